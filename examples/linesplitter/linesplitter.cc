@@ -17,6 +17,7 @@
 
 #include <cerrno>
 #include <cstdint>
+#include <cstring>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -25,14 +26,14 @@
 
 #include "linesplitter.h"
 
+// memchr() is vectorized by common C libraries
 static int64_t find_newline(const ArrowStringView& src) {
-  for (int64_t i = 0; i < src.size_bytes; i++) {
-    if (src.data[i] == '\n') {
-      return i;
-    }
+  const void* newline = memchr(src.data, '\n', static_cast<size_t>(src.size_bytes));
+  if (newline == nullptr) {
+    return src.size_bytes;
   }
 
-  return src.size_bytes;
+  return static_cast<const char*>(newline) - src.data;
 }
 
 static int linesplitter_read_internal(const std::string& src, ArrowArray* out,
@@ -43,10 +44,14 @@ static int linesplitter_read_internal(const std::string& src, ArrowArray* out,
 
   ArrowStringView src_view = {src.data(), static_cast<int64_t>(src.size())};
   ArrowStringView line_view;
-  int64_t next_newline = -1;
-  while ((next_newline = find_newline(src_view)) >= 0) {
+  while (true) {
+    int64_t next_newline = find_newline(src_view);
     line_view = {src_view.data, next_newline};
     NANOARROW_RETURN_NOT_OK(ArrowArrayAppendString(tmp.get(), line_view));
+    if (next_newline == src_view.size_bytes) {
+      break;
+    }
+
     src_view.data += next_newline + 1;
     src_view.size_bytes -= next_newline + 1;
   }
@@ -67,6 +72,132 @@ std::pair<int, std::string> linesplitter_read(const std::string& src, ArrowArray
   }
 }
 
+class LinesplitterArrayStream : public nanoarrow::EmptyArrayStream {
+ public:
+  static int Make(linesplitter_read_fn read, int64_t chunk_size,
+                        ArrowArrayStream* out, ArrowError* error) {
+    if (chunk_size <= 0 || chunk_size > INT32_MAX) {
+      ArrowErrorSet(error, "Expected chunk_size between 1 and %ld but found %ld",
+                    static_cast<long>(INT32_MAX), static_cast<long>(chunk_size));
+      return EINVAL;
+    }
+
+    nanoarrow::UniqueSchema schema;
+    NANOARROW_RETURN_NOT_OK(ArrowSchemaInitFromType(schema.get(), NANOARROW_TYPE_STRING));
+    (new LinesplitterArrayStream(schema.get(), std::move(read), chunk_size))
+        ->MakeStream(out);
+    return NANOARROW_OK;
+  }
+
+ protected:
+  LinesplitterArrayStream(ArrowSchema* schema, linesplitter_read_fn read,
+                          int64_t chunk_size)
+      : EmptyArrayStream(schema),
+        read_(std::move(read)),
+        chunk_size_(chunk_size),
+        finished_(false) {}
+
+  int get_next(ArrowArray* array) override {
+    if (finished_) {
+      array->release = nullptr;
+      return NANOARROW_OK;
+    }
+
+    // The partial line at the end of the previous chunk (which contains no newline)
+    // starts the data buffer of this array
+    nanoarrow::UniqueBuffer data;
+    nanoarrow::UniqueBuffer offsets;
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferAppend(data.get(), carry_->data, carry_->size_bytes));
+    NANOARROW_RETURN_NOT_OK(ArrowBufferAppendInt32(offsets.get(), 0));
+    int64_t n_lines = 0;
+    int64_t end = 0;
+
+    // Read chunks until at least one line ends or the input ends
+    while (n_lines == 0) {
+      int64_t scan_start = data->size_bytes;
+      if ((scan_start + chunk_size_) > INT32_MAX) {
+        ArrowErrorSet(&error_, "Line of %ld or more bytes does not fit in a string array",
+                      static_cast<long>(scan_start));
+        return EOVERFLOW;
+      }
+
+      NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(data.get(), chunk_size_));
+      int64_t size_read = read_(data->data + data->size_bytes, chunk_size_);
+      if (size_read < 0) {
+        ArrowErrorSet(&error_, "Failed to read input: %s",
+                      std::strerror(static_cast<int>(-size_read)));
+        return static_cast<int>(-size_read);
+      } else if (size_read == 0) {
+        finished_ = true;
+        break;
+      }
+
+      data->size_bytes += size_read;
+
+      // Only the offsets of the lines in the chunk are built
+      const char* chunk = reinterpret_cast<const char*>(data->data);
+      ArrowStringView remaining = {chunk + scan_start, size_read};
+      int64_t next_newline;
+      while ((next_newline = find_newline(remaining)) < remaining.size_bytes) {
+        end = (remaining.data - chunk) + next_newline + 1;
+        NANOARROW_RETURN_NOT_OK(
+            ArrowBufferAppendInt32(offsets.get(), static_cast<int32_t>(end)));
+        n_lines++;
+        remaining.data += next_newline + 1;
+        remaining.size_bytes -= next_newline + 1;
+      }
+    }
+
+    // The last line of the input need not end with a newline
+    if (finished_ && end < data->size_bytes) {
+      end = data->size_bytes;
+      NANOARROW_RETURN_NOT_OK(
+          ArrowBufferAppendInt32(offsets.get(), static_cast<int32_t>(end)));
+      n_lines++;
+    }
+
+    carry_->size_bytes = 0;
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferAppend(carry_.get(), data->data + end, data->size_bytes - end));
+    data->size_bytes = end;
+
+    if (n_lines == 0) {
+      array->release = nullptr;
+      return NANOARROW_OK;
+    }
+
+    nanoarrow::UniqueArray tmp;
+    NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(tmp.get(), NANOARROW_TYPE_STRING));
+    NANOARROW_RETURN_NOT_OK(ArrowArraySetBuffer(tmp.get(), 1, offsets.get()));
+    NANOARROW_RETURN_NOT_OK(ArrowArraySetBuffer(tmp.get(), 2, data.get()));
+    tmp->length = n_lines;
+    tmp->null_count = 0;
+    NANOARROW_RETURN_NOT_OK(ArrowArrayFinishBuildingDefault(tmp.get(), &error_));
+
+    ArrowArrayMove(tmp.get(), array);
+    return NANOARROW_OK;
+  }
+
+ private:
+  linesplitter_read_fn read_;
+  int64_t chunk_size_;
+  bool finished_;
+  nanoarrow::UniqueBuffer carry_;
+};
+
+std::pair<int, std::string> linesplitter_read_stream(linesplitter_read_fn read,
+                                                     int64_t chunk_size,
+                                                     ArrowArrayStream* out) {
+  ArrowError error;
+  int code = LinesplitterArrayStream::Make(std::move(read), chunk_size, out, &error);
+  if (code != NANOARROW_OK) {
+    return {code, std::string(ArrowErrorMessage(&error))};
+  } else {
+    return {NANOARROW_OK, ""};
+  }
+}
+
 static int linesplitter_write_internal(ArrowArray* input, std::stringstream& out,
                                        ArrowError* error) {
   nanoarrow::UniqueArrayView input_view;
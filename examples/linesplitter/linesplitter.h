@@ -18,6 +18,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <functional>
 #include <string>
 #include <utility>
 
@@ -63,6 +64,24 @@ struct ArrowArray {
 
 #endif  // ARROW_C_DATA_INTERFACE
 
+#ifndef ARROW_C_STREAM_INTERFACE
+#define ARROW_C_STREAM_INTERFACE
+
+struct ArrowArrayStream {
+  // Callbacks providing stream functionality
+  int (*get_schema)(struct ArrowArrayStream*, struct ArrowSchema* out);
+  int (*get_next)(struct ArrowArrayStream*, struct ArrowArray* out);
+  const char* (*get_last_error)(struct ArrowArrayStream*);
+
+  // Release callback
+  void (*release)(struct ArrowArrayStream*);
+
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+#endif  // ARROW_C_STREAM_INTERFACE
+
 // Builds an ArrowArray of type string that will contain one element for each line
 // in src and places it into out.
 //
@@ -70,6 +89,23 @@ struct ArrowArray {
 std::pair<int, std::string> linesplitter_read(const std::string& src,
                                               struct ArrowArray* out);
 
+// Reads up to size_bytes bytes of input into dst and returns the number of bytes
+// read, zero at the end of the input, or a negative errno code on error.
+using linesplitter_read_fn = std::function<int64_t(uint8_t* dst, int64_t size_bytes)>;
+
+// Builds an ArrowArrayStream of string arrays that contain one element for each line
+// of the input from read and places it into out. Input is read in chunks of
+// chunk_size bytes directly into the data buffer of the next array, such that only
+// the offsets are built: each element includes its trailing newline (as the offsets
+// of a string array must be contiguous) and only the partial line at the end of a
+// chunk is copied to the start of the next array. Each array contains the lines that
+// end in one or more chunks (more than one if a line spans them).
+//
+// On success, returns {0, ""}; on error, returns {<errno code>, <error message>}
+std::pair<int, std::string> linesplitter_read_stream(linesplitter_read_fn read,
+                                                     int64_t chunk_size,
+                                                     struct ArrowArrayStream* out);
+
 // Concatenates all elements of a string ArrowArray inserting a newline between
 // elements.
 //
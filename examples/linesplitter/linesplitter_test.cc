@@ -15,6 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <nanoarrow/nanoarrow.hpp>
@@ -47,3 +53,53 @@ TEST(Linesplitter, LinesplitterRoundtrip) {
   ASSERT_EQ(result2.first, 0);
   ASSERT_EQ(result2.second, "line1\nline2\nline3\n");
 }
+
+TEST(Linesplitter, LinesplitterReadStream) {
+  std::string src = "line1\nline2\n\na line longer than a chunk\nlast";
+  size_t pos = 0;
+  auto read = [&](uint8_t* dst, int64_t size_bytes) -> int64_t {
+    int64_t n = std::min<int64_t>(size_bytes, src.size() - pos);
+    memcpy(dst, src.data() + pos, n);
+    pos += n;
+    return n;
+  };
+
+  nanoarrow::UniqueArrayStream stream;
+  auto result = linesplitter_read_stream(read, 8, stream.get());
+  ASSERT_EQ(result.first, 0);
+  ASSERT_EQ(result.second, "");
+
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  ArrowArrayViewInitFromType(array_view.get(), NANOARROW_TYPE_STRING);
+  std::vector<std::string> lines;
+  int64_t n_arrays = 0;
+  while (true) {
+    ASSERT_EQ(stream->get_next(stream.get(), array.get()), 0);
+    if (array->release == nullptr) {
+      break;
+    }
+
+    n_arrays++;
+    ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr), 0);
+    for (int64_t i = 0; i < array->length; i++) {
+      ArrowStringView item = ArrowArrayViewGetStringUnsafe(array_view.get(), i);
+      lines.push_back(std::string(item.data, item.size_bytes));
+    }
+    array.reset();
+  }
+
+  // Lines keep their newline and are never split across arrays
+  EXPECT_EQ(lines, std::vector<std::string>({"line1\n", "line2\n", "\n",
+                                             "a line longer than a chunk\n", "last"}));
+  EXPECT_GT(n_arrays, 1);
+
+  auto fail = [](uint8_t*, int64_t) -> int64_t { return -EIO; };
+  stream.reset();
+  ASSERT_EQ(linesplitter_read_stream(fail, 8, stream.get()).first, 0);
+  EXPECT_EQ(stream->get_next(stream.get(), array.get()), EIO);
+  EXPECT_EQ(std::string(stream->get_last_error(stream.get())),
+            std::string("Failed to read input: ") + std::strerror(EIO));
+
+  EXPECT_EQ(linesplitter_read_stream(read, 0, stream.get()).first, EINVAL);
+}
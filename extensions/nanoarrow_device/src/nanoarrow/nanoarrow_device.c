@@ -19,6 +19,7 @@
 
 #include "nanoarrow.h"
 
+#include "nanoarrow_atomic_internal.h"
 #include "nanoarrow_device.h"
 
 ArrowErrorCode ArrowDeviceCheckRuntime(struct ArrowError* error) {
@@ -128,10 +129,29 @@ void ArrowDeviceInitCpu(struct ArrowDevice* device) {
 
 #ifdef NANOARROW_DEVICE_WITH_METAL
 struct ArrowDevice* ArrowDeviceMetalDefaultDevice(void);
+struct ArrowBufferAllocator ArrowDeviceMetalAllocator(void);
 #endif
 
 #ifdef NANOARROW_DEVICE_WITH_CUDA
 struct ArrowDevice* ArrowDeviceCuda(ArrowDeviceType device_type, int64_t device_id);
+ArrowErrorCode ArrowDeviceCudaBufferCopyManyToCpu(struct ArrowDevice* device_src,
+                                                  const struct ArrowBufferView* src,
+                                                  struct ArrowBufferView* dst,
+                                                  int64_t n);
+ArrowErrorCode ArrowDeviceCudaAllocateBuffer(struct ArrowDevice* device,
+                                             struct ArrowBuffer* buffer,
+                                             int64_t size_bytes);
+ArrowErrorCode ArrowDeviceCudaAllocator(struct ArrowDevice* device,
+                                        struct ArrowBufferAllocator* out);
+#endif
+
+#ifdef NANOARROW_DEVICE_WITH_ROCM
+struct ArrowDevice* ArrowDeviceRocm(ArrowDeviceType device_type, int64_t device_id);
+ArrowErrorCode ArrowDeviceRocmAllocateBuffer(struct ArrowDevice* device,
+                                             struct ArrowBuffer* buffer,
+                                             int64_t size_bytes);
+ArrowErrorCode ArrowDeviceRocmAllocator(struct ArrowDevice* device,
+                                        struct ArrowBufferAllocator* out);
 #endif
 
 struct ArrowDevice* ArrowDeviceResolve(ArrowDeviceType device_type, int64_t device_id) {
@@ -154,6 +174,12 @@ struct ArrowDevice* ArrowDeviceResolve(ArrowDeviceType device_type, int64_t devi
   }
 #endif
 
+#ifdef NANOARROW_DEVICE_WITH_ROCM
+  if (device_type == ARROW_DEVICE_ROCM || device_type == ARROW_DEVICE_ROCM_HOST) {
+    return ArrowDeviceRocm(device_type, device_id);
+  }
+#endif
+
   return NULL;
 }
 
@@ -204,6 +230,59 @@ ArrowErrorCode ArrowDeviceBufferCopy(struct ArrowDevice* device_src,
   return result;
 }
 
+ArrowErrorCode ArrowDeviceAllocator(struct ArrowDevice* device,
+                                    struct ArrowBufferAllocator* out) {
+  switch (device->device_type) {
+    case ARROW_DEVICE_CPU:
+      *out = ArrowBufferAllocatorDefault();
+      return NANOARROW_OK;
+#ifdef NANOARROW_DEVICE_WITH_METAL
+    case ARROW_DEVICE_METAL:
+      *out = ArrowDeviceMetalAllocator();
+      return NANOARROW_OK;
+#endif
+#ifdef NANOARROW_DEVICE_WITH_CUDA
+    case ARROW_DEVICE_CUDA:
+    case ARROW_DEVICE_CUDA_HOST:
+      return ArrowDeviceCudaAllocator(device, out);
+#endif
+#ifdef NANOARROW_DEVICE_WITH_ROCM
+    case ARROW_DEVICE_ROCM:
+    case ARROW_DEVICE_ROCM_HOST:
+      return ArrowDeviceRocmAllocator(device, out);
+#endif
+    default:
+      return ENOTSUP;
+  }
+}
+
+ArrowErrorCode ArrowDeviceArrayInitFromSchema(struct ArrowDevice* device,
+                                              struct ArrowArray* array,
+                                              struct ArrowSchema* schema,
+                                              struct ArrowError* error) {
+  struct ArrowBufferAllocator allocator;
+  int result = ArrowDeviceAllocator(device, &allocator);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "Device type %d does not provide a CPU-writable allocator",
+                  (int)device->device_type);
+    return result;
+  }
+
+  struct ArrowArray tmp;
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromSchema(&tmp, schema, error));
+
+  result = ArrowArraySetAllocator(&tmp, allocator);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "Failed to set the allocator of device type %d",
+                  (int)device->device_type);
+    tmp.release(&tmp);
+    return result;
+  }
+
+  ArrowArrayMove(&tmp, array);
+  return NANOARROW_OK;
+}
+
 struct ArrowBasicDeviceArrayStreamPrivate {
   struct ArrowDevice* device;
   struct ArrowArrayStream naive_stream;
@@ -280,43 +359,42 @@ void ArrowDeviceArrayViewReset(struct ArrowDeviceArrayView* device_array_view) {
   device_array_view->device = NULL;
 }
 
-static ArrowErrorCode ArrowDeviceBufferGetInt32(struct ArrowDevice* device,
-                                                struct ArrowBufferView buffer_view,
-                                                int64_t i, int32_t* out) {
-  struct ArrowBufferView out_view;
-  out_view.data.as_int32 = out;
-  out_view.size_bytes = sizeof(int32_t);
-
-  struct ArrowBufferView device_buffer_view;
-  device_buffer_view.data.as_int32 = buffer_view.data.as_int32 + i;
-  device_buffer_view.size_bytes = sizeof(int32_t);
-  NANOARROW_RETURN_NOT_OK(
-      ArrowDeviceBufferCopy(device, device_buffer_view, ArrowDeviceCpu(), out_view));
-  return NANOARROW_OK;
-}
+// Copies n sections of memory on device to the CPU. Devices whose copies each require
+// a round trip (i.e., CUDA) gather them such that all are resolved with one.
+static ArrowErrorCode ArrowDeviceBufferCopyManyToCpu(struct ArrowDevice* device,
+                                                     const struct ArrowBufferView* src,
+                                                     struct ArrowBufferView* dst,
+                                                     int64_t n) {
+#ifdef NANOARROW_DEVICE_WITH_CUDA
+  if (device->device_type == ARROW_DEVICE_CUDA && n > 1) {
+    return ArrowDeviceCudaBufferCopyManyToCpu(device, src, dst, n);
+  }
+#endif
 
-static ArrowErrorCode ArrowDeviceBufferGetInt64(struct ArrowDevice* device,
-                                                struct ArrowBufferView buffer_view,
-                                                int64_t i, int64_t* out) {
-  struct ArrowBufferView out_view;
-  out_view.data.as_int64 = out;
-  out_view.size_bytes = sizeof(int64_t);
+  for (int64_t i = 0; i < n; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowDeviceBufferCopy(device, src[i], ArrowDeviceCpu(), dst[i]));
+  }
 
-  struct ArrowBufferView device_buffer_view;
-  device_buffer_view.data.as_int64 = buffer_view.data.as_int64 + i;
-  device_buffer_view.size_bytes = sizeof(int64_t);
-  NANOARROW_RETURN_NOT_OK(
-      ArrowDeviceBufferCopy(device, device_buffer_view, ArrowDeviceCpu(), out_view));
   return NANOARROW_OK;
 }
 
-static ArrowErrorCode ArrowDeviceArrayViewResolveBufferSizes(
-    struct ArrowDevice* device, struct ArrowArrayView* array_view) {
-  // Calculate buffer sizes that require accessing the offset buffer
-  // (at this point all other sizes have been resolved).
+// A variable-length buffer whose size is the last value of an offsets buffer that has
+// to be copied from the device
+struct ArrowDeviceLastOffset {
+  struct ArrowArrayView* array_view;
+  struct ArrowBufferView src;
+  union {
+    int32_t as_int32;
+    int64_t as_int64;
+  } value;
+};
+
+static ArrowErrorCode ArrowDeviceArrayViewCollectLastOffsets(
+    struct ArrowArrayView* array_view, struct ArrowBuffer* last_offsets) {
   int64_t offset_plus_length = array_view->offset + array_view->length;
-  int32_t last_offset32;
-  int64_t last_offset64;
+  struct ArrowDeviceLastOffset last_offset;
+  last_offset.array_view = array_view;
 
   switch (array_view->storage_type) {
     case NANOARROW_TYPE_STRING:
@@ -324,9 +402,11 @@ static ArrowErrorCode ArrowDeviceArrayViewResolveBufferSizes(
       if (array_view->buffer_views[1].size_bytes == 0) {
         array_view->buffer_views[2].size_bytes = 0;
       } else if (array_view->buffer_views[2].size_bytes == -1) {
-        NANOARROW_RETURN_NOT_OK(ArrowDeviceBufferGetInt32(
-            device, array_view->buffer_views[1], offset_plus_length, &last_offset32));
-        array_view->buffer_views[2].size_bytes = last_offset32;
+        last_offset.src.data.as_int32 =
+            array_view->buffer_views[1].data.as_int32 + offset_plus_length;
+        last_offset.src.size_bytes = sizeof(int32_t);
+        NANOARROW_RETURN_NOT_OK(
+            ArrowBufferAppend(last_offsets, &last_offset, sizeof(last_offset)));
       }
       break;
 
@@ -335,9 +415,11 @@ static ArrowErrorCode ArrowDeviceArrayViewResolveBufferSizes(
       if (array_view->buffer_views[1].size_bytes == 0) {
         array_view->buffer_views[2].size_bytes = 0;
       } else if (array_view->buffer_views[2].size_bytes == -1) {
-        NANOARROW_RETURN_NOT_OK(ArrowDeviceBufferGetInt64(
-            device, array_view->buffer_views[1], offset_plus_length, &last_offset64));
-        array_view->buffer_views[2].size_bytes = last_offset64;
+        last_offset.src.data.as_int64 =
+            array_view->buffer_views[1].data.as_int64 + offset_plus_length;
+        last_offset.src.size_bytes = sizeof(int64_t);
+        NANOARROW_RETURN_NOT_OK(
+            ArrowBufferAppend(last_offsets, &last_offset, sizeof(last_offset)));
       }
       break;
     default:
@@ -347,12 +429,58 @@ static ArrowErrorCode ArrowDeviceArrayViewResolveBufferSizes(
   // Recurse for children
   for (int64_t i = 0; i < array_view->n_children; i++) {
     NANOARROW_RETURN_NOT_OK(
-        ArrowDeviceArrayViewResolveBufferSizes(device, array_view->children[i]));
+        ArrowDeviceArrayViewCollectLastOffsets(array_view->children[i], last_offsets));
   }
 
   return NANOARROW_OK;
 }
 
+// Calculate buffer sizes that require accessing the offset buffer (at this point all
+// other sizes have been resolved). The last offsets of every array in the tree are
+// copied from the device together rather than one at a time.
+static ArrowErrorCode ArrowDeviceArrayViewResolveBufferSizes(
+    struct ArrowDevice* device, struct ArrowArrayView* array_view) {
+  struct ArrowBuffer last_offsets;
+  ArrowBufferInit(&last_offsets);
+  struct ArrowBuffer views;
+  ArrowBufferInit(&views);
+
+  int result = ArrowDeviceArrayViewCollectLastOffsets(array_view, &last_offsets);
+  struct ArrowDeviceLastOffset* items = (struct ArrowDeviceLastOffset*)last_offsets.data;
+  int64_t n = last_offsets.size_bytes / (int64_t)sizeof(struct ArrowDeviceLastOffset);
+
+  if (result == NANOARROW_OK && n > 0) {
+    result = ArrowBufferReserve(&views, 2 * n * sizeof(struct ArrowBufferView));
+  }
+
+  if (result == NANOARROW_OK && n > 0) {
+    struct ArrowBufferView* src = (struct ArrowBufferView*)views.data;
+    struct ArrowBufferView* dst = src + n;
+    for (int64_t i = 0; i < n; i++) {
+      src[i] = items[i].src;
+      dst[i].data.data = &items[i].value;
+      dst[i].size_bytes = items[i].src.size_bytes;
+    }
+
+    result = ArrowDeviceBufferCopyManyToCpu(device, src, dst, n);
+  }
+
+  if (result == NANOARROW_OK) {
+    for (int64_t i = 0; i < n; i++) {
+      struct ArrowBufferView* data_view = items[i].array_view->buffer_views + 2;
+      if (items[i].src.size_bytes == sizeof(int32_t)) {
+        data_view->size_bytes = items[i].value.as_int32;
+      } else {
+        data_view->size_bytes = items[i].value.as_int64;
+      }
+    }
+  }
+
+  ArrowBufferReset(&views);
+  ArrowBufferReset(&last_offsets);
+  return result;
+}
+
 ArrowErrorCode ArrowDeviceArrayViewSetArrayMinimal(
     struct ArrowDeviceArrayView* device_array_view, struct ArrowDeviceArray* device_array,
     struct ArrowError* error) {
@@ -402,8 +530,8 @@ static ArrowErrorCode ArrowDeviceArrayViewCopyInternal(struct ArrowDevice* devic
                                                        struct ArrowArrayView* src,
                                                        struct ArrowDevice* device_dst,
                                                        struct ArrowArray* dst) {
-  // Currently no attempt to minimize the amount of memory copied (i.e.,
-  // by applying offset + length and copying potentially fewer bytes)
+  // Copies every buffer in its entirety (see ArrowDeviceArrayViewCopyRange() for
+  // the copy used when only part of them is referenced)
   dst->length = src->length;
   dst->offset = src->offset;
   dst->null_count = src->null_count;
@@ -430,14 +558,239 @@ static ArrowErrorCode ArrowDeviceArrayViewCopyInternal(struct ArrowDevice* devic
   return NANOARROW_OK;
 }
 
+// Checks that every buffer of array_view and the children whose elements correspond
+// to its elements can be copied in part by ArrowDeviceArrayViewCopyRange()
+static int ArrowDeviceArrayViewCanCopyRange(struct ArrowArrayView* array_view) {
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_RUN_END_ENCODED:
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_STRING_VIEW:
+      return 0;
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY:
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY:
+    case NANOARROW_TYPE_DENSE_UNION:
+      // The data buffer or children are referenced through the offsets
+      return 1;
+    default:
+      break;
+  }
+
+  for (int i = 0; i < 3; i++) {
+    int64_t element_size_bits = array_view->layout.element_size_bits[i];
+    if (array_view->layout.buffer_type[i] == NANOARROW_BUFFER_TYPE_DATA &&
+        (element_size_bits <= 0 || (element_size_bits != 1 && element_size_bits % 8))) {
+      return 0;
+    }
+  }
+
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    if (!ArrowDeviceArrayViewCanCopyRange(array_view->children[i])) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+// Copies size_bytes of src starting at offset_bytes to a new buffer on device_dst
+static ArrowErrorCode ArrowDeviceBufferInitSection(struct ArrowDevice* device_src,
+                                                   struct ArrowBufferView src,
+                                                   int64_t offset_bytes,
+                                                   int64_t size_bytes,
+                                                   struct ArrowDevice* device_dst,
+                                                   struct ArrowBuffer* dst) {
+  if (size_bytes == 0) {
+    return NANOARROW_OK;
+  }
+
+  if (offset_bytes < 0 || size_bytes < 0 ||
+      (src.size_bytes >= 0 && (offset_bytes + size_bytes) > src.size_bytes)) {
+    return EINVAL;
+  }
+
+  src.data.as_uint8 += offset_bytes;
+  src.size_bytes = size_bytes;
+  return ArrowDeviceBufferInit(device_src, src, device_dst, dst);
+}
+
+// Copies n_offsets values of an offsets buffer starting at the offset_elements-th to
+// a new buffer on device_dst, rebased such that the first is zero. The offsets are
+// always made on the CPU (where the first and last values that delimit the data or
+// child elements they refer to are also read).
+static ArrowErrorCode ArrowDeviceOffsetsInitSection(
+    struct ArrowDevice* device_src, struct ArrowBufferView src, int64_t offset_elements,
+    int64_t n_offsets, int64_t element_size_bytes, struct ArrowDevice* device_dst,
+    struct ArrowBuffer* dst, int64_t* first, int64_t* last) {
+  *first = 0;
+  *last = 0;
+
+  // A zero-length array may omit its offsets buffer
+  if (src.size_bytes == 0) {
+    return NANOARROW_OK;
+  }
+
+  struct ArrowBuffer offsets;
+  ArrowBufferInit(&offsets);
+  NANOARROW_RETURN_NOT_OK(ArrowDeviceBufferInitSection(
+      device_src, src, offset_elements * element_size_bytes,
+      n_offsets * element_size_bytes, ArrowDeviceCpu(), &offsets));
+
+  if (element_size_bytes == sizeof(int32_t)) {
+    int32_t* values = (int32_t*)offsets.data;
+    *first = values[0];
+    *last = values[n_offsets - 1];
+    for (int64_t i = 0; i < n_offsets; i++) {
+      values[i] -= (int32_t)*first;
+    }
+  } else {
+    int64_t* values = (int64_t*)offsets.data;
+    *first = values[0];
+    *last = values[n_offsets - 1];
+    for (int64_t i = 0; i < n_offsets; i++) {
+      values[i] -= *first;
+    }
+  }
+
+  if (*first < 0 || *last < *first) {
+    ArrowBufferReset(&offsets);
+    return EINVAL;
+  }
+
+  if (device_dst->device_type == ARROW_DEVICE_CPU) {
+    ArrowBufferMove(&offsets, dst);
+    return NANOARROW_OK;
+  }
+
+  struct ArrowBufferView offsets_view;
+  offsets_view.data.data = offsets.data;
+  offsets_view.size_bytes = offsets.size_bytes;
+  int result = ArrowDeviceBufferInit(ArrowDeviceCpu(), offsets_view, device_dst, dst);
+  ArrowBufferReset(&offsets);
+  return result;
+}
+
+// Copies the length elements of src starting at physical index offset (i.e., including
+// src->offset). The copy starts at the closest preceding byte boundary of any bitmap
+// such that bitmaps never have to be shifted: dst->offset is offset % 8 and dst's
+// first dst->offset elements are not part of the range. Offsets are rebased such that
+// only the data or child elements referenced by the range are copied.
+static ArrowErrorCode ArrowDeviceArrayViewCopyRange(struct ArrowDevice* device_src,
+                                                    struct ArrowArrayView* src,
+                                                    int64_t offset, int64_t length,
+                                                    struct ArrowDevice* device_dst,
+                                                    struct ArrowArray* dst) {
+  int64_t bit_offset = offset % 8;
+  int64_t start = offset - bit_offset;
+  int64_t n_elements = bit_offset + length;
+
+  dst->length = length;
+  dst->offset = bit_offset;
+  if (src->null_count == 0 || (offset == src->offset && length == src->length)) {
+    dst->null_count = src->null_count;
+  } else {
+    dst->null_count = -1;
+  }
+
+  // The range of the data buffer or child referenced by the offsets buffer (if any)
+  int64_t first = 0;
+  int64_t last = 0;
+
+  for (int i = 0; i < 3; i++) {
+    struct ArrowBufferView src_view = src->buffer_views[i];
+    struct ArrowBuffer* dst_buffer = ArrowArrayBuffer(dst, i);
+    int64_t element_size_bits = src->layout.element_size_bits[i];
+
+    switch (src->layout.buffer_type[i]) {
+      case NANOARROW_BUFFER_TYPE_NONE:
+        break;
+      case NANOARROW_BUFFER_TYPE_DATA_OFFSET:
+        NANOARROW_RETURN_NOT_OK(ArrowDeviceOffsetsInitSection(
+            device_src, src_view, start, n_elements + 1, element_size_bits / 8,
+            device_dst, dst_buffer, &first, &last));
+        break;
+      case NANOARROW_BUFFER_TYPE_DATA:
+        if (src->storage_type == NANOARROW_TYPE_STRING ||
+            src->storage_type == NANOARROW_TYPE_BINARY ||
+            src->storage_type == NANOARROW_TYPE_LARGE_STRING ||
+            src->storage_type == NANOARROW_TYPE_LARGE_BINARY) {
+          NANOARROW_RETURN_NOT_OK(ArrowDeviceBufferInitSection(
+              device_src, src_view, first, last - first, device_dst, dst_buffer));
+          break;
+        }
+        // fall through
+      default:
+        // Validity or data bitmaps, type ids, union offsets, and fixed-width data
+        if (element_size_bits == 1 && src_view.size_bytes != 0) {
+          NANOARROW_RETURN_NOT_OK(
+              ArrowDeviceBufferInitSection(device_src, src_view, start / 8,
+                                           (n_elements + 7) / 8, device_dst, dst_buffer));
+        } else if (src_view.size_bytes != 0) {
+          NANOARROW_RETURN_NOT_OK(ArrowDeviceBufferInitSection(
+              device_src, src_view, start * (element_size_bits / 8),
+              n_elements * (element_size_bits / 8), device_dst, dst_buffer));
+        }
+        break;
+    }
+  }
+
+  for (int64_t i = 0; i < src->n_children; i++) {
+    struct ArrowArrayView* child = src->children[i];
+    switch (src->storage_type) {
+      case NANOARROW_TYPE_LIST:
+      case NANOARROW_TYPE_LARGE_LIST:
+      case NANOARROW_TYPE_MAP:
+        NANOARROW_RETURN_NOT_OK(ArrowDeviceArrayViewCopyRange(
+            device_src, child, child->offset + first, last - first, device_dst,
+            dst->children[i]));
+        break;
+      case NANOARROW_TYPE_FIXED_SIZE_LIST:
+        NANOARROW_RETURN_NOT_OK(ArrowDeviceArrayViewCopyRange(
+            device_src, child, child->offset + start * src->layout.child_size_elements,
+            n_elements * src->layout.child_size_elements, device_dst,
+            dst->children[i]));
+        break;
+      case NANOARROW_TYPE_DENSE_UNION:
+        // Union offsets are not ordered, so children are copied in their entirety
+        NANOARROW_RETURN_NOT_OK(ArrowDeviceArrayViewCopyInternal(device_src, child,
+                                                                 device_dst,
+                                                                 dst->children[i]));
+        break;
+      default:
+        // Struct and sparse union children have an element for each element
+        NANOARROW_RETURN_NOT_OK(ArrowDeviceArrayViewCopyRange(
+            device_src, child, child->offset + start, n_elements, device_dst,
+            dst->children[i]));
+        break;
+    }
+  }
+
+  // Dictionary values may be referenced by any index
+  if (src->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowDeviceArrayViewCopyInternal(
+        device_src, src->dictionary, device_dst, dst->dictionary));
+  }
+
+  return NANOARROW_OK;
+}
+
 ArrowErrorCode ArrowDeviceArrayViewCopy(struct ArrowDeviceArrayView* src,
                                         struct ArrowDevice* device_dst,
                                         struct ArrowDeviceArray* dst) {
   struct ArrowArray tmp;
   NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromArrayView(&tmp, &src->array_view, NULL));
 
-  int result =
-      ArrowDeviceArrayViewCopyInternal(src->device, &src->array_view, device_dst, &tmp);
+  int result;
+  if (ArrowDeviceArrayViewCanCopyRange(&src->array_view)) {
+    result = ArrowDeviceArrayViewCopyRange(src->device, &src->array_view,
+                                           src->array_view.offset,
+                                           src->array_view.length, device_dst, &tmp);
+  } else {
+    result =
+        ArrowDeviceArrayViewCopyInternal(src->device, &src->array_view, device_dst, &tmp);
+  }
+
   if (result != NANOARROW_OK) {
     tmp.release(&tmp);
     return result;
@@ -458,6 +811,249 @@ ArrowErrorCode ArrowDeviceArrayViewCopy(struct ArrowDeviceArrayView* src,
   return result;
 }
 
+// Buffers of a coalesced copy start at a multiple of this many bytes from the start
+// of the allocation they share
+#define NANOARROW_DEVICE_COALESCED_ALIGNMENT 64
+
+// One allocation whose sections are the buffers of a coalesced copy. Each buffer
+// holds one reference and the allocation is freed when the last is released.
+struct ArrowDeviceSharedBuffer {
+  struct ArrowBuffer buffer;
+  ArrowRefCount n_references;
+};
+
+static void ArrowDeviceSharedBufferFree(struct ArrowBufferAllocator* allocator,
+                                        uint8_t* ptr, int64_t size) {
+  struct ArrowDeviceSharedBuffer* shared =
+      (struct ArrowDeviceSharedBuffer*)allocator->private_data;
+
+  if (ArrowRefCountAdd(&shared->n_references, -1) == 0) {
+    ArrowBufferReset(&shared->buffer);
+    ArrowFree(shared);
+  }
+}
+
+static int64_t ArrowDeviceCoalescedAlign(int64_t offset) {
+  return (offset + NANOARROW_DEVICE_COALESCED_ALIGNMENT - 1) &
+         ~((int64_t)NANOARROW_DEVICE_COALESCED_ALIGNMENT - 1);
+}
+
+// Computes the size of an allocation that can hold all non-empty buffers of
+// array_view and its children and dictionary
+static ArrowErrorCode ArrowDeviceArrayViewCoalescedSize(struct ArrowArrayView* array_view,
+                                                        int64_t* size_bytes,
+                                                        int64_t* n_buffers) {
+  for (int i = 0; i < 3; i++) {
+    if (array_view->layout.buffer_type[i] == NANOARROW_BUFFER_TYPE_NONE) {
+      break;
+    }
+
+    int64_t buffer_size = array_view->buffer_views[i].size_bytes;
+    if (buffer_size < 0) {
+      return EINVAL;
+    } else if (buffer_size > 0) {
+      *size_bytes = ArrowDeviceCoalescedAlign(*size_bytes) + buffer_size;
+      (*n_buffers)++;
+    }
+  }
+
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowDeviceArrayViewCoalescedSize(array_view->children[i],
+                                                              size_bytes, n_buffers));
+  }
+
+  if (array_view->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowDeviceArrayViewCoalescedSize(array_view->dictionary, size_bytes, n_buffers));
+  }
+
+  return NANOARROW_OK;
+}
+
+// Copies the buffers of array_view into staging in the order (and at the offsets)
+// counted by ArrowDeviceArrayViewCoalescedSize()
+static void ArrowDeviceArrayViewCoalescedPack(struct ArrowArrayView* array_view,
+                                              uint8_t* staging, int64_t* offset) {
+  for (int i = 0; i < 3; i++) {
+    if (array_view->layout.buffer_type[i] == NANOARROW_BUFFER_TYPE_NONE) {
+      break;
+    }
+
+    struct ArrowBufferView src = array_view->buffer_views[i];
+    if (src.size_bytes > 0) {
+      *offset = ArrowDeviceCoalescedAlign(*offset);
+      memcpy(staging + *offset, src.data.data, (size_t)src.size_bytes);
+      *offset += src.size_bytes;
+    }
+  }
+
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    ArrowDeviceArrayViewCoalescedPack(array_view->children[i], staging, offset);
+  }
+
+  if (array_view->dictionary != NULL) {
+    ArrowDeviceArrayViewCoalescedPack(array_view->dictionary, staging, offset);
+  }
+}
+
+// Points each buffer of dst at its section of the shared allocation
+static void ArrowDeviceArrayViewCoalescedAssign(struct ArrowArrayView* array_view,
+                                                struct ArrowDeviceSharedBuffer* shared,
+                                                int64_t* offset, struct ArrowArray* dst) {
+  dst->length = array_view->length;
+  dst->offset = array_view->offset;
+  dst->null_count = array_view->null_count;
+
+  for (int i = 0; i < 3; i++) {
+    if (array_view->layout.buffer_type[i] == NANOARROW_BUFFER_TYPE_NONE) {
+      break;
+    }
+
+    int64_t buffer_size = array_view->buffer_views[i].size_bytes;
+    if (buffer_size > 0) {
+      *offset = ArrowDeviceCoalescedAlign(*offset);
+      struct ArrowBuffer* buffer = ArrowArrayBuffer(dst, i);
+      buffer->data = shared->buffer.data + *offset;
+      buffer->size_bytes = buffer_size;
+      buffer->capacity_bytes = buffer_size;
+      buffer->allocator = ArrowBufferDeallocator(&ArrowDeviceSharedBufferFree, shared);
+      *offset += buffer_size;
+    }
+  }
+
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    ArrowDeviceArrayViewCoalescedAssign(array_view->children[i], shared, offset,
+                                        dst->children[i]);
+  }
+
+  if (array_view->dictionary != NULL) {
+    ArrowDeviceArrayViewCoalescedAssign(array_view->dictionary, shared, offset,
+                                        dst->dictionary);
+  }
+}
+
+// Allocates CPU-accessible memory to pack buffers into before they are copied to
+// device_dst. For a CPU, CUDA_HOST, or ROCM_HOST destination, this is the destination
+// itself (i.e., *is_dst is set to 1 and no copy is required); for a CUDA or ROCm
+// device, it is pinned memory such that the driver doesn't have to stage the copy
+// again.
+static ArrowErrorCode ArrowDeviceAllocateStaging(struct ArrowDevice* device_dst,
+                                                 int64_t size_bytes,
+                                                 struct ArrowBuffer* out, int* is_dst) {
+  *is_dst = device_dst->device_type == ARROW_DEVICE_CPU;
+
+#ifdef NANOARROW_DEVICE_WITH_CUDA
+  if (device_dst->device_type == ARROW_DEVICE_CUDA_HOST) {
+    *is_dst = 1;
+    return ArrowDeviceCudaAllocateBuffer(device_dst, out, size_bytes);
+  }
+
+  if (device_dst->device_type == ARROW_DEVICE_CUDA) {
+    struct ArrowDevice* cuda_host =
+        ArrowDeviceCuda(ARROW_DEVICE_CUDA_HOST, device_dst->device_id);
+    if (cuda_host != NULL) {
+      return ArrowDeviceCudaAllocateBuffer(cuda_host, out, size_bytes);
+    }
+  }
+#endif
+
+#ifdef NANOARROW_DEVICE_WITH_ROCM
+  if (device_dst->device_type == ARROW_DEVICE_ROCM_HOST) {
+    *is_dst = 1;
+    return ArrowDeviceRocmAllocateBuffer(device_dst, out, size_bytes);
+  }
+
+  if (device_dst->device_type == ARROW_DEVICE_ROCM) {
+    struct ArrowDevice* rocm_host =
+        ArrowDeviceRocm(ARROW_DEVICE_ROCM_HOST, device_dst->device_id);
+    if (rocm_host != NULL) {
+      return ArrowDeviceRocmAllocateBuffer(rocm_host, out, size_bytes);
+    }
+  }
+#endif
+
+  ArrowBufferInit(out);
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(out, size_bytes));
+  out->size_bytes = size_bytes;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowDeviceArrayViewCopyCoalesced(struct ArrowDeviceArrayView* src,
+                                                 struct ArrowDevice* device_dst,
+                                                 struct ArrowDeviceArray* dst) {
+  // Buffers are packed with memcpy()
+  if (src->device->device_type != ARROW_DEVICE_CPU &&
+      src->device->device_type != ARROW_DEVICE_CUDA_HOST &&
+      src->device->device_type != ARROW_DEVICE_ROCM_HOST) {
+    return ENOTSUP;
+  }
+
+  int64_t size_bytes = 0;
+  int64_t n_buffers = 0;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowDeviceArrayViewCoalescedSize(&src->array_view, &size_bytes, &n_buffers));
+
+  struct ArrowArray tmp;
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromArrayView(&tmp, &src->array_view, NULL));
+
+  struct ArrowDeviceSharedBuffer* shared = NULL;
+  int result = NANOARROW_OK;
+  if (n_buffers > 0) {
+    shared = (struct ArrowDeviceSharedBuffer*)ArrowMalloc(
+        sizeof(struct ArrowDeviceSharedBuffer));
+    if (shared == NULL) {
+      tmp.release(&tmp);
+      return ENOMEM;
+    }
+
+    struct ArrowBuffer staging;
+    int is_dst = 0;
+    result = ArrowDeviceAllocateStaging(device_dst, size_bytes, &staging, &is_dst);
+    if (result == NANOARROW_OK) {
+      int64_t staging_offset = 0;
+      ArrowDeviceArrayViewCoalescedPack(&src->array_view, staging.data,
+                                        &staging_offset);
+    }
+
+    // One transfer for the whole tree
+    if (result == NANOARROW_OK && is_dst) {
+      ArrowBufferMove(&staging, &shared->buffer);
+    } else if (result == NANOARROW_OK) {
+      struct ArrowBufferView staging_view;
+      staging_view.data.data = staging.data;
+      staging_view.size_bytes = staging.size_bytes;
+      result = ArrowDeviceBufferInit(ArrowDeviceCpu(), staging_view, device_dst,
+                                     &shared->buffer);
+      ArrowBufferReset(&staging);
+    }
+
+    if (result != NANOARROW_OK) {
+      ArrowFree(shared);
+      tmp.release(&tmp);
+      return result;
+    }
+
+    ArrowRefCountInit(&shared->n_references, n_buffers);
+  }
+
+  int64_t offset = 0;
+  ArrowDeviceArrayViewCoalescedAssign(&src->array_view, shared, &offset, &tmp);
+
+  result = ArrowArrayFinishBuilding(&tmp, NANOARROW_VALIDATION_LEVEL_MINIMAL, NULL);
+  if (result != NANOARROW_OK) {
+    tmp.release(&tmp);
+    return result;
+  }
+
+  result = ArrowDeviceArrayInit(device_dst, dst, &tmp);
+  if (result != NANOARROW_OK) {
+    tmp.release(&tmp);
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
 ArrowErrorCode ArrowDeviceArrayMoveToDevice(struct ArrowDeviceArray* src,
                                             struct ArrowDevice* device_dst,
                                             struct ArrowDeviceArray* dst) {
@@ -484,7 +1080,7 @@ ArrowErrorCode ArrowDeviceArrayMoveToDevice(struct ArrowDeviceArray* src,
 
   // See if the destination knows how to move
   if (device_dst->array_move != NULL) {
-    NANOARROW_RETURN_NOT_OK(device_dst->array_move(device_src, src, device_dst, dst));
+    return device_dst->array_move(device_src, src, device_dst, dst);
   }
 
   return ENOTSUP;
@@ -132,6 +132,8 @@ static inline void ArrowDeviceArrayMove(struct ArrowDeviceArray* src,
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceArrayViewSetArray)
 #define ArrowDeviceArrayViewCopy \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceArrayViewCopy)
+#define ArrowDeviceArrayViewCopyCoalesced \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceArrayViewCopyCoalesced)
 #define ArrowDeviceArrayViewCopyRequired \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceArrayViewCopyRequired)
 #define ArrowDeviceArrayMoveToDevice \
@@ -142,6 +144,9 @@ static inline void ArrowDeviceArrayMove(struct ArrowDeviceArray* src,
 #define ArrowDeviceBufferInit NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceBufferInit)
 #define ArrowDeviceBufferMove NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceBufferMove)
 #define ArrowDeviceBufferCopy NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceBufferCopy)
+#define ArrowDeviceAllocator NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceAllocator)
+#define ArrowDeviceArrayInitFromSchema \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceArrayInitFromSchema)
 #define ArrowDeviceBasicArrayStreamInit \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceBasicArrayStreamInit)
 
@@ -273,10 +278,34 @@ ArrowErrorCode ArrowDeviceArrayViewSetArray(
     struct ArrowError* error);
 
 /// \brief Copy an ArrowDeviceArrayView to a device
+///
+/// Only the parts of buffers referenced by the offset and length of src are copied
+/// (e.g., a small slice of a large array costs proportional to its length). To avoid
+/// shifting bitmaps, the copy starts at the preceding multiple of eight elements such
+/// that the offset of dst is src's offset modulo eight. Offsets are rebased on the
+/// CPU. Dictionaries, children of dense unions, and arrays that contain a run-end
+/// encoded or binary view type are copied in their entirety.
 ArrowErrorCode ArrowDeviceArrayViewCopy(struct ArrowDeviceArrayView* src,
                                         struct ArrowDevice* device_dst,
                                         struct ArrowDeviceArray* dst);
 
+/// \brief Copy an ArrowDeviceArrayView to a device with a single transfer
+///
+/// Like ArrowDeviceArrayViewCopy() except that every buffer of src (including those
+/// of its children and dictionaries) is packed into one contiguous staging buffer at
+/// 64-byte aligned offsets and copied to device_dst at once, which avoids a transfer
+/// per buffer for trees with many small buffers. For a CUDA destination, the staging
+/// buffer is pinned host memory (which is reused if the allocation pool of the
+/// ARROW_DEVICE_CUDA_HOST device is enabled), as it is for a ROCm destination. The
+/// buffers of dst are sections of one allocation that is freed when the last of them
+/// is released, which is only thread safe when compiled with C11 and stdatomic.h.
+/// Buffers are copied in their entirety. Returns ENOTSUP if the buffers of src are
+/// not CPU-accessible (i.e., src is not an ARROW_DEVICE_CPU, ARROW_DEVICE_CUDA_HOST,
+/// or ARROW_DEVICE_ROCM_HOST array).
+ArrowErrorCode ArrowDeviceArrayViewCopyCoalesced(struct ArrowDeviceArrayView* src,
+                                                 struct ArrowDevice* device_dst,
+                                                 struct ArrowDeviceArray* dst);
+
 /// \brief Move an ArrowDeviceArray to a device if possible
 ///
 /// Will attempt to move a device array to a device without copying buffers.
@@ -315,6 +344,30 @@ ArrowErrorCode ArrowDeviceBufferCopy(struct ArrowDevice* device_src,
                                      struct ArrowDevice* device_dst,
                                      struct ArrowBufferView dst);
 
+/// \brief Get an allocator for CPU-writable memory that a device can use directly
+///
+/// Buffers allocated by out can be written by the CPU (e.g., with the array builder
+/// functions of the nanoarrow core library) and read by device without a copy. For
+/// a CPU device, this is ArrowBufferAllocatorDefault(); for Metal, this is
+/// ArrowDeviceMetalAllocator(); for ARROW_DEVICE_CUDA_HOST and
+/// ARROW_DEVICE_ROCM_HOST, memory is pinned host memory; for ARROW_DEVICE_CUDA and
+/// ARROW_DEVICE_ROCM, memory is managed (unified) memory. Returns ENOTSUP if this
+/// build does not support device or if its memory can't be written by the CPU.
+ArrowErrorCode ArrowDeviceAllocator(struct ArrowDevice* device,
+                                    struct ArrowBufferAllocator* out);
+
+/// \brief Initialize a CPU ArrowArray whose buffers are allocated for a device
+///
+/// Like ArrowArrayInitFromSchema() except that every buffer of array, its children,
+/// and its dictionary is allocated with ArrowDeviceAllocator(). Once built, the
+/// array can be wrapped with ArrowDeviceArrayInit() for device, or a CPU
+/// ArrowDeviceArray of it moved to device with ArrowDeviceArrayMoveToDevice(), in
+/// both cases without copying any buffers.
+ArrowErrorCode ArrowDeviceArrayInitFromSchema(struct ArrowDevice* device,
+                                              struct ArrowArray* array,
+                                              struct ArrowSchema* schema,
+                                              struct ArrowError* error);
+
 /// \brief Initialize an ArrowDeviceArrayStream from an existing ArrowArrayStream
 ///
 /// Wrap an ArrowArrayStream of ArrowDeviceArray objects already allocated by the
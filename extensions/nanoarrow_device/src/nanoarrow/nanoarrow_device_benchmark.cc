@@ -0,0 +1,365 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cerrno>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "nanoarrow_device.hpp"
+
+#if defined(NANOARROW_DEVICE_WITH_METAL)
+#include "nanoarrow_device_metal.h"
+#endif
+
+// The benchmarks below move batches of three shapes between the CPU and a device:
+// narrow (one int64 column), wide (32 double columns), and strings (one column of
+// 32-byte strings). Each is run for every shape, device type this library was built
+// with, and number of rows; device types with no device at runtime are skipped.
+// The time of one iteration is the latency of one batch; for the benchmarks that copy
+// buffers, bytes processed are the total size of the batch's buffers such that
+// bytes_per_second is the transfer throughput.
+namespace {
+
+enum BatchShape { kBatchNarrow, kBatchWide, kBatchStrings };
+
+constexpr int kWideColumns = 32;
+
+const char* BatchShapeName(int64_t shape) {
+  switch (shape) {
+    case kBatchNarrow:
+      return "narrow";
+    case kBatchWide:
+      return "wide";
+    case kBatchStrings:
+      return "strings";
+    default:
+      return "unknown";
+  }
+}
+
+const char* DeviceTypeName(int64_t device_type) {
+  switch (device_type) {
+    case ARROW_DEVICE_CPU:
+      return "CPU";
+    case ARROW_DEVICE_CUDA:
+      return "CUDA";
+    case ARROW_DEVICE_CUDA_HOST:
+      return "CUDA_HOST";
+    case ARROW_DEVICE_METAL:
+      return "METAL";
+    case ARROW_DEVICE_ROCM:
+      return "ROCM";
+    case ARROW_DEVICE_ROCM_HOST:
+      return "ROCM_HOST";
+    default:
+      return "unknown";
+  }
+}
+
+struct ArrowDevice* GetDevice(int64_t device_type) {
+#if defined(NANOARROW_DEVICE_WITH_METAL)
+  if (device_type == ARROW_DEVICE_METAL) {
+    return ArrowDeviceMetalDefaultDevice();
+  }
+#endif
+
+  return ArrowDeviceResolve(static_cast<ArrowDeviceType>(device_type), 0);
+}
+
+ArrowErrorCode InitBatchSchema(int64_t shape, struct ArrowSchema* schema) {
+  int64_t n_columns = shape == kBatchWide ? kWideColumns : 1;
+  enum ArrowType type = NANOARROW_TYPE_INT64;
+  if (shape == kBatchWide) {
+    type = NANOARROW_TYPE_DOUBLE;
+  } else if (shape == kBatchStrings) {
+    type = NANOARROW_TYPE_STRING;
+  }
+
+  ArrowSchemaInit(schema);
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetTypeStruct(schema, n_columns));
+  for (int64_t i = 0; i < n_columns; i++) {
+    std::string name = "col" + std::to_string(i);
+    NANOARROW_RETURN_NOT_OK(ArrowSchemaSetType(schema->children[i], type));
+    NANOARROW_RETURN_NOT_OK(ArrowSchemaSetName(schema->children[i], name.c_str()));
+  }
+
+  return NANOARROW_OK;
+}
+
+// Builds a batch whose buffers are allocated by ArrowDeviceAllocator() of device
+ArrowErrorCode InitBatch(int64_t shape, int64_t n_rows, struct ArrowDevice* device,
+                         struct ArrowSchema* schema, struct ArrowArray* array) {
+  NANOARROW_RETURN_NOT_OK(ArrowDeviceArrayInitFromSchema(device, array, schema, nullptr));
+  NANOARROW_RETURN_NOT_OK(ArrowArrayStartAppending(array));
+
+  std::string value(32, 'a');
+  for (int64_t i = 0; i < n_rows; i++) {
+    for (int64_t j = 0; j < array->n_children; j++) {
+      struct ArrowArray* child = array->children[j];
+      switch (shape) {
+        case kBatchNarrow:
+          NANOARROW_RETURN_NOT_OK(ArrowArrayAppendInt(child, i));
+          break;
+        case kBatchWide:
+          NANOARROW_RETURN_NOT_OK(ArrowArrayAppendDouble(child, static_cast<double>(i)));
+          break;
+        default:
+          value[i % value.size()] = static_cast<char>('a' + i % 26);
+          NANOARROW_RETURN_NOT_OK(ArrowArrayAppendString(
+              child, {value.data(), static_cast<int64_t>(value.size())}));
+          break;
+      }
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowArrayFinishElement(array));
+  }
+
+  return ArrowArrayFinishBuildingDefault(array, nullptr);
+}
+
+int64_t BuffersSize(const struct ArrowArrayView* array_view) {
+  int64_t size = 0;
+  for (int i = 0; i < NANOARROW_MAX_FIXED_BUFFERS; i++) {
+    size += array_view->buffer_views[i].size_bytes;
+  }
+
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    size += BuffersSize(array_view->children[i]);
+  }
+
+  return size;
+}
+
+ArrowErrorCode SynchronizeArray(struct ArrowDevice* device,
+                                struct ArrowDeviceArray* device_array) {
+  if (device_array->sync_event == nullptr) {
+    return NANOARROW_OK;
+  }
+
+  return device->synchronize_event(device, device_array->sync_event, nullptr);
+}
+
+// A batch built on the CPU and its copy on the device of a benchmark
+class DeviceBatch {
+ public:
+  ArrowErrorCode Init(benchmark::State& state) {
+    shape_ = state.range(0);
+    device_ = GetDevice(state.range(1));
+    if (device_ == nullptr) {
+      return ENODEV;
+    }
+
+    NANOARROW_RETURN_NOT_OK(InitBatchSchema(shape_, schema_.get()));
+    nanoarrow::UniqueArray array;
+    NANOARROW_RETURN_NOT_OK(
+        InitBatch(shape_, state.range(2), ArrowDeviceCpu(), schema_.get(), array.get()));
+    NANOARROW_RETURN_NOT_OK(
+        ArrowDeviceArrayInit(ArrowDeviceCpu(), cpu_array_.get(), array.get()));
+
+    NANOARROW_RETURN_NOT_OK(InitView(cpu_view_.get()));
+    NANOARROW_RETURN_NOT_OK(
+        ArrowDeviceArrayViewSetArray(cpu_view_.get(), cpu_array_.get(), nullptr));
+    NANOARROW_RETURN_NOT_OK(
+        ArrowDeviceArrayViewCopy(cpu_view_.get(), device_, device_array_.get()));
+    NANOARROW_RETURN_NOT_OK(SynchronizeArray(device_, device_array_.get()));
+
+    NANOARROW_RETURN_NOT_OK(InitView(device_view_.get()));
+    NANOARROW_RETURN_NOT_OK(
+        ArrowDeviceArrayViewSetArray(device_view_.get(), device_array_.get(), nullptr));
+
+    n_bytes_ = BuffersSize(&cpu_view_->array_view);
+    return NANOARROW_OK;
+  }
+
+  ArrowErrorCode InitView(struct ArrowDeviceArrayView* device_array_view) {
+    ArrowDeviceArrayViewInit(device_array_view);
+    return ArrowArrayViewInitFromSchema(&device_array_view->array_view, schema_.get(),
+                                        nullptr);
+  }
+
+  void SetCounters(benchmark::State& state, bool copies_buffers) const {
+    state.SetLabel(std::string(BatchShapeName(shape_)) + "/" +
+                   DeviceTypeName(device_->device_type));
+    if (copies_buffers) {
+      state.SetBytesProcessed(state.iterations() * n_bytes_);
+    }
+    state.counters["batches_per_second"] = benchmark::Counter(
+        static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+  }
+
+  int64_t shape() const { return shape_; }
+  struct ArrowDevice* device() { return device_; }
+  struct ArrowSchema* schema() { return schema_.get(); }
+  struct ArrowDeviceArrayView* cpu_view() { return cpu_view_.get(); }
+  struct ArrowDeviceArray* device_array() { return device_array_.get(); }
+  struct ArrowDeviceArrayView* device_view() { return device_view_.get(); }
+
+ private:
+  int64_t shape_{};
+  struct ArrowDevice* device_{};
+  int64_t n_bytes_{};
+  nanoarrow::UniqueSchema schema_;
+  nanoarrow::device::UniqueDeviceArray cpu_array_;
+  nanoarrow::device::UniqueDeviceArrayView cpu_view_;
+  nanoarrow::device::UniqueDeviceArray device_array_;
+  nanoarrow::device::UniqueDeviceArrayView device_view_;
+};
+
+// Releases only the struct of a shallow copy: the buffers and children are still
+// owned by the array they were copied from
+void ReleaseShallowCopy(struct ArrowArray* array) { array->release = nullptr; }
+
+}  // namespace
+
+#define BENCHMARK_RETURN_NOT_OK(expr)                       \
+  do {                                                      \
+    if ((expr) != NANOARROW_OK) {                           \
+      state.SkipWithError("nanoarrow call failed: " #expr); \
+      return;                                               \
+    }                                                       \
+  } while (0)
+
+#define BENCHMARK_INIT_BATCH(batch)                                     \
+  DeviceBatch batch;                                                    \
+  do {                                                                  \
+    int result = batch.Init(state);                                     \
+    if (result == ENODEV) {                                             \
+      state.SkipWithError("No device of this type is available");       \
+      return;                                                           \
+    }                                                                   \
+    BENCHMARK_RETURN_NOT_OK(result);                                    \
+  } while (0)
+
+// CPU -> device
+static void BM_DeviceArrayViewCopy(benchmark::State& state) {
+  BENCHMARK_INIT_BATCH(batch);
+
+  for (auto _ : state) {
+    nanoarrow::device::UniqueDeviceArray dst;
+    BENCHMARK_RETURN_NOT_OK(
+        ArrowDeviceArrayViewCopy(batch.cpu_view(), batch.device(), dst.get()));
+    BENCHMARK_RETURN_NOT_OK(SynchronizeArray(batch.device(), dst.get()));
+  }
+
+  batch.SetCounters(state, true);
+}
+
+// Device -> CPU
+static void BM_DeviceArrayViewCopyToCpu(benchmark::State& state) {
+  BENCHMARK_INIT_BATCH(batch);
+
+  for (auto _ : state) {
+    nanoarrow::device::UniqueDeviceArray dst;
+    BENCHMARK_RETURN_NOT_OK(
+        ArrowDeviceArrayViewCopy(batch.device_view(), ArrowDeviceCpu(), dst.get()));
+  }
+
+  batch.SetCounters(state, true);
+}
+
+// CPU -> device as one transfer of every buffer
+static void BM_DeviceArrayViewCopyCoalesced(benchmark::State& state) {
+  BENCHMARK_INIT_BATCH(batch);
+
+  for (auto _ : state) {
+    nanoarrow::device::UniqueDeviceArray dst;
+    BENCHMARK_RETURN_NOT_OK(
+        ArrowDeviceArrayViewCopyCoalesced(batch.cpu_view(), batch.device(), dst.get()));
+    BENCHMARK_RETURN_NOT_OK(SynchronizeArray(batch.device(), dst.get()));
+  }
+
+  batch.SetCounters(state, true);
+}
+
+// Setting up a view of a batch on the device, which copies the last offset of every
+// string or list buffer to the CPU to resolve the size of its data buffer
+static void BM_DeviceArrayViewSetArray(benchmark::State& state) {
+  BENCHMARK_INIT_BATCH(batch);
+
+  for (auto _ : state) {
+    BENCHMARK_RETURN_NOT_OK(ArrowDeviceArrayViewSetArray(
+        batch.device_view(), batch.device_array(), nullptr));
+  }
+
+  batch.SetCounters(state, false);
+}
+
+// CPU -> device for a batch built with the device's allocator, which is a move of
+// the batch's metadata if the device can access its buffers
+static void BM_DeviceArrayMoveToDevice(benchmark::State& state) {
+  BENCHMARK_INIT_BATCH(batch);
+
+  nanoarrow::UniqueArray array;
+  int result = InitBatch(batch.shape(), state.range(2), batch.device(), batch.schema(),
+                         array.get());
+  if (result == ENOTSUP) {
+    state.SkipWithError("Device does not provide a CPU-writable allocator");
+    return;
+  }
+  BENCHMARK_RETURN_NOT_OK(result);
+
+  for (auto _ : state) {
+    struct ArrowArray shallow_copy = *array.get();
+    shallow_copy.release = &ReleaseShallowCopy;
+
+    nanoarrow::device::UniqueDeviceArray src;
+    nanoarrow::device::UniqueDeviceArray dst;
+    BENCHMARK_RETURN_NOT_OK(
+        ArrowDeviceArrayInit(ArrowDeviceCpu(), src.get(), &shallow_copy));
+    result = ArrowDeviceArrayMoveToDevice(src.get(), batch.device(), dst.get());
+    if (result == ENOTSUP) {
+      state.SkipWithError("Moving this batch to the device requires a copy");
+      return;
+    }
+    BENCHMARK_RETURN_NOT_OK(result);
+  }
+
+  batch.SetCounters(state, false);
+}
+
+static void DeviceBenchmarkArgs(benchmark::internal::Benchmark* b) {
+  const int64_t device_types[] = {
+    ARROW_DEVICE_CPU,
+#if defined(NANOARROW_DEVICE_WITH_CUDA)
+    ARROW_DEVICE_CUDA_HOST, ARROW_DEVICE_CUDA,
+#endif
+#if defined(NANOARROW_DEVICE_WITH_ROCM)
+    ARROW_DEVICE_ROCM_HOST, ARROW_DEVICE_ROCM,
+#endif
+#if defined(NANOARROW_DEVICE_WITH_METAL)
+    ARROW_DEVICE_METAL,
+#endif
+  };
+
+  b->ArgNames({"shape", "device_type", "n_rows"});
+  for (int64_t shape : {kBatchNarrow, kBatchWide, kBatchStrings}) {
+    for (int64_t device_type : device_types) {
+      for (int64_t n_rows : {1 << 10, 1 << 14, 1 << 18}) {
+        b->Args({shape, device_type, n_rows});
+      }
+    }
+  }
+}
+
+BENCHMARK(BM_DeviceArrayViewCopy)->Apply(DeviceBenchmarkArgs)->UseRealTime();
+BENCHMARK(BM_DeviceArrayViewCopyToCpu)->Apply(DeviceBenchmarkArgs)->UseRealTime();
+BENCHMARK(BM_DeviceArrayViewCopyCoalesced)->Apply(DeviceBenchmarkArgs)->UseRealTime();
+BENCHMARK(BM_DeviceArrayViewSetArray)->Apply(DeviceBenchmarkArgs)->UseRealTime();
+BENCHMARK(BM_DeviceArrayMoveToDevice)->Apply(DeviceBenchmarkArgs)->UseRealTime();
+
+BENCHMARK_MAIN();
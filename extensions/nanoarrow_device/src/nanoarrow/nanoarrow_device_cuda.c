@@ -17,7 +17,23 @@
 
 #include <cuda_runtime_api.h>
 
+#include "nanoarrow_atomic_internal.h"
 #include "nanoarrow_device.h"
+#include "nanoarrow_device_cuda.h"
+#include "nanoarrow_device_cuda_kernels.h"
+
+// Pooled blocks have a power-of-two capacity between
+// 2 ^ NANOARROW_CUDA_POOL_MIN_SIZE_CLASS and 2 ^ NANOARROW_CUDA_POOL_MAX_SIZE_CLASS
+// bytes; larger (and empty) allocations are never retained. The minimum matches the
+// alignment of cudaMalloc(), which never hands out less than this anyway.
+#define NANOARROW_CUDA_POOL_MIN_SIZE_CLASS 8
+#define NANOARROW_CUDA_POOL_MAX_SIZE_CLASS 30
+#define NANOARROW_CUDA_POOL_N_SIZE_CLASSES \
+  (NANOARROW_CUDA_POOL_MAX_SIZE_CLASS - NANOARROW_CUDA_POOL_MIN_SIZE_CLASS + 1)
+
+// The number of sync events of released arrays that each device keeps for the next
+// arrays it initializes
+#define NANOARROW_CUDA_POOL_MAX_EVENTS 64
 
 struct ArrowDeviceCudaAllocatorPrivate {
   ArrowDeviceType device_type;
@@ -25,18 +41,57 @@ struct ArrowDeviceCudaAllocatorPrivate {
   // When moving a buffer from CUDA_HOST to CUDA, the pointer used to access
   // the data changes but the pointer needed to pass to cudaFreeHost does not
   void* allocated_ptr;
+  // The pool of the device that allocated this block and the index of its size class
+  // (or -1 if the block is never retained)
+  struct ArrowDeviceCudaPool* pool;
+  int size_class;
+  // The next block in the pool's list of blocks that are not in use
+  struct ArrowDeviceCudaAllocatorPrivate* next;
 };
 
-static void ArrowDeviceCudaDeallocator(struct ArrowBufferAllocator* allocator,
-                                       uint8_t* ptr, int64_t old_size) {
-  struct ArrowDeviceCudaAllocatorPrivate* allocator_private =
-      (struct ArrowDeviceCudaAllocatorPrivate*)allocator->private_data;
+// Unlike the core buffer pool, device memory can't hold the free list's next
+// pointers, so blocks that are not in use are kept as a singly-linked list of their
+// (host) allocator private data per size class. Each ArrowDevice returned by
+// ArrowDeviceCuda() owns one of these as its private_data.
+struct ArrowDeviceCudaPool {
+  ArrowSpinLock lock;
+  struct ArrowDeviceCudaAllocatorPrivate* free_blocks[NANOARROW_CUDA_POOL_N_SIZE_CLASSES];
+  int64_t max_bytes_retained;
+  struct ArrowBufferPoolStats stats;
+  cudaEvent_t free_events[NANOARROW_CUDA_POOL_MAX_EVENTS];
+  int n_free_events;
+};
 
-  int prev_device = 0;
-  // Not ideal: we have no place to communicate any errors here
-  cudaGetDevice(&prev_device);
-  cudaSetDevice((int)allocator_private->device_id);
+// Returns the size class for an allocation of size bytes or -1 if it should not
+// be pooled
+static int ArrowDeviceCudaPoolSizeClass(int64_t size) {
+  if (size == 0) {
+    return -1;
+  }
+
+  int size_class = NANOARROW_CUDA_POOL_MIN_SIZE_CLASS;
+  while (size_class <= NANOARROW_CUDA_POOL_MAX_SIZE_CLASS &&
+         (((int64_t)1) << size_class) < size) {
+    size_class++;
+  }
+
+  if (size_class > NANOARROW_CUDA_POOL_MAX_SIZE_CLASS) {
+    return -1;
+  } else {
+    return size_class - NANOARROW_CUDA_POOL_MIN_SIZE_CLASS;
+  }
+}
+
+static int64_t ArrowDeviceCudaPoolBlockSize(int size_class) {
+  return ((int64_t)1) << (size_class + NANOARROW_CUDA_POOL_MIN_SIZE_CLASS);
+}
 
+static void ArrowDeviceCudaRelease(struct ArrowDevice* device);
+
+// Frees the memory of a block and its private data. The caller is responsible for
+// setting the current device to the block's device.
+static void ArrowDeviceCudaFreeBlock(
+    struct ArrowDeviceCudaAllocatorPrivate* allocator_private) {
   switch (allocator_private->device_type) {
     case ARROW_DEVICE_CUDA:
       cudaFree(allocator_private->allocated_ptr);
@@ -48,13 +103,129 @@ static void ArrowDeviceCudaDeallocator(struct ArrowBufferAllocator* allocator,
       break;
   }
 
-  cudaSetDevice(prev_device);
   ArrowFree(allocator_private);
 }
 
-static ArrowErrorCode ArrowDeviceCudaAllocateBuffer(struct ArrowDevice* device,
-                                                    struct ArrowBuffer* buffer,
-                                                    int64_t size_bytes) {
+// Removes all blocks that are not in use from the pool and frees them
+static void ArrowDeviceCudaPoolTrimInternal(struct ArrowDevice* device) {
+  struct ArrowDeviceCudaPool* pool = (struct ArrowDeviceCudaPool*)device->private_data;
+  struct ArrowDeviceCudaAllocatorPrivate* free_blocks[NANOARROW_CUDA_POOL_N_SIZE_CLASSES];
+
+  // Detach the lists while holding the lock but free them afterward
+  ArrowSpinLockAcquire(&pool->lock);
+  for (int i = 0; i < NANOARROW_CUDA_POOL_N_SIZE_CLASSES; i++) {
+    free_blocks[i] = pool->free_blocks[i];
+    pool->free_blocks[i] = NULL;
+  }
+  int64_t bytes_retained = pool->stats.bytes_retained;
+  pool->stats.bytes_retained = 0;
+  cudaEvent_t free_events[NANOARROW_CUDA_POOL_MAX_EVENTS];
+  int n_free_events = pool->n_free_events;
+  for (int i = 0; i < n_free_events; i++) {
+    free_events[i] = pool->free_events[i];
+  }
+  pool->n_free_events = 0;
+  ArrowSpinLockRelease(&pool->lock);
+
+  if (bytes_retained == 0 && n_free_events == 0) {
+    return;
+  }
+
+  int prev_device = 0;
+  cudaGetDevice(&prev_device);
+  cudaSetDevice((int)device->device_id);
+
+  for (int i = 0; i < n_free_events; i++) {
+    cudaEventDestroy(free_events[i]);
+  }
+
+  for (int i = 0; i < NANOARROW_CUDA_POOL_N_SIZE_CLASSES; i++) {
+    struct ArrowDeviceCudaAllocatorPrivate* block = free_blocks[i];
+    while (block != NULL) {
+      struct ArrowDeviceCudaAllocatorPrivate* next = block->next;
+      ArrowDeviceCudaFreeBlock(block);
+      block = next;
+    }
+  }
+
+  cudaSetDevice(prev_device);
+}
+
+static void ArrowDeviceCudaDeallocator(struct ArrowBufferAllocator* allocator,
+                                       uint8_t* ptr, int64_t old_size) {
+  struct ArrowDeviceCudaAllocatorPrivate* allocator_private =
+      (struct ArrowDeviceCudaAllocatorPrivate*)allocator->private_data;
+
+  // Return the block to its pool if there is room for it
+  struct ArrowDeviceCudaPool* pool = allocator_private->pool;
+  int size_class = allocator_private->size_class;
+  if (size_class >= 0) {
+    int64_t block_size = ArrowDeviceCudaPoolBlockSize(size_class);
+    ArrowSpinLockAcquire(&pool->lock);
+    if ((pool->stats.bytes_retained + block_size) <= pool->max_bytes_retained) {
+      allocator_private->next = pool->free_blocks[size_class];
+      pool->free_blocks[size_class] = allocator_private;
+      pool->stats.bytes_retained += block_size;
+      allocator_private = NULL;
+    }
+    ArrowSpinLockRelease(&pool->lock);
+
+    if (allocator_private == NULL) {
+      return;
+    }
+  }
+
+  int prev_device = 0;
+  // Not ideal: we have no place to communicate any errors here
+  cudaGetDevice(&prev_device);
+  cudaSetDevice((int)allocator_private->device_id);
+  ArrowDeviceCudaFreeBlock(allocator_private);
+  cudaSetDevice(prev_device);
+}
+
+ArrowErrorCode ArrowDeviceCudaAllocateBuffer(struct ArrowDevice* device,
+                                             struct ArrowBuffer* buffer,
+                                             int64_t size_bytes) {
+  if (device->release != &ArrowDeviceCudaRelease) {
+    return EINVAL;
+  }
+
+  struct ArrowDeviceCudaPool* pool = (struct ArrowDeviceCudaPool*)device->private_data;
+  struct ArrowDeviceCudaAllocatorPrivate* allocator_private = NULL;
+
+  // A retained block needs neither an allocation nor a change of the current device.
+  // Sizes are only rounded up to a size class when the block may be retained.
+  int size_class = -1;
+  ArrowSpinLockAcquire(&pool->lock);
+  if (pool->max_bytes_retained > 0) {
+    size_class = ArrowDeviceCudaPoolSizeClass(size_bytes);
+  }
+
+  if (size_class >= 0 && pool->free_blocks[size_class] != NULL) {
+    allocator_private = pool->free_blocks[size_class];
+    pool->free_blocks[size_class] = allocator_private->next;
+    pool->stats.bytes_retained -= ArrowDeviceCudaPoolBlockSize(size_class);
+    pool->stats.n_hits++;
+  } else if (size_class >= 0) {
+    pool->stats.n_misses++;
+  }
+  ArrowSpinLockRelease(&pool->lock);
+
+  if (allocator_private != NULL) {
+    allocator_private->next = NULL;
+    buffer->data = (uint8_t*)allocator_private->allocated_ptr;
+    buffer->size_bytes = size_bytes;
+    buffer->capacity_bytes = size_bytes;
+    buffer->allocator =
+        ArrowBufferDeallocator(&ArrowDeviceCudaDeallocator, allocator_private);
+    return NANOARROW_OK;
+  }
+
+  int64_t allocation_size = size_bytes;
+  if (size_class >= 0) {
+    allocation_size = ArrowDeviceCudaPoolBlockSize(size_class);
+  }
+
   int prev_device = 0;
   cudaError_t result = cudaGetDevice(&prev_device);
   if (result != cudaSuccess) {
@@ -67,9 +238,8 @@ static ArrowErrorCode ArrowDeviceCudaAllocateBuffer(struct ArrowDevice* device,
     return EINVAL;
   }
 
-  struct ArrowDeviceCudaAllocatorPrivate* allocator_private =
-      (struct ArrowDeviceCudaAllocatorPrivate*)ArrowMalloc(
-          sizeof(struct ArrowDeviceCudaAllocatorPrivate));
+  allocator_private = (struct ArrowDeviceCudaAllocatorPrivate*)ArrowMalloc(
+      sizeof(struct ArrowDeviceCudaAllocatorPrivate));
   if (allocator_private == NULL) {
     cudaSetDevice(prev_device);
     return ENOMEM;
@@ -78,10 +248,10 @@ static ArrowErrorCode ArrowDeviceCudaAllocateBuffer(struct ArrowDevice* device,
   void* ptr = NULL;
   switch (device->device_type) {
     case ARROW_DEVICE_CUDA:
-      result = cudaMalloc(&ptr, (int64_t)size_bytes);
+      result = cudaMalloc(&ptr, (int64_t)allocation_size);
       break;
     case ARROW_DEVICE_CUDA_HOST:
-      result = cudaMallocHost(&ptr, (int64_t)size_bytes);
+      result = cudaMallocHost(&ptr, (int64_t)allocation_size);
       break;
     default:
       ArrowFree(allocator_private);
@@ -98,6 +268,9 @@ static ArrowErrorCode ArrowDeviceCudaAllocateBuffer(struct ArrowDevice* device,
   allocator_private->device_id = device->device_id;
   allocator_private->device_type = device->device_type;
   allocator_private->allocated_ptr = ptr;
+  allocator_private->pool = pool;
+  allocator_private->size_class = size_class;
+  allocator_private->next = NULL;
 
   buffer->data = (uint8_t*)ptr;
   buffer->size_bytes = size_bytes;
@@ -109,23 +282,117 @@ static ArrowErrorCode ArrowDeviceCudaAllocateBuffer(struct ArrowDevice* device,
   return NANOARROW_OK;
 }
 
+static uint8_t* ArrowDeviceCudaAllocatorReallocate(
+    struct ArrowBufferAllocator* allocator, uint8_t* ptr, int64_t old_size,
+    int64_t new_size) {
+  struct ArrowDevice* device = (struct ArrowDevice*)allocator->private_data;
+
+  // Always allocate at least one byte such that a successful allocation is not NULL
+  size_t allocation_size = new_size > 0 ? (size_t)new_size : 1;
+  void* new_ptr = NULL;
+  cudaError_t result;
+  if (device->device_type == ARROW_DEVICE_CUDA_HOST) {
+    result = cudaMallocHost(&new_ptr, allocation_size);
+  } else {
+    result = cudaMallocManaged(&new_ptr, allocation_size, cudaMemAttachGlobal);
+  }
+
+  if (result != cudaSuccess) {
+    return NULL;
+  }
+
+  if (ptr != NULL) {
+    memcpy(new_ptr, ptr, (size_t)(new_size < old_size ? new_size : old_size));
+    allocator->free(allocator, ptr, old_size);
+  }
+
+  return (uint8_t*)new_ptr;
+}
+
+static void ArrowDeviceCudaAllocatorFree(struct ArrowBufferAllocator* allocator,
+                                         uint8_t* ptr, int64_t old_size) {
+  struct ArrowDevice* device = (struct ArrowDevice*)allocator->private_data;
+  if (device->device_type == ARROW_DEVICE_CUDA_HOST) {
+    cudaFreeHost(ptr);
+  } else {
+    cudaFree(ptr);
+  }
+}
+
+ArrowErrorCode ArrowDeviceCudaAllocator(struct ArrowDevice* device,
+                                        struct ArrowBufferAllocator* out) {
+  if (device->release != &ArrowDeviceCudaRelease) {
+    return EINVAL;
+  }
+
+  out->reallocate = &ArrowDeviceCudaAllocatorReallocate;
+  out->free = &ArrowDeviceCudaAllocatorFree;
+  out->private_data = device;
+  return NANOARROW_OK;
+}
+
 struct ArrowDeviceCudaArrayPrivate {
   struct ArrowArray parent;
+  struct ArrowDevice* device;
   cudaEvent_t sync_event;
 };
 
+// Takes an event from the pool of device or creates one. The caller is responsible
+// for setting the current device to device.
+static cudaError_t ArrowDeviceCudaEventAcquire(struct ArrowDevice* device,
+                                              cudaEvent_t* out) {
+  struct ArrowDeviceCudaPool* pool = (struct ArrowDeviceCudaPool*)device->private_data;
+
+  ArrowSpinLockAcquire(&pool->lock);
+  int n_free_events = pool->n_free_events;
+  if (n_free_events > 0) {
+    *out = pool->free_events[n_free_events - 1];
+    pool->n_free_events--;
+  }
+  ArrowSpinLockRelease(&pool->lock);
+
+  if (n_free_events > 0) {
+    return cudaSuccess;
+  }
+
+  // Timing is never used and makes both recording and synchronizing slower
+  return cudaEventCreateWithFlags(out, cudaEventDisableTiming);
+}
+
+// Returns an event to the pool of device (or destroys it if the pool is full). A
+// pooled event may still be pending: an array that reuses it without recording it
+// again waits at most for the work it was last recorded after.
+static void ArrowDeviceCudaEventRelease(struct ArrowDevice* device, cudaEvent_t event) {
+  struct ArrowDeviceCudaPool* pool = (struct ArrowDeviceCudaPool*)device->private_data;
+
+  ArrowSpinLockAcquire(&pool->lock);
+  int pooled = pool->n_free_events < NANOARROW_CUDA_POOL_MAX_EVENTS;
+  if (pooled) {
+    pool->free_events[pool->n_free_events] = event;
+    pool->n_free_events++;
+  }
+  ArrowSpinLockRelease(&pool->lock);
+
+  if (!pooled) {
+    cudaEventDestroy(event);
+  }
+}
+
 static void ArrowDeviceCudaArrayRelease(struct ArrowArray* array) {
   struct ArrowDeviceCudaArrayPrivate* private_data =
       (struct ArrowDeviceCudaArrayPrivate*)array->private_data;
-  cudaEventDestroy(private_data->sync_event);
+  ArrowDeviceCudaEventRelease(private_data->device, private_data->sync_event);
   private_data->parent.release(&private_data->parent);
   ArrowFree(private_data);
   array->release = NULL;
 }
 
-static ArrowErrorCode ArrowDeviceCudaArrayInit(struct ArrowDevice* device,
-                                               struct ArrowDeviceArray* device_array,
-                                               struct ArrowArray* array) {
+// Wraps array with a sync_event from the pool of device. If stream is non-NULL, the
+// event is recorded on stream before array is moved such that array is left as it was
+// if recording fails.
+static ArrowErrorCode ArrowDeviceCudaArrayInitInternal(
+    struct ArrowDevice* device, struct ArrowDeviceArray* device_array,
+    struct ArrowArray* array, cudaStream_t* stream) {
   struct ArrowDeviceCudaArrayPrivate* private_data =
       (struct ArrowDeviceCudaArrayPrivate*)ArrowMalloc(
           sizeof(struct ArrowDeviceCudaArrayPrivate));
@@ -147,12 +414,24 @@ static ArrowErrorCode ArrowDeviceCudaArrayInit(struct ArrowDevice* device,
     return EINVAL;
   }
 
-  cudaError_t error = cudaEventCreate(&private_data->sync_event);
-  if (error != cudaSuccess) {
+  result = ArrowDeviceCudaEventAcquire(device, &private_data->sync_event);
+  if (result != cudaSuccess) {
+    cudaSetDevice(prev_device);
     ArrowFree(private_data);
     return EINVAL;
   }
 
+  if (stream != NULL) {
+    result = cudaEventRecord(private_data->sync_event, *stream);
+    if (result != cudaSuccess) {
+      ArrowDeviceCudaEventRelease(device, private_data->sync_event);
+      cudaSetDevice(prev_device);
+      ArrowFree(private_data);
+      return EINVAL;
+    }
+  }
+
+  private_data->device = device;
   memset(device_array, 0, sizeof(struct ArrowDeviceArray));
   device_array->array = *array;
   device_array->array.private_data = private_data;
@@ -167,63 +446,196 @@ static ArrowErrorCode ArrowDeviceCudaArrayInit(struct ArrowDevice* device,
   return NANOARROW_OK;
 }
 
-// TODO: All these buffer copiers would benefit from cudaMemcpyAsync but there is
-// no good way to incorporate that just yet
+static ArrowErrorCode ArrowDeviceCudaArrayInit(struct ArrowDevice* device,
+                                               struct ArrowDeviceArray* device_array,
+                                               struct ArrowArray* array) {
+  return ArrowDeviceCudaArrayInitInternal(device, device_array, array, NULL);
+}
 
-static ArrowErrorCode ArrowDeviceCudaBufferInit(struct ArrowDevice* device_src,
-                                                struct ArrowBufferView src,
-                                                struct ArrowDevice* device_dst,
-                                                struct ArrowBuffer* dst) {
-  struct ArrowBuffer tmp;
-  enum cudaMemcpyKind memcpy_kind;
+ArrowErrorCode ArrowDeviceCudaArrayInitAsync(struct ArrowDevice* device,
+                                             struct ArrowDeviceArray* device_array,
+                                             struct ArrowArray* array,
+                                             cudaStream_t stream) {
+  if (device->release != &ArrowDeviceCudaRelease) {
+    return EINVAL;
+  }
 
+  return ArrowDeviceCudaArrayInitInternal(device, device_array, array, &stream);
+}
+
+// The devices returned by ArrowDeviceCuda(): n_devices ARROW_DEVICE_CUDA devices
+// followed by n_devices ARROW_DEVICE_CUDA_HOST devices. peer_access holds the
+// ArrowDeviceCudaPeerAccess state of each (device, peer) pair of CUDA devices and is
+// protected by peer_access_lock.
+struct ArrowDeviceCudaRegistry {
+  struct ArrowDevice* devices;
+  int n_devices;
+  char* peer_access;
+  ArrowSpinLock peer_access_lock;
+};
+
+enum ArrowDeviceCudaPeerAccess {
+  NANOARROW_CUDA_PEER_ACCESS_UNKNOWN = 0,
+  NANOARROW_CUDA_PEER_ACCESS_ENABLED,
+  NANOARROW_CUDA_PEER_ACCESS_UNAVAILABLE
+};
+
+static struct ArrowDeviceCudaRegistry registry_singleton = {NULL, 0, NULL};
+
+static int ArrowDeviceCudaIsRegistered(struct ArrowDevice* device) {
+  return registry_singleton.devices != NULL && device->device_id >= 0 &&
+         device->device_id < registry_singleton.n_devices &&
+         device == registry_singleton.devices + device->device_id;
+}
+
+// Enables access by device to the memory of peer the first time it is requested.
+// Returns ENOTSUP if the pair can't access each other directly (e.g., because they
+// aren't connected by NVLink or the same PCIe root complex).
+static ArrowErrorCode ArrowDeviceCudaPeerAccessInternal(struct ArrowDevice* device,
+                                                        struct ArrowDevice* peer) {
+  if (device == peer) {
+    return NANOARROW_OK;
+  }
+
+  char* state = registry_singleton.peer_access +
+                device->device_id * registry_singleton.n_devices + peer->device_id;
+
+  ArrowSpinLockAcquire(&registry_singleton.peer_access_lock);
+  if (*state == NANOARROW_CUDA_PEER_ACCESS_UNKNOWN) {
+    int can_access = 0;
+    cudaError_t result = cudaDeviceCanAccessPeer(&can_access, (int)device->device_id,
+                                                 (int)peer->device_id);
+    if (result == cudaSuccess && can_access) {
+      int prev_device = 0;
+      cudaGetDevice(&prev_device);
+      result = cudaSetDevice((int)device->device_id);
+      if (result == cudaSuccess) {
+        result = cudaDeviceEnablePeerAccess((int)peer->device_id, 0);
+      }
+      cudaSetDevice(prev_device);
+
+      // Access may have been enabled outside of nanoarrow, which isn't a failure
+      if (result == cudaErrorPeerAccessAlreadyEnabled) {
+        cudaGetLastError();
+        result = cudaSuccess;
+      }
+    }
+
+    *state = result == cudaSuccess && can_access ? NANOARROW_CUDA_PEER_ACCESS_ENABLED
+                                                 : NANOARROW_CUDA_PEER_ACCESS_UNAVAILABLE;
+  }
+
+  int enabled = *state == NANOARROW_CUDA_PEER_ACCESS_ENABLED;
+  ArrowSpinLockRelease(&registry_singleton.peer_access_lock);
+  return enabled ? NANOARROW_OK : ENOTSUP;
+}
+
+ArrowErrorCode ArrowDeviceCudaEnablePeerAccess(struct ArrowDevice* device,
+                                               struct ArrowDevice* peer) {
+  if (device->device_type != ARROW_DEVICE_CUDA ||
+      peer->device_type != ARROW_DEVICE_CUDA || !ArrowDeviceCudaIsRegistered(device) ||
+      !ArrowDeviceCudaIsRegistered(peer)) {
+    return EINVAL;
+  }
+
+  return ArrowDeviceCudaPeerAccessInternal(device, peer);
+}
+
+// Resolves the kind of copy needed to copy memory from device_src to device_dst
+static ArrowErrorCode ArrowDeviceCudaMemcpyKind(struct ArrowDevice* device_src,
+                                                struct ArrowDevice* device_dst,
+                                                enum cudaMemcpyKind* out) {
   if (device_src->device_type == ARROW_DEVICE_CPU &&
       device_dst->device_type == ARROW_DEVICE_CUDA) {
-    NANOARROW_RETURN_NOT_OK(
-        ArrowDeviceCudaAllocateBuffer(device_dst, &tmp, src.size_bytes));
-    memcpy_kind = cudaMemcpyHostToDevice;
-
+    *out = cudaMemcpyHostToDevice;
   } else if (device_src->device_type == ARROW_DEVICE_CUDA &&
              device_dst->device_type == ARROW_DEVICE_CUDA) {
-    NANOARROW_RETURN_NOT_OK(
-        ArrowDeviceCudaAllocateBuffer(device_dst, &tmp, src.size_bytes));
-    memcpy_kind = cudaMemcpyDeviceToDevice;
-
+    *out = cudaMemcpyDeviceToDevice;
   } else if (device_src->device_type == ARROW_DEVICE_CUDA &&
              device_dst->device_type == ARROW_DEVICE_CPU) {
-    ArrowBufferInit(&tmp);
-    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(&tmp, src.size_bytes));
-    tmp.size_bytes = src.size_bytes;
-    memcpy_kind = cudaMemcpyDeviceToHost;
-
+    *out = cudaMemcpyDeviceToHost;
   } else if (device_src->device_type == ARROW_DEVICE_CPU &&
              device_dst->device_type == ARROW_DEVICE_CUDA_HOST) {
-    NANOARROW_RETURN_NOT_OK(
-        ArrowDeviceCudaAllocateBuffer(device_dst, &tmp, src.size_bytes));
-    memcpy_kind = cudaMemcpyHostToHost;
-
+    *out = cudaMemcpyHostToHost;
   } else if (device_src->device_type == ARROW_DEVICE_CUDA_HOST &&
              device_dst->device_type == ARROW_DEVICE_CUDA_HOST) {
-    NANOARROW_RETURN_NOT_OK(
-        ArrowDeviceCudaAllocateBuffer(device_dst, &tmp, src.size_bytes));
-    memcpy_kind = cudaMemcpyHostToHost;
-
+    *out = cudaMemcpyHostToHost;
   } else if (device_src->device_type == ARROW_DEVICE_CUDA_HOST &&
              device_dst->device_type == ARROW_DEVICE_CPU) {
-    ArrowBufferInit(&tmp);
-    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(&tmp, src.size_bytes));
-    tmp.size_bytes = src.size_bytes;
-    memcpy_kind = cudaMemcpyHostToHost;
-
+    *out = cudaMemcpyHostToHost;
   } else {
     return ENOTSUP;
   }
 
-  cudaError_t result =
-      cudaMemcpy(tmp.data, src.data.as_uint8, (size_t)src.size_bytes, memcpy_kind);
-  if (result != cudaSuccess) {
+  return NANOARROW_OK;
+}
+
+// Copies size_bytes from src on device_src to dst on device_dst, issuing the copy on
+// stream if async is non-zero. Copies between two CUDA devices are peer copies,
+// which are direct (rather than staged through host memory) if peer access could be
+// enabled.
+static ArrowErrorCode ArrowDeviceCudaMemcpy(struct ArrowDevice* device_src,
+                                            const void* src,
+                                            struct ArrowDevice* device_dst, void* dst,
+                                            int64_t size_bytes,
+                                            enum cudaMemcpyKind memcpy_kind, int async,
+                                            cudaStream_t stream) {
+  cudaError_t result;
+  if (memcpy_kind == cudaMemcpyDeviceToDevice &&
+      device_src->device_id != device_dst->device_id) {
+    if (ArrowDeviceCudaIsRegistered(device_src) &&
+        ArrowDeviceCudaIsRegistered(device_dst)) {
+      ArrowDeviceCudaPeerAccessInternal(device_dst, device_src);
+      ArrowDeviceCudaPeerAccessInternal(device_src, device_dst);
+    }
+
+    if (async) {
+      result = cudaMemcpyPeerAsync(dst, (int)device_dst->device_id, src,
+                                   (int)device_src->device_id, (size_t)size_bytes,
+                                   stream);
+    } else {
+      result = cudaMemcpyPeer(dst, (int)device_dst->device_id, src,
+                              (int)device_src->device_id, (size_t)size_bytes);
+    }
+  } else if (async) {
+    result = cudaMemcpyAsync(dst, src, (size_t)size_bytes, memcpy_kind, stream);
+  } else {
+    result = cudaMemcpy(dst, src, (size_t)size_bytes, memcpy_kind);
+  }
+
+  return result == cudaSuccess ? NANOARROW_OK : EINVAL;
+}
+
+// Allocates a buffer of size_bytes on device_dst to be the destination of a copy
+static ArrowErrorCode ArrowDeviceCudaAllocateCopyDestination(
+    struct ArrowDevice* device_dst, int64_t size_bytes, struct ArrowBuffer* dst) {
+  if (device_dst->device_type == ARROW_DEVICE_CPU) {
+    ArrowBufferInit(dst);
+    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(dst, size_bytes));
+    dst->size_bytes = size_bytes;
+    return NANOARROW_OK;
+  }
+
+  return ArrowDeviceCudaAllocateBuffer(device_dst, dst, size_bytes);
+}
+
+static ArrowErrorCode ArrowDeviceCudaBufferInit(struct ArrowDevice* device_src,
+                                                struct ArrowBufferView src,
+                                                struct ArrowDevice* device_dst,
+                                                struct ArrowBuffer* dst) {
+  enum cudaMemcpyKind memcpy_kind;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowDeviceCudaMemcpyKind(device_src, device_dst, &memcpy_kind));
+
+  struct ArrowBuffer tmp;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowDeviceCudaAllocateCopyDestination(device_dst, src.size_bytes, &tmp));
+
+  int result = ArrowDeviceCudaMemcpy(device_src, src.data.data, device_dst, tmp.data,
+                                     src.size_bytes, memcpy_kind, 0, 0);
+  if (result != NANOARROW_OK) {
     ArrowBufferReset(&tmp);
-    return EINVAL;
+    return result;
   }
 
   ArrowBufferMove(&tmp, dst);
@@ -235,37 +647,435 @@ static ArrowErrorCode ArrowDeviceCudaBufferCopy(struct ArrowDevice* device_src,
                                                 struct ArrowDevice* device_dst,
                                                 struct ArrowBufferView dst) {
   enum cudaMemcpyKind memcpy_kind;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowDeviceCudaMemcpyKind(device_src, device_dst, &memcpy_kind));
 
-  if (device_src->device_type == ARROW_DEVICE_CPU &&
-      device_dst->device_type == ARROW_DEVICE_CUDA) {
-    memcpy_kind = cudaMemcpyHostToDevice;
-  } else if (device_src->device_type == ARROW_DEVICE_CUDA &&
-             device_dst->device_type == ARROW_DEVICE_CUDA) {
-    memcpy_kind = cudaMemcpyDeviceToDevice;
-  } else if (device_src->device_type == ARROW_DEVICE_CUDA &&
-             device_dst->device_type == ARROW_DEVICE_CPU) {
-    memcpy_kind = cudaMemcpyDeviceToHost;
-  } else if (device_src->device_type == ARROW_DEVICE_CPU &&
-             device_dst->device_type == ARROW_DEVICE_CUDA_HOST) {
-    memcpy_kind = cudaMemcpyHostToHost;
-  } else if (device_src->device_type == ARROW_DEVICE_CUDA_HOST &&
-             device_dst->device_type == ARROW_DEVICE_CUDA_HOST) {
-    memcpy_kind = cudaMemcpyHostToHost;
-  } else if (device_src->device_type == ARROW_DEVICE_CUDA_HOST &&
-             device_dst->device_type == ARROW_DEVICE_CPU) {
-    memcpy_kind = cudaMemcpyHostToHost;
-  } else {
+  return ArrowDeviceCudaMemcpy(device_src, src.data.data, device_dst,
+                               (void*)dst.data.data, dst.size_bytes, memcpy_kind, 0, 0);
+}
+
+ArrowErrorCode ArrowDeviceCudaBufferInitAsync(struct ArrowDevice* device_src,
+                                              struct ArrowBufferView src,
+                                              struct ArrowDevice* device_dst,
+                                              struct ArrowBuffer* dst,
+                                              cudaStream_t stream) {
+  enum cudaMemcpyKind memcpy_kind;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowDeviceCudaMemcpyKind(device_src, device_dst, &memcpy_kind));
+
+  struct ArrowBuffer tmp;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowDeviceCudaAllocateCopyDestination(device_dst, src.size_bytes, &tmp));
+
+  int result = ArrowDeviceCudaMemcpy(device_src, src.data.data, device_dst, tmp.data,
+                                     src.size_bytes, memcpy_kind, 1, stream);
+  if (result != NANOARROW_OK) {
+    ArrowBufferReset(&tmp);
+    return result;
+  }
+
+  ArrowBufferMove(&tmp, dst);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowDeviceCudaBufferCopyAsync(struct ArrowDevice* device_src,
+                                              struct ArrowBufferView src,
+                                              struct ArrowDevice* device_dst,
+                                              struct ArrowBufferView dst,
+                                              cudaStream_t stream) {
+  enum cudaMemcpyKind memcpy_kind;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowDeviceCudaMemcpyKind(device_src, device_dst, &memcpy_kind));
+
+  return ArrowDeviceCudaMemcpy(device_src, src.data.data, device_dst,
+                               (void*)dst.data.data, dst.size_bytes, memcpy_kind, 1,
+                               stream);
+}
+
+ArrowErrorCode ArrowDeviceCudaBufferCopyManyToCpu(struct ArrowDevice* device_src,
+                                                  const struct ArrowBufferView* src,
+                                                  struct ArrowBufferView* dst,
+                                                  int64_t n) {
+  if (device_src->device_type != ARROW_DEVICE_CUDA) {
     return ENOTSUP;
   }
 
-  cudaError_t result = cudaMemcpy((void*)dst.data.as_uint8, src.data.as_uint8,
-                                  dst.size_bytes, memcpy_kind);
+  int64_t total_size_bytes = 0;
+  for (int64_t i = 0; i < n; i++) {
+    total_size_bytes += dst[i].size_bytes;
+  }
+
+  if (total_size_bytes == 0) {
+    return NANOARROW_OK;
+  }
+
+  // Gather the sections into contiguous device memory with device-side copies that
+  // don't block, such that a single copy to the CPU waits for all of them
+  struct ArrowBuffer gathered;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowDeviceCudaAllocateBuffer(device_src, &gathered, total_size_bytes));
+
+  struct ArrowBuffer host;
+  ArrowBufferInit(&host);
+  int result = ArrowBufferReserve(&host, total_size_bytes);
+
+  int64_t offset = 0;
+  for (int64_t i = 0; i < n && result == NANOARROW_OK; i++) {
+    if (cudaMemcpyAsync(gathered.data + offset, src[i].data.data,
+                        (size_t)dst[i].size_bytes, cudaMemcpyDeviceToDevice,
+                        0) != cudaSuccess) {
+      result = EINVAL;
+    }
+    offset += dst[i].size_bytes;
+  }
+
+  if (result == NANOARROW_OK &&
+      cudaMemcpy(host.data, gathered.data, (size_t)total_size_bytes,
+                 cudaMemcpyDeviceToHost) != cudaSuccess) {
+    result = EINVAL;
+  }
+
+  if (result == NANOARROW_OK) {
+    offset = 0;
+    for (int64_t i = 0; i < n; i++) {
+      memcpy((void*)dst[i].data.data, host.data + offset, (size_t)dst[i].size_bytes);
+      offset += dst[i].size_bytes;
+    }
+  }
+
+  ArrowBufferReset(&host);
+  ArrowBufferReset(&gathered);
+  return result;
+}
+
+static ArrowErrorCode ArrowDeviceCudaArrayViewCopyInternal(struct ArrowDevice* device_src,
+                                                           struct ArrowArrayView* src,
+                                                           struct ArrowDevice* device_dst,
+                                                           cudaStream_t stream,
+                                                           struct ArrowArray* dst) {
+  dst->length = src->length;
+  dst->offset = src->offset;
+  dst->null_count = src->null_count;
+
+  for (int i = 0; i < 3; i++) {
+    if (src->layout.buffer_type[i] == NANOARROW_BUFFER_TYPE_NONE) {
+      break;
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowDeviceCudaBufferInitAsync(
+        device_src, src->buffer_views[i], device_dst, ArrowArrayBuffer(dst, i), stream));
+  }
+
+  for (int64_t i = 0; i < src->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowDeviceCudaArrayViewCopyInternal(
+        device_src, src->children[i], device_dst, stream, dst->children[i]));
+  }
+
+  if (src->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowDeviceCudaArrayViewCopyInternal(
+        device_src, src->dictionary, device_dst, stream, dst->dictionary));
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowDeviceCudaArrayViewCopyAsync(struct ArrowDeviceArrayView* src,
+                                                 struct ArrowDevice* device_dst,
+                                                 cudaStream_t stream,
+                                                 struct ArrowDeviceArray* dst) {
+  struct ArrowArray tmp;
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromArrayView(&tmp, &src->array_view, NULL));
+
+  int result = ArrowDeviceCudaArrayViewCopyInternal(src->device, &src->array_view,
+                                                    device_dst, stream, &tmp);
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayFinishBuilding(&tmp, NANOARROW_VALIDATION_LEVEL_MINIMAL, NULL);
+  }
+
+  // A CPU array has no sync_event, so its buffers must be complete when it is returned
+  // (as must those of any array whose copies failed before it can be released)
+  if (result != NANOARROW_OK || device_dst->device_type == ARROW_DEVICE_CPU) {
+    if (cudaStreamSynchronize(stream) != cudaSuccess && result == NANOARROW_OK) {
+      result = EINVAL;
+    }
+  }
+
+  if (result != NANOARROW_OK) {
+    tmp.release(&tmp);
+    return result;
+  }
+
+  result = ArrowDeviceArrayInit(device_dst, dst, &tmp);
+  if (result != NANOARROW_OK) {
+    tmp.release(&tmp);
+    return result;
+  }
+
+  // Otherwise, one event recorded after every copy signals that all of them are done
+  if (dst->sync_event != NULL &&
+      cudaEventRecord(*((cudaEvent_t*)dst->sync_event), stream) != cudaSuccess) {
+    cudaStreamSynchronize(stream);
+    dst->array.release(&dst->array);
+    return EINVAL;
+  }
+
+  return NANOARROW_OK;
+}
+
+// The kind of reduction computed on the device for an ArrowArrayView by
+// ArrowDeviceCudaArrayViewValidate()
+enum ArrowDeviceCudaCheckType {
+  NANOARROW_CUDA_CHECK_VALIDITY,
+  NANOARROW_CUDA_CHECK_OFFSETS,
+  NANOARROW_CUDA_CHECK_UNION
+};
+
+struct ArrowDeviceCudaCheck {
+  enum ArrowDeviceCudaCheckType check_type;
+  struct ArrowArrayView* array_view;
+  // The number of elements checked, which is needed to interpret the result
+  int64_t n;
+  // The largest valid offset for NANOARROW_CUDA_CHECK_OFFSETS
+  int64_t max_value;
+};
+
+// Appends the checks of array_view and its descendants to checks (an ArrowBuffer of
+// struct ArrowDeviceCudaCheck), in the order in which they are reported
+static ArrowErrorCode ArrowDeviceCudaCollectChecks(struct ArrowArrayView* array_view,
+                                                   struct ArrowBuffer* checks,
+                                                   struct ArrowError* error) {
+  struct ArrowDeviceCudaCheck check;
+  check.array_view = array_view;
+  check.max_value = 0;
+
+  if (array_view->layout.buffer_type[0] == NANOARROW_BUFFER_TYPE_VALIDITY) {
+    if (array_view->buffer_views[0].data.data == NULL) {
+      if (array_view->null_count == -1) {
+        array_view->null_count = 0;
+      }
+    } else if (array_view->length > 0) {
+      check.check_type = NANOARROW_CUDA_CHECK_VALIDITY;
+      check.n = array_view->length;
+      NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(checks, &check, sizeof(check)));
+    }
+  }
+
+  if (array_view->layout.buffer_type[1] == NANOARROW_BUFFER_TYPE_DATA_OFFSET) {
+    check.check_type = NANOARROW_CUDA_CHECK_OFFSETS;
+    check.n = array_view->buffer_views[1].size_bytes /
+              (array_view->layout.element_size_bits[1] / 8);
+    switch (array_view->storage_type) {
+      case NANOARROW_TYPE_STRING:
+      case NANOARROW_TYPE_BINARY:
+      case NANOARROW_TYPE_LARGE_STRING:
+      case NANOARROW_TYPE_LARGE_BINARY:
+        check.max_value = array_view->buffer_views[2].size_bytes;
+        break;
+      default:
+        check.max_value = array_view->children[0]->length;
+        break;
+    }
+
+    if (check.n > 0) {
+      NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(checks, &check, sizeof(check)));
+    }
+  }
+
+  if (array_view->storage_type == NANOARROW_TYPE_DENSE_UNION ||
+      array_view->storage_type == NANOARROW_TYPE_SPARSE_UNION) {
+    if (array_view->union_type_id_map == NULL) {
+      ArrowErrorSet(error,
+                    "Insufficient information provided for validation of union array");
+      return EINVAL;
+    }
+
+    check.check_type = NANOARROW_CUDA_CHECK_UNION;
+    check.n = array_view->length;
+    if (check.n > 0) {
+      NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(checks, &check, sizeof(check)));
+    }
+  }
+
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowDeviceCudaCollectChecks(array_view->children[i], checks, error));
+  }
+
+  if (array_view->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowDeviceCudaCollectChecks(array_view->dictionary, checks, error));
+  }
+
+  return NANOARROW_OK;
+}
+
+static cudaError_t ArrowDeviceCudaLaunchCheck(struct ArrowDeviceCudaCheck* check,
+                                              unsigned long long* out,
+                                              cudaStream_t stream) {
+  struct ArrowArrayView* array_view = check->array_view;
+  switch (check->check_type) {
+    case NANOARROW_CUDA_CHECK_VALIDITY:
+      return ArrowDeviceCudaLaunchCountBits(array_view->buffer_views[0].data.as_uint8,
+                                            array_view->offset, array_view->length, out,
+                                            stream);
+    case NANOARROW_CUDA_CHECK_OFFSETS:
+      if (array_view->layout.element_size_bits[1] == 32) {
+        return ArrowDeviceCudaLaunchCheckOffsetsInt32(
+            array_view->buffer_views[1].data.as_int32, check->n, check->max_value, out,
+            stream);
+      } else {
+        return ArrowDeviceCudaLaunchCheckOffsetsInt64(
+            array_view->buffer_views[1].data.as_int64, check->n, check->max_value, out,
+            stream);
+      }
+    case NANOARROW_CUDA_CHECK_UNION: {
+      struct ArrowDeviceCudaUnionChildren children;
+      memset(children.type_id_to_child_index, -1,
+             sizeof(children.type_id_to_child_index));
+      for (int64_t i = 0; i < array_view->n_children; i++) {
+        int8_t type_id = array_view->union_type_id_map[128 + i];
+        if (type_id >= 0) {
+          children.type_id_to_child_index[type_id] = (int8_t)i;
+        }
+        children.child_length[i] = array_view->children[i]->length;
+      }
+
+      const int32_t* offsets = NULL;
+      if (array_view->storage_type == NANOARROW_TYPE_DENSE_UNION) {
+        offsets = array_view->buffer_views[1].data.as_int32 + array_view->offset;
+      }
+
+      return ArrowDeviceCudaLaunchCheckUnion(
+          array_view->buffer_views[0].data.as_int8 + array_view->offset, offsets,
+          check->n, children, out, stream);
+    }
+    default:
+      return cudaSuccess;
+  }
+}
+
+static ArrowErrorCode ArrowDeviceCudaReportCheck(struct ArrowDeviceCudaCheck* check,
+                                                 unsigned long long result,
+                                                 struct ArrowError* error) {
+  struct ArrowArrayView* array_view = check->array_view;
+  if (check->check_type == NANOARROW_CUDA_CHECK_VALIDITY) {
+    int64_t null_count = array_view->length - (int64_t)result;
+    if (array_view->null_count == -1) {
+      array_view->null_count = null_count;
+    } else if (array_view->null_count != null_count) {
+      ArrowErrorSet(error, "Expected null_count of %ld but found %ld nulls in validity",
+                    (long)array_view->null_count, (long)null_count);
+      return EINVAL;
+    }
+
+    return NANOARROW_OK;
+  }
+
+  if (result == 0) {
+    return NANOARROW_OK;
+  }
+
+  int64_t i = check->n - (int64_t)result;
+  if (check->check_type == NANOARROW_CUDA_CHECK_OFFSETS) {
+    ArrowErrorSet(error,
+                  "[%ld] Expected offsets to be non-decreasing and between 0 and %ld",
+                  (long)i, (long)check->max_value);
+  } else {
+    ArrowErrorSet(error,
+                  "[%ld] Expected union type id to refer to a child and offset to refer "
+                  "to an element of that child",
+                  (long)i);
+  }
+
+  return EINVAL;
+}
+
+static ArrowErrorCode ArrowDeviceCudaRunChecks(struct ArrowDevice* device,
+                                               struct ArrowDeviceCudaCheck* checks,
+                                               int64_t n_checks, unsigned long long* out,
+                                               struct ArrowError* error) {
+  struct ArrowBuffer results;
+  NANOARROW_RETURN_NOT_OK(ArrowDeviceCudaAllocateBuffer(
+      device, &results, n_checks * (int64_t)sizeof(unsigned long long)));
+
+  // Every check is queued on the same stream behind one memset and in front of one
+  // copy of all of the results, such that nothing waits until the copy
+  unsigned long long* results_data = (unsigned long long*)results.data;
+  int prev_device = 0;
+  cudaError_t result = cudaGetDevice(&prev_device);
+  if (result == cudaSuccess) {
+    result = cudaSetDevice((int)device->device_id);
+  }
+
+  if (result == cudaSuccess) {
+    result = cudaMemsetAsync(results_data, 0, (size_t)results.size_bytes, 0);
+  }
+
+  for (int64_t i = 0; i < n_checks && result == cudaSuccess; i++) {
+    result = ArrowDeviceCudaLaunchCheck(checks + i, results_data + i, 0);
+  }
+
+  if (result == cudaSuccess) {
+    result = cudaMemcpyAsync(out, results_data, (size_t)results.size_bytes,
+                             cudaMemcpyDeviceToHost, 0);
+  }
+
+  if (result == cudaSuccess) {
+    result = cudaStreamSynchronize(0);
+  } else {
+    cudaStreamSynchronize(0);
+  }
+
+  cudaSetDevice(prev_device);
+  ArrowBufferReset(&results);
+
   if (result != cudaSuccess) {
+    ArrowErrorSet(error, "Validation on the device failed: %s",
+                  cudaGetErrorString(result));
     return EINVAL;
   }
+
   return NANOARROW_OK;
 }
 
+ArrowErrorCode ArrowDeviceCudaArrayViewValidate(
+    struct ArrowDeviceArrayView* device_array_view, struct ArrowError* error) {
+  struct ArrowDevice* device = device_array_view->device;
+  if (device->device_type != ARROW_DEVICE_CUDA ||
+      device->release != &ArrowDeviceCudaRelease) {
+    ArrowErrorSet(error, "Expected an array view of a CUDA device array");
+    return EINVAL;
+  }
+
+  struct ArrowBuffer checks;
+  ArrowBufferInit(&checks);
+  int result =
+      ArrowDeviceCudaCollectChecks(&device_array_view->array_view, &checks, error);
+  int64_t n_checks = checks.size_bytes / (int64_t)sizeof(struct ArrowDeviceCudaCheck);
+  if (result != NANOARROW_OK || n_checks == 0) {
+    ArrowBufferReset(&checks);
+    return result;
+  }
+
+  struct ArrowDeviceCudaCheck* checks_data = (struct ArrowDeviceCudaCheck*)checks.data;
+  unsigned long long* results =
+      (unsigned long long*)ArrowMalloc(n_checks * sizeof(unsigned long long));
+  if (results == NULL) {
+    ArrowBufferReset(&checks);
+    ArrowErrorSet(error, "Failed to allocate validation results");
+    return ENOMEM;
+  }
+
+  result = ArrowDeviceCudaRunChecks(device, checks_data, n_checks, results, error);
+  for (int64_t i = 0; i < n_checks && result == NANOARROW_OK; i++) {
+    result = ArrowDeviceCudaReportCheck(checks_data + i, results[i], error);
+  }
+
+  ArrowFree(results);
+  ArrowBufferReset(&checks);
+  return result;
+}
+
 static ArrowErrorCode ArrowDeviceCudaSynchronize(struct ArrowDevice* device,
                                                  void* sync_event,
                                                  struct ArrowError* error) {
@@ -290,6 +1100,46 @@ static ArrowErrorCode ArrowDeviceCudaSynchronize(struct ArrowDevice* device,
   return NANOARROW_OK;
 }
 
+// Check that every buffer of array is memory that device can access without a copy,
+// i.e., pinned host memory for ARROW_DEVICE_CUDA_HOST or managed memory for
+// ARROW_DEVICE_CUDA.
+static int ArrowDeviceCudaArrayIsAccessible(struct ArrowDevice* device,
+                                            struct ArrowArray* array) {
+  enum cudaMemoryType expected_type = cudaMemoryTypeManaged;
+  if (device->device_type == ARROW_DEVICE_CUDA_HOST) {
+    expected_type = cudaMemoryTypeHost;
+  }
+
+  for (int64_t i = 0; i < array->n_buffers; i++) {
+    if (array->buffers[i] == NULL) {
+      continue;
+    }
+
+    struct cudaPointerAttributes attributes;
+    if (cudaPointerGetAttributes(&attributes, array->buffers[i]) != cudaSuccess) {
+      // Clear the error such that it is not reported by a later call
+      cudaGetLastError();
+      return 0;
+    }
+
+    if (attributes.type != expected_type) {
+      return 0;
+    }
+  }
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    if (!ArrowDeviceCudaArrayIsAccessible(device, array->children[i])) {
+      return 0;
+    }
+  }
+
+  if (array->dictionary != NULL) {
+    return ArrowDeviceCudaArrayIsAccessible(device, array->dictionary);
+  }
+
+  return 1;
+}
+
 static ArrowErrorCode ArrowDeviceCudaArrayMove(struct ArrowDevice* device_src,
                                                struct ArrowDeviceArray* src,
                                                struct ArrowDevice* device_dst,
@@ -312,13 +1162,26 @@ static ArrowErrorCode ArrowDeviceCudaArrayMove(struct ArrowDevice* device_src,
     return NANOARROW_OK;
   }
 
+  if (device_src->device_type == ARROW_DEVICE_CPU &&
+      (device_dst->device_type == ARROW_DEVICE_CUDA_HOST ||
+       device_dst->device_type == ARROW_DEVICE_CUDA) &&
+      ArrowDeviceCudaArrayIsAccessible(device_dst, &src->array)) {
+    // Move: every buffer is already pinned (or managed) memory (e.g., an array built
+    // with ArrowDeviceArrayInitFromSchema()), so only the metadata changes. A CPU
+    // array has no sync_event to wait on.
+    return ArrowDeviceArrayInit(device_dst, dst, &src->array);
+  }
+
   // TODO: We can theoretically also do a move from CUDA_HOST to CUDA
 
   return ENOTSUP;
 }
 
 static void ArrowDeviceCudaRelease(struct ArrowDevice* device) {
-  // No private_data to release
+  // Buffers allocated by this device must be freed before it is released
+  ArrowDeviceCudaPoolTrimInternal(device);
+  ArrowFree(device->private_data);
+  device->private_data = NULL;
 }
 
 static ArrowErrorCode ArrowDeviceCudaInitDevice(struct ArrowDevice* device,
@@ -355,49 +1218,393 @@ static ArrowErrorCode ArrowDeviceCudaInitDevice(struct ArrowDevice* device,
   device->buffer_copy = &ArrowDeviceCudaBufferCopy;
   device->synchronize_event = &ArrowDeviceCudaSynchronize;
   device->release = &ArrowDeviceCudaRelease;
-  device->private_data = NULL;
+
+  struct ArrowDeviceCudaPool* pool =
+      (struct ArrowDeviceCudaPool*)ArrowMalloc(sizeof(struct ArrowDeviceCudaPool));
+  if (pool == NULL) {
+    ArrowErrorSet(error, "Failed to allocate CUDA device allocation pool");
+    return ENOMEM;
+  }
+
+  ArrowSpinLockInit(&pool->lock);
+  for (int i = 0; i < NANOARROW_CUDA_POOL_N_SIZE_CLASSES; i++) {
+    pool->free_blocks[i] = NULL;
+  }
+  pool->max_bytes_retained = 0;
+  pool->n_free_events = 0;
+  pool->stats.n_hits = 0;
+  pool->stats.n_misses = 0;
+  pool->stats.bytes_retained = 0;
+  device->private_data = pool;
 
   return NANOARROW_OK;
 }
 
-struct ArrowDevice* ArrowDeviceCuda(ArrowDeviceType device_type, int64_t device_id) {
-  int n_devices;
-  cudaError_t result = cudaGetDeviceCount(&n_devices);
-  if (result != cudaSuccess) {
-    return NULL;
+// Initializes the devices of registry_singleton, every pair of which starts with
+// unknown peer access
+static ArrowErrorCode ArrowDeviceCudaRegistryInit(int n_devices) {
+  struct ArrowDevice* devices =
+      (struct ArrowDevice*)ArrowMalloc(2 * n_devices * sizeof(struct ArrowDevice));
+  char* peer_access = (char*)ArrowMalloc(n_devices * n_devices);
+  if (devices == NULL || peer_access == NULL) {
+    ArrowFree(devices);
+    ArrowFree(peer_access);
+    return ENOMEM;
   }
-  static struct ArrowDevice* devices_singleton = NULL;
-  if (devices_singleton == NULL) {
-    devices_singleton =
-        (struct ArrowDevice*)ArrowMalloc(2 * n_devices * sizeof(struct ArrowDevice));
 
-    for (int i = 0; i < n_devices; i++) {
-      int result =
-          ArrowDeviceCudaInitDevice(devices_singleton + i, ARROW_DEVICE_CUDA, i, NULL);
+  for (int i = 0; i < n_devices; i++) {
+    int result = ArrowDeviceCudaInitDevice(devices + i, ARROW_DEVICE_CUDA, i, NULL);
+    if (result == NANOARROW_OK) {
+      result = ArrowDeviceCudaInitDevice(devices + n_devices + i, ARROW_DEVICE_CUDA_HOST,
+                                         i, NULL);
       if (result != NANOARROW_OK) {
-        ArrowFree(devices_singleton);
-        devices_singleton = NULL;
+        ArrowFree(devices[i].private_data);
       }
+    }
 
-      result = ArrowDeviceCudaInitDevice(devices_singleton + n_devices + i,
-                                         ARROW_DEVICE_CUDA_HOST, i, NULL);
-      if (result != NANOARROW_OK) {
-        ArrowFree(devices_singleton);
-        devices_singleton = NULL;
+    if (result != NANOARROW_OK) {
+      for (int j = 0; j < i; j++) {
+        ArrowFree(devices[j].private_data);
+        ArrowFree(devices[n_devices + j].private_data);
       }
+      ArrowFree(devices);
+      ArrowFree(peer_access);
+      return result;
     }
   }
 
-  if (device_id < 0 || device_id >= n_devices) {
+  memset(peer_access, NANOARROW_CUDA_PEER_ACCESS_UNKNOWN, n_devices * n_devices);
+  ArrowSpinLockInit(&registry_singleton.peer_access_lock);
+  registry_singleton.n_devices = n_devices;
+  registry_singleton.peer_access = peer_access;
+  registry_singleton.devices = devices;
+  return NANOARROW_OK;
+}
+
+struct ArrowDevice* ArrowDeviceCuda(ArrowDeviceType device_type, int64_t device_id) {
+  if (registry_singleton.devices == NULL) {
+    int n_devices;
+    cudaError_t result = cudaGetDeviceCount(&n_devices);
+    if (result != cudaSuccess || n_devices == 0 ||
+        ArrowDeviceCudaRegistryInit(n_devices) != NANOARROW_OK) {
+      return NULL;
+    }
+  }
+
+  if (device_id < 0 || device_id >= registry_singleton.n_devices) {
     return NULL;
   }
 
   switch (device_type) {
     case ARROW_DEVICE_CUDA:
-      return devices_singleton + device_id;
+      return registry_singleton.devices + device_id;
     case ARROW_DEVICE_CUDA_HOST:
-      return devices_singleton + n_devices + device_id;
+      return registry_singleton.devices + registry_singleton.n_devices + device_id;
     default:
       return NULL;
   }
 }
+
+ArrowErrorCode ArrowDeviceCudaPoolSetMaxBytesRetained(struct ArrowDevice* device,
+                                                      int64_t max_bytes_retained) {
+  if (device->release != &ArrowDeviceCudaRelease || max_bytes_retained < 0) {
+    return EINVAL;
+  }
+
+  struct ArrowDeviceCudaPool* pool = (struct ArrowDeviceCudaPool*)device->private_data;
+  ArrowSpinLockAcquire(&pool->lock);
+  int needs_trim = pool->stats.bytes_retained > max_bytes_retained;
+  pool->max_bytes_retained = max_bytes_retained;
+  ArrowSpinLockRelease(&pool->lock);
+
+  if (needs_trim) {
+    ArrowDeviceCudaPoolTrimInternal(device);
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowDeviceCudaPoolStats(struct ArrowDevice* device,
+                                        struct ArrowBufferPoolStats* out) {
+  if (device->release != &ArrowDeviceCudaRelease) {
+    return EINVAL;
+  }
+
+  struct ArrowDeviceCudaPool* pool = (struct ArrowDeviceCudaPool*)device->private_data;
+  ArrowSpinLockAcquire(&pool->lock);
+  *out = pool->stats;
+  ArrowSpinLockRelease(&pool->lock);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowDeviceCudaPoolTrim(struct ArrowDevice* device) {
+  if (device->release != &ArrowDeviceCudaRelease) {
+    return EINVAL;
+  }
+
+  ArrowDeviceCudaPoolTrimInternal(device);
+  return NANOARROW_OK;
+}
+
+// A batch whose copy to the device has been issued. The source must remain valid until
+// the copy is complete (i.e., after copied has occurred), which may be after the
+// consumer of the stream has released the copy.
+struct ArrowDeviceCudaArrayStreamSlot {
+  struct ArrowArray array;
+  struct ArrowDeviceArrayView device_array_view;
+  struct ArrowDeviceArray device_array;
+  cudaEvent_t copied;
+};
+
+struct ArrowDeviceCudaArrayStreamPrivate {
+  struct ArrowDevice* device;
+  struct ArrowArrayStream naive_stream;
+  struct ArrowSchema schema;
+  cudaStream_t stream;
+  // A ring of n_prefetch + 1 slots where slots[head] is the next batch to return and
+  // the n_pending slots after it have also been issued
+  struct ArrowDeviceCudaArrayStreamSlot* slots;
+  int64_t n_slots;
+  int64_t head;
+  int64_t n_pending;
+  int finished;
+  struct ArrowError error;
+};
+
+// Releases the source of a slot once its copy is complete
+static void ArrowDeviceCudaArrayStreamSlotReset(
+    struct ArrowDeviceCudaArrayStreamSlot* slot) {
+  if (slot->array.release != NULL) {
+    cudaEventSynchronize(slot->copied);
+    slot->array.release(&slot->array);
+  }
+}
+
+// Pulls the next batch from the source stream and issues its copy into the slot after
+// the pending ones
+static ArrowErrorCode ArrowDeviceCudaArrayStreamIssue(
+    struct ArrowDeviceCudaArrayStreamPrivate* private_data) {
+  struct ArrowDeviceCudaArrayStreamSlot* slot =
+      private_data->slots +
+      (private_data->head + private_data->n_pending) % private_data->n_slots;
+  ArrowDeviceCudaArrayStreamSlotReset(slot);
+
+  struct ArrowArrayStream* naive_stream = &private_data->naive_stream;
+  int result = naive_stream->get_next(naive_stream, &slot->array);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(&private_data->error, "%s",
+                  naive_stream->get_last_error(naive_stream));
+    return result;
+  }
+
+  if (slot->array.release == NULL) {
+    private_data->finished = 1;
+    return NANOARROW_OK;
+  }
+
+  result = ArrowArrayViewSetArray(&slot->device_array_view.array_view, &slot->array,
+                                  &private_data->error);
+  if (result == NANOARROW_OK) {
+    result = ArrowDeviceCudaArrayViewCopyAsync(&slot->device_array_view,
+                                               private_data->device,
+                                               private_data->stream, &slot->device_array);
+    if (result != NANOARROW_OK) {
+      ArrowErrorSet(&private_data->error, "Failed to copy batch to device");
+    }
+  }
+
+  if (result == NANOARROW_OK &&
+      cudaEventRecord(slot->copied, private_data->stream) != cudaSuccess) {
+    cudaStreamSynchronize(private_data->stream);
+    slot->device_array.array.release(&slot->device_array.array);
+    ArrowErrorSet(&private_data->error, "cudaEventRecord() failed");
+    result = EINVAL;
+  }
+
+  if (result != NANOARROW_OK) {
+    slot->array.release(&slot->array);
+    return result;
+  }
+
+  private_data->n_pending++;
+  return NANOARROW_OK;
+}
+
+static int ArrowDeviceCudaArrayStreamGetSchema(
+    struct ArrowDeviceArrayStream* array_stream, struct ArrowSchema* schema) {
+  struct ArrowDeviceCudaArrayStreamPrivate* private_data =
+      (struct ArrowDeviceCudaArrayStreamPrivate*)array_stream->private_data;
+  return ArrowSchemaDeepCopy(&private_data->schema, schema);
+}
+
+static int ArrowDeviceCudaArrayStreamGetNext(struct ArrowDeviceArrayStream* array_stream,
+                                             struct ArrowDeviceArray* device_array) {
+  struct ArrowDeviceCudaArrayStreamPrivate* private_data =
+      (struct ArrowDeviceCudaArrayStreamPrivate*)array_stream->private_data;
+  ArrowErrorInit(&private_data->error);
+
+  // Keep the copies of the next n_prefetch batches in flight after this one is returned.
+  // The slot reused first is the one returned by the previous call.
+  while (!private_data->finished && private_data->n_pending < private_data->n_slots) {
+    NANOARROW_RETURN_NOT_OK(ArrowDeviceCudaArrayStreamIssue(private_data));
+  }
+
+  if (private_data->n_pending == 0) {
+    memset(device_array, 0, sizeof(struct ArrowDeviceArray));
+    device_array->device_type = private_data->device->device_type;
+    device_array->device_id = private_data->device->device_id;
+    return NANOARROW_OK;
+  }
+
+  struct ArrowDeviceCudaArrayStreamSlot* slot = private_data->slots + private_data->head;
+  ArrowDeviceArrayMove(&slot->device_array, device_array);
+  private_data->head = (private_data->head + 1) % private_data->n_slots;
+  private_data->n_pending--;
+  return NANOARROW_OK;
+}
+
+static const char* ArrowDeviceCudaArrayStreamGetLastError(
+    struct ArrowDeviceArrayStream* array_stream) {
+  struct ArrowDeviceCudaArrayStreamPrivate* private_data =
+      (struct ArrowDeviceCudaArrayStreamPrivate*)array_stream->private_data;
+  return private_data->error.message;
+}
+
+static void ArrowDeviceCudaArrayStreamPrivateRelease(
+    struct ArrowDeviceCudaArrayStreamPrivate* private_data) {
+  for (int64_t i = 0; i < private_data->n_slots; i++) {
+    struct ArrowDeviceCudaArrayStreamSlot* slot = private_data->slots + i;
+    ArrowDeviceCudaArrayStreamSlotReset(slot);
+    if (slot->device_array.array.release != NULL) {
+      slot->device_array.array.release(&slot->device_array.array);
+    }
+
+    ArrowArrayViewReset(&slot->device_array_view.array_view);
+    if (slot->copied != NULL) {
+      cudaEventDestroy(slot->copied);
+    }
+  }
+
+  if (private_data->stream != NULL) {
+    cudaStreamDestroy(private_data->stream);
+  }
+
+  ArrowFree(private_data->slots);
+  if (private_data->schema.release != NULL) {
+    private_data->schema.release(&private_data->schema);
+  }
+
+  if (private_data->naive_stream.release != NULL) {
+    private_data->naive_stream.release(&private_data->naive_stream);
+  }
+
+  ArrowFree(private_data);
+}
+
+static void ArrowDeviceCudaArrayStreamRelease(
+    struct ArrowDeviceArrayStream* array_stream) {
+  ArrowDeviceCudaArrayStreamPrivateRelease(
+      (struct ArrowDeviceCudaArrayStreamPrivate*)array_stream->private_data);
+  array_stream->release = NULL;
+}
+
+// Creates the CUDA stream and events used by the adapter on its device
+static ArrowErrorCode ArrowDeviceCudaArrayStreamInitPrivate(
+    struct ArrowDeviceCudaArrayStreamPrivate* private_data, struct ArrowError* error) {
+  int result = private_data->naive_stream.get_schema(&private_data->naive_stream,
+                                                     &private_data->schema);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "%s",
+                  private_data->naive_stream.get_last_error(&private_data->naive_stream));
+    return result;
+  }
+
+  for (int64_t i = 0; i < private_data->n_slots; i++) {
+    struct ArrowDeviceCudaArrayStreamSlot* slot = private_data->slots + i;
+    ArrowDeviceArrayViewInit(&slot->device_array_view);
+    slot->device_array_view.device = ArrowDeviceCpu();
+    NANOARROW_RETURN_NOT_OK(ArrowArrayViewInitFromSchema(
+        &slot->device_array_view.array_view, &private_data->schema, error));
+  }
+
+  int prev_device = 0;
+  if (cudaGetDevice(&prev_device) != cudaSuccess ||
+      cudaSetDevice((int)private_data->device->device_id) != cudaSuccess) {
+    ArrowErrorSet(error, "Failed to set CUDA device");
+    return EINVAL;
+  }
+
+  if (cudaStreamCreate(&private_data->stream) != cudaSuccess) {
+    private_data->stream = NULL;
+    cudaSetDevice(prev_device);
+    ArrowErrorSet(error, "cudaStreamCreate() failed");
+    return EINVAL;
+  }
+
+  for (int64_t i = 0; i < private_data->n_slots; i++) {
+    struct ArrowDeviceCudaArrayStreamSlot* slot = private_data->slots + i;
+    if (cudaEventCreate(&slot->copied) != cudaSuccess) {
+      slot->copied = NULL;
+      cudaSetDevice(prev_device);
+      ArrowErrorSet(error, "cudaEventCreate() failed");
+      return EINVAL;
+    }
+  }
+
+  cudaSetDevice(prev_device);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowDeviceCudaArrayStreamInit(
+    struct ArrowDeviceArrayStream* device_array_stream,
+    struct ArrowArrayStream* array_stream, struct ArrowDevice* device,
+    int64_t n_prefetch, struct ArrowError* error) {
+  if (device->release != &ArrowDeviceCudaRelease) {
+    ArrowErrorSet(error, "device must be a device returned by ArrowDeviceCuda()");
+    return EINVAL;
+  }
+
+  if (n_prefetch < 0) {
+    ArrowErrorSet(error, "n_prefetch must be >= 0");
+    return EINVAL;
+  }
+
+  struct ArrowDeviceCudaArrayStreamPrivate* private_data =
+      (struct ArrowDeviceCudaArrayStreamPrivate*)ArrowMalloc(
+          sizeof(struct ArrowDeviceCudaArrayStreamPrivate));
+  if (private_data == NULL) {
+    ArrowErrorSet(error, "Failed to allocate CUDA array stream");
+    return ENOMEM;
+  }
+
+  memset(private_data, 0, sizeof(struct ArrowDeviceCudaArrayStreamPrivate));
+  private_data->device = device;
+  private_data->n_slots = n_prefetch + 1;
+  private_data->slots = (struct ArrowDeviceCudaArrayStreamSlot*)ArrowMalloc(
+      private_data->n_slots * sizeof(struct ArrowDeviceCudaArrayStreamSlot));
+  if (private_data->slots == NULL) {
+    ArrowFree(private_data);
+    ArrowErrorSet(error, "Failed to allocate CUDA array stream");
+    return ENOMEM;
+  }
+
+  memset(private_data->slots, 0,
+         private_data->n_slots * sizeof(struct ArrowDeviceCudaArrayStreamSlot));
+  ArrowArrayStreamMove(array_stream, &private_data->naive_stream);
+
+  int result = ArrowDeviceCudaArrayStreamInitPrivate(private_data, error);
+  if (result != NANOARROW_OK) {
+    // Ownership of array_stream is only transferred on success
+    ArrowArrayStreamMove(&private_data->naive_stream, array_stream);
+    ArrowDeviceCudaArrayStreamPrivateRelease(private_data);
+    return result;
+  }
+
+  device_array_stream->device_type = device->device_type;
+  device_array_stream->get_schema = &ArrowDeviceCudaArrayStreamGetSchema;
+  device_array_stream->get_next = &ArrowDeviceCudaArrayStreamGetNext;
+  device_array_stream->get_last_error = &ArrowDeviceCudaArrayStreamGetLastError;
+  device_array_stream->release = &ArrowDeviceCudaArrayStreamRelease;
+  device_array_stream->private_data = private_data;
+  return NANOARROW_OK;
+}
@@ -18,11 +18,39 @@
 #ifndef NANOARROW_DEVICE_CUDA_H_INCLUDED
 #define NANOARROW_DEVICE_CUDA_H_INCLUDED
 
+#include <cuda_runtime_api.h>
+
 #include "nanoarrow_device.h"
 
 #ifdef NANOARROW_NAMESPACE
 
 #define ArrowDeviceCuda NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCuda)
+#define ArrowDeviceCudaArrayInitAsync \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCudaArrayInitAsync)
+#define ArrowDeviceCudaBufferInitAsync \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCudaBufferInitAsync)
+#define ArrowDeviceCudaBufferCopyAsync \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCudaBufferCopyAsync)
+#define ArrowDeviceCudaArrayViewCopyAsync \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCudaArrayViewCopyAsync)
+#define ArrowDeviceCudaBufferCopyManyToCpu \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCudaBufferCopyManyToCpu)
+#define ArrowDeviceCudaAllocateBuffer \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCudaAllocateBuffer)
+#define ArrowDeviceCudaArrayStreamInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCudaArrayStreamInit)
+#define ArrowDeviceCudaAllocator \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCudaAllocator)
+#define ArrowDeviceCudaPoolSetMaxBytesRetained \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCudaPoolSetMaxBytesRetained)
+#define ArrowDeviceCudaPoolStats \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCudaPoolStats)
+#define ArrowDeviceCudaPoolTrim \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCudaPoolTrim)
+#define ArrowDeviceCudaEnablePeerAccess \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCudaEnablePeerAccess)
+#define ArrowDeviceCudaArrayViewValidate \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCudaArrayViewValidate)
 
 #endif
 
@@ -40,9 +68,166 @@ extern "C" {
 /// \brief Get a CUDA device from type and ID
 ///
 /// device_type must be one of ARROW_DEVICE_CUDA or ARROW_DEVICE_CUDA_HOST;
-/// device_id must be between 0 and cudaGetDeviceCount - 1.
+/// device_id must be between 0 and cudaGetDeviceCount - 1. The same device is
+/// returned for every call with the same arguments. Copies between two distinct
+/// ARROW_DEVICE_CUDA devices are issued with cudaMemcpyPeer() (or
+/// cudaMemcpyPeerAsync()) after enabling peer access between them (see
+/// ArrowDeviceCudaEnablePeerAccess()) such that they don't pass through host memory
+/// when the devices can access each other directly.
 struct ArrowDevice* ArrowDeviceCuda(ArrowDeviceType device_type, int64_t device_id);
 
+/// \brief Enable direct access by a CUDA device to the memory of another
+///
+/// Peer access is enabled with cudaDeviceEnablePeerAccess() the first time it is
+/// requested for a pair of devices (which copies between them do implicitly) and the
+/// result is remembered for the lifetime of the process. Returns NANOARROW_OK if
+/// device can access the memory of peer (including when device and peer are the same
+/// device), ENOTSUP if the devices can't access each other directly, or EINVAL if
+/// either is not an ARROW_DEVICE_CUDA device returned by ArrowDeviceCuda().
+ArrowErrorCode ArrowDeviceCudaEnablePeerAccess(struct ArrowDevice* device,
+                                               struct ArrowDevice* peer);
+
+/// \brief Allocate an uninitialized buffer on a CUDA device
+///
+/// Allocates size_bytes of device memory (or pinned host memory for
+/// ARROW_DEVICE_CUDA_HOST) whose release callback returns it to device's allocation
+/// pool or frees it. Returns EINVAL if device was not returned by ArrowDeviceCuda().
+ArrowErrorCode ArrowDeviceCudaAllocateBuffer(struct ArrowDevice* device,
+                                             struct ArrowBuffer* buffer,
+                                             int64_t size_bytes);
+
+/// \brief Get an allocator for CPU-writable memory that a CUDA device can read
+///
+/// For ARROW_DEVICE_CUDA_HOST, buffers are pinned host memory allocated with
+/// cudaMallocHost(); for ARROW_DEVICE_CUDA, buffers are managed memory allocated
+/// with cudaMallocManaged(). Buffers are not retained by the pool of device and
+/// growing a buffer is always a new allocation and a copy. An array whose buffers were
+/// all allocated in this way can be moved from the CPU to device with
+/// ArrowDeviceArrayMoveToDevice() without a copy. Returns EINVAL if device was not
+/// returned by ArrowDeviceCuda().
+ArrowErrorCode ArrowDeviceCudaAllocator(struct ArrowDevice* device,
+                                        struct ArrowBufferAllocator* out);
+
+/// \brief Retain freed allocations of a CUDA device for reuse
+///
+/// By default, every buffer allocated by a device returned by ArrowDeviceCuda() is
+/// a new cudaMalloc() (or cudaMallocHost() for ARROW_DEVICE_CUDA_HOST) that is
+/// freed with the buffer. When max_bytes_retained is greater than zero, allocations
+/// are rounded up to a power-of-two size class and, when a buffer is freed, its
+/// block is retained for reuse by the next allocation of the same size class (e.g.,
+/// by the next batch of a stream whose batches have a similar shape). At most
+/// max_bytes_retained bytes are held in blocks that are not in use; lowering this
+/// value frees them. The pool is thread safe if ArrowBufferPoolIsThreadSafe()
+/// returns non-zero. Returns EINVAL if device was not returned by ArrowDeviceCuda().
+ArrowErrorCode ArrowDeviceCudaPoolSetMaxBytesRetained(struct ArrowDevice* device,
+                                                      int64_t max_bytes_retained);
+
+/// \brief Get usage statistics for the allocation pool of a CUDA device
+ArrowErrorCode ArrowDeviceCudaPoolStats(struct ArrowDevice* device,
+                                        struct ArrowBufferPoolStats* out);
+
+/// \brief Free all blocks and events retained by the pool of a CUDA device
+ArrowErrorCode ArrowDeviceCudaPoolTrim(struct ArrowDevice* device);
+
+/// \brief Initialize an ArrowDeviceArray whose sync_event is recorded on a stream
+///
+/// Like ArrowDeviceArrayInit() for a CUDA device except that the sync_event of
+/// device_array is recorded on stream, such that it completes once the work
+/// currently queued on stream (e.g., the kernels that produce array's buffers) is
+/// complete. Like every sync_event of an array initialized by a CUDA device, the event
+/// is created with cudaEventDisableTiming and is returned to device's pool of events
+/// for a later array when device_array is released. If this fails, array is not
+/// modified. Returns EINVAL if device was not returned by ArrowDeviceCuda().
+ArrowErrorCode ArrowDeviceCudaArrayInitAsync(struct ArrowDevice* device,
+                                             struct ArrowDeviceArray* device_array,
+                                             struct ArrowArray* array,
+                                             cudaStream_t stream);
+
+/// \brief Initialize an owning buffer from existing content on a CUDA stream
+///
+/// Like ArrowDeviceBufferInit() for a copy to or from a CUDA device, except that the
+/// copy is issued with cudaMemcpyAsync() on stream. dst is allocated before this
+/// returns but its content is only valid once the work queued on stream is complete;
+/// src must remain valid until then. Copies only overlap with other work when host
+/// memory is pinned (i.e., ARROW_DEVICE_CUDA_HOST). Returns ENOTSUP if neither
+/// device_src nor device_dst is a CUDA device.
+ArrowErrorCode ArrowDeviceCudaBufferInitAsync(struct ArrowDevice* device_src,
+                                              struct ArrowBufferView src,
+                                              struct ArrowDevice* device_dst,
+                                              struct ArrowBuffer* dst,
+                                              cudaStream_t stream);
+
+/// \brief Copy a section of memory into a preallocated buffer on a CUDA stream
+///
+/// Like ArrowDeviceBufferCopy() except that the copy is issued with
+/// cudaMemcpyAsync() on stream and is complete once the work queued on stream is
+/// complete.
+ArrowErrorCode ArrowDeviceCudaBufferCopyAsync(struct ArrowDevice* device_src,
+                                              struct ArrowBufferView src,
+                                              struct ArrowDevice* device_dst,
+                                              struct ArrowBufferView dst,
+                                              cudaStream_t stream);
+
+/// \brief Copy many small sections of CUDA memory to the CPU with one round trip
+///
+/// Each src[i] is copied into the CPU memory of dst[i] (whose size_bytes is the number
+/// of bytes copied). The sections are first gathered on the device such that only one
+/// blocking copy to the CPU is required, which is how
+/// ArrowDeviceArrayViewSetArray() resolves the sizes of all string and binary buffers
+/// of an array at once. Returns ENOTSUP if device_src is not an ARROW_DEVICE_CUDA
+/// device.
+ArrowErrorCode ArrowDeviceCudaBufferCopyManyToCpu(struct ArrowDevice* device_src,
+                                                  const struct ArrowBufferView* src,
+                                                  struct ArrowBufferView* dst,
+                                                  int64_t n);
+
+/// \brief Copy an ArrowDeviceArrayView to a device on a CUDA stream
+///
+/// Like ArrowDeviceArrayViewCopy() except that the copy of every buffer is issued on
+/// stream without waiting for the previous one to complete. If device_dst is a CUDA
+/// device, one event is recorded on stream after the last copy as the sync_event of
+/// dst and this function returns without blocking; otherwise, stream is synchronized
+/// before returning because CPU arrays have no sync_event. src must remain valid until
+/// dst's sync_event has completed.
+ArrowErrorCode ArrowDeviceCudaArrayViewCopyAsync(struct ArrowDeviceArrayView* src,
+                                                 struct ArrowDevice* device_dst,
+                                                 cudaStream_t stream,
+                                                 struct ArrowDeviceArray* dst);
+
+/// \brief Validate an ArrowDeviceArrayView of a CUDA device array on the device
+///
+/// Checks the buffers of device_array_view and its children in device memory with
+/// kernels that each reduce a buffer to a single value, such that only these are
+/// copied back to the host (in one copy after all of the kernels are queued) rather
+/// than the buffers themselves. Checks that offsets of string, binary, and list
+/// types are non-decreasing and refer to data that exists, and that union type ids
+/// (and dense union offsets) refer to children (and child elements) that exist. The
+/// number of nulls in each validity buffer is counted: a null_count of -1 is replaced
+/// with this count and any other null_count must match it. device_array_view must have
+/// been set with ArrowDeviceArrayViewSetArray() from an array whose sync_event is
+/// complete. Returns EINVAL if device_array_view is not valid or does not refer to an
+/// ARROW_DEVICE_CUDA device returned by ArrowDeviceCuda().
+ArrowErrorCode ArrowDeviceCudaArrayViewValidate(
+    struct ArrowDeviceArrayView* device_array_view, struct ArrowError* error);
+
+/// \brief Initialize an ArrowDeviceArrayStream that copies batches to a CUDA device
+///
+/// Wraps an ArrowArrayStream of CPU arrays as an ArrowDeviceArrayStream whose arrays
+/// have been copied to device (an ARROW_DEVICE_CUDA or ARROW_DEVICE_CUDA_HOST device
+/// returned by ArrowDeviceCuda()). The copies are issued with
+/// ArrowDeviceCudaArrayViewCopyAsync() on a CUDA stream owned by the adapter: each
+/// call to get_next returns a batch whose copy may still be in progress (the consumer
+/// must wait on its sync_event) after issuing the copies of up to n_prefetch
+/// subsequent batches, such that these overlap with the consumer's work on the
+/// current one. Source batches are kept until their copy is complete. This function
+/// moves the ownership of array_stream to the device_array_stream if it returns
+/// NANOARROW_OK, after which the caller is responsible for releasing the
+/// ArrowDeviceArrayStream.
+ArrowErrorCode ArrowDeviceCudaArrayStreamInit(
+    struct ArrowDeviceArrayStream* device_array_stream,
+    struct ArrowArrayStream* array_stream, struct ArrowDevice* device,
+    int64_t n_prefetch, struct ArrowError* error);
+
 /// @}
 
 #ifdef __cplusplus
@@ -0,0 +1,217 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cuda_runtime.h>
+
+#include "nanoarrow_device_cuda_kernels.h"
+
+// Kernels use grid-stride loops such that the number of blocks can be capped
+// regardless of the number of elements
+#define NANOARROW_CUDA_BLOCK_SIZE 256
+#define NANOARROW_CUDA_MAX_BLOCKS 1024
+
+static unsigned int ArrowDeviceCudaNumBlocks(int64_t n) {
+  int64_t n_blocks = (n + NANOARROW_CUDA_BLOCK_SIZE - 1) / NANOARROW_CUDA_BLOCK_SIZE;
+  if (n_blocks > NANOARROW_CUDA_MAX_BLOCKS) {
+    return NANOARROW_CUDA_MAX_BLOCKS;
+  } else if (n_blocks < 1) {
+    return 1;
+  } else {
+    return (unsigned int)n_blocks;
+  }
+}
+
+// Sums value over the threads of a warp such that only one atomic operation per warp
+// is needed
+__device__ static unsigned long long ArrowDeviceCudaWarpSum(unsigned long long value) {
+  for (int delta = warpSize / 2; delta > 0; delta /= 2) {
+    value += __shfl_down_sync(0xffffffff, value, delta);
+  }
+
+  return value;
+}
+
+__device__ static unsigned long long ArrowDeviceCudaWarpMax(unsigned long long value) {
+  for (int delta = warpSize / 2; delta > 0; delta /= 2) {
+    unsigned long long other = __shfl_down_sync(0xffffffff, value, delta);
+    value = other > value ? other : value;
+  }
+
+  return value;
+}
+
+// Records that element i of n is invalid, keeping the smallest such i (i.e., the
+// largest n - i)
+__device__ static void ArrowDeviceCudaReportInvalid(int64_t n, int64_t first_invalid,
+                                                    unsigned long long* out) {
+  unsigned long long value =
+      first_invalid < n ? (unsigned long long)(n - first_invalid) : 0;
+  value = ArrowDeviceCudaWarpMax(value);
+  if ((threadIdx.x % warpSize) == 0 && value != 0) {
+    atomicMax(out, value);
+  }
+}
+
+__global__ static void ArrowDeviceCudaCountBitsKernel(const uint8_t* bits,
+                                                      int64_t offset, int64_t length,
+                                                      unsigned long long* out) {
+  int64_t end = offset + length;
+  int64_t first_byte = offset / 8;
+  int64_t n_bytes = (end + 7) / 8 - first_byte;
+
+  // Every thread of the warp must take part in the reduction, so threads without
+  // bytes left contribute zero rather than exiting the loop early
+  unsigned long long count = 0;
+  int64_t stride = (int64_t)blockDim.x * gridDim.x;
+  int64_t first = (int64_t)blockIdx.x * blockDim.x + threadIdx.x;
+  int64_t n_iterations = (n_bytes + stride - 1) / stride;
+  for (int64_t iteration = 0; iteration < n_iterations; iteration++) {
+    int64_t i = first + iteration * stride;
+    if (i >= n_bytes) {
+      continue;
+    }
+
+    unsigned int byte = bits[first_byte + i];
+    int64_t byte_start = (first_byte + i) * 8;
+    if (byte_start < offset) {
+      byte &= 0xffu << (offset - byte_start);
+    }
+    if (byte_start + 8 > end) {
+      byte &= 0xffu >> (byte_start + 8 - end);
+    }
+
+    count += __popc(byte);
+  }
+
+  count = ArrowDeviceCudaWarpSum(count);
+  if ((threadIdx.x % warpSize) == 0 && count != 0) {
+    atomicAdd(out, count);
+  }
+}
+
+template <typename T>
+__global__ static void ArrowDeviceCudaCheckOffsetsKernel(const T* offsets, int64_t n,
+                                                         int64_t max_value,
+                                                         unsigned long long* out) {
+  int64_t stride = (int64_t)blockDim.x * gridDim.x;
+  int64_t first = (int64_t)blockIdx.x * blockDim.x + threadIdx.x;
+  int64_t n_iterations = (n + stride - 1) / stride;
+
+  // Like the count, the first invalid element seen by each thread is reduced over the
+  // warp once after the loop and the loop runs the same number of times on every thread
+  int64_t first_invalid = n;
+  for (int64_t iteration = 0; iteration < n_iterations; iteration++) {
+    int64_t i = first + iteration * stride;
+    if (i >= n || first_invalid < n) {
+      continue;
+    }
+
+    int64_t value = offsets[i];
+    int invalid = (i == 0 && value < 0) || (i > 0 && value < (int64_t)offsets[i - 1]) ||
+                  (i == n - 1 && value > max_value);
+    if (invalid) {
+      first_invalid = i;
+    }
+  }
+
+  ArrowDeviceCudaReportInvalid(n, first_invalid, out);
+}
+
+__global__ static void ArrowDeviceCudaCheckUnionKernel(
+    const int8_t* type_ids, const int32_t* offsets, int64_t n,
+    struct ArrowDeviceCudaUnionChildren children, unsigned long long* out) {
+  int64_t stride = (int64_t)blockDim.x * gridDim.x;
+  int64_t first = (int64_t)blockIdx.x * blockDim.x + threadIdx.x;
+  int64_t n_iterations = (n + stride - 1) / stride;
+
+  int64_t first_invalid = n;
+  for (int64_t iteration = 0; iteration < n_iterations; iteration++) {
+    int64_t i = first + iteration * stride;
+    if (i >= n || first_invalid < n) {
+      continue;
+    }
+
+    int8_t type_id = type_ids[i];
+    int child_index = type_id < 0 ? -1 : children.type_id_to_child_index[type_id];
+    int invalid = child_index < 0;
+    if (!invalid && offsets != NULL) {
+      invalid = offsets[i] < 0 || offsets[i] >= children.child_length[child_index];
+    }
+
+    if (invalid) {
+      first_invalid = i;
+    }
+  }
+
+  ArrowDeviceCudaReportInvalid(n, first_invalid, out);
+}
+
+cudaError_t ArrowDeviceCudaLaunchCountBits(const uint8_t* bits, int64_t offset,
+                                           int64_t length, unsigned long long* out,
+                                           cudaStream_t stream) {
+  if (length <= 0) {
+    return cudaSuccess;
+  }
+
+  ArrowDeviceCudaCountBitsKernel<<<ArrowDeviceCudaNumBlocks((length + 7) / 8 + 1),
+                                   NANOARROW_CUDA_BLOCK_SIZE, 0, stream>>>(
+      bits, offset, length, out);
+  return cudaGetLastError();
+}
+
+cudaError_t ArrowDeviceCudaLaunchCheckOffsetsInt32(const int32_t* offsets, int64_t n,
+                                                   int64_t max_value,
+                                                   unsigned long long* out,
+                                                   cudaStream_t stream) {
+  if (n <= 0) {
+    return cudaSuccess;
+  }
+
+  ArrowDeviceCudaCheckOffsetsKernel<int32_t>
+      <<<ArrowDeviceCudaNumBlocks(n), NANOARROW_CUDA_BLOCK_SIZE, 0, stream>>>(
+          offsets, n, max_value, out);
+  return cudaGetLastError();
+}
+
+cudaError_t ArrowDeviceCudaLaunchCheckOffsetsInt64(const int64_t* offsets, int64_t n,
+                                                   int64_t max_value,
+                                                   unsigned long long* out,
+                                                   cudaStream_t stream) {
+  if (n <= 0) {
+    return cudaSuccess;
+  }
+
+  ArrowDeviceCudaCheckOffsetsKernel<int64_t>
+      <<<ArrowDeviceCudaNumBlocks(n), NANOARROW_CUDA_BLOCK_SIZE, 0, stream>>>(
+          offsets, n, max_value, out);
+  return cudaGetLastError();
+}
+
+cudaError_t ArrowDeviceCudaLaunchCheckUnion(const int8_t* type_ids,
+                                            const int32_t* offsets, int64_t n,
+                                            struct ArrowDeviceCudaUnionChildren children,
+                                            unsigned long long* out,
+                                            cudaStream_t stream) {
+  if (n <= 0) {
+    return cudaSuccess;
+  }
+
+  ArrowDeviceCudaCheckUnionKernel<<<ArrowDeviceCudaNumBlocks(n),
+                                    NANOARROW_CUDA_BLOCK_SIZE, 0, stream>>>(
+      type_ids, offsets, n, children, out);
+  return cudaGetLastError();
+}
@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef NANOARROW_DEVICE_CUDA_KERNELS_H_INCLUDED
+#define NANOARROW_DEVICE_CUDA_KERNELS_H_INCLUDED
+
+#include <stdint.h>
+
+#include <cuda_runtime_api.h>
+
+#include "nanoarrow_device.h"
+
+// Launchers for the kernels in nanoarrow_device_cuda_kernels.cu, which are only used
+// internally by nanoarrow_device_cuda.c. Each kernel reduces its input to a single
+// unsigned 64-bit result in device memory that must be zeroed before the launch, such
+// that the results of many launches can be zeroed and copied back to the host
+// together. Checks store n - i for the first invalid element i (i.e., a result of zero
+// means that all elements are valid).
+
+#ifdef NANOARROW_NAMESPACE
+
+#define ArrowDeviceCudaLaunchCountBits \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCudaLaunchCountBits)
+#define ArrowDeviceCudaLaunchCheckOffsetsInt32 \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCudaLaunchCheckOffsetsInt32)
+#define ArrowDeviceCudaLaunchCheckOffsetsInt64 \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCudaLaunchCheckOffsetsInt64)
+#define ArrowDeviceCudaLaunchCheckUnion \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceCudaLaunchCheckUnion)
+
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Describes the children of a union to the union check, which is passed by value
+// such that the kernel doesn't need a separate copy of it to the device
+struct ArrowDeviceCudaUnionChildren {
+  // Child index of each type id (or -1 if the type id is not valid)
+  int8_t type_id_to_child_index[128];
+  // Length of each child
+  int64_t child_length[128];
+};
+
+// Adds the number of set bits between bit offset and offset + length of bits to *out
+cudaError_t ArrowDeviceCudaLaunchCountBits(const uint8_t* bits, int64_t offset,
+                                           int64_t length, unsigned long long* out,
+                                           cudaStream_t stream);
+
+// Checks that n offsets are non-decreasing, that the first is >= 0, and that the last
+// is <= max_value
+cudaError_t ArrowDeviceCudaLaunchCheckOffsetsInt32(const int32_t* offsets, int64_t n,
+                                                   int64_t max_value,
+                                                   unsigned long long* out,
+                                                   cudaStream_t stream);
+cudaError_t ArrowDeviceCudaLaunchCheckOffsetsInt64(const int64_t* offsets, int64_t n,
+                                                   int64_t max_value,
+                                                   unsigned long long* out,
+                                                   cudaStream_t stream);
+
+// Checks that n type ids refer to a child and, if offsets is not NULL (i.e., for a
+// dense union), that each offset refers to an element of that child
+cudaError_t ArrowDeviceCudaLaunchCheckUnion(const int8_t* type_ids,
+                                            const int32_t* offsets, int64_t n,
+                                            struct ArrowDeviceCudaUnionChildren children,
+                                            unsigned long long* out,
+                                            cudaStream_t stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -17,6 +17,8 @@
 
 #include <errno.h>
 
+#include <vector>
+
 #include <cuda_runtime_api.h>
 #include <gtest/gtest.h>
 
@@ -31,6 +33,10 @@ TEST(NanoarrowDeviceCuda, GetDevice) {
   ASSERT_NE(cuda_host, nullptr);
   EXPECT_EQ(cuda_host->device_type, ARROW_DEVICE_CUDA_HOST);
 
+  // Devices are singletons
+  EXPECT_EQ(ArrowDeviceCuda(ARROW_DEVICE_CUDA, 0), cuda);
+  EXPECT_EQ(ArrowDeviceCuda(ARROW_DEVICE_CUDA_HOST, 0), cuda_host);
+
   // null return for invalid input
   EXPECT_EQ(ArrowDeviceCuda(ARROW_DEVICE_CUDA, std::numeric_limits<int32_t>::max()),
             nullptr);
@@ -142,6 +148,499 @@ TEST(NanoarrowDeviceCuda, DeviceCudaBufferCopy) {
   }
 }
 
+TEST(NanoarrowDeviceCuda, DeviceCudaPeerCopy) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowDevice* gpu = ArrowDeviceCuda(ARROW_DEVICE_CUDA, 0);
+  struct ArrowDevice* gpu_host = ArrowDeviceCuda(ARROW_DEVICE_CUDA_HOST, 0);
+  ASSERT_EQ(ArrowDeviceCudaEnablePeerAccess(gpu, gpu), NANOARROW_OK);
+  EXPECT_EQ(ArrowDeviceCudaEnablePeerAccess(cpu, gpu), EINVAL);
+  EXPECT_EQ(ArrowDeviceCudaEnablePeerAccess(gpu, gpu_host), EINVAL);
+
+  int n_devices = 0;
+  ASSERT_EQ(cudaGetDeviceCount(&n_devices), cudaSuccess);
+  if (n_devices < 2) {
+    GTEST_SKIP() << "Peer copies require at least two CUDA devices";
+  }
+
+  struct ArrowDevice* peer = ArrowDeviceCuda(ARROW_DEVICE_CUDA, 1);
+  int result = ArrowDeviceCudaEnablePeerAccess(gpu, peer);
+  EXPECT_TRUE(result == NANOARROW_OK || result == ENOTSUP);
+  EXPECT_EQ(ArrowDeviceCudaEnablePeerAccess(gpu, peer), result);
+
+  // Copies between devices succeed whether or not peer access is available
+  uint8_t data[] = {0x01, 0x02, 0x03, 0x04, 0x05};
+  struct ArrowBufferView cpu_view = {data, sizeof(data)};
+  struct ArrowBuffer on_gpu;
+  struct ArrowBuffer on_peer;
+  struct ArrowBuffer on_gpu_again;
+  ASSERT_EQ(ArrowDeviceBufferInit(cpu, cpu_view, gpu, &on_gpu), NANOARROW_OK);
+  struct ArrowBufferView gpu_view = {on_gpu.data, on_gpu.size_bytes};
+  ASSERT_EQ(ArrowDeviceBufferInit(gpu, gpu_view, peer, &on_peer), NANOARROW_OK);
+
+  cudaStream_t stream;
+  ASSERT_EQ(cudaStreamCreate(&stream), cudaSuccess);
+  struct ArrowBufferView peer_view = {on_peer.data, on_peer.size_bytes};
+  ASSERT_EQ(ArrowDeviceCudaBufferInitAsync(peer, peer_view, gpu, &on_gpu_again, stream),
+            NANOARROW_OK);
+  ASSERT_EQ(cudaStreamSynchronize(stream), cudaSuccess);
+  ASSERT_EQ(cudaStreamDestroy(stream), cudaSuccess);
+
+  uint8_t cpu_dest[5];
+  struct ArrowBufferView cpu_dest_view = {cpu_dest, sizeof(data)};
+  struct ArrowBufferView gpu_again_view = {on_gpu_again.data, on_gpu_again.size_bytes};
+  ASSERT_EQ(ArrowDeviceBufferCopy(gpu, gpu_again_view, cpu, cpu_dest_view),
+            NANOARROW_OK);
+  EXPECT_EQ(memcmp(cpu_dest, data, sizeof(data)), 0);
+
+  ArrowBufferReset(&on_gpu);
+  ArrowBufferReset(&on_peer);
+  ArrowBufferReset(&on_gpu_again);
+}
+
+TEST(NanoarrowDeviceCuda, DeviceCudaBufferCopyAsync) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowDevice* gpu = ArrowDeviceCuda(ARROW_DEVICE_CUDA, 0);
+  uint8_t data[] = {0x01, 0x02, 0x03, 0x04, 0x05};
+  struct ArrowBufferView cpu_view = {data, sizeof(data)};
+
+  cudaStream_t stream;
+  ASSERT_EQ(cudaStreamCreate(&stream), cudaSuccess);
+
+  // CPU -> GPU
+  struct ArrowBuffer buffer_gpu;
+  ASSERT_EQ(ArrowDeviceCudaBufferInitAsync(cpu, cpu_view, gpu, &buffer_gpu, stream),
+            NANOARROW_OK);
+  EXPECT_EQ(buffer_gpu.size_bytes, sizeof(data));
+  struct ArrowBufferView gpu_view = {buffer_gpu.data, buffer_gpu.size_bytes};
+
+  // GPU -> CPU
+  uint8_t cpu_dest[5];
+  struct ArrowBufferView cpu_dest_view = {cpu_dest, sizeof(data)};
+  ASSERT_EQ(ArrowDeviceCudaBufferCopyAsync(gpu, gpu_view, cpu, cpu_dest_view, stream),
+            NANOARROW_OK);
+  ASSERT_EQ(cudaStreamSynchronize(stream), cudaSuccess);
+  EXPECT_EQ(memcmp(cpu_dest, data, sizeof(data)), 0);
+
+  // CPU -> CPU is not a CUDA copy
+  struct ArrowBuffer buffer;
+  EXPECT_EQ(ArrowDeviceCudaBufferInitAsync(cpu, cpu_view, cpu, &buffer, stream), ENOTSUP);
+
+  ArrowBufferReset(&buffer_gpu);
+  ASSERT_EQ(cudaStreamDestroy(stream), cudaSuccess);
+}
+
+TEST(NanoarrowDeviceCuda, DeviceCudaBufferCopyManyToCpu) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowDevice* gpu = ArrowDeviceCuda(ARROW_DEVICE_CUDA, 0);
+  int32_t data[] = {1, 2, 3, 4, 5};
+  struct ArrowBufferView cpu_view = {data, sizeof(data)};
+
+  struct ArrowBuffer buffer_gpu;
+  ASSERT_EQ(ArrowDeviceBufferInit(cpu, cpu_view, gpu, &buffer_gpu), NANOARROW_OK);
+
+  // Read the first, last, and middle two values
+  const int32_t* gpu_data = reinterpret_cast<const int32_t*>(buffer_gpu.data);
+  struct ArrowBufferView src[3];
+  src[0] = {gpu_data, sizeof(int32_t)};
+  src[1] = {gpu_data + 4, sizeof(int32_t)};
+  src[2] = {gpu_data + 1, 2 * sizeof(int32_t)};
+
+  int32_t dest[4] = {0, 0, 0, 0};
+  struct ArrowBufferView dst[3];
+  dst[0] = {dest, sizeof(int32_t)};
+  dst[1] = {dest + 1, sizeof(int32_t)};
+  dst[2] = {dest + 2, 2 * sizeof(int32_t)};
+
+  ASSERT_EQ(ArrowDeviceCudaBufferCopyManyToCpu(gpu, src, dst, 3), NANOARROW_OK);
+  EXPECT_EQ(dest[0], 1);
+  EXPECT_EQ(dest[1], 5);
+  EXPECT_EQ(dest[2], 2);
+  EXPECT_EQ(dest[3], 3);
+
+  EXPECT_EQ(ArrowDeviceCudaBufferCopyManyToCpu(cpu, src, dst, 3), ENOTSUP);
+  ArrowBufferReset(&buffer_gpu);
+}
+
+TEST(NanoarrowDeviceCuda, DeviceCudaPool) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  uint8_t data[] = {0x01, 0x02, 0x03, 0x04, 0x05};
+  struct ArrowBufferView cpu_view = {data, sizeof(data)};
+  struct ArrowBufferPoolStats stats;
+
+  EXPECT_EQ(ArrowDeviceCudaPoolSetMaxBytesRetained(cpu, 1024), EINVAL);
+  EXPECT_EQ(ArrowDeviceCudaPoolStats(cpu, &stats), EINVAL);
+  EXPECT_EQ(ArrowDeviceCudaPoolTrim(cpu), EINVAL);
+
+  for (ArrowDeviceType device_type : {ARROW_DEVICE_CUDA, ARROW_DEVICE_CUDA_HOST}) {
+    struct ArrowDevice* gpu = ArrowDeviceCuda(device_type, 0);
+    EXPECT_EQ(ArrowDeviceCudaPoolSetMaxBytesRetained(gpu, -1), EINVAL);
+    ASSERT_EQ(ArrowDeviceCudaPoolSetMaxBytesRetained(gpu, 1024), NANOARROW_OK);
+
+    // The first allocation is a miss whose block is retained when it is freed
+    struct ArrowBuffer buffer_gpu;
+    ASSERT_EQ(ArrowDeviceBufferInit(cpu, cpu_view, gpu, &buffer_gpu), NANOARROW_OK);
+    void* first_ptr = buffer_gpu.data;
+    ArrowBufferReset(&buffer_gpu);
+    ASSERT_EQ(ArrowDeviceCudaPoolStats(gpu, &stats), NANOARROW_OK);
+    EXPECT_EQ(stats.n_hits, 0);
+    EXPECT_EQ(stats.n_misses, 1);
+    EXPECT_EQ(stats.bytes_retained, 256);
+
+    // ...and reused by the next one of the same size class
+    ASSERT_EQ(ArrowDeviceBufferInit(cpu, cpu_view, gpu, &buffer_gpu), NANOARROW_OK);
+    EXPECT_EQ(buffer_gpu.data, first_ptr);
+    EXPECT_EQ(buffer_gpu.size_bytes, sizeof(data));
+    ASSERT_EQ(ArrowDeviceCudaPoolStats(gpu, &stats), NANOARROW_OK);
+    EXPECT_EQ(stats.n_hits, 1);
+    EXPECT_EQ(stats.bytes_retained, 0);
+
+    struct ArrowBuffer buffer;
+    struct ArrowBufferView gpu_view = {buffer_gpu.data, buffer_gpu.size_bytes};
+    ASSERT_EQ(ArrowDeviceBufferInit(gpu, gpu_view, cpu, &buffer), NANOARROW_OK);
+    EXPECT_EQ(memcmp(buffer.data, data, sizeof(data)), 0);
+    ArrowBufferReset(&buffer);
+    ArrowBufferReset(&buffer_gpu);
+
+    // Blocks that would exceed max_bytes_retained are freed
+    std::vector<uint8_t> large_data(2048);
+    struct ArrowBufferView large_view = {large_data.data(),
+                                         static_cast<int64_t>(large_data.size())};
+    ASSERT_EQ(ArrowDeviceBufferInit(cpu, large_view, gpu, &buffer_gpu), NANOARROW_OK);
+    ArrowBufferReset(&buffer_gpu);
+    ASSERT_EQ(ArrowDeviceCudaPoolStats(gpu, &stats), NANOARROW_OK);
+    EXPECT_EQ(stats.bytes_retained, 256);
+
+    ASSERT_EQ(ArrowDeviceCudaPoolTrim(gpu), NANOARROW_OK);
+    ASSERT_EQ(ArrowDeviceCudaPoolStats(gpu, &stats), NANOARROW_OK);
+    EXPECT_EQ(stats.bytes_retained, 0);
+    ASSERT_EQ(ArrowDeviceCudaPoolSetMaxBytesRetained(gpu, 0), NANOARROW_OK);
+  }
+}
+
+TEST(NanoarrowDeviceCuda, DeviceCudaArrayViewCopyAsync) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowDevice* gpu = ArrowDeviceCuda(ARROW_DEVICE_CUDA, 0);
+  struct ArrowArray array;
+  struct ArrowDeviceArray device_array;
+  struct ArrowDeviceArrayView device_array_view;
+
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("abc")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("defg")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowDeviceArrayInit(cpu, &device_array, &array), NANOARROW_OK);
+
+  ArrowDeviceArrayViewInit(&device_array_view);
+  ArrowArrayViewInitFromType(&device_array_view.array_view, NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view, &device_array, nullptr),
+            NANOARROW_OK);
+
+  cudaStream_t stream;
+  ASSERT_EQ(cudaStreamCreate(&stream), cudaSuccess);
+
+  // CPU -> GPU returns an array whose sync_event completes after every copy
+  struct ArrowDeviceArray device_array2;
+  ASSERT_EQ(
+      ArrowDeviceCudaArrayViewCopyAsync(&device_array_view, gpu, stream, &device_array2),
+      NANOARROW_OK);
+  ASSERT_NE(device_array2.sync_event, nullptr);
+  ASSERT_EQ(gpu->synchronize_event(gpu, device_array2.sync_event, nullptr),
+            NANOARROW_OK);
+  device_array.array.release(&device_array.array);
+
+  // GPU -> CPU is complete when it returns
+  ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view, &device_array2, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowDeviceCudaArrayViewCopyAsync(&device_array_view, cpu, stream, &device_array),
+      NANOARROW_OK);
+  device_array2.array.release(&device_array2.array);
+  EXPECT_EQ(device_array.device_type, ARROW_DEVICE_CPU);
+  EXPECT_EQ(device_array.sync_event, nullptr);
+
+  ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view, &device_array, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(device_array_view.array_view.length, 3);
+  EXPECT_EQ(device_array_view.array_view.buffer_views[2].size_bytes, 7);
+  EXPECT_EQ(memcmp(device_array_view.array_view.buffer_views[2].data.data, "abcdefg", 7),
+            0);
+
+  device_array.array.release(&device_array.array);
+  ArrowDeviceArrayViewReset(&device_array_view);
+  ASSERT_EQ(cudaStreamDestroy(stream), cudaSuccess);
+}
+
+TEST(NanoarrowDeviceCuda, DeviceCudaArrayInitAsync) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowDevice* gpu = ArrowDeviceCuda(ARROW_DEVICE_CUDA, 0);
+  struct ArrowArray array;
+  struct ArrowDeviceArray device_array;
+
+  cudaStream_t stream;
+  ASSERT_EQ(cudaStreamCreate(&stream), cudaSuccess);
+
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowDeviceCudaArrayInitAsync(gpu, &device_array, &array, stream),
+            NANOARROW_OK);
+  EXPECT_EQ(array.release, nullptr);
+  EXPECT_EQ(device_array.device_type, ARROW_DEVICE_CUDA);
+  ASSERT_NE(device_array.sync_event, nullptr);
+  cudaEvent_t event = *((cudaEvent_t*)device_array.sync_event);
+  ASSERT_EQ(gpu->synchronize_event(gpu, device_array.sync_event, nullptr),
+            NANOARROW_OK);
+  device_array.array.release(&device_array.array);
+
+  // The event of a released array is reused by the next array of the device
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowDeviceArrayInit(gpu, &device_array, &array), NANOARROW_OK);
+  EXPECT_EQ(*((cudaEvent_t*)device_array.sync_event), event);
+  device_array.array.release(&device_array.array);
+
+  ASSERT_EQ(ArrowDeviceCudaPoolTrim(gpu), NANOARROW_OK);
+
+  // Not a CUDA device
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  EXPECT_EQ(ArrowDeviceCudaArrayInitAsync(cpu, &device_array, &array, stream), EINVAL);
+  array.release(&array);
+
+  ASSERT_EQ(cudaStreamDestroy(stream), cudaSuccess);
+}
+
+TEST(NanoarrowDeviceCuda, DeviceCudaArrayViewValidate) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowDevice* gpu = ArrowDeviceCuda(ARROW_DEVICE_CUDA, 0);
+  struct ArrowArray array;
+  struct ArrowDeviceArray device_array;
+  struct ArrowDeviceArrayView device_array_view;
+  struct ArrowError error;
+
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("abc")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("defg")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowDeviceArrayInit(cpu, &device_array, &array), NANOARROW_OK);
+
+  ArrowDeviceArrayViewInit(&device_array_view);
+  ArrowArrayViewInitFromType(&device_array_view.array_view, NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view, &device_array, nullptr),
+            NANOARROW_OK);
+
+  // Only views of CUDA arrays can be validated on the device
+  EXPECT_EQ(ArrowDeviceCudaArrayViewValidate(&device_array_view, &error), EINVAL);
+
+  struct ArrowDeviceArray device_array2;
+  ASSERT_EQ(ArrowDeviceArrayViewCopy(&device_array_view, gpu, &device_array2),
+            NANOARROW_OK);
+  device_array.array.release(&device_array.array);
+  ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view, &device_array2, nullptr),
+            NANOARROW_OK);
+
+  // An unknown null_count is counted on the device
+  device_array_view.array_view.null_count = -1;
+  ASSERT_EQ(ArrowDeviceCudaArrayViewValidate(&device_array_view, &error), NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(device_array_view.array_view.null_count, 1);
+
+  device_array_view.array_view.null_count = 2;
+  EXPECT_EQ(ArrowDeviceCudaArrayViewValidate(&device_array_view, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected null_count of 2 but found 1 nulls in validity");
+  device_array_view.array_view.null_count = 1;
+
+  // Decreasing offsets in device memory are found without copying them to the CPU
+  int32_t offsets[] = {0, 3, 2, 7};
+  void* offsets_data = const_cast<void*>(device_array2.array.buffers[1]);
+  ASSERT_EQ(cudaMemcpy(offsets_data, offsets, sizeof(offsets), cudaMemcpyHostToDevice),
+            cudaSuccess);
+  EXPECT_EQ(ArrowDeviceCudaArrayViewValidate(&device_array_view, &error), EINVAL);
+  EXPECT_STREQ(error.message,
+               "[2] Expected offsets to be non-decreasing and between 0 and 7");
+
+  device_array2.array.release(&device_array2.array);
+  ArrowDeviceArrayViewReset(&device_array_view);
+}
+
+TEST(NanoarrowDeviceCuda, DeviceCudaArrayViewCopyCoalesced) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowArray array;
+  struct ArrowDeviceArray device_array;
+  struct ArrowDeviceArrayView device_array_view;
+
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("abc")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("defg")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowDeviceArrayInit(cpu, &device_array, &array), NANOARROW_OK);
+
+  ArrowDeviceArrayViewInit(&device_array_view);
+  ArrowArrayViewInitFromType(&device_array_view.array_view, NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view, &device_array, nullptr),
+            NANOARROW_OK);
+
+  for (ArrowDeviceType device_type : {ARROW_DEVICE_CUDA, ARROW_DEVICE_CUDA_HOST}) {
+    struct ArrowDevice* gpu = ArrowDeviceCuda(device_type, 0);
+    struct ArrowDeviceArray device_array2;
+    ASSERT_EQ(ArrowDeviceArrayViewCopyCoalesced(&device_array_view, gpu, &device_array2),
+              NANOARROW_OK);
+    ASSERT_EQ(device_array2.device_type, device_type);
+
+    // The three buffers are sections of one allocation
+    const uint8_t* const* buffers =
+        reinterpret_cast<const uint8_t* const*>(device_array2.array.buffers);
+    EXPECT_EQ(buffers[1] - buffers[0], 64);
+    EXPECT_EQ(buffers[2] - buffers[0], 128);
+
+    struct ArrowDeviceArrayView device_array_view2;
+    ArrowDeviceArrayViewInit(&device_array_view2);
+    ArrowArrayViewInitFromType(&device_array_view2.array_view, NANOARROW_TYPE_STRING);
+    ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view2, &device_array2, nullptr),
+              NANOARROW_OK);
+    EXPECT_EQ(device_array_view2.array_view.buffer_views[2].size_bytes, 7);
+
+    struct ArrowDeviceArray device_array3;
+    ASSERT_EQ(ArrowDeviceArrayViewCopy(&device_array_view2, cpu, &device_array3),
+              NANOARROW_OK);
+    device_array2.array.release(&device_array2.array);
+    ArrowDeviceArrayViewReset(&device_array_view2);
+
+    EXPECT_EQ(device_array3.array.length, 3);
+    EXPECT_EQ(memcmp(device_array3.array.buffers[2], "abcdefg", 7), 0);
+    device_array3.array.release(&device_array3.array);
+  }
+
+  // Sources that are not CPU-accessible can't be packed
+  struct ArrowDevice* gpu = ArrowDeviceCuda(ARROW_DEVICE_CUDA, 0);
+  struct ArrowDeviceArray device_array2;
+  ASSERT_EQ(ArrowDeviceArrayViewCopy(&device_array_view, gpu, &device_array2),
+            NANOARROW_OK);
+  device_array.array.release(&device_array.array);
+  ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view, &device_array2, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(ArrowDeviceArrayViewCopyCoalesced(&device_array_view, cpu, &device_array),
+            ENOTSUP);
+
+  device_array2.array.release(&device_array2.array);
+  ArrowDeviceArrayViewReset(&device_array_view);
+}
+
+TEST(NanoarrowDeviceCuda, DeviceCudaArrayInitFromSchema) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowDeviceArray device_array;
+  struct ArrowDeviceArray device_array2;
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRING), NANOARROW_OK);
+
+  for (ArrowDeviceType device_type : {ARROW_DEVICE_CUDA_HOST, ARROW_DEVICE_CUDA}) {
+    struct ArrowDevice* device = ArrowDeviceCuda(device_type, 0);
+    ASSERT_NE(device, nullptr);
+
+    ASSERT_EQ(ArrowDeviceArrayInitFromSchema(device, &array, &schema, nullptr),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("abc")), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("defg")), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+    const void* data = array.buffers[2];
+    ASSERT_EQ(ArrowDeviceArrayInit(cpu, &device_array, &array), NANOARROW_OK);
+
+    // Every buffer is accessible by the device, so the move does not copy
+    ASSERT_EQ(ArrowDeviceArrayMoveToDevice(&device_array, device, &device_array2),
+              NANOARROW_OK);
+    EXPECT_EQ(device_array.array.release, nullptr);
+    EXPECT_EQ(device_array2.device_type, device_type);
+    EXPECT_NE(device_array2.sync_event, nullptr);
+    EXPECT_EQ(device_array2.array.buffers[2], data);
+    EXPECT_EQ(memcmp(device_array2.array.buffers[2], "abcdefg", 7), 0);
+    device_array2.array.release(&device_array2.array);
+  }
+
+  // Buffers allocated by the default allocator still require a copy
+  struct ArrowDevice* gpu = ArrowDeviceCuda(ARROW_DEVICE_CUDA, 0);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("abc")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowDeviceArrayInit(cpu, &device_array, &array), NANOARROW_OK);
+  EXPECT_EQ(ArrowDeviceArrayMoveToDevice(&device_array, gpu, &device_array2), ENOTSUP);
+  device_array.array.release(&device_array.array);
+
+  schema.release(&schema);
+}
+
+TEST(NanoarrowDeviceCuda, DeviceCudaArrayStream) {
+  struct ArrowDevice* gpu = ArrowDeviceCuda(ARROW_DEVICE_CUDA, 0);
+  struct ArrowSchema schema;
+  struct ArrowArrayStream array_stream;
+  struct ArrowDeviceArrayStream device_array_stream;
+  struct ArrowError error;
+
+  // Batch i is [i, 10 * i]
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowBasicArrayStreamInit(&array_stream, &schema, 5), NANOARROW_OK);
+  for (int64_t i = 0; i < 5; i++) {
+    struct ArrowArray array;
+    ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendInt(&array, i), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendInt(&array, 10 * i), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+    ArrowBasicArrayStreamSetArray(&array_stream, i, &array);
+  }
+
+  EXPECT_EQ(ArrowDeviceCudaArrayStreamInit(&device_array_stream, &array_stream,
+                                           ArrowDeviceCpu(), 2, &error),
+            EINVAL);
+  EXPECT_EQ(ArrowDeviceCudaArrayStreamInit(&device_array_stream, &array_stream, gpu,
+                                           -1, &error),
+            EINVAL);
+  ASSERT_EQ(ArrowDeviceCudaArrayStreamInit(&device_array_stream, &array_stream, gpu, 2,
+                                           &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(array_stream.release, nullptr);
+  EXPECT_EQ(device_array_stream.device_type, ARROW_DEVICE_CUDA);
+
+  struct ArrowSchema schema_copy;
+  ASSERT_EQ(device_array_stream.get_schema(&device_array_stream, &schema_copy),
+            NANOARROW_OK);
+  EXPECT_STREQ(schema_copy.format, "i");
+  schema_copy.release(&schema_copy);
+
+  for (int64_t i = 0; i < 5; i++) {
+    struct ArrowDeviceArray device_array;
+    ASSERT_EQ(device_array_stream.get_next(&device_array_stream, &device_array),
+              NANOARROW_OK);
+    ASSERT_NE(device_array.array.release, nullptr);
+    EXPECT_EQ(device_array.device_type, ARROW_DEVICE_CUDA);
+    ASSERT_EQ(gpu->synchronize_event(gpu, device_array.sync_event, nullptr),
+              NANOARROW_OK);
+
+    int32_t values[2];
+    struct ArrowBufferView gpu_view = {device_array.array.buffers[1], sizeof(values)};
+    struct ArrowBufferView cpu_view = {values, sizeof(values)};
+    ASSERT_EQ(ArrowDeviceBufferCopy(gpu, gpu_view, ArrowDeviceCpu(), cpu_view),
+              NANOARROW_OK);
+    EXPECT_EQ(values[0], i);
+    EXPECT_EQ(values[1], 10 * i);
+    device_array.array.release(&device_array.array);
+  }
+
+  struct ArrowDeviceArray device_array;
+  ASSERT_EQ(device_array_stream.get_next(&device_array_stream, &device_array),
+            NANOARROW_OK);
+  EXPECT_EQ(device_array.array.release, nullptr);
+
+  device_array_stream.release(&device_array_stream);
+}
+
 class StringTypeParameterizedTestFixture
     : public ::testing::TestWithParam<std::pair<ArrowDeviceType, enum ArrowType>> {
  protected:
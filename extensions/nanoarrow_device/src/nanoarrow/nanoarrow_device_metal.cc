@@ -20,6 +20,8 @@
 #include <string.h>
 #include <unistd.h>
 
+#include <limits>
+
 #define NS_PRIVATE_IMPLEMENTATION
 #define MTL_PRIVATE_IMPLEMENTATION
 #include <Metal/Metal.hpp>
@@ -28,17 +30,34 @@
 
 #include "nanoarrow_device_metal.h"
 
-// If non-null, caller must ->release() the return value. This doesn't
-// release the underlying memory (which must be managed separately).
-static MTL::Buffer* ArrowDeviceMetalWrapBufferNonOwning(MTL::Device* mtl_device,
-                                                        const void* arbitrary_addr,
-                                                        int64_t size_bytes = -1) {
+static int64_t ArrowDeviceMetalPageSize(void) {
   // Cache the page size from the system call
   static int pagesize = 0;
   if (pagesize == 0) {
     pagesize = getpagesize();
   }
 
+  return pagesize;
+}
+
+// Rounds size_bytes up to a multiple of the page size, or returns -1 if this would
+// overflow
+static int64_t ArrowDeviceMetalPageAlignedSize(int64_t size_bytes) {
+  int64_t pagesize = ArrowDeviceMetalPageSize();
+  if (size_bytes > std::numeric_limits<int64_t>::max() - pagesize) {
+    return -1;
+  }
+
+  return (size_bytes + pagesize - 1) / pagesize * pagesize;
+}
+
+// If non-null, caller must ->release() the return value. This doesn't
+// release the underlying memory (which must be managed separately).
+static MTL::Buffer* ArrowDeviceMetalWrapBufferNonOwning(MTL::Device* mtl_device,
+                                                        const void* arbitrary_addr,
+                                                        int64_t size_bytes = -1) {
+  int64_t pagesize = ArrowDeviceMetalPageSize();
+
   // If we don't know the size of the buffer yet, try pagesize
   if (size_bytes == -1) {
     size_bytes = pagesize;
@@ -49,11 +68,9 @@ static MTL::Buffer* ArrowDeviceMetalWrapBufferNonOwning(MTL::Device* mtl_device,
     return mtl_device->newBuffer(0, MTL::ResourceStorageModeShared);
   }
 
-  int64_t allocation_size;
-  if (size_bytes % pagesize == 0) {
-    allocation_size = size_bytes;
-  } else {
-    allocation_size = (size_bytes / pagesize) + 1 * pagesize;
+  int64_t allocation_size = ArrowDeviceMetalPageAlignedSize(size_bytes);
+  if (allocation_size == -1) {
+    return nullptr;
   }
 
   // Will return nullptr if the memory is improperly aligned
@@ -64,22 +81,23 @@ static MTL::Buffer* ArrowDeviceMetalWrapBufferNonOwning(MTL::Device* mtl_device,
 static uint8_t* ArrowDeviceMetalAllocatorReallocate(
     struct ArrowBufferAllocator* allocator, uint8_t* ptr, int64_t old_size,
     int64_t new_size) {
-  // Cache the page size from the system call
-  static int pagesize = 0;
-  if (pagesize == 0) {
-    pagesize = getpagesize();
+  // Every allocation is a whole number of pages (and at least one page)
+  int64_t allocation_size = ArrowDeviceMetalPageAlignedSize(new_size);
+  if (allocation_size == -1) {
+    return nullptr;
+  } else if (allocation_size == 0) {
+    allocation_size = ArrowDeviceMetalPageSize();
   }
 
-  int64_t allocation_size;
-  if (new_size % pagesize == 0) {
-    allocation_size = new_size;
-  } else {
-    allocation_size = (new_size / pagesize) + 1 * pagesize;
+  // If growing an existing buffer but its allocation (which was rounded up to a whole
+  // number of pages in the same way) is still big enough, return the same pointer and
+  // do nothing.
+  int64_t old_allocation_size = ArrowDeviceMetalPageAlignedSize(old_size);
+  if (old_allocation_size == 0) {
+    old_allocation_size = ArrowDeviceMetalPageSize();
   }
 
-  // If growing an existing buffer but the allocation size is still big enough,
-  // return the same pointer and do nothing.
-  if (ptr != nullptr && new_size >= old_size && new_size <= allocation_size) {
+  if (ptr != nullptr && new_size >= old_size && allocation_size == old_allocation_size) {
     return ptr;
   }
 
@@ -90,13 +108,14 @@ static uint8_t* ArrowDeviceMetalAllocatorReallocate(
     copy_size = new_size;
   }
 
+  // Like realloc(), ptr remains valid if a new allocation can't be made
   void* new_ptr = nullptr;
-  posix_memalign(&new_ptr, pagesize, allocation_size);
-  if (new_ptr != nullptr && ptr != nullptr) {
-    memcpy(new_ptr, ptr, copy_size);
+  if (posix_memalign(&new_ptr, ArrowDeviceMetalPageSize(), allocation_size) != 0) {
+    return nullptr;
   }
 
   if (ptr != nullptr) {
+    memcpy(new_ptr, ptr, copy_size);
     free(ptr);
   }
 
@@ -108,13 +127,24 @@ static void ArrowDeviceMetalAllocatorFree(struct ArrowBufferAllocator* allocator
   free(ptr);
 }
 
+struct ArrowBufferAllocator ArrowDeviceMetalAllocator(void) {
+  struct ArrowBufferAllocator allocator;
+  allocator.reallocate = &ArrowDeviceMetalAllocatorReallocate;
+  allocator.free = &ArrowDeviceMetalAllocatorFree;
+  allocator.private_data = nullptr;
+  return allocator;
+}
+
 void ArrowDeviceMetalInitBuffer(struct ArrowBuffer* buffer) {
-  buffer->allocator.reallocate = &ArrowDeviceMetalAllocatorReallocate;
-  buffer->allocator.free = &ArrowDeviceMetalAllocatorFree;
-  buffer->allocator.private_data = nullptr;
+  buffer->allocator = ArrowDeviceMetalAllocator();
   buffer->data = nullptr;
   buffer->size_bytes = 0;
   buffer->capacity_bytes = 0;
+  buffer->growth_policy = NANOARROW_BUFFER_GROWTH_DOUBLE;
+#if defined(NANOARROW_WITH_BUFFER_STATS)
+  buffer->n_reallocations = 0;
+  buffer->bytes_reallocated = 0;
+#endif
 }
 
 ArrowErrorCode ArrowDeviceMetalAlignArrayBuffers(struct ArrowArray* array) {
@@ -128,6 +158,9 @@ ArrowErrorCode ArrowDeviceMetalAlignArrayBuffers(struct ArrowArray* array) {
         ArrowBufferAppend(&new_buffer, buffer->data, buffer->size_bytes));
     ArrowBufferReset(buffer);
     ArrowBufferMove(&new_buffer, buffer);
+
+    // Keep the pointers of an array that was already finished in sync
+    array->buffers[i] = buffer->data;
   }
 
   for (int64_t i = 0; i < array->n_children; i++) {
@@ -137,6 +170,23 @@ ArrowErrorCode ArrowDeviceMetalAlignArrayBuffers(struct ArrowArray* array) {
   return NANOARROW_OK;
 }
 
+ArrowErrorCode ArrowDeviceMetalArrayInitFromSchema(struct ArrowArray* array,
+                                                   struct ArrowSchema* schema,
+                                                   struct ArrowError* error) {
+  struct ArrowArray tmp;
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromSchema(&tmp, schema, error));
+
+  int result = ArrowArraySetAllocator(&tmp, ArrowDeviceMetalAllocator());
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "Failed to set the Metal allocator");
+    tmp.release(&tmp);
+    return result;
+  }
+
+  ArrowArrayMove(&tmp, array);
+  return NANOARROW_OK;
+}
+
 struct ArrowDeviceMetalArrayPrivate {
   struct ArrowArray parent;
   MTL::SharedEvent* event;
@@ -272,8 +322,14 @@ static ArrowErrorCode ArrowDeviceMetalBufferCopy(struct ArrowDevice* device_src,
 
 static int ArrowDeviceMetalCopyRequiredCpuToMetal(MTL::Device* mtl_device,
                                                   struct ArrowArray* src) {
-  // Only if all buffers in src can be wrapped as an MTL::Buffer
+  // Only if all buffers in src can be wrapped as an MTL::Buffer (buffers that were
+  // never allocated, e.g., the validity bitmap of an array with no nulls, can't be
+  // wrapped but don't need to be)
   for (int i = 0; i < src->n_buffers; i++) {
+    if (src->buffers[i] == nullptr) {
+      continue;
+    }
+
     MTL::Buffer* maybe_buffer =
         ArrowDeviceMetalWrapBufferNonOwning(mtl_device, src->buffers[i]);
     if (maybe_buffer == nullptr) {
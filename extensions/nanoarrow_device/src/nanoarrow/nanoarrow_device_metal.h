@@ -26,10 +26,14 @@
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceMetalDefaultDevice)
 #define ArrowDeviceMetalInitDefaultDevice \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceMetalInitDefaultDevice)
-#define ArrowDeviceMetalInitCpuBuffer \
-  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceMetalInitCpuBuffer)
-#define ArrowDeviceMetalInitCpuArrayBuffers \
-  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceMetalInitCpuArrayBuffers)
+#define ArrowDeviceMetalAllocator \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceMetalAllocator)
+#define ArrowDeviceMetalInitBuffer \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceMetalInitBuffer)
+#define ArrowDeviceMetalAlignArrayBuffers \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceMetalAlignArrayBuffers)
+#define ArrowDeviceMetalArrayInitFromSchema \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceMetalArrayInitFromSchema)
 
 #endif
 
@@ -58,6 +62,15 @@ struct ArrowDevice* ArrowDeviceMetalDefaultDevice(void);
 ArrowErrorCode ArrowDeviceMetalInitDefaultDevice(struct ArrowDevice* device,
                                                  struct ArrowError* error);
 
+/// \brief Return the Metal allocator
+///
+/// Allocations are page-aligned and padded to a whole number of pages such that
+/// they can be wrapped as an `MTL::Buffer*` without copying. Use with
+/// ArrowArraySetAllocator() (or ArrowDeviceMetalArrayInitFromSchema()) to build
+/// arrays whose move to the Metal device (see ArrowDeviceArrayMoveToDevice()) hands
+/// off pointers rather than copying buffers.
+struct ArrowBufferAllocator ArrowDeviceMetalAllocator(void);
+
 /// \brief Initialize a buffer with the Metal allocator
 ///
 /// Metal uses shared memory with the CPU; however, only page-aligned buffers
@@ -76,6 +89,16 @@ void ArrowDeviceMetalInitBuffer(struct ArrowBuffer* buffer);
 /// validation).
 ArrowErrorCode ArrowDeviceMetalAlignArrayBuffers(struct ArrowArray* array);
 
+/// \brief Initialize a CPU ArrowArray whose buffers use the Metal allocator
+///
+/// Like ArrowArrayInitFromSchema() except that every buffer of array, its children,
+/// and its dictionary is allocated using ArrowDeviceMetalAllocator(). Once built,
+/// the array can be moved to the Metal device with ArrowDeviceArrayMoveToDevice()
+/// without copying any buffers.
+ArrowErrorCode ArrowDeviceMetalArrayInitFromSchema(struct ArrowArray* array,
+                                                   struct ArrowSchema* schema,
+                                                   struct ArrowError* error);
+
 /// @}
 
 #ifdef __cplusplus
@@ -207,6 +207,41 @@ TEST(NanoarrowDeviceMetal, DeviceCpuArrayBuffers) {
   EXPECT_EQ(data_ptr[0], 1234);
 }
 
+TEST(NanoarrowDeviceMetal, DeviceCpuArrayInitFromSchema) {
+  struct ArrowDevice* metal = ArrowDeviceMetalDefaultDevice();
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+
+  nanoarrow::UniqueSchema schema;
+  ArrowSchemaInit(schema.get());
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowDeviceMetalArrayInitFromSchema(&array, schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int32_t i = 0; i < 10000; i++) {
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[0], i), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  const void* data_ptr = array.children[0]->buffers[1];
+
+  struct ArrowDeviceArray device_array;
+  ASSERT_EQ(ArrowDeviceArrayInit(cpu, &device_array, &array), NANOARROW_OK);
+
+  // Every buffer can be wrapped, so moving to Metal doesn't copy
+  struct ArrowDeviceArray device_array2;
+  device_array2.array.release = nullptr;
+  ASSERT_EQ(ArrowDeviceArrayMoveToDevice(&device_array, metal, &device_array2),
+            NANOARROW_OK);
+  EXPECT_EQ(device_array2.device_type, ARROW_DEVICE_METAL);
+  EXPECT_EQ(device_array2.array.children[0]->buffers[1], data_ptr);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(data_ptr)[9999], 9999);
+
+  device_array2.array.release(&device_array2.array);
+}
+
 class StringTypeParameterizedTestFixture
     : public ::testing::TestWithParam<enum ArrowType> {
  protected:
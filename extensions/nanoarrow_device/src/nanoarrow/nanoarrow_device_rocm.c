@@ -0,0 +1,790 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <string.h>
+
+#include <hip/hip_runtime_api.h>
+
+#include "nanoarrow_device.h"
+#include "nanoarrow_device_rocm.h"
+
+struct ArrowDeviceRocmAllocatorPrivate {
+  ArrowDeviceType device_type;
+  int64_t device_id;
+  // When moving a buffer from ROCM_HOST to ROCM, the pointer used to access
+  // the data changes but the pointer needed to pass to hipHostFree does not
+  void* allocated_ptr;
+  // Non-zero if allocated_ptr was allocated from a memory pool and must be freed
+  // with hipFreeAsync()
+  int pooled;
+};
+
+// Each ArrowDevice returned by ArrowDeviceRocm() owns one of these as its
+// private_data. The pool is NULL for ARROW_DEVICE_ROCM_HOST devices and devices that
+// don't support stream-ordered allocation.
+struct ArrowDeviceRocmPrivate {
+  hipMemPool_t pool;
+};
+
+static void ArrowDeviceRocmRelease(struct ArrowDevice* device);
+
+static void ArrowDeviceRocmDeallocator(struct ArrowBufferAllocator* allocator,
+                                       uint8_t* ptr, int64_t old_size) {
+  struct ArrowDeviceRocmAllocatorPrivate* allocator_private =
+      (struct ArrowDeviceRocmAllocatorPrivate*)allocator->private_data;
+
+  int prev_device = 0;
+  // Not ideal: we have no place to communicate any errors here
+  hipGetDevice(&prev_device);
+  hipSetDevice((int)allocator_private->device_id);
+
+  switch (allocator_private->device_type) {
+    case ARROW_DEVICE_ROCM:
+      // The null stream waits for work queued on other (blocking) streams, so the
+      // block is not reused by the pool while it may still be read or written
+      if (allocator_private->pooled) {
+        hipFreeAsync(allocator_private->allocated_ptr, 0);
+      } else {
+        hipFree(allocator_private->allocated_ptr);
+      }
+      break;
+    case ARROW_DEVICE_ROCM_HOST:
+      hipHostFree(allocator_private->allocated_ptr);
+      break;
+    default:
+      break;
+  }
+
+  hipSetDevice(prev_device);
+  ArrowFree(allocator_private);
+}
+
+// Allocates size_bytes on device, ordering the allocation on stream if the memory
+// comes from the device's pool
+static ArrowErrorCode ArrowDeviceRocmAllocateBufferInternal(struct ArrowDevice* device,
+                                                            struct ArrowBuffer* buffer,
+                                                            int64_t size_bytes,
+                                                            hipStream_t stream) {
+  if (device->release != &ArrowDeviceRocmRelease) {
+    return EINVAL;
+  }
+
+  struct ArrowDeviceRocmPrivate* private_data =
+      (struct ArrowDeviceRocmPrivate*)device->private_data;
+
+  int prev_device = 0;
+  hipError_t result = hipGetDevice(&prev_device);
+  if (result != hipSuccess) {
+    return EINVAL;
+  }
+
+  result = hipSetDevice((int)device->device_id);
+  if (result != hipSuccess) {
+    hipSetDevice(prev_device);
+    return EINVAL;
+  }
+
+  struct ArrowDeviceRocmAllocatorPrivate* allocator_private =
+      (struct ArrowDeviceRocmAllocatorPrivate*)ArrowMalloc(
+          sizeof(struct ArrowDeviceRocmAllocatorPrivate));
+  if (allocator_private == NULL) {
+    hipSetDevice(prev_device);
+    return ENOMEM;
+  }
+
+  void* ptr = NULL;
+  int pooled = 0;
+  switch (device->device_type) {
+    case ARROW_DEVICE_ROCM:
+      if (private_data->pool != NULL) {
+        pooled = 1;
+        result =
+            hipMallocFromPoolAsync(&ptr, (size_t)size_bytes, private_data->pool, stream);
+      } else {
+        result = hipMalloc(&ptr, (size_t)size_bytes);
+      }
+      break;
+    case ARROW_DEVICE_ROCM_HOST:
+      result = hipHostMalloc(&ptr, (size_t)size_bytes, hipHostMallocDefault);
+      break;
+    default:
+      ArrowFree(allocator_private);
+      hipSetDevice(prev_device);
+      return EINVAL;
+  }
+
+  if (result != hipSuccess) {
+    ArrowFree(allocator_private);
+    hipSetDevice(prev_device);
+    return ENOMEM;
+  }
+
+  allocator_private->device_id = device->device_id;
+  allocator_private->device_type = device->device_type;
+  allocator_private->allocated_ptr = ptr;
+  allocator_private->pooled = pooled;
+
+  buffer->data = (uint8_t*)ptr;
+  buffer->size_bytes = size_bytes;
+  buffer->capacity_bytes = size_bytes;
+  buffer->allocator =
+      ArrowBufferDeallocator(&ArrowDeviceRocmDeallocator, allocator_private);
+
+  hipSetDevice(prev_device);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowDeviceRocmAllocateBuffer(struct ArrowDevice* device,
+                                             struct ArrowBuffer* buffer,
+                                             int64_t size_bytes) {
+  return ArrowDeviceRocmAllocateBufferInternal(device, buffer, size_bytes, 0);
+}
+
+static uint8_t* ArrowDeviceRocmAllocatorReallocate(
+    struct ArrowBufferAllocator* allocator, uint8_t* ptr, int64_t old_size,
+    int64_t new_size) {
+  struct ArrowDevice* device = (struct ArrowDevice*)allocator->private_data;
+
+  // Always allocate at least one byte such that a successful allocation is not NULL
+  size_t allocation_size = new_size > 0 ? (size_t)new_size : 1;
+  void* new_ptr = NULL;
+  hipError_t result;
+  if (device->device_type == ARROW_DEVICE_ROCM_HOST) {
+    result = hipHostMalloc(&new_ptr, allocation_size, hipHostMallocDefault);
+  } else {
+    result = hipMallocManaged(&new_ptr, allocation_size, hipMemAttachGlobal);
+  }
+
+  if (result != hipSuccess) {
+    return NULL;
+  }
+
+  if (ptr != NULL) {
+    memcpy(new_ptr, ptr, (size_t)(new_size < old_size ? new_size : old_size));
+    allocator->free(allocator, ptr, old_size);
+  }
+
+  return (uint8_t*)new_ptr;
+}
+
+static void ArrowDeviceRocmAllocatorFree(struct ArrowBufferAllocator* allocator,
+                                         uint8_t* ptr, int64_t old_size) {
+  struct ArrowDevice* device = (struct ArrowDevice*)allocator->private_data;
+  if (device->device_type == ARROW_DEVICE_ROCM_HOST) {
+    hipHostFree(ptr);
+  } else {
+    hipFree(ptr);
+  }
+}
+
+ArrowErrorCode ArrowDeviceRocmAllocator(struct ArrowDevice* device,
+                                        struct ArrowBufferAllocator* out) {
+  if (device->release != &ArrowDeviceRocmRelease) {
+    return EINVAL;
+  }
+
+  out->reallocate = &ArrowDeviceRocmAllocatorReallocate;
+  out->free = &ArrowDeviceRocmAllocatorFree;
+  out->private_data = device;
+  return NANOARROW_OK;
+}
+
+struct ArrowDeviceRocmArrayPrivate {
+  struct ArrowArray parent;
+  hipEvent_t sync_event;
+};
+
+static void ArrowDeviceRocmArrayRelease(struct ArrowArray* array) {
+  struct ArrowDeviceRocmArrayPrivate* private_data =
+      (struct ArrowDeviceRocmArrayPrivate*)array->private_data;
+  hipEventDestroy(private_data->sync_event);
+  private_data->parent.release(&private_data->parent);
+  ArrowFree(private_data);
+  array->release = NULL;
+}
+
+static ArrowErrorCode ArrowDeviceRocmArrayInit(struct ArrowDevice* device,
+                                               struct ArrowDeviceArray* device_array,
+                                               struct ArrowArray* array) {
+  struct ArrowDeviceRocmArrayPrivate* private_data =
+      (struct ArrowDeviceRocmArrayPrivate*)ArrowMalloc(
+          sizeof(struct ArrowDeviceRocmArrayPrivate));
+  if (private_data == NULL) {
+    return ENOMEM;
+  }
+
+  int prev_device = 0;
+  hipError_t result = hipGetDevice(&prev_device);
+  if (result != hipSuccess) {
+    ArrowFree(private_data);
+    return EINVAL;
+  }
+
+  result = hipSetDevice((int)device->device_id);
+  if (result != hipSuccess) {
+    hipSetDevice(prev_device);
+    ArrowFree(private_data);
+    return EINVAL;
+  }
+
+  // The event is only used for synchronization, which is cheaper without timing
+  result = hipEventCreateWithFlags(&private_data->sync_event, hipEventDisableTiming);
+  if (result != hipSuccess) {
+    hipSetDevice(prev_device);
+    ArrowFree(private_data);
+    return EINVAL;
+  }
+
+  memset(device_array, 0, sizeof(struct ArrowDeviceArray));
+  device_array->array = *array;
+  device_array->array.private_data = private_data;
+  device_array->array.release = &ArrowDeviceRocmArrayRelease;
+  ArrowArrayMove(array, &private_data->parent);
+
+  device_array->device_id = device->device_id;
+  device_array->device_type = device->device_type;
+  device_array->sync_event = &private_data->sync_event;
+
+  hipSetDevice(prev_device);
+  return NANOARROW_OK;
+}
+
+// Resolves the kind of copy needed to copy memory from device_src to device_dst
+static ArrowErrorCode ArrowDeviceRocmMemcpyKind(struct ArrowDevice* device_src,
+                                                struct ArrowDevice* device_dst,
+                                                hipMemcpyKind* out) {
+  if (device_src->device_type == ARROW_DEVICE_CPU &&
+      device_dst->device_type == ARROW_DEVICE_ROCM) {
+    *out = hipMemcpyHostToDevice;
+  } else if (device_src->device_type == ARROW_DEVICE_ROCM &&
+             device_dst->device_type == ARROW_DEVICE_ROCM) {
+    *out = hipMemcpyDeviceToDevice;
+  } else if (device_src->device_type == ARROW_DEVICE_ROCM &&
+             device_dst->device_type == ARROW_DEVICE_CPU) {
+    *out = hipMemcpyDeviceToHost;
+  } else if (device_src->device_type == ARROW_DEVICE_CPU &&
+             device_dst->device_type == ARROW_DEVICE_ROCM_HOST) {
+    *out = hipMemcpyHostToHost;
+  } else if (device_src->device_type == ARROW_DEVICE_ROCM_HOST &&
+             device_dst->device_type == ARROW_DEVICE_ROCM_HOST) {
+    *out = hipMemcpyHostToHost;
+  } else if (device_src->device_type == ARROW_DEVICE_ROCM_HOST &&
+             device_dst->device_type == ARROW_DEVICE_CPU) {
+    *out = hipMemcpyHostToHost;
+  } else {
+    return ENOTSUP;
+  }
+
+  return NANOARROW_OK;
+}
+
+// Copies size_bytes from src on device_src to dst on device_dst, issuing the copy on
+// stream if async is non-zero. Copies between two ROCm devices are peer copies.
+static ArrowErrorCode ArrowDeviceRocmMemcpy(struct ArrowDevice* device_src,
+                                            const void* src,
+                                            struct ArrowDevice* device_dst, void* dst,
+                                            int64_t size_bytes, hipMemcpyKind memcpy_kind,
+                                            int async, hipStream_t stream) {
+  hipError_t result;
+  if (memcpy_kind == hipMemcpyDeviceToDevice &&
+      device_src->device_id != device_dst->device_id) {
+    if (async) {
+      result = hipMemcpyPeerAsync(dst, (int)device_dst->device_id, src,
+                                  (int)device_src->device_id, (size_t)size_bytes, stream);
+    } else {
+      result = hipMemcpyPeer(dst, (int)device_dst->device_id, src,
+                             (int)device_src->device_id, (size_t)size_bytes);
+    }
+  } else if (async) {
+    result = hipMemcpyAsync(dst, src, (size_t)size_bytes, memcpy_kind, stream);
+  } else {
+    result = hipMemcpy(dst, src, (size_t)size_bytes, memcpy_kind);
+  }
+
+  return result == hipSuccess ? NANOARROW_OK : EINVAL;
+}
+
+// Allocates a buffer of size_bytes on device_dst to be the destination of a copy
+// issued on stream
+static ArrowErrorCode ArrowDeviceRocmAllocateCopyDestination(
+    struct ArrowDevice* device_dst, int64_t size_bytes, hipStream_t stream,
+    struct ArrowBuffer* dst) {
+  if (device_dst->device_type == ARROW_DEVICE_CPU) {
+    ArrowBufferInit(dst);
+    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(dst, size_bytes));
+    dst->size_bytes = size_bytes;
+    return NANOARROW_OK;
+  }
+
+  return ArrowDeviceRocmAllocateBufferInternal(device_dst, dst, size_bytes, stream);
+}
+
+static ArrowErrorCode ArrowDeviceRocmBufferInit(struct ArrowDevice* device_src,
+                                                struct ArrowBufferView src,
+                                                struct ArrowDevice* device_dst,
+                                                struct ArrowBuffer* dst) {
+  hipMemcpyKind memcpy_kind;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowDeviceRocmMemcpyKind(device_src, device_dst, &memcpy_kind));
+
+  struct ArrowBuffer tmp;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowDeviceRocmAllocateCopyDestination(device_dst, src.size_bytes, 0, &tmp));
+
+  int result = ArrowDeviceRocmMemcpy(device_src, src.data.data, device_dst, tmp.data,
+                                     src.size_bytes, memcpy_kind, 0, 0);
+  if (result != NANOARROW_OK) {
+    ArrowBufferReset(&tmp);
+    return result;
+  }
+
+  ArrowBufferMove(&tmp, dst);
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowDeviceRocmBufferCopy(struct ArrowDevice* device_src,
+                                                struct ArrowBufferView src,
+                                                struct ArrowDevice* device_dst,
+                                                struct ArrowBufferView dst) {
+  hipMemcpyKind memcpy_kind;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowDeviceRocmMemcpyKind(device_src, device_dst, &memcpy_kind));
+
+  return ArrowDeviceRocmMemcpy(device_src, src.data.data, device_dst,
+                               (void*)dst.data.data, dst.size_bytes, memcpy_kind, 0, 0);
+}
+
+ArrowErrorCode ArrowDeviceRocmBufferInitAsync(struct ArrowDevice* device_src,
+                                              struct ArrowBufferView src,
+                                              struct ArrowDevice* device_dst,
+                                              struct ArrowBuffer* dst,
+                                              hipStream_t stream) {
+  hipMemcpyKind memcpy_kind;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowDeviceRocmMemcpyKind(device_src, device_dst, &memcpy_kind));
+
+  struct ArrowBuffer tmp;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowDeviceRocmAllocateCopyDestination(device_dst, src.size_bytes, stream, &tmp));
+
+  int result = ArrowDeviceRocmMemcpy(device_src, src.data.data, device_dst, tmp.data,
+                                     src.size_bytes, memcpy_kind, 1, stream);
+  if (result != NANOARROW_OK) {
+    ArrowBufferReset(&tmp);
+    return result;
+  }
+
+  ArrowBufferMove(&tmp, dst);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowDeviceRocmBufferCopyAsync(struct ArrowDevice* device_src,
+                                              struct ArrowBufferView src,
+                                              struct ArrowDevice* device_dst,
+                                              struct ArrowBufferView dst,
+                                              hipStream_t stream) {
+  hipMemcpyKind memcpy_kind;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowDeviceRocmMemcpyKind(device_src, device_dst, &memcpy_kind));
+
+  return ArrowDeviceRocmMemcpy(device_src, src.data.data, device_dst,
+                               (void*)dst.data.data, dst.size_bytes, memcpy_kind, 1,
+                               stream);
+}
+
+static ArrowErrorCode ArrowDeviceRocmArrayViewCopyInternal(struct ArrowDevice* device_src,
+                                                           struct ArrowArrayView* src,
+                                                           struct ArrowDevice* device_dst,
+                                                           hipStream_t stream,
+                                                           struct ArrowArray* dst) {
+  dst->length = src->length;
+  dst->offset = src->offset;
+  dst->null_count = src->null_count;
+
+  for (int i = 0; i < 3; i++) {
+    if (src->layout.buffer_type[i] == NANOARROW_BUFFER_TYPE_NONE) {
+      break;
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowDeviceRocmBufferInitAsync(
+        device_src, src->buffer_views[i], device_dst, ArrowArrayBuffer(dst, i), stream));
+  }
+
+  for (int64_t i = 0; i < src->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowDeviceRocmArrayViewCopyInternal(
+        device_src, src->children[i], device_dst, stream, dst->children[i]));
+  }
+
+  if (src->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowDeviceRocmArrayViewCopyInternal(
+        device_src, src->dictionary, device_dst, stream, dst->dictionary));
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowDeviceRocmArrayViewCopyAsync(struct ArrowDeviceArrayView* src,
+                                                 struct ArrowDevice* device_dst,
+                                                 hipStream_t stream,
+                                                 struct ArrowDeviceArray* dst) {
+  struct ArrowArray tmp;
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromArrayView(&tmp, &src->array_view, NULL));
+
+  int result = ArrowDeviceRocmArrayViewCopyInternal(src->device, &src->array_view,
+                                                    device_dst, stream, &tmp);
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayFinishBuilding(&tmp, NANOARROW_VALIDATION_LEVEL_MINIMAL, NULL);
+  }
+
+  // A CPU array has no sync_event, so its buffers must be complete when it is returned
+  // (as must those of any array whose copies failed before it can be released)
+  if (result != NANOARROW_OK || device_dst->device_type == ARROW_DEVICE_CPU) {
+    if (hipStreamSynchronize(stream) != hipSuccess && result == NANOARROW_OK) {
+      result = EINVAL;
+    }
+  }
+
+  if (result != NANOARROW_OK) {
+    tmp.release(&tmp);
+    return result;
+  }
+
+  result = ArrowDeviceArrayInit(device_dst, dst, &tmp);
+  if (result != NANOARROW_OK) {
+    tmp.release(&tmp);
+    return result;
+  }
+
+  // Otherwise, one event recorded after every copy signals that all of them are done
+  if (dst->sync_event != NULL &&
+      hipEventRecord(*((hipEvent_t*)dst->sync_event), stream) != hipSuccess) {
+    hipStreamSynchronize(stream);
+    dst->array.release(&dst->array);
+    return EINVAL;
+  }
+
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowDeviceRocmSynchronize(struct ArrowDevice* device,
+                                                 void* sync_event,
+                                                 struct ArrowError* error) {
+  if (sync_event == NULL) {
+    return NANOARROW_OK;
+  }
+
+  if (device->device_type != ARROW_DEVICE_ROCM &&
+      device->device_type != ARROW_DEVICE_ROCM_HOST) {
+    return ENOTSUP;
+  }
+
+  // Memory for hip_event is owned by the ArrowArray member of the ArrowDeviceArray
+  hipEvent_t* hip_event = (hipEvent_t*)sync_event;
+  hipError_t result = hipEventSynchronize(*hip_event);
+
+  if (result != hipSuccess) {
+    ArrowErrorSet(error, "hipEventSynchronize() failed: %s", hipGetErrorString(result));
+    return EINVAL;
+  }
+
+  return NANOARROW_OK;
+}
+
+// Check that every buffer of array is memory that device can access without a copy,
+// i.e., pinned host memory for ARROW_DEVICE_ROCM_HOST or managed memory for
+// ARROW_DEVICE_ROCM.
+static int ArrowDeviceRocmArrayIsAccessible(struct ArrowDevice* device,
+                                            struct ArrowArray* array) {
+  hipMemoryType expected_type = hipMemoryTypeManaged;
+  if (device->device_type == ARROW_DEVICE_ROCM_HOST) {
+    expected_type = hipMemoryTypeHost;
+  }
+
+  for (int64_t i = 0; i < array->n_buffers; i++) {
+    if (array->buffers[i] == NULL) {
+      continue;
+    }
+
+    hipPointerAttribute_t attributes;
+    if (hipPointerGetAttributes(&attributes, array->buffers[i]) != hipSuccess) {
+      // Clear the error such that it is not reported by a later call
+      hipGetLastError();
+      return 0;
+    }
+
+    if (attributes.type != expected_type) {
+      return 0;
+    }
+  }
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    if (!ArrowDeviceRocmArrayIsAccessible(device, array->children[i])) {
+      return 0;
+    }
+  }
+
+  if (array->dictionary != NULL) {
+    return ArrowDeviceRocmArrayIsAccessible(device, array->dictionary);
+  }
+
+  return 1;
+}
+
+static ArrowErrorCode ArrowDeviceRocmArrayMove(struct ArrowDevice* device_src,
+                                               struct ArrowDeviceArray* src,
+                                               struct ArrowDevice* device_dst,
+                                               struct ArrowDeviceArray* dst) {
+  // Note that the case where the devices are the same is handled before this
+
+  if (device_src->device_type == ARROW_DEVICE_ROCM_HOST &&
+      device_dst->device_type == ARROW_DEVICE_CPU) {
+    // Move: the array's release callback is responsible for hipHostFree. We do
+    // have to wait on the sync event, though, because this has to be NULL for a CPU
+    // device array.
+    NANOARROW_RETURN_NOT_OK(
+        ArrowDeviceRocmSynchronize(device_src, src->sync_event, NULL));
+    ArrowDeviceArrayMove(src, dst);
+    dst->device_type = device_dst->device_type;
+    dst->device_id = device_dst->device_id;
+    dst->sync_event = NULL;
+
+    return NANOARROW_OK;
+  }
+
+  if (device_src->device_type == ARROW_DEVICE_CPU &&
+      (device_dst->device_type == ARROW_DEVICE_ROCM_HOST ||
+       device_dst->device_type == ARROW_DEVICE_ROCM) &&
+      ArrowDeviceRocmArrayIsAccessible(device_dst, &src->array)) {
+    // Move: every buffer is already pinned (or managed) memory (e.g., an array built
+    // with ArrowDeviceArrayInitFromSchema()), so only the metadata changes. A CPU
+    // array has no sync_event to wait on.
+    return ArrowDeviceArrayInit(device_dst, dst, &src->array);
+  }
+
+  return ENOTSUP;
+}
+
+static void ArrowDeviceRocmRelease(struct ArrowDevice* device) {
+  // Buffers allocated by this device must be freed before it is released
+  struct ArrowDeviceRocmPrivate* private_data =
+      (struct ArrowDeviceRocmPrivate*)device->private_data;
+  if (private_data->pool != NULL) {
+    hipMemPoolDestroy(private_data->pool);
+  }
+
+  ArrowFree(private_data);
+  device->private_data = NULL;
+}
+
+// Creates the memory pool of an ARROW_DEVICE_ROCM device, leaving *out NULL if the
+// device does not support stream-ordered allocation
+static ArrowErrorCode ArrowDeviceRocmPoolInit(int device_id, hipMemPool_t* out,
+                                              struct ArrowError* error) {
+  *out = NULL;
+
+  int supported = 0;
+  hipError_t result = hipDeviceGetAttribute(
+      &supported, hipDeviceAttributeMemoryPoolsSupported, device_id);
+  if (result != hipSuccess || !supported) {
+    return NANOARROW_OK;
+  }
+
+  hipMemPoolProps props;
+  memset(&props, 0, sizeof(hipMemPoolProps));
+  props.allocType = hipMemAllocationTypePinned;
+  props.handleTypes = hipMemHandleTypeNone;
+  props.location.type = hipMemLocationTypeDevice;
+  props.location.id = device_id;
+
+  result = hipMemPoolCreate(out, &props);
+  if (result != hipSuccess) {
+    *out = NULL;
+    ArrowErrorSet(error, "hipMemPoolCreate() failed: %s", hipGetErrorString(result));
+    return EINVAL;
+  }
+
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowDeviceRocmInitDevice(struct ArrowDevice* device,
+                                                ArrowDeviceType device_type,
+                                                int64_t device_id,
+                                                struct ArrowError* error) {
+  switch (device_type) {
+    case ARROW_DEVICE_ROCM:
+    case ARROW_DEVICE_ROCM_HOST:
+      break;
+    default:
+      ArrowErrorSet(error, "Device type code %d not supported", (int)device_type);
+      return EINVAL;
+  }
+
+  int n_devices;
+  hipError_t result = hipGetDeviceCount(&n_devices);
+  if (result != hipSuccess) {
+    ArrowErrorSet(error, "hipGetDeviceCount() failed: %s", hipGetErrorString(result));
+    return EINVAL;
+  }
+
+  if (device_id < 0 || device_id >= n_devices) {
+    ArrowErrorSet(error, "ROCm device_id must be between 0 and %d", n_devices - 1);
+    return EINVAL;
+  }
+
+  struct ArrowDeviceRocmPrivate* private_data =
+      (struct ArrowDeviceRocmPrivate*)ArrowMalloc(sizeof(struct ArrowDeviceRocmPrivate));
+  if (private_data == NULL) {
+    ArrowErrorSet(error, "Failed to allocate ROCm device private data");
+    return ENOMEM;
+  }
+
+  private_data->pool = NULL;
+  if (device_type == ARROW_DEVICE_ROCM) {
+    int pool_result = ArrowDeviceRocmPoolInit((int)device_id, &private_data->pool, error);
+    if (pool_result != NANOARROW_OK) {
+      ArrowFree(private_data);
+      return pool_result;
+    }
+  }
+
+  device->device_type = device_type;
+  device->device_id = device_id;
+  device->array_init = &ArrowDeviceRocmArrayInit;
+  device->array_move = &ArrowDeviceRocmArrayMove;
+  device->buffer_init = &ArrowDeviceRocmBufferInit;
+  device->buffer_move = NULL;
+  device->buffer_copy = &ArrowDeviceRocmBufferCopy;
+  device->synchronize_event = &ArrowDeviceRocmSynchronize;
+  device->release = &ArrowDeviceRocmRelease;
+  device->private_data = private_data;
+
+  return NANOARROW_OK;
+}
+
+// The devices returned by ArrowDeviceRocm(): n_devices ARROW_DEVICE_ROCM devices
+// followed by n_devices ARROW_DEVICE_ROCM_HOST devices
+struct ArrowDeviceRocmRegistry {
+  struct ArrowDevice* devices;
+  int n_devices;
+};
+
+static struct ArrowDeviceRocmRegistry registry_singleton = {NULL, 0};
+
+static ArrowErrorCode ArrowDeviceRocmRegistryInit(int n_devices) {
+  struct ArrowDevice* devices =
+      (struct ArrowDevice*)ArrowMalloc(2 * n_devices * sizeof(struct ArrowDevice));
+  if (devices == NULL) {
+    return ENOMEM;
+  }
+
+  for (int i = 0; i < n_devices; i++) {
+    int result = ArrowDeviceRocmInitDevice(devices + i, ARROW_DEVICE_ROCM, i, NULL);
+    if (result == NANOARROW_OK) {
+      result = ArrowDeviceRocmInitDevice(devices + n_devices + i, ARROW_DEVICE_ROCM_HOST,
+                                         i, NULL);
+      if (result != NANOARROW_OK) {
+        devices[i].release(devices + i);
+      }
+    }
+
+    if (result != NANOARROW_OK) {
+      for (int j = 0; j < i; j++) {
+        devices[j].release(devices + j);
+        devices[n_devices + j].release(devices + n_devices + j);
+      }
+      ArrowFree(devices);
+      return result;
+    }
+  }
+
+  registry_singleton.n_devices = n_devices;
+  registry_singleton.devices = devices;
+  return NANOARROW_OK;
+}
+
+struct ArrowDevice* ArrowDeviceRocm(ArrowDeviceType device_type, int64_t device_id) {
+  if (registry_singleton.devices == NULL) {
+    int n_devices;
+    hipError_t result = hipGetDeviceCount(&n_devices);
+    if (result != hipSuccess || n_devices == 0 ||
+        ArrowDeviceRocmRegistryInit(n_devices) != NANOARROW_OK) {
+      return NULL;
+    }
+  }
+
+  if (device_id < 0 || device_id >= registry_singleton.n_devices) {
+    return NULL;
+  }
+
+  switch (device_type) {
+    case ARROW_DEVICE_ROCM:
+      return registry_singleton.devices + device_id;
+    case ARROW_DEVICE_ROCM_HOST:
+      return registry_singleton.devices + registry_singleton.n_devices + device_id;
+    default:
+      return NULL;
+  }
+}
+
+// Returns the pool of device or NULL if device was not returned by ArrowDeviceRocm()
+// or has no pool (in which case *code is set to the error to return)
+static hipMemPool_t ArrowDeviceRocmPool(struct ArrowDevice* device, int* code) {
+  if (device->release != &ArrowDeviceRocmRelease) {
+    *code = EINVAL;
+    return NULL;
+  }
+
+  hipMemPool_t pool = ((struct ArrowDeviceRocmPrivate*)device->private_data)->pool;
+  *code = pool == NULL ? ENOTSUP : NANOARROW_OK;
+  return pool;
+}
+
+ArrowErrorCode ArrowDeviceRocmPoolSetMaxBytesRetained(struct ArrowDevice* device,
+                                                      int64_t max_bytes_retained) {
+  if (max_bytes_retained < 0) {
+    return EINVAL;
+  }
+
+  int code;
+  hipMemPool_t pool = ArrowDeviceRocmPool(device, &code);
+  if (pool == NULL) {
+    return code;
+  }
+
+  uint64_t threshold = (uint64_t)max_bytes_retained;
+  if (hipMemPoolSetAttribute(pool, hipMemPoolAttrReleaseThreshold, &threshold) !=
+      hipSuccess) {
+    return EINVAL;
+  }
+
+  // Lowering the threshold doesn't release memory until the next synchronization
+  if (hipMemPoolTrimTo(pool, (size_t)max_bytes_retained) != hipSuccess) {
+    return EINVAL;
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowDeviceRocmPoolTrim(struct ArrowDevice* device) {
+  int code;
+  hipMemPool_t pool = ArrowDeviceRocmPool(device, &code);
+  if (pool == NULL) {
+    return code;
+  }
+
+  return hipMemPoolTrimTo(pool, 0) == hipSuccess ? NANOARROW_OK : EINVAL;
+}
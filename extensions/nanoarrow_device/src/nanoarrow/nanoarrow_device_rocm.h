@@ -0,0 +1,150 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef NANOARROW_DEVICE_ROCM_H_INCLUDED
+#define NANOARROW_DEVICE_ROCM_H_INCLUDED
+
+#include <hip/hip_runtime_api.h>
+
+#include "nanoarrow_device.h"
+
+#ifdef NANOARROW_NAMESPACE
+
+#define ArrowDeviceRocm NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceRocm)
+#define ArrowDeviceRocmBufferInitAsync \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceRocmBufferInitAsync)
+#define ArrowDeviceRocmBufferCopyAsync \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceRocmBufferCopyAsync)
+#define ArrowDeviceRocmArrayViewCopyAsync \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceRocmArrayViewCopyAsync)
+#define ArrowDeviceRocmAllocateBuffer \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceRocmAllocateBuffer)
+#define ArrowDeviceRocmAllocator \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceRocmAllocator)
+#define ArrowDeviceRocmPoolSetMaxBytesRetained \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceRocmPoolSetMaxBytesRetained)
+#define ArrowDeviceRocmPoolTrim \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDeviceRocmPoolTrim)
+
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \defgroup nanoarrow_device_rocm ROCm Device extension
+///
+/// A ROCm/HIP (i.e., `hip/hip_runtime_api.h`) implementation of the Arrow C Device
+/// interface that mirrors the CUDA extension.
+///
+/// @{
+
+/// \brief Get a ROCm device from type and ID
+///
+/// device_type must be one of ARROW_DEVICE_ROCM or ARROW_DEVICE_ROCM_HOST;
+/// device_id must be between 0 and hipGetDeviceCount - 1. The same device is
+/// returned for every call with the same arguments. Copies between two distinct
+/// ARROW_DEVICE_ROCM devices are issued with hipMemcpyPeer() (or
+/// hipMemcpyPeerAsync()).
+struct ArrowDevice* ArrowDeviceRocm(ArrowDeviceType device_type, int64_t device_id);
+
+/// \brief Allocate an uninitialized buffer on a ROCm device
+///
+/// Allocates size_bytes of device memory (or pinned host memory for
+/// ARROW_DEVICE_ROCM_HOST) whose release callback frees it. Device memory is
+/// allocated with hipMallocFromPoolAsync() from a memory pool owned by device (or
+/// with hipMalloc() if the device does not support memory pools) on the null stream
+/// and freed with hipFreeAsync() on the null stream, which is ordered after work
+/// queued on other blocking streams. Returns EINVAL if device was not returned by
+/// ArrowDeviceRocm().
+ArrowErrorCode ArrowDeviceRocmAllocateBuffer(struct ArrowDevice* device,
+                                             struct ArrowBuffer* buffer,
+                                             int64_t size_bytes);
+
+/// \brief Get an allocator for CPU-writable memory that a ROCm device can read
+///
+/// For ARROW_DEVICE_ROCM_HOST, buffers are pinned host memory allocated with
+/// hipHostMalloc(); for ARROW_DEVICE_ROCM, buffers are managed memory allocated with
+/// hipMallocManaged(). Buffers never come from the memory pool of device and growing
+/// a buffer is always a new allocation and a copy. An array whose buffers were all
+/// allocated in this way can be moved from the CPU to device with
+/// ArrowDeviceArrayMoveToDevice() without a copy. Returns EINVAL if device was not
+/// returned by ArrowDeviceRocm().
+ArrowErrorCode ArrowDeviceRocmAllocator(struct ArrowDevice* device,
+                                        struct ArrowBufferAllocator* out);
+
+/// \brief Retain freed allocations of a ROCm device for reuse
+///
+/// Sets the release threshold of the memory pool used by ArrowDeviceRocmAllocateBuffer()
+/// for an ARROW_DEVICE_ROCM device. By default (0), memory freed to the pool is
+/// returned to the system at the next synchronization; when max_bytes_retained is
+/// greater than zero, up to this many bytes are kept by the pool such that future
+/// allocations (e.g., of the next batch of a stream whose batches have a similar
+/// shape) are served without a new allocation. Returns ENOTSUP if the device does not
+/// support memory pools or EINVAL if device was not returned by ArrowDeviceRocm().
+ArrowErrorCode ArrowDeviceRocmPoolSetMaxBytesRetained(struct ArrowDevice* device,
+                                                      int64_t max_bytes_retained);
+
+/// \brief Return all memory retained by the pool of a ROCm device to the system
+ArrowErrorCode ArrowDeviceRocmPoolTrim(struct ArrowDevice* device);
+
+/// \brief Initialize an owning buffer from existing content on a HIP stream
+///
+/// Like ArrowDeviceBufferInit() for a copy to or from a ROCm device, except that the
+/// copy is issued with hipMemcpyAsync() on stream (and device memory is allocated on
+/// stream). dst is allocated before this returns but its content is only valid once
+/// the work queued on stream is complete; src must remain valid until then. Copies
+/// only overlap with other work when host memory is pinned (i.e.,
+/// ARROW_DEVICE_ROCM_HOST). Returns ENOTSUP if neither device_src nor device_dst is a
+/// ROCm device.
+ArrowErrorCode ArrowDeviceRocmBufferInitAsync(struct ArrowDevice* device_src,
+                                              struct ArrowBufferView src,
+                                              struct ArrowDevice* device_dst,
+                                              struct ArrowBuffer* dst,
+                                              hipStream_t stream);
+
+/// \brief Copy a section of memory into a preallocated buffer on a HIP stream
+///
+/// Like ArrowDeviceBufferCopy() except that the copy is issued with
+/// hipMemcpyAsync() on stream and is complete once the work queued on stream is
+/// complete.
+ArrowErrorCode ArrowDeviceRocmBufferCopyAsync(struct ArrowDevice* device_src,
+                                              struct ArrowBufferView src,
+                                              struct ArrowDevice* device_dst,
+                                              struct ArrowBufferView dst,
+                                              hipStream_t stream);
+
+/// \brief Copy an ArrowDeviceArrayView to a device on a HIP stream
+///
+/// Like ArrowDeviceArrayViewCopy() except that the copy of every buffer is issued on
+/// stream without waiting for the previous one to complete. If device_dst is a ROCm
+/// device, one event is recorded on stream after the last copy as the sync_event of
+/// dst and this function returns without blocking; otherwise, stream is synchronized
+/// before returning because CPU arrays have no sync_event. src must remain valid until
+/// dst's sync_event has completed.
+ArrowErrorCode ArrowDeviceRocmArrayViewCopyAsync(struct ArrowDeviceArrayView* src,
+                                                 struct ArrowDevice* device_dst,
+                                                 hipStream_t stream,
+                                                 struct ArrowDeviceArray* dst);
+
+/// @}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,311 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <errno.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+
+#include "nanoarrow_device.h"
+#include "nanoarrow_device_rocm.h"
+
+TEST(NanoarrowDeviceRocm, GetDevice) {
+  struct ArrowDevice* rocm = ArrowDeviceRocm(ARROW_DEVICE_ROCM, 0);
+  ASSERT_NE(rocm, nullptr);
+  EXPECT_EQ(rocm->device_type, ARROW_DEVICE_ROCM);
+  struct ArrowDevice* rocm_host = ArrowDeviceRocm(ARROW_DEVICE_ROCM_HOST, 0);
+  ASSERT_NE(rocm_host, nullptr);
+  EXPECT_EQ(rocm_host->device_type, ARROW_DEVICE_ROCM_HOST);
+
+  // Devices are singletons that are also available from ArrowDeviceResolve()
+  EXPECT_EQ(ArrowDeviceRocm(ARROW_DEVICE_ROCM, 0), rocm);
+  EXPECT_EQ(ArrowDeviceRocm(ARROW_DEVICE_ROCM_HOST, 0), rocm_host);
+  EXPECT_EQ(ArrowDeviceResolve(ARROW_DEVICE_ROCM, 0), rocm);
+  EXPECT_EQ(ArrowDeviceResolve(ARROW_DEVICE_ROCM_HOST, 0), rocm_host);
+
+  // null return for invalid input
+  EXPECT_EQ(ArrowDeviceRocm(ARROW_DEVICE_ROCM, std::numeric_limits<int32_t>::max()),
+            nullptr);
+  EXPECT_EQ(ArrowDeviceRocm(ARROW_DEVICE_CPU, 0), nullptr);
+}
+
+TEST(NanoarrowDeviceRocm, DeviceRocmBufferInit) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowDevice* gpu = ArrowDeviceRocm(ARROW_DEVICE_ROCM, 0);
+  struct ArrowBuffer buffer_gpu;
+  struct ArrowBuffer buffer;
+  uint8_t data[] = {0x01, 0x02, 0x03, 0x04, 0x05};
+  struct ArrowBufferView cpu_view = {data, sizeof(data)};
+
+  // CPU -> GPU
+  ASSERT_EQ(ArrowDeviceBufferInit(cpu, cpu_view, gpu, &buffer_gpu), NANOARROW_OK);
+  EXPECT_EQ(buffer_gpu.size_bytes, sizeof(data));
+  // (Content is tested on the roundtrip)
+  struct ArrowBufferView gpu_view = {buffer_gpu.data, buffer_gpu.size_bytes};
+
+  // GPU -> GPU
+  ASSERT_EQ(ArrowDeviceBufferInit(gpu, gpu_view, gpu, &buffer), NANOARROW_OK);
+  EXPECT_EQ(buffer.size_bytes, sizeof(data));
+  // (Content is tested on the roundtrip)
+  ArrowBufferReset(&buffer);
+
+  // GPU -> CPU
+  ASSERT_EQ(ArrowDeviceBufferInit(gpu, gpu_view, cpu, &buffer), NANOARROW_OK);
+  EXPECT_EQ(buffer.size_bytes, sizeof(data));
+  EXPECT_EQ(memcmp(buffer.data, data, sizeof(data)), 0);
+  ArrowBufferReset(&buffer);
+
+  ArrowBufferReset(&buffer_gpu);
+}
+
+TEST(NanoarrowDeviceRocm, DeviceRocmHostBufferInit) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowDevice* gpu = ArrowDeviceRocm(ARROW_DEVICE_ROCM_HOST, 0);
+  struct ArrowBuffer buffer_gpu;
+  struct ArrowBuffer buffer;
+  uint8_t data[] = {0x01, 0x02, 0x03, 0x04, 0x05};
+  struct ArrowBufferView cpu_view = {data, sizeof(data)};
+
+  // CPU -> GPU
+  ASSERT_EQ(ArrowDeviceBufferInit(cpu, cpu_view, gpu, &buffer_gpu), NANOARROW_OK);
+  EXPECT_EQ(buffer_gpu.size_bytes, sizeof(data));
+  EXPECT_EQ(memcmp(buffer_gpu.data, data, sizeof(data)), 0);
+  // Here, "GPU" is memory in the CPU space allocated by hipHostMalloc
+  struct ArrowBufferView gpu_view = {buffer_gpu.data, buffer_gpu.size_bytes};
+
+  // GPU -> CPU
+  ASSERT_EQ(ArrowDeviceBufferInit(gpu, gpu_view, cpu, &buffer), NANOARROW_OK);
+  EXPECT_EQ(buffer.size_bytes, sizeof(data));
+  EXPECT_EQ(memcmp(buffer.data, data, sizeof(data)), 0);
+  ArrowBufferReset(&buffer);
+
+  ArrowBufferReset(&buffer_gpu);
+}
+
+TEST(NanoarrowDeviceRocm, DeviceRocmBufferCopyAsync) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowDevice* gpu = ArrowDeviceRocm(ARROW_DEVICE_ROCM, 0);
+  uint8_t data[] = {0x01, 0x02, 0x03, 0x04, 0x05};
+  struct ArrowBufferView cpu_view = {data, sizeof(data)};
+
+  hipStream_t stream;
+  ASSERT_EQ(hipStreamCreate(&stream), hipSuccess);
+
+  // CPU -> GPU
+  struct ArrowBuffer buffer_gpu;
+  ASSERT_EQ(ArrowDeviceRocmBufferInitAsync(cpu, cpu_view, gpu, &buffer_gpu, stream),
+            NANOARROW_OK);
+  EXPECT_EQ(buffer_gpu.size_bytes, sizeof(data));
+  struct ArrowBufferView gpu_view = {buffer_gpu.data, buffer_gpu.size_bytes};
+
+  // GPU -> CPU
+  uint8_t cpu_dest[5];
+  struct ArrowBufferView cpu_dest_view = {cpu_dest, sizeof(data)};
+  ASSERT_EQ(ArrowDeviceRocmBufferCopyAsync(gpu, gpu_view, cpu, cpu_dest_view, stream),
+            NANOARROW_OK);
+  ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+  EXPECT_EQ(memcmp(cpu_dest, data, sizeof(data)), 0);
+
+  // CPU -> CPU is not a ROCm copy
+  struct ArrowBuffer buffer;
+  EXPECT_EQ(ArrowDeviceRocmBufferInitAsync(cpu, cpu_view, cpu, &buffer, stream), ENOTSUP);
+
+  ArrowBufferReset(&buffer_gpu);
+  ASSERT_EQ(hipStreamDestroy(stream), hipSuccess);
+}
+
+TEST(NanoarrowDeviceRocm, DeviceRocmPool) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowDevice* gpu = ArrowDeviceRocm(ARROW_DEVICE_ROCM, 0);
+  struct ArrowDevice* gpu_host = ArrowDeviceRocm(ARROW_DEVICE_ROCM_HOST, 0);
+
+  EXPECT_EQ(ArrowDeviceRocmPoolSetMaxBytesRetained(cpu, 1024), EINVAL);
+  EXPECT_EQ(ArrowDeviceRocmPoolTrim(cpu), EINVAL);
+  EXPECT_EQ(ArrowDeviceRocmPoolSetMaxBytesRetained(gpu, -1), EINVAL);
+
+  // Pinned host memory is never pooled
+  EXPECT_EQ(ArrowDeviceRocmPoolSetMaxBytesRetained(gpu_host, 1024), ENOTSUP);
+
+  int result = ArrowDeviceRocmPoolSetMaxBytesRetained(gpu, 1 << 20);
+  if (result == ENOTSUP) {
+    GTEST_SKIP() << "ROCm device 0 does not support memory pools";
+  }
+  ASSERT_EQ(result, NANOARROW_OK);
+
+  // Blocks freed to the pool are served again without changing their content
+  std::vector<uint8_t> data(4096, 0x01);
+  struct ArrowBufferView cpu_view = {data.data(), static_cast<int64_t>(data.size())};
+  for (int i = 0; i < 3; i++) {
+    struct ArrowBuffer buffer_gpu;
+    ASSERT_EQ(ArrowDeviceBufferInit(cpu, cpu_view, gpu, &buffer_gpu), NANOARROW_OK);
+
+    struct ArrowBuffer buffer;
+    struct ArrowBufferView gpu_view = {buffer_gpu.data, buffer_gpu.size_bytes};
+    ASSERT_EQ(ArrowDeviceBufferInit(gpu, gpu_view, cpu, &buffer), NANOARROW_OK);
+    EXPECT_EQ(memcmp(buffer.data, data.data(), data.size()), 0);
+    ArrowBufferReset(&buffer);
+    ArrowBufferReset(&buffer_gpu);
+  }
+
+  ASSERT_EQ(ArrowDeviceRocmPoolTrim(gpu), NANOARROW_OK);
+  ASSERT_EQ(ArrowDeviceRocmPoolSetMaxBytesRetained(gpu, 0), NANOARROW_OK);
+}
+
+TEST(NanoarrowDeviceRocm, DeviceRocmArrayViewCopyAsync) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowDevice* gpu = ArrowDeviceRocm(ARROW_DEVICE_ROCM, 0);
+  struct ArrowArray array;
+  struct ArrowDeviceArray device_array;
+  struct ArrowDeviceArrayView device_array_view;
+
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("abc")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("defg")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowDeviceArrayInit(cpu, &device_array, &array), NANOARROW_OK);
+
+  ArrowDeviceArrayViewInit(&device_array_view);
+  ArrowArrayViewInitFromType(&device_array_view.array_view, NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view, &device_array, nullptr),
+            NANOARROW_OK);
+
+  hipStream_t stream;
+  ASSERT_EQ(hipStreamCreate(&stream), hipSuccess);
+
+  // CPU -> GPU returns an array whose sync_event completes after every copy
+  struct ArrowDeviceArray device_array2;
+  ASSERT_EQ(
+      ArrowDeviceRocmArrayViewCopyAsync(&device_array_view, gpu, stream, &device_array2),
+      NANOARROW_OK);
+  EXPECT_EQ(device_array2.device_type, ARROW_DEVICE_ROCM);
+  ASSERT_NE(device_array2.sync_event, nullptr);
+  ASSERT_EQ(gpu->synchronize_event(gpu, device_array2.sync_event, nullptr),
+            NANOARROW_OK);
+  device_array.array.release(&device_array.array);
+
+  // GPU -> CPU is complete when it returns
+  ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view, &device_array2, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowDeviceRocmArrayViewCopyAsync(&device_array_view, cpu, stream, &device_array),
+      NANOARROW_OK);
+  device_array2.array.release(&device_array2.array);
+  EXPECT_EQ(device_array.device_type, ARROW_DEVICE_CPU);
+  EXPECT_EQ(device_array.sync_event, nullptr);
+
+  ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view, &device_array, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(device_array_view.array_view.length, 3);
+  EXPECT_EQ(device_array_view.array_view.buffer_views[2].size_bytes, 7);
+  EXPECT_EQ(memcmp(device_array_view.array_view.buffer_views[2].data.data, "abcdefg", 7),
+            0);
+
+  device_array.array.release(&device_array.array);
+  ArrowDeviceArrayViewReset(&device_array_view);
+  ASSERT_EQ(hipStreamDestroy(stream), hipSuccess);
+}
+
+TEST(NanoarrowDeviceRocm, DeviceRocmArrayViewCopyCoalesced) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowDevice* gpu = ArrowDeviceRocm(ARROW_DEVICE_ROCM, 0);
+  struct ArrowArray array;
+  struct ArrowDeviceArray device_array;
+  struct ArrowDeviceArrayView device_array_view;
+
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("abc")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("defg")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowDeviceArrayInit(cpu, &device_array, &array), NANOARROW_OK);
+
+  ArrowDeviceArrayViewInit(&device_array_view);
+  ArrowArrayViewInitFromType(&device_array_view.array_view, NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view, &device_array, nullptr),
+            NANOARROW_OK);
+
+  // Staged through pinned ROCM_HOST memory in a single transfer
+  struct ArrowDeviceArray device_array2;
+  ASSERT_EQ(ArrowDeviceArrayViewCopyCoalesced(&device_array_view, gpu, &device_array2),
+            NANOARROW_OK);
+  EXPECT_EQ(device_array2.device_type, ARROW_DEVICE_ROCM);
+  device_array.array.release(&device_array.array);
+
+  ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view, &device_array2, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(device_array_view.array_view.length, 2);
+  EXPECT_EQ(device_array_view.array_view.buffer_views[2].size_bytes, 7);
+
+  ASSERT_EQ(ArrowDeviceArrayViewCopy(&device_array_view, cpu, &device_array),
+            NANOARROW_OK);
+  device_array2.array.release(&device_array2.array);
+  EXPECT_EQ(memcmp(device_array.array.buffers[2], "abcdefg", 7), 0);
+
+  device_array.array.release(&device_array.array);
+  ArrowDeviceArrayViewReset(&device_array_view);
+}
+
+TEST(NanoarrowDeviceRocm, DeviceRocmArrayInitFromSchema) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowDeviceArray device_array;
+  struct ArrowDeviceArray device_array2;
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRING), NANOARROW_OK);
+
+  for (ArrowDeviceType device_type : {ARROW_DEVICE_ROCM_HOST, ARROW_DEVICE_ROCM}) {
+    struct ArrowDevice* device = ArrowDeviceRocm(device_type, 0);
+    ASSERT_NE(device, nullptr);
+
+    ASSERT_EQ(ArrowDeviceArrayInitFromSchema(device, &array, &schema, nullptr),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("abc")), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("defg")), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+    const void* data = array.buffers[2];
+    ASSERT_EQ(ArrowDeviceArrayInit(cpu, &device_array, &array), NANOARROW_OK);
+
+    // Every buffer is accessible by the device, so the move does not copy
+    ASSERT_EQ(ArrowDeviceArrayMoveToDevice(&device_array, device, &device_array2),
+              NANOARROW_OK);
+    EXPECT_EQ(device_array.array.release, nullptr);
+    EXPECT_EQ(device_array2.device_type, device_type);
+    EXPECT_NE(device_array2.sync_event, nullptr);
+    EXPECT_EQ(device_array2.array.buffers[2], data);
+    EXPECT_EQ(memcmp(device_array2.array.buffers[2], "abcdefg", 7), 0);
+    device_array2.array.release(&device_array2.array);
+  }
+
+  // Buffers allocated by the default allocator still require a copy
+  struct ArrowDevice* gpu = ArrowDeviceRocm(ARROW_DEVICE_ROCM, 0);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("abc")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowDeviceArrayInit(cpu, &device_array, &array), NANOARROW_OK);
+  EXPECT_EQ(ArrowDeviceArrayMoveToDevice(&device_array, gpu, &device_array2), ENOTSUP);
+  device_array.array.release(&device_array.array);
+
+  schema.release(&schema);
+}
@@ -17,6 +17,8 @@
 
 #include <errno.h>
 
+#include <string>
+
 #include <gtest/gtest.h>
 
 #include "nanoarrow_device.h"
@@ -37,6 +39,38 @@ TEST(NanoarrowDevice, CpuDevice) {
   EXPECT_EQ(cpu->synchronize_event(cpu, sync_event, nullptr), EINVAL);
 }
 
+TEST(NanoarrowDevice, ArrowDeviceCpuAllocator) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowBufferAllocator allocator;
+  ASSERT_EQ(ArrowDeviceAllocator(cpu, &allocator), NANOARROW_OK);
+  EXPECT_EQ(allocator.reallocate, ArrowBufferAllocatorDefault().reallocate);
+
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowDeviceArray device_array;
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowDeviceArrayInitFromSchema(cpu, &array, &schema, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 123), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowDeviceArrayInit(cpu, &device_array, &array), NANOARROW_OK);
+  EXPECT_EQ(device_array.array.length, 1);
+  device_array.array.release(&device_array.array);
+
+  // A device without CPU-writable memory
+  struct ArrowDevice device;
+  ArrowDeviceInitCpu(&device);
+  device.device_type = ARROW_DEVICE_VPI;
+  EXPECT_EQ(ArrowDeviceAllocator(&device, &allocator), ENOTSUP);
+
+  struct ArrowError error;
+  EXPECT_EQ(ArrowDeviceArrayInitFromSchema(&device, &array, &schema, &error), ENOTSUP);
+  EXPECT_STREQ(error.message, "Device type 9 does not provide a CPU-writable allocator");
+
+  schema.release(&schema);
+}
+
 TEST(NanoarrowDevice, ArrowDeviceCpuBuffer) {
   struct ArrowDevice* cpu = ArrowDeviceCpu();
   struct ArrowBuffer buffer;
@@ -108,3 +142,211 @@ INSTANTIATE_TEST_SUITE_P(NanoarrowDevice, StringTypeParameterizedTestFixture,
                                            NANOARROW_TYPE_LARGE_STRING,
                                            NANOARROW_TYPE_BINARY,
                                            NANOARROW_TYPE_LARGE_BINARY));
+
+TEST(NanoarrowDevice, ArrowDeviceCpuArrayViewNestedStrings) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowDeviceArray device_array;
+  struct ArrowDeviceArrayView device_array_view;
+
+  // The sizes of every string buffer in the tree are resolved together
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_LARGE_BINARY),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema.children[2], 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[2]->children[0], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.children[0], ArrowCharView("abc")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView("defgh")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.children[2]->children[0], ArrowCharView("ij")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(array.children[2]), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowDeviceArrayInit(cpu, &device_array, &array), NANOARROW_OK);
+
+  ArrowDeviceArrayViewInit(&device_array_view);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&device_array_view.array_view, &schema, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view, &device_array, nullptr),
+            NANOARROW_OK);
+
+  struct ArrowArrayView* array_view = &device_array_view.array_view;
+  EXPECT_EQ(array_view->children[0]->buffer_views[2].size_bytes, 3);
+  EXPECT_EQ(array_view->children[1]->buffer_views[2].size_bytes, 5);
+  EXPECT_EQ(array_view->children[2]->children[0]->buffer_views[2].size_bytes, 2);
+
+  device_array.array.release(&device_array.array);
+  ArrowDeviceArrayViewReset(&device_array_view);
+  schema.release(&schema);
+}
+
+TEST(NanoarrowDevice, ArrowDeviceCpuArrayViewCopySlice) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowDeviceArray device_array;
+  struct ArrowDeviceArrayView device_array_view;
+
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[2], NANOARROW_TYPE_LIST), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[2]->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+
+  // Row i is {i or null if i % 3 == 0, "i", [i, 10 * i]}
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int64_t i = 0; i < 20; i++) {
+    if (i % 3 == 0) {
+      ASSERT_EQ(ArrowArrayAppendNull(array.children[0], 1), NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowArrayAppendInt(array.children[0], i), NANOARROW_OK);
+    }
+
+    std::string value = std::to_string(i);
+    ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView(value.c_str())),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[2]->children[0], i), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[2]->children[0], 10 * i),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(array.children[2]), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  // Rows 11 through 14
+  array.offset = 11;
+  array.length = 4;
+  ASSERT_EQ(ArrowDeviceArrayInit(cpu, &device_array, &array), NANOARROW_OK);
+
+  ArrowDeviceArrayViewInit(&device_array_view);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&device_array_view.array_view, &schema, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view, &device_array, nullptr),
+            NANOARROW_OK);
+
+  struct ArrowDeviceArray device_array2;
+  ASSERT_EQ(ArrowDeviceArrayViewCopy(&device_array_view, cpu, &device_array2),
+            NANOARROW_OK);
+  device_array.array.release(&device_array.array);
+
+  // Only rows 8 through 14 were copied such that the bitmaps didn't need a shift
+  struct ArrowArray* copy = &device_array2.array;
+  EXPECT_EQ(copy->offset, 3);
+  EXPECT_EQ(copy->length, 4);
+  EXPECT_EQ(copy->children[0]->length, 7);
+  EXPECT_EQ(copy->children[2]->children[0]->length, 14);
+
+  ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view, &device_array2, nullptr),
+            NANOARROW_OK);
+  struct ArrowArrayView* array_view = &device_array_view.array_view;
+  EXPECT_EQ(array_view->children[0]->buffer_views[1].size_bytes, 7 * sizeof(int32_t));
+  EXPECT_EQ(array_view->children[1]->buffer_views[1].size_bytes, 8 * sizeof(int32_t));
+  EXPECT_EQ(array_view->children[1]->buffer_views[2].size_bytes, 12);
+  EXPECT_EQ(array_view->children[2]->children[0]->buffer_views[1].size_bytes,
+            14 * sizeof(int32_t));
+
+  for (int64_t i = 0; i < 4; i++) {
+    int64_t row = 11 + i;
+    int64_t index = copy->offset + i;
+
+    EXPECT_EQ(ArrowArrayViewIsNull(array_view->children[0], index), row % 3 == 0);
+    if (row % 3 != 0) {
+      EXPECT_EQ(ArrowArrayViewGetIntUnsafe(array_view->children[0], index), row);
+    }
+
+    struct ArrowStringView value =
+        ArrowArrayViewGetStringUnsafe(array_view->children[1], index);
+    EXPECT_EQ(std::string(value.data, value.size_bytes), std::to_string(row));
+
+    struct ArrowArrayView* list = array_view->children[2];
+    int64_t child_index = ArrowArrayViewListChildOffset(list, index);
+    EXPECT_EQ(ArrowArrayViewListChildOffset(list, index + 1) - child_index, 2);
+    EXPECT_EQ(ArrowArrayViewGetIntUnsafe(list->children[0], child_index), row);
+    EXPECT_EQ(ArrowArrayViewGetIntUnsafe(list->children[0], child_index + 1), 10 * row);
+  }
+
+  device_array2.array.release(&device_array2.array);
+  ArrowDeviceArrayViewReset(&device_array_view);
+  schema.release(&schema);
+}
+
+TEST(NanoarrowDevice, ArrowDeviceCpuArrayViewCopyCoalesced) {
+  struct ArrowDevice* cpu = ArrowDeviceCpu();
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowDeviceArray device_array;
+  struct ArrowDeviceArrayView device_array_view;
+
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 123), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView("abc")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowDeviceArrayInit(cpu, &device_array, &array), NANOARROW_OK);
+
+  ArrowDeviceArrayViewInit(&device_array_view);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&device_array_view.array_view, &schema, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view, &device_array, nullptr),
+            NANOARROW_OK);
+
+  struct ArrowDeviceArray device_array2;
+  ASSERT_EQ(ArrowDeviceArrayViewCopyCoalesced(&device_array_view, cpu, &device_array2),
+            NANOARROW_OK);
+  device_array.array.release(&device_array.array);
+
+  // Every non-empty buffer is an aligned section of the same allocation (the children
+  // have no validity buffers)
+  struct ArrowArray* copy = &device_array2.array;
+  const uint8_t* base = reinterpret_cast<const uint8_t*>(copy->buffers[0]);
+  ASSERT_NE(base, nullptr);
+  EXPECT_EQ(copy->children[0]->buffers[0], nullptr);
+  EXPECT_EQ(copy->children[1]->buffers[0], nullptr);
+  const uint8_t* buffers[] = {
+      reinterpret_cast<const uint8_t*>(copy->children[0]->buffers[1]),
+      reinterpret_cast<const uint8_t*>(copy->children[1]->buffers[1]),
+      reinterpret_cast<const uint8_t*>(copy->children[1]->buffers[2])};
+  for (int64_t i = 0; i < 3; i++) {
+    EXPECT_EQ(buffers[i] - base, 64 * (i + 1));
+  }
+
+  ASSERT_EQ(ArrowDeviceArrayViewSetArray(&device_array_view, &device_array2, nullptr),
+            NANOARROW_OK);
+  struct ArrowArrayView* array_view = &device_array_view.array_view;
+  EXPECT_FALSE(ArrowArrayViewIsNull(array_view, 0));
+  EXPECT_TRUE(ArrowArrayViewIsNull(array_view, 1));
+  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(array_view->children[0], 0), 123);
+  struct ArrowStringView value =
+      ArrowArrayViewGetStringUnsafe(array_view->children[1], 0);
+  EXPECT_EQ(std::string(value.data, value.size_bytes), "abc");
+
+  // The allocation outlives the parent if a child is moved out of it
+  struct ArrowArray child;
+  ArrowArrayMove(copy->children[1], &child);
+  device_array2.array.release(&device_array2.array);
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(child.buffers[2]), 3), "abc");
+  child.release(&child);
+
+  ArrowDeviceArrayViewReset(&device_array_view);
+  schema.release(&schema);
+}
@@ -0,0 +1,441 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "nanoarrow/nanoarrow_ipc.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_COLUMNS 256
+
+static void print_usage(void) {
+  fprintf(stderr,
+          "Usage: transcode_stream [OPTIONS] INPUT OUTPUT (either may be - for "
+          "stdin/stdout)\n"
+          "\n"
+          "Reads an Arrow IPC stream and writes its (possibly compressed) batches\n"
+          "uncompressed, optionally reshaped by the following options:\n"
+          "\n"
+          "  --columns PATHS    Comma-separated field paths to keep (e.g., a,b.c)\n"
+          "  --batch-rows N     Rebatch to N rows per batch (the last may be shorter)\n"
+          "  --split-rows N     Write every N rows to a new OUTPUT.0, OUTPUT.1, ...\n"
+          "  --file             Write the Arrow IPC file format instead of a stream\n");
+}
+
+struct TranscodeOptions {
+  const char* input;
+  const char* output;
+  struct ArrowStringView columns[MAX_COLUMNS];
+  int64_t n_columns;
+  int64_t batch_rows;
+  int64_t split_rows;
+  int file_format;
+};
+
+// The state of the output stream currently being written and of the batch being
+// accumulated for it
+struct Transcoder {
+  struct TranscodeOptions* options;
+  struct ArrowSchema schema;
+  struct ArrowIpcWriter writer;
+  int writer_open;
+  int64_t n_outputs;
+  int64_t output_rows;
+  struct ArrowArray pending;
+  struct ArrowArrayView view;
+  int64_t total_rows;
+  int64_t total_batches;
+};
+
+static int parse_int64(const char* value, int64_t* out) {
+  char* end = NULL;
+  errno = 0;
+  long long parsed = strtoll(value, &end, 10);
+  if (errno != 0 || end == value || *end != '\0' || parsed <= 0) {
+    return EINVAL;
+  }
+
+  *out = (int64_t)parsed;
+  return NANOARROW_OK;
+}
+
+static int parse_columns(char* value, struct TranscodeOptions* options) {
+  options->n_columns = 0;
+  char* begin = value;
+  while (1) {
+    char* end = strchr(begin, ',');
+    if (options->n_columns == MAX_COLUMNS) {
+      return EINVAL;
+    }
+
+    struct ArrowStringView* path = options->columns + options->n_columns;
+    path->data = begin;
+    path->size_bytes = end == NULL ? (int64_t)strlen(begin) : (int64_t)(end - begin);
+    options->n_columns++;
+
+    if (end == NULL) {
+      return NANOARROW_OK;
+    }
+
+    begin = end + 1;
+  }
+}
+
+static int parse_args(int argc, char* argv[], struct TranscodeOptions* options) {
+  memset(options, 0, sizeof(struct TranscodeOptions));
+
+  int n_positional = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--file") == 0) {
+      options->file_format = 1;
+    } else if (strcmp(argv[i], "--columns") == 0 && (i + 1) < argc) {
+      NANOARROW_RETURN_NOT_OK(parse_columns(argv[++i], options));
+    } else if (strcmp(argv[i], "--batch-rows") == 0 && (i + 1) < argc) {
+      NANOARROW_RETURN_NOT_OK(parse_int64(argv[++i], &options->batch_rows));
+    } else if (strcmp(argv[i], "--split-rows") == 0 && (i + 1) < argc) {
+      NANOARROW_RETURN_NOT_OK(parse_int64(argv[++i], &options->split_rows));
+    } else if (strncmp(argv[i], "--", 2) == 0) {
+      return EINVAL;
+    } else if (n_positional == 0) {
+      options->input = argv[i];
+      n_positional++;
+    } else if (n_positional == 1) {
+      options->output = argv[i];
+      n_positional++;
+    } else {
+      return EINVAL;
+    }
+  }
+
+  if (n_positional != 2) {
+    return EINVAL;
+  }
+
+  // Split outputs are named after OUTPUT, which can't be stdout
+  if (options->split_rows > 0 && strcmp(options->output, "-") == 0) {
+    return EINVAL;
+  }
+
+  return NANOARROW_OK;
+}
+
+static int open_output(struct Transcoder* transcoder, struct ArrowError* error) {
+  struct TranscodeOptions* options = transcoder->options;
+
+  FILE* file_ptr;
+  if (options->split_rows > 0) {
+    char filename[4096];
+    snprintf(filename, sizeof(filename), "%s.%ld", options->output,
+             (long)transcoder->n_outputs);
+    file_ptr = fopen(filename, "wb");
+  } else if (strcmp(options->output, "-") == 0) {
+    file_ptr = freopen(NULL, "wb", stdout);
+  } else {
+    file_ptr = fopen(options->output, "wb");
+  }
+
+  if (file_ptr == NULL) {
+    ArrowErrorSet(error, "Failed to open output %ld of '%s'",
+                  (long)transcoder->n_outputs, options->output);
+    return EINVAL;
+  }
+
+  struct ArrowIpcOutputStream output_stream;
+  int result = ArrowIpcOutputStreamInitFile(&output_stream, file_ptr, 1);
+  if (result != NANOARROW_OK) {
+    fclose(file_ptr);
+    ArrowErrorSet(error, "ArrowIpcOutputStreamInitFile() failed");
+    return result;
+  }
+
+  result = ArrowIpcWriterInit(&transcoder->writer, &output_stream);
+  if (result != NANOARROW_OK) {
+    output_stream.release(&output_stream);
+    ArrowErrorSet(error, "ArrowIpcWriterInit() failed");
+    return result;
+  }
+
+  transcoder->writer_open = 1;
+  transcoder->n_outputs++;
+  transcoder->output_rows = 0;
+  if (options->file_format) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcWriterStartFile(&transcoder->writer, error));
+  }
+
+  return ArrowIpcWriterWriteSchema(&transcoder->writer, &transcoder->schema, error);
+}
+
+static int close_output(struct Transcoder* transcoder, struct ArrowError* error) {
+  if (!transcoder->writer_open) {
+    return NANOARROW_OK;
+  }
+
+  int result;
+  if (transcoder->options->file_format) {
+    result = ArrowIpcWriterFinalizeFile(&transcoder->writer, error);
+  } else {
+    result = ArrowIpcWriterWriteArrayView(&transcoder->writer, NULL, error);
+  }
+
+  ArrowIpcWriterReset(&transcoder->writer);
+  transcoder->writer_open = 0;
+  transcoder->output_rows = 0;
+  return result;
+}
+
+static int write_array(struct Transcoder* transcoder, struct ArrowArray* array,
+                       struct ArrowError* error) {
+  if (!transcoder->writer_open) {
+    NANOARROW_RETURN_NOT_OK(open_output(transcoder, error));
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowArrayViewSetArray(&transcoder->view, array, error));
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcWriterWriteArrayView(&transcoder->writer, &transcoder->view, error));
+
+  transcoder->output_rows += array->length;
+  transcoder->total_rows += array->length;
+  transcoder->total_batches++;
+
+  if (transcoder->options->split_rows > 0 &&
+      transcoder->output_rows == transcoder->options->split_rows) {
+    NANOARROW_RETURN_NOT_OK(close_output(transcoder, error));
+  }
+
+  return NANOARROW_OK;
+}
+
+static int start_pending(struct Transcoder* transcoder, struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(
+      ArrowArrayInitFromSchema(&transcoder->pending, &transcoder->schema, error));
+  return ArrowArrayStartAppending(&transcoder->pending);
+}
+
+static int flush_pending(struct Transcoder* transcoder, struct ArrowError* error) {
+  if (transcoder->pending.length == 0) {
+    return NANOARROW_OK;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowArrayFinishBuildingDefault(&transcoder->pending, error));
+  int result = write_array(transcoder, &transcoder->pending, error);
+  transcoder->pending.release(&transcoder->pending);
+  NANOARROW_RETURN_NOT_OK(result);
+  return start_pending(transcoder, error);
+}
+
+// Appends the rows of array to the pending batch, writing it whenever it reaches
+// --batch-rows rows or the current output reaches --split-rows rows
+static int append_array(struct Transcoder* transcoder, struct ArrowArray* array,
+                        struct ArrowError* error) {
+  struct TranscodeOptions* options = transcoder->options;
+
+  struct ArrowArrayView in_view;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowArrayViewInitFromSchema(&in_view, &transcoder->schema, error));
+  int result = ArrowArrayViewSetArray(&in_view, array, error);
+
+  int64_t offset = 0;
+  while (result == NANOARROW_OK && offset < array->length) {
+    int64_t n_rows = array->length - offset;
+    if (options->batch_rows > 0 &&
+        n_rows > (options->batch_rows - transcoder->pending.length)) {
+      n_rows = options->batch_rows - transcoder->pending.length;
+    }
+
+    int64_t output_remaining =
+        options->split_rows - transcoder->output_rows - transcoder->pending.length;
+    if (options->split_rows > 0 && n_rows > output_remaining) {
+      n_rows = output_remaining;
+    }
+
+    result = ArrowArrayAppendArrayView(&transcoder->pending, &in_view, offset, n_rows);
+    if (result != NANOARROW_OK) {
+      ArrowErrorSet(error, "ArrowArrayAppendArrayView() failed");
+      break;
+    }
+
+    offset += n_rows;
+
+    // Without --batch-rows, input batches are only cut at --split-rows boundaries
+    int batch_full = transcoder->pending.length == options->batch_rows;
+    int output_full = options->split_rows > 0 && n_rows == output_remaining;
+    int input_done = options->batch_rows == 0 && offset == array->length;
+    if (batch_full || output_full || input_done) {
+      result = flush_pending(transcoder, error);
+    }
+  }
+
+  ArrowArrayViewReset(&in_view);
+  return result;
+}
+
+static const char* last_error(struct ArrowArrayStream* stream) {
+  const char* message = stream->get_last_error(stream);
+  if (message == NULL) {
+    message = "";
+  }
+
+  return message;
+}
+
+static int transcode(struct Transcoder* transcoder, struct ArrowArrayStream* stream,
+                     struct ArrowError* error) {
+  struct TranscodeOptions* options = transcoder->options;
+  int rebatch = options->batch_rows > 0 || options->split_rows > 0;
+
+  int result = stream->get_schema(stream, &transcoder->schema);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "stream.get_schema() returned %d with error '%s'", result,
+                  last_error(stream));
+    return result;
+  }
+
+  NANOARROW_RETURN_NOT_OK(
+      ArrowArrayViewInitFromSchema(&transcoder->view, &transcoder->schema, error));
+
+  // Rows appended to a new batch only keep the indices of dictionary-encoded columns
+  if (rebatch) {
+    for (int64_t i = 0; i < transcoder->schema.n_children; i++) {
+      if (transcoder->schema.children[i]->dictionary != NULL) {
+        ArrowErrorSet(error,
+                      "--batch-rows and --split-rows are not supported for "
+                      "dictionary-encoded column '%s'",
+                      transcoder->schema.children[i]->name);
+        return ENOTSUP;
+      }
+    }
+
+    NANOARROW_RETURN_NOT_OK(start_pending(transcoder, error));
+  } else {
+    NANOARROW_RETURN_NOT_OK(open_output(transcoder, error));
+  }
+
+  struct ArrowArray array;
+  while (1) {
+    result = stream->get_next(stream, &array);
+    if (result != NANOARROW_OK) {
+      ArrowErrorSet(error, "stream.get_next() returned %d with error '%s'", result,
+                    last_error(stream));
+      return result;
+    }
+
+    if (array.release == NULL) {
+      break;
+    }
+
+    if (rebatch) {
+      result = append_array(transcoder, &array, error);
+    } else {
+      result = write_array(transcoder, &array, error);
+    }
+
+    array.release(&array);
+    NANOARROW_RETURN_NOT_OK(result);
+  }
+
+  if (rebatch) {
+    NANOARROW_RETURN_NOT_OK(flush_pending(transcoder, error));
+  }
+
+  // An empty input still produces one (empty) output
+  if (transcoder->n_outputs == 0) {
+    NANOARROW_RETURN_NOT_OK(open_output(transcoder, error));
+  }
+
+  return close_output(transcoder, error);
+}
+
+int main(int argc, char* argv[]) {
+  struct TranscodeOptions options;
+  if (parse_args(argc, argv, &options) != NANOARROW_OK) {
+    print_usage();
+    return 1;
+  }
+
+  FILE* file_ptr;
+  if (strcmp(options.input, "-") == 0) {
+    file_ptr = freopen(NULL, "rb", stdin);
+  } else {
+    file_ptr = fopen(options.input, "rb");
+  }
+
+  if (file_ptr == NULL) {
+    fprintf(stderr, "Failed to open input '%s'\n", options.input);
+    return 1;
+  }
+
+  struct ArrowIpcInputStream input;
+  int result = ArrowIpcInputStreamInitFile(&input, file_ptr, 1);
+  if (result != NANOARROW_OK) {
+    fprintf(stderr, "ArrowIpcInputStreamInitFile() failed\n");
+    fclose(file_ptr);
+    return 1;
+  }
+
+  // Only the selected columns are decoded and whole messages are read at once
+  struct ArrowIpcArrayStreamReaderOptions reader_options;
+  ArrowIpcArrayStreamReaderOptionsInit(&reader_options);
+  reader_options.field_paths = options.columns;
+  reader_options.n_field_paths = options.n_columns;
+  if (strcmp(options.input, "-") != 0) {
+    reader_options.read_ahead_bytes = 1024 * 1024;
+  }
+
+  struct ArrowArrayStream stream;
+  result = ArrowIpcArrayStreamReaderInit(&stream, &input, &reader_options);
+  if (result != NANOARROW_OK) {
+    fprintf(stderr, "ArrowIpcArrayStreamReaderInit() failed\n");
+    input.release(&input);
+    return 1;
+  }
+
+  struct Transcoder transcoder;
+  memset(&transcoder, 0, sizeof(struct Transcoder));
+  transcoder.options = &options;
+
+  clock_t begin = clock();
+  struct ArrowError error;
+  error.message[0] = '\0';
+  result = transcode(&transcoder, &stream, &error);
+  clock_t end = clock();
+
+  if (transcoder.writer_open) {
+    ArrowIpcWriterReset(&transcoder.writer);
+  }
+  if (transcoder.pending.release != NULL) {
+    transcoder.pending.release(&transcoder.pending);
+  }
+  ArrowArrayViewReset(&transcoder.view);
+  if (transcoder.schema.release != NULL) {
+    transcoder.schema.release(&transcoder.schema);
+  }
+  stream.release(&stream);
+
+  if (result != NANOARROW_OK) {
+    fprintf(stderr, "%s\n", error.message);
+    return 1;
+  }
+
+  double elapsed = (end - begin) / ((double)CLOCKS_PER_SEC);
+  fprintf(stderr, "Wrote %ld rows in %ld batch(es) to %ld output(s) <%.06f seconds>\n",
+          (long)transcoder.total_rows, (long)transcoder.total_batches,
+          (long)transcoder.n_outputs, elapsed);
+  return 0;
+}
@@ -29,6 +29,10 @@
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcSharedBufferInit)
 #define ArrowIpcSharedBufferReset \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcSharedBufferReset)
+#define ArrowIpcSharedBufferSlice \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcSharedBufferSlice)
+#define ArrowIpcSharedBufferInitMmap \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcSharedBufferInitMmap)
 #define ArrowIpcDecoderInit NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderInit)
 #define ArrowIpcDecoderReset NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderReset)
 #define ArrowIpcDecoderPeekHeader \
@@ -37,26 +41,166 @@
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderVerifyHeader)
 #define ArrowIpcDecoderDecodeHeader \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderDecodeHeader)
+#define ArrowIpcDecoderDecodeFlightDataHeader \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderDecodeFlightDataHeader)
+#define ArrowIpcDecoderDecodeRecordBatchSizes \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderDecodeRecordBatchSizes)
 #define ArrowIpcDecoderDecodeSchema \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderDecodeSchema)
 #define ArrowIpcDecoderDecodeArrayView \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderDecodeArrayView)
 #define ArrowIpcDecoderDecodeArray \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderDecodeArray)
+#define ArrowIpcDecoderDecodeArrayInto \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderDecodeArrayInto)
 #define ArrowIpcDecoderDecodeArrayFromShared \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderDecodeArrayFromShared)
+#define ArrowIpcDecoderDecodeDeviceArray \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderDecodeDeviceArray)
+#define ArrowIpcDecoderDecodeDictionary \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderDecodeDictionary)
+#define ArrowIpcDecoderDecodeDictionaryFromShared \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderDecodeDictionaryFromShared)
 #define ArrowIpcDecoderSetSchema \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderSetSchema)
+#define ArrowIpcDecoderSetProjection \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderSetProjection)
+#define ArrowIpcDecompressionIsSupported \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecompressionIsSupported)
+#define ArrowIpcDecoderSetExecutor \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderSetExecutor)
+#define ArrowIpcDecoderSetAllocator \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderSetAllocator)
+#define ArrowIpcDecoderSetSharedBufferCopyThreshold \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderSetSharedBufferCopyThreshold)
+#define ArrowIpcDecoderSetDeviceBody \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderSetDeviceBody)
+#define ArrowIpcDecoderGetStats \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderGetStats)
 #define ArrowIpcDecoderSetEndianness \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderSetEndianness)
+#define ArrowIpcDecoderSetVerificationLevel \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderSetVerificationLevel)
+#define ArrowIpcSchemaCacheInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcSchemaCacheInit)
+#define ArrowIpcSchemaCacheReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcSchemaCacheReset)
+#define ArrowIpcSchemaCacheGetStats \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcSchemaCacheGetStats)
+#define ArrowIpcDecoderSetSchemaCache \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderSetSchemaCache)
 #define ArrowIpcInputStreamInitBuffer \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcInputStreamInitBuffer)
 #define ArrowIpcInputStreamInitFile \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcInputStreamInitFile)
+#define ArrowIpcInputStreamInitMmap \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcInputStreamInitMmap)
+#define ArrowIpcInputStreamInitFileDescriptor \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcInputStreamInitFileDescriptor)
+#define ArrowIpcInputStreamInitSharedRing \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcInputStreamInitSharedRing)
+#define ArrowIpcOutputStreamInitSharedRing \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcOutputStreamInitSharedRing)
 #define ArrowIpcInputStreamMove \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcInputStreamMove)
+#define ArrowIpcFooterInit NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcFooterInit)
+#define ArrowIpcFooterReset NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcFooterReset)
+#define ArrowIpcDecoderPeekFooter \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderPeekFooter)
+#define ArrowIpcDecoderVerifyFooter \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderVerifyFooter)
+#define ArrowIpcDecoderDecodeFooter \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderDecodeFooter)
+#define ArrowIpcFileReaderInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcFileReaderInit)
+#define ArrowIpcFileReaderReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcFileReaderReset)
+#define ArrowIpcFileReaderReadRecordBatch \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcFileReaderReadRecordBatch)
+#define ArrowIpcFileReaderReadRecordBatchSizes \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcFileReaderReadRecordBatchSizes)
+#define ArrowIpcArrayStreamReaderOptionsInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcArrayStreamReaderOptionsInit)
 #define ArrowIpcArrayStreamReaderInit \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcArrayStreamReaderInit)
+#define ArrowIpcArrayStreamReaderGetStats \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcArrayStreamReaderGetStats)
+#define ArrowIpcArrayStreamReaderSeek \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcArrayStreamReaderSeek)
+#define ArrowIpcBatchViewInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcBatchViewInit)
+#define ArrowIpcBatchViewSetArray \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcBatchViewSetArray)
+#define ArrowIpcBatchViewGetColumn \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcBatchViewGetColumn)
+#define ArrowIpcBatchViewReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcBatchViewReset)
+#define ArrowIpcMessageIndexInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcMessageIndexInit)
+#define ArrowIpcMessageIndexReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcMessageIndexReset)
+#define ArrowIpcMessageIndexSerialize \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcMessageIndexSerialize)
+#define ArrowIpcMessageIndexDeserialize \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcMessageIndexDeserialize)
+#define ArrowIpcPushReaderInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcPushReaderInit)
+#define ArrowIpcPushReaderFeed \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcPushReaderFeed)
+#define ArrowIpcPushReaderBytesNeeded \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcPushReaderBytesNeeded)
+#define ArrowIpcPushReaderFinish \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcPushReaderFinish)
+#define ArrowIpcPushReaderReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcPushReaderReset)
+#define ArrowIpcEncoderInit NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcEncoderInit)
+#define ArrowIpcEncoderReset NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcEncoderReset)
+#define ArrowIpcEncoderEncodeSchema \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcEncoderEncodeSchema)
+#define ArrowIpcEncoderEncodeRecordBatch \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcEncoderEncodeRecordBatch)
+#define ArrowIpcEncoderEncodeDictionaryBatch \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcEncoderEncodeDictionaryBatch)
+#define ArrowIpcEncoderEncodeFooter \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcEncoderEncodeFooter)
+#define ArrowIpcEncoderFinalizeBuffer \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcEncoderFinalizeBuffer)
+#define ArrowIpcCompressionIsSupported \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcCompressionIsSupported)
+#define ArrowIpcEncoderSetCompression \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcEncoderSetCompression)
+#define ArrowIpcEncoderSetExecutor \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcEncoderSetExecutor)
+#define ArrowIpcOutputStreamInitBuffer \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcOutputStreamInitBuffer)
+#define ArrowIpcOutputStreamInitFile \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcOutputStreamInitFile)
+#define ArrowIpcOutputStreamInitFileDescriptor \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcOutputStreamInitFileDescriptor)
+#define ArrowIpcOutputStreamMove \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcOutputStreamMove)
+#define ArrowIpcWriterInit NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcWriterInit)
+#define ArrowIpcWriterReset NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcWriterReset)
+#define ArrowIpcWriterWriteSchema \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcWriterWriteSchema)
+#define ArrowIpcWriterWriteArrayView \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcWriterWriteArrayView)
+#define ArrowIpcWriterWriteArrayStream \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcWriterWriteArrayStream)
+#define ArrowIpcWriterStartFile \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcWriterStartFile)
+#define ArrowIpcWriterFinalizeFile \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcWriterFinalizeFile)
+#define ArrowIpcWriterSetCompression \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcWriterSetCompression)
+#define ArrowIpcWriterSetExecutor \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcWriterSetExecutor)
+#define ArrowIpcWriterSetPipeline \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcWriterSetPipeline)
+#define ArrowIpcWriterSetDictionaryEncode \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcWriterSetDictionaryEncode)
+#define ArrowIpcOutputStreamAddSendfileSource \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcOutputStreamAddSendfileSource)
 
 #endif
 
@@ -108,6 +252,16 @@ enum ArrowIpcCompressionType {
   NANOARROW_IPC_COMPRESSION_TYPE_ZSTD
 };
 
+/// \brief Message header verification level enumerator
+enum ArrowIpcVerificationLevel {
+  /// \brief Run full flatbuffer verification on every message header
+  NANOARROW_IPC_VERIFICATION_LEVEL_FULL,
+  /// \brief Run full flatbuffer verification on Schema message headers but only check
+  /// that the parts of RecordBatch and DictionaryBatch message headers accessed
+  /// when decoding them are within bounds
+  NANOARROW_IPC_VERIFICATION_LEVEL_TRUSTED
+};
+
 /// \brief Feature flag for a stream that uses dictionary replacement
 #define NANOARROW_IPC_FEATURE_DICTIONARY_REPLACEMENT 1
 
@@ -137,6 +291,27 @@ ArrowErrorCode ArrowIpcSharedBufferInit(struct ArrowIpcSharedBuffer* shared,
 /// ArrowArray objects that refer to it have also been released.
 void ArrowIpcSharedBufferReset(struct ArrowIpcSharedBuffer* shared);
 
+/// \brief Create a reference to a portion of a shared buffer
+///
+/// Initializes out with its own reference to the length bytes of shared starting at
+/// offset without copying them. The caller must release out with
+/// ArrowIpcSharedBufferReset(). Returns EINVAL if the range is outside shared.
+ArrowErrorCode ArrowIpcSharedBufferSlice(struct ArrowIpcSharedBuffer* shared,
+                                         int64_t offset, int64_t length,
+                                         struct ArrowIpcSharedBuffer* out);
+
+/// \brief Initialize a shared buffer from a memory-mapped file
+///
+/// Maps the entire content of file_descriptor read-only. The mapping is removed when
+/// the caller and all ArrowArray objects that refer to it have released their
+/// references, such that pages of the file are only loaded into memory when a
+/// decoded buffer is accessed. The caller may close file_descriptor after this call.
+/// Returns ENOTSUP on platforms without mmap() (e.g., Windows) or the errno set by a
+/// failed system call.
+ArrowErrorCode ArrowIpcSharedBufferInitMmap(struct ArrowIpcSharedBuffer* shared,
+                                            int file_descriptor,
+                                            struct ArrowError* error);
+
 /// \brief Check for shared buffer thread safety
 ///
 /// Thread-safe shared buffers require C11 and the stdatomic.h header.
@@ -144,6 +319,13 @@ void ArrowIpcSharedBufferReset(struct ArrowIpcSharedBuffer* shared);
 /// the resulting arrays must not be passed to other threads to be released.
 int ArrowIpcSharedBufferIsThreadSafe(void);
 
+/// \brief Check whether message bodies using a compression type can be decoded
+///
+/// Decompression is optional: ZSTD requires building with NANOARROW_IPC_WITH_ZSTD
+/// and LZ4 frame requires building with NANOARROW_IPC_WITH_LZ4. Returns non-zero
+/// if buffers compressed using codec can be decompressed by this build.
+int ArrowIpcDecompressionIsSupported(enum ArrowIpcCompressionType codec);
+
 /// \brief Decoder for Arrow IPC messages
 ///
 /// This structure is intended to be allocated by the caller,
@@ -178,6 +360,13 @@ struct ArrowIpcDecoder {
   /// \brief The number of bytes in the forthcoming body message.
   int64_t body_size_bytes;
 
+  /// \brief The dictionary id of the current DictionaryBatch message
+  int64_t dictionary_id;
+
+  /// \brief Non-zero if the current DictionaryBatch message is a delta whose values
+  /// are appended to those of the previous DictionaryBatch message with the same id
+  int dictionary_is_delta;
+
   /// \brief Private resources managed by this library
   void* private_data;
 };
@@ -208,7 +397,9 @@ ArrowErrorCode ArrowIpcDecoderPeekHeader(struct ArrowIpcDecoder* decoder,
 /// and decoder.message_type.
 ///
 /// Returns as ArrowIpcDecoderPeekHeader() and additionally will
-/// return EINVAL if flatbuffer verification fails.
+/// return EINVAL if flatbuffer verification fails. The amount of verification that
+/// is performed can be reduced for trusted input using
+/// ArrowIpcDecoderSetVerificationLevel().
 ArrowErrorCode ArrowIpcDecoderVerifyHeader(struct ArrowIpcDecoder* decoder,
                                            struct ArrowBufferView data,
                                            struct ArrowError* error);
@@ -232,6 +423,62 @@ ArrowErrorCode ArrowIpcDecoderDecodeHeader(struct ArrowIpcDecoder* decoder,
                                            struct ArrowBufferView data,
                                            struct ArrowError* error);
 
+/// \brief Verify and decode a message header carried without an encapsulation prefix
+///
+/// Arrow Flight (and other transports) carry the flatbuffer bytes of a Message (e.g.,
+/// FlightData.data_header) separately from its body (FlightData.data_body) and without
+/// the continuation and metadata size prefix of the encapsulated format. This verifies
+/// data_header as for ArrowIpcDecoderVerifyHeader() and decodes it as for
+/// ArrowIpcDecoderDecodeHeader(), setting decoder.header_size_bytes to the size of
+/// data_header. A successful call can be followed by a call to
+/// ArrowIpcDecoderDecodeSchema() or to one of the functions that decodes the body,
+/// which may be an independent buffer (e.g., an ArrowIpcSharedBuffer initialized from
+/// an ArrowBuffer whose deallocator releases a pooled transport slice, such that decoded
+/// arrays reference the slice without copying). data_header is copied if it is not
+/// 8-byte aligned; otherwise, it must remain valid until the body has been decoded.
+ArrowErrorCode ArrowIpcDecoderDecodeFlightDataHeader(struct ArrowIpcDecoder* decoder,
+                                                     struct ArrowBufferView data_header,
+                                                     struct ArrowError* error);
+
+/// \brief The row count and buffer sizes of a RecordBatch message
+///
+/// Sizes are those recorded in the message header (i.e., the compressed size of each
+/// buffer of a compressed body) and do not include the padding between buffers. The
+/// values of dictionary-encoded columns are carried by DictionaryBatch messages and
+/// are not included in the size of their column.
+struct ArrowIpcRecordBatchSizes {
+  /// \brief The number of rows in the batch
+  int64_t length;
+
+  /// \brief The number of bytes in the message body
+  int64_t body_size_bytes;
+
+  /// \brief The number of buffers in the message
+  int64_t n_buffers;
+
+  /// \brief The size of each buffer in depth-first order of the schema's fields
+  const int64_t* buffer_size_bytes;
+
+  /// \brief The number of top-level columns
+  int64_t n_columns;
+
+  /// \brief The total size of the buffers of each top-level column and its children
+  const int64_t* column_size_bytes;
+};
+
+/// \brief Decode the row count and buffer sizes of a RecordBatch message
+///
+/// After a successful call to ArrowIpcDecoderDecodeHeader() with a RecordBatch message
+/// whose schema has been set with ArrowIpcDecoderSetSchema(), populates out from the
+/// header alone such that the body never has to be read (e.g., to collect statistics
+/// for a file or stream and skip every body). The arrays pointed to by out are owned
+/// by the decoder and are valid until the next call to this function or
+/// ArrowIpcDecoderReset(). Returns EINVAL if the decoder did not just decode a
+/// RecordBatch message or NANOARROW_OK otherwise.
+ArrowErrorCode ArrowIpcDecoderDecodeRecordBatchSizes(
+    struct ArrowIpcDecoder* decoder, struct ArrowIpcRecordBatchSizes* out,
+    struct ArrowError* error);
+
 /// \brief Decode an ArrowSchema
 ///
 /// After a successful call to ArrowIpcDecoderDecodeHeader(), retrieve an ArrowSchema.
@@ -256,6 +503,21 @@ ArrowErrorCode ArrowIpcDecoderSetSchema(struct ArrowIpcDecoder* decoder,
                                         struct ArrowSchema* schema,
                                         struct ArrowError* error);
 
+/// \brief Decode only the fields selected by a projection from future record batches
+///
+/// After a successful call to ArrowIpcDecoderSetSchema() with schema, causes
+/// ArrowIpcDecoderDecodeArrayView() and ArrowIpcDecoderDecodeArray() with a field index
+/// of -1 to decode the fields of schema selected by projection as if the schema were
+/// the result of ArrowSchemaProject(). The FieldNodes and Buffers of other fields are
+/// never accessed, so their parts of the body are not copied, decompressed, validated,
+/// or (for a memory-mapped body) read from disk. Decoding a single field with a
+/// field index other than -1 is not affected. Pass a NULL projection to decode all
+/// fields again. Setting a new schema removes the projection. Returns EINVAL if schema
+/// is not the schema that was set or if projection is not compatible with it.
+ArrowErrorCode ArrowIpcDecoderSetProjection(
+    struct ArrowIpcDecoder* decoder, struct ArrowSchema* schema,
+    const struct ArrowSchemaProjection* projection, struct ArrowError* error);
+
 /// \brief Set the endianness used to decode future record batch messages
 ///
 /// Prepares the decoder for future record batch messages with the specified
@@ -267,6 +529,174 @@ ArrowErrorCode ArrowIpcDecoderSetSchema(struct ArrowIpcDecoder* decoder,
 ArrowErrorCode ArrowIpcDecoderSetEndianness(struct ArrowIpcDecoder* decoder,
                                             enum ArrowIpcEndianness endianness);
 
+/// \brief Set the verification level used by ArrowIpcDecoderVerifyHeader()
+///
+/// Full flatbuffer verification (the default) walks every table, vector, and string
+/// of a message header, including custom metadata the decoder never reads. For input
+/// produced by a trusted writer, NANOARROW_IPC_VERIFICATION_LEVEL_TRUSTED fully
+/// verifies Schema messages (which are decoded once per stream) but only checks the
+/// offsets, vtables, and field node/buffer vectors of RecordBatch and DictionaryBatch
+/// messages. These checks still guarantee that decoding the header does not access
+/// memory outside of it; field node and buffer counts are checked against the schema
+/// when the header is decoded and buffer ranges are checked against the body when it
+/// is decoded. Returns EINVAL if level is not a valid verification level.
+ArrowErrorCode ArrowIpcDecoderSetVerificationLevel(
+    struct ArrowIpcDecoder* decoder, enum ArrowIpcVerificationLevel level);
+
+/// \brief Set the executor used to decompress future record batch messages
+///
+/// When a record batch uses a compressed body or a non-system endianness, each
+/// buffer that must be decompressed and/or endian swapped is processed by a separate
+/// task submitted to executor (e.g., such that the columns of a wide batch are
+/// decompressed by a thread pool). The executor must outlive the decoder or be
+/// replaced before it is destroyed. The default (NULL) processes buffers serially on
+/// the calling thread.
+void ArrowIpcDecoderSetExecutor(struct ArrowIpcDecoder* decoder,
+                                struct ArrowExecutor* executor);
+
+/// \brief Set the allocator used for buffers the decoder must allocate
+///
+/// Decompressed buffers and buffers copied from a message body into an ArrowArray are
+/// allocated using allocator, which defaults to ArrowBufferAllocatorDefault(). Using a
+/// buffer pool (i.e., one initialized using ArrowBufferAllocatorPoolInit()) allows the
+/// memory of released batches to be reused when decoding future batches of a similar
+/// shape.
+void ArrowIpcDecoderSetAllocator(struct ArrowIpcDecoder* decoder,
+                                 struct ArrowBufferAllocator allocator);
+
+/// \brief Copy small buffers rather than sharing the body they were decoded from
+///
+/// Every buffer of an array decoded with ArrowIpcDecoderDecodeArrayFromShared()
+/// holds a reference to the whole body, so keeping one small column of a large
+/// batch alive (e.g., a projection or a key column) keeps the entire body in memory.
+/// Buffers smaller than threshold_bytes are instead copied into memory allocated by
+/// the decoder's allocator such that only larger buffers reference the body. The
+/// default of 0 shares every buffer.
+void ArrowIpcDecoderSetSharedBufferCopyThreshold(struct ArrowIpcDecoder* decoder,
+                                                 int64_t threshold_bytes);
+
+/// \brief Declare that future message bodies are in memory the CPU can't access
+///
+/// Message headers are always decoded on the CPU; however, the body of a RecordBatch
+/// message may be placed in device memory (e.g., read directly into a CUDA buffer
+/// allocated with ArrowDeviceCudaAllocateBuffer() and wrapped with
+/// ArrowIpcSharedBufferInit()). If device_body is non-zero, arrays must be decoded
+/// using ArrowIpcDecoderDecodeArrayFromShared() with a validation level of
+/// NANOARROW_VALIDATION_LEVEL_MINIMAL or lower such that every buffer of the
+/// output points into the body without being copied or read. Decoding returns
+/// ENOTSUP for compressed bodies, bodies that must be endian swapped, and
+/// DictionaryBatch messages or schemas with dictionary-encoded fields because
+/// these are processed on the CPU. The shared buffer copy threshold is ignored.
+/// The resulting ArrowArray can be wrapped with ArrowDeviceArrayInit() using the
+/// device that owns the body. The default (0) assumes CPU-accessible bodies.
+void ArrowIpcDecoderSetDeviceBody(struct ArrowIpcDecoder* decoder, int device_body);
+
+/// \brief Counters and timers describing the work done to read and decode messages
+///
+/// These values are only collected if nanoarrow_ipc was built with
+/// NANOARROW_IPC_WITH_STATS defined (e.g., using the CMake option of the same name);
+/// otherwise, no counting or timing code is compiled. Times are measured using a
+/// monotonic clock and are cumulative.
+struct ArrowIpcStats {
+  /// \brief The number of calls to ArrowIpcInputStream::read() (readers only)
+  ///
+  /// Message headers and bodies that a reader maps directly from a buffer, file, or
+  /// shared ring input without calling read() are each counted as one read.
+  int64_t n_reads;
+
+  /// \brief The number of bytes returned by ArrowIpcInputStream::read() or mapped
+  /// directly from the input (readers only)
+  int64_t n_bytes_read;
+
+  /// \brief The number of message headers successfully decoded
+  int64_t n_messages;
+
+  /// \brief The number of buffers that reference a shared body without copying
+  int64_t n_buffers_shared;
+
+  /// \brief The number of bytes referenced by buffers that share a body
+  int64_t n_bytes_shared;
+
+  /// \brief The number of buffers allocated to hold decompressed, endian swapped, or
+  /// copied values
+  int64_t n_buffers_allocated;
+
+  /// \brief The number of bytes written to allocated buffers
+  int64_t n_bytes_copied;
+
+  /// \brief Nanoseconds spent in ArrowIpcInputStream::read() (readers only)
+  int64_t read_ns;
+
+  /// \brief Nanoseconds spent verifying message headers
+  int64_t verify_ns;
+
+  /// \brief Nanoseconds spent decoding message headers
+  int64_t decode_header_ns;
+
+  /// \brief Nanoseconds spent decoding message bodies into arrays
+  int64_t decode_body_ns;
+
+  /// \brief Nanoseconds spent validating decoded arrays
+  int64_t validate_ns;
+};
+
+/// \brief Get the statistics collected by a decoder since it was initialized
+///
+/// Includes the work done decoding DictionaryBatch messages. Returns ENOTSUP if
+/// nanoarrow_ipc was built without NANOARROW_IPC_WITH_STATS.
+ArrowErrorCode ArrowIpcDecoderGetStats(struct ArrowIpcDecoder* decoder,
+                                       struct ArrowIpcStats* out);
+
+/// \brief A cache of decoded Schema messages that may be shared among decoders
+///
+/// Services that start many short streams with the same Schema message can share one
+/// cache among the decoders of all streams (see ArrowIpcDecoderSetSchemaCache()). The
+/// cache may be used from multiple threads if ArrowIpcSharedBufferIsThreadSafe()
+/// returns non-zero.
+struct ArrowIpcSchemaCache {
+  /// \brief Private resources managed by this library
+  void* private_data;
+};
+
+/// \brief Statistics describing the use of an ArrowIpcSchemaCache
+struct ArrowIpcSchemaCacheStats {
+  /// \brief The number of Schema messages currently held by the cache
+  int64_t n_entries;
+
+  /// \brief The number of Schema messages found in the cache
+  int64_t n_hits;
+
+  /// \brief The number of Schema messages that were decoded and added to the cache
+  int64_t n_misses;
+};
+
+/// \brief Initialize an ArrowIpcSchemaCache holding up to max_entries Schema messages
+///
+/// When the cache is full, the oldest entry is replaced. Returns EINVAL if max_entries
+/// is less than 1. If NANOARROW_OK is returned, the caller is responsible for calling
+/// ArrowIpcSchemaCacheReset() after all decoders using the cache have been reset.
+ArrowErrorCode ArrowIpcSchemaCacheInit(struct ArrowIpcSchemaCache* cache,
+                                       int64_t max_entries);
+
+/// \brief Release all resources held by an ArrowIpcSchemaCache
+void ArrowIpcSchemaCacheReset(struct ArrowIpcSchemaCache* cache);
+
+/// \brief Get usage statistics for an ArrowIpcSchemaCache
+void ArrowIpcSchemaCacheGetStats(struct ArrowIpcSchemaCache* cache,
+                                 struct ArrowIpcSchemaCacheStats* out);
+
+/// \brief Set the cache used to decode future Schema messages
+///
+/// Schema messages are identified by a hash and a comparison of their complete
+/// flatbuffer bytes. When ArrowIpcDecoderVerifyHeader() is passed the bytes of a
+/// cached Schema message, flatbuffer verification (which these bytes have already
+/// passed) is skipped; ArrowIpcDecoderDecodeSchema() copies the cached ArrowSchema
+/// instead of walking the message and adds messages that were not found to the cache.
+/// The cache must outlive the decoder or be replaced before it is destroyed. The
+/// default (NULL) does not cache Schema messages.
+void ArrowIpcDecoderSetSchemaCache(struct ArrowIpcDecoder* decoder,
+                                   struct ArrowIpcSchemaCache* cache);
+
 /// \brief Decode an ArrowArrayView
 ///
 /// After a successful call to ArrowIpcDecoderDecodeHeader(), deserialize the content
@@ -301,6 +731,26 @@ ArrowErrorCode ArrowIpcDecoderDecodeArray(struct ArrowIpcDecoder* decoder,
                                           enum ArrowValidationLevel validation_level,
                                           struct ArrowError* error);
 
+/// \brief Decode an ArrowArray into a recycled ArrowArray
+///
+/// Like ArrowIpcDecoderDecodeArray(), except that if out is not released and was
+/// previously decoded by ArrowIpcDecoderDecodeArray() or
+/// ArrowIpcDecoderDecodeArrayInto() for a field with the same structure, its buffers
+/// are reused (i.e., only grown if the new batch is larger) instead of allocating a new
+/// ArrowArray. Otherwise, out is released (if required) and a new ArrowArray is
+/// allocated. Repeatedly decoding batches of a similar shape into the same out
+/// therefore performs no heap allocations once its buffers are large enough except for
+/// the reference to the values of each dictionary-encoded field.
+///
+/// The caller is responsible for releasing out. If NANOARROW_OK is not returned, out
+/// is unmodified if the message could not be decoded or validated or is released
+/// otherwise.
+ArrowErrorCode ArrowIpcDecoderDecodeArrayInto(struct ArrowIpcDecoder* decoder,
+                                              struct ArrowBufferView body, int64_t i,
+                                              struct ArrowArray* out,
+                                              enum ArrowValidationLevel validation_level,
+                                              struct ArrowError* error);
+
 /// \brief Decode an ArrowArray from an owned buffer
 ///
 /// This implementation takes advantage of the fact that it can avoid copying individual
@@ -313,6 +763,190 @@ ArrowErrorCode ArrowIpcDecoderDecodeArrayFromShared(
     struct ArrowArray* out, enum ArrowValidationLevel validation_level,
     struct ArrowError* error);
 
+struct ArrowDevice;
+struct ArrowDeviceArray;
+
+/// \brief Decode an ArrowDeviceArray whose buffers are allocated by a device
+///
+/// Like ArrowIpcDecoderDecodeArray() except that the buffers of out are allocated on
+/// device (e.g., from ArrowDeviceCuda() in nanoarrow_device.h) and body, which must be
+/// CPU-accessible, is transferred to the device once: the whole body is copied using
+/// the device's buffer_init callback and every buffer of out references a section of
+/// that copy. Validation at levels above NANOARROW_VALIDATION_LEVEL_MINIMAL is
+/// performed on the CPU before the transfer. Bodies that must be decompressed or
+/// endian swapped and batches with dictionary-encoded fields are instead decoded on
+/// the CPU and their buffers copied to device with ArrowDeviceArrayViewCopyCoalesced().
+/// For a CPU device, no copy is made. The sync_event of out is set by the device's
+/// array_init callback. The caller is responsible for releasing out if NANOARROW_OK
+/// is returned.
+///
+/// Returns ENOTSUP if nanoarrow_ipc was not built with NANOARROW_IPC_WITH_DEVICE,
+/// errors as ArrowIpcDecoderDecodeArray(), or NANOARROW_OK otherwise.
+ArrowErrorCode ArrowIpcDecoderDecodeDeviceArray(
+    struct ArrowIpcDecoder* decoder, struct ArrowBufferView body, int64_t i,
+    struct ArrowDevice* device, struct ArrowDeviceArray* out,
+    enum ArrowValidationLevel validation_level, struct ArrowError* error);
+
+/// \brief Decode the values of a dictionary
+///
+/// After a successful call to ArrowIpcDecoderDecodeHeader() for a DictionaryBatch
+/// message, decode the dictionary values in body and store them in the decoder. A
+/// delta dictionary is appended to the previous values for decoder->dictionary_id;
+/// otherwise, the previous values are replaced. Values are decoded once per message
+/// and are shared with (not copied into) the dictionary of each ArrowArrayView or
+/// ArrowArray subsequently decoded from a RecordBatch message. Arrays that were
+/// already decoded keep a reference to the values they were decoded with.
+///
+/// Dictionary ids are assigned to the dictionary-encoded fields of the schema passed
+/// to ArrowIpcDecoderSetSchema() in depth-first order using the ids of the last
+/// Schema message or footer decoded by ArrowIpcDecoderDecodeSchema() or
+/// ArrowIpcDecoderDecodeFooter(). If these ids do not apply to the schema that was
+/// set (or no schema was decoded), the nth dictionary-encoded field is assigned
+/// id n.
+///
+/// Returns EINVAL if the decoder did not just decode a DictionaryBatch message or
+/// NANOARROW_OK otherwise.
+ArrowErrorCode ArrowIpcDecoderDecodeDictionary(struct ArrowIpcDecoder* decoder,
+                                               struct ArrowBufferView body,
+                                               enum ArrowValidationLevel validation_level,
+                                               struct ArrowError* error);
+
+/// \brief Decode the values of a dictionary from an owned buffer
+///
+/// Like ArrowIpcDecoderDecodeDictionary() but avoids copying buffers as
+/// ArrowIpcDecoderDecodeArrayFromShared() does.
+ArrowErrorCode ArrowIpcDecoderDecodeDictionaryFromShared(
+    struct ArrowIpcDecoder* decoder, struct ArrowIpcSharedBuffer* body,
+    enum ArrowValidationLevel validation_level, struct ArrowError* error);
+
+/// \brief The location of a message in an Arrow IPC file
+struct ArrowIpcFileBlock {
+  /// \brief The offset of the start of the message from the start of the file
+  int64_t offset;
+
+  /// \brief The size of the encapsulated message header, including the 8 byte prefix
+  /// and any padding
+  int32_t metadata_length;
+
+  /// \brief The size of the message body, which immediately follows the header
+  int64_t body_length;
+};
+
+/// \brief The content of an Arrow IPC file footer
+///
+/// Initialize using ArrowIpcFooterInit() and release using ArrowIpcFooterReset().
+struct ArrowIpcFooter {
+  /// \brief The schema of the file, which has been released if schema.release is NULL
+  struct ArrowSchema schema;
+
+  /// \brief The struct ArrowIpcFileBlock location of each RecordBatch message
+  struct ArrowBuffer record_batch_blocks;
+
+  /// \brief The struct ArrowIpcFileBlock location of each DictionaryBatch message
+  struct ArrowBuffer dictionary_blocks;
+};
+
+/// \brief Initialize the contents of an ArrowIpcFooter
+void ArrowIpcFooterInit(struct ArrowIpcFooter* footer);
+
+/// \brief Release the schema and blocks of an ArrowIpcFooter
+void ArrowIpcFooterReset(struct ArrowIpcFooter* footer);
+
+/// \brief Peek at an Arrow IPC file footer
+///
+/// An Arrow IPC file ends with a flatbuffer footer, the size of the footer as a
+/// little-endian 32-bit integer, and the magic bytes "ARROW1". Given data that ends
+/// at the end of the file, ArrowIpcDecoderPeekFooter() sets decoder.header_size_bytes
+/// to the number of bytes at the end of the file that contain the footer (including
+/// its size and the magic bytes). Returns ESPIPE if data does not contain all of
+/// these bytes (e.g., such that the caller can read a larger portion of the end of
+/// the file), EINVAL if these bytes are not valid, or NANOARROW_OK otherwise.
+ArrowErrorCode ArrowIpcDecoderPeekFooter(struct ArrowIpcDecoder* decoder,
+                                         struct ArrowBufferView data,
+                                         struct ArrowError* error);
+
+/// \brief Verify an Arrow IPC file footer
+///
+/// Runs ArrowIpcDecoderPeekFooter() and additionally runs flatbuffer verification to
+/// ensure that decoding the footer will not access memory outside of data. Returns
+/// as ArrowIpcDecoderPeekFooter() and additionally will return EINVAL if flatbuffer
+/// verification fails.
+ArrowErrorCode ArrowIpcDecoderVerifyFooter(struct ArrowIpcDecoder* decoder,
+                                           struct ArrowBufferView data,
+                                           struct ArrowError* error);
+
+/// \brief Decode an Arrow IPC file footer
+///
+/// Runs ArrowIpcDecoderPeekFooter() and decodes the schema and the record batch
+/// blocks of the footer into out, which must have been initialized with
+/// ArrowIpcFooterInit(). As for a Schema message, decoder.endianness and
+/// decoder.feature_flags are set from the schema. In almost all cases this should
+/// be preceded by a call to ArrowIpcDecoderVerifyFooter(). Returns EINVAL if the
+/// footer cannot be decoded, ENOTSUP if it uses features not supported by this
+/// library, or NANOARROW_OK otherwise.
+ArrowErrorCode ArrowIpcDecoderDecodeFooter(struct ArrowIpcDecoder* decoder,
+                                           struct ArrowBufferView data,
+                                           struct ArrowIpcFooter* out,
+                                           struct ArrowError* error);
+
+/// \brief A random-access reader of the Arrow IPC file format
+///
+/// The footer of an Arrow IPC file indexes the location of every RecordBatch message
+/// such that any batch can be decoded without reading the messages before it. This
+/// structure is intended to be allocated by the caller, initialized using
+/// ArrowIpcFileReaderInit(), and released with ArrowIpcFileReaderReset(). The footer
+/// and n_record_batches fields can be read but should not be modified by the caller.
+struct ArrowIpcFileReader {
+  /// \brief The schema and record batch locations decoded from the footer
+  struct ArrowIpcFooter footer;
+
+  /// \brief The number of record batches in the file
+  int64_t n_record_batches;
+
+  /// \brief Private resources managed by this library
+  void* private_data;
+};
+
+/// \brief Initialize an ArrowIpcFileReader
+///
+/// Checks the magic bytes at the start and end of file and decodes its footer.
+/// Batches decoded from file share its memory (as for
+/// ArrowIpcDecoderDecodeArrayFromShared()) such that the file is not copied (e.g.,
+/// when file wraps a memory-mapped region). The reader keeps its own reference to
+/// file: the caller must still ArrowIpcSharedBufferReset() file and, if NANOARROW_OK
+/// is returned, is responsible for calling ArrowIpcFileReaderReset(). Returns EINVAL
+/// if file is not a valid Arrow IPC file or ENOTSUP if it uses features not
+/// supported by this library.
+ArrowErrorCode ArrowIpcFileReaderInit(struct ArrowIpcFileReader* reader,
+                                      struct ArrowIpcSharedBuffer* file,
+                                      struct ArrowError* error);
+
+/// \brief Release an ArrowIpcFileReader
+void ArrowIpcFileReaderReset(struct ArrowIpcFileReader* reader);
+
+/// \brief Decode the record batch at index i of the footer
+///
+/// Decodes only the RecordBatch message at footer location i, whose header and body
+/// are checked against the bounds of the file. Reading batches concurrently
+/// requires one ArrowIpcFileReader per thread (each may be initialized from the
+/// same file) and ArrowIpcSharedBufferIsThreadSafe() to return non-zero. Returns
+/// EINVAL if i is out of range or the message is invalid, or NANOARROW_OK otherwise.
+ArrowErrorCode ArrowIpcFileReaderReadRecordBatch(struct ArrowIpcFileReader* reader,
+                                                 int64_t i, struct ArrowArray* out,
+                                                 struct ArrowError* error);
+
+/// \brief Decode the row count and buffer sizes of the record batch at index i
+///
+/// Decodes and checks only the header of the RecordBatch message at footer location i
+/// as for ArrowIpcDecoderDecodeRecordBatchSizes(): the body is never accessed (i.e.,
+/// its pages are never read from disk when file wraps a memory-mapped region). The
+/// arrays pointed to by out are valid until the next call to this function or
+/// ArrowIpcFileReaderReset(). Returns EINVAL if i is out of range or the message is
+/// invalid, or NANOARROW_OK otherwise.
+ArrowErrorCode ArrowIpcFileReaderReadRecordBatchSizes(
+    struct ArrowIpcFileReader* reader, int64_t i, struct ArrowIpcRecordBatchSizes* out,
+    struct ArrowError* error);
+
 /// \brief An user-extensible input data source
 struct ArrowIpcInputStream {
   /// \brief Read up to buf_size_bytes from stream into buf
@@ -339,6 +973,10 @@ void ArrowIpcInputStreamMove(struct ArrowIpcInputStream* src,
                              struct ArrowIpcInputStream* dst);
 
 /// \brief Create an input stream from an ArrowBuffer
+///
+/// The buffer is moved into a shared buffer such that an ArrowIpcArrayStreamReader
+/// created from this stream decodes record batches in place instead of copying
+/// message bodies, sharing ownership of the input when use_shared_buffers is set.
 ArrowErrorCode ArrowIpcInputStreamInitBuffer(struct ArrowIpcInputStream* stream,
                                              struct ArrowBuffer* input);
 
@@ -350,7 +988,123 @@ ArrowErrorCode ArrowIpcInputStreamInitBuffer(struct ArrowIpcInputStream* stream,
 ArrowErrorCode ArrowIpcInputStreamInitFile(struct ArrowIpcInputStream* stream,
                                            void* file_ptr, int close_on_release);
 
+/// \brief Create an input stream from a memory-mapped file
+///
+/// Maps file_descriptor as for ArrowIpcSharedBufferInitMmap(). The read() callback
+/// copies from the mapping; however, an ArrowArrayStream created from this stream
+/// with ArrowIpcArrayStreamReaderInit() decodes message headers and bodies directly
+/// from the mapping and (when using shared buffers) returns arrays that reference it
+/// without copying. Returns as ArrowIpcSharedBufferInitMmap().
+ArrowErrorCode ArrowIpcInputStreamInitMmap(struct ArrowIpcInputStream* stream,
+                                           int file_descriptor,
+                                           struct ArrowError* error);
+
+/// \brief Create an input stream that reads from a shared-memory ring
+///
+/// Maps file_descriptor, which must refer to a ring initialized by
+/// ArrowIpcOutputStreamInitSharedRing() (e.g., a descriptor from shm_open() or
+/// memfd_create() shared with or inherited from the writing process), and may be
+/// closed once this function returns. read() blocks until the writer has published
+/// enough bytes and returns fewer bytes than requested only when the writer has been
+/// released. An ArrowArrayStream created from this stream with
+/// ArrowIpcArrayStreamReaderInit() and use_shared_buffers returns arrays that reference
+/// message bodies in the ring without copying; the space of a message is reused by
+/// the writer once every array that references it has been released. Returns EINVAL if
+/// file_descriptor does not refer to a ring or ENOTSUP on platforms without POSIX
+/// shared memory and C11 atomics (e.g., Windows).
+ArrowErrorCode ArrowIpcInputStreamInitSharedRing(struct ArrowIpcInputStream* stream,
+                                                 int file_descriptor,
+                                                 struct ArrowError* error);
+
+/// \brief Create an input stream from a POSIX file descriptor
+///
+/// Reads with pread() starting from the current offset of file_descriptor (which
+/// is not advanced) and advises the kernel that the file will be read sequentially
+/// so that it can read ahead aggressively. Unlike ArrowIpcInputStreamInitFile(),
+/// reads bypass stdio buffering and are copied once into the destination. Each
+/// read() fills buf unless the end of the file is reached. Sockets are read with
+/// recv() and MSG_WAITALL such that message bodies are received directly into their
+/// (aligned, see ArrowIpcArrayStreamReaderOptions::body_alignment) destination with
+/// as few calls as possible. Other descriptors that do not support pread() (e.g.,
+/// pipes) are read with read(). If close_on_release is non-zero, file_descriptor is
+/// closed when the stream is released. Returns ENOTSUP on Windows.
+ArrowErrorCode ArrowIpcInputStreamInitFileDescriptor(struct ArrowIpcInputStream* stream,
+                                                     int file_descriptor,
+                                                     int close_on_release,
+                                                     struct ArrowError* error);
+
+/// \brief The location of one message of an Arrow IPC stream
+struct ArrowIpcMessageIndexEntry {
+  /// \brief The type of the message
+  enum ArrowIpcMessageType message_type;
+
+  /// \brief The position of the message in the stream (starting from 0 for the Schema)
+  int64_t message_index;
+
+  /// \brief The offset of the first byte of the message from the start of the stream
+  int64_t offset;
+
+  /// \brief The number of rows of a RecordBatch message or 0 otherwise
+  int64_t length;
+
+  /// \brief The dictionary id of a DictionaryBatch message or -1 otherwise
+  int64_t dictionary_id;
+
+  /// \brief Non-zero if a DictionaryBatch message is a delta
+  int dictionary_is_delta;
+};
+
+/// \brief The locations of the Schema, DictionaryBatch, and RecordBatch messages of
+/// an Arrow IPC stream
+///
+/// An index is recorded by a stream reader as it reads the stream (see
+/// ArrowIpcArrayStreamReaderOptions::message_index) and may be persisted alongside the
+/// stream (e.g., as a sidecar file) with ArrowIpcMessageIndexSerialize() such that a
+/// later reader of the same stream can start at any RecordBatch with
+/// ArrowIpcArrayStreamReaderSeek(). This structure is intended to be allocated by the
+/// caller, initialized using ArrowIpcMessageIndexInit(), and released with
+/// ArrowIpcMessageIndexReset().
+struct ArrowIpcMessageIndex {
+  /// \brief The struct ArrowIpcMessageIndexEntry of each message in stream order
+  struct ArrowBuffer entries;
+
+  /// \brief The number of entries
+  int64_t n_entries;
+
+  /// \brief The number of entries that are RecordBatch messages
+  int64_t n_record_batches;
+};
+
+/// \brief Initialize an empty ArrowIpcMessageIndex
+void ArrowIpcMessageIndexInit(struct ArrowIpcMessageIndex* index);
+
+/// \brief Release the entries of an ArrowIpcMessageIndex
+void ArrowIpcMessageIndexReset(struct ArrowIpcMessageIndex* index);
+
+/// \brief Append a serialized copy of an ArrowIpcMessageIndex to out
+///
+/// The serialized index consists of 8 magic bytes, the number of entries, and the
+/// fields of each entry, written as little-endian 64-bit integers such that it can be
+/// read on any platform with ArrowIpcMessageIndexDeserialize().
+ArrowErrorCode ArrowIpcMessageIndexSerialize(const struct ArrowIpcMessageIndex* index,
+                                             struct ArrowBuffer* out,
+                                             struct ArrowError* error);
+
+/// \brief Replace the entries of an ArrowIpcMessageIndex with a serialized index
+///
+/// Returns EINVAL if data was not written by ArrowIpcMessageIndexSerialize() or its
+/// entries are not in stream order.
+ArrowErrorCode ArrowIpcMessageIndexDeserialize(struct ArrowIpcMessageIndex* index,
+                                               struct ArrowBufferView data,
+                                               struct ArrowError* error);
+
 /// \brief Options for ArrowIpcArrayStreamReaderInit()
+///
+/// Members are added to this struct as the reader gains features, so options must be
+/// initialized with ArrowIpcArrayStreamReaderOptionsInit() before any member is set
+/// (a struct whose members are assigned individually leaves any member added later
+/// undefined). The default of each member is the value assigned to it by
+/// ArrowIpcArrayStreamReaderOptionsInit().
 struct ArrowIpcArrayStreamReaderOptions {
   /// \brief The field index to extract.
   ///
@@ -366,19 +1120,602 @@ struct ArrowIpcArrayStreamReaderOptions {
   /// a single field there is probably no advantage to using shared buffers.
   /// Defaults to the value of ArrowIpcSharedBufferIsThreadSafe().
   int use_shared_buffers;
+
+  /// \brief The full paths of the fields to extract
+  ///
+  /// If n_field_paths is greater than zero, the schema and arrays of the stream
+  /// contain only the fields selected by an ArrowSchemaProjection of these paths (e.g.,
+  /// "a" or "a.b") and the buffers of other fields are not decoded. The paths are
+  /// copied when the reader is initialized. field_index must be -1 if any paths are
+  /// specified. Defaults to NULL.
+  const struct ArrowStringView* field_paths;
+
+  /// \brief The number of paths in field_paths
+  ///
+  /// Defaults to 0 (i.e., read all fields).
+  int64_t n_field_paths;
+
+  /// \brief An executor used to decode RecordBatch messages in parallel
+  ///
+  /// If non-NULL, up to batch_readahead RecordBatch messages are read on the thread
+  /// calling get_next() and are then decoded and validated as independent tasks of
+  /// executor, each using its own decoder, before being returned in order. If
+  /// use_shared_buffers is non-zero, ArrowIpcSharedBufferIsThreadSafe() must return
+  /// a non-zero value. The executor must outlive the stream. Defaults to NULL (i.e.,
+  /// decode each message on the thread calling get_next()).
+  struct ArrowExecutor* executor;
+
+  /// \brief The maximum number of RecordBatch messages decoded together by executor
+  ///
+  /// Decoded arrays that have not yet been returned by get_next() are held by the
+  /// stream, so this bounds the memory used by the stream to approximately
+  /// batch_readahead batches. Must be at least 1. Defaults to 8.
+  int64_t batch_readahead;
+
+  /// \brief The verification level used for the message headers of the stream
+  ///
+  /// See ArrowIpcDecoderSetVerificationLevel(). Defaults to
+  /// NANOARROW_IPC_VERIFICATION_LEVEL_FULL.
+  enum ArrowIpcVerificationLevel verification_level;
+
+  /// \brief The size of the read-ahead window used to frame messages
+  ///
+  /// If greater than zero, the input stream is read in requests of (at least)
+  /// read_ahead_bytes such that the prefixes, headers, and small bodies of
+  /// consecutive messages are served from a single read. Bodies larger than the
+  /// window are read directly into their destination. Because the read()
+  /// callback of an input stream may block until the requested number of bytes is
+  /// available, this should only be used when the input is not interactive (e.g.,
+  /// a file). Values of 1-8 MB are reasonable for files. Ignored for memory-mapped
+  /// input (see ArrowIpcInputStreamInitMmap()) and shared rings (see
+  /// ArrowIpcInputStreamInitSharedRing()). Must not be negative. Defaults to 0
+  /// (i.e., issue one read per prefix, header, and body).
+  int64_t read_ahead_bytes;
+
+  /// \brief A cache used to decode the Schema message of the stream
+  ///
+  /// See ArrowIpcDecoderSetSchemaCache(). The cache must outlive the stream.
+  /// Defaults to NULL.
+  struct ArrowIpcSchemaCache* schema_cache;
+
+  /// \brief The size below which buffers are copied rather than shared
+  ///
+  /// If use_shared_buffers is non-zero, buffers smaller than this are copied such
+  /// that arrays which are kept alive do not keep the body of their whole batch in
+  /// memory (see ArrowIpcDecoderSetSharedBufferCopyThreshold()). Defaults to 0 (i.e.,
+  /// share every buffer).
+  int64_t shared_buffer_copy_threshold_bytes;
+
+  /// \brief Copy the body of each RecordBatch message to device memory
+  ///
+  /// If non-NULL, the body of each message is passed to copy_body after it has been
+  /// read, which must initialize out with a copy of body that out owns (e.g., using
+  /// ArrowDeviceBufferInit() to copy it to a CUDA device) or return an errno code.
+  /// Arrays are then decoded from out with ArrowIpcDecoderSetDeviceBody() such that
+  /// their buffers point into device memory and are validated at
+  /// NANOARROW_VALIDATION_LEVEL_MINIMAL. For memory-mapped input (see
+  /// ArrowIpcInputStreamInitMmap()), body points into the mapping such that no
+  /// intermediate copy is made on the host. Requires use_shared_buffers to be
+  /// non-zero. Defaults to NULL (i.e., decode arrays from bodies in CPU memory).
+  ArrowErrorCode (*copy_body)(void* private_data, struct ArrowBufferView body,
+                              struct ArrowBuffer* out, struct ArrowError* error);
+
+  /// \brief The private_data passed to copy_body
+  void* copy_body_private_data;
+
+  /// \brief The alignment of message bodies read into memory
+  ///
+  /// Bodies that are not decoded in place (i.e., unless the input is a buffer or
+  /// memory-mapped stream) are read into memory allocated using
+  /// ArrowBufferAllocatorAligned() with this alignment such that the buffers of
+  /// arrays decoded with use_shared_buffers start at the alignment of their offset
+  /// in the body (which is a multiple of 64 for bodies written by Arrow C++). Zero
+  /// uses ArrowBufferAllocatorDefault(). Ignored if body_allocator is non-NULL. Must
+  /// not be negative. Defaults to 64.
+  int64_t body_alignment;
+
+  /// \brief The allocator used for message bodies read into memory
+  ///
+  /// If non-NULL, a copy of this allocator is used instead of one with body_alignment
+  /// (e.g., to allocate bodies from a pool). Memory allocated with it may be freed
+  /// after the stream is released by arrays that reference it, so any state it
+  /// refers to must outlive those arrays. Defaults to NULL.
+  const struct ArrowBufferAllocator* body_allocator;
+
+  /// \brief An index to which the location of each message read is appended
+  ///
+  /// If non-NULL, an entry is appended for every Schema, DictionaryBatch, and
+  /// RecordBatch message read by the stream that follows the last entry of the index
+  /// (i.e., messages read again after ArrowIpcArrayStreamReaderSeek() are not
+  /// recorded twice). The index must outlive the stream. Defaults to NULL.
+  struct ArrowIpcMessageIndex* message_index;
+
+  /// \brief Set to a non-zero value to defer the validation of batch content
+  ///
+  /// If non-zero, arrays decoded from RecordBatch messages are validated at
+  /// NANOARROW_VALIDATION_LEVEL_MINIMAL (i.e., the sizes of their buffers are checked
+  /// but content such as offsets and union type ids is not) such that columns that are
+  /// never read are never validated. The content of a column must then be validated
+  /// before it is read, e.g., by accessing it using ArrowIpcBatchViewGetColumn().
+  /// DictionaryBatch messages are always fully validated. Defaults to 0 (i.e., fully
+  /// validate each batch before it is returned).
+  int defer_validation;
 };
 
+/// \brief Initialize ArrowIpcArrayStreamReaderOptions with default values
+///
+/// Must be called before setting any member of options.
+void ArrowIpcArrayStreamReaderOptionsInit(
+    struct ArrowIpcArrayStreamReaderOptions* options);
+
 /// \brief Initialize an ArrowArrayStream from an input stream of bytes
 ///
 /// The stream of bytes must begin with a Schema message and be followed by
 /// zero or more RecordBatch messages as described in the Arrow IPC stream
-/// format specification. Returns NANOARROW_OK on success. If NANOARROW_OK
-/// is returned, the ArrowArrayStream takes ownership of input_stream and
+/// format specification. options must be NULL (i.e., use the default of every member)
+/// or initialized with ArrowIpcArrayStreamReaderOptionsInit(). Returns NANOARROW_OK on
+/// success or EINVAL if options specify both a field_index and field_paths, an invalid
+/// executor configuration, or a copy_body without use_shared_buffers. If
+/// NANOARROW_OK is returned, the ArrowArrayStream takes ownership of input_stream and
 /// the caller is responsible for releasing out.
 ArrowErrorCode ArrowIpcArrayStreamReaderInit(
     struct ArrowArrayStream* out, struct ArrowIpcInputStream* input_stream,
     struct ArrowIpcArrayStreamReaderOptions* options);
 
+/// \brief Get the statistics collected by an ArrowArrayStream reader
+///
+/// stream must have been initialized with ArrowIpcArrayStreamReaderInit() and must
+/// not be in a call to get_schema() or get_next(). The values of all decoders used
+/// by the reader (including those of a batch_readahead executor) are summed. Returns
+/// EINVAL if stream is not an IPC reader or ENOTSUP if nanoarrow_ipc was built without
+/// NANOARROW_IPC_WITH_STATS.
+ArrowErrorCode ArrowIpcArrayStreamReaderGetStats(struct ArrowArrayStream* stream,
+                                                 struct ArrowIpcStats* out);
+
+/// \brief Position an ArrowArrayStream reader at a RecordBatch of its stream
+///
+/// stream must have been initialized with ArrowIpcArrayStreamReaderInit() from a
+/// seekable input (a buffer, a memory-mapped file, a regular file descriptor, or a
+/// seekable FILE*) positioned at the start of the same stream of bytes that index
+/// describes. The next call to get_next() returns the record batch at batch_index
+/// (counting only RecordBatch messages). The Schema message is read first if it has
+/// not yet been read (which decodes it from options->schema_cache if it was cached by
+/// a previous reader) and the DictionaryBatch messages that the batch depends on are
+/// decoded before returning. Returns EINVAL if stream is not an IPC reader or
+/// batch_index is out of range of index, ENOTSUP if the input is not seekable or the
+/// reader uses an executor, or an error code from reading the stream otherwise.
+ArrowErrorCode ArrowIpcArrayStreamReaderSeek(struct ArrowArrayStream* stream,
+                                             const struct ArrowIpcMessageIndex* index,
+                                             int64_t batch_index,
+                                             struct ArrowError* error);
+
+/// \brief A view of a record batch whose columns are validated when first accessed
+///
+/// Used to read the batches of a reader initialized with defer_validation such that
+/// only the columns that are accessed are fully validated. Initialize using
+/// ArrowIpcBatchViewInit() and release using ArrowIpcBatchViewReset().
+struct ArrowIpcBatchView {
+  /// \brief A struct view of the batch set at NANOARROW_VALIDATION_LEVEL_MINIMAL
+  ///
+  /// The content of a child must not be read unless it was returned by
+  /// ArrowIpcBatchViewGetColumn() since the batch was last set.
+  struct ArrowArrayView array_view;
+
+  /// \brief One byte per column that is non-zero if the column has been validated
+  struct ArrowBuffer validated;
+};
+
+/// \brief Initialize an ArrowIpcBatchView from the schema of a stream
+///
+/// Returns EINVAL if schema is not a struct. On success, the caller is responsible
+/// for calling ArrowIpcBatchViewReset().
+ArrowErrorCode ArrowIpcBatchViewInit(struct ArrowIpcBatchView* batch_view,
+                                     struct ArrowSchema* schema,
+                                     struct ArrowError* error);
+
+/// \brief Set the batch of an ArrowIpcBatchView
+///
+/// Sets array_view from array at NANOARROW_VALIDATION_LEVEL_MINIMAL and marks every
+/// column as not yet validated. array must remain valid while batch_view refers to it.
+ArrowErrorCode ArrowIpcBatchViewSetArray(struct ArrowIpcBatchView* batch_view,
+                                         struct ArrowArray* array,
+                                         struct ArrowError* error);
+
+/// \brief Get a view of a column of the batch of an ArrowIpcBatchView
+///
+/// Fully validates column i the first time it is accessed after the batch was set
+/// and sets out to the view of the column. If the column is invalid, the error is
+/// prefixed with the index of the column and the column is validated again when it
+/// is next accessed. Returns EINVAL if i is out of range or the column is invalid.
+ArrowErrorCode ArrowIpcBatchViewGetColumn(struct ArrowIpcBatchView* batch_view,
+                                          int64_t i, struct ArrowArrayView** out,
+                                          struct ArrowError* error);
+
+/// \brief Release the memory held by an ArrowIpcBatchView
+void ArrowIpcBatchViewReset(struct ArrowIpcBatchView* batch_view);
+
+/// \brief A push-based reader of the Arrow IPC stream format
+///
+/// Unlike the ArrowArrayStream returned by ArrowIpcArrayStreamReaderInit(), which
+/// blocks on its ArrowIpcInputStream, the push reader is fed bytes by the caller as
+/// they arrive (e.g., from a network callback) and delivers the schema and decoded
+/// arrays to an ArrowAsyncArrayStreamHandler. RecordBatch messages are decoded only
+/// when requested via ArrowAsyncProducer::request(); complete messages that have not
+/// yet been requested remain buffered.
+struct ArrowIpcPushReader {
+  /// \brief Private resources managed by this library
+  void* private_data;
+};
+
+/// \brief Initialize an ArrowIpcPushReader
+///
+/// options are interpreted as for ArrowIpcArrayStreamReaderInit() (except that
+/// executor and read_ahead_bytes are ignored) and may be NULL. Returns EINVAL if
+/// options specify copy_body.
+/// If NANOARROW_OK is returned, the reader takes ownership of handler and the caller
+/// is responsible for calling ArrowIpcPushReaderReset().
+ArrowErrorCode ArrowIpcPushReaderInit(struct ArrowIpcPushReader* reader,
+                                      struct ArrowAsyncArrayStreamHandler* handler,
+                                      struct ArrowIpcArrayStreamReaderOptions* options);
+
+/// \brief Append bytes to the input of an ArrowIpcPushReader
+///
+/// Decodes as many complete messages as possible: the Schema message is always
+/// decoded and delivered to on_schema(); RecordBatch messages are decoded and
+/// delivered to on_next() while requests are outstanding. data may be of any size and
+/// need not be valid after this call returns. If no input is buffered, complete
+/// messages are decoded directly from data and only its remaining bytes are copied
+/// into the reader's input buffer; otherwise, data is appended to the buffered input.
+/// Returns NANOARROW_OK unless the stream ended with an error (which has also been
+/// delivered to on_error()) or was cancelled (ECANCELED). Input that follows the
+/// end-of-stream indicator is ignored.
+ArrowErrorCode ArrowIpcPushReaderFeed(struct ArrowIpcPushReader* reader,
+                                      struct ArrowBufferView data);
+
+/// \brief Return the number of bytes required to complete the next message
+///
+/// Returns the number of bytes that must be fed before the message at the start of
+/// the buffered input can be decoded, as far as is known from the bytes buffered so
+/// far (i.e., the 8-byte prefix, then the header, then the body). Feeding fewer bytes
+/// only appends them to the buffered input. Returns 0 if a complete message is
+/// waiting for a request or if the reader has finished.
+int64_t ArrowIpcPushReaderBytesNeeded(struct ArrowIpcPushReader* reader);
+
+/// \brief Signal the end of input to an ArrowIpcPushReader
+///
+/// If all previously fed input was consumed, the end of the stream is delivered to
+/// on_next() when requested, even if no end-of-stream indicator was present. A
+/// partial message in the remaining input is reported to on_error() as EINVAL.
+/// Returns as ArrowIpcPushReaderFeed().
+ArrowErrorCode ArrowIpcPushReaderFinish(struct ArrowIpcPushReader* reader);
+
+/// \brief Release an ArrowIpcPushReader
+///
+/// If the handler has not yet been released, on_error() is called with ECANCELED
+/// before releasing it.
+void ArrowIpcPushReaderReset(struct ArrowIpcPushReader* reader);
+
+/// \brief Encoder for Arrow IPC messages
+///
+/// This structure is intended to be allocated by the caller,
+/// initialized using ArrowIpcEncoderInit(), and released with
+/// ArrowIpcEncoderReset(). These fields should not be modified
+/// by the caller but can be read following a call to
+/// ArrowIpcEncoderEncodeSchema() or ArrowIpcEncoderEncodeRecordBatch().
+struct ArrowIpcEncoder {
+  /// \brief The buffers that make up the body of the last encoded message
+  ///
+  /// Writing these n_body_buffers views in order produces the message body,
+  /// including the padding that follows each buffer. The views refer to the memory
+  /// of the encoded ArrowArrayView (or to static padding bytes or compressed buffers
+  /// owned by the encoder) and are valid until the next call to an ArrowIpcEncoder
+  /// function.
+  const struct ArrowBufferView* body_buffers;
+
+  /// \brief The number of views in body_buffers
+  int64_t n_body_buffers;
+
+  /// \brief The number of bytes in the body of the last encoded message
+  int64_t body_size_bytes;
+
+  /// \brief Private resources managed by this library
+  void* private_data;
+};
+
+/// \brief Initialize an encoder
+ArrowErrorCode ArrowIpcEncoderInit(struct ArrowIpcEncoder* encoder);
+
+/// \brief Release all resources attached to an encoder
+void ArrowIpcEncoderReset(struct ArrowIpcEncoder* encoder);
+
+/// \brief Check whether message bodies can be compressed using a compression type
+///
+/// Like decompression, compression requires building with NANOARROW_IPC_WITH_ZSTD
+/// or NANOARROW_IPC_WITH_LZ4. Returns non-zero if codec can be used by this build.
+int ArrowIpcCompressionIsSupported(enum ArrowIpcCompressionType codec);
+
+/// \brief Set the compression used for the bodies of future messages
+///
+/// Record batch and dictionary batch messages encoded after this call have each
+/// non-empty buffer compressed separately (i.e., using the BUFFER method of the
+/// BodyCompression). A buffer that compression does not make smaller is written
+/// uncompressed with an uncompressed length of -1 such that incompressible data
+/// is not inflated and is not copied. Returns ENOTSUP if codec is not supported by
+/// this build.
+ArrowErrorCode ArrowIpcEncoderSetCompression(struct ArrowIpcEncoder* encoder,
+                                             enum ArrowIpcCompressionType codec);
+
+/// \brief Set the executor used to compress future message bodies
+///
+/// Each non-empty buffer is compressed by a separate task submitted to executor. The
+/// executor must outlive the encoder or be replaced before it is destroyed. The
+/// default (NULL) compresses buffers serially on the calling thread.
+void ArrowIpcEncoderSetExecutor(struct ArrowIpcEncoder* encoder,
+                                struct ArrowExecutor* executor);
+
+/// \brief Encode a Schema message
+///
+/// Builds the flatbuffer for a Schema message describing the children of schema
+/// (which must be a struct) using the system endianness. The message can then be
+/// retrieved with ArrowIpcEncoderFinalizeBuffer(). Returns EINVAL if schema is not a
+/// valid struct or ENOTSUP if schema uses features not supported by this library
+/// (e.g., dictionary-encoded dictionary values). Dictionary-encoded fields are
+/// assigned dictionary ids 0, 1, 2, ... in depth-first order.
+ArrowErrorCode ArrowIpcEncoderEncodeSchema(struct ArrowIpcEncoder* encoder,
+                                           struct ArrowSchema* schema,
+                                           struct ArrowError* error);
+
+/// \brief Encode a RecordBatch message
+///
+/// Builds the flatbuffer for a RecordBatch message from the children of
+/// array_view (which must be a struct) and records views of its buffers in
+/// encoder->body_buffers without copying them. Unknown null counts of array_view and
+/// its children are computed and cached. The message header can then be retrieved
+/// with ArrowIpcEncoderFinalizeBuffer(). Returns EINVAL if array_view is not a
+/// struct or any of its buffer views has a negative size, or ENOTSUP if array_view or
+/// any of its children have a non-zero offset or a type not supported by this library.
+ArrowErrorCode ArrowIpcEncoderEncodeRecordBatch(struct ArrowIpcEncoder* encoder,
+                                                struct ArrowArrayView* array_view,
+                                                struct ArrowError* error);
+
+/// \brief Encode a DictionaryBatch message
+///
+/// Builds the flatbuffer for a DictionaryBatch message containing values as the
+/// dictionary with the given id and records views of its buffers in
+/// encoder->body_buffers without copying them. If is_delta is non-zero, a reader
+/// appends values to the previous dictionary with this id instead of replacing it.
+/// The indices of dictionary-encoded arrays are encoded separately using
+/// ArrowIpcEncoderEncodeRecordBatch(). Returns as ArrowIpcEncoderEncodeRecordBatch().
+ArrowErrorCode ArrowIpcEncoderEncodeDictionaryBatch(struct ArrowIpcEncoder* encoder,
+                                                    int64_t id, int is_delta,
+                                                    struct ArrowArrayView* values,
+                                                    struct ArrowError* error);
+
+/// \brief Encode an Arrow IPC file footer
+///
+/// Builds the flatbuffer for a footer describing footer->schema (which must be a
+/// struct), footer->dictionary_blocks, and footer->record_batch_blocks. The footer
+/// can then be retrieved with ArrowIpcEncoderFinalizeBuffer(). Returns as
+/// ArrowIpcEncoderEncodeSchema().
+ArrowErrorCode ArrowIpcEncoderEncodeFooter(struct ArrowIpcEncoder* encoder,
+                                           struct ArrowIpcFooter* footer,
+                                           struct ArrowError* error);
+
+/// \brief Append the last encoded message header to a buffer
+///
+/// Appends the encapsulated message header (i.e., the continuation bytes,
+/// the little-endian 32-bit header size, the flatbuffer message, and the padding
+/// required to make its size a multiple of 8 bytes) to out. This is followed in
+/// the stream by the encoder->body_size_bytes bytes of encoder->body_buffers. If a
+/// footer was last encoded, the flatbuffer is instead followed by its size as a
+/// little-endian 32-bit integer and the magic bytes "ARROW1", such that the result
+/// is the end of an Arrow IPC file.
+ArrowErrorCode ArrowIpcEncoderFinalizeBuffer(struct ArrowIpcEncoder* encoder,
+                                             struct ArrowBuffer* out);
+
+/// \brief An user-extensible output data sink
+struct ArrowIpcOutputStream {
+  /// \brief Write the contents of n_buffers buffers to stream
+  ///
+  /// Implementations must write all bytes of every buffer in order (e.g., using a
+  /// gathered write) or return an error. Returns NANOARROW_OK on success.
+  ArrowErrorCode (*write)(struct ArrowIpcOutputStream* stream,
+                          const struct ArrowBufferView* buffers, int64_t n_buffers,
+                          struct ArrowError* error);
+
+  /// \brief Release the stream and any resources it may be holding
+  ///
+  /// Release callback implementations must set the release member to NULL.
+  /// Callers must check that the release callback is not NULL before calling
+  /// write() or release().
+  void (*release)(struct ArrowIpcOutputStream* stream);
+
+  /// \brief Private implementation-defined data
+  void* private_data;
+};
+
+/// \brief Transfer ownership of an ArrowIpcOutputStream
+void ArrowIpcOutputStreamMove(struct ArrowIpcOutputStream* src,
+                              struct ArrowIpcOutputStream* dst);
+
+/// \brief Create an output stream that appends to an ArrowBuffer
+///
+/// The stream does not take ownership of output, which must remain valid until the
+/// stream is released.
+ArrowErrorCode ArrowIpcOutputStreamInitBuffer(struct ArrowIpcOutputStream* stream,
+                                              struct ArrowBuffer* output);
+
+/// \brief Create an output stream from a C FILE* pointer
+///
+/// As for ArrowIpcInputStreamInitFile(), the stream has no mechanism to
+/// communicate an error if file_ptr fails to close.
+ArrowErrorCode ArrowIpcOutputStreamInitFile(struct ArrowIpcOutputStream* stream,
+                                            void* file_ptr, int close_on_release);
+
+/// \brief Create an output stream from a POSIX file descriptor
+///
+/// Buffers are written with writev() such that message bodies are never copied
+/// into a contiguous staging buffer. Sockets are written with sendmsg(), which
+/// gathers buffers in the same way but returns EPIPE if the connection was closed
+/// by the peer instead of raising SIGPIPE. Returns ENOTSUP on platforms without
+/// writev() (e.g., Windows).
+ArrowErrorCode ArrowIpcOutputStreamInitFileDescriptor(
+    struct ArrowIpcOutputStream* stream, int file_descriptor, int close_on_release);
+
+/// \brief Send buffers that refer to a memory-mapped file with sendfile()
+///
+/// data must point to size_bytes of a mapping of file_descriptor starting at offset
+/// 0 (e.g., the mapping of an IPC file whose batches were decoded with
+/// ArrowIpcInputStreamInitMmap() and shared buffers), and both must remain valid
+/// until stream is released. Large buffers passed to write() that lie entirely
+/// within this region are then sent from file_descriptor with sendfile() such that
+/// the kernel transfers the pages of the file to the output without copying them
+/// from user space (e.g., when relaying a file to a socket); other buffers are
+/// still gathered with writev() or sendmsg(). stream must have been created with
+/// ArrowIpcOutputStreamInitFileDescriptor(). Returns EINVAL if it was not or ENOTSUP
+/// on platforms without sendfile() (i.e., other than Linux).
+ArrowErrorCode ArrowIpcOutputStreamAddSendfileSource(struct ArrowIpcOutputStream* stream,
+                                                     int file_descriptor,
+                                                     const void* data,
+                                                     int64_t size_bytes,
+                                                     struct ArrowError* error);
+
+/// \brief Create an output stream that writes to a shared-memory ring
+///
+/// Resizes the file referred to by file_descriptor (which may be closed once this
+/// function returns) to hold a ring of capacity_bytes (rounded up to a multiple of 64)
+/// that can be read by another process using ArrowIpcInputStreamInitSharedRing().
+/// Each write() copies its buffers once into a contiguous, 64-byte aligned region of
+/// the ring, blocking until the reader has released enough space, and returns EINVAL
+/// if they can never fit or EPIPE if the input stream has been released. Releasing
+/// the stream marks the end of the ring's input. Returns ENOTSUP on platforms without
+/// POSIX shared memory and C11 atomics (e.g., Windows).
+ArrowErrorCode ArrowIpcOutputStreamInitSharedRing(struct ArrowIpcOutputStream* stream,
+                                                  int file_descriptor,
+                                                  int64_t capacity_bytes,
+                                                  struct ArrowError* error);
+
+/// \brief A writer of the Arrow IPC stream format
+///
+/// This structure is intended to be allocated by the caller, initialized using
+/// ArrowIpcWriterInit(), and released with ArrowIpcWriterReset().
+struct ArrowIpcWriter {
+  /// \brief Private resources managed by this library
+  void* private_data;
+};
+
+/// \brief Initialize an ArrowIpcWriter
+///
+/// If NANOARROW_OK is returned, the writer takes ownership of output_stream and
+/// the caller is responsible for calling ArrowIpcWriterReset().
+ArrowErrorCode ArrowIpcWriterInit(struct ArrowIpcWriter* writer,
+                                  struct ArrowIpcOutputStream* output_stream);
+
+/// \brief Release an ArrowIpcWriter and its output stream
+void ArrowIpcWriterReset(struct ArrowIpcWriter* writer);
+
+/// \brief Set the compression used for the bodies of future messages
+///
+/// Returns as ArrowIpcEncoderSetCompression().
+ArrowErrorCode ArrowIpcWriterSetCompression(struct ArrowIpcWriter* writer,
+                                            enum ArrowIpcCompressionType codec);
+
+/// \brief Set the executor used to compress future message bodies
+///
+/// See ArrowIpcEncoderSetExecutor().
+void ArrowIpcWriterSetExecutor(struct ArrowIpcWriter* writer,
+                               struct ArrowExecutor* executor);
+
+/// \brief Set the executor used to pipeline ArrowIpcWriterWriteArrayStream()
+///
+/// If executor is non-NULL, ArrowIpcWriterWriteArrayStream() reads up to n_batches
+/// arrays at a time on the calling thread and passes them to a single call to the
+/// executor, in which each array is encoded (and compressed) by its own task using its
+/// own encoder while one more task writes the arrays encoded by the previous call in
+/// order. At most 2 * n_batches arrays of the input stream are held at once, such that
+/// the input stream is not read faster than the output stream can be written. The
+/// executor set by ArrowIpcWriterSetExecutor() is not used for these arrays, and
+/// streams with dictionary-encoded columns are always written one array at a time.
+/// The executor must outlive the writer or be replaced before it is destroyed.
+/// Returns EINVAL if executor is non-NULL and n_batches is less than 1.
+ArrowErrorCode ArrowIpcWriterSetPipeline(struct ArrowIpcWriter* writer,
+                                         struct ArrowExecutor* executor,
+                                         int64_t n_batches);
+
+/// \brief Dictionary-encode columns of the batches written for later schemas
+///
+/// Selects the top-level string, large string, binary, or large binary columns at
+/// column_indices of the schemas passed to later calls to ArrowIpcWriterWriteSchema()
+/// to be dictionary-encoded by the writer: the Schema message describes them as
+/// dictionary-encoded with int32 indices and ArrowIpcWriterWriteArrayView() accepts
+/// batches of the schema as given (i.e., of dense values) and replaces these columns
+/// by their indices. Each value is assigned an index in order of first appearance
+/// using an ArrowGrouper whose keys persist across the batches of a schema. Only the
+/// values that are new to a batch are written before it, as a delta DictionaryBatch
+/// message (after a first DictionaryBatch message that is not a delta), and no
+/// DictionaryBatch message is written for a batch without new values. Nulls are
+/// written as null indices rather than dictionary values. Streams with encoded
+/// columns are never pipelined (see ArrowIpcWriterSetPipeline()). Pass n_columns of 0
+/// to stop encoding columns of later schemas. Returns EINVAL if n_columns or an index
+/// is negative.
+ArrowErrorCode ArrowIpcWriterSetDictionaryEncode(struct ArrowIpcWriter* writer,
+                                                const int64_t* column_indices,
+                                                int64_t n_columns);
+
+/// \brief Write a Schema message
+///
+/// Returns as ArrowIpcEncoderEncodeSchema() or any error returned by the output
+/// stream (or EINVAL if a column selected with ArrowIpcWriterSetDictionaryEncode() is
+/// out of range or is not a string or binary column).
+ArrowErrorCode ArrowIpcWriterWriteSchema(struct ArrowIpcWriter* writer,
+                                         struct ArrowSchema* schema,
+                                         struct ArrowError* error);
+
+/// \brief Write a RecordBatch message
+///
+/// Writes the message header and the buffers of in with a single call to the output
+/// stream's write(). If in is NULL, the end-of-stream indicator is written instead.
+/// The message is preceded by a DictionaryBatch message for each dictionary-encoded
+/// column whose values do not have the same contents as those written for the
+/// previous batch (or, for columns encoded by the writer, whose values are new). The
+/// writer keeps a copy of the last DictionaryBatch message for each dictionary to
+/// compare against.
+/// Returns as ArrowIpcEncoderEncodeRecordBatch() or any error returned by the output
+/// stream (or EINVAL if a dictionary would be replaced in the file format or a column
+/// encoded by the writer does not have the type of its schema, EOVERFLOW if it would
+/// have more than INT32_MAX distinct values).
+ArrowErrorCode ArrowIpcWriterWriteArrayView(struct ArrowIpcWriter* writer,
+                                            struct ArrowArrayView* in,
+                                            struct ArrowError* error);
+
+/// \brief Write an ArrowArrayStream
+///
+/// Writes the schema of in, a RecordBatch message for each of its arrays, and the
+/// end-of-stream indicator. The caller retains ownership of in. If an executor was
+/// set with ArrowIpcWriterSetPipeline(), arrays are encoded in parallel and written as
+/// described there; in either case, in is only read from the calling thread and an
+/// error reading in is returned after the arrays read before it have been written.
+ArrowErrorCode ArrowIpcWriterWriteArrayStream(struct ArrowIpcWriter* writer,
+                                              struct ArrowArrayStream* in,
+                                              struct ArrowError* error);
+
+/// \brief Start writing the Arrow IPC file format
+///
+/// Writes the magic bytes that begin an Arrow IPC file. After this call, the schema
+/// and the location of each RecordBatch message written are recorded such that
+/// ArrowIpcWriterFinalizeFile() can write the footer. Returns EINVAL if any message
+/// has already been written.
+ArrowErrorCode ArrowIpcWriterStartFile(struct ArrowIpcWriter* writer,
+                                       struct ArrowError* error);
+
+/// \brief Finish writing the Arrow IPC file format
+///
+/// Writes the end-of-stream indicator (if it has not already been written) followed
+/// by the footer. Returns EINVAL if ArrowIpcWriterStartFile() was not called or no
+/// schema has been written.
+ArrowErrorCode ArrowIpcWriterFinalizeFile(struct ArrowIpcWriter* writer,
+                                          struct ArrowError* error);
+
 /// @}
 
 #ifdef __cplusplus
@@ -54,11 +54,78 @@ static inline void release_pointer(struct ArrowIpcInputStream* data) {
   }
 }
 
+static inline void init_pointer(struct ArrowIpcEncoder* data) {
+  data->private_data = nullptr;
+}
+
+static inline void move_pointer(struct ArrowIpcEncoder* src,
+                                struct ArrowIpcEncoder* dst) {
+  memcpy(dst, src, sizeof(struct ArrowIpcEncoder));
+  src->private_data = nullptr;
+}
+
+static inline void release_pointer(struct ArrowIpcEncoder* data) {
+  ArrowIpcEncoderReset(data);
+}
+
+static inline void init_pointer(struct ArrowIpcOutputStream* data) {
+  data->release = nullptr;
+}
+
+static inline void move_pointer(struct ArrowIpcOutputStream* src,
+                                struct ArrowIpcOutputStream* dst) {
+  memcpy(dst, src, sizeof(struct ArrowIpcOutputStream));
+  src->release = nullptr;
+}
+
+static inline void release_pointer(struct ArrowIpcOutputStream* data) {
+  if (data->release != nullptr) {
+    data->release(data);
+  }
+}
+
+static inline void init_pointer(struct ArrowIpcWriter* data) {
+  data->private_data = nullptr;
+}
+
+static inline void move_pointer(struct ArrowIpcWriter* src, struct ArrowIpcWriter* dst) {
+  memcpy(dst, src, sizeof(struct ArrowIpcWriter));
+  src->private_data = nullptr;
+}
+
+static inline void release_pointer(struct ArrowIpcWriter* data) {
+  ArrowIpcWriterReset(data);
+}
+
+static inline void init_pointer(struct ArrowIpcFileReader* data) {
+  ArrowIpcFooterInit(&data->footer);
+  data->n_record_batches = 0;
+  data->private_data = nullptr;
+}
+
+static inline void move_pointer(struct ArrowIpcFileReader* src,
+                                struct ArrowIpcFileReader* dst) {
+  memcpy(dst, src, sizeof(struct ArrowIpcFileReader));
+  init_pointer(src);
+}
+
+static inline void release_pointer(struct ArrowIpcFileReader* data) {
+  ArrowIpcFileReaderReset(data);
+}
+
 }  // namespace internal
 }  // namespace nanoarrow
 
 #include "nanoarrow.hpp"
 
+// Awaitable reads are available when compiling with C++20 coroutine support
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#include <coroutine>
+#define NANOARROW_IPC_HPP_HAVE_COROUTINES 1
+#endif
+#endif
+
 namespace nanoarrow {
 
 namespace ipc {
@@ -76,6 +143,301 @@ using UniqueDecoder = internal::Unique<struct ArrowIpcDecoder>;
 /// \brief Class wrapping a unique struct ArrowIpcInputStream
 using UniqueInputStream = internal::Unique<struct ArrowIpcInputStream>;
 
+/// \brief Class wrapping a unique struct ArrowIpcEncoder
+using UniqueEncoder = internal::Unique<struct ArrowIpcEncoder>;
+
+/// \brief Class wrapping a unique struct ArrowIpcOutputStream
+using UniqueOutputStream = internal::Unique<struct ArrowIpcOutputStream>;
+
+/// \brief Class wrapping a unique struct ArrowIpcWriter
+using UniqueWriter = internal::Unique<struct ArrowIpcWriter>;
+
+/// \brief Class wrapping a unique struct ArrowIpcFileReader
+using UniqueFileReader = internal::Unique<struct ArrowIpcFileReader>;
+
+/// @}
+
+/// \defgroup nanoarrow_ipc_hpp-reader Batch reader
+///
+/// A reader of the Arrow IPC stream format that decodes each RecordBatch into the
+/// same ArrowArray.
+///
+/// @{
+
+/// \brief Read the record batches of an IPC stream with one decoder and one array
+///
+/// Unlike the ArrowArrayStream returned by ArrowIpcArrayStreamReaderInit(), which
+/// returns a new ArrowArray for every batch, this reader decodes every batch with
+/// ArrowIpcDecoderDecodeArrayInto() into an array that it owns and reads every
+/// message into the same header and body buffers. Once those are large enough,
+/// reading a stream of similarly-shaped batches performs no heap allocations (except
+/// for the reference to the values of each dictionary-encoded field). Each batch is
+/// valid until the next read; callers that need to keep one can ArrowArrayMove() it
+/// out of the pointer returned by Next(), in which case the next batch is decoded
+/// into a new array.
+class BatchReader {
+ public:
+  /// \brief Construct a reader of input, which must begin with a Schema message
+  explicit BatchReader(UniqueInputStream input) : input_(std::move(input)) {}
+
+  /// \brief Read and decode the Schema message if it has not yet been read
+  ArrowErrorCode ReadSchema(struct ArrowError* error) {
+    if (schema_->release != nullptr) {
+      return NANOARROW_OK;
+    }
+
+    if (decoder_->private_data == nullptr) {
+      NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowIpcDecoderInit(decoder_.get()), error);
+    }
+
+    ArrowErrorCode result = ReadMessage(error);
+    if (result == ENODATA) {
+      ArrowErrorSet(error, "No data available on stream");
+      return EINVAL;
+    }
+    NANOARROW_RETURN_NOT_OK(result);
+
+    if (decoder_->message_type != NANOARROW_IPC_MESSAGE_TYPE_SCHEMA) {
+      ArrowErrorSet(error, "Unexpected message type at start of input (expected Schema)");
+      return EINVAL;
+    }
+
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+        ArrowIpcDecoderSetEndianness(decoder_.get(), decoder_->endianness), error);
+    UniqueSchema schema;
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeSchema(decoder_.get(), schema.get(),
+                                                        error));
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderSetSchema(decoder_.get(), schema.get(),
+                                                     error));
+    schema_.reset(schema.get());
+    return NANOARROW_OK;
+  }
+
+  /// \brief The schema of the stream, or a released schema if it has not been read
+  struct ArrowSchema* schema() { return schema_.get(); }
+
+  /// \brief Decode the next record batch
+  ///
+  /// Reads the schema if required and any DictionaryBatch messages that precede the
+  /// next RecordBatch. On success, out points to the decoded batch, which is owned by
+  /// this reader, or is nullptr at the end of the stream.
+  ArrowErrorCode Next(struct ArrowArray** out, struct ArrowError* error) {
+    *out = nullptr;
+    NANOARROW_RETURN_NOT_OK(ReadSchema(error));
+
+    while (true) {
+      ArrowErrorCode result = ReadMessage(error);
+      if (result == ENODATA) {
+        return NANOARROW_OK;
+      }
+      NANOARROW_RETURN_NOT_OK(result);
+
+      if (decoder_->message_type == NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH) {
+        NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeDictionary(
+            decoder_.get(), body_view(), NANOARROW_VALIDATION_LEVEL_FULL, error));
+      } else if (decoder_->message_type == NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH) {
+        break;
+      } else {
+        ArrowErrorSet(error, "Unexpected message type (expected RecordBatch)");
+        return EINVAL;
+      }
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeArrayInto(
+        decoder_.get(), body_view(), -1, array_.get(), NANOARROW_VALIDATION_LEVEL_FULL,
+        error));
+    *out = array_.get();
+    return NANOARROW_OK;
+  }
+
+  /// \brief An input range over the remaining batches of the stream
+  ///
+  /// Incrementing an iterator decodes the next batch as for Next(), invalidating the
+  /// batch pointed to by the previous iterator. Iteration ends at the end of the
+  /// stream or at the first error, after which status() returns the error code and
+  /// error contains its message.
+  class BatchRange {
+   public:
+    class iterator {
+     public:
+      using iterator_category = std::input_iterator_tag;
+      using value_type = struct ArrowArray*;
+      using difference_type = int64_t;
+      using pointer = void;
+      using reference = struct ArrowArray*;
+
+      iterator() : range_(nullptr), batch_(nullptr) {}
+      explicit iterator(BatchRange* range) : range_(range), batch_(nullptr) {
+        ++(*this);
+      }
+
+      struct ArrowArray* operator*() const { return batch_; }
+
+      iterator& operator++() {
+        range_->status_ = range_->reader_->Next(&batch_, range_->error_);
+        if (range_->status_ != NANOARROW_OK) {
+          batch_ = nullptr;
+        }
+        return *this;
+      }
+
+      bool operator==(const iterator& rhs) const { return batch_ == rhs.batch_; }
+      bool operator!=(const iterator& rhs) const { return batch_ != rhs.batch_; }
+
+     private:
+      BatchRange* range_;
+      struct ArrowArray* batch_;
+    };
+
+    BatchRange(BatchReader* reader, struct ArrowError* error)
+        : reader_(reader), error_(error), status_(NANOARROW_OK) {}
+
+    iterator begin() { return iterator(this); }
+    iterator end() { return iterator(); }
+
+    /// \brief NANOARROW_OK unless iteration stopped because of an error
+    ArrowErrorCode status() const { return status_; }
+
+   private:
+    BatchReader* reader_;
+    struct ArrowError* error_;
+    ArrowErrorCode status_;
+  };
+
+  /// \brief Iterate over the remaining batches of the stream
+  BatchRange Batches(struct ArrowError* error) { return BatchRange(this, error); }
+
+#if defined(NANOARROW_IPC_HPP_HAVE_COROUTINES)
+  /// \brief An awaitable that decodes the next record batch on an executor
+  ///
+  /// Awaiting suspends the calling coroutine and passes a callable with no arguments
+  /// to schedule (e.g., a lambda that calls asio::post() with a thread pool's
+  /// executor). That callable calls Next() and resumes the coroutine on the thread
+  /// that invoked it, such that the thread awaiting the batch is never blocked on
+  /// input. The result of co_await is the ArrowErrorCode returned by Next().
+  template <typename Schedule>
+  class NextAwaitable {
+   public:
+    NextAwaitable(BatchReader* reader, Schedule schedule, struct ArrowArray** out,
+                  struct ArrowError* error)
+        : reader_(reader),
+          schedule_(std::move(schedule)),
+          out_(out),
+          error_(error),
+          result_(NANOARROW_OK) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+      // The coroutine (and this awaitable) may be resumed and destroyed before
+      // schedule returns, so schedule must not be a member when it is called
+      Schedule schedule = std::move(schedule_);
+      schedule([this, handle]() {
+        result_ = reader_->Next(out_, error_);
+        handle.resume();
+      });
+    }
+
+    ArrowErrorCode await_resume() const noexcept { return result_; }
+
+   private:
+    BatchReader* reader_;
+    Schedule schedule_;
+    struct ArrowArray** out_;
+    struct ArrowError* error_;
+    ArrowErrorCode result_;
+  };
+
+  /// \brief Decode the next record batch on the executor invoked by schedule
+  ///
+  /// See NextAwaitable. The reader, out, and error must remain valid until the
+  /// awaiting coroutine is resumed and only one read may be pending at a time.
+  template <typename Schedule>
+  NextAwaitable<Schedule> NextAsync(Schedule schedule, struct ArrowArray** out,
+                                    struct ArrowError* error) {
+    return NextAwaitable<Schedule>(this, std::move(schedule), out, error);
+  }
+#endif
+
+ private:
+  UniqueInputStream input_;
+  UniqueDecoder decoder_;
+  UniqueSchema schema_;
+  UniqueArray array_;
+  UniqueBuffer header_;
+  UniqueBuffer body_;
+
+  struct ArrowBufferView body_view() {
+    struct ArrowBufferView view;
+    view.data.data = body_->data;
+    view.size_bytes = body_->size_bytes;
+    return view;
+  }
+
+  // Replaces the bytes of buffer after its first offset bytes with up to size_bytes
+  // read from the input
+  ArrowErrorCode ReadInto(struct ArrowBuffer* buffer, int64_t offset,
+                          int64_t size_bytes, int64_t* bytes_read,
+                          struct ArrowError* error) {
+    buffer->size_bytes = offset;
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowBufferReserve(buffer, size_bytes), error);
+    *bytes_read = 0;
+    if (size_bytes > 0) {
+      NANOARROW_RETURN_NOT_OK(input_->read(input_.get(), buffer->data + offset,
+                                           size_bytes, bytes_read, error));
+    }
+    buffer->size_bytes += *bytes_read;
+    return NANOARROW_OK;
+  }
+
+  // Reads and decodes the header of the next message and reads its body, returning
+  // ENODATA at the end of the stream
+  ArrowErrorCode ReadMessage(struct ArrowError* error) {
+    int64_t bytes_read = 0;
+    NANOARROW_RETURN_NOT_OK(ReadInto(header_.get(), 0, 8, &bytes_read, error));
+    if (bytes_read == 0) {
+      return ENODATA;
+    } else if (bytes_read != 8) {
+      ArrowErrorSet(error, "Expected at least 8 bytes in remainder of stream");
+      return EINVAL;
+    }
+
+    struct ArrowBufferView header_view;
+    header_view.data.data = header_->data;
+    header_view.size_bytes = 8;
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderPeekHeader(decoder_.get(), header_view,
+                                                      error));
+
+    int64_t expected_bytes = decoder_->header_size_bytes - 8;
+    NANOARROW_RETURN_NOT_OK(
+        ReadInto(header_.get(), 8, expected_bytes, &bytes_read, error));
+    if (bytes_read != expected_bytes) {
+      ArrowErrorSet(error, "Expected to be able to read %ld bytes for message header",
+                    static_cast<long>(expected_bytes));
+      return EINVAL;
+    }
+
+    header_view.data.data = header_->data;
+    header_view.size_bytes = header_->size_bytes;
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderVerifyHeader(decoder_.get(), header_view,
+                                                        error));
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeHeader(decoder_.get(), header_view,
+                                                        error));
+
+    expected_bytes = decoder_->body_size_bytes;
+    NANOARROW_RETURN_NOT_OK(ReadInto(body_.get(), 0, expected_bytes, &bytes_read,
+                                     error));
+    if (bytes_read != expected_bytes) {
+      ArrowErrorSet(error,
+                    "Expected to be able to read %ld bytes for message body but got %ld",
+                    static_cast<long>(expected_bytes), static_cast<long>(bytes_read));
+      return ESPIPE;
+    }
+
+    return NANOARROW_OK;
+  }
+};
+
 /// @}
 
 }  // namespace ipc
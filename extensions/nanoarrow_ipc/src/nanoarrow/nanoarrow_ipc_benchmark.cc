@@ -0,0 +1,564 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "nanoarrow.h"
+#include "nanoarrow_ipc.h"
+#include "nanoarrow_ipc_flatcc_generated.h"
+
+#define ns(x) FLATBUFFERS_WRAP_NAMESPACE(org_apache_arrow_flatbuf, x)
+
+// The benchmarks below need IPC streams to decode, but this library does not (yet)
+// write IPC. This section contains just enough of a writer to generate the corpora:
+// little-endian streams of uncompressed int32, int64, double, string, struct, and
+// list columns without dictionaries or metadata.
+namespace {
+
+void AppendPadded(std::string* out, const void* data, int64_t size_bytes) {
+  out->append(reinterpret_cast<const char*>(data), size_bytes);
+  out->append(static_cast<size_t>((8 - size_bytes % 8) % 8), '\0');
+}
+
+// Frames a finished flatbuffer Message as an encapsulated IPC message
+void AppendMessage(std::string* out, flatcc_builder_t* builder, const std::string& body) {
+  size_t size_bytes;
+  void* message = flatcc_builder_finalize_aligned_buffer(builder, &size_bytes);
+  int32_t padded_size = static_cast<int32_t>((size_bytes + 7) / 8 * 8);
+
+  uint32_t continuation = 0xFFFFFFFF;
+  out->append(reinterpret_cast<const char*>(&continuation), sizeof(continuation));
+  out->append(reinterpret_cast<const char*>(&padded_size), sizeof(padded_size));
+  AppendPadded(out, message, static_cast<int64_t>(size_bytes));
+  out->append(body);
+
+  flatcc_builder_aligned_free(message);
+}
+
+// Adds the members of an already-started Field table
+void EncodeField(flatcc_builder_t* B, struct ArrowSchema* schema) {
+  struct ArrowSchemaView schema_view;
+  ArrowSchemaViewInit(&schema_view, schema, nullptr);
+
+  ns(Field_name_create_str(B, schema->name == nullptr ? "" : schema->name));
+  ns(Field_nullable_add(B, (schema->flags & ARROW_FLAG_NULLABLE) != 0));
+  switch (schema_view.type) {
+    case NANOARROW_TYPE_INT32:
+      ns(Field_type_Int_create(B, 32, 1));
+      break;
+    case NANOARROW_TYPE_INT64:
+      ns(Field_type_Int_create(B, 64, 1));
+      break;
+    case NANOARROW_TYPE_DOUBLE:
+      ns(Field_type_FloatingPoint_create(B, ns(Precision_DOUBLE)));
+      break;
+    case NANOARROW_TYPE_STRING:
+      ns(Field_type_Utf8_create(B));
+      break;
+    case NANOARROW_TYPE_STRUCT:
+      ns(Field_type_Struct__create(B));
+      break;
+    case NANOARROW_TYPE_LIST:
+      ns(Field_type_List_create(B));
+      break;
+    default:
+      break;
+  }
+
+  ns(Field_children_start(B));
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    ns(Field_children_push_start(B));
+    EncodeField(B, schema->children[i]);
+    ns(Field_children_push_end(B));
+  }
+  ns(Field_children_end(B));
+}
+
+void AppendSchemaMessage(std::string* out, struct ArrowSchema* schema) {
+  flatcc_builder_t builder;
+  flatcc_builder_t* B = &builder;
+  flatcc_builder_init(B);
+
+  ns(Message_start_as_root(B));
+  ns(Message_version_add(B, ns(MetadataVersion_V5)));
+  ns(Message_header_Schema_start(B));
+  ns(Schema_endianness_add(B, ns(Endianness_Little)));
+  ns(Schema_fields_start(B));
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    ns(Schema_fields_push_start(B));
+    EncodeField(B, schema->children[i]);
+    ns(Schema_fields_push_end(B));
+  }
+  ns(Schema_fields_end(B));
+  ns(Message_header_Schema_end(B));
+  ns(Message_bodyLength_add(B, 0));
+  ns(Message_end_as_root(B));
+
+  AppendMessage(out, B, "");
+  flatcc_builder_clear(B);
+}
+
+struct FieldNode {
+  int64_t length;
+  int64_t null_count;
+};
+
+struct BodyBuffer {
+  int64_t offset;
+  int64_t length;
+};
+
+// Collects the field nodes and buffers of the children of array_view in depth-first
+// order (the order that they appear in a RecordBatch message)
+void CollectBuffers(const struct ArrowArrayView* array_view,
+                    std::vector<FieldNode>* nodes, std::vector<BodyBuffer>* buffers,
+                    std::string* body) {
+  nodes->push_back({array_view->length, array_view->null_count});
+  for (int i = 0; i < 3; i++) {
+    if (array_view->layout.buffer_type[i] == NANOARROW_BUFFER_TYPE_NONE) {
+      break;
+    }
+
+    struct ArrowBufferView buffer = array_view->buffer_views[i];
+    int64_t size_bytes = buffer.size_bytes > 0 ? buffer.size_bytes : 0;
+    buffers->push_back({static_cast<int64_t>(body->size()), size_bytes});
+    AppendPadded(body, buffer.data.data, size_bytes);
+  }
+
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    CollectBuffers(array_view->children[i], nodes, buffers, body);
+  }
+}
+
+void AppendRecordBatchMessage(std::string* out, const struct ArrowArrayView* array_view) {
+  std::vector<FieldNode> nodes;
+  std::vector<BodyBuffer> buffers;
+  std::string body;
+
+  // The top-level struct array of a RecordBatch has no node or buffers of its own
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    CollectBuffers(array_view->children[i], &nodes, &buffers, &body);
+  }
+
+  flatcc_builder_t builder;
+  flatcc_builder_t* B = &builder;
+  flatcc_builder_init(B);
+
+  ns(Message_start_as_root(B));
+  ns(Message_version_add(B, ns(MetadataVersion_V5)));
+  ns(Message_header_RecordBatch_start(B));
+  ns(RecordBatch_length_add(B, array_view->length));
+  ns(RecordBatch_nodes_start(B));
+  for (const FieldNode& node : nodes) {
+    ns(RecordBatch_nodes_push_create(B, node.length, node.null_count));
+  }
+  ns(RecordBatch_nodes_end(B));
+  ns(RecordBatch_buffers_start(B));
+  for (const BodyBuffer& buffer : buffers) {
+    ns(RecordBatch_buffers_push_create(B, buffer.offset, buffer.length));
+  }
+  ns(RecordBatch_buffers_end(B));
+  ns(Message_header_RecordBatch_end(B));
+  ns(Message_bodyLength_add(B, static_cast<int64_t>(body.size())));
+  ns(Message_end_as_root(B));
+
+  AppendMessage(out, B, body);
+  flatcc_builder_clear(B);
+}
+
+// An IPC stream of n_batches copies of one record batch
+struct Corpus {
+  std::string name;
+  std::string stream;
+  std::string schema_message;
+  std::string batch_message;
+  int64_t n_batches;
+  int64_t n_rows;
+};
+
+constexpr int64_t kRowsPerBatch = 8192;
+constexpr int64_t kBatchesPerStream = 16;
+
+enum CorpusType { kWide = 0, kDeep = 1, kStrings = 2 };
+
+ArrowErrorCode AppendValue(struct ArrowArray* array, enum ArrowType type, int64_t i) {
+  if (i % 16 == 15) {
+    return ArrowArrayAppendNull(array, 1);
+  }
+
+  switch (type) {
+    case NANOARROW_TYPE_DOUBLE:
+      return ArrowArrayAppendDouble(array, i * 0.5);
+    case NANOARROW_TYPE_STRING: {
+      // Strings of between 0 and 63 bytes
+      static const std::string kChars(64, 'x');
+      struct ArrowStringView value;
+      value.data = kChars.data();
+      value.size_bytes = (i * 7) % 64;
+      return ArrowArrayAppendString(array, value);
+    }
+    default:
+      return ArrowArrayAppendInt(array, i);
+  }
+}
+
+ArrowErrorCode MakeCorpusBatch(enum CorpusType corpus_type, struct ArrowSchema* schema,
+                               struct ArrowArray* array) {
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaInitFromType(schema, NANOARROW_TYPE_STRUCT));
+
+  switch (corpus_type) {
+    case kWide: {
+      // 100 numeric columns
+      NANOARROW_RETURN_NOT_OK(ArrowSchemaAllocateChildren(schema, 100));
+      for (int64_t i = 0; i < 100; i++) {
+        enum ArrowType type = i % 2 == 0 ? NANOARROW_TYPE_INT64 : NANOARROW_TYPE_DOUBLE;
+        NANOARROW_RETURN_NOT_OK(ArrowSchemaInitFromType(schema->children[i], type));
+        std::string name = "col" + std::to_string(i);
+        NANOARROW_RETURN_NOT_OK(ArrowSchemaSetName(schema->children[i], name.c_str()));
+      }
+      break;
+    }
+    case kDeep: {
+      // One column of 8 nested structs around a list<int32>
+      struct ArrowSchema* parent = schema;
+      for (int depth = 0; depth < 8; depth++) {
+        NANOARROW_RETURN_NOT_OK(ArrowSchemaAllocateChildren(parent, 1));
+        NANOARROW_RETURN_NOT_OK(
+            ArrowSchemaInitFromType(parent->children[0], NANOARROW_TYPE_STRUCT));
+        NANOARROW_RETURN_NOT_OK(ArrowSchemaSetName(parent->children[0], "nested"));
+        parent = parent->children[0];
+      }
+
+      NANOARROW_RETURN_NOT_OK(ArrowSchemaAllocateChildren(parent, 1));
+      NANOARROW_RETURN_NOT_OK(
+          ArrowSchemaInitFromType(parent->children[0], NANOARROW_TYPE_LIST));
+      NANOARROW_RETURN_NOT_OK(ArrowSchemaSetName(parent->children[0], "values"));
+      NANOARROW_RETURN_NOT_OK(ArrowSchemaSetType(parent->children[0]->children[0],
+                                                 NANOARROW_TYPE_INT32));
+      break;
+    }
+    case kStrings: {
+      // 4 string columns
+      NANOARROW_RETURN_NOT_OK(ArrowSchemaAllocateChildren(schema, 4));
+      for (int64_t i = 0; i < 4; i++) {
+        NANOARROW_RETURN_NOT_OK(
+            ArrowSchemaInitFromType(schema->children[i], NANOARROW_TYPE_STRING));
+        std::string name = "col" + std::to_string(i);
+        NANOARROW_RETURN_NOT_OK(ArrowSchemaSetName(schema->children[i], name.c_str()));
+      }
+      break;
+    }
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromSchema(array, schema, nullptr));
+  NANOARROW_RETURN_NOT_OK(ArrowArrayStartAppending(array));
+
+  for (int64_t i = 0; i < kRowsPerBatch; i++) {
+    if (corpus_type == kDeep) {
+      struct ArrowArray* leaf = array;
+      while (leaf->n_children == 1 && leaf->children[0]->n_children > 0) {
+        leaf = leaf->children[0];
+      }
+
+      // leaf is now the list array
+      for (int64_t j = 0; j < 4; j++) {
+        NANOARROW_RETURN_NOT_OK(ArrowArrayAppendInt(leaf->children[0], i + j));
+      }
+      NANOARROW_RETURN_NOT_OK(ArrowArrayFinishElement(leaf));
+
+      for (struct ArrowArray* parent = leaf; parent != array;) {
+        struct ArrowArray* grandparent = array;
+        while (grandparent->children[0] != parent) {
+          grandparent = grandparent->children[0];
+        }
+        NANOARROW_RETURN_NOT_OK(ArrowArrayFinishElement(grandparent));
+        parent = grandparent;
+      }
+    } else {
+      for (int64_t j = 0; j < array->n_children; j++) {
+        struct ArrowSchemaView schema_view;
+        NANOARROW_RETURN_NOT_OK(
+            ArrowSchemaViewInit(&schema_view, schema->children[j], nullptr));
+        NANOARROW_RETURN_NOT_OK(AppendValue(array->children[j], schema_view.type, i));
+      }
+      NANOARROW_RETURN_NOT_OK(ArrowArrayFinishElement(array));
+    }
+  }
+
+  return ArrowArrayFinishBuildingDefault(array, nullptr);
+}
+
+ArrowErrorCode MakeCorpus(enum CorpusType corpus_type, Corpus* corpus) {
+  static const char* kNames[] = {"wide", "deep", "strings"};
+
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  schema.release = nullptr;
+  array.release = nullptr;
+  int result = MakeCorpusBatch(corpus_type, &schema, &array);
+
+  struct ArrowArrayView array_view;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_UNINITIALIZED);
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr);
+  }
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayViewSetArray(&array_view, &array, nullptr);
+  }
+
+  if (result == NANOARROW_OK) {
+    corpus->name = kNames[corpus_type];
+    AppendSchemaMessage(&corpus->schema_message, &schema);
+    AppendRecordBatchMessage(&corpus->batch_message, &array_view);
+    corpus->n_batches = kBatchesPerStream;
+    corpus->n_rows = kBatchesPerStream * kRowsPerBatch;
+
+    uint32_t end_of_stream[] = {0xFFFFFFFF, 0};
+    corpus->stream = corpus->schema_message;
+    for (int64_t i = 0; i < corpus->n_batches; i++) {
+      corpus->stream += corpus->batch_message;
+    }
+    corpus->stream.append(reinterpret_cast<const char*>(end_of_stream),
+                          sizeof(end_of_stream));
+  }
+
+  ArrowArrayViewReset(&array_view);
+  if (array.release != nullptr) {
+    array.release(&array);
+  }
+  if (schema.release != nullptr) {
+    schema.release(&schema);
+  }
+  return result;
+}
+
+const Corpus* GetCorpus(int64_t corpus_type) {
+  static std::vector<Corpus> corpora;
+  if (corpora.empty()) {
+    corpora.resize(3);
+    for (int i = 0; i < 3; i++) {
+      if (MakeCorpus(static_cast<enum CorpusType>(i), &corpora[i]) != NANOARROW_OK) {
+        corpora.clear();
+        return nullptr;
+      }
+    }
+  }
+
+  return &corpora[corpus_type];
+}
+
+struct ArrowBufferView ViewOf(const std::string& data) {
+  struct ArrowBufferView view;
+  view.data.data = data.data();
+  view.size_bytes = static_cast<int64_t>(data.size());
+  return view;
+}
+
+// A decoder that has consumed the schema message of corpus
+class CorpusDecoder {
+ public:
+  CorpusDecoder() { ArrowIpcDecoderInit(&decoder_); }
+  ~CorpusDecoder() { ArrowIpcDecoderReset(&decoder_); }
+
+  ArrowErrorCode Init(const Corpus& corpus) {
+    struct ArrowBufferView data = ViewOf(corpus.schema_message);
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderVerifyHeader(&decoder_, data, nullptr));
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeHeader(&decoder_, data, nullptr));
+
+    struct ArrowSchema schema;
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeSchema(&decoder_, &schema, nullptr));
+    int result = ArrowIpcDecoderSetSchema(&decoder_, &schema, nullptr);
+    schema.release(&schema);
+    return result;
+  }
+
+  struct ArrowIpcDecoder* get() { return &decoder_; }
+
+ private:
+  struct ArrowIpcDecoder decoder_;
+};
+
+void SetCorpusCounters(benchmark::State& state, const Corpus& corpus, int64_t n_bytes,
+                       int64_t n_batches) {
+  state.SetLabel(corpus.name);
+  state.SetBytesProcessed(state.iterations() * n_bytes);
+  state.counters["batches_per_second"] =
+      benchmark::Counter(static_cast<double>(state.iterations() * n_batches),
+                         benchmark::Counter::kIsRate);
+}
+
+}  // namespace
+
+#define BENCHMARK_RETURN_NOT_OK(expr)                       \
+  do {                                                      \
+    if ((expr) != NANOARROW_OK) {                           \
+      state.SkipWithError("nanoarrow call failed: " #expr); \
+      return;                                               \
+    }                                                       \
+  } while (0)
+
+#define BENCHMARK_GET_CORPUS(corpus)                       \
+  const Corpus* corpus = GetCorpus(state.range(0));        \
+  if (corpus == nullptr) {                                 \
+    state.SkipWithError("Failed to generate IPC corpora"); \
+    return;                                                \
+  }
+
+static void BM_IpcDecoderVerifyHeader(benchmark::State& state) {
+  BENCHMARK_GET_CORPUS(corpus);
+  CorpusDecoder decoder;
+  BENCHMARK_RETURN_NOT_OK(decoder.Init(*corpus));
+  struct ArrowBufferView data = ViewOf(corpus->batch_message);
+
+  for (auto _ : state) {
+    BENCHMARK_RETURN_NOT_OK(ArrowIpcDecoderVerifyHeader(decoder.get(), data, nullptr));
+  }
+
+  SetCorpusCounters(state, *corpus, decoder.get()->header_size_bytes, 1);
+}
+
+static void BM_IpcDecoderDecodeHeader(benchmark::State& state) {
+  BENCHMARK_GET_CORPUS(corpus);
+  CorpusDecoder decoder;
+  BENCHMARK_RETURN_NOT_OK(decoder.Init(*corpus));
+  struct ArrowBufferView data = ViewOf(corpus->batch_message);
+
+  for (auto _ : state) {
+    BENCHMARK_RETURN_NOT_OK(ArrowIpcDecoderDecodeHeader(decoder.get(), data, nullptr));
+  }
+
+  SetCorpusCounters(state, *corpus, decoder.get()->header_size_bytes, 1);
+}
+
+// Decodes the record batch message of a corpus into an ArrowArray using either a view
+// of the body (which copies buffers) or a shared buffer (which does not)
+static void BenchmarkDecodeArray(benchmark::State& state, bool use_shared_buffers) {
+  BENCHMARK_GET_CORPUS(corpus);
+  CorpusDecoder decoder;
+  BENCHMARK_RETURN_NOT_OK(decoder.Init(*corpus));
+  struct ArrowBufferView data = ViewOf(corpus->batch_message);
+  BENCHMARK_RETURN_NOT_OK(ArrowIpcDecoderVerifyHeader(decoder.get(), data, nullptr));
+  BENCHMARK_RETURN_NOT_OK(ArrowIpcDecoderDecodeHeader(decoder.get(), data, nullptr));
+
+  struct ArrowBufferView body;
+  body.data.as_uint8 = data.data.as_uint8 + decoder.get()->header_size_bytes;
+  body.size_bytes = decoder.get()->body_size_bytes;
+
+  struct ArrowIpcSharedBuffer shared;
+  struct ArrowBuffer body_buffer;
+  ArrowBufferInit(&body_buffer);
+  BENCHMARK_RETURN_NOT_OK(ArrowBufferAppendBufferView(&body_buffer, body));
+  BENCHMARK_RETURN_NOT_OK(ArrowIpcSharedBufferInit(&shared, &body_buffer));
+
+  for (auto _ : state) {
+    struct ArrowArray array;
+    int result;
+    if (use_shared_buffers) {
+      result = ArrowIpcDecoderDecodeArrayFromShared(
+          decoder.get(), &shared, -1, &array, NANOARROW_VALIDATION_LEVEL_FULL, nullptr);
+    } else {
+      result = ArrowIpcDecoderDecodeArray(decoder.get(), body, -1, &array,
+                                          NANOARROW_VALIDATION_LEVEL_FULL, nullptr);
+    }
+
+    if (result != NANOARROW_OK) {
+      state.SkipWithError("Failed to decode array");
+      break;
+    }
+    array.release(&array);
+  }
+
+  ArrowIpcSharedBufferReset(&shared);
+  SetCorpusCounters(state, *corpus, body.size_bytes, 1);
+}
+
+static void BM_IpcDecoderDecodeArray(benchmark::State& state) {
+  BenchmarkDecodeArray(state, false);
+}
+
+static void BM_IpcDecoderDecodeArrayFromShared(benchmark::State& state) {
+  BenchmarkDecodeArray(state, true);
+}
+
+static void NoOpFree(struct ArrowBufferAllocator* allocator, uint8_t* ptr,
+                     int64_t size) {}
+
+// Reads every array of a corpus using ArrowIpcArrayStreamReaderInit()
+static void BenchmarkStreamReader(benchmark::State& state, int use_shared_buffers) {
+  BENCHMARK_GET_CORPUS(corpus);
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.use_shared_buffers = use_shared_buffers;
+
+  for (auto _ : state) {
+    // Wrap the corpus without copying it
+    struct ArrowBuffer input_buffer;
+    ArrowBufferInit(&input_buffer);
+    struct ArrowBufferAllocator no_op = ArrowBufferDeallocator(&NoOpFree, nullptr);
+    BENCHMARK_RETURN_NOT_OK(ArrowBufferSetAllocator(&input_buffer, no_op));
+    input_buffer.data =
+        reinterpret_cast<uint8_t*>(const_cast<char*>(corpus->stream.data()));
+    input_buffer.size_bytes = static_cast<int64_t>(corpus->stream.size());
+    input_buffer.capacity_bytes = input_buffer.size_bytes;
+
+    struct ArrowIpcInputStream input;
+    BENCHMARK_RETURN_NOT_OK(ArrowIpcInputStreamInitBuffer(&input, &input_buffer));
+    struct ArrowArrayStream stream;
+    BENCHMARK_RETURN_NOT_OK(ArrowIpcArrayStreamReaderInit(&stream, &input, &options));
+
+    int64_t n_batches = 0;
+    struct ArrowArray array;
+    while (stream.get_next(&stream, &array) == NANOARROW_OK && array.release != nullptr) {
+      n_batches++;
+      array.release(&array);
+    }
+    stream.release(&stream);
+
+    if (n_batches != corpus->n_batches) {
+      state.SkipWithError("Failed to read all batches");
+      break;
+    }
+  }
+
+  SetCorpusCounters(state, *corpus, static_cast<int64_t>(corpus->stream.size()),
+                    corpus->n_batches);
+}
+
+static void BM_IpcArrayStreamReader(benchmark::State& state) {
+  BenchmarkStreamReader(state, 0);
+}
+
+static void BM_IpcArrayStreamReaderSharedBuffers(benchmark::State& state) {
+  BenchmarkStreamReader(state, 1);
+}
+
+// Each benchmark takes the corpus type as its only argument
+#define NANOARROW_IPC_BENCHMARK_CORPORA \
+  ArgName("corpus")->DenseRange(kWide, kStrings)->Unit(benchmark::kMicrosecond)
+
+BENCHMARK(BM_IpcDecoderVerifyHeader)->NANOARROW_IPC_BENCHMARK_CORPORA;
+BENCHMARK(BM_IpcDecoderDecodeHeader)->NANOARROW_IPC_BENCHMARK_CORPORA;
+BENCHMARK(BM_IpcDecoderDecodeArray)->NANOARROW_IPC_BENCHMARK_CORPORA;
+BENCHMARK(BM_IpcDecoderDecodeArrayFromShared)->NANOARROW_IPC_BENCHMARK_CORPORA;
+BENCHMARK(BM_IpcArrayStreamReader)->NANOARROW_IPC_BENCHMARK_CORPORA;
+BENCHMARK(BM_IpcArrayStreamReaderSharedBuffers)->NANOARROW_IPC_BENCHMARK_CORPORA;
+
+BENCHMARK_MAIN();
@@ -15,6 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+// clock_gettime() requires _GNU_SOURCE on Linux when compiling with -std=c99
+#if defined(NANOARROW_IPC_WITH_STATS) && defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include <errno.h>
 #include <stdio.h>
 #include <string.h>
@@ -42,6 +47,40 @@
 
 #endif
 
+// The schema cache lock comes from nanoarrow's internal atomics header, which
+// follows NANOARROW_IPC_USE_STDATOMIC unless NANOARROW_USE_STDATOMIC is also set
+#if !defined(NANOARROW_USE_STDATOMIC)
+#define NANOARROW_USE_STDATOMIC NANOARROW_IPC_USE_STDATOMIC
+#endif
+#include "nanoarrow_atomic_internal.h"
+
+#if defined(NANOARROW_IPC_WITH_ZSTD)
+#include <zstd.h>
+#endif
+
+#if defined(NANOARROW_IPC_WITH_LZ4)
+#include <lz4frame.h>
+#endif
+
+#if defined(NANOARROW_IPC_WITH_DEVICE)
+#include "nanoarrow_device.h"
+#endif
+
+#if defined(NANOARROW_IPC_WITH_STATS) && defined(_WIN32)
+#include <windows.h>
+#elif defined(NANOARROW_IPC_WITH_STATS)
+#include <time.h>
+#endif
+
+// Endian swapping uses byte shuffle instructions if the compiler targets them
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define NANOARROW_IPC_SWAP_SSSE3
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define NANOARROW_IPC_SWAP_NEON
+#endif
+
 #include "nanoarrow.h"
 #include "nanoarrow_ipc.h"
 #include "nanoarrow_ipc_flatcc_generated.h"
@@ -50,6 +89,50 @@
 // at the beginning of every message header.
 const static int64_t kMessageHeaderPrefixSize = 8;
 
+// Statistics are accumulated into ArrowIpcDecoderPrivate::stats using these macros,
+// which expand to nothing unless nanoarrow_ipc is built with NANOARROW_IPC_WITH_STATS
+#if defined(NANOARROW_IPC_WITH_STATS)
+static int64_t ArrowIpcDecoderNowNs(void) {
+#if defined(_WIN32)
+  LARGE_INTEGER frequency;
+  LARGE_INTEGER counter;
+  QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&counter);
+  return (int64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (int64_t)now.tv_sec * 1000000000 + (int64_t)now.tv_nsec;
+#endif
+}
+
+#define NANOARROW_IPC_STATS_ADD(private_data, field, value) \
+  (private_data)->stats.field += (value)
+#define NANOARROW_IPC_STATS_TIMER_START(name) int64_t name = ArrowIpcDecoderNowNs()
+#define NANOARROW_IPC_STATS_TIMER_STOP(private_data, field, name) \
+  (private_data)->stats.field += ArrowIpcDecoderNowNs() - (name)
+
+static void ArrowIpcDecoderAddStats(struct ArrowIpcStats* dst,
+                                    const struct ArrowIpcStats* src) {
+  dst->n_reads += src->n_reads;
+  dst->n_bytes_read += src->n_bytes_read;
+  dst->n_messages += src->n_messages;
+  dst->n_buffers_shared += src->n_buffers_shared;
+  dst->n_bytes_shared += src->n_bytes_shared;
+  dst->n_buffers_allocated += src->n_buffers_allocated;
+  dst->n_bytes_copied += src->n_bytes_copied;
+  dst->read_ns += src->read_ns;
+  dst->verify_ns += src->verify_ns;
+  dst->decode_header_ns += src->decode_header_ns;
+  dst->decode_body_ns += src->decode_body_ns;
+  dst->validate_ns += src->validate_ns;
+}
+#else
+#define NANOARROW_IPC_STATS_ADD(private_data, field, value)
+#define NANOARROW_IPC_STATS_TIMER_START(name)
+#define NANOARROW_IPC_STATS_TIMER_STOP(private_data, field, name)
+#endif
+
 // Internal representation of a parsed "Field" from flatbuffers. This
 // represents a field in a depth-first walk of column arrays and their
 // children.
@@ -62,6 +145,37 @@ struct ArrowIpcField {
   struct ArrowArray* array;
   // The cumulative number of buffers preceding this node.
   int64_t buffer_offset;
+  // The index of the ArrowIpcDecoderPrivate::dictionaries element that holds the values
+  // of this node if it is dictionary-encoded or -1 otherwise.
+  int64_t dictionary_i;
+};
+
+// Internal representation of a node of the pruned tree of fields selected by
+// ArrowIpcDecoderSetProjection().
+struct ArrowIpcProjectedField {
+  // Pointer to the ArrowIpcDecoderPrivate::projected_array_view or child for this node
+  struct ArrowArrayView* array_view;
+  // Pointer to the ArrowIpcDecoderPrivate::projected_array or child for this node,
+  // used as scratch space in the same way as ArrowIpcField::array.
+  struct ArrowArray* array;
+  // The index of the ArrowIpcDecoderPrivate::fields element for this node
+  int64_t field_i;
+};
+
+// Internal representation of the dictionary referred to by one or more
+// dictionary-encoded fields.
+struct ArrowIpcDictionary {
+  // The id used by DictionaryBatch messages to refer to this dictionary
+  int64_t id;
+  // The value type of the dictionary (i.e., the schema->dictionary of the field)
+  struct ArrowSchema schema;
+  // A decoder whose schema is a struct with a single child of the value type, used to
+  // decode the RecordBatch that each DictionaryBatch message wraps
+  struct ArrowIpcDecoder decoder;
+  // The current values, which are released until the first DictionaryBatch message
+  // with this id is decoded. These values are shared with (not copied into) the
+  // dictionary of each decoded ArrowArray.
+  struct ArrowArray values;
 };
 
 // Internal data specific to the read/decode process
@@ -89,6 +203,51 @@ struct ArrowIpcDecoderPrivate {
   int64_t n_buffers;
   // A pointer to the last flatbuffers message.
   const void* last_message;
+  // The flatbuffer bytes of the Message containing last_message
+  struct ArrowBufferView last_message_data;
+  // An optional cache of decoded Schema messages shared with other decoders
+  struct ArrowIpcSchemaCache* schema_cache;
+  // The bytes of the last Message that passed ArrowIpcDecoderVerifyHeader(). Messages
+  // decoded without verification are never added to schema_cache.
+  struct ArrowBufferView verified_message_data;
+  // An aligned copy of the last header passed to ArrowIpcDecoderDecodeFlightDataHeader()
+  // if the original was not aligned
+  struct ArrowBuffer header_copy;
+  // The int64_t buffer sizes followed by the int64_t column sizes pointed to by the
+  // last output of ArrowIpcDecoderDecodeRecordBatchSizes()
+  struct ArrowBuffer record_batch_sizes;
+  // The verification run by ArrowIpcDecoderVerifyHeader()
+  enum ArrowIpcVerificationLevel verification_level;
+  // An optional executor used to decompress the buffers of a RecordBatch in parallel
+  struct ArrowExecutor* executor;
+  // The allocator used for decompressed, endian swapped, and copied buffers
+  struct ArrowBufferAllocator allocator;
+  // Buffers smaller than this are copied rather than referencing a shared body
+  int64_t shared_buffer_copy_threshold_bytes;
+  // Non-zero if message bodies are in memory that can't be accessed by the CPU
+  int device_body;
+  // The struct ArrowIpcBufferTask values collected while walking a RecordBatch
+  struct ArrowBuffer buffer_tasks;
+  // The int64_t dictionary ids of the last decoded Schema in depth-first field order
+  struct ArrowBuffer schema_dictionary_ids;
+  // The number of distinct dictionaries referred to by the schema that has been set
+  int64_t n_dictionaries;
+  // The dictionaries referred to by the schema that has been set
+  struct ArrowIpcDictionary* dictionaries;
+  // The dictionary targeted by the last decoded DictionaryBatch message
+  struct ArrowIpcDictionary* pending_dictionary;
+  // An ArrowArrayView/ArrowArray pair with the structure of the projected schema that
+  // replace array_view and array when decoding all fields of a RecordBatch
+  struct ArrowArrayView projected_array_view;
+  struct ArrowArray projected_array;
+  // The number of nodes in the projected tree or 0 if no projection has been set
+  int64_t n_projected_fields;
+  // The nodes of the projected tree in depth-first order
+  struct ArrowIpcProjectedField* projected_fields;
+#if defined(NANOARROW_IPC_WITH_STATS)
+  // Counters and timers returned by ArrowIpcDecoderGetStats()
+  struct ArrowIpcStats stats;
+#endif
 };
 
 ArrowErrorCode ArrowIpcCheckRuntime(struct ArrowError* error) {
@@ -122,7 +281,7 @@ struct ArrowIpcSharedBufferPrivate {
 };
 
 static int64_t ArrowIpcSharedBufferUpdate(
-    struct ArrowIpcSharedBufferPrivate* private_data, int delta) {
+    struct ArrowIpcSharedBufferPrivate* private_data, int64_t delta) {
   int64_t old_count = atomic_fetch_add(&private_data->reference_count, delta);
   return old_count + delta;
 }
@@ -140,7 +299,7 @@ struct ArrowIpcSharedBufferPrivate {
 };
 
 static int64_t ArrowIpcSharedBufferUpdate(
-    struct ArrowIpcSharedBufferPrivate* private_data, int delta) {
+    struct ArrowIpcSharedBufferPrivate* private_data, int64_t delta) {
   private_data->reference_count += delta;
   return private_data->reference_count;
 }
@@ -207,10 +366,72 @@ static void ArrowIpcSharedBufferClone(struct ArrowIpcSharedBuffer* shared,
   memcpy(shared_out, shared, sizeof(struct ArrowBuffer));
 }
 
+// References to a shared buffer that are acquired together (i.e., with a single update
+// of its reference count) and are then handed out one at a time
+struct ArrowIpcSharedBufferReferences {
+  struct ArrowIpcSharedBuffer* shared;
+  int64_t n_available;
+};
+
+static void ArrowIpcSharedBufferAcquire(struct ArrowIpcSharedBuffer* shared, int64_t n,
+                                        struct ArrowIpcSharedBufferReferences* out) {
+  out->shared = shared;
+  out->n_available = 0;
+  if (shared->private_src.data != NULL && n > 0) {
+    struct ArrowIpcSharedBufferPrivate* private_data =
+        (struct ArrowIpcSharedBufferPrivate*)shared->private_src.allocator.private_data;
+    ArrowIpcSharedBufferUpdate(private_data, n);
+    out->n_available = n;
+  }
+}
+
+static void ArrowIpcSharedBufferTake(struct ArrowIpcSharedBufferReferences* references,
+                                     struct ArrowBuffer* shared_out) {
+  if (references->n_available == 0) {
+    ArrowIpcSharedBufferClone(references->shared, shared_out);
+    return;
+  }
+
+  references->n_available--;
+  memcpy(shared_out, references->shared, sizeof(struct ArrowBuffer));
+}
+
+// Releases the references that were acquired but never taken
+static void ArrowIpcSharedBufferRelease(
+    struct ArrowIpcSharedBufferReferences* references) {
+  if (references->n_available > 0) {
+    struct ArrowIpcSharedBufferPrivate* private_data =
+        (struct ArrowIpcSharedBufferPrivate*)references->shared->private_src.allocator
+            .private_data;
+    ArrowIpcSharedBufferUpdate(private_data, -references->n_available);
+    references->n_available = 0;
+  }
+}
+
 void ArrowIpcSharedBufferReset(struct ArrowIpcSharedBuffer* shared) {
   ArrowBufferReset(&shared->private_src);
 }
 
+ArrowErrorCode ArrowIpcSharedBufferSlice(struct ArrowIpcSharedBuffer* shared,
+                                         int64_t offset, int64_t length,
+                                         struct ArrowIpcSharedBuffer* out) {
+  if (offset < 0 || length < 0 || offset > shared->private_src.size_bytes ||
+      length > (shared->private_src.size_bytes - offset)) {
+    return EINVAL;
+  }
+
+  // The deallocator ignores the pointer it is passed, so a clone can point anywhere
+  // within the source
+  ArrowIpcSharedBufferClone(shared, &out->private_src);
+  if (out->private_src.data != NULL) {
+    out->private_src.data += offset;
+  }
+
+  out->private_src.size_bytes = length;
+  out->private_src.capacity_bytes = length;
+  return NANOARROW_OK;
+}
+
 static int ArrowIpcDecoderNeedsSwapEndian(struct ArrowIpcDecoder* decoder) {
   struct ArrowIpcDecoderPrivate* private_data =
       (struct ArrowIpcDecoderPrivate*)decoder->private_data;
@@ -234,10 +455,54 @@ ArrowErrorCode ArrowIpcDecoderInit(struct ArrowIpcDecoder* decoder) {
 
   memset(private_data, 0, sizeof(struct ArrowIpcDecoderPrivate));
   private_data->system_endianness = ArrowIpcSystemEndianness();
+  private_data->allocator = ArrowBufferAllocatorDefault();
+  ArrowBufferInit(&private_data->buffer_tasks);
+  ArrowBufferInit(&private_data->schema_dictionary_ids);
+  ArrowBufferInit(&private_data->header_copy);
+  ArrowBufferInit(&private_data->record_batch_sizes);
   decoder->private_data = private_data;
   return NANOARROW_OK;
 }
 
+static void ArrowIpcDecoderResetDictionaries(
+    struct ArrowIpcDecoderPrivate* private_data) {
+  for (int64_t i = 0; i < private_data->n_dictionaries; i++) {
+    struct ArrowIpcDictionary* dictionary = private_data->dictionaries + i;
+    if (dictionary->schema.release != NULL) {
+      dictionary->schema.release(&dictionary->schema);
+    }
+
+    if (dictionary->values.release != NULL) {
+      dictionary->values.release(&dictionary->values);
+    }
+
+    ArrowIpcDecoderReset(&dictionary->decoder);
+  }
+
+  if (private_data->dictionaries != NULL) {
+    ArrowFree(private_data->dictionaries);
+    private_data->dictionaries = NULL;
+  }
+
+  private_data->n_dictionaries = 0;
+  private_data->pending_dictionary = NULL;
+}
+
+static void ArrowIpcDecoderResetProjection(
+    struct ArrowIpcDecoderPrivate* private_data) {
+  ArrowArrayViewReset(&private_data->projected_array_view);
+  if (private_data->projected_array.release != NULL) {
+    private_data->projected_array.release(&private_data->projected_array);
+  }
+
+  if (private_data->projected_fields != NULL) {
+    ArrowFree(private_data->projected_fields);
+    private_data->projected_fields = NULL;
+  }
+
+  private_data->n_projected_fields = 0;
+}
+
 void ArrowIpcDecoderReset(struct ArrowIpcDecoder* decoder) {
   struct ArrowIpcDecoderPrivate* private_data =
       (struct ArrowIpcDecoderPrivate*)decoder->private_data;
@@ -254,6 +519,12 @@ void ArrowIpcDecoderReset(struct ArrowIpcDecoder* decoder) {
       private_data->n_fields = 0;
     }
 
+    ArrowIpcDecoderResetDictionaries(private_data);
+    ArrowIpcDecoderResetProjection(private_data);
+    ArrowBufferReset(&private_data->buffer_tasks);
+    ArrowBufferReset(&private_data->schema_dictionary_ids);
+    ArrowBufferReset(&private_data->header_copy);
+    ArrowBufferReset(&private_data->record_batch_sizes);
     ArrowFree(private_data);
     memset(decoder, 0, sizeof(struct ArrowIpcDecoder));
   }
@@ -760,14 +1031,87 @@ static int ArrowIpcDecoderSetType(struct ArrowSchema* schema, ns(Field_table_t)
 static int ArrowIpcDecoderSetChildren(struct ArrowSchema* schema, ns(Field_vec_t) fields,
                                       struct ArrowError* error);
 
-static int ArrowIpcDecoderSetField(struct ArrowSchema* schema, ns(Field_table_t) field,
-                                   struct ArrowError* error) {
-  // No dictionary support yet
-  if (ns(Field_dictionary_is_present(field))) {
-    ArrowErrorSet(error, "Schema message field with DictionaryEncoding not supported");
-    return ENOTSUP;
+// Sets the format and children of schema from field. For a dictionary-encoded field
+// these describe the dictionary values and schema is the field's schema->dictionary.
+static int ArrowIpcDecoderSetTypeAndChildren(struct ArrowSchema* schema,
+                                             ns(Field_table_t) field,
+                                             struct ArrowError* error) {
+  // Sets the schema->format and validates type-related inconsistencies
+  // that might exist in the flatbuffer
+  ns(Field_vec_t) children = ns(Field_children(field));
+  int64_t n_children = ns(Field_vec_len(children));
+
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderSetType(schema, field, n_children, error));
+
+  // Children are defined separately in the flatbuffer, so we allocate, initialize
+  // and set them separately as well.
+  int result = ArrowSchemaAllocateChildren(schema, n_children);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "ArrowSchemaAllocateChildren() failed");
+    return result;
+  }
+
+  for (int64_t i = 0; i < n_children; i++) {
+    ArrowSchemaInit(schema->children[i]);
+  }
+
+  return ArrowIpcDecoderSetChildren(schema, children, error);
+}
+
+// Sets the index type and flags of a dictionary-encoded field and allocates
+// schema->dictionary to hold the value type
+static int ArrowIpcDecoderSetDictionaryEncoding(
+    struct ArrowSchema* schema, ns(DictionaryEncoding_table_t) encoding,
+    struct ArrowError* error) {
+  // The index type defaults to a signed 32-bit integer
+  int index_type = NANOARROW_TYPE_INT32;
+  if (ns(DictionaryEncoding_indexType_is_present(encoding))) {
+    ns(Int_table_t) int_type = ns(DictionaryEncoding_indexType(encoding));
+    int bit_width = ns(Int_bitWidth_get(int_type));
+    int is_signed = ns(Int_is_signed_get(int_type));
+    switch (bit_width) {
+      case 8:
+        index_type = is_signed ? NANOARROW_TYPE_INT8 : NANOARROW_TYPE_UINT8;
+        break;
+      case 16:
+        index_type = is_signed ? NANOARROW_TYPE_INT16 : NANOARROW_TYPE_UINT16;
+        break;
+      case 32:
+        index_type = is_signed ? NANOARROW_TYPE_INT32 : NANOARROW_TYPE_UINT32;
+        break;
+      case 64:
+        index_type = is_signed ? NANOARROW_TYPE_INT64 : NANOARROW_TYPE_UINT64;
+        break;
+      default:
+        ArrowErrorSet(error, "Expected DictionaryEncoding indexType bitWidth of "
+                             "8, 16, 32, or 64 but got %d",
+                      bit_width);
+        return EINVAL;
+    }
+  }
+
+  int result = ArrowSchemaSetType(schema, index_type);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "ArrowSchemaSetType() failed for dictionary index type");
+    return result;
+  }
+
+  if (ns(DictionaryEncoding_isOrdered(encoding))) {
+    schema->flags |= ARROW_FLAG_DICTIONARY_ORDERED;
+  }
+
+  result = ArrowSchemaAllocateDictionary(schema);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "ArrowSchemaAllocateDictionary() failed");
+    return result;
   }
 
+  ArrowSchemaInit(schema->dictionary);
+  return NANOARROW_OK;
+}
+
+static int ArrowIpcDecoderSetField(struct ArrowSchema* schema, ns(Field_table_t) field,
+                                   struct ArrowError* error) {
   int result;
   if (ns(Field_name_is_present(field))) {
     result = ArrowSchemaSetName(schema, ns(Field_name_get(field)));
@@ -780,12 +1124,16 @@ static int ArrowIpcDecoderSetField(struct ArrowSchema* schema, ns(Field_table_t)
     return result;
   }
 
-  // Sets the schema->format and validates type-related inconsistencies
-  // that might exist in the flatbuffer
-  ns(Field_vec_t) children = ns(Field_children(field));
-  int64_t n_children = ns(Field_vec_len(children));
-
-  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderSetType(schema, field, n_children, error));
+  // For a dictionary-encoded field, the type and children in the flatbuffer
+  // describe the dictionary values
+  if (ns(Field_dictionary_is_present(field))) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderSetDictionaryEncoding(
+        schema, ns(Field_dictionary(field)), error));
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcDecoderSetTypeAndChildren(schema->dictionary, field, error));
+  } else {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderSetTypeAndChildren(schema, field, error));
+  }
 
   // nanoarrow's type setters set the nullable flag by default, so we might
   // have to unset it here.
@@ -795,20 +1143,27 @@ static int ArrowIpcDecoderSetField(struct ArrowSchema* schema, ns(Field_table_t)
     schema->flags &= ~ARROW_FLAG_NULLABLE;
   }
 
-  // Children are defined separately in the flatbuffer, so we allocate, initialize
-  // and set them separately as well.
-  result = ArrowSchemaAllocateChildren(schema, n_children);
-  if (result != NANOARROW_OK) {
-    ArrowErrorSet(error, "ArrowSchemaAllocateChildren() failed");
-    return result;
-  }
+  return ArrowIpcDecoderSetMetadata(schema, ns(Field_custom_metadata(field)), error);
+}
 
-  for (int64_t i = 0; i < n_children; i++) {
-    ArrowSchemaInit(schema->children[i]);
+// Appends the id of each dictionary-encoded field to ids in the depth-first order in
+// which ArrowIpcDecoderSetSchema() visits fields (i.e., not including the children of
+// dictionary values)
+static int ArrowIpcDecoderCollectDictionaryIds(ns(Field_vec_t) fields,
+                                               struct ArrowBuffer* ids) {
+  int64_t n_fields = ns(Field_vec_len(fields));
+  for (int64_t i = 0; i < n_fields; i++) {
+    ns(Field_table_t) field = ns(Field_vec_at(fields, i));
+    if (ns(Field_dictionary_is_present(field))) {
+      int64_t id = ns(DictionaryEncoding_id(ns(Field_dictionary(field))));
+      NANOARROW_RETURN_NOT_OK(ArrowBufferAppendInt64(ids, id));
+    } else {
+      NANOARROW_RETURN_NOT_OK(
+          ArrowIpcDecoderCollectDictionaryIds(ns(Field_children(field)), ids));
+    }
   }
 
-  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderSetChildren(schema, children, error));
-  return ArrowIpcDecoderSetMetadata(schema, ns(Field_custom_metadata(field)), error);
+  return NANOARROW_OK;
 }
 
 static int ArrowIpcDecoderSetChildren(struct ArrowSchema* schema, ns(Field_vec_t) fields,
@@ -930,7 +1285,64 @@ static inline void ArrowIpcDecoderResetHeaderInfo(struct ArrowIpcDecoder* decode
   decoder->codec = 0;
   decoder->header_size_bytes = 0;
   decoder->body_size_bytes = 0;
+  decoder->dictionary_id = 0;
+  decoder->dictionary_is_delta = 0;
   private_data->last_message = NULL;
+  private_data->last_message_data.data.data = NULL;
+  private_data->last_message_data.size_bytes = 0;
+  private_data->pending_dictionary = NULL;
+}
+
+static int ArrowIpcDecoderDecodeDictionaryBatchHeader(
+    struct ArrowIpcDecoder* decoder, flatbuffers_generic_t message_header,
+    struct ArrowError* error) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+
+  ns(DictionaryBatch_table_t) batch = (ns(DictionaryBatch_table_t))message_header;
+  decoder->dictionary_id = ns(DictionaryBatch_id(batch));
+  decoder->dictionary_is_delta = ns(DictionaryBatch_isDelta(batch));
+
+  struct ArrowIpcDictionary* dictionary = NULL;
+  for (int64_t i = 0; i < private_data->n_dictionaries; i++) {
+    if (private_data->dictionaries[i].id == decoder->dictionary_id) {
+      dictionary = private_data->dictionaries + i;
+      break;
+    }
+  }
+
+  if (dictionary == NULL) {
+    ArrowErrorSet(error, "DictionaryBatch message has unknown dictionary id %ld",
+                  (long)decoder->dictionary_id);
+    return EINVAL;
+  }
+
+  if (!ns(DictionaryBatch_data_is_present(batch))) {
+    ArrowErrorSet(error, "DictionaryBatch message with id %ld has no data",
+                  (long)decoder->dictionary_id);
+    return EINVAL;
+  }
+
+  // The wrapped RecordBatch is decoded by the dictionary's own decoder, which uses
+  // the same options as this one.
+  struct ArrowIpcDecoder* dictionary_decoder = &dictionary->decoder;
+  struct ArrowIpcDecoderPrivate* dictionary_private =
+      (struct ArrowIpcDecoderPrivate*)dictionary_decoder->private_data;
+  dictionary_private->endianness = private_data->endianness;
+  dictionary_private->executor = private_data->executor;
+  dictionary_private->allocator = private_data->allocator;
+
+  ns(RecordBatch_table_t) data = ns(DictionaryBatch_data(batch));
+  ArrowIpcDecoderResetHeaderInfo(dictionary_decoder);
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcDecoderDecodeRecordBatchHeader(dictionary_decoder, data, error));
+  dictionary_decoder->message_type = NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH;
+  dictionary_decoder->body_size_bytes = decoder->body_size_bytes;
+  dictionary_private->last_message = data;
+
+  decoder->codec = dictionary_decoder->codec;
+  private_data->pending_dictionary = dictionary;
+  return NANOARROW_OK;
 }
 
 // Returns NANOARROW_OK if data is large enough to read the first 8 bytes
@@ -986,94 +1398,504 @@ ArrowErrorCode ArrowIpcDecoderPeekHeader(struct ArrowIpcDecoder* decoder,
   return NANOARROW_OK;
 }
 
-ArrowErrorCode ArrowIpcDecoderVerifyHeader(struct ArrowIpcDecoder* decoder,
-                                           struct ArrowBufferView data,
-                                           struct ArrowError* error) {
-  struct ArrowIpcDecoderPrivate* private_data =
-      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+// The location of a flatbuffer table within a buffer whose vtable and inline fields
+// have been checked to lie within the buffer by ArrowIpcFlatbufferCheckTable()
+struct ArrowIpcFlatbufferTable {
+  const uint8_t* buf;
+  int64_t table;
+  int64_t table_size;
+  int64_t vtable;
+  int64_t vtable_size;
+};
 
-  ArrowIpcDecoderResetHeaderInfo(decoder);
-  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderReadHeaderPrefix(
-      decoder, &data, &decoder->header_size_bytes, error));
+// Checks the table referred to by the uoffset at position ref of a buffer with the
+// same rules as flatbuffer verification (without verifying any of its fields)
+static int ArrowIpcFlatbufferCheckTable(const uint8_t* buf, int64_t buf_size, int64_t ref,
+                                        struct ArrowIpcFlatbufferTable* out) {
+  int64_t table = ref + (int64_t)__flatbuffers_uoffset_read_from_pe(buf + ref);
+  if (table <= ref || (table % 4) != 0 || table > (buf_size - 4)) {
+    return 0;
+  }
 
-  // Check that data contains at least the entire header (return ESPIPE to signal
-  // that reading more data may help).
-  int64_t message_body_size = decoder->header_size_bytes - kMessageHeaderPrefixSize;
-  if (data.size_bytes < message_body_size) {
-    ArrowErrorSet(error,
-                  "Expected >= %ld bytes of remaining data but found %ld bytes in buffer",
-                  (long)message_body_size + kMessageHeaderPrefixSize,
-                  (long)data.size_bytes + kMessageHeaderPrefixSize);
-    return ESPIPE;
+  int64_t vtable = table - (int64_t)__flatbuffers_soffset_read_from_pe(buf + table);
+  if (vtable < 0 || (vtable % 2) != 0 || vtable > (buf_size - 4)) {
+    return 0;
   }
 
-  // Run flatbuffers verification
-  if (ns(Message_verify_as_root(data.data.as_uint8, message_body_size) !=
-         flatcc_verify_ok)) {
-    ArrowErrorSet(error, "Message flatbuffer verification failed");
-    return EINVAL;
+  out->buf = buf;
+  out->table = table;
+  out->vtable = vtable;
+  out->vtable_size = __flatbuffers_voffset_read_from_pe(buf + vtable);
+  out->table_size = __flatbuffers_voffset_read_from_pe(buf + vtable + 2);
+  return out->vtable_size >= 4 && (out->vtable_size % 2) == 0 &&
+         out->vtable_size <= (buf_size - vtable) &&
+         out->table_size <= (buf_size - table);
+}
+
+// Returns the position of field id (a scalar or uoffset of size_bytes bytes) in the
+// buffer, 0 if the field is not present, or -1 if it is not within the table
+static int64_t ArrowIpcFlatbufferField(const struct ArrowIpcFlatbufferTable* table,
+                                       int id, int64_t size_bytes) {
+  if ((4 + 2 * id + 2) > table->vtable_size) {
+    return 0;
   }
 
-  // Read some basic information from the message
-  ns(Message_table_t) message = ns(Message_as_root(data.data.as_uint8));
-  decoder->metadata_version = ns(Message_version(message));
-  decoder->message_type = ns(Message_header_type(message));
-  decoder->body_size_bytes = ns(Message_bodyLength(message));
+  int64_t offset =
+      __flatbuffers_voffset_read_from_pe(table->buf + table->vtable + 4 + 2 * id);
+  if (offset == 0) {
+    return 0;
+  }
 
-  private_data->last_message = ns(Message_header_get(message));
-  return NANOARROW_OK;
+  if ((offset + size_bytes) > table->table_size ||
+      ((table->table + offset) % size_bytes) != 0) {
+    return -1;
+  }
+
+  return table->table + offset;
 }
 
-ArrowErrorCode ArrowIpcDecoderDecodeHeader(struct ArrowIpcDecoder* decoder,
-                                           struct ArrowBufferView data,
-                                           struct ArrowError* error) {
-  struct ArrowIpcDecoderPrivate* private_data =
-      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+// Checks that the vector of 8-byte aligned structs referred to by the uoffset at
+// position ref is within the buffer
+static int ArrowIpcFlatbufferCheckStructVector(const uint8_t* buf, int64_t buf_size,
+                                               int64_t ref, int64_t elem_size_bytes) {
+  int64_t vec = ref + (int64_t)__flatbuffers_uoffset_read_from_pe(buf + ref);
+  if (vec <= ref || ((vec + 4) % 8) != 0 || vec > (buf_size - 4)) {
+    return 0;
+  }
 
-  ArrowIpcDecoderResetHeaderInfo(decoder);
-  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderReadHeaderPrefix(
-      decoder, &data, &decoder->header_size_bytes, error));
+  int64_t n = __flatbuffers_uoffset_read_from_pe(buf + vec);
+  return n <= ((buf_size - vec - 4) / elem_size_bytes);
+}
 
-  // Check that data contains at least the entire header (return ESPIPE to signal
-  // that reading more data may help).
-  int64_t message_body_size = decoder->header_size_bytes - kMessageHeaderPrefixSize;
-  if (data.size_bytes < message_body_size) {
-    ArrowErrorSet(error,
-                  "Expected >= %ld bytes of remaining data but found %ld bytes in buffer",
-                  (long)message_body_size + kMessageHeaderPrefixSize,
-                  (long)data.size_bytes + kMessageHeaderPrefixSize);
-    return ESPIPE;
+// Checks the fields of a RecordBatch table that are accessed when decoding it
+static int ArrowIpcDecoderCheckRecordBatch(const uint8_t* buf, int64_t buf_size,
+                                           int64_t ref) {
+  struct ArrowIpcFlatbufferTable batch;
+  if (!ArrowIpcFlatbufferCheckTable(buf, buf_size, ref, &batch)) {
+    return 0;
   }
 
-  ns(Message_table_t) message = ns(Message_as_root(data.data.as_uint8));
-  if (!message) {
+  // length
+  if (ArrowIpcFlatbufferField(&batch, 0, 8) < 0) {
+    return 0;
+  }
+
+  // nodes and buffers (both vectors of 16-byte structs)
+  for (int id = 1; id <= 2; id++) {
+    int64_t pos = ArrowIpcFlatbufferField(&batch, id, 4);
+    if (pos < 0) {
+      return 0;
+    } else if (pos > 0 && !ArrowIpcFlatbufferCheckStructVector(buf, buf_size, pos, 16)) {
+      return 0;
+    }
+  }
+
+  // compression
+  int64_t pos = ArrowIpcFlatbufferField(&batch, 3, 4);
+  if (pos < 0) {
+    return 0;
+  } else if (pos > 0) {
+    struct ArrowIpcFlatbufferTable compression;
+    if (!ArrowIpcFlatbufferCheckTable(buf, buf_size, pos, &compression) ||
+        ArrowIpcFlatbufferField(&compression, 0, 1) < 0) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+// Checks the parts of a RecordBatch or DictionaryBatch message that are accessed when
+// decoding it. Returns ENOTSUP for other message types (which must be fully verified)
+// or EINVAL if any check fails.
+static int ArrowIpcDecoderCheckMessage(const uint8_t* buf, int64_t buf_size) {
+  // As for flatbuffer verification, the buffer must be aligned and large enough to
+  // contain the root uoffset and a file identifier
+  if ((((uintptr_t)buf) % 4) != 0 || buf_size < 8) {
     return EINVAL;
   }
 
-  // Read some basic information from the message
-  int32_t metadata_version = ns(Message_version(message));
-  decoder->message_type = ns(Message_header_type(message));
-  decoder->body_size_bytes = ns(Message_bodyLength(message));
+  struct ArrowIpcFlatbufferTable message;
+  if (!ArrowIpcFlatbufferCheckTable(buf, buf_size, 0, &message)) {
+    return EINVAL;
+  }
 
-  switch (decoder->metadata_version) {
-    case ns(MetadataVersion_V5):
-      break;
-    case ns(MetadataVersion_V1):
-    case ns(MetadataVersion_V2):
-    case ns(MetadataVersion_V3):
-    case ns(MetadataVersion_V4):
-      ArrowErrorSet(error, "Expected metadata version V5 but found %s",
-                    ns(MetadataVersion_name(decoder->metadata_version)));
-      break;
-    default:
-      ArrowErrorSet(error, "Unexpected value for Message metadata version (%d)",
-                    decoder->metadata_version);
-      return EINVAL;
+  int64_t header_type_pos = ArrowIpcFlatbufferField(&message, 1, 1);
+  int64_t header_pos = ArrowIpcFlatbufferField(&message, 2, 4);
+  if (ArrowIpcFlatbufferField(&message, 0, 2) < 0 || header_type_pos < 0 ||
+      header_pos < 0 || ArrowIpcFlatbufferField(&message, 3, 8) < 0) {
+    return EINVAL;
   }
 
-  flatbuffers_generic_t message_header = ns(Message_header_get(message));
-  switch (decoder->message_type) {
-    case ns(MessageHeader_Schema):
+  uint8_t header_type = header_type_pos > 0 ? buf[header_type_pos] : 0;
+  switch (header_type) {
+    case ns(MessageHeader_RecordBatch):
+      if (header_pos == 0 ||
+          !ArrowIpcDecoderCheckRecordBatch(buf, buf_size, header_pos)) {
+        return EINVAL;
+      }
+      return NANOARROW_OK;
+    case ns(MessageHeader_DictionaryBatch): {
+      struct ArrowIpcFlatbufferTable batch;
+      if (header_pos == 0 ||
+          !ArrowIpcFlatbufferCheckTable(buf, buf_size, header_pos, &batch)) {
+        return EINVAL;
+      }
+
+      // id, data, and isDelta
+      int64_t data_pos = ArrowIpcFlatbufferField(&batch, 1, 4);
+      if (ArrowIpcFlatbufferField(&batch, 0, 8) < 0 || data_pos < 0 ||
+          ArrowIpcFlatbufferField(&batch, 2, 1) < 0 ||
+          (data_pos > 0 && !ArrowIpcDecoderCheckRecordBatch(buf, buf_size, data_pos))) {
+        return EINVAL;
+      }
+      return NANOARROW_OK;
+    }
+    default:
+      return ENOTSUP;
+  }
+}
+
+// Returns the header type of the Message in buf or -1 if the Message table or its
+// header_type field does not lie within the buffer
+static int ArrowIpcDecoderPeekMessageType(const uint8_t* buf, int64_t buf_size) {
+  struct ArrowIpcFlatbufferTable message;
+  if ((((uintptr_t)buf) % 4) != 0 || buf_size < 8 ||
+      !ArrowIpcFlatbufferCheckTable(buf, buf_size, 0, &message)) {
+    return -1;
+  }
+
+  int64_t header_type_pos = ArrowIpcFlatbufferField(&message, 1, 1);
+  if (header_type_pos < 0) {
+    return -1;
+  }
+
+  return header_type_pos > 0 ? buf[header_type_pos] : 0;
+}
+
+// The flatbuffer bytes of a Schema message that passed verification and the result
+// of decoding it
+struct ArrowIpcSchemaCacheEntry {
+  uint64_t hash;
+  struct ArrowBuffer message;
+  struct ArrowSchema schema;
+  // The int64_t dictionary ids of schema in depth-first field order
+  struct ArrowBuffer dictionary_ids;
+};
+
+struct ArrowIpcSchemaCachePrivate {
+  ArrowSpinLock lock;
+  int64_t max_entries;
+  int64_t n_entries;
+  // The entry replaced by the next insertion once the cache is full
+  int64_t next_entry;
+  int64_t n_hits;
+  int64_t n_misses;
+  struct ArrowIpcSchemaCacheEntry* entries;
+};
+
+static void ArrowIpcSchemaCacheEntryReset(struct ArrowIpcSchemaCacheEntry* entry) {
+  ArrowBufferReset(&entry->message);
+  ArrowBufferReset(&entry->dictionary_ids);
+  if (entry->schema.release != NULL) {
+    entry->schema.release(&entry->schema);
+  }
+}
+
+ArrowErrorCode ArrowIpcSchemaCacheInit(struct ArrowIpcSchemaCache* cache,
+                                       int64_t max_entries) {
+  if (max_entries < 1) {
+    return EINVAL;
+  }
+
+  struct ArrowIpcSchemaCachePrivate* private_data =
+      (struct ArrowIpcSchemaCachePrivate*)ArrowMalloc(
+          sizeof(struct ArrowIpcSchemaCachePrivate));
+  if (private_data == NULL) {
+    return ENOMEM;
+  }
+
+  private_data->entries = (struct ArrowIpcSchemaCacheEntry*)ArrowMalloc(
+      max_entries * sizeof(struct ArrowIpcSchemaCacheEntry));
+  if (private_data->entries == NULL) {
+    ArrowFree(private_data);
+    return ENOMEM;
+  }
+
+  ArrowSpinLockInit(&private_data->lock);
+  private_data->max_entries = max_entries;
+  private_data->n_entries = 0;
+  private_data->next_entry = 0;
+  private_data->n_hits = 0;
+  private_data->n_misses = 0;
+  cache->private_data = private_data;
+  return NANOARROW_OK;
+}
+
+void ArrowIpcSchemaCacheReset(struct ArrowIpcSchemaCache* cache) {
+  struct ArrowIpcSchemaCachePrivate* private_data =
+      (struct ArrowIpcSchemaCachePrivate*)cache->private_data;
+  if (private_data == NULL) {
+    return;
+  }
+
+  for (int64_t i = 0; i < private_data->n_entries; i++) {
+    ArrowIpcSchemaCacheEntryReset(private_data->entries + i);
+  }
+
+  ArrowFree(private_data->entries);
+  ArrowFree(private_data);
+  cache->private_data = NULL;
+}
+
+void ArrowIpcSchemaCacheGetStats(struct ArrowIpcSchemaCache* cache,
+                                 struct ArrowIpcSchemaCacheStats* out) {
+  struct ArrowIpcSchemaCachePrivate* private_data =
+      (struct ArrowIpcSchemaCachePrivate*)cache->private_data;
+  ArrowSpinLockAcquire(&private_data->lock);
+  out->n_entries = private_data->n_entries;
+  out->n_hits = private_data->n_hits;
+  out->n_misses = private_data->n_misses;
+  ArrowSpinLockRelease(&private_data->lock);
+}
+
+// 64-bit FNV-1a
+static uint64_t ArrowIpcSchemaCacheHash(struct ArrowBufferView data) {
+  uint64_t hash = 14695981039346656037ULL;
+  for (int64_t i = 0; i < data.size_bytes; i++) {
+    hash ^= data.data.as_uint8[i];
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+// Must be called with the lock held
+static struct ArrowIpcSchemaCacheEntry* ArrowIpcSchemaCacheFind(
+    struct ArrowIpcSchemaCachePrivate* private_data, uint64_t hash,
+    struct ArrowBufferView data) {
+  for (int64_t i = 0; i < private_data->n_entries; i++) {
+    struct ArrowIpcSchemaCacheEntry* entry = private_data->entries + i;
+    if (entry->hash == hash && entry->message.size_bytes == data.size_bytes &&
+        memcmp(entry->message.data, data.data.data, data.size_bytes) == 0) {
+      return entry;
+    }
+  }
+
+  return NULL;
+}
+
+// Sets found to a non-zero value if the Schema message in data is in the cache. If out
+// is non-NULL, the lookup is counted in the cache statistics and (if found) the cached
+// schema and dictionary ids are copied to out and dictionary_ids.
+static int ArrowIpcSchemaCacheLookup(struct ArrowIpcSchemaCache* cache,
+                                     struct ArrowBufferView data,
+                                     struct ArrowSchema* out,
+                                     struct ArrowBuffer* dictionary_ids, int* found,
+                                     struct ArrowError* error) {
+  struct ArrowIpcSchemaCachePrivate* private_data =
+      (struct ArrowIpcSchemaCachePrivate*)cache->private_data;
+  uint64_t hash = ArrowIpcSchemaCacheHash(data);
+  int result = NANOARROW_OK;
+
+  ArrowSpinLockAcquire(&private_data->lock);
+  struct ArrowIpcSchemaCacheEntry* entry =
+      ArrowIpcSchemaCacheFind(private_data, hash, data);
+  *found = entry != NULL;
+  if (out != NULL && entry == NULL) {
+    private_data->n_misses++;
+  } else if (out != NULL) {
+    private_data->n_hits++;
+    dictionary_ids->size_bytes = 0;
+    result = ArrowBufferAppend(dictionary_ids, entry->dictionary_ids.data,
+                               entry->dictionary_ids.size_bytes);
+    if (result == NANOARROW_OK) {
+      result = ArrowSchemaDeepCopy(&entry->schema, out);
+    }
+  }
+  ArrowSpinLockRelease(&private_data->lock);
+
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "Failed to copy cached schema");
+  }
+
+  return result;
+}
+
+// Adds a copy of a verified Schema message and the result of decoding it to the cache.
+// Caching is best-effort: the message is not cached if it cannot be copied.
+static void ArrowIpcSchemaCacheInsert(struct ArrowIpcSchemaCache* cache,
+                                      struct ArrowBufferView data,
+                                      struct ArrowSchema* schema,
+                                      struct ArrowBuffer* dictionary_ids) {
+  struct ArrowIpcSchemaCachePrivate* private_data =
+      (struct ArrowIpcSchemaCachePrivate*)cache->private_data;
+
+  // Copy outside the lock
+  struct ArrowIpcSchemaCacheEntry entry;
+  entry.hash = ArrowIpcSchemaCacheHash(data);
+  ArrowBufferInit(&entry.message);
+  ArrowBufferInit(&entry.dictionary_ids);
+  entry.schema.release = NULL;
+  if (ArrowBufferAppend(&entry.message, data.data.data, data.size_bytes) !=
+          NANOARROW_OK ||
+      ArrowBufferAppend(&entry.dictionary_ids, dictionary_ids->data,
+                        dictionary_ids->size_bytes) != NANOARROW_OK ||
+      ArrowSchemaDeepCopy(schema, &entry.schema) != NANOARROW_OK) {
+    ArrowIpcSchemaCacheEntryReset(&entry);
+    return;
+  }
+
+  // Another decoder may have inserted the same message since it was looked up
+  ArrowSpinLockAcquire(&private_data->lock);
+  if (ArrowIpcSchemaCacheFind(private_data, entry.hash, data) != NULL) {
+    ArrowSpinLockRelease(&private_data->lock);
+    ArrowIpcSchemaCacheEntryReset(&entry);
+    return;
+  }
+
+  struct ArrowIpcSchemaCacheEntry replaced;
+  replaced.schema.release = NULL;
+  if (private_data->n_entries < private_data->max_entries) {
+    ArrowBufferInit(&replaced.message);
+    ArrowBufferInit(&replaced.dictionary_ids);
+    private_data->entries[private_data->n_entries] = entry;
+    private_data->n_entries++;
+  } else {
+    replaced = private_data->entries[private_data->next_entry];
+    private_data->entries[private_data->next_entry] = entry;
+    private_data->next_entry = (private_data->next_entry + 1) % private_data->max_entries;
+  }
+  ArrowSpinLockRelease(&private_data->lock);
+
+  ArrowIpcSchemaCacheEntryReset(&replaced);
+}
+
+void ArrowIpcDecoderSetSchemaCache(struct ArrowIpcDecoder* decoder,
+                                   struct ArrowIpcSchemaCache* cache) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+  private_data->schema_cache = cache;
+}
+
+// Verifies the flatbuffer bytes of a Message (i.e., without the encapsulation prefix)
+static int ArrowIpcDecoderVerifyMessageInternal(struct ArrowIpcDecoder* decoder,
+                                                struct ArrowBufferView message_data,
+                                                struct ArrowError* error) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+  const uint8_t* buf = message_data.data.as_uint8;
+  int64_t buf_size = message_data.size_bytes;
+
+  // Check trusted RecordBatch and DictionaryBatch messages without running
+  // flatbuffers verification
+  int result = ENOTSUP;
+  if (private_data->verification_level == NANOARROW_IPC_VERIFICATION_LEVEL_TRUSTED) {
+    result = ArrowIpcDecoderCheckMessage(buf, buf_size);
+    if (result == EINVAL) {
+      ArrowErrorSet(error, "Message flatbuffer bounds check failed");
+      return EINVAL;
+    }
+  }
+
+  // Schema messages whose bytes are in the cache have already been verified
+  if (result != NANOARROW_OK && private_data->schema_cache != NULL &&
+      ArrowIpcDecoderPeekMessageType(buf, buf_size) == ns(MessageHeader_Schema)) {
+    int found = 0;
+    NANOARROW_RETURN_NOT_OK(ArrowIpcSchemaCacheLookup(
+        private_data->schema_cache, message_data, NULL, NULL, &found, error));
+    if (found) {
+      result = NANOARROW_OK;
+    }
+  }
+
+  // Run flatbuffers verification
+  if (result != NANOARROW_OK &&
+      ns(Message_verify_as_root(buf, buf_size) != flatcc_verify_ok)) {
+    ArrowErrorSet(error, "Message flatbuffer verification failed");
+    return EINVAL;
+  }
+
+  // Read some basic information from the message
+  ns(Message_table_t) message = ns(Message_as_root(buf));
+  decoder->metadata_version = ns(Message_version(message));
+  decoder->message_type = ns(Message_header_type(message));
+  decoder->body_size_bytes = ns(Message_bodyLength(message));
+
+  private_data->last_message = ns(Message_header_get(message));
+  private_data->last_message_data = message_data;
+  private_data->verified_message_data = message_data;
+  return NANOARROW_OK;
+}
+
+static int ArrowIpcDecoderVerifyMessage(struct ArrowIpcDecoder* decoder,
+                                        struct ArrowBufferView message_data,
+                                        struct ArrowError* error) {
+  NANOARROW_IPC_STATS_TIMER_START(start);
+  int result = ArrowIpcDecoderVerifyMessageInternal(decoder, message_data, error);
+  NANOARROW_IPC_STATS_TIMER_STOP((struct ArrowIpcDecoderPrivate*)decoder->private_data,
+                                 verify_ns, start);
+  return result;
+}
+
+ArrowErrorCode ArrowIpcDecoderVerifyHeader(struct ArrowIpcDecoder* decoder,
+                                           struct ArrowBufferView data,
+                                           struct ArrowError* error) {
+  ArrowIpcDecoderResetHeaderInfo(decoder);
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderReadHeaderPrefix(
+      decoder, &data, &decoder->header_size_bytes, error));
+
+  // Check that data contains at least the entire header (return ESPIPE to signal
+  // that reading more data may help).
+  int64_t message_body_size = decoder->header_size_bytes - kMessageHeaderPrefixSize;
+  if (data.size_bytes < message_body_size) {
+    ArrowErrorSet(error,
+                  "Expected >= %ld bytes of remaining data but found %ld bytes in buffer",
+                  (long)message_body_size + kMessageHeaderPrefixSize,
+                  (long)data.size_bytes + kMessageHeaderPrefixSize);
+    return ESPIPE;
+  }
+
+  data.size_bytes = message_body_size;
+  return ArrowIpcDecoderVerifyMessage(decoder, data, error);
+}
+
+// Decodes the flatbuffer bytes of a Message (i.e., without the encapsulation prefix)
+static int ArrowIpcDecoderDecodeMessageInternal(struct ArrowIpcDecoder* decoder,
+                                                struct ArrowBufferView message_data,
+                                                struct ArrowError* error) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+
+  ns(Message_table_t) message = ns(Message_as_root(message_data.data.as_uint8));
+  if (!message) {
+    return EINVAL;
+  }
+
+  // Read some basic information from the message
+  int32_t metadata_version = ns(Message_version(message));
+  decoder->message_type = ns(Message_header_type(message));
+  decoder->body_size_bytes = ns(Message_bodyLength(message));
+
+  switch (decoder->metadata_version) {
+    case ns(MetadataVersion_V5):
+      break;
+    case ns(MetadataVersion_V1):
+    case ns(MetadataVersion_V2):
+    case ns(MetadataVersion_V3):
+    case ns(MetadataVersion_V4):
+      ArrowErrorSet(error, "Expected metadata version V5 but found %s",
+                    ns(MetadataVersion_name(decoder->metadata_version)));
+      break;
+    default:
+      ArrowErrorSet(error, "Unexpected value for Message metadata version (%d)",
+                    decoder->metadata_version);
+      return EINVAL;
+  }
+
+  flatbuffers_generic_t message_header = ns(Message_header_get(message));
+  switch (decoder->message_type) {
+    case ns(MessageHeader_Schema):
       NANOARROW_RETURN_NOT_OK(
           ArrowIpcDecoderDecodeSchemaHeader(decoder, message_header, error));
       break;
@@ -1082,6 +1904,9 @@ ArrowErrorCode ArrowIpcDecoderDecodeHeader(struct ArrowIpcDecoder* decoder,
           ArrowIpcDecoderDecodeRecordBatchHeader(decoder, message_header, error));
       break;
     case ns(MessageHeader_DictionaryBatch):
+      NANOARROW_RETURN_NOT_OK(
+          ArrowIpcDecoderDecodeDictionaryBatchHeader(decoder, message_header, error));
+      break;
     case ns(MessageHeader_Tensor):
     case ns(MessageHeader_SparseTensor):
       ArrowErrorSet(error, "Unsupported message type: '%s'",
@@ -1093,12 +1918,99 @@ ArrowErrorCode ArrowIpcDecoderDecodeHeader(struct ArrowIpcDecoder* decoder,
   }
 
   private_data->last_message = message_header;
+  private_data->last_message_data = message_data;
+  NANOARROW_IPC_STATS_ADD(private_data, n_messages, 1);
   return NANOARROW_OK;
 }
 
-ArrowErrorCode ArrowIpcDecoderDecodeSchema(struct ArrowIpcDecoder* decoder,
-                                           struct ArrowSchema* out,
+static int ArrowIpcDecoderDecodeMessage(struct ArrowIpcDecoder* decoder,
+                                        struct ArrowBufferView message_data,
+                                        struct ArrowError* error) {
+  NANOARROW_IPC_STATS_TIMER_START(start);
+  int result = ArrowIpcDecoderDecodeMessageInternal(decoder, message_data, error);
+  NANOARROW_IPC_STATS_TIMER_STOP((struct ArrowIpcDecoderPrivate*)decoder->private_data,
+                                 decode_header_ns, start);
+  return result;
+}
+
+static ArrowErrorCode ArrowIpcDecoderDecodeHeaderInternal(
+    struct ArrowIpcDecoder* decoder, struct ArrowBufferView data,
+    struct ArrowError* error) {
+  ArrowIpcDecoderResetHeaderInfo(decoder);
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderReadHeaderPrefix(
+      decoder, &data, &decoder->header_size_bytes, error));
+
+  // Check that data contains at least the entire header (return ESPIPE to signal
+  // that reading more data may help).
+  int64_t message_body_size = decoder->header_size_bytes - kMessageHeaderPrefixSize;
+  if (data.size_bytes < message_body_size) {
+    ArrowErrorSet(error,
+                  "Expected >= %ld bytes of remaining data but found %ld bytes in buffer",
+                  (long)message_body_size + kMessageHeaderPrefixSize,
+                  (long)data.size_bytes + kMessageHeaderPrefixSize);
+    return ESPIPE;
+  }
+
+  data.size_bytes = message_body_size;
+  return ArrowIpcDecoderDecodeMessage(decoder, data, error);
+}
+
+ArrowErrorCode ArrowIpcDecoderDecodeHeader(struct ArrowIpcDecoder* decoder,
+                                           struct ArrowBufferView data,
                                            struct ArrowError* error) {
+  NANOARROW_TRACE(NANOARROW_TRACE_IPC_DECODE_HEADER_BEGIN, data.size_bytes, 0);
+  int result = ArrowIpcDecoderDecodeHeaderInternal(decoder, data, error);
+  NANOARROW_TRACE(NANOARROW_TRACE_IPC_DECODE_HEADER_END, result, 0);
+  return result;
+}
+
+ArrowErrorCode ArrowIpcDecoderDecodeFlightDataHeader(struct ArrowIpcDecoder* decoder,
+                                                     struct ArrowBufferView data_header,
+                                                     struct ArrowError* error) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+
+  ArrowIpcDecoderResetHeaderInfo(decoder);
+
+  // Flatbuffer access requires an aligned buffer, which the bytes of a protobuf field
+  // are not guaranteed to be
+  if ((((uintptr_t)data_header.data.data) % 8) != 0) {
+    private_data->header_copy.size_bytes = 0;
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+        ArrowBufferAppend(&private_data->header_copy, data_header.data.data,
+                          data_header.size_bytes),
+        error);
+    data_header.data.data = private_data->header_copy.data;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderVerifyMessage(decoder, data_header, error));
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeMessage(decoder, data_header, error));
+  decoder->header_size_bytes = data_header.size_bytes;
+  return NANOARROW_OK;
+}
+
+static int ArrowIpcDecoderSchemaFromFlatbuffer(ns(Schema_table_t) schema,
+                                               struct ArrowSchema* out,
+                                               struct ArrowError* error);
+
+// Records the dictionary ids of schema such that they can be assigned to the
+// dictionary-encoded fields of the next schema passed to ArrowIpcDecoderSetSchema()
+static int ArrowIpcDecoderSetSchemaDictionaryIds(struct ArrowIpcDecoder* decoder,
+                                                 ns(Schema_table_t) schema,
+                                                 struct ArrowError* error) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+
+  private_data->schema_dictionary_ids.size_bytes = 0;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowIpcDecoderCollectDictionaryIds(ns(Schema_fields(schema)),
+                                          &private_data->schema_dictionary_ids),
+      error);
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowIpcDecoderDecodeSchemaInternal(
+    struct ArrowIpcDecoder* decoder, struct ArrowSchema* out, struct ArrowError* error) {
   struct ArrowIpcDecoderPrivate* private_data =
       (struct ArrowIpcDecoderPrivate*)decoder->private_data;
 
@@ -1108,8 +2020,44 @@ ArrowErrorCode ArrowIpcDecoderDecodeSchema(struct ArrowIpcDecoder* decoder,
     return EINVAL;
   }
 
+  struct ArrowIpcSchemaCache* cache = private_data->schema_cache;
+  if (cache != NULL) {
+    int found = 0;
+    NANOARROW_RETURN_NOT_OK(ArrowIpcSchemaCacheLookup(
+        cache, private_data->last_message_data, out,
+        &private_data->schema_dictionary_ids, &found, error));
+    if (found) {
+      return NANOARROW_OK;
+    }
+  }
+
   ns(Schema_table_t) schema = (ns(Schema_table_t))private_data->last_message;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderSetSchemaDictionaryIds(decoder, schema, error));
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderSchemaFromFlatbuffer(schema, out, error));
+
+  struct ArrowBufferView message_data = private_data->last_message_data;
+  if (cache != NULL &&
+      message_data.data.data == private_data->verified_message_data.data.data &&
+      message_data.size_bytes == private_data->verified_message_data.size_bytes) {
+    ArrowIpcSchemaCacheInsert(cache, message_data, out,
+                              &private_data->schema_dictionary_ids);
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcDecoderDecodeSchema(struct ArrowIpcDecoder* decoder,
+                                           struct ArrowSchema* out,
+                                           struct ArrowError* error) {
+  NANOARROW_TRACE(NANOARROW_TRACE_IPC_DECODE_SCHEMA_BEGIN, 0, 0);
+  int result = ArrowIpcDecoderDecodeSchemaInternal(decoder, out, error);
+  NANOARROW_TRACE(NANOARROW_TRACE_IPC_DECODE_SCHEMA_END, result, 0);
+  return result;
+}
 
+static int ArrowIpcDecoderSchemaFromFlatbuffer(ns(Schema_table_t) schema,
+                                               struct ArrowSchema* out,
+                                               struct ArrowError* error) {
   ns(Field_vec_t) fields = ns(Schema_fields(schema));
   int64_t n_fields = ns(Schema_vec_len(fields));
 
@@ -1154,6 +2102,7 @@ static void ArrowIpcDecoderInitFields(struct ArrowIpcField* fields,
   field->array_view = array_view;
   field->array = array;
   field->buffer_offset = *n_buffers;
+  field->dictionary_i = -1;
 
   for (int i = 0; i < 3; i++) {
     *n_buffers += array_view->layout.buffer_type[i] != NANOARROW_BUFFER_TYPE_NONE;
@@ -1167,35 +2116,133 @@ static void ArrowIpcDecoderInitFields(struct ArrowIpcField* fields,
   }
 }
 
-ArrowErrorCode ArrowIpcDecoderSetSchema(struct ArrowIpcDecoder* decoder,
-                                        struct ArrowSchema* schema,
-                                        struct ArrowError* error) {
-  struct ArrowIpcDecoderPrivate* private_data =
-      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+static void ArrowIpcDecoderCountDictionaryFields(struct ArrowSchema* schema,
+                                                 int64_t* n_dictionary_fields) {
+  *n_dictionary_fields += schema->dictionary != NULL;
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    ArrowIpcDecoderCountDictionaryFields(schema->children[i], n_dictionary_fields);
+  }
+}
 
-  // Reset previously allocated schema-specific resources
-  private_data->n_buffers = 0;
-  private_data->n_fields = 0;
-  ArrowArrayViewReset(&private_data->array_view);
-  if (private_data->array.release != NULL) {
-    private_data->array.release(&private_data->array);
+static int ArrowIpcSchemaHasDictionary(struct ArrowSchema* schema) {
+  if (schema->dictionary != NULL) {
+    return 1;
   }
-  if (private_data->fields != NULL) {
-    ArrowFree(private_data->fields);
+
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    if (ArrowIpcSchemaHasDictionary(schema->children[i])) {
+      return 1;
+    }
   }
 
-  // Allocate Array and ArrayView based on schema without moving the schema.
-  // This will fail if the schema is not valid.
-  NANOARROW_RETURN_NOT_OK(
-      ArrowArrayViewInitFromSchema(&private_data->array_view, schema, error));
-  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromArrayView(&private_data->array,
-                                                      &private_data->array_view, error));
+  return 0;
+}
 
-  // Root must be a struct
-  if (private_data->array_view.storage_type != NANOARROW_TYPE_STRUCT) {
-    ArrowErrorSet(error, "schema must be a struct type");
-    return EINVAL;
-  }
+static int ArrowIpcDecoderInitDictionary(struct ArrowIpcDictionary* dictionary,
+                                         int64_t id, struct ArrowSchema* value_schema,
+                                         struct ArrowError* error) {
+  dictionary->id = id;
+
+  if (ArrowIpcSchemaHasDictionary(value_schema)) {
+    ArrowErrorSet(error, "Dictionary-encoded dictionary values are not supported");
+    return ENOTSUP;
+  }
+
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowSchemaDeepCopy(value_schema, &dictionary->schema), error);
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowIpcDecoderInit(&dictionary->decoder), error);
+
+  // The RecordBatch wrapped by a DictionaryBatch message has a single column
+  // containing the dictionary values
+  struct ArrowSchema batch_schema;
+  ArrowSchemaInit(&batch_schema);
+  int result = ArrowSchemaSetTypeStruct(&batch_schema, 1);
+  if (result == NANOARROW_OK) {
+    batch_schema.children[0]->release(batch_schema.children[0]);
+    result = ArrowSchemaDeepCopy(value_schema, batch_schema.children[0]);
+  }
+
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "Failed to allocate schema for dictionary with id %ld",
+                  (long)id);
+    batch_schema.release(&batch_schema);
+    return result;
+  }
+
+  result = ArrowIpcDecoderSetSchema(&dictionary->decoder, &batch_schema, error);
+  batch_schema.release(&batch_schema);
+  return result;
+}
+
+// Assigns a dictionary to each field in the same depth-first order as
+// ArrowIpcDecoderInitFields(), initializing a dictionary the first time its id is seen
+static int ArrowIpcDecoderInitDictionaries(struct ArrowIpcDecoderPrivate* private_data,
+                                           struct ArrowSchema* schema,
+                                           const int64_t* ids, int64_t* field_i,
+                                           int64_t* dictionary_field_i,
+                                           struct ArrowError* error) {
+  struct ArrowIpcField* field = private_data->fields + (*field_i);
+  *field_i += 1;
+
+  if (schema->dictionary != NULL) {
+    int64_t id = ids != NULL ? ids[*dictionary_field_i] : *dictionary_field_i;
+    *dictionary_field_i += 1;
+
+    for (int64_t i = 0; i < private_data->n_dictionaries; i++) {
+      if (private_data->dictionaries[i].id == id) {
+        field->dictionary_i = i;
+        break;
+      }
+    }
+
+    if (field->dictionary_i == -1) {
+      field->dictionary_i = private_data->n_dictionaries;
+      private_data->n_dictionaries += 1;
+      NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderInitDictionary(
+          private_data->dictionaries + field->dictionary_i, id, schema->dictionary,
+          error));
+    }
+  }
+
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderInitDictionaries(
+        private_data, schema->children[i], ids, field_i, dictionary_field_i, error));
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcDecoderSetSchema(struct ArrowIpcDecoder* decoder,
+                                        struct ArrowSchema* schema,
+                                        struct ArrowError* error) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+
+  // Reset previously allocated schema-specific resources
+  private_data->n_buffers = 0;
+  private_data->n_fields = 0;
+  ArrowIpcDecoderResetDictionaries(private_data);
+  ArrowIpcDecoderResetProjection(private_data);
+  ArrowArrayViewReset(&private_data->array_view);
+  if (private_data->array.release != NULL) {
+    private_data->array.release(&private_data->array);
+  }
+  if (private_data->fields != NULL) {
+    ArrowFree(private_data->fields);
+  }
+
+  // Allocate Array and ArrayView based on schema without moving the schema.
+  // This will fail if the schema is not valid.
+  NANOARROW_RETURN_NOT_OK(
+      ArrowArrayViewInitFromSchema(&private_data->array_view, schema, error));
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromArrayView(&private_data->array,
+                                                      &private_data->array_view, error));
+
+  // Root must be a struct
+  if (private_data->array_view.storage_type != NANOARROW_TYPE_STRUCT) {
+    ArrowErrorSet(error, "schema must be a struct type");
+    return EINVAL;
+  }
 
   // Walk tree and calculate how many fields we need to allocate
   ArrowIpcDecoderCountFields(schema, &private_data->n_fields);
@@ -1212,6 +2259,227 @@ ArrowErrorCode ArrowIpcDecoderSetSchema(struct ArrowIpcDecoder* decoder,
   ArrowIpcDecoderInitFields(private_data->fields, &private_data->array_view,
                             &private_data->array, &field_i, &private_data->n_buffers);
 
+  // Assign each dictionary-encoded field to a dictionary. Ids recorded from the last
+  // decoded Schema are only used if they were recorded for the same number of
+  // dictionary-encoded fields; otherwise, the nth such field uses id n.
+  int64_t n_dictionary_fields = 0;
+  ArrowIpcDecoderCountDictionaryFields(schema, &n_dictionary_fields);
+  if (n_dictionary_fields == 0) {
+    return NANOARROW_OK;
+  }
+
+  private_data->dictionaries = (struct ArrowIpcDictionary*)ArrowMalloc(
+      n_dictionary_fields * sizeof(struct ArrowIpcDictionary));
+  if (private_data->dictionaries == NULL) {
+    ArrowErrorSet(error, "Failed to allocate decoder->dictionaries");
+    return ENOMEM;
+  }
+  memset(private_data->dictionaries, 0,
+         n_dictionary_fields * sizeof(struct ArrowIpcDictionary));
+
+  const int64_t* ids = NULL;
+  if ((private_data->schema_dictionary_ids.size_bytes / (int64_t)sizeof(int64_t)) ==
+      n_dictionary_fields) {
+    ids = (const int64_t*)private_data->schema_dictionary_ids.data;
+  }
+
+  field_i = 0;
+  int64_t dictionary_field_i = 0;
+  return ArrowIpcDecoderInitDictionaries(private_data, schema, ids, &field_i,
+                                         &dictionary_field_i, error);
+}
+
+static int64_t ArrowIpcArrayViewCountNodes(struct ArrowArrayView* array_view) {
+  int64_t n_nodes = 1;
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    n_nodes += ArrowIpcArrayViewCountNodes(array_view->children[i]);
+  }
+
+  return n_nodes;
+}
+
+// Records the node of the projected tree at array_view/array as the field at field_i
+// and recurses into its children. The node corresponds to the projection node at
+// *node_i or, if node_i is NULL, is a descendant of a node that keeps all of its
+// children (whose fields then follow field_i in the same order).
+static void ArrowIpcDecoderInitProjectedFields(
+    struct ArrowIpcDecoderPrivate* private_data,
+    const struct ArrowSchemaProjection* projection, int64_t* node_i, int64_t field_i,
+    struct ArrowArrayView* array_view, struct ArrowArray* array, int64_t* projected_i) {
+  struct ArrowIpcProjectedField* projected =
+      private_data->projected_fields + (*projected_i);
+  projected->array_view = array_view;
+  projected->array = array;
+  projected->field_i = field_i;
+  *projected_i += 1;
+
+  int64_t n_children = -1;
+  if (node_i != NULL) {
+    n_children = projection->n_children[*node_i];
+    *node_i += 1;
+  }
+
+  if (n_children == -1) {
+    int64_t child_field_i = field_i + 1;
+    for (int64_t i = 0; i < array_view->n_children; i++) {
+      ArrowIpcDecoderInitProjectedFields(private_data, NULL, NULL, child_field_i,
+                                         array_view->children[i], array->children[i],
+                                         projected_i);
+      child_field_i += ArrowIpcArrayViewCountNodes(array_view->children[i]);
+    }
+
+    return;
+  }
+
+  struct ArrowArrayView* source = private_data->fields[field_i].array_view;
+  for (int64_t i = 0; i < n_children; i++) {
+    int64_t child_field_i = field_i + 1;
+    for (int64_t j = 0; j < projection->child_index[*node_i]; j++) {
+      child_field_i += ArrowIpcArrayViewCountNodes(source->children[j]);
+    }
+
+    ArrowIpcDecoderInitProjectedFields(private_data, projection, node_i, child_field_i,
+                                       array_view->children[i], array->children[i],
+                                       projected_i);
+  }
+}
+
+static int ArrowIpcDecoderSetProjectionInternal(
+    struct ArrowIpcDecoderPrivate* private_data, struct ArrowSchema* schema,
+    const struct ArrowSchemaProjection* projection, struct ArrowError* error) {
+  int64_t n_fields = 0;
+  ArrowIpcDecoderCountFields(schema, &n_fields);
+  if (private_data->n_fields == 0 || n_fields != private_data->n_fields) {
+    ArrowErrorSet(error, "Expected the schema most recently set with %ld fields",
+                  (long)private_data->n_fields);
+    return EINVAL;
+  }
+
+  // This will fail if projection is not compatible with schema
+  struct ArrowSchema projected_schema;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowSchemaProject(schema, projection, &projected_schema, error));
+
+  int64_t n_projected_fields = 0;
+  ArrowIpcDecoderCountFields(&projected_schema, &n_projected_fields);
+  int result = ArrowArrayViewInitFromSchema(&private_data->projected_array_view,
+                                            &projected_schema, error);
+  projected_schema.release(&projected_schema);
+  NANOARROW_RETURN_NOT_OK(result);
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromArrayView(
+      &private_data->projected_array, &private_data->projected_array_view, error));
+
+  private_data->projected_fields = (struct ArrowIpcProjectedField*)ArrowMalloc(
+      n_projected_fields * sizeof(struct ArrowIpcProjectedField));
+  if (private_data->projected_fields == NULL) {
+    ArrowErrorSet(error, "Failed to allocate decoder->projected_fields");
+    return ENOMEM;
+  }
+
+  int64_t node_i = 0;
+  int64_t projected_i = 0;
+  ArrowIpcDecoderInitProjectedFields(private_data, projection, &node_i, 0,
+                                     &private_data->projected_array_view,
+                                     &private_data->projected_array, &projected_i);
+
+  // Dictionaries that were already decoded apply to the projected fields as well
+  for (int64_t i = 0; i < n_projected_fields; i++) {
+    struct ArrowIpcProjectedField* projected = private_data->projected_fields + i;
+    int64_t dictionary_i = private_data->fields[projected->field_i].dictionary_i;
+    if (dictionary_i >= 0 &&
+        private_data->dictionaries[dictionary_i].values.release != NULL) {
+      struct ArrowArray* values = &private_data->dictionaries[dictionary_i].values;
+      NANOARROW_RETURN_NOT_OK(
+          ArrowArrayViewSetArray(projected->array_view->dictionary, values, error));
+    }
+  }
+
+  private_data->n_projected_fields = n_projected_fields;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcDecoderSetProjection(
+    struct ArrowIpcDecoder* decoder, struct ArrowSchema* schema,
+    const struct ArrowSchemaProjection* projection, struct ArrowError* error) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+
+  ArrowIpcDecoderResetProjection(private_data);
+  if (projection == NULL) {
+    return NANOARROW_OK;
+  }
+
+  int result =
+      ArrowIpcDecoderSetProjectionInternal(private_data, schema, projection, error);
+  if (result != NANOARROW_OK) {
+    ArrowIpcDecoderResetProjection(private_data);
+  }
+
+  return result;
+}
+
+ArrowErrorCode ArrowIpcDecoderDecodeRecordBatchSizes(
+    struct ArrowIpcDecoder* decoder, struct ArrowIpcRecordBatchSizes* out,
+    struct ArrowError* error) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+
+  if (private_data->last_message == NULL ||
+      decoder->message_type != NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH) {
+    ArrowErrorSet(error, "decoder did not just decode a RecordBatch message");
+    return EINVAL;
+  }
+
+  ns(RecordBatch_table_t) batch = (ns(RecordBatch_table_t))private_data->last_message;
+  ns(Buffer_vec_t) buffers = ns(RecordBatch_buffers(batch));
+  int64_t n_buffers = ns(Buffer_vec_len(buffers));
+  int64_t n_columns = private_data->array_view.n_children;
+
+  struct ArrowBuffer* sizes = &private_data->record_batch_sizes;
+  sizes->size_bytes = 0;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferReserve(sizes, (n_buffers + n_columns) * sizeof(int64_t)), error);
+  int64_t* buffer_sizes = (int64_t*)sizes->data;
+  int64_t* column_sizes = buffer_sizes + n_buffers;
+
+  for (int64_t i = 0; i < n_buffers; i++) {
+    ns(Buffer_struct_t) buffer = ns(Buffer_vec_at(buffers, (size_t)i));
+    buffer_sizes[i] = ns(Buffer_length(buffer));
+    if (buffer_sizes[i] < 0) {
+      ArrowErrorSet(error, "Buffer %ld has negative length %ld", (long)i,
+                    (long)buffer_sizes[i]);
+      return EINVAL;
+    }
+  }
+
+  // The buffers of each column are contiguous in the message and begin at the buffer
+  // offset of its field (less one for the root struct, which the message does not
+  // count) such that each column ends where the next one begins
+  int64_t field_i = 1;
+  for (int64_t i = 0; i < n_columns; i++) {
+    int64_t next_field_i =
+        field_i + ArrowIpcArrayViewCountNodes(private_data->array_view.children[i]);
+    int64_t begin = private_data->fields[field_i].buffer_offset - 1;
+    int64_t end = n_buffers;
+    if (next_field_i < private_data->n_fields) {
+      end = private_data->fields[next_field_i].buffer_offset - 1;
+    }
+
+    column_sizes[i] = 0;
+    for (int64_t j = begin; j < end; j++) {
+      column_sizes[i] += buffer_sizes[j];
+    }
+
+    field_i = next_field_i;
+  }
+
+  sizes->size_bytes = (n_buffers + n_columns) * sizeof(int64_t);
+  out->length = ns(RecordBatch_length(batch));
+  out->body_size_bytes = decoder->body_size_bytes;
+  out->n_buffers = n_buffers;
+  out->buffer_size_bytes = buffer_sizes;
+  out->n_columns = n_columns;
+  out->column_size_bytes = column_sizes;
   return NANOARROW_OK;
 }
 
@@ -1231,479 +2499,1817 @@ ArrowErrorCode ArrowIpcDecoderSetEndianness(struct ArrowIpcDecoder* decoder,
   }
 }
 
-/// \brief Information required to read and/or decompress a single buffer
-///
-/// The RecordBatch message header contains a description of each buffer
-/// in the message body. The ArrowIpcBufferSource is the parsed result of
-/// a single buffer with compression and endian information such that the
-/// original buffer can be reconstructed.
-struct ArrowIpcBufferSource {
-  int64_t body_offset_bytes;
-  int64_t buffer_length_bytes;
-  enum ArrowIpcCompressionType codec;
-  enum ArrowType data_type;
-  int32_t element_size_bits;
-  int swap_endian;
-};
+ArrowErrorCode ArrowIpcDecoderSetVerificationLevel(
+    struct ArrowIpcDecoder* decoder, enum ArrowIpcVerificationLevel level) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
 
-/// \brief Materializing ArrowBuffer objects
-///
-/// Given a description of where a buffer is located inside the message body, make
-/// the ArrowBuffer that will be placed into the correct ArrowArray. The decoder
-/// does not do any IO and does not make any assumptions about how or if the body
-/// has been read into memory. This abstraction is currently internal and exists
-/// to support the two obvious ways a user might go about this: (1) using a
-/// non-owned view of memory that must be copied slice-wise or (2) adding a reference
-/// to an ArrowIpcSharedBuffer and returning a slice of that memory.
-struct ArrowIpcBufferFactory {
-  /// \brief User-defined callback to populate a buffer view
-  ///
-  /// At the time that this callback is called, the ArrowIpcBufferSource has been checked
-  /// to ensure that it is within the body size declared by the message header. A
-  /// possibly preallocated ArrowBuffer (dst) is provided, which implementations must use
-  /// if an allocation is required (in which case the view must be populated pointing to
-  /// the contents of the ArrowBuffer) If NANOARROW_OK is not returned, error must contain
-  /// a null-terminated message.
-  ArrowErrorCode (*make_buffer)(struct ArrowIpcBufferFactory* factory,
-                                struct ArrowIpcBufferSource* src,
-                                struct ArrowBufferView* dst_view, struct ArrowBuffer* dst,
-                                struct ArrowError* error);
+  switch (level) {
+    case NANOARROW_IPC_VERIFICATION_LEVEL_FULL:
+    case NANOARROW_IPC_VERIFICATION_LEVEL_TRUSTED:
+      private_data->verification_level = level;
+      return NANOARROW_OK;
+    default:
+      return EINVAL;
+  }
+}
 
-  /// \brief Caller-defined private data to be used in the callback.
-  ///
-  /// Usually this would be a description of where the body has been read into memory or
-  /// information required to do so.
-  void* private_data;
-};
+void ArrowIpcDecoderSetExecutor(struct ArrowIpcDecoder* decoder,
+                                struct ArrowExecutor* executor) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+  private_data->executor = executor;
+}
 
-static ArrowErrorCode ArrowIpcMakeBufferFromView(struct ArrowIpcBufferFactory* factory,
-                                                 struct ArrowIpcBufferSource* src,
-                                                 struct ArrowBufferView* dst_view,
-                                                 struct ArrowBuffer* dst,
-                                                 struct ArrowError* error) {
-  struct ArrowBufferView* body = (struct ArrowBufferView*)factory->private_data;
-  dst_view->data.as_uint8 = body->data.as_uint8 + src->body_offset_bytes;
-  dst_view->size_bytes = src->buffer_length_bytes;
-  return NANOARROW_OK;
+void ArrowIpcDecoderSetAllocator(struct ArrowIpcDecoder* decoder,
+                                 struct ArrowBufferAllocator allocator) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+  private_data->allocator = allocator;
 }
 
-static struct ArrowIpcBufferFactory ArrowIpcBufferFactoryFromView(
-    struct ArrowBufferView* buffer_view) {
-  struct ArrowIpcBufferFactory out;
-  out.make_buffer = &ArrowIpcMakeBufferFromView;
-  out.private_data = buffer_view;
-  return out;
+void ArrowIpcDecoderSetSharedBufferCopyThreshold(struct ArrowIpcDecoder* decoder,
+                                                 int64_t threshold_bytes) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+  private_data->shared_buffer_copy_threshold_bytes = threshold_bytes;
 }
 
-static ArrowErrorCode ArrowIpcMakeBufferFromShared(struct ArrowIpcBufferFactory* factory,
-                                                   struct ArrowIpcBufferSource* src,
-                                                   struct ArrowBufferView* dst_view,
-                                                   struct ArrowBuffer* dst,
-                                                   struct ArrowError* error) {
-  struct ArrowIpcSharedBuffer* shared =
-      (struct ArrowIpcSharedBuffer*)factory->private_data;
-  ArrowBufferReset(dst);
-  ArrowIpcSharedBufferClone(shared, dst);
-  dst->data += src->body_offset_bytes;
-  dst->size_bytes = src->buffer_length_bytes;
-  dst_view->data.data = dst->data;
-  dst_view->size_bytes = dst->size_bytes;
-  return NANOARROW_OK;
+void ArrowIpcDecoderSetDeviceBody(struct ArrowIpcDecoder* decoder, int device_body) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+  private_data->device_body = device_body;
 }
 
-static struct ArrowIpcBufferFactory ArrowIpcBufferFactoryFromShared(
-    struct ArrowIpcSharedBuffer* shared) {
-  struct ArrowIpcBufferFactory out;
-  out.make_buffer = &ArrowIpcMakeBufferFromShared;
-  out.private_data = shared;
-  return out;
+ArrowErrorCode ArrowIpcDecoderGetStats(struct ArrowIpcDecoder* decoder,
+                                       struct ArrowIpcStats* out) {
+#if defined(NANOARROW_IPC_WITH_STATS)
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+  *out = private_data->stats;
+  return NANOARROW_OK;
+#else
+  memset(out, 0, sizeof(struct ArrowIpcStats));
+  return ENOTSUP;
+#endif
 }
 
-// Just for the purposes of endian-swapping
-struct ArrowIpcIntervalMonthDayNano {
-  uint32_t months;
-  uint32_t days;
-  uint64_t ns;
-};
+typedef ArrowErrorCode (*ArrowIpcDecompressFunction)(struct ArrowBufferView src,
+                                                     uint8_t* dst, int64_t dst_size,
+                                                     struct ArrowError* error);
+
+#if defined(NANOARROW_IPC_WITH_ZSTD)
+static ArrowErrorCode ArrowIpcDecompressZstd(struct ArrowBufferView src, uint8_t* dst,
+                                             int64_t dst_size, struct ArrowError* error) {
+  size_t code = ZSTD_decompress(dst, (size_t)dst_size, src.data.data,
+                                (size_t)src.size_bytes);
+  if (ZSTD_isError(code)) {
+    ArrowErrorSet(error, "ZSTD_decompress() failed: %s", ZSTD_getErrorName(code));
+    return EIO;
+  }
 
-static int ArrowIpcDecoderSwapEndian(struct ArrowIpcBufferSource* src,
-                                     struct ArrowBufferView* out_view,
-                                     struct ArrowBuffer* dst, struct ArrowError* error) {
-  // Some buffer data types don't need any endian swapping
-  switch (src->data_type) {
-    case NANOARROW_TYPE_BOOL:
-    case NANOARROW_TYPE_INT8:
-    case NANOARROW_TYPE_UINT8:
-    case NANOARROW_TYPE_STRING:
-    case NANOARROW_TYPE_BINARY:
-      return NANOARROW_OK;
-    default:
-      break;
+  if (code != (size_t)dst_size) {
+    ArrowErrorSet(error, "Expected %ld bytes from ZSTD_decompress() but got %ld",
+                  (long)dst_size, (long)code);
+    return EIO;
   }
 
-  // Make sure dst is not a shared buffer that we can't modify
-  struct ArrowBuffer tmp;
-  ArrowBufferInit(&tmp);
+  return NANOARROW_OK;
+}
+#endif
 
-  if (dst->allocator.private_data != NULL) {
-    ArrowBufferMove(dst, &tmp);
-    ArrowBufferInit(dst);
+#if defined(NANOARROW_IPC_WITH_LZ4)
+static ArrowErrorCode ArrowIpcDecompressLz4(struct ArrowBufferView src, uint8_t* dst,
+                                            int64_t dst_size, struct ArrowError* error) {
+  LZ4F_dctx* ctx = NULL;
+  size_t code = LZ4F_createDecompressionContext(&ctx, LZ4F_VERSION);
+  if (LZ4F_isError(code)) {
+    ArrowErrorSet(error, "LZ4F_createDecompressionContext() failed: %s",
+                  LZ4F_getErrorName(code));
+    return ENOMEM;
   }
 
-  if (dst->size_bytes == 0) {
-    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(dst, out_view->size_bytes));
-    dst->size_bytes = out_view->size_bytes;
+  // A buffer may contain more than one frame, each of which is decoded by the same
+  // context (which is reset at the end of each frame)
+  const uint8_t* src_ptr = src.data.as_uint8;
+  size_t src_remaining = (size_t)src.size_bytes;
+  uint8_t* dst_ptr = dst;
+  size_t dst_remaining = (size_t)dst_size;
+  int result = NANOARROW_OK;
+  while (src_remaining > 0) {
+    size_t src_consumed = src_remaining;
+    size_t dst_written = dst_remaining;
+    code = LZ4F_decompress(ctx, dst_ptr, &dst_written, src_ptr, &src_consumed, NULL);
+    if (LZ4F_isError(code)) {
+      ArrowErrorSet(error, "LZ4F_decompress() failed: %s", LZ4F_getErrorName(code));
+      result = EIO;
+      break;
+    }
+
+    if (src_consumed == 0 && dst_written == 0) {
+      break;
+    }
+
+    src_ptr += src_consumed;
+    src_remaining -= src_consumed;
+    dst_ptr += dst_written;
+    dst_remaining -= dst_written;
   }
 
-  switch (src->data_type) {
-    case NANOARROW_TYPE_DECIMAL128:
-    case NANOARROW_TYPE_DECIMAL256: {
-      const uint64_t* ptr_src = out_view->data.as_uint64;
-      uint64_t* ptr_dst = (uint64_t*)dst->data;
-      uint64_t words[4];
-      int n_words = src->element_size_bits / 64;
+  LZ4F_freeDecompressionContext(ctx);
+  NANOARROW_RETURN_NOT_OK(result);
 
-      for (int64_t i = 0; i < (dst->size_bytes / n_words / 8); i++) {
-        for (int j = 0; j < n_words; j++) {
-          words[j] = bswap64(ptr_src[i * n_words + j]);
-        }
+  if (code != 0 || src_remaining != 0 || dst_remaining != 0) {
+    ArrowErrorSet(error, "Expected %ld bytes from LZ4 frame but got %ld",
+                  (long)dst_size, (long)(dst_size - dst_remaining));
+    return EIO;
+  }
 
+  return NANOARROW_OK;
+}
+#endif
+
+static ArrowIpcDecompressFunction ArrowIpcGetDecompressFunction(
+    enum ArrowIpcCompressionType codec) {
+  switch (codec) {
+#if defined(NANOARROW_IPC_WITH_ZSTD)
+    case NANOARROW_IPC_COMPRESSION_TYPE_ZSTD:
+      return &ArrowIpcDecompressZstd;
+#endif
+#if defined(NANOARROW_IPC_WITH_LZ4)
+    case NANOARROW_IPC_COMPRESSION_TYPE_LZ4_FRAME:
+      return &ArrowIpcDecompressLz4;
+#endif
+    default:
+      return NULL;
+  }
+}
+
+int ArrowIpcDecompressionIsSupported(enum ArrowIpcCompressionType codec) {
+  return ArrowIpcGetDecompressFunction(codec) != NULL;
+}
+
+static const char* ArrowIpcCompressionTypeName(enum ArrowIpcCompressionType codec) {
+  switch (codec) {
+    case NANOARROW_IPC_COMPRESSION_TYPE_NONE:
+      return "NONE";
+    case NANOARROW_IPC_COMPRESSION_TYPE_LZ4_FRAME:
+      return "LZ4_FRAME";
+    case NANOARROW_IPC_COMPRESSION_TYPE_ZSTD:
+      return "ZSTD";
+    default:
+      return "<unknown>";
+  }
+}
+
+// The units whose bytes are reversed to swap the endianness of a buffer
+enum ArrowIpcSwapKind {
+  NANOARROW_IPC_SWAP_NONE,
+  NANOARROW_IPC_SWAP_16,
+  NANOARROW_IPC_SWAP_32,
+  NANOARROW_IPC_SWAP_64,
+  NANOARROW_IPC_SWAP_128,
+  NANOARROW_IPC_SWAP_256,
+  // A 32-bit months, 32-bit days, and 64-bit nanoseconds interval
+  NANOARROW_IPC_SWAP_MONTH_DAY_NANO
+};
+
+#if defined(NANOARROW_IPC_SWAP_SSSE3) || defined(NANOARROW_IPC_SWAP_NEON)
+// The source byte of each destination byte of a 16-byte block by swap kind. A 256-bit
+// unit is swapped by reversing each 16-byte half and exchanging the halves.
+static const uint8_t kArrowIpcSwapShuffles[][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14},
+    {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12},
+    {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8},
+    {15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0},
+    {15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0},
+    {3, 2, 1, 0, 7, 6, 5, 4, 15, 14, 13, 12, 11, 10, 9, 8}};
+
+// Swaps as many whole 16-byte blocks (or 32-byte blocks for 256-bit units) of src into
+// dst as possible and returns the number of bytes swapped
+static int64_t ArrowIpcSwapBytesSimd(enum ArrowIpcSwapKind kind, const uint8_t* src,
+                                     uint8_t* dst, int64_t size_bytes) {
+  int64_t i = 0;
+#if defined(NANOARROW_IPC_SWAP_SSSE3)
+  __m128i shuffle = _mm_loadu_si128((const __m128i*)kArrowIpcSwapShuffles[kind]);
+  if (kind == NANOARROW_IPC_SWAP_256) {
+    for (; (i + 32) <= size_bytes; i += 32) {
+      __m128i lo = _mm_loadu_si128((const __m128i*)(src + i));
+      __m128i hi = _mm_loadu_si128((const __m128i*)(src + i + 16));
+      _mm_storeu_si128((__m128i*)(dst + i), _mm_shuffle_epi8(hi, shuffle));
+      _mm_storeu_si128((__m128i*)(dst + i + 16), _mm_shuffle_epi8(lo, shuffle));
+    }
+  } else {
+    for (; (i + 16) <= size_bytes; i += 16) {
+      __m128i block = _mm_loadu_si128((const __m128i*)(src + i));
+      _mm_storeu_si128((__m128i*)(dst + i), _mm_shuffle_epi8(block, shuffle));
+    }
+  }
+#else
+  uint8x16_t shuffle = vld1q_u8(kArrowIpcSwapShuffles[kind]);
+  if (kind == NANOARROW_IPC_SWAP_256) {
+    for (; (i + 32) <= size_bytes; i += 32) {
+      uint8x16_t lo = vld1q_u8(src + i);
+      uint8x16_t hi = vld1q_u8(src + i + 16);
+      vst1q_u8(dst + i, vqtbl1q_u8(hi, shuffle));
+      vst1q_u8(dst + i + 16, vqtbl1q_u8(lo, shuffle));
+    }
+  } else {
+    for (; (i + 16) <= size_bytes; i += 16) {
+      vst1q_u8(dst + i, vqtbl1q_u8(vld1q_u8(src + i), shuffle));
+    }
+  }
+#endif
+  return i;
+}
+#endif
+
+// Reverses the bytes of each unit of src into dst, which may be equal to src
+static void ArrowIpcSwapBytes(enum ArrowIpcSwapKind kind, const uint8_t* src,
+                              uint8_t* dst, int64_t size_bytes) {
+  int64_t i = 0;
+#if defined(NANOARROW_IPC_SWAP_SSSE3) || defined(NANOARROW_IPC_SWAP_NEON)
+  i = ArrowIpcSwapBytesSimd(kind, src, dst, size_bytes);
+#endif
+
+  switch (kind) {
+    case NANOARROW_IPC_SWAP_16:
+      for (; (i + 2) <= size_bytes; i += 2) {
+        uint16_t value;
+        memcpy(&value, src + i, sizeof(value));
+        value = bswap16(value);
+        memcpy(dst + i, &value, sizeof(value));
+      }
+      break;
+    case NANOARROW_IPC_SWAP_32:
+      for (; (i + 4) <= size_bytes; i += 4) {
+        uint32_t value;
+        memcpy(&value, src + i, sizeof(value));
+        value = bswap32(value);
+        memcpy(dst + i, &value, sizeof(value));
+      }
+      break;
+    case NANOARROW_IPC_SWAP_64:
+      for (; (i + 8) <= size_bytes; i += 8) {
+        uint64_t value;
+        memcpy(&value, src + i, sizeof(value));
+        value = bswap64(value);
+        memcpy(dst + i, &value, sizeof(value));
+      }
+      break;
+    case NANOARROW_IPC_SWAP_128:
+    case NANOARROW_IPC_SWAP_256: {
+      int n_words = kind == NANOARROW_IPC_SWAP_128 ? 2 : 4;
+      int64_t unit_size_bytes = n_words * 8;
+      uint64_t words[4];
+      for (; (i + unit_size_bytes) <= size_bytes; i += unit_size_bytes) {
+        memcpy(words, src + i, unit_size_bytes);
         for (int j = 0; j < n_words; j++) {
-          ptr_dst[i * n_words + j] = words[n_words - j - 1];
+          uint64_t word = bswap64(words[n_words - j - 1]);
+          memcpy(dst + i + j * 8, &word, sizeof(word));
         }
       }
       break;
     }
-    case NANOARROW_TYPE_INTERVAL_DAY_TIME: {
-      uint32_t* ptr = (uint32_t*)dst->data;
-      for (int64_t i = 0; i < (dst->size_bytes / 4); i++) {
-        ptr[i] = bswap32(out_view->data.as_uint32[i]);
+    case NANOARROW_IPC_SWAP_MONTH_DAY_NANO:
+      for (; (i + 16) <= size_bytes; i += 16) {
+        uint32_t months;
+        uint32_t days;
+        uint64_t ns;
+        memcpy(&months, src + i, sizeof(months));
+        memcpy(&days, src + i + 4, sizeof(days));
+        memcpy(&ns, src + i + 8, sizeof(ns));
+        months = bswap32(months);
+        days = bswap32(days);
+        ns = bswap64(ns);
+        memcpy(dst + i, &months, sizeof(months));
+        memcpy(dst + i + 4, &days, sizeof(days));
+        memcpy(dst + i + 8, &ns, sizeof(ns));
       }
       break;
-    }
-    case NANOARROW_TYPE_INTERVAL_MONTH_DAY_NANO: {
-      const uint8_t* ptr_src = out_view->data.as_uint8;
-      uint8_t* ptr_dst = dst->data;
-      int item_size_bytes = 16;
-      struct ArrowIpcIntervalMonthDayNano item;
-      for (int64_t i = 0; i < (dst->size_bytes / item_size_bytes); i++) {
-        memcpy(&item, ptr_src + i * item_size_bytes, item_size_bytes);
-        item.months = bswap32(item.months);
-        item.days = bswap32(item.days);
-        item.ns = bswap64(item.ns);
-        memcpy(ptr_dst + i * item_size_bytes, &item, item_size_bytes);
-      }
+    default:
       break;
+  }
+}
+
+/// \brief A buffer whose decompression and/or endian swapping has been deferred
+///
+/// Decompression and endian swapping are deferred until all buffers of a RecordBatch
+/// have been located such that they can be run in parallel. If decompress is non-NULL,
+/// src is decompressed into dst before dst is swapped in place; otherwise, src is
+/// swapped into dst.
+struct ArrowIpcBufferTask {
+  ArrowIpcDecompressFunction decompress;
+  struct ArrowBufferView src;
+  uint8_t* dst;
+  int64_t dst_size;
+  enum ArrowIpcSwapKind swap;
+  ArrowErrorCode result;
+};
+
+static ArrowErrorCode ArrowIpcBufferTaskRunInternal(struct ArrowIpcBufferTask* task,
+                                                    struct ArrowError* error) {
+  const uint8_t* swap_src = task->src.data.as_uint8;
+  if (task->decompress != NULL) {
+    NANOARROW_RETURN_NOT_OK(
+        task->decompress(task->src, task->dst, task->dst_size, error));
+    swap_src = task->dst;
+  }
+
+  if (task->swap != NANOARROW_IPC_SWAP_NONE) {
+    ArrowIpcSwapBytes(task->swap, swap_src, task->dst, task->dst_size);
+  }
+
+  return NANOARROW_OK;
+}
+
+static void ArrowIpcBufferTaskRun(void* task_private, int64_t i) {
+  struct ArrowIpcBufferTask* task = (struct ArrowIpcBufferTask*)task_private + i;
+  task->result = ArrowIpcBufferTaskRunInternal(task, NULL);
+}
+
+static ArrowErrorCode ArrowIpcDecoderRunBufferTasks(
+    struct ArrowIpcDecoderPrivate* private_data, struct ArrowError* error) {
+  struct ArrowIpcBufferTask* tasks =
+      (struct ArrowIpcBufferTask*)private_data->buffer_tasks.data;
+  int64_t n_tasks =
+      private_data->buffer_tasks.size_bytes / sizeof(struct ArrowIpcBufferTask);
+  private_data->buffer_tasks.size_bytes = 0;
+
+  if (private_data->executor == NULL || n_tasks < 2) {
+    for (int64_t i = 0; i < n_tasks; i++) {
+      NANOARROW_RETURN_NOT_OK(ArrowIpcBufferTaskRunInternal(tasks + i, error));
+    }
+
+    return NANOARROW_OK;
+  }
+
+  private_data->executor->parallel_for(private_data->executor, &ArrowIpcBufferTaskRun,
+                                       tasks, n_tasks);
+
+  // Tasks don't have their own ArrowError, so a failed task is repeated on this thread
+  // to populate error
+  for (int64_t i = 0; i < n_tasks; i++) {
+    if (tasks[i].result != NANOARROW_OK) {
+      int result = ArrowIpcBufferTaskRunInternal(tasks + i, error);
+      return result != NANOARROW_OK ? result : tasks[i].result;
     }
+  }
+
+  return NANOARROW_OK;
+}
+
+/// \brief Information required to read and/or decompress a single buffer
+///
+/// The RecordBatch message header contains a description of each buffer
+/// in the message body. The ArrowIpcBufferSource is the parsed result of
+/// a single buffer with compression and endian information such that the
+/// original buffer can be reconstructed.
+struct ArrowIpcBufferSource {
+  int64_t body_offset_bytes;
+  int64_t buffer_length_bytes;
+  enum ArrowIpcCompressionType codec;
+  enum ArrowType data_type;
+  int32_t element_size_bits;
+  int swap_endian;
+};
+
+/// \brief Materializing ArrowBuffer objects
+///
+/// Given a description of where a buffer is located inside the message body, make
+/// the ArrowBuffer that will be placed into the correct ArrowArray. The decoder
+/// does not do any IO and does not make any assumptions about how or if the body
+/// has been read into memory. This abstraction is currently internal and exists
+/// to support the two obvious ways a user might go about this: (1) using a
+/// non-owned view of memory that must be copied slice-wise or (2) adding a reference
+/// to an ArrowIpcSharedBuffer and returning a slice of that memory.
+struct ArrowIpcBufferFactory {
+  /// \brief User-defined callback to populate a buffer view
+  ///
+  /// At the time that this callback is called, the ArrowIpcBufferSource has been checked
+  /// to ensure that it is within the body size declared by the message header. A
+  /// possibly preallocated ArrowBuffer (dst) is provided, which implementations must use
+  /// if an allocation is required (in which case the view must be populated pointing to
+  /// the contents of the ArrowBuffer) If NANOARROW_OK is not returned, error must contain
+  /// a null-terminated message.
+  ArrowErrorCode (*make_buffer)(struct ArrowIpcBufferFactory* factory,
+                                struct ArrowIpcBufferSource* src,
+                                struct ArrowBufferView* dst_view, struct ArrowBuffer* dst,
+                                struct ArrowError* error);
+
+  /// \brief Caller-defined private data to be used in the callback.
+  ///
+  /// Usually this would be a description of where the body has been read into memory or
+  /// information required to do so.
+  void* private_data;
+};
+
+static ArrowErrorCode ArrowIpcMakeBufferFromView(struct ArrowIpcBufferFactory* factory,
+                                                 struct ArrowIpcBufferSource* src,
+                                                 struct ArrowBufferView* dst_view,
+                                                 struct ArrowBuffer* dst,
+                                                 struct ArrowError* error) {
+  struct ArrowBufferView* body = (struct ArrowBufferView*)factory->private_data;
+  dst_view->data.as_uint8 = body->data.as_uint8 + src->body_offset_bytes;
+  dst_view->size_bytes = src->buffer_length_bytes;
+  return NANOARROW_OK;
+}
+
+static struct ArrowIpcBufferFactory ArrowIpcBufferFactoryFromView(
+    struct ArrowBufferView* buffer_view) {
+  struct ArrowIpcBufferFactory out;
+  out.make_buffer = &ArrowIpcMakeBufferFromView;
+  out.private_data = buffer_view;
+  return out;
+}
+
+static ArrowErrorCode ArrowIpcMakeBufferFromShared(struct ArrowIpcBufferFactory* factory,
+                                                   struct ArrowIpcBufferSource* src,
+                                                   struct ArrowBufferView* dst_view,
+                                                   struct ArrowBuffer* dst,
+                                                   struct ArrowError* error) {
+  struct ArrowIpcSharedBufferReferences* references =
+      (struct ArrowIpcSharedBufferReferences*)factory->private_data;
+  ArrowBufferReset(dst);
+  ArrowIpcSharedBufferTake(references, dst);
+  dst->data += src->body_offset_bytes;
+  dst->size_bytes = src->buffer_length_bytes;
+  dst_view->data.data = dst->data;
+  dst_view->size_bytes = dst->size_bytes;
+  return NANOARROW_OK;
+}
+
+static struct ArrowIpcBufferFactory ArrowIpcBufferFactoryFromShared(
+    struct ArrowIpcSharedBufferReferences* references) {
+  struct ArrowIpcBufferFactory out;
+  out.make_buffer = &ArrowIpcMakeBufferFromShared;
+  out.private_data = references;
+  return out;
+}
+
+struct ArrowIpcArraySetter {
+  ns(FieldNode_vec_t) fields;
+  int64_t field_i;
+  ns(Buffer_vec_t) buffers;
+  int64_t buffer_i;
+  int64_t body_size_bytes;
+  struct ArrowIpcBufferSource src;
+  struct ArrowIpcBufferFactory factory;
+  struct ArrowBufferView body;
+  struct ArrowIpcDecoderPrivate* private_data;
+};
+
+// Returns the units whose bytes must be reversed to swap the endianness of a buffer
+// described by src
+static int ArrowIpcDecoderGetSwapKind(struct ArrowIpcBufferSource* src,
+                                      enum ArrowIpcSwapKind* out,
+                                      struct ArrowError* error) {
+  *out = NANOARROW_IPC_SWAP_NONE;
+  if (!src->swap_endian) {
+    return NANOARROW_OK;
+  }
+
+  switch (src->data_type) {
+    // Some buffer data types don't need any endian swapping
+    case NANOARROW_TYPE_BOOL:
+    case NANOARROW_TYPE_INT8:
+    case NANOARROW_TYPE_UINT8:
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY:
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_DECIMAL128:
+      *out = NANOARROW_IPC_SWAP_128;
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_DECIMAL256:
+      *out = NANOARROW_IPC_SWAP_256;
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_INTERVAL_DAY_TIME:
+      *out = NANOARROW_IPC_SWAP_32;
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_INTERVAL_MONTH_DAY_NANO:
+      *out = NANOARROW_IPC_SWAP_MONTH_DAY_NANO;
+      return NANOARROW_OK;
     default:
-      switch (src->element_size_bits) {
-        case 16: {
-          uint16_t* ptr = (uint16_t*)dst->data;
-          for (int64_t i = 0; i < (dst->size_bytes / 2); i++) {
-            ptr[i] = bswap16(out_view->data.as_uint16[i]);
-          }
-          break;
-        }
-        case 32: {
-          uint32_t* ptr = (uint32_t*)dst->data;
-          for (int64_t i = 0; i < (dst->size_bytes / 4); i++) {
-            ptr[i] = bswap32(out_view->data.as_uint32[i]);
-          }
-          break;
-        }
-        case 64: {
-          uint64_t* ptr = (uint64_t*)dst->data;
-          for (int64_t i = 0; i < (dst->size_bytes / 8); i++) {
-            ptr[i] = bswap64(out_view->data.as_uint64[i]);
-          }
-          break;
-        }
-        default:
-          ArrowErrorSet(error, "Endian swapping for element bitwidth %d is not supported",
-                        (int)src->element_size_bits);
-          return ENOTSUP;
-      }
       break;
   }
 
-  ArrowBufferReset(&tmp);
-  out_view->data.data = dst->data;
-  return NANOARROW_OK;
+  switch (src->element_size_bits) {
+    case 16:
+      *out = NANOARROW_IPC_SWAP_16;
+      return NANOARROW_OK;
+    case 32:
+      *out = NANOARROW_IPC_SWAP_32;
+      return NANOARROW_OK;
+    case 64:
+      *out = NANOARROW_IPC_SWAP_64;
+      return NANOARROW_OK;
+    default:
+      ArrowErrorSet(error, "Endian swapping for element bitwidth %d is not supported",
+                    (int)src->element_size_bits);
+      return ENOTSUP;
+  }
+}
+
+// Defers swapping the endianness of the buffer in out_view into dst. The view always
+// points to memory that is not owned by the decoder (i.e., the message body), so the
+// buffer is swapped while it is copied into dst.
+static int ArrowIpcDecoderSwapEndian(struct ArrowIpcArraySetter* setter,
+                                     struct ArrowBufferView* out_view,
+                                     struct ArrowBuffer* dst, struct ArrowError* error) {
+  enum ArrowIpcSwapKind swap;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderGetSwapKind(&setter->src, &swap, error));
+  if (swap == NANOARROW_IPC_SWAP_NONE || out_view->size_bytes == 0) {
+    return NANOARROW_OK;
+  }
+
+  // dst may be a reference to a shared body, which can't be modified but is kept
+  // alive by the caller until decoding is complete
+  if (dst->data != NULL && setter->factory.make_buffer == &ArrowIpcMakeBufferFromShared) {
+    ArrowBufferReset(dst);
+  }
+
+  if (dst->data == NULL) {
+    dst->allocator = setter->private_data->allocator;
+  }
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowBufferResize(dst, out_view->size_bytes, 0),
+                                     error);
+
+  struct ArrowIpcBufferTask task;
+  task.decompress = NULL;
+  task.src = *out_view;
+  task.dst = dst->data;
+  task.dst_size = out_view->size_bytes;
+  task.swap = swap;
+  task.result = NANOARROW_OK;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferAppend(&setter->private_data->buffer_tasks, &task, sizeof(task)), error);
+
+  out_view->data.data = dst->data;
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowIpcDecoderMakeUncompressedBuffer(
+    struct ArrowIpcArraySetter* setter, int64_t offset, int64_t length,
+    struct ArrowBufferView* out_view, struct ArrowBuffer* out, struct ArrowError* error) {
+  setter->src.body_offset_bytes = offset;
+  setter->src.buffer_length_bytes = length;
+  NANOARROW_RETURN_NOT_OK(
+      setter->factory.make_buffer(&setter->factory, &setter->src, out_view, out, error));
+
+  if (setter->src.swap_endian) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderSwapEndian(setter, out_view, out, error));
+  }
+
+  // A small buffer that still references a shared body is copied such that it does
+  // not keep the whole body alive. The caller keeps the body alive until decoding is
+  // complete, so out_view remains valid after out releases its reference.
+  if (setter->factory.make_buffer == &ArrowIpcMakeBufferFromShared &&
+      !setter->private_data->device_body &&
+      length < setter->private_data->shared_buffer_copy_threshold_bytes &&
+      out_view->data.as_uint8 == setter->body.data.as_uint8 + offset) {
+    ArrowBufferReset(out);
+    out->allocator = setter->private_data->allocator;
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+        ArrowBufferAppend(out, out_view->data.data, out_view->size_bytes), error);
+    out_view->data.data = out->data;
+  }
+
+#if defined(NANOARROW_IPC_WITH_STATS)
+  // Buffers that still point into a view of the body are counted when they are copied
+  // by ArrowIpcDecoderWalkGetArray()
+  if (out_view->data.as_uint8 != setter->body.data.as_uint8 + offset) {
+    setter->private_data->stats.n_buffers_allocated++;
+    setter->private_data->stats.n_bytes_copied += out_view->size_bytes;
+  } else if (setter->factory.make_buffer == &ArrowIpcMakeBufferFromShared) {
+    setter->private_data->stats.n_buffers_shared++;
+    setter->private_data->stats.n_bytes_shared += out_view->size_bytes;
+  }
+#endif
+
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowIpcDecoderMakeCompressedBuffer(
+    struct ArrowIpcArraySetter* setter, int64_t offset, int64_t length,
+    struct ArrowBufferView* out_view, struct ArrowBuffer* out, struct ArrowError* error) {
+  // Each compressed buffer is prefixed with its uncompressed length as a little-endian
+  // int64 (or -1 if the buffer was left uncompressed)
+  if (length < (int64_t)sizeof(int64_t)) {
+    ArrowErrorSet(error, "Expected compressed buffer of at least 8 bytes but found %ld",
+                  (long)length);
+    return EINVAL;
+  }
+
+  const uint8_t* prefix = setter->body.data.as_uint8 + offset;
+  uint64_t uncompressed_size_unsigned = 0;
+  for (int i = 7; i >= 0; i--) {
+    uncompressed_size_unsigned = (uncompressed_size_unsigned << 8) | prefix[i];
+  }
+  int64_t uncompressed_size = (int64_t)uncompressed_size_unsigned;
+
+  if (uncompressed_size == -1) {
+    return ArrowIpcDecoderMakeUncompressedBuffer(setter, offset + 8, length - 8, out_view,
+                                                 out, error);
+  } else if (uncompressed_size == 0) {
+    return NANOARROW_OK;
+  } else if (uncompressed_size < 0) {
+    ArrowErrorSet(error, "Invalid uncompressed buffer length: %ld",
+                  (long)uncompressed_size);
+    return EINVAL;
+  }
+
+  ArrowIpcDecompressFunction decompress =
+      ArrowIpcGetDecompressFunction(setter->src.codec);
+  if (decompress == NULL) {
+    ArrowErrorSet(error,
+                  "The nanoarrow_ipc extension was built without support for "
+                  "compression type '%s' (%d)",
+                  ArrowIpcCompressionTypeName(setter->src.codec), (int)setter->src.codec);
+    return ENOTSUP;
+  }
+
+  // The decompressed buffer is owned by the decoder and is swapped in place
+  enum ArrowIpcSwapKind swap;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderGetSwapKind(&setter->src, &swap, error));
+
+  if (out->data == NULL) {
+    out->allocator = setter->private_data->allocator;
+  }
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowBufferResize(out, uncompressed_size, 0), error);
+
+  struct ArrowIpcBufferTask task;
+  task.decompress = decompress;
+  task.src.data.as_uint8 = prefix + 8;
+  task.src.size_bytes = length - 8;
+  task.dst = out->data;
+  task.dst_size = uncompressed_size;
+  task.swap = swap;
+  task.result = NANOARROW_OK;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferAppend(&setter->private_data->buffer_tasks, &task, sizeof(task)), error);
+
+  out_view->data.data = out->data;
+  out_view->size_bytes = uncompressed_size;
+  NANOARROW_IPC_STATS_ADD(setter->private_data, n_buffers_allocated, 1);
+  NANOARROW_IPC_STATS_ADD(setter->private_data, n_bytes_copied, uncompressed_size);
+  return NANOARROW_OK;
+}
+
+static int ArrowIpcDecoderMakeBuffer(struct ArrowIpcArraySetter* setter, int64_t offset,
+                                     int64_t length, struct ArrowBufferView* out_view,
+                                     struct ArrowBuffer* out, struct ArrowError* error) {
+  out_view->data.data = NULL;
+  out_view->size_bytes = 0;
+
+  if (length == 0) {
+    return NANOARROW_OK;
+  }
+
+  // Check that this buffer fits within the body
+  int64_t buffer_start = offset;
+  int64_t buffer_end = buffer_start + length;
+  if (buffer_start < 0 || buffer_end > setter->body_size_bytes) {
+    ArrowErrorSet(error, "Buffer requires body offsets [%ld..%ld) but body has size %ld",
+                  (long)buffer_start, (long)buffer_end, (long)setter->body_size_bytes);
+    return EINVAL;
+  }
+
+  if (setter->src.codec != NANOARROW_IPC_COMPRESSION_TYPE_NONE) {
+    return ArrowIpcDecoderMakeCompressedBuffer(setter, offset, length, out_view, out,
+                                               error);
+  }
+
+  return ArrowIpcDecoderMakeUncompressedBuffer(setter, offset, length, out_view, out,
+                                               error);
+}
+
+// Prepares buffer to receive a copy of a buffer from the message body. Its capacity is
+// kept if it was allocated using allocator; otherwise, it is released such that the
+// copy is allocated using allocator.
+static void ArrowIpcDecoderRecycleBuffer(struct ArrowBuffer* buffer,
+                                         struct ArrowBufferAllocator* allocator) {
+  if (buffer->allocator.reallocate == allocator->reallocate &&
+      buffer->allocator.free == allocator->free &&
+      buffer->allocator.private_data == allocator->private_data) {
+    buffer->size_bytes = 0;
+  } else {
+    ArrowBufferReset(buffer);
+    buffer->allocator = *allocator;
+  }
+}
+
+// Checks that out was built by nanoarrow with the same structure and storage types as
+// the scratch array such that its buffers can be recycled
+static int ArrowIpcDecoderArrayIsReusable(struct ArrowArray* array,
+                                          struct ArrowArray* out) {
+  if (out->release != array->release || out->n_buffers != array->n_buffers ||
+      out->n_children != array->n_children ||
+      (out->dictionary == NULL) != (array->dictionary == NULL)) {
+    return 0;
+  }
+
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  struct ArrowArrayPrivateData* out_private_data =
+      (struct ArrowArrayPrivateData*)out->private_data;
+  if (out_private_data->storage_type != private_data->storage_type ||
+      out_private_data->n_variadic_buffers != 0) {
+    return 0;
+  }
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    if (!ArrowIpcDecoderArrayIsReusable(array->children[i], out->children[i])) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static int ArrowIpcDecoderWalkGetArray(struct ArrowIpcDecoderPrivate* private_data,
+                                       struct ArrowArrayView* array_view,
+                                       struct ArrowArray* array, struct ArrowArray* out,
+                                       int reuse, struct ArrowError* error) {
+  out->length = array_view->length;
+  out->null_count = array_view->null_count;
+  out->offset = 0;
+
+  for (int64_t i = 0; i < array->n_buffers; i++) {
+    struct ArrowBufferView view = array_view->buffer_views[i];
+    struct ArrowBuffer* scratch_buffer = ArrowArrayBuffer(array, i);
+    struct ArrowBuffer* buffer_out = ArrowArrayBuffer(out, i);
+
+    // If the scratch buffer was used, move it to the final array (or, when recycling
+    // out, exchange it with the buffer of out such that both keep their capacity).
+    // Otherwise, copy the view.
+    if (scratch_buffer->size_bytes == 0) {
+      ArrowIpcDecoderRecycleBuffer(buffer_out, &private_data->allocator);
+      NANOARROW_RETURN_NOT_OK(ArrowBufferAppendBufferView(buffer_out, view));
+      if (view.size_bytes > 0) {
+        NANOARROW_IPC_STATS_ADD(private_data, n_buffers_allocated, 1);
+        NANOARROW_IPC_STATS_ADD(private_data, n_bytes_copied, view.size_bytes);
+      }
+    } else if (scratch_buffer->data == view.data.as_uint8 && reuse) {
+      struct ArrowBuffer previous;
+      ArrowBufferMove(buffer_out, &previous);
+      ArrowBufferMove(scratch_buffer, buffer_out);
+      ArrowBufferMove(&previous, scratch_buffer);
+      ArrowIpcDecoderRecycleBuffer(scratch_buffer, &private_data->allocator);
+    } else if (scratch_buffer->data == view.data.as_uint8) {
+      ArrowBufferMove(scratch_buffer, buffer_out);
+    } else {
+      ArrowErrorSet(
+          error,
+          "Internal: scratch buffer was used but doesn't point to the same data as view");
+      return EINVAL;
+    }
+  }
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcDecoderWalkGetArray(private_data, array_view->children[i],
+                                    array->children[i], out->children[i], reuse, error));
+  }
+
+  return NANOARROW_OK;
+}
+
+// Finishes a recycled out like ArrowArrayFinishBuilding() but without the allocations
+// it needs to validate out (whose content was already validated) and without visiting
+// dictionaries (which are slices that are replaced after this)
+static ArrowErrorCode ArrowIpcDecoderWalkFinishRecycled(
+    struct ArrowArray* out, enum ArrowValidationLevel validation_level) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)out->private_data;
+
+  if (validation_level >= NANOARROW_VALIDATION_LEVEL_DEFAULT) {
+    switch (private_data->storage_type) {
+      case NANOARROW_TYPE_BINARY:
+      case NANOARROW_TYPE_STRING:
+      case NANOARROW_TYPE_LARGE_BINARY:
+      case NANOARROW_TYPE_LARGE_STRING:
+        if (ArrowArrayBuffer(out, 2)->data == NULL) {
+          NANOARROW_RETURN_NOT_OK(ArrowBufferAppendUInt8(ArrowArrayBuffer(out, 2), 0));
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
+  for (int64_t i = 0; i < 3; i++) {
+    private_data->buffer_data[i] = ArrowArrayBuffer(out, i)->data;
+  }
+  private_data->built_by_append = 0;
+
+  for (int64_t i = 0; i < out->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcDecoderWalkFinishRecycled(out->children[i], validation_level));
+  }
+
+  return NANOARROW_OK;
+}
+
+// Sets the length, null count, and buffers (but not the children) of array_view from
+// the FieldNode and Buffers at the current position of setter
+static int ArrowIpcDecoderSetArrayViewNode(struct ArrowIpcArraySetter* setter,
+                                           struct ArrowArrayView* array_view,
+                                           struct ArrowArray* array,
+                                           struct ArrowError* error) {
+  // The values of a dictionary-encoded field must have been decoded from a previous
+  // DictionaryBatch message (setter->fields doesn't count the root struct but
+  // private_data->fields does)
+  struct ArrowIpcField* ipc_field = setter->private_data->fields + setter->field_i + 1;
+  if (ipc_field->dictionary_i >= 0) {
+    struct ArrowIpcDictionary* dictionary =
+        setter->private_data->dictionaries + ipc_field->dictionary_i;
+    if (dictionary->values.release == NULL) {
+      ArrowErrorSet(error, "Dictionary with id %ld has not been decoded",
+                    (long)dictionary->id);
+      return EINVAL;
+    }
+  }
+
+  ns(FieldNode_struct_t) field =
+      ns(FieldNode_vec_at(setter->fields, (size_t)setter->field_i));
+  array_view->length = ns(FieldNode_length(field));
+  array_view->null_count = ns(FieldNode_null_count(field));
+  setter->field_i += 1;
+
+  for (int64_t i = 0; i < 3; i++) {
+    if (array_view->layout.buffer_type[i] == NANOARROW_BUFFER_TYPE_NONE) {
+      break;
+    }
+
+    ns(Buffer_struct_t) buffer =
+        ns(Buffer_vec_at(setter->buffers, (size_t)setter->buffer_i));
+    int64_t buffer_offset = ns(Buffer_offset(buffer));
+    int64_t buffer_length = ns(Buffer_length(buffer));
+    setter->buffer_i += 1;
+
+    // Provide a buffer that will be used if any allocation has to occur
+    struct ArrowBuffer* buffer_dst = ArrowArrayBuffer(array, i);
+
+    // Attempt to re-use any previous allocation unless this buffer is
+    // wrapping a custom allocator.
+    if (buffer_dst->allocator.private_data != NULL) {
+      ArrowBufferReset(buffer_dst);
+    } else {
+      buffer_dst->size_bytes = 0;
+    }
+
+    setter->src.data_type = array_view->layout.buffer_data_type[i];
+    setter->src.element_size_bits = array_view->layout.element_size_bits[i];
+
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcDecoderMakeBuffer(setter, buffer_offset, buffer_length,
+                                  &array_view->buffer_views[i], buffer_dst, error));
+  }
+
+  return NANOARROW_OK;
+}
+
+static int ArrowIpcDecoderWalkSetArrayView(struct ArrowIpcArraySetter* setter,
+                                           struct ArrowArrayView* array_view,
+                                           struct ArrowArray* array,
+                                           struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcDecoderSetArrayViewNode(setter, array_view, array, error));
+
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderWalkSetArrayView(
+        setter, array_view->children[i], array->children[i], error));
+  }
+
+  return NANOARROW_OK;
+}
+
+// Replaces the placeholder dictionary of each dictionary-encoded node of out with a
+// reference to the current values of its dictionary. Nodes of out are the fields
+// starting at *field_i or, if projected_fields is non-NULL, the projected fields
+// starting at *field_i.
+static int ArrowIpcDecoderWalkSetDictionaries(
+    struct ArrowIpcDecoderPrivate* private_data,
+    const struct ArrowIpcProjectedField* projected_fields, int64_t* field_i,
+    struct ArrowArray* out) {
+  struct ArrowIpcField* field = private_data->fields + (*field_i);
+  if (projected_fields != NULL) {
+    field = private_data->fields + projected_fields[*field_i].field_i;
+  }
+  *field_i += 1;
+
+  if (field->dictionary_i >= 0) {
+    struct ArrowIpcDictionary* dictionary =
+        private_data->dictionaries + field->dictionary_i;
+    out->dictionary->release(out->dictionary);
+    NANOARROW_RETURN_NOT_OK(ArrowArraySlice(&dictionary->values, 0,
+                                            dictionary->values.length, out->dictionary));
+  }
+
+  for (int64_t i = 0; i < out->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderWalkSetDictionaries(
+        private_data, projected_fields, field_i, out->children[i]));
+  }
+
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowIpcDecoderBuildArray(
+    struct ArrowIpcDecoder* decoder, int64_t field_i, struct ArrowArray* out,
+    enum ArrowValidationLevel validation_level, struct ArrowError* error) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+
+  NANOARROW_IPC_STATS_TIMER_START(start);
+  struct ArrowIpcField* root = private_data->fields + field_i + 1;
+
+  // All fields are decoded into the projected tree if a projection was set
+  const struct ArrowIpcProjectedField* projected_fields = NULL;
+  if (field_i == -1 && private_data->n_projected_fields > 0) {
+    projected_fields = private_data->projected_fields;
+  }
+
+  struct ArrowArrayView* root_view = root->array_view;
+  struct ArrowArray* root_array = root->array;
+  if (projected_fields != NULL) {
+    root_view = &private_data->projected_array_view;
+    root_array = &private_data->projected_array;
+  }
+
+  // A released out is always allocated; otherwise, out is recycled if possible
+  int reuse = out->release != NULL && ArrowIpcDecoderArrayIsReusable(root_array, out);
+  if (!reuse && out->release != NULL) {
+    out->release(out);
+  }
+
+  if (!reuse) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromArrayView(out, root_view, error));
+  }
+
+  if (field_i == -1) {
+    out->length = root_view->length;
+    out->null_count = root_view->null_count;
+    out->offset = 0;
+
+    for (int64_t i = 0; i < root_view->n_children; i++) {
+      NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderWalkGetArray(
+          private_data, root_view->children[i], root_array->children[i],
+          out->children[i], reuse, error));
+    }
+
+  } else {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderWalkGetArray(private_data, root_view,
+                                                        root_array, out, reuse, error));
+  }
+
+  // If validation is going to happen it has already occurred; however, the part of
+  // ArrowArrayFinishBuilding() that allocates a data buffer if the data buffer is
+  // NULL (required for compatibility with Arrow <= 9.0.0) assumes CPU data access
+  // and thus needs a validation level >= default. A recycled out is finished without
+  // revalidating such that decoding into it does not allocate.
+  if (reuse) {
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+        ArrowIpcDecoderWalkFinishRecycled(out, validation_level), error);
+  } else if (validation_level >= NANOARROW_VALIDATION_LEVEL_DEFAULT) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayFinishBuilding(out, NANOARROW_VALIDATION_LEVEL_DEFAULT, error));
+  } else {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayFinishBuilding(out, NANOARROW_VALIDATION_LEVEL_NONE, error));
+  }
+
+  // Dictionaries are attached after building because they are slices that
+  // ArrowArrayFinishBuilding() can't modify
+  if (private_data->n_dictionaries > 0) {
+    int64_t dictionary_field_i = projected_fields != NULL ? 0 : field_i + 1;
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+        ArrowIpcDecoderWalkSetDictionaries(private_data, projected_fields,
+                                           &dictionary_field_i, out),
+        error);
+  }
+
+  NANOARROW_IPC_STATS_TIMER_STOP(private_data, decode_body_ns, start);
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowIpcDecoderDecodeArrayInternal(
+    struct ArrowIpcDecoder* decoder, int64_t field_i, struct ArrowArray* out,
+    enum ArrowValidationLevel validation_level, struct ArrowError* error) {
+  NANOARROW_TRACE(NANOARROW_TRACE_IPC_DECODE_ARRAY_BEGIN, 0, 0);
+  int result = ArrowIpcDecoderBuildArray(decoder, field_i, out, validation_level, error);
+  NANOARROW_TRACE(NANOARROW_TRACE_IPC_DECODE_ARRAY_END, result, 0);
+  return result;
+}
+
+static ArrowErrorCode ArrowIpcDecoderSetArrayViews(
+    struct ArrowIpcDecoder* decoder, struct ArrowIpcBufferFactory factory,
+    struct ArrowBufferView body, int64_t field_i, struct ArrowArrayView** out_view,
+    struct ArrowError* error) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+
+  if (private_data->last_message == NULL ||
+      decoder->message_type != NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH) {
+    ArrowErrorSet(error, "decoder did not just decode a RecordBatch message");
+    return EINVAL;
+  }
+
+  // Buffers of a device body can only be referenced by pointer
+  if (private_data->device_body) {
+    if (decoder->codec != NANOARROW_IPC_COMPRESSION_TYPE_NONE) {
+      ArrowErrorSet(error, "Can't decompress a message body in device memory");
+      return ENOTSUP;
+    } else if (ArrowIpcDecoderNeedsSwapEndian(decoder)) {
+      ArrowErrorSet(error,
+                    "Can't swap the endianness of a message body in device memory");
+      return ENOTSUP;
+    } else if (private_data->n_dictionaries > 0) {
+      ArrowErrorSet(error,
+                    "Can't decode dictionary-encoded fields from a message body in "
+                    "device memory");
+      return ENOTSUP;
+    }
+  }
+
+  NANOARROW_IPC_STATS_TIMER_START(start);
+  ns(RecordBatch_table_t) batch = (ns(RecordBatch_table_t))private_data->last_message;
+
+  // RecordBatch messages don't count the root node but decoder->fields does
+  struct ArrowIpcField* root = private_data->fields + field_i + 1;
+  struct ArrowArrayView* root_view = root->array_view;
+
+  struct ArrowIpcArraySetter setter;
+  setter.fields = ns(RecordBatch_nodes(batch));
+  setter.field_i = field_i;
+  setter.buffers = ns(RecordBatch_buffers(batch));
+  setter.buffer_i = root->buffer_offset - 1;
+  setter.body_size_bytes = decoder->body_size_bytes;
+  setter.factory = factory;
+  setter.src.codec = decoder->codec;
+  setter.src.swap_endian = ArrowIpcDecoderNeedsSwapEndian(decoder);
+  setter.body = body;
+  setter.private_data = private_data;
+  private_data->buffer_tasks.size_bytes = 0;
+
+  if (field_i == -1 && private_data->n_projected_fields > 0) {
+    // Each node of the projected tree is set from the position of its own field such
+    // that the FieldNodes and Buffers of other fields are never accessed
+    root_view = &private_data->projected_array_view;
+    private_data->projected_array_view.length = ns(RecordBatch_length(batch));
+    private_data->projected_array_view.null_count = 0;
+
+    for (int64_t i = 1; i < private_data->n_projected_fields; i++) {
+      struct ArrowIpcProjectedField* projected = private_data->projected_fields + i;
+      setter.field_i = projected->field_i - 1;
+      setter.buffer_i = private_data->fields[projected->field_i].buffer_offset - 1;
+      NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderSetArrayViewNode(
+          &setter, projected->array_view, projected->array, error));
+    }
+  } else if (field_i == -1) {
+    // The flatbuffers FieldNode doesn't count the root struct so we have to loop over
+    // the children ourselves
+    root->array_view->length = ns(RecordBatch_length(batch));
+    root->array_view->null_count = 0;
+    setter.field_i++;
+    setter.buffer_i++;
+
+    for (int64_t i = 0; i < root->array_view->n_children; i++) {
+      NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderWalkSetArrayView(
+          &setter, root->array_view->children[i], root->array->children[i], error));
+    }
+  } else {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcDecoderWalkSetArrayView(&setter, root->array_view, root->array, error));
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderRunBufferTasks(private_data, error));
+
+  *out_view = root_view;
+  NANOARROW_IPC_STATS_TIMER_STOP(private_data, decode_body_ns, start);
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowIpcDecoderDecodeArrayViewInternal(
+    struct ArrowIpcDecoder* decoder, struct ArrowIpcBufferFactory factory,
+    struct ArrowBufferView body, int64_t field_i, struct ArrowArrayView** out_view,
+    struct ArrowError* error) {
+  NANOARROW_TRACE(NANOARROW_TRACE_IPC_DECODE_ARRAY_VIEW_BEGIN, body.size_bytes, 0);
+  int result =
+      ArrowIpcDecoderSetArrayViews(decoder, factory, body, field_i, out_view, error);
+  NANOARROW_TRACE(NANOARROW_TRACE_IPC_DECODE_ARRAY_VIEW_END, result, 0);
+  return result;
+}
+
+// Checks that an ArrowArray can be decoded from a device body without the CPU reading
+// it: buffers must be referenced from a shared body (rather than copied from a view)
+// and validation must not dereference buffer content
+static ArrowErrorCode ArrowIpcDecoderCheckDeviceBody(
+    struct ArrowIpcDecoder* decoder, int shared,
+    enum ArrowValidationLevel validation_level, struct ArrowError* error) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+  if (!private_data->device_body) {
+    return NANOARROW_OK;
+  }
+
+  if (!shared) {
+    ArrowErrorSet(error,
+                  "Arrays must be decoded from a message body in device memory using "
+                  "ArrowIpcDecoderDecodeArrayFromShared()");
+    return EINVAL;
+  }
+
+  if (validation_level > NANOARROW_VALIDATION_LEVEL_MINIMAL) {
+    ArrowErrorSet(error,
+                  "Validation level of arrays decoded from a message body in device "
+                  "memory must be NANOARROW_VALIDATION_LEVEL_MINIMAL or lower");
+    return EINVAL;
+  }
+
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowIpcDecoderValidateArrayView(
+    struct ArrowIpcDecoder* decoder, struct ArrowArrayView* array_view,
+    enum ArrowValidationLevel validation_level, struct ArrowError* error) {
+  NANOARROW_TRACE(NANOARROW_TRACE_IPC_VALIDATE_BEGIN, validation_level, 0);
+  NANOARROW_IPC_STATS_TIMER_START(start);
+  int result = ArrowArrayViewValidate(array_view, validation_level, error);
+  NANOARROW_IPC_STATS_TIMER_STOP((struct ArrowIpcDecoderPrivate*)decoder->private_data,
+                                 validate_ns, start);
+  NANOARROW_TRACE(NANOARROW_TRACE_IPC_VALIDATE_END, result, 0);
+  return result;
+}
+
+ArrowErrorCode ArrowIpcDecoderDecodeArrayView(struct ArrowIpcDecoder* decoder,
+                                              struct ArrowBufferView body, int64_t i,
+                                              struct ArrowArrayView** out,
+                                              struct ArrowError* error) {
+  return ArrowIpcDecoderDecodeArrayViewInternal(
+      decoder, ArrowIpcBufferFactoryFromView(&body), body, i, out, error);
+}
+
+ArrowErrorCode ArrowIpcDecoderDecodeArray(struct ArrowIpcDecoder* decoder,
+                                          struct ArrowBufferView body, int64_t i,
+                                          struct ArrowArray* out,
+                                          enum ArrowValidationLevel validation_level,
+                                          struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcDecoderCheckDeviceBody(decoder, 0, validation_level, error));
+  struct ArrowArrayView* array_view;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeArrayViewInternal(
+      decoder, ArrowIpcBufferFactoryFromView(&body), body, i, &array_view, error));
+
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcDecoderValidateArrayView(decoder, array_view, validation_level, error));
+
+  struct ArrowArray temp;
+  temp.release = NULL;
+  int result =
+      ArrowIpcDecoderDecodeArrayInternal(decoder, i, &temp, validation_level, error);
+  if (result != NANOARROW_OK && temp.release != NULL) {
+    temp.release(&temp);
+  } else if (result != NANOARROW_OK) {
+    return result;
+  }
+
+  ArrowArrayMove(&temp, out);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcDecoderDecodeArrayInto(struct ArrowIpcDecoder* decoder,
+                                              struct ArrowBufferView body, int64_t i,
+                                              struct ArrowArray* out,
+                                              enum ArrowValidationLevel validation_level,
+                                              struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcDecoderCheckDeviceBody(decoder, 0, validation_level, error));
+  struct ArrowArrayView* array_view;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeArrayViewInternal(
+      decoder, ArrowIpcBufferFactoryFromView(&body), body, i, &array_view, error));
+
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcDecoderValidateArrayView(decoder, array_view, validation_level, error));
+
+  int result =
+      ArrowIpcDecoderDecodeArrayInternal(decoder, i, out, validation_level, error);
+  if (result != NANOARROW_OK && out->release != NULL) {
+    out->release(out);
+  }
+
+  return result;
+}
+
+ArrowErrorCode ArrowIpcDecoderDecodeArrayFromShared(
+    struct ArrowIpcDecoder* decoder, struct ArrowIpcSharedBuffer* body, int64_t i,
+    struct ArrowArray* out, enum ArrowValidationLevel validation_level,
+    struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcDecoderCheckDeviceBody(decoder, 1, validation_level, error));
+  struct ArrowBufferView body_view;
+  body_view.data.data = body->private_src.data;
+  body_view.size_bytes = body->private_src.size_bytes;
+
+  // Every buffer of the batch needs a reference to the body, which are acquired with
+  // one update of its (possibly atomic) reference count rather than one per buffer
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+  struct ArrowIpcSharedBufferReferences references;
+  ArrowIpcSharedBufferAcquire(body, private_data->n_buffers, &references);
+
+  struct ArrowArrayView* array_view;
+  int result = ArrowIpcDecoderDecodeArrayViewInternal(
+      decoder, ArrowIpcBufferFactoryFromShared(&references), body_view, i, &array_view,
+      error);
+  ArrowIpcSharedBufferRelease(&references);
+  NANOARROW_RETURN_NOT_OK(result);
+
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcDecoderValidateArrayView(decoder, array_view, validation_level, error));
+
+  struct ArrowArray temp;
+  temp.release = NULL;
+  result = ArrowIpcDecoderDecodeArrayInternal(decoder, i, &temp, validation_level, error);
+  if (result != NANOARROW_OK && temp.release != NULL) {
+    temp.release(&temp);
+  } else if (result != NANOARROW_OK) {
+    return result;
+  }
+
+  ArrowArrayMove(&temp, out);
+  return NANOARROW_OK;
+}
+
+#if defined(NANOARROW_IPC_WITH_DEVICE)
+// Decodes and validates the buffers of field i on the CPU and copies them to device in
+// one transfer, which is used when the buffers of out can't be sections of the body
+static ArrowErrorCode ArrowIpcDecoderDecodeDeviceArrayCopy(
+    struct ArrowIpcDecoder* decoder, struct ArrowBufferView body, int64_t i,
+    struct ArrowDevice* device, struct ArrowDeviceArray* out,
+    enum ArrowValidationLevel validation_level, struct ArrowError* error) {
+  struct ArrowArrayView* array_view;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcDecoderDecodeArrayView(decoder, body, i, &array_view, error));
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcDecoderValidateArrayView(decoder, array_view, validation_level, error));
+
+  // The copy only reads the view, which remains owned by the decoder
+  struct ArrowDeviceArrayView device_view;
+  device_view.device = ArrowDeviceCpu();
+  device_view.array_view = *array_view;
+  int result = ArrowDeviceArrayViewCopyCoalesced(&device_view, device, out);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "Failed to copy decoded buffers to device %ld",
+                  (long)device->device_id);
+  }
+
+  return result;
+}
+
+static ArrowErrorCode ArrowIpcDecoderDecodeDeviceArrayInternal(
+    struct ArrowIpcDecoder* decoder, struct ArrowBufferView body, int64_t i,
+    struct ArrowDevice* device, struct ArrowDeviceArray* out,
+    enum ArrowValidationLevel validation_level, struct ArrowError* error) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+  struct ArrowArray array;
+
+  if (device->device_type == ARROW_DEVICE_CPU) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcDecoderDecodeArray(decoder, body, i, &array, validation_level, error));
+    int result = ArrowDeviceArrayInit(device, out, &array);
+    if (result != NANOARROW_OK) {
+      array.release(&array);
+    }
+
+    return result;
+  }
+
+  if (private_data->last_message == NULL ||
+      decoder->message_type != NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH) {
+    ArrowErrorSet(error, "decoder did not just decode a RecordBatch message");
+    return EINVAL;
+  }
+
+  if (decoder->codec != NANOARROW_IPC_COMPRESSION_TYPE_NONE ||
+      ArrowIpcDecoderNeedsSwapEndian(decoder) || private_data->n_dictionaries > 0) {
+    return ArrowIpcDecoderDecodeDeviceArrayCopy(decoder, body, i, device, out,
+                                                validation_level, error);
+  }
+
+  // Levels that read buffer content can't run once the buffers are on the device
+  if (validation_level > NANOARROW_VALIDATION_LEVEL_MINIMAL) {
+    struct ArrowArrayView* array_view;
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcDecoderDecodeArrayView(decoder, body, i, &array_view, error));
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcDecoderValidateArrayView(decoder, array_view, validation_level, error));
+    validation_level = NANOARROW_VALIDATION_LEVEL_MINIMAL;
+  }
+
+  struct ArrowBuffer buffer;
+  int result = ArrowDeviceBufferInit(ArrowDeviceCpu(), body, device, &buffer);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "Failed to copy message body of %ld bytes to device %ld",
+                  (long)body.size_bytes, (long)device->device_id);
+    return result;
+  }
+
+  struct ArrowIpcSharedBuffer shared;
+  result = ArrowIpcSharedBufferInit(&shared, &buffer);
+  if (result != NANOARROW_OK) {
+    ArrowBufferReset(&buffer);
+    return result;
+  }
+
+  private_data->device_body = 1;
+  result = ArrowIpcDecoderDecodeArrayFromShared(decoder, &shared, i, &array,
+                                                validation_level, error);
+  ArrowIpcSharedBufferReset(&shared);
+  NANOARROW_RETURN_NOT_OK(result);
+
+  result = ArrowDeviceArrayInit(device, out, &array);
+  if (result != NANOARROW_OK) {
+    array.release(&array);
+  }
+
+  return result;
+}
+#endif
+
+ArrowErrorCode ArrowIpcDecoderDecodeDeviceArray(
+    struct ArrowIpcDecoder* decoder, struct ArrowBufferView body, int64_t i,
+    struct ArrowDevice* device, struct ArrowDeviceArray* out,
+    enum ArrowValidationLevel validation_level, struct ArrowError* error) {
+#if defined(NANOARROW_IPC_WITH_DEVICE)
+  // body is in CPU memory regardless of what was declared for other calls
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+  int device_body = private_data->device_body;
+  private_data->device_body = 0;
+  int result = ArrowIpcDecoderDecodeDeviceArrayInternal(decoder, body, i, device, out,
+                                                        validation_level, error);
+  private_data->device_body = device_body;
+  return result;
+#else
+  ArrowErrorSet(error, "nanoarrow_ipc was not built with NANOARROW_IPC_WITH_DEVICE");
+  return ENOTSUP;
+#endif
+}
+
+// Replaces (or, for a delta, appends to) the values of the dictionary targeted by the
+// last decoded DictionaryBatch message, taking ownership of values
+static ArrowErrorCode ArrowIpcDecoderUpdateDictionary(struct ArrowIpcDecoder* decoder,
+                                                      struct ArrowArray* values,
+                                                      struct ArrowError* error) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+  struct ArrowIpcDictionary* dictionary = private_data->pending_dictionary;
+
+#if defined(NANOARROW_IPC_WITH_STATS)
+  // The work done by the dictionary's decoder is reported as the work of this one
+  struct ArrowIpcDecoderPrivate* dictionary_private =
+      (struct ArrowIpcDecoderPrivate*)dictionary->decoder.private_data;
+  ArrowIpcDecoderAddStats(&private_data->stats, &dictionary_private->stats);
+  memset(&dictionary_private->stats, 0, sizeof(struct ArrowIpcStats));
+#endif
+
+  if (decoder->dictionary_is_delta && dictionary->values.release != NULL) {
+    struct ArrowArray* arrays[2];
+    arrays[0] = &dictionary->values;
+    arrays[1] = values;
+    struct ArrowArray combined;
+    int result = ArrowArrayConcatenate(arrays, 2, &dictionary->schema, &combined, error);
+    values->release(values);
+    NANOARROW_RETURN_NOT_OK(result);
+    ArrowArrayMove(&combined, values);
+  }
+
+  // Arrays that were already decoded keep a reference to the previous values
+  if (dictionary->values.release != NULL) {
+    dictionary->values.release(&dictionary->values);
+  }
+  ArrowArrayMove(values, &dictionary->values);
+  private_data->pending_dictionary = NULL;
+
+  int64_t dictionary_i = dictionary - private_data->dictionaries;
+  for (int64_t i = 0; i < private_data->n_fields; i++) {
+    struct ArrowIpcField* field = private_data->fields + i;
+    if (field->dictionary_i == dictionary_i) {
+      NANOARROW_RETURN_NOT_OK(ArrowArrayViewSetArray(field->array_view->dictionary,
+                                                     &dictionary->values, error));
+    }
+  }
+
+  for (int64_t i = 0; i < private_data->n_projected_fields; i++) {
+    struct ArrowIpcProjectedField* projected = private_data->projected_fields + i;
+    if (private_data->fields[projected->field_i].dictionary_i == dictionary_i) {
+      NANOARROW_RETURN_NOT_OK(ArrowArrayViewSetArray(projected->array_view->dictionary,
+                                                     &dictionary->values, error));
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowIpcDecoderCheckDictionaryBatch(
+    struct ArrowIpcDecoder* decoder, struct ArrowError* error) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+
+  if (private_data->pending_dictionary == NULL ||
+      decoder->message_type != NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH) {
+    ArrowErrorSet(error, "decoder did not just decode a DictionaryBatch message");
+    return EINVAL;
+  }
+
+  // Dictionary values are decoded, concatenated, and attached on the CPU
+  if (private_data->device_body) {
+    ArrowErrorSet(error, "Can't decode a DictionaryBatch message body in device memory");
+    return ENOTSUP;
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcDecoderDecodeDictionary(struct ArrowIpcDecoder* decoder,
+                                               struct ArrowBufferView body,
+                                               enum ArrowValidationLevel validation_level,
+                                               struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderCheckDictionaryBatch(decoder, error));
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+
+  struct ArrowArray values;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcDecoderDecodeArray(&private_data->pending_dictionary->decoder, body, 0,
+                                 &values, validation_level, error));
+  return ArrowIpcDecoderUpdateDictionary(decoder, &values, error);
+}
+
+ArrowErrorCode ArrowIpcDecoderDecodeDictionaryFromShared(
+    struct ArrowIpcDecoder* decoder, struct ArrowIpcSharedBuffer* body,
+    enum ArrowValidationLevel validation_level, struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderCheckDictionaryBatch(decoder, error));
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+
+  struct ArrowArray values;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeArrayFromShared(
+      &private_data->pending_dictionary->decoder, body, 0, &values, validation_level,
+      error));
+  return ArrowIpcDecoderUpdateDictionary(decoder, &values, error);
+}
+
+void ArrowIpcFooterInit(struct ArrowIpcFooter* footer) {
+  footer->schema.release = NULL;
+  ArrowBufferInit(&footer->record_batch_blocks);
+  ArrowBufferInit(&footer->dictionary_blocks);
+}
+
+void ArrowIpcFooterReset(struct ArrowIpcFooter* footer) {
+  if (footer->schema.release != NULL) {
+    footer->schema.release(&footer->schema);
+  }
+
+  ArrowBufferReset(&footer->record_batch_blocks);
+  ArrowBufferReset(&footer->dictionary_blocks);
 }
 
-struct ArrowIpcArraySetter {
-  ns(FieldNode_vec_t) fields;
-  int64_t field_i;
-  ns(Buffer_vec_t) buffers;
-  int64_t buffer_i;
-  int64_t body_size_bytes;
-  struct ArrowIpcBufferSource src;
-  struct ArrowIpcBufferFactory factory;
-};
+// The footer size and the magic bytes that end an Arrow IPC file
+static const int64_t kFileFooterSuffixSize = 10;
 
-static int ArrowIpcDecoderMakeBuffer(struct ArrowIpcArraySetter* setter, int64_t offset,
-                                     int64_t length, struct ArrowBufferView* out_view,
-                                     struct ArrowBuffer* out, struct ArrowError* error) {
-  out_view->data.data = NULL;
-  out_view->size_bytes = 0;
+ArrowErrorCode ArrowIpcDecoderPeekFooter(struct ArrowIpcDecoder* decoder,
+                                         struct ArrowBufferView data,
+                                         struct ArrowError* error) {
+  struct ArrowIpcDecoderPrivate* private_data =
+      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
 
-  if (length == 0) {
-    return NANOARROW_OK;
+  ArrowIpcDecoderResetHeaderInfo(decoder);
+  if (data.size_bytes < kFileFooterSuffixSize) {
+    ArrowErrorSet(error, "Expected data of at least 10 bytes but only %ld bytes remain",
+                  (long)data.size_bytes);
+    return ESPIPE;
   }
 
-  // Check that this buffer fits within the body
-  int64_t buffer_start = offset;
-  int64_t buffer_end = buffer_start + length;
-  if (buffer_start < 0 || buffer_end > setter->body_size_bytes) {
-    ArrowErrorSet(error, "Buffer requires body offsets [%ld..%ld) but body has size %ld",
-                  (long)buffer_start, (long)buffer_end, (long)setter->body_size_bytes);
+  const uint8_t* suffix =
+      data.data.as_uint8 + data.size_bytes - kFileFooterSuffixSize;
+  if (memcmp(suffix + 4, "ARROW1", 6) != 0) {
+    ArrowErrorSet(error, "Expected file to end with magic bytes 'ARROW1'");
     return EINVAL;
   }
 
-  // If the ArrowIpcBufferFactory is made public, these should get moved (since then a
-  // user could inject support for either one). More likely, by the time that happens,
-  // this library will be able to support some of these features.
-  if (setter->src.codec != NANOARROW_IPC_COMPRESSION_TYPE_NONE) {
-    ArrowErrorSet(error, "The nanoarrow_ipc extension does not support compression");
-    return ENOTSUP;
+  struct ArrowBufferView size_view;
+  size_view.data.as_uint8 = suffix;
+  size_view.size_bytes = 4;
+  int swap_endian = private_data->system_endianness == NANOARROW_IPC_ENDIANNESS_BIG;
+  int32_t footer_size_bytes = ArrowIpcReadInt32LE(&size_view, swap_endian);
+  if (footer_size_bytes <= 0 || footer_size_bytes > (INT32_MAX - kFileFooterSuffixSize)) {
+    ArrowErrorSet(error, "Expected footer size > 0 but found footer size of %ld bytes",
+                  (long)footer_size_bytes);
+    return EINVAL;
   }
 
-  setter->src.body_offset_bytes = offset;
-  setter->src.buffer_length_bytes = length;
-  NANOARROW_RETURN_NOT_OK(
-      setter->factory.make_buffer(&setter->factory, &setter->src, out_view, out, error));
-
-  if (setter->src.swap_endian) {
-    NANOARROW_RETURN_NOT_OK(
-        ArrowIpcDecoderSwapEndian(&setter->src, out_view, out, error));
+  decoder->header_size_bytes = footer_size_bytes + (int32_t)kFileFooterSuffixSize;
+  if (data.size_bytes < decoder->header_size_bytes) {
+    ArrowErrorSet(error,
+                  "Expected >= %ld bytes of remaining data but found %ld bytes in buffer",
+                  (long)decoder->header_size_bytes, (long)data.size_bytes);
+    return ESPIPE;
   }
 
   return NANOARROW_OK;
 }
 
-static int ArrowIpcDecoderWalkGetArray(struct ArrowArrayView* array_view,
-                                       struct ArrowArray* array, struct ArrowArray* out,
-                                       struct ArrowError* error) {
-  out->length = array_view->length;
-  out->null_count = array_view->null_count;
-
-  for (int64_t i = 0; i < array->n_buffers; i++) {
-    struct ArrowBufferView view = array_view->buffer_views[i];
-    struct ArrowBuffer* scratch_buffer = ArrowArrayBuffer(array, i);
-    struct ArrowBuffer* buffer_out = ArrowArrayBuffer(out, i);
+ArrowErrorCode ArrowIpcDecoderVerifyFooter(struct ArrowIpcDecoder* decoder,
+                                           struct ArrowBufferView data,
+                                           struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderPeekFooter(decoder, data, error));
 
-    // If the scratch buffer was used, move it to the final array. Otherwise,
-    // copy the view.
-    if (scratch_buffer->size_bytes == 0) {
-      NANOARROW_RETURN_NOT_OK(ArrowBufferAppendBufferView(buffer_out, view));
-    } else if (scratch_buffer->data == view.data.as_uint8) {
-      ArrowBufferMove(scratch_buffer, buffer_out);
-    } else {
-      ArrowErrorSet(
-          error,
-          "Internal: scratch buffer was used but doesn't point to the same data as view");
-      return EINVAL;
-    }
+  int64_t footer_size_bytes = decoder->header_size_bytes - kFileFooterSuffixSize;
+  const uint8_t* footer_data =
+      data.data.as_uint8 + data.size_bytes - decoder->header_size_bytes;
+  if (ns(Footer_verify_as_root(footer_data, footer_size_bytes)) != flatcc_verify_ok) {
+    ArrowErrorSet(error, "Footer flatbuffer verification failed");
+    return EINVAL;
   }
 
-  for (int64_t i = 0; i < array->n_children; i++) {
-    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderWalkGetArray(
-        array_view->children[i], array->children[i], out->children[i], error));
+  return NANOARROW_OK;
+}
+
+static int ArrowIpcDecoderSetFileBlocks(ns(Block_vec_t) blocks, struct ArrowBuffer* out,
+                                        struct ArrowError* error) {
+  int64_t n_blocks = ns(Block_vec_len(blocks));
+  out->size_bytes = 0;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferReserve(out, n_blocks * sizeof(struct ArrowIpcFileBlock)), error);
+  for (int64_t i = 0; i < n_blocks; i++) {
+    ns(Block_struct_t) block = ns(Block_vec_at(blocks, i));
+    struct ArrowIpcFileBlock file_block;
+    file_block.offset = ns(Block_offset(block));
+    file_block.metadata_length = ns(Block_metaDataLength(block));
+    file_block.body_length = ns(Block_bodyLength(block));
+    ArrowBufferAppendUnsafe(out, &file_block, sizeof(file_block));
   }
 
   return NANOARROW_OK;
 }
 
-static int ArrowIpcDecoderWalkSetArrayView(struct ArrowIpcArraySetter* setter,
-                                           struct ArrowArrayView* array_view,
-                                           struct ArrowArray* array,
+ArrowErrorCode ArrowIpcDecoderDecodeFooter(struct ArrowIpcDecoder* decoder,
+                                           struct ArrowBufferView data,
+                                           struct ArrowIpcFooter* out,
                                            struct ArrowError* error) {
-  ns(FieldNode_struct_t) field =
-      ns(FieldNode_vec_at(setter->fields, (size_t)setter->field_i));
-  array_view->length = ns(FieldNode_length(field));
-  array_view->null_count = ns(FieldNode_null_count(field));
-  setter->field_i += 1;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderPeekFooter(decoder, data, error));
 
-  for (int64_t i = 0; i < 3; i++) {
-    if (array_view->layout.buffer_type[i] == NANOARROW_BUFFER_TYPE_NONE) {
-      break;
-    }
+  const uint8_t* footer_data =
+      data.data.as_uint8 + data.size_bytes - decoder->header_size_bytes;
+  ns(Footer_table_t) footer = ns(Footer_as_root(footer_data));
+  if (!footer) {
+    return EINVAL;
+  }
 
-    ns(Buffer_struct_t) buffer =
-        ns(Buffer_vec_at(setter->buffers, (size_t)setter->buffer_i));
-    int64_t buffer_offset = ns(Buffer_offset(buffer));
-    int64_t buffer_length = ns(Buffer_length(buffer));
-    setter->buffer_i += 1;
+  ns(Schema_table_t) schema = ns(Footer_schema(footer));
+  if (!schema) {
+    ArrowErrorSet(error, "Footer has no schema");
+    return EINVAL;
+  }
 
-    // Provide a buffer that will be used if any allocation has to occur
-    struct ArrowBuffer* buffer_dst = ArrowArrayBuffer(array, i);
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeSchemaHeader(decoder, schema, error));
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderSetSchemaDictionaryIds(decoder, schema, error));
 
-    // Attempt to re-use any previous allocation unless this buffer is
-    // wrapping a custom allocator.
-    if (buffer_dst->allocator.private_data != NULL) {
-      ArrowBufferReset(buffer_dst);
-    } else {
-      buffer_dst->size_bytes = 0;
-    }
+  struct ArrowSchema tmp;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderSchemaFromFlatbuffer(schema, &tmp, error));
+  if (out->schema.release != NULL) {
+    out->schema.release(&out->schema);
+  }
+  ArrowSchemaMove(&tmp, &out->schema);
 
-    setter->src.data_type = array_view->layout.buffer_data_type[i];
-    setter->src.element_size_bits = array_view->layout.element_size_bits[i];
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderSetFileBlocks(
+      ns(Footer_recordBatches(footer)), &out->record_batch_blocks, error));
+  return ArrowIpcDecoderSetFileBlocks(ns(Footer_dictionaries(footer)),
+                                      &out->dictionary_blocks, error);
+}
 
-    NANOARROW_RETURN_NOT_OK(
-        ArrowIpcDecoderMakeBuffer(setter, buffer_offset, buffer_length,
-                                  &array_view->buffer_views[i], buffer_dst, error));
+// The magic bytes and padding that begin an Arrow IPC file
+static const int64_t kFileMagicPaddedSize = 8;
+
+struct ArrowIpcFileReaderPrivate {
+  struct ArrowIpcDecoder decoder;
+  // A reference to the entire file
+  struct ArrowIpcSharedBuffer file;
+};
+
+static ArrowErrorCode ArrowIpcFileReaderDecodeDictionaries(
+    struct ArrowIpcFileReader* reader, struct ArrowError* error);
+
+ArrowErrorCode ArrowIpcFileReaderInit(struct ArrowIpcFileReader* reader,
+                                      struct ArrowIpcSharedBuffer* file,
+                                      struct ArrowError* error) {
+  struct ArrowBufferView data;
+  data.data.data = file->private_src.data;
+  data.size_bytes = file->private_src.size_bytes;
+
+  if (data.size_bytes < kFileMagicPaddedSize + kFileFooterSuffixSize ||
+      memcmp(data.data.data, "ARROW1", 6) != 0) {
+    ArrowErrorSet(error, "Expected file to start with magic bytes 'ARROW1'");
+    return EINVAL;
   }
 
-  for (int64_t i = 0; i < array_view->n_children; i++) {
-    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderWalkSetArrayView(
-        setter, array_view->children[i], array->children[i], error));
+  struct ArrowIpcFileReaderPrivate* private_data =
+      (struct ArrowIpcFileReaderPrivate*)ArrowMalloc(
+          sizeof(struct ArrowIpcFileReaderPrivate));
+  if (private_data == NULL) {
+    ArrowErrorSet(error, "Failed to allocate ArrowIpcFileReaderPrivate");
+    return ENOMEM;
   }
 
-  return NANOARROW_OK;
-}
+  int result = ArrowIpcDecoderInit(&private_data->decoder);
+  if (result != NANOARROW_OK) {
+    ArrowFree(private_data);
+    return result;
+  }
 
-static ArrowErrorCode ArrowIpcDecoderDecodeArrayInternal(
-    struct ArrowIpcDecoder* decoder, int64_t field_i, struct ArrowArray* out,
-    enum ArrowValidationLevel validation_level, struct ArrowError* error) {
-  struct ArrowIpcDecoderPrivate* private_data =
-      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+  ArrowIpcSharedBufferClone(file, &private_data->file.private_src);
+  ArrowIpcFooterInit(&reader->footer);
+  reader->n_record_batches = 0;
+  reader->private_data = private_data;
+
+  // The footer must not overlap the magic bytes at the start of the file
+  data.data.as_uint8 += kFileMagicPaddedSize;
+  data.size_bytes -= kFileMagicPaddedSize;
+
+  struct ArrowIpcDecoder* decoder = &private_data->decoder;
+  result = ArrowIpcDecoderVerifyFooter(decoder, data, error);
+  if (result == ESPIPE) {
+    ArrowErrorSet(error, "Footer of %ld bytes is larger than the file",
+                  (long)decoder->header_size_bytes);
+    result = EINVAL;
+  }
 
-  struct ArrowIpcField* root = private_data->fields + field_i + 1;
+  if (result == NANOARROW_OK) {
+    result = ArrowIpcDecoderDecodeFooter(decoder, data, &reader->footer, error);
+  }
 
-  if (field_i == -1) {
-    NANOARROW_RETURN_NOT_OK(
-        ArrowArrayInitFromArrayView(out, &private_data->array_view, error));
-    out->length = private_data->array_view.length;
-    out->null_count = private_data->array_view.null_count;
+  if (result == NANOARROW_OK) {
+    result = ArrowIpcDecoderSetSchema(decoder, &reader->footer.schema, error);
+  }
 
-    for (int64_t i = 0; i < private_data->array_view.n_children; i++) {
-      NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderWalkGetArray(
-          private_data->array_view.children[i], private_data->array.children[i],
-          out->children[i], error));
-    }
+  if (result == NANOARROW_OK) {
+    result = ArrowIpcDecoderSetEndianness(decoder, decoder->endianness);
+  }
 
-  } else {
-    NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromArrayView(out, root->array_view, error));
-    NANOARROW_RETURN_NOT_OK(
-        ArrowIpcDecoderWalkGetArray(root->array_view, root->array, out, error));
+  if (result == NANOARROW_OK) {
+    result = ArrowIpcFileReaderDecodeDictionaries(reader, error);
   }
 
-  // If validation is going to happen it has already occurred; however, the part of
-  // ArrowArrayFinishBuilding() that allocates a data buffer if the data buffer is
-  // NULL (required for compatibility with Arrow <= 9.0.0) assumes CPU data access
-  // and thus needs a validation level >= default.
-  if (validation_level >= NANOARROW_VALIDATION_LEVEL_DEFAULT) {
-    NANOARROW_RETURN_NOT_OK(
-        ArrowArrayFinishBuilding(out, NANOARROW_VALIDATION_LEVEL_DEFAULT, error));
-  } else {
-    NANOARROW_RETURN_NOT_OK(
-        ArrowArrayFinishBuilding(out, NANOARROW_VALIDATION_LEVEL_NONE, error));
+  if (result != NANOARROW_OK) {
+    ArrowIpcFileReaderReset(reader);
+    return result;
   }
 
+  reader->n_record_batches =
+      reader->footer.record_batch_blocks.size_bytes / sizeof(struct ArrowIpcFileBlock);
   return NANOARROW_OK;
 }
 
-static ArrowErrorCode ArrowIpcDecoderDecodeArrayViewInternal(
-    struct ArrowIpcDecoder* decoder, struct ArrowIpcBufferFactory factory,
-    int64_t field_i, struct ArrowArrayView** out_view, struct ArrowError* error) {
-  struct ArrowIpcDecoderPrivate* private_data =
-      (struct ArrowIpcDecoderPrivate*)decoder->private_data;
+void ArrowIpcFileReaderReset(struct ArrowIpcFileReader* reader) {
+  struct ArrowIpcFileReaderPrivate* private_data =
+      (struct ArrowIpcFileReaderPrivate*)reader->private_data;
 
-  if (private_data->last_message == NULL ||
-      decoder->message_type != NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH) {
-    ArrowErrorSet(error, "decoder did not just decode a RecordBatch message");
-    return EINVAL;
+  if (private_data != NULL) {
+    ArrowIpcDecoderReset(&private_data->decoder);
+    ArrowIpcSharedBufferReset(&private_data->file);
+    ArrowFree(private_data);
   }
 
-  ns(RecordBatch_table_t) batch = (ns(RecordBatch_table_t))private_data->last_message;
+  ArrowIpcFooterReset(&reader->footer);
+  reader->n_record_batches = 0;
+  reader->private_data = NULL;
+}
 
-  // RecordBatch messages don't count the root node but decoder->fields does
-  struct ArrowIpcField* root = private_data->fields + field_i + 1;
+// Decodes the header of the message at block and returns the message body as a slice
+// of the file (or only checks its bounds if body is NULL)
+static ArrowErrorCode ArrowIpcFileReaderDecodeBlock(
+    struct ArrowIpcFileReaderPrivate* private_data, struct ArrowIpcFileBlock block,
+    const char* block_name, int64_t i, enum ArrowIpcMessageType message_type,
+    struct ArrowIpcSharedBuffer* body, struct ArrowError* error) {
+  struct ArrowIpcDecoder* decoder = &private_data->decoder;
+
+  int64_t file_size_bytes = private_data->file.private_src.size_bytes;
+  if (block.offset < kFileMagicPaddedSize || block.metadata_length <= 0 ||
+      block.body_length < 0 || block.offset > file_size_bytes ||
+      block.metadata_length > (file_size_bytes - block.offset) ||
+      block.body_length > (file_size_bytes - block.offset - block.metadata_length)) {
+    ArrowErrorSet(error,
+                  "%s %ld at offset %ld with metadata length %ld and body "
+                  "length %ld is outside a file of %ld bytes",
+                  block_name, (long)i, (long)block.offset, (long)block.metadata_length,
+                  (long)block.body_length, (long)file_size_bytes);
+    return EINVAL;
+  }
 
-  struct ArrowIpcArraySetter setter;
-  setter.fields = ns(RecordBatch_nodes(batch));
-  setter.field_i = field_i;
-  setter.buffers = ns(RecordBatch_buffers(batch));
-  setter.buffer_i = root->buffer_offset - 1;
-  setter.body_size_bytes = decoder->body_size_bytes;
-  setter.factory = factory;
-  setter.src.codec = decoder->codec;
-  setter.src.swap_endian = ArrowIpcDecoderNeedsSwapEndian(decoder);
+  struct ArrowBufferView header;
+  header.data.as_uint8 = private_data->file.private_src.data + block.offset;
+  header.size_bytes = block.metadata_length;
+  int result = ArrowIpcDecoderVerifyHeader(decoder, header, error);
+  if (result == ESPIPE) {
+    ArrowErrorSet(error, "%s %ld header is larger than its metadata length", block_name,
+                  (long)i);
+    return EINVAL;
+  }
+  NANOARROW_RETURN_NOT_OK(result);
 
-  // The flatbuffers FieldNode doesn't count the root struct so we have to loop over the
-  // children ourselves
-  if (field_i == -1) {
-    root->array_view->length = ns(RecordBatch_length(batch));
-    root->array_view->null_count = 0;
-    setter.field_i++;
-    setter.buffer_i++;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeHeader(decoder, header, error));
+  if (decoder->message_type != message_type) {
+    ArrowErrorSet(error, "Expected %s message at block %ld but found %s",
+                  ns(MessageHeader_type_name(message_type)), (long)i,
+                  ns(MessageHeader_type_name(decoder->message_type)));
+    return EINVAL;
+  }
 
-    for (int64_t i = 0; i < root->array_view->n_children; i++) {
-      NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderWalkSetArrayView(
-          &setter, root->array_view->children[i], root->array->children[i], error));
-    }
-  } else {
-    NANOARROW_RETURN_NOT_OK(
-        ArrowIpcDecoderWalkSetArrayView(&setter, root->array_view, root->array, error));
+  if (decoder->body_size_bytes > block.body_length) {
+    ArrowErrorSet(error, "%s %ld body of %ld bytes exceeds its block of %ld", block_name,
+                  (long)i, (long)decoder->body_size_bytes, (long)block.body_length);
+    return EINVAL;
+  }
+
+  if (body != NULL) {
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+        ArrowIpcSharedBufferSlice(&private_data->file,
+                                  block.offset + block.metadata_length,
+                                  decoder->body_size_bytes, body),
+        error);
   }
 
-  *out_view = root->array_view;
   return NANOARROW_OK;
 }
 
-ArrowErrorCode ArrowIpcDecoderDecodeArrayView(struct ArrowIpcDecoder* decoder,
-                                              struct ArrowBufferView body, int64_t i,
-                                              struct ArrowArrayView** out,
-                                              struct ArrowError* error) {
-  return ArrowIpcDecoderDecodeArrayViewInternal(
-      decoder, ArrowIpcBufferFactoryFromView(&body), i, out, error);
-}
+// Decodes every DictionaryBatch message listed in the footer such that all
+// dictionaries are available before any record batch is read
+static ArrowErrorCode ArrowIpcFileReaderDecodeDictionaries(
+    struct ArrowIpcFileReader* reader, struct ArrowError* error) {
+  struct ArrowIpcFileReaderPrivate* private_data =
+      (struct ArrowIpcFileReaderPrivate*)reader->private_data;
+
+  const struct ArrowIpcFileBlock* blocks =
+      (const struct ArrowIpcFileBlock*)reader->footer.dictionary_blocks.data;
+  int64_t n_blocks =
+      reader->footer.dictionary_blocks.size_bytes / sizeof(struct ArrowIpcFileBlock);
+  for (int64_t i = 0; i < n_blocks; i++) {
+    struct ArrowIpcSharedBuffer body;
+    NANOARROW_RETURN_NOT_OK(ArrowIpcFileReaderDecodeBlock(
+        private_data, blocks[i], "Dictionary batch", i,
+        NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH, &body, error));
+    int result = ArrowIpcDecoderDecodeDictionaryFromShared(
+        &private_data->decoder, &body, NANOARROW_VALIDATION_LEVEL_FULL, error);
+    ArrowIpcSharedBufferReset(&body);
+    NANOARROW_RETURN_NOT_OK(result);
+  }
 
-ArrowErrorCode ArrowIpcDecoderDecodeArray(struct ArrowIpcDecoder* decoder,
-                                          struct ArrowBufferView body, int64_t i,
-                                          struct ArrowArray* out,
-                                          enum ArrowValidationLevel validation_level,
-                                          struct ArrowError* error) {
-  struct ArrowArrayView* array_view;
-  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeArrayViewInternal(
-      decoder, ArrowIpcBufferFactoryFromView(&body), i, &array_view, error));
+  return NANOARROW_OK;
+}
 
-  NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidate(array_view, validation_level, error));
+ArrowErrorCode ArrowIpcFileReaderReadRecordBatch(struct ArrowIpcFileReader* reader,
+                                                 int64_t i, struct ArrowArray* out,
+                                                 struct ArrowError* error) {
+  struct ArrowIpcFileReaderPrivate* private_data =
+      (struct ArrowIpcFileReaderPrivate*)reader->private_data;
 
-  struct ArrowArray temp;
-  temp.release = NULL;
-  int result =
-      ArrowIpcDecoderDecodeArrayInternal(decoder, i, &temp, validation_level, error);
-  if (result != NANOARROW_OK && temp.release != NULL) {
-    temp.release(&temp);
-  } else if (result != NANOARROW_OK) {
-    return result;
+  if (i < 0 || i >= reader->n_record_batches) {
+    ArrowErrorSet(error, "Expected record batch index in [0, %ld) but found %ld",
+                  (long)reader->n_record_batches, (long)i);
+    return EINVAL;
   }
 
-  ArrowArrayMove(&temp, out);
-  return NANOARROW_OK;
+  struct ArrowIpcFileBlock block =
+      ((const struct ArrowIpcFileBlock*)reader->footer.record_batch_blocks.data)[i];
+  struct ArrowIpcSharedBuffer body;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcFileReaderDecodeBlock(
+      private_data, block, "Record batch", i, NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH,
+      &body, error));
+  int result = ArrowIpcDecoderDecodeArrayFromShared(
+      &private_data->decoder, &body, -1, out, NANOARROW_VALIDATION_LEVEL_FULL, error);
+  ArrowIpcSharedBufferReset(&body);
+  return result;
 }
 
-ArrowErrorCode ArrowIpcDecoderDecodeArrayFromShared(
-    struct ArrowIpcDecoder* decoder, struct ArrowIpcSharedBuffer* body, int64_t i,
-    struct ArrowArray* out, enum ArrowValidationLevel validation_level,
+ArrowErrorCode ArrowIpcFileReaderReadRecordBatchSizes(
+    struct ArrowIpcFileReader* reader, int64_t i, struct ArrowIpcRecordBatchSizes* out,
     struct ArrowError* error) {
-  struct ArrowArrayView* array_view;
-  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeArrayViewInternal(
-      decoder, ArrowIpcBufferFactoryFromShared(body), i, &array_view, error));
+  struct ArrowIpcFileReaderPrivate* private_data =
+      (struct ArrowIpcFileReaderPrivate*)reader->private_data;
 
-  NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidate(array_view, validation_level, error));
-
-  struct ArrowArray temp;
-  temp.release = NULL;
-  int result =
-      ArrowIpcDecoderDecodeArrayInternal(decoder, i, &temp, validation_level, error);
-  if (result != NANOARROW_OK && temp.release != NULL) {
-    temp.release(&temp);
-  } else if (result != NANOARROW_OK) {
-    return result;
+  if (i < 0 || i >= reader->n_record_batches) {
+    ArrowErrorSet(error, "Expected record batch index in [0, %ld) but found %ld",
+                  (long)reader->n_record_batches, (long)i);
+    return EINVAL;
   }
 
-  ArrowArrayMove(&temp, out);
-  return NANOARROW_OK;
+  struct ArrowIpcFileBlock block =
+      ((const struct ArrowIpcFileBlock*)reader->footer.record_batch_blocks.data)[i];
+  NANOARROW_RETURN_NOT_OK(ArrowIpcFileReaderDecodeBlock(
+      private_data, block, "Record batch", i, NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH,
+      NULL, error));
+  return ArrowIpcDecoderDecodeRecordBatchSizes(&private_data->decoder, out, error);
 }
@@ -16,10 +16,13 @@
 // under the License.
 
 #include <thread>
+#include <vector>
 
 #include <arrow/array.h>
+#include <arrow/builder.h>
 #include <arrow/c/bridge.h>
 #include <arrow/ipc/api.h>
+#include <arrow/util/compression.h>
 #include <arrow/util/key_value_metadata.h>
 #include <gtest/gtest.h>
 
@@ -28,6 +31,10 @@
 
 #include "nanoarrow_ipc.h"
 
+#if defined(NANOARROW_IPC_WITH_DEVICE)
+#include "nanoarrow_device.h"
+#endif
+
 using namespace arrow;
 
 // Copied from nanoarrow_ipc.c so we can test the internal state
@@ -37,8 +44,12 @@ struct ArrowIpcField {
   struct ArrowArrayView* array_view;
   struct ArrowArray* array;
   int64_t buffer_offset;
+  int64_t dictionary_i;
 };
 
+struct ArrowIpcDictionary;
+struct ArrowIpcProjectedField;
+
 struct ArrowIpcDecoderPrivate {
   enum ArrowIpcEndianness endianness;
   enum ArrowIpcEndianness system_endianness;
@@ -48,6 +59,28 @@ struct ArrowIpcDecoderPrivate {
   struct ArrowIpcField* fields;
   int64_t n_buffers;
   const void* last_message;
+  struct ArrowBufferView last_message_data;
+  struct ArrowIpcSchemaCache* schema_cache;
+  struct ArrowBufferView verified_message_data;
+  struct ArrowBuffer header_copy;
+  struct ArrowBuffer record_batch_sizes;
+  enum ArrowIpcVerificationLevel verification_level;
+  struct ArrowExecutor* executor;
+  struct ArrowBufferAllocator allocator;
+  int64_t shared_buffer_copy_threshold_bytes;
+  int device_body;
+  struct ArrowBuffer buffer_tasks;
+  struct ArrowBuffer schema_dictionary_ids;
+  int64_t n_dictionaries;
+  struct ArrowIpcDictionary* dictionaries;
+  struct ArrowIpcDictionary* pending_dictionary;
+  struct ArrowArrayView projected_array_view;
+  struct ArrowArray projected_array;
+  int64_t n_projected_fields;
+  struct ArrowIpcProjectedField* projected_fields;
+#if defined(NANOARROW_IPC_WITH_STATS)
+  struct ArrowIpcStats stats;
+#endif
 };
 }
 
@@ -263,6 +296,85 @@ TEST(NanoarrowIpcTest, NanoarrowIpcVerifyInvalid) {
   ArrowIpcDecoderReset(&decoder);
 }
 
+TEST(NanoarrowIpcTest, NanoarrowIpcVerifyTrusted) {
+  struct ArrowIpcDecoder decoder;
+  struct ArrowError error;
+  struct ArrowSchema schema;
+
+  ArrowIpcDecoderInit(&decoder);
+  EXPECT_EQ(ArrowIpcDecoderSetVerificationLevel(
+                &decoder, static_cast<enum ArrowIpcVerificationLevel>(-1)),
+            EINVAL);
+  ASSERT_EQ(ArrowIpcDecoderSetVerificationLevel(&decoder,
+                                                NANOARROW_IPC_VERIFICATION_LEVEL_TRUSTED),
+            NANOARROW_OK);
+
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderSetSchema(&decoder, &schema, nullptr), NANOARROW_OK);
+
+  struct ArrowBufferView data;
+  data.data.as_uint8 = kSimpleRecordBatch;
+  data.size_bytes = sizeof(kSimpleRecordBatch);
+  ASSERT_EQ(ArrowIpcDecoderVerifyHeader(&decoder, data, &error), NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(decoder.message_type, NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH);
+  EXPECT_EQ(decoder.body_size_bytes, 16);
+
+  // Schema messages are still fully verified
+  alignas(8) uint8_t simple_schema_invalid[sizeof(kSimpleSchema)];
+  data.data.as_uint8 = simple_schema_invalid;
+  data.size_bytes = sizeof(simple_schema_invalid);
+  for (int64_t i = 1; i < 265; i++) {
+    SCOPED_TRACE(i);
+
+    memcpy(simple_schema_invalid, kSimpleSchema, i);
+    memcpy(simple_schema_invalid + i, kSimpleSchema + (i + 1),
+           (sizeof(simple_schema_invalid) - i - 1));
+
+    ArrowErrorInit(&error);
+    ASSERT_NE(ArrowIpcDecoderVerifyHeader(&decoder, data, &error), NANOARROW_OK);
+    ASSERT_GT(strlen(error.message), 0);
+  }
+
+  // Record batch messages that pass the bounds check must be safe to decode. Removing
+  // bytes from the start of the message must cause the check to fail.
+  int64_t header_size = sizeof(kSimpleRecordBatch) - 16;
+  alignas(8) uint8_t batch_invalid[sizeof(kSimpleRecordBatch)];
+  data.data.as_uint8 = batch_invalid;
+  data.size_bytes = sizeof(batch_invalid);
+  int64_t n_failed = 0;
+  for (int64_t i = 8; i < header_size; i++) {
+    SCOPED_TRACE(i);
+
+    memcpy(batch_invalid, kSimpleRecordBatch, i);
+    memcpy(batch_invalid + i, kSimpleRecordBatch + (i + 1),
+           (sizeof(batch_invalid) - i - 1));
+
+    ArrowErrorInit(&error);
+    if (ArrowIpcDecoderVerifyHeader(&decoder, data, &error) != NANOARROW_OK) {
+      ASSERT_GT(strlen(error.message), 0);
+      n_failed++;
+      continue;
+    }
+
+    if (ArrowIpcDecoderDecodeHeader(&decoder, data, &error) != NANOARROW_OK) {
+      continue;
+    }
+
+    struct ArrowBufferView body;
+    body.data.as_uint8 = batch_invalid + decoder.header_size_bytes;
+    body.size_bytes = sizeof(batch_invalid) - decoder.header_size_bytes;
+    struct ArrowArrayView* array_view;
+    ArrowIpcDecoderDecodeArrayView(&decoder, body, -1, &array_view, &error);
+  }
+
+  EXPECT_GT(n_failed, 0);
+  schema.release(&schema);
+  ArrowIpcDecoderReset(&decoder);
+}
+
 TEST(NanoarrowIpcTest, NanoarrowIpcDecodeSimpleSchema) {
   struct ArrowIpcDecoder decoder;
   struct ArrowError error;
@@ -364,13 +476,18 @@ TEST(NanoarrowIpcTest, NanoarrowIpcDecodeSimpleRecordBatch) {
 
   array.release(&array);
 
-  // Field extract should fail if compression was set
-  decoder.codec = NANOARROW_IPC_COMPRESSION_TYPE_ZSTD;
-  EXPECT_EQ(ArrowIpcDecoderDecodeArray(&decoder, body, 0, &array,
-                                       NANOARROW_VALIDATION_LEVEL_FULL, &error),
-            ENOTSUP);
-  EXPECT_STREQ(error.message, "The nanoarrow_ipc extension does not support compression");
-  decoder.codec = NANOARROW_IPC_COMPRESSION_TYPE_NONE;
+  // Field extract should fail if compression was set and is not supported by this
+  // build
+  if (!ArrowIpcDecompressionIsSupported(NANOARROW_IPC_COMPRESSION_TYPE_ZSTD)) {
+    decoder.codec = NANOARROW_IPC_COMPRESSION_TYPE_ZSTD;
+    EXPECT_EQ(ArrowIpcDecoderDecodeArray(&decoder, body, 0, &array,
+                                         NANOARROW_VALIDATION_LEVEL_FULL, &error),
+              ENOTSUP);
+    EXPECT_STREQ(error.message,
+                 "The nanoarrow_ipc extension was built without support for "
+                 "compression type 'ZSTD' (2)");
+    decoder.codec = NANOARROW_IPC_COMPRESSION_TYPE_NONE;
+  }
 
   // Field extract should fail if body is too small
   decoder.body_size_bytes = 0;
@@ -552,6 +669,385 @@ TEST(NanoarrowIpcTest, NanoarrowIpcDecodeSimpleRecordBatchFromShared) {
   ArrowIpcDecoderReset(&decoder);
 }
 
+static void FreeTransportSlice(struct ArrowBufferAllocator* allocator, uint8_t* ptr,
+                               int64_t size) {
+  *reinterpret_cast<int*>(allocator->private_data) += 1;
+}
+
+TEST(NanoarrowIpcTest, NanoarrowIpcDecodeFlightData) {
+  struct ArrowIpcDecoder decoder;
+  struct ArrowError error;
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+
+  uint8_t one_two_three_le[] = {0x01, 0x00, 0x00, 0x00, 0x02, 0x00,
+                                0x00, 0x00, 0x03, 0x00, 0x00, 0x00};
+
+  // Flight carries the flatbuffer bytes of each message without the 8 byte prefix,
+  // possibly at an unaligned address
+  std::vector<uint64_t> storage(sizeof(kSimpleSchema) / 8 + 1);
+  uint8_t* unaligned = reinterpret_cast<uint8_t*>(storage.data()) + 1;
+  memcpy(unaligned, kSimpleSchema + 8, sizeof(kSimpleSchema) - 8);
+
+  struct ArrowBufferView data_header;
+  data_header.data.as_uint8 = unaligned;
+  data_header.size_bytes = sizeof(kSimpleSchema) - 8;
+
+  ArrowIpcDecoderInit(&decoder);
+  ASSERT_EQ(ArrowIpcDecoderDecodeFlightDataHeader(&decoder, data_header, &error),
+            NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(decoder.message_type, NANOARROW_IPC_MESSAGE_TYPE_SCHEMA);
+  EXPECT_EQ(decoder.header_size_bytes, sizeof(kSimpleSchema) - 8);
+  EXPECT_EQ(decoder.body_size_bytes, 0);
+
+  ASSERT_EQ(ArrowIpcDecoderDecodeSchema(&decoder, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderSetSchema(&decoder, &schema, &error), NANOARROW_OK);
+  schema.release(&schema);
+
+  data_header.data.as_uint8 = kSimpleRecordBatch + 8;
+  data_header.size_bytes = 0x88;
+  ASSERT_EQ(ArrowIpcDecoderDecodeFlightDataHeader(&decoder, data_header, &error),
+            NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(decoder.message_type, NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH);
+  ASSERT_EQ(decoder.body_size_bytes, 16);
+
+  // The body is an independent buffer owned by the transport
+  int n_slice_frees = 0;
+  struct ArrowBuffer body;
+  ArrowBufferInit(&body);
+  body.data = kSimpleRecordBatch + 8 + 0x88;
+  body.size_bytes = decoder.body_size_bytes;
+  body.capacity_bytes = decoder.body_size_bytes;
+  body.allocator = ArrowBufferDeallocator(&FreeTransportSlice, &n_slice_frees);
+
+  struct ArrowIpcSharedBuffer shared;
+  ASSERT_EQ(ArrowIpcSharedBufferInit(&shared, &body), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderDecodeArrayFromShared(
+                &decoder, &shared, -1, &array, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  ArrowIpcSharedBufferReset(&shared);
+  EXPECT_EQ(n_slice_frees, 0);
+
+  ASSERT_EQ(array.length, 3);
+  ASSERT_EQ(array.n_children, 1);
+  EXPECT_EQ(array.children[0]->buffers[1], kSimpleRecordBatch + 8 + 0x88);
+  EXPECT_EQ(
+      memcmp(array.children[0]->buffers[1], one_two_three_le, sizeof(one_two_three_le)),
+      0);
+  array.release(&array);
+  EXPECT_EQ(n_slice_frees, 1);
+
+  // Invalid headers are rejected
+  data_header.size_bytes = 16;
+  EXPECT_EQ(ArrowIpcDecoderDecodeFlightDataHeader(&decoder, data_header, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Message flatbuffer verification failed");
+
+  ArrowIpcDecoderReset(&decoder);
+}
+
+TEST(NanoarrowIpcTest, NanoarrowIpcDecodeSharedBufferCopyThreshold) {
+  struct ArrowIpcDecoder decoder;
+  struct ArrowError error;
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+
+  uint8_t one_two_three_le[] = {0x01, 0x00, 0x00, 0x00, 0x02, 0x00,
+                                0x00, 0x00, 0x03, 0x00, 0x00, 0x00};
+
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  struct ArrowBufferView data;
+  data.data.as_uint8 = kSimpleRecordBatch;
+  data.size_bytes = sizeof(kSimpleRecordBatch);
+
+  ArrowIpcDecoderInit(&decoder);
+  ASSERT_EQ(ArrowIpcDecoderSetSchema(&decoder, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderDecodeHeader(&decoder, data, &error), NANOARROW_OK);
+  const uint8_t* body_data = kSimpleRecordBatch + decoder.header_size_bytes;
+
+  for (int64_t threshold : {0, 12, 13}) {
+    ArrowIpcDecoderSetSharedBufferCopyThreshold(&decoder, threshold);
+
+    int n_slice_frees = 0;
+    struct ArrowBuffer body;
+    ArrowBufferInit(&body);
+    body.data = const_cast<uint8_t*>(body_data);
+    body.size_bytes = decoder.body_size_bytes;
+    body.capacity_bytes = decoder.body_size_bytes;
+    body.allocator = ArrowBufferDeallocator(&FreeTransportSlice, &n_slice_frees);
+
+    struct ArrowIpcSharedBuffer shared;
+    ASSERT_EQ(ArrowIpcSharedBufferInit(&shared, &body), NANOARROW_OK);
+    ASSERT_EQ(ArrowIpcDecoderDecodeArrayFromShared(&decoder, &shared, -1, &array,
+                                                    NANOARROW_VALIDATION_LEVEL_FULL,
+                                                    &error),
+              NANOARROW_OK)
+        << error.message;
+    ArrowIpcSharedBufferReset(&shared);
+
+    // The 12 byte data buffer is only copied (releasing the body) if it is smaller
+    // than the threshold
+    ASSERT_EQ(array.n_children, 1);
+    EXPECT_EQ(n_slice_frees, threshold > 12 ? 1 : 0);
+    EXPECT_EQ(array.children[0]->buffers[1] == body_data, threshold <= 12);
+    EXPECT_EQ(
+        memcmp(array.children[0]->buffers[1], one_two_three_le, sizeof(one_two_three_le)),
+        0);
+    array.release(&array);
+    EXPECT_EQ(n_slice_frees, 1);
+  }
+
+  schema.release(&schema);
+  ArrowIpcDecoderReset(&decoder);
+}
+
+TEST(NanoarrowIpcTest, NanoarrowIpcDecodeDeviceBody) {
+  struct ArrowIpcDecoder decoder;
+  struct ArrowError error;
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  struct ArrowBufferView data;
+  data.data.as_uint8 = kSimpleRecordBatch;
+  data.size_bytes = sizeof(kSimpleRecordBatch);
+
+  ArrowIpcDecoderInit(&decoder);
+  ArrowIpcDecoderSetDeviceBody(&decoder, 1);
+  // The copy threshold is ignored because a device body can't be copied on the CPU
+  ArrowIpcDecoderSetSharedBufferCopyThreshold(&decoder, 13);
+  ASSERT_EQ(ArrowIpcDecoderSetSchema(&decoder, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderDecodeHeader(&decoder, data, &error), NANOARROW_OK);
+  const uint8_t* body_data = kSimpleRecordBatch + decoder.header_size_bytes;
+
+  // Arrays can't be copied out of a view of the body
+  struct ArrowBufferView body_view;
+  body_view.data.as_uint8 = body_data;
+  body_view.size_bytes = decoder.body_size_bytes;
+  EXPECT_EQ(ArrowIpcDecoderDecodeArray(&decoder, body_view, -1, &array,
+                                       NANOARROW_VALIDATION_LEVEL_NONE, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message,
+               "Arrays must be decoded from a message body in device memory using "
+               "ArrowIpcDecoderDecodeArrayFromShared()");
+
+  int n_slice_frees = 0;
+  struct ArrowBuffer body;
+  ArrowBufferInit(&body);
+  body.data = const_cast<uint8_t*>(body_data);
+  body.size_bytes = decoder.body_size_bytes;
+  body.capacity_bytes = decoder.body_size_bytes;
+  body.allocator = ArrowBufferDeallocator(&FreeTransportSlice, &n_slice_frees);
+
+  struct ArrowIpcSharedBuffer shared;
+  ASSERT_EQ(ArrowIpcSharedBufferInit(&shared, &body), NANOARROW_OK);
+
+  // ...or validated in a way that reads their content
+  EXPECT_EQ(ArrowIpcDecoderDecodeArrayFromShared(&decoder, &shared, -1, &array,
+                                                  NANOARROW_VALIDATION_LEVEL_DEFAULT,
+                                                  &error),
+            EINVAL);
+
+  ASSERT_EQ(ArrowIpcDecoderDecodeArrayFromShared(&decoder, &shared, -1, &array,
+                                                  NANOARROW_VALIDATION_LEVEL_MINIMAL,
+                                                  &error),
+            NANOARROW_OK)
+      << error.message;
+  ArrowIpcSharedBufferReset(&shared);
+
+  ASSERT_EQ(array.n_children, 1);
+  EXPECT_EQ(array.children[0]->length, 3);
+  EXPECT_EQ(array.children[0]->buffers[1], body_data);
+  EXPECT_EQ(n_slice_frees, 0);
+  array.release(&array);
+  EXPECT_EQ(n_slice_frees, 1);
+
+  schema.release(&schema);
+  ArrowIpcDecoderReset(&decoder);
+}
+
+#if defined(NANOARROW_IPC_WITH_DEVICE)
+// A device whose memory is allocated on the heap and counts the transfers made to it
+static ArrowErrorCode TestDeviceBufferInit(struct ArrowDevice* device_src,
+                                           struct ArrowBufferView src,
+                                           struct ArrowDevice* device_dst,
+                                           struct ArrowBuffer* dst) {
+  if (device_src->device_type != ARROW_DEVICE_CPU ||
+      device_dst->device_type != ARROW_DEVICE_CUDA) {
+    return ENOTSUP;
+  }
+
+  *reinterpret_cast<int*>(device_dst->private_data) += 1;
+  ArrowBufferInit(dst);
+  return ArrowBufferAppend(dst, src.data.data, src.size_bytes);
+}
+
+static void TestDeviceInit(struct ArrowDevice* device, int* n_copies) {
+  ArrowDeviceInitCpu(device);
+  device->device_type = ARROW_DEVICE_CUDA;
+  device->device_id = 7;
+  device->array_init = nullptr;
+  device->buffer_init = &TestDeviceBufferInit;
+  device->private_data = n_copies;
+}
+
+TEST(NanoarrowIpcTest, NanoarrowIpcDecodeDeviceArray) {
+  struct ArrowIpcDecoder decoder;
+  struct ArrowError error;
+  struct ArrowSchema schema;
+  struct ArrowDeviceArray device_array;
+
+  int n_copies = 0;
+  struct ArrowDevice device;
+  TestDeviceInit(&device, &n_copies);
+
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  struct ArrowBufferView data;
+  data.data.as_uint8 = kSimpleRecordBatch;
+  data.size_bytes = sizeof(kSimpleRecordBatch);
+
+  ArrowIpcDecoderInit(&decoder);
+  ASSERT_EQ(ArrowIpcDecoderSetSchema(&decoder, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderDecodeHeader(&decoder, data, &error), NANOARROW_OK);
+
+  struct ArrowBufferView body;
+  body.data.as_uint8 = kSimpleRecordBatch + decoder.header_size_bytes;
+  body.size_bytes = decoder.body_size_bytes;
+  int32_t values[3];
+  memcpy(values, body.data.as_uint8, sizeof(values));
+
+  // The body is transferred once and validated on the CPU beforehand
+  ASSERT_EQ(ArrowIpcDecoderDecodeDeviceArray(&decoder, body, -1, &device, &device_array,
+                                             NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(n_copies, 1);
+  EXPECT_EQ(device_array.device_type, ARROW_DEVICE_CUDA);
+  EXPECT_EQ(device_array.device_id, 7);
+  ASSERT_EQ(device_array.array.n_children, 1);
+  EXPECT_EQ(device_array.array.children[0]->length, 3);
+  EXPECT_NE(device_array.array.children[0]->buffers[1], body.data.data);
+  EXPECT_EQ(memcmp(device_array.array.children[0]->buffers[1], values, sizeof(values)),
+            0);
+  device_array.array.release(&device_array.array);
+
+  // A CPU device decodes without a transfer
+  ASSERT_EQ(ArrowIpcDecoderDecodeDeviceArray(&decoder, body, -1, ArrowDeviceCpu(),
+                                             &device_array,
+                                             NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(n_copies, 1);
+  EXPECT_EQ(device_array.device_type, ARROW_DEVICE_CPU);
+  device_array.array.release(&device_array.array);
+
+  // Bodies that must be endian swapped are decoded on the CPU before the transfer
+  ASSERT_EQ(ArrowIpcDecoderSetEndianness(
+                &decoder, ArrowIpcSystemEndianness() == NANOARROW_IPC_ENDIANNESS_LITTLE
+                              ? NANOARROW_IPC_ENDIANNESS_BIG
+                              : NANOARROW_IPC_ENDIANNESS_LITTLE),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderDecodeDeviceArray(&decoder, body, -1, &device, &device_array,
+                                             NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(n_copies, 2);
+  EXPECT_EQ(device_array.device_type, ARROW_DEVICE_CUDA);
+  ASSERT_EQ(device_array.array.n_children, 1);
+  const int32_t* swapped =
+      reinterpret_cast<const int32_t*>(device_array.array.children[0]->buffers[1]);
+  for (int j = 0; j < 3; j++) {
+    EXPECT_EQ(static_cast<uint32_t>(swapped[j]),
+              bswap32(static_cast<uint32_t>(values[j])));
+  }
+  device_array.array.release(&device_array.array);
+
+  schema.release(&schema);
+  ArrowIpcDecoderReset(&decoder);
+}
+#else
+TEST(NanoarrowIpcTest, NanoarrowIpcDecodeDeviceArray) {
+  struct ArrowIpcDecoder decoder;
+  struct ArrowError error;
+  struct ArrowBufferView body;
+  body.data.data = nullptr;
+  body.size_bytes = 0;
+
+  ArrowIpcDecoderInit(&decoder);
+  EXPECT_EQ(ArrowIpcDecoderDecodeDeviceArray(&decoder, body, -1, nullptr, nullptr,
+                                             NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            ENOTSUP);
+  EXPECT_STREQ(error.message,
+               "nanoarrow_ipc was not built with NANOARROW_IPC_WITH_DEVICE");
+  ArrowIpcDecoderReset(&decoder);
+}
+#endif
+
+TEST(NanoarrowIpcTest, NanoarrowIpcDecodeSharedBufferReferences) {
+  struct ArrowIpcDecoder decoder;
+  struct ArrowError error;
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  struct ArrowBufferView data;
+  data.data.as_uint8 = kSimpleRecordBatch;
+  data.size_bytes = sizeof(kSimpleRecordBatch);
+
+  ArrowIpcDecoderInit(&decoder);
+  ASSERT_EQ(ArrowIpcDecoderSetSchema(&decoder, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderDecodeHeader(&decoder, data, &error), NANOARROW_OK);
+  int64_t body_size_bytes = decoder.body_size_bytes;
+
+  // References to the body that are acquired for a batch but not used by any of its
+  // buffers (or that were acquired for a batch that failed to decode) are released
+  for (int64_t declared_body_size_bytes : {body_size_bytes, int64_t(0)}) {
+    decoder.body_size_bytes = declared_body_size_bytes;
+
+    int n_slice_frees = 0;
+    struct ArrowBuffer body;
+    ArrowBufferInit(&body);
+    body.data = kSimpleRecordBatch + decoder.header_size_bytes;
+    body.size_bytes = body_size_bytes;
+    body.capacity_bytes = body_size_bytes;
+    body.allocator = ArrowBufferDeallocator(&FreeTransportSlice, &n_slice_frees);
+
+    struct ArrowIpcSharedBuffer shared;
+    ASSERT_EQ(ArrowIpcSharedBufferInit(&shared, &body), NANOARROW_OK);
+    int result = ArrowIpcDecoderDecodeArrayFromShared(
+        &decoder, &shared, -1, &array, NANOARROW_VALIDATION_LEVEL_FULL, &error);
+    ArrowIpcSharedBufferReset(&shared);
+
+    if (declared_body_size_bytes == 0) {
+      ASSERT_EQ(result, EINVAL);
+    } else {
+      ASSERT_EQ(result, NANOARROW_OK) << error.message;
+      EXPECT_EQ(n_slice_frees, 0);
+      array.release(&array);
+    }
+
+    EXPECT_EQ(n_slice_frees, 1);
+  }
+
+  schema.release(&schema);
+  ArrowIpcDecoderReset(&decoder);
+}
+
 TEST(NanoarrowIpcTest, NanoarrowIpcSharedBufferThreadSafeDecode) {
   if (!ArrowIpcSharedBufferIsThreadSafe()) {
     GTEST_SKIP() << "ArrowIpcSharedBufferIsThreadSafe() returned false";
@@ -615,6 +1111,118 @@ TEST(NanoarrowIpcTest, NanoarrowIpcSharedBufferThreadSafeDecode) {
   // We will get a (occasional) memory leak if the atomic counter does not work
 }
 
+// Runs each task on its own thread
+static void ThreadPerTaskParallelFor(struct ArrowExecutor* executor,
+                                     void (*task)(void* task_private, int64_t i),
+                                     void* task_private, int64_t n_tasks) {
+  auto n_calls = reinterpret_cast<int64_t*>(executor->private_data);
+  *n_calls += 1;
+
+  std::vector<std::thread> threads;
+  for (int64_t i = 0; i < n_tasks; i++) {
+    threads.emplace_back([task, task_private, i] { task(task_private, i); });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+class CompressionParameterizedTestFixture
+    : public ::testing::TestWithParam<enum ArrowIpcCompressionType> {};
+
+TEST_P(CompressionParameterizedTestFixture, NanoarrowIpcDecodeCompressedRecordBatch) {
+  enum ArrowIpcCompressionType codec = GetParam();
+  arrow::Compression::type arrow_codec = codec == NANOARROW_IPC_COMPRESSION_TYPE_ZSTD
+                                             ? arrow::Compression::ZSTD
+                                             : arrow::Compression::LZ4_FRAME;
+  if (!ArrowIpcDecompressionIsSupported(codec)) {
+    GTEST_SKIP() << "nanoarrow_ipc was built without support for codec " << codec;
+  }
+  if (!arrow::util::Codec::IsAvailable(arrow_codec)) {
+    GTEST_SKIP() << "Arrow C++ was built without support for codec " << codec;
+  }
+
+  // Include a column that compresses well and one that Arrow C++ will likely leave
+  // uncompressed
+  std::shared_ptr<arrow::Array> ints;
+  std::shared_ptr<arrow::Array> strings;
+  arrow::Int32Builder int_builder;
+  arrow::StringBuilder string_builder;
+  for (int32_t i = 0; i < 10000; i++) {
+    ASSERT_TRUE(int_builder.Append(i % 10).ok());
+    ASSERT_TRUE(string_builder.Append(std::to_string(i * 7919)).ok());
+  }
+  ASSERT_TRUE(int_builder.AppendNull().ok());
+  ASSERT_TRUE(string_builder.AppendNull().ok());
+  ASSERT_TRUE(int_builder.Finish(&ints).ok());
+  ASSERT_TRUE(string_builder.Finish(&strings).ok());
+
+  auto arrow_schema = arrow::schema(
+      {arrow::field("ints", arrow::int32()), arrow::field("strings", arrow::utf8())});
+  auto batch = arrow::RecordBatch::Make(arrow_schema, ints->length(), {ints, strings});
+
+  auto options = arrow::ipc::IpcWriteOptions::Defaults();
+  auto maybe_codec = arrow::util::Codec::Create(arrow_codec);
+  ASSERT_TRUE(maybe_codec.ok());
+  options.codec = std::move(maybe_codec).ValueUnsafe();
+  auto maybe_serialized = arrow::ipc::SerializeRecordBatch(*batch, options);
+  ASSERT_TRUE(maybe_serialized.ok());
+
+  struct ArrowSchema schema;
+  struct ArrowIpcDecoder decoder;
+  struct ArrowBufferView buffer_view;
+  struct ArrowArray array;
+  struct ArrowError error;
+
+  ASSERT_TRUE(arrow::ExportSchema(*arrow_schema, &schema).ok());
+  ArrowIpcDecoderInit(&decoder);
+  ASSERT_EQ(ArrowIpcDecoderSetSchema(&decoder, &schema, nullptr), NANOARROW_OK);
+
+  buffer_view.data.data = maybe_serialized.ValueUnsafe()->data();
+  buffer_view.size_bytes = maybe_serialized.ValueUnsafe()->size();
+  ASSERT_EQ(ArrowIpcDecoderDecodeHeader(&decoder, buffer_view, nullptr), NANOARROW_OK);
+  EXPECT_EQ(decoder.codec, codec);
+  buffer_view.data.as_uint8 += decoder.header_size_bytes;
+  buffer_view.size_bytes -= decoder.header_size_bytes;
+
+  // Decode serially, then using an executor and a buffer pool
+  for (int use_executor = 0; use_executor < 2; use_executor++) {
+    int64_t n_calls = 0;
+    struct ArrowExecutor executor;
+    executor.parallel_for = &ThreadPerTaskParallelFor;
+    executor.private_data = &n_calls;
+
+    struct ArrowBufferAllocator pool;
+    ASSERT_EQ(ArrowBufferAllocatorPoolInit(&pool, 1024 * 1024), NANOARROW_OK);
+    if (use_executor) {
+      ArrowIpcDecoderSetExecutor(&decoder, &executor);
+      ArrowIpcDecoderSetAllocator(&decoder, pool);
+    }
+
+    ASSERT_EQ(ArrowIpcDecoderDecodeArray(&decoder, buffer_view, -1, &array,
+                                         NANOARROW_VALIDATION_LEVEL_FULL, &error),
+              NANOARROW_OK)
+        << error.message;
+    EXPECT_EQ(n_calls, use_executor);
+
+    auto maybe_batch = arrow::ImportRecordBatch(&array, arrow_schema);
+    ASSERT_TRUE(maybe_batch.ok());
+    EXPECT_TRUE(maybe_batch.ValueUnsafe()->Equals(*batch));
+
+    ArrowIpcDecoderSetExecutor(&decoder, nullptr);
+    ArrowIpcDecoderSetAllocator(&decoder, ArrowBufferAllocatorDefault());
+    ArrowBufferAllocatorPoolRelease(&pool);
+  }
+
+  schema.release(&schema);
+  ArrowIpcDecoderReset(&decoder);
+}
+
+INSTANTIATE_TEST_SUITE_P(NanoarrowIpcTest, CompressionParameterizedTestFixture,
+                         ::testing::Values(NANOARROW_IPC_COMPRESSION_TYPE_LZ4_FRAME,
+                                           NANOARROW_IPC_COMPRESSION_TYPE_ZSTD));
+
 TEST_P(ArrowTypeParameterizedTestFixture, NanoarrowIpcArrowArrayRoundtrip) {
   const std::shared_ptr<arrow::DataType>& data_type = GetParam();
   std::shared_ptr<arrow::Schema> dummy_schema =
@@ -939,3 +1547,509 @@ INSTANTIATE_TEST_SUITE_P(NanoarrowIpcTest, ArrowTypeIdParameterizedTestFixture,
                                            NANOARROW_TYPE_DECIMAL128,
                                            NANOARROW_TYPE_DECIMAL256,
                                            NANOARROW_TYPE_INTERVAL_MONTH_DAY_NANO));
+
+static struct ArrowBufferView ViewOf(struct ArrowBuffer* buffer) {
+  struct ArrowBufferView view;
+  view.data.as_uint8 = buffer->data;
+  view.size_bytes = buffer->size_bytes;
+  return view;
+}
+
+// Builds a struct<some_int: int32, some_string: string, some_list: list<int64>>
+// with a null in each column
+static void MakeSimpleBatch(struct ArrowSchema* schema, struct ArrowArray* array) {
+  ASSERT_EQ(ArrowSchemaInitFromType(schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(schema, 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0], "some_int"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[1], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[1], "some_string"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[2], NANOARROW_TYPE_LIST),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[2], "some_list"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[2]->children[0], NANOARROW_TYPE_INT64),
+            NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(array, schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array), NANOARROW_OK);
+  for (int64_t i = 0; i < 5; i++) {
+    if (i == 1) {
+      ASSERT_EQ(ArrowArrayAppendNull(array->children[0], 1), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayAppendNull(array->children[1], 1), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayAppendNull(array->children[2], 1), NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowArrayAppendInt(array->children[0], i), NANOARROW_OK);
+      std::string value(i, 'a');
+      ASSERT_EQ(ArrowArrayAppendString(array->children[1], ArrowCharView(value.c_str())),
+                NANOARROW_OK);
+      for (int64_t j = 0; j < i; j++) {
+        ASSERT_EQ(ArrowArrayAppendInt(array->children[2]->children[0], j), NANOARROW_OK);
+      }
+      ASSERT_EQ(ArrowArrayFinishElement(array->children[2]), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishElement(array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array, nullptr), NANOARROW_OK);
+}
+
+static void ExpectSimpleBatch(struct ArrowArray* array) {
+  ASSERT_EQ(array->length, 5);
+  ASSERT_EQ(array->n_children, 3);
+  EXPECT_EQ(array->children[0]->null_count, 1);
+  EXPECT_EQ(array->children[1]->null_count, 1);
+  EXPECT_EQ(array->children[2]->null_count, 1);
+
+  const int32_t* ints = reinterpret_cast<const int32_t*>(array->children[0]->buffers[1]);
+  EXPECT_EQ(ints[0], 0);
+  EXPECT_EQ(ints[4], 4);
+
+  const int32_t* offsets =
+      reinterpret_cast<const int32_t*>(array->children[1]->buffers[1]);
+  const char* data = reinterpret_cast<const char*>(array->children[1]->buffers[2]);
+  EXPECT_EQ(std::string(data + offsets[4], offsets[5] - offsets[4]), "aaaa");
+
+  const int64_t* list_values =
+      reinterpret_cast<const int64_t*>(array->children[2]->children[0]->buffers[1]);
+  EXPECT_EQ(array->children[2]->children[0]->length, 9);
+  EXPECT_EQ(list_values[8], 3);
+}
+
+// Builds a struct<col: dictionary<values=string, indices=int32>> whose dictionary
+
+// Builds a struct<col: dictionary<values=string, indices=int32>> whose dictionary
+// contains dictionary_values
+static void MakeDictionaryBatch(struct ArrowSchema* schema, struct ArrowArray* array,
+                                const std::vector<std::string>& dictionary_values,
+                                const std::vector<int32_t>& indices) {
+  ASSERT_EQ(ArrowSchemaInitFromType(schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0], "col"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(schema->children[0]), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[0]->dictionary,
+                                    NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(array, schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array), NANOARROW_OK);
+  for (int32_t index : indices) {
+    ASSERT_EQ(ArrowArrayAppendInt(array->children[0], index), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(array), NANOARROW_OK);
+  }
+  for (const std::string& value : dictionary_values) {
+    ASSERT_EQ(ArrowArrayAppendString(array->children[0]->dictionary,
+                                     ArrowCharView(value.c_str())),
+              NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array, nullptr), NANOARROW_OK);
+}
+
+static std::string DictionaryValue(struct ArrowArray* dictionary, int64_t i) {
+  const int32_t* offsets = reinterpret_cast<const int32_t*>(dictionary->buffers[1]);
+  const char* data = reinterpret_cast<const char*>(dictionary->buffers[2]);
+  return std::string(data + offsets[i], offsets[i + 1] - offsets[i]);
+}
+
+TEST(NanoarrowIpcTest, NanoarrowIpcDecodeArrayIntoReusesBuffers) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+  ASSERT_NO_FATAL_FAILURE(MakeSimpleBatch(&schema, &array));
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+
+  struct ArrowIpcEncoder encoder;
+  struct ArrowIpcDecoder decoder;
+  struct ArrowBuffer header;
+  struct ArrowBuffer body;
+  ASSERT_EQ(ArrowIpcEncoderInit(&encoder), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderInit(&decoder), NANOARROW_OK);
+  ArrowBufferInit(&header);
+  ArrowBufferInit(&body);
+  ASSERT_EQ(ArrowIpcDecoderSetSchema(&decoder, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcEncoderEncodeRecordBatch(&encoder, &array_view, &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcEncoderFinalizeBuffer(&encoder, &header), NANOARROW_OK);
+  for (int64_t i = 0; i < encoder.n_body_buffers; i++) {
+    ASSERT_EQ(ArrowBufferAppend(&body, encoder.body_buffers[i].data.data,
+                                encoder.body_buffers[i].size_bytes),
+              NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowIpcDecoderDecodeHeader(&decoder, ViewOf(&header), &error),
+            NANOARROW_OK)
+      << error.message;
+
+  // A released out is allocated
+  struct ArrowArray out;
+  out.release = nullptr;
+  ASSERT_EQ(ArrowIpcDecoderDecodeArrayInto(&decoder, ViewOf(&body), -1, &out,
+                                           NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_NO_FATAL_FAILURE(ExpectSimpleBatch(&out));
+  const void* ints = out.children[0]->buffers[1];
+  const void* data = out.children[1]->buffers[2];
+  const void* list_values = out.children[2]->children[0]->buffers[1];
+
+  // Decoding into the same out recycles its buffers
+  ASSERT_EQ(ArrowIpcDecoderDecodeArrayInto(&decoder, ViewOf(&body), -1, &out,
+                                           NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_NO_FATAL_FAILURE(ExpectSimpleBatch(&out));
+  EXPECT_EQ(out.children[0]->buffers[1], ints);
+  EXPECT_EQ(out.children[1]->buffers[2], data);
+  EXPECT_EQ(out.children[2]->children[0]->buffers[1], list_values);
+
+  // An out with a different structure is released and allocated again
+  ASSERT_EQ(ArrowIpcDecoderDecodeArrayInto(&decoder, ViewOf(&body), 0, &out,
+                                           NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(out.length, 5);
+  EXPECT_EQ(out.n_children, 0);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(out.buffers[1])[4], 4);
+  out.release(&out);
+
+  // Buffers copied from the body are allocated using the decoder's allocator such
+  // that decoding into a recycled out doesn't allocate
+  struct ArrowBufferAllocator pool;
+  struct ArrowBufferPoolStats stats;
+  struct ArrowBufferPoolStats recycled_stats;
+  ASSERT_EQ(ArrowBufferAllocatorPoolInit(&pool, 1 << 20), NANOARROW_OK);
+  ArrowIpcDecoderSetAllocator(&decoder, pool);
+  out.release = nullptr;
+  ASSERT_EQ(ArrowIpcDecoderDecodeArrayInto(&decoder, ViewOf(&body), -1, &out,
+                                           NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  ArrowBufferAllocatorPoolStats(&pool, &stats);
+  EXPECT_GT(stats.n_misses, 0);
+  ASSERT_EQ(ArrowIpcDecoderDecodeArrayInto(&decoder, ViewOf(&body), -1, &out,
+                                           NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_NO_FATAL_FAILURE(ExpectSimpleBatch(&out));
+  ArrowBufferAllocatorPoolStats(&pool, &recycled_stats);
+  EXPECT_EQ(recycled_stats.n_hits, stats.n_hits);
+  EXPECT_EQ(recycled_stats.n_misses, stats.n_misses);
+  out.release(&out);
+
+  ArrowBufferAllocatorPoolRelease(&pool);
+  ArrowBufferReset(&header);
+  ArrowBufferReset(&body);
+  ArrowIpcDecoderReset(&decoder);
+  ArrowIpcEncoderReset(&encoder);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
+}
+
+// Builds a batch whose columns need each kind of endian swapping. If big_endian is
+// non-zero, the bytes of each unit are reversed as a big-endian producer would
+// have written them.
+static void MakeSwapEndianBatch(struct ArrowSchema* schema, struct ArrowArray* array,
+                                int big_endian) {
+  const int64_t length = 37;
+  const enum ArrowType types[] = {NANOARROW_TYPE_INT16,      NANOARROW_TYPE_INT32,
+                                  NANOARROW_TYPE_INT64,      NANOARROW_TYPE_DECIMAL128,
+                                  NANOARROW_TYPE_DECIMAL256,
+                                  NANOARROW_TYPE_INTERVAL_MONTH_DAY_NANO,
+                                  NANOARROW_TYPE_STRING};
+  const std::vector<std::vector<int>> units = {{2},  {4},       {8}, {16},
+                                               {32}, {4, 4, 8}, {4}};
+  const int64_t n_columns = sizeof(types) / sizeof(types[0]);
+
+  ArrowSchemaInit(schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema, n_columns), NANOARROW_OK);
+  for (int64_t i = 0; i < n_columns; i++) {
+    if (types[i] == NANOARROW_TYPE_DECIMAL128 || types[i] == NANOARROW_TYPE_DECIMAL256) {
+      ASSERT_EQ(ArrowSchemaSetTypeDecimal(schema->children[i], types[i], 38, 0),
+                NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowSchemaSetType(schema->children[i], types[i]), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowSchemaSetName(schema->children[i], std::to_string(i).c_str()),
+              NANOARROW_OK);
+  }
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(array, schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array), NANOARROW_OK);
+  uint8_t value = 0;
+  for (int64_t i = 0; i < n_columns; i++) {
+    struct ArrowArray* child = array->children[i];
+    if (types[i] == NANOARROW_TYPE_STRING) {
+      for (int64_t j = 0; j < length; j++) {
+        ASSERT_EQ(ArrowArrayAppendString(child, ArrowCharView(std::to_string(j).c_str())),
+                  NANOARROW_OK);
+      }
+    } else {
+      int64_t element_size_bytes = 0;
+      for (int unit : units[i]) {
+        element_size_bytes += unit;
+      }
+      for (int64_t j = 0; j < (length * element_size_bytes); j++) {
+        ASSERT_EQ(ArrowBufferAppendUInt8(ArrowArrayBuffer(child, 1), value++),
+                  NANOARROW_OK);
+      }
+      child->length = length;
+    }
+
+    struct ArrowBuffer* buffer = ArrowArrayBuffer(child, 1);
+    for (int64_t offset = 0; big_endian && offset < buffer->size_bytes;) {
+      for (int unit : units[i]) {
+        std::reverse(buffer->data + offset, buffer->data + offset + unit);
+        offset += unit;
+      }
+    }
+  }
+
+  // Reversed offsets are not valid until they are swapped again by the decoder
+  array->length = length;
+  ASSERT_EQ(ArrowArrayFinishBuilding(array, NANOARROW_VALIDATION_LEVEL_NONE, nullptr),
+            NANOARROW_OK);
+}
+
+TEST(NanoarrowIpcTest, NanoarrowIpcDecodeSwapEndianBatch) {
+  struct ArrowSchema schema;
+  struct ArrowArray expected;
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+  ASSERT_NO_FATAL_FAILURE(MakeSwapEndianBatch(&schema, &expected, 0));
+  schema.release(&schema);
+  ASSERT_NO_FATAL_FAILURE(MakeSwapEndianBatch(&schema, &array, 1));
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &expected, &error), NANOARROW_OK);
+
+  // Buffer sizes are computed from the (valid) little-endian offsets
+  for (int64_t i = 0; i < array.n_children; i++) {
+    array_view.children[i]->buffer_views[1].data.data = array.children[i]->buffers[1];
+  }
+
+  struct ArrowIpcEncoder encoder;
+  struct ArrowBuffer header;
+  struct ArrowBuffer body;
+  ASSERT_EQ(ArrowIpcEncoderInit(&encoder), NANOARROW_OK);
+  ArrowBufferInit(&header);
+  ArrowBufferInit(&body);
+  ASSERT_EQ(ArrowIpcEncoderEncodeRecordBatch(&encoder, &array_view, &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcEncoderFinalizeBuffer(&encoder, &header), NANOARROW_OK);
+  for (int64_t i = 0; i < encoder.n_body_buffers; i++) {
+    ASSERT_EQ(ArrowBufferAppend(&body, encoder.body_buffers[i].data.data,
+                                encoder.body_buffers[i].size_bytes),
+              NANOARROW_OK);
+  }
+
+  // Decode the little-endian body as if it had been produced on a big-endian system
+  struct ArrowIpcDecoder decoder;
+  ASSERT_EQ(ArrowIpcDecoderInit(&decoder), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderSetSchema(&decoder, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderSetEndianness(&decoder, NANOARROW_IPC_ENDIANNESS_BIG),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderDecodeHeader(&decoder, ViewOf(&header), &error),
+            NANOARROW_OK)
+      << error.message;
+
+  int64_t n_calls = 0;
+  struct ArrowExecutor executor;
+  executor.parallel_for = &ThreadPerTaskParallelFor;
+  executor.private_data = &n_calls;
+
+  for (int mode = 0; mode < 3; mode++) {
+    SCOPED_TRACE(mode);
+    if (mode == 2) {
+      ArrowIpcDecoderSetExecutor(&decoder, &executor);
+    }
+
+    struct ArrowArray out;
+    if (mode == 1) {
+      struct ArrowBuffer body_copy;
+      ArrowBufferInit(&body_copy);
+      ASSERT_EQ(ArrowBufferAppend(&body_copy, body.data, body.size_bytes), NANOARROW_OK);
+      struct ArrowIpcSharedBuffer shared;
+      ASSERT_EQ(ArrowIpcSharedBufferInit(&shared, &body_copy), NANOARROW_OK);
+      ASSERT_EQ(ArrowIpcDecoderDecodeArrayFromShared(&decoder, &shared, -1, &out,
+                                                     NANOARROW_VALIDATION_LEVEL_FULL,
+                                                     &error),
+                NANOARROW_OK)
+          << error.message;
+      ArrowIpcSharedBufferReset(&shared);
+    } else {
+      ASSERT_EQ(ArrowIpcDecoderDecodeArray(&decoder, ViewOf(&body), -1, &out,
+                                           NANOARROW_VALIDATION_LEVEL_FULL, &error),
+                NANOARROW_OK)
+          << error.message;
+    }
+
+    ASSERT_EQ(out.n_children, expected.n_children);
+    for (int64_t i = 0; i < expected.n_children; i++) {
+      SCOPED_TRACE(i);
+      struct ArrowArray* child = expected.children[i];
+      for (int64_t j = 1; j < child->n_buffers; j++) {
+        struct ArrowBuffer* buffer = ArrowArrayBuffer(child, j);
+        EXPECT_EQ(memcmp(out.children[i]->buffers[j], buffer->data, buffer->size_bytes),
+                  0);
+      }
+    }
+
+    out.release(&out);
+  }
+
+  // All buffers of the batch are swapped by a single parallel_for() call
+  EXPECT_EQ(n_calls, 1);
+
+  ArrowBufferReset(&header);
+  ArrowBufferReset(&body);
+  ArrowIpcDecoderReset(&decoder);
+  ArrowIpcEncoderReset(&encoder);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  expected.release(&expected);
+  schema.release(&schema);
+}
+
+TEST(NanoarrowIpcTest, NanoarrowIpcDecodeDictionaryDelta) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowArray delta;
+  struct ArrowArrayView array_view;
+  struct ArrowArrayView delta_view;
+  struct ArrowError error;
+  ASSERT_NO_FATAL_FAILURE(MakeDictionaryBatch(&schema, &array, {"a", "b"}, {1, 0}));
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  schema.release(&schema);
+  ASSERT_NO_FATAL_FAILURE(MakeDictionaryBatch(&schema, &delta, {"c"}, {2}));
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&delta_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&delta_view, &delta, &error), NANOARROW_OK);
+
+  struct ArrowIpcEncoder encoder;
+  struct ArrowIpcDecoder decoder;
+  struct ArrowBuffer header;
+  struct ArrowBuffer body;
+  ASSERT_EQ(ArrowIpcEncoderInit(&encoder), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderInit(&decoder), NANOARROW_OK);
+  ArrowBufferInit(&header);
+  ArrowBufferInit(&body);
+
+  // Decodes the header of the last encoded message and copies its body
+  auto decode_header = [&]() {
+    header.size_bytes = 0;
+    body.size_bytes = 0;
+    ASSERT_EQ(ArrowIpcEncoderFinalizeBuffer(&encoder, &header), NANOARROW_OK);
+    for (int64_t i = 0; i < encoder.n_body_buffers; i++) {
+      ASSERT_EQ(ArrowBufferAppend(&body, encoder.body_buffers[i].data.data,
+                                  encoder.body_buffers[i].size_bytes),
+                NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowIpcDecoderDecodeHeader(&decoder, ViewOf(&header), &error),
+              NANOARROW_OK)
+        << error.message;
+  };
+
+  ASSERT_EQ(ArrowIpcEncoderEncodeSchema(&encoder, &schema, &error), NANOARROW_OK);
+  ASSERT_NO_FATAL_FAILURE(decode_header());
+  struct ArrowSchema decoded_schema;
+  ASSERT_EQ(ArrowIpcDecoderDecodeSchema(&decoder, &decoded_schema, &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderSetSchema(&decoder, &decoded_schema, &error), NANOARROW_OK)
+      << error.message;
+  decoded_schema.release(&decoded_schema);
+
+  // A record batch can't be decoded before its dictionary
+  struct ArrowArray out;
+  ASSERT_EQ(ArrowIpcEncoderEncodeRecordBatch(&encoder, &array_view, &error),
+            NANOARROW_OK);
+  ASSERT_NO_FATAL_FAILURE(decode_header());
+  EXPECT_EQ(ArrowIpcDecoderDecodeArray(&decoder, ViewOf(&body), -1, &out,
+                                       NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Dictionary with id 0 has not been decoded");
+  EXPECT_EQ(ArrowIpcDecoderDecodeDictionary(&decoder, ViewOf(&body),
+                                            NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            EINVAL);
+
+  // Unknown dictionary ids are an error
+  ASSERT_EQ(ArrowIpcEncoderEncodeDictionaryBatch(&encoder, 1, 0,
+                                                 array_view.children[0]->dictionary,
+                                                 &error),
+            NANOARROW_OK);
+  header.size_bytes = 0;
+  ASSERT_EQ(ArrowIpcEncoderFinalizeBuffer(&encoder, &header), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcDecoderDecodeHeader(&decoder, ViewOf(&header), &error), EINVAL);
+  EXPECT_STREQ(error.message, "DictionaryBatch message has unknown dictionary id 1");
+
+  struct ArrowArray first;
+  ASSERT_EQ(ArrowIpcEncoderEncodeDictionaryBatch(&encoder, 0, 0,
+                                                 array_view.children[0]->dictionary,
+                                                 &error),
+            NANOARROW_OK);
+  ASSERT_NO_FATAL_FAILURE(decode_header());
+  EXPECT_EQ(decoder.message_type, NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH);
+  EXPECT_EQ(decoder.dictionary_id, 0);
+  EXPECT_FALSE(decoder.dictionary_is_delta);
+  ASSERT_EQ(ArrowIpcDecoderDecodeDictionary(&decoder, ViewOf(&body),
+                                            NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(ArrowIpcEncoderEncodeRecordBatch(&encoder, &array_view, &error),
+            NANOARROW_OK);
+  ASSERT_NO_FATAL_FAILURE(decode_header());
+  ASSERT_EQ(ArrowIpcDecoderDecodeArray(&decoder, ViewOf(&body), -1, &first,
+                                       NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  // A delta appends to the existing dictionary without modifying earlier batches
+  struct ArrowArray second;
+  ASSERT_EQ(ArrowIpcEncoderEncodeDictionaryBatch(&encoder, 0, 1,
+                                                 delta_view.children[0]->dictionary,
+                                                 &error),
+            NANOARROW_OK);
+  ASSERT_NO_FATAL_FAILURE(decode_header());
+  EXPECT_TRUE(decoder.dictionary_is_delta);
+  ASSERT_EQ(ArrowIpcDecoderDecodeDictionary(&decoder, ViewOf(&body),
+                                            NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(ArrowIpcEncoderEncodeRecordBatch(&encoder, &delta_view, &error),
+            NANOARROW_OK);
+  ASSERT_NO_FATAL_FAILURE(decode_header());
+  ASSERT_EQ(ArrowIpcDecoderDecodeArray(&decoder, ViewOf(&body), -1, &second,
+                                       NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  ASSERT_EQ(first.children[0]->dictionary->length, 2);
+  EXPECT_EQ(DictionaryValue(first.children[0]->dictionary, 1), "b");
+  ASSERT_EQ(second.children[0]->dictionary->length, 3);
+  EXPECT_EQ(DictionaryValue(second.children[0]->dictionary, 0), "a");
+  EXPECT_EQ(DictionaryValue(second.children[0]->dictionary, 2), "c");
+
+  // A recycled array references the current dictionary values
+  ASSERT_EQ(ArrowIpcDecoderDecodeArrayInto(&decoder, ViewOf(&body), -1, &first,
+                                           NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(first.length, 1);
+  ASSERT_EQ(first.children[0]->dictionary->length, 3);
+  EXPECT_EQ(DictionaryValue(first.children[0]->dictionary, 2), "c");
+
+  first.release(&first);
+  second.release(&second);
+  ArrowBufferReset(&header);
+  ArrowBufferReset(&body);
+  ArrowIpcDecoderReset(&decoder);
+  ArrowIpcEncoderReset(&encoder);
+  ArrowArrayViewReset(&array_view);
+  ArrowArrayViewReset(&delta_view);
+  array.release(&array);
+  delta.release(&delta);
+  schema.release(&schema);
+}
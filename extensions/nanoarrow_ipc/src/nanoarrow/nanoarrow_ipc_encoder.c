@@ -0,0 +1,1104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nanoarrow.h"
+#include "nanoarrow_ipc.h"
+#include "nanoarrow_ipc_flatcc_generated.h"
+
+#if defined(NANOARROW_IPC_WITH_ZSTD)
+#include <zstd.h>
+#endif
+
+#if defined(NANOARROW_IPC_WITH_LZ4)
+#include <lz4frame.h>
+#endif
+
+#define ns(x) FLATBUFFERS_WRAP_NAMESPACE(org_apache_arrow_flatbuf, x)
+
+// The flatcc builder only fails when it cannot allocate memory. Functions that add to a
+// table or end a vector return 0 on success; functions that end a table or push to a
+// vector return a reference or pointer that is NULL on failure.
+#define FLATCC_RETURN_UNLESS_0(x, error)                                       \
+  do {                                                                         \
+    if (ns(x) != 0) {                                                          \
+      ArrowErrorSet(error, "%s:%d: %s failed", __FILE__, __LINE__, #x);        \
+      return ENOMEM;                                                           \
+    }                                                                          \
+  } while (0)
+
+#define FLATCC_RETURN_IF_NULL(x, error)                                        \
+  do {                                                                         \
+    if (!(ns(x))) {                                                            \
+      ArrowErrorSet(error, "%s:%d: %s failed", __FILE__, __LINE__, #x);        \
+      return ENOMEM;                                                           \
+    }                                                                          \
+  } while (0)
+
+// Bytes referred to by ArrowIpcEncoder::body_buffers to pad each body buffer to a
+// multiple of 8 bytes
+static const uint8_t kArrowIpcEncoderPadding[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+
+// Internal data specific to the encode process
+struct ArrowIpcEncoderPrivate {
+  // The builder containing the last encoded flatbuffers message
+  flatcc_builder_t builder;
+  // The ArrowBufferView elements of ArrowIpcEncoder::body_buffers
+  struct ArrowBuffer body_buffers;
+  // Pairs of int64_t length/null_count values for each FieldNode of the last encoded
+  // RecordBatch. These are collected before any flatbuffer is built because flatcc
+  // can't interleave the construction of the nodes and buffers vectors.
+  struct ArrowBuffer nodes;
+  // Pairs of int64_t offset/length values for each Buffer of the last encoded
+  // RecordBatch
+  struct ArrowBuffer buffers;
+  // The (uncompressed) ArrowBufferView of each Buffer of the last encoded RecordBatch
+  struct ArrowBuffer sources;
+  // The struct ArrowIpcCompressTask for each non-empty Buffer of the last encoded
+  // RecordBatch if its body is compressed
+  struct ArrowBuffer compress_tasks;
+  // An array of n_compressed ArrowBuffers that hold the compressed Buffers of the last
+  // encoded RecordBatch (reused from message to message)
+  struct ArrowBuffer* compressed;
+  int64_t n_compressed;
+  // The compression and executor used for the bodies of future messages
+  enum ArrowIpcCompressionType codec;
+  struct ArrowExecutor* executor;
+  // Nonzero if the last encoded flatbuffer is a file Footer rather than a Message
+  int is_footer;
+};
+
+ArrowErrorCode ArrowIpcEncoderInit(struct ArrowIpcEncoder* encoder) {
+  memset(encoder, 0, sizeof(struct ArrowIpcEncoder));
+  struct ArrowIpcEncoderPrivate* private_data =
+      (struct ArrowIpcEncoderPrivate*)ArrowMalloc(sizeof(struct ArrowIpcEncoderPrivate));
+  if (private_data == NULL) {
+    return ENOMEM;
+  }
+
+  if (flatcc_builder_init(&private_data->builder) != 0) {
+    ArrowFree(private_data);
+    return ENOMEM;
+  }
+
+  ArrowBufferInit(&private_data->body_buffers);
+  ArrowBufferInit(&private_data->nodes);
+  ArrowBufferInit(&private_data->buffers);
+  ArrowBufferInit(&private_data->sources);
+  ArrowBufferInit(&private_data->compress_tasks);
+  private_data->compressed = NULL;
+  private_data->n_compressed = 0;
+  private_data->codec = NANOARROW_IPC_COMPRESSION_TYPE_NONE;
+  private_data->executor = NULL;
+  private_data->is_footer = 0;
+  encoder->private_data = private_data;
+  return NANOARROW_OK;
+}
+
+void ArrowIpcEncoderReset(struct ArrowIpcEncoder* encoder) {
+  struct ArrowIpcEncoderPrivate* private_data =
+      (struct ArrowIpcEncoderPrivate*)encoder->private_data;
+
+  if (private_data != NULL) {
+    flatcc_builder_clear(&private_data->builder);
+    ArrowBufferReset(&private_data->body_buffers);
+    ArrowBufferReset(&private_data->nodes);
+    ArrowBufferReset(&private_data->buffers);
+    ArrowBufferReset(&private_data->sources);
+    ArrowBufferReset(&private_data->compress_tasks);
+    for (int64_t i = 0; i < private_data->n_compressed; i++) {
+      ArrowBufferReset(private_data->compressed + i);
+    }
+    if (private_data->compressed != NULL) {
+      ArrowFree(private_data->compressed);
+    }
+    ArrowFree(private_data);
+    memset(encoder, 0, sizeof(struct ArrowIpcEncoder));
+  }
+}
+
+static inline void ArrowIpcEncoderResetMessage(struct ArrowIpcEncoder* encoder) {
+  struct ArrowIpcEncoderPrivate* private_data =
+      (struct ArrowIpcEncoderPrivate*)encoder->private_data;
+
+  flatcc_builder_reset(&private_data->builder);
+  private_data->body_buffers.size_bytes = 0;
+  private_data->nodes.size_bytes = 0;
+  private_data->buffers.size_bytes = 0;
+  private_data->sources.size_bytes = 0;
+  private_data->compress_tasks.size_bytes = 0;
+  private_data->is_footer = 0;
+  encoder->body_buffers = NULL;
+  encoder->n_body_buffers = 0;
+  encoder->body_size_bytes = 0;
+}
+
+static int ArrowIpcEncoderBuildMetadata(flatcc_builder_t* builder, const char* metadata,
+                                        ns(KeyValue_vec_ref_t) * out,
+                                        struct ArrowError* error) {
+  struct ArrowMetadataReader reader;
+  NANOARROW_RETURN_NOT_OK(ArrowMetadataReaderInit(&reader, metadata));
+
+  FLATCC_RETURN_UNLESS_0(KeyValue_vec_start(builder), error);
+  while (reader.remaining_keys > 0) {
+    struct ArrowStringView key;
+    struct ArrowStringView value;
+    NANOARROW_RETURN_NOT_OK(ArrowMetadataReaderRead(&reader, &key, &value));
+
+    flatbuffers_string_ref_t key_ref =
+        flatbuffers_string_create(builder, key.data, (size_t)key.size_bytes);
+    flatbuffers_string_ref_t value_ref =
+        flatbuffers_string_create(builder, value.data, (size_t)value.size_bytes);
+    if (!key_ref || !value_ref) {
+      ArrowErrorSet(error, "flatbuffers_string_create() failed");
+      return ENOMEM;
+    }
+
+    FLATCC_RETURN_IF_NULL(KeyValue_vec_push_create(builder, key_ref, value_ref), error);
+  }
+
+  *out = ns(KeyValue_vec_end(builder));
+  if (!*out) {
+    ArrowErrorSet(error, "KeyValue_vec_end() failed");
+    return ENOMEM;
+  }
+
+  return NANOARROW_OK;
+}
+
+static int ArrowIpcEncoderParseUnionTypeIds(const char* type_ids_str, int32_t* type_ids,
+                                            int64_t n_children,
+                                            struct ArrowError* error) {
+  const char* cursor = type_ids_str;
+  for (int64_t i = 0; i < n_children; i++) {
+    char* end;
+    type_ids[i] = (int32_t)strtol(cursor, &end, 10);
+    if (end == cursor || (*end != ',' && *end != '\0')) {
+      ArrowErrorSet(error, "Invalid union type ids '%s'", type_ids_str);
+      return EINVAL;
+    }
+
+    cursor = *end == ',' ? end + 1 : end;
+  }
+
+  return NANOARROW_OK;
+}
+
+static int ArrowIpcEncoderBuildUnion(flatcc_builder_t* builder,
+                                     struct ArrowSchemaView* schema_view,
+                                     struct ArrowError* error) {
+  int32_t type_ids[128];
+  int64_t n_children = schema_view->schema->n_children;
+  if (n_children > 127) {
+    ArrowErrorSet(error, "Expected between 0 and 127 union children but found %ld",
+                  (long)n_children);
+    return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderParseUnionTypeIds(schema_view->union_type_ids,
+                                                           type_ids, n_children, error));
+
+  ns(UnionMode_enum_t) mode = schema_view->type == NANOARROW_TYPE_DENSE_UNION
+                                  ? ns(UnionMode_Dense)
+                                  : ns(UnionMode_Sparse);
+  FLATCC_RETURN_UNLESS_0(Field_type_Union_start(builder), error);
+  FLATCC_RETURN_UNLESS_0(Union_mode_add(builder, mode), error);
+  FLATCC_RETURN_UNLESS_0(Union_typeIds_create(builder, type_ids, (size_t)n_children),
+                         error);
+  FLATCC_RETURN_UNLESS_0(Field_type_Union_end(builder), error);
+  return NANOARROW_OK;
+}
+
+static int ArrowIpcEncoderBuildFieldType(flatcc_builder_t* builder,
+                                         struct ArrowSchemaView* schema_view,
+                                         struct ArrowError* error) {
+  switch (schema_view->type) {
+    case NANOARROW_TYPE_NA:
+      FLATCC_RETURN_UNLESS_0(Field_type_Null_create(builder), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_BOOL:
+      FLATCC_RETURN_UNLESS_0(Field_type_Bool_create(builder), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_UINT8:
+    case NANOARROW_TYPE_INT8:
+      FLATCC_RETURN_UNLESS_0(
+          Field_type_Int_create(builder, 8, schema_view->type == NANOARROW_TYPE_INT8),
+          error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_UINT16:
+    case NANOARROW_TYPE_INT16:
+      FLATCC_RETURN_UNLESS_0(
+          Field_type_Int_create(builder, 16, schema_view->type == NANOARROW_TYPE_INT16),
+          error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_UINT32:
+    case NANOARROW_TYPE_INT32:
+      FLATCC_RETURN_UNLESS_0(
+          Field_type_Int_create(builder, 32, schema_view->type == NANOARROW_TYPE_INT32),
+          error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_UINT64:
+    case NANOARROW_TYPE_INT64:
+      FLATCC_RETURN_UNLESS_0(
+          Field_type_Int_create(builder, 64, schema_view->type == NANOARROW_TYPE_INT64),
+          error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_HALF_FLOAT:
+      FLATCC_RETURN_UNLESS_0(Field_type_FloatingPoint_create(builder, ns(Precision_HALF)),
+                             error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_FLOAT:
+      FLATCC_RETURN_UNLESS_0(
+          Field_type_FloatingPoint_create(builder, ns(Precision_SINGLE)), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_DOUBLE:
+      FLATCC_RETURN_UNLESS_0(
+          Field_type_FloatingPoint_create(builder, ns(Precision_DOUBLE)), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_DECIMAL128:
+    case NANOARROW_TYPE_DECIMAL256:
+      FLATCC_RETURN_UNLESS_0(
+          Field_type_Decimal_create(builder, schema_view->decimal_precision,
+                                    schema_view->decimal_scale,
+                                    schema_view->decimal_bitwidth),
+          error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_STRING:
+      FLATCC_RETURN_UNLESS_0(Field_type_Utf8_create(builder), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_LARGE_STRING:
+      FLATCC_RETURN_UNLESS_0(Field_type_LargeUtf8_create(builder), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_BINARY:
+      FLATCC_RETURN_UNLESS_0(Field_type_Binary_create(builder), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_LARGE_BINARY:
+      FLATCC_RETURN_UNLESS_0(Field_type_LargeBinary_create(builder), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_FIXED_SIZE_BINARY:
+      FLATCC_RETURN_UNLESS_0(
+          Field_type_FixedSizeBinary_create(builder, schema_view->fixed_size), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_DATE32:
+      FLATCC_RETURN_UNLESS_0(Field_type_Date_create(builder, ns(DateUnit_DAY)), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_DATE64:
+      FLATCC_RETURN_UNLESS_0(Field_type_Date_create(builder, ns(DateUnit_MILLISECOND)),
+                             error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_TIME32:
+      FLATCC_RETURN_UNLESS_0(
+          Field_type_Time_create(builder, (ns(TimeUnit_enum_t))schema_view->time_unit,
+                                 32),
+          error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_TIME64:
+      FLATCC_RETURN_UNLESS_0(
+          Field_type_Time_create(builder, (ns(TimeUnit_enum_t))schema_view->time_unit,
+                                 64),
+          error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_TIMESTAMP:
+      FLATCC_RETURN_UNLESS_0(Field_type_Timestamp_start(builder), error);
+      FLATCC_RETURN_UNLESS_0(
+          Timestamp_unit_add(builder, (ns(TimeUnit_enum_t))schema_view->time_unit),
+          error);
+      if (schema_view->timezone != NULL && schema_view->timezone[0] != '\0') {
+        FLATCC_RETURN_UNLESS_0(
+            Timestamp_timezone_create_str(builder, schema_view->timezone), error);
+      }
+      FLATCC_RETURN_UNLESS_0(Field_type_Timestamp_end(builder), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_DURATION:
+      FLATCC_RETURN_UNLESS_0(
+          Field_type_Duration_create(builder,
+                                     (ns(TimeUnit_enum_t))schema_view->time_unit),
+          error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_INTERVAL_MONTHS:
+      FLATCC_RETURN_UNLESS_0(
+          Field_type_Interval_create(builder, ns(IntervalUnit_YEAR_MONTH)), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_INTERVAL_DAY_TIME:
+      FLATCC_RETURN_UNLESS_0(
+          Field_type_Interval_create(builder, ns(IntervalUnit_DAY_TIME)), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_INTERVAL_MONTH_DAY_NANO:
+      FLATCC_RETURN_UNLESS_0(
+          Field_type_Interval_create(builder, ns(IntervalUnit_MONTH_DAY_NANO)), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_STRUCT:
+      FLATCC_RETURN_UNLESS_0(Field_type_Struct__create(builder), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_LIST:
+      FLATCC_RETURN_UNLESS_0(Field_type_List_create(builder), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_LARGE_LIST:
+      FLATCC_RETURN_UNLESS_0(Field_type_LargeList_create(builder), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_FIXED_SIZE_LIST:
+      FLATCC_RETURN_UNLESS_0(
+          Field_type_FixedSizeList_create(builder, schema_view->fixed_size), error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_MAP:
+      FLATCC_RETURN_UNLESS_0(
+          Field_type_Map_create(
+              builder, (schema_view->schema->flags & ARROW_FLAG_MAP_KEYS_SORTED) != 0),
+          error);
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_SPARSE_UNION:
+    case NANOARROW_TYPE_DENSE_UNION:
+      return ArrowIpcEncoderBuildUnion(builder, schema_view, error);
+    default:
+      ArrowErrorSet(error, "Encoding type %s is not supported",
+                    ArrowTypeString(schema_view->type));
+      return ENOTSUP;
+  }
+}
+
+static int ArrowIpcEncoderBuildField(flatcc_builder_t* builder,
+                                     struct ArrowSchema* schema,
+                                     int64_t* dictionary_id, struct ArrowError* error);
+
+static int ArrowIpcEncoderBuildChildren(flatcc_builder_t* builder,
+                                        struct ArrowSchema* schema,
+                                        int64_t* dictionary_id,
+                                        struct ArrowError* error) {
+  // Other readers require that the children vector is present even if it is empty
+  FLATCC_RETURN_UNLESS_0(Field_children_start(builder), error);
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    FLATCC_RETURN_UNLESS_0(Field_children_push_start(builder), error);
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcEncoderBuildField(builder, schema->children[i], dictionary_id, error));
+    FLATCC_RETURN_IF_NULL(Field_children_push_end(builder), error);
+  }
+  FLATCC_RETURN_UNLESS_0(Field_children_end(builder), error);
+  return NANOARROW_OK;
+}
+
+static int ArrowIpcEncoderSchemaHasDictionary(struct ArrowSchema* schema) {
+  if (schema->dictionary != NULL) {
+    return 1;
+  }
+
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    if (ArrowIpcEncoderSchemaHasDictionary(schema->children[i])) {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+// Adds the DictionaryEncoding of a dictionary-encoded field and the type and
+// children of its values
+static int ArrowIpcEncoderBuildDictionaryField(flatcc_builder_t* builder,
+                                               struct ArrowSchemaView* schema_view,
+                                               int64_t* dictionary_id,
+                                               struct ArrowError* error) {
+  struct ArrowSchema* schema = schema_view->schema;
+  if (ArrowIpcEncoderSchemaHasDictionary(schema->dictionary)) {
+    ArrowErrorSet(error,
+                  "Encoding dictionary-encoded dictionary values is not supported");
+    return ENOTSUP;
+  }
+
+  int bit_width;
+  switch (schema_view->storage_type) {
+    case NANOARROW_TYPE_INT8:
+    case NANOARROW_TYPE_UINT8:
+      bit_width = 8;
+      break;
+    case NANOARROW_TYPE_INT16:
+    case NANOARROW_TYPE_UINT16:
+      bit_width = 16;
+      break;
+    case NANOARROW_TYPE_INT32:
+    case NANOARROW_TYPE_UINT32:
+      bit_width = 32;
+      break;
+    default:
+      bit_width = 64;
+      break;
+  }
+
+  int is_signed = schema_view->storage_type == NANOARROW_TYPE_INT8 ||
+                  schema_view->storage_type == NANOARROW_TYPE_INT16 ||
+                  schema_view->storage_type == NANOARROW_TYPE_INT32 ||
+                  schema_view->storage_type == NANOARROW_TYPE_INT64;
+
+  FLATCC_RETURN_UNLESS_0(Field_dictionary_start(builder), error);
+  FLATCC_RETURN_UNLESS_0(DictionaryEncoding_id_add(builder, *dictionary_id), error);
+  FLATCC_RETURN_UNLESS_0(
+      DictionaryEncoding_indexType_create(builder, bit_width, is_signed), error);
+  FLATCC_RETURN_UNLESS_0(
+      DictionaryEncoding_isOrdered_add(
+          builder, (schema->flags & ARROW_FLAG_DICTIONARY_ORDERED) != 0),
+      error);
+  FLATCC_RETURN_UNLESS_0(Field_dictionary_end(builder), error);
+  *dictionary_id += 1;
+
+  struct ArrowSchemaView value_view;
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaViewInit(&value_view, schema->dictionary, error));
+  NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderBuildFieldType(builder, &value_view, error));
+  return ArrowIpcEncoderBuildChildren(builder, schema->dictionary, dictionary_id, error);
+}
+
+// Dictionary-encoded fields are assigned ids from dictionary_id in depth-first order
+static int ArrowIpcEncoderBuildField(flatcc_builder_t* builder,
+                                     struct ArrowSchema* schema,
+                                     int64_t* dictionary_id, struct ArrowError* error) {
+  struct ArrowSchemaView schema_view;
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaViewInit(&schema_view, schema, error));
+
+  if (schema->name != NULL) {
+    FLATCC_RETURN_UNLESS_0(Field_name_create_str(builder, schema->name), error);
+  }
+
+  FLATCC_RETURN_UNLESS_0(
+      Field_nullable_add(builder, (schema->flags & ARROW_FLAG_NULLABLE) != 0), error);
+
+  if (schema->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcEncoderBuildDictionaryField(builder, &schema_view, dictionary_id, error));
+  } else {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderBuildFieldType(builder, &schema_view, error));
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcEncoderBuildChildren(builder, schema, dictionary_id, error));
+  }
+
+  if (schema->metadata != NULL) {
+    ns(KeyValue_vec_ref_t) metadata;
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcEncoderBuildMetadata(builder, schema->metadata, &metadata, error));
+    FLATCC_RETURN_UNLESS_0(Field_custom_metadata_add(builder, metadata), error);
+  }
+
+  return NANOARROW_OK;
+}
+
+static int ArrowIpcEncoderCheckSchema(struct ArrowSchema* schema,
+                                     struct ArrowError* error) {
+  struct ArrowSchemaView schema_view;
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaViewInit(&schema_view, schema, error));
+  if (schema_view.type != NANOARROW_TYPE_STRUCT) {
+    ArrowErrorSet(error, "Expected schema of type struct but found %s",
+                  ArrowTypeString(schema_view.type));
+    return EINVAL;
+  }
+
+  return NANOARROW_OK;
+}
+
+// Adds the fields of a Schema table that has already been started. This is shared by
+// the Schema message and the file Footer, which embeds the same table.
+static int ArrowIpcEncoderBuildSchema(flatcc_builder_t* builder,
+                                      struct ArrowSchema* schema,
+                                      struct ArrowError* error) {
+  uint32_t check = 1;
+  char first_byte;
+  memcpy(&first_byte, &check, sizeof(char));
+  ns(Endianness_enum_t) endianness =
+      first_byte ? ns(Endianness_Little) : ns(Endianness_Big);
+
+  FLATCC_RETURN_UNLESS_0(Schema_endianness_add(builder, endianness), error);
+
+  int64_t dictionary_id = 0;
+  FLATCC_RETURN_UNLESS_0(Schema_fields_start(builder), error);
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    FLATCC_RETURN_UNLESS_0(Schema_fields_push_start(builder), error);
+    NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderBuildField(builder, schema->children[i],
+                                                      &dictionary_id, error));
+    FLATCC_RETURN_IF_NULL(Schema_fields_push_end(builder), error);
+  }
+  FLATCC_RETURN_UNLESS_0(Schema_fields_end(builder), error);
+
+  if (schema->metadata != NULL) {
+    ns(KeyValue_vec_ref_t) metadata;
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcEncoderBuildMetadata(builder, schema->metadata, &metadata, error));
+    FLATCC_RETURN_UNLESS_0(Schema_custom_metadata_add(builder, metadata), error);
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcEncoderEncodeSchema(struct ArrowIpcEncoder* encoder,
+                                           struct ArrowSchema* schema,
+                                           struct ArrowError* error) {
+  struct ArrowIpcEncoderPrivate* private_data =
+      (struct ArrowIpcEncoderPrivate*)encoder->private_data;
+  flatcc_builder_t* builder = &private_data->builder;
+  ArrowIpcEncoderResetMessage(encoder);
+  NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderCheckSchema(schema, error));
+
+  FLATCC_RETURN_UNLESS_0(Message_start_as_root(builder), error);
+  FLATCC_RETURN_UNLESS_0(Message_version_add(builder, ns(MetadataVersion_V5)), error);
+
+  FLATCC_RETURN_UNLESS_0(Message_header_Schema_start(builder), error);
+  NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderBuildSchema(builder, schema, error));
+  FLATCC_RETURN_UNLESS_0(Message_header_Schema_end(builder), error);
+
+  FLATCC_RETURN_UNLESS_0(Message_bodyLength_add(builder, 0), error);
+  FLATCC_RETURN_IF_NULL(Message_end_as_root(builder), error);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcEncoderEncodeFooter(struct ArrowIpcEncoder* encoder,
+                                           struct ArrowIpcFooter* footer,
+                                           struct ArrowError* error) {
+  struct ArrowIpcEncoderPrivate* private_data =
+      (struct ArrowIpcEncoderPrivate*)encoder->private_data;
+  flatcc_builder_t* builder = &private_data->builder;
+  ArrowIpcEncoderResetMessage(encoder);
+  NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderCheckSchema(&footer->schema, error));
+
+  FLATCC_RETURN_UNLESS_0(Footer_start_as_root(builder), error);
+  FLATCC_RETURN_UNLESS_0(Footer_version_add(builder, ns(MetadataVersion_V5)), error);
+
+  FLATCC_RETURN_UNLESS_0(Footer_schema_start(builder), error);
+  NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderBuildSchema(builder, &footer->schema, error));
+  FLATCC_RETURN_UNLESS_0(Footer_schema_end(builder), error);
+
+  const struct ArrowIpcFileBlock* blocks =
+      (const struct ArrowIpcFileBlock*)footer->dictionary_blocks.data;
+  int64_t n_blocks =
+      footer->dictionary_blocks.size_bytes / sizeof(struct ArrowIpcFileBlock);
+
+  FLATCC_RETURN_UNLESS_0(Footer_dictionaries_start(builder), error);
+  for (int64_t i = 0; i < n_blocks; i++) {
+    FLATCC_RETURN_IF_NULL(
+        Footer_dictionaries_push_create(builder, blocks[i].offset,
+                                        blocks[i].metadata_length,
+                                        blocks[i].body_length),
+        error);
+  }
+  FLATCC_RETURN_UNLESS_0(Footer_dictionaries_end(builder), error);
+
+  blocks = (const struct ArrowIpcFileBlock*)footer->record_batch_blocks.data;
+  n_blocks = footer->record_batch_blocks.size_bytes / sizeof(struct ArrowIpcFileBlock);
+
+  FLATCC_RETURN_UNLESS_0(Footer_recordBatches_start(builder), error);
+  for (int64_t i = 0; i < n_blocks; i++) {
+    FLATCC_RETURN_IF_NULL(
+        Footer_recordBatches_push_create(builder, blocks[i].offset,
+                                         blocks[i].metadata_length,
+                                         blocks[i].body_length),
+        error);
+  }
+  FLATCC_RETURN_UNLESS_0(Footer_recordBatches_end(builder), error);
+
+  FLATCC_RETURN_IF_NULL(Footer_end_as_root(builder), error);
+  private_data->is_footer = 1;
+  return NANOARROW_OK;
+}
+
+static int ArrowIpcEncoderCollectBuffers(struct ArrowIpcEncoderPrivate* private_data,
+                                         struct ArrowArrayView* array_view,
+                                         struct ArrowError* error) {
+  if (array_view->offset != 0) {
+    ArrowErrorSet(error, "Encoding an array with a non-zero offset is not supported");
+    return ENOTSUP;
+  }
+
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_STRING_VIEW:
+    case NANOARROW_TYPE_RUN_END_ENCODED:
+      ArrowErrorSet(error, "Encoding an array of type %s is not supported",
+                    ArrowTypeString(array_view->storage_type));
+      return ENOTSUP;
+    default:
+      break;
+  }
+
+  // Only the indices of a dictionary-encoded array are part of a RecordBatch (the
+  // values are encoded separately with ArrowIpcEncoderEncodeDictionaryBatch()).
+  // The null count must be known to write the FieldNode.
+  int64_t node[2];
+  node[0] = array_view->length;
+  node[1] = ArrowArrayViewComputeNullCount(array_view);
+  NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(&private_data->nodes, node, sizeof(node)));
+
+  for (int i = 0; i < 3; i++) {
+    if (array_view->layout.buffer_type[i] == NANOARROW_BUFFER_TYPE_NONE) {
+      break;
+    }
+
+    struct ArrowBufferView view = array_view->buffer_views[i];
+    if (view.size_bytes < 0) {
+      ArrowErrorSet(error, "Expected non-negative size for buffer %d but found %ld", i,
+                    (long)view.size_bytes);
+      return EINVAL;
+    }
+
+    // The validity bitmap of an array without nulls is written as an empty buffer
+    if (view.data.data == NULL ||
+        (node[1] == 0 &&
+         array_view->layout.buffer_type[i] == NANOARROW_BUFFER_TYPE_VALIDITY)) {
+      view.size_bytes = 0;
+    }
+
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferAppend(&private_data->sources, &view, sizeof(view)));
+  }
+
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcEncoderCollectBuffers(private_data, array_view->children[i], error));
+  }
+
+  return NANOARROW_OK;
+}
+
+typedef ArrowErrorCode (*ArrowIpcCompressFunction)(struct ArrowBufferView src,
+                                                   struct ArrowBuffer* dst,
+                                                   struct ArrowError* error);
+
+// Compressors append to dst (which already contains the 8-byte length prefix)
+#if defined(NANOARROW_IPC_WITH_ZSTD)
+static ArrowErrorCode ArrowIpcCompressZstd(struct ArrowBufferView src,
+                                           struct ArrowBuffer* dst,
+                                           struct ArrowError* error) {
+  size_t max_size = ZSTD_compressBound((size_t)src.size_bytes);
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowBufferReserve(dst, (int64_t)max_size), error);
+
+  // Level 1 matches the default of the Arrow C++ IPC writer
+  size_t code = ZSTD_compress(dst->data + dst->size_bytes, max_size, src.data.data,
+                              (size_t)src.size_bytes, 1);
+  if (ZSTD_isError(code)) {
+    ArrowErrorSet(error, "ZSTD_compress() failed: %s", ZSTD_getErrorName(code));
+    return EIO;
+  }
+
+  dst->size_bytes += (int64_t)code;
+  return NANOARROW_OK;
+}
+#endif
+
+#if defined(NANOARROW_IPC_WITH_LZ4)
+static ArrowErrorCode ArrowIpcCompressLz4(struct ArrowBufferView src,
+                                          struct ArrowBuffer* dst,
+                                          struct ArrowError* error) {
+  size_t max_size = LZ4F_compressFrameBound((size_t)src.size_bytes, NULL);
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowBufferReserve(dst, (int64_t)max_size), error);
+
+  size_t code = LZ4F_compressFrame(dst->data + dst->size_bytes, max_size, src.data.data,
+                                   (size_t)src.size_bytes, NULL);
+  if (LZ4F_isError(code)) {
+    ArrowErrorSet(error, "LZ4F_compressFrame() failed: %s", LZ4F_getErrorName(code));
+    return EIO;
+  }
+
+  dst->size_bytes += (int64_t)code;
+  return NANOARROW_OK;
+}
+#endif
+
+static ArrowIpcCompressFunction ArrowIpcGetCompressFunction(
+    enum ArrowIpcCompressionType codec) {
+  switch (codec) {
+#if defined(NANOARROW_IPC_WITH_ZSTD)
+    case NANOARROW_IPC_COMPRESSION_TYPE_ZSTD:
+      return &ArrowIpcCompressZstd;
+#endif
+#if defined(NANOARROW_IPC_WITH_LZ4)
+    case NANOARROW_IPC_COMPRESSION_TYPE_LZ4_FRAME:
+      return &ArrowIpcCompressLz4;
+#endif
+    default:
+      return NULL;
+  }
+}
+
+int ArrowIpcCompressionIsSupported(enum ArrowIpcCompressionType codec) {
+  return ArrowIpcGetCompressFunction(codec) != NULL;
+}
+
+ArrowErrorCode ArrowIpcEncoderSetCompression(struct ArrowIpcEncoder* encoder,
+                                             enum ArrowIpcCompressionType codec) {
+  struct ArrowIpcEncoderPrivate* private_data =
+      (struct ArrowIpcEncoderPrivate*)encoder->private_data;
+  if (codec != NANOARROW_IPC_COMPRESSION_TYPE_NONE &&
+      !ArrowIpcCompressionIsSupported(codec)) {
+    return ENOTSUP;
+  }
+
+  private_data->codec = codec;
+  return NANOARROW_OK;
+}
+
+void ArrowIpcEncoderSetExecutor(struct ArrowIpcEncoder* encoder,
+                                struct ArrowExecutor* executor) {
+  struct ArrowIpcEncoderPrivate* private_data =
+      (struct ArrowIpcEncoderPrivate*)encoder->private_data;
+  private_data->executor = executor;
+}
+
+// The compression of one Buffer. On success, dst contains the little-endian
+// uncompressed length followed by the compressed bytes or, if compression did not
+// make the buffer smaller, only a length of -1 (i.e., the uncompressed bytes of src
+// follow in the body).
+struct ArrowIpcCompressTask {
+  ArrowIpcCompressFunction compress;
+  struct ArrowBufferView src;
+  struct ArrowBuffer* dst;
+  ArrowErrorCode result;
+};
+
+static void ArrowIpcEncoderWriteInt64LE(uint8_t* out, int64_t value) {
+  for (int i = 0; i < 8; i++) {
+    out[i] = (uint8_t)(((uint64_t)value >> (8 * i)) & 0xFF);
+  }
+}
+
+static ArrowErrorCode ArrowIpcCompressTaskRunInternal(struct ArrowIpcCompressTask* task,
+                                                      struct ArrowError* error) {
+  struct ArrowBuffer* dst = task->dst;
+  dst->size_bytes = 0;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowBufferReserve(dst, 8), error);
+  ArrowIpcEncoderWriteInt64LE(dst->data, task->src.size_bytes);
+  dst->size_bytes = 8;
+  NANOARROW_RETURN_NOT_OK(task->compress(task->src, dst, error));
+
+  if ((dst->size_bytes - 8) >= task->src.size_bytes) {
+    ArrowIpcEncoderWriteInt64LE(dst->data, -1);
+    dst->size_bytes = 8;
+  }
+
+  return NANOARROW_OK;
+}
+
+static void ArrowIpcCompressTaskRun(void* task_private, int64_t i) {
+  struct ArrowIpcCompressTask* task = (struct ArrowIpcCompressTask*)task_private + i;
+  task->result = ArrowIpcCompressTaskRunInternal(task, NULL);
+}
+
+static ArrowErrorCode ArrowIpcEncoderCompressBuffers(
+    struct ArrowIpcEncoderPrivate* private_data, struct ArrowError* error) {
+  const struct ArrowBufferView* sources =
+      (const struct ArrowBufferView*)private_data->sources.data;
+  int64_t n_sources = private_data->sources.size_bytes / sizeof(struct ArrowBufferView);
+
+  // Compressed buffers are kept between messages such that their memory is reused
+  if (private_data->n_compressed < n_sources) {
+    struct ArrowBuffer* compressed = (struct ArrowBuffer*)ArrowRealloc(
+        private_data->compressed, n_sources * sizeof(struct ArrowBuffer));
+    if (compressed == NULL) {
+      ArrowErrorSet(error, "Failed to allocate compressed buffers");
+      return ENOMEM;
+    }
+
+    for (int64_t i = private_data->n_compressed; i < n_sources; i++) {
+      ArrowBufferInit(compressed + i);
+    }
+
+    private_data->compressed = compressed;
+    private_data->n_compressed = n_sources;
+  }
+
+  ArrowIpcCompressFunction compress = ArrowIpcGetCompressFunction(private_data->codec);
+  for (int64_t i = 0; i < n_sources; i++) {
+    if (sources[i].size_bytes == 0) {
+      continue;
+    }
+
+    struct ArrowIpcCompressTask task;
+    task.compress = compress;
+    task.src = sources[i];
+    task.dst = private_data->compressed + i;
+    task.result = NANOARROW_OK;
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+        ArrowBufferAppend(&private_data->compress_tasks, &task, sizeof(task)), error);
+  }
+
+  struct ArrowIpcCompressTask* tasks =
+      (struct ArrowIpcCompressTask*)private_data->compress_tasks.data;
+  int64_t n_tasks =
+      private_data->compress_tasks.size_bytes / sizeof(struct ArrowIpcCompressTask);
+
+  if (private_data->executor == NULL || n_tasks < 2) {
+    for (int64_t i = 0; i < n_tasks; i++) {
+      NANOARROW_RETURN_NOT_OK(ArrowIpcCompressTaskRunInternal(tasks + i, error));
+    }
+
+    return NANOARROW_OK;
+  }
+
+  private_data->executor->parallel_for(private_data->executor, &ArrowIpcCompressTaskRun,
+                                       tasks, n_tasks);
+
+  // Tasks don't have their own ArrowError, so a failed task is repeated on this thread
+  // to populate error
+  for (int64_t i = 0; i < n_tasks; i++) {
+    if (tasks[i].result != NANOARROW_OK) {
+      int result = ArrowIpcCompressTaskRunInternal(tasks + i, error);
+      return result != NANOARROW_OK ? result : tasks[i].result;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowIpcEncoderAppendBodyBuffer(
+    struct ArrowIpcEncoderPrivate* private_data, const uint8_t* data,
+    int64_t size_bytes) {
+  if (size_bytes == 0) {
+    return NANOARROW_OK;
+  }
+
+  struct ArrowBufferView view;
+  view.data.as_uint8 = data;
+  view.size_bytes = size_bytes;
+  return ArrowBufferAppend(&private_data->body_buffers, &view, sizeof(view));
+}
+
+// Lays out the body from the collected (and possibly compressed) Buffers such that
+// each Buffer is followed by the padding required to make its size a multiple of
+// 8 bytes
+static ArrowErrorCode ArrowIpcEncoderLayoutBody(
+    struct ArrowIpcEncoderPrivate* private_data, int64_t* body_size_bytes,
+    struct ArrowError* error) {
+  if (private_data->codec != NANOARROW_IPC_COMPRESSION_TYPE_NONE) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderCompressBuffers(private_data, error));
+  }
+
+  const struct ArrowBufferView* sources =
+      (const struct ArrowBufferView*)private_data->sources.data;
+  int64_t n_sources = private_data->sources.size_bytes / sizeof(struct ArrowBufferView);
+  *body_size_bytes = 0;
+
+  for (int64_t i = 0; i < n_sources; i++) {
+    int64_t size_bytes = sources[i].size_bytes;
+    if (private_data->codec == NANOARROW_IPC_COMPRESSION_TYPE_NONE ||
+        size_bytes == 0) {
+      NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderAppendBodyBuffer(
+          private_data, sources[i].data.as_uint8, size_bytes));
+    } else {
+      // The compressed bytes or the -1 prefix followed by the uncompressed bytes
+      struct ArrowBuffer* compressed = private_data->compressed + i;
+      NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderAppendBodyBuffer(
+          private_data, compressed->data, compressed->size_bytes));
+      if (compressed->size_bytes == 8) {
+        NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderAppendBodyBuffer(
+            private_data, sources[i].data.as_uint8, size_bytes));
+        size_bytes += 8;
+      } else {
+        size_bytes = compressed->size_bytes;
+      }
+    }
+
+    int64_t buffer[2];
+    buffer[0] = *body_size_bytes;
+    buffer[1] = size_bytes;
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferAppend(&private_data->buffers, buffer, sizeof(buffer)));
+
+    int64_t padding_bytes = (8 - size_bytes % 8) % 8;
+    NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderAppendBodyBuffer(
+        private_data, kArrowIpcEncoderPadding, padding_bytes));
+    *body_size_bytes += size_bytes + padding_bytes;
+  }
+
+  return NANOARROW_OK;
+}
+
+// Adds the length, nodes, and buffers of a RecordBatch table that has already been
+// started from the nodes and buffers collected for the last encoded message. This is
+// shared by RecordBatch and DictionaryBatch messages, the latter of which wraps a
+// RecordBatch whose only column contains the dictionary values.
+static int ArrowIpcEncoderBuildRecordBatch(struct ArrowIpcEncoderPrivate* private_data,
+                                           int64_t length, struct ArrowError* error) {
+  flatcc_builder_t* builder = &private_data->builder;
+  const int64_t* nodes = (const int64_t*)private_data->nodes.data;
+  int64_t n_nodes = private_data->nodes.size_bytes / (2 * sizeof(int64_t));
+  const int64_t* buffers = (const int64_t*)private_data->buffers.data;
+  int64_t n_buffers = private_data->buffers.size_bytes / (2 * sizeof(int64_t));
+
+  FLATCC_RETURN_UNLESS_0(RecordBatch_length_add(builder, length), error);
+
+  FLATCC_RETURN_UNLESS_0(RecordBatch_nodes_start(builder), error);
+  for (int64_t i = 0; i < n_nodes; i++) {
+    FLATCC_RETURN_IF_NULL(
+        RecordBatch_nodes_push_create(builder, nodes[2 * i], nodes[2 * i + 1]), error);
+  }
+  FLATCC_RETURN_UNLESS_0(RecordBatch_nodes_end(builder), error);
+
+  FLATCC_RETURN_UNLESS_0(RecordBatch_buffers_start(builder), error);
+  for (int64_t i = 0; i < n_buffers; i++) {
+    FLATCC_RETURN_IF_NULL(
+        RecordBatch_buffers_push_create(builder, buffers[2 * i], buffers[2 * i + 1]),
+        error);
+  }
+  FLATCC_RETURN_UNLESS_0(RecordBatch_buffers_end(builder), error);
+
+  if (private_data->codec != NANOARROW_IPC_COMPRESSION_TYPE_NONE) {
+    ns(CompressionType_enum_t) codec =
+        private_data->codec == NANOARROW_IPC_COMPRESSION_TYPE_ZSTD
+            ? ns(CompressionType_ZSTD)
+            : ns(CompressionType_LZ4_FRAME);
+    FLATCC_RETURN_UNLESS_0(
+        RecordBatch_compression_create(builder, codec, ns(BodyCompressionMethod_BUFFER)),
+        error);
+  }
+
+  return NANOARROW_OK;
+}
+
+static void ArrowIpcEncoderSetBodyBuffers(struct ArrowIpcEncoder* encoder,
+                                          int64_t body_size_bytes) {
+  struct ArrowIpcEncoderPrivate* private_data =
+      (struct ArrowIpcEncoderPrivate*)encoder->private_data;
+  encoder->body_buffers = (const struct ArrowBufferView*)private_data->body_buffers.data;
+  encoder->n_body_buffers =
+      private_data->body_buffers.size_bytes / sizeof(struct ArrowBufferView);
+  encoder->body_size_bytes = body_size_bytes;
+}
+
+ArrowErrorCode ArrowIpcEncoderEncodeRecordBatch(struct ArrowIpcEncoder* encoder,
+                                                struct ArrowArrayView* array_view,
+                                                struct ArrowError* error) {
+  struct ArrowIpcEncoderPrivate* private_data =
+      (struct ArrowIpcEncoderPrivate*)encoder->private_data;
+  flatcc_builder_t* builder = &private_data->builder;
+  ArrowIpcEncoderResetMessage(encoder);
+
+  if (array_view->storage_type != NANOARROW_TYPE_STRUCT) {
+    ArrowErrorSet(error, "Expected array of type struct but found %s",
+                  ArrowTypeString(array_view->storage_type));
+    return EINVAL;
+  }
+
+  if (array_view->offset != 0) {
+    ArrowErrorSet(error, "Encoding an array with a non-zero offset is not supported");
+    return ENOTSUP;
+  }
+
+  // The root struct array has no FieldNode or buffers of its own
+  int64_t body_size_bytes = 0;
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcEncoderCollectBuffers(private_data, array_view->children[i], error));
+  }
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcEncoderLayoutBody(private_data, &body_size_bytes, error));
+
+  FLATCC_RETURN_UNLESS_0(Message_start_as_root(builder), error);
+  FLATCC_RETURN_UNLESS_0(Message_version_add(builder, ns(MetadataVersion_V5)), error);
+
+  FLATCC_RETURN_UNLESS_0(Message_header_RecordBatch_start(builder), error);
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcEncoderBuildRecordBatch(private_data, array_view->length, error));
+  FLATCC_RETURN_UNLESS_0(Message_header_RecordBatch_end(builder), error);
+
+  FLATCC_RETURN_UNLESS_0(Message_bodyLength_add(builder, body_size_bytes), error);
+  FLATCC_RETURN_IF_NULL(Message_end_as_root(builder), error);
+
+  ArrowIpcEncoderSetBodyBuffers(encoder, body_size_bytes);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcEncoderEncodeDictionaryBatch(struct ArrowIpcEncoder* encoder,
+                                                    int64_t id, int is_delta,
+                                                    struct ArrowArrayView* values,
+                                                    struct ArrowError* error) {
+  struct ArrowIpcEncoderPrivate* private_data =
+      (struct ArrowIpcEncoderPrivate*)encoder->private_data;
+  flatcc_builder_t* builder = &private_data->builder;
+  ArrowIpcEncoderResetMessage(encoder);
+
+  if (values->dictionary != NULL) {
+    ArrowErrorSet(error,
+                  "Encoding dictionary-encoded dictionary values is not supported");
+    return ENOTSUP;
+  }
+
+  int64_t body_size_bytes = 0;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderCollectBuffers(private_data, values, error));
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcEncoderLayoutBody(private_data, &body_size_bytes, error));
+
+  FLATCC_RETURN_UNLESS_0(Message_start_as_root(builder), error);
+  FLATCC_RETURN_UNLESS_0(Message_version_add(builder, ns(MetadataVersion_V5)), error);
+
+  FLATCC_RETURN_UNLESS_0(Message_header_DictionaryBatch_start(builder), error);
+  FLATCC_RETURN_UNLESS_0(DictionaryBatch_id_add(builder, id), error);
+  FLATCC_RETURN_UNLESS_0(DictionaryBatch_data_start(builder), error);
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcEncoderBuildRecordBatch(private_data, values->length, error));
+  FLATCC_RETURN_UNLESS_0(DictionaryBatch_data_end(builder), error);
+  FLATCC_RETURN_UNLESS_0(DictionaryBatch_isDelta_add(builder, is_delta != 0), error);
+  FLATCC_RETURN_UNLESS_0(Message_header_DictionaryBatch_end(builder), error);
+
+  FLATCC_RETURN_UNLESS_0(Message_bodyLength_add(builder, body_size_bytes), error);
+  FLATCC_RETURN_IF_NULL(Message_end_as_root(builder), error);
+
+  ArrowIpcEncoderSetBodyBuffers(encoder, body_size_bytes);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcEncoderFinalizeBuffer(struct ArrowIpcEncoder* encoder,
+                                             struct ArrowBuffer* out) {
+  struct ArrowIpcEncoderPrivate* private_data =
+      (struct ArrowIpcEncoderPrivate*)encoder->private_data;
+  flatcc_builder_t* builder = &private_data->builder;
+
+  size_t size_bytes = flatcc_builder_get_buffer_size(builder);
+  if (size_bytes == 0 || size_bytes > 2147483640) {
+    return EINVAL;
+  }
+
+  if (private_data->is_footer) {
+    // The footer is followed by its little-endian 32-bit size and the magic bytes
+    uint8_t suffix[10] = {0, 0, 0, 0, 'A', 'R', 'R', 'O', 'W', '1'};
+    for (int i = 0; i < 4; i++) {
+      suffix[i] = (uint8_t)(((uint32_t)size_bytes >> (8 * i)) & 0xFF);
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(out, size_bytes + sizeof(suffix)));
+    if (flatcc_builder_copy_buffer(builder, out->data + out->size_bytes, size_bytes) ==
+        NULL) {
+      return EINVAL;
+    }
+
+    out->size_bytes += size_bytes;
+    ArrowBufferAppendUnsafe(out, suffix, sizeof(suffix));
+    return NANOARROW_OK;
+  }
+
+  // The header size must be written as a little-endian 32-bit integer
+  int32_t padded_size_bytes = (int32_t)((size_bytes + 7) / 8 * 8);
+  uint8_t prefix[8] = {0xFF, 0xFF, 0xFF, 0xFF, 0, 0, 0, 0};
+  for (int i = 0; i < 4; i++) {
+    prefix[4 + i] = (uint8_t)(((uint32_t)padded_size_bytes >> (8 * i)) & 0xFF);
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(out, sizeof(prefix) + padded_size_bytes));
+  ArrowBufferAppendUnsafe(out, prefix, sizeof(prefix));
+  if (flatcc_builder_copy_buffer(builder, out->data + out->size_bytes, size_bytes) ==
+      NULL) {
+    return EINVAL;
+  }
+
+  out->size_bytes += size_bytes;
+  memset(out->data + out->size_bytes, 0, padded_size_bytes - size_bytes);
+  out->size_bytes += padded_size_bytes - size_bytes;
+  return NANOARROW_OK;
+}
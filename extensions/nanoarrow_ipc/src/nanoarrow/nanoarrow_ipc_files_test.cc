@@ -270,18 +270,12 @@ INSTANTIATE_TEST_SUITE_P(
         TestFile::OK("generated_recursive_nested.stream"),
         TestFile::OK("generated_union.stream"),
 
-        // Files with features that are not yet supported (Dictionary encoding)
-        TestFile::NotSupported(
-            "generated_dictionary_unsigned.stream",
-            "Schema message field with DictionaryEncoding not supported"),
-        TestFile::NotSupported(
-            "generated_dictionary.stream",
-            "Schema message field with DictionaryEncoding not supported"),
-        TestFile::NotSupported(
-            "generated_nested_dictionary.stream",
-            "Schema message field with DictionaryEncoding not supported"),
-        TestFile::NotSupported(
-            "generated_extension.stream",
-            "Schema message field with DictionaryEncoding not supported")
+        TestFile::OK("generated_dictionary_unsigned.stream"),
+        TestFile::OK("generated_dictionary.stream"),
+        TestFile::OK("generated_extension.stream"),
+
+        // Files with features that are not yet supported (nested dictionaries)
+        TestFile::NotSupported("generated_nested_dictionary.stream",
+                               "Dictionary-encoded dictionary values are not supported")
         // Comment to keep last line from wrapping
         ));
@@ -17,6 +17,12 @@
 
 #include <gtest/gtest.h>
 
+#include <errno.h>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include "nanoarrow_ipc.hpp"
 
 TEST(NanoarrowIpcHppTest, NanoarrowIpcHppTestUniqueDecoder) {
@@ -44,3 +50,168 @@ TEST(NanoarrowIpcHppTest, NanoarrowIpcHppTestUniqueInputStream) {
   EXPECT_NE(input2->release, nullptr);
   EXPECT_EQ(input->release, nullptr);
 }
+
+// Writes a stream of struct<col: int32> batches with the given lengths to output
+static void WriteBatches(struct ArrowBuffer* output,
+                         const std::vector<int32_t>& lengths) {
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.get(), NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(schema.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0], "col"), NANOARROW_OK);
+
+  nanoarrow::ipc::UniqueOutputStream output_stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(output_stream.get(), output), NANOARROW_OK);
+  nanoarrow::ipc::UniqueWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(writer.get(), output_stream.get()), NANOARROW_OK);
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(writer.get(), schema.get(), &error), NANOARROW_OK)
+      << error.message;
+
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), &error),
+            NANOARROW_OK);
+  for (int32_t length : lengths) {
+    nanoarrow::UniqueArray array;
+    ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+    for (int32_t i = 0; i < length; i++) {
+      ASSERT_EQ(ArrowArrayAppendInt(array->children[0], i), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayFinishElement(array.get()), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), &error),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowIpcWriterWriteArrayView(writer.get(), array_view.get(), &error),
+              NANOARROW_OK)
+        << error.message;
+  }
+}
+
+static nanoarrow::ipc::UniqueInputStream MakeInput(struct ArrowBuffer* data) {
+  nanoarrow::ipc::UniqueInputStream input;
+  EXPECT_EQ(ArrowIpcInputStreamInitBuffer(input.get(), data), NANOARROW_OK);
+  return input;
+}
+
+TEST(NanoarrowIpcHppTest, NanoarrowIpcHppTestBatchReader) {
+  nanoarrow::UniqueBuffer data;
+  ASSERT_NO_FATAL_FAILURE(WriteBatches(data.get(), {5, 5, 3}));
+
+  nanoarrow::ipc::BatchReader reader(MakeInput(data.get()));
+  struct ArrowError error;
+  ASSERT_EQ(reader.ReadSchema(&error), NANOARROW_OK) << error.message;
+  ASSERT_EQ(reader.schema()->n_children, 1);
+
+  // Every batch is decoded into the same array and buffers
+  struct ArrowArray* batch;
+  ASSERT_EQ(reader.Next(&batch, &error), NANOARROW_OK) << error.message;
+  ASSERT_NE(batch, nullptr);
+  ASSERT_EQ(batch->length, 5);
+  struct ArrowArray* first_batch = batch;
+  const void* first_values = batch->children[0]->buffers[1];
+
+  for (int64_t expected_length : {5, 3}) {
+    ASSERT_EQ(reader.Next(&batch, &error), NANOARROW_OK) << error.message;
+    ASSERT_EQ(batch, first_batch);
+    ASSERT_EQ(batch->length, expected_length);
+    EXPECT_EQ(batch->children[0]->buffers[1], first_values);
+    const int32_t* values =
+        reinterpret_cast<const int32_t*>(batch->children[0]->buffers[1]);
+    EXPECT_EQ(values[2], 2);
+  }
+
+  ASSERT_EQ(reader.Next(&batch, &error), NANOARROW_OK) << error.message;
+  EXPECT_EQ(batch, nullptr);
+}
+
+TEST(NanoarrowIpcHppTest, NanoarrowIpcHppTestBatchReaderRange) {
+  nanoarrow::UniqueBuffer data;
+  ASSERT_NO_FATAL_FAILURE(WriteBatches(data.get(), {1, 2, 3}));
+  nanoarrow::UniqueBuffer truncated;
+  ASSERT_EQ(ArrowBufferAppend(truncated.get(), data->data, data->size_bytes - 1),
+            NANOARROW_OK);
+
+  nanoarrow::ipc::BatchReader reader(MakeInput(data.get()));
+  struct ArrowError error;
+  auto batches = reader.Batches(&error);
+  std::vector<int64_t> lengths;
+  for (struct ArrowArray* batch : batches) {
+    lengths.push_back(batch->length);
+  }
+  EXPECT_EQ(batches.status(), NANOARROW_OK) << error.message;
+  EXPECT_EQ(lengths, std::vector<int64_t>({1, 2, 3}));
+
+  // Iteration stops at the first error
+  nanoarrow::ipc::BatchReader truncated_reader(MakeInput(truncated.get()));
+  auto truncated_batches = truncated_reader.Batches(&error);
+  lengths.clear();
+  for (struct ArrowArray* batch : truncated_batches) {
+    lengths.push_back(batch->length);
+  }
+  EXPECT_EQ(truncated_batches.status(), ESPIPE);
+  EXPECT_EQ(lengths, std::vector<int64_t>({1, 2}));
+
+  nanoarrow::UniqueBuffer empty;
+  nanoarrow::ipc::BatchReader empty_reader(MakeInput(empty.get()));
+  EXPECT_EQ(empty_reader.ReadSchema(&error), EINVAL);
+}
+
+#if defined(NANOARROW_IPC_HPP_HAVE_COROUTINES)
+// A coroutine that starts eagerly and is never awaited
+struct DetachedTask {
+  struct promise_type {
+    DetachedTask get_return_object() { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+template <typename Schedule>
+static DetachedTask SumLengthsAsync(nanoarrow::ipc::BatchReader* reader,
+                                    Schedule schedule, std::promise<int64_t>* result) {
+  struct ArrowError error;
+  struct ArrowArray* batch;
+  int64_t total = 0;
+  while (true) {
+    ArrowErrorCode code = co_await reader->NextAsync(schedule, &batch, &error);
+    if (code != NANOARROW_OK) {
+      result->set_value(-1);
+      co_return;
+    } else if (batch == nullptr) {
+      break;
+    }
+    total += batch->length;
+  }
+
+  result->set_value(total);
+}
+
+TEST(NanoarrowIpcHppTest, NanoarrowIpcHppTestBatchReaderAsync) {
+  nanoarrow::UniqueBuffer data;
+  ASSERT_NO_FATAL_FAILURE(WriteBatches(data.get(), {1, 2, 3}));
+  nanoarrow::ipc::BatchReader reader(MakeInput(data.get()));
+
+  // Each read runs (and resumes the coroutine) on a thread of its own
+  std::mutex threads_mutex;
+  std::vector<std::thread> threads;
+  auto schedule = [&](auto task) {
+    std::lock_guard<std::mutex> lock(threads_mutex);
+    threads.emplace_back(std::move(task));
+  };
+  std::promise<int64_t> result;
+  std::future<int64_t> total = result.get_future();
+  SumLengthsAsync(&reader, schedule, &result);
+  EXPECT_EQ(total.get(), 6);
+
+  // One read per batch and one that found the end of the stream
+  std::lock_guard<std::mutex> lock(threads_mutex);
+  ASSERT_EQ(threads.size(), 4);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+#endif
@@ -15,10 +15,41 @@
 // specific language governing permissions and limitations
 // under the License.
 
+// pread() and posix_fadvise() require _GNU_SOURCE on Linux
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include <errno.h>
 #include <stdio.h>
 #include <string.h>
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(NANOARROW_IPC_WITH_STATS) && defined(_WIN32)
+#include <windows.h>
+#elif defined(NANOARROW_IPC_WITH_STATS)
+#include <time.h>
+#endif
+
+// Shared rings require POSIX and C11 atomics that can be shared between processes
+// (detected as for NANOARROW_IPC_USE_STDATOMIC in nanoarrow_ipc_decoder.c)
+#if !defined(_WIN32) && defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && \
+    (defined(__clang__) || !defined(__GNUC__) || __GNUC__ >= 5) &&                  \
+    !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#include <time.h>
+#define NANOARROW_IPC_HAVE_SHARED_RING 1
+#else
+#define NANOARROW_IPC_HAVE_SHARED_RING 0
+#endif
+
 #include "nanoarrow.h"
 #include "nanoarrow_ipc.h"
 
@@ -28,65 +59,6 @@ void ArrowIpcInputStreamMove(struct ArrowIpcInputStream* src,
   src->release = NULL;
 }
 
-struct ArrowIpcInputStreamBufferPrivate {
-  struct ArrowBuffer input;
-  int64_t cursor_bytes;
-};
-
-static ArrowErrorCode ArrowIpcInputStreamBufferRead(struct ArrowIpcInputStream* stream,
-                                                    uint8_t* buf, int64_t buf_size_bytes,
-                                                    int64_t* size_read_out,
-                                                    struct ArrowError* error) {
-  if (buf_size_bytes == 0) {
-    *size_read_out = 0;
-    return NANOARROW_OK;
-  }
-
-  struct ArrowIpcInputStreamBufferPrivate* private_data =
-      (struct ArrowIpcInputStreamBufferPrivate*)stream->private_data;
-  int64_t bytes_remaining = private_data->input.size_bytes - private_data->cursor_bytes;
-  int64_t bytes_to_read;
-  if (bytes_remaining > buf_size_bytes) {
-    bytes_to_read = buf_size_bytes;
-  } else {
-    bytes_to_read = bytes_remaining;
-  }
-
-  if (bytes_to_read > 0) {
-    memcpy(buf, private_data->input.data + private_data->cursor_bytes, bytes_to_read);
-  }
-
-  *size_read_out = bytes_to_read;
-  private_data->cursor_bytes += bytes_to_read;
-  return NANOARROW_OK;
-}
-
-static void ArrowIpcInputStreamBufferRelease(struct ArrowIpcInputStream* stream) {
-  struct ArrowIpcInputStreamBufferPrivate* private_data =
-      (struct ArrowIpcInputStreamBufferPrivate*)stream->private_data;
-  ArrowBufferReset(&private_data->input);
-  ArrowFree(private_data);
-  stream->release = NULL;
-}
-
-ArrowErrorCode ArrowIpcInputStreamInitBuffer(struct ArrowIpcInputStream* stream,
-                                             struct ArrowBuffer* input) {
-  struct ArrowIpcInputStreamBufferPrivate* private_data =
-      (struct ArrowIpcInputStreamBufferPrivate*)ArrowMalloc(
-          sizeof(struct ArrowIpcInputStreamBufferPrivate));
-  if (private_data == NULL) {
-    return ENOMEM;
-  }
-
-  ArrowBufferMove(input, &private_data->input);
-  private_data->cursor_bytes = 0;
-  stream->read = &ArrowIpcInputStreamBufferRead;
-  stream->release = &ArrowIpcInputStreamBufferRelease;
-  stream->private_data = private_data;
-
-  return NANOARROW_OK;
-}
-
 struct ArrowIpcInputStreamFilePrivate {
   FILE* file_ptr;
   int stream_finished;
@@ -163,286 +135,2808 @@ ArrowErrorCode ArrowIpcInputStreamInitFile(struct ArrowIpcInputStream* stream,
   return NANOARROW_OK;
 }
 
-struct ArrowIpcArrayStreamReaderPrivate {
-  struct ArrowIpcInputStream input;
-  struct ArrowIpcDecoder decoder;
-  int use_shared_buffers;
-  struct ArrowSchema out_schema;
-  int64_t field_index;
-  struct ArrowBuffer header;
-  struct ArrowBuffer body;
-  struct ArrowError error;
-};
-
-static void ArrowIpcArrayStreamReaderRelease(struct ArrowArrayStream* stream) {
-  struct ArrowIpcArrayStreamReaderPrivate* private_data =
-      (struct ArrowIpcArrayStreamReaderPrivate*)stream->private_data;
+#if !defined(_WIN32)
 
-  if (private_data->input.release != NULL) {
-    private_data->input.release(&private_data->input);
-  }
+struct ArrowIpcInputStreamFileDescriptorPrivate {
+  int file_descriptor;
+  int close_on_release;
+  // Non-zero if file_descriptor supports pread(), in which case reads start at offset
+  int use_pread;
+  int64_t offset;
+  // Non-zero if file_descriptor is a socket, which is read with recv()
+  int is_socket;
+};
 
-  ArrowIpcDecoderReset(&private_data->decoder);
+static void ArrowIpcInputStreamFileDescriptorRelease(struct ArrowIpcInputStream* stream) {
+  struct ArrowIpcInputStreamFileDescriptorPrivate* private_data =
+      (struct ArrowIpcInputStreamFileDescriptorPrivate*)stream->private_data;
 
-  if (private_data->out_schema.release != NULL) {
-    private_data->out_schema.release(&private_data->out_schema);
+  if (private_data->close_on_release) {
+    close(private_data->file_descriptor);
   }
 
-  ArrowBufferReset(&private_data->header);
-  ArrowBufferReset(&private_data->body);
-
   ArrowFree(private_data);
   stream->release = NULL;
 }
 
-static int ArrowIpcArrayStreamReaderNextHeader(
-    struct ArrowIpcArrayStreamReaderPrivate* private_data,
-    enum ArrowIpcMessageType message_type) {
-  private_data->header.size_bytes = 0;
+static ArrowErrorCode ArrowIpcInputStreamFileDescriptorRead(
+    struct ArrowIpcInputStream* stream, uint8_t* buf, int64_t buf_size_bytes,
+    int64_t* size_read_out, struct ArrowError* error) {
+  struct ArrowIpcInputStreamFileDescriptorPrivate* private_data =
+      (struct ArrowIpcInputStreamFileDescriptorPrivate*)stream->private_data;
+
+  // Both pread() and read() may return fewer bytes than requested before the end of
+  // the file (e.g., for large requests or if interrupted by a signal)
   int64_t bytes_read = 0;
+  while (bytes_read < buf_size_bytes) {
+    ssize_t result;
+    if (private_data->use_pread) {
+      result = pread(private_data->file_descriptor, buf + bytes_read,
+                     (size_t)(buf_size_bytes - bytes_read), (off_t)private_data->offset);
+    } else if (private_data->is_socket) {
+      // MSG_WAITALL waits for the whole request instead of returning each segment
+      // as it arrives, such that a large body is usually received with one call
+      result = recv(private_data->file_descriptor, buf + bytes_read,
+                    (size_t)(buf_size_bytes - bytes_read), MSG_WAITALL);
+    } else {
+      result = read(private_data->file_descriptor, buf + bytes_read,
+                    (size_t)(buf_size_bytes - bytes_read));
+    }
 
-  // Read 8 bytes (continuation + header size in bytes)
-  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowBufferReserve(&private_data->header, 8),
-                                     &private_data->error);
-  NANOARROW_RETURN_NOT_OK(private_data->input.read(&private_data->input,
-                                                   private_data->header.data, 8,
-                                                   &bytes_read, &private_data->error));
-  private_data->header.size_bytes += bytes_read;
+    if (result < 0 && errno == EINTR) {
+      continue;
+    } else if (result < 0) {
+      int code = errno;
+      *size_read_out = bytes_read;
+      ArrowErrorSet(error, "ArrowIpcInputStreamFileDescriptor IO error: %s",
+                    strerror(code));
+      return code;
+    } else if (result == 0) {
+      break;
+    }
 
-  if (bytes_read == 0) {
-    // The caller might not use this error message (e.g., if the end of the stream
-    // is one of the valid outcomes) but we set the error anyway in case it gets
-    // propagated higher (e.g., if the stream is empty and there's no schema message)
-    ArrowErrorSet(&private_data->error, "No data available on stream");
-    return ENODATA;
-  } else if (bytes_read != 8) {
-    ArrowErrorSet(&private_data->error,
-                  "Expected at least 8 bytes in remainder of stream");
-    return EINVAL;
+    bytes_read += result;
+    private_data->offset += result;
   }
 
-  struct ArrowBufferView input_view;
-  input_view.data.data = private_data->header.data;
-  input_view.size_bytes = private_data->header.size_bytes;
+  *size_read_out = bytes_read;
+  return NANOARROW_OK;
+}
 
-  // Use PeekHeader to fill in decoder.header_size_bytes
-  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderPeekHeader(&private_data->decoder, input_view,
-                                                    &private_data->error));
+ArrowErrorCode ArrowIpcInputStreamInitFileDescriptor(struct ArrowIpcInputStream* stream,
+                                                     int file_descriptor,
+                                                     int close_on_release,
+                                                     struct ArrowError* error) {
+  struct stat file_stat;
+  if (fstat(file_descriptor, &file_stat) != 0) {
+    int result = errno;
+    ArrowErrorSet(error, "fstat() failed: %s", strerror(result));
+    return result;
+  }
 
-  // Read the header bytes
-  int64_t expected_header_bytes = private_data->decoder.header_size_bytes - 8;
-  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
-      ArrowBufferReserve(&private_data->header, expected_header_bytes),
-      &private_data->error);
-  NANOARROW_RETURN_NOT_OK(
-      private_data->input.read(&private_data->input, private_data->header.data + 8,
-                               expected_header_bytes, &bytes_read, &private_data->error));
-  private_data->header.size_bytes += bytes_read;
+  struct ArrowIpcInputStreamFileDescriptorPrivate* private_data =
+      (struct ArrowIpcInputStreamFileDescriptorPrivate*)ArrowMalloc(
+          sizeof(struct ArrowIpcInputStreamFileDescriptorPrivate));
+  if (private_data == NULL) {
+    ArrowErrorSet(error, "Failed to allocate ArrowIpcInputStreamFileDescriptorPrivate");
+    return ENOMEM;
+  }
 
-  // Verify + decode the header
-  input_view.data.data = private_data->header.data;
-  input_view.size_bytes = private_data->header.size_bytes;
-  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderVerifyHeader(&private_data->decoder, input_view,
-                                                      &private_data->error));
+  private_data->file_descriptor = file_descriptor;
+  private_data->close_on_release = close_on_release;
+  private_data->use_pread = S_ISREG(file_stat.st_mode);
+  private_data->offset = 0;
+  private_data->is_socket = S_ISSOCK(file_stat.st_mode);
+
+  if (private_data->use_pread) {
+    off_t offset = lseek(file_descriptor, 0, SEEK_CUR);
+    if (offset < 0) {
+      private_data->use_pread = 0;
+    } else {
+      private_data->offset = (int64_t)offset;
+    }
+  }
 
-  // Don't decode the message if it's of the wrong type (because the error message
-  // is better communicated by the caller)
-  if (private_data->decoder.message_type != message_type) {
-    return NANOARROW_OK;
+#if defined(POSIX_FADV_SEQUENTIAL)
+  // This is only a hint, so a failure here is not an error
+  if (private_data->use_pread) {
+    posix_fadvise(file_descriptor, (off_t)private_data->offset, 0,
+                  POSIX_FADV_SEQUENTIAL);
   }
+#endif
 
-  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeHeader(&private_data->decoder, input_view,
-                                                      &private_data->error));
+  stream->read = &ArrowIpcInputStreamFileDescriptorRead;
+  stream->release = &ArrowIpcInputStreamFileDescriptorRelease;
+  stream->private_data = private_data;
   return NANOARROW_OK;
 }
 
-static int ArrowIpcArrayStreamReaderNextBody(
-    struct ArrowIpcArrayStreamReaderPrivate* private_data) {
-  int64_t bytes_read;
-  int64_t bytes_to_read = private_data->decoder.body_size_bytes;
-
-  // Read the body bytes
-  private_data->body.size_bytes = 0;
-  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
-      ArrowBufferReserve(&private_data->body, bytes_to_read), &private_data->error);
-  NANOARROW_RETURN_NOT_OK(private_data->input.read(&private_data->input,
-                                                   private_data->body.data, bytes_to_read,
-                                                   &bytes_read, &private_data->error));
-  private_data->body.size_bytes += bytes_read;
-
-  if (bytes_read != bytes_to_read) {
-    ArrowErrorSet(&private_data->error,
-                  "Expected to be able to read %ld bytes for message body but got %ld",
-                  (long)bytes_to_read, bytes_read);
-    return ESPIPE;
-  } else {
-    return NANOARROW_OK;
+static void ArrowIpcMmapFree(struct ArrowBufferAllocator* allocator, uint8_t* ptr,
+                             int64_t size) {
+  // ptr may be an offset into the mapping, whose start and length are stored in the
+  // buffer when the mapping is created
+  struct ArrowBuffer* mapping = (struct ArrowBuffer*)allocator->private_data;
+  if (mapping->data != NULL) {
+    munmap(mapping->data, (size_t)mapping->size_bytes);
   }
+
+  ArrowFree(mapping);
 }
 
-static int ArrowIpcArrayStreamReaderReadSchemaIfNeeded(
-    struct ArrowIpcArrayStreamReaderPrivate* private_data) {
-  if (private_data->out_schema.release != NULL) {
-    return NANOARROW_OK;
+ArrowErrorCode ArrowIpcSharedBufferInitMmap(struct ArrowIpcSharedBuffer* shared,
+                                            int file_descriptor,
+                                            struct ArrowError* error) {
+  struct stat file_stat;
+  if (fstat(file_descriptor, &file_stat) != 0) {
+    int result = errno;
+    ArrowErrorSet(error, "fstat() failed: %s", strerror(result));
+    return result;
   }
 
-  NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderNextHeader(
-      private_data, NANOARROW_IPC_MESSAGE_TYPE_SCHEMA));
-
-  // Error if this isn't a schema message
-  if (private_data->decoder.message_type != NANOARROW_IPC_MESSAGE_TYPE_SCHEMA) {
-    ArrowErrorSet(&private_data->error,
-                  "Unexpected message type at start of input (expected Schema)");
-    return EINVAL;
+  // mmap() of zero bytes is an error, but an empty file is a valid (empty) buffer
+  struct ArrowBuffer src;
+  ArrowBufferInit(&src);
+  if (file_stat.st_size == 0) {
+    return ArrowIpcSharedBufferInit(shared, &src);
   }
 
-  // ...or if it uses features we don't support
-  if (private_data->decoder.feature_flags & NANOARROW_IPC_FEATURE_COMPRESSED_BODY) {
-    ArrowErrorSet(&private_data->error,
-                  "This stream uses unsupported feature COMPRESSED_BODY");
-    return EINVAL;
+  // Keep track of the mapping separately from the buffer that is shared
+  struct ArrowBuffer* mapping =
+      (struct ArrowBuffer*)ArrowMalloc(sizeof(struct ArrowBuffer));
+  if (mapping == NULL) {
+    ArrowErrorSet(error, "Failed to allocate mapping");
+    return ENOMEM;
   }
 
-  if (private_data->decoder.feature_flags &
-      NANOARROW_IPC_FEATURE_DICTIONARY_REPLACEMENT) {
-    ArrowErrorSet(&private_data->error,
-                  "This stream uses unsupported feature DICTIONARY_REPLACEMENT");
-    return EINVAL;
+  ArrowBufferInit(mapping);
+  void* data =
+      mmap(NULL, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+  if (data == MAP_FAILED) {
+    int result = errno;
+    ArrowFree(mapping);
+    ArrowErrorSet(error, "mmap() of %ld bytes failed: %s", (long)file_stat.st_size,
+                  strerror(result));
+    return result;
   }
 
-  // Notify the decoder of buffer endianness
-  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
-      ArrowIpcDecoderSetEndianness(&private_data->decoder,
-                                   private_data->decoder.endianness),
-      &private_data->error);
-
-  struct ArrowSchema tmp;
-  NANOARROW_RETURN_NOT_OK(
-      ArrowIpcDecoderDecodeSchema(&private_data->decoder, &tmp, &private_data->error));
-
-  // Only support "read the whole thing" for now
-  if (private_data->field_index != -1) {
-    tmp.release(&tmp);
-    ArrowErrorSet(&private_data->error, "Field index != -1 is not yet supported");
-    return ENOTSUP;
-  }
+  mapping->data = (uint8_t*)data;
+  mapping->size_bytes = (int64_t)file_stat.st_size;
+  src.data = mapping->data;
+  src.size_bytes = mapping->size_bytes;
+  src.capacity_bytes = mapping->size_bytes;
+  src.allocator = ArrowBufferDeallocator(&ArrowIpcMmapFree, mapping);
 
-  // Notify the decoder of the schema for forthcoming messages
-  int result =
-      ArrowIpcDecoderSetSchema(&private_data->decoder, &tmp, &private_data->error);
+  int result = ArrowIpcSharedBufferInit(shared, &src);
   if (result != NANOARROW_OK) {
-    tmp.release(&tmp);
+    ArrowBufferReset(&src);
+    ArrowErrorSet(error, "Failed to initialize shared buffer");
     return result;
   }
 
-  ArrowSchemaMove(&tmp, &private_data->out_schema);
   return NANOARROW_OK;
 }
 
-static int ArrowIpcArrayStreamReaderGetSchema(struct ArrowArrayStream* stream,
-                                              struct ArrowSchema* out) {
-  struct ArrowIpcArrayStreamReaderPrivate* private_data =
-      (struct ArrowIpcArrayStreamReaderPrivate*)stream->private_data;
-  private_data->error.message[0] = '\0';
-  NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderReadSchemaIfNeeded(private_data));
-  return ArrowSchemaDeepCopy(&private_data->out_schema, out);
-}
-
-static int ArrowIpcArrayStreamReaderGetNext(struct ArrowArrayStream* stream,
-                                            struct ArrowArray* out) {
-  struct ArrowIpcArrayStreamReaderPrivate* private_data =
-      (struct ArrowIpcArrayStreamReaderPrivate*)stream->private_data;
-  ArrowErrorInit(&private_data->error);
-  NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderReadSchemaIfNeeded(private_data));
+#else
 
-  // Read + decode the next header
-  int result = ArrowIpcArrayStreamReaderNextHeader(
-      private_data, NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH);
-  if (result == ENODATA) {
-    // Stream is finished either because there is no input or because
-    // end of stream bytes were read.
-    out->release = NULL;
-    return NANOARROW_OK;
-  } else if (result != NANOARROW_OK) {
-    // Other error
-    return result;
-  }
+ArrowErrorCode ArrowIpcSharedBufferInitMmap(struct ArrowIpcSharedBuffer* shared,
+                                            int file_descriptor,
+                                            struct ArrowError* error) {
+  ArrowErrorSet(error, "ArrowIpcSharedBufferInitMmap() is not supported on Windows");
+  return ENOTSUP;
+}
 
-  // Make sure we have a RecordBatch message
-  if (private_data->decoder.message_type != NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH) {
-    ArrowErrorSet(&private_data->error, "Unexpected message type (expected RecordBatch)");
-    return EINVAL;
-  }
+ArrowErrorCode ArrowIpcInputStreamInitFileDescriptor(struct ArrowIpcInputStream* stream,
+                                                     int file_descriptor,
+                                                     int close_on_release,
+                                                     struct ArrowError* error) {
+  ArrowErrorSet(error,
+                "ArrowIpcInputStreamInitFileDescriptor() is not supported on Windows");
+  return ENOTSUP;
+}
 
-  // Read in the body
-  NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderNextBody(private_data));
+#endif
 
-  struct ArrowArray tmp;
+struct ArrowIpcInputStreamMmapPrivate {
+  struct ArrowIpcSharedBuffer file;
+  int64_t cursor_bytes;
+};
 
-  if (private_data->use_shared_buffers) {
-    struct ArrowIpcSharedBuffer shared;
-    NANOARROW_RETURN_NOT_OK_WITH_ERROR(
-        ArrowIpcSharedBufferInit(&shared, &private_data->body), &private_data->error);
-    result = ArrowIpcDecoderDecodeArrayFromShared(
-        &private_data->decoder, &shared, private_data->field_index, &tmp,
-        NANOARROW_VALIDATION_LEVEL_FULL, &private_data->error);
-    ArrowIpcSharedBufferReset(&shared);
-    NANOARROW_RETURN_NOT_OK(result);
-  } else {
-    struct ArrowBufferView body_view;
-    body_view.data.data = private_data->body.data;
-    body_view.size_bytes = private_data->body.size_bytes;
+static ArrowErrorCode ArrowIpcInputStreamMmapRead(struct ArrowIpcInputStream* stream,
+                                                  uint8_t* buf, int64_t buf_size_bytes,
+                                                  int64_t* size_read_out,
+                                                  struct ArrowError* error) {
+  struct ArrowIpcInputStreamMmapPrivate* private_data =
+      (struct ArrowIpcInputStreamMmapPrivate*)stream->private_data;
+  int64_t bytes_remaining =
+      private_data->file.private_src.size_bytes - private_data->cursor_bytes;
+  int64_t bytes_to_read = bytes_remaining > buf_size_bytes ? buf_size_bytes
+                                                           : bytes_remaining;
 
-    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeArray(
-        &private_data->decoder, body_view, private_data->field_index, &tmp,
-        NANOARROW_VALIDATION_LEVEL_FULL, &private_data->error));
+  if (bytes_to_read > 0) {
+    memcpy(buf, private_data->file.private_src.data + private_data->cursor_bytes,
+           bytes_to_read);
   }
 
-  ArrowArrayMove(&tmp, out);
+  *size_read_out = bytes_to_read;
+  private_data->cursor_bytes += bytes_to_read;
   return NANOARROW_OK;
 }
 
-static const char* ArrowIpcArrayStreamReaderGetLastError(
-    struct ArrowArrayStream* stream) {
-  struct ArrowIpcArrayStreamReaderPrivate* private_data =
-      (struct ArrowIpcArrayStreamReaderPrivate*)stream->private_data;
-  return private_data->error.message;
+static void ArrowIpcInputStreamMmapRelease(struct ArrowIpcInputStream* stream) {
+  struct ArrowIpcInputStreamMmapPrivate* private_data =
+      (struct ArrowIpcInputStreamMmapPrivate*)stream->private_data;
+  ArrowIpcSharedBufferReset(&private_data->file);
+  ArrowFree(private_data);
+  stream->release = NULL;
 }
 
-ArrowErrorCode ArrowIpcArrayStreamReaderInit(
-    struct ArrowArrayStream* out, struct ArrowIpcInputStream* input_stream,
-    struct ArrowIpcArrayStreamReaderOptions* options) {
-  struct ArrowIpcArrayStreamReaderPrivate* private_data =
-      (struct ArrowIpcArrayStreamReaderPrivate*)ArrowMalloc(
-          sizeof(struct ArrowIpcArrayStreamReaderPrivate));
+// Buffers are wrapped in a shared buffer and read like a memory-mapped file such that
+// the ArrowArrayStream reader decodes messages in place (and, when using shared
+// buffers, returns arrays that reference input without copying)
+ArrowErrorCode ArrowIpcInputStreamInitBuffer(struct ArrowIpcInputStream* stream,
+                                             struct ArrowBuffer* input) {
+  struct ArrowIpcInputStreamMmapPrivate* private_data =
+      (struct ArrowIpcInputStreamMmapPrivate*)ArrowMalloc(
+          sizeof(struct ArrowIpcInputStreamMmapPrivate));
   if (private_data == NULL) {
     return ENOMEM;
   }
 
-  int result = ArrowIpcDecoderInit(&private_data->decoder);
+  int result = ArrowIpcSharedBufferInit(&private_data->file, input);
   if (result != NANOARROW_OK) {
     ArrowFree(private_data);
     return result;
   }
 
-  ArrowBufferInit(&private_data->header);
-  ArrowBufferInit(&private_data->body);
-  private_data->out_schema.release = NULL;
-  ArrowIpcInputStreamMove(input_stream, &private_data->input);
+  private_data->cursor_bytes = 0;
+  stream->read = &ArrowIpcInputStreamMmapRead;
+  stream->release = &ArrowIpcInputStreamMmapRelease;
+  stream->private_data = private_data;
+  return NANOARROW_OK;
+}
 
-  if (options != NULL) {
-    private_data->field_index = options->field_index;
-    private_data->use_shared_buffers = options->use_shared_buffers;
-  } else {
-    private_data->field_index = -1;
-    private_data->use_shared_buffers = ArrowIpcSharedBufferIsThreadSafe();
+ArrowErrorCode ArrowIpcInputStreamInitMmap(struct ArrowIpcInputStream* stream,
+                                           int file_descriptor,
+                                           struct ArrowError* error) {
+  struct ArrowIpcInputStreamMmapPrivate* private_data =
+      (struct ArrowIpcInputStreamMmapPrivate*)ArrowMalloc(
+          sizeof(struct ArrowIpcInputStreamMmapPrivate));
+  if (private_data == NULL) {
+    ArrowErrorSet(error, "Failed to allocate ArrowIpcInputStreamMmapPrivate");
+    return ENOMEM;
   }
 
-  out->private_data = private_data;
-  out->get_schema = &ArrowIpcArrayStreamReaderGetSchema;
-  out->get_next = &ArrowIpcArrayStreamReaderGetNext;
-  out->get_last_error = &ArrowIpcArrayStreamReaderGetLastError;
-  out->release = &ArrowIpcArrayStreamReaderRelease;
+  int result = ArrowIpcSharedBufferInitMmap(&private_data->file, file_descriptor, error);
+  if (result != NANOARROW_OK) {
+    ArrowFree(private_data);
+    return result;
+  }
 
-  return NANOARROW_OK;
+  private_data->cursor_bytes = 0;
+  stream->read = &ArrowIpcInputStreamMmapRead;
+  stream->release = &ArrowIpcInputStreamMmapRelease;
+  stream->private_data = private_data;
+  return NANOARROW_OK;
+}
+
+// Returns the offset of the next byte that stream will read, or -1 if stream cannot
+// be repositioned with ArrowIpcInputStreamSeek()
+static int64_t ArrowIpcInputStreamTell(struct ArrowIpcInputStream* stream) {
+  if (stream->read == &ArrowIpcInputStreamMmapRead) {
+    return ((struct ArrowIpcInputStreamMmapPrivate*)stream->private_data)->cursor_bytes;
+  }
+
+#if !defined(_WIN32)
+  if (stream->read == &ArrowIpcInputStreamFileDescriptorRead) {
+    struct ArrowIpcInputStreamFileDescriptorPrivate* private_data =
+        (struct ArrowIpcInputStreamFileDescriptorPrivate*)stream->private_data;
+    return private_data->use_pread ? private_data->offset : -1;
+  }
+#endif
+
+  if (stream->read == &ArrowIpcInputStreamFileRead) {
+    struct ArrowIpcInputStreamFilePrivate* private_data =
+        (struct ArrowIpcInputStreamFilePrivate*)stream->private_data;
+    if (private_data->file_ptr == NULL) {
+      return -1;
+    }
+
+    long offset = ftell(private_data->file_ptr);
+    return offset < 0 ? -1 : (int64_t)offset;
+  }
+
+  return -1;
+}
+
+// Repositions a stream for which ArrowIpcInputStreamTell() returned a valid offset
+// such that the next read starts at offset
+static int ArrowIpcInputStreamSeek(struct ArrowIpcInputStream* stream, int64_t offset,
+                                   struct ArrowError* error) {
+  if (stream->read == &ArrowIpcInputStreamMmapRead) {
+    struct ArrowIpcInputStreamMmapPrivate* private_data =
+        (struct ArrowIpcInputStreamMmapPrivate*)stream->private_data;
+    if (offset < 0 || offset > private_data->file.private_src.size_bytes) {
+      ArrowErrorSet(error, "Can't seek to offset %ld of a buffer of %ld bytes",
+                    (long)offset, (long)private_data->file.private_src.size_bytes);
+      return EINVAL;
+    }
+
+    private_data->cursor_bytes = offset;
+    return NANOARROW_OK;
+  }
+
+#if !defined(_WIN32)
+  if (stream->read == &ArrowIpcInputStreamFileDescriptorRead) {
+    struct ArrowIpcInputStreamFileDescriptorPrivate* private_data =
+        (struct ArrowIpcInputStreamFileDescriptorPrivate*)stream->private_data;
+    private_data->offset = offset;
+    return NANOARROW_OK;
+  }
+#endif
+
+  struct ArrowIpcInputStreamFilePrivate* private_data =
+      (struct ArrowIpcInputStreamFilePrivate*)stream->private_data;
+  if (private_data->file_ptr == NULL) {
+    ArrowErrorSet(error, "Can't seek a file that was closed at the end of the stream");
+    return ENOTSUP;
+  }
+
+  if (fseek(private_data->file_ptr, (long)offset, SEEK_SET) != 0) {
+    int result = errno;
+    ArrowErrorSet(error, "fseek() to offset %ld failed: %s", (long)offset,
+                  strerror(result));
+    return result;
+  }
+
+  private_data->stream_finished = 0;
+  return NANOARROW_OK;
+}
+
+#if NANOARROW_IPC_HAVE_SHARED_RING
+
+// A shared ring is a file (e.g., from shm_open() or memfd_create()) that begins with
+// a header of NANOARROW_IPC_SHARED_RING_ALIGNMENT bytes followed by capacity_bytes of
+// slots. Each write() to the output stream is copied into one contiguous slot whose
+// payload (like the ring itself) is aligned to NANOARROW_IPC_SHARED_RING_ALIGNMENT
+// bytes. A slot that does not fit before the end of the ring is preceded by a slot
+// with a size of -1 that pads the ring to its end.
+//
+// Positions are byte offsets that increase monotonically (i.e., the address of a
+// position is its remainder modulo capacity_bytes). The writer publishes slots by
+// advancing head. Each slot holds one reference for the reader's cursor and one for
+// each shared buffer that refers to its payload; the writer reuses the space of the
+// oldest slots once their reference counts reach zero, which allows arrays to
+// reference the ring without copying and to be released in any order.
+#define NANOARROW_IPC_SHARED_RING_ALIGNMENT 64
+
+static const char kArrowIpcSharedRingMagic[8] = {'N', 'A', 'R', 'I', 'N', 'G', '0', '1'};
+
+struct ArrowIpcSharedRingHeader {
+  char magic[8];
+  int64_t capacity_bytes;
+  atomic_llong head;
+  atomic_int writer_closed;
+  atomic_int reader_closed;
+};
+
+struct ArrowIpcSharedRingSlot {
+  int64_t size_bytes;
+  atomic_llong n_refs;
+};
+
+static struct ArrowIpcSharedRingSlot* ArrowIpcSharedRingSlotAt(
+    struct ArrowIpcSharedRingHeader* header, int64_t position) {
+  return (struct ArrowIpcSharedRingSlot*)((uint8_t*)header +
+                                          NANOARROW_IPC_SHARED_RING_ALIGNMENT +
+                                          position % header->capacity_bytes);
+}
+
+static uint8_t* ArrowIpcSharedRingSlotPayload(struct ArrowIpcSharedRingSlot* slot) {
+  return (uint8_t*)slot + NANOARROW_IPC_SHARED_RING_ALIGNMENT;
+}
+
+static int64_t ArrowIpcSharedRingRoundUp(int64_t size_bytes) {
+  return (size_bytes + NANOARROW_IPC_SHARED_RING_ALIGNMENT - 1) /
+         NANOARROW_IPC_SHARED_RING_ALIGNMENT * NANOARROW_IPC_SHARED_RING_ALIGNMENT;
+}
+
+// The number of bytes of the ring occupied by the slot at position
+static int64_t ArrowIpcSharedRingSlotSize(struct ArrowIpcSharedRingHeader* header,
+                                          int64_t position, int64_t size_bytes) {
+  if (size_bytes == -1) {
+    return header->capacity_bytes - position % header->capacity_bytes;
+  }
+
+  return NANOARROW_IPC_SHARED_RING_ALIGNMENT + ArrowIpcSharedRingRoundUp(size_bytes);
+}
+
+// Both ends of the ring poll the other while waiting for it
+static void ArrowIpcSharedRingWait(void) {
+  struct timespec duration;
+  duration.tv_sec = 0;
+  duration.tv_nsec = 50000;
+  nanosleep(&duration, NULL);
+}
+
+// The mapping of a shared ring by the input stream, which is kept alive by the stream
+// and by each shared buffer that refers to it
+struct ArrowIpcSharedRingMapping {
+  struct ArrowIpcSharedRingHeader* header;
+  int64_t size_bytes;
+  atomic_llong reference_count;
+};
+
+static void ArrowIpcSharedRingMappingRelease(struct ArrowIpcSharedRingMapping* mapping) {
+  if (atomic_fetch_sub(&mapping->reference_count, 1) == 1) {
+    munmap(mapping->header, (size_t)mapping->size_bytes);
+    ArrowFree(mapping);
+  }
+}
+
+struct ArrowIpcInputStreamSharedRingPrivate {
+  struct ArrowIpcSharedRingMapping* mapping;
+  // The current slot (which holds a reference for the cursor) or NULL if the cursor
+  // has not yet moved to the slot at position
+  struct ArrowIpcSharedRingSlot* slot;
+  int64_t position;
+  // The number of bytes of the current slot's payload that have been read
+  int64_t slot_offset;
+};
+
+// Releases the current slot (if any) and waits for the slot that follows it. Sets
+// slot to NULL when the writer has closed the ring and all slots have been read.
+static void ArrowIpcSharedRingInputNextSlot(
+    struct ArrowIpcInputStreamSharedRingPrivate* private_data) {
+  struct ArrowIpcSharedRingHeader* header = private_data->mapping->header;
+  if (private_data->slot != NULL) {
+    private_data->position += ArrowIpcSharedRingSlotSize(
+        header, private_data->position, private_data->slot->size_bytes);
+    atomic_fetch_sub_explicit(&private_data->slot->n_refs, 1, memory_order_release);
+    private_data->slot = NULL;
+  }
+
+  while (1) {
+    // Check for closing before head such that the last slots are not missed
+    int writer_closed =
+        atomic_load_explicit(&header->writer_closed, memory_order_acquire);
+    if (atomic_load_explicit(&header->head, memory_order_acquire) >
+        private_data->position) {
+      break;
+    } else if (writer_closed) {
+      return;
+    }
+
+    ArrowIpcSharedRingWait();
+  }
+
+  struct ArrowIpcSharedRingSlot* slot =
+      ArrowIpcSharedRingSlotAt(header, private_data->position);
+  if (slot->size_bytes == -1) {
+    private_data->slot = slot;
+    ArrowIpcSharedRingInputNextSlot(private_data);
+    return;
+  }
+
+  private_data->slot = slot;
+  private_data->slot_offset = 0;
+}
+
+static ArrowErrorCode ArrowIpcInputStreamSharedRingRead(
+    struct ArrowIpcInputStream* stream, uint8_t* buf, int64_t buf_size_bytes,
+    int64_t* size_read_out, struct ArrowError* error) {
+  struct ArrowIpcInputStreamSharedRingPrivate* private_data =
+      (struct ArrowIpcInputStreamSharedRingPrivate*)stream->private_data;
+
+  *size_read_out = 0;
+  while (*size_read_out < buf_size_bytes) {
+    if (private_data->slot == NULL ||
+        private_data->slot_offset == private_data->slot->size_bytes) {
+      ArrowIpcSharedRingInputNextSlot(private_data);
+      if (private_data->slot == NULL) {
+        break;
+      }
+
+      continue;
+    }
+
+    int64_t bytes_remaining = private_data->slot->size_bytes - private_data->slot_offset;
+    int64_t bytes_to_read = buf_size_bytes - *size_read_out;
+    if (bytes_to_read > bytes_remaining) {
+      bytes_to_read = bytes_remaining;
+    }
+
+    memcpy(buf + *size_read_out,
+           ArrowIpcSharedRingSlotPayload(private_data->slot) + private_data->slot_offset,
+           bytes_to_read);
+    private_data->slot_offset += bytes_to_read;
+    *size_read_out += bytes_to_read;
+  }
+
+  return NANOARROW_OK;
+}
+
+static void ArrowIpcInputStreamSharedRingRelease(struct ArrowIpcInputStream* stream) {
+  struct ArrowIpcInputStreamSharedRingPrivate* private_data =
+      (struct ArrowIpcInputStreamSharedRingPrivate*)stream->private_data;
+  struct ArrowIpcSharedRingMapping* mapping = private_data->mapping;
+  if (private_data->slot != NULL) {
+    atomic_fetch_sub_explicit(&private_data->slot->n_refs, 1, memory_order_release);
+  }
+
+  atomic_store_explicit(&mapping->header->reader_closed, 1, memory_order_release);
+  ArrowIpcSharedRingMappingRelease(mapping);
+  ArrowFree(private_data);
+  stream->release = NULL;
+}
+
+static struct ArrowIpcInputStreamSharedRingPrivate* ArrowIpcInputStreamSharedRing(
+    struct ArrowIpcInputStream* stream) {
+  if (stream->read != &ArrowIpcInputStreamSharedRingRead) {
+    return NULL;
+  }
+
+  return (struct ArrowIpcInputStreamSharedRingPrivate*)stream->private_data;
+}
+
+// Points view at the next n_bytes of the stream if they are in the payload of the
+// current slot, in which case view is valid until the next read(). Returns zero (and
+// leaves the stream untouched) otherwise.
+static int ArrowIpcInputStreamSharedRingView(
+    struct ArrowIpcInputStreamSharedRingPrivate* private_data, int64_t n_bytes,
+    struct ArrowBufferView* view) {
+  struct ArrowIpcSharedRingSlot* slot = private_data->slot;
+  if (slot == NULL || (slot->size_bytes - private_data->slot_offset) < n_bytes) {
+    return 0;
+  }
+
+  view->data.as_uint8 = ArrowIpcSharedRingSlotPayload(slot) + private_data->slot_offset;
+  view->size_bytes = n_bytes;
+  private_data->slot_offset += n_bytes;
+  return 1;
+}
+
+// A reference to a slot (and the mapping that contains it) held by a shared buffer
+struct ArrowIpcSharedRingReference {
+  struct ArrowIpcSharedRingMapping* mapping;
+  struct ArrowIpcSharedRingSlot* slot;
+};
+
+static void ArrowIpcSharedRingReferenceFree(struct ArrowBufferAllocator* allocator,
+                                            uint8_t* ptr, int64_t size) {
+  struct ArrowIpcSharedRingReference* reference =
+      (struct ArrowIpcSharedRingReference*)allocator->private_data;
+  atomic_fetch_sub_explicit(&reference->slot->n_refs, 1, memory_order_release);
+  ArrowIpcSharedRingMappingRelease(reference->mapping);
+  ArrowFree(reference);
+}
+
+// Initializes shared with a view returned by ArrowIpcInputStreamSharedRingView(),
+// which keeps its slot from being reused until shared (and every array that references
+// it) has been released
+static ArrowErrorCode ArrowIpcInputStreamSharedRingShare(
+    struct ArrowIpcInputStreamSharedRingPrivate* private_data,
+    struct ArrowBufferView view, struct ArrowIpcSharedBuffer* shared,
+    struct ArrowError* error) {
+  struct ArrowIpcSharedRingReference* reference =
+      (struct ArrowIpcSharedRingReference*)ArrowMalloc(
+          sizeof(struct ArrowIpcSharedRingReference));
+  if (reference == NULL) {
+    ArrowErrorSet(error, "Failed to allocate ArrowIpcSharedRingReference");
+    return ENOMEM;
+  }
+
+  reference->mapping = private_data->mapping;
+  reference->slot = private_data->slot;
+  atomic_fetch_add(&reference->mapping->reference_count, 1);
+  atomic_fetch_add_explicit(&reference->slot->n_refs, 1, memory_order_relaxed);
+
+  struct ArrowBuffer src;
+  ArrowBufferInit(&src);
+  src.data = (uint8_t*)view.data.data;
+  src.size_bytes = view.size_bytes;
+  src.capacity_bytes = view.size_bytes;
+  src.allocator = ArrowBufferDeallocator(&ArrowIpcSharedRingReferenceFree, reference);
+
+  int result = ArrowIpcSharedBufferInit(shared, &src);
+  if (result != NANOARROW_OK) {
+    ArrowBufferReset(&src);
+    ArrowErrorSet(error, "Failed to initialize shared buffer");
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcInputStreamInitSharedRing(struct ArrowIpcInputStream* stream,
+                                                 int file_descriptor,
+                                                 struct ArrowError* error) {
+  struct stat file_stat;
+  if (fstat(file_descriptor, &file_stat) != 0) {
+    ArrowErrorSet(error, "fstat() failed with errno %d: %s", errno, strerror(errno));
+    return errno;
+  }
+
+  int64_t size_bytes = (int64_t)file_stat.st_size;
+  if (size_bytes < (int64_t)sizeof(struct ArrowIpcSharedRingHeader)) {
+    ArrowErrorSet(error, "Expected shared ring of at least %ld bytes but got %ld bytes",
+                  (long)sizeof(struct ArrowIpcSharedRingHeader), (long)size_bytes);
+    return EINVAL;
+  }
+
+  void* addr = mmap(NULL, (size_t)size_bytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                    file_descriptor, 0);
+  if (addr == MAP_FAILED) {
+    ArrowErrorSet(error, "mmap() failed with errno %d: %s", errno, strerror(errno));
+    return errno;
+  }
+
+  struct ArrowIpcSharedRingHeader* header = (struct ArrowIpcSharedRingHeader*)addr;
+  if (memcmp(header->magic, kArrowIpcSharedRingMagic, sizeof(header->magic)) != 0 ||
+      header->capacity_bytes <= 0 ||
+      header->capacity_bytes > (size_bytes - NANOARROW_IPC_SHARED_RING_ALIGNMENT)) {
+    munmap(addr, (size_t)size_bytes);
+    ArrowErrorSet(error, "File descriptor does not refer to an initialized shared ring");
+    return EINVAL;
+  }
+
+  struct ArrowIpcSharedRingMapping* mapping =
+      (struct ArrowIpcSharedRingMapping*)ArrowMalloc(
+          sizeof(struct ArrowIpcSharedRingMapping));
+  struct ArrowIpcInputStreamSharedRingPrivate* private_data =
+      (struct ArrowIpcInputStreamSharedRingPrivate*)ArrowMalloc(
+          sizeof(struct ArrowIpcInputStreamSharedRingPrivate));
+  if (mapping == NULL || private_data == NULL) {
+    ArrowFree(mapping);
+    ArrowFree(private_data);
+    munmap(addr, (size_t)size_bytes);
+    ArrowErrorSet(error, "Failed to allocate ArrowIpcInputStreamSharedRingPrivate");
+    return ENOMEM;
+  }
+
+  mapping->header = header;
+  mapping->size_bytes = size_bytes;
+  atomic_init(&mapping->reference_count, 1);
+  private_data->mapping = mapping;
+  private_data->slot = NULL;
+  private_data->position = 0;
+  private_data->slot_offset = 0;
+
+  stream->read = &ArrowIpcInputStreamSharedRingRead;
+  stream->release = &ArrowIpcInputStreamSharedRingRelease;
+  stream->private_data = private_data;
+  return NANOARROW_OK;
+}
+
+// The writing end of the ring lives here with the reading end such that the layout of
+// the ring is defined once
+struct ArrowIpcOutputStreamSharedRingPrivate {
+  struct ArrowIpcSharedRingHeader* header;
+  int64_t size_bytes;
+  // The position after the last published slot
+  int64_t head;
+  // The position of the oldest slot whose space has not yet been reused
+  int64_t tail;
+};
+
+static void ArrowIpcOutputStreamSharedRingReclaim(
+    struct ArrowIpcOutputStreamSharedRingPrivate* private_data) {
+  while (private_data->tail < private_data->head) {
+    struct ArrowIpcSharedRingSlot* slot =
+        ArrowIpcSharedRingSlotAt(private_data->header, private_data->tail);
+    if (atomic_load_explicit(&slot->n_refs, memory_order_acquire) != 0) {
+      return;
+    }
+
+    private_data->tail += ArrowIpcSharedRingSlotSize(
+        private_data->header, private_data->tail, slot->size_bytes);
+  }
+}
+
+static ArrowErrorCode ArrowIpcOutputStreamSharedRingWrite(
+    struct ArrowIpcOutputStream* stream, const struct ArrowBufferView* buffers,
+    int64_t n_buffers, struct ArrowError* error) {
+  struct ArrowIpcOutputStreamSharedRingPrivate* private_data =
+      (struct ArrowIpcOutputStreamSharedRingPrivate*)stream->private_data;
+  struct ArrowIpcSharedRingHeader* header = private_data->header;
+
+  int64_t size_bytes = 0;
+  for (int64_t i = 0; i < n_buffers; i++) {
+    size_bytes += buffers[i].size_bytes;
+  }
+
+  int64_t slot_size = ArrowIpcSharedRingSlotSize(header, 0, size_bytes);
+  if (slot_size > header->capacity_bytes) {
+    ArrowErrorSet(error,
+                  "Can't write %ld bytes to shared ring with capacity of %ld bytes",
+                  (long)size_bytes, (long)header->capacity_bytes);
+    return EINVAL;
+  }
+
+  // Wait for the reader to release enough space, including any padding
+  int64_t bytes_before_end =
+      header->capacity_bytes - private_data->head % header->capacity_bytes;
+  int64_t bytes_needed = slot_size;
+  if (slot_size > bytes_before_end) {
+    bytes_needed += bytes_before_end;
+  }
+
+  while (1) {
+    ArrowIpcOutputStreamSharedRingReclaim(private_data);
+    int64_t bytes_used = private_data->head - private_data->tail;
+    int64_t bytes_free = header->capacity_bytes - bytes_used;
+    if (bytes_free >= bytes_needed) {
+      break;
+    } else if (atomic_load_explicit(&header->reader_closed, memory_order_acquire)) {
+      ArrowErrorSet(error, "Shared ring was closed by the reader");
+      return EPIPE;
+    }
+
+    ArrowIpcSharedRingWait();
+  }
+
+  struct ArrowIpcSharedRingSlot* slot;
+  if (slot_size > bytes_before_end) {
+    slot = ArrowIpcSharedRingSlotAt(header, private_data->head);
+    slot->size_bytes = -1;
+    atomic_store_explicit(&slot->n_refs, 1, memory_order_relaxed);
+    private_data->head += bytes_before_end;
+  }
+
+  slot = ArrowIpcSharedRingSlotAt(header, private_data->head);
+  slot->size_bytes = size_bytes;
+  atomic_store_explicit(&slot->n_refs, 1, memory_order_relaxed);
+  uint8_t* payload = ArrowIpcSharedRingSlotPayload(slot);
+  for (int64_t i = 0; i < n_buffers; i++) {
+    if (buffers[i].size_bytes > 0) {
+      memcpy(payload, buffers[i].data.data, buffers[i].size_bytes);
+      payload += buffers[i].size_bytes;
+    }
+  }
+
+  private_data->head += slot_size;
+  atomic_store_explicit(&header->head, private_data->head, memory_order_release);
+  return NANOARROW_OK;
+}
+
+static void ArrowIpcOutputStreamSharedRingRelease(struct ArrowIpcOutputStream* stream) {
+  struct ArrowIpcOutputStreamSharedRingPrivate* private_data =
+      (struct ArrowIpcOutputStreamSharedRingPrivate*)stream->private_data;
+  atomic_store_explicit(&private_data->header->writer_closed, 1, memory_order_release);
+  munmap(private_data->header, (size_t)private_data->size_bytes);
+  ArrowFree(private_data);
+  stream->release = NULL;
+}
+
+ArrowErrorCode ArrowIpcOutputStreamInitSharedRing(struct ArrowIpcOutputStream* stream,
+                                                  int file_descriptor,
+                                                  int64_t capacity_bytes,
+                                                  struct ArrowError* error) {
+  if (capacity_bytes <= 0) {
+    ArrowErrorSet(error, "Expected shared ring capacity > 0 but got %ld",
+                  (long)capacity_bytes);
+    return EINVAL;
+  }
+
+  capacity_bytes = ArrowIpcSharedRingRoundUp(capacity_bytes);
+  int64_t size_bytes = NANOARROW_IPC_SHARED_RING_ALIGNMENT + capacity_bytes;
+  if (ftruncate(file_descriptor, (off_t)size_bytes) != 0) {
+    ArrowErrorSet(error, "ftruncate() failed with errno %d: %s", errno, strerror(errno));
+    return errno;
+  }
+
+  void* addr = mmap(NULL, (size_t)size_bytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                    file_descriptor, 0);
+  if (addr == MAP_FAILED) {
+    ArrowErrorSet(error, "mmap() failed with errno %d: %s", errno, strerror(errno));
+    return errno;
+  }
+
+  struct ArrowIpcSharedRingHeader* header = (struct ArrowIpcSharedRingHeader*)addr;
+  if (!atomic_is_lock_free(&header->head) ||
+      !atomic_is_lock_free(&header->reader_closed)) {
+    munmap(addr, (size_t)size_bytes);
+    ArrowErrorSet(error, "Shared rings require lock-free atomics");
+    return ENOTSUP;
+  }
+
+  struct ArrowIpcOutputStreamSharedRingPrivate* private_data =
+      (struct ArrowIpcOutputStreamSharedRingPrivate*)ArrowMalloc(
+          sizeof(struct ArrowIpcOutputStreamSharedRingPrivate));
+  if (private_data == NULL) {
+    munmap(addr, (size_t)size_bytes);
+    ArrowErrorSet(error, "Failed to allocate ArrowIpcOutputStreamSharedRingPrivate");
+    return ENOMEM;
+  }
+
+  // The magic is written last such that a reader never sees a partial header
+  header->capacity_bytes = capacity_bytes;
+  atomic_init(&header->head, 0);
+  atomic_init(&header->writer_closed, 0);
+  atomic_init(&header->reader_closed, 0);
+  atomic_thread_fence(memory_order_release);
+  memcpy(header->magic, kArrowIpcSharedRingMagic, sizeof(header->magic));
+
+  private_data->header = header;
+  private_data->size_bytes = size_bytes;
+  private_data->head = 0;
+  private_data->tail = 0;
+
+  stream->write = &ArrowIpcOutputStreamSharedRingWrite;
+  stream->release = &ArrowIpcOutputStreamSharedRingRelease;
+  stream->private_data = private_data;
+  return NANOARROW_OK;
+}
+
+#else
+
+struct ArrowIpcInputStreamSharedRingPrivate;
+
+static struct ArrowIpcInputStreamSharedRingPrivate* ArrowIpcInputStreamSharedRing(
+    struct ArrowIpcInputStream* stream) {
+  return NULL;
+}
+
+static int ArrowIpcInputStreamSharedRingView(
+    struct ArrowIpcInputStreamSharedRingPrivate* private_data, int64_t n_bytes,
+    struct ArrowBufferView* view) {
+  return 0;
+}
+
+static ArrowErrorCode ArrowIpcInputStreamSharedRingShare(
+    struct ArrowIpcInputStreamSharedRingPrivate* private_data,
+    struct ArrowBufferView view, struct ArrowIpcSharedBuffer* shared,
+    struct ArrowError* error) {
+  return ENOTSUP;
+}
+
+ArrowErrorCode ArrowIpcInputStreamInitSharedRing(struct ArrowIpcInputStream* stream,
+                                                 int file_descriptor,
+                                                 struct ArrowError* error) {
+  ArrowErrorSet(error, "Shared rings require POSIX and C11 atomics");
+  return ENOTSUP;
+}
+
+ArrowErrorCode ArrowIpcOutputStreamInitSharedRing(struct ArrowIpcOutputStream* stream,
+                                                  int file_descriptor,
+                                                  int64_t capacity_bytes,
+                                                  struct ArrowError* error) {
+  ArrowErrorSet(error, "Shared rings require POSIX and C11 atomics");
+  return ENOTSUP;
+}
+
+#endif
+
+void ArrowIpcMessageIndexInit(struct ArrowIpcMessageIndex* index) {
+  ArrowBufferInit(&index->entries);
+  index->n_entries = 0;
+  index->n_record_batches = 0;
+}
+
+void ArrowIpcMessageIndexReset(struct ArrowIpcMessageIndex* index) {
+  ArrowBufferReset(&index->entries);
+  index->n_entries = 0;
+  index->n_record_batches = 0;
+}
+
+static ArrowErrorCode ArrowIpcMessageIndexAppend(
+    struct ArrowIpcMessageIndex* index, const struct ArrowIpcMessageIndexEntry* entry) {
+  NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(&index->entries, entry,
+                                            sizeof(struct ArrowIpcMessageIndexEntry)));
+  index->n_entries++;
+  if (entry->message_type == NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH) {
+    index->n_record_batches++;
+  }
+
+  return NANOARROW_OK;
+}
+
+static const char kArrowIpcMessageIndexMagic[8] = {'N', 'A', 'I', 'D',
+                                                   'X', '0', '0', '1'};
+
+// The number of 64-bit fields written for each entry of a serialized index
+#define NANOARROW_IPC_MESSAGE_INDEX_ENTRY_FIELDS 6
+
+static void ArrowIpcMessageIndexWriteInt64(uint8_t* dst, int64_t value) {
+  for (int i = 0; i < 8; i++) {
+    dst[i] = (uint8_t)(((uint64_t)value >> (8 * i)) & 0xFF);
+  }
+}
+
+static int64_t ArrowIpcMessageIndexReadInt64(const uint8_t* src) {
+  uint64_t value = 0;
+  for (int i = 0; i < 8; i++) {
+    value |= (uint64_t)src[i] << (8 * i);
+  }
+  return (int64_t)value;
+}
+
+ArrowErrorCode ArrowIpcMessageIndexSerialize(const struct ArrowIpcMessageIndex* index,
+                                             struct ArrowBuffer* out,
+                                             struct ArrowError* error) {
+  int64_t size_bytes =
+      16 + index->n_entries * NANOARROW_IPC_MESSAGE_INDEX_ENTRY_FIELDS * 8;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowBufferReserve(out, size_bytes), error);
+
+  uint8_t* dst = out->data + out->size_bytes;
+  memcpy(dst, kArrowIpcMessageIndexMagic, sizeof(kArrowIpcMessageIndexMagic));
+  ArrowIpcMessageIndexWriteInt64(dst + 8, index->n_entries);
+  dst += 16;
+
+  const struct ArrowIpcMessageIndexEntry* entries =
+      (const struct ArrowIpcMessageIndexEntry*)index->entries.data;
+  for (int64_t i = 0; i < index->n_entries; i++) {
+    ArrowIpcMessageIndexWriteInt64(dst, entries[i].message_type);
+    ArrowIpcMessageIndexWriteInt64(dst + 8, entries[i].message_index);
+    ArrowIpcMessageIndexWriteInt64(dst + 16, entries[i].offset);
+    ArrowIpcMessageIndexWriteInt64(dst + 24, entries[i].length);
+    ArrowIpcMessageIndexWriteInt64(dst + 32, entries[i].dictionary_id);
+    ArrowIpcMessageIndexWriteInt64(dst + 40, entries[i].dictionary_is_delta);
+    dst += NANOARROW_IPC_MESSAGE_INDEX_ENTRY_FIELDS * 8;
+  }
+
+  out->size_bytes += size_bytes;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcMessageIndexDeserialize(struct ArrowIpcMessageIndex* index,
+                                               struct ArrowBufferView data,
+                                               struct ArrowError* error) {
+  if (data.size_bytes < 16 || memcmp(data.data.as_uint8, kArrowIpcMessageIndexMagic,
+                                     sizeof(kArrowIpcMessageIndexMagic)) != 0) {
+    ArrowErrorSet(error, "Expected message index to start with magic bytes 'NAIDX001'");
+    return EINVAL;
+  }
+
+  int64_t n_entries = ArrowIpcMessageIndexReadInt64(data.data.as_uint8 + 8);
+  int64_t entry_size_bytes = NANOARROW_IPC_MESSAGE_INDEX_ENTRY_FIELDS * 8;
+  if (n_entries < 0 || n_entries > (data.size_bytes - 16) / entry_size_bytes) {
+    ArrowErrorSet(error, "Message index with %ld entries does not fit in %ld bytes",
+                  (long)n_entries, (long)data.size_bytes);
+    return EINVAL;
+  }
+
+  struct ArrowIpcMessageIndex tmp;
+  ArrowIpcMessageIndexInit(&tmp);
+  int result = ArrowBufferReserve(&tmp.entries,
+                                  n_entries * sizeof(struct ArrowIpcMessageIndexEntry));
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "Failed to allocate %ld message index entries",
+                  (long)n_entries);
+    return result;
+  }
+
+  const uint8_t* src = data.data.as_uint8 + 16;
+  for (int64_t i = 0; i < n_entries; i++, src += entry_size_bytes) {
+    struct ArrowIpcMessageIndexEntry entry;
+    int64_t message_type = ArrowIpcMessageIndexReadInt64(src);
+    entry.message_index = ArrowIpcMessageIndexReadInt64(src + 8);
+    entry.offset = ArrowIpcMessageIndexReadInt64(src + 16);
+    entry.length = ArrowIpcMessageIndexReadInt64(src + 24);
+    entry.dictionary_id = ArrowIpcMessageIndexReadInt64(src + 32);
+    entry.dictionary_is_delta = ArrowIpcMessageIndexReadInt64(src + 40) != 0;
+
+    const struct ArrowIpcMessageIndexEntry* prev =
+        i > 0 ? ((const struct ArrowIpcMessageIndexEntry*)tmp.entries.data) + i - 1
+              : NULL;
+    if ((message_type != NANOARROW_IPC_MESSAGE_TYPE_SCHEMA &&
+         message_type != NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH &&
+         message_type != NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH) ||
+        entry.message_index < 0 || entry.offset < 0 || entry.length < 0 ||
+        (prev != NULL && (entry.message_index <= prev->message_index ||
+                          entry.offset <= prev->offset))) {
+      ArrowIpcMessageIndexReset(&tmp);
+      ArrowErrorSet(error, "Message index entry %ld is invalid or out of order",
+                    (long)i);
+      return EINVAL;
+    }
+
+    // Can't fail because the entries were reserved above
+    entry.message_type = (enum ArrowIpcMessageType)message_type;
+    ArrowIpcMessageIndexAppend(&tmp, &entry);
+  }
+
+  ArrowIpcMessageIndexReset(index);
+  ArrowBufferMove(&tmp.entries, &index->entries);
+  index->n_entries = tmp.n_entries;
+  index->n_record_batches = tmp.n_record_batches;
+  return NANOARROW_OK;
+}
+
+void ArrowIpcArrayStreamReaderOptionsInit(
+    struct ArrowIpcArrayStreamReaderOptions* options) {
+  options->field_index = -1;
+  options->use_shared_buffers = ArrowIpcSharedBufferIsThreadSafe();
+  options->field_paths = NULL;
+  options->n_field_paths = 0;
+  options->executor = NULL;
+  options->batch_readahead = 8;
+  options->verification_level = NANOARROW_IPC_VERIFICATION_LEVEL_FULL;
+  options->read_ahead_bytes = 0;
+  options->schema_cache = NULL;
+  options->shared_buffer_copy_threshold_bytes = 0;
+  options->copy_body = NULL;
+  options->copy_body_private_data = NULL;
+  options->body_alignment = 64;
+  options->body_allocator = NULL;
+  options->message_index = NULL;
+  options->defer_validation = 0;
+}
+
+// Returns the allocator requested by options for message bodies read into memory
+static struct ArrowBufferAllocator ArrowIpcBodyAllocator(
+    const struct ArrowIpcArrayStreamReaderOptions* options) {
+  if (options == NULL) {
+    return ArrowBufferAllocatorAligned(64);
+  } else if (options->body_allocator != NULL) {
+    return *options->body_allocator;
+  } else if (options->body_alignment > 0) {
+    return ArrowBufferAllocatorAligned(options->body_alignment);
+  } else {
+    return ArrowBufferAllocatorDefault();
+  }
+}
+
+// A copy of ArrowIpcArrayStreamReaderOptions::field_paths, which are used when the
+// Schema message is read
+struct ArrowIpcFieldPaths {
+  int64_t n_paths;
+  // The struct ArrowStringView of each path, which point into data
+  struct ArrowBuffer paths;
+  struct ArrowBuffer data;
+};
+
+static void ArrowIpcFieldPathsReset(struct ArrowIpcFieldPaths* field_paths) {
+  ArrowBufferReset(&field_paths->paths);
+  ArrowBufferReset(&field_paths->data);
+  field_paths->n_paths = 0;
+}
+
+static int ArrowIpcFieldPathsInit(struct ArrowIpcFieldPaths* field_paths,
+                                  struct ArrowIpcArrayStreamReaderOptions* options) {
+  field_paths->n_paths = 0;
+  ArrowBufferInit(&field_paths->paths);
+  ArrowBufferInit(&field_paths->data);
+  if (options == NULL || options->n_field_paths <= 0) {
+    return NANOARROW_OK;
+  }
+
+  if (options->field_index != -1) {
+    return EINVAL;
+  }
+
+  // Copy all data before computing views such that they are not invalidated by
+  // reallocation
+  for (int64_t i = 0; i < options->n_field_paths; i++) {
+    struct ArrowStringView path = options->field_paths[i];
+    NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(&field_paths->data, path.data,
+                                              path.size_bytes));
+  }
+
+  int64_t offset = 0;
+  for (int64_t i = 0; i < options->n_field_paths; i++) {
+    struct ArrowStringView path;
+    path.data = (const char*)field_paths->data.data + offset;
+    path.size_bytes = options->field_paths[i].size_bytes;
+    offset += path.size_bytes;
+    NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(&field_paths->paths, &path, sizeof(path)));
+  }
+
+  field_paths->n_paths = options->n_field_paths;
+  return NANOARROW_OK;
+}
+
+// A RecordBatch message read ahead by a stream reader with an executor. Each task has
+// its own decoder (and copy of the header referenced by that decoder) such that tasks
+// can be decoded concurrently.
+struct ArrowIpcArrayStreamReaderTask {
+  struct ArrowIpcDecoder decoder;
+  struct ArrowBuffer header;
+  struct ArrowBuffer body;
+  struct ArrowBufferView body_view;
+  struct ArrowIpcSharedBuffer shared;
+  struct ArrowArray array;
+  int result;
+  struct ArrowError error;
+};
+
+struct ArrowIpcArrayStreamReaderPrivate {
+  struct ArrowIpcInputStream input;
+  struct ArrowIpcDecoder decoder;
+  int use_shared_buffers;
+  int64_t shared_buffer_copy_threshold_bytes;
+  // If copy_body is non-NULL, bodies are copied to device memory before decoding. In
+  // that case or if validation is deferred, arrays are validated at validation_level
+  // (MINIMAL, which is otherwise FULL)
+  ArrowErrorCode (*copy_body)(void* private_data, struct ArrowBufferView body,
+                              struct ArrowBuffer* out, struct ArrowError* error);
+  void* copy_body_private_data;
+  enum ArrowValidationLevel validation_level;
+  struct ArrowSchema out_schema;
+  int64_t field_index;
+  struct ArrowIpcFieldPaths field_paths;
+  struct ArrowBuffer header;
+  // Bodies are read into body, which is (re)allocated using body_allocator
+  struct ArrowBuffer body;
+  struct ArrowBufferAllocator body_allocator;
+  // Non-NULL if input is a buffer or memory-mapped stream, whose messages are decoded
+  // in place
+  struct ArrowIpcInputStreamMmapPrivate* mmap_input;
+  // Non-NULL if input is a shared ring, whose bodies are shared in place if
+  // use_shared_buffers is set. body_in_ring is non-zero if body_view points into it.
+  struct ArrowIpcInputStreamSharedRingPrivate* ring_input;
+  int body_in_ring;
+  struct ArrowBufferView header_view;
+  struct ArrowBufferView body_view;
+  struct ArrowError error;
+
+  // The number of bytes and messages consumed since the start of the stream, which
+  // began at offset input_start of input (or -1 if input is not seekable). If
+  // message_index is non-NULL, the location of each message is appended to it.
+  int64_t position;
+  int64_t n_messages;
+  int64_t input_start;
+  struct ArrowIpcMessageIndex* message_index;
+
+  // If read_ahead_bytes is greater than zero, input is read into read_ahead in
+  // requests of read_ahead_bytes and bytes in [read_ahead_offset,
+  // read_ahead.size_bytes) have been read from input but not yet consumed
+  int64_t read_ahead_bytes;
+  struct ArrowBuffer read_ahead;
+  int64_t read_ahead_offset;
+
+  // If executor is non-NULL, up to n_tasks RecordBatch messages are read and then
+  // decoded together. Tasks in [next_task, n_tasks_ready) have been decoded but not
+  // yet returned. A read error that occurs after some tasks were read is returned
+  // once those tasks have been returned.
+  struct ArrowExecutor* executor;
+  struct ArrowIpcArrayStreamReaderTask* tasks;
+  int64_t n_tasks;
+  int64_t n_tasks_ready;
+  int64_t next_task;
+  int pending_dictionary;
+  int finished;
+  int read_result;
+  struct ArrowError read_error;
+
+#if defined(NANOARROW_IPC_WITH_STATS)
+  // The read counters and timer returned by ArrowIpcArrayStreamReaderGetStats()
+  struct ArrowIpcStats stats;
+#endif
+};
+
+static void ArrowIpcArrayStreamReaderResetTasks(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data) {
+  if (private_data->tasks == NULL) {
+    return;
+  }
+
+  for (int64_t i = 0; i < private_data->n_tasks; i++) {
+    struct ArrowIpcArrayStreamReaderTask* task = private_data->tasks + i;
+    ArrowIpcDecoderReset(&task->decoder);
+    ArrowBufferReset(&task->header);
+    ArrowBufferReset(&task->body);
+    if (task->array.release != NULL) {
+      task->array.release(&task->array);
+    }
+  }
+
+  ArrowFree(private_data->tasks);
+  private_data->tasks = NULL;
+}
+
+static void ArrowIpcArrayStreamReaderRelease(struct ArrowArrayStream* stream) {
+  struct ArrowIpcArrayStreamReaderPrivate* private_data =
+      (struct ArrowIpcArrayStreamReaderPrivate*)stream->private_data;
+
+  if (private_data->input.release != NULL) {
+    private_data->input.release(&private_data->input);
+  }
+
+  ArrowIpcDecoderReset(&private_data->decoder);
+
+  if (private_data->out_schema.release != NULL) {
+    private_data->out_schema.release(&private_data->out_schema);
+  }
+
+  ArrowBufferReset(&private_data->header);
+  ArrowBufferReset(&private_data->body);
+  ArrowBufferReset(&private_data->read_ahead);
+  ArrowIpcFieldPathsReset(&private_data->field_paths);
+  ArrowIpcArrayStreamReaderResetTasks(private_data);
+
+  ArrowFree(private_data);
+  stream->release = NULL;
+}
+
+#if defined(NANOARROW_IPC_WITH_STATS)
+static int64_t ArrowIpcArrayStreamReaderNowNs(void) {
+#if defined(_WIN32)
+  LARGE_INTEGER frequency;
+  LARGE_INTEGER counter;
+  QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&counter);
+  return (int64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (int64_t)now.tv_sec * 1000000000 + (int64_t)now.tv_nsec;
+#endif
+}
+#endif
+
+// Calls input.read(), counting and timing the read if statistics are enabled
+static int ArrowIpcArrayStreamReaderReadInput(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data, uint8_t* buf,
+    int64_t buf_size_bytes, int64_t* size_read_out) {
+#if defined(NANOARROW_IPC_WITH_STATS)
+  int64_t start = ArrowIpcArrayStreamReaderNowNs();
+  int result = private_data->input.read(&private_data->input, buf, buf_size_bytes,
+                                        size_read_out, &private_data->error);
+  private_data->stats.read_ns += ArrowIpcArrayStreamReaderNowNs() - start;
+  private_data->stats.n_reads++;
+  if (result == NANOARROW_OK) {
+    private_data->stats.n_bytes_read += *size_read_out;
+  }
+  return result;
+#else
+  return private_data->input.read(&private_data->input, buf, buf_size_bytes,
+                                  size_read_out, &private_data->error);
+#endif
+}
+
+// Reads up to buf_size_bytes from the input into buf, serving bytes from (and
+// refilling) the read-ahead window if one was requested. Reads that would not fit
+// in the window bypass it so that large message bodies are not copied twice.
+static int ArrowIpcArrayStreamReaderRead(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data, uint8_t* buf,
+    int64_t buf_size_bytes, int64_t* size_read_out) {
+  if (private_data->read_ahead_bytes <= 0) {
+    return ArrowIpcArrayStreamReaderReadInput(private_data, buf, buf_size_bytes,
+                                              size_read_out);
+  }
+
+  struct ArrowBuffer* read_ahead = &private_data->read_ahead;
+  int64_t bytes_buffered = read_ahead->size_bytes - private_data->read_ahead_offset;
+  if (bytes_buffered >= buf_size_bytes) {
+    memcpy(buf, read_ahead->data + private_data->read_ahead_offset, buf_size_bytes);
+    private_data->read_ahead_offset += buf_size_bytes;
+    *size_read_out = buf_size_bytes;
+    return NANOARROW_OK;
+  }
+
+  if (bytes_buffered > 0) {
+    memcpy(buf, read_ahead->data + private_data->read_ahead_offset, bytes_buffered);
+  }
+  read_ahead->size_bytes = 0;
+  private_data->read_ahead_offset = 0;
+
+  int64_t bytes_remaining = buf_size_bytes - bytes_buffered;
+  int64_t bytes_read = 0;
+  if (bytes_remaining >= private_data->read_ahead_bytes) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderReadInput(
+        private_data, buf + bytes_buffered, bytes_remaining, &bytes_read));
+    *size_read_out = bytes_buffered + bytes_read;
+    return NANOARROW_OK;
+  }
+
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferReserve(read_ahead, private_data->read_ahead_bytes),
+      &private_data->error);
+  NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderReadInput(
+      private_data, read_ahead->data, private_data->read_ahead_bytes, &bytes_read));
+  read_ahead->size_bytes = bytes_read;
+
+  if (bytes_read < bytes_remaining) {
+    bytes_remaining = bytes_read;
+  }
+
+  memcpy(buf + bytes_buffered, read_ahead->data, bytes_remaining);
+  private_data->read_ahead_offset = bytes_remaining;
+  *size_read_out = bytes_buffered + bytes_remaining;
+  return NANOARROW_OK;
+}
+
+// Reads the next encapsulated message header into private_data->header
+static int ArrowIpcArrayStreamReaderReadHeader(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data,
+    struct ArrowBufferView* input_view) {
+  private_data->header.size_bytes = 0;
+  int64_t bytes_read = 0;
+
+  // Read 8 bytes (continuation + header size in bytes)
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowBufferReserve(&private_data->header, 8),
+                                     &private_data->error);
+  NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderRead(
+      private_data, private_data->header.data, 8, &bytes_read));
+  private_data->header.size_bytes += bytes_read;
+  private_data->position += bytes_read;
+
+  if (bytes_read == 0) {
+    // The caller might not use this error message (e.g., if the end of the stream
+    // is one of the valid outcomes) but we set the error anyway in case it gets
+    // propagated higher (e.g., if the stream is empty and there's no schema message)
+    ArrowErrorSet(&private_data->error, "No data available on stream");
+    return ENODATA;
+  } else if (bytes_read != 8) {
+    ArrowErrorSet(&private_data->error,
+                  "Expected at least 8 bytes in remainder of stream");
+    return EINVAL;
+  }
+
+  input_view->data.data = private_data->header.data;
+  input_view->size_bytes = private_data->header.size_bytes;
+
+  // Use PeekHeader to fill in decoder.header_size_bytes
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderPeekHeader(&private_data->decoder, *input_view,
+                                                    &private_data->error));
+
+  // Read the header bytes
+  int64_t expected_header_bytes = private_data->decoder.header_size_bytes - 8;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferReserve(&private_data->header, expected_header_bytes),
+      &private_data->error);
+  NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderRead(
+      private_data, private_data->header.data + 8, expected_header_bytes, &bytes_read));
+  private_data->header.size_bytes += bytes_read;
+  private_data->position += bytes_read;
+
+  input_view->data.data = private_data->header.data;
+  input_view->size_bytes = private_data->header.size_bytes;
+  return NANOARROW_OK;
+}
+
+// Counts size_bytes that were mapped from the input without calling read() as a read
+// if statistics are enabled
+static void ArrowIpcArrayStreamReaderCountMapped(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data, int64_t size_bytes) {
+#if defined(NANOARROW_IPC_WITH_STATS)
+  private_data->stats.n_reads++;
+  private_data->stats.n_bytes_read += size_bytes;
+#else
+  (void)private_data;
+  (void)size_bytes;
+#endif
+}
+
+// Points input_view at the next encapsulated message header in the mapping
+static int ArrowIpcArrayStreamReaderMapHeader(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data,
+    struct ArrowBufferView* input_view) {
+  struct ArrowIpcInputStreamMmapPrivate* input = private_data->mmap_input;
+  int64_t bytes_remaining = input->file.private_src.size_bytes - input->cursor_bytes;
+
+  if (bytes_remaining == 0) {
+    ArrowErrorSet(&private_data->error, "No data available on stream");
+    return ENODATA;
+  } else if (bytes_remaining < 8) {
+    ArrowErrorSet(&private_data->error,
+                  "Expected at least 8 bytes in remainder of stream");
+    return EINVAL;
+  }
+
+  input_view->data.as_uint8 = input->file.private_src.data + input->cursor_bytes;
+  input_view->size_bytes = bytes_remaining;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderPeekHeader(&private_data->decoder, *input_view,
+                                                    &private_data->error));
+
+  // Verification will fail below if the header is larger than the remaining bytes
+  if (private_data->decoder.header_size_bytes < bytes_remaining) {
+    input_view->size_bytes = private_data->decoder.header_size_bytes;
+  }
+
+  input->cursor_bytes += input_view->size_bytes;
+  private_data->position += input_view->size_bytes;
+  ArrowIpcArrayStreamReaderCountMapped(private_data, input_view->size_bytes);
+  return NANOARROW_OK;
+}
+
+// Appends the location of the message whose header was just decoded (which started at
+// offset) to the message index unless it was already recorded
+static int ArrowIpcArrayStreamReaderIndexMessage(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data, int64_t offset) {
+  int64_t message_index = private_data->n_messages++;
+  struct ArrowIpcMessageIndex* index = private_data->message_index;
+  if (index == NULL) {
+    return NANOARROW_OK;
+  }
+
+  if (index->n_entries > 0) {
+    const struct ArrowIpcMessageIndexEntry* last =
+        ((const struct ArrowIpcMessageIndexEntry*)index->entries.data) +
+        index->n_entries - 1;
+    if (last->message_index >= message_index) {
+      return NANOARROW_OK;
+    }
+  }
+
+  struct ArrowIpcDecoder* decoder = &private_data->decoder;
+  struct ArrowIpcMessageIndexEntry entry;
+  entry.message_type = decoder->message_type;
+  entry.message_index = message_index;
+  entry.offset = offset;
+  entry.length = 0;
+  entry.dictionary_id = -1;
+  entry.dictionary_is_delta = 0;
+
+  if (decoder->message_type == NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH) {
+    struct ArrowIpcRecordBatchSizes sizes;
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcDecoderDecodeRecordBatchSizes(decoder, &sizes, &private_data->error));
+    entry.length = sizes.length;
+  } else if (decoder->message_type == NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH) {
+    entry.dictionary_id = decoder->dictionary_id;
+    entry.dictionary_is_delta = decoder->dictionary_is_delta;
+  }
+
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowIpcMessageIndexAppend(index, &entry),
+                                     &private_data->error);
+  return NANOARROW_OK;
+}
+
+static int ArrowIpcArrayStreamReaderNextHeader(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data,
+    enum ArrowIpcMessageType message_type) {
+  int64_t offset = private_data->position;
+  struct ArrowBufferView input_view;
+  if (private_data->mmap_input != NULL) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcArrayStreamReaderMapHeader(private_data, &input_view));
+  } else {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcArrayStreamReaderReadHeader(private_data, &input_view));
+  }
+
+  // Verify + decode the header
+  private_data->header_view = input_view;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderVerifyHeader(&private_data->decoder, input_view,
+                                                      &private_data->error));
+
+  // Don't decode the message if it's of the wrong type (because the error message
+  // is better communicated by the caller). DictionaryBatch messages may precede
+  // any RecordBatch message.
+  enum ArrowIpcMessageType actual_type = private_data->decoder.message_type;
+  if (actual_type != message_type &&
+      !(message_type == NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH &&
+        actual_type == NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH)) {
+    return NANOARROW_OK;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeHeader(&private_data->decoder, input_view,
+                                                      &private_data->error));
+  return ArrowIpcArrayStreamReaderIndexMessage(private_data, offset);
+}
+
+static int ArrowIpcArrayStreamReaderNextBody(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data) {
+  int64_t bytes_read;
+  int64_t bytes_to_read = private_data->decoder.body_size_bytes;
+
+  if (private_data->mmap_input != NULL) {
+    struct ArrowIpcInputStreamMmapPrivate* input = private_data->mmap_input;
+    int64_t bytes_remaining = input->file.private_src.size_bytes - input->cursor_bytes;
+    if (bytes_remaining < bytes_to_read) {
+      ArrowErrorSet(&private_data->error,
+                    "Expected to be able to read %ld bytes for message body but got %ld",
+                    (long)bytes_to_read, (long)bytes_remaining);
+      return ESPIPE;
+    }
+
+    private_data->body_view.data.as_uint8 =
+        input->file.private_src.data + input->cursor_bytes;
+    private_data->body_view.size_bytes = bytes_to_read;
+    input->cursor_bytes += bytes_to_read;
+    private_data->position += bytes_to_read;
+    ArrowIpcArrayStreamReaderCountMapped(private_data, bytes_to_read);
+    return NANOARROW_OK;
+  }
+
+  private_data->body_in_ring =
+      private_data->ring_input != NULL && private_data->use_shared_buffers &&
+      ArrowIpcInputStreamSharedRingView(private_data->ring_input, bytes_to_read,
+                                        &private_data->body_view);
+  if (private_data->body_in_ring) {
+    private_data->position += bytes_to_read;
+    ArrowIpcArrayStreamReaderCountMapped(private_data, bytes_to_read);
+    return NANOARROW_OK;
+  }
+
+  // Read the body bytes. The body may have been moved to a shared buffer (or swapped
+  // with one that was never allocated) since the last message.
+  if (private_data->body.data == NULL) {
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+        ArrowBufferSetAllocator(&private_data->body, private_data->body_allocator),
+        &private_data->error);
+  }
+
+  private_data->body.size_bytes = 0;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferReserve(&private_data->body, bytes_to_read), &private_data->error);
+  NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderRead(
+      private_data, private_data->body.data, bytes_to_read, &bytes_read));
+  private_data->body.size_bytes += bytes_read;
+  private_data->position += bytes_read;
+  private_data->body_view.data.data = private_data->body.data;
+  private_data->body_view.size_bytes = private_data->body.size_bytes;
+
+  if (bytes_read != bytes_to_read) {
+    ArrowErrorSet(&private_data->error,
+                  "Expected to be able to read %ld bytes for message body but got %ld",
+                  (long)bytes_to_read, bytes_read);
+    return ESPIPE;
+  } else {
+    return NANOARROW_OK;
+  }
+}
+
+// Notifies decoder that only the fields of schema (which was just set) selected by
+// field_paths will be decoded and replaces schema with the projected schema
+static int ArrowIpcDecoderProjectSchema(struct ArrowIpcDecoder* decoder,
+                                        struct ArrowSchema* schema,
+                                        const struct ArrowIpcFieldPaths* field_paths,
+                                        struct ArrowError* error) {
+  struct ArrowSchemaProjection projection;
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaProjectionInit(
+      &projection, schema, (const struct ArrowStringView*)field_paths->paths.data,
+      field_paths->n_paths, error));
+
+  struct ArrowSchema projected;
+  projected.release = NULL;
+  int result = ArrowIpcDecoderSetProjection(decoder, schema, &projection, error);
+  if (result == NANOARROW_OK) {
+    result = ArrowSchemaProject(schema, &projection, &projected, error);
+  }
+
+  ArrowSchemaProjectionReset(&projection);
+  NANOARROW_RETURN_NOT_OK(result);
+
+  schema->release(schema);
+  ArrowSchemaMove(&projected, schema);
+  return NANOARROW_OK;
+}
+
+// Checks and decodes the Schema message most recently decoded by decoder and
+// notifies decoder of the schema (and any projection) for forthcoming RecordBatch
+// messages
+static int ArrowIpcDecoderReadSchemaMessage(struct ArrowIpcDecoder* decoder,
+                                            int64_t field_index,
+                                            const struct ArrowIpcFieldPaths* field_paths,
+                                            struct ArrowSchema* out,
+                                            struct ArrowError* error) {
+  // Error if this isn't a schema message
+  if (decoder->message_type != NANOARROW_IPC_MESSAGE_TYPE_SCHEMA) {
+    ArrowErrorSet(error, "Unexpected message type at start of input (expected Schema)");
+    return EINVAL;
+  }
+
+  // ...or if it uses features we don't support
+  if (decoder->feature_flags & NANOARROW_IPC_FEATURE_COMPRESSED_BODY) {
+    ArrowErrorSet(error, "This stream uses unsupported feature COMPRESSED_BODY");
+    return EINVAL;
+  }
+
+  // Notify the decoder of buffer endianness
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowIpcDecoderSetEndianness(decoder, decoder->endianness), error);
+
+  struct ArrowSchema tmp;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeSchema(decoder, &tmp, error));
+
+  // Only support "read the whole thing" for now
+  if (field_index != -1) {
+    tmp.release(&tmp);
+    ArrowErrorSet(error, "Field index != -1 is not yet supported");
+    return ENOTSUP;
+  }
+
+  // Notify the decoder of the schema for forthcoming messages
+  int result = ArrowIpcDecoderSetSchema(decoder, &tmp, error);
+  if (result == NANOARROW_OK && field_paths->n_paths > 0) {
+    result = ArrowIpcDecoderProjectSchema(decoder, &tmp, field_paths, error);
+  }
+
+  if (result != NANOARROW_OK) {
+    tmp.release(&tmp);
+    return result;
+  }
+
+  ArrowSchemaMove(&tmp, out);
+  return NANOARROW_OK;
+}
+
+// Initializes the decoder of each task from the Schema message that was just read
+static int ArrowIpcArrayStreamReaderInitTasks(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data) {
+  private_data->tasks = (struct ArrowIpcArrayStreamReaderTask*)ArrowMalloc(
+      private_data->n_tasks * sizeof(struct ArrowIpcArrayStreamReaderTask));
+  if (private_data->tasks == NULL) {
+    ArrowErrorSet(&private_data->error, "Failed to allocate %ld decode tasks",
+                  (long)private_data->n_tasks);
+    return ENOMEM;
+  }
+
+  // Initialize every task before anything can fail such that all can be reset
+  for (int64_t i = 0; i < private_data->n_tasks; i++) {
+    struct ArrowIpcArrayStreamReaderTask* task = private_data->tasks + i;
+    task->decoder.private_data = NULL;
+    ArrowBufferInit(&task->header);
+    ArrowBufferInit(&task->body);
+    task->array.release = NULL;
+  }
+
+  struct ArrowSchema schema;
+  for (int64_t i = 0; i < private_data->n_tasks; i++) {
+    struct ArrowIpcDecoder* decoder = &private_data->tasks[i].decoder;
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowIpcDecoderInit(decoder),
+                                       &private_data->error);
+    ArrowIpcDecoderSetSharedBufferCopyThreshold(
+        decoder, private_data->shared_buffer_copy_threshold_bytes);
+    ArrowIpcDecoderSetDeviceBody(decoder, private_data->copy_body != NULL);
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeHeader(
+        decoder, private_data->header_view, &private_data->error));
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderReadSchemaMessage(
+        decoder, private_data->field_index, &private_data->field_paths, &schema,
+        &private_data->error));
+    schema.release(&schema);
+  }
+
+  return NANOARROW_OK;
+}
+
+static int ArrowIpcArrayStreamReaderReadSchemaIfNeeded(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data) {
+  if (private_data->out_schema.release != NULL) {
+    return NANOARROW_OK;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderNextHeader(
+      private_data, NANOARROW_IPC_MESSAGE_TYPE_SCHEMA));
+
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderReadSchemaMessage(
+      &private_data->decoder, private_data->field_index, &private_data->field_paths,
+      &private_data->out_schema, &private_data->error));
+
+  if (private_data->executor != NULL) {
+    int result = ArrowIpcArrayStreamReaderInitTasks(private_data);
+    if (result != NANOARROW_OK) {
+      ArrowIpcArrayStreamReaderResetTasks(private_data);
+      private_data->out_schema.release(&private_data->out_schema);
+      return result;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+static int ArrowIpcArrayStreamReaderGetSchema(struct ArrowArrayStream* stream,
+                                              struct ArrowSchema* out) {
+  struct ArrowIpcArrayStreamReaderPrivate* private_data =
+      (struct ArrowIpcArrayStreamReaderPrivate*)stream->private_data;
+  private_data->error.message[0] = '\0';
+  NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderReadSchemaIfNeeded(private_data));
+  return ArrowSchemaDeepCopy(&private_data->out_schema, out);
+}
+
+// Initializes shared with the body that was just read, which arrays decoded from it
+// may reference without copying
+static int ArrowIpcArrayStreamReaderShareBody(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data,
+    struct ArrowIpcSharedBuffer* shared) {
+  if (private_data->copy_body != NULL) {
+    // Arrays reference the copy, which the host buffer (or mapping) doesn't outlive
+    struct ArrowBuffer copy;
+    ArrowBufferInit(&copy);
+    int result = private_data->copy_body(private_data->copy_body_private_data,
+                                         private_data->body_view, &copy,
+                                         &private_data->error);
+    if (result == NANOARROW_OK) {
+      result = ArrowIpcSharedBufferInit(shared, &copy);
+    }
+
+    if (result != NANOARROW_OK) {
+      ArrowBufferReset(&copy);
+    }
+    return result;
+  } else if (private_data->body_in_ring) {
+    // Arrays reference the ring directly
+    NANOARROW_RETURN_NOT_OK(ArrowIpcInputStreamSharedRingShare(
+        private_data->ring_input, private_data->body_view, shared, &private_data->error));
+  } else if (private_data->mmap_input != NULL) {
+    // Arrays reference the mapping directly
+    struct ArrowIpcInputStreamMmapPrivate* input = private_data->mmap_input;
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+        ArrowIpcSharedBufferSlice(
+            &input->file, input->cursor_bytes - private_data->body_view.size_bytes,
+            private_data->body_view.size_bytes, shared),
+        &private_data->error);
+  } else {
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+        ArrowIpcSharedBufferInit(shared, &private_data->body), &private_data->error);
+  }
+
+  return NANOARROW_OK;
+}
+
+// Decodes the DictionaryBatch message that was just read using the decoder of every
+// task such that any task can decode the RecordBatch messages that follow it
+static int ArrowIpcArrayStreamReaderApplyDictionary(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data) {
+  struct ArrowIpcSharedBuffer shared;
+  if (private_data->use_shared_buffers) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderShareBody(private_data, &shared));
+  }
+
+  int result = NANOARROW_OK;
+  for (int64_t i = 0; i < private_data->n_tasks && result == NANOARROW_OK; i++) {
+    struct ArrowIpcDecoder* decoder = &private_data->tasks[i].decoder;
+    result = ArrowIpcDecoderDecodeHeader(decoder, private_data->header_view,
+                                         &private_data->error);
+    if (result != NANOARROW_OK) {
+      break;
+    }
+
+    if (private_data->use_shared_buffers) {
+      result = ArrowIpcDecoderDecodeDictionaryFromShared(
+          decoder, &shared, NANOARROW_VALIDATION_LEVEL_FULL, &private_data->error);
+    } else {
+      result = ArrowIpcDecoderDecodeDictionary(decoder, private_data->body_view,
+                                               NANOARROW_VALIDATION_LEVEL_FULL,
+                                               &private_data->error);
+    }
+  }
+
+  if (private_data->use_shared_buffers) {
+    ArrowIpcSharedBufferReset(&shared);
+  }
+
+  return result;
+}
+
+// Reads the next message into the next task if it is a RecordBatch message. A
+// DictionaryBatch message is applied immediately if no tasks are waiting to be decoded
+// using the previous dictionaries or is otherwise left pending.
+static int ArrowIpcArrayStreamReaderReadTask(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data) {
+  int result = ArrowIpcArrayStreamReaderNextHeader(
+      private_data, NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH);
+  if (result == ENODATA) {
+    private_data->finished = 1;
+    return NANOARROW_OK;
+  }
+  NANOARROW_RETURN_NOT_OK(result);
+
+  enum ArrowIpcMessageType message_type = private_data->decoder.message_type;
+  if (message_type == NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderNextBody(private_data));
+    if (private_data->n_tasks_ready > 0) {
+      private_data->pending_dictionary = 1;
+      return NANOARROW_OK;
+    }
+
+    return ArrowIpcArrayStreamReaderApplyDictionary(private_data);
+  } else if (message_type != NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH) {
+    ArrowErrorSet(&private_data->error, "Unexpected message type (expected RecordBatch)");
+    return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderNextBody(private_data));
+
+  struct ArrowIpcArrayStreamReaderTask* task =
+      private_data->tasks + private_data->n_tasks_ready;
+  task->header.size_bytes = 0;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferAppend(&task->header, private_data->header_view.data.data,
+                        private_data->header_view.size_bytes),
+      &private_data->error);
+  struct ArrowBufferView header_view;
+  header_view.data.data = task->header.data;
+  header_view.size_bytes = task->header.size_bytes;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcDecoderDecodeHeader(&task->decoder, header_view, &private_data->error));
+
+  if (private_data->use_shared_buffers) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcArrayStreamReaderShareBody(private_data, &task->shared));
+  } else if (private_data->mmap_input != NULL) {
+    task->body_view = private_data->body_view;
+  } else {
+    // Exchange buffers such that both keep their capacity for subsequent messages
+    struct ArrowBuffer body;
+    ArrowBufferMove(&task->body, &body);
+    ArrowBufferMove(&private_data->body, &task->body);
+    ArrowBufferMove(&body, &private_data->body);
+    task->body_view.data.data = task->body.data;
+    task->body_view.size_bytes = task->body.size_bytes;
+  }
+
+  private_data->n_tasks_ready++;
+  return NANOARROW_OK;
+}
+
+static void ArrowIpcArrayStreamReaderDecodeTask(void* task_private, int64_t i) {
+  struct ArrowIpcArrayStreamReaderPrivate* private_data =
+      (struct ArrowIpcArrayStreamReaderPrivate*)task_private;
+  struct ArrowIpcArrayStreamReaderTask* task = private_data->tasks + i;
+  ArrowErrorInit(&task->error);
+
+  if (private_data->use_shared_buffers) {
+    task->result = ArrowIpcDecoderDecodeArrayFromShared(
+        &task->decoder, &task->shared, private_data->field_index, &task->array,
+        private_data->validation_level, &task->error);
+  } else {
+    task->result = ArrowIpcDecoderDecodeArray(
+        &task->decoder, task->body_view, private_data->field_index, &task->array,
+        private_data->validation_level, &task->error);
+  }
+}
+
+// Reads up to n_tasks RecordBatch messages and decodes them using the executor
+static int ArrowIpcArrayStreamReaderRunTasks(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data) {
+  private_data->n_tasks_ready = 0;
+  private_data->next_task = 0;
+
+  int result = NANOARROW_OK;
+  if (private_data->pending_dictionary) {
+    private_data->pending_dictionary = 0;
+    result = ArrowIpcArrayStreamReaderApplyDictionary(private_data);
+  }
+
+  while (result == NANOARROW_OK && !private_data->finished &&
+         !private_data->pending_dictionary &&
+         private_data->n_tasks_ready < private_data->n_tasks) {
+    result = ArrowIpcArrayStreamReaderReadTask(private_data);
+  }
+
+  if (result != NANOARROW_OK && private_data->n_tasks_ready == 0) {
+    return result;
+  } else if (result != NANOARROW_OK) {
+    private_data->finished = 1;
+    private_data->read_result = result;
+    memcpy(&private_data->read_error, &private_data->error, sizeof(struct ArrowError));
+  }
+
+  if (private_data->n_tasks_ready == 0) {
+    return NANOARROW_OK;
+  }
+
+  private_data->executor->parallel_for(private_data->executor,
+                                       &ArrowIpcArrayStreamReaderDecodeTask,
+                                       private_data, private_data->n_tasks_ready);
+
+  if (private_data->use_shared_buffers) {
+    for (int64_t i = 0; i < private_data->n_tasks_ready; i++) {
+      ArrowIpcSharedBufferReset(&private_data->tasks[i].shared);
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+static int ArrowIpcArrayStreamReaderGetNextTask(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data, struct ArrowArray* out) {
+  if (private_data->next_task == private_data->n_tasks_ready &&
+      private_data->read_result != NANOARROW_OK) {
+    memcpy(&private_data->error, &private_data->read_error, sizeof(struct ArrowError));
+    return private_data->read_result;
+  }
+
+  if (private_data->next_task == private_data->n_tasks_ready) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderRunTasks(private_data));
+  }
+
+  if (private_data->next_task == private_data->n_tasks_ready) {
+    out->release = NULL;
+    return NANOARROW_OK;
+  }
+
+  struct ArrowIpcArrayStreamReaderTask* task =
+      private_data->tasks + private_data->next_task;
+  private_data->next_task++;
+  if (task->result != NANOARROW_OK) {
+    memcpy(&private_data->error, &task->error, sizeof(struct ArrowError));
+    return task->result;
+  }
+
+  ArrowArrayMove(&task->array, out);
+  return NANOARROW_OK;
+}
+
+// Reads the body of the DictionaryBatch message whose header was just decoded and
+// decodes it using the reader's decoder
+static int ArrowIpcArrayStreamReaderReadDictionary(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data) {
+  NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderNextBody(private_data));
+  if (private_data->use_shared_buffers) {
+    struct ArrowIpcSharedBuffer shared;
+    NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderShareBody(private_data, &shared));
+    int result = ArrowIpcDecoderDecodeDictionaryFromShared(
+        &private_data->decoder, &shared, NANOARROW_VALIDATION_LEVEL_FULL,
+        &private_data->error);
+    ArrowIpcSharedBufferReset(&shared);
+    return result;
+  } else {
+    return ArrowIpcDecoderDecodeDictionary(&private_data->decoder,
+                                           private_data->body_view,
+                                           NANOARROW_VALIDATION_LEVEL_FULL,
+                                           &private_data->error);
+  }
+}
+
+static int ArrowIpcArrayStreamReaderGetNext(struct ArrowArrayStream* stream,
+                                            struct ArrowArray* out) {
+  struct ArrowIpcArrayStreamReaderPrivate* private_data =
+      (struct ArrowIpcArrayStreamReaderPrivate*)stream->private_data;
+  ArrowErrorInit(&private_data->error);
+  NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderReadSchemaIfNeeded(private_data));
+
+  if (private_data->executor != NULL) {
+    return ArrowIpcArrayStreamReaderGetNextTask(private_data, out);
+  }
+
+  // Read + decode the next header, decoding any DictionaryBatch messages that
+  // precede the next RecordBatch
+  int result;
+  while (1) {
+    result = ArrowIpcArrayStreamReaderNextHeader(private_data,
+                                                 NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH);
+    if (result == ENODATA) {
+      // Stream is finished either because there is no input or because
+      // end of stream bytes were read.
+      out->release = NULL;
+      return NANOARROW_OK;
+    } else if (result != NANOARROW_OK) {
+      // Other error
+      return result;
+    }
+
+    if (private_data->decoder.message_type !=
+        NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH) {
+      break;
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderReadDictionary(private_data));
+  }
+
+  // Make sure we have a RecordBatch message
+  if (private_data->decoder.message_type != NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH) {
+    ArrowErrorSet(&private_data->error, "Unexpected message type (expected RecordBatch)");
+    return EINVAL;
+  }
+
+  // Read in the body
+  NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderNextBody(private_data));
+
+  struct ArrowArray tmp;
+
+  if (private_data->use_shared_buffers) {
+    struct ArrowIpcSharedBuffer shared;
+    NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderShareBody(private_data, &shared));
+    result = ArrowIpcDecoderDecodeArrayFromShared(
+        &private_data->decoder, &shared, private_data->field_index, &tmp,
+        private_data->validation_level, &private_data->error);
+    ArrowIpcSharedBufferReset(&shared);
+    NANOARROW_RETURN_NOT_OK(result);
+  } else {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeArray(
+        &private_data->decoder, private_data->body_view, private_data->field_index, &tmp,
+        private_data->validation_level, &private_data->error));
+  }
+
+  ArrowArrayMove(&tmp, out);
+  return NANOARROW_OK;
+}
+
+static const char* ArrowIpcArrayStreamReaderGetLastError(
+    struct ArrowArrayStream* stream) {
+  struct ArrowIpcArrayStreamReaderPrivate* private_data =
+      (struct ArrowIpcArrayStreamReaderPrivate*)stream->private_data;
+  return private_data->error.message;
+}
+
+ArrowErrorCode ArrowIpcArrayStreamReaderInit(
+    struct ArrowArrayStream* out, struct ArrowIpcInputStream* input_stream,
+    struct ArrowIpcArrayStreamReaderOptions* options) {
+  // Tasks reference shared buffers from multiple threads
+  if (options != NULL && options->executor != NULL &&
+      (options->batch_readahead < 1 ||
+       (options->use_shared_buffers && !ArrowIpcSharedBufferIsThreadSafe()))) {
+    return EINVAL;
+  }
+
+  if (options != NULL && (options->read_ahead_bytes < 0 || options->body_alignment < 0)) {
+    return EINVAL;
+  }
+
+  // Device bodies can only be referenced by shared buffers
+  if (options != NULL && options->copy_body != NULL && !options->use_shared_buffers) {
+    return EINVAL;
+  }
+
+  struct ArrowIpcArrayStreamReaderPrivate* private_data =
+      (struct ArrowIpcArrayStreamReaderPrivate*)ArrowMalloc(
+          sizeof(struct ArrowIpcArrayStreamReaderPrivate));
+  if (private_data == NULL) {
+    return ENOMEM;
+  }
+
+  int result = ArrowIpcDecoderInit(&private_data->decoder);
+  if (result != NANOARROW_OK) {
+    ArrowFree(private_data);
+    return result;
+  }
+
+  result = ArrowIpcFieldPathsInit(&private_data->field_paths, options);
+  if (result == NANOARROW_OK && options != NULL) {
+    result = ArrowIpcDecoderSetVerificationLevel(&private_data->decoder,
+                                                 options->verification_level);
+    ArrowIpcDecoderSetSchemaCache(&private_data->decoder, options->schema_cache);
+    ArrowIpcDecoderSetSharedBufferCopyThreshold(
+        &private_data->decoder, options->shared_buffer_copy_threshold_bytes);
+    ArrowIpcDecoderSetDeviceBody(&private_data->decoder, options->copy_body != NULL);
+  }
+
+  if (result != NANOARROW_OK) {
+    ArrowIpcFieldPathsReset(&private_data->field_paths);
+    ArrowIpcDecoderReset(&private_data->decoder);
+    ArrowFree(private_data);
+    return result;
+  }
+
+  ArrowBufferInit(&private_data->header);
+  ArrowBufferInit(&private_data->body);
+  private_data->body_allocator = ArrowIpcBodyAllocator(options);
+  ArrowBufferInit(&private_data->read_ahead);
+  private_data->read_ahead_offset = 0;
+  private_data->read_ahead_bytes = 0;
+  private_data->out_schema.release = NULL;
+  ArrowIpcInputStreamMove(input_stream, &private_data->input);
+  if (private_data->input.read == &ArrowIpcInputStreamMmapRead) {
+    private_data->mmap_input =
+        (struct ArrowIpcInputStreamMmapPrivate*)private_data->input.private_data;
+  } else {
+    private_data->mmap_input = NULL;
+  }
+  private_data->ring_input = ArrowIpcInputStreamSharedRing(&private_data->input);
+  private_data->body_in_ring = 0;
+  private_data->position = 0;
+  private_data->n_messages = 0;
+  private_data->input_start = ArrowIpcInputStreamTell(&private_data->input);
+  private_data->message_index = NULL;
+  private_data->header_view.data.data = NULL;
+  private_data->header_view.size_bytes = 0;
+  private_data->body_view.data.data = NULL;
+  private_data->body_view.size_bytes = 0;
+
+  private_data->executor = NULL;
+  private_data->tasks = NULL;
+  private_data->n_tasks = 0;
+  private_data->n_tasks_ready = 0;
+  private_data->next_task = 0;
+  private_data->pending_dictionary = 0;
+  private_data->finished = 0;
+  private_data->read_result = NANOARROW_OK;
+#if defined(NANOARROW_IPC_WITH_STATS)
+  memset(&private_data->stats, 0, sizeof(struct ArrowIpcStats));
+#endif
+
+  if (options != NULL) {
+    private_data->field_index = options->field_index;
+    private_data->use_shared_buffers = options->use_shared_buffers;
+    private_data->shared_buffer_copy_threshold_bytes =
+        options->shared_buffer_copy_threshold_bytes;
+    private_data->copy_body = options->copy_body;
+    private_data->copy_body_private_data = options->copy_body_private_data;
+    private_data->executor = options->executor;
+    private_data->n_tasks = options->batch_readahead;
+    private_data->message_index = options->message_index;
+    if (private_data->mmap_input == NULL && private_data->ring_input == NULL) {
+      private_data->read_ahead_bytes = options->read_ahead_bytes;
+    }
+  } else {
+    private_data->field_index = -1;
+    private_data->use_shared_buffers = ArrowIpcSharedBufferIsThreadSafe();
+    private_data->shared_buffer_copy_threshold_bytes = 0;
+    private_data->copy_body = NULL;
+    private_data->copy_body_private_data = NULL;
+  }
+
+  private_data->validation_level = NANOARROW_VALIDATION_LEVEL_FULL;
+  if (private_data->copy_body != NULL ||
+      (options != NULL && options->defer_validation)) {
+    private_data->validation_level = NANOARROW_VALIDATION_LEVEL_MINIMAL;
+  }
+
+  out->private_data = private_data;
+  out->get_schema = &ArrowIpcArrayStreamReaderGetSchema;
+  out->get_next = &ArrowIpcArrayStreamReaderGetNext;
+  out->get_last_error = &ArrowIpcArrayStreamReaderGetLastError;
+  out->release = &ArrowIpcArrayStreamReaderRelease;
+
+  return NANOARROW_OK;
+}
+
+#if defined(NANOARROW_IPC_WITH_STATS)
+static void ArrowIpcArrayStreamReaderAddDecoderStats(struct ArrowIpcStats* out,
+                                                     struct ArrowIpcDecoder* decoder) {
+  struct ArrowIpcStats stats;
+  ArrowIpcDecoderGetStats(decoder, &stats);
+  out->n_messages += stats.n_messages;
+  out->n_buffers_shared += stats.n_buffers_shared;
+  out->n_bytes_shared += stats.n_bytes_shared;
+  out->n_buffers_allocated += stats.n_buffers_allocated;
+  out->n_bytes_copied += stats.n_bytes_copied;
+  out->verify_ns += stats.verify_ns;
+  out->decode_header_ns += stats.decode_header_ns;
+  out->decode_body_ns += stats.decode_body_ns;
+  out->validate_ns += stats.validate_ns;
+}
+#endif
+
+ArrowErrorCode ArrowIpcArrayStreamReaderGetStats(struct ArrowArrayStream* stream,
+                                                 struct ArrowIpcStats* out) {
+  memset(out, 0, sizeof(struct ArrowIpcStats));
+  if (stream->release == NULL || stream->get_next != &ArrowIpcArrayStreamReaderGetNext) {
+    return EINVAL;
+  }
+
+#if defined(NANOARROW_IPC_WITH_STATS)
+  struct ArrowIpcArrayStreamReaderPrivate* private_data =
+      (struct ArrowIpcArrayStreamReaderPrivate*)stream->private_data;
+  *out = private_data->stats;
+  ArrowIpcArrayStreamReaderAddDecoderStats(out, &private_data->decoder);
+  // Task decoders decode a second copy of headers that were already read (and counted)
+  // by the reader's own decoder
+  int64_t n_messages = out->n_messages;
+  if (private_data->tasks != NULL) {
+    for (int64_t i = 0; i < private_data->n_tasks; i++) {
+      ArrowIpcArrayStreamReaderAddDecoderStats(out, &private_data->tasks[i].decoder);
+    }
+  }
+  out->n_messages = n_messages;
+
+  return NANOARROW_OK;
+#else
+  return ENOTSUP;
+#endif
+}
+
+// Repositions the reader at the message that starts at offset bytes from the start of
+// the stream, discarding any bytes that were read ahead
+static int ArrowIpcArrayStreamReaderSeekMessage(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data,
+    const struct ArrowIpcMessageIndexEntry* entry) {
+  int64_t offset = private_data->input_start + entry->offset;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcInputStreamSeek(&private_data->input, offset, &private_data->error));
+  private_data->position = entry->offset;
+  private_data->n_messages = entry->message_index;
+  private_data->read_ahead.size_bytes = 0;
+  private_data->read_ahead_offset = 0;
+  return NANOARROW_OK;
+}
+
+// Returns non-zero if the DictionaryBatch message at entries[i] contributes to the
+// dictionary of its id at entries[end] (i.e., if no later message before end replaces
+// that dictionary)
+static int ArrowIpcMessageIndexDictionaryIsLive(
+    const struct ArrowIpcMessageIndexEntry* entries, int64_t i, int64_t end) {
+  for (int64_t j = i + 1; j < end; j++) {
+    if (entries[j].message_type == NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH &&
+        entries[j].dictionary_id == entries[i].dictionary_id &&
+        !entries[j].dictionary_is_delta) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static int ArrowIpcArrayStreamReaderSeekInternal(
+    struct ArrowIpcArrayStreamReaderPrivate* private_data,
+    const struct ArrowIpcMessageIndex* index, int64_t batch_index) {
+  if (private_data->executor != NULL) {
+    ArrowErrorSet(&private_data->error, "Can't seek a reader that uses an executor");
+    return ENOTSUP;
+  } else if (private_data->input_start < 0) {
+    ArrowErrorSet(&private_data->error,
+                  "Can't seek a reader whose input is not seekable");
+    return ENOTSUP;
+  } else if (batch_index < 0 || batch_index >= index->n_record_batches) {
+    ArrowErrorSet(&private_data->error,
+                  "Record batch %ld is out of range of an index of %ld record batches",
+                  (long)batch_index, (long)index->n_record_batches);
+    return EINVAL;
+  }
+
+  const struct ArrowIpcMessageIndexEntry* entries =
+      (const struct ArrowIpcMessageIndexEntry*)index->entries.data;
+  int64_t batch_entry = 0;
+  for (int64_t n_batches = 0; batch_entry < index->n_entries; batch_entry++) {
+    if (entries[batch_entry].message_type == NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH &&
+        n_batches++ == batch_index) {
+      break;
+    }
+  }
+
+  if (private_data->out_schema.release == NULL) {
+    if (entries[0].message_type != NANOARROW_IPC_MESSAGE_TYPE_SCHEMA) {
+      ArrowErrorSet(&private_data->error,
+                    "Expected the first entry of the index to be a Schema message");
+      return EINVAL;
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderSeekMessage(private_data, entries));
+    NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderReadSchemaIfNeeded(private_data));
+  }
+
+  // Replay the dictionaries that the batch depends on
+  for (int64_t i = 0; i < batch_entry; i++) {
+    if (entries[i].message_type != NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH ||
+        !ArrowIpcMessageIndexDictionaryIsLive(entries, i, batch_entry)) {
+      continue;
+    }
+
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcArrayStreamReaderSeekMessage(private_data, entries + i));
+    NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderNextHeader(
+        private_data, NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH));
+    if (private_data->decoder.message_type !=
+        NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH) {
+      ArrowErrorSet(&private_data->error,
+                    "Expected DictionaryBatch message at offset %ld of the stream",
+                    (long)entries[i].offset);
+      return EINVAL;
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowIpcArrayStreamReaderReadDictionary(private_data));
+  }
+
+  return ArrowIpcArrayStreamReaderSeekMessage(private_data, entries + batch_entry);
+}
+
+ArrowErrorCode ArrowIpcArrayStreamReaderSeek(struct ArrowArrayStream* stream,
+                                             const struct ArrowIpcMessageIndex* index,
+                                             int64_t batch_index,
+                                             struct ArrowError* error) {
+  if (stream->release == NULL || stream->get_next != &ArrowIpcArrayStreamReaderGetNext) {
+    ArrowErrorSet(error, "stream is not an ArrowIpcArrayStreamReader");
+    return EINVAL;
+  }
+
+  struct ArrowIpcArrayStreamReaderPrivate* private_data =
+      (struct ArrowIpcArrayStreamReaderPrivate*)stream->private_data;
+  ArrowErrorInit(&private_data->error);
+  int result = ArrowIpcArrayStreamReaderSeekInternal(private_data, index, batch_index);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "%s", private_data->error.message);
+  }
+
+  return result;
+}
+
+ArrowErrorCode ArrowIpcBatchViewInit(struct ArrowIpcBatchView* batch_view,
+                                     struct ArrowSchema* schema,
+                                     struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(
+      ArrowArrayViewInitFromSchema(&batch_view->array_view, schema, error));
+  ArrowBufferInit(&batch_view->validated);
+
+  if (batch_view->array_view.storage_type != NANOARROW_TYPE_STRUCT) {
+    ArrowErrorSet(error, "Expected struct schema for batch view but found %s",
+                  ArrowTypeString(batch_view->array_view.storage_type));
+    ArrowArrayViewReset(&batch_view->array_view);
+    return EINVAL;
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcBatchViewSetArray(struct ArrowIpcBatchView* batch_view,
+                                         struct ArrowArray* array,
+                                         struct ArrowError* error) {
+  // Columns are never considered validated if setting the array fails
+  ArrowBufferResize(&batch_view->validated, 0, 0);
+  NANOARROW_RETURN_NOT_OK(
+      ArrowArrayViewSetArrayMinimal(&batch_view->array_view, array, error));
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferAppendFill(&batch_view->validated, 0,
+                            batch_view->array_view.n_children),
+      error);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcBatchViewGetColumn(struct ArrowIpcBatchView* batch_view,
+                                          int64_t i, struct ArrowArrayView** out,
+                                          struct ArrowError* error) {
+  if (i < 0 || i >= batch_view->validated.size_bytes) {
+    ArrowErrorSet(error, "Expected column index between 0 and %ld but found %ld",
+                  (long)(batch_view->validated.size_bytes - 1), (long)i);
+    return EINVAL;
+  }
+
+  struct ArrowArrayView* column = batch_view->array_view.children[i];
+  if (!batch_view->validated.data[i]) {
+    struct ArrowError column_error;
+    column_error.message[0] = '\0';
+    int result = ArrowArrayViewValidate(column, NANOARROW_VALIDATION_LEVEL_FULL,
+                                        &column_error);
+    if (result != NANOARROW_OK) {
+      ArrowErrorSet(error, "Column %ld is invalid: %s", (long)i, column_error.message);
+      return result;
+    }
+
+    batch_view->validated.data[i] = 1;
+  }
+
+  *out = column;
+  return NANOARROW_OK;
+}
+
+void ArrowIpcBatchViewReset(struct ArrowIpcBatchView* batch_view) {
+  ArrowArrayViewReset(&batch_view->array_view);
+  ArrowBufferReset(&batch_view->validated);
+}
+
+struct ArrowIpcPushReaderPrivate {
+  struct ArrowIpcDecoder decoder;
+  struct ArrowAsyncArrayStreamHandler handler;
+  struct ArrowAsyncProducer producer;
+  int64_t field_index;
+  struct ArrowIpcFieldPaths field_paths;
+  int use_shared_buffers;
+  // The validation level of arrays decoded from RecordBatch messages
+  enum ArrowValidationLevel validation_level;
+  // The allocator used for the copies of bodies referenced by shared buffers
+  struct ArrowBufferAllocator body_allocator;
+  // Input is consumed from chunk (the data passed to ArrowIpcPushReaderFeed() while
+  // it is being processed without copying) if non-NULL or from input otherwise
+  struct ArrowBuffer input;
+  struct ArrowBufferView chunk;
+  int64_t input_offset;
+  // The number of bytes required to complete the message at the start of the input
+  // as of the last attempt to read it
+  int64_t n_bytes_needed;
+  int64_t n_requested;
+  char schema_done;
+  char input_finished;
+  char delivering;
+  char done;
+  int result;
+  struct ArrowError error;
+};
+
+static struct ArrowBufferView ArrowIpcPushReaderRemaining(
+    struct ArrowIpcPushReaderPrivate* private_data) {
+  struct ArrowBufferView view;
+  if (private_data->chunk.data.data != NULL) {
+    view.data.as_uint8 = private_data->chunk.data.as_uint8 + private_data->input_offset;
+    view.size_bytes = private_data->chunk.size_bytes - private_data->input_offset;
+  } else {
+    view.data.as_uint8 = private_data->input.data + private_data->input_offset;
+    view.size_bytes = private_data->input.size_bytes - private_data->input_offset;
+  }
+  return view;
+}
+
+// Returns NANOARROW_OK if the remaining input begins with a complete, verified
+// message (header and body), ESPIPE if more input is required, ENODATA if the
+// remaining input begins with the end-of-stream indicator, or another errno code
+// if the input is not valid.
+static int ArrowIpcPushReaderPeekMessage(struct ArrowIpcPushReaderPrivate* private_data,
+                                         struct ArrowBufferView* message) {
+  *message = ArrowIpcPushReaderRemaining(private_data);
+  private_data->n_bytes_needed = 0;
+
+  // The size of the header is known once its 8-byte prefix is available
+  int result =
+      ArrowIpcDecoderPeekHeader(&private_data->decoder, *message, &private_data->error);
+  if (result == ESPIPE) {
+    private_data->n_bytes_needed = 8 - message->size_bytes;
+    return result;
+  }
+  NANOARROW_RETURN_NOT_OK(result);
+
+  // ...and the size of the body once the header is available
+  result =
+      ArrowIpcDecoderVerifyHeader(&private_data->decoder, *message, &private_data->error);
+  if (result == ESPIPE) {
+    private_data->n_bytes_needed =
+        private_data->decoder.header_size_bytes - message->size_bytes;
+    return result;
+  }
+  NANOARROW_RETURN_NOT_OK(result);
+
+  int64_t message_size_bytes =
+      private_data->decoder.header_size_bytes + private_data->decoder.body_size_bytes;
+  if (message->size_bytes < message_size_bytes) {
+    private_data->n_bytes_needed = message_size_bytes - message->size_bytes;
+    ArrowErrorSet(&private_data->error,
+                  "Expected %ld bytes for message header and body but found %ld bytes",
+                  (long)message_size_bytes, (long)message->size_bytes);
+    return ESPIPE;
+  }
+
+  message->size_bytes = message_size_bytes;
+  return NANOARROW_OK;
+}
+
+static int ArrowIpcPushReaderDecodeSchema(
+    struct ArrowIpcPushReaderPrivate* private_data, struct ArrowBufferView message) {
+  if (private_data->decoder.message_type == NANOARROW_IPC_MESSAGE_TYPE_SCHEMA) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeHeader(&private_data->decoder, message,
+                                                        &private_data->error));
+  }
+
+  struct ArrowSchema schema;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderReadSchemaMessage(
+      &private_data->decoder, private_data->field_index, &private_data->field_paths,
+      &schema, &private_data->error));
+  private_data->input_offset += message.size_bytes;
+  private_data->schema_done = 1;
+
+  if (private_data->handler.on_schema(&private_data->handler, &private_data->producer,
+                                      &schema) != NANOARROW_OK) {
+    private_data->done = 1;
+    private_data->result = ECANCELED;
+  }
+
+  return NANOARROW_OK;
+}
+
+// Decodes a RecordBatch message into out or a DictionaryBatch message into the
+// decoder (leaving out released)
+static int ArrowIpcPushReaderDecodeArray(struct ArrowIpcPushReaderPrivate* private_data,
+                                         struct ArrowBufferView message,
+                                         struct ArrowArray* out) {
+  enum ArrowIpcMessageType message_type = private_data->decoder.message_type;
+  char is_dictionary = message_type == NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH;
+  if (message_type != NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH && !is_dictionary) {
+    ArrowErrorSet(&private_data->error, "Unexpected message type (expected RecordBatch)");
+    return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeHeader(&private_data->decoder, message,
+                                                      &private_data->error));
+
+  struct ArrowBufferView body_view;
+  body_view.data.as_uint8 =
+      message.data.as_uint8 + private_data->decoder.header_size_bytes;
+  body_view.size_bytes = private_data->decoder.body_size_bytes;
+
+  if (!private_data->use_shared_buffers && is_dictionary) {
+    return ArrowIpcDecoderDecodeDictionary(&private_data->decoder, body_view,
+                                           NANOARROW_VALIDATION_LEVEL_FULL,
+                                           &private_data->error);
+  } else if (!private_data->use_shared_buffers) {
+    return ArrowIpcDecoderDecodeArray(
+        &private_data->decoder, body_view, private_data->field_index, out,
+        private_data->validation_level, &private_data->error);
+  }
+
+  // The input buffer is reused for subsequent messages, so shared buffers need
+  // a copy of the body that they can own
+  struct ArrowBuffer body;
+  ArrowBufferInit(&body);
+  int result = ArrowBufferSetAllocator(&body, private_data->body_allocator);
+  if (result == NANOARROW_OK) {
+    result = ArrowBufferAppendBufferView(&body, body_view);
+  }
+  if (result != NANOARROW_OK) {
+    ArrowBufferReset(&body);
+    ArrowErrorSet(&private_data->error, "Failed to copy message body");
+    return result;
+  }
+
+  struct ArrowIpcSharedBuffer shared;
+  result = ArrowIpcSharedBufferInit(&shared, &body);
+  if (result != NANOARROW_OK) {
+    ArrowBufferReset(&body);
+    ArrowErrorSet(&private_data->error, "Failed to initialize shared buffer");
+    return result;
+  }
+
+  if (is_dictionary) {
+    result = ArrowIpcDecoderDecodeDictionaryFromShared(
+        &private_data->decoder, &shared, NANOARROW_VALIDATION_LEVEL_FULL,
+        &private_data->error);
+  } else {
+    result = ArrowIpcDecoderDecodeArrayFromShared(
+        &private_data->decoder, &shared, private_data->field_index, out,
+        private_data->validation_level, &private_data->error);
+  }
+  ArrowIpcSharedBufferReset(&shared);
+  return result;
+}
+
+static void ArrowIpcPushReaderDeliver(struct ArrowIpcPushReaderPrivate* private_data,
+                                      struct ArrowArray* array) {
+  char is_end = array->release == NULL;
+  private_data->n_requested--;
+  if (private_data->handler.on_next(&private_data->handler, array) != NANOARROW_OK) {
+    private_data->done = 1;
+    private_data->result = ECANCELED;
+  } else if (is_end) {
+    private_data->done = 1;
+  }
+}
+
+// Makes as much progress as possible with the available input and requests. Returns
+// NANOARROW_OK if progress was made, EAGAIN if more input or requests are required,
+// or another errno code if the input is not valid.
+static int ArrowIpcPushReaderStep(struct ArrowIpcPushReaderPrivate* private_data) {
+  struct ArrowBufferView message;
+  int result = ArrowIpcPushReaderPeekMessage(private_data, &message);
+  int64_t n_remaining = ArrowIpcPushReaderRemaining(private_data).size_bytes;
+
+  // Invalid or truncated input is reported even if no arrays are requested
+  if (result == ESPIPE && !private_data->input_finished) {
+    return EAGAIN;
+  } else if (result == ESPIPE && n_remaining > 0) {
+    // ESPIPE is reserved for "more input may help", which is no longer the case
+    return EINVAL;
+  } else if (result == ESPIPE && !private_data->schema_done) {
+    ArrowErrorSet(&private_data->error, "No data available on stream");
+    return ENODATA;
+  } else if (result == ENODATA && !private_data->schema_done) {
+    ArrowErrorSet(&private_data->error,
+                  "Unexpected end of stream at start of input (expected Schema)");
+    return EINVAL;
+  } else if (result != NANOARROW_OK && result != ESPIPE && result != ENODATA) {
+    return result;
+  }
+
+  if (private_data->schema_done && private_data->n_requested <= 0) {
+    return EAGAIN;
+  }
+
+  struct ArrowArray array;
+  array.release = NULL;
+
+  if (result == ESPIPE) {
+    // Input without an end-of-stream indicator is treated as finished
+    ArrowIpcPushReaderDeliver(private_data, &array);
+    return NANOARROW_OK;
+  } else if (result == ENODATA) {
+    private_data->input_offset += 8;
+    ArrowIpcPushReaderDeliver(private_data, &array);
+    return NANOARROW_OK;
+  }
+
+  if (!private_data->schema_done) {
+    return ArrowIpcPushReaderDecodeSchema(private_data, message);
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowIpcPushReaderDecodeArray(private_data, message, &array));
+  private_data->input_offset += message.size_bytes;
+  if (private_data->decoder.message_type != NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH) {
+    ArrowIpcPushReaderDeliver(private_data, &array);
+  }
+
+  return NANOARROW_OK;
+}
+
+static void ArrowIpcPushReaderProcess(struct ArrowIpcPushReaderPrivate* private_data) {
+  if (private_data->delivering) {
+    return;
+  }
+
+  private_data->delivering = 1;
+  int result = NANOARROW_OK;
+  while (!private_data->done && result == NANOARROW_OK) {
+    result = ArrowIpcPushReaderStep(private_data);
+  }
+  private_data->delivering = 0;
+
+  if (!private_data->done && result != EAGAIN) {
+    private_data->done = 1;
+    private_data->result = result;
+    private_data->handler.on_error(&private_data->handler, result,
+                                   private_data->error.message);
+  }
+
+  // Move unconsumed input to the start of the buffer. Unconsumed bytes of a chunk must
+  // be copied (ahead of any input fed while the chunk was processed) because the
+  // chunk is only valid until ArrowIpcPushReaderFeed() returns.
+  struct ArrowBufferView remaining = ArrowIpcPushReaderRemaining(private_data);
+  int64_t n_fed_while_processing = 0;
+  if (private_data->chunk.data.data != NULL) {
+    n_fed_while_processing = private_data->input.size_bytes;
+    private_data->chunk.data.data = NULL;
+    private_data->chunk.size_bytes = 0;
+    result = ArrowBufferReserve(&private_data->input, remaining.size_bytes);
+    if (result != NANOARROW_OK && !private_data->done) {
+      private_data->done = 1;
+      private_data->result = result;
+      private_data->handler.on_error(&private_data->handler, result,
+                                     "Failed to copy unconsumed input");
+    } else if (result == NANOARROW_OK) {
+      memmove(private_data->input.data + remaining.size_bytes, private_data->input.data,
+              n_fed_while_processing);
+      memcpy(private_data->input.data, remaining.data.data, remaining.size_bytes);
+      private_data->input.size_bytes = remaining.size_bytes + n_fed_while_processing;
+    }
+  } else {
+    if (remaining.size_bytes > 0 && private_data->input_offset > 0) {
+      memmove(private_data->input.data, remaining.data.data, remaining.size_bytes);
+    }
+    private_data->input.size_bytes = remaining.size_bytes;
+  }
+  private_data->input_offset = 0;
+
+  if (private_data->done && private_data->handler.release != NULL) {
+    private_data->handler.release(&private_data->handler);
+    private_data->handler.release = NULL;
+  }
+
+  // Input fed from a callback while a chunk was processed has not been seen yet
+  if (n_fed_while_processing > 0 && !private_data->done) {
+    ArrowIpcPushReaderProcess(private_data);
+  }
+}
+
+static void ArrowIpcPushReaderRequest(struct ArrowAsyncProducer* producer, int64_t n) {
+  struct ArrowIpcPushReaderPrivate* private_data =
+      (struct ArrowIpcPushReaderPrivate*)producer->private_data;
+  if (private_data->done || n <= 0) {
+    return;
+  }
+
+  private_data->n_requested += n;
+  ArrowIpcPushReaderProcess(private_data);
+}
+
+static void ArrowIpcPushReaderCancel(struct ArrowAsyncProducer* producer) {
+  struct ArrowIpcPushReaderPrivate* private_data =
+      (struct ArrowIpcPushReaderPrivate*)producer->private_data;
+  if (private_data->done) {
+    return;
+  }
+
+  private_data->done = 1;
+  private_data->result = ECANCELED;
+  if (!private_data->delivering) {
+    private_data->handler.release(&private_data->handler);
+    private_data->handler.release = NULL;
+  }
+}
+
+ArrowErrorCode ArrowIpcPushReaderInit(struct ArrowIpcPushReader* reader,
+                                      struct ArrowAsyncArrayStreamHandler* handler,
+                                      struct ArrowIpcArrayStreamReaderOptions* options) {
+  if (options != NULL && (options->copy_body != NULL || options->body_alignment < 0)) {
+    return EINVAL;
+  }
+
+  struct ArrowIpcPushReaderPrivate* private_data =
+      (struct ArrowIpcPushReaderPrivate*)ArrowMalloc(
+          sizeof(struct ArrowIpcPushReaderPrivate));
+  if (private_data == NULL) {
+    return ENOMEM;
+  }
+
+  int result = ArrowIpcDecoderInit(&private_data->decoder);
+  if (result != NANOARROW_OK) {
+    ArrowFree(private_data);
+    return result;
+  }
+
+  result = ArrowIpcFieldPathsInit(&private_data->field_paths, options);
+  if (result == NANOARROW_OK && options != NULL) {
+    result = ArrowIpcDecoderSetVerificationLevel(&private_data->decoder,
+                                                 options->verification_level);
+    ArrowIpcDecoderSetSchemaCache(&private_data->decoder, options->schema_cache);
+    ArrowIpcDecoderSetSharedBufferCopyThreshold(
+        &private_data->decoder, options->shared_buffer_copy_threshold_bytes);
+  }
+
+  if (result != NANOARROW_OK) {
+    ArrowIpcFieldPathsReset(&private_data->field_paths);
+    ArrowIpcDecoderReset(&private_data->decoder);
+    ArrowFree(private_data);
+    return result;
+  }
+
+  private_data->validation_level = NANOARROW_VALIDATION_LEVEL_FULL;
+  if (options != NULL) {
+    private_data->field_index = options->field_index;
+    private_data->use_shared_buffers = options->use_shared_buffers;
+    if (options->defer_validation) {
+      private_data->validation_level = NANOARROW_VALIDATION_LEVEL_MINIMAL;
+    }
+  } else {
+    private_data->field_index = -1;
+    private_data->use_shared_buffers = ArrowIpcSharedBufferIsThreadSafe();
+  }
+  private_data->body_allocator = ArrowIpcBodyAllocator(options);
+
+  memcpy(&private_data->handler, handler, sizeof(struct ArrowAsyncArrayStreamHandler));
+  handler->release = NULL;
+  private_data->producer.request = &ArrowIpcPushReaderRequest;
+  private_data->producer.cancel = &ArrowIpcPushReaderCancel;
+  private_data->producer.private_data = private_data;
+  ArrowBufferInit(&private_data->input);
+  private_data->chunk.data.data = NULL;
+  private_data->chunk.size_bytes = 0;
+  private_data->input_offset = 0;
+  private_data->n_bytes_needed = 8;
+  private_data->n_requested = 0;
+  private_data->schema_done = 0;
+  private_data->input_finished = 0;
+  private_data->delivering = 0;
+  private_data->done = 0;
+  private_data->result = NANOARROW_OK;
+  private_data->error.message[0] = '\0';
+
+  reader->private_data = private_data;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcPushReaderFeed(struct ArrowIpcPushReader* reader,
+                                      struct ArrowBufferView data) {
+  struct ArrowIpcPushReaderPrivate* private_data =
+      (struct ArrowIpcPushReaderPrivate*)reader->private_data;
+  if (private_data->done) {
+    return private_data->result;
+  } else if (private_data->input_finished) {
+    return EINVAL;
+  }
+
+  // A chunk that can't complete the message at the start of the input only needs to
+  // be buffered
+  if (data.size_bytes < private_data->n_bytes_needed) {
+    NANOARROW_RETURN_NOT_OK(ArrowBufferAppendBufferView(&private_data->input, data));
+    private_data->n_bytes_needed -= data.size_bytes;
+    return NANOARROW_OK;
+  }
+
+  // If nothing is buffered, messages are decoded directly from data and only what
+  // remains is copied
+  if (private_data->input.size_bytes == 0 && !private_data->delivering &&
+      data.data.data != NULL) {
+    private_data->chunk = data;
+  } else {
+    NANOARROW_RETURN_NOT_OK(ArrowBufferAppendBufferView(&private_data->input, data));
+  }
+
+  ArrowIpcPushReaderProcess(private_data);
+  return private_data->result;
+}
+
+int64_t ArrowIpcPushReaderBytesNeeded(struct ArrowIpcPushReader* reader) {
+  struct ArrowIpcPushReaderPrivate* private_data =
+      (struct ArrowIpcPushReaderPrivate*)reader->private_data;
+  if (private_data->done || private_data->input_finished) {
+    return 0;
+  }
+
+  return private_data->n_bytes_needed;
+}
+
+ArrowErrorCode ArrowIpcPushReaderFinish(struct ArrowIpcPushReader* reader) {
+  struct ArrowIpcPushReaderPrivate* private_data =
+      (struct ArrowIpcPushReaderPrivate*)reader->private_data;
+  if (private_data->done) {
+    return private_data->result;
+  }
+
+  private_data->input_finished = 1;
+  ArrowIpcPushReaderProcess(private_data);
+  return private_data->result;
+}
+
+void ArrowIpcPushReaderReset(struct ArrowIpcPushReader* reader) {
+  struct ArrowIpcPushReaderPrivate* private_data =
+      (struct ArrowIpcPushReaderPrivate*)reader->private_data;
+
+  if (private_data->handler.release != NULL) {
+    private_data->handler.on_error(&private_data->handler, ECANCELED,
+                                   "Reader was reset before the end of input");
+    private_data->handler.release(&private_data->handler);
+  }
+
+  ArrowIpcDecoderReset(&private_data->decoder);
+  ArrowBufferReset(&private_data->input);
+  ArrowIpcFieldPathsReset(&private_data->field_paths);
+  ArrowFree(private_data);
+  reader->private_data = NULL;
 }
@@ -17,7 +17,16 @@
 
 #include <gtest/gtest.h>
 
+#include <errno.h>
 #include <stdio.h>
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
 
 #include "nanoarrow_ipc.h"
 
@@ -93,124 +102,1127 @@ TEST(NanoarrowIpcReader, InputStreamBuffer) {
   EXPECT_EQ(stream.read(&stream, nullptr, 2, &size_read_bytes, nullptr), NANOARROW_OK);
   EXPECT_EQ(size_read_bytes, 0);
 
-  EXPECT_EQ(stream.read(&stream, nullptr, 0, &size_read_bytes, nullptr), NANOARROW_OK);
-  EXPECT_EQ(size_read_bytes, 0);
+  EXPECT_EQ(stream.read(&stream, nullptr, 0, &size_read_bytes, nullptr), NANOARROW_OK);
+  EXPECT_EQ(size_read_bytes, 0);
+
+  stream.release(&stream);
+}
+
+TEST(NanoarrowIpcReader, InputStreamFile) {
+  uint8_t input_data[] = {0x01, 0x02, 0x03, 0x04, 0x05};
+  FILE* file_ptr = tmpfile();
+  ASSERT_NE(file_ptr, nullptr);
+  ASSERT_EQ(fwrite(input_data, 1, sizeof(input_data), file_ptr), sizeof(input_data));
+  fseek(file_ptr, 0, SEEK_SET);
+
+  struct ArrowIpcInputStream stream;
+  uint8_t output_data[] = {0xff, 0xff, 0xff, 0xff, 0xff};
+  int64_t size_read_bytes;
+
+  ASSERT_EQ(ArrowIpcInputStreamInitFile(&stream, file_ptr, 1), NANOARROW_OK);
+
+  EXPECT_EQ(stream.read(&stream, output_data, 2, &size_read_bytes, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(size_read_bytes, 2);
+  uint8_t output_data1[] = {0x01, 0x02, 0xff, 0xff, 0xff};
+  EXPECT_EQ(memcmp(output_data, output_data1, sizeof(output_data)), 0);
+
+  EXPECT_EQ(stream.read(&stream, output_data + 2, 2, &size_read_bytes, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(size_read_bytes, 2);
+  uint8_t output_data2[] = {0x01, 0x02, 0x03, 0x04, 0xff};
+  EXPECT_EQ(memcmp(output_data, output_data2, sizeof(output_data)), 0);
+
+  EXPECT_EQ(stream.read(&stream, output_data + 4, 2, &size_read_bytes, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(size_read_bytes, 1);
+  uint8_t output_data3[] = {0x01, 0x02, 0x03, 0x04, 0x05};
+  EXPECT_EQ(memcmp(output_data, output_data3, sizeof(output_data)), 0);
+
+  EXPECT_EQ(stream.read(&stream, nullptr, 2, &size_read_bytes, nullptr), NANOARROW_OK);
+  EXPECT_EQ(size_read_bytes, 0);
+
+  EXPECT_EQ(stream.read(&stream, nullptr, 0, &size_read_bytes, nullptr), NANOARROW_OK);
+  EXPECT_EQ(size_read_bytes, 0);
+
+  stream.release(&stream);
+}
+
+#if !defined(_WIN32)
+TEST(NanoarrowIpcReader, InputStreamMmap) {
+  uint8_t input_data[] = {0x01, 0x02, 0x03, 0x04, 0x05};
+  FILE* file_ptr = tmpfile();
+  ASSERT_NE(file_ptr, nullptr);
+  ASSERT_EQ(fwrite(input_data, 1, sizeof(input_data), file_ptr), sizeof(input_data));
+  fflush(file_ptr);
+
+  // The mapping outlives the file descriptor
+  struct ArrowIpcInputStream stream;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcInputStreamInitMmap(&stream, fileno(file_ptr), &error), NANOARROW_OK)
+      << error.message;
+  fclose(file_ptr);
+
+  uint8_t output_data[] = {0xff, 0xff, 0xff, 0xff, 0xff};
+  int64_t size_read_bytes;
+  EXPECT_EQ(stream.read(&stream, output_data, 4, &size_read_bytes, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(size_read_bytes, 4);
+  EXPECT_EQ(stream.read(&stream, output_data + 4, 2, &size_read_bytes, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(size_read_bytes, 1);
+  EXPECT_EQ(memcmp(output_data, input_data, sizeof(output_data)), 0);
+  EXPECT_EQ(stream.read(&stream, nullptr, 2, &size_read_bytes, nullptr), NANOARROW_OK);
+  EXPECT_EQ(size_read_bytes, 0);
+  stream.release(&stream);
+
+  // An empty file is an empty stream
+  file_ptr = tmpfile();
+  ASSERT_NE(file_ptr, nullptr);
+  ASSERT_EQ(ArrowIpcInputStreamInitMmap(&stream, fileno(file_ptr), &error), NANOARROW_OK)
+      << error.message;
+  fclose(file_ptr);
+  EXPECT_EQ(stream.read(&stream, output_data, 2, &size_read_bytes, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(size_read_bytes, 0);
+  stream.release(&stream);
+
+  EXPECT_EQ(ArrowIpcInputStreamInitMmap(&stream, -1, &error), EBADF);
+}
+
+TEST(NanoarrowIpcReader, InputStreamFileDescriptor) {
+  uint8_t input_data[] = {0x01, 0x02, 0x03, 0x04, 0x05};
+  FILE* file_ptr = tmpfile();
+  ASSERT_NE(file_ptr, nullptr);
+  ASSERT_EQ(fwrite(input_data, 1, sizeof(input_data), file_ptr), sizeof(input_data));
+  fflush(file_ptr);
+
+  // Reads start at the current offset of the file descriptor
+  ASSERT_EQ(lseek(fileno(file_ptr), 1, SEEK_SET), 1);
+
+  struct ArrowIpcInputStream stream;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcInputStreamInitFileDescriptor(&stream, fileno(file_ptr), 0, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  uint8_t output_data[] = {0xff, 0xff, 0xff, 0xff, 0xff};
+  int64_t size_read_bytes;
+  EXPECT_EQ(stream.read(&stream, output_data, 2, &size_read_bytes, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(size_read_bytes, 2);
+  EXPECT_EQ(stream.read(&stream, output_data + 2, 3, &size_read_bytes, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(size_read_bytes, 2);
+  uint8_t output_data1[] = {0x02, 0x03, 0x04, 0x05, 0xff};
+  EXPECT_EQ(memcmp(output_data, output_data1, sizeof(output_data)), 0);
+  EXPECT_EQ(stream.read(&stream, output_data, 2, &size_read_bytes, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(size_read_bytes, 0);
+  EXPECT_EQ(stream.read(&stream, nullptr, 0, &size_read_bytes, &error), NANOARROW_OK);
+  EXPECT_EQ(size_read_bytes, 0);
+  stream.release(&stream);
+
+  // The offset of the file descriptor was not advanced and it was not closed
+  EXPECT_EQ(lseek(fileno(file_ptr), 0, SEEK_CUR), 1);
+  fclose(file_ptr);
+
+  // Pipes are read with read()
+  int pipe_fds[2];
+  ASSERT_EQ(pipe(pipe_fds), 0);
+  ASSERT_EQ(write(pipe_fds[1], input_data, sizeof(input_data)),
+            static_cast<ssize_t>(sizeof(input_data)));
+  close(pipe_fds[1]);
+
+  ASSERT_EQ(ArrowIpcInputStreamInitFileDescriptor(&stream, pipe_fds[0], 1, &error),
+            NANOARROW_OK)
+      << error.message;
+  memset(output_data, 0xff, sizeof(output_data));
+  EXPECT_EQ(stream.read(&stream, output_data, 4, &size_read_bytes, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(size_read_bytes, 4);
+  EXPECT_EQ(stream.read(&stream, output_data + 4, 2, &size_read_bytes, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(size_read_bytes, 1);
+  EXPECT_EQ(memcmp(output_data, input_data, sizeof(output_data)), 0);
+  stream.release(&stream);
+
+  EXPECT_EQ(ArrowIpcInputStreamInitFileDescriptor(&stream, -1, 0, &error), EBADF);
+}
+
+TEST(NanoarrowIpcReader, StreamReaderFileDescriptor) {
+  FILE* file_ptr = tmpfile();
+  ASSERT_NE(file_ptr, nullptr);
+  ASSERT_EQ(fwrite(kSimpleSchema, 1, sizeof(kSimpleSchema), file_ptr),
+            sizeof(kSimpleSchema));
+  ASSERT_EQ(fwrite(kSimpleRecordBatch, 1, sizeof(kSimpleRecordBatch), file_ptr),
+            sizeof(kSimpleRecordBatch));
+  fflush(file_ptr);
+  ASSERT_EQ(lseek(fileno(file_ptr), 0, SEEK_SET), 0);
+
+  // The stream owns its own file descriptor
+  struct ArrowIpcInputStream input;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcInputStreamInitFileDescriptor(&input, dup(fileno(file_ptr)), 1,
+                                                  &error),
+            NANOARROW_OK)
+      << error.message;
+  fclose(file_ptr);
+
+  struct ArrowArrayStream stream;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, nullptr), NANOARROW_OK);
+
+  struct ArrowSchema schema;
+  ASSERT_EQ(stream.get_schema(&stream, &schema), NANOARROW_OK)
+      << stream.get_last_error(&stream);
+  EXPECT_STREQ(schema.format, "+s");
+  schema.release(&schema);
+
+  struct ArrowArray array;
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.length, 3);
+  array.release(&array);
+
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.release, nullptr);
+
+  stream.release(&stream);
+}
+
+TEST(NanoarrowIpcReader, StreamReaderMmap) {
+  FILE* file_ptr = tmpfile();
+  ASSERT_NE(file_ptr, nullptr);
+  ASSERT_EQ(fwrite(kSimpleSchema, 1, sizeof(kSimpleSchema), file_ptr),
+            sizeof(kSimpleSchema));
+  for (int i = 0; i < 2; i++) {
+    ASSERT_EQ(fwrite(kSimpleRecordBatch, 1, sizeof(kSimpleRecordBatch), file_ptr),
+              sizeof(kSimpleRecordBatch));
+  }
+  ASSERT_EQ(fwrite(kEndOfStream, 1, sizeof(kEndOfStream), file_ptr),
+            sizeof(kEndOfStream));
+  fflush(file_ptr);
+
+  for (int use_shared_buffers = 0; use_shared_buffers < 2; use_shared_buffers++) {
+    struct ArrowIpcInputStream input;
+    struct ArrowError error;
+    ASSERT_EQ(ArrowIpcInputStreamInitMmap(&input, fileno(file_ptr), &error),
+              NANOARROW_OK)
+        << error.message;
+
+    struct ArrowArrayStream stream;
+    struct ArrowIpcArrayStreamReaderOptions options;
+    ArrowIpcArrayStreamReaderOptionsInit(&options);
+    options.use_shared_buffers = use_shared_buffers;
+    ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
+
+    struct ArrowSchema schema;
+    ASSERT_EQ(stream.get_schema(&stream, &schema), NANOARROW_OK);
+    EXPECT_STREQ(schema.format, "+s");
+    schema.release(&schema);
+
+    struct ArrowArray arrays[2];
+    for (int i = 0; i < 2; i++) {
+      ASSERT_EQ(stream.get_next(&stream, &arrays[i]), NANOARROW_OK)
+          << stream.get_last_error(&stream);
+      ASSERT_NE(arrays[i].release, nullptr);
+    }
+
+    struct ArrowArray array;
+    ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+    EXPECT_EQ(array.release, nullptr);
+    stream.release(&stream);
+
+    // Arrays remain valid after the stream (and its mapping) have been released
+    for (int i = 0; i < 2; i++) {
+      ASSERT_EQ(arrays[i].length, 3);
+      const int32_t* values =
+          reinterpret_cast<const int32_t*>(arrays[i].children[0]->buffers[1]);
+      EXPECT_EQ(values[0], 1);
+      EXPECT_EQ(values[2], 3);
+      arrays[i].release(&arrays[i]);
+    }
+  }
+
+  fclose(file_ptr);
+}
+
+#if !defined(_WIN32)
+static ArrowErrorCode WriteToRing(struct ArrowIpcOutputStream* output,
+                                  const uint8_t* data, int64_t size_bytes) {
+  struct ArrowBufferView view;
+  view.data.as_uint8 = data;
+  view.size_bytes = size_bytes;
+  return output->write(output, &view, 1, nullptr);
+}
+
+TEST(NanoarrowIpcReader, StreamReaderSharedRing) {
+  FILE* file_ptr = tmpfile();
+  ASSERT_NE(file_ptr, nullptr);
+  struct ArrowIpcOutputStream output;
+  struct ArrowError error;
+  int result =
+      ArrowIpcOutputStreamInitSharedRing(&output, fileno(file_ptr), 4096, &error);
+  if (result == ENOTSUP) {
+    fclose(file_ptr);
+    GTEST_SKIP() << error.message;
+  }
+  ASSERT_EQ(result, NANOARROW_OK) << error.message;
+
+  ASSERT_EQ(WriteToRing(&output, kSimpleSchema, sizeof(kSimpleSchema)), NANOARROW_OK);
+  ASSERT_EQ(WriteToRing(&output, kSimpleRecordBatch, sizeof(kSimpleRecordBatch)),
+            NANOARROW_OK);
+  output.release(&output);
+
+  struct ArrowIpcInputStream input;
+  ASSERT_EQ(ArrowIpcInputStreamInitSharedRing(&input, fileno(file_ptr), &error),
+            NANOARROW_OK)
+      << error.message;
+  struct ArrowArrayStream stream;
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.use_shared_buffers = 1;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
+
+  struct ArrowArray array;
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK)
+      << stream.get_last_error(&stream);
+  ASSERT_EQ(array.length, 3);
+  struct ArrowArray end;
+  ASSERT_EQ(stream.get_next(&stream, &end), NANOARROW_OK);
+  EXPECT_EQ(end.release, nullptr);
+  stream.release(&stream);
+
+  // The array references the ring (which outlives the stream) without copying, so
+  // modifying the bytes of the file modifies the array
+  const int32_t* values = reinterpret_cast<const int32_t*>(array.children[0]->buffers[1]);
+  EXPECT_EQ(values[0], 1);
+  fseek(file_ptr, 0, SEEK_END);
+  std::vector<uint8_t> contents(ftell(file_ptr));
+  ASSERT_EQ(pread(fileno(file_ptr), contents.data(), contents.size(), 0),
+            static_cast<ssize_t>(contents.size()));
+  const uint8_t kValues[] = {1, 0, 0, 0, 2, 0, 0, 0, 3, 0, 0, 0};
+  auto found = std::search(contents.begin(), contents.end(), kValues, kValues + 12);
+  ASSERT_NE(found, contents.end());
+  int32_t new_value = 42;
+  ASSERT_EQ(pwrite(fileno(file_ptr), &new_value, sizeof(new_value),
+                   found - contents.begin()),
+            static_cast<ssize_t>(sizeof(new_value)));
+  EXPECT_EQ(values[0], 42);
+  array.release(&array);
+
+  // Not a shared ring
+  FILE* other_ptr = tmpfile();
+  ASSERT_NE(other_ptr, nullptr);
+  ASSERT_EQ(fwrite(kSimpleSchema, 1, sizeof(kSimpleSchema), other_ptr),
+            sizeof(kSimpleSchema));
+  fflush(other_ptr);
+  EXPECT_EQ(ArrowIpcInputStreamInitSharedRing(&input, fileno(other_ptr), &error),
+            EINVAL);
+  fclose(other_ptr);
+  fclose(file_ptr);
+}
+
+TEST(NanoarrowIpcReader, StreamReaderSharedRingBackpressure) {
+  // The ring has room for only a few messages, such that the writer must wait for the
+  // reader to release the arrays that reference earlier messages
+  const int64_t n_batches = 100;
+  for (int use_shared_buffers = 0; use_shared_buffers < 2; use_shared_buffers++) {
+    SCOPED_TRACE("use_shared_buffers: " + std::to_string(use_shared_buffers));
+    FILE* file_ptr = tmpfile();
+    ASSERT_NE(file_ptr, nullptr);
+    struct ArrowIpcOutputStream output;
+    struct ArrowError error;
+    int result = ArrowIpcOutputStreamInitSharedRing(&output, fileno(file_ptr), 1000,
+                                                    &error);
+    if (result == ENOTSUP) {
+      fclose(file_ptr);
+      GTEST_SKIP() << error.message;
+    }
+    ASSERT_EQ(result, NANOARROW_OK) << error.message;
+
+    // Messages that can never fit are rejected
+    std::vector<uint8_t> too_big(1024, 0);
+    EXPECT_EQ(WriteToRing(&output, too_big.data(), too_big.size()), EINVAL);
+
+    struct ArrowIpcInputStream input;
+    ASSERT_EQ(ArrowIpcInputStreamInitSharedRing(&input, fileno(file_ptr), &error),
+              NANOARROW_OK)
+        << error.message;
+    fclose(file_ptr);
+
+    int write_result = NANOARROW_OK;
+    std::thread writer([&] {
+      write_result = WriteToRing(&output, kSimpleSchema, sizeof(kSimpleSchema));
+      for (int64_t i = 0; i < n_batches && write_result == NANOARROW_OK; i++) {
+        write_result =
+            WriteToRing(&output, kSimpleRecordBatch, sizeof(kSimpleRecordBatch));
+      }
+      if (write_result == NANOARROW_OK) {
+        write_result = WriteToRing(&output, kEndOfStream, sizeof(kEndOfStream));
+      }
+      output.release(&output);
+    });
+
+    struct ArrowArrayStream stream;
+    struct ArrowIpcArrayStreamReaderOptions options;
+    ArrowIpcArrayStreamReaderOptionsInit(&options);
+    options.use_shared_buffers = use_shared_buffers;
+    ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
+
+    // Keep the two most recent arrays alive while reading the next
+    struct ArrowArray arrays[3];
+    for (auto& array : arrays) {
+      array.release = nullptr;
+    }
+
+    int64_t n_read = 0;
+    while (true) {
+      struct ArrowArray* array = arrays + (n_read % 3);
+      if (array->release != nullptr) {
+        array->release(array);
+      }
+
+      ASSERT_EQ(stream.get_next(&stream, array), NANOARROW_OK)
+          << stream.get_last_error(&stream);
+      if (array->release == nullptr) {
+        break;
+      }
+
+      ASSERT_EQ(array->length, 3);
+      const int32_t* values =
+          reinterpret_cast<const int32_t*>(array->children[0]->buffers[1]);
+      EXPECT_EQ(values[0], 1);
+      EXPECT_EQ(values[2], 3);
+      n_read++;
+    }
+
+    for (auto& array : arrays) {
+      if (array.release != nullptr) {
+        array.release(&array);
+      }
+    }
+
+    stream.release(&stream);
+    writer.join();
+    EXPECT_EQ(write_result, NANOARROW_OK);
+    EXPECT_EQ(n_read, n_batches);
+  }
+}
+#endif
+
+TEST(NanoarrowIpcReader, StreamReaderMmapIncompleteMessageBody) {
+  FILE* file_ptr = tmpfile();
+  ASSERT_NE(file_ptr, nullptr);
+  ASSERT_EQ(fwrite(kSimpleSchema, 1, sizeof(kSimpleSchema), file_ptr),
+            sizeof(kSimpleSchema));
+  ASSERT_EQ(fwrite(kSimpleRecordBatch, 1, sizeof(kSimpleRecordBatch) - 1, file_ptr),
+            sizeof(kSimpleRecordBatch) - 1);
+  fflush(file_ptr);
+
+  struct ArrowIpcInputStream input;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcInputStreamInitMmap(&input, fileno(file_ptr), &error), NANOARROW_OK)
+      << error.message;
+  fclose(file_ptr);
+
+  struct ArrowArrayStream stream;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, nullptr), NANOARROW_OK);
+
+  struct ArrowArray array;
+  ASSERT_EQ(stream.get_next(&stream, &array), ESPIPE);
+  EXPECT_STREQ(stream.get_last_error(&stream),
+               "Expected to be able to read 16 bytes for message body but got 15");
+
+  stream.release(&stream);
+}
+#endif
+
+TEST(NanoarrowIpcReader, StreamReaderBasic) {
+  struct ArrowBuffer input_buffer;
+  ArrowBufferInit(&input_buffer);
+  ASSERT_EQ(ArrowBufferAppend(&input_buffer, kSimpleSchema, sizeof(kSimpleSchema)),
+            NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowBufferAppend(&input_buffer, kSimpleRecordBatch, sizeof(kSimpleRecordBatch)),
+      NANOARROW_OK);
+
+  struct ArrowIpcInputStream input;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
+
+  struct ArrowArrayStream stream;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, nullptr), NANOARROW_OK);
+
+  struct ArrowSchema schema;
+
+  ASSERT_EQ(stream.get_schema(&stream, &schema), NANOARROW_OK);
+  EXPECT_STREQ(schema.format, "+s");
+  schema.release(&schema);
+
+  struct ArrowArray array;
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.length, 3);
+  array.release(&array);
+
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.release, nullptr);
+
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.release, nullptr);
+
+  stream.release(&stream);
+}
+
+TEST(NanoarrowIpcReader, StreamReaderBufferZeroCopy) {
+  struct ArrowBuffer input_buffer;
+  ArrowBufferInit(&input_buffer);
+  ASSERT_EQ(ArrowBufferAppend(&input_buffer, kSimpleSchema, sizeof(kSimpleSchema)),
+            NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowBufferAppend(&input_buffer, kSimpleRecordBatch, sizeof(kSimpleRecordBatch)),
+      NANOARROW_OK);
+  const uint8_t* input_begin = input_buffer.data;
+  const uint8_t* input_end = input_begin + input_buffer.size_bytes;
+
+  struct ArrowIpcInputStream input;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
+
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.use_shared_buffers = 1;
+
+  struct ArrowArrayStream stream;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
+
+  struct ArrowArray array;
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  ASSERT_EQ(array.n_children, 1);
+  const uint8_t* values = reinterpret_cast<const uint8_t*>(array.children[0]->buffers[1]);
+  EXPECT_GE(values, input_begin);
+  EXPECT_LT(values, input_end);
+
+  // The array must keep the input alive after the stream is released
+  stream.release(&stream);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(values)[2], 3);
+  array.release(&array);
+}
+
+TEST(NanoarrowIpcReader, StreamReaderBasicNoSharedBuffers) {
+  struct ArrowBuffer input_buffer;
+  ArrowBufferInit(&input_buffer);
+  ASSERT_EQ(ArrowBufferAppend(&input_buffer, kSimpleSchema, sizeof(kSimpleSchema)),
+            NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowBufferAppend(&input_buffer, kSimpleRecordBatch, sizeof(kSimpleRecordBatch)),
+      NANOARROW_OK);
+
+  struct ArrowIpcInputStream input;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
+
+  struct ArrowArrayStream stream;
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.use_shared_buffers = 0;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
+
+  struct ArrowSchema schema;
+  ASSERT_EQ(stream.get_schema(&stream, &schema), NANOARROW_OK);
+  EXPECT_STREQ(schema.format, "+s");
+  schema.release(&schema);
+
+  struct ArrowArray array;
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.length, 3);
+  array.release(&array);
+
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.release, nullptr);
+
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.release, nullptr);
+
+  stream.release(&stream);
+}
+
+// Copies bodies to a separate allocation (standing in for device memory) and records
+// where the last copy was placed
+struct CopyBodyCounter {
+  int64_t n_copies;
+  const uint8_t* last_copy;
+  int64_t last_copy_size;
+  int result;
+};
+
+static ArrowErrorCode CopyBodyCounting(void* private_data, struct ArrowBufferView body,
+                                       struct ArrowBuffer* out,
+                                       struct ArrowError* error) {
+  auto counter = reinterpret_cast<CopyBodyCounter*>(private_data);
+  if (counter->result != NANOARROW_OK) {
+    ArrowErrorSet(error, "copy failed");
+    return counter->result;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowBufferAppendBufferView(out, body));
+  counter->n_copies++;
+  counter->last_copy = out->data;
+  counter->last_copy_size = out->size_bytes;
+  return NANOARROW_OK;
+}
+
+TEST(NanoarrowIpcReader, StreamReaderCopyBody) {
+  std::vector<uint8_t> data(kSimpleSchema, kSimpleSchema + sizeof(kSimpleSchema));
+  data.insert(data.end(), kSimpleRecordBatch,
+              kSimpleRecordBatch + sizeof(kSimpleRecordBatch));
+
+  CopyBodyCounter counter{0, nullptr, 0, NANOARROW_OK};
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.use_shared_buffers = 1;
+  options.copy_body = &CopyBodyCounting;
+  options.copy_body_private_data = &counter;
+
+  struct ArrowBuffer input_buffer;
+  ArrowBufferInit(&input_buffer);
+  ASSERT_EQ(ArrowBufferAppend(&input_buffer, data.data(), data.size()), NANOARROW_OK);
+  struct ArrowIpcInputStream input;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
+
+  struct ArrowArrayStream stream;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
+
+  // Every buffer of the array points into the copy of the body
+  struct ArrowArray array;
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  EXPECT_EQ(counter.n_copies, 1);
+  ASSERT_EQ(array.n_children, 1);
+  ASSERT_EQ(array.children[0]->length, 3);
+  auto values = reinterpret_cast<const uint8_t*>(array.children[0]->buffers[1]);
+  EXPECT_GE(values, counter.last_copy);
+  EXPECT_LE(values + 3 * sizeof(int32_t), counter.last_copy + counter.last_copy_size);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(values)[2], 3);
+  array.release(&array);
+
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.release, nullptr);
+  stream.release(&stream);
+
+  // Errors from copy_body are propagated
+  counter.result = EIO;
+  ArrowBufferInit(&input_buffer);
+  ASSERT_EQ(ArrowBufferAppend(&input_buffer, data.data(), data.size()), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
+  EXPECT_EQ(stream.get_next(&stream, &array), EIO);
+  EXPECT_STREQ(stream.get_last_error(&stream), "copy failed");
+  stream.release(&stream);
+
+  // Device bodies can't be decoded without shared buffers
+  options.use_shared_buffers = 0;
+  ArrowBufferInit(&input_buffer);
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), EINVAL);
+  input.release(&input);
+}
+
+TEST(NanoarrowIpcReader, StreamReaderStats) {
+  struct ArrowBuffer input_buffer;
+  ArrowBufferInit(&input_buffer);
+  ASSERT_EQ(ArrowBufferAppend(&input_buffer, kSimpleSchema, sizeof(kSimpleSchema)),
+            NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowBufferAppend(&input_buffer, kSimpleRecordBatch, sizeof(kSimpleRecordBatch)),
+      NANOARROW_OK);
+
+  struct ArrowIpcInputStream input;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
+
+  struct ArrowArrayStream stream;
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.use_shared_buffers = 0;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
+
+  struct ArrowArray array;
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  array.release(&array);
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.release, nullptr);
+
+  struct ArrowIpcStats stats;
+#if defined(NANOARROW_IPC_WITH_STATS)
+  ASSERT_EQ(ArrowIpcArrayStreamReaderGetStats(&stream, &stats), NANOARROW_OK);
+  EXPECT_GT(stats.n_reads, 0);
+  EXPECT_EQ(stats.n_bytes_read, sizeof(kSimpleSchema) + sizeof(kSimpleRecordBatch));
+  EXPECT_EQ(stats.n_messages, 2);
+
+  // The int32 data buffer is copied out of the body (the validity buffer is empty)
+  EXPECT_EQ(stats.n_buffers_shared, 0);
+  EXPECT_EQ(stats.n_bytes_shared, 0);
+  EXPECT_EQ(stats.n_buffers_allocated, 1);
+  EXPECT_EQ(stats.n_bytes_copied, 3 * sizeof(int32_t));
+  EXPECT_GE(stats.read_ns, 0);
+  EXPECT_GE(stats.decode_body_ns, 0);
+#else
+  EXPECT_EQ(ArrowIpcArrayStreamReaderGetStats(&stream, &stats), ENOTSUP);
+#endif
+
+  stream.release(&stream);
+
+  // Streams that are not IPC readers are rejected
+  struct ArrowSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowBasicArrayStreamInit(&stream, &schema, 0), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcArrayStreamReaderGetStats(&stream, &stats), EINVAL);
+  stream.release(&stream);
+}
+
+TEST(NanoarrowIpcReader, StreamReaderTrustedInput) {
+  struct ArrowBuffer input_buffer;
+  ArrowBufferInit(&input_buffer);
+  ASSERT_EQ(ArrowBufferAppend(&input_buffer, kSimpleSchema, sizeof(kSimpleSchema)),
+            NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowBufferAppend(&input_buffer, kSimpleRecordBatch, sizeof(kSimpleRecordBatch)),
+      NANOARROW_OK);
+
+  struct ArrowIpcInputStream input;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
+
+  struct ArrowArrayStream stream;
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  EXPECT_EQ(options.verification_level, NANOARROW_IPC_VERIFICATION_LEVEL_FULL);
+  options.verification_level = static_cast<enum ArrowIpcVerificationLevel>(-1);
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), EINVAL);
+
+  options.verification_level = NANOARROW_IPC_VERIFICATION_LEVEL_TRUSTED;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
+
+  struct ArrowSchema schema;
+  ASSERT_EQ(stream.get_schema(&stream, &schema), NANOARROW_OK);
+  EXPECT_STREQ(schema.format, "+s");
+  schema.release(&schema);
+
+  struct ArrowArray array;
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.length, 3);
+  array.release(&array);
+
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.release, nullptr);
+
+  stream.release(&stream);
+}
+
+// Writes a stream of one batch {a: int32, b: string} whose string offsets decrease,
+// which is only detected by full validation of b
+static void WriteStreamWithInvalidOffsets(struct ArrowBuffer* output,
+                                          struct ArrowSchema* schema) {
+  ArrowSchemaInit(schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0], "a"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[1], "b"), NANOARROW_OK);
+
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (const char* value : {"ab", "c", "def"}) {
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 1), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView(value)),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  reinterpret_cast<int32_t*>(ArrowArrayBuffer(array.children[1], 1)->data)[2] = 1;
+
+  struct ArrowArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+
+  ArrowBufferInit(output);
+  struct ArrowIpcOutputStream output_stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, output), NANOARROW_OK);
+  struct ArrowIpcWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(&writer, schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteArrayView(&writer, &array_view, nullptr), NANOARROW_OK);
+  ArrowIpcWriterReset(&writer);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+}
+
+TEST(NanoarrowIpcReader, StreamReaderDeferValidation) {
+  struct ArrowBuffer output;
+  struct ArrowSchema schema;
+  ASSERT_NO_FATAL_FAILURE(WriteStreamWithInvalidOffsets(&output, &schema));
+  struct ArrowBuffer input_buffer;
+  ArrowBufferInit(&input_buffer);
+  ASSERT_EQ(ArrowBufferAppend(&input_buffer, output.data, output.size_bytes),
+            NANOARROW_OK);
+
+  // By default, the whole batch is validated before it is returned
+  struct ArrowIpcInputStream input;
+  struct ArrowArrayStream stream;
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &output), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, nullptr), NANOARROW_OK);
+  EXPECT_EQ(stream.get_next(&stream, &array), EINVAL);
+  stream.release(&stream);
+
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  EXPECT_EQ(options.defer_validation, 0);
+  options.defer_validation = 1;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK)
+      << stream.get_last_error(&stream);
+
+  struct ArrowIpcBatchView batch_view;
+  struct ArrowArrayView* column;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcBatchViewInit(&batch_view, schema.children[0], &error), EINVAL);
+  ASSERT_EQ(ArrowIpcBatchViewInit(&batch_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcBatchViewSetArray(&batch_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcBatchViewGetColumn(&batch_view, 2, &column, &error), EINVAL);
+
+  // Only the column that is accessed is validated and its error refers to it
+  ASSERT_EQ(ArrowIpcBatchViewGetColumn(&batch_view, 0, &column, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(column, 2), 1);
+  EXPECT_EQ(batch_view.validated.data[0], 1);
+  EXPECT_EQ(batch_view.validated.data[1], 0);
+  EXPECT_EQ(ArrowIpcBatchViewGetColumn(&batch_view, 1, &column, &error), EINVAL);
+  EXPECT_EQ(std::string(error.message).find("Column 1 is invalid: "), 0)
+      << error.message;
+  EXPECT_EQ(ArrowIpcBatchViewGetColumn(&batch_view, 1, &column, &error), EINVAL);
+
+  // Setting a new batch marks every column as not yet validated
+  ASSERT_EQ(ArrowIpcBatchViewSetArray(&batch_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(batch_view.validated.data[0], 0);
+
+  ArrowIpcBatchViewReset(&batch_view);
+  array.release(&array);
+  stream.release(&stream);
+  schema.release(&schema);
+}
+
+// An input stream that counts the calls to read() of the stream it wraps
+struct CountingInputStream {
+  struct ArrowIpcInputStream wrapped;
+  int64_t n_reads;
+};
+
+static ArrowErrorCode CountingInputStreamRead(struct ArrowIpcInputStream* stream,
+                                              uint8_t* buf, int64_t buf_size_bytes,
+                                              int64_t* size_read_out,
+                                              struct ArrowError* error) {
+  auto private_data = reinterpret_cast<CountingInputStream*>(stream->private_data);
+  private_data->n_reads++;
+  return private_data->wrapped.read(&private_data->wrapped, buf, buf_size_bytes,
+                                    size_read_out, error);
+}
+
+static void CountingInputStreamRelease(struct ArrowIpcInputStream* stream) {
+  auto private_data = reinterpret_cast<CountingInputStream*>(stream->private_data);
+  private_data->wrapped.release(&private_data->wrapped);
+  stream->release = nullptr;
+}
+
+static int64_t ReadAllCountingReads(const std::vector<uint8_t>& data,
+                                    int64_t read_ahead_bytes, int64_t* n_batches) {
+  struct ArrowBuffer input_buffer;
+  ArrowBufferInit(&input_buffer);
+  EXPECT_EQ(ArrowBufferAppend(&input_buffer, data.data(), data.size()), NANOARROW_OK);
+
+  CountingInputStream counting;
+  counting.n_reads = 0;
+  EXPECT_EQ(ArrowIpcInputStreamInitBuffer(&counting.wrapped, &input_buffer),
+            NANOARROW_OK);
+  struct ArrowIpcInputStream input;
+  input.read = &CountingInputStreamRead;
+  input.release = &CountingInputStreamRelease;
+  input.private_data = &counting;
+
+  struct ArrowArrayStream stream;
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.read_ahead_bytes = read_ahead_bytes;
+  EXPECT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
+
+  struct ArrowSchema schema;
+  EXPECT_EQ(stream.get_schema(&stream, &schema), NANOARROW_OK);
+  EXPECT_STREQ(schema.format, "+s");
+  schema.release(&schema);
+
+  *n_batches = 0;
+  struct ArrowArray array;
+  while (true) {
+    EXPECT_EQ(stream.get_next(&stream, &array), NANOARROW_OK)
+        << stream.get_last_error(&stream);
+    if (array.release == nullptr) {
+      break;
+    }
+
+    EXPECT_EQ(array.length, 3);
+    EXPECT_EQ(array.n_children, 1);
+    const int32_t* values =
+        reinterpret_cast<const int32_t*>(array.children[0]->buffers[1]);
+    EXPECT_EQ(values[0], 1);
+    EXPECT_EQ(values[1], 2);
+    EXPECT_EQ(values[2], 3);
+    array.release(&array);
+    (*n_batches)++;
+  }
 
   stream.release(&stream);
+  return counting.n_reads;
 }
 
-TEST(NanoarrowIpcReader, InputStreamFile) {
-  uint8_t input_data[] = {0x01, 0x02, 0x03, 0x04, 0x05};
-  FILE* file_ptr = tmpfile();
-  ASSERT_NE(file_ptr, nullptr);
-  ASSERT_EQ(fwrite(input_data, 1, sizeof(input_data), file_ptr), sizeof(input_data));
-  fseek(file_ptr, 0, SEEK_SET);
+// An allocator that counts its allocations and returns 128-byte aligned memory
+static int64_t n_body_allocations = 0;
 
-  struct ArrowIpcInputStream stream;
-  uint8_t output_data[] = {0xff, 0xff, 0xff, 0xff, 0xff};
-  int64_t size_read_bytes;
+static uint8_t* CountingBodyReallocate(struct ArrowBufferAllocator* allocator,
+                                       uint8_t* ptr, int64_t old_size,
+                                       int64_t new_size) {
+  auto aligned = reinterpret_cast<struct ArrowBufferAllocator*>(allocator->private_data);
+  n_body_allocations++;
+  return aligned->reallocate(aligned, ptr, old_size, new_size);
+}
 
-  ASSERT_EQ(ArrowIpcInputStreamInitFile(&stream, file_ptr, 1), NANOARROW_OK);
+static void CountingBodyFree(struct ArrowBufferAllocator* allocator, uint8_t* ptr,
+                             int64_t size) {
+  auto aligned = reinterpret_cast<struct ArrowBufferAllocator*>(allocator->private_data);
+  aligned->free(aligned, ptr, size);
+}
 
-  EXPECT_EQ(stream.read(&stream, output_data, 2, &size_read_bytes, nullptr),
-            NANOARROW_OK);
-  EXPECT_EQ(size_read_bytes, 2);
-  uint8_t output_data1[] = {0x01, 0x02, 0xff, 0xff, 0xff};
-  EXPECT_EQ(memcmp(output_data, output_data1, sizeof(output_data)), 0);
+TEST(NanoarrowIpcReader, StreamReaderBodyAlignment) {
+  std::vector<uint8_t> data;
+  data.insert(data.end(), kSimpleSchema, kSimpleSchema + sizeof(kSimpleSchema));
+  for (int i = 0; i < 3; i++) {
+    data.insert(data.end(), kSimpleRecordBatch,
+                kSimpleRecordBatch + sizeof(kSimpleRecordBatch));
+  }
 
-  EXPECT_EQ(stream.read(&stream, output_data + 2, 2, &size_read_bytes, nullptr),
-            NANOARROW_OK);
-  EXPECT_EQ(size_read_bytes, 2);
-  uint8_t output_data2[] = {0x01, 0x02, 0x03, 0x04, 0xff};
-  EXPECT_EQ(memcmp(output_data, output_data2, sizeof(output_data)), 0);
+  struct ArrowBufferAllocator aligned = ArrowBufferAllocatorAligned(128);
+  struct ArrowBufferAllocator counting;
+  counting.reallocate = &CountingBodyReallocate;
+  counting.free = &CountingBodyFree;
+  counting.private_data = &aligned;
 
-  EXPECT_EQ(stream.read(&stream, output_data + 4, 2, &size_read_bytes, nullptr),
-            NANOARROW_OK);
-  EXPECT_EQ(size_read_bytes, 1);
-  uint8_t output_data3[] = {0x01, 0x02, 0x03, 0x04, 0x05};
-  EXPECT_EQ(memcmp(output_data, output_data3, sizeof(output_data)), 0);
+  for (int64_t alignment : {-1, 0, 64, 128}) {
+    SCOPED_TRACE("alignment: " + std::to_string(alignment));
+    struct ArrowBuffer input_buffer;
+    ArrowBufferInit(&input_buffer);
+    ASSERT_EQ(ArrowBufferAppend(&input_buffer, data.data(), data.size()), NANOARROW_OK);
+
+    // Wrapping the buffer input ensures that bodies are read into memory rather than
+    // decoded in place
+    CountingInputStream counting_input;
+    counting_input.n_reads = 0;
+    ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&counting_input.wrapped, &input_buffer),
+              NANOARROW_OK);
+    struct ArrowIpcInputStream input;
+    input.read = &CountingInputStreamRead;
+    input.release = &CountingInputStreamRelease;
+    input.private_data = &counting_input;
+
+    struct ArrowIpcArrayStreamReaderOptions options;
+    ArrowIpcArrayStreamReaderOptionsInit(&options);
+    EXPECT_EQ(options.body_alignment, 64);
+    options.use_shared_buffers = 1;
+    if (alignment == -1) {
+      options.body_allocator = &counting;
+    } else {
+      options.body_alignment = alignment;
+    }
+
+    struct ArrowArrayStream stream;
+    n_body_allocations = 0;
+    ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
+
+    // Each batch keeps its own body alive, so every body is newly allocated
+    std::vector<struct ArrowArray> arrays(3);
+    for (auto& array : arrays) {
+      ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK)
+          << stream.get_last_error(&stream);
+      ASSERT_NE(array.release, nullptr);
+      ASSERT_EQ(array.length, 3);
+      const int32_t* values =
+          reinterpret_cast<const int32_t*>(array.children[0]->buffers[1]);
+      EXPECT_EQ(values[2], 3);
+      if (alignment != 0) {
+        int64_t expected = alignment == -1 ? 128 : alignment;
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(values) % expected, 0);
+      }
+    }
 
-  EXPECT_EQ(stream.read(&stream, nullptr, 2, &size_read_bytes, nullptr), NANOARROW_OK);
-  EXPECT_EQ(size_read_bytes, 0);
+    stream.release(&stream);
+    for (auto& array : arrays) {
+      array.release(&array);
+    }
 
-  EXPECT_EQ(stream.read(&stream, nullptr, 0, &size_read_bytes, nullptr), NANOARROW_OK);
-  EXPECT_EQ(size_read_bytes, 0);
+    if (alignment == -1) {
+      EXPECT_EQ(n_body_allocations, 3);
+    }
+  }
 
-  stream.release(&stream);
+  struct ArrowBuffer input_buffer;
+  ArrowBufferInit(&input_buffer);
+  struct ArrowIpcInputStream input;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.body_alignment = -1;
+  struct ArrowArrayStream stream;
+  EXPECT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), EINVAL);
+  input.release(&input);
 }
 
-TEST(NanoarrowIpcReader, StreamReaderBasic) {
+TEST(NanoarrowIpcReader, StreamReaderReadAhead) {
+  std::vector<uint8_t> data(kSimpleSchema, kSimpleSchema + sizeof(kSimpleSchema));
+  for (int i = 0; i < 5; i++) {
+    data.insert(data.end(), kSimpleRecordBatch,
+                kSimpleRecordBatch + sizeof(kSimpleRecordBatch));
+  }
+  data.insert(data.end(), kEndOfStream, kEndOfStream + sizeof(kEndOfStream));
+
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  EXPECT_EQ(options.read_ahead_bytes, 0);
+  options.read_ahead_bytes = -1;
+  struct ArrowIpcInputStream input;
+  struct ArrowBuffer input_buffer;
+  ArrowBufferInit(&input_buffer);
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
+  struct ArrowArrayStream stream;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), EINVAL);
+  input.release(&input);
+
+  // Without read-ahead, each message requires a read for its prefix, header, and body
+  int64_t n_batches;
+  EXPECT_EQ(ReadAllCountingReads(data, 0, &n_batches), 2 + 5 * 3 + 1);
+  EXPECT_EQ(n_batches, 5);
+
+  // With a window larger than the stream, the whole stream is framed from one read
+  EXPECT_EQ(ReadAllCountingReads(data, 1024 * 1024, &n_batches), 1);
+  EXPECT_EQ(n_batches, 5);
+
+  // Windows that split prefixes, headers, and bodies must give the same result
+  for (int64_t read_ahead_bytes : {1, 7, 8, 15, 16, 17, 100, 255}) {
+    SCOPED_TRACE(read_ahead_bytes);
+    int64_t n_reads = ReadAllCountingReads(data, read_ahead_bytes, &n_batches);
+    EXPECT_EQ(n_batches, 5);
+    EXPECT_LE(n_reads, 2 + 5 * 3 + 1);
+  }
+}
+
+TEST(NanoarrowIpcReader, StreamReaderReadAheadIncompleteMessageBody) {
   struct ArrowBuffer input_buffer;
   ArrowBufferInit(&input_buffer);
   ASSERT_EQ(ArrowBufferAppend(&input_buffer, kSimpleSchema, sizeof(kSimpleSchema)),
             NANOARROW_OK);
-  ASSERT_EQ(
-      ArrowBufferAppend(&input_buffer, kSimpleRecordBatch, sizeof(kSimpleRecordBatch)),
-      NANOARROW_OK);
+  ASSERT_EQ(ArrowBufferAppend(&input_buffer, kSimpleRecordBatch,
+                              sizeof(kSimpleRecordBatch) - 1),
+            NANOARROW_OK);
 
   struct ArrowIpcInputStream input;
   ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
 
   struct ArrowArrayStream stream;
-  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, nullptr), NANOARROW_OK);
-
-  struct ArrowSchema schema;
-
-  ASSERT_EQ(stream.get_schema(&stream, &schema), NANOARROW_OK);
-  EXPECT_STREQ(schema.format, "+s");
-  schema.release(&schema);
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.read_ahead_bytes = 4096;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
 
   struct ArrowArray array;
-  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
-  EXPECT_EQ(array.length, 3);
-  array.release(&array);
-
-  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
-  EXPECT_EQ(array.release, nullptr);
-
-  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
-  EXPECT_EQ(array.release, nullptr);
+  ASSERT_EQ(stream.get_next(&stream, &array), ESPIPE);
+  EXPECT_STREQ(stream.get_last_error(&stream),
+               "Expected to be able to read 16 bytes for message body but got 15");
 
   stream.release(&stream);
 }
 
-TEST(NanoarrowIpcReader, StreamReaderBasicNoSharedBuffers) {
+static void ReadStreamWithSchemaCache(const std::vector<uint8_t>& data,
+                                      struct ArrowIpcSchemaCache* cache,
+                                      const char* expected_name) {
   struct ArrowBuffer input_buffer;
   ArrowBufferInit(&input_buffer);
-  ASSERT_EQ(ArrowBufferAppend(&input_buffer, kSimpleSchema, sizeof(kSimpleSchema)),
-            NANOARROW_OK);
-  ASSERT_EQ(
-      ArrowBufferAppend(&input_buffer, kSimpleRecordBatch, sizeof(kSimpleRecordBatch)),
-      NANOARROW_OK);
-
+  ASSERT_EQ(ArrowBufferAppend(&input_buffer, data.data(), data.size()), NANOARROW_OK);
   struct ArrowIpcInputStream input;
   ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
 
   struct ArrowArrayStream stream;
   struct ArrowIpcArrayStreamReaderOptions options;
-  options.field_index = -1;
-  options.use_shared_buffers = 0;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.schema_cache = cache;
   ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
 
   struct ArrowSchema schema;
-  ASSERT_EQ(stream.get_schema(&stream, &schema), NANOARROW_OK);
+  ASSERT_EQ(stream.get_schema(&stream, &schema), NANOARROW_OK)
+      << stream.get_last_error(&stream);
   EXPECT_STREQ(schema.format, "+s");
+  ASSERT_EQ(schema.n_children, 1);
+  EXPECT_STREQ(schema.children[0]->name, expected_name);
   schema.release(&schema);
 
   struct ArrowArray array;
-  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK)
+      << stream.get_last_error(&stream);
   EXPECT_EQ(array.length, 3);
   array.release(&array);
 
   ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
   EXPECT_EQ(array.release, nullptr);
-
-  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
-  EXPECT_EQ(array.release, nullptr);
-
   stream.release(&stream);
 }
 
+TEST(NanoarrowIpcReader, StreamReaderSchemaCache) {
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  EXPECT_EQ(options.schema_cache, nullptr);
+
+  struct ArrowIpcSchemaCache cache;
+  ASSERT_EQ(ArrowIpcSchemaCacheInit(&cache, 0), EINVAL);
+  ASSERT_EQ(ArrowIpcSchemaCacheInit(&cache, 1), NANOARROW_OK);
+
+  std::vector<uint8_t> data(kSimpleSchema, kSimpleSchema + sizeof(kSimpleSchema));
+  data.insert(data.end(), kSimpleRecordBatch,
+              kSimpleRecordBatch + sizeof(kSimpleRecordBatch));
+
+  // The same Schema message with a different field name
+  std::vector<uint8_t> other_data = data;
+  const char* name = "some_col";
+  auto name_pos = std::search(other_data.begin(), other_data.end(), name, name + 8);
+  ASSERT_NE(name_pos, other_data.end());
+  name_pos[7] = 'x';
+
+  struct ArrowIpcSchemaCacheStats stats;
+  ASSERT_NO_FATAL_FAILURE(ReadStreamWithSchemaCache(data, &cache, "some_col"));
+  ArrowIpcSchemaCacheGetStats(&cache, &stats);
+  EXPECT_EQ(stats.n_entries, 1);
+  EXPECT_EQ(stats.n_hits, 0);
+  EXPECT_EQ(stats.n_misses, 1);
+
+  ASSERT_NO_FATAL_FAILURE(ReadStreamWithSchemaCache(data, &cache, "some_col"));
+  ASSERT_NO_FATAL_FAILURE(ReadStreamWithSchemaCache(data, &cache, "some_col"));
+  ArrowIpcSchemaCacheGetStats(&cache, &stats);
+  EXPECT_EQ(stats.n_entries, 1);
+  EXPECT_EQ(stats.n_hits, 2);
+  EXPECT_EQ(stats.n_misses, 1);
+
+  // A different Schema message replaces the only entry
+  ASSERT_NO_FATAL_FAILURE(ReadStreamWithSchemaCache(other_data, &cache, "some_cox"));
+  ASSERT_NO_FATAL_FAILURE(ReadStreamWithSchemaCache(data, &cache, "some_col"));
+  ArrowIpcSchemaCacheGetStats(&cache, &stats);
+  EXPECT_EQ(stats.n_entries, 1);
+  EXPECT_EQ(stats.n_hits, 2);
+  EXPECT_EQ(stats.n_misses, 3);
+
+  ArrowIpcSchemaCacheReset(&cache);
+  EXPECT_EQ(cache.private_data, nullptr);
+}
+
 TEST(NanoarrowIpcReader, StreamReaderBasicWithEndOfStream) {
   struct ArrowBuffer input_buffer;
   ArrowBufferInit(&input_buffer);
@@ -408,6 +1420,7 @@ TEST(NanoarrowIpcReader, StreamReaderUnsupportedFieldIndex) {
 
   struct ArrowArrayStream stream;
   struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
   options.field_index = 0;
   options.use_shared_buffers = 0;
   ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
@@ -454,3 +1467,626 @@ TEST(NanoarrowIpcReader, StreamReaderIncompletePrefix) {
 
   stream.release(&stream);
 }
+
+static ArrowErrorCode FeedInChunks(struct ArrowIpcPushReader* reader, const uint8_t* data,
+                                   int64_t size_bytes, int64_t chunk_size) {
+  for (int64_t i = 0; i < size_bytes; i += chunk_size) {
+    struct ArrowBufferView chunk;
+    chunk.data.as_uint8 = data + i;
+    chunk.size_bytes = std::min(chunk_size, size_bytes - i);
+    NANOARROW_RETURN_NOT_OK(ArrowIpcPushReaderFeed(reader, chunk));
+  }
+
+  return NANOARROW_OK;
+}
+
+TEST(NanoarrowIpcReader, PushReaderBasic) {
+  for (int use_shared_buffers : {0, 1}) {
+    struct ArrowIpcArrayStreamReaderOptions options;
+    ArrowIpcArrayStreamReaderOptionsInit(&options);
+    options.use_shared_buffers = use_shared_buffers;
+
+    struct ArrowAsyncArrayStreamHandler handler;
+    struct ArrowArrayStream stream;
+    ASSERT_EQ(ArrowArrayStreamInitFromAsync(&stream, &handler), NANOARROW_OK);
+
+    struct ArrowIpcPushReader reader;
+    ASSERT_EQ(ArrowIpcPushReaderInit(&reader, &handler, &options), NANOARROW_OK);
+    EXPECT_EQ(handler.release, nullptr);
+
+    struct ArrowSchema schema;
+    EXPECT_EQ(stream.get_schema(&stream, &schema), EAGAIN);
+    ASSERT_EQ(FeedInChunks(&reader, kSimpleSchema, sizeof(kSimpleSchema), 1),
+              NANOARROW_OK);
+    ASSERT_EQ(stream.get_schema(&stream, &schema), NANOARROW_OK);
+    EXPECT_STREQ(schema.format, "+s");
+    schema.release(&schema);
+
+    // Requesting an array before its bytes arrive does not block
+    struct ArrowArray array;
+    EXPECT_EQ(stream.get_next(&stream, &array), EAGAIN);
+    ASSERT_EQ(
+        FeedInChunks(&reader, kSimpleRecordBatch, sizeof(kSimpleRecordBatch), 7),
+        NANOARROW_OK);
+    ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+    EXPECT_EQ(array.length, 3);
+    array.release(&array);
+
+    ASSERT_EQ(FeedInChunks(&reader, kEndOfStream, sizeof(kEndOfStream), 3),
+              NANOARROW_OK);
+    ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+    EXPECT_EQ(array.release, nullptr);
+
+    ArrowIpcPushReaderReset(&reader);
+    stream.release(&stream);
+  }
+}
+
+TEST(NanoarrowIpcReader, PushReaderBuffersUnrequestedMessages) {
+  struct ArrowAsyncArrayStreamHandler handler;
+  struct ArrowArrayStream stream;
+  ASSERT_EQ(ArrowArrayStreamInitFromAsync(&stream, &handler), NANOARROW_OK);
+
+  struct ArrowIpcPushReader reader;
+  ASSERT_EQ(ArrowIpcPushReaderInit(&reader, &handler, nullptr), NANOARROW_OK);
+  ASSERT_EQ(FeedInChunks(&reader, kSimpleSchema, sizeof(kSimpleSchema), 100),
+            NANOARROW_OK);
+  for (int i = 0; i < 2; i++) {
+    ASSERT_EQ(
+        FeedInChunks(&reader, kSimpleRecordBatch, sizeof(kSimpleRecordBatch), 100),
+        NANOARROW_OK);
+  }
+
+  // Input without an end-of-stream indicator ends when the reader is finished
+  ASSERT_EQ(ArrowIpcPushReaderFinish(&reader), NANOARROW_OK);
+
+  struct ArrowArray array;
+  for (int i = 0; i < 2; i++) {
+    ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+    EXPECT_EQ(array.length, 3);
+    array.release(&array);
+  }
+
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.release, nullptr);
+
+  ArrowIpcPushReaderReset(&reader);
+  stream.release(&stream);
+}
+
+TEST(NanoarrowIpcReader, PushReaderBytesNeeded) {
+  struct ArrowAsyncArrayStreamHandler handler;
+  struct ArrowArrayStream stream;
+  ASSERT_EQ(ArrowArrayStreamInitFromAsync(&stream, &handler), NANOARROW_OK);
+  struct ArrowIpcPushReader reader;
+  ASSERT_EQ(ArrowIpcPushReaderInit(&reader, &handler, nullptr), NANOARROW_OK);
+
+  // The prefix is needed before anything else is known
+  EXPECT_EQ(ArrowIpcPushReaderBytesNeeded(&reader), 8);
+  ASSERT_EQ(FeedInChunks(&reader, kSimpleSchema, 3, 3), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcPushReaderBytesNeeded(&reader), 5);
+  ASSERT_EQ(FeedInChunks(&reader, kSimpleSchema + 3, sizeof(kSimpleSchema) - 3, 100),
+            NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcPushReaderBytesNeeded(&reader), 8);
+
+  // ...then the rest of the header, then the body
+  struct ArrowArray array;
+  EXPECT_EQ(stream.get_next(&stream, &array), EAGAIN);
+  ASSERT_EQ(FeedInChunks(&reader, kSimpleRecordBatch, 8, 8), NANOARROW_OK);
+  int64_t header_remaining = ArrowIpcPushReaderBytesNeeded(&reader);
+  ASSERT_GT(header_remaining, 0);
+  ASSERT_LT(8 + header_remaining, static_cast<int64_t>(sizeof(kSimpleRecordBatch)));
+  ASSERT_EQ(FeedInChunks(&reader, kSimpleRecordBatch + 8, header_remaining, 100),
+            NANOARROW_OK);
+  int64_t n_fed = 8 + header_remaining;
+  EXPECT_EQ(ArrowIpcPushReaderBytesNeeded(&reader),
+            static_cast<int64_t>(sizeof(kSimpleRecordBatch)) - n_fed);
+  ASSERT_EQ(FeedInChunks(&reader, kSimpleRecordBatch + n_fed,
+                         sizeof(kSimpleRecordBatch) - n_fed, 100),
+            NANOARROW_OK);
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.length, 3);
+  array.release(&array);
+
+  // A complete message waiting for a request needs no more bytes
+  ASSERT_EQ(
+      FeedInChunks(&reader, kSimpleRecordBatch, sizeof(kSimpleRecordBatch), 100),
+      NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcPushReaderBytesNeeded(&reader), 0);
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  array.release(&array);
+
+  ArrowIpcPushReaderReset(&reader);
+  stream.release(&stream);
+}
+
+TEST(NanoarrowIpcReader, PushReaderChunksAreNotReferenced) {
+  for (int use_shared_buffers : {0, 1}) {
+    struct ArrowIpcArrayStreamReaderOptions options;
+    ArrowIpcArrayStreamReaderOptionsInit(&options);
+    options.use_shared_buffers = use_shared_buffers;
+
+    struct ArrowAsyncArrayStreamHandler handler;
+    struct ArrowArrayStream stream;
+    ASSERT_EQ(ArrowArrayStreamInitFromAsync(&stream, &handler), NANOARROW_OK);
+    struct ArrowIpcPushReader reader;
+    ASSERT_EQ(ArrowIpcPushReaderInit(&reader, &handler, &options), NANOARROW_OK);
+
+    // One chunk contains the schema, a requested batch, an unrequested batch, and
+    // part of a third batch
+    std::vector<uint8_t> chunk(kSimpleSchema, kSimpleSchema + sizeof(kSimpleSchema));
+    for (int i = 0; i < 3; i++) {
+      chunk.insert(chunk.end(), kSimpleRecordBatch,
+                   kSimpleRecordBatch + sizeof(kSimpleRecordBatch));
+    }
+    chunk.resize(chunk.size() - 5);
+
+    struct ArrowSchema schema;
+    ASSERT_EQ(stream.get_schema(&stream, &schema), EAGAIN);
+    struct ArrowArray array;
+    ASSERT_EQ(stream.get_next(&stream, &array), EAGAIN);
+    ASSERT_EQ(FeedInChunks(&reader, chunk.data(), chunk.size(), chunk.size()),
+              NANOARROW_OK);
+    EXPECT_EQ(ArrowIpcPushReaderBytesNeeded(&reader), 0);
+
+    // Neither decoded arrays nor buffered input may reference the chunk
+    std::fill(chunk.begin(), chunk.end(), 0xFF);
+    ASSERT_EQ(stream.get_schema(&stream, &schema), NANOARROW_OK);
+    schema.release(&schema);
+    for (int i = 0; i < 2; i++) {
+      ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK)
+          << stream.get_last_error(&stream);
+      ASSERT_EQ(array.length, 3);
+      EXPECT_EQ(reinterpret_cast<const int32_t*>(array.children[0]->buffers[1])[2], 3);
+      array.release(&array);
+    }
+
+    EXPECT_EQ(stream.get_next(&stream, &array), EAGAIN);
+    EXPECT_EQ(ArrowIpcPushReaderBytesNeeded(&reader), 5);
+    ASSERT_EQ(FeedInChunks(&reader, kSimpleRecordBatch + sizeof(kSimpleRecordBatch) - 5,
+                           5, 5),
+              NANOARROW_OK);
+    ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+    EXPECT_EQ(array.length, 3);
+    array.release(&array);
+
+    ArrowIpcPushReaderReset(&reader);
+    stream.release(&stream);
+  }
+}
+
+TEST(NanoarrowIpcReader, PushReaderErrors) {
+  struct ArrowAsyncArrayStreamHandler handler;
+  struct ArrowArrayStream stream;
+  struct ArrowIpcPushReader reader;
+  struct ArrowArray array;
+
+  // Input must begin with a Schema message
+  ASSERT_EQ(ArrowArrayStreamInitFromAsync(&stream, &handler), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcPushReaderInit(&reader, &handler, nullptr), NANOARROW_OK);
+  EXPECT_EQ(
+      FeedInChunks(&reader, kSimpleRecordBatch, sizeof(kSimpleRecordBatch), 100),
+      EINVAL);
+  EXPECT_EQ(stream.get_next(&stream, &array), EINVAL);
+  EXPECT_STREQ(stream.get_last_error(&stream),
+               "Unexpected message type at start of input (expected Schema)");
+  ArrowIpcPushReaderReset(&reader);
+  stream.release(&stream);
+
+  // Input must not end in the middle of a message
+  ASSERT_EQ(ArrowArrayStreamInitFromAsync(&stream, &handler), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcPushReaderInit(&reader, &handler, nullptr), NANOARROW_OK);
+  ASSERT_EQ(FeedInChunks(&reader, kSimpleSchema, sizeof(kSimpleSchema), 100),
+            NANOARROW_OK);
+  ASSERT_EQ(FeedInChunks(&reader, kSimpleRecordBatch, sizeof(kSimpleRecordBatch) - 1,
+                         100),
+            NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcPushReaderFinish(&reader), EINVAL);
+  EXPECT_EQ(stream.get_next(&stream, &array), EINVAL);
+  ArrowIpcPushReaderReset(&reader);
+  stream.release(&stream);
+
+  // Releasing the consumer cancels the reader
+  ASSERT_EQ(ArrowArrayStreamInitFromAsync(&stream, &handler), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcPushReaderInit(&reader, &handler, nullptr), NANOARROW_OK);
+  ASSERT_EQ(FeedInChunks(&reader, kSimpleSchema, sizeof(kSimpleSchema), 100),
+            NANOARROW_OK);
+  stream.release(&stream);
+  EXPECT_EQ(
+      FeedInChunks(&reader, kSimpleRecordBatch, sizeof(kSimpleRecordBatch), 100),
+      ECANCELED);
+  ArrowIpcPushReaderReset(&reader);
+
+  // Resetting the reader before the end of input reports an error to the consumer
+  ASSERT_EQ(ArrowArrayStreamInitFromAsync(&stream, &handler), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcPushReaderInit(&reader, &handler, nullptr), NANOARROW_OK);
+  ArrowIpcPushReaderReset(&reader);
+  EXPECT_EQ(stream.get_next(&stream, &array), ECANCELED);
+  EXPECT_STREQ(stream.get_last_error(&stream),
+               "Reader was reset before the end of input");
+  stream.release(&stream);
+}
+
+// Builds a struct<some_int: int32, some_string: string, some_list: list<int64>>
+// with a null in each column
+static void MakeSimpleBatch(struct ArrowSchema* schema, struct ArrowArray* array) {
+  ASSERT_EQ(ArrowSchemaInitFromType(schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(schema, 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0], "some_int"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[1], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[1], "some_string"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[2], NANOARROW_TYPE_LIST),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[2], "some_list"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[2]->children[0], NANOARROW_TYPE_INT64),
+            NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(array, schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array), NANOARROW_OK);
+  for (int64_t i = 0; i < 5; i++) {
+    if (i == 1) {
+      ASSERT_EQ(ArrowArrayAppendNull(array->children[0], 1), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayAppendNull(array->children[1], 1), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayAppendNull(array->children[2], 1), NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowArrayAppendInt(array->children[0], i), NANOARROW_OK);
+      std::string value(i, 'a');
+      ASSERT_EQ(ArrowArrayAppendString(array->children[1], ArrowCharView(value.c_str())),
+                NANOARROW_OK);
+      for (int64_t j = 0; j < i; j++) {
+        ASSERT_EQ(ArrowArrayAppendInt(array->children[2]->children[0], j), NANOARROW_OK);
+      }
+      ASSERT_EQ(ArrowArrayFinishElement(array->children[2]), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishElement(array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array, nullptr), NANOARROW_OK);
+}
+
+// Builds a struct<col: dictionary<values=string, indices=int32>> whose dictionary
+// contains dictionary_values
+static void MakeDictionaryBatch(struct ArrowSchema* schema, struct ArrowArray* array,
+                                const std::vector<std::string>& dictionary_values,
+                                const std::vector<int32_t>& indices) {
+  ASSERT_EQ(ArrowSchemaInitFromType(schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0], "col"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(schema->children[0]), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[0]->dictionary,
+                                    NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(array, schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array), NANOARROW_OK);
+  for (int32_t index : indices) {
+    ASSERT_EQ(ArrowArrayAppendInt(array->children[0], index), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(array), NANOARROW_OK);
+  }
+  for (const std::string& value : dictionary_values) {
+    ASSERT_EQ(ArrowArrayAppendString(array->children[0]->dictionary,
+                                     ArrowCharView(value.c_str())),
+              NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array, nullptr), NANOARROW_OK);
+}
+
+static std::string DictionaryValue(struct ArrowArray* dictionary, int64_t i) {
+  const int32_t* offsets = reinterpret_cast<const int32_t*>(dictionary->buffers[1]);
+  const char* data = reinterpret_cast<const char*>(dictionary->buffers[2]);
+  return std::string(data + offsets[i], offsets[i + 1] - offsets[i]);
+}
+
+TEST(NanoarrowIpcReader, StreamReaderProjectionErrors) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  ASSERT_NO_FATAL_FAILURE(MakeSimpleBatch(&schema, &array));
+  array.release(&array);
+
+  struct ArrowBuffer output;
+  ArrowBufferInit(&output);
+  struct ArrowIpcOutputStream output_stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, &output), NANOARROW_OK);
+  struct ArrowIpcWriter writer;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(&writer, &schema, &error), NANOARROW_OK);
+  ArrowIpcWriterReset(&writer);
+  schema.release(&schema);
+
+  struct ArrowStringView paths[] = {ArrowCharView("not_a_field")};
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.field_paths = paths;
+  options.n_field_paths = 1;
+
+  // A field index can't be combined with paths
+  struct ArrowIpcInputStream input_stream;
+  struct ArrowArrayStream stream;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input_stream, &output), NANOARROW_OK);
+  options.field_index = 0;
+  EXPECT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input_stream, &options), EINVAL);
+
+  // Paths that don't exist are reported when the schema is read
+  options.field_index = -1;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input_stream, &options),
+            NANOARROW_OK);
+  EXPECT_EQ(stream.get_schema(&stream, &schema), EINVAL);
+  EXPECT_NE(std::string(stream.get_last_error(&stream)).find("not_a_field"),
+            std::string::npos)
+      << stream.get_last_error(&stream);
+  stream.release(&stream);
+}
+
+// Writes a stream of three batches whose dictionary is replaced before the last one
+static void WriteDictionaryStream(struct ArrowBuffer* output) {
+  struct ArrowSchema schema;
+  struct ArrowSchema replacement_schema;
+  struct ArrowArray array;
+  struct ArrowArray replacement;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+  ASSERT_NO_FATAL_FAILURE(MakeDictionaryBatch(&schema, &array, {"a", "b"}, {1, 0, 1}));
+  ASSERT_NO_FATAL_FAILURE(
+      MakeDictionaryBatch(&replacement_schema, &replacement, {"c"}, {0}));
+  replacement_schema.release(&replacement_schema);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+
+  struct ArrowIpcOutputStream output_stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, output), NANOARROW_OK);
+  struct ArrowIpcWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(&writer, &schema, &error), NANOARROW_OK)
+      << error.message;
+  for (struct ArrowArray* batch : {&array, &array, &replacement}) {
+    ASSERT_EQ(ArrowArrayViewSetArray(&array_view, batch, &error), NANOARROW_OK);
+    ASSERT_EQ(ArrowIpcWriterWriteArrayView(&writer, &array_view, &error), NANOARROW_OK)
+        << error.message;
+  }
+
+  ArrowIpcWriterReset(&writer);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  replacement.release(&replacement);
+  schema.release(&schema);
+}
+
+TEST(NanoarrowIpcReader, StreamReaderMessageIndex) {
+  struct ArrowBuffer output;
+  ArrowBufferInit(&output);
+  ASSERT_NO_FATAL_FAILURE(WriteDictionaryStream(&output));
+  std::vector<uint8_t> data(output.data, output.data + output.size_bytes);
+
+  // Record the index while reading the whole stream
+  struct ArrowIpcMessageIndex index;
+  ArrowIpcMessageIndexInit(&index);
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.message_index = &index;
+
+  struct ArrowIpcInputStream input_stream;
+  struct ArrowArrayStream stream;
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input_stream, &output), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input_stream, &options),
+            NANOARROW_OK);
+  while (true) {
+    ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK)
+        << stream.get_last_error(&stream);
+    if (array.release == nullptr) {
+      break;
+    }
+    array.release(&array);
+  }
+  stream.release(&stream);
+
+  ASSERT_EQ(index.n_entries, 6);
+  ASSERT_EQ(index.n_record_batches, 3);
+  const auto* entries =
+      reinterpret_cast<const struct ArrowIpcMessageIndexEntry*>(index.entries.data);
+  std::vector<enum ArrowIpcMessageType> message_types = {
+      NANOARROW_IPC_MESSAGE_TYPE_SCHEMA,
+      NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH,
+      NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH,
+      NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH,
+      NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH,
+      NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH};
+  for (int64_t i = 0; i < index.n_entries; i++) {
+    EXPECT_EQ(entries[i].message_type, message_types[i]);
+    EXPECT_EQ(entries[i].message_index, i);
+  }
+  EXPECT_EQ(entries[0].offset, 0);
+  EXPECT_EQ(entries[2].length, 3);
+  EXPECT_EQ(entries[5].length, 1);
+  EXPECT_EQ(entries[4].dictionary_id, 0);
+  EXPECT_FALSE(entries[4].dictionary_is_delta);
+
+  // The sidecar round trips and rejects anything else
+  struct ArrowBuffer sidecar;
+  ArrowBufferInit(&sidecar);
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcMessageIndexSerialize(&index, &sidecar, &error), NANOARROW_OK);
+  ArrowIpcMessageIndexReset(&index);
+  ArrowIpcMessageIndexInit(&index);
+  struct ArrowBufferView sidecar_view;
+  sidecar_view.data.data = sidecar.data;
+  sidecar_view.size_bytes = sidecar.size_bytes - 1;
+  EXPECT_EQ(ArrowIpcMessageIndexDeserialize(&index, sidecar_view, &error), EINVAL);
+  sidecar_view.size_bytes = sidecar.size_bytes;
+  ASSERT_EQ(ArrowIpcMessageIndexDeserialize(&index, sidecar_view, &error), NANOARROW_OK)
+      << error.message;
+  ArrowBufferReset(&sidecar);
+  ASSERT_EQ(index.n_entries, 6);
+  ASSERT_EQ(index.n_record_batches, 3);
+
+  // Seeking replays the current dictionary of each batch from a buffer or a FILE*
+  FILE* file_ptr = tmpfile();
+  ASSERT_NE(file_ptr, nullptr);
+  ASSERT_EQ(fwrite(data.data(), 1, data.size(), file_ptr), data.size());
+  rewind(file_ptr);
+
+  for (int use_file : {0, 1}) {
+    SCOPED_TRACE("use_file: " + std::to_string(use_file));
+    if (use_file) {
+      ASSERT_EQ(ArrowIpcInputStreamInitFile(&input_stream, file_ptr, 1), NANOARROW_OK);
+    } else {
+      ArrowBufferInit(&output);
+      ASSERT_EQ(ArrowBufferAppend(&output, data.data(), data.size()), NANOARROW_OK);
+      ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input_stream, &output), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input_stream, nullptr),
+              NANOARROW_OK);
+    EXPECT_EQ(ArrowIpcArrayStreamReaderSeek(&stream, &index, 3, &error), EINVAL);
+
+    ASSERT_EQ(ArrowIpcArrayStreamReaderSeek(&stream, &index, 2, &error), NANOARROW_OK)
+        << error.message;
+    ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK)
+        << stream.get_last_error(&stream);
+    ASSERT_EQ(array.length, 1);
+    EXPECT_EQ(DictionaryValue(array.children[0]->dictionary, 0), "c");
+    array.release(&array);
+
+    ASSERT_EQ(ArrowIpcArrayStreamReaderSeek(&stream, &index, 1, &error), NANOARROW_OK)
+        << error.message;
+    for (int64_t expected_length : {3, 1}) {
+      ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK)
+          << stream.get_last_error(&stream);
+      ASSERT_EQ(array.length, expected_length);
+      array.release(&array);
+    }
+
+    ASSERT_EQ(ArrowIpcArrayStreamReaderSeek(&stream, &index, 0, &error), NANOARROW_OK)
+        << error.message;
+    ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK)
+        << stream.get_last_error(&stream);
+    ASSERT_EQ(array.length, 3);
+    ASSERT_EQ(array.children[0]->dictionary->length, 2);
+    EXPECT_EQ(DictionaryValue(array.children[0]->dictionary, 1), "b");
+    array.release(&array);
+    stream.release(&stream);
+  }
+
+  ArrowIpcMessageIndexReset(&index);
+}
+
+// Runs each task on its own thread
+static void ThreadPerTaskParallelFor(struct ArrowExecutor* executor,
+                                     void (*task)(void* task_private, int64_t i),
+                                     void* task_private, int64_t n_tasks) {
+  auto n_calls = reinterpret_cast<int64_t*>(executor->private_data);
+  *n_calls += 1;
+
+  std::vector<std::thread> threads;
+  for (int64_t i = 0; i < n_tasks; i++) {
+    threads.emplace_back([task, task_private, i] { task(task_private, i); });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+TEST(NanoarrowIpcReader, StreamReaderParallelDecode) {
+  // Batch i has length i + 1 and a dictionary that is replaced every two batches
+  const int64_t n_batches = 5;
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+  struct ArrowBuffer output;
+  ArrowBufferInit(&output);
+  struct ArrowIpcOutputStream output_stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, &output), NANOARROW_OK);
+  struct ArrowIpcWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+
+  for (int64_t i = 0; i < n_batches; i++) {
+    std::vector<int32_t> indices(i + 1, 0);
+    ASSERT_NO_FATAL_FAILURE(MakeDictionaryBatch(
+        &schema, &array, {"value" + std::to_string(i / 2)}, indices));
+    ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+    if (i == 0) {
+      ASSERT_EQ(ArrowIpcWriterWriteSchema(&writer, &schema, &error), NANOARROW_OK)
+          << error.message;
+    }
+    ASSERT_EQ(ArrowIpcWriterWriteArrayView(&writer, &array_view, &error), NANOARROW_OK)
+        << error.message;
+    ArrowArrayViewReset(&array_view);
+    array.release(&array);
+    schema.release(&schema);
+  }
+  ArrowIpcWriterReset(&writer);
+
+  int64_t n_calls = 0;
+  struct ArrowExecutor executor;
+  executor.parallel_for = &ThreadPerTaskParallelFor;
+  executor.private_data = &n_calls;
+
+  std::vector<int> use_shared_buffers_values = {0};
+  if (ArrowIpcSharedBufferIsThreadSafe()) {
+    use_shared_buffers_values.push_back(1);
+  }
+
+  for (int use_shared_buffers : use_shared_buffers_values) {
+    for (int64_t batch_readahead : {1, 2, 8}) {
+      SCOPED_TRACE("use_shared_buffers: " + std::to_string(use_shared_buffers) +
+                   ", batch_readahead: " + std::to_string(batch_readahead));
+      struct ArrowBuffer input;
+      ArrowBufferInit(&input);
+      ASSERT_EQ(ArrowBufferAppend(&input, output.data, output.size_bytes), NANOARROW_OK);
+      struct ArrowIpcInputStream input_stream;
+      ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input_stream, &input), NANOARROW_OK);
+
+      struct ArrowIpcArrayStreamReaderOptions options;
+      ArrowIpcArrayStreamReaderOptionsInit(&options);
+      options.use_shared_buffers = use_shared_buffers;
+      options.executor = &executor;
+      options.batch_readahead = batch_readahead;
+      struct ArrowArrayStream stream;
+      ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input_stream, &options),
+                NANOARROW_OK);
+
+      // Batches are returned in order, each with the dictionary that preceded it
+      n_calls = 0;
+      for (int64_t i = 0; i < n_batches; i++) {
+        ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK)
+            << stream.get_last_error(&stream);
+        ASSERT_NE(array.release, nullptr);
+        EXPECT_EQ(array.length, i + 1);
+        ASSERT_EQ(array.children[0]->dictionary->length, 1);
+        EXPECT_EQ(DictionaryValue(array.children[0]->dictionary, 0),
+                  "value" + std::to_string(i / 2));
+        array.release(&array);
+      }
+
+      ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+      EXPECT_EQ(array.release, nullptr);
+      EXPECT_GE(n_calls, (n_batches + batch_readahead - 1) / batch_readahead);
+      EXPECT_LE(n_calls, n_batches);
+      stream.release(&stream);
+    }
+  }
+
+  // Undelivered batches are released with the stream
+  struct ArrowIpcInputStream input_stream;
+  struct ArrowArrayStream stream;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input_stream, &output), NANOARROW_OK);
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.executor = &executor;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input_stream, &options),
+            NANOARROW_OK);
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK)
+      << stream.get_last_error(&stream);
+  array.release(&array);
+  stream.release(&stream);
+
+  // The executor needs at least one task
+  options.batch_readahead = 0;
+  EXPECT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input_stream, &options), EINVAL);
+}
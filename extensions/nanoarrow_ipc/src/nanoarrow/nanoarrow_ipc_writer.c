@@ -0,0 +1,1470 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// S_ISSOCK() and MSG_NOSIGNAL require _GNU_SOURCE on Linux
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#endif
+
+#include "nanoarrow.h"
+#include "nanoarrow_ipc.h"
+
+void ArrowIpcOutputStreamMove(struct ArrowIpcOutputStream* src,
+                              struct ArrowIpcOutputStream* dst) {
+  memcpy(dst, src, sizeof(struct ArrowIpcOutputStream));
+  src->release = NULL;
+}
+
+static ArrowErrorCode ArrowIpcOutputStreamBufferWrite(
+    struct ArrowIpcOutputStream* stream, const struct ArrowBufferView* buffers,
+    int64_t n_buffers, struct ArrowError* error) {
+  struct ArrowBuffer* output = (struct ArrowBuffer*)stream->private_data;
+
+  int64_t size_bytes = 0;
+  for (int64_t i = 0; i < n_buffers; i++) {
+    size_bytes += buffers[i].size_bytes;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(output, size_bytes));
+  for (int64_t i = 0; i < n_buffers; i++) {
+    if (buffers[i].size_bytes > 0) {
+      ArrowBufferAppendUnsafe(output, buffers[i].data.data, buffers[i].size_bytes);
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+static void ArrowIpcOutputStreamBufferRelease(struct ArrowIpcOutputStream* stream) {
+  stream->release = NULL;
+}
+
+ArrowErrorCode ArrowIpcOutputStreamInitBuffer(struct ArrowIpcOutputStream* stream,
+                                              struct ArrowBuffer* output) {
+  stream->write = &ArrowIpcOutputStreamBufferWrite;
+  stream->release = &ArrowIpcOutputStreamBufferRelease;
+  stream->private_data = output;
+  return NANOARROW_OK;
+}
+
+struct ArrowIpcOutputStreamFilePrivate {
+  FILE* file_ptr;
+  int close_on_release;
+};
+
+static ArrowErrorCode ArrowIpcOutputStreamFileWrite(struct ArrowIpcOutputStream* stream,
+                                                    const struct ArrowBufferView* buffers,
+                                                    int64_t n_buffers,
+                                                    struct ArrowError* error) {
+  struct ArrowIpcOutputStreamFilePrivate* private_data =
+      (struct ArrowIpcOutputStreamFilePrivate*)stream->private_data;
+
+  for (int64_t i = 0; i < n_buffers; i++) {
+    if (buffers[i].size_bytes <= 0) {
+      continue;
+    }
+
+    size_t size_bytes = (size_t)buffers[i].size_bytes;
+    if (fwrite(buffers[i].data.data, 1, size_bytes, private_data->file_ptr) !=
+        size_bytes) {
+      ArrowErrorSet(error, "ArrowIpcOutputStreamFile IO error");
+      return EIO;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+static void ArrowIpcOutputStreamFileRelease(struct ArrowIpcOutputStream* stream) {
+  struct ArrowIpcOutputStreamFilePrivate* private_data =
+      (struct ArrowIpcOutputStreamFilePrivate*)stream->private_data;
+
+  if (private_data->file_ptr != NULL && private_data->close_on_release) {
+    fclose(private_data->file_ptr);
+  }
+
+  ArrowFree(private_data);
+  stream->release = NULL;
+}
+
+ArrowErrorCode ArrowIpcOutputStreamInitFile(struct ArrowIpcOutputStream* stream,
+                                            void* file_ptr, int close_on_release) {
+  struct ArrowIpcOutputStreamFilePrivate* private_data =
+      (struct ArrowIpcOutputStreamFilePrivate*)ArrowMalloc(
+          sizeof(struct ArrowIpcOutputStreamFilePrivate));
+  if (private_data == NULL) {
+    return ENOMEM;
+  }
+
+  private_data->file_ptr = (FILE*)file_ptr;
+  private_data->close_on_release = close_on_release;
+
+  stream->write = &ArrowIpcOutputStreamFileWrite;
+  stream->release = &ArrowIpcOutputStreamFileRelease;
+  stream->private_data = private_data;
+  return NANOARROW_OK;
+}
+
+#if defined(_WIN32)
+
+ArrowErrorCode ArrowIpcOutputStreamInitFileDescriptor(
+    struct ArrowIpcOutputStream* stream, int file_descriptor, int close_on_release) {
+  return ENOTSUP;
+}
+
+ArrowErrorCode ArrowIpcOutputStreamAddSendfileSource(struct ArrowIpcOutputStream* stream,
+                                                     int file_descriptor,
+                                                     const void* data,
+                                                     int64_t size_bytes,
+                                                     struct ArrowError* error) {
+  ArrowErrorSet(error,
+                "ArrowIpcOutputStreamAddSendfileSource() is not supported on Windows");
+  return ENOTSUP;
+}
+
+#else
+
+// POSIX only guarantees that writev() accepts 16 iovecs; however, most platforms
+// define a much larger IOV_MAX
+#if defined(IOV_MAX) && IOV_MAX < 64
+#define NANOARROW_IPC_MAX_IOVECS IOV_MAX
+#else
+#define NANOARROW_IPC_MAX_IOVECS 64
+#endif
+
+// Buffers smaller than this are gathered with the buffers around them instead of
+// being sent with their own call to sendfile()
+#define NANOARROW_IPC_SENDFILE_MIN_BYTES 65536
+
+// A region of memory that maps file_descriptor from offset 0 (see
+// ArrowIpcOutputStreamAddSendfileSource())
+struct ArrowIpcOutputStreamSendfileSource {
+  int file_descriptor;
+  const uint8_t* data;
+  int64_t size_bytes;
+};
+
+struct ArrowIpcOutputStreamFileDescriptorPrivate {
+  int file_descriptor;
+  int close_on_release;
+  // Non-zero if file_descriptor is a socket, which is written with sendmsg()
+  int is_socket;
+  // The struct ArrowIpcOutputStreamSendfileSource elements added to the stream
+  struct ArrowBuffer sendfile_sources;
+};
+
+static ssize_t ArrowIpcOutputStreamFileDescriptorWritev(
+    struct ArrowIpcOutputStreamFileDescriptorPrivate* private_data,
+    struct iovec* iovecs, int n_iovecs) {
+  if (!private_data->is_socket) {
+    return writev(private_data->file_descriptor, iovecs, n_iovecs);
+  }
+
+  // Unlike writev(), sendmsg() can report a closed connection as EPIPE without
+  // raising SIGPIPE (which terminates the process by default)
+  struct msghdr message;
+  memset(&message, 0, sizeof(message));
+  message.msg_iov = iovecs;
+  message.msg_iovlen = n_iovecs;
+#if defined(MSG_NOSIGNAL)
+  return sendmsg(private_data->file_descriptor, &message, MSG_NOSIGNAL);
+#else
+  return sendmsg(private_data->file_descriptor, &message, 0);
+#endif
+}
+
+static ArrowErrorCode ArrowIpcOutputStreamFileDescriptorGather(
+    struct ArrowIpcOutputStreamFileDescriptorPrivate* private_data,
+    const struct ArrowBufferView* buffers, int64_t n_buffers, struct ArrowError* error) {
+  struct iovec iovecs[NANOARROW_IPC_MAX_IOVECS];
+
+  // The buffer and the offset into it at which the next write starts
+  int64_t buffer_i = 0;
+  int64_t offset_bytes = 0;
+
+  while (1) {
+    while (buffer_i < n_buffers && offset_bytes >= buffers[buffer_i].size_bytes) {
+      buffer_i++;
+      offset_bytes = 0;
+    }
+
+    if (buffer_i == n_buffers) {
+      return NANOARROW_OK;
+    }
+
+    int n_iovecs = 0;
+    for (int64_t i = buffer_i; i < n_buffers && n_iovecs < NANOARROW_IPC_MAX_IOVECS;
+         i++) {
+      int64_t start_bytes = i == buffer_i ? offset_bytes : 0;
+      if (buffers[i].size_bytes > start_bytes) {
+        iovecs[n_iovecs].iov_base = (void*)(buffers[i].data.as_uint8 + start_bytes);
+        iovecs[n_iovecs].iov_len = (size_t)(buffers[i].size_bytes - start_bytes);
+        n_iovecs++;
+      }
+    }
+
+    ssize_t bytes_written =
+        ArrowIpcOutputStreamFileDescriptorWritev(private_data, iovecs, n_iovecs);
+    if (bytes_written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+
+      int code = errno;
+      ArrowErrorSet(error, "ArrowIpcOutputStreamFileDescriptor IO error: %s",
+                    strerror(code));
+      return code == EPIPE ? EPIPE : EIO;
+    }
+
+    // writev() may write fewer bytes than requested, so advance past exactly the
+    // bytes that were written
+    int64_t bytes_remaining = (int64_t)bytes_written;
+    while (bytes_remaining > 0) {
+      int64_t bytes_available = buffers[buffer_i].size_bytes - offset_bytes;
+      if (bytes_remaining < bytes_available) {
+        offset_bytes += bytes_remaining;
+        bytes_remaining = 0;
+      } else {
+        bytes_remaining -= bytes_available > 0 ? bytes_available : 0;
+        buffer_i++;
+        offset_bytes = 0;
+      }
+    }
+  }
+}
+
+// Returns the source that buffer can be sent from with sendfile() or NULL
+static const struct ArrowIpcOutputStreamSendfileSource*
+ArrowIpcOutputStreamFileDescriptorFindSource(
+    struct ArrowIpcOutputStreamFileDescriptorPrivate* private_data,
+    struct ArrowBufferView buffer) {
+  if (buffer.size_bytes < NANOARROW_IPC_SENDFILE_MIN_BYTES) {
+    return NULL;
+  }
+
+  const struct ArrowIpcOutputStreamSendfileSource* sources =
+      (const struct ArrowIpcOutputStreamSendfileSource*)
+          private_data->sendfile_sources.data;
+  int64_t n_sources = private_data->sendfile_sources.size_bytes /
+                      sizeof(struct ArrowIpcOutputStreamSendfileSource);
+  for (int64_t i = 0; i < n_sources; i++) {
+    if (buffer.data.as_uint8 >= sources[i].data &&
+        (buffer.data.as_uint8 + buffer.size_bytes) <=
+            (sources[i].data + sources[i].size_bytes)) {
+      return sources + i;
+    }
+  }
+
+  return NULL;
+}
+
+static ArrowErrorCode ArrowIpcOutputStreamFileDescriptorSendfile(
+    struct ArrowIpcOutputStreamFileDescriptorPrivate* private_data,
+    const struct ArrowIpcOutputStreamSendfileSource* source,
+    struct ArrowBufferView buffer, struct ArrowError* error) {
+#if defined(__linux__)
+  off_t offset = (off_t)(buffer.data.as_uint8 - source->data);
+  int64_t bytes_remaining = buffer.size_bytes;
+  while (bytes_remaining > 0) {
+    // Like writev(), sendfile() may send fewer bytes than requested but advances
+    // offset past exactly the bytes that were sent
+    ssize_t bytes_written = sendfile(private_data->file_descriptor,
+                                     source->file_descriptor, &offset,
+                                     (size_t)bytes_remaining);
+    if (bytes_written < 0 && errno == EINTR) {
+      continue;
+    } else if (bytes_written <= 0) {
+      int code = bytes_written < 0 ? errno : EIO;
+      ArrowErrorSet(error, "ArrowIpcOutputStreamFileDescriptor sendfile() error: %s",
+                    strerror(code));
+      return code == EPIPE ? EPIPE : EIO;
+    }
+
+    bytes_remaining -= bytes_written;
+  }
+
+  return NANOARROW_OK;
+#else
+  return ArrowIpcOutputStreamFileDescriptorGather(private_data, &buffer, 1, error);
+#endif
+}
+
+// Writes buffers with as few calls as possible, gathering consecutive buffers except
+// those that can be sent from a sendfile() source
+static ArrowErrorCode ArrowIpcOutputStreamFileDescriptorWrite(
+    struct ArrowIpcOutputStream* stream, const struct ArrowBufferView* buffers,
+    int64_t n_buffers, struct ArrowError* error) {
+  struct ArrowIpcOutputStreamFileDescriptorPrivate* private_data =
+      (struct ArrowIpcOutputStreamFileDescriptorPrivate*)stream->private_data;
+
+  int64_t first_buffer = 0;
+  for (int64_t i = 0; i < n_buffers && private_data->sendfile_sources.size_bytes > 0;
+       i++) {
+    const struct ArrowIpcOutputStreamSendfileSource* source =
+        ArrowIpcOutputStreamFileDescriptorFindSource(private_data, buffers[i]);
+    if (source == NULL) {
+      continue;
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowIpcOutputStreamFileDescriptorGather(
+        private_data, buffers + first_buffer, i - first_buffer, error));
+    NANOARROW_RETURN_NOT_OK(ArrowIpcOutputStreamFileDescriptorSendfile(
+        private_data, source, buffers[i], error));
+    first_buffer = i + 1;
+  }
+
+  return ArrowIpcOutputStreamFileDescriptorGather(
+      private_data, buffers + first_buffer, n_buffers - first_buffer, error);
+}
+
+static void ArrowIpcOutputStreamFileDescriptorRelease(
+    struct ArrowIpcOutputStream* stream) {
+  struct ArrowIpcOutputStreamFileDescriptorPrivate* private_data =
+      (struct ArrowIpcOutputStreamFileDescriptorPrivate*)stream->private_data;
+
+  if (private_data->close_on_release) {
+    close(private_data->file_descriptor);
+  }
+
+  ArrowBufferReset(&private_data->sendfile_sources);
+  ArrowFree(private_data);
+  stream->release = NULL;
+}
+
+ArrowErrorCode ArrowIpcOutputStreamInitFileDescriptor(
+    struct ArrowIpcOutputStream* stream, int file_descriptor, int close_on_release) {
+  struct ArrowIpcOutputStreamFileDescriptorPrivate* private_data =
+      (struct ArrowIpcOutputStreamFileDescriptorPrivate*)ArrowMalloc(
+          sizeof(struct ArrowIpcOutputStreamFileDescriptorPrivate));
+  if (private_data == NULL) {
+    return ENOMEM;
+  }
+
+  struct stat file_stat;
+  private_data->file_descriptor = file_descriptor;
+  private_data->close_on_release = close_on_release;
+  private_data->is_socket =
+      fstat(file_descriptor, &file_stat) == 0 && S_ISSOCK(file_stat.st_mode);
+  ArrowBufferInit(&private_data->sendfile_sources);
+
+#if defined(SO_NOSIGPIPE)
+  // Platforms without MSG_NOSIGNAL (e.g., MacOS) disable SIGPIPE per socket
+  if (private_data->is_socket) {
+    int value = 1;
+    setsockopt(file_descriptor, SOL_SOCKET, SO_NOSIGPIPE, &value, sizeof(value));
+  }
+#endif
+
+  stream->write = &ArrowIpcOutputStreamFileDescriptorWrite;
+  stream->release = &ArrowIpcOutputStreamFileDescriptorRelease;
+  stream->private_data = private_data;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcOutputStreamAddSendfileSource(struct ArrowIpcOutputStream* stream,
+                                                     int file_descriptor,
+                                                     const void* data,
+                                                     int64_t size_bytes,
+                                                     struct ArrowError* error) {
+  if (stream->write != &ArrowIpcOutputStreamFileDescriptorWrite) {
+    ArrowErrorSet(error, "Expected an output stream created with "
+                         "ArrowIpcOutputStreamInitFileDescriptor()");
+    return EINVAL;
+  }
+
+  if (data == NULL || size_bytes < 0) {
+    ArrowErrorSet(error, "Expected a valid region of %ld bytes", (long)size_bytes);
+    return EINVAL;
+  }
+
+#if defined(__linux__)
+  struct ArrowIpcOutputStreamFileDescriptorPrivate* private_data =
+      (struct ArrowIpcOutputStreamFileDescriptorPrivate*)stream->private_data;
+  struct ArrowIpcOutputStreamSendfileSource source;
+  source.file_descriptor = file_descriptor;
+  source.data = (const uint8_t*)data;
+  source.size_bytes = size_bytes;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferAppend(&private_data->sendfile_sources, &source, sizeof(source)),
+      error);
+  return NANOARROW_OK;
+#else
+  ArrowErrorSet(error, "sendfile() is not supported on this platform");
+  return ENOTSUP;
+#endif
+}
+
+#endif
+
+// A copy of the DictionaryBatch message (header followed by body) last written for a
+// dictionary id such that a dictionary is only written again if the values of a later
+// batch encode differently. Comparing contents rather than buffer addresses ensures that
+// values written to memory that was freed and reallocated are not mistaken for the
+// values written before. Dictionaries of columns encoded by the writer are written as
+// deltas and leave message empty.
+struct ArrowIpcWriterDictionary {
+  struct ArrowBuffer message;
+};
+
+// A string or binary column of the current schema that the writer dictionary-encodes.
+// Values are assigned dictionary indices in order of first appearance by grouper,
+// whose keys persist across batches, such that only the values that are new to a
+// batch are written (as a delta) before it.
+struct ArrowIpcWriterEncodedColumn {
+  int64_t column_index;
+  struct ArrowGrouper grouper;
+  // The int32_t dictionary index of each group of grouper (or -1 for the null group)
+  struct ArrowBuffer group_indices;
+  // The number of values written to the dictionary so far
+  int64_t n_values;
+  // The int64_t group id and int32_t index of each element of the current batch and
+  // the int64_t element of the current batch that is the first of each new value
+  struct ArrowBuffer group_ids;
+  struct ArrowBuffer indices;
+  struct ArrowBuffer new_values;
+  // The new values of the current batch and the indices that replace the column in
+  // the current batch (whose dictionary is delta_view)
+  struct ArrowArray delta;
+  struct ArrowArrayView delta_view;
+  struct ArrowArrayView indices_view;
+};
+
+struct ArrowIpcWriterPrivate {
+  struct ArrowIpcEncoder encoder;
+  struct ArrowIpcOutputStream output_stream;
+  // The encapsulated header of the message being written
+  struct ArrowBuffer header;
+  // The ArrowBufferView elements (header followed by body) passed to write()
+  struct ArrowBuffer views;
+  // The number of bytes passed to write() so far (i.e., the current file offset)
+  int64_t bytes_written;
+  // Nonzero if ArrowIpcWriterStartFile() was called
+  int is_file;
+  int wrote_schema;
+  int wrote_end_of_stream;
+  // The schema and record batch locations accumulated in file mode
+  struct ArrowIpcFooter footer;
+  // The struct ArrowIpcWriterDictionary last written for each dictionary id
+  struct ArrowBuffer dictionaries;
+  // The int64_t indices of the columns to dictionary-encode in schemas written later
+  struct ArrowBuffer dictionary_encode;
+  // The columns of the current schema that are dictionary-encoded by the writer
+  struct ArrowIpcWriterEncodedColumn* encoded_columns;
+  int64_t n_encoded_columns;
+  // The children of the batch in which encoded columns are replaced by their indices
+  struct ArrowBuffer batch_children;
+  // The compression used for the bodies of future messages
+  enum ArrowIpcCompressionType codec;
+  // If pipeline_executor is non-NULL, ArrowIpcWriterWriteArrayStream() encodes
+  // windows of up to pipeline_n_batches batches as tasks of pipeline_executor
+  struct ArrowExecutor* pipeline_executor;
+  int64_t pipeline_n_batches;
+};
+
+ArrowErrorCode ArrowIpcWriterInit(struct ArrowIpcWriter* writer,
+                                  struct ArrowIpcOutputStream* output_stream) {
+  struct ArrowIpcWriterPrivate* private_data =
+      (struct ArrowIpcWriterPrivate*)ArrowMalloc(sizeof(struct ArrowIpcWriterPrivate));
+  if (private_data == NULL) {
+    return ENOMEM;
+  }
+
+  int result = ArrowIpcEncoderInit(&private_data->encoder);
+  if (result != NANOARROW_OK) {
+    ArrowFree(private_data);
+    return result;
+  }
+
+  ArrowIpcOutputStreamMove(output_stream, &private_data->output_stream);
+  ArrowBufferInit(&private_data->header);
+  ArrowBufferInit(&private_data->views);
+  private_data->bytes_written = 0;
+  private_data->is_file = 0;
+  private_data->wrote_schema = 0;
+  private_data->wrote_end_of_stream = 0;
+  ArrowIpcFooterInit(&private_data->footer);
+  ArrowBufferInit(&private_data->dictionaries);
+  ArrowBufferInit(&private_data->dictionary_encode);
+  private_data->encoded_columns = NULL;
+  private_data->n_encoded_columns = 0;
+  ArrowBufferInit(&private_data->batch_children);
+  private_data->codec = NANOARROW_IPC_COMPRESSION_TYPE_NONE;
+  private_data->pipeline_executor = NULL;
+  private_data->pipeline_n_batches = 0;
+  writer->private_data = private_data;
+  return NANOARROW_OK;
+}
+
+static void ArrowIpcWriterResetEncodedColumns(
+    struct ArrowIpcWriterPrivate* private_data) {
+  for (int64_t i = 0; i < private_data->n_encoded_columns; i++) {
+    struct ArrowIpcWriterEncodedColumn* encoded = private_data->encoded_columns + i;
+    ArrowGrouperReset(&encoded->grouper);
+    ArrowBufferReset(&encoded->group_indices);
+    ArrowBufferReset(&encoded->group_ids);
+    ArrowBufferReset(&encoded->indices);
+    ArrowBufferReset(&encoded->new_values);
+    if (encoded->delta.release != NULL) {
+      encoded->delta.release(&encoded->delta);
+    }
+    ArrowArrayViewReset(&encoded->delta_view);
+    // The dictionary of indices_view is delta_view, which is not owned by it
+    encoded->indices_view.dictionary = NULL;
+    ArrowArrayViewReset(&encoded->indices_view);
+  }
+
+  if (private_data->encoded_columns != NULL) {
+    ArrowFree(private_data->encoded_columns);
+  }
+
+  private_data->encoded_columns = NULL;
+  private_data->n_encoded_columns = 0;
+}
+
+static void ArrowIpcWriterResetDictionaries(struct ArrowIpcWriterPrivate* private_data) {
+  struct ArrowIpcWriterDictionary* written =
+      (struct ArrowIpcWriterDictionary*)private_data->dictionaries.data;
+  int64_t n_written =
+      private_data->dictionaries.size_bytes / sizeof(struct ArrowIpcWriterDictionary);
+  for (int64_t i = 0; i < n_written; i++) {
+    ArrowBufferReset(&written[i].message);
+  }
+
+  private_data->dictionaries.size_bytes = 0;
+}
+
+void ArrowIpcWriterReset(struct ArrowIpcWriter* writer) {
+  struct ArrowIpcWriterPrivate* private_data =
+      (struct ArrowIpcWriterPrivate*)writer->private_data;
+
+  if (private_data != NULL) {
+    ArrowIpcEncoderReset(&private_data->encoder);
+    if (private_data->output_stream.release != NULL) {
+      private_data->output_stream.release(&private_data->output_stream);
+    }
+
+    ArrowBufferReset(&private_data->header);
+    ArrowBufferReset(&private_data->views);
+    ArrowIpcFooterReset(&private_data->footer);
+    ArrowIpcWriterResetDictionaries(private_data);
+    ArrowBufferReset(&private_data->dictionaries);
+    ArrowBufferReset(&private_data->dictionary_encode);
+    ArrowIpcWriterResetEncodedColumns(private_data);
+    ArrowBufferReset(&private_data->batch_children);
+    ArrowFree(private_data);
+    writer->private_data = NULL;
+  }
+}
+
+ArrowErrorCode ArrowIpcWriterSetCompression(struct ArrowIpcWriter* writer,
+                                            enum ArrowIpcCompressionType codec) {
+  struct ArrowIpcWriterPrivate* private_data =
+      (struct ArrowIpcWriterPrivate*)writer->private_data;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderSetCompression(&private_data->encoder, codec));
+  private_data->codec = codec;
+  return NANOARROW_OK;
+}
+
+void ArrowIpcWriterSetExecutor(struct ArrowIpcWriter* writer,
+                               struct ArrowExecutor* executor) {
+  struct ArrowIpcWriterPrivate* private_data =
+      (struct ArrowIpcWriterPrivate*)writer->private_data;
+  ArrowIpcEncoderSetExecutor(&private_data->encoder, executor);
+}
+
+ArrowErrorCode ArrowIpcWriterSetPipeline(struct ArrowIpcWriter* writer,
+                                         struct ArrowExecutor* executor,
+                                         int64_t n_batches) {
+  struct ArrowIpcWriterPrivate* private_data =
+      (struct ArrowIpcWriterPrivate*)writer->private_data;
+  if (executor != NULL && n_batches < 1) {
+    return EINVAL;
+  }
+
+  private_data->pipeline_executor = executor;
+  private_data->pipeline_n_batches = n_batches;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcWriterSetDictionaryEncode(struct ArrowIpcWriter* writer,
+                                                const int64_t* column_indices,
+                                                int64_t n_columns) {
+  struct ArrowIpcWriterPrivate* private_data =
+      (struct ArrowIpcWriterPrivate*)writer->private_data;
+  if (n_columns < 0) {
+    return EINVAL;
+  }
+
+  for (int64_t i = 0; i < n_columns; i++) {
+    if (column_indices[i] < 0) {
+      return EINVAL;
+    }
+  }
+
+  private_data->dictionary_encode.size_bytes = 0;
+  return ArrowBufferAppend(&private_data->dictionary_encode, column_indices,
+                           n_columns * sizeof(int64_t));
+}
+
+static ArrowErrorCode ArrowIpcWriterWrite(struct ArrowIpcWriterPrivate* private_data,
+                                          const struct ArrowBufferView* views,
+                                          int64_t n_views, struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(private_data->output_stream.write(&private_data->output_stream,
+                                                            views, n_views, error));
+  for (int64_t i = 0; i < n_views; i++) {
+    private_data->bytes_written += views[i].size_bytes;
+  }
+
+  return NANOARROW_OK;
+}
+
+// Writes a finalized message header and the body of the message last encoded by
+// encoder with a single call to write()
+static ArrowErrorCode ArrowIpcWriterWriteMessage(
+    struct ArrowIpcWriterPrivate* private_data, struct ArrowIpcEncoder* encoder,
+    const struct ArrowBuffer* header_buffer, struct ArrowError* error) {
+  struct ArrowBufferView header;
+  header.data.as_uint8 = header_buffer->data;
+  header.size_bytes = header_buffer->size_bytes;
+
+  private_data->views.size_bytes = 0;
+  int64_t n_views = 1 + encoder->n_body_buffers;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowBufferReserve(&private_data->views, n_views * sizeof(struct ArrowBufferView)));
+  ArrowBufferAppendUnsafe(&private_data->views, &header, sizeof(header));
+  if (encoder->n_body_buffers > 0) {
+    ArrowBufferAppendUnsafe(&private_data->views, encoder->body_buffers,
+                            encoder->n_body_buffers * sizeof(struct ArrowBufferView));
+  }
+
+  const struct ArrowBufferView* views =
+      (const struct ArrowBufferView*)private_data->views.data;
+  return ArrowIpcWriterWrite(private_data, views, n_views, error);
+}
+
+// Replaces the content of header with the last encoded message header
+static ArrowErrorCode ArrowIpcWriterFinalizeHeader(struct ArrowIpcEncoder* encoder,
+                                                   struct ArrowBuffer* header,
+                                                   struct ArrowError* error) {
+  header->size_bytes = 0;
+  int result = ArrowIpcEncoderFinalizeBuffer(encoder, header);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "ArrowIpcEncoderFinalizeBuffer() failed");
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+// Writes the last encoded message header and its body with a single call to write()
+static ArrowErrorCode ArrowIpcWriterWriteEncodedMessage(
+    struct ArrowIpcWriterPrivate* private_data, struct ArrowError* error) {
+  struct ArrowIpcEncoder* encoder = &private_data->encoder;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcWriterFinalizeHeader(encoder, &private_data->header, error));
+  return ArrowIpcWriterWriteMessage(private_data, encoder, &private_data->header, error);
+}
+
+// Writes a finalized RecordBatch message and, in file mode, records its location
+static ArrowErrorCode ArrowIpcWriterWriteRecordBatchMessage(
+    struct ArrowIpcWriterPrivate* private_data, struct ArrowIpcEncoder* encoder,
+    const struct ArrowBuffer* header, struct ArrowError* error) {
+  struct ArrowIpcFileBlock block;
+  block.offset = private_data->bytes_written;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcWriterWriteMessage(private_data, encoder, header, error));
+
+  if (private_data->is_file) {
+    block.metadata_length = (int32_t)header->size_bytes;
+    block.body_length = encoder->body_size_bytes;
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+        ArrowBufferAppend(&private_data->footer.record_batch_blocks, &block,
+                          sizeof(block)),
+        error);
+  }
+
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowIpcWriterWriteEndOfStream(
+    struct ArrowIpcWriterPrivate* private_data, struct ArrowError* error) {
+  static const uint8_t kEndOfStream[8] = {0xFF, 0xFF, 0xFF, 0xFF, 0, 0, 0, 0};
+  struct ArrowBufferView end_of_stream;
+  end_of_stream.data.as_uint8 = kEndOfStream;
+  end_of_stream.size_bytes = sizeof(kEndOfStream);
+  NANOARROW_RETURN_NOT_OK(ArrowIpcWriterWrite(private_data, &end_of_stream, 1, error));
+  private_data->wrote_end_of_stream = 1;
+  return NANOARROW_OK;
+}
+
+// Initializes an encoded column for the string or binary column i of schema and
+// replaces the column by a dictionary-encoded field with int32 indices
+static ArrowErrorCode ArrowIpcWriterInitEncodedColumn(
+    struct ArrowIpcWriterEncodedColumn* encoded, struct ArrowSchema* schema, int64_t i,
+    struct ArrowError* error) {
+  if (i >= schema->n_children) {
+    ArrowErrorSet(error,
+                  "Can't dictionary-encode column %ld of a schema with %ld columns",
+                  (long)i, (long)schema->n_children);
+    return EINVAL;
+  }
+
+  struct ArrowSchema* child = schema->children[i];
+  struct ArrowSchemaView schema_view;
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaViewInit(&schema_view, child, error));
+  switch (schema_view.type) {
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_BINARY:
+    case NANOARROW_TYPE_LARGE_BINARY:
+      if (child->dictionary == NULL) {
+        break;
+      }
+      // fall through
+    default:
+      ArrowErrorSet(error, "Can't dictionary-encode column %ld of type %s%s", (long)i,
+                    child->dictionary != NULL ? "dictionary<...> of " : "",
+                    ArrowTypeString(schema_view.type));
+      return EINVAL;
+  }
+
+  struct ArrowSchema values;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowSchemaInitFromType(&values, schema_view.type),
+                                     error);
+  int result = ArrowGrouperInit(&encoded->grouper, &values, error);
+  values.release(&values);
+  NANOARROW_RETURN_NOT_OK(result);
+
+  encoded->column_index = i;
+  ArrowBufferInit(&encoded->group_indices);
+  encoded->n_values = 0;
+  ArrowBufferInit(&encoded->group_ids);
+  ArrowBufferInit(&encoded->indices);
+  ArrowBufferInit(&encoded->new_values);
+  encoded->delta.release = NULL;
+  ArrowArrayViewInitFromType(&encoded->delta_view, schema_view.type);
+  ArrowArrayViewInitFromType(&encoded->indices_view, NANOARROW_TYPE_INT32);
+
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowSchemaAllocateDictionary(child), error);
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowSchemaInitFromType(child->dictionary, schema_view.type), error);
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowSchemaSetFormat(child, "i"), error);
+  return NANOARROW_OK;
+}
+
+// Initializes an encoded column for each column of schema selected by
+// ArrowIpcWriterSetDictionaryEncode() and sets out to a copy of schema in which they
+// are dictionary-encoded
+static ArrowErrorCode ArrowIpcWriterInitEncodedColumns(
+    struct ArrowIpcWriterPrivate* private_data, struct ArrowSchema* schema,
+    struct ArrowSchema* out, struct ArrowError* error) {
+  const int64_t* column_indices = (const int64_t*)private_data->dictionary_encode.data;
+  int64_t n_columns = private_data->dictionary_encode.size_bytes / sizeof(int64_t);
+
+  private_data->encoded_columns = (struct ArrowIpcWriterEncodedColumn*)ArrowMalloc(
+      n_columns * sizeof(struct ArrowIpcWriterEncodedColumn));
+  if (private_data->encoded_columns == NULL) {
+    ArrowErrorSet(error, "Failed to allocate %ld encoded columns", (long)n_columns);
+    return ENOMEM;
+  }
+
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowSchemaDeepCopy(schema, out), error);
+  for (int64_t i = 0; i < n_columns; i++) {
+    // Encoded columns are only reset once their grouper has been initialized
+    struct ArrowIpcWriterEncodedColumn* encoded =
+        private_data->encoded_columns + private_data->n_encoded_columns;
+    encoded->grouper.private_data = NULL;
+    int result = ArrowIpcWriterInitEncodedColumn(encoded, out, column_indices[i], error);
+    if (encoded->grouper.private_data != NULL) {
+      private_data->n_encoded_columns++;
+    }
+
+    if (result != NANOARROW_OK) {
+      out->release(out);
+      return result;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcWriterWriteSchema(struct ArrowIpcWriter* writer,
+                                         struct ArrowSchema* schema,
+                                         struct ArrowError* error) {
+  struct ArrowIpcWriterPrivate* private_data =
+      (struct ArrowIpcWriterPrivate*)writer->private_data;
+
+  // The values of encoded columns are only valid for batches of this schema
+  ArrowIpcWriterResetEncodedColumns(private_data);
+  struct ArrowSchema encoded_schema;
+  encoded_schema.release = NULL;
+  if (private_data->dictionary_encode.size_bytes > 0) {
+    int result =
+        ArrowIpcWriterInitEncodedColumns(private_data, schema, &encoded_schema, error);
+    if (result != NANOARROW_OK) {
+      ArrowIpcWriterResetEncodedColumns(private_data);
+      return result;
+    }
+
+    schema = &encoded_schema;
+  }
+
+  int result = ArrowIpcEncoderEncodeSchema(&private_data->encoder, schema, error);
+  if (result == NANOARROW_OK) {
+    result = ArrowIpcWriterWriteEncodedMessage(private_data, error);
+  }
+
+  if (result == NANOARROW_OK) {
+    private_data->wrote_schema = 1;
+    ArrowIpcWriterResetDictionaries(private_data);
+  }
+
+  if (result == NANOARROW_OK && private_data->is_file) {
+    struct ArrowSchema* footer_schema = &private_data->footer.schema;
+    if (footer_schema->release != NULL) {
+      footer_schema->release(footer_schema);
+    }
+
+    result = ArrowSchemaDeepCopy(schema, footer_schema);
+    if (result != NANOARROW_OK) {
+      ArrowErrorSet(error, "ArrowSchemaDeepCopy() failed");
+    }
+  }
+
+  if (encoded_schema.release != NULL) {
+    encoded_schema.release(&encoded_schema);
+  }
+
+  return result;
+}
+
+// Assigns a dictionary index to each element of column, collects the values that
+// have not been seen in a previous batch into encoded->delta, and sets
+// encoded->indices_view to the indices of column
+static ArrowErrorCode ArrowIpcWriterEncodeColumn(
+    struct ArrowIpcWriterEncodedColumn* encoded, struct ArrowArrayView* column,
+    struct ArrowError* error) {
+  if (column->storage_type != encoded->delta_view.storage_type ||
+      column->dictionary != NULL) {
+    ArrowErrorSet(error, "Expected column %ld of type %s but found %s",
+                  (long)encoded->column_index,
+                  ArrowTypeString(encoded->delta_view.storage_type),
+                  ArrowTypeString(column->storage_type));
+    return EINVAL;
+  }
+
+  int64_t n = column->length;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferResize(&encoded->group_ids, n * sizeof(int64_t), 0), error);
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferResize(&encoded->indices, n * sizeof(int32_t), 0), error);
+  int64_t* group_ids = (int64_t*)encoded->group_ids.data;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowGrouperConsume(&encoded->grouper, column, group_ids, error));
+
+  // Groups are numbered in order of first appearance, so a group is new exactly when
+  // its id is the number of groups seen before it
+  encoded->new_values.size_bytes = 0;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferReserve(&encoded->group_indices,
+                         (encoded->grouper.n_groups * sizeof(int32_t)) -
+                             encoded->group_indices.size_bytes),
+      error);
+  int32_t* indices = (int32_t*)encoded->indices.data;
+  for (int64_t j = 0; j < n; j++) {
+    int64_t n_groups = encoded->group_indices.size_bytes / sizeof(int32_t);
+    if (group_ids[j] == n_groups) {
+      int32_t index = -1;
+      if (!ArrowArrayViewIsNull(column, j)) {
+        if (encoded->n_values == INT32_MAX) {
+          ArrowErrorSet(error,
+                        "Can't dictionary-encode more than %ld values in column %ld",
+                        (long)INT32_MAX, (long)encoded->column_index);
+          return EOVERFLOW;
+        }
+
+        index = (int32_t)encoded->n_values++;
+        NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+            ArrowBufferAppendInt64(&encoded->new_values, j), error);
+      }
+
+      ArrowBufferAppendUnsafe(&encoded->group_indices, &index, sizeof(int32_t));
+    }
+
+    int32_t index = ((const int32_t*)encoded->group_indices.data)[group_ids[j]];
+    indices[j] = index < 0 ? 0 : index;
+  }
+
+  if (encoded->delta.release != NULL) {
+    encoded->delta.release(&encoded->delta);
+  }
+
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowArrayInitFromType(&encoded->delta, column->storage_type), error);
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowArrayStartAppending(&encoded->delta), error);
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowArrayAppendTake(&encoded->delta, column,
+                           (const int64_t*)encoded->new_values.data,
+                           encoded->new_values.size_bytes / sizeof(int64_t)),
+      error);
+  NANOARROW_RETURN_NOT_OK(ArrowArrayFinishBuildingDefault(&encoded->delta, error));
+  NANOARROW_RETURN_NOT_OK(
+      ArrowArrayViewSetArray(&encoded->delta_view, &encoded->delta, error));
+
+  // The indices share the validity buffer of column
+  struct ArrowArrayView* indices_view = &encoded->indices_view;
+  indices_view->length = n;
+  indices_view->offset = 0;
+  indices_view->null_count = column->null_count;
+  indices_view->buffer_views[0] = column->buffer_views[0];
+  indices_view->buffer_views[1].data.data = encoded->indices.data;
+  indices_view->buffer_views[1].size_bytes = n * sizeof(int32_t);
+  indices_view->dictionary = &encoded->delta_view;
+  return NANOARROW_OK;
+}
+
+// Returns the encoded column whose indices are array_view or NULL
+static struct ArrowIpcWriterEncodedColumn* ArrowIpcWriterFindEncodedColumn(
+    struct ArrowIpcWriterPrivate* private_data, struct ArrowArrayView* array_view) {
+  for (int64_t i = 0; i < private_data->n_encoded_columns; i++) {
+    if (&private_data->encoded_columns[i].indices_view == array_view) {
+      return private_data->encoded_columns + i;
+    }
+  }
+
+  return NULL;
+}
+
+// Sets out to a copy of in whose encoded columns are replaced by their indices
+static ArrowErrorCode ArrowIpcWriterEncodeColumns(
+    struct ArrowIpcWriterPrivate* private_data, struct ArrowArrayView* in,
+    struct ArrowArrayView* out, struct ArrowError* error) {
+  if (in->storage_type != NANOARROW_TYPE_STRUCT) {
+    ArrowErrorSet(error, "Expected struct array to dictionary-encode but found %s",
+                  ArrowTypeString(in->storage_type));
+    return EINVAL;
+  }
+
+  private_data->batch_children.size_bytes = 0;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferAppend(&private_data->batch_children, in->children,
+                        in->n_children * sizeof(struct ArrowArrayView*)),
+      error);
+  struct ArrowArrayView** children =
+      (struct ArrowArrayView**)private_data->batch_children.data;
+
+  for (int64_t i = 0; i < private_data->n_encoded_columns; i++) {
+    struct ArrowIpcWriterEncodedColumn* encoded = private_data->encoded_columns + i;
+    if (encoded->column_index >= in->n_children) {
+      ArrowErrorSet(error, "Expected at least %ld columns but found %ld",
+                    (long)(encoded->column_index + 1), (long)in->n_children);
+      return EINVAL;
+    }
+
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcWriterEncodeColumn(encoded, children[encoded->column_index], error));
+    children[encoded->column_index] = &encoded->indices_view;
+  }
+
+  *out = *in;
+  out->children = children;
+  return NANOARROW_OK;
+}
+
+// Returns non-zero if the finalized header and the body of the last encoded message
+// are identical to message
+static int ArrowIpcWriterMessageEquals(const struct ArrowBuffer* message,
+                                       const struct ArrowBuffer* header,
+                                       const struct ArrowIpcEncoder* encoder) {
+  int64_t size_bytes = header->size_bytes;
+  for (int64_t i = 0; i < encoder->n_body_buffers; i++) {
+    size_bytes += encoder->body_buffers[i].size_bytes;
+  }
+
+  if (size_bytes != message->size_bytes ||
+      memcmp(message->data, header->data, (size_t)header->size_bytes) != 0) {
+    return 0;
+  }
+
+  const uint8_t* data = message->data + header->size_bytes;
+  for (int64_t i = 0; i < encoder->n_body_buffers; i++) {
+    const struct ArrowBufferView* body = encoder->body_buffers + i;
+    if (body->size_bytes > 0 &&
+        memcmp(data, body->data.data, (size_t)body->size_bytes) != 0) {
+      return 0;
+    }
+
+    data += body->size_bytes;
+  }
+
+  return 1;
+}
+
+// Replaces the content of message with the finalized header and the body of the last
+// encoded message
+static ArrowErrorCode ArrowIpcWriterCopyMessage(struct ArrowBuffer* message,
+                                                const struct ArrowBuffer* header,
+                                                const struct ArrowIpcEncoder* encoder) {
+  message->size_bytes = 0;
+  NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(message, header->data, header->size_bytes));
+  for (int64_t i = 0; i < encoder->n_body_buffers; i++) {
+    const struct ArrowBufferView* body = encoder->body_buffers + i;
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferAppend(message, body->data.data, body->size_bytes));
+  }
+
+  return NANOARROW_OK;
+}
+
+// Writes a DictionaryBatch message for the values of each dictionary-encoded node of
+// array_view (assigning ids in the same depth-first order as
+// ArrowIpcEncoderEncodeSchema()) unless the same values were written last
+static ArrowErrorCode ArrowIpcWriterWriteDictionaries(
+    struct ArrowIpcWriterPrivate* private_data, struct ArrowArrayView* array_view,
+    int64_t* dictionary_id, struct ArrowError* error) {
+  struct ArrowArrayView* values = array_view->dictionary;
+  if (values != NULL) {
+    int64_t id = *dictionary_id;
+    *dictionary_id += 1;
+
+    struct ArrowIpcWriterDictionary* written =
+        (struct ArrowIpcWriterDictionary*)private_data->dictionaries.data;
+    int64_t n_written =
+        private_data->dictionaries.size_bytes / sizeof(struct ArrowIpcWriterDictionary);
+    int is_encoded = ArrowIpcWriterFindEncodedColumn(private_data, array_view) != NULL;
+    int is_delta = 0;
+    int is_unchanged;
+    if (is_encoded) {
+      // The values of an encoded column are those that are new to this batch, which
+      // are appended to the values written before
+      is_delta = id < n_written;
+      is_unchanged = is_delta && values->length == 0;
+    } else {
+      is_unchanged = 0;
+    }
+
+    if (!is_unchanged) {
+      NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderEncodeDictionaryBatch(
+          &private_data->encoder, id, is_delta, values, error));
+      NANOARROW_RETURN_NOT_OK(ArrowIpcWriterFinalizeHeader(
+          &private_data->encoder, &private_data->header, error));
+    }
+
+    if (!is_encoded && id < n_written) {
+      is_unchanged = ArrowIpcWriterMessageEquals(
+          &written[id].message, &private_data->header, &private_data->encoder);
+      if (!is_unchanged && private_data->is_file) {
+        ArrowErrorSet(error,
+                      "Can't replace dictionary with id %ld in the Arrow IPC file format",
+                      (long)id);
+        return EINVAL;
+      }
+    }
+
+    if (!is_unchanged) {
+      struct ArrowIpcFileBlock block;
+      block.offset = private_data->bytes_written;
+      NANOARROW_RETURN_NOT_OK(ArrowIpcWriterWriteMessage(
+          private_data, &private_data->encoder, &private_data->header, error));
+
+      if (private_data->is_file) {
+        block.metadata_length = (int32_t)private_data->header.size_bytes;
+        block.body_length = private_data->encoder.body_size_bytes;
+        NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+            ArrowBufferAppend(&private_data->footer.dictionary_blocks, &block,
+                              sizeof(block)),
+            error);
+      }
+
+      if (id >= n_written) {
+        struct ArrowIpcWriterDictionary dictionary;
+        ArrowBufferInit(&dictionary.message);
+        NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+            ArrowBufferAppend(&private_data->dictionaries, &dictionary,
+                              sizeof(dictionary)),
+            error);
+        written = (struct ArrowIpcWriterDictionary*)private_data->dictionaries.data;
+      }
+
+      if (!is_encoded) {
+        NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+            ArrowIpcWriterCopyMessage(&written[id].message, &private_data->header,
+                                      &private_data->encoder),
+            error);
+      }
+    }
+  }
+
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcWriterWriteDictionaries(
+        private_data, array_view->children[i], dictionary_id, error));
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcWriterWriteArrayView(struct ArrowIpcWriter* writer,
+                                            struct ArrowArrayView* in,
+                                            struct ArrowError* error) {
+  struct ArrowIpcWriterPrivate* private_data =
+      (struct ArrowIpcWriterPrivate*)writer->private_data;
+
+  if (in == NULL) {
+    return ArrowIpcWriterWriteEndOfStream(private_data, error);
+  }
+
+  struct ArrowArrayView encoded;
+  if (private_data->n_encoded_columns > 0) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcWriterEncodeColumns(private_data, in, &encoded, error));
+    in = &encoded;
+  }
+
+  int64_t dictionary_id = 0;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcWriterWriteDictionaries(private_data, in, &dictionary_id, error));
+
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcEncoderEncodeRecordBatch(&private_data->encoder, in, error));
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcWriterFinalizeHeader(&private_data->encoder, &private_data->header, error));
+  return ArrowIpcWriterWriteRecordBatchMessage(private_data, &private_data->encoder,
+                                               &private_data->header, error);
+}
+
+static int ArrowIpcWriterHasDictionary(struct ArrowArrayView* array_view) {
+  if (array_view->dictionary != NULL) {
+    return 1;
+  }
+
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    if (ArrowIpcWriterHasDictionary(array_view->children[i])) {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+// A batch written by ArrowIpcWriterWriteArrayStream() with a pipeline executor. Each
+// task has its own encoder (and header) such that tasks can be encoded concurrently.
+struct ArrowIpcWriterTask {
+  struct ArrowIpcEncoder encoder;
+  struct ArrowBuffer header;
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  int result;
+  struct ArrowError error;
+};
+
+// One step of the pipeline: task 0 writes the n_writing batches encoded by the
+// previous step in order while tasks 1 to n_encoding encode the batches read for
+// this step
+struct ArrowIpcWriterPipeline {
+  struct ArrowIpcWriterPrivate* private_data;
+  struct ArrowIpcWriterTask* writing;
+  int64_t n_writing;
+  struct ArrowIpcWriterTask* encoding;
+  int64_t n_encoding;
+  int write_result;
+  struct ArrowError write_error;
+};
+
+static void ArrowIpcWriterPipelineTask(void* task_private, int64_t i) {
+  struct ArrowIpcWriterPipeline* pipeline = (struct ArrowIpcWriterPipeline*)task_private;
+
+  if (i > 0) {
+    struct ArrowIpcWriterTask* task = pipeline->encoding + i - 1;
+    task->result =
+        ArrowIpcEncoderEncodeRecordBatch(&task->encoder, &task->array_view, &task->error);
+    if (task->result == NANOARROW_OK) {
+      task->result =
+          ArrowIpcWriterFinalizeHeader(&task->encoder, &task->header, &task->error);
+    }
+
+    return;
+  }
+
+  pipeline->write_result = NANOARROW_OK;
+  for (int64_t j = 0; j < pipeline->n_writing; j++) {
+    struct ArrowIpcWriterTask* task = pipeline->writing + j;
+    pipeline->write_result = ArrowIpcWriterWriteRecordBatchMessage(
+        pipeline->private_data, &task->encoder, &task->header, &pipeline->write_error);
+    if (pipeline->write_result != NANOARROW_OK) {
+      return;
+    }
+  }
+}
+
+static void ArrowIpcWriterResetTasks(struct ArrowIpcWriterTask* tasks, int64_t n_tasks) {
+  for (int64_t i = 0; i < n_tasks; i++) {
+    ArrowIpcEncoderReset(&tasks[i].encoder);
+    ArrowBufferReset(&tasks[i].header);
+    ArrowArrayViewReset(&tasks[i].array_view);
+    if (tasks[i].array.release != NULL) {
+      tasks[i].array.release(&tasks[i].array);
+    }
+  }
+
+  ArrowFree(tasks);
+}
+
+// Reads up to pipeline_n_batches arrays from in on the calling thread and then, as
+// tasks of a single call to the executor, encodes them while the arrays read
+// previously are written
+static ArrowErrorCode ArrowIpcWriterWriteArrayStreamPipelined(
+    struct ArrowIpcWriterPrivate* private_data, struct ArrowArrayStream* in,
+    struct ArrowSchema* schema, struct ArrowError* error) {
+  struct ArrowExecutor* executor = private_data->pipeline_executor;
+  const int64_t n_batches = private_data->pipeline_n_batches;
+
+  struct ArrowIpcWriterTask* tasks = (struct ArrowIpcWriterTask*)ArrowMalloc(
+      2 * n_batches * sizeof(struct ArrowIpcWriterTask));
+  if (tasks == NULL) {
+    ArrowErrorSet(error, "Failed to allocate %ld writer tasks", (long)(2 * n_batches));
+    return ENOMEM;
+  }
+
+  int64_t n_tasks = 0;
+  int result = NANOARROW_OK;
+  while (result == NANOARROW_OK && n_tasks < 2 * n_batches) {
+    struct ArrowIpcWriterTask* task = tasks + n_tasks;
+    result = ArrowIpcEncoderInit(&task->encoder);
+    if (result != NANOARROW_OK) {
+      ArrowErrorSet(error, "ArrowIpcEncoderInit() failed");
+      break;
+    }
+
+    ArrowBufferInit(&task->header);
+    ArrowArrayViewInitFromType(&task->array_view, NANOARROW_TYPE_UNINITIALIZED);
+    task->array.release = NULL;
+    n_tasks++;
+
+    result = ArrowIpcEncoderSetCompression(&task->encoder, private_data->codec);
+    if (result == NANOARROW_OK) {
+      result = ArrowArrayViewInitFromSchema(&task->array_view, schema, error);
+    }
+  }
+
+  struct ArrowIpcWriterPipeline pipeline;
+  pipeline.private_data = private_data;
+  pipeline.writing = tasks;
+  pipeline.n_writing = 0;
+  pipeline.encoding = tasks + n_batches;
+  pipeline.n_encoding = 0;
+
+  // A read error is returned once the batches read before it have been written
+  int read_result = NANOARROW_OK;
+  int finished = 0;
+  while (result == NANOARROW_OK) {
+    while (!finished && pipeline.n_encoding < n_batches) {
+      struct ArrowIpcWriterTask* task = pipeline.encoding + pipeline.n_encoding;
+      read_result = in->get_next(in, &task->array);
+      if (read_result != NANOARROW_OK) {
+        const char* message = in->get_last_error(in);
+        ArrowErrorSet(error, "ArrowArrayStream::get_next() failed: %s",
+                      message == NULL ? "" : message);
+        task->array.release = NULL;
+        finished = 1;
+      } else if (task->array.release == NULL) {
+        finished = 1;
+      } else {
+        read_result = ArrowArrayViewSetArray(&task->array_view, &task->array, error);
+        finished = read_result != NANOARROW_OK;
+        pipeline.n_encoding += !finished;
+      }
+    }
+
+    if (pipeline.n_writing == 0 && pipeline.n_encoding == 0) {
+      break;
+    }
+
+    executor->parallel_for(executor, &ArrowIpcWriterPipelineTask, &pipeline,
+                           1 + pipeline.n_encoding);
+
+    // Written batches are released such that at most two windows of batches are
+    // held at once
+    for (int64_t j = 0; j < pipeline.n_writing; j++) {
+      pipeline.writing[j].array.release(&pipeline.writing[j].array);
+    }
+
+    // Errors are returned in stream order
+    if (pipeline.write_result != NANOARROW_OK) {
+      result = pipeline.write_result;
+      ArrowErrorSet(error, "%s", pipeline.write_error.message);
+      break;
+    }
+
+    for (int64_t j = 0; j < pipeline.n_encoding; j++) {
+      if (pipeline.encoding[j].result != NANOARROW_OK) {
+        result = pipeline.encoding[j].result;
+        ArrowErrorSet(error, "%s", pipeline.encoding[j].error.message);
+        break;
+      }
+    }
+
+    struct ArrowIpcWriterTask* written = pipeline.writing;
+    pipeline.writing = pipeline.encoding;
+    pipeline.n_writing = pipeline.n_encoding;
+    pipeline.encoding = written;
+    pipeline.n_encoding = 0;
+  }
+
+  if (result == NANOARROW_OK) {
+    result = read_result;
+  }
+
+  if (result == NANOARROW_OK) {
+    result = ArrowIpcWriterWriteEndOfStream(private_data, error);
+  }
+
+  ArrowIpcWriterResetTasks(tasks, n_tasks);
+  return result;
+}
+
+ArrowErrorCode ArrowIpcWriterWriteArrayStream(struct ArrowIpcWriter* writer,
+                                              struct ArrowArrayStream* in,
+                                              struct ArrowError* error) {
+  struct ArrowSchema schema;
+  int result = in->get_schema(in, &schema);
+  if (result != NANOARROW_OK) {
+    const char* message = in->get_last_error(in);
+    ArrowErrorSet(error, "ArrowArrayStream::get_schema() failed: %s",
+                  message == NULL ? "" : message);
+    return result;
+  }
+
+  struct ArrowIpcWriterPrivate* private_data =
+      (struct ArrowIpcWriterPrivate*)writer->private_data;
+  struct ArrowArrayView array_view;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_UNINITIALIZED);
+  result = ArrowIpcWriterWriteSchema(writer, &schema, error);
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayViewInitFromSchema(&array_view, &schema, error);
+  }
+
+  // Dictionaries are written in order with the batches that refer to them, so
+  // streams with dictionary-encoded columns are written one batch at a time
+  if (result == NANOARROW_OK && private_data->pipeline_executor != NULL &&
+      private_data->n_encoded_columns == 0 && !ArrowIpcWriterHasDictionary(&array_view)) {
+    result = ArrowIpcWriterWriteArrayStreamPipelined(private_data, in, &schema, error);
+    ArrowArrayViewReset(&array_view);
+    schema.release(&schema);
+    return result;
+  }
+
+  schema.release(&schema);
+
+  struct ArrowArray array;
+  while (result == NANOARROW_OK) {
+    result = in->get_next(in, &array);
+    if (result != NANOARROW_OK) {
+      const char* message = in->get_last_error(in);
+      ArrowErrorSet(error, "ArrowArrayStream::get_next() failed: %s",
+                    message == NULL ? "" : message);
+      break;
+    }
+
+    if (array.release == NULL) {
+      result = ArrowIpcWriterWriteArrayView(writer, NULL, error);
+      break;
+    }
+
+    result = ArrowArrayViewSetArray(&array_view, &array, error);
+    if (result == NANOARROW_OK) {
+      result = ArrowIpcWriterWriteArrayView(writer, &array_view, error);
+    }
+
+    array.release(&array);
+  }
+
+  ArrowArrayViewReset(&array_view);
+  return result;
+}
+
+ArrowErrorCode ArrowIpcWriterStartFile(struct ArrowIpcWriter* writer,
+                                       struct ArrowError* error) {
+  struct ArrowIpcWriterPrivate* private_data =
+      (struct ArrowIpcWriterPrivate*)writer->private_data;
+
+  if (private_data->bytes_written != 0) {
+    ArrowErrorSet(error, "Can't start a file after writing %ld bytes",
+                  (long)private_data->bytes_written);
+    return EINVAL;
+  }
+
+  // The magic bytes are padded to 8 bytes such that messages remain aligned
+  static const uint8_t kMagic[8] = {'A', 'R', 'R', 'O', 'W', '1', 0, 0};
+  struct ArrowBufferView magic;
+  magic.data.as_uint8 = kMagic;
+  magic.size_bytes = sizeof(kMagic);
+  NANOARROW_RETURN_NOT_OK(ArrowIpcWriterWrite(private_data, &magic, 1, error));
+  private_data->is_file = 1;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcWriterFinalizeFile(struct ArrowIpcWriter* writer,
+                                          struct ArrowError* error) {
+  struct ArrowIpcWriterPrivate* private_data =
+      (struct ArrowIpcWriterPrivate*)writer->private_data;
+
+  if (!private_data->is_file) {
+    ArrowErrorSet(error, "Can't finalize a file before ArrowIpcWriterStartFile()");
+    return EINVAL;
+  }
+
+  if (!private_data->wrote_schema) {
+    ArrowErrorSet(error, "Can't finalize a file before writing its schema");
+    return EINVAL;
+  }
+
+  if (!private_data->wrote_end_of_stream) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcWriterWriteEndOfStream(private_data, error));
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderEncodeFooter(&private_data->encoder,
+                                                      &private_data->footer, error));
+
+  private_data->header.size_bytes = 0;
+  int result =
+      ArrowIpcEncoderFinalizeBuffer(&private_data->encoder, &private_data->header);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "ArrowIpcEncoderFinalizeBuffer() failed");
+    return result;
+  }
+
+  struct ArrowBufferView footer;
+  footer.data.as_uint8 = private_data->header.data;
+  footer.size_bytes = private_data->header.size_bytes;
+  return ArrowIpcWriterWrite(private_data, &footer, 1, error);
+}
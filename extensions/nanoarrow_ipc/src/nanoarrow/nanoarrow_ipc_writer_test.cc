@@ -0,0 +1,1545 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <errno.h>
+#include <stdio.h>
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include "nanoarrow_ipc.h"
+
+static std::string SchemaToString(struct ArrowSchema* schema) {
+  char buf[1024];
+  ArrowSchemaToString(schema, buf, sizeof(buf), 1);
+  return buf;
+}
+
+static struct ArrowBufferView ViewOf(struct ArrowBuffer* buffer) {
+  struct ArrowBufferView view;
+  view.data.as_uint8 = buffer->data;
+  view.size_bytes = buffer->size_bytes;
+  return view;
+}
+
+// Builds a struct<some_int: int32, some_string: string, some_list: list<int64>>
+// with a null in each column
+static void MakeSimpleBatch(struct ArrowSchema* schema, struct ArrowArray* array) {
+  ASSERT_EQ(ArrowSchemaInitFromType(schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(schema, 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0], "some_int"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[1], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[1], "some_string"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[2], NANOARROW_TYPE_LIST),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[2], "some_list"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[2]->children[0], NANOARROW_TYPE_INT64),
+            NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(array, schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array), NANOARROW_OK);
+  for (int64_t i = 0; i < 5; i++) {
+    if (i == 1) {
+      ASSERT_EQ(ArrowArrayAppendNull(array->children[0], 1), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayAppendNull(array->children[1], 1), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayAppendNull(array->children[2], 1), NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowArrayAppendInt(array->children[0], i), NANOARROW_OK);
+      std::string value(i, 'a');
+      ASSERT_EQ(ArrowArrayAppendString(array->children[1], ArrowCharView(value.c_str())),
+                NANOARROW_OK);
+      for (int64_t j = 0; j < i; j++) {
+        ASSERT_EQ(ArrowArrayAppendInt(array->children[2]->children[0], j), NANOARROW_OK);
+      }
+      ASSERT_EQ(ArrowArrayFinishElement(array->children[2]), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishElement(array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array, nullptr), NANOARROW_OK);
+}
+
+static void ExpectSimpleBatch(struct ArrowArray* array) {
+  ASSERT_EQ(array->length, 5);
+  ASSERT_EQ(array->n_children, 3);
+  EXPECT_EQ(array->children[0]->null_count, 1);
+  EXPECT_EQ(array->children[1]->null_count, 1);
+  EXPECT_EQ(array->children[2]->null_count, 1);
+
+  const int32_t* ints = reinterpret_cast<const int32_t*>(array->children[0]->buffers[1]);
+  EXPECT_EQ(ints[0], 0);
+  EXPECT_EQ(ints[4], 4);
+
+  const int32_t* offsets =
+      reinterpret_cast<const int32_t*>(array->children[1]->buffers[1]);
+  const char* data = reinterpret_cast<const char*>(array->children[1]->buffers[2]);
+  EXPECT_EQ(std::string(data + offsets[4], offsets[5] - offsets[4]), "aaaa");
+
+  const int64_t* list_values =
+      reinterpret_cast<const int64_t*>(array->children[2]->children[0]->buffers[1]);
+  EXPECT_EQ(array->children[2]->children[0]->length, 9);
+  EXPECT_EQ(list_values[8], 3);
+}
+
+// Builds a struct<col: dictionary<values=string, indices=int32>> whose dictionary
+// contains dictionary_values
+static void MakeDictionaryBatch(struct ArrowSchema* schema, struct ArrowArray* array,
+                                const std::vector<std::string>& dictionary_values,
+                                const std::vector<int32_t>& indices) {
+  ASSERT_EQ(ArrowSchemaInitFromType(schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0], "col"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(schema->children[0]), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[0]->dictionary,
+                                    NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(array, schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array), NANOARROW_OK);
+  for (int32_t index : indices) {
+    ASSERT_EQ(ArrowArrayAppendInt(array->children[0], index), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(array), NANOARROW_OK);
+  }
+  for (const std::string& value : dictionary_values) {
+    ASSERT_EQ(ArrowArrayAppendString(array->children[0]->dictionary,
+                                     ArrowCharView(value.c_str())),
+              NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array, nullptr), NANOARROW_OK);
+}
+
+static std::string DictionaryValue(struct ArrowArray* dictionary, int64_t i) {
+  const int32_t* offsets = reinterpret_cast<const int32_t*>(dictionary->buffers[1]);
+  const char* data = reinterpret_cast<const char*>(dictionary->buffers[2]);
+  return std::string(data + offsets[i], offsets[i + 1] - offsets[i]);
+}
+
+TEST(NanoarrowIpcWriter, EncoderSchemaRoundTrip) {
+  struct ArrowSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 12), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0], NANOARROW_TYPE_UINT16),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[1], NANOARROW_TYPE_HALF_FLOAT),
+            NANOARROW_OK);
+  ArrowSchemaInit(schema.children[2]);
+  ASSERT_EQ(
+      ArrowSchemaSetTypeDecimal(schema.children[2], NANOARROW_TYPE_DECIMAL256, 40, 3),
+      NANOARROW_OK);
+  ArrowSchemaInit(schema.children[3]);
+  ASSERT_EQ(ArrowSchemaSetTypeFixedSize(schema.children[3],
+                                        NANOARROW_TYPE_FIXED_SIZE_BINARY, 12),
+            NANOARROW_OK);
+  ArrowSchemaInit(schema.children[4]);
+  ASSERT_EQ(ArrowSchemaSetTypeDateTime(schema.children[4], NANOARROW_TYPE_TIMESTAMP,
+                                       NANOARROW_TIME_UNIT_MICRO, "America/Halifax"),
+            NANOARROW_OK);
+  ArrowSchemaInit(schema.children[5]);
+  ASSERT_EQ(ArrowSchemaSetTypeDateTime(schema.children[5], NANOARROW_TYPE_TIME32,
+                                       NANOARROW_TIME_UNIT_MILLI, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[6], NANOARROW_TYPE_DATE64),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[7],
+                                    NANOARROW_TYPE_INTERVAL_MONTH_DAY_NANO),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[8], NANOARROW_TYPE_LARGE_BINARY),
+            NANOARROW_OK);
+  ArrowSchemaInit(schema.children[9]);
+  ASSERT_EQ(ArrowSchemaSetTypeFixedSize(schema.children[9],
+                                        NANOARROW_TYPE_FIXED_SIZE_LIST, 3),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[9]->children[0], NANOARROW_TYPE_BOOL),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[10], NANOARROW_TYPE_MAP),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[10]->children[0]->children[0],
+                               NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[10]->children[0]->children[1],
+                               NANOARROW_TYPE_NA),
+            NANOARROW_OK);
+  schema.children[10]->flags |= ARROW_FLAG_MAP_KEYS_SORTED;
+  ArrowSchemaInit(schema.children[11]);
+  ASSERT_EQ(ArrowSchemaSetFormat(schema.children[11], "+ud:4,7"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(schema.children[11], 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[11]->children[0],
+                                    NANOARROW_TYPE_FLOAT),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[11]->children[1],
+                                    NANOARROW_TYPE_LARGE_STRING),
+            NANOARROW_OK);
+
+  for (int64_t i = 0; i < schema.n_children; i++) {
+    std::string name = "col" + std::to_string(i);
+    ASSERT_EQ(ArrowSchemaSetName(schema.children[i], name.c_str()), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[11]->children[0], "f"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[11]->children[1], "s"), NANOARROW_OK);
+  schema.children[0]->flags &= ~ARROW_FLAG_NULLABLE;
+
+  struct ArrowBuffer metadata;
+  ASSERT_EQ(ArrowMetadataBuilderInit(&metadata, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowMetadataBuilderAppend(&metadata, ArrowCharView("some_key"),
+                                       ArrowCharView("some_value")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetMetadata(&schema, (const char*)metadata.data), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetMetadata(schema.children[3], (const char*)metadata.data),
+            NANOARROW_OK);
+  ArrowBufferReset(&metadata);
+
+  struct ArrowIpcEncoder encoder;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcEncoderInit(&encoder), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcEncoderEncodeSchema(&encoder, &schema, &error), NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(encoder.n_body_buffers, 0);
+  EXPECT_EQ(encoder.body_size_bytes, 0);
+
+  struct ArrowBuffer buffer;
+  ArrowBufferInit(&buffer);
+  ASSERT_EQ(ArrowIpcEncoderFinalizeBuffer(&encoder, &buffer), NANOARROW_OK);
+  EXPECT_EQ(buffer.size_bytes % 8, 0);
+  ArrowIpcEncoderReset(&encoder);
+
+  struct ArrowIpcDecoder decoder;
+  ASSERT_EQ(ArrowIpcDecoderInit(&decoder), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderVerifyHeader(&decoder, ViewOf(&buffer), &error), NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(ArrowIpcDecoderDecodeHeader(&decoder, ViewOf(&buffer), &error), NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(decoder.message_type, NANOARROW_IPC_MESSAGE_TYPE_SCHEMA);
+  EXPECT_EQ(decoder.header_size_bytes, buffer.size_bytes);
+
+  struct ArrowSchema roundtripped;
+  ASSERT_EQ(ArrowIpcDecoderDecodeSchema(&decoder, &roundtripped, &error), NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(SchemaToString(&roundtripped), SchemaToString(&schema));
+  EXPECT_EQ(std::string(roundtripped.children[11]->format), "+ud:4,7");
+  EXPECT_EQ(roundtripped.children[0]->flags & ARROW_FLAG_NULLABLE, 0);
+  EXPECT_NE(roundtripped.children[1]->flags & ARROW_FLAG_NULLABLE, 0);
+  EXPECT_NE(roundtripped.children[10]->flags & ARROW_FLAG_MAP_KEYS_SORTED, 0);
+
+  struct ArrowStringView value;
+  ASSERT_EQ(ArrowMetadataGetValue(roundtripped.metadata, ArrowCharView("some_key"),
+                                  &value),
+            NANOARROW_OK);
+  EXPECT_EQ(std::string(value.data, value.size_bytes), "some_value");
+  ASSERT_EQ(ArrowMetadataGetValue(roundtripped.children[3]->metadata,
+                                  ArrowCharView("some_key"), &value),
+            NANOARROW_OK);
+  EXPECT_EQ(std::string(value.data, value.size_bytes), "some_value");
+
+  roundtripped.release(&roundtripped);
+  schema.release(&schema);
+  ArrowIpcDecoderReset(&decoder);
+  ArrowBufferReset(&buffer);
+}
+
+TEST(NanoarrowIpcWriter, EncoderRecordBatchReferencesBuffers) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  ASSERT_NO_FATAL_FAILURE(MakeSimpleBatch(&schema, &array));
+
+  struct ArrowArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+
+  struct ArrowIpcEncoder encoder;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcEncoderInit(&encoder), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcEncoderEncodeRecordBatch(&encoder, &array_view, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  // Body buffers are views of the original buffers (or padding) and not copies
+  int64_t body_size_bytes = 0;
+  bool found_string_data = false;
+  for (int64_t i = 0; i < encoder.n_body_buffers; i++) {
+    body_size_bytes += encoder.body_buffers[i].size_bytes;
+    if (encoder.body_buffers[i].data.data == array.children[1]->buffers[2]) {
+      found_string_data = true;
+    }
+  }
+  EXPECT_TRUE(found_string_data);
+  EXPECT_EQ(body_size_bytes, encoder.body_size_bytes);
+  EXPECT_EQ(encoder.body_size_bytes % 8, 0);
+
+  ArrowIpcEncoderReset(&encoder);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
+}
+
+TEST(NanoarrowIpcWriter, EncoderErrors) {
+  struct ArrowIpcEncoder encoder;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcEncoderInit(&encoder), NANOARROW_OK);
+
+  // Nothing has been encoded yet
+  struct ArrowBuffer buffer;
+  ArrowBufferInit(&buffer);
+  EXPECT_EQ(ArrowIpcEncoderFinalizeBuffer(&encoder, &buffer), EINVAL);
+  ArrowBufferReset(&buffer);
+
+  struct ArrowSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcEncoderEncodeSchema(&encoder, &schema, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected schema of type struct but found int32");
+  schema.release(&schema);
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(schema.children[0]), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0]->dictionary,
+                                    NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(schema.children[0]->dictionary),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0]->dictionary->dictionary,
+                                    NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcEncoderEncodeSchema(&encoder, &schema, &error), ENOTSUP);
+  EXPECT_STREQ(error.message,
+               "Encoding dictionary-encoded dictionary values is not supported");
+  schema.release(&schema);
+
+  struct ArrowArray array;
+  ASSERT_NO_FATAL_FAILURE(MakeSimpleBatch(&schema, &array));
+  struct ArrowArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
+  array.offset = 1;
+  array.length = 4;
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcEncoderEncodeRecordBatch(&encoder, &array_view, &error), ENOTSUP);
+  EXPECT_STREQ(error.message,
+               "Encoding an array with a non-zero offset is not supported");
+
+  // Negative buffer sizes are rejected rather than written as empty buffers
+  array.offset = 0;
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  array_view.children[0]->buffer_views[1].size_bytes = -1;
+  EXPECT_EQ(ArrowIpcEncoderEncodeRecordBatch(&encoder, &array_view, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected non-negative size for buffer 1 but found -1");
+
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
+  ArrowIpcEncoderReset(&encoder);
+}
+
+TEST(NanoarrowIpcWriter, WriterArrayStreamRoundTrip) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  ASSERT_NO_FATAL_FAILURE(MakeSimpleBatch(&schema, &array));
+
+  struct ArrowArrayStream stream;
+  ASSERT_EQ(ArrowBasicArrayStreamInit(&stream, &schema, 2), NANOARROW_OK);
+  ArrowBasicArrayStreamSetArray(&stream, 0, &array);
+  ASSERT_NO_FATAL_FAILURE(MakeSimpleBatch(&schema, &array));
+  schema.release(&schema);
+  ArrowBasicArrayStreamSetArray(&stream, 1, &array);
+
+  struct ArrowBuffer output;
+  ArrowBufferInit(&output);
+  struct ArrowIpcOutputStream output_stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, &output), NANOARROW_OK);
+
+  struct ArrowIpcWriter writer;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+  EXPECT_EQ(output_stream.release, nullptr);
+  ASSERT_EQ(ArrowIpcWriterWriteArrayStream(&writer, &stream, &error), NANOARROW_OK)
+      << error.message;
+  ArrowIpcWriterReset(&writer);
+  stream.release(&stream);
+
+  // The stream ends with the end-of-stream indicator
+  ASSERT_GE(output.size_bytes, 8);
+  EXPECT_EQ(output.size_bytes % 8, 0);
+  const uint8_t kEndOfStream[] = {0xFF, 0xFF, 0xFF, 0xFF, 0, 0, 0, 0};
+  EXPECT_EQ(memcmp(output.data + output.size_bytes - 8, kEndOfStream, 8), 0);
+
+  struct ArrowIpcInputStream input_stream;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input_stream, &output), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input_stream, nullptr),
+            NANOARROW_OK);
+
+  ASSERT_EQ(stream.get_schema(&stream, &schema), NANOARROW_OK);
+  EXPECT_EQ(SchemaToString(&schema),
+            "struct<some_int: int32, some_string: string, some_list: list<item: "
+            "int64>>");
+  schema.release(&schema);
+
+  for (int i = 0; i < 2; i++) {
+    ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK)
+        << stream.get_last_error(&stream);
+    ASSERT_NE(array.release, nullptr);
+    ASSERT_NO_FATAL_FAILURE(ExpectSimpleBatch(&array));
+    array.release(&array);
+  }
+
+  ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.release, nullptr);
+  stream.release(&stream);
+}
+
+TEST(NanoarrowIpcWriter, WriterEmptyStruct) {
+  struct ArrowSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 0), NANOARROW_OK);
+
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  array.length = 3;
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  struct ArrowArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+
+  struct ArrowBuffer output;
+  ArrowBufferInit(&output);
+  struct ArrowIpcOutputStream output_stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, &output), NANOARROW_OK);
+  struct ArrowIpcWriter writer;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(&writer, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteArrayView(&writer, &array_view, &error), NANOARROW_OK);
+  ArrowIpcWriterReset(&writer);
+
+  struct ArrowIpcInputStream input_stream;
+  struct ArrowArrayStream stream;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input_stream, &output), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input_stream, nullptr),
+            NANOARROW_OK);
+
+  struct ArrowArray roundtripped;
+  ASSERT_EQ(stream.get_next(&stream, &roundtripped), NANOARROW_OK);
+  EXPECT_EQ(roundtripped.length, 3);
+  EXPECT_EQ(roundtripped.n_children, 0);
+  roundtripped.release(&roundtripped);
+
+  // Without an end-of-stream indicator the end of the input is the end of the stream
+  ASSERT_EQ(stream.get_next(&stream, &roundtripped), NANOARROW_OK);
+  EXPECT_EQ(roundtripped.release, nullptr);
+
+  stream.release(&stream);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
+}
+
+TEST(NanoarrowIpcWriter, WriterProjectedRoundTrip) {
+  // struct<some_struct: struct<x: int32, y: string>, some_int: int32>, where all
+  // elements of some_struct are null except the last
+  struct ArrowSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0], NANOARROW_TYPE_STRUCT),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0], "some_struct"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(schema.children[0], 2), NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowSchemaInitFromType(schema.children[0]->children[0], NANOARROW_TYPE_INT32),
+      NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0]->children[0], "x"), NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowSchemaInitFromType(schema.children[0]->children[1], NANOARROW_TYPE_STRING),
+      NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0]->children[1], "y"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[1], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[1], "some_int"), NANOARROW_OK);
+
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int64_t i = 0; i < 3; i++) {
+    struct ArrowArray* some_struct = array.children[0];
+    if (i < 2) {
+      ASSERT_EQ(ArrowArrayAppendNull(some_struct, 1), NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowArrayAppendInt(some_struct->children[0], 10), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayAppendString(some_struct->children[1], ArrowCharView("yyy")),
+                NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayFinishElement(some_struct), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[1], i), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+
+  struct ArrowBuffer output;
+  ArrowBufferInit(&output);
+  struct ArrowIpcOutputStream output_stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, &output), NANOARROW_OK);
+  struct ArrowIpcWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(&writer, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteArrayView(&writer, &array_view, &error), NANOARROW_OK);
+  ArrowIpcWriterReset(&writer);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
+
+  // Make the string data of y invalid UTF-8, which is only detected if y is decoded
+  int64_t y_offset = -1;
+  for (int64_t i = 0; i + 3 <= output.size_bytes; i++) {
+    if (memcmp(output.data + i, "yyy", 3) == 0) {
+      y_offset = i;
+    }
+  }
+  ASSERT_GE(y_offset, 0);
+  output.data[y_offset] = 0xFF;
+
+  struct ArrowStringView paths[] = {ArrowCharView("some_int"),
+                                    ArrowCharView("some_struct.x")};
+  for (int use_shared_buffers = 0; use_shared_buffers < 2; use_shared_buffers++) {
+    struct ArrowBuffer copy;
+    ArrowBufferInit(&copy);
+    ASSERT_EQ(ArrowBufferAppend(&copy, output.data, output.size_bytes), NANOARROW_OK);
+
+    struct ArrowIpcArrayStreamReaderOptions options;
+    ArrowIpcArrayStreamReaderOptionsInit(&options);
+    options.use_shared_buffers = use_shared_buffers;
+    options.field_paths = paths;
+    options.n_field_paths = 2;
+
+    struct ArrowIpcInputStream input_stream;
+    struct ArrowArrayStream stream;
+    ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input_stream, &copy), NANOARROW_OK);
+    ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input_stream, &options),
+              NANOARROW_OK);
+
+    ASSERT_EQ(stream.get_schema(&stream, &schema), NANOARROW_OK);
+    EXPECT_EQ(SchemaToString(&schema),
+              "struct<some_int: int32, some_struct: struct<x: int32>>");
+    schema.release(&schema);
+
+    ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK)
+        << stream.get_last_error(&stream);
+    ASSERT_EQ(array.length, 3);
+    ASSERT_EQ(array.n_children, 2);
+    const int32_t* ints = reinterpret_cast<const int32_t*>(array.children[0]->buffers[1]);
+    EXPECT_EQ(ints[2], 2);
+    ASSERT_EQ(array.children[1]->n_children, 1);
+    EXPECT_EQ(array.children[1]->null_count, 2);
+    ints = reinterpret_cast<const int32_t*>(array.children[1]->children[0]->buffers[1]);
+    EXPECT_EQ(ints[2], 10);
+    array.release(&array);
+
+    ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+    EXPECT_EQ(array.release, nullptr);
+    stream.release(&stream);
+  }
+
+  // Without a projection y is decoded and fails validation
+  struct ArrowIpcInputStream input_stream;
+  struct ArrowArrayStream stream;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input_stream, &output), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input_stream, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(stream.get_next(&stream, &array), EINVAL);
+  stream.release(&stream);
+}
+
+TEST(NanoarrowIpcWriter, WriterDictionaryRoundTrip) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowArray replacement;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+  ASSERT_NO_FATAL_FAILURE(MakeDictionaryBatch(&schema, &array, {"a", "b"}, {1, 0, 1}));
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+
+  struct ArrowBuffer output;
+  ArrowBufferInit(&output);
+  struct ArrowIpcOutputStream output_stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, &output), NANOARROW_OK);
+  struct ArrowIpcWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(&writer, &schema, &error), NANOARROW_OK)
+      << error.message;
+
+  // The unchanged dictionary is only written before the first batch
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteArrayView(&writer, &array_view, &error), NANOARROW_OK)
+      << error.message;
+  int64_t size_after_first = output.size_bytes;
+  ASSERT_EQ(ArrowIpcWriterWriteArrayView(&writer, &array_view, &error), NANOARROW_OK)
+      << error.message;
+  int64_t size_of_batch = output.size_bytes - size_after_first;
+
+  // A different dictionary is written as a replacement
+  schema.release(&schema);
+  ASSERT_NO_FATAL_FAILURE(MakeDictionaryBatch(&schema, &replacement, {"c"}, {0}));
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &replacement, &error), NANOARROW_OK);
+  int64_t size_before_replacement = output.size_bytes;
+  ASSERT_EQ(ArrowIpcWriterWriteArrayView(&writer, &array_view, &error), NANOARROW_OK)
+      << error.message;
+  EXPECT_GT(output.size_bytes - size_before_replacement, size_of_batch);
+  ArrowIpcWriterReset(&writer);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  replacement.release(&replacement);
+  schema.release(&schema);
+
+  struct ArrowIpcInputStream input_stream;
+  struct ArrowArrayStream stream;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input_stream, &output), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input_stream, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(stream.get_schema(&stream, &schema), NANOARROW_OK);
+  EXPECT_EQ(SchemaToString(&schema), "struct<col: dictionary(int32)<string>>");
+  schema.release(&schema);
+
+  struct ArrowArray arrays[3];
+  for (int i = 0; i < 3; i++) {
+    ASSERT_EQ(stream.get_next(&stream, &arrays[i]), NANOARROW_OK)
+        << stream.get_last_error(&stream);
+    ASSERT_NE(arrays[i].release, nullptr);
+    ASSERT_NE(arrays[i].children[0]->dictionary, nullptr);
+  }
+  stream.release(&stream);
+
+  // Batches that share a dictionary share its buffers and outlive the reader
+  struct ArrowArray* dictionary = arrays[0].children[0]->dictionary;
+  ASSERT_EQ(dictionary->length, 2);
+  EXPECT_EQ(DictionaryValue(dictionary, 0), "a");
+  EXPECT_EQ(DictionaryValue(dictionary, 1), "b");
+  EXPECT_EQ(arrays[1].children[0]->dictionary->buffers[2], dictionary->buffers[2]);
+  const int32_t* indices =
+      reinterpret_cast<const int32_t*>(arrays[1].children[0]->buffers[1]);
+  EXPECT_EQ(indices[0], 1);
+
+  dictionary = arrays[2].children[0]->dictionary;
+  ASSERT_EQ(dictionary->length, 1);
+  EXPECT_EQ(DictionaryValue(dictionary, 0), "c");
+
+  for (int i = 0; i < 3; i++) {
+    arrays[i].release(&arrays[i]);
+  }
+}
+
+TEST(NanoarrowIpcWriter, WriterDictionaryComparesContents) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowArray copy;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+  ASSERT_NO_FATAL_FAILURE(MakeDictionaryBatch(&schema, &array, {"a", "b"}, {1, 0}));
+  struct ArrowSchema copy_schema;
+  ASSERT_NO_FATAL_FAILURE(MakeDictionaryBatch(&copy_schema, &copy, {"a", "b"}, {1, 0}));
+  copy_schema.release(&copy_schema);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+
+  struct ArrowBuffer output;
+  ArrowBufferInit(&output);
+  struct ArrowIpcOutputStream output_stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, &output), NANOARROW_OK);
+  struct ArrowIpcWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(&writer, &schema, &error), NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteArrayView(&writer, &array_view, &error), NANOARROW_OK)
+      << error.message;
+
+  // The same values in different buffers are not written again
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &copy, &error), NANOARROW_OK);
+  int64_t size_before_copy = output.size_bytes;
+  ASSERT_EQ(ArrowIpcWriterWriteArrayView(&writer, &array_view, &error), NANOARROW_OK)
+      << error.message;
+  int64_t size_of_batch = output.size_bytes - size_before_copy;
+
+  // Values of the same size written to the same buffers (e.g., memory that was freed
+  // and reallocated) are written as a replacement
+  char* data = reinterpret_cast<char*>(
+      const_cast<void*>(array.children[0]->dictionary->buffers[2]));
+  data[0] = 'c';
+  data[1] = 'd';
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  int64_t size_before_replacement = output.size_bytes;
+  ASSERT_EQ(ArrowIpcWriterWriteArrayView(&writer, &array_view, &error), NANOARROW_OK)
+      << error.message;
+  EXPECT_GT(output.size_bytes - size_before_replacement, size_of_batch);
+  ArrowIpcWriterReset(&writer);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  copy.release(&copy);
+  schema.release(&schema);
+
+  struct ArrowIpcInputStream input_stream;
+  struct ArrowArrayStream stream;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input_stream, &output), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input_stream, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(stream.get_schema(&stream, &schema), NANOARROW_OK);
+  schema.release(&schema);
+
+  const char* expected[][2] = {{"a", "b"}, {"a", "b"}, {"c", "d"}};
+  for (int i = 0; i < 3; i++) {
+    struct ArrowArray batch;
+    ASSERT_EQ(stream.get_next(&stream, &batch), NANOARROW_OK)
+        << stream.get_last_error(&stream);
+    struct ArrowArray* dictionary = batch.children[0]->dictionary;
+    ASSERT_EQ(dictionary->length, 2);
+    EXPECT_EQ(DictionaryValue(dictionary, 0), expected[i][0]);
+    EXPECT_EQ(DictionaryValue(dictionary, 1), expected[i][1]);
+    batch.release(&batch);
+  }
+  stream.release(&stream);
+}
+
+TEST(NanoarrowIpcWriter, WriterDictionaryEncodeRoundTrip) {
+  struct ArrowSchema schema;
+  struct ArrowError error;
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0], "s"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[1], "n"), NANOARROW_OK);
+
+  struct ArrowBuffer output;
+  ArrowBufferInit(&output);
+  struct ArrowIpcOutputStream output_stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, &output), NANOARROW_OK);
+  struct ArrowIpcWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+
+  // Only string and binary columns in range can be encoded
+  int64_t column_indices[] = {1};
+  ASSERT_EQ(ArrowIpcWriterSetDictionaryEncode(&writer, column_indices, -1), EINVAL);
+  ASSERT_EQ(ArrowIpcWriterSetDictionaryEncode(&writer, column_indices, 1), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcWriterWriteSchema(&writer, &schema, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Can't dictionary-encode column 1 of type int32");
+  column_indices[0] = 2;
+  ASSERT_EQ(ArrowIpcWriterSetDictionaryEncode(&writer, column_indices, 1), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcWriterWriteSchema(&writer, &schema, &error), EINVAL);
+  EXPECT_EQ(output.size_bytes, 0);
+
+  column_indices[0] = 0;
+  ASSERT_EQ(ArrowIpcWriterSetDictionaryEncode(&writer, column_indices, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(&writer, &schema, &error), NANOARROW_OK)
+      << error.message;
+
+  // The second batch has one new value and the third has none
+  std::vector<std::vector<const char*>> batches = {
+      {"a", "b", nullptr, "a"}, {"b", "c", "c"}, {"a", nullptr}};
+  struct ArrowArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  for (const auto& values : batches) {
+    struct ArrowArray array;
+    ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    for (const char* value : values) {
+      if (value == nullptr) {
+        ASSERT_EQ(ArrowArrayAppendNull(array.children[0], 1), NANOARROW_OK);
+      } else {
+        ASSERT_EQ(ArrowArrayAppendString(array.children[0], ArrowCharView(value)),
+                  NANOARROW_OK);
+      }
+      ASSERT_EQ(ArrowArrayAppendInt(array.children[1], 7), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+    ASSERT_EQ(ArrowIpcWriterWriteArrayView(&writer, &array_view, &error), NANOARROW_OK)
+        << error.message;
+    array.release(&array);
+  }
+  ASSERT_EQ(ArrowIpcWriterWriteArrayView(&writer, nullptr, &error), NANOARROW_OK);
+  ArrowIpcWriterReset(&writer);
+  ArrowArrayViewReset(&array_view);
+  schema.release(&schema);
+
+  struct ArrowIpcMessageIndex index;
+  ArrowIpcMessageIndexInit(&index);
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.message_index = &index;
+  struct ArrowIpcInputStream input_stream;
+  struct ArrowArrayStream stream;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input_stream, &output), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input_stream, &options),
+            NANOARROW_OK);
+  ASSERT_EQ(stream.get_schema(&stream, &schema), NANOARROW_OK);
+  EXPECT_EQ(SchemaToString(&schema), "struct<s: dictionary(int32)<string>, n: int32>");
+  schema.release(&schema);
+
+  std::vector<std::vector<int32_t>> expected_indices = {{0, 1, 0, 0}, {1, 2, 2}, {0, 0}};
+  std::vector<int64_t> expected_dictionary_lengths = {2, 3, 3};
+  for (size_t i = 0; i < batches.size(); i++) {
+    struct ArrowArray array;
+    ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK)
+        << stream.get_last_error(&stream);
+    ASSERT_NE(array.release, nullptr);
+    struct ArrowArray* column = array.children[0];
+    ASSERT_NE(column->dictionary, nullptr);
+    ASSERT_EQ(column->dictionary->length, expected_dictionary_lengths[i]);
+    EXPECT_EQ(DictionaryValue(column->dictionary, 0), "a");
+    EXPECT_EQ(DictionaryValue(column->dictionary, 1), "b");
+    if (column->dictionary->length > 2) {
+      EXPECT_EQ(DictionaryValue(column->dictionary, 2), "c");
+    }
+
+    const int32_t* indices = reinterpret_cast<const int32_t*>(column->buffers[1]);
+    EXPECT_EQ(std::vector<int32_t>(indices, indices + column->length),
+              expected_indices[i]);
+    EXPECT_EQ(column->null_count, i == 1 ? 0 : 1);
+    array.release(&array);
+  }
+  stream.release(&stream);
+
+  // Schema, dictionary, batch, delta dictionary, batch, batch
+  ASSERT_EQ(index.n_entries, 6);
+  const struct ArrowIpcMessageIndexEntry* entries =
+      reinterpret_cast<const struct ArrowIpcMessageIndexEntry*>(index.entries.data);
+  EXPECT_EQ(entries[1].message_type, NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH);
+  EXPECT_FALSE(entries[1].dictionary_is_delta);
+  EXPECT_EQ(entries[2].message_type, NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH);
+  EXPECT_EQ(entries[3].message_type, NANOARROW_IPC_MESSAGE_TYPE_DICTIONARY_BATCH);
+  EXPECT_TRUE(entries[3].dictionary_is_delta);
+  EXPECT_EQ(entries[4].message_type, NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH);
+  EXPECT_EQ(entries[5].message_type, NANOARROW_IPC_MESSAGE_TYPE_RECORD_BATCH);
+  ArrowIpcMessageIndexReset(&index);
+}
+
+// Runs each task on its own thread
+static void ThreadPerTaskParallelFor(struct ArrowExecutor* executor,
+                                     void (*task)(void* task_private, int64_t i),
+                                     void* task_private, int64_t n_tasks) {
+  auto n_calls = reinterpret_cast<int64_t*>(executor->private_data);
+  *n_calls += 1;
+
+  std::vector<std::thread> threads;
+  for (int64_t i = 0; i < n_tasks; i++) {
+    threads.emplace_back([task, task_private, i] { task(task_private, i); });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+// Builds a struct<zeros: int64, noise: int64> whose first column compresses well and
+// whose second column (a pseudo-random sequence) does not compress at all
+static void MakeCompressionBatch(struct ArrowSchema* schema, struct ArrowArray* array,
+                                 int64_t length) {
+  ASSERT_EQ(ArrowSchemaInitFromType(schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(schema, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[0], NANOARROW_TYPE_INT64),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0], "zeros"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[1], NANOARROW_TYPE_INT64),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[1], "noise"), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(array, schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array), NANOARROW_OK);
+  uint64_t state = 0x9E3779B97F4A7C15ULL;
+  for (int64_t i = 0; i < length; i++) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    ASSERT_EQ(ArrowArrayAppendInt(array->children[0], 0), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendInt(array->children[1], (int64_t)(state >> 1)),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array, nullptr), NANOARROW_OK);
+}
+
+TEST(NanoarrowIpcWriter, WriterCompressedRoundTrip) {
+  const int64_t length = 1024;
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+  ASSERT_NO_FATAL_FAILURE(MakeCompressionBatch(&schema, &array, length));
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  const void* noise = array.children[1]->buffers[1];
+
+  struct ArrowIpcEncoder encoder;
+  ASSERT_EQ(ArrowIpcEncoderInit(&encoder), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcEncoderSetCompression(
+                &encoder, static_cast<enum ArrowIpcCompressionType>(100)),
+            ENOTSUP);
+  ArrowIpcEncoderReset(&encoder);
+
+  for (auto codec :
+       {NANOARROW_IPC_COMPRESSION_TYPE_ZSTD, NANOARROW_IPC_COMPRESSION_TYPE_LZ4_FRAME}) {
+    SCOPED_TRACE("codec: " + std::to_string(codec));
+    if (!ArrowIpcCompressionIsSupported(codec)) {
+      ASSERT_EQ(ArrowIpcEncoderInit(&encoder), NANOARROW_OK);
+      EXPECT_EQ(ArrowIpcEncoderSetCompression(&encoder, codec), ENOTSUP);
+      ArrowIpcEncoderReset(&encoder);
+      continue;
+    }
+
+    // The compressible column is compressed and the incompressible column refers to
+    // the array's own buffer after an uncompressed length of -1
+    ASSERT_EQ(ArrowIpcEncoderInit(&encoder), NANOARROW_OK);
+    ASSERT_EQ(ArrowIpcEncoderSetCompression(&encoder, codec), NANOARROW_OK);
+    ASSERT_EQ(ArrowIpcEncoderEncodeRecordBatch(&encoder, &array_view, &error),
+              NANOARROW_OK)
+        << error.message;
+    EXPECT_LT(encoder.body_size_bytes, 2 * length * 8);
+    int64_t noise_index = -1;
+    for (int64_t i = 0; i < encoder.n_body_buffers; i++) {
+      if (encoder.body_buffers[i].data.data == noise) {
+        noise_index = i;
+      }
+    }
+    ASSERT_GT(noise_index, 0);
+    EXPECT_EQ(encoder.body_buffers[noise_index].size_bytes, length * 8);
+    const struct ArrowBufferView& prefix = encoder.body_buffers[noise_index - 1];
+    ASSERT_EQ(prefix.size_bytes, 8);
+    const uint8_t kUncompressed[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+    EXPECT_EQ(memcmp(prefix.data.data, kUncompressed, 8), 0);
+    ArrowIpcEncoderReset(&encoder);
+
+    // Buffers are compressed in parallel by the executor and decompress to the
+    // original values
+    int64_t n_calls = 0;
+    struct ArrowExecutor executor;
+    executor.parallel_for = &ThreadPerTaskParallelFor;
+    executor.private_data = &n_calls;
+
+    struct ArrowBuffer output;
+    ArrowBufferInit(&output);
+    struct ArrowIpcOutputStream output_stream;
+    ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, &output), NANOARROW_OK);
+    struct ArrowIpcWriter writer;
+    ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+    ASSERT_EQ(ArrowIpcWriterSetCompression(&writer, codec), NANOARROW_OK);
+    ArrowIpcWriterSetExecutor(&writer, &executor);
+    ASSERT_EQ(ArrowIpcWriterWriteSchema(&writer, &schema, &error), NANOARROW_OK)
+        << error.message;
+    ASSERT_EQ(ArrowIpcWriterWriteArrayView(&writer, &array_view, &error), NANOARROW_OK)
+        << error.message;
+    ArrowIpcWriterReset(&writer);
+    EXPECT_EQ(n_calls, 1);
+
+    struct ArrowIpcInputStream input_stream;
+    ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input_stream, &output), NANOARROW_OK);
+    struct ArrowArrayStream stream;
+    ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input_stream, nullptr),
+              NANOARROW_OK);
+    struct ArrowArray actual;
+    ASSERT_EQ(stream.get_next(&stream, &actual), NANOARROW_OK)
+        << stream.get_last_error(&stream);
+    ASSERT_EQ(actual.length, length);
+    EXPECT_EQ(memcmp(actual.children[0]->buffers[1], array.children[0]->buffers[1],
+                     length * 8),
+              0);
+    EXPECT_EQ(memcmp(actual.children[1]->buffers[1], noise, length * 8), 0);
+    actual.release(&actual);
+    stream.release(&stream);
+  }
+
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
+}
+
+// Writes a stream of n_batches copies of MakeSimpleBatch() (of which the batch at
+// invalid_batch, if any, is an int32 array that can't be written) using an executor
+// for each window of pipeline_n_batches batches (or, if 0, without an executor)
+static void WritePipelinedStream(struct ArrowBuffer* output, int64_t n_batches,
+                                 int64_t invalid_batch, int64_t pipeline_n_batches,
+                                 int is_file, enum ArrowIpcCompressionType codec,
+                                 int* result, int64_t* n_calls) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowArrayStream stream;
+  ASSERT_NO_FATAL_FAILURE(MakeSimpleBatch(&schema, &array));
+  ASSERT_EQ(ArrowBasicArrayStreamInit(&stream, &schema, n_batches), NANOARROW_OK);
+  array.release(&array);
+  for (int64_t i = 0; i < n_batches; i++) {
+    if (i == invalid_batch) {
+      ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+    } else {
+      ASSERT_NO_FATAL_FAILURE(MakeSimpleBatch(&schema, &array));
+      schema.release(&schema);
+    }
+    ArrowBasicArrayStreamSetArray(&stream, i, &array);
+  }
+
+  struct ArrowExecutor executor;
+  executor.parallel_for = &ThreadPerTaskParallelFor;
+  executor.private_data = n_calls;
+
+  struct ArrowIpcOutputStream output_stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, output), NANOARROW_OK);
+  struct ArrowIpcWriter writer;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterSetCompression(&writer, codec), NANOARROW_OK);
+  if (pipeline_n_batches > 0) {
+    ASSERT_EQ(ArrowIpcWriterSetPipeline(&writer, &executor, pipeline_n_batches),
+              NANOARROW_OK);
+  }
+  if (is_file) {
+    ASSERT_EQ(ArrowIpcWriterStartFile(&writer, &error), NANOARROW_OK);
+  }
+
+  *result = ArrowIpcWriterWriteArrayStream(&writer, &stream, &error);
+  if (*result == NANOARROW_OK && is_file) {
+    *result = ArrowIpcWriterFinalizeFile(&writer, &error);
+  }
+  ArrowIpcWriterReset(&writer);
+  stream.release(&stream);
+}
+
+TEST(NanoarrowIpcWriter, WriterPipelinedArrayStream) {
+  const int64_t n_batches = 7;
+  std::vector<enum ArrowIpcCompressionType> codecs = {
+      NANOARROW_IPC_COMPRESSION_TYPE_NONE};
+  if (ArrowIpcCompressionIsSupported(NANOARROW_IPC_COMPRESSION_TYPE_ZSTD)) {
+    codecs.push_back(NANOARROW_IPC_COMPRESSION_TYPE_ZSTD);
+  }
+
+  // The pipelined writer produces the same bytes as the serial writer
+  for (int is_file : {0, 1}) {
+    for (auto codec : codecs) {
+      int result;
+      int64_t n_calls = 0;
+      struct ArrowBuffer expected;
+      ArrowBufferInit(&expected);
+      ASSERT_NO_FATAL_FAILURE(
+          WritePipelinedStream(&expected, n_batches, -1, 0, is_file, codec, &result,
+                               &n_calls));
+      ASSERT_EQ(result, NANOARROW_OK);
+      EXPECT_EQ(n_calls, 0);
+
+      for (int64_t pipeline_n_batches : {1, 2, 3, 8}) {
+        SCOPED_TRACE("is_file: " + std::to_string(is_file) +
+                     ", codec: " + std::to_string(codec) +
+                     ", pipeline_n_batches: " + std::to_string(pipeline_n_batches));
+        struct ArrowBuffer actual;
+        ArrowBufferInit(&actual);
+        ASSERT_NO_FATAL_FAILURE(WritePipelinedStream(&actual, n_batches, -1,
+                                                     pipeline_n_batches, is_file, codec,
+                                                     &result, &n_calls));
+        ASSERT_EQ(result, NANOARROW_OK);
+        ASSERT_EQ(actual.size_bytes, expected.size_bytes);
+        EXPECT_EQ(memcmp(actual.data, expected.data, actual.size_bytes), 0);
+
+        // One call per window plus one to write the last window
+        int64_t n_windows = (n_batches + pipeline_n_batches - 1) / pipeline_n_batches;
+        EXPECT_EQ(n_calls, n_windows + 1);
+        n_calls = 0;
+        ArrowBufferReset(&actual);
+      }
+
+      ArrowBufferReset(&expected);
+    }
+  }
+
+  // A batch that can't be read is reported after the batches before it are written
+  for (int64_t pipeline_n_batches : {1, 2, 8}) {
+    SCOPED_TRACE("pipeline_n_batches: " + std::to_string(pipeline_n_batches));
+    int result;
+    int64_t n_calls = 0;
+    struct ArrowBuffer output;
+    ArrowBufferInit(&output);
+    ASSERT_NO_FATAL_FAILURE(WritePipelinedStream(&output, n_batches, 3,
+                                                 pipeline_n_batches, 0,
+                                                 NANOARROW_IPC_COMPRESSION_TYPE_NONE,
+                                                 &result, &n_calls));
+    EXPECT_EQ(result, EINVAL);
+
+    struct ArrowIpcInputStream input_stream;
+    ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input_stream, &output), NANOARROW_OK);
+    struct ArrowArrayStream stream;
+    ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input_stream, nullptr),
+              NANOARROW_OK);
+    struct ArrowArray array;
+    for (int64_t i = 0; i < 3; i++) {
+      ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK)
+          << stream.get_last_error(&stream);
+      ASSERT_NO_FATAL_FAILURE(ExpectSimpleBatch(&array));
+      array.release(&array);
+    }
+    ASSERT_EQ(stream.get_next(&stream, &array), NANOARROW_OK);
+    EXPECT_EQ(array.release, nullptr);
+    stream.release(&stream);
+    ArrowBufferReset(&output);
+  }
+
+  // The executor needs at least one batch per window
+  struct ArrowBuffer output;
+  ArrowBufferInit(&output);
+  struct ArrowIpcOutputStream output_stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, &output), NANOARROW_OK);
+  struct ArrowIpcWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+  struct ArrowExecutor executor;
+  executor.parallel_for = &ThreadPerTaskParallelFor;
+  executor.private_data = nullptr;
+  EXPECT_EQ(ArrowIpcWriterSetPipeline(&writer, &executor, 0), EINVAL);
+  EXPECT_EQ(ArrowIpcWriterSetPipeline(&writer, nullptr, 0), NANOARROW_OK);
+  ArrowIpcWriterReset(&writer);
+}
+
+TEST(NanoarrowIpcWriter, FileDictionaryRoundTrip) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowArray replacement;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+  ASSERT_NO_FATAL_FAILURE(MakeDictionaryBatch(&schema, &array, {"a", "b"}, {1, 0, 1}));
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+
+  struct ArrowBuffer output;
+  ArrowBufferInit(&output);
+  struct ArrowIpcOutputStream output_stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, &output), NANOARROW_OK);
+  struct ArrowIpcWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterStartFile(&writer, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(&writer, &schema, &error), NANOARROW_OK);
+  for (int i = 0; i < 2; i++) {
+    ASSERT_EQ(ArrowIpcWriterWriteArrayView(&writer, &array_view, &error), NANOARROW_OK)
+        << error.message;
+  }
+
+  // Files can't contain dictionary replacements
+  schema.release(&schema);
+  ASSERT_NO_FATAL_FAILURE(MakeDictionaryBatch(&schema, &replacement, {"c"}, {0}));
+  struct ArrowArrayView replacement_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&replacement_view, &schema, &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&replacement_view, &replacement, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcWriterWriteArrayView(&writer, &replacement_view, &error), EINVAL);
+  EXPECT_STREQ(error.message,
+               "Can't replace dictionary with id 0 in the Arrow IPC file format");
+  ArrowArrayViewReset(&replacement_view);
+  replacement.release(&replacement);
+
+  ASSERT_EQ(ArrowIpcWriterFinalizeFile(&writer, &error), NANOARROW_OK)
+      << error.message;
+  ArrowIpcWriterReset(&writer);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
+
+  struct ArrowIpcSharedBuffer file;
+  ASSERT_EQ(ArrowIpcSharedBufferInit(&file, &output), NANOARROW_OK);
+  struct ArrowIpcFileReader reader;
+  ASSERT_EQ(ArrowIpcFileReaderInit(&reader, &file, &error), NANOARROW_OK)
+      << error.message;
+  ArrowIpcSharedBufferReset(&file);
+  ASSERT_EQ(reader.n_record_batches, 2);
+  EXPECT_EQ(reader.footer.dictionary_blocks.size_bytes,
+            sizeof(struct ArrowIpcFileBlock));
+
+  for (int64_t i = 1; i >= 0; i--) {
+    ASSERT_EQ(ArrowIpcFileReaderReadRecordBatch(&reader, i, &array, &error),
+              NANOARROW_OK)
+        << error.message;
+    ASSERT_EQ(array.children[0]->dictionary->length, 2);
+    EXPECT_EQ(DictionaryValue(array.children[0]->dictionary, 1), "b");
+    array.release(&array);
+  }
+
+  ArrowIpcFileReaderReset(&reader);
+}
+
+TEST(NanoarrowIpcWriter, FileRoundTrip) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+  ASSERT_NO_FATAL_FAILURE(MakeSimpleBatch(&schema, &array));
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+
+  struct ArrowBuffer output;
+  ArrowBufferInit(&output);
+  struct ArrowIpcOutputStream output_stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, &output), NANOARROW_OK);
+
+  struct ArrowIpcWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterStartFile(&writer, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(&writer, &schema, &error), NANOARROW_OK);
+  for (int i = 0; i < 3; i++) {
+    ASSERT_EQ(ArrowIpcWriterWriteArrayView(&writer, &array_view, &error), NANOARROW_OK)
+        << error.message;
+  }
+  ASSERT_EQ(ArrowIpcWriterFinalizeFile(&writer, &error), NANOARROW_OK)
+      << error.message;
+  ArrowIpcWriterReset(&writer);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
+
+  // The file begins and ends with the magic bytes
+  ASSERT_GE(output.size_bytes, 18);
+  EXPECT_EQ(memcmp(output.data, "ARROW1\0\0", 8), 0);
+  EXPECT_EQ(memcmp(output.data + output.size_bytes - 6, "ARROW1", 6), 0);
+
+  // The footer can be decoded from the end of the file
+  struct ArrowIpcDecoder decoder;
+  struct ArrowIpcFooter footer;
+  ASSERT_EQ(ArrowIpcDecoderInit(&decoder), NANOARROW_OK);
+  ArrowIpcFooterInit(&footer);
+  struct ArrowBufferView data = ViewOf(&output);
+  ASSERT_EQ(ArrowIpcDecoderVerifyFooter(&decoder, data, &error), NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(ArrowIpcDecoderDecodeFooter(&decoder, data, &footer, &error), NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(SchemaToString(&footer.schema),
+            "struct<some_int: int32, some_string: string, some_list: list<item: "
+            "int64>>");
+  ASSERT_EQ(footer.record_batch_blocks.size_bytes, 3 * sizeof(struct ArrowIpcFileBlock));
+  const struct ArrowIpcFileBlock* blocks =
+      reinterpret_cast<const struct ArrowIpcFileBlock*>(footer.record_batch_blocks.data);
+  EXPECT_EQ(blocks[1].offset, blocks[0].offset + blocks[0].metadata_length +
+                                  blocks[0].body_length);
+  ArrowIpcFooterReset(&footer);
+
+  // Not enough of the end of the file to contain the footer
+  data.data.as_uint8 += data.size_bytes - 16;
+  data.size_bytes = 16;
+  EXPECT_EQ(ArrowIpcDecoderPeekFooter(&decoder, data, &error), ESPIPE);
+  ArrowIpcDecoderReset(&decoder);
+
+  // Batches can be read in any order and outlive the reader and the file
+  struct ArrowIpcSharedBuffer file;
+  ASSERT_EQ(ArrowIpcSharedBufferInit(&file, &output), NANOARROW_OK);
+  struct ArrowIpcFileReader reader;
+  ASSERT_EQ(ArrowIpcFileReaderInit(&reader, &file, &error), NANOARROW_OK)
+      << error.message;
+  ArrowIpcSharedBufferReset(&file);
+  ASSERT_EQ(reader.n_record_batches, 3);
+
+  struct ArrowArray arrays[3];
+  for (int64_t i = 2; i >= 0; i--) {
+    ASSERT_EQ(ArrowIpcFileReaderReadRecordBatch(&reader, i, &arrays[i], &error),
+              NANOARROW_OK)
+        << error.message;
+  }
+
+  EXPECT_EQ(ArrowIpcFileReaderReadRecordBatch(&reader, 3, &array, &error), EINVAL);
+  EXPECT_EQ(ArrowIpcFileReaderReadRecordBatch(&reader, -1, &array, &error), EINVAL);
+  ArrowIpcFileReaderReset(&reader);
+
+  for (int i = 0; i < 3; i++) {
+    ASSERT_NO_FATAL_FAILURE(ExpectSimpleBatch(&arrays[i]));
+    arrays[i].release(&arrays[i]);
+  }
+}
+
+TEST(NanoarrowIpcWriter, FileRecordBatchSizes) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+  ASSERT_NO_FATAL_FAILURE(MakeSimpleBatch(&schema, &array));
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+
+  struct ArrowBuffer output;
+  ArrowBufferInit(&output);
+  struct ArrowIpcOutputStream output_stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, &output), NANOARROW_OK);
+
+  struct ArrowIpcWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterStartFile(&writer, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(&writer, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteArrayView(&writer, &array_view, &error), NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(ArrowIpcWriterFinalizeFile(&writer, &error), NANOARROW_OK)
+      << error.message;
+  ArrowIpcWriterReset(&writer);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
+
+  struct ArrowIpcSharedBuffer file;
+  ASSERT_EQ(ArrowIpcSharedBufferInit(&file, &output), NANOARROW_OK);
+  struct ArrowIpcFileReader reader;
+  ASSERT_EQ(ArrowIpcFileReaderInit(&reader, &file, &error), NANOARROW_OK)
+      << error.message;
+  ArrowIpcSharedBufferReset(&file);
+  ASSERT_EQ(reader.n_record_batches, 1);
+
+  struct ArrowIpcRecordBatchSizes sizes;
+  ASSERT_EQ(ArrowIpcFileReaderReadRecordBatchSizes(&reader, 0, &sizes, &error),
+            NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(sizes.length, 5);
+
+  // some_int: validity, data; some_string: validity, offsets, data;
+  // some_list: validity, offsets, item validity, item data
+  std::vector<int64_t> buffer_sizes(sizes.buffer_size_bytes,
+                                    sizes.buffer_size_bytes + sizes.n_buffers);
+  EXPECT_EQ(buffer_sizes, std::vector<int64_t>({1, 20, 1, 24, 9, 1, 24, 0, 72}));
+  std::vector<int64_t> column_sizes(sizes.column_size_bytes,
+                                    sizes.column_size_bytes + sizes.n_columns);
+  EXPECT_EQ(column_sizes, std::vector<int64_t>({21, 34, 97}));
+  EXPECT_GE(sizes.body_size_bytes, 21 + 34 + 97);
+
+  EXPECT_EQ(ArrowIpcFileReaderReadRecordBatchSizes(&reader, 1, &sizes, &error), EINVAL);
+  ArrowIpcFileReaderReset(&reader);
+
+  struct ArrowIpcDecoder decoder;
+  ASSERT_EQ(ArrowIpcDecoderInit(&decoder), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcDecoderDecodeRecordBatchSizes(&decoder, &sizes, &error), EINVAL);
+  EXPECT_STREQ(error.message, "decoder did not just decode a RecordBatch message");
+  ArrowIpcDecoderReset(&decoder);
+}
+
+TEST(NanoarrowIpcWriter, FileErrors) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowError error;
+  ASSERT_NO_FATAL_FAILURE(MakeSimpleBatch(&schema, &array));
+  array.release(&array);
+
+  struct ArrowBuffer output;
+  ArrowBufferInit(&output);
+  struct ArrowIpcOutputStream output_stream;
+  struct ArrowIpcWriter writer;
+
+  // Files must be started before any message and finalized after the schema
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, &output), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcWriterFinalizeFile(&writer, &error), EINVAL);
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(&writer, &schema, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcWriterStartFile(&writer, &error), EINVAL);
+  ArrowIpcWriterReset(&writer);
+
+  output.size_bytes = 0;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&output_stream, &output), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterInit(&writer, &output_stream), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterStartFile(&writer, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcWriterFinalizeFile(&writer, &error), EINVAL);
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(&writer, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterFinalizeFile(&writer, &error), NANOARROW_OK);
+  ArrowIpcWriterReset(&writer);
+  schema.release(&schema);
+
+  struct ArrowBuffer copy;
+  struct ArrowIpcSharedBuffer file;
+  struct ArrowIpcFileReader reader;
+
+  // A file with no batches is valid
+  ArrowBufferInit(&copy);
+  ASSERT_EQ(ArrowBufferAppend(&copy, output.data, output.size_bytes), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcSharedBufferInit(&file, &copy), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcFileReaderInit(&reader, &file, &error), NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(reader.n_record_batches, 0);
+  ArrowIpcFileReaderReset(&reader);
+  ArrowIpcSharedBufferReset(&file);
+
+  // Bad leading magic, bad trailing magic, and a footer size larger than the file
+  for (int64_t offset : {int64_t(0), output.size_bytes - 1, output.size_bytes - 10}) {
+    ArrowBufferInit(&copy);
+    ASSERT_EQ(ArrowBufferAppend(&copy, output.data, output.size_bytes), NANOARROW_OK);
+    copy.data[offset] = 0x7F;
+    ASSERT_EQ(ArrowIpcSharedBufferInit(&file, &copy), NANOARROW_OK);
+    EXPECT_EQ(ArrowIpcFileReaderInit(&reader, &file, &error), EINVAL) << offset;
+    ArrowIpcSharedBufferReset(&file);
+  }
+
+  ArrowBufferReset(&output);
+}
+
+TEST(NanoarrowIpcWriter, OutputStreamFile) {
+  FILE* file_ptr = tmpfile();
+  ASSERT_NE(file_ptr, nullptr);
+
+  struct ArrowIpcOutputStream stream;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcOutputStreamInitFile(&stream, file_ptr, 0), NANOARROW_OK);
+
+  struct ArrowBufferView buffers[3];
+  buffers[0].data.data = "abc";
+  buffers[0].size_bytes = 3;
+  buffers[1].data.data = nullptr;
+  buffers[1].size_bytes = 0;
+  buffers[2].data.data = "defg";
+  buffers[2].size_bytes = 4;
+  ASSERT_EQ(stream.write(&stream, buffers, 3, &error), NANOARROW_OK);
+  stream.release(&stream);
+  EXPECT_EQ(stream.release, nullptr);
+
+  char content[16];
+  rewind(file_ptr);
+  ASSERT_EQ(fread(content, 1, sizeof(content), file_ptr), 7);
+  EXPECT_EQ(std::string(content, 7), "abcdefg");
+  fclose(file_ptr);
+}
+
+#if !defined(_WIN32)
+TEST(NanoarrowIpcWriter, OutputStreamFileDescriptor) {
+  FILE* file_ptr = tmpfile();
+  ASSERT_NE(file_ptr, nullptr);
+
+  struct ArrowIpcOutputStream stream;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcOutputStreamInitFileDescriptor(&stream, fileno(file_ptr), 0),
+            NANOARROW_OK);
+
+  // Use more buffers than fit in a single writev() call
+  std::vector<std::string> values;
+  std::string expected;
+  for (int i = 0; i < 200; i++) {
+    values.push_back(std::string(i % 7, static_cast<char>('a' + i % 26)));
+    expected += values.back();
+  }
+
+  std::vector<struct ArrowBufferView> buffers(values.size());
+  for (size_t i = 0; i < values.size(); i++) {
+    buffers[i].data.data = values[i].data();
+    buffers[i].size_bytes = static_cast<int64_t>(values[i].size());
+  }
+
+  ASSERT_EQ(stream.write(&stream, buffers.data(), buffers.size(), &error), NANOARROW_OK)
+      << error.message;
+  stream.release(&stream);
+
+  std::string content(expected.size() + 1, '\0');
+  rewind(file_ptr);
+  ASSERT_EQ(fread(&content[0], 1, content.size(), file_ptr), expected.size());
+  content.resize(expected.size());
+  EXPECT_EQ(content, expected);
+  fclose(file_ptr);
+}
+
+TEST(NanoarrowIpcWriter, OutputStreamSocket) {
+  // A file whose mapping is sent with sendfile()
+  std::string file_content(200000, '\0');
+  for (size_t i = 0; i < file_content.size(); i++) {
+    file_content[i] = static_cast<char>(i * 7 + (i >> 8));
+  }
+  FILE* file_ptr = tmpfile();
+  ASSERT_NE(file_ptr, nullptr);
+  ASSERT_EQ(fwrite(file_content.data(), 1, file_content.size(), file_ptr),
+            file_content.size());
+  fflush(file_ptr);
+  void* mapping = mmap(nullptr, file_content.size(), PROT_READ, MAP_PRIVATE,
+                       fileno(file_ptr), 0);
+  ASSERT_NE(mapping, MAP_FAILED);
+  const uint8_t* file_data = reinterpret_cast<const uint8_t*>(mapping);
+
+  int socket_fds[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, socket_fds), 0);
+  struct ArrowIpcOutputStream stream;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcOutputStreamInitFileDescriptor(&stream, socket_fds[0], 1),
+            NANOARROW_OK);
+  int result = ArrowIpcOutputStreamAddSendfileSource(&stream, fileno(file_ptr), mapping,
+                                                     file_content.size(), &error);
+#if defined(__linux__)
+  ASSERT_EQ(result, NANOARROW_OK) << error.message;
+#else
+  ASSERT_EQ(result, ENOTSUP);
+#endif
+
+  // Small buffers in the mapping are gathered with the others
+  struct ArrowBufferView buffers[5];
+  buffers[0].data.data = "abc";
+  buffers[0].size_bytes = 3;
+  buffers[1].data.as_uint8 = file_data + 100;
+  buffers[1].size_bytes = 150000;
+  buffers[2].data.data = "defg";
+  buffers[2].size_bytes = 4;
+  buffers[3].data.as_uint8 = file_data;
+  buffers[3].size_bytes = 10;
+  buffers[4].data.as_uint8 = file_data + 120000;
+  buffers[4].size_bytes = 80000;
+  std::string expected = "abc" + file_content.substr(100, 150000) + "defg" +
+                         file_content.substr(0, 10) + file_content.substr(120000);
+
+  // The whole buffer doesn't fit in the socket, so write from another thread
+  int write_result = -1;
+  std::thread writer([&] {
+    struct ArrowError write_error;
+    write_result = stream.write(&stream, buffers, 5, &write_error);
+    stream.release(&stream);
+  });
+
+  struct ArrowIpcInputStream input;
+  ASSERT_EQ(ArrowIpcInputStreamInitFileDescriptor(&input, socket_fds[1], 1, &error),
+            NANOARROW_OK)
+      << error.message;
+  std::string content(expected.size() + 1, '\0');
+  int64_t size_read_bytes = 0;
+  ASSERT_EQ(input.read(&input, reinterpret_cast<uint8_t*>(&content[0]), content.size(),
+                       &size_read_bytes, &error),
+            NANOARROW_OK)
+      << error.message;
+  writer.join();
+  input.release(&input);
+  EXPECT_EQ(write_result, NANOARROW_OK);
+  ASSERT_EQ(size_read_bytes, static_cast<int64_t>(expected.size()));
+  content.resize(expected.size());
+  EXPECT_TRUE(content == expected);
+
+  munmap(mapping, file_content.size());
+  fclose(file_ptr);
+
+  // Sources can only be added to file descriptor streams
+  struct ArrowBuffer output;
+  ArrowBufferInit(&output);
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(&stream, &output), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcOutputStreamAddSendfileSource(&stream, 0, "abc", 3, &error),
+            EINVAL);
+  stream.release(&stream);
+
+  // Writing to a closed connection is an error rather than a signal
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, socket_fds), 0);
+  close(socket_fds[1]);
+  ASSERT_EQ(ArrowIpcOutputStreamInitFileDescriptor(&stream, socket_fds[0], 1),
+            NANOARROW_OK);
+  EXPECT_EQ(stream.write(&stream, buffers, 1, &error), EPIPE);
+  stream.release(&stream);
+}
+#endif
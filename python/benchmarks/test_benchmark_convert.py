@@ -0,0 +1,163 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+
+"""Benchmarks for conversions between Python objects and nanoarrow arrays
+
+Run from the python/ directory against the installed package (i.e., after
+``pip install .``, which bundles the C library from the parent directory)::
+
+    pip install .[benchmark]
+    pytest benchmarks --benchmark-group-by=func,param:n
+
+Each conversion is compared against the equivalent pyarrow conversion, whose
+benchmarks have names that start with ``test_pyarrow_``.
+"""
+
+import numpy as np
+import pytest
+
+pa = pytest.importorskip("pyarrow")
+pytest.importorskip("pytest_benchmark")
+
+import nanoarrow as na  # noqa: E402
+
+SIZES = [1_000, 100_000, 1_000_000]
+NULL_RATES = [0, 0.1, 0.5]
+KINDS = ["int64", "double", "string", "timestamp", "list", "struct"]
+
+
+def make_pyarrow_array(kind, n, null_rate):
+    rng = np.random.default_rng(1234)
+    mask = rng.random(n) < null_rate if null_rate > 0 else None
+
+    if kind == "int64":
+        return pa.array(rng.integers(0, 1000, n), mask=mask)
+    elif kind == "double":
+        return pa.array(rng.random(n), mask=mask)
+    elif kind == "string":
+        values = [f"value_{i}" for i in rng.integers(0, 1_000_000, n)]
+        return pa.array(values, mask=mask)
+    elif kind == "timestamp":
+        values = rng.integers(0, 2_000_000_000, n).astype("datetime64[s]")
+        return pa.array(values, pa.timestamp("s", "UTC"), mask=mask)
+    elif kind == "list":
+        lengths = rng.integers(0, 5, n)
+        offsets = np.concatenate([[0], np.cumsum(lengths)]).astype(np.int32)
+        values = pa.array(rng.integers(0, 1000, offsets[-1]), pa.int32())
+        if mask is not None:
+            # Lists are null where their offset is null
+            offsets = pa.array(offsets, mask=np.append(mask, False))
+        return pa.ListArray.from_arrays(offsets, values)
+    elif kind == "struct":
+        return pa.StructArray.from_arrays(
+            [
+                make_pyarrow_array("double", n, null_rate),
+                make_pyarrow_array("string", n, null_rate),
+            ],
+            names=["x", "y"],
+        )
+    else:
+        raise ValueError(f"Unknown kind '{kind}'")
+
+
+def pylist_values(kind, array):
+    # Element types that pyarrow converts and Array.from_iterable() accepts
+    values = array.cast(pa.int64()) if kind == "timestamp" else array
+    return values.to_pylist()
+
+
+@pytest.fixture(params=SIZES, ids=lambda n: f"n={n}")
+def n(request):
+    return request.param
+
+
+@pytest.fixture(params=NULL_RATES, ids=lambda rate: f"null_rate={rate}")
+def null_rate(request):
+    return request.param
+
+
+@pytest.fixture(params=KINDS)
+def kind(request):
+    return request.param
+
+
+@pytest.fixture
+def pa_array(kind, n, null_rate):
+    return make_pyarrow_array(kind, n, null_rate)
+
+
+def test_nanoarrow_import(benchmark, pa_array):
+    benchmark(na.array, pa_array)
+
+
+def test_nanoarrow_view(benchmark, pa_array):
+    array = na.array(pa_array)
+    benchmark(array.view)
+
+
+def test_nanoarrow_to_pylist(benchmark, pa_array):
+    view = na.array(pa_array).view()
+    benchmark(view.to_pylist)
+
+
+def test_pyarrow_to_pylist(benchmark, pa_array):
+    benchmark(pa_array.to_pylist)
+
+
+def test_nanoarrow_from_iterable(benchmark, kind, pa_array):
+    if kind in ("list", "struct"):
+        pytest.skip(f"Array.from_iterable() does not support {kind} values")
+
+    values = pylist_values(kind, pa_array)
+    schema = na.schema(pa.int64()) if kind == "timestamp" else na.schema(pa_array.type)
+    benchmark(na.Array.from_iterable, values, schema)
+
+
+def test_pyarrow_from_pylist(benchmark, kind, pa_array):
+    if kind in ("list", "struct"):
+        pytest.skip(f"Array.from_iterable() does not support {kind} values")
+
+    values = pylist_values(kind, pa_array)
+    type = pa.int64() if kind == "timestamp" else pa_array.type
+    benchmark(pa.array, values, type)
+
+
+def test_nanoarrow_to_numpy(benchmark, kind, pa_array):
+    if kind not in ("int64", "double"):
+        pytest.skip(f"ArrayView.to_numpy() does not support {kind} values")
+
+    view = na.array(pa_array).view()
+    benchmark(view.to_numpy)
+
+
+def test_pyarrow_to_numpy(benchmark, kind, pa_array):
+    if kind not in ("int64", "double"):
+        pytest.skip(f"ArrayView.to_numpy() does not support {kind} values")
+
+    benchmark(pa_array.to_numpy, zero_copy_only=False)
+
+
+def test_nanoarrow_buffer_view_export(benchmark, n):
+    # The Python buffer protocol export of a BufferView
+    view = na.array(pa.array(np.arange(n))).view()
+    benchmark(lambda: np.frombuffer(view.buffers[1], np.int64))
+
+
+def test_nanoarrow_from_buffer(benchmark, n):
+    values = np.arange(n)
+    benchmark(na.Array.from_buffer, values)
@@ -202,6 +202,90 @@ def copy_or_generate_nanoarrow_c():
         os.unlink(maybe_nanoarrow_hpp)
 
 
+# Runs cmake -DNANOARROW_IPC_BUNDLE=ON if cmake exists or copies the bundled
+# nanoarrow_ipc.c/h and flatcc sources from ../dist if it does not
+def copy_or_generate_nanoarrow_ipc_c():
+    this_wd = os.getcwd()
+    this_dir = os.path.abspath(os.path.dirname(__file__))
+    source_dir = os.path.dirname(this_dir)
+    vendor_dir = os.path.join(this_dir, "src/nanoarrow")
+
+    for f in ("nanoarrow_ipc.c", "nanoarrow_ipc.h", "flatcc.c"):
+        if os.path.exists(os.path.join(vendor_dir, f)):
+            os.unlink(os.path.join(vendor_dir, f))
+    if os.path.exists(os.path.join(vendor_dir, "flatcc")):
+        shutil.rmtree(os.path.join(vendor_dir, "flatcc"))
+
+    ipc_source_dir = os.path.join(source_dir, "extensions", "nanoarrow_ipc")
+    has_cmake = os.system("cmake --version") == 0
+    build_dir = os.path.join(this_dir, "_cmake_ipc")
+
+    if has_cmake and os.path.exists(os.path.join(ipc_source_dir, "CMakeLists.txt")):
+        try:
+            os.mkdir(build_dir)
+            os.chdir(build_dir)
+            os.system(f"cmake {ipc_source_dir} -DNANOARROW_IPC_BUNDLE=ON")
+            os.system("cmake --install . --prefix=../src/nanoarrow")
+        finally:
+            if os.path.exists(build_dir):
+                # Can fail on Windows with permission issues
+                try:
+                    shutil.rmtree(build_dir)
+                except Exception as e:
+                    print(f"Failed to remove _cmake_ipc temp directory: {str(e)}")
+            os.chdir(this_wd)
+    else:
+        dist_dir = os.path.join(source_dir, "dist")
+        for f in ("nanoarrow_ipc.c", "nanoarrow_ipc.h", "flatcc.c"):
+            shutil.copyfile(os.path.join(dist_dir, f), os.path.join(vendor_dir, f))
+        shutil.copytree(
+            os.path.join(dist_dir, "flatcc"), os.path.join(vendor_dir, "flatcc")
+        )
+
+    if not os.path.exists(os.path.join(vendor_dir, "nanoarrow_ipc.h")):
+        raise ValueError("Attempt to vendor nanoarrow_ipc.c/h failed")
+
+
+# Runs cmake -DNANOARROW_DEVICE_BUNDLE=ON if cmake exists or copies the bundled
+# nanoarrow_device.c/h from ../dist if it does not. Only the CPU device is
+# vendored: the CUDA implementation requires nvcc to build.
+def copy_or_generate_nanoarrow_device_c():
+    this_wd = os.getcwd()
+    this_dir = os.path.abspath(os.path.dirname(__file__))
+    source_dir = os.path.dirname(this_dir)
+    vendor_dir = os.path.join(this_dir, "src/nanoarrow")
+
+    for f in ("nanoarrow_device.c", "nanoarrow_device.h"):
+        if os.path.exists(os.path.join(vendor_dir, f)):
+            os.unlink(os.path.join(vendor_dir, f))
+
+    device_source_dir = os.path.join(source_dir, "extensions", "nanoarrow_device")
+    has_cmake = os.system("cmake --version") == 0
+    build_dir = os.path.join(this_dir, "_cmake_device")
+
+    if has_cmake and os.path.exists(os.path.join(device_source_dir, "CMakeLists.txt")):
+        try:
+            os.mkdir(build_dir)
+            os.chdir(build_dir)
+            os.system(f"cmake {device_source_dir} -DNANOARROW_DEVICE_BUNDLE=ON")
+            os.system("cmake --install . --prefix=../src/nanoarrow")
+        finally:
+            if os.path.exists(build_dir):
+                # Can fail on Windows with permission issues
+                try:
+                    shutil.rmtree(build_dir)
+                except Exception as e:
+                    print(f"Failed to remove _cmake_device temp directory: {str(e)}")
+            os.chdir(this_wd)
+    else:
+        dist_dir = os.path.join(source_dir, "dist")
+        for f in ("nanoarrow_device.c", "nanoarrow_device.h"):
+            shutil.copyfile(os.path.join(dist_dir, f), os.path.join(vendor_dir, f))
+
+    if not os.path.exists(os.path.join(vendor_dir, "nanoarrow_device.h")):
+        raise ValueError("Attempt to vendor nanoarrow_device.c/h failed")
+
+
 # Runs the pxd generator with some information about the file name
 def generate_nanoarrow_pxd():
     this_dir = os.path.abspath(os.path.dirname(__file__))
@@ -215,4 +299,6 @@ def generate_nanoarrow_pxd():
 
 if __name__ == "__main__":
     copy_or_generate_nanoarrow_c()
+    copy_or_generate_nanoarrow_ipc_c()
+    copy_or_generate_nanoarrow_device_c()
     generate_nanoarrow_pxd()
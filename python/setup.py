@@ -55,6 +55,33 @@ setup(
             extra_compile_args=coverage_compile_args,
             extra_link_args=coverage_link_args,
             define_macros=coverage_define_macros,
-        )
+        ),
+        Extension(
+            name="nanoarrow._ipc_lib",
+            include_dirs=["src/nanoarrow"],
+            language="c",
+            sources=[
+                "src/nanoarrow/_ipc_lib.pyx",
+                "src/nanoarrow/nanoarrow.c",
+                "src/nanoarrow/nanoarrow_ipc.c",
+                "src/nanoarrow/flatcc.c",
+            ],
+            extra_compile_args=coverage_compile_args,
+            extra_link_args=coverage_link_args,
+            define_macros=coverage_define_macros,
+        ),
+        Extension(
+            name="nanoarrow._device_lib",
+            include_dirs=["src/nanoarrow"],
+            language="c",
+            sources=[
+                "src/nanoarrow/_device_lib.pyx",
+                "src/nanoarrow/nanoarrow.c",
+                "src/nanoarrow/nanoarrow_device.c",
+            ],
+            extra_compile_args=coverage_compile_args,
+            extra_link_args=coverage_link_args,
+            define_macros=coverage_define_macros,
+        ),
     ]
 )
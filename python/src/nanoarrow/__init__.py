@@ -15,5 +15,12 @@
 # specific language governing permissions and limitations
 # under the License.
 
-from ._lib import Array, ArrayStream, ArrayView, Schema, c_version  # noqa: F401
-from .lib import array, array_stream, schema  # noqa: F401
+from ._lib import (  # noqa: F401
+    Array,
+    ArrayStream,
+    ArrayView,
+    CategoricalConverter,
+    Schema,
+    c_version,
+)
+from .lib import array, array_from_iterable, array_stream, schema  # noqa: F401
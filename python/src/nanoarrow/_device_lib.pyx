@@ -0,0 +1,317 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+# cython: language_level = 3
+# cython: linetrace=True
+
+"""Low-level nanoarrow device Python bindings
+
+This Cython extension wraps the ArrowDeviceArray of the nanoarrow_device
+extension and exports arrays using the DLPack protocol such that the data buffer
+of a device array can be consumed (e.g., by PyTorch or CuPy) without copying it
+through host memory.
+"""
+
+from libc.stdint cimport uintptr_t, uint8_t, uint16_t, int32_t, int64_t, uint64_t
+from cpython.pycapsule cimport PyCapsule_New, PyCapsule_GetPointer, PyCapsule_IsValid
+from cpython.ref cimport Py_INCREF, Py_DECREF
+from nanoarrow_c cimport *
+from nanoarrow_device_c cimport *
+
+from nanoarrow._lib import Array, NanoarrowException, Schema
+
+
+# The subset of the DLPack ABI (dlpack.h) required to export a DLManagedTensor
+
+cdef struct DLDevice:
+    int32_t device_type
+    int32_t device_id
+
+cdef struct DLDataType:
+    uint8_t code
+    uint8_t bits
+    uint16_t lanes
+
+cdef struct DLTensor:
+    void* data
+    DLDevice device
+    int32_t ndim
+    DLDataType dtype
+    int64_t* shape
+    int64_t* strides
+    uint64_t byte_offset
+
+cdef struct DLManagedTensor:
+    DLTensor dl_tensor
+    void* manager_ctx
+    void (*deleter)(DLManagedTensor* self) noexcept
+
+cdef enum:
+    _kDLInt = 0
+    _kDLUInt = 1
+    _kDLFloat = 2
+
+# DLPack type codes and bit widths of the storage types that can be exported
+_DLPACK_TYPES = {
+    NANOARROW_TYPE_INT8: (_kDLInt, 8),
+    NANOARROW_TYPE_UINT8: (_kDLUInt, 8),
+    NANOARROW_TYPE_INT16: (_kDLInt, 16),
+    NANOARROW_TYPE_UINT16: (_kDLUInt, 16),
+    NANOARROW_TYPE_INT32: (_kDLInt, 32),
+    NANOARROW_TYPE_UINT32: (_kDLUInt, 32),
+    NANOARROW_TYPE_INT64: (_kDLInt, 64),
+    NANOARROW_TYPE_UINT64: (_kDLUInt, 64),
+    NANOARROW_TYPE_HALF_FLOAT: (_kDLFloat, 16),
+    NANOARROW_TYPE_FLOAT: (_kDLFloat, 32),
+    NANOARROW_TYPE_DOUBLE: (_kDLFloat, 64),
+}
+
+
+# The tensor and its (one-dimensional) shape share one allocation
+cdef struct _DLPackTensor:
+    DLManagedTensor managed
+    int64_t shape[1]
+
+
+cdef void _dlpack_tensor_deleter(DLManagedTensor* managed) noexcept with gil:
+    if managed.manager_ctx != NULL:
+        Py_DECREF(<object>managed.manager_ctx)
+        managed.manager_ctx = NULL
+    ArrowFree(managed)
+
+
+cdef void _pycapsule_dltensor_deleter(object capsule) noexcept:
+    # Consumers rename the capsule to "used_dltensor" when they take ownership
+    cdef DLManagedTensor* managed
+    if PyCapsule_IsValid(capsule, "dltensor"):
+        managed = <DLManagedTensor*>PyCapsule_GetPointer(capsule, "dltensor")
+        managed.deleter(managed)
+
+
+# Release callback for an ArrowArray that shares the buffers and children of an
+# Array owned by Python: private_data is a strong reference to that Array.
+cdef void _shared_array_release(ArrowArray* array) noexcept with gil:
+    Py_DECREF(<object>array.private_data)
+    array.private_data = NULL
+    array.release = NULL
+
+
+cdef class DeviceArrayHolder:
+    """Memory holder for an ArrowDeviceArray
+
+    This class is responsible for the lifecycle of the ArrowDeviceArray
+    whose memory it is responsible. When this object is deleted,
+    a non-NULL release callback is invoked.
+    """
+    cdef ArrowDeviceArray c_device_array
+
+    def __cinit__(self):
+        self.c_device_array.array.release = NULL
+
+    def __dealloc__(self):
+        if self.c_device_array.array.release != NULL:
+          self.c_device_array.array.release(&self.c_device_array.array)
+
+    def _addr(self):
+        return <uintptr_t>&self.c_device_array
+
+
+cdef class DeviceArray:
+    """ArrowDeviceArray wrapper
+
+    This class provides a user-facing interface to access the fields of an
+    ArrowDeviceArray as defined in the Arrow C Device data interface. These
+    objects are usually created using `nanoarrow.device.device_array()`.
+    Null-free arrays of integer and floating point types can be exported
+    using the DLPack protocol (e.g., ``numpy.from_dlpack()``) without copying.
+
+    Examples
+    --------
+
+    >>> import pyarrow as pa
+    >>> from nanoarrow import device
+    >>> device_array = device.device_array(pa.array([1, 2, 3], pa.int32()))
+    >>> device_array.device_type
+    1
+    >>> device_array.array.length
+    3
+    """
+    cdef object _base
+    cdef ArrowDeviceArray* _ptr
+    cdef object _schema
+
+    @staticmethod
+    def allocate(schema):
+        base = DeviceArrayHolder()
+        return DeviceArray(base, base._addr(), schema)
+
+    def __cinit__(self, object base, uintptr_t addr, schema):
+        self._base = base
+        self._ptr = <ArrowDeviceArray*>addr
+        self._schema = schema
+
+    def _addr(self):
+        return <uintptr_t>self._ptr
+
+    def is_valid(self):
+        return self._ptr != NULL and self._ptr.array.release != NULL
+
+    def _assert_valid(self):
+        if self._ptr == NULL:
+            raise RuntimeError("DeviceArray is NULL")
+        if self._ptr.array.release == NULL:
+            raise RuntimeError("DeviceArray is released")
+
+    @property
+    def schema(self):
+        return self._schema
+
+    @property
+    def device_type(self):
+        self._assert_valid()
+        return self._ptr.device_type
+
+    @property
+    def device_id(self):
+        self._assert_valid()
+        return self._ptr.device_id
+
+    @property
+    def array(self):
+        """The ArrowArray member of this device array
+
+        Its buffers are only accessible from the CPU if device_type is
+        ARROW_DEVICE_CPU or ARROW_DEVICE_CUDA_HOST.
+        """
+        self._assert_valid()
+        return Array(self, <uintptr_t>&self._ptr.array, self._schema)
+
+    def __dlpack_device__(self):
+        # ArrowDeviceType values are DLPack DLDeviceType values
+        self._assert_valid()
+        return (self._ptr.device_type, self._ptr.device_id)
+
+    def __dlpack__(self, stream=None):
+        """Export the data buffer of this array as a DLPack capsule
+
+        Only null-free arrays of integer and floating point types without
+        children can be exported. The capsule references the data buffer of this
+        array (no data is copied) and keeps this object alive until the consumer
+        deletes the tensor. If this array has a sync_event, it is waited on
+        before the capsule is returned such that the data is ready on any
+        stream.
+        """
+        self._assert_valid()
+        cdef ArrowArray* c_array = &self._ptr.array
+        cdef ArrowSchema* c_schema = <ArrowSchema*><uintptr_t>self._schema._addr()
+        cdef ArrowSchemaView schema_view
+        cdef ArrowError error
+        error.message[0] = 0
+
+        cdef int code = ArrowSchemaViewInit(&schema_view, c_schema, &error)
+        if code != NANOARROW_OK:
+            raise NanoarrowException(
+                "ArrowSchemaViewInit()", code, error.message.decode("UTF-8")
+            )
+
+        if (
+            schema_view.type not in _DLPACK_TYPES
+            or c_array.n_children != 0
+            or c_array.dictionary != NULL
+        ):
+            type_str = ArrowTypeString(schema_view.type).decode("UTF-8")
+            raise TypeError(f"Can't export array of type '{type_str}' using DLPack")
+
+        cdef int64_t null_count = c_array.null_count
+        if c_array.buffers[0] == NULL:
+            null_count = 0
+        elif null_count == -1 and self._ptr.device_type in (
+            ARROW_DEVICE_CPU, ARROW_DEVICE_CUDA_HOST
+        ):
+            null_count = c_array.length - ArrowBitCountSet(
+                <const uint8_t*>c_array.buffers[0], c_array.offset, c_array.length
+            )
+
+        if null_count != 0:
+            raise ValueError("Can't export array that may contain nulls using DLPack")
+
+        cdef ArrowDevice* device
+        if self._ptr.sync_event != NULL:
+            device = ArrowDeviceResolve(self._ptr.device_type, self._ptr.device_id)
+            if device == NULL:
+                raise RuntimeError(
+                    "Can't wait on the sync_event of an array with device type "
+                    f"{self._ptr.device_type}: this device is not supported by "
+                    "this build of nanoarrow"
+                )
+
+            code = device.synchronize_event(device, self._ptr.sync_event, &error)
+            if code != NANOARROW_OK:
+                raise NanoarrowException(
+                    "ArrowDevice::synchronize_event()",
+                    code,
+                    error.message.decode("UTF-8")
+                )
+
+        type_code, bits = _DLPACK_TYPES[schema_view.type]
+
+        cdef _DLPackTensor* tensor = <_DLPackTensor*>ArrowMalloc(sizeof(_DLPackTensor))
+        if tensor == NULL:
+            raise MemoryError()
+
+        tensor.shape[0] = c_array.length
+        tensor.managed.dl_tensor.data = <void*>c_array.buffers[1]
+        tensor.managed.dl_tensor.device.device_type = self._ptr.device_type
+        tensor.managed.dl_tensor.device.device_id = self._ptr.device_id
+        tensor.managed.dl_tensor.ndim = 1
+        tensor.managed.dl_tensor.dtype.code = type_code
+        tensor.managed.dl_tensor.dtype.bits = bits
+        tensor.managed.dl_tensor.dtype.lanes = 1
+        tensor.managed.dl_tensor.shape = &tensor.shape[0]
+        tensor.managed.dl_tensor.strides = NULL
+        tensor.managed.dl_tensor.byte_offset = c_array.offset * (bits // 8)
+        tensor.managed.manager_ctx = <void*>self
+        tensor.managed.deleter = &_dlpack_tensor_deleter
+        Py_INCREF(self)
+
+        try:
+            return PyCapsule_New(tensor, "dltensor", &_pycapsule_dltensor_deleter)
+        except:
+            _dlpack_tensor_deleter(&tensor.managed)
+            raise
+
+
+def device_array_from_array(array):
+    """Wrap an Array whose buffers are in CPU memory as a DeviceArray
+
+    The DeviceArray shares the buffers and children of ``array`` (no data is
+    copied) and keeps it alive until the DeviceArray is released.
+    """
+    array._assert_valid()
+    cdef DeviceArray out = DeviceArray.allocate(array.schema)
+    cdef ArrowArray* c_array = <ArrowArray*><uintptr_t>array._addr()
+    cdef ArrowArray shared = c_array[0]
+    shared.private_data = <void*>array
+    shared.release = &_shared_array_release
+    Py_INCREF(array)
+
+    cdef int code = ArrowDeviceArrayInit(ArrowDeviceCpu(), out._ptr, &shared)
+    if code != NANOARROW_OK:
+        shared.release(&shared)
+        raise NanoarrowException("ArrowDeviceArrayInit()", code)
+
+    return out
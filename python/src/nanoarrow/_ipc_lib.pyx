@@ -0,0 +1,168 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+# cython: language_level = 3
+# cython: linetrace=True
+
+"""Low-level nanoarrow IPC Python bindings
+
+This Cython extension wraps the ArrowArrayStream reader of the nanoarrow_ipc
+extension. Input that implements the Python buffer protocol is decoded in place:
+arrays reference the buffer, which is kept alive by the buffer export, instead of
+copying message bodies. Other input is read through its read() method.
+"""
+
+from libc.errno cimport EIO
+from libc.stdint cimport uintptr_t, uint8_t, int64_t
+from libc.string cimport memcpy
+from cpython.buffer cimport PyObject_GetBuffer, PyBuffer_Release, PyBUF_ANY_CONTIGUOUS
+from cpython cimport Py_buffer
+from cpython.mem cimport PyMem_Malloc, PyMem_Free
+from cpython.ref cimport Py_INCREF, Py_DECREF
+from nanoarrow_c cimport *
+from nanoarrow_ipc_c cimport *
+
+from nanoarrow._lib import ArrayStream, NanoarrowException
+
+# ArrowBufferDeallocator() is not picked up by the nanoarrow_c.pxd generator because
+# its callback argument is a function pointer
+cdef extern from "nanoarrow.h" nogil:
+    ArrowBufferAllocator ArrowBufferDeallocator(
+        void (*custom_free)(ArrowBufferAllocator*, uint8_t*, int64_t),
+        void* private_data
+    )
+
+
+cdef void _py_buffer_deallocate(ArrowBufferAllocator* allocator, uint8_t* ptr,
+                                int64_t size) noexcept with gil:
+    cdef Py_buffer* data = <Py_buffer*>allocator.private_data
+    PyBuffer_Release(data)
+    PyMem_Free(data)
+
+
+# Reads from a Python object with a read() method, filling buf unless the end of the
+# input is reached
+cdef ArrowErrorCode _py_input_stream_read(
+    ArrowIpcInputStream* stream,
+    uint8_t* buf,
+    int64_t buf_size_bytes,
+    int64_t* size_read_out,
+    ArrowError* error
+) noexcept with gil:
+    cdef object obj = <object>stream.private_data
+    cdef const unsigned char* chunk_data
+    cdef int64_t chunk_size
+    cdef int64_t n_read = 0
+
+    try:
+        while n_read < buf_size_bytes:
+            chunk = obj.read(buf_size_bytes - n_read)
+            if not chunk:
+                break
+
+            chunk_data = chunk
+            chunk_size = len(chunk)
+            if chunk_size > buf_size_bytes - n_read:
+                raise ValueError("read() returned more bytes than requested")
+
+            memcpy(buf + n_read, chunk_data, chunk_size)
+            n_read += chunk_size
+    except Exception as e:
+        message = f"{type(e).__name__}: {e}".encode("UTF-8")
+        ArrowErrorSet(error, "%s", <const char*>message)
+        return EIO
+
+    size_read_out[0] = n_read
+    return NANOARROW_OK
+
+
+cdef void _py_input_stream_release(ArrowIpcInputStream* stream) noexcept with gil:
+    Py_DECREF(<object>stream.private_data)
+    stream.private_data = NULL
+    stream.release = NULL
+
+
+cdef object _array_stream_from_input_stream(ArrowIpcInputStream* input_stream):
+    array_stream = ArrayStream.allocate()
+    cdef ArrowArrayStream* c_array_stream = (
+        <ArrowArrayStream*><uintptr_t>array_stream._addr()
+    )
+
+    # Shared buffers are only used when their reference count is thread safe because
+    # arrays may be released from any Python thread
+    cdef ArrowIpcArrayStreamReaderOptions options
+    ArrowIpcArrayStreamReaderOptionsInit(&options)
+    options.use_shared_buffers = ArrowIpcSharedBufferIsThreadSafe()
+
+    cdef int code = ArrowIpcArrayStreamReaderInit(
+        c_array_stream, input_stream, &options
+    )
+    if code != NANOARROW_OK:
+        input_stream.release(input_stream)
+        raise NanoarrowException("ArrowIpcArrayStreamReaderInit()", code)
+
+    return array_stream
+
+
+def array_stream_from_buffer(obj):
+    """Create an ArrayStream that decodes the IPC stream held by a buffer
+
+    ``obj`` can be any object implementing the Python buffer protocol (e.g., bytes,
+    a memoryview, or an mmap.mmap). Arrays returned by the stream reference the
+    content of ``obj`` without copying it and ``obj`` is kept alive until the
+    stream and all arrays that reference it are released.
+    """
+    cdef Py_buffer* data = <Py_buffer*>PyMem_Malloc(sizeof(Py_buffer))
+    if data == NULL:
+        raise MemoryError()
+
+    try:
+        PyObject_GetBuffer(obj, data, PyBUF_ANY_CONTIGUOUS)
+    except:
+        PyMem_Free(data)
+        raise
+
+    # From here, data is released with input
+    cdef ArrowBuffer input
+    ArrowBufferInit(&input)
+    input.data = <uint8_t*>data.buf
+    input.size_bytes = data.len
+    input.capacity_bytes = data.len
+    input.allocator = ArrowBufferDeallocator(&_py_buffer_deallocate, data)
+
+    cdef ArrowIpcInputStream input_stream
+    cdef int code = ArrowIpcInputStreamInitBuffer(&input_stream, &input)
+    if code != NANOARROW_OK:
+        ArrowBufferReset(&input)
+        raise NanoarrowException("ArrowIpcInputStreamInitBuffer()", code)
+
+    return _array_stream_from_input_stream(&input_stream)
+
+
+def array_stream_from_readable(obj):
+    """Create an ArrayStream that decodes the IPC stream read from obj.read()
+
+    ``obj`` is kept alive until the stream is released. Message bodies are copied
+    from the bytes returned by ``obj.read()``.
+    """
+    cdef ArrowIpcInputStream input_stream
+    input_stream.read = &_py_input_stream_read
+    input_stream.release = &_py_input_stream_release
+    input_stream.private_data = <void*>obj
+    Py_INCREF(obj)
+
+    return _array_stream_from_input_stream(&input_stream)
@@ -27,12 +27,51 @@ strong references to Python objects. These wrappers are intended to
 be literal and stay close to the structure definitions.
 """
 
-from libc.stdint cimport uintptr_t, int64_t
+from libc.stdint cimport uintptr_t, int8_t, uint8_t, int64_t, uint64_t
+from libc.string cimport memcmp
 from cpython.mem cimport PyMem_Malloc, PyMem_Free
-from cpython.bytes cimport PyBytes_FromStringAndSize
+from cpython.bytes cimport PyBytes_FromStringAndSize, PyBytes_AsStringAndSize
+from cpython.unicode cimport PyUnicode_DecodeUTF8
 from cpython cimport Py_buffer
+from cpython.buffer cimport PyObject_CheckBuffer, PyObject_GetBuffer, PyBuffer_Release
+from cpython.buffer cimport PyBUF_WRITABLE, PyBUF_FORMAT, PyBUF_ANY_CONTIGUOUS
+from cpython.pycapsule cimport PyCapsule_New, PyCapsule_GetPointer
+from cpython.ref cimport Py_INCREF, Py_DECREF
 from nanoarrow_c cimport *
 
+import asyncio
+import sys
+import threading
+
+# Declarations the nanoarrow_c.pxd generator does not pick up (it skips names that
+# contain digits and arguments that are function pointers)
+cdef extern from "nanoarrow.h" nogil:
+    ArrowBufferAllocator ArrowBufferDeallocator(
+        void (*custom_free)(ArrowBufferAllocator*, uint8_t*, int64_t),
+        void* private_data
+    )
+    void ArrowBitsUnpackInt8(const uint8_t* bits, int64_t start_offset, int64_t length,
+                             int8_t* out)
+    void ArrowBitmapAppendInt8Unsafe(ArrowBitmap* bitmap, const int8_t* values,
+                                     int64_t n_values)
+    ArrowBuffer* ArrowArrayBuffer(ArrowArray* array, int64_t i)
+    void ArrowSchemaMove(ArrowSchema* src, ArrowSchema* dst)
+    void ArrowArrayMove(ArrowArray* src, ArrowArray* dst)
+    void ArrowArrayStreamMove(ArrowArrayStream* src, ArrowArrayStream* dst)
+    int64_t ARROW_FLAG_DICTIONARY_ORDERED
+
+cdef extern from "Python.h":
+    const char* PyUnicode_AsUTF8AndSize(object unicode, Py_ssize_t* size) except NULL
+
+# The callbacks of the ArrowArrayStream are invoked without the GIL such that slow
+# producers don't block other Python threads
+ctypedef int (*ArrowArrayStreamGetSchemaFunc)(
+    ArrowArrayStream*, ArrowSchema*
+) noexcept nogil
+ctypedef int (*ArrowArrayStreamGetNextFunc)(
+    ArrowArrayStream*, ArrowArray*
+) noexcept nogil
+
 def c_version():
     """Return the nanoarrow C library version string
     """
@@ -117,6 +156,71 @@ cdef class ArrayViewHolder:
         return <uintptr_t>&self.c_array_view
 
 
+# PyCapsule support for the Arrow PyCapsule interface. Each capsule owns heap memory
+# for one C struct; the capsule destructor releases the struct if the consumer did
+# not move it out and then frees the memory.
+
+cdef void _pycapsule_schema_deleter(object schema_capsule) noexcept:
+    cdef ArrowSchema* schema = <ArrowSchema*>PyCapsule_GetPointer(
+        schema_capsule, "arrow_schema"
+    )
+    if schema.release != NULL:
+        schema.release(schema)
+    ArrowFree(schema)
+
+
+cdef object _alloc_c_schema(ArrowSchema** c_schema):
+    c_schema[0] = <ArrowSchema*>ArrowMalloc(sizeof(ArrowSchema))
+    if c_schema[0] == NULL:
+        raise MemoryError()
+    c_schema[0].release = NULL
+    return PyCapsule_New(c_schema[0], "arrow_schema", &_pycapsule_schema_deleter)
+
+
+cdef void _pycapsule_array_deleter(object array_capsule) noexcept:
+    cdef ArrowArray* array = <ArrowArray*>PyCapsule_GetPointer(
+        array_capsule, "arrow_array"
+    )
+    if array.release != NULL:
+        array.release(array)
+    ArrowFree(array)
+
+
+cdef object _alloc_c_array(ArrowArray** c_array):
+    c_array[0] = <ArrowArray*>ArrowMalloc(sizeof(ArrowArray))
+    if c_array[0] == NULL:
+        raise MemoryError()
+    c_array[0].release = NULL
+    return PyCapsule_New(c_array[0], "arrow_array", &_pycapsule_array_deleter)
+
+
+cdef void _pycapsule_array_stream_deleter(object stream_capsule) noexcept:
+    cdef ArrowArrayStream* stream = <ArrowArrayStream*>PyCapsule_GetPointer(
+        stream_capsule, "arrow_array_stream"
+    )
+    if stream.release != NULL:
+        stream.release(stream)
+    ArrowFree(stream)
+
+
+cdef object _alloc_c_array_stream(ArrowArrayStream** c_stream):
+    c_stream[0] = <ArrowArrayStream*>ArrowMalloc(sizeof(ArrowArrayStream))
+    if c_stream[0] == NULL:
+        raise MemoryError()
+    c_stream[0].release = NULL
+    return PyCapsule_New(
+        c_stream[0], "arrow_array_stream", &_pycapsule_array_stream_deleter
+    )
+
+
+# Release callback for an ArrowArray that shares the buffers and children of an
+# Array owned by Python: private_data is a strong reference to that Array.
+cdef void _shared_array_release(ArrowArray* array) noexcept with gil:
+    Py_DECREF(<object>array.private_data)
+    array.private_data = NULL
+    array.release = NULL
+
+
 class NanoarrowException(RuntimeError):
     """An error resulting from a call to the nanoarrow C library
 
@@ -190,15 +294,57 @@ cdef class Schema:
     """
     cdef object _base
     cdef ArrowSchema* _ptr
+    cdef object _cached_view
+    cdef list _cached_children
 
     @staticmethod
     def allocate():
         base = SchemaHolder()
         return Schema(base, base._addr())
 
+    @staticmethod
+    def _import_from_c_capsule(schema_capsule):
+        """Import from an "arrow_schema" PyCapsule
+
+        The ArrowSchema is moved out of the capsule into a new Schema.
+        """
+        cdef ArrowSchema* c_schema = <ArrowSchema*>PyCapsule_GetPointer(
+            schema_capsule, "arrow_schema"
+        )
+        cdef Schema out = Schema.allocate()
+        ArrowSchemaMove(c_schema, out._ptr)
+        return out
+
     def __cinit__(self, object base, uintptr_t addr):
         self._base = base,
         self._ptr = <ArrowSchema*>addr
+        self._cached_view = None
+        self._cached_children = None
+
+    cdef Schema _child(self, int64_t i):
+        # Children reference the object that owns this schema's memory rather than
+        # this wrapper such that caching them does not create a reference cycle
+        if self._cached_children is None:
+            self._cached_children = [None] * self._ptr.n_children
+
+        child = self._cached_children[i]
+        if child is None:
+            child = Schema(self._base, <uintptr_t>self._ptr.children[i])
+            self._cached_children[i] = child
+        return child
+
+    def __arrow_c_schema__(self):
+        """Export to an "arrow_schema" PyCapsule
+
+        The capsule owns an independent deep copy of this schema.
+        """
+        self._assert_valid()
+        cdef ArrowSchema* c_schema_out
+        schema_capsule = _alloc_c_schema(&c_schema_out)
+        cdef int result = ArrowSchemaDeepCopy(self._ptr, c_schema_out)
+        if result != NANOARROW_OK:
+            Error.raise_error("ArrowSchemaDeepCopy()", result)
+        return schema_capsule
 
     def _addr(self):
         return <uintptr_t>self._ptr
@@ -264,15 +410,76 @@ cdef class Schema:
             return None
 
     def view(self):
+        """Parse this schema into a SchemaView
+
+        The result is cached: the ArrowSchema wrapped by this object is
+        assumed not to change after it has been accessed.
+        """
         self._assert_valid()
+        if self._cached_view is not None:
+            return self._cached_view
+
         schema_view = SchemaView()
         cdef Error error = Error()
         cdef int result = ArrowSchemaViewInit(&schema_view._schema_view, self._ptr, &error.c_error)
         if result != NANOARROW_OK:
             error.raise_message("ArrowSchemaViewInit()", result)
 
+        self._cached_view = schema_view
         return schema_view
 
+    def describe_fields(self):
+        """Describe every node of this schema tree
+
+        Walks the tree depth-first in a single pass (starting with this schema
+        at depth 0) without creating Schema wrappers for the children.
+        Dictionaries are not included.
+
+        Returns
+        -------
+        dict
+            Lists of equal length keyed by "depth", "name", "type" (as returned
+            by SchemaView.type) and "flags".
+
+        Examples
+        --------
+
+        >>> import pyarrow as pa
+        >>> import nanoarrow as na
+        >>> schema = na.schema(pa.schema([pa.field("col", pa.int32())]))
+        >>> schema.describe_fields()["type"]
+        ['struct', 'int32']
+        """
+        self._assert_valid()
+        cdef dict out = {"depth": [], "name": [], "type": [], "flags": []}
+        cdef Error error = Error()
+        _schema_describe_fields(
+            self._ptr, 0, out["depth"], out["name"], out["type"], out["flags"], error
+        )
+        return out
+
+
+cdef int _schema_describe_fields(ArrowSchema* schema, int64_t depth, list depths,
+                                 list names, list types, list flags,
+                                 Error error) except -1:
+    cdef ArrowSchemaView schema_view
+    cdef int result = ArrowSchemaViewInit(&schema_view, schema, &error.c_error)
+    if result != NANOARROW_OK:
+        error.raise_message("ArrowSchemaViewInit()", result)
+
+    depths.append(depth)
+    names.append(schema.name.decode("UTF-8") if schema.name != NULL else None)
+    types.append(ArrowTypeString(schema_view.type).decode("UTF-8"))
+    flags.append(schema.flags)
+
+    cdef int64_t i
+    for i in range(schema.n_children):
+        _schema_describe_fields(
+            schema.children[i], depth + 1, depths, names, types, flags, error
+        )
+
+    return 0
+
 
 cdef class SchemaView:
     """ArrowSchemaView wrapper
@@ -390,6 +597,251 @@ cdef class SchemaView:
                 self._schema_view.extension_metadata.size_bytes
             )
 
+cdef void _py_buffer_deallocate(ArrowBufferAllocator* allocator, uint8_t* ptr,
+                                int64_t size) noexcept with gil:
+    cdef Py_buffer* data = <Py_buffer*>allocator.private_data
+    PyBuffer_Release(data)
+    PyMem_Free(data)
+
+
+_BUFFER_FORMAT_TYPES = {
+    ("b", 1): NANOARROW_TYPE_INT8,
+    ("B", 1): NANOARROW_TYPE_UINT8,
+    ("h", 2): NANOARROW_TYPE_INT16,
+    ("H", 2): NANOARROW_TYPE_UINT16,
+    ("i", 4): NANOARROW_TYPE_INT32,
+    ("I", 4): NANOARROW_TYPE_UINT32,
+    ("l", 4): NANOARROW_TYPE_INT32,
+    ("L", 4): NANOARROW_TYPE_UINT32,
+    ("l", 8): NANOARROW_TYPE_INT64,
+    ("L", 8): NANOARROW_TYPE_UINT64,
+    ("q", 8): NANOARROW_TYPE_INT64,
+    ("Q", 8): NANOARROW_TYPE_UINT64,
+    ("e", 2): NANOARROW_TYPE_HALF_FLOAT,
+    ("f", 4): NANOARROW_TYPE_FLOAT,
+    ("d", 8): NANOARROW_TYPE_DOUBLE,
+}
+
+
+cdef object _arrow_type_from_buffer(Py_buffer* data):
+    format = data.format.decode("UTF-8") if data.format != NULL else "B"
+
+    # Byte order prefixes other than the native one are not supported
+    native_prefix = "<" if sys.byteorder == "little" else ">"
+    if format[:1] in ("@", "=", native_prefix):
+        format = format[1:]
+
+    if data.ndim != 1:
+        raise ValueError(f"Expected one-dimensional buffer but got ndim {data.ndim}")
+
+    key = (format, data.itemsize)
+    if key not in _BUFFER_FORMAT_TYPES:
+        raise TypeError(f"Can't create Array from buffer with format '{format}'")
+
+    return _BUFFER_FORMAT_TYPES[key]
+
+
+cdef int _array_set_validity_from_mask(ArrowArray* array, object mask) except -1:
+    cdef Py_buffer mask_data
+    PyObject_GetBuffer(mask, &mask_data, PyBUF_ANY_CONTIGUOUS)
+
+    cdef ArrowBitmap bitmap
+    ArrowBitmapInit(&bitmap)
+    cdef int64_t i
+    cdef int result
+
+    try:
+        if mask_data.len != array.length:
+            raise ValueError(
+                f"Expected mask of {array.length} bytes but got {mask_data.len} bytes"
+            )
+
+        result = ArrowBitmapReserve(&bitmap, array.length)
+        if result != NANOARROW_OK:
+            Error.raise_error("ArrowBitmapReserve()", result)
+
+        # Pack the mask and invert it such that set bits indicate valid elements
+        ArrowBitmapAppendInt8Unsafe(&bitmap, <const int8_t*>mask_data.buf, array.length)
+        for i in range(bitmap.buffer.size_bytes):
+            bitmap.buffer.data[i] = ~bitmap.buffer.data[i]
+    except:
+        ArrowBitmapReset(&bitmap)
+        raise
+    finally:
+        PyBuffer_Release(&mask_data)
+
+    cdef int64_t n_valid = ArrowBitCountSet(bitmap.buffer.data, 0, array.length)
+    array.null_count = array.length - n_valid
+    ArrowArraySetValidityBitmap(array, &bitmap)
+    return 0
+
+
+cdef ArrowType _infer_arrow_type(list values) except *:
+    for item in values:
+        if item is None:
+            continue
+        elif isinstance(item, bool):
+            return NANOARROW_TYPE_BOOL
+        elif isinstance(item, int):
+            return NANOARROW_TYPE_INT64
+        elif isinstance(item, float):
+            return NANOARROW_TYPE_DOUBLE
+        elif isinstance(item, str):
+            return NANOARROW_TYPE_STRING
+        elif isinstance(item, bytes):
+            return NANOARROW_TYPE_BINARY
+        else:
+            raise TypeError(
+                f"Can't infer Arrow type from object of type {type(item).__name__}"
+            )
+
+    return NANOARROW_TYPE_NA
+
+
+cdef int _array_append_values(ArrowArray* array, ArrowType storage_type,
+                              list values) except -1:
+    # One loop per family of storage types such that each loop only does the
+    # conversion it needs
+    cdef int code = NANOARROW_OK
+    cdef Py_ssize_t size
+    cdef char* data
+    cdef ArrowStringView string_view
+    cdef ArrowBufferView bytes_view
+    cdef str what
+
+    if storage_type == NANOARROW_TYPE_NA:
+        what = "ArrowArrayAppendNull()"
+        for item in values:
+            if item is not None:
+                raise TypeError(f"Expected None but got {type(item).__name__}")
+        code = ArrowArrayAppendNull(array, len(values))
+    elif storage_type == NANOARROW_TYPE_BOOL:
+        what = "ArrowArrayAppendInt()"
+        for item in values:
+            if item is None:
+                code = ArrowArrayAppendNull(array, 1)
+            else:
+                code = ArrowArrayAppendInt(array, 1 if <bint>item else 0)
+            if code != NANOARROW_OK:
+                break
+    elif storage_type in (
+        NANOARROW_TYPE_INT8, NANOARROW_TYPE_UINT8, NANOARROW_TYPE_INT16,
+        NANOARROW_TYPE_UINT16, NANOARROW_TYPE_INT32, NANOARROW_TYPE_UINT32,
+        NANOARROW_TYPE_INT64
+    ):
+        what = "ArrowArrayAppendInt()"
+        for item in values:
+            if item is None:
+                code = ArrowArrayAppendNull(array, 1)
+            else:
+                code = ArrowArrayAppendInt(array, <int64_t>item)
+            if code != NANOARROW_OK:
+                break
+    elif storage_type == NANOARROW_TYPE_UINT64:
+        what = "ArrowArrayAppendUInt()"
+        for item in values:
+            if item is None:
+                code = ArrowArrayAppendNull(array, 1)
+            else:
+                code = ArrowArrayAppendUInt(array, <uint64_t>item)
+            if code != NANOARROW_OK:
+                break
+    elif storage_type in (NANOARROW_TYPE_FLOAT, NANOARROW_TYPE_DOUBLE):
+        what = "ArrowArrayAppendDouble()"
+        for item in values:
+            if item is None:
+                code = ArrowArrayAppendNull(array, 1)
+            else:
+                code = ArrowArrayAppendDouble(array, <double>item)
+            if code != NANOARROW_OK:
+                break
+    elif storage_type in (NANOARROW_TYPE_STRING, NANOARROW_TYPE_LARGE_STRING):
+        what = "ArrowArrayAppendString()"
+        for item in values:
+            if item is None:
+                code = ArrowArrayAppendNull(array, 1)
+            else:
+                string_view.data = PyUnicode_AsUTF8AndSize(item, &size)
+                string_view.size_bytes = size
+                code = ArrowArrayAppendString(array, string_view)
+            if code != NANOARROW_OK:
+                break
+    elif storage_type in (
+        NANOARROW_TYPE_BINARY, NANOARROW_TYPE_LARGE_BINARY,
+        NANOARROW_TYPE_FIXED_SIZE_BINARY
+    ):
+        what = "ArrowArrayAppendBytes()"
+        for item in values:
+            if item is None:
+                code = ArrowArrayAppendNull(array, 1)
+            else:
+                PyBytes_AsStringAndSize(item, &data, &size)
+                bytes_view.data.data = data
+                bytes_view.size_bytes = size
+                code = ArrowArrayAppendBytes(array, bytes_view)
+            if code != NANOARROW_OK:
+                break
+    else:
+        type_str = ArrowTypeString(storage_type).decode("UTF-8")
+        raise TypeError(f"Can't create Array of type '{type_str}' from Python objects")
+
+    if code != NANOARROW_OK:
+        Error.raise_error(what, code)
+
+    return 0
+
+
+cdef object _array_from_buffer_copy(object obj, Schema schema):
+    # Copies the content of obj into a new Array with one call to ArrowBufferAppend()
+    # if obj is a buffer whose format matches schema (or schema is None). Returns None
+    # otherwise such that the caller can fall back on iterating over obj.
+    cdef Py_buffer data
+    try:
+        PyObject_GetBuffer(obj, &data, PyBUF_FORMAT | PyBUF_ANY_CONTIGUOUS)
+    except BufferError:
+        return None
+
+    cdef int result
+    cdef Error error = Error()
+    cdef Array array
+    try:
+        try:
+            arrow_type = _arrow_type_from_buffer(&data)
+        except (TypeError, ValueError):
+            return None
+
+        if schema is None:
+            schema = Schema.allocate()
+            result = ArrowSchemaInitFromType(schema._ptr, arrow_type)
+            if result != NANOARROW_OK:
+                Error.raise_error("ArrowSchemaInitFromType()", result)
+        elif (<SchemaView>schema.view())._schema_view.storage_type != arrow_type:
+            return None
+
+        array = Array.allocate(schema)
+        result = ArrowArrayInitFromSchema(array._ptr, schema._ptr, &error.c_error)
+        if result != NANOARROW_OK:
+            error.raise_message("ArrowArrayInitFromSchema()", result)
+
+        result = ArrowArrayStartAppending(array._ptr)
+        if result != NANOARROW_OK:
+            Error.raise_error("ArrowArrayStartAppending()", result)
+
+        result = ArrowBufferAppend(ArrowArrayBuffer(array._ptr, 1), data.buf, data.len)
+        if result != NANOARROW_OK:
+            Error.raise_error("ArrowBufferAppend()", result)
+    finally:
+        PyBuffer_Release(&data)
+
+    array._ptr.length = data.len // data.itemsize
+    array._ptr.null_count = 0
+    result = ArrowArrayFinishBuildingDefault(array._ptr, &error.c_error)
+    if result != NANOARROW_OK:
+        error.raise_message("ArrowArrayFinishBuildingDefault()", result)
+
+    return array
+
+
 cdef class Array:
     """ArrowArray wrapper
 
@@ -417,16 +869,250 @@ cdef class Array:
     cdef object _base
     cdef ArrowArray* _ptr
     cdef Schema _schema
+    cdef list _cached_children
 
     @staticmethod
     def allocate(Schema schema):
         base = ArrayHolder()
         return Array(base, base._addr(), schema)
 
+    @staticmethod
+    def from_buffer(obj, mask=None):
+        """Create an Array from an object implementing the Python buffer protocol
+
+        The content of ``obj`` is used as the data buffer of the Array without
+        copying and ``obj`` is kept alive until the data buffer is released. The
+        Arrow type is inferred from the format of ``obj``, which must be a
+        one-dimensional contiguous buffer of integers or floating point values.
+        If ``mask`` is provided, it must be a buffer of one byte per element
+        whose value is 1 for null elements and 0 otherwise (e.g., the ``mask``
+        of a ``numpy.ma.MaskedArray``) and is packed into the validity bitmap.
+
+        Examples
+        --------
+
+        >>> import numpy as np
+        >>> import nanoarrow as na
+        >>> array = na.Array.from_buffer(np.array([1, 2, 3], np.int32))
+        >>> array.schema.format
+        'i'
+        >>> array.length
+        3
+        """
+        cdef Py_buffer* data = <Py_buffer*>PyMem_Malloc(sizeof(Py_buffer))
+        if data == NULL:
+            raise MemoryError()
+
+        try:
+            PyObject_GetBuffer(obj, data, PyBUF_FORMAT | PyBUF_ANY_CONTIGUOUS)
+        except:
+            PyMem_Free(data)
+            raise
+
+        try:
+            arrow_type = _arrow_type_from_buffer(data)
+        except:
+            PyBuffer_Release(data)
+            PyMem_Free(data)
+            raise
+
+        # From here, data is released with buffer
+        cdef ArrowBuffer buffer
+        ArrowBufferInit(&buffer)
+        buffer.data = <uint8_t*>data.buf
+        buffer.size_bytes = data.len
+        buffer.capacity_bytes = data.len
+        buffer.allocator = ArrowBufferDeallocator(&_py_buffer_deallocate, data)
+        cdef int64_t length = data.len // data.itemsize
+
+        cdef Schema schema = Schema.allocate()
+        cdef int result = ArrowSchemaInitFromType(schema._ptr, arrow_type)
+        if result != NANOARROW_OK:
+            ArrowBufferReset(&buffer)
+            Error.raise_error("ArrowSchemaInitFromType()", result)
+
+        cdef Array array = Array.allocate(schema)
+        result = ArrowArrayInitFromType(array._ptr, arrow_type)
+        if result != NANOARROW_OK:
+            ArrowBufferReset(&buffer)
+            Error.raise_error("ArrowArrayInitFromType()", result)
+
+        result = ArrowArraySetBuffer(array._ptr, 1, &buffer)
+        if result != NANOARROW_OK:
+            ArrowBufferReset(&buffer)
+            Error.raise_error("ArrowArraySetBuffer()", result)
+
+        array._ptr.length = length
+        if mask is not None:
+            _array_set_validity_from_mask(array._ptr, mask)
+
+        cdef Error error = Error()
+        result = ArrowArrayFinishBuildingDefault(array._ptr, &error.c_error)
+        if result != NANOARROW_OK:
+            error.raise_message("ArrowArrayFinishBuildingDefault()", result)
+
+        return array
+
+    @staticmethod
+    def from_iterable(obj, Schema schema=None):
+        """Create an Array by appending the elements of a Python iterable
+
+        Elements are appended to the buffers of a new ArrowArray using a loop
+        specialized for the storage type of ``schema``: ``int``, ``float``,
+        ``bool``, ``str``, and ``bytes`` values are supported and ``None`` is
+        appended as null. If ``schema`` is not provided, the type is inferred
+        from the first element that is not ``None``. Objects implementing the
+        buffer protocol whose format matches the storage type (or any supported
+        format if ``schema`` is not provided) are copied with a single bulk
+        append. Unlike :meth:`from_buffer`, the result never references ``obj``.
+
+        Examples
+        --------
+
+        >>> import nanoarrow as na
+        >>> array = na.Array.from_iterable([1, None, 3])
+        >>> array.schema.format
+        'l'
+        >>> array.view().to_pylist()
+        [1, None, 3]
+        """
+        if PyObject_CheckBuffer(obj):
+            out = _array_from_buffer_copy(obj, schema)
+            if out is not None:
+                return out
+
+        cdef list values = obj if isinstance(obj, list) else list(obj)
+        cdef int result
+        if schema is None:
+            schema = Schema.allocate()
+            result = ArrowSchemaInitFromType(schema._ptr, _infer_arrow_type(values))
+            if result != NANOARROW_OK:
+                Error.raise_error("ArrowSchemaInitFromType()", result)
+
+        cdef Error error = Error()
+        cdef Array array = Array.allocate(schema)
+        result = ArrowArrayInitFromSchema(array._ptr, schema._ptr, &error.c_error)
+        if result != NANOARROW_OK:
+            error.raise_message("ArrowArrayInitFromSchema()", result)
+
+        result = ArrowArrayStartAppending(array._ptr)
+        if result != NANOARROW_OK:
+            Error.raise_error("ArrowArrayStartAppending()", result)
+
+        result = ArrowArrayReserve(array._ptr, len(values))
+        if result != NANOARROW_OK:
+            Error.raise_error("ArrowArrayReserve()", result)
+
+        cdef SchemaView schema_view = schema.view()
+        _array_append_values(array._ptr, schema_view._schema_view.storage_type, values)
+
+        result = ArrowArrayFinishBuildingDefault(array._ptr, &error.c_error)
+        if result != NANOARROW_OK:
+            error.raise_message("ArrowArrayFinishBuildingDefault()", result)
+
+        return array
+
+    @staticmethod
+    def from_pandas_categorical(obj):
+        """Create a dictionary-encoded Array from a ``pandas.Categorical``
+
+        The codes of ``obj`` are used as the indices of the Array without copying
+        (see :meth:`from_buffer`), with codes of -1 marked as null in the validity
+        bitmap. Numeric categories are used as the dictionary without copying;
+        other categories are appended to a new dictionary (see
+        :meth:`from_iterable`). The dictionary is flagged as ordered if ``obj``
+        is ordered.
+
+        Examples
+        --------
+
+        >>> import pandas as pd
+        >>> import nanoarrow as na
+        >>> array = na.Array.from_pandas_categorical(pd.Categorical(["a", "b", "a"]))
+        >>> array.schema.format
+        'c'
+        >>> array.dictionary.view().to_pylist()
+        ['a', 'b']
+        """
+        import numpy as np
+
+        codes = np.asarray(obj.codes)
+        mask = codes < 0
+        cdef Array array = Array.from_buffer(codes, mask if mask.any() else None)
+
+        categories = np.asarray(obj.categories)
+        cdef Array dictionary
+        if categories.dtype.kind in "iuf":
+            dictionary = Array.from_buffer(np.ascontiguousarray(categories))
+        else:
+            dictionary = Array.from_iterable(categories.tolist())
+
+        cdef int result = ArrowSchemaAllocateDictionary(array._schema._ptr)
+        if result != NANOARROW_OK:
+            Error.raise_error("ArrowSchemaAllocateDictionary()", result)
+        ArrowSchemaMove(dictionary._schema._ptr, array._schema._ptr.dictionary)
+        if obj.ordered:
+            array._schema._ptr.flags |= ARROW_FLAG_DICTIONARY_ORDERED
+
+        result = ArrowArrayAllocateDictionary(array._ptr)
+        if result != NANOARROW_OK:
+            Error.raise_error("ArrowArrayAllocateDictionary()", result)
+        ArrowArrayMove(dictionary._ptr, array._ptr.dictionary)
+
+        return array
+
+    @staticmethod
+    def _import_from_c_capsule(schema_capsule, array_capsule):
+        """Import from "arrow_schema" and "arrow_array" PyCapsules
+
+        Both structures are moved out of their capsules into a new Array.
+        """
+        cdef Schema schema = Schema._import_from_c_capsule(schema_capsule)
+        cdef ArrowArray* c_array = <ArrowArray*>PyCapsule_GetPointer(
+            array_capsule, "arrow_array"
+        )
+        cdef Array out = Array.allocate(schema)
+        ArrowArrayMove(c_array, out._ptr)
+        return out
+
     def __cinit__(self, object base, uintptr_t addr, Schema schema):
         self._base = base,
         self._ptr = <ArrowArray*>addr
         self._schema = schema
+        self._cached_children = None
+
+    cdef Array _child(self, int64_t i):
+        # As for Schema._child(), children reference the owner of this array's
+        # memory to avoid a reference cycle
+        if self._cached_children is None:
+            self._cached_children = [None] * self._ptr.n_children
+
+        child = self._cached_children[i]
+        if child is None:
+            child = Array(
+                self._base, <uintptr_t>self._ptr.children[i], self._schema._child(i)
+            )
+            self._cached_children[i] = child
+        return child
+
+    def __arrow_c_array__(self, requested_schema=None):
+        """Export to "arrow_schema" and "arrow_array" PyCapsules
+
+        The exported ArrowArray shares buffers and children with this Array
+        (no data is copied) and keeps it alive until the consumer releases it.
+        """
+        self._assert_valid()
+        if requested_schema is not None:
+            raise NotImplementedError("requested_schema")
+
+        schema_capsule = self._schema.__arrow_c_schema__()
+        cdef ArrowArray* c_array_out
+        array_capsule = _alloc_c_array(&c_array_out)
+        c_array_out[0] = self._ptr[0]
+        c_array_out.private_data = <void*>self
+        c_array_out.release = &_shared_array_release
+        Py_INCREF(self)
+        return schema_capsule, array_capsule
 
     def _addr(self):
         return <uintptr_t>self._ptr
@@ -474,22 +1160,360 @@ cdef class Array:
         else:
             return None
 
+    @property
+    def nbytes(self):
+        """Number of buffer bytes referenced by this array
+
+        See :attr:`ArrayView.nbytes`.
+        """
+        return self.view().nbytes
+
+    @property
+    def allocated_bytes(self):
+        """Total size in bytes of the buffers this array keeps alive
+
+        Unlike :attr:`nbytes`, this includes the parts of buffers outside the
+        range referenced by this array's offset and length (e.g., for slices) and
+        counts each distinct buffer once. The C data interface does not
+        communicate buffer capacities or the size of a parent allocation (e.g.,
+        an IPC message body a buffer points into), so the size of each buffer is
+        the size required by the array that references it.
+        """
+        cdef ArrayView view = self.view()
+        return _array_view_allocated_bytes(view._ptr, set())
+
     def view(self):
         cdef ArrayViewHolder holder = ArrayViewHolder()
+        cdef ArrowArrayView* c_array_view = &holder.c_array_view
+        cdef ArrowSchema* c_schema = self._schema._ptr
+        cdef ArrowArray* c_array = self._ptr
 
+        # Validation may take a while for large arrays, so let other threads run
         cdef Error error = Error()
-        cdef int result = ArrowArrayViewInitFromSchema(&holder.c_array_view,
-                                                       self._schema._ptr, &error.c_error)
+        cdef ArrowError* c_error = &error.c_error
+        cdef int result
+        with nogil:
+            result = ArrowArrayViewInitFromSchema(c_array_view, c_schema, c_error)
         if result != NANOARROW_OK:
             error.raise_message("ArrowArrayViewInitFromSchema()", result)
 
-        result = ArrowArrayViewSetArray(&holder.c_array_view, self._ptr, &error.c_error)
+        with nogil:
+            result = ArrowArrayViewSetArray(c_array_view, c_array, c_error)
         if result != NANOARROW_OK:
             error.raise_message("ArrowArrayViewSetArray()", result)
 
         return ArrayView(holder, holder._addr(), self._schema, self)
 
 
+# Number of elements fetched per call to the ArrowArrayViewGet*sUnsafe() batch getters
+cdef enum:
+    _PYLIST_CHUNK_SIZE = 1024
+
+
+cdef int64_t _array_view_child_offset(ArrowArrayView* view, int64_t i):
+    if view.storage_type == NANOARROW_TYPE_LARGE_LIST:
+        return view.buffer_views[1].data.as_int64[i]
+    else:
+        return view.buffer_views[1].data.as_int32[i]
+
+
+cdef list _array_view_to_pylist(ArrowArrayView* view, ArrowSchema* schema,
+                                int64_t i, int64_t n):
+    """Convert elements [i, i + n) of an ArrowArrayView to Python objects
+
+    Indices are relative to the offset of view (as they are for the
+    ArrowArrayViewGet*Unsafe() functions). Values are fetched in chunks using the
+    batch getters where one exists and null elements are set to None afterwards.
+    """
+    cdef list out = [None] * n
+    cdef ArrowType storage_type = view.storage_type
+    cdef int64_t j, k, chunk, start, end, child_start, child_end, size
+    cdef int64_t run_end, physical
+    cdef int64_t ints[_PYLIST_CHUNK_SIZE]
+    cdef double doubles[_PYLIST_CHUNK_SIZE]
+    cdef ArrowStringView strings[_PYLIST_CHUNK_SIZE]
+    cdef const uint8_t* bits
+    cdef ArrowArrayView* run_ends
+    cdef ArrowArrayView* entries
+    cdef const char* name
+    cdef list values
+    cdef list keys
+    cdef list names
+    cdef list columns
+    cdef dict row
+
+    if n <= 0:
+        return out
+
+    if view.dictionary != NULL:
+        values = _array_view_to_pylist(
+            view.dictionary, schema.dictionary, 0, view.dictionary.length
+        )
+        j = 0
+        while j < n:
+            chunk = min(n - j, _PYLIST_CHUNK_SIZE)
+            ArrowArrayViewGetIntsUnsafe(view, i + j, chunk, ints)
+            for k in range(chunk):
+                if not ArrowArrayViewIsNull(view, i + j + k):
+                    out[j + k] = values[ints[k]]
+            j += chunk
+        return out
+
+    if storage_type == NANOARROW_TYPE_NA:
+        return out
+    elif storage_type == NANOARROW_TYPE_BOOL:
+        bits = view.buffer_views[1].data.as_uint8
+        for j in range(n):
+            out[j] = ArrowBitGet(bits, view.offset + i + j) != 0
+    elif storage_type in (
+        NANOARROW_TYPE_INT8, NANOARROW_TYPE_UINT8, NANOARROW_TYPE_INT16,
+        NANOARROW_TYPE_UINT16, NANOARROW_TYPE_INT32, NANOARROW_TYPE_UINT32,
+        NANOARROW_TYPE_INT64
+    ):
+        j = 0
+        while j < n:
+            chunk = min(n - j, _PYLIST_CHUNK_SIZE)
+            ArrowArrayViewGetIntsUnsafe(view, i + j, chunk, ints)
+            for k in range(chunk):
+                out[j + k] = ints[k]
+            j += chunk
+    elif storage_type == NANOARROW_TYPE_UINT64:
+        # Values above INT64_MAX don't survive the int64_t batch getter
+        for j in range(n):
+            out[j] = ArrowArrayViewGetUIntUnsafe(view, i + j)
+    elif storage_type in (NANOARROW_TYPE_FLOAT, NANOARROW_TYPE_DOUBLE):
+        j = 0
+        while j < n:
+            chunk = min(n - j, _PYLIST_CHUNK_SIZE)
+            ArrowArrayViewGetDoublesUnsafe(view, i + j, chunk, doubles)
+            for k in range(chunk):
+                out[j + k] = doubles[k]
+            j += chunk
+    elif storage_type in (
+        NANOARROW_TYPE_STRING, NANOARROW_TYPE_LARGE_STRING, NANOARROW_TYPE_STRING_VIEW
+    ):
+        j = 0
+        while j < n:
+            chunk = min(n - j, _PYLIST_CHUNK_SIZE)
+            ArrowArrayViewGetStringsUnsafe(view, i + j, chunk, strings)
+            for k in range(chunk):
+                out[j + k] = PyUnicode_DecodeUTF8(
+                    strings[k].data, strings[k].size_bytes, NULL
+                )
+            j += chunk
+    elif storage_type in (
+        NANOARROW_TYPE_BINARY, NANOARROW_TYPE_LARGE_BINARY,
+        NANOARROW_TYPE_FIXED_SIZE_BINARY, NANOARROW_TYPE_BINARY_VIEW
+    ):
+        j = 0
+        while j < n:
+            chunk = min(n - j, _PYLIST_CHUNK_SIZE)
+            ArrowArrayViewGetStringsUnsafe(view, i + j, chunk, strings)
+            for k in range(chunk):
+                out[j + k] = PyBytes_FromStringAndSize(
+                    strings[k].data, strings[k].size_bytes
+                )
+            j += chunk
+    elif storage_type == NANOARROW_TYPE_STRUCT:
+        names = []
+        columns = []
+        for k in range(view.n_children):
+            name = schema.children[k].name
+            names.append(name.decode("UTF-8") if name != NULL else "")
+            columns.append(
+                _array_view_to_pylist(
+                    view.children[k], schema.children[k], view.offset + i, n
+                )
+            )
+        for j in range(n):
+            row = {}
+            for k in range(view.n_children):
+                row[names[k]] = columns[k][j]
+            out[j] = row
+    elif storage_type in (NANOARROW_TYPE_LIST, NANOARROW_TYPE_LARGE_LIST):
+        start = _array_view_child_offset(view, view.offset + i)
+        end = _array_view_child_offset(view, view.offset + i + n)
+        values = _array_view_to_pylist(
+            view.children[0], schema.children[0], start, end - start
+        )
+        for j in range(n):
+            child_start = _array_view_child_offset(view, view.offset + i + j) - start
+            child_end = _array_view_child_offset(view, view.offset + i + j + 1) - start
+            out[j] = values[child_start:child_end]
+    elif storage_type == NANOARROW_TYPE_MAP:
+        # Like pyarrow, maps are lists of (key, value) tuples
+        entries = view.children[0]
+        start = _array_view_child_offset(view, view.offset + i)
+        end = _array_view_child_offset(view, view.offset + i + n)
+        keys = _array_view_to_pylist(
+            entries.children[0], schema.children[0].children[0],
+            entries.offset + start, end - start
+        )
+        values = _array_view_to_pylist(
+            entries.children[1], schema.children[0].children[1],
+            entries.offset + start, end - start
+        )
+        for j in range(n):
+            child_start = _array_view_child_offset(view, view.offset + i + j) - start
+            child_end = _array_view_child_offset(view, view.offset + i + j + 1) - start
+            out[j] = list(
+                zip(keys[child_start:child_end], values[child_start:child_end])
+            )
+    elif storage_type == NANOARROW_TYPE_FIXED_SIZE_LIST:
+        size = view.layout.child_size_elements
+        values = _array_view_to_pylist(
+            view.children[0], schema.children[0], (view.offset + i) * size, n * size
+        )
+        for j in range(n):
+            out[j] = values[(j * size):((j + 1) * size)]
+    elif storage_type == NANOARROW_TYPE_RUN_END_ENCODED:
+        # Convert the referenced values once and walk the runs in order
+        run_ends = view.children[0]
+        start = ArrowArrayViewRunEndPhysicalIndex(view, i)
+        end = ArrowArrayViewRunEndPhysicalIndex(view, i + n - 1) + 1
+        values = _array_view_to_pylist(
+            view.children[1], schema.children[1], start, end - start
+        )
+        physical = start
+        run_end = ArrowArrayViewGetIntUnsafe(run_ends, physical)
+        for j in range(n):
+            while view.offset + i + j >= run_end:
+                physical += 1
+                run_end = ArrowArrayViewGetIntUnsafe(run_ends, physical)
+            out[j] = values[physical - start]
+        return out
+    elif storage_type in (NANOARROW_TYPE_SPARSE_UNION, NANOARROW_TYPE_DENSE_UNION):
+        # Unions have no validity bitmap
+        for j in range(n):
+            k = ArrowArrayViewUnionChildIndex(view, view.offset + i + j)
+            start = ArrowArrayViewUnionChildOffset(view, view.offset + i + j)
+            out[j] = _array_view_to_pylist(
+                view.children[k], schema.children[k], start, 1
+            )[0]
+        return out
+    else:
+        type_str = ArrowTypeString(storage_type).decode("UTF-8")
+        raise TypeError(
+            f"Can't convert array view of type '{type_str}' to Python objects"
+        )
+
+    bits = view.buffer_views[0].data.as_uint8
+    if bits != NULL:
+        for j in range(n):
+            if not ArrowBitGet(bits, view.offset + i + j):
+                out[j] = None
+
+    return out
+
+
+cdef int64_t _array_view_nbytes(ArrowArrayView* view, int64_t i, int64_t n):
+    """Number of buffer bytes referenced by elements [i, i + n) of an ArrowArrayView
+
+    Indices are relative to the offset of view. Children are restricted to the
+    range referenced by [i, i + n); dictionaries and variadic buffers are counted
+    in full.
+    """
+    cdef int64_t out = 0
+    cdef int64_t start = view.offset + i
+    cdef int64_t k, element_size_bits, child_start, child_end
+    cdef ArrowBufferType buffer_type
+    cdef const ArrowBufferView* offsets
+
+    if view.dictionary != NULL:
+        out += _array_view_nbytes(view.dictionary, 0, view.dictionary.length)
+
+    if n <= 0:
+        return out
+
+    for k in range(3):
+        buffer_type = view.layout.buffer_type[k]
+        element_size_bits = view.layout.element_size_bits[k]
+        if view.buffer_views[k].data.data == NULL:
+            continue
+
+        if buffer_type == NANOARROW_BUFFER_TYPE_VALIDITY or (
+            buffer_type == NANOARROW_BUFFER_TYPE_DATA and element_size_bits == 1
+        ):
+            out += (start + n + 7) // 8 - start // 8
+        elif buffer_type == NANOARROW_BUFFER_TYPE_DATA_OFFSET:
+            out += (n + 1) * element_size_bits // 8
+        elif (
+            buffer_type == NANOARROW_BUFFER_TYPE_DATA
+            and view.layout.buffer_type[1] == NANOARROW_BUFFER_TYPE_DATA_OFFSET
+        ):
+            offsets = &view.buffer_views[1]
+            if view.layout.element_size_bits[1] == 64:
+                out += offsets.data.as_int64[start + n] - offsets.data.as_int64[start]
+            else:
+                out += offsets.data.as_int32[start + n] - offsets.data.as_int32[start]
+        else:
+            out += n * element_size_bits // 8
+
+    for k in range(view.n_variadic_buffers):
+        out += view.variadic_buffer_sizes[k]
+
+    if view.storage_type in (
+        NANOARROW_TYPE_LIST, NANOARROW_TYPE_LARGE_LIST, NANOARROW_TYPE_MAP
+    ):
+        child_start = _array_view_child_offset(view, start)
+        child_end = _array_view_child_offset(view, start + n)
+        out += _array_view_nbytes(
+            view.children[0], child_start, child_end - child_start
+        )
+    elif view.storage_type == NANOARROW_TYPE_FIXED_SIZE_LIST:
+        out += _array_view_nbytes(
+            view.children[0],
+            start * view.layout.child_size_elements,
+            n * view.layout.child_size_elements
+        )
+    elif view.storage_type == NANOARROW_TYPE_RUN_END_ENCODED:
+        child_start = ArrowArrayViewRunEndPhysicalIndex(view, i)
+        child_end = ArrowArrayViewRunEndPhysicalIndex(view, i + n - 1) + 1
+        for k in range(view.n_children):
+            out += _array_view_nbytes(
+                view.children[k], child_start, child_end - child_start
+            )
+    elif view.storage_type == NANOARROW_TYPE_DENSE_UNION:
+        for k in range(view.n_children):
+            out += _array_view_nbytes(view.children[k], 0, view.children[k].length)
+    else:
+        for k in range(view.n_children):
+            out += _array_view_nbytes(view.children[k], start, n)
+
+    return out
+
+
+cdef int64_t _array_view_allocated_bytes(ArrowArrayView* view, set seen) except? -1:
+    """Total size of the buffers reachable from an ArrowArrayView
+
+    Buffers are identified by address such that buffers shared between arrays are
+    only counted once.
+    """
+    cdef int64_t out = 0
+    cdef int64_t k
+    cdef uintptr_t addr
+
+    for k in range(3):
+        addr = <uintptr_t>view.buffer_views[k].data.data
+        if addr != 0 and addr not in seen:
+            seen.add(addr)
+            out += view.buffer_views[k].size_bytes
+
+    for k in range(view.n_variadic_buffers):
+        addr = <uintptr_t>view.variadic_buffers[k]
+        if addr != 0 and addr not in seen:
+            seen.add(addr)
+            out += view.variadic_buffer_sizes[k]
+
+    for k in range(view.n_children):
+        out += _array_view_allocated_bytes(view.children[k], seen)
+
+    if view.dictionary != NULL:
+        out += _array_view_allocated_bytes(view.dictionary, seen)
+
+    return out
+
+
 cdef class ArrayView:
     """ArrowArrayView wrapper
 
@@ -560,6 +1584,259 @@ cdef class ArrayView:
     def schema(self):
         return self._schema
 
+    def to_numpy(self):
+        """Convert this view to a NumPy array
+
+        Null-free arrays of fixed-width numeric types are returned as a zero-copy
+        view of the data buffer (with the offset of this view applied) that keeps
+        this view alive. Boolean values are unpacked from their bitmap into a new
+        array. Arrays that contain nulls are returned as a ``numpy.ma.MaskedArray``
+        whose mask is unpacked from the validity bitmap.
+
+        Examples
+        --------
+
+        >>> import pyarrow as pa
+        >>> import nanoarrow as na
+        >>> na.array(pa.array([1, 2, 3], pa.int32())).view().to_numpy()
+        array([1, 2, 3], dtype=int32)
+        """
+        import numpy as np
+
+        cdef ArrowType storage_type = self._ptr.storage_type
+        cdef int64_t offset = self._ptr.offset
+        cdef int64_t length = self._ptr.length
+        cdef const uint8_t* validity = self._ptr.buffer_views[0].data.as_uint8
+
+        if storage_type == NANOARROW_TYPE_BOOL:
+            values = self._unpack_bits(self._ptr.buffer_views[1].data.as_uint8)
+        elif storage_type in _NUMPY_DTYPES:
+            dtype = np.dtype(_NUMPY_DTYPES[storage_type])
+            data = self.buffers[1]
+            if data is None:
+                values = np.empty(0, dtype)
+            else:
+                values = np.frombuffer(data, dtype)[offset:(offset + length)]
+        else:
+            type_str = ArrowTypeString(storage_type).decode("UTF-8")
+            raise TypeError(f"Can't convert array view of type '{type_str}' to numpy")
+
+        if validity == NULL or self._ptr.null_count == 0:
+            return values
+        elif (
+            self._ptr.null_count == -1
+            and ArrowBitCountSet(validity, offset, length) == length
+        ):
+            return values
+
+        mask = self._unpack_bits(validity)
+        np.logical_not(mask, out=mask)
+        return np.ma.MaskedArray(values, mask=mask)
+
+    cdef object _unpack_bits(self, const uint8_t* bits):
+        import numpy as np
+
+        out = np.empty(self._ptr.length, np.bool_)
+        cdef int8_t[::1] out_view = out.view(np.int8)
+        if self._ptr.length > 0:
+            ArrowBitsUnpackInt8(bits, self._ptr.offset, self._ptr.length, &out_view[0])
+        return out
+
+    def to_pandas_categorical(self):
+        """Convert this dictionary-encoded view to a ``pandas.Categorical``
+
+        See :class:`CategoricalConverter`, which can also reuse the categories of
+        a previous conversion for the views of a stream whose dictionary is
+        unchanged.
+
+        Examples
+        --------
+
+        >>> import pyarrow as pa
+        >>> import nanoarrow as na
+        >>> pa_array = pa.array(["a", "b", "a"]).dictionary_encode()
+        >>> na.array(pa_array).view().to_pandas_categorical()
+        ['a', 'b', 'a']
+        Categories (2, object): ['a', 'b']
+        """
+        return CategoricalConverter().convert(self)
+
+    @property
+    def nbytes(self):
+        """Number of buffer bytes referenced by this view
+
+        Only the range referenced by this view's offset and length is counted,
+        including the referenced ranges of child arrays. Dictionaries and the
+        variadic buffers of binary and string views are counted in full.
+        """
+        return _array_view_nbytes(self._ptr, 0, self._ptr.length)
+
+    def to_pylist(self):
+        """Convert this view to a list of Python objects
+
+        Values are converted in C-level loops: integers and floating point values
+        become ``int`` or ``float``, strings become ``str``, binary values become
+        ``bytes``, structs become ``dict`` objects, lists become ``list`` objects,
+        and nulls become ``None``. Dictionary-encoded and run-end encoded arrays
+        are decoded.
+
+        Examples
+        --------
+
+        >>> import pyarrow as pa
+        >>> import nanoarrow as na
+        >>> na.array(pa.array(["a", None, "c"])).view().to_pylist()
+        ['a', None, 'c']
+        """
+        return _array_view_to_pylist(self._ptr, self._schema._ptr, 0, self._ptr.length)
+
+    def __iter__(self):
+        cdef int64_t i = 0
+        cdef int64_t chunk
+        while i < self._ptr.length:
+            chunk = min(self._ptr.length - i, _PYLIST_CHUNK_SIZE)
+            yield from _array_view_to_pylist(self._ptr, self._schema._ptr, i, chunk)
+            i += chunk
+
+
+_NUMPY_DTYPES = {
+    NANOARROW_TYPE_UINT8: "uint8",
+    NANOARROW_TYPE_INT8: "int8",
+    NANOARROW_TYPE_UINT16: "uint16",
+    NANOARROW_TYPE_INT16: "int16",
+    NANOARROW_TYPE_UINT32: "uint32",
+    NANOARROW_TYPE_INT32: "int32",
+    NANOARROW_TYPE_UINT64: "uint64",
+    NANOARROW_TYPE_INT64: "int64",
+    NANOARROW_TYPE_HALF_FLOAT: "float16",
+    NANOARROW_TYPE_FLOAT: "float32",
+    NANOARROW_TYPE_DOUBLE: "float64",
+}
+
+
+cdef bint _array_view_buffers_equal(ArrowArrayView* lhs, ArrowArrayView* rhs):
+    # Only buffers referenced by the views are compared, such that views of
+    # identical values with distinct offsets or padding may compare as unequal
+    if (
+        lhs.storage_type != rhs.storage_type
+        or lhs.offset != rhs.offset
+        or lhs.length != rhs.length
+        or lhs.n_children != 0
+        or rhs.n_children != 0
+        or lhs.n_variadic_buffers != 0
+        or rhs.n_variadic_buffers != 0
+        or lhs.dictionary != NULL
+        or rhs.dictionary != NULL
+    ):
+        return False
+
+    cdef int64_t size_bytes
+    cdef int i
+    for i in range(3):
+        size_bytes = lhs.buffer_views[i].size_bytes
+        if size_bytes != rhs.buffer_views[i].size_bytes:
+            return False
+        if (
+            size_bytes > 0
+            and lhs.buffer_views[i].data.data != rhs.buffer_views[i].data.data
+            and memcmp(
+                lhs.buffer_views[i].data.data, rhs.buffer_views[i].data.data, size_bytes
+            ) != 0
+        ):
+            return False
+
+    return True
+
+
+cdef class CategoricalConverter:
+    """Convert dictionary-encoded ArrayViews to ``pandas.Categorical`` objects
+
+    The indices of a view are used as the codes of the result without copying
+    if they have no nulls and their type is the signed integer type that pandas
+    uses for the number of categories (e.g., int8 for fewer than 127
+    categories); otherwise, they are copied with nulls set to -1. Numeric
+    dictionaries are used as categories without copying and other
+    dictionaries are converted with :meth:`ArrayView.to_pylist`. A dictionary
+    that contains nulls is not supported.
+
+    The ``pandas.CategoricalDtype`` of the previous conversion (and therefore
+    its categories object) is reused if the dictionary of the next view has
+    the same buffers or buffer content, which is usually the case for the
+    batches of a stream.
+
+    Examples
+    --------
+
+    >>> import pyarrow as pa
+    >>> import nanoarrow as na
+    >>> pa_array = pa.array(["a", "b", "a"]).dictionary_encode()
+    >>> converter = na.CategoricalConverter()
+    >>> first = converter.convert(na.array(pa_array).view())
+    >>> second = converter.convert(na.array(pa_array.slice(1)).view())
+    >>> first.categories is second.categories
+    True
+    """
+    cdef ArrayView _dictionary
+    cdef object _dtype
+
+    def __cinit__(self):
+        self._dictionary = None
+        self._dtype = None
+
+    @property
+    def dtype(self):
+        """The ``pandas.CategoricalDtype`` of the previous conversion"""
+        return self._dtype
+
+    def convert(self, ArrayView view):
+        import numpy as np
+        import pandas as pd
+
+        if view._ptr.dictionary == NULL:
+            raise TypeError(
+                "Can't convert array view that is not dictionary-encoded "
+                "to pandas.Categorical"
+            )
+
+        cdef ArrayView dictionary = view.dictionary
+        ordered = (view._schema._ptr.flags & ARROW_FLAG_DICTIONARY_ORDERED) != 0
+        if (
+            self._dictionary is None
+            or self._dtype.ordered != ordered
+            or not _array_view_buffers_equal(self._dictionary._ptr, dictionary._ptr)
+        ):
+            if dictionary._ptr.storage_type in _NUMPY_DTYPES:
+                categories = dictionary.to_numpy()
+                has_nulls = isinstance(categories, np.ma.MaskedArray)
+            else:
+                categories = dictionary.to_pylist()
+                has_nulls = None in categories
+
+            if has_nulls:
+                raise ValueError(
+                    "Can't convert dictionary that contains nulls to pandas.Categorical"
+                )
+
+            self._dtype = pd.CategoricalDtype(pd.Index(categories), ordered=ordered)
+            self._dictionary = dictionary
+
+        codes = view.to_numpy()
+        if codes.dtype.kind == "u":
+            # Non-null indices are less than the length of the dictionary
+            signed = np.dtype(f"int{codes.dtype.itemsize * 8}")
+            if dictionary._ptr.length <= np.iinfo(signed).max:
+                codes = codes.view(signed)
+            else:
+                codes = codes.astype(np.int64)
+        if isinstance(codes, np.ma.MaskedArray):
+            codes = codes.filled(-1)
+
+        try:
+            return pd.Categorical.from_codes(codes, dtype=self._dtype, validate=False)
+        except TypeError:
+            # pandas < 2.1 always validates codes
+            return pd.Categorical.from_codes(codes, dtype=self._dtype)
+
 
 cdef class SchemaChildren:
     """Wrapper for a lazily-resolved list of Schema children
@@ -579,12 +1856,7 @@ cdef class SchemaChildren:
         if k < 0 or k >= self._length:
             raise IndexError(f"{k} out of range [0, {self._length})")
 
-        return Schema(self._parent, self._child_addr(k))
-
-    cdef _child_addr(self, int64_t i):
-        cdef ArrowSchema** children = self._parent._ptr.children
-        cdef ArrowSchema* child = children[i]
-        return <uintptr_t>child
+        return self._parent._child(k)
 
 
 cdef class SchemaMetadata:
@@ -636,12 +1908,7 @@ cdef class ArrayChildren:
         k = int(k)
         if k < 0 or k >= self._length:
             raise IndexError(f"{k} out of range [0, {self._length})")
-        return Array(self._parent, self._child_addr(k), self._parent.schema.children[k])
-
-    cdef _child_addr(self, int64_t i):
-        cdef ArrowArray** children = self._parent._ptr.children
-        cdef ArrowArray* child = children[i]
-        return <uintptr_t>child
+        return self._parent._child(k)
 
 
 cdef class ArrayViewChildren:
@@ -739,6 +2006,9 @@ cdef class BufferView:
             return "B"
 
     def __getbuffer__(self, Py_buffer *buffer, int flags):
+        if flags & PyBUF_WRITABLE:
+            raise BufferError("BufferView is read-only")
+
         buffer.buf = <void*>self._ptr.data.data
         buffer.format = self._get_format()
         buffer.internal = NULL
@@ -818,11 +2088,40 @@ cdef class ArrayStream:
     cdef ArrowArrayStream* _ptr
     cdef object _cached_schema
 
+    @staticmethod
+    def _import_from_c_capsule(stream_capsule):
+        """Import from an "arrow_array_stream" PyCapsule
+
+        The ArrowArrayStream is moved out of the capsule into a new ArrayStream.
+        """
+        cdef ArrowArrayStream* c_stream = <ArrowArrayStream*>PyCapsule_GetPointer(
+            stream_capsule, "arrow_array_stream"
+        )
+        cdef ArrayStream out = ArrayStream.allocate()
+        ArrowArrayStreamMove(c_stream, out._ptr)
+        return out
+
     def __cinit__(self, object base, uintptr_t addr):
         self._base = base
         self._ptr = <ArrowArrayStream*>addr
         self._cached_schema = None
 
+    def __arrow_c_stream__(self, requested_schema=None):
+        """Export to an "arrow_array_stream" PyCapsule
+
+        The ArrowArrayStream is moved into the capsule: this ArrayStream is
+        released afterwards and the consumer takes ownership of the stream.
+        """
+        self._assert_valid()
+        if requested_schema is not None:
+            raise NotImplementedError("requested_schema")
+
+        cdef ArrowArrayStream* c_stream_out
+        stream_capsule = _alloc_c_array_stream(&c_stream_out)
+        ArrowArrayStreamMove(self._ptr, c_stream_out)
+        self._cached_schema = None
+        return stream_capsule
+
     def _addr(self):
         return <uintptr_t>self._ptr
 
@@ -837,7 +2136,15 @@ cdef class ArrayStream:
 
     def _get_schema(self, Schema schema):
         self._assert_valid()
-        cdef int code = self._ptr.get_schema(self._ptr, schema._ptr)
+        cdef ArrowArrayStream* c_array_stream = self._ptr
+        cdef ArrowSchema* c_schema = schema._ptr
+        cdef ArrowArrayStreamGetSchemaFunc get_schema = (
+            <ArrowArrayStreamGetSchemaFunc>c_array_stream.get_schema
+        )
+        cdef int code
+        with nogil:
+            code = get_schema(c_array_stream, c_schema)
+
         cdef const char* message = NULL
         if code != NANOARROW_OK:
             message = self._ptr.get_last_error(self._ptr)
@@ -875,7 +2182,15 @@ cdef class ArrayStream:
             self._get_schema(self._cached_schema)
 
         cdef Array array = Array.allocate(self._cached_schema)
-        cdef int code = self._ptr.get_next(self._ptr, array._ptr)
+        cdef ArrowArrayStream* c_array_stream = self._ptr
+        cdef ArrowArray* c_array = array._ptr
+        cdef ArrowArrayStreamGetNextFunc get_next = (
+            <ArrowArrayStreamGetNextFunc>c_array_stream.get_next
+        )
+        cdef int code
+        with nogil:
+            code = get_next(c_array_stream, c_array)
+
         cdef const char* message = NULL
         if code != NANOARROW_OK:
             message = self._ptr.get_last_error(self._ptr)
@@ -899,7 +2214,112 @@ cdef class ArrayStream:
     def __next__(self):
         return self.get_next()
 
+    def iter_async(self, readahead=1):
+        """Iterate over the Arrays in this stream from an asyncio event loop
+
+        Returns an asynchronous iterator that calls ``get_next()`` in a worker thread
+        (which releases the GIL while the stream's callback runs) such that waiting
+        for the next Array does not block the event loop. Up to ``readahead`` Arrays
+        are read before they are requested. The stream must not be used by anything
+        else until iteration is complete or the iterator is closed with ``aclose()``.
+
+        Examples
+        --------
+
+        >>> import asyncio
+        >>> import pyarrow as pa
+        >>> import nanoarrow as na
+        >>> pa_batch = pa.record_batch([pa.array([1, 2, 3])], names=["col1"])
+        >>> pa_reader = pa.RecordBatchReader.from_batches(pa_batch.schema, [pa_batch])
+        >>> array_stream = na.array_stream(pa_reader)
+        >>> async def lengths():
+        ...     return [array.length async for array in array_stream]
+        >>> asyncio.run(lengths())
+        [3]
+        """
+        return ArrayStreamAsyncIterator(self, readahead)
+
+    def __aiter__(self):
+        return self.iter_async()
+
     @staticmethod
     def allocate():
         base = ArrayStreamHolder()
         return ArrayStream(base, base._addr())
+
+
+class ArrayStreamAsyncIterator:
+    """Asynchronous iterator over the Arrays of an ArrayStream
+
+    These objects are usually created using ``ArrayStream.iter_async()``. A worker
+    thread is started when the first Array is requested and puts each Array (or
+    exception) into a queue of ``readahead`` items that is consumed from the event
+    loop.
+    """
+
+    def __init__(self, array_stream, readahead=1):
+        if readahead < 1:
+            raise ValueError("readahead must be greater than or equal to 1")
+
+        self._array_stream = array_stream
+        self._readahead = readahead
+        self._queue = None
+        self._thread = None
+        self._finished = False
+        self._closed = threading.Event()
+
+    def __aiter__(self):
+        return self
+
+    async def __anext__(self):
+        if self._finished:
+            raise StopAsyncIteration()
+
+        if self._thread is None:
+            self._queue = asyncio.Queue(self._readahead)
+            self._thread = threading.Thread(
+                target=self._read_all, args=(asyncio.get_running_loop(),), daemon=True
+            )
+            self._thread.start()
+
+        array, exception = await self._queue.get()
+        if exception is not None:
+            self._finished = True
+            raise exception
+        elif array is None:
+            self._finished = True
+            raise StopAsyncIteration()
+        else:
+            return array
+
+    async def aclose(self):
+        """Stop reading from the stream
+
+        The worker thread exits after the Array it is currently reading (if any)
+        is complete.
+        """
+        self._finished = True
+        self._closed.set()
+        if self._queue is not None:
+            while not self._queue.empty():
+                self._queue.get_nowait()
+
+    def _read_all(self, loop):
+        while not self._closed.is_set():
+            try:
+                item = (self._array_stream.get_next(), None)
+            except StopIteration:
+                item = (None, None)
+            except Exception as e:
+                item = (None, e)
+
+            # Waits for space in the queue (i.e., until fewer than readahead Arrays
+            # are waiting to be consumed)
+            try:
+                asyncio.run_coroutine_threadsafe(self._queue.put(item), loop).result()
+            except Exception:
+                # e.g., the event loop was closed
+                return
+
+            if item[0] is None:
+                return
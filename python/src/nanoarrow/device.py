@@ -0,0 +1,48 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+from ._device_lib import DeviceArray, device_array_from_array
+from ._lib import Schema
+from .lib import array
+
+
+def device_array(obj):
+    """Convert an object to a nanoarrow.device.DeviceArray
+
+    Objects that can export an ArrowDeviceArray (e.g., a ``pyarrow.Array`` whose
+    buffers are on a GPU) are imported as is. Other objects are converted using
+    :func:`nanoarrow.array` and wrapped as an array on the CPU without copying.
+
+    Examples
+    --------
+
+    >>> import numpy as np
+    >>> import pyarrow as pa
+    >>> from nanoarrow import device
+    >>> device_array = device.device_array(pa.array([1, 2, 3], pa.int32()))
+    >>> np.from_dlpack(device_array)
+    array([1, 2, 3], dtype=int32)
+    """
+    if isinstance(obj, DeviceArray):
+        return obj
+
+    if hasattr(obj, "_export_to_c_device"):
+        out = DeviceArray.allocate(Schema.allocate())
+        obj._export_to_c_device(out._addr(), out.schema._addr())
+        return out
+
+    return device_array_from_array(array(obj))
@@ -0,0 +1,152 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+import mmap
+import os
+import threading
+
+from ._ipc_lib import array_stream_from_buffer, array_stream_from_readable
+
+
+def array_stream(obj):
+    """Read an Arrow IPC stream as a nanoarrow.ArrayStream
+
+    ``obj`` can be an object implementing the Python buffer protocol (e.g., bytes,
+    memoryview, or mmap.mmap), a file-like object with a ``read()`` method, or a
+    path to a file. Buffers are decoded in place such that the arrays returned by
+    the stream reference their content without copying it. Files referred to by
+    path are memory-mapped where possible and decoded in the same way.
+
+    Examples
+    --------
+
+    >>> import pyarrow as pa
+    >>> import nanoarrow as na
+    >>> from nanoarrow import ipc
+    >>> pa_batch = pa.record_batch([pa.array([1, 2, 3])], names=["col1"])
+    >>> sink = pa.BufferOutputStream()
+    >>> with pa.ipc.new_stream(sink, pa_batch.schema) as writer:
+    ...     writer.write_batch(pa_batch)
+    >>> array_stream = ipc.array_stream(sink.getvalue())
+    >>> array_stream.get_next().length
+    3
+    """
+    if isinstance(obj, (str, os.PathLike)):
+        with open(obj, "rb") as f:
+            try:
+                mapped = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+            except (ValueError, OSError):
+                # Empty files and some special files can't be mapped
+                return array_stream_from_buffer(f.read())
+
+        return array_stream_from_buffer(mapped)
+
+    try:
+        memoryview(obj)
+    except TypeError:
+        pass
+    else:
+        return array_stream_from_buffer(obj)
+
+    if hasattr(obj, "read"):
+        return array_stream_from_readable(obj)
+
+    raise TypeError(
+        f"Can't read Arrow IPC stream from object of type {type(obj).__name__}"
+    )
+
+
+class _FedInput:
+    # The input of a StreamDecoder, which the stream keeps alive (this object must not
+    # reference the stream to avoid a reference cycle through the C stream)
+
+    def __init__(self):
+        self.pending = bytearray()
+        self.eof = False
+        self.condition = threading.Condition()
+
+    def read(self, n):
+        # Called by the stream (with the GIL held) to read up to n bytes: waits until
+        # some are available or the end of the input was fed
+        with self.condition:
+            while not self.pending and not self.eof:
+                self.condition.wait()
+
+            chunk = bytes(self.pending[:n])
+            del self.pending[:n]
+            return chunk
+
+
+class StreamDecoder:
+    """Decode an Arrow IPC stream from bytes that arrive incrementally
+
+    Bytes are passed to ``feed()`` as they arrive (e.g., from an asyncio socket) and
+    ``feed_eof()`` is called at the end of the input. The Arrays of the stream are
+    read from ``array_stream``, whose ``get_next()`` waits for enough bytes to decode
+    the next message. From an event loop, iterate over the decoder (or
+    ``array_stream.iter_async()``) such that waiting happens in a worker thread.
+    Message bodies are copied out of the fed bytes.
+
+    Examples
+    --------
+
+    >>> import asyncio
+    >>> import pyarrow as pa
+    >>> from nanoarrow import ipc
+    >>> pa_batch = pa.record_batch([pa.array([1, 2, 3])], names=["col1"])
+    >>> sink = pa.BufferOutputStream()
+    >>> with pa.ipc.new_stream(sink, pa_batch.schema) as writer:
+    ...     writer.write_batch(pa_batch)
+    >>> content = sink.getvalue().to_pybytes()
+    >>> async def lengths():
+    ...     decoder = ipc.StreamDecoder()
+    ...     for i in range(0, len(content), 100):
+    ...         decoder.feed(content[i:(i + 100)])
+    ...     decoder.feed_eof()
+    ...     return [array.length async for array in decoder]
+    >>> asyncio.run(lengths())
+    [3]
+    """
+
+    def __init__(self):
+        self._input = _FedInput()
+        self._array_stream = array_stream_from_readable(self._input)
+
+    @property
+    def array_stream(self):
+        return self._array_stream
+
+    def feed(self, data):
+        """Append bytes to the input of the stream"""
+        with self._input.condition:
+            if self._input.eof:
+                raise ValueError("Can't feed() a StreamDecoder after feed_eof()")
+
+            self._input.pending += data
+            self._input.condition.notify_all()
+
+    def feed_eof(self):
+        """Signal that all bytes of the input have been fed"""
+        with self._input.condition:
+            self._input.eof = True
+            self._input.condition.notify_all()
+
+    def iter_async(self, readahead=1):
+        return self._array_stream.iter_async(readahead)
+
+    def __aiter__(self):
+        return self.iter_async()
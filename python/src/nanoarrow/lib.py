@@ -15,6 +15,8 @@
 # specific language governing permissions and limitations
 # under the License.
 
+import sys
+
 from ._lib import Array, ArrayStream, Schema
 
 
@@ -22,9 +24,12 @@ def schema(obj):
     if isinstance(obj, Schema):
         return obj
 
+    if hasattr(obj, "__arrow_c_schema__"):
+        return Schema._import_from_c_capsule(obj.__arrow_c_schema__())
+
     # Not particularly safe because _export_to_c() could be exporting an
-    # array, schema, or array_stream. The ideal
-    # solution here would be something like __arrow_c_schema__()
+    # array, schema, or array_stream. Only used for objects that do not
+    # implement the Arrow PyCapsule interface.
     if hasattr(obj, "_export_to_c"):
         out = Schema.allocate()
         obj._export_to_c(out._addr())
@@ -39,9 +44,17 @@ def array(obj):
     if isinstance(obj, Array):
         return obj
 
+    if hasattr(obj, "__arrow_c_array__"):
+        return Array._import_from_c_capsule(*obj.__arrow_c_array__())
+
+    # Only checked if pandas was already imported by the caller
+    pd = sys.modules.get("pandas")
+    if pd is not None and isinstance(obj, pd.Categorical):
+        return Array.from_pandas_categorical(obj)
+
     # Somewhat safe because calling _export_to_c() with two arguments will
-    # not fail with a crash (but will fail with a confusing error). The ideal
-    # solution here would be something like __arrow_c_array__()
+    # not fail with a crash (but will fail with a confusing error). Only used
+    # for objects that do not implement the Arrow PyCapsule interface.
     if hasattr(obj, "_export_to_c"):
         out = Array.allocate(Schema.allocate())
         obj._export_to_c(out._addr(), out.schema._addr())
@@ -53,12 +66,15 @@ def array(obj):
 
 
 def array_stream(obj):
-    if isinstance(obj, Schema):
+    if isinstance(obj, ArrayStream):
         return obj
 
+    if hasattr(obj, "__arrow_c_stream__"):
+        return ArrayStream._import_from_c_capsule(obj.__arrow_c_stream__())
+
     # Not particularly safe because _export_to_c() could be exporting an
-    # array, schema, or array_stream. The ideal
-    # solution here would be something like __arrow_c_array_stream__()
+    # array, schema, or array_stream. Only used for objects that do not
+    # implement the Arrow PyCapsule interface.
     if hasattr(obj, "_export_to_c"):
         out = ArrayStream.allocate()
         obj._export_to_c(out._addr())
@@ -68,3 +84,25 @@ def array_stream(obj):
             f"Can't convert object of type {type(obj).__name__} "
             "to nanoarrow.ArrowArrayStream"
         )
+
+
+def array_from_iterable(obj, schema=None):
+    """Create a nanoarrow.Array from a Python iterable
+
+    See :meth:`nanoarrow.Array.from_iterable`. ``schema`` may be anything
+    accepted by :func:`nanoarrow.schema`.
+
+    Examples
+    --------
+
+    >>> import nanoarrow as na
+    >>> na.array_from_iterable(["a", None, "c"]).view().to_pylist()
+    ['a', None, 'c']
+    """
+    if schema is not None:
+        schema = _as_schema(schema)
+    return Array.from_iterable(obj, schema)
+
+
+# The schema argument of array_from_iterable() shadows schema()
+_as_schema = schema
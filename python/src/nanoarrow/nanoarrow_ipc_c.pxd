@@ -0,0 +1,47 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+# cython: language_level = 3
+
+# Unlike nanoarrow_c.pxd, these declarations are not generated: they cover only
+# the subset of nanoarrow_ipc.h used by _ipc_lib.pyx
+
+from libc.stdint cimport uint8_t, int64_t
+from nanoarrow_c cimport *
+
+cdef extern from "nanoarrow_ipc.h" nogil:
+
+    struct ArrowIpcInputStream:
+        ArrowErrorCode (*read)(ArrowIpcInputStream* stream, uint8_t* buf,
+                               int64_t buf_size_bytes, int64_t* size_read_out,
+                               ArrowError* error) noexcept
+        void (*release)(ArrowIpcInputStream* stream) noexcept
+        void* private_data
+
+    struct ArrowIpcArrayStreamReaderOptions:
+        int64_t field_index
+        int use_shared_buffers
+
+    int ArrowIpcSharedBufferIsThreadSafe()
+    ArrowErrorCode ArrowIpcInputStreamInitBuffer(ArrowIpcInputStream* stream,
+                                                 ArrowBuffer* input)
+    void ArrowIpcArrayStreamReaderOptionsInit(ArrowIpcArrayStreamReaderOptions* options)
+    ArrowErrorCode ArrowIpcArrayStreamReaderInit(
+        ArrowArrayStream* out,
+        ArrowIpcInputStream* input_stream,
+        ArrowIpcArrayStreamReaderOptions* options
+    )
@@ -0,0 +1,86 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+import numpy as np
+import pyarrow as pa
+import pytest
+
+import nanoarrow as na
+from nanoarrow import device
+
+requires_from_dlpack = pytest.mark.skipif(
+    not hasattr(np, "from_dlpack"), reason="numpy does not implement from_dlpack()"
+)
+
+
+def test_device_array_cpu():
+    device_array = device.device_array(pa.array([1, 2, 3], pa.int32()))
+    assert device_array.is_valid()
+    assert device_array.device_type == 1
+    assert device_array.device_id == 0
+    assert device_array.__dlpack_device__() == (1, 0)
+    assert device_array.array.length == 3
+    assert device_array.schema.format == "i"
+    assert device.device_array(device_array) is device_array
+
+
+def test_device_array_shares_buffers():
+    array = na.Array.from_buffer(np.array([1, 2, 3], np.int64))
+    device_array = device.device_array(array)
+    assert device_array.array.buffers == array.buffers
+
+    # The device array keeps the original alive
+    del array
+    assert device_array.array.view().to_pylist() == [1, 2, 3]
+
+
+@requires_from_dlpack
+def test_device_array_dlpack():
+    data = np.array([1.5, 2.5, 3.5])
+    device_array = device.device_array(na.Array.from_buffer(data))
+    out = np.from_dlpack(device_array)
+    np.testing.assert_array_equal(out, data)
+
+    # No copy: the result points into the exported buffer
+    assert out.ctypes.data == data.ctypes.data
+
+    # The tensor keeps the device array alive
+    del device_array
+    np.testing.assert_array_equal(out, data)
+
+
+@requires_from_dlpack
+def test_device_array_dlpack_offset():
+    pa_array = pa.array([1, 2, 3, 4], pa.int16())[1:]
+    out = np.from_dlpack(device.device_array(pa_array))
+    assert out.dtype == np.int16
+    np.testing.assert_array_equal(out, [2, 3, 4])
+
+
+def test_device_array_dlpack_errors():
+    with pytest.raises(TypeError, match="Can't export array of type 'string'"):
+        device.device_array(pa.array(["a"])).__dlpack__()
+
+    with pytest.raises(TypeError, match="Can't export array of type 'bool'"):
+        device.device_array(pa.array([True])).__dlpack__()
+
+    with pytest.raises(ValueError, match="may contain nulls"):
+        device.device_array(pa.array([1, None], pa.int32())).__dlpack__()
+
+    # A validity buffer without nulls does not prevent the export
+    pa_array = pa.array([1, None, 3], pa.int32())[2:]
+    device.device_array(pa_array).__dlpack__()
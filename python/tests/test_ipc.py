@@ -0,0 +1,155 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+import io
+import mmap
+
+import numpy as np
+import pyarrow as pa
+import pytest
+
+import nanoarrow as na
+from nanoarrow import ipc
+
+
+def make_ipc_stream():
+    pa_batch = pa.record_batch(
+        [pa.array(np.arange(1000, dtype=np.int32)), pa.array(["abc"] * 1000)],
+        names=["some_ints", "some_strings"],
+    )
+    sink = pa.BufferOutputStream()
+    with pa.ipc.new_stream(sink, pa_batch.schema) as writer:
+        writer.write_batch(pa_batch)
+        writer.write_batch(pa_batch)
+
+    return pa_batch, sink.getvalue().to_pybytes()
+
+
+def check_array_stream(array_stream, pa_batch):
+    assert isinstance(array_stream, na.ArrayStream)
+    assert array_stream.get_schema().format == "+s"
+
+    batches = list(array_stream)
+    assert len(batches) == 2
+    for batch in batches:
+        pa_imported = pa.RecordBatch._import_from_c(batch._addr(), batch.schema._addr())
+        assert pa_imported.equals(pa_batch)
+
+
+def test_ipc_array_stream_bytes():
+    pa_batch, data = make_ipc_stream()
+    check_array_stream(ipc.array_stream(data), pa_batch)
+    check_array_stream(ipc.array_stream(memoryview(data)), pa_batch)
+    check_array_stream(ipc.array_stream(bytearray(data)), pa_batch)
+
+
+def test_ipc_array_stream_zero_copy():
+    _, data = make_ipc_stream()
+    data = bytearray(data)
+    array_stream = ipc.array_stream(data)
+    array = array_stream.get_next()
+    del array_stream
+
+    # Arrays reference the input, which keeps it from being resized
+    values = array.view().children[0].to_numpy()
+    np.testing.assert_array_equal(values, np.arange(1000, dtype=np.int32))
+    if np.shares_memory(values, np.frombuffer(data, np.uint8)):
+        with pytest.raises(BufferError):
+            data.extend(b"more")
+
+
+def test_ipc_array_stream_readable():
+    pa_batch, data = make_ipc_stream()
+    check_array_stream(ipc.array_stream(io.BytesIO(data)), pa_batch)
+
+    # Short reads are tolerated
+    class Trickle:
+        def __init__(self, data):
+            self._data = io.BytesIO(data)
+
+        def read(self, n):
+            return self._data.read(min(n, 7))
+
+    check_array_stream(ipc.array_stream(Trickle(data)), pa_batch)
+
+
+def test_ipc_array_stream_readable_error():
+    class Broken:
+        def read(self, n):
+            raise OSError("this is a read error")
+
+    array_stream = ipc.array_stream(Broken())
+    with pytest.raises(na._lib.NanoarrowException, match="this is a read error"):
+        array_stream.get_schema()
+
+
+
+def test_ipc_stream_decoder():
+    import asyncio
+
+    pa_batch, data = make_ipc_stream()
+
+    # Arrays can be read before all of the input was fed
+    async def feed_and_read():
+        decoder = ipc.StreamDecoder()
+
+        async def feed():
+            for i in range(0, len(data), 1000):
+                decoder.feed(data[i : (i + 1000)])
+                await asyncio.sleep(0)
+            decoder.feed_eof()
+
+        feed_task = asyncio.create_task(feed())
+        batches = [batch async for batch in decoder]
+        await feed_task
+        return batches
+
+    batches = asyncio.run(feed_and_read())
+    assert len(batches) == 2
+    for batch in batches:
+        pa_imported = pa.RecordBatch._import_from_c(batch._addr(), batch.schema._addr())
+        assert pa_imported.equals(pa_batch)
+
+    # The array stream can also be consumed synchronously
+    decoder = ipc.StreamDecoder()
+    decoder.feed(data)
+    decoder.feed_eof()
+    check_array_stream(decoder.array_stream, pa_batch)
+
+    with pytest.raises(ValueError, match="after feed_eof"):
+        decoder.feed(b"more")
+
+def test_ipc_array_stream_path_and_mmap(tmp_path):
+    pa_batch, data = make_ipc_stream()
+    path = tmp_path / "stream.arrows"
+    path.write_bytes(data)
+
+    check_array_stream(ipc.array_stream(path), pa_batch)
+    check_array_stream(ipc.array_stream(str(path)), pa_batch)
+
+    with open(path, "rb") as f:
+        mapped = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+    check_array_stream(ipc.array_stream(mapped), pa_batch)
+
+
+def test_ipc_array_stream_errors():
+    with pytest.raises(TypeError, match="Can't read Arrow IPC stream from object"):
+        ipc.array_stream(None)
+
+    array_stream = ipc.array_stream(b"\x01\x02\x03")
+    with pytest.raises(na._lib.NanoarrowException):
+        array_stream.get_schema()
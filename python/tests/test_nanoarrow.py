@@ -89,6 +89,32 @@ def test_schema_metadata():
     assert list(meta2.values()) == [b"value1", b"value2"]
 
 
+def test_schema_cached_wrappers():
+    schema = na.schema(pa.schema([pa.field("col1", pa.int32())]))
+    assert schema.view() is schema.view()
+    assert schema.children[0] is schema.children[0]
+
+    # Children keep the schema's memory alive without referencing the parent
+    child = schema.children[0]
+    del schema
+    assert child.name == "col1"
+
+
+def test_schema_describe_fields():
+    pa_schema = pa.schema(
+        [
+            pa.field("col1", pa.int32(), nullable=False),
+            pa.field("col2", pa.struct([pa.field("x", pa.string())])),
+        ]
+    )
+    fields = na.schema(pa_schema).describe_fields()
+    assert fields["depth"] == [0, 1, 1, 2]
+    assert fields["name"] == ["", "col1", "col2", "x"]
+    assert fields["type"] == ["struct", "int32", "struct", "string"]
+    assert fields["flags"][1] == 0
+    assert fields["flags"][3] == 2
+
+
 def test_schema_view():
     schema = na.Schema.allocate()
     with pytest.raises(RuntimeError):
@@ -165,6 +191,149 @@ def test_array():
         array.children[1]
 
 
+def test_array_cached_children():
+    pa_batch = pa.record_batch([pa.array([1, 2, 3], pa.int32())], names=["col"])
+    array = na.array(pa_batch)
+    assert array.children[0] is array.children[0]
+    assert array.children[0].schema is array.schema.children[0]
+
+    child = array.children[0]
+    del array
+    assert child.length == 3
+
+
+def test_array_from_buffer():
+    data_types = [
+        (np.uint8(), "C"),
+        (np.int8(), "c"),
+        (np.uint16(), "S"),
+        (np.int16(), "s"),
+        (np.uint32(), "I"),
+        (np.int32(), "i"),
+        (np.uint64(), "L"),
+        (np.int64(), "l"),
+        (np.float16(), "e"),
+        (np.float32(), "f"),
+        (np.float64(), "g"),
+    ]
+
+    for np_type, format in data_types:
+        values = np.array([0, 1, 2], np_type)
+        array = na.Array.from_buffer(values)
+        assert array.schema.format == format
+        assert array.length == 3
+        assert array.null_count == 0
+        assert array.buffers[0] == 0
+
+        # The data buffer references the content of values
+        assert array.buffers[1] == values.ctypes.data
+        np.testing.assert_array_equal(array.view().to_numpy(), values)
+
+
+def test_array_from_buffer_keeps_object_alive():
+    values = np.array([1, 2, 3], np.int32)
+    array = na.Array.from_buffer(values)
+    del values
+
+    np.testing.assert_array_equal(
+        array.view().to_numpy(), np.array([1, 2, 3], np.int32)
+    )
+
+
+def test_array_from_buffer_mask():
+    values = np.array([1, 2, 3, 4, 5, 6, 7, 8, 9], np.int32)
+    mask = np.array([False, True, False, False, False, False, False, False, True])
+    array = na.Array.from_buffer(values, mask=mask)
+    assert array.null_count == 2
+    assert pa.array(values, mask=mask).equals(pa_array_from_na(array))
+
+    # An all-valid mask does not create a validity bitmap
+    array = na.Array.from_buffer(values, mask=np.zeros(9, np.bool_))
+    assert array.null_count == 0
+    assert array.buffers[0] == 0
+
+    with pytest.raises(ValueError, match="Expected mask of 9 bytes but got 2 bytes"):
+        na.Array.from_buffer(values, mask=np.zeros(2, np.bool_))
+
+
+def test_array_from_buffer_errors():
+    with pytest.raises(TypeError, match="Can't create Array from buffer with format"):
+        na.Array.from_buffer(np.array([True, False]))
+
+    with pytest.raises(ValueError, match="Expected one-dimensional buffer"):
+        na.Array.from_buffer(np.zeros((2, 2), np.int32))
+
+    with pytest.raises(TypeError):
+        na.Array.from_buffer(None)
+
+
+def pa_array_from_na(array):
+    return pa.Array._import_from_c(array._addr(), array.schema._addr())
+
+
+def test_array_from_iterable():
+    array = na.Array.from_iterable([1, None, 3])
+    assert array.schema.format == "l"
+    assert array.null_count == 1
+    assert array.view().to_pylist() == [1, None, 3]
+
+    for values in [[1.5, None], [True, None, False], ["a", None, "é"]]:
+        assert na.Array.from_iterable(values).view().to_pylist() == values
+
+    # Any iterable is accepted
+    array = na.Array.from_iterable(x for x in [b"ab", None])
+    assert array.view().to_pylist() == [b"ab", None]
+
+    array = na.Array.from_iterable([None, None])
+    assert array.schema.format == "n"
+    assert array.length == 2
+
+
+def test_array_from_iterable_schema():
+    array = na.array_from_iterable([1, 2, None], pa.int8())
+    assert array.schema.format == "c"
+    assert pa_array_from_na(array).to_pylist() == [1, 2, None]
+
+    array = na.array_from_iterable([2**64 - 1], pa.uint64())
+    assert array.view().to_pylist() == [2**64 - 1]
+
+    array = na.array_from_iterable([1, 2.5], pa.float32())
+    assert array.view().to_pylist() == [1.0, 2.5]
+
+    array = na.array_from_iterable(["abc"], pa.large_string())
+    assert array.schema.format == "U"
+
+    with pytest.raises(na._lib.NanoarrowException):
+        na.array_from_iterable([1000], pa.int8())
+
+    with pytest.raises(TypeError):
+        na.array_from_iterable(["a"], pa.int32())
+
+    with pytest.raises(TypeError, match="Can't create Array of type 'decimal128'"):
+        na.array_from_iterable([1], pa.decimal128(10, 2))
+
+
+def test_array_from_iterable_buffer():
+    data = np.array([1, 2, 3], np.int32)
+    array = na.Array.from_iterable(data)
+    assert array.schema.format == "i"
+    np.testing.assert_array_equal(array.view().to_numpy(), data)
+
+    # The content is copied
+    data[0] = 100
+    assert array.view().to_pylist() == [1, 2, 3]
+
+    # A buffer whose format does not match the schema is iterated over
+    array = na.array_from_iterable(np.array([1, 2], np.int32), pa.int64())
+    assert array.schema.format == "l"
+    assert array.view().to_pylist() == [1, 2]
+
+
+def test_array_from_iterable_infer_error():
+    with pytest.raises(TypeError, match="Can't infer Arrow type"):
+        na.Array.from_iterable([object()])
+
+
 def test_array_view():
     array = na.array(pa.array([1, 2, 3], pa.int32()))
     view = array.view()
@@ -241,6 +410,256 @@ def test_buffers_data():
         )
 
 
+def test_array_view_to_numpy():
+    data_types = [
+        (pa.uint8(), np.uint8()),
+        (pa.int8(), np.int8()),
+        (pa.uint16(), np.uint16()),
+        (pa.int16(), np.int16()),
+        (pa.uint32(), np.uint32()),
+        (pa.int32(), np.int32()),
+        (pa.uint64(), np.uint64()),
+        (pa.int64(), np.int64()),
+        (pa.float16(), np.float16()),
+        (pa.float32(), np.float32()),
+        (pa.float64(), np.float64()),
+    ]
+
+    for pa_type, np_type in data_types:
+        pa_array = pa.array(np.array([0, 1, 2, 3], np_type), pa_type)
+        view = na.array(pa_array.slice(1, 2)).view()
+        values = view.to_numpy()
+        assert not isinstance(values, np.ma.MaskedArray)
+        assert values.dtype == np_type
+        assert values.flags.writeable is False
+        np.testing.assert_array_equal(values, np.array([1, 2], np_type))
+
+        # Null-free values are not copied
+        data = np.frombuffer(view.buffers[1], np_type)
+        assert np.shares_memory(values, data)
+
+
+def test_array_view_to_numpy_nulls():
+    pa_array = pa.array([0, None, 2, 3, None], pa.int32())
+    values = na.array(pa_array.slice(1)).view().to_numpy()
+    assert isinstance(values, np.ma.MaskedArray)
+    np.testing.assert_array_equal(values.mask, [True, False, False, True])
+    np.testing.assert_array_equal(values.compressed(), np.array([2, 3], np.int32))
+
+    # A slice without nulls of an array with nulls is not masked
+    values = na.array(pa_array.slice(2, 2)).view().to_numpy()
+    assert not isinstance(values, np.ma.MaskedArray)
+    np.testing.assert_array_equal(values, np.array([2, 3], np.int32))
+
+
+def test_array_view_to_numpy_bool():
+    bools = [True, False, True, True, False, False, True, False, True, True]
+    pa_array = pa.array(bools)
+    values = na.array(pa_array.slice(3)).view().to_numpy()
+    assert values.dtype == np.bool_
+    np.testing.assert_array_equal(values, np.array(bools[3:]))
+
+    values = na.array(pa.array([True, None, False])).view().to_numpy()
+    assert isinstance(values, np.ma.MaskedArray)
+    np.testing.assert_array_equal(values.mask, [False, True, False])
+    np.testing.assert_array_equal(values.compressed(), [True, False])
+
+    values = na.array(pa.array([], pa.bool_())).view().to_numpy()
+    assert len(values) == 0
+
+
+def test_array_view_to_numpy_unsupported():
+    view = na.array(pa.array(["abc"])).view()
+    with pytest.raises(TypeError, match="Can't convert array view of type 'string'"):
+        view.to_numpy()
+
+
+def test_array_view_to_pandas_categorical():
+    pytest.importorskip("pandas")
+
+    # int8 indices are used as codes without copying
+    pa_array = pa.DictionaryArray.from_arrays(
+        pa.array([0, 1, 0, 2], pa.int8()), pa.array(["a", "b", "c"])
+    )
+    view = na.array(pa_array).view()
+    categorical = view.to_pandas_categorical()
+    assert list(categorical) == ["a", "b", "a", "c"]
+    assert list(categorical.categories) == ["a", "b", "c"]
+    assert categorical.ordered is False
+    codes = np.frombuffer(view.buffers[1], np.int8)
+    assert np.shares_memory(categorical.codes, codes)
+
+    # Null indices become codes of -1; unsigned and ordered dictionaries
+    pa_array = pa.DictionaryArray.from_arrays(
+        pa.array([2, None, 0], pa.uint32()), pa.array([1.5, 2.5, 3.5]), ordered=True
+    )
+    categorical = na.array(pa_array).view().to_pandas_categorical()
+    np.testing.assert_array_equal(categorical.codes, [2, -1, 0])
+    np.testing.assert_array_equal(categorical.categories, [1.5, 2.5, 3.5])
+    assert categorical.ordered is True
+
+    with pytest.raises(TypeError, match="not dictionary-encoded"):
+        na.array(pa.array([1, 2, 3])).view().to_pandas_categorical()
+
+    pa_array = pa.DictionaryArray.from_arrays(
+        pa.array([0, 1], pa.int8()), pa.array(["a", None])
+    )
+    with pytest.raises(ValueError, match="dictionary that contains nulls"):
+        na.array(pa_array).view().to_pandas_categorical()
+
+
+def test_categorical_converter_reuses_categories():
+    pytest.importorskip("pandas")
+
+    dictionary = pa.array(["a", "b", "c"])
+    batches = [
+        pa.DictionaryArray.from_arrays(pa.array([0, 1], pa.int32()), dictionary),
+        pa.DictionaryArray.from_arrays(pa.array([2, 2], pa.int32()), dictionary),
+        # Identical content in a different buffer
+        pa.DictionaryArray.from_arrays(
+            pa.array([1], pa.int32()), pa.array(["a", "b", "c"])
+        ),
+        pa.DictionaryArray.from_arrays(
+            pa.array([1], pa.int32()), pa.array(["a", "b", "d"])
+        ),
+    ]
+
+    converter = na.CategoricalConverter()
+    results = [converter.convert(na.array(batch).view()) for batch in batches]
+    assert results[1].categories is results[0].categories
+    assert results[2].categories is results[0].categories
+    assert results[3].categories is not results[0].categories
+    assert list(results[3]) == ["b"]
+    assert converter.dtype is results[3].dtype
+
+
+def test_array_from_pandas_categorical():
+    pd = pytest.importorskip("pandas")
+
+    categorical = pd.Categorical(["b", None, "a", "b"], categories=["b", "a"])
+    array = na.array(categorical)
+    assert array.schema.format == "c"
+    assert array.schema.dictionary.format == "u"
+    assert array.null_count == 1
+    assert array.view().to_pylist() == ["b", None, "a", "b"]
+
+    # Codes and numeric categories are not copied
+    categorical = pd.Categorical([10, 20, 10], ordered=True)
+    array = na.Array.from_pandas_categorical(categorical)
+    assert array.schema.flags & 1
+    codes = np.frombuffer(array.view().buffers[1], np.int8)
+    assert np.shares_memory(codes, categorical.codes)
+    categories = np.frombuffer(array.dictionary.view().buffers[1], np.int64)
+    assert np.shares_memory(categories, categorical.categories.to_numpy())
+
+    # Round trip
+    result = array.view().to_pandas_categorical()
+    assert list(result) == [10, 20, 10]
+    assert result.ordered is True
+
+
+def test_array_view_to_pylist_primitive():
+    for pa_type in [pa.int8(), pa.uint16(), pa.int32(), pa.int64(), pa.float64()]:
+        pa_array = pa.array([1, None, 3], pa_type)
+        assert na.array(pa_array).view().to_pylist() == pa_array.to_pylist()
+
+    pa_array = pa.array([True, False, None, True])
+    assert na.array(pa_array).view().to_pylist() == [True, False, None, True]
+
+    pa_array = pa.array([2**64 - 1, 0], pa.uint64())
+    assert na.array(pa_array).view().to_pylist() == [2**64 - 1, 0]
+
+    assert na.array(pa.array([None, None])).view().to_pylist() == [None, None]
+
+
+def test_array_view_to_pylist_string_binary():
+    pa_array = pa.array(["abc", None, "é"])
+    assert na.array(pa_array).view().to_pylist() == ["abc", None, "é"]
+
+    pa_array = pa.array(["abc", "de"], pa.large_string())
+    assert na.array(pa_array).view().to_pylist() == ["abc", "de"]
+
+    pa_array = pa.array([b"ab", None, b""], pa.binary())
+    assert na.array(pa_array).view().to_pylist() == [b"ab", None, b""]
+
+    pa_array = pa.array([b"ab", b"cd"], pa.binary(2))
+    assert na.array(pa_array).view().to_pylist() == [b"ab", b"cd"]
+
+
+def test_array_view_to_pylist_nested():
+    pa_array = pa.array([{"x": 1, "y": "a"}, None, {"x": 3, "y": None}])
+    assert na.array(pa_array).view().to_pylist() == pa_array.to_pylist()
+
+    pa_array = pa.array([[1, 2], None, [], [3]], pa.list_(pa.int32()))
+    assert na.array(pa_array).view().to_pylist() == [[1, 2], None, [], [3]]
+
+    pa_array = pa.array([[1, 2], [3, 4]], pa.list_(pa.int32(), 2))
+    assert na.array(pa_array).view().to_pylist() == [[1, 2], [3, 4]]
+
+    pa_array = pa.array([[("a", 1)], [], None], pa.map_(pa.string(), pa.int32()))
+    assert na.array(pa_array).view().to_pylist() == [[("a", 1)], [], None]
+
+
+def test_array_view_to_pylist_offset():
+    pa_array = pa.array([[1, 2], [3], None, [4, 5]], pa.list_(pa.int64()))[1:]
+    assert na.array(pa_array).view().to_pylist() == [[3], None, [4, 5]]
+
+    pa_array = pa.array([{"x": i} for i in range(5)])[2:4]
+    assert na.array(pa_array).view().to_pylist() == [{"x": 2}, {"x": 3}]
+
+
+def test_array_view_to_pylist_dictionary():
+    pa_array = pa.array(["a", "b", None, "a"]).dictionary_encode()
+    assert na.array(pa_array).view().to_pylist() == ["a", "b", None, "a"]
+
+
+def test_array_view_iter():
+    pa_array = pa.array(range(3000), pa.int32())
+    view = na.array(pa_array).view()
+    assert list(view) == list(range(3000))
+    assert list(na.array(pa.array([], pa.int32())).view()) == []
+
+
+def test_array_view_to_pylist_unsupported():
+    view = na.array(pa.array([1], pa.decimal128(10, 2))).view()
+    with pytest.raises(TypeError, match="type 'decimal128' to Python"):
+        view.to_pylist()
+
+
+def test_array_nbytes():
+    array = na.array(pa.array([1, 2, 3], pa.int32()))
+    assert array.nbytes == 12
+    assert array.view().nbytes == 12
+    assert array.allocated_bytes == 12
+
+    # One byte of validity bitmap plus the data
+    array = na.array(pa.array([1, None, 3], pa.int32()))
+    assert array.nbytes == 13
+
+    # Offsets for three strings plus the referenced characters
+    array = na.array(pa.array(["abc", "de", None]))
+    assert array.nbytes == 1 + 16 + 5
+    assert array.nbytes == pa.array(["abc", "de", None]).nbytes
+
+
+def test_array_nbytes_slice():
+    pa_array = pa.array(range(100), pa.int64())[10:20]
+    array = na.array(pa_array)
+    assert array.nbytes == 80
+    assert array.allocated_bytes == 160
+
+    pa_array = pa.array([[1, 2], [3], [4, 5, 6]], pa.list_(pa.int32()))[1:]
+    array = na.array(pa_array)
+    assert array.nbytes == 3 * 4 + 4 * 4
+
+
+def test_array_allocated_bytes_shared_buffers():
+    pa_column = pa.array([1, 2, 3], pa.int32())
+    array = na.array(pa.record_batch([pa_column, pa_column], names=["a", "b"]))
+    assert array.nbytes == 24
+    assert array.allocated_bytes == 12
+
+
 def test_buffers_string():
     view = na.array(pa.array(["a", "bc", "def"])).view()
 
@@ -292,3 +711,138 @@ def test_array_stream_iter():
     arrays = list(array_stream)
     assert len(arrays) == 1
     assert arrays[0].schema.children[0].name == "some_column"
+
+
+def test_array_stream_threads():
+    from concurrent.futures import ThreadPoolExecutor
+
+    def consume(i):
+        pa_array = pa.record_batch([pa.array([i] * 100, pa.int32())], names=["col"])
+        reader = pa.RecordBatchReader.from_batches(pa_array.schema, [pa_array] * 10)
+        array_stream = na.array_stream(reader)
+        return sum(array.view().children[0].to_numpy().sum() for array in array_stream)
+
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        totals = list(executor.map(consume, range(8)))
+
+    assert totals == [i * 1000 for i in range(8)]
+
+
+
+def test_array_stream_iter_async():
+    import asyncio
+
+    def make_array_stream():
+        pa_array = pa.record_batch([pa.array([1, 2, 3], pa.int32())], names=["col"])
+        reader = pa.RecordBatchReader.from_batches(pa_array.schema, [pa_array] * 5)
+        return na.array_stream(reader)
+
+    async def lengths(iterator):
+        return [array.length async for array in iterator]
+
+    assert asyncio.run(lengths(make_array_stream())) == [3] * 5
+    assert asyncio.run(lengths(make_array_stream().iter_async(readahead=3))) == [3] * 5
+
+    with pytest.raises(ValueError, match="readahead"):
+        make_array_stream().iter_async(readahead=0)
+
+    async def first_and_close(iterator):
+        array = await iterator.__anext__()
+        await iterator.aclose()
+        with pytest.raises(StopAsyncIteration):
+            await iterator.__anext__()
+        return array.length
+
+    assert asyncio.run(first_and_close(make_array_stream().iter_async())) == 3
+
+class CapsuleWrapper:
+    """Exposes only the Arrow PyCapsule interface of the wrapped object"""
+
+    def __init__(self, obj):
+        self.obj = obj
+
+    def __arrow_c_schema__(self):
+        return self.obj.__arrow_c_schema__()
+
+    def __arrow_c_array__(self, requested_schema=None):
+        return self.obj.__arrow_c_array__(requested_schema)
+
+    def __arrow_c_stream__(self, requested_schema=None):
+        return self.obj.__arrow_c_stream__(requested_schema)
+
+
+def test_schema_capsule():
+    schema = na.schema(pa.int32())
+    capsule = schema.__arrow_c_schema__()
+    assert type(capsule).__name__ == "PyCapsule"
+
+    schema2 = na.schema(CapsuleWrapper(schema))
+    assert schema2 is not schema
+    assert schema2._addr() != schema._addr()
+    assert schema2.format == "i"
+
+    # The exported schema is independent of the original
+    del schema
+    assert schema2.is_valid()
+
+    # Capsules that were never consumed are released when collected
+    del capsule
+
+
+def test_array_capsule_zero_copy():
+    array = na.Array.from_buffer(np.array([1, 2, 3], np.int32))
+    array2 = na.array(CapsuleWrapper(array))
+    assert array2 is not array
+    assert array2.length == 3
+    assert array2.buffers == array.buffers
+
+    # The exported array keeps the original alive
+    del array
+    np.testing.assert_array_equal(array2.view().to_numpy(), [1, 2, 3])
+
+    with pytest.raises(NotImplementedError):
+        array2.__arrow_c_array__(requested_schema=na.schema(pa.int32()))
+
+
+def test_array_capsule_child():
+    pa_batch = pa.record_batch([pa.array([1, 2, 3], pa.int32())], names=["col"])
+    array = na.array(pa_batch)
+    child = na.array(CapsuleWrapper(array.children[0]))
+    assert child.schema.name == "col"
+    assert child.buffers == array.children[0].buffers
+
+    del array
+    np.testing.assert_array_equal(child.view().to_numpy(), [1, 2, 3])
+
+
+def test_array_stream_capsule_moves():
+    pa_batch = pa.record_batch([pa.array([1, 2, 3], pa.int32())], names=["col"])
+    reader = pa.RecordBatchReader.from_batches(pa_batch.schema, [pa_batch])
+    array_stream = na.array_stream(reader)
+
+    array_stream2 = na.array_stream(CapsuleWrapper(array_stream))
+    assert array_stream.is_valid() is False
+    assert array_stream2.is_valid() is True
+    assert list(array_stream2)[0].length == 3
+
+    with pytest.raises(RuntimeError):
+        array_stream.__arrow_c_stream__()
+
+
+@pytest.mark.skipif(
+    not hasattr(pa.RecordBatchReader, "from_stream"),
+    reason="pyarrow does not implement the Arrow PyCapsule interface",
+)
+def test_capsule_pyarrow_roundtrip():
+    array = na.Array.from_buffer(np.array([1, 2, 3], np.int64))
+    pa_array = pa.array(array)
+    assert pa_array.to_pylist() == [1, 2, 3]
+
+    assert pa.schema(na.schema(pa.schema([pa.field("col", pa.int32())]))) == (
+        pa.schema([pa.field("col", pa.int32())])
+    )
+
+    pa_batch = pa.record_batch([pa.array([1, 2, 3], pa.int32())], names=["col"])
+    reader = pa.RecordBatchReader.from_batches(pa_batch.schema, [pa_batch])
+    pa_reader = pa.RecordBatchReader.from_stream(na.array_stream(reader))
+    assert pa_reader.read_all().num_rows == 3
@@ -31,8 +31,9 @@
 #ifdef HAS_ALTREP
 
 // This file defines all ALTREP classes used to speed up conversion
-// from an arrow_array to an R vector. Currently only string and
-// large string arrays are converted to ALTREP.
+// from an arrow_array to an R vector. String and large string arrays are
+// converted to ALTREP, as are null-free int32 and double arrays. Columns of data
+// frames converted lazily from a stream are deferred ALTREP vectors.
 //
 // All ALTREP classes follow some common patterns:
 //
@@ -116,6 +117,493 @@ static const void* nanoarrow_altrep_dataptr_or_null(SEXP altrep_sexp) {
 
 static R_altrep_class_t nanoarrow_altrep_chr_cls;
 
+// Integer and double ALTREP classes are backed directly by the data buffer of a
+// null-free int32 or float64 array, which has the same representation as an R
+// vector. The same applies to a null-free int64 array converted to a
+// bit64::integer64(), which is a double vector whose elements hold the bits of an
+// int64_t (the int64 class shares all methods with the double class). Unlike the
+// string class, R_altrep_data1() holds an (independent) external pointer to the
+// array itself, which keeps its buffers alive. Elements are only copied into R memory
+// (i.e., materialized) when a writable pointer to the data is requested.
+
+static inline const void* nanoarrow_altrep_num_data(SEXP array_xptr, size_t elsize) {
+  struct ArrowArray* array = (struct ArrowArray*)R_ExternalPtrAddr(array_xptr);
+  return (const uint8_t*)array->buffers[1] + (array->offset * elsize);
+}
+
+static R_xlen_t nanoarrow_altrep_num_length(SEXP altrep_sexp) {
+  SEXP array_xptr = R_altrep_data1(altrep_sexp);
+  if (array_xptr == R_NilValue) {
+    return Rf_xlength(R_altrep_data2(altrep_sexp));
+  }
+
+  struct ArrowArray* array = (struct ArrowArray*)R_ExternalPtrAddr(array_xptr);
+  return (R_xlen_t)array->length;
+}
+
+static Rboolean nanoarrow_altrep_num_inspect(SEXP altrep_sexp, int pre, int deep,
+                                             int pvec,
+                                             void (*inspect_subtree)(SEXP, int, int,
+                                                                     int)) {
+  const char* materialized = "";
+  if (R_altrep_data1(altrep_sexp) == R_NilValue) {
+    materialized = "materialized ";
+  }
+
+  R_xlen_t len = nanoarrow_altrep_num_length(altrep_sexp);
+  const char* class_name = nanoarrow_altrep_class(altrep_sexp);
+  Rprintf("<%s%s[%ld]>\n", materialized, class_name, (long)len);
+  return TRUE;
+}
+
+static SEXP nanoarrow_altrep_num_materialize(SEXP altrep_sexp) {
+  SEXP array_xptr = R_altrep_data1(altrep_sexp);
+  if (array_xptr == R_NilValue) {
+    return R_altrep_data2(altrep_sexp);
+  }
+
+  R_xlen_t len = nanoarrow_altrep_num_length(altrep_sexp);
+  SEXP result_sexp;
+  if (TYPEOF(altrep_sexp) == INTSXP) {
+    result_sexp = PROTECT(Rf_allocVector(INTSXP, len));
+    memcpy(INTEGER(result_sexp), nanoarrow_altrep_num_data(array_xptr, sizeof(int)),
+           len * sizeof(int));
+  } else {
+    result_sexp = PROTECT(Rf_allocVector(REALSXP, len));
+    memcpy(REAL(result_sexp), nanoarrow_altrep_num_data(array_xptr, sizeof(double)),
+           len * sizeof(double));
+  }
+
+  R_set_altrep_data2(altrep_sexp, result_sexp);
+  R_set_altrep_data1(altrep_sexp, R_NilValue);
+  UNPROTECT(1);
+  return result_sexp;
+}
+
+static void* nanoarrow_altrep_num_dataptr(SEXP altrep_sexp, Rboolean writable) {
+  SEXP array_xptr = R_altrep_data1(altrep_sexp);
+  if (array_xptr == R_NilValue || writable) {
+    return DATAPTR(nanoarrow_altrep_num_materialize(altrep_sexp));
+  }
+
+  // R only reads from a pointer requested with writable = FALSE
+  size_t elsize = TYPEOF(altrep_sexp) == INTSXP ? sizeof(int) : sizeof(double);
+  return (void*)nanoarrow_altrep_num_data(array_xptr, elsize);
+}
+
+static const void* nanoarrow_altrep_num_dataptr_or_null(SEXP altrep_sexp) {
+  return nanoarrow_altrep_num_dataptr(altrep_sexp, FALSE);
+}
+
+static int nanoarrow_altinteger_elt(SEXP altrep_sexp, R_xlen_t i) {
+  const int* data = (const int*)nanoarrow_altrep_num_dataptr(altrep_sexp, FALSE);
+  return data[i];
+}
+
+static R_xlen_t nanoarrow_altinteger_get_region(SEXP altrep_sexp, R_xlen_t i,
+                                                R_xlen_t n, int* buf) {
+  R_xlen_t len = nanoarrow_altrep_num_length(altrep_sexp);
+  if (n > (len - i)) {
+    n = len - i;
+  }
+
+  const int* data = (const int*)nanoarrow_altrep_num_dataptr(altrep_sexp, FALSE);
+  memcpy(buf, data + i, n * sizeof(int));
+  return n;
+}
+
+static double nanoarrow_altreal_elt(SEXP altrep_sexp, R_xlen_t i) {
+  const double* data = (const double*)nanoarrow_altrep_num_dataptr(altrep_sexp, FALSE);
+  return data[i];
+}
+
+static R_xlen_t nanoarrow_altreal_get_region(SEXP altrep_sexp, R_xlen_t i, R_xlen_t n,
+                                             double* buf) {
+  R_xlen_t len = nanoarrow_altrep_num_length(altrep_sexp);
+  if (n > (len - i)) {
+    n = len - i;
+  }
+
+  const double* data = (const double*)nanoarrow_altrep_num_dataptr(altrep_sexp, FALSE);
+  memcpy(buf, data + i, n * sizeof(double));
+  return n;
+}
+
+static R_altrep_class_t nanoarrow_altrep_int_cls;
+static R_altrep_class_t nanoarrow_altrep_dbl_cls;
+static R_altrep_class_t nanoarrow_altrep_int64_cls;
+
+// Deferred ALTREP classes wrap a column whose conversion has not happened yet. Here,
+// R_altrep_data1() holds a list() of the (independent) chunks that make up the column,
+// the column's schema, the ptype used to convert it, its total length, and (if
+// elements can be read from the chunks directly) an external pointer to a struct
+// ChunkedIndex. The whole column is converted using the usual converter machinery the
+// first time a pointer to its data is requested. When a ChunkedIndex is available,
+// individual elements and regions are served from the chunks without converting the
+// whole column; otherwise, these also trigger conversion.
+
+#define NANOARROW_DEFERRED_CHUNKS 0
+#define NANOARROW_DEFERRED_SCHEMA 1
+#define NANOARROW_DEFERRED_PTYPE 2
+#define NANOARROW_DEFERRED_LENGTH 3
+#define NANOARROW_DEFERRED_INDEX 4
+
+// One array view per chunk and the (exclusive) cumulative end of each chunk, which is
+// used to find the chunk containing an element with a binary search
+struct ChunkedIndex {
+  int64_t n_chunks;
+  int64_t* chunk_end;
+  struct ArrowArrayView* array_views;
+};
+
+static void finalize_chunked_index_xptr(SEXP index_xptr) {
+  struct ChunkedIndex* index = (struct ChunkedIndex*)R_ExternalPtrAddr(index_xptr);
+  if (index != NULL) {
+    for (int64_t i = 0; i < index->n_chunks; i++) {
+      ArrowArrayViewReset(index->array_views + i);
+    }
+
+    ArrowFree(index->array_views);
+    ArrowFree(index->chunk_end);
+    ArrowFree(index);
+  }
+}
+
+// Returns the chunk containing element i and sets *chunk_i to its index in that chunk
+static inline struct ArrowArrayView* chunked_index_find(struct ChunkedIndex* index,
+                                                        int64_t i, int64_t* chunk_i) {
+  int64_t lo = 0;
+  int64_t hi = index->n_chunks - 1;
+  while (lo < hi) {
+    int64_t mid = lo + (hi - lo) / 2;
+    if (index->chunk_end[mid] <= i) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  int64_t chunk_start = lo == 0 ? 0 : index->chunk_end[lo - 1];
+  *chunk_i = i - chunk_start;
+  return index->array_views + lo;
+}
+
+// Returns the ChunkedIndex for a deferred vector or NULL if elements cannot be served
+// from its chunks (including when the vector has already been materialized)
+static inline struct ChunkedIndex* nanoarrow_altrep_deferred_index(SEXP altrep_sexp) {
+  SEXP spec = R_altrep_data1(altrep_sexp);
+  if (spec == R_NilValue) {
+    return NULL;
+  }
+
+  SEXP index_xptr = VECTOR_ELT(spec, NANOARROW_DEFERRED_INDEX);
+  if (index_xptr == R_NilValue) {
+    return NULL;
+  }
+
+  return (struct ChunkedIndex*)R_ExternalPtrAddr(index_xptr);
+}
+
+// Storage types whose elements can be converted one at a time without any of the
+// options that a ptype can carry
+static int chunked_index_type_supported(SEXPTYPE sexp_type, enum ArrowType type) {
+  switch (sexp_type) {
+    case LGLSXP:
+      return type == NANOARROW_TYPE_BOOL;
+    case INTSXP:
+      switch (type) {
+        case NANOARROW_TYPE_INT8:
+        case NANOARROW_TYPE_UINT8:
+        case NANOARROW_TYPE_INT16:
+        case NANOARROW_TYPE_UINT16:
+        case NANOARROW_TYPE_INT32:
+          return 1;
+        default:
+          return 0;
+      }
+    case REALSXP:
+      switch (type) {
+        case NANOARROW_TYPE_INT8:
+        case NANOARROW_TYPE_UINT8:
+        case NANOARROW_TYPE_INT16:
+        case NANOARROW_TYPE_UINT16:
+        case NANOARROW_TYPE_INT32:
+        case NANOARROW_TYPE_UINT32:
+        case NANOARROW_TYPE_INT64:
+        case NANOARROW_TYPE_UINT64:
+        case NANOARROW_TYPE_FLOAT:
+        case NANOARROW_TYPE_DOUBLE:
+          return 1;
+        default:
+          return 0;
+      }
+    case STRSXP:
+      return type == NANOARROW_TYPE_STRING || type == NANOARROW_TYPE_LARGE_STRING;
+    default:
+      return 0;
+  }
+}
+
+// Creates an external pointer to a struct ChunkedIndex for chunks or returns
+// R_NilValue if elements of a vector with ptype_sexp can't be served from them
+static SEXP chunked_index_xptr(SEXP chunks_sexp, SEXP schema_xptr, SEXP ptype_sexp) {
+  // Anything with attributes (e.g., a Date or a factor) needs the full converter
+  struct ArrowSchema* schema = (struct ArrowSchema*)R_ExternalPtrAddr(schema_xptr);
+  struct ArrowSchemaView schema_view;
+  if (ATTRIB(ptype_sexp) != R_NilValue || schema->dictionary != NULL ||
+      ArrowSchemaViewInit(&schema_view, schema, NULL) != NANOARROW_OK ||
+      schema_view.extension_name.size_bytes > 0 ||
+      !chunked_index_type_supported(TYPEOF(ptype_sexp), schema_view.type)) {
+    return R_NilValue;
+  }
+
+  struct ChunkedIndex* index =
+      (struct ChunkedIndex*)ArrowMalloc(sizeof(struct ChunkedIndex));
+  if (index == NULL) {
+    Rf_error("Failed to allocate ChunkedIndex");
+  }
+
+  index->n_chunks = 0;
+  index->chunk_end = NULL;
+  index->array_views = NULL;
+  SEXP index_xptr = PROTECT(R_MakeExternalPtr(index, R_NilValue, chunks_sexp));
+  R_RegisterCFinalizer(index_xptr, &finalize_chunked_index_xptr);
+
+  R_xlen_t n_chunks = Rf_xlength(chunks_sexp);
+  index->chunk_end = (int64_t*)ArrowMalloc(n_chunks * sizeof(int64_t));
+  index->array_views =
+      (struct ArrowArrayView*)ArrowMalloc(n_chunks * sizeof(struct ArrowArrayView));
+  if (n_chunks > 0 && (index->chunk_end == NULL || index->array_views == NULL)) {
+    Rf_error("Failed to allocate ChunkedIndex");
+  }
+
+  struct ArrowError error;
+  int64_t end = 0;
+  for (R_xlen_t i = 0; i < n_chunks; i++) {
+    struct ArrowArrayView* array_view = index->array_views + i;
+    if (ArrowArrayViewInitFromSchema(array_view, schema, &error) != NANOARROW_OK) {
+      Rf_error("ArrowArrayViewInitFromSchema(): %s", error.message);
+    }
+    index->n_chunks++;
+
+    struct ArrowArray* array = array_from_xptr(VECTOR_ELT(chunks_sexp, i));
+    if (ArrowArrayViewSetArray(array_view, array, &error) != NANOARROW_OK) {
+      Rf_error("ArrowArrayViewSetArray(): %s", error.message);
+    }
+
+    end += array->length;
+    index->chunk_end[i] = end;
+  }
+
+  UNPROTECT(1);
+  return index_xptr;
+}
+
+static R_xlen_t nanoarrow_altrep_deferred_length(SEXP altrep_sexp) {
+  SEXP spec = R_altrep_data1(altrep_sexp);
+  if (spec == R_NilValue) {
+    return Rf_xlength(R_altrep_data2(altrep_sexp));
+  }
+
+  return (R_xlen_t)REAL(VECTOR_ELT(spec, NANOARROW_DEFERRED_LENGTH))[0];
+}
+
+static Rboolean nanoarrow_altrep_deferred_inspect(SEXP altrep_sexp, int pre, int deep,
+                                                  int pvec,
+                                                  void (*inspect_subtree)(SEXP, int, int,
+                                                                          int)) {
+  const char* materialized = "";
+  if (R_altrep_data1(altrep_sexp) == R_NilValue) {
+    materialized = "materialized ";
+  }
+
+  R_xlen_t len = nanoarrow_altrep_deferred_length(altrep_sexp);
+  const char* class_name = nanoarrow_altrep_class(altrep_sexp);
+  Rprintf("<%s%s[%ld]>\n", materialized, class_name, (long)len);
+  return TRUE;
+}
+
+static SEXP nanoarrow_altrep_deferred_materialize(SEXP altrep_sexp) {
+  SEXP spec = R_altrep_data1(altrep_sexp);
+  if (spec == R_NilValue) {
+    return R_altrep_data2(altrep_sexp);
+  }
+
+  SEXP result_sexp = PROTECT(nanoarrow_c_convert_array_list(
+      VECTOR_ELT(spec, NANOARROW_DEFERRED_CHUNKS),
+      VECTOR_ELT(spec, NANOARROW_DEFERRED_SCHEMA),
+      VECTOR_ELT(spec, NANOARROW_DEFERRED_PTYPE)));
+  R_set_altrep_data2(altrep_sexp, result_sexp);
+  R_set_altrep_data1(altrep_sexp, R_NilValue);
+  UNPROTECT(1);
+  return result_sexp;
+}
+
+static void* nanoarrow_altrep_deferred_dataptr(SEXP altrep_sexp, Rboolean writable) {
+  return DATAPTR(nanoarrow_altrep_deferred_materialize(altrep_sexp));
+}
+
+static const void* nanoarrow_altrep_deferred_dataptr_or_null(SEXP altrep_sexp) {
+  if (R_altrep_data1(altrep_sexp) == R_NilValue) {
+    return DATAPTR_OR_NULL(R_altrep_data2(altrep_sexp));
+  }
+
+  return NULL;
+}
+
+static inline int chunk_int_elt(struct ArrowArrayView* array_view, int64_t i) {
+  if (ArrowArrayViewIsNull(array_view, i)) {
+    return NA_INTEGER;
+  }
+
+  return (int)ArrowArrayViewGetIntUnsafe(array_view, i);
+}
+
+static inline double chunk_dbl_elt(struct ArrowArrayView* array_view, int64_t i) {
+  if (ArrowArrayViewIsNull(array_view, i)) {
+    return NA_REAL;
+  }
+
+  return ArrowArrayViewGetDoubleUnsafe(array_view, i);
+}
+
+static inline SEXP chunk_chr_elt(struct ArrowArrayView* array_view, int64_t i) {
+  if (ArrowArrayViewIsNull(array_view, i)) {
+    return NA_STRING;
+  }
+
+  struct ArrowStringView item = ArrowArrayViewGetStringUnsafe(array_view, i);
+  return Rf_mkCharLenCE(item.data, (int)item.size_bytes, CE_UTF8);
+}
+
+// Fills buf with elements [i, i + n) chunk by chunk (so that the binary search is
+// performed once per region rather than once per element)
+#define NANOARROW_CHUNKED_GET_REGION(index, i, n, buf, elt_fun) \
+  do {                                                           \
+    int64_t chunk_i;                                             \
+    struct ArrowArrayView* array_view =                         \
+        chunked_index_find((index), (i), &chunk_i);              \
+    for (R_xlen_t k = 0; k < (n); k++) {                         \
+      if (chunk_i == array_view->length) {                      \
+        array_view++;                                            \
+        chunk_i = 0;                                             \
+        while (array_view->length == 0) array_view++;            \
+      }                                                          \
+      (buf)[k] = elt_fun(array_view, chunk_i++);                 \
+    }                                                            \
+  } while (0)
+
+static inline R_xlen_t nanoarrow_altrep_deferred_region_size(SEXP altrep_sexp,
+                                                             R_xlen_t i, R_xlen_t n) {
+  R_xlen_t len = nanoarrow_altrep_deferred_length(altrep_sexp);
+  return n > (len - i) ? (len - i) : n;
+}
+
+static int nanoarrow_altrep_deferred_int_elt(SEXP altrep_sexp, R_xlen_t i) {
+  struct ChunkedIndex* index = nanoarrow_altrep_deferred_index(altrep_sexp);
+  if (index == NULL) {
+    return INTEGER(nanoarrow_altrep_deferred_materialize(altrep_sexp))[i];
+  }
+
+  int64_t chunk_i;
+  struct ArrowArrayView* array_view = chunked_index_find(index, i, &chunk_i);
+  return chunk_int_elt(array_view, chunk_i);
+}
+
+static R_xlen_t nanoarrow_altrep_deferred_int_get_region(SEXP altrep_sexp, R_xlen_t i,
+                                                         R_xlen_t n, int* buf) {
+  struct ChunkedIndex* index = nanoarrow_altrep_deferred_index(altrep_sexp);
+  n = nanoarrow_altrep_deferred_region_size(altrep_sexp, i, n);
+  if (index == NULL) {
+    memcpy(buf, INTEGER(nanoarrow_altrep_deferred_materialize(altrep_sexp)) + i,
+           n * sizeof(int));
+  } else if (n > 0) {
+    NANOARROW_CHUNKED_GET_REGION(index, i, n, buf, chunk_int_elt);
+  }
+
+  return n;
+}
+
+static double nanoarrow_altrep_deferred_dbl_elt(SEXP altrep_sexp, R_xlen_t i) {
+  struct ChunkedIndex* index = nanoarrow_altrep_deferred_index(altrep_sexp);
+  if (index == NULL) {
+    return REAL(nanoarrow_altrep_deferred_materialize(altrep_sexp))[i];
+  }
+
+  int64_t chunk_i;
+  struct ArrowArrayView* array_view = chunked_index_find(index, i, &chunk_i);
+  return chunk_dbl_elt(array_view, chunk_i);
+}
+
+static R_xlen_t nanoarrow_altrep_deferred_dbl_get_region(SEXP altrep_sexp, R_xlen_t i,
+                                                         R_xlen_t n, double* buf) {
+  struct ChunkedIndex* index = nanoarrow_altrep_deferred_index(altrep_sexp);
+  n = nanoarrow_altrep_deferred_region_size(altrep_sexp, i, n);
+  if (index == NULL) {
+    memcpy(buf, REAL(nanoarrow_altrep_deferred_materialize(altrep_sexp)) + i,
+           n * sizeof(double));
+  } else if (n > 0) {
+    NANOARROW_CHUNKED_GET_REGION(index, i, n, buf, chunk_dbl_elt);
+  }
+
+  return n;
+}
+
+static SEXP nanoarrow_altrep_deferred_chr_elt(SEXP altrep_sexp, R_xlen_t i) {
+  struct ChunkedIndex* index = nanoarrow_altrep_deferred_index(altrep_sexp);
+  if (index == NULL) {
+    return STRING_ELT(nanoarrow_altrep_deferred_materialize(altrep_sexp), i);
+  }
+
+  int64_t chunk_i;
+  struct ArrowArrayView* array_view = chunked_index_find(index, i, &chunk_i);
+  return chunk_chr_elt(array_view, chunk_i);
+}
+
+static R_altrep_class_t nanoarrow_altrep_deferred_int_cls;
+static R_altrep_class_t nanoarrow_altrep_deferred_dbl_cls;
+static R_altrep_class_t nanoarrow_altrep_deferred_chr_cls;
+
+// ALTLOGICAL available in R >= 3.6
+#if R_VERSION >= R_Version(3, 6, 0)
+#define HAS_ALTREP_ALTLOGICAL
+
+static inline int chunk_lgl_elt(struct ArrowArrayView* array_view, int64_t i) {
+  if (ArrowArrayViewIsNull(array_view, i)) {
+    return NA_LOGICAL;
+  }
+
+  return ArrowArrayViewGetIntUnsafe(array_view, i) != 0;
+}
+
+static int nanoarrow_altrep_deferred_lgl_elt(SEXP altrep_sexp, R_xlen_t i) {
+  struct ChunkedIndex* index = nanoarrow_altrep_deferred_index(altrep_sexp);
+  if (index == NULL) {
+    return LOGICAL(nanoarrow_altrep_deferred_materialize(altrep_sexp))[i];
+  }
+
+  int64_t chunk_i;
+  struct ArrowArrayView* array_view = chunked_index_find(index, i, &chunk_i);
+  return chunk_lgl_elt(array_view, chunk_i);
+}
+
+static R_xlen_t nanoarrow_altrep_deferred_lgl_get_region(SEXP altrep_sexp, R_xlen_t i,
+                                                         R_xlen_t n, int* buf) {
+  struct ChunkedIndex* index = nanoarrow_altrep_deferred_index(altrep_sexp);
+  n = nanoarrow_altrep_deferred_region_size(altrep_sexp, i, n);
+  if (index == NULL) {
+    memcpy(buf, LOGICAL(nanoarrow_altrep_deferred_materialize(altrep_sexp)) + i,
+           n * sizeof(int));
+  } else if (n > 0) {
+    NANOARROW_CHUNKED_GET_REGION(index, i, n, buf, chunk_lgl_elt);
+  }
+
+  return n;
+}
+
+static R_altrep_class_t nanoarrow_altrep_deferred_lgl_cls;
+#endif
+
 #endif
 
 static void register_nanoarrow_altstring(DllInfo* info) {
@@ -146,7 +634,103 @@ static void register_nanoarrow_altstring(DllInfo* info) {
 #endif
 }
 
-void register_nanoarrow_altrep(DllInfo* info) { register_nanoarrow_altstring(info); }
+static void register_nanoarrow_altnum(DllInfo* info) {
+#ifdef HAS_ALTREP
+  nanoarrow_altrep_int_cls =
+      R_make_altinteger_class("nanoarrow::altrep_int", "nanoarrow", info);
+  R_set_altrep_Length_method(nanoarrow_altrep_int_cls, &nanoarrow_altrep_num_length);
+  R_set_altrep_Inspect_method(nanoarrow_altrep_int_cls, &nanoarrow_altrep_num_inspect);
+  R_set_altvec_Dataptr_or_null_method(nanoarrow_altrep_int_cls,
+                                      &nanoarrow_altrep_num_dataptr_or_null);
+  R_set_altvec_Dataptr_method(nanoarrow_altrep_int_cls, &nanoarrow_altrep_num_dataptr);
+  R_set_altinteger_Elt_method(nanoarrow_altrep_int_cls, &nanoarrow_altinteger_elt);
+  R_set_altinteger_Get_region_method(nanoarrow_altrep_int_cls,
+                                     &nanoarrow_altinteger_get_region);
+
+  nanoarrow_altrep_dbl_cls =
+      R_make_altreal_class("nanoarrow::altrep_dbl", "nanoarrow", info);
+  R_set_altrep_Length_method(nanoarrow_altrep_dbl_cls, &nanoarrow_altrep_num_length);
+  R_set_altrep_Inspect_method(nanoarrow_altrep_dbl_cls, &nanoarrow_altrep_num_inspect);
+  R_set_altvec_Dataptr_or_null_method(nanoarrow_altrep_dbl_cls,
+                                      &nanoarrow_altrep_num_dataptr_or_null);
+  R_set_altvec_Dataptr_method(nanoarrow_altrep_dbl_cls, &nanoarrow_altrep_num_dataptr);
+  R_set_altreal_Elt_method(nanoarrow_altrep_dbl_cls, &nanoarrow_altreal_elt);
+  R_set_altreal_Get_region_method(nanoarrow_altrep_dbl_cls,
+                                  &nanoarrow_altreal_get_region);
+
+  nanoarrow_altrep_int64_cls =
+      R_make_altreal_class("nanoarrow::altrep_int64", "nanoarrow", info);
+  R_set_altrep_Length_method(nanoarrow_altrep_int64_cls, &nanoarrow_altrep_num_length);
+  R_set_altrep_Inspect_method(nanoarrow_altrep_int64_cls,
+                              &nanoarrow_altrep_num_inspect);
+  R_set_altvec_Dataptr_or_null_method(nanoarrow_altrep_int64_cls,
+                                      &nanoarrow_altrep_num_dataptr_or_null);
+  R_set_altvec_Dataptr_method(nanoarrow_altrep_int64_cls,
+                              &nanoarrow_altrep_num_dataptr);
+  R_set_altreal_Elt_method(nanoarrow_altrep_int64_cls, &nanoarrow_altreal_elt);
+  R_set_altreal_Get_region_method(nanoarrow_altrep_int64_cls,
+                                  &nanoarrow_altreal_get_region);
+
+  // Because the vector is marked not mutable and no set_Elt method is defined,
+  // modifications (e.g., x[1] <- 0L) duplicate the vector or request a writable
+  // pointer to its data, both of which read from or materialize this object
+  // without ever writing to the Arrow buffer.
+#endif
+}
+
+#ifdef HAS_ALTREP
+static void register_nanoarrow_altrep_deferred_common(R_altrep_class_t cls) {
+  R_set_altrep_Length_method(cls, &nanoarrow_altrep_deferred_length);
+  R_set_altrep_Inspect_method(cls, &nanoarrow_altrep_deferred_inspect);
+  R_set_altvec_Dataptr_or_null_method(cls, &nanoarrow_altrep_deferred_dataptr_or_null);
+  R_set_altvec_Dataptr_method(cls, &nanoarrow_altrep_deferred_dataptr);
+}
+#endif
+
+static void register_nanoarrow_altdeferred(DllInfo* info) {
+#ifdef HAS_ALTREP
+  nanoarrow_altrep_deferred_int_cls =
+      R_make_altinteger_class("nanoarrow::altrep_deferred_int", "nanoarrow", info);
+  register_nanoarrow_altrep_deferred_common(nanoarrow_altrep_deferred_int_cls);
+  R_set_altinteger_Elt_method(nanoarrow_altrep_deferred_int_cls,
+                              &nanoarrow_altrep_deferred_int_elt);
+  R_set_altinteger_Get_region_method(nanoarrow_altrep_deferred_int_cls,
+                                     &nanoarrow_altrep_deferred_int_get_region);
+
+  nanoarrow_altrep_deferred_dbl_cls =
+      R_make_altreal_class("nanoarrow::altrep_deferred_dbl", "nanoarrow", info);
+  register_nanoarrow_altrep_deferred_common(nanoarrow_altrep_deferred_dbl_cls);
+  R_set_altreal_Elt_method(nanoarrow_altrep_deferred_dbl_cls,
+                           &nanoarrow_altrep_deferred_dbl_elt);
+  R_set_altreal_Get_region_method(nanoarrow_altrep_deferred_dbl_cls,
+                                  &nanoarrow_altrep_deferred_dbl_get_region);
+
+  nanoarrow_altrep_deferred_chr_cls =
+      R_make_altstring_class("nanoarrow::altrep_deferred_chr", "nanoarrow", info);
+  register_nanoarrow_altrep_deferred_common(nanoarrow_altrep_deferred_chr_cls);
+  R_set_altstring_Elt_method(nanoarrow_altrep_deferred_chr_cls,
+                             &nanoarrow_altrep_deferred_chr_elt);
+
+#ifdef HAS_ALTREP_ALTLOGICAL
+  nanoarrow_altrep_deferred_lgl_cls =
+      R_make_altlogical_class("nanoarrow::altrep_deferred_lgl", "nanoarrow", info);
+  register_nanoarrow_altrep_deferred_common(nanoarrow_altrep_deferred_lgl_cls);
+  R_set_altlogical_Elt_method(nanoarrow_altrep_deferred_lgl_cls,
+                              &nanoarrow_altrep_deferred_lgl_elt);
+  R_set_altlogical_Get_region_method(nanoarrow_altrep_deferred_lgl_cls,
+                                     &nanoarrow_altrep_deferred_lgl_get_region);
+#endif
+
+  // No Elt setter is defined and deferred vectors are marked not mutable, so
+  // modifications materialize the column via Dataptr before writing to it.
+#endif
+}
+
+void register_nanoarrow_altrep(DllInfo* info) {
+  register_nanoarrow_altstring(info);
+  register_nanoarrow_altnum(info);
+  register_nanoarrow_altdeferred(info);
+}
 
 SEXP nanoarrow_c_make_altrep_chr(SEXP array_xptr) {
 #ifdef HAS_ALTREP
@@ -189,6 +773,144 @@ SEXP nanoarrow_c_make_altrep_chr(SEXP array_xptr) {
 #endif
 }
 
+SEXP nanoarrow_make_altrep_num(SEXP array_xptr, enum VectorType vector_type) {
+#ifdef HAS_ALTREP
+  struct ArrowSchema* schema = schema_from_array_xptr(array_xptr);
+  struct ArrowArray* array = array_from_xptr(array_xptr);
+
+  struct ArrowSchemaView schema_view;
+  if (ArrowSchemaViewInit(&schema_view, schema, NULL) != NANOARROW_OK) {
+    Rf_error("Invalid schema");
+  }
+
+  // Only arrays whose data buffer can be used as-is are supported: anything else
+  // (including any array with nulls, which need NA sentinels) is converted by copying
+  size_t elsize;
+  R_altrep_class_t cls;
+  if (vector_type == VECTOR_TYPE_INT && schema_view.type == NANOARROW_TYPE_INT32) {
+    elsize = sizeof(int);
+    cls = nanoarrow_altrep_int_cls;
+  } else if (vector_type == VECTOR_TYPE_DBL &&
+             schema_view.type == NANOARROW_TYPE_DOUBLE) {
+    elsize = sizeof(double);
+    cls = nanoarrow_altrep_dbl_cls;
+  } else if (vector_type == VECTOR_TYPE_INTEGER64 &&
+             schema_view.type == NANOARROW_TYPE_INT64) {
+    elsize = sizeof(int64_t);
+    cls = nanoarrow_altrep_int64_cls;
+  } else {
+    return R_NilValue;
+  }
+
+  if (schema_view.extension_name.size_bytes > 0 || array->dictionary != NULL ||
+      array->length == 0 || array->buffers[1] == NULL) {
+    return R_NilValue;
+  }
+
+  if (array->null_count != 0 && array->buffers[0] != NULL) {
+    int64_t n_valid =
+        ArrowBitCountSet((const uint8_t*)array->buffers[0], array->offset, array->length);
+    if (n_valid != array->length) {
+      return R_NilValue;
+    }
+  }
+
+  // R assumes that the data pointer of a vector is aligned
+  const uint8_t* data = (const uint8_t*)array->buffers[1] + (array->offset * elsize);
+  if (((uintptr_t)data % elsize) != 0) {
+    return R_NilValue;
+  }
+
+  // As for strings, don't keep the array's parent alive unnecessarily
+  SEXP array_xptr_independent = PROTECT(array_xptr_ensure_independent(array_xptr));
+  SEXP out = PROTECT(R_new_altrep(cls, array_xptr_independent, R_NilValue));
+  if (vector_type == VECTOR_TYPE_INTEGER64) {
+    Rf_setAttrib(out, R_ClassSymbol, nanoarrow_cls_integer64);
+  }
+
+  MARK_NOT_MUTABLE(out);
+  UNPROTECT(2);
+  return out;
+#else
+  return R_NilValue;
+#endif
+}
+
+SEXP nanoarrow_make_altrep_deferred(SEXP chunks_sexp, SEXP schema_xptr,
+                                    SEXP ptype_sexp) {
+#ifdef HAS_ALTREP
+  R_altrep_class_t cls;
+  switch (TYPEOF(ptype_sexp)) {
+#ifdef HAS_ALTREP_ALTLOGICAL
+    case LGLSXP:
+      cls = nanoarrow_altrep_deferred_lgl_cls;
+      break;
+#endif
+    case INTSXP:
+      cls = nanoarrow_altrep_deferred_int_cls;
+      break;
+    case REALSXP:
+      cls = nanoarrow_altrep_deferred_dbl_cls;
+      break;
+    case STRSXP:
+      cls = nanoarrow_altrep_deferred_chr_cls;
+      break;
+    default:
+      return R_NilValue;
+  }
+
+  // Validate the schema now so that an invalid or unsupported schema errors here
+  // rather than when the column is first accessed
+  SEXP converter_xptr = PROTECT(nanoarrow_converter_from_ptype(ptype_sexp));
+  if (nanoarrow_converter_set_schema(converter_xptr, schema_xptr) != NANOARROW_OK) {
+    nanoarrow_converter_stop(converter_xptr);
+  }
+
+  // Don't keep the parent of each chunk alive unnecessarily (i.e., the memory for
+  // a column that is never accessed is released when the column is discarded)
+  R_xlen_t n_chunks = Rf_xlength(chunks_sexp);
+  SEXP chunks_independent = PROTECT(Rf_allocVector(VECSXP, n_chunks));
+  double length = 0;
+  for (R_xlen_t i = 0; i < n_chunks; i++) {
+    SEXP chunk_xptr = VECTOR_ELT(chunks_sexp, i);
+    SET_VECTOR_ELT(chunks_independent, i, array_xptr_ensure_independent(chunk_xptr));
+    length += array_from_xptr(chunk_xptr)->length;
+  }
+
+  SEXP spec = PROTECT(Rf_allocVector(VECSXP, 5));
+  SET_VECTOR_ELT(spec, NANOARROW_DEFERRED_CHUNKS, chunks_independent);
+  SET_VECTOR_ELT(spec, NANOARROW_DEFERRED_SCHEMA, schema_xptr);
+  SET_VECTOR_ELT(spec, NANOARROW_DEFERRED_PTYPE, ptype_sexp);
+  SET_VECTOR_ELT(spec, NANOARROW_DEFERRED_LENGTH, Rf_ScalarReal(length));
+  SET_VECTOR_ELT(spec, NANOARROW_DEFERRED_INDEX,
+                 chunked_index_xptr(chunks_independent, schema_xptr, ptype_sexp));
+
+  // The result has the attributes of the ptype (e.g., class)
+  SEXP out = PROTECT(R_new_altrep(cls, spec, R_NilValue));
+  DUPLICATE_ATTRIB(out, ptype_sexp);
+  MARK_NOT_MUTABLE(out);
+  UNPROTECT(4);
+  return out;
+#else
+  return R_NilValue;
+#endif
+}
+
+SEXP nanoarrow_c_make_altrep_num(SEXP array_xptr, SEXP ptype_sexp) {
+  switch (TYPEOF(ptype_sexp)) {
+    case INTSXP:
+      return nanoarrow_make_altrep_num(array_xptr, VECTOR_TYPE_INT);
+    case REALSXP:
+      if (Rf_inherits(ptype_sexp, "integer64")) {
+        return nanoarrow_make_altrep_num(array_xptr, VECTOR_TYPE_INTEGER64);
+      } else {
+        return nanoarrow_make_altrep_num(array_xptr, VECTOR_TYPE_DBL);
+      }
+    default:
+      return R_NilValue;
+  }
+}
+
 SEXP nanoarrow_c_is_altrep(SEXP x_sexp) {
   return Rf_ScalarLogical(is_nanoarrow_altrep(x_sexp));
 }
@@ -217,7 +939,18 @@ SEXP nanoarrow_c_altrep_force_materialize(SEXP x_sexp, SEXP recursive_sexp) {
   }
 
   const char* class_name = nanoarrow_altrep_class(x_sexp);
-  if (class_name && strcmp(class_name, "nanoarrow::altrep_chr") == 0) {
+  if (class_name && (strcmp(class_name, "nanoarrow::altrep_int") == 0 ||
+                     strcmp(class_name, "nanoarrow::altrep_dbl") == 0 ||
+                     strcmp(class_name, "nanoarrow::altrep_int64") == 0)) {
+    int already_materialized = R_altrep_data1(x_sexp) == R_NilValue;
+    nanoarrow_altrep_num_materialize(x_sexp);
+    return Rf_ScalarInteger(!already_materialized);
+  } else if (class_name &&
+             strncmp(class_name, "nanoarrow::altrep_deferred_", 27) == 0) {
+    int already_materialized = R_altrep_data1(x_sexp) == R_NilValue;
+    nanoarrow_altrep_deferred_materialize(x_sexp);
+    return Rf_ScalarInteger(!already_materialized);
+  } else if (class_name && strcmp(class_name, "nanoarrow::altrep_chr") == 0) {
     // Force materialization even if already materialized (the method
     // should be safe to call more than once as written here)
     int already_materialized = R_altrep_data1(x_sexp) == R_NilValue;
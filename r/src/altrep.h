@@ -22,6 +22,8 @@
 
 #include <string.h>
 
+#include "materialize_common.h"
+
 // ALTREP available in R >= 3.5
 #if defined(R_VERSION) && R_VERSION >= R_Version(3, 5, 0)
 
@@ -58,4 +60,16 @@ static inline int is_nanoarrow_altrep(SEXP x) {
 // R_NilValue if the conversion is not possible.
 SEXP nanoarrow_c_make_altrep_chr(SEXP array_xptr);
 
+// Creates an altinteger (for VECTOR_TYPE_INT) or altreal (for VECTOR_TYPE_DBL and
+// VECTOR_TYPE_INTEGER64) vector whose data is the data buffer of a null-free int32,
+// double, or int64 array or returns R_NilValue if the conversion is not possible.
+SEXP nanoarrow_make_altrep_num(SEXP array_xptr, enum VectorType vector_type);
+
+// Creates a logical, integer, double, or character vector (according to ptype_sexp)
+// that converts chunks (a list() of arrays with schema schema_xptr) the first time any
+// of its elements are accessed, or returns R_NilValue if deferring the conversion is
+// not possible.
+SEXP nanoarrow_make_altrep_deferred(SEXP chunks_sexp, SEXP schema_xptr,
+                                    SEXP ptype_sexp);
+
 #endif
@@ -46,6 +46,97 @@ static void call_as_nanoarrow_array(SEXP x_sexp, struct ArrowArray* array,
   UNPROTECT(3);
 }
 
+// Allocates a bitmap of exactly len bits whose bytes can be filled directly
+static uint8_t* as_array_bitmap_allocate(struct ArrowBitmap* bitmap, int64_t len) {
+  ArrowBitmapInit(bitmap);
+  if (ArrowBitmapReserve(bitmap, len) != NANOARROW_OK) {
+    Rf_error("ArrowBitmapReserve() failed");
+  }
+
+  bitmap->size_bits = len;
+  bitmap->buffer.size_bytes = _ArrowBytesForBits(len);
+  return bitmap->buffer.data;
+}
+
+// The bitmap packers below produce one output byte per eight input elements
+// (rather than appending one bit at a time) and return the number of zero bits.
+// Any trailing bits in the final byte are zeroed.
+static int64_t as_array_pack_validity_int(const int* x_data, int64_t len,
+                                          uint8_t* bits) {
+  int64_t n_full_bytes = len / 8;
+  int64_t n_valid = 0;
+  for (int64_t i = 0; i < n_full_bytes; i++) {
+    const int* x = x_data + i * 8;
+    uint8_t byte = 0;
+    for (int j = 0; j < 8; j++) {
+      byte |= (uint8_t)(x[j] != NA_INTEGER) << j;
+    }
+    bits[i] = byte;
+    n_valid += _ArrowkBytePopcount[byte];
+  }
+
+  if (len % 8 != 0) {
+    const int* x = x_data + n_full_bytes * 8;
+    uint8_t byte = 0;
+    for (int j = 0; j < (len % 8); j++) {
+      byte |= (uint8_t)(x[j] != NA_INTEGER) << j;
+    }
+    bits[n_full_bytes] = byte;
+    n_valid += _ArrowkBytePopcount[byte];
+  }
+
+  return len - n_valid;
+}
+
+static int64_t as_array_pack_validity_dbl(const double* x_data, int64_t len,
+                                          uint8_t* bits) {
+  int64_t n_full_bytes = len / 8;
+  int64_t n_valid = 0;
+  for (int64_t i = 0; i < n_full_bytes; i++) {
+    const double* x = x_data + i * 8;
+    uint8_t byte = 0;
+    for (int j = 0; j < 8; j++) {
+      byte |= (uint8_t)(!ISNAN(x[j])) << j;
+    }
+    bits[i] = byte;
+    n_valid += _ArrowkBytePopcount[byte];
+  }
+
+  if (len % 8 != 0) {
+    const double* x = x_data + n_full_bytes * 8;
+    uint8_t byte = 0;
+    for (int j = 0; j < (len % 8); j++) {
+      byte |= (uint8_t)(!ISNAN(x[j])) << j;
+    }
+    bits[n_full_bytes] = byte;
+    n_valid += _ArrowkBytePopcount[byte];
+  }
+
+  return len - n_valid;
+}
+
+// Packs logical values as bits where NA values are packed as false
+static void as_array_pack_values_lgl(const int* x_data, int64_t len, uint8_t* bits) {
+  int64_t n_full_bytes = len / 8;
+  for (int64_t i = 0; i < n_full_bytes; i++) {
+    const int* x = x_data + i * 8;
+    uint8_t byte = 0;
+    for (int j = 0; j < 8; j++) {
+      byte |= (uint8_t)(x[j] != 0 && x[j] != NA_INTEGER) << j;
+    }
+    bits[i] = byte;
+  }
+
+  if (len % 8 != 0) {
+    const int* x = x_data + n_full_bytes * 8;
+    uint8_t byte = 0;
+    for (int j = 0; j < (len % 8); j++) {
+      byte |= (uint8_t)(x[j] != 0 && x[j] != NA_INTEGER) << j;
+    }
+    bits[n_full_bytes] = byte;
+  }
+}
+
 static void as_array_int(SEXP x_sexp, struct ArrowArray* array, SEXP schema_xptr,
                          struct ArrowSchemaView* schema_view, struct ArrowError* error) {
   // Only consider the default create for now
@@ -85,19 +176,8 @@ static void as_array_int(SEXP x_sexp, struct ArrowArray* array, SEXP schema_xptr
   // If there are nulls, pack the validity buffer
   if (first_null != -1) {
     struct ArrowBitmap bitmap;
-    ArrowBitmapInit(&bitmap);
-    result = ArrowBitmapReserve(&bitmap, len);
-    if (result != NANOARROW_OK) {
-      Rf_error("ArrowBitmapReserve() failed");
-    }
-
-    ArrowBitmapAppendUnsafe(&bitmap, 1, first_null);
-    for (int64_t i = first_null; i < len; i++) {
-      uint8_t is_valid = x_data[i] != NA_INTEGER;
-      null_count += !is_valid;
-      ArrowBitmapAppend(&bitmap, is_valid, 1);
-    }
-
+    uint8_t* bits = as_array_bitmap_allocate(&bitmap, len);
+    null_count = as_array_pack_validity_int(x_data, len, bits);
     ArrowArraySetValidityBitmap(array, &bitmap);
   }
 
@@ -131,24 +211,18 @@ static void as_array_lgl(SEXP x_sexp, struct ArrowArray* array, SEXP schema_xptr
   }
 
   struct ArrowBitmap value_bitmap;
-  ArrowBitmapInit(&value_bitmap);
-  result = ArrowBitmapReserve(&value_bitmap, len);
-  if (result != NANOARROW_OK) {
-    Rf_error("ArrowBitmapReserve() failed");
-  }
+  uint8_t* value_bits = as_array_bitmap_allocate(&value_bitmap, len);
+  as_array_pack_values_lgl(x_data, len, value_bits);
+  ArrowArraySetBuffer(array, 1, &value_bitmap.buffer);
 
   int has_nulls = 0;
   for (int64_t i = 0; i < len; i++) {
     if (x_data[i] == NA_INTEGER) {
       has_nulls = 1;
-      ArrowBitmapAppend(&value_bitmap, 0, 1);
-    } else {
-      ArrowBitmapAppend(&value_bitmap, x_data[i] != 0, 1);
+      break;
     }
   }
 
-  ArrowArraySetBuffer(array, 1, &value_bitmap.buffer);
-
   // Set the array fields
   array->length = len;
   array->offset = 0;
@@ -157,18 +231,8 @@ static void as_array_lgl(SEXP x_sexp, struct ArrowArray* array, SEXP schema_xptr
   // If there are nulls, pack the validity buffer
   if (has_nulls) {
     struct ArrowBitmap bitmap;
-    ArrowBitmapInit(&bitmap);
-    result = ArrowBitmapReserve(&bitmap, len);
-    if (result != NANOARROW_OK) {
-      Rf_error("ArrowBitmapReserve() failed");
-    }
-
-    for (int64_t i = 0; i < len; i++) {
-      uint8_t is_valid = x_data[i] != NA_INTEGER;
-      null_count += !is_valid;
-      ArrowBitmapAppend(&bitmap, is_valid, 1);
-    }
-
+    uint8_t* bits = as_array_bitmap_allocate(&bitmap, len);
+    null_count = as_array_pack_validity_int(x_data, len, bits);
     ArrowArraySetValidityBitmap(array, &bitmap);
   }
 
@@ -264,7 +328,7 @@ static void as_array_dbl(SEXP x_sexp, struct ArrowArray* array, SEXP schema_xptr
   // Look for the first null (will be the last index if there are none)
   int64_t first_null = -1;
   for (int64_t i = 0; i < len; i++) {
-    if (R_IsNA(x_data[i]) || R_IsNaN(x_data[i])) {
+    if (ISNAN(x_data[i])) {
       first_null = i;
       break;
     }
@@ -273,19 +337,8 @@ static void as_array_dbl(SEXP x_sexp, struct ArrowArray* array, SEXP schema_xptr
   // If there are nulls, pack the validity buffer
   if (first_null != -1) {
     struct ArrowBitmap bitmap;
-    ArrowBitmapInit(&bitmap);
-    result = ArrowBitmapReserve(&bitmap, len);
-    if (result != NANOARROW_OK) {
-      Rf_error("ArrowBitmapReserve() failed");
-    }
-
-    ArrowBitmapAppendUnsafe(&bitmap, 1, first_null);
-    for (int64_t i = first_null; i < len; i++) {
-      uint8_t is_valid = !R_IsNA(x_data[i]) && !R_IsNaN(x_data[i]);
-      null_count += !is_valid;
-      ArrowBitmapAppend(&bitmap, is_valid, 1);
-    }
-
+    uint8_t* bits = as_array_bitmap_allocate(&bitmap, len);
+    null_count = as_array_pack_validity_dbl(x_data, len, bits);
     ArrowArraySetValidityBitmap(array, &bitmap);
   }
 
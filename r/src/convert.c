@@ -65,12 +65,16 @@ SEXP nanoarrow_converter_from_type(enum VectorType vector_type) {
   converter->schema_view.storage_type = NANOARROW_TYPE_UNINITIALIZED;
   converter->src.array_view = &converter->array_view;
   converter->dst.vec_sexp = R_NilValue;
+  converter->dst.data = NULL;
   converter->options = NULL;
   converter->error.message[0] = '\0';
   converter->size = 0;
   converter->capacity = 0;
   converter->n_children = 0;
   converter->children = NULL;
+  converter->defer_warnings = 0;
+  converter->n_lossy_values = 0;
+  converter->lossy_message = NULL;
 
   converter->ptype_view.vector_type = vector_type;
   converter->ptype_view.ptype = R_NilValue;
@@ -331,6 +335,7 @@ void sync_after_converter_reallocate(SEXP converter_xptr, struct RConverter* con
   SET_VECTOR_ELT(converter_shelter, 4, result_sexp);
 
   converter->dst.vec_sexp = result_sexp;
+  converter->dst.data = nanoarrow_vec_data(result_sexp);
   converter->dst.offset = 0;
   converter->dst.length = 0;
   converter->size = 0;
@@ -442,6 +447,7 @@ SEXP nanoarrow_converter_release_result(SEXP converter_xptr) {
   SEXP result = PROTECT(VECTOR_ELT(converter_shelter, 4));
   SET_VECTOR_ELT(converter_shelter, 4, R_NilValue);
   converter->dst.vec_sexp = R_NilValue;
+  converter->dst.data = NULL;
   converter->dst.offset = 0;
   converter->dst.length = 0;
   converter->size = 0;
@@ -63,4 +63,9 @@ SEXP nanoarrow_converter_release_result(SEXP converter_xptr);
 // that return a non-zero errno value.
 void nanoarrow_converter_stop(SEXP converter_xptr);
 
+// Converts a list() of arrays that all have the schema schema_xptr into a single R
+// vector of type ptype_sexp (allocating the result exactly once).
+SEXP nanoarrow_c_convert_array_list(SEXP batches_sexp, SEXP schema_xptr,
+                                    SEXP ptype_sexp);
+
 #endif
@@ -100,6 +100,70 @@ static SEXP convert_array_default(SEXP array_xptr, enum VectorType vector_type,
   return result;
 }
 
+// Null-free int32, double, and int64 (to integer64) arrays are converted to ALTREP
+// vectors that use the array's data buffer as-is; everything else is copied
+static SEXP convert_array_num(SEXP array_xptr, enum VectorType vector_type,
+                              SEXP ptype_sexp) {
+  SEXP result = PROTECT(nanoarrow_make_altrep_num(array_xptr, vector_type));
+  if (result == R_NilValue) {
+    result = convert_array_default(array_xptr, vector_type, ptype_sexp);
+  }
+
+  UNPROTECT(1);
+  return result;
+}
+
+// Dictionary-encoded strings are converted by creating the CHARSXP of each
+// dictionary value once and looking it up by index for each element, rather than
+// converting the dictionary to a character vector and subsetting it (which would
+// call Rf_mkCharLenCE() once per element).
+static SEXP convert_array_chr_dictionary(SEXP array_xptr) {
+  SEXP array_view_xptr = PROTECT(array_view_xptr_from_array_xptr(array_xptr));
+  struct ArrowArrayView* array_view =
+      (struct ArrowArrayView*)R_ExternalPtrAddr(array_view_xptr);
+  struct ArrowArrayView* dictionary_view = array_view->dictionary;
+
+  switch (dictionary_view->storage_type) {
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_LARGE_STRING:
+      break;
+    default:
+      UNPROTECT(1);
+      return convert_array_default(array_xptr, VECTOR_TYPE_CHR, R_NilValue);
+  }
+
+  int64_t n_values = dictionary_view->length;
+  SEXP values_sexp = PROTECT(Rf_allocVector(STRSXP, n_values));
+  for (int64_t i = 0; i < n_values; i++) {
+    if (ArrowArrayViewIsNull(dictionary_view, i)) {
+      SET_STRING_ELT(values_sexp, i, NA_STRING);
+    } else {
+      struct ArrowStringView item = ArrowArrayViewGetStringUnsafe(dictionary_view, i);
+      SET_STRING_ELT(values_sexp, i,
+                     Rf_mkCharLenCE(item.data, (int)item.size_bytes, CE_UTF8));
+    }
+  }
+
+  SEXP result = PROTECT(Rf_allocVector(STRSXP, array_view->length));
+  for (int64_t i = 0; i < array_view->length; i++) {
+    if (ArrowArrayViewIsNull(array_view, i)) {
+      SET_STRING_ELT(result, i, NA_STRING);
+      continue;
+    }
+
+    int64_t key = ArrowArrayViewGetIntUnsafe(array_view, i);
+    if (key < 0 || key >= n_values) {
+      Rf_error("Expected dictionary index between 0 and %ld but found %ld",
+               (long)(n_values - 1), (long)key);
+    }
+
+    SET_STRING_ELT(result, i, STRING_ELT(values_sexp, key));
+  }
+
+  UNPROTECT(3);
+  return result;
+}
+
 static SEXP convert_array_chr(SEXP array_xptr, SEXP ptype_sexp) {
   struct ArrowSchema* schema = schema_from_array_xptr(array_xptr);
   struct ArrowSchemaView schema_view;
@@ -130,7 +194,7 @@ static SEXP convert_array_chr(SEXP array_xptr, SEXP ptype_sexp) {
     UNPROTECT(1);
     return result;
   } else {
-    return convert_array_default(array_xptr, VECTOR_TYPE_CHR, R_NilValue);
+    return convert_array_chr_dictionary(array_xptr);
   }
 }
 
@@ -214,9 +278,10 @@ SEXP nanoarrow_c_convert_array(SEXP array_xptr, SEXP ptype_sexp) {
     enum VectorType vector_type = nanoarrow_infer_vector_type_array(array_xptr);
     switch (vector_type) {
       case VECTOR_TYPE_LGL:
+        return convert_array_default(array_xptr, vector_type, R_NilValue);
       case VECTOR_TYPE_INT:
       case VECTOR_TYPE_DBL:
-        return convert_array_default(array_xptr, vector_type, R_NilValue);
+        return convert_array_num(array_xptr, vector_type, R_NilValue);
       case VECTOR_TYPE_CHR:
         return convert_array_chr(array_xptr, ptype_sexp);
       case VECTOR_TYPE_DATA_FRAME:
@@ -243,9 +308,10 @@ SEXP nanoarrow_c_convert_array(SEXP array_xptr, SEXP ptype_sexp) {
                Rf_inherits(ptype_sexp, "vctrs_list_of") ||
                Rf_inherits(ptype_sexp, "Date") || Rf_inherits(ptype_sexp, "hms") ||
                Rf_inherits(ptype_sexp, "POSIXct") ||
-               Rf_inherits(ptype_sexp, "difftime") ||
-               Rf_inherits(ptype_sexp, "integer64")) {
+               Rf_inherits(ptype_sexp, "difftime")) {
       return convert_array_default(array_xptr, VECTOR_TYPE_UNINITIALIZED, ptype_sexp);
+    } else if (Rf_inherits(ptype_sexp, "integer64")) {
+      return convert_array_num(array_xptr, VECTOR_TYPE_INTEGER64, ptype_sexp);
     } else {
       return call_convert_array(array_xptr, ptype_sexp);
     }
@@ -256,9 +322,9 @@ SEXP nanoarrow_c_convert_array(SEXP array_xptr, SEXP ptype_sexp) {
     case LGLSXP:
       return convert_array_default(array_xptr, VECTOR_TYPE_LGL, ptype_sexp);
     case INTSXP:
-      return convert_array_default(array_xptr, VECTOR_TYPE_INT, ptype_sexp);
+      return convert_array_num(array_xptr, VECTOR_TYPE_INT, ptype_sexp);
     case REALSXP:
-      return convert_array_default(array_xptr, VECTOR_TYPE_DBL, ptype_sexp);
+      return convert_array_num(array_xptr, VECTOR_TYPE_DBL, ptype_sexp);
     case STRSXP:
       return convert_array_chr(array_xptr, ptype_sexp);
     default:
@@ -21,9 +21,11 @@
 
 #include "nanoarrow.h"
 
+#include "altrep.h"
 #include "array.h"
 #include "array_stream.h"
 #include "convert.h"
+#include "materialize.h"
 #include "schema.h"
 
 SEXP nanoarrow_c_convert_array_stream(SEXP array_stream_xptr, SEXP ptype_sexp,
@@ -95,3 +97,105 @@ SEXP nanoarrow_c_convert_array_stream(SEXP array_stream_xptr, SEXP ptype_sexp,
   UNPROTECT(4);
   return result_sexp;
 }
+
+SEXP nanoarrow_c_convert_array_list(SEXP batches_sexp, SEXP schema_xptr,
+                                    SEXP ptype_sexp) {
+  R_xlen_t n_batches = Rf_xlength(batches_sexp);
+
+  // Sum the lengths of the retained batches so that the result can be allocated
+  // exactly once instead of growing (and copying) as each batch is materialized
+  int64_t size = 0;
+  for (R_xlen_t i = 0; i < n_batches; i++) {
+    struct ArrowArray* array = array_from_xptr(VECTOR_ELT(batches_sexp, i));
+    size += array->length;
+  }
+
+  SEXP converter_xptr = PROTECT(nanoarrow_converter_from_ptype(ptype_sexp));
+  if (nanoarrow_converter_set_schema(converter_xptr, schema_xptr) != NANOARROW_OK) {
+    nanoarrow_converter_stop(converter_xptr);
+  }
+
+  if (nanoarrow_converter_reserve(converter_xptr, size) != NANOARROW_OK) {
+    nanoarrow_converter_stop(converter_xptr);
+  }
+
+  int64_t n_materialized = 0;
+  for (R_xlen_t i = 0; i < n_batches; i++) {
+    SEXP array_xptr = VECTOR_ELT(batches_sexp, i);
+    struct ArrowArray* array = array_from_xptr(array_xptr);
+    if (nanoarrow_converter_set_array(converter_xptr, array_xptr) != NANOARROW_OK) {
+      nanoarrow_converter_stop(converter_xptr);
+    }
+
+    n_materialized = nanoarrow_converter_materialize_n(converter_xptr, array->length);
+    if (n_materialized != array->length) {
+      Rf_error("Expected to materialize %ld values in batch %ld but materialized %ld",
+               (long)array->length, (long)(i + 1), (long)n_materialized);
+    }
+  }
+
+  if (nanoarrow_converter_finalize(converter_xptr) != NANOARROW_OK) {
+    nanoarrow_converter_stop(converter_xptr);
+  }
+
+  SEXP result_sexp = PROTECT(nanoarrow_converter_release_result(converter_xptr));
+  UNPROTECT(2);
+  return result_sexp;
+}
+
+SEXP nanoarrow_c_convert_array_list_lazy(SEXP batches_sexp, SEXP schema_xptr,
+                                         SEXP ptype_sexp) {
+  // Vectors that aren't data frames may themselves be deferred
+  if (!Rf_inherits(ptype_sexp, "data.frame")) {
+    SEXP result_sexp =
+        PROTECT(nanoarrow_make_altrep_deferred(batches_sexp, schema_xptr, ptype_sexp));
+    if (result_sexp == R_NilValue) {
+      result_sexp = nanoarrow_c_convert_array_list(batches_sexp, schema_xptr, ptype_sexp);
+    }
+
+    UNPROTECT(1);
+    return result_sexp;
+  }
+
+  // Check the ptype against the schema up front (including the number of columns)
+  SEXP converter_xptr = PROTECT(nanoarrow_converter_from_ptype(ptype_sexp));
+  if (nanoarrow_converter_set_schema(converter_xptr, schema_xptr) != NANOARROW_OK) {
+    nanoarrow_converter_stop(converter_xptr);
+  }
+
+  R_xlen_t n_batches = Rf_xlength(batches_sexp);
+  R_xlen_t n_cols = Rf_xlength(ptype_sexp);
+  int64_t n_rows = 0;
+  for (R_xlen_t i = 0; i < n_batches; i++) {
+    n_rows += array_from_xptr(VECTOR_ELT(batches_sexp, i))->length;
+  }
+
+  SEXP result_sexp = PROTECT(Rf_allocVector(VECSXP, n_cols));
+  for (R_xlen_t j = 0; j < n_cols; j++) {
+    SEXP chunks_sexp = PROTECT(Rf_allocVector(VECSXP, n_batches));
+    for (R_xlen_t i = 0; i < n_batches; i++) {
+      SET_VECTOR_ELT(chunks_sexp, i,
+                     borrow_array_child_xptr(VECTOR_ELT(batches_sexp, i), j));
+    }
+
+    SEXP child_schema_xptr = PROTECT(borrow_schema_child_xptr(schema_xptr, j));
+    SEXP child_ptype = VECTOR_ELT(ptype_sexp, j);
+
+    // Columns that can't be deferred (e.g., nested data frames or lists) are
+    // converted now
+    SEXP column_sexp = PROTECT(
+        nanoarrow_make_altrep_deferred(chunks_sexp, child_schema_xptr, child_ptype));
+    if (column_sexp == R_NilValue) {
+      column_sexp = nanoarrow_c_convert_array_list(chunks_sexp, child_schema_xptr,
+                                                   child_ptype);
+    }
+
+    SET_VECTOR_ELT(result_sexp, j, column_sexp);
+    UNPROTECT(3);
+  }
+
+  DUPLICATE_ATTRIB(result_sexp, ptype_sexp);
+  nanoarrow_set_rownames(result_sexp, n_rows);
+  UNPROTECT(2);
+  return result_sexp;
+}
@@ -24,6 +24,7 @@
 
 /* generated by tools/make-callentries.R */
 extern SEXP nanoarrow_c_make_altrep_chr(SEXP array_xptr);
+extern SEXP nanoarrow_c_make_altrep_num(SEXP array_xptr, SEXP ptype_sexp);
 extern SEXP nanoarrow_c_is_altrep(SEXP x_sexp);
 extern SEXP nanoarrow_c_altrep_is_materialized(SEXP x_sexp);
 extern SEXP nanoarrow_c_altrep_force_materialize(SEXP x_sexp, SEXP recursive_sexp);
@@ -31,7 +32,6 @@ extern SEXP nanoarrow_c_array_stream_get_schema(SEXP array_stream_xptr);
 extern SEXP nanoarrow_c_array_stream_get_next(SEXP array_stream_xptr);
 extern SEXP nanoarrow_c_basic_array_stream(SEXP batches_sexp, SEXP schema_xptr,
                                            SEXP validate_sexp);
-extern SEXP nanoarrow_c_array_list_total_length(SEXP list_of_array_xptr);
 extern SEXP nanoarrow_c_array_view(SEXP array_xptr, SEXP schema_xptr);
 extern SEXP nanoarrow_c_array_init(SEXP schema_xptr);
 extern SEXP nanoarrow_c_array_set_length(SEXP array_xptr, SEXP length_sexp);
@@ -54,7 +54,13 @@ extern SEXP nanoarrow_c_buffer_head_bytes(SEXP buffer_xptr, SEXP max_bytes_sexp)
 extern SEXP nanoarrow_c_buffer_as_raw(SEXP buffer_xptr);
 extern SEXP nanoarrow_c_convert_array_stream(SEXP array_stream_xptr, SEXP ptype_sexp,
                                              SEXP size_sexp, SEXP n_sexp);
+extern SEXP nanoarrow_c_convert_array_list(SEXP batches_sexp, SEXP schema_xptr,
+                                           SEXP ptype_sexp);
+extern SEXP nanoarrow_c_convert_array_list_lazy(SEXP batches_sexp, SEXP schema_xptr,
+                                                SEXP ptype_sexp);
 extern SEXP nanoarrow_c_infer_ptype(SEXP schema_xptr);
+extern SEXP nanoarrow_c_ipc_array_reader_buffer(SEXP buffer_sexp);
+extern SEXP nanoarrow_c_ipc_array_reader_file(SEXP path_sexp);
 extern SEXP nanoarrow_c_convert_array(SEXP array_xptr, SEXP ptype_sexp);
 extern SEXP nanoarrow_c_allocate_schema(void);
 extern SEXP nanoarrow_c_allocate_array(void);
@@ -94,6 +100,7 @@ extern SEXP nanoarrow_c_version_runtime(void);
 
 static const R_CallMethodDef CallEntries[] = {
     {"nanoarrow_c_make_altrep_chr", (DL_FUNC)&nanoarrow_c_make_altrep_chr, 1},
+    {"nanoarrow_c_make_altrep_num", (DL_FUNC)&nanoarrow_c_make_altrep_num, 2},
     {"nanoarrow_c_is_altrep", (DL_FUNC)&nanoarrow_c_is_altrep, 1},
     {"nanoarrow_c_altrep_is_materialized", (DL_FUNC)&nanoarrow_c_altrep_is_materialized,
      1},
@@ -103,8 +110,6 @@ static const R_CallMethodDef CallEntries[] = {
      1},
     {"nanoarrow_c_array_stream_get_next", (DL_FUNC)&nanoarrow_c_array_stream_get_next, 1},
     {"nanoarrow_c_basic_array_stream", (DL_FUNC)&nanoarrow_c_basic_array_stream, 3},
-    {"nanoarrow_c_array_list_total_length", (DL_FUNC)&nanoarrow_c_array_list_total_length,
-     1},
     {"nanoarrow_c_array_view", (DL_FUNC)&nanoarrow_c_array_view, 2},
     {"nanoarrow_c_array_init", (DL_FUNC)&nanoarrow_c_array_init, 1},
     {"nanoarrow_c_array_set_length", (DL_FUNC)&nanoarrow_c_array_set_length, 2},
@@ -125,7 +130,13 @@ static const R_CallMethodDef CallEntries[] = {
     {"nanoarrow_c_buffer_head_bytes", (DL_FUNC)&nanoarrow_c_buffer_head_bytes, 2},
     {"nanoarrow_c_buffer_as_raw", (DL_FUNC)&nanoarrow_c_buffer_as_raw, 1},
     {"nanoarrow_c_convert_array_stream", (DL_FUNC)&nanoarrow_c_convert_array_stream, 4},
+    {"nanoarrow_c_convert_array_list", (DL_FUNC)&nanoarrow_c_convert_array_list, 3},
+    {"nanoarrow_c_convert_array_list_lazy", (DL_FUNC)&nanoarrow_c_convert_array_list_lazy,
+     3},
     {"nanoarrow_c_infer_ptype", (DL_FUNC)&nanoarrow_c_infer_ptype, 1},
+    {"nanoarrow_c_ipc_array_reader_buffer", (DL_FUNC)&nanoarrow_c_ipc_array_reader_buffer,
+     1},
+    {"nanoarrow_c_ipc_array_reader_file", (DL_FUNC)&nanoarrow_c_ipc_array_reader_file, 1},
     {"nanoarrow_c_convert_array", (DL_FUNC)&nanoarrow_c_convert_array, 2},
     {"nanoarrow_c_allocate_schema", (DL_FUNC)&nanoarrow_c_allocate_schema, 0},
     {"nanoarrow_c_allocate_array", (DL_FUNC)&nanoarrow_c_allocate_array, 0},
@@ -0,0 +1,102 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#define R_NO_REMAP
+#include <R.h>
+#include <Rinternals.h>
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "array_stream.h"
+#include "buffer.h"
+#include "nanoarrow.h"
+#include "nanoarrow_ipc.h"
+
+// Creates the ArrowArrayStream that decodes input. Arrays are created with shared
+// buffers such that they reference (and keep alive) the raw vector or mapping from
+// which they were decoded instead of copying message bodies.
+static SEXP ipc_array_stream_owning_xptr(struct ArrowIpcInputStream* input) {
+  SEXP array_stream_xptr = PROTECT(array_stream_owning_xptr());
+  struct ArrowArrayStream* array_stream =
+      (struct ArrowArrayStream*)R_ExternalPtrAddr(array_stream_xptr);
+
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.use_shared_buffers = 1;
+
+  int result = ArrowIpcArrayStreamReaderInit(array_stream, input, &options);
+  if (result != NANOARROW_OK) {
+    input->release(input);
+    Rf_error("ArrowIpcArrayStreamReaderInit() failed [%d]", result);
+  }
+
+  UNPROTECT(1);
+  return array_stream_xptr;
+}
+
+SEXP nanoarrow_c_ipc_array_reader_buffer(SEXP buffer_sexp) {
+  if (TYPEOF(buffer_sexp) != RAWSXP) {
+    Rf_error("buffer must be a raw vector");
+  }
+
+  // The raw vector is preserved until the last array that references it is released
+  struct ArrowBuffer buffer;
+  ArrowBufferInit(&buffer);
+  buffer_borrowed(&buffer, RAW(buffer_sexp), Rf_xlength(buffer_sexp), buffer_sexp);
+
+  struct ArrowIpcInputStream input;
+  int result = ArrowIpcInputStreamInitBuffer(&input, &buffer);
+  if (result != NANOARROW_OK) {
+    ArrowBufferReset(&buffer);
+    Rf_error("ArrowIpcInputStreamInitBuffer() failed [%d]", result);
+  }
+
+  return ipc_array_stream_owning_xptr(&input);
+}
+
+SEXP nanoarrow_c_ipc_array_reader_file(SEXP path_sexp) {
+  if (TYPEOF(path_sexp) != STRSXP || Rf_length(path_sexp) != 1 ||
+      STRING_ELT(path_sexp, 0) == NA_STRING) {
+    Rf_error("path must be a character vector of length 1");
+  }
+
+  const char* path = R_ExpandFileName(Rf_translateChar(STRING_ELT(path_sexp, 0)));
+  FILE* file_ptr = fopen(path, "rb");
+  if (file_ptr == NULL) {
+    Rf_error("Failed to open '%s': %s", path, strerror(errno));
+  }
+
+  // The mapping does not depend on the file remaining open. Where memory mapping is
+  // not available (e.g., Windows), fall back to reading (and copying) from the file.
+  struct ArrowIpcInputStream input;
+  struct ArrowError error;
+  ArrowErrorInit(&error);
+  int result = ArrowIpcInputStreamInitMmap(&input, fileno(file_ptr), &error);
+  if (result == NANOARROW_OK) {
+    fclose(file_ptr);
+  } else {
+    result = ArrowIpcInputStreamInitFile(&input, file_ptr, 1);
+    if (result != NANOARROW_OK) {
+      fclose(file_ptr);
+      Rf_error("ArrowIpcInputStreamInitFile() failed [%d]", result);
+    }
+  }
+
+  return ipc_array_stream_owning_xptr(&input);
+}
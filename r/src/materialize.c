@@ -53,6 +53,19 @@ SEXP nanoarrow_alloc_type(enum VectorType vector_type, R_xlen_t len) {
   }
 }
 
+void* nanoarrow_vec_data(SEXP vec_sexp) {
+  switch (TYPEOF(vec_sexp)) {
+    case LGLSXP:
+      return LOGICAL(vec_sexp);
+    case INTSXP:
+      return INTEGER(vec_sexp);
+    case REALSXP:
+      return REAL(vec_sexp);
+    default:
+      return NULL;
+  }
+}
+
 // A version of Rf_getAttrib(x, sym) != R_NilValue that never
 // expands the row.names attribute
 static int has_attrib_safe(SEXP x, SEXP sym) {
@@ -311,6 +324,145 @@ static int nanoarrow_materialize_other(struct RConverter* converter,
   return NANOARROW_OK;
 }
 
+// Returns the value of getOption("nanoarrow.num_threads"), the number of threads
+// used to materialize the columns of a data frame (1 if unset or invalid)
+static int nanoarrow_materialize_n_threads(void) {
+  SEXP n_threads_sexp = Rf_GetOption1(Rf_install("nanoarrow.num_threads"));
+  if (n_threads_sexp == R_NilValue) {
+    return 1;
+  }
+
+  int n_threads = Rf_asInteger(n_threads_sexp);
+  if (n_threads == NA_INTEGER || n_threads < 1) {
+    return 1;
+  }
+
+  return n_threads;
+}
+
+// Returns non-zero if materializing converter never calls the R API, which is the
+// case for materializers that only write through dst.data (except for lossy
+// conversion warnings, which can be deferred)
+static int nanoarrow_materialize_is_thread_safe(struct RConverter* converter) {
+  if (converter->dst.data == NULL ||
+      converter->schema_view.extension_name.size_bytes > 0 ||
+      converter->src.array_view->array->dictionary != NULL) {
+    return 0;
+  }
+
+  switch (converter->ptype_view.vector_type) {
+    case VECTOR_TYPE_LGL:
+    case VECTOR_TYPE_INT:
+    case VECTOR_TYPE_DBL:
+    case VECTOR_TYPE_POSIXCT:
+    case VECTOR_TYPE_DATE:
+    case VECTOR_TYPE_DIFFTIME:
+    case VECTOR_TYPE_INTEGER64:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+// Like nanoarrow_materialize_base() for a converter for which
+// nanoarrow_materialize_is_thread_safe() is true, except that failure never falls
+// back to an R-level conversion
+static int nanoarrow_materialize_thread_safe(struct RConverter* converter) {
+  switch (converter->ptype_view.vector_type) {
+    case VECTOR_TYPE_LGL:
+      return nanoarrow_materialize_lgl(&converter->src, &converter->dst,
+                                       converter->options);
+    case VECTOR_TYPE_INT:
+      return nanoarrow_materialize_int(converter);
+    case VECTOR_TYPE_DBL:
+      return nanoarrow_materialize_dbl(converter);
+    case VECTOR_TYPE_POSIXCT:
+      return nanoarrow_materialize_posixct(converter);
+    case VECTOR_TYPE_DATE:
+      return nanoarrow_materialize_date(converter);
+    case VECTOR_TYPE_DIFFTIME:
+      return nanoarrow_materialize_difftime(converter);
+    case VECTOR_TYPE_INTEGER64:
+      return nanoarrow_materialize_int64(converter);
+    default:
+      return ENOTSUP;
+  }
+}
+
+struct MaterializeChildrenTask {
+  struct RConverter** children;
+  const int* child_indices;
+  int* results;
+};
+
+static void nanoarrow_materialize_child_task(int64_t i, void* data) {
+  struct MaterializeChildrenTask* task = (struct MaterializeChildrenTask*)data;
+  struct RConverter* child = task->children[task->child_indices[i]];
+  task->results[i] = nanoarrow_materialize_thread_safe(child);
+}
+
+// Materializes the children of a struct converter whose src and dst slices have
+// already been set. Children that are thread safe are materialized first on up to
+// n_threads threads; the rest (and any that failed, such that they can fall back to
+// an R-level conversion) are then materialized in order on this thread.
+static int nanoarrow_materialize_children(struct RConverter* converter,
+                                          SEXP child_converter_xptrs, int n_threads) {
+  // R-allocated such that nothing leaks if a later conversion longjmps
+  SEXP parallel_sexp = PROTECT(Rf_allocVector(INTSXP, converter->n_children * 2));
+  int* child_indices = INTEGER(parallel_sexp);
+  int* results = child_indices + converter->n_children;
+  int64_t n_parallel = 0;
+
+  if (n_threads > 1) {
+    for (R_xlen_t i = 0; i < converter->n_children; i++) {
+      if (nanoarrow_materialize_is_thread_safe(converter->children[i])) {
+        converter->children[i]->defer_warnings = 1;
+        converter->children[i]->n_lossy_values = 0;
+        child_indices[n_parallel++] = (int)i;
+      }
+    }
+  }
+
+  if (n_parallel > 1) {
+    struct MaterializeChildrenTask task;
+    task.children = converter->children;
+    task.child_indices = child_indices;
+    task.results = results;
+    nanoarrow_parallel_for(n_parallel, n_threads, &nanoarrow_materialize_child_task,
+                           &task);
+  } else {
+    n_parallel = 0;
+  }
+
+  for (R_xlen_t i = 0; i < converter->n_children; i++) {
+    converter->children[i]->defer_warnings = 0;
+  }
+
+  int64_t next_parallel = 0;
+  for (R_xlen_t i = 0; i < converter->n_children; i++) {
+    struct RConverter* child = converter->children[i];
+    if (next_parallel < n_parallel && child_indices[next_parallel] == i) {
+      int result = results[next_parallel++];
+      if (result == NANOARROW_OK) {
+        if (child->n_lossy_values > 0) {
+          warn_lossy_conversion(child->n_lossy_values, child->lossy_message);
+        }
+
+        continue;
+      }
+    }
+
+    int result = nanoarrow_materialize(child, VECTOR_ELT(child_converter_xptrs, i));
+    if (result != NANOARROW_OK) {
+      UNPROTECT(1);
+      return result;
+    }
+  }
+
+  UNPROTECT(1);
+  return NANOARROW_OK;
+}
+
 static int nanoarrow_materialize_data_frame(struct RConverter* converter,
                                             SEXP converter_xptr) {
   if (converter->ptype_view.vector_type != VECTOR_TYPE_DATA_FRAME) {
@@ -332,11 +484,14 @@ static int nanoarrow_materialize_data_frame(struct RConverter* converter,
         converter->children[i]->src.length = converter->src.length;
         converter->children[i]->dst.offset = converter->dst.offset;
         converter->children[i]->dst.length = converter->dst.length;
-        SEXP child_converter_xptr = VECTOR_ELT(child_converter_xptrs, i);
-        NANOARROW_RETURN_NOT_OK(
-            nanoarrow_materialize(converter->children[i], child_converter_xptr));
       }
-      return NANOARROW_OK;
+
+      if (converter->n_children > 1) {
+        return nanoarrow_materialize_children(converter, child_converter_xptrs,
+                                              nanoarrow_materialize_n_threads());
+      } else {
+        return nanoarrow_materialize_children(converter, child_converter_xptrs, 1);
+      }
 
     case NANOARROW_TYPE_DENSE_UNION:
     case NANOARROW_TYPE_SPARSE_UNION:
@@ -384,6 +539,90 @@ static int materialize_list_element(struct RConverter* converter, SEXP converter
   return NANOARROW_OK;
 }
 
+// Returns a new vector containing length elements of values starting at offset (with
+// the attributes of values) or R_NilValue if values is not of a type that can be
+// sliced in this way
+static SEXP slice_list_values(SEXP values, R_xlen_t offset, R_xlen_t length) {
+  SEXP item;
+  switch (TYPEOF(values)) {
+    case RAWSXP:
+      item = PROTECT(Rf_allocVector(RAWSXP, length));
+      memcpy(RAW(item), RAW(values) + offset, length * sizeof(uint8_t));
+      break;
+    case LGLSXP:
+    case INTSXP:
+      item = PROTECT(Rf_allocVector(TYPEOF(values), length));
+      memcpy(INTEGER(item), INTEGER(values) + offset, length * sizeof(int));
+      break;
+    case REALSXP:
+      item = PROTECT(Rf_allocVector(REALSXP, length));
+      memcpy(REAL(item), REAL(values) + offset, length * sizeof(double));
+      break;
+    case CPLXSXP:
+      item = PROTECT(Rf_allocVector(CPLXSXP, length));
+      memcpy(COMPLEX(item), COMPLEX(values) + offset, length * sizeof(Rcomplex));
+      break;
+    case STRSXP:
+      item = PROTECT(Rf_allocVector(STRSXP, length));
+      for (R_xlen_t i = 0; i < length; i++) {
+        SET_STRING_ELT(item, i, STRING_ELT(values, offset + i));
+      }
+      break;
+    default:
+      return R_NilValue;
+  }
+
+  Rf_copyMostAttrib(values, item);
+  UNPROTECT(1);
+  return item;
+}
+
+// Materializes the child elements of all rows in [src->offset, src->offset +
+// src->length) with one call to the child converter and fills each non-null row of dst
+// with a slice of the result. Returns ENOTSUP if the child values can't be sliced
+// (e.g., for a data frame), in which case each row has to be materialized separately.
+static int materialize_list_of_sliced(struct RConverter* converter,
+                                      SEXP child_converter_xptr, int64_t child_offset,
+                                      int64_t child_length,
+                                      const int64_t* row_offsets) {
+  struct RConverter* child_converter = converter->children[0];
+  struct ArrayViewSlice* src = &converter->src;
+  struct VectorSlice* dst = &converter->dst;
+
+  if (nanoarrow_ptype_is_data_frame(child_converter->ptype_view.ptype)) {
+    return ENOTSUP;
+  }
+
+  NANOARROW_RETURN_NOT_OK(materialize_list_element(child_converter, child_converter_xptr,
+                                                   child_offset, child_length));
+  SEXP values = PROTECT(nanoarrow_converter_release_result(child_converter_xptr));
+
+  switch (TYPEOF(values)) {
+    case RAWSXP:
+    case LGLSXP:
+    case INTSXP:
+    case REALSXP:
+    case CPLXSXP:
+    case STRSXP:
+      break;
+    default:
+      UNPROTECT(1);
+      return ENOTSUP;
+  }
+
+  for (int64_t i = 0; i < dst->length; i++) {
+    if (!ArrowArrayViewIsNull(src->array_view, src->offset + i)) {
+      int64_t offset = row_offsets[i] - child_offset;
+      int64_t length = row_offsets[i + 1] - row_offsets[i];
+      SET_VECTOR_ELT(dst->vec_sexp, dst->offset + i,
+                     slice_list_values(values, offset, length));
+    }
+  }
+
+  UNPROTECT(1);
+  return NANOARROW_OK;
+}
+
 static int nanoarrow_materialize_list_of(struct RConverter* converter,
                                          SEXP converter_xptr) {
   SEXP converter_shelter = R_ExternalPtrProtected(converter_xptr);
@@ -403,52 +642,64 @@ static int nanoarrow_materialize_list_of(struct RConverter* converter,
   const int64_t* large_offsets = src->array_view->buffer_views[1].data.as_int64;
   int64_t raw_src_offset = src->array_view->array->offset + src->offset;
 
-  int64_t offset;
-  int64_t length;
+  if (dst->length == 0 || src->array_view->storage_type == NANOARROW_TYPE_NA) {
+    return NANOARROW_OK;
+  }
+
+  // Collect the offsets of every row into the child such that all rows can be
+  // materialized with a single call to the child converter (rather than reserving,
+  // materializing, and finalizing the child converter once per row). These are
+  // stored in R memory because the child converter may longjmp.
+  SEXP row_offsets_sexp = PROTECT(Rf_allocVector(REALSXP, dst->length + 1));
+  int64_t* row_offsets = (int64_t*)REAL(row_offsets_sexp);
 
   switch (src->array_view->storage_type) {
-    case NANOARROW_TYPE_NA:
-      return NANOARROW_OK;
     case NANOARROW_TYPE_LIST:
-      for (int64_t i = 0; i < dst->length; i++) {
-        if (!ArrowArrayViewIsNull(src->array_view, src->offset + i)) {
-          offset = offsets[raw_src_offset + i];
-          length = offsets[raw_src_offset + i + 1] - offset;
-          NANOARROW_RETURN_NOT_OK(materialize_list_element(
-              child_converter, child_converter_xptr, offset, length));
-          SET_VECTOR_ELT(dst->vec_sexp, dst->offset + i,
-                         nanoarrow_converter_release_result(child_converter_xptr));
-        }
+      for (int64_t i = 0; i <= dst->length; i++) {
+        row_offsets[i] = offsets[raw_src_offset + i];
       }
       break;
     case NANOARROW_TYPE_LARGE_LIST:
-      for (int64_t i = 0; i < dst->length; i++) {
-        if (!ArrowArrayViewIsNull(src->array_view, src->offset + i)) {
-          offset = large_offsets[raw_src_offset + i];
-          length = large_offsets[raw_src_offset + i + 1] - offset;
-          NANOARROW_RETURN_NOT_OK(materialize_list_element(
-              child_converter, child_converter_xptr, offset, length));
-          SET_VECTOR_ELT(dst->vec_sexp, dst->offset + i,
-                         nanoarrow_converter_release_result(child_converter_xptr));
-        }
-      }
+      memcpy(row_offsets, large_offsets + raw_src_offset,
+             (dst->length + 1) * sizeof(int64_t));
       break;
-    case NANOARROW_TYPE_FIXED_SIZE_LIST:
-      length = src->array_view->layout.child_size_elements;
-      for (int64_t i = 0; i < dst->length; i++) {
-        if (!ArrowArrayViewIsNull(src->array_view, src->offset + i)) {
-          offset = (raw_src_offset + i) * length;
-          NANOARROW_RETURN_NOT_OK(materialize_list_element(
-              child_converter, child_converter_xptr, offset, length));
-          SET_VECTOR_ELT(dst->vec_sexp, dst->offset + i,
-                         nanoarrow_converter_release_result(child_converter_xptr));
-        }
+    case NANOARROW_TYPE_FIXED_SIZE_LIST: {
+      int64_t size = src->array_view->layout.child_size_elements;
+      for (int64_t i = 0; i <= dst->length; i++) {
+        row_offsets[i] = (raw_src_offset + i) * size;
       }
       break;
+    }
     default:
+      UNPROTECT(1);
       return EINVAL;
   }
 
+  int64_t child_offset = row_offsets[0];
+  int64_t child_length = row_offsets[dst->length] - child_offset;
+  int result = materialize_list_of_sliced(converter, child_converter_xptr,
+                                          child_offset, child_length, row_offsets);
+  if (result != ENOTSUP) {
+    UNPROTECT(1);
+    return result;
+  }
+
+  for (int64_t i = 0; i < dst->length; i++) {
+    if (!ArrowArrayViewIsNull(src->array_view, src->offset + i)) {
+      result = materialize_list_element(child_converter, child_converter_xptr,
+                                        row_offsets[i],
+                                        row_offsets[i + 1] - row_offsets[i]);
+      if (result != NANOARROW_OK) {
+        UNPROTECT(1);
+        return result;
+      }
+
+      SET_VECTOR_ELT(dst->vec_sexp, dst->offset + i,
+                     nanoarrow_converter_release_result(child_converter_xptr));
+    }
+  }
+
+  UNPROTECT(1);
   return NANOARROW_OK;
 }
 
@@ -468,7 +719,7 @@ static int nanoarrow_materialize_base(struct RConverter* converter, SEXP convert
     case VECTOR_TYPE_LGL:
       return nanoarrow_materialize_lgl(src, dst, options);
     case VECTOR_TYPE_INT:
-      return nanoarrow_materialize_int(src, dst, options);
+      return nanoarrow_materialize_int(converter);
     case VECTOR_TYPE_DBL:
       return nanoarrow_materialize_dbl(converter);
     case VECTOR_TYPE_CHR:
@@ -480,7 +731,7 @@ static int nanoarrow_materialize_base(struct RConverter* converter, SEXP convert
     case VECTOR_TYPE_DIFFTIME:
       return nanoarrow_materialize_difftime(converter);
     case VECTOR_TYPE_INTEGER64:
-      return nanoarrow_materialize_int64(src, dst, options);
+      return nanoarrow_materialize_int64(converter);
     case VECTOR_TYPE_BLOB:
       return nanoarrow_materialize_blob(src, dst, options);
     case VECTOR_TYPE_LIST_OF:
@@ -40,6 +40,10 @@ int nanoarrow_materialize(struct RConverter* converter, SEXP converter_xptr);
 
 // Shortcut to allocate a vector based on a vector type or ptype
 SEXP nanoarrow_alloc_type(enum VectorType vector_type, R_xlen_t len);
+
+// Returns the data pointer of a logical, integer, or double vector (or NULL for any
+// other vector)
+void* nanoarrow_vec_data(SEXP vec_sexp);
 SEXP nanoarrow_materialize_realloc(SEXP ptype, R_xlen_t len);
 
 #endif
@@ -43,15 +43,27 @@ static inline int nanoarrow_materialize_chr(struct RConverter* converter) {
       return ENOTSUP;
   }
 
+  // Runs of repeated values (common in low-cardinality columns) reuse the CHARSXP of
+  // the previous element, which is cheaper than looking it up in R's global CHARSXP
+  // cache again
   struct ArrowStringView item;
+  struct ArrowStringView prev_item = {NULL, -1};
+  SEXP prev_chr = NA_STRING;
   for (R_xlen_t i = 0; i < dst->length; i++) {
     if (ArrowArrayViewIsNull(src->array_view, src->offset + i)) {
       SET_STRING_ELT(dst->vec_sexp, dst->offset + i, NA_STRING);
-    } else {
-      item = ArrowArrayViewGetStringUnsafe(src->array_view, src->offset + i);
-      SET_STRING_ELT(dst->vec_sexp, dst->offset + i,
-                     Rf_mkCharLenCE(item.data, item.size_bytes, CE_UTF8));
+      continue;
     }
+
+    item = ArrowArrayViewGetStringUnsafe(src->array_view, src->offset + i);
+    if (item.size_bytes != prev_item.size_bytes ||
+        (item.size_bytes > 0 &&
+         memcmp(item.data, prev_item.data, item.size_bytes) != 0)) {
+      prev_chr = Rf_mkCharLenCE(item.data, item.size_bytes, CE_UTF8);
+      prev_item = item;
+    }
+
+    SET_STRING_ELT(dst->vec_sexp, dst->offset + i, prev_chr);
   }
 
   return NANOARROW_OK;
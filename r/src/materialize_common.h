@@ -77,6 +77,10 @@ struct ArrayViewSlice {
 // This can be both a source and/or a target for copying from/to.
 struct VectorSlice {
   SEXP vec_sexp;
+  // The data pointer of vec_sexp for logical, integer, and double vectors (or NULL
+  // for other vectors), which is resolved when vec_sexp is allocated such that
+  // materializers that only write through it never call the R API
+  void* data;
   R_xlen_t offset;
   R_xlen_t length;
 };
@@ -105,6 +109,12 @@ struct RConverter {
   R_xlen_t capacity;
   R_xlen_t n_children;
   struct RConverter** children;
+  // When non-zero, lossy conversions are counted in n_lossy_values instead of
+  // issuing a warning (i.e., when materializing on a thread other than the main
+  // thread) and the main thread issues the warning afterward
+  int defer_warnings;
+  int64_t n_lossy_values;
+  const char* lossy_message;
 };
 
 static inline void warn_lossy_conversion(int64_t count, const char* msg) {
@@ -116,4 +126,96 @@ static inline void warn_lossy_conversion(int64_t count, const char* msg) {
   UNPROTECT(4);
 }
 
+static inline void nanoarrow_converter_warn_lossy(struct RConverter* converter,
+                                                  int64_t count, const char* msg) {
+  if (converter->defer_warnings) {
+    converter->n_lossy_values += count;
+    converter->lossy_message = msg;
+  } else {
+    warn_lossy_conversion(count, msg);
+  }
+}
+
+// Returns the n_bits (<= 64) bits of bits starting at bit start_offset as the lowest
+// bits of a word whose other bits are zero. Only the bytes containing these bits
+// are read.
+static inline uint64_t nanoarrow_bitmap_word(const uint8_t* bits, int64_t start_offset,
+                                             int64_t n_bits) {
+  const uint8_t* bytes = bits + (start_offset / 8);
+  int shift = (int)(start_offset % 8);
+  int64_t n_bytes = (shift + n_bits + 7) / 8;
+
+  uint64_t word = 0;
+  for (int64_t j = 0; j < n_bytes && j < 8; j++) {
+    word |= ((uint64_t)bytes[j]) << (8 * j);
+  }
+
+  word >>= shift;
+  if (n_bytes > 8) {
+    word |= ((uint64_t)bytes[8]) << (64 - shift);
+  }
+
+  if (n_bits < 64) {
+    word &= (((uint64_t)1) << n_bits) - 1;
+  }
+
+  return word;
+}
+
+// The nanoarrow_fill_na_*() functions set the elements of values whose bit in the
+// validity bitmap is_valid (starting at bit start_offset) is not set to na_value.
+// The bitmap is scanned one 64-bit word at a time such that the common case of a
+// word without nulls costs a single comparison rather than 64 calls to ArrowBitGet().
+static inline void nanoarrow_fill_na_int(const uint8_t* is_valid, int64_t start_offset,
+                                         int* values, int64_t n, int na_value) {
+  for (int64_t i = 0; i < n; i += 64) {
+    int64_t n_bits = (n - i) < 64 ? (n - i) : 64;
+    uint64_t valid = nanoarrow_bitmap_word(is_valid, start_offset + i, n_bits);
+    if (valid == (UINT64_MAX >> (64 - n_bits))) {
+      continue;
+    }
+
+    for (int64_t j = 0; j < n_bits; j++) {
+      if (!((valid >> j) & 1)) {
+        values[i + j] = na_value;
+      }
+    }
+  }
+}
+
+static inline void nanoarrow_fill_na_int64(const uint8_t* is_valid,
+                                           int64_t start_offset, int64_t* values,
+                                           int64_t n, int64_t na_value) {
+  for (int64_t i = 0; i < n; i += 64) {
+    int64_t n_bits = (n - i) < 64 ? (n - i) : 64;
+    uint64_t valid = nanoarrow_bitmap_word(is_valid, start_offset + i, n_bits);
+    if (valid == (UINT64_MAX >> (64 - n_bits))) {
+      continue;
+    }
+
+    for (int64_t j = 0; j < n_bits; j++) {
+      if (!((valid >> j) & 1)) {
+        values[i + j] = na_value;
+      }
+    }
+  }
+}
+
+static inline void nanoarrow_fill_na_dbl(const uint8_t* is_valid, int64_t start_offset,
+                                         double* values, int64_t n, double na_value) {
+  for (int64_t i = 0; i < n; i += 64) {
+    int64_t n_bits = (n - i) < 64 ? (n - i) : 64;
+    uint64_t valid = nanoarrow_bitmap_word(is_valid, start_offset + i, n_bits);
+    if (valid == (UINT64_MAX >> (64 - n_bits))) {
+      continue;
+    }
+
+    for (int64_t j = 0; j < n_bits; j++) {
+      if (!((valid >> j) & 1)) {
+        values[i + j] = na_value;
+      }
+    }
+  }
+}
+
 #endif
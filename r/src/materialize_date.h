@@ -26,12 +26,38 @@
 #include "materialize_dbl.h"
 #include "nanoarrow.h"
 
+// Converts int32 days (i.e., the storage of a date32 array) directly rather than
+// through the generic per-element conversion to double
+static inline int nanoarrow_materialize_date_int32(struct RConverter* converter) {
+  struct ArrayViewSlice* src = &converter->src;
+  struct VectorSlice* dst = &converter->dst;
+  if (src->array_view->array->dictionary != NULL) {
+    return ENOTSUP;
+  }
+
+  const uint8_t* is_valid = src->array_view->buffer_views[0].data.as_uint8;
+  int64_t raw_src_offset = src->array_view->array->offset + src->offset;
+  const int32_t* values = src->array_view->buffer_views[1].data.as_int32 + raw_src_offset;
+  double* result = (double*)dst->data + dst->offset;
+
+  for (R_xlen_t i = 0; i < dst->length; i++) {
+    result[i] = values[i];
+  }
+
+  if (is_valid != NULL && src->array_view->array->null_count != 0) {
+    nanoarrow_fill_na_dbl(is_valid, raw_src_offset, result, dst->length, NA_REAL);
+  }
+
+  return NANOARROW_OK;
+}
+
 static int nanoarrow_materialize_date(struct RConverter* converter) {
   if (converter->ptype_view.sexp_type == REALSXP) {
     switch (converter->schema_view.type) {
       case NANOARROW_TYPE_NA:
-      case NANOARROW_TYPE_DATE32:
         return nanoarrow_materialize_dbl(converter);
+      case NANOARROW_TYPE_DATE32:
+        return nanoarrow_materialize_date_int32(converter);
       default:
         break;
     }
@@ -34,7 +34,7 @@ static inline int nanoarrow_materialize_dbl(struct RConverter* converter) {
 
   struct ArrayViewSlice* src = &converter->src;
   struct VectorSlice* dst = &converter->dst;
-  double* result = REAL(dst->vec_sexp);
+  double* result = (double*)dst->data;
   int64_t n_bad_values = 0;
 
   // True for all the types supported here
@@ -55,11 +55,8 @@ static inline int nanoarrow_materialize_dbl(struct RConverter* converter) {
 
       // Set any nulls to NA_REAL
       if (is_valid != NULL && src->array_view->array->null_count != 0) {
-        for (R_xlen_t i = 0; i < dst->length; i++) {
-          if (!ArrowBitGet(is_valid, raw_src_offset + i)) {
-            result[dst->offset + i] = NA_REAL;
-          }
-        }
+        nanoarrow_fill_na_dbl(is_valid, raw_src_offset, result + dst->offset, dst->length,
+                              NA_REAL);
       }
       break;
     case NANOARROW_TYPE_BOOL:
@@ -78,11 +75,8 @@ static inline int nanoarrow_materialize_dbl(struct RConverter* converter) {
 
       // Set any nulls to NA_REAL
       if (is_valid != NULL && src->array_view->array->null_count != 0) {
-        for (R_xlen_t i = 0; i < dst->length; i++) {
-          if (!ArrowBitGet(is_valid, raw_src_offset + i)) {
-            result[dst->offset + i] = NA_REAL;
-          }
-        }
+        nanoarrow_fill_na_dbl(is_valid, raw_src_offset, result + dst->offset, dst->length,
+                              NA_REAL);
       }
       break;
 
@@ -100,11 +94,8 @@ static inline int nanoarrow_materialize_dbl(struct RConverter* converter) {
 
       // Set any nulls to NA_REAL
       if (is_valid != NULL && src->array_view->array->null_count != 0) {
-        for (R_xlen_t i = 0; i < dst->length; i++) {
-          if (!ArrowBitGet(is_valid, raw_src_offset + i)) {
-            result[dst->offset + i] = NA_REAL;
-          }
-        }
+        nanoarrow_fill_na_dbl(is_valid, raw_src_offset, result + dst->offset, dst->length,
+                              NA_REAL);
       }
       break;
 
@@ -113,8 +104,9 @@ static inline int nanoarrow_materialize_dbl(struct RConverter* converter) {
   }
 
   if (n_bad_values > 0) {
-    warn_lossy_conversion(
-        n_bad_values, "may have incurred loss of precision in conversion to double()");
+    nanoarrow_converter_warn_lossy(
+        converter, n_bad_values,
+        "may have incurred loss of precision in conversion to double()");
   }
 
   return NANOARROW_OK;
@@ -77,7 +77,7 @@ static inline int nanoarrow_materialize_difftime(struct RConverter* converter) {
     }
 
     if (scale != 1) {
-      double* result = REAL(converter->dst.vec_sexp);
+      double* result = (double*)converter->dst.data;
       for (int64_t i = 0; i < converter->dst.length; i++) {
         result[converter->dst.offset + i] = result[converter->dst.offset + i] * scale;
       }
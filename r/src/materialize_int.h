@@ -24,14 +24,14 @@
 #include "materialize_common.h"
 #include "nanoarrow.h"
 
-static inline int nanoarrow_materialize_int(struct ArrayViewSlice* src,
-                                            struct VectorSlice* dst,
-                                            struct MaterializeOptions* options) {
-  if (src->array_view->array->dictionary != NULL) {
+static inline int nanoarrow_materialize_int(struct RConverter* converter) {
+  if (converter->src.array_view->array->dictionary != NULL) {
     return ENOTSUP;
   }
 
-  int* result = INTEGER(dst->vec_sexp);
+  struct ArrayViewSlice* src = &converter->src;
+  struct VectorSlice* dst = &converter->dst;
+  int* result = (int*)dst->data;
   int64_t n_bad_values = 0;
 
   // True for all the types supported here
@@ -52,11 +52,8 @@ static inline int nanoarrow_materialize_int(struct ArrayViewSlice* src,
 
       // Set any nulls to NA_INTEGER
       if (is_valid != NULL && src->array_view->array->null_count != 0) {
-        for (R_xlen_t i = 0; i < dst->length; i++) {
-          if (!ArrowBitGet(is_valid, raw_src_offset + i)) {
-            result[dst->offset + i] = NA_INTEGER;
-          }
-        }
+        nanoarrow_fill_na_int(is_valid, raw_src_offset, result + dst->offset, dst->length,
+                              NA_INTEGER);
       }
       break;
     case NANOARROW_TYPE_BOOL:
@@ -66,11 +63,8 @@ static inline int nanoarrow_materialize_int(struct ArrayViewSlice* src,
 
       // Set any nulls to NA_LOGICAL
       if (is_valid != NULL && src->array_view->array->null_count != 0) {
-        for (R_xlen_t i = 0; i < dst->length; i++) {
-          if (!ArrowBitGet(is_valid, raw_src_offset + i)) {
-            result[dst->offset + i] = NA_LOGICAL;
-          }
-        }
+        nanoarrow_fill_na_int(is_valid, raw_src_offset, result + dst->offset, dst->length,
+                              NA_LOGICAL);
       }
       break;
     case NANOARROW_TYPE_INT8:
@@ -85,11 +79,8 @@ static inline int nanoarrow_materialize_int(struct ArrayViewSlice* src,
 
       // Set any nulls to NA_INTEGER
       if (is_valid != NULL && src->array_view->array->null_count != 0) {
-        for (R_xlen_t i = 0; i < dst->length; i++) {
-          if (!ArrowBitGet(is_valid, raw_src_offset + i)) {
-            result[dst->offset + i] = NA_INTEGER;
-          }
-        }
+        nanoarrow_fill_na_int(is_valid, raw_src_offset, result + dst->offset, dst->length,
+                              NA_INTEGER);
       }
       break;
     case NANOARROW_TYPE_UINT32:
@@ -131,7 +122,8 @@ static inline int nanoarrow_materialize_int(struct ArrayViewSlice* src,
   }
 
   if (n_bad_values > 0) {
-    warn_lossy_conversion(n_bad_values, "outside integer range set to NA");
+    nanoarrow_converter_warn_lossy(converter, n_bad_values,
+                                   "outside integer range set to NA");
   }
 
   return NANOARROW_OK;
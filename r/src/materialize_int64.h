@@ -26,14 +26,14 @@
 
 #define NA_INTEGER64 INT64_MIN
 
-static inline int nanoarrow_materialize_int64(struct ArrayViewSlice* src,
-                                              struct VectorSlice* dst,
-                                              struct MaterializeOptions* options) {
-  if (src->array_view->array->dictionary != NULL) {
+static inline int nanoarrow_materialize_int64(struct RConverter* converter) {
+  if (converter->src.array_view->array->dictionary != NULL) {
     return ENOTSUP;
   }
 
-  int64_t* result = (int64_t*)REAL(dst->vec_sexp);
+  struct ArrayViewSlice* src = &converter->src;
+  struct VectorSlice* dst = &converter->dst;
+  int64_t* result = (int64_t*)dst->data;
   int64_t n_bad_values = 0;
 
   // True for all the types supported here
@@ -49,16 +49,13 @@ static inline int nanoarrow_materialize_int64(struct ArrayViewSlice* src,
       break;
     case NANOARROW_TYPE_INT64:
       memcpy(result + dst->offset,
-             src->array_view->buffer_views[1].data.as_int32 + raw_src_offset,
+             src->array_view->buffer_views[1].data.as_int64 + raw_src_offset,
              dst->length * sizeof(int64_t));
 
       // Set any nulls to NA_INTEGER64
       if (is_valid != NULL && src->array_view->array->null_count != 0) {
-        for (R_xlen_t i = 0; i < dst->length; i++) {
-          if (!ArrowBitGet(is_valid, raw_src_offset + i)) {
-            result[dst->offset + i] = NA_INTEGER64;
-          }
-        }
+        nanoarrow_fill_na_int64(is_valid, raw_src_offset, result + dst->offset,
+                                dst->length, NA_INTEGER64);
       }
       break;
     case NANOARROW_TYPE_BOOL:
@@ -76,11 +73,8 @@ static inline int nanoarrow_materialize_int64(struct ArrayViewSlice* src,
 
       // Set any nulls to NA_INTEGER
       if (is_valid != NULL && src->array_view->array->null_count != 0) {
-        for (R_xlen_t i = 0; i < dst->length; i++) {
-          if (!ArrowBitGet(is_valid, raw_src_offset + i)) {
-            result[dst->offset + i] = NA_INTEGER64;
-          }
-        }
+        nanoarrow_fill_na_int64(is_valid, raw_src_offset, result + dst->offset,
+                                dst->length, NA_INTEGER64);
       }
       break;
     case NANOARROW_TYPE_UINT64:
@@ -120,7 +114,8 @@ static inline int nanoarrow_materialize_int64(struct ArrayViewSlice* src,
   }
 
   if (n_bad_values > 0) {
-    warn_lossy_conversion(n_bad_values, "outside integer64 range set to NA");
+    nanoarrow_converter_warn_lossy(converter, n_bad_values,
+                                   "outside integer64 range set to NA");
   }
 
   return NANOARROW_OK;
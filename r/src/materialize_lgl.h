@@ -34,7 +34,7 @@ static int nanoarrow_materialize_lgl(struct ArrayViewSlice* src, struct VectorSl
   const uint8_t* is_valid = src->array_view->buffer_views[0].data.as_uint8;
   const uint8_t* data_buffer = src->array_view->buffer_views[1].data.as_uint8;
   int64_t raw_src_offset = src->array_view->array->offset + src->offset;
-  int* result = LOGICAL(dst->vec_sexp);
+  int* result = (int*)dst->data;
 
   // Fill the buffer
   switch (src->array_view->storage_type) {
@@ -49,11 +49,8 @@ static int nanoarrow_materialize_lgl(struct ArrayViewSlice* src, struct VectorSl
 
       // Set any nulls to NA_LOGICAL
       if (is_valid != NULL && src->array_view->array->null_count != 0) {
-        for (R_xlen_t i = 0; i < dst->length; i++) {
-          if (!ArrowBitGet(is_valid, raw_src_offset + i)) {
-            result[dst->offset + i] = NA_LOGICAL;
-          }
-        }
+        nanoarrow_fill_na_int(is_valid, raw_src_offset, result + dst->offset, dst->length,
+                              NA_LOGICAL);
       }
       break;
     case NANOARROW_TYPE_INT8:
@@ -73,11 +70,8 @@ static int nanoarrow_materialize_lgl(struct ArrayViewSlice* src, struct VectorSl
 
       // Set any nulls to NA_LOGICAL
       if (is_valid != NULL && src->array_view->array->null_count != 0) {
-        for (R_xlen_t i = 0; i < dst->length; i++) {
-          if (!ArrowBitGet(is_valid, raw_src_offset + i)) {
-            result[dst->offset + i] = NA_LOGICAL;
-          }
-        }
+        nanoarrow_fill_na_int(is_valid, raw_src_offset, result + dst->offset, dst->length,
+                              NA_LOGICAL);
       }
       break;
 
@@ -25,21 +25,65 @@
 #include "materialize_dbl.h"
 #include "nanoarrow.h"
 
+// Converts int64 values (i.e., the storage of timestamp and date64 arrays) to seconds
+// in a single pass over the data buffer rather than converting each element to double
+// and scaling the output afterward
+static inline int nanoarrow_materialize_posixct_int64(struct RConverter* converter,
+                                                      double scale) {
+  struct ArrayViewSlice* src = &converter->src;
+  struct VectorSlice* dst = &converter->dst;
+  if (src->array_view->array->dictionary != NULL) {
+    return ENOTSUP;
+  }
+
+  const uint8_t* is_valid = src->array_view->buffer_views[0].data.as_uint8;
+  int64_t raw_src_offset = src->array_view->array->offset + src->offset;
+  const int64_t* values = src->array_view->buffer_views[1].data.as_int64 + raw_src_offset;
+  double* result = (double*)dst->data + dst->offset;
+
+  int64_t n_bad_values = 0;
+  for (R_xlen_t i = 0; i < dst->length; i++) {
+    double value = (double)values[i];
+    n_bad_values += value > MAX_DBL_AS_INTEGER || value < -MAX_DBL_AS_INTEGER;
+    result[i] = value * scale;
+  }
+
+  int has_nulls = is_valid != NULL && src->array_view->array->null_count != 0;
+  if (has_nulls) {
+    nanoarrow_fill_na_dbl(is_valid, raw_src_offset, result, dst->length, NA_REAL);
+  }
+
+  // The content of a null slot is undefined, so recount any values that can't be
+  // represented exactly considering only non-null values
+  if (n_bad_values > 0 && has_nulls) {
+    n_bad_values = 0;
+    for (R_xlen_t i = 0; i < dst->length; i++) {
+      double value = (double)values[i];
+      n_bad_values += (value > MAX_DBL_AS_INTEGER || value < -MAX_DBL_AS_INTEGER) &&
+                      ArrowBitGet(is_valid, raw_src_offset + i);
+    }
+  }
+
+  if (n_bad_values > 0) {
+    nanoarrow_converter_warn_lossy(
+        converter, n_bad_values,
+        "may have incurred loss of precision in conversion to double()");
+  }
+
+  return NANOARROW_OK;
+}
+
 static inline int nanoarrow_materialize_posixct(struct RConverter* converter) {
   if (converter->ptype_view.sexp_type == REALSXP) {
     enum ArrowTimeUnit time_unit;
     switch (converter->schema_view.type) {
       case NANOARROW_TYPE_NA:
-        time_unit = NANOARROW_TIME_UNIT_SECOND;
-        NANOARROW_RETURN_NOT_OK(nanoarrow_materialize_dbl(converter));
-        break;
+        return nanoarrow_materialize_dbl(converter);
       case NANOARROW_TYPE_DATE64:
         time_unit = NANOARROW_TIME_UNIT_MILLI;
-        NANOARROW_RETURN_NOT_OK(nanoarrow_materialize_dbl(converter));
         break;
       case NANOARROW_TYPE_TIMESTAMP:
         time_unit = converter->schema_view.time_unit;
-        NANOARROW_RETURN_NOT_OK(nanoarrow_materialize_dbl(converter));
         break;
       default:
         return EINVAL;
@@ -63,14 +107,7 @@ static inline int nanoarrow_materialize_posixct(struct RConverter* converter) {
         return EINVAL;
     }
 
-    if (scale != 1) {
-      double* result = REAL(converter->dst.vec_sexp);
-      for (int64_t i = 0; i < converter->dst.length; i++) {
-        result[converter->dst.offset + i] = result[converter->dst.offset + i] * scale;
-      }
-    }
-
-    return NANOARROW_OK;
+    return nanoarrow_materialize_posixct_int64(converter, scale);
   }
 
   return EINVAL;
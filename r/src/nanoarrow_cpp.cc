@@ -19,6 +19,7 @@
 #include <R.h>
 #include <Rinternals.h>
 
+#include <atomic>
 #include <cstdint>
 #include <cstring>
 #include <mutex>
@@ -196,6 +197,32 @@ extern "C" int nanoarrow_is_main_thread(void) {
   return PreservedSEXPRegistry::GetInstance().is_main_thread();
 }
 
+extern "C" void nanoarrow_parallel_for(int64_t n, int n_threads,
+                                       void (*fun)(int64_t i, void* data), void* data) {
+  std::atomic<int64_t> next(0);
+  auto work = [&] {
+    for (int64_t i = next++; i < n; i = next++) {
+      fun(i, data);
+    }
+  };
+
+  // If a thread can't be started, the remaining work is done by the threads that
+  // could (including this one)
+  std::vector<std::thread> workers;
+  for (int64_t i = 1; i < n_threads && i < n; i++) {
+    try {
+      workers.emplace_back(work);
+    } catch (std::exception& e) {
+      break;
+    }
+  }
+
+  work();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
 extern "C" void nanoarrow_preserve_and_release_on_other_thread(SEXP obj) {
   nanoarrow_preserve_sexp(obj);
   std::thread worker([obj] { nanoarrow_release_sexp(obj); });
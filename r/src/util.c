@@ -29,6 +29,7 @@ SEXP nanoarrow_cls_data_frame = NULL;
 SEXP nanoarrow_cls_schema = NULL;
 SEXP nanoarrow_cls_array_stream = NULL;
 SEXP nanoarrow_cls_buffer = NULL;
+SEXP nanoarrow_cls_integer64 = NULL;
 
 void nanoarrow_init_cached_sexps(void) {
   SEXP nanoarrow_str = PROTECT(Rf_mkString("nanoarrow"));
@@ -40,6 +41,7 @@ void nanoarrow_init_cached_sexps(void) {
   nanoarrow_cls_schema = PROTECT(Rf_mkString("nanoarrow_schema"));
   nanoarrow_cls_array_stream = PROTECT(Rf_mkString("nanoarrow_array_stream"));
   nanoarrow_cls_buffer = PROTECT(Rf_mkString("nanoarrow_buffer"));
+  nanoarrow_cls_integer64 = PROTECT(Rf_mkString("integer64"));
 
   R_PreserveObject(nanoarrow_ns_pkg);
   R_PreserveObject(nanoarrow_cls_array);
@@ -49,8 +51,9 @@ void nanoarrow_init_cached_sexps(void) {
   R_PreserveObject(nanoarrow_cls_schema);
   R_PreserveObject(nanoarrow_cls_array_stream);
   R_PreserveObject(nanoarrow_cls_buffer);
+  R_PreserveObject(nanoarrow_cls_integer64);
 
-  UNPROTECT(9);
+  UNPROTECT(10);
 }
 
 SEXP nanoarrow_c_preserved_count(void) {
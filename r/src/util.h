@@ -31,6 +31,7 @@ extern SEXP nanoarrow_cls_data_frame;
 extern SEXP nanoarrow_cls_schema;
 extern SEXP nanoarrow_cls_array_stream;
 extern SEXP nanoarrow_cls_buffer;
+extern SEXP nanoarrow_cls_integer64;
 
 void nanoarrow_init_cached_sexps(void);
 
@@ -45,6 +46,12 @@ int64_t nanoarrow_preserved_count(void);
 int64_t nanoarrow_preserved_empty(void);
 int nanoarrow_is_main_thread(void);
 
+// Calls fun(i, data) for each i between 0 and n - 1 on up to n_threads threads
+// (including the calling thread) and returns when all calls have returned. fun must
+// not call the R API unless n_threads is 1.
+void nanoarrow_parallel_for(int64_t n, int n_threads, void (*fun)(int64_t i, void* data),
+                            void* data);
+
 // For testing
 void nanoarrow_preserve_and_release_on_other_thread(SEXP obj);
 
@@ -16,10 +16,15 @@
 // under the License.
 
 #include <errno.h>
+#include <float.h>
 #include <stdlib.h>
 #include <string.h>
 
+// The number of elements read at a time by kernels that buffer values on the stack
+#define NANOARROW_KERNEL_BLOCK_SIZE 256
+
 #include "nanoarrow.h"
+#include "nanoarrow_atomic_internal.h"
 
 static void ArrowArrayRelease(struct ArrowArray* array) {
   // Release buffers held by this array
@@ -29,6 +34,18 @@ static void ArrowArrayRelease(struct ArrowArray* array) {
     ArrowBitmapReset(&private_data->bitmap);
     ArrowBufferReset(&private_data->buffers[0]);
     ArrowBufferReset(&private_data->buffers[1]);
+    for (int64_t i = 0; i < private_data->n_variadic_buffers; i++) {
+      ArrowBufferReset(&private_data->variadic_buffers[i]);
+    }
+    if (private_data->variadic_buffers != NULL) {
+      ArrowFree(private_data->variadic_buffers);
+    }
+    if (private_data->variadic_buffer_sizes != NULL) {
+      ArrowFree(private_data->variadic_buffer_sizes);
+    }
+    if (private_data->variadic_buffer_data != NULL) {
+      ArrowFree(private_data->variadic_buffer_data);
+    }
     ArrowFree(private_data);
   }
 
@@ -69,6 +86,7 @@ static ArrowErrorCode ArrowArraySetStorageType(struct ArrowArray* array,
   switch (storage_type) {
     case NANOARROW_TYPE_UNINITIALIZED:
     case NANOARROW_TYPE_NA:
+    case NANOARROW_TYPE_RUN_END_ENCODED:
       array->n_buffers = 0;
       break;
 
@@ -107,6 +125,14 @@ static ArrowErrorCode ArrowArraySetStorageType(struct ArrowArray* array,
     case NANOARROW_TYPE_LARGE_STRING:
     case NANOARROW_TYPE_BINARY:
     case NANOARROW_TYPE_LARGE_BINARY:
+    case NANOARROW_TYPE_LIST_VIEW:
+    case NANOARROW_TYPE_LARGE_LIST_VIEW:
+      array->n_buffers = 3;
+      break;
+
+    // validity + views + variadic buffer sizes until a variadic buffer is added
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_STRING_VIEW:
       array->n_buffers = 3;
       break;
 
@@ -148,6 +174,10 @@ ArrowErrorCode ArrowArrayInitFromType(struct ArrowArray* array,
   private_data->buffer_data[0] = NULL;
   private_data->buffer_data[1] = NULL;
   private_data->buffer_data[2] = NULL;
+  private_data->n_variadic_buffers = 0;
+  private_data->variadic_buffers = NULL;
+  private_data->variadic_buffer_sizes = NULL;
+  private_data->variadic_buffer_data = NULL;
 
   array->private_data = private_data;
   array->buffers = (const void**)(&private_data->buffer_data);
@@ -162,6 +192,7 @@ ArrowErrorCode ArrowArrayInitFromType(struct ArrowArray* array,
   // We can only know this not to be true when initializing based on a schema
   // so assume this to be true.
   private_data->union_type_id_is_child_index = 1;
+  private_data->built_by_append = 1;
   return NANOARROW_OK;
 }
 
@@ -282,6 +313,7 @@ void ArrowArraySetValidityBitmap(struct ArrowArray* array, struct ArrowBitmap* b
   private_data->bitmap.size_bits = bitmap->size_bits;
   bitmap->size_bits = 0;
   private_data->buffer_data[0] = private_data->bitmap.buffer.data;
+  private_data->built_by_append = 0;
   array->null_count = -1;
 }
 
@@ -290,6 +322,12 @@ ArrowErrorCode ArrowArraySetBuffer(struct ArrowArray* array, int64_t i,
   struct ArrowArrayPrivateData* private_data =
       (struct ArrowArrayPrivateData*)array->private_data;
 
+  // The third buffer of a binary or string view array is managed by the builder
+  if (i == 2 && (private_data->storage_type == NANOARROW_TYPE_BINARY_VIEW ||
+                 private_data->storage_type == NANOARROW_TYPE_STRING_VIEW)) {
+    return EINVAL;
+  }
+
   switch (i) {
     case 0:
       ArrowBufferMove(buffer, &private_data->bitmap.buffer);
@@ -304,6 +342,69 @@ ArrowErrorCode ArrowArraySetBuffer(struct ArrowArray* array, int64_t i,
       return EINVAL;
   }
 
+  private_data->built_by_append = 0;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArraySetFixedSizeListValues(struct ArrowArray* array,
+                                                struct ArrowBuffer* values) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  if (private_data->storage_type != NANOARROW_TYPE_FIXED_SIZE_LIST ||
+      array->length != 0 || array->children[0]->length != 0) {
+    return EINVAL;
+  }
+
+  struct ArrowArray* child = array->children[0];
+  struct ArrowArrayPrivateData* child_private_data =
+      (struct ArrowArrayPrivateData*)child->private_data;
+  int64_t element_size_bits = child_private_data->layout.element_size_bits[1];
+  if (child_private_data->layout.buffer_type[1] != NANOARROW_BUFFER_TYPE_DATA ||
+      child_private_data->layout.buffer_type[2] != NANOARROW_BUFFER_TYPE_NONE ||
+      element_size_bits < 8 || child->n_children != 0 || child->dictionary != NULL) {
+    return EINVAL;
+  }
+
+  int64_t list_size = private_data->layout.child_size_elements;
+  int64_t list_size_bytes = list_size * (element_size_bits / 8);
+  if (list_size_bytes == 0 || (values->size_bytes % list_size_bytes) != 0) {
+    return EINVAL;
+  }
+
+  int64_t n = values->size_bytes / list_size_bytes;
+  NANOARROW_RETURN_NOT_OK(ArrowArraySetBuffer(child, 1, values));
+  child->length = n * list_size;
+  child->null_count = 0;
+  array->length = n;
+  array->null_count = 0;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArraySetAllocator(struct ArrowArray* array,
+                                      struct ArrowBufferAllocator allocator) {
+  if (array->release != &ArrowArrayRelease) {
+    return EINVAL;
+  }
+
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowBufferSetAllocator(&private_data->bitmap.buffer, allocator));
+  NANOARROW_RETURN_NOT_OK(ArrowBufferSetAllocator(&private_data->buffers[0], allocator));
+  NANOARROW_RETURN_NOT_OK(ArrowBufferSetAllocator(&private_data->buffers[1], allocator));
+  for (int64_t i = 0; i < private_data->n_variadic_buffers; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferSetAllocator(&private_data->variadic_buffers[i], allocator));
+  }
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowArraySetAllocator(array->children[i], allocator));
+  }
+
+  if (array->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowArraySetAllocator(array->dictionary, allocator));
+  }
+
   return NANOARROW_OK;
 }
 
@@ -326,6 +427,13 @@ static ArrowErrorCode ArrowArrayViewInitFromArray(struct ArrowArrayView* array_v
   array_view->buffer_views[2].data.as_uint8 = private_data->buffers[1].data;
   array_view->buffer_views[2].size_bytes = private_data->buffers[1].size_bytes;
 
+  // The variadic buffer pointers are synchronized by ArrowArrayFlushInternalPointers()
+  if (private_data->n_variadic_buffers > 0) {
+    array_view->n_variadic_buffers = private_data->n_variadic_buffers;
+    array_view->variadic_buffers = private_data->variadic_buffer_data + 2;
+    array_view->variadic_buffer_sizes = private_data->variadic_buffer_sizes;
+  }
+
   int result = ArrowArrayViewAllocateChildren(array_view, array->n_children);
   if (result != NANOARROW_OK) {
     ArrowArrayViewReset(array_view);
@@ -360,19 +468,19 @@ static ArrowErrorCode ArrowArrayViewInitFromArray(struct ArrowArrayView* array_v
 static ArrowErrorCode ArrowArrayReserveInternal(struct ArrowArray* array,
                                                 struct ArrowArrayView* array_view) {
   // Loop through buffers and reserve the extra space that we know about
-  for (int64_t i = 0; i < array->n_buffers; i++) {
+  for (int64_t i = 0; i < array->n_buffers && i < NANOARROW_MAX_FIXED_BUFFERS; i++) {
     // Don't reserve on a validity buffer that hasn't been allocated yet
     if (array_view->layout.buffer_type[i] == NANOARROW_BUFFER_TYPE_VALIDITY &&
-        ArrowArrayBuffer(array, i)->data == NULL) {
+        _ArrowArrayBuffer(array, i)->data == NULL) {
       continue;
     }
 
     int64_t additional_size_bytes =
-        array_view->buffer_views[i].size_bytes - ArrowArrayBuffer(array, i)->size_bytes;
+        array_view->buffer_views[i].size_bytes - _ArrowArrayBuffer(array, i)->size_bytes;
 
     if (additional_size_bytes > 0) {
       NANOARROW_RETURN_NOT_OK(
-          ArrowBufferReserve(ArrowArrayBuffer(array, i), additional_size_bytes));
+          ArrowBufferReserve(_ArrowArrayBuffer(array, i), additional_size_bytes));
     }
   }
 
@@ -403,790 +511,9328 @@ ArrowErrorCode ArrowArrayReserve(struct ArrowArray* array,
   return NANOARROW_OK;
 }
 
-static ArrowErrorCode ArrowArrayFinalizeBuffers(struct ArrowArray* array) {
+ArrowErrorCode ArrowArrayReserveShape(struct ArrowArray* array,
+                                      const struct ArrowArrayShape* shape) {
   struct ArrowArrayPrivateData* private_data =
       (struct ArrowArrayPrivateData*)array->private_data;
 
-  // The only buffer finalizing this currently does is make sure the data
-  // buffer for (Large)String|Binary is never NULL
+  if (shape->length < 0 || shape->data_size_bytes < 0 ||
+      (shape->n_children != 0 && shape->n_children != array->n_children)) {
+    return EINVAL;
+  }
+
+  for (int64_t i = 0; i < array->n_buffers && i < NANOARROW_MAX_FIXED_BUFFERS; i++) {
+    struct ArrowBuffer* buffer = _ArrowArrayBuffer(array, i);
+    int64_t element_size_bits = private_data->layout.element_size_bits[i];
+    int64_t additional_size_bytes;
+
+    switch (private_data->layout.buffer_type[i]) {
+      case NANOARROW_BUFFER_TYPE_NONE:
+        continue;
+      case NANOARROW_BUFFER_TYPE_VALIDITY:
+        // Don't reserve on a validity buffer that hasn't been allocated yet
+        if (buffer->data == NULL) {
+          continue;
+        }
+        additional_size_bytes =
+            _ArrowBytesForBits(array->length + shape->length) - buffer->size_bytes;
+        break;
+      default:
+        if (element_size_bits == 0) {
+          additional_size_bytes = shape->data_size_bytes;
+        } else if (element_size_bits == 1) {
+          additional_size_bytes =
+              _ArrowBytesForBits(array->length + shape->length) - buffer->size_bytes;
+        } else {
+          additional_size_bytes = shape->length * element_size_bits / 8;
+        }
+        break;
+    }
+
+    if (additional_size_bytes > 0) {
+      NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(buffer, additional_size_bytes));
+    }
+  }
+
+  if (shape->n_children != 0) {
+    for (int64_t i = 0; i < array->n_children; i++) {
+      NANOARROW_RETURN_NOT_OK(
+          ArrowArrayReserveShape(array->children[i], shape->children[i]));
+    }
+
+    return NANOARROW_OK;
+  }
+
+  // Derive the shape of children whose length is determined by this array
+  struct ArrowArrayShape child_shape = {0, 0, 0, NULL};
   switch (private_data->storage_type) {
-    case NANOARROW_TYPE_BINARY:
-    case NANOARROW_TYPE_STRING:
-    case NANOARROW_TYPE_LARGE_BINARY:
-    case NANOARROW_TYPE_LARGE_STRING:
-      if (ArrowArrayBuffer(array, 2)->data == NULL) {
-        ArrowBufferAppendUInt8(ArrowArrayBuffer(array, 2), 0);
-      }
+    case NANOARROW_TYPE_STRUCT:
+    case NANOARROW_TYPE_SPARSE_UNION:
+      child_shape.length = shape->length;
       break;
-    default:
+    case NANOARROW_TYPE_FIXED_SIZE_LIST:
+      child_shape.length = shape->length * private_data->layout.child_size_elements;
       break;
+    default:
+      return NANOARROW_OK;
   }
 
   for (int64_t i = 0; i < array->n_children; i++) {
-    NANOARROW_RETURN_NOT_OK(ArrowArrayFinalizeBuffers(array->children[i]));
-  }
-
-  if (array->dictionary != NULL) {
-    NANOARROW_RETURN_NOT_OK(ArrowArrayFinalizeBuffers(array->dictionary));
+    NANOARROW_RETURN_NOT_OK(ArrowArrayReserveShape(array->children[i], &child_shape));
   }
 
   return NANOARROW_OK;
 }
 
-static void ArrowArrayFlushInternalPointers(struct ArrowArray* array) {
+#if defined(NANOARROW_WITH_BUFFER_STATS)
+static void ArrowArrayAddBuildStats(const struct ArrowBuffer* buffer,
+                                    struct ArrowArrayBuildStats* out) {
+  out->n_reallocations += buffer->n_reallocations;
+  out->bytes_reallocated += buffer->bytes_reallocated;
+}
+
+static void ArrowArrayGetBuildStatsInternal(struct ArrowArray* array,
+                                            struct ArrowArrayBuildStats* out) {
   struct ArrowArrayPrivateData* private_data =
       (struct ArrowArrayPrivateData*)array->private_data;
 
-  for (int64_t i = 0; i < 3; i++) {
-    private_data->buffer_data[i] = ArrowArrayBuffer(array, i)->data;
+  ArrowArrayAddBuildStats(&private_data->bitmap.buffer, out);
+  ArrowArrayAddBuildStats(private_data->buffers + 0, out);
+  ArrowArrayAddBuildStats(private_data->buffers + 1, out);
+  for (int64_t i = 0; i < private_data->n_variadic_buffers; i++) {
+    ArrowArrayAddBuildStats(private_data->variadic_buffers + i, out);
   }
 
   for (int64_t i = 0; i < array->n_children; i++) {
-    ArrowArrayFlushInternalPointers(array->children[i]);
+    ArrowArrayGetBuildStatsInternal(array->children[i], out);
   }
 
   if (array->dictionary != NULL) {
-    ArrowArrayFlushInternalPointers(array->dictionary);
+    ArrowArrayGetBuildStatsInternal(array->dictionary, out);
   }
 }
+#endif
+
+ArrowErrorCode ArrowArrayGetBuildStats(struct ArrowArray* array,
+                                       struct ArrowArrayBuildStats* out) {
+  out->n_reallocations = 0;
+  out->bytes_reallocated = 0;
+#if defined(NANOARROW_WITH_BUFFER_STATS)
+  ArrowArrayGetBuildStatsInternal(array, out);
+  return NANOARROW_OK;
+#else
+  (void)array;
+  return ENOTSUP;
+#endif
+}
 
-ArrowErrorCode ArrowArrayFinishBuilding(struct ArrowArray* array,
-                                        enum ArrowValidationLevel validation_level,
-                                        struct ArrowError* error) {
-  // Even if the data buffer is size zero, the pointer value needed to be non-null
-  // in some implementations (at least one version of Arrow C++ at the time this
-  // was added). Only do this fix if we can assume CPU data access.
-  if (validation_level >= NANOARROW_VALIDATION_LEVEL_DEFAULT) {
-    NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowArrayFinalizeBuffers(array), error);
+// A capacity hint holds the size of each fixed buffer of each node of an array tree
+// (children before the dictionary, depth first) as int64_t values
+static ArrowErrorCode ArrowArrayCapacityHintUpdateInternal(struct ArrowArray* array,
+                                                           struct ArrowBuffer* hint,
+                                                           int64_t* hint_i, int append) {
+  for (int64_t i = 0; i < NANOARROW_MAX_FIXED_BUFFERS; i++) {
+    int64_t size_bytes = _ArrowArrayBuffer(array, i)->size_bytes;
+    if (append) {
+      NANOARROW_RETURN_NOT_OK(ArrowBufferAppendInt64(hint, size_bytes));
+    } else {
+      if ((*hint_i + 1) * (int64_t)sizeof(int64_t) > hint->size_bytes) {
+        return EINVAL;
+      }
+
+      int64_t* hint_values = (int64_t*)hint->data;
+      if (size_bytes > hint_values[*hint_i]) {
+        hint_values[*hint_i] = size_bytes;
+      }
+    }
+
+    (*hint_i)++;
   }
 
-  // Make sure the value we get with array->buffers[i] is set to the actual
-  // pointer (which may have changed from the original due to reallocation)
-  ArrowArrayFlushInternalPointers(array);
+  for (int64_t i = 0; i < array->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayCapacityHintUpdateInternal(array->children[i], hint, hint_i, append));
+  }
 
-  if (validation_level == NANOARROW_VALIDATION_LEVEL_NONE) {
-    return NANOARROW_OK;
+  if (array->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayCapacityHintUpdateInternal(array->dictionary, hint, hint_i, append));
   }
 
-  // For validation, initialize an ArrowArrayView with our known buffer sizes
-  struct ArrowArrayView array_view;
-  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowArrayViewInitFromArray(&array_view, array),
-                                     error);
-  int result = ArrowArrayViewValidate(&array_view, validation_level, error);
-  ArrowArrayViewReset(&array_view);
-  return result;
+  return NANOARROW_OK;
 }
 
-ArrowErrorCode ArrowArrayFinishBuildingDefault(struct ArrowArray* array,
-                                               struct ArrowError* error) {
-  return ArrowArrayFinishBuilding(array, NANOARROW_VALIDATION_LEVEL_DEFAULT, error);
-}
+ArrowErrorCode ArrowArrayCapacityHintUpdate(struct ArrowArray* array,
+                                            struct ArrowBuffer* hint) {
+  int64_t hint_i = 0;
+  int append = hint->size_bytes == 0;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowArrayCapacityHintUpdateInternal(array, hint, &hint_i, append));
+  if ((hint_i * (int64_t)sizeof(int64_t)) != hint->size_bytes) {
+    return EINVAL;
+  }
 
-void ArrowArrayViewInitFromType(struct ArrowArrayView* array_view,
-                                enum ArrowType storage_type) {
-  memset(array_view, 0, sizeof(struct ArrowArrayView));
-  array_view->storage_type = storage_type;
-  ArrowLayoutInit(&array_view->layout, storage_type);
+  return NANOARROW_OK;
 }
 
-ArrowErrorCode ArrowArrayViewAllocateChildren(struct ArrowArrayView* array_view,
-                                              int64_t n_children) {
-  if (array_view->children != NULL) {
+static ArrowErrorCode ArrowArrayReserveFromHintInternal(struct ArrowArray* array,
+                                                        const int64_t* hint_values,
+                                                        int64_t n_hint_values,
+                                                        int64_t* hint_i) {
+  if ((*hint_i + NANOARROW_MAX_FIXED_BUFFERS) > n_hint_values) {
     return EINVAL;
   }
 
-  array_view->children =
-      (struct ArrowArrayView**)ArrowMalloc(n_children * sizeof(struct ArrowArrayView*));
-  if (array_view->children == NULL) {
-    return ENOMEM;
-  }
+  for (int64_t i = 0; i < NANOARROW_MAX_FIXED_BUFFERS; i++) {
+    struct ArrowBuffer* buffer = _ArrowArrayBuffer(array, i);
+    int64_t additional_size_bytes = hint_values[*hint_i + i] - buffer->size_bytes;
 
-  for (int64_t i = 0; i < n_children; i++) {
-    array_view->children[i] = NULL;
+    // A validity buffer that hasn't been allocated can only be allocated before the
+    // first element is appended (later, it must be allocated with its bits set)
+    int unallocated_validity = i == 0 && buffer->data == NULL && array->length > 0;
+    if (additional_size_bytes > 0 && !unallocated_validity) {
+      NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(buffer, additional_size_bytes));
+    }
   }
 
-  array_view->n_children = n_children;
+  *hint_i += NANOARROW_MAX_FIXED_BUFFERS;
 
-  for (int64_t i = 0; i < n_children; i++) {
-    array_view->children[i] =
-        (struct ArrowArrayView*)ArrowMalloc(sizeof(struct ArrowArrayView));
-    if (array_view->children[i] == NULL) {
-      return ENOMEM;
-    }
-    ArrowArrayViewInitFromType(array_view->children[i], NANOARROW_TYPE_UNINITIALIZED);
+  for (int64_t i = 0; i < array->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayReserveFromHintInternal(
+        array->children[i], hint_values, n_hint_values, hint_i));
+  }
+
+  if (array->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayReserveFromHintInternal(
+        array->dictionary, hint_values, n_hint_values, hint_i));
   }
 
   return NANOARROW_OK;
 }
 
-ArrowErrorCode ArrowArrayViewAllocateDictionary(struct ArrowArrayView* array_view) {
-  if (array_view->dictionary != NULL) {
+ArrowErrorCode ArrowArrayReserveFromHint(struct ArrowArray* array,
+                                         const struct ArrowBuffer* hint) {
+  int64_t hint_i = 0;
+  int64_t n_hint_values = hint->size_bytes / (int64_t)sizeof(int64_t);
+  NANOARROW_RETURN_NOT_OK(ArrowArrayReserveFromHintInternal(
+      array, (const int64_t*)hint->data, n_hint_values, &hint_i));
+  if (hint_i != n_hint_values) {
     return EINVAL;
   }
 
-  array_view->dictionary =
-      (struct ArrowArrayView*)ArrowMalloc(sizeof(struct ArrowArrayView));
-  if (array_view->dictionary == NULL) {
-    return ENOMEM;
-  }
-
-  ArrowArrayViewInitFromType(array_view->dictionary, NANOARROW_TYPE_UNINITIALIZED);
   return NANOARROW_OK;
 }
 
-ArrowErrorCode ArrowArrayViewInitFromSchema(struct ArrowArrayView* array_view,
-                                            struct ArrowSchema* schema,
-                                            struct ArrowError* error) {
-  struct ArrowSchemaView schema_view;
-  int result = ArrowSchemaViewInit(&schema_view, schema, error);
-  if (result != NANOARROW_OK) {
-    return result;
+// Append length bits starting at bit offset of bits to a bit-packed data buffer
+// whose first out_offset bits are already in use
+static ArrowErrorCode ArrowArrayAppendBitsFromView(struct ArrowBuffer* buffer,
+                                                   int64_t out_offset,
+                                                   const uint8_t* bits, int64_t offset,
+                                                   int64_t length) {
+  int64_t bytes_required = _ArrowBytesForBits(out_offset + length);
+  if (bytes_required > buffer->size_bytes) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferAppendFill(buffer, 0, bytes_required - buffer->size_bytes));
   }
 
-  ArrowArrayViewInitFromType(array_view, schema_view.storage_type);
-  array_view->layout = schema_view.layout;
+  ArrowBitsAnd(bits, offset, bits, offset, length, buffer->data, out_offset);
+  return NANOARROW_OK;
+}
 
-  result = ArrowArrayViewAllocateChildren(array_view, schema->n_children);
-  if (result != NANOARROW_OK) {
-    ArrowErrorSet(error, "ArrowArrayViewAllocateChildren() failed");
-    ArrowArrayViewReset(array_view);
-    return result;
+// Append the offsets for elements [offset, offset + length) of offsets_view to
+// offsets_buffer, rebased such that they continue from the last offset already
+// present in offsets_buffer. Sets *first_out and *n_out to the range of values
+// (i.e., bytes or child elements) referred to by the appended offsets.
+static ArrowErrorCode ArrowArrayAppendOffsetsFromView(struct ArrowBuffer* offsets_buffer,
+                                                      enum ArrowType offset_type,
+                                                      struct ArrowBufferView offsets_view,
+                                                      int64_t offset, int64_t length,
+                                                      int64_t* first_out,
+                                                      int64_t* n_out) {
+  int64_t first;
+  int64_t last;
+  int64_t base;
+
+  // ArrowArrayStartAppending() appends the first offset
+  if (offsets_buffer->size_bytes == 0) {
+    return EINVAL;
   }
 
-  for (int64_t i = 0; i < schema->n_children; i++) {
-    result =
-        ArrowArrayViewInitFromSchema(array_view->children[i], schema->children[i], error);
-    if (result != NANOARROW_OK) {
-      ArrowArrayViewReset(array_view);
-      return result;
+  if (offset_type == NANOARROW_TYPE_INT32) {
+    const int32_t* src = offsets_view.data.as_int32 + offset;
+    first = src[0];
+    last = src[length];
+    base = ((int32_t*)offsets_buffer->data)[offsets_buffer->size_bytes /
+                                            (int64_t)sizeof(int32_t) -
+                                            1] -
+           first;
+    if (last < first) {
+      return EINVAL;
     }
-  }
 
-  if (schema->dictionary != NULL) {
-    result = ArrowArrayViewAllocateDictionary(array_view);
-    if (result != NANOARROW_OK) {
-      ArrowArrayViewReset(array_view);
-      return result;
+    if ((last + base) > INT32_MAX) {
+      return EOVERFLOW;
     }
 
-    result =
-        ArrowArrayViewInitFromSchema(array_view->dictionary, schema->dictionary, error);
-    if (result != NANOARROW_OK) {
-      ArrowArrayViewReset(array_view);
-      return result;
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferReserve(offsets_buffer, length * (int64_t)sizeof(int32_t)));
+    int32_t* dst = (int32_t*)(offsets_buffer->data + offsets_buffer->size_bytes);
+    for (int64_t i = 0; i < length; i++) {
+      dst[i] = (int32_t)(src[i + 1] + base);
     }
-  }
-
-  if (array_view->storage_type == NANOARROW_TYPE_SPARSE_UNION ||
-      array_view->storage_type == NANOARROW_TYPE_DENSE_UNION) {
-    array_view->union_type_id_map = (int8_t*)ArrowMalloc(256 * sizeof(int8_t));
-    if (array_view->union_type_id_map == NULL) {
-      return ENOMEM;
+    offsets_buffer->size_bytes += length * (int64_t)sizeof(int32_t);
+  } else {
+    const int64_t* src = offsets_view.data.as_int64 + offset;
+    first = src[0];
+    last = src[length];
+    base = ((int64_t*)offsets_buffer->data)[offsets_buffer->size_bytes /
+                                            (int64_t)sizeof(int64_t) -
+                                            1] -
+           first;
+    if (last < first) {
+      return EINVAL;
     }
 
-    memset(array_view->union_type_id_map, -1, 256);
-    int8_t n_type_ids = _ArrowParseUnionTypeIds(schema_view.union_type_ids,
-                                                array_view->union_type_id_map + 128);
-    for (int8_t child_index = 0; child_index < n_type_ids; child_index++) {
-      int8_t type_id = array_view->union_type_id_map[128 + child_index];
-      array_view->union_type_id_map[type_id] = child_index;
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferReserve(offsets_buffer, length * (int64_t)sizeof(int64_t)));
+    int64_t* dst = (int64_t*)(offsets_buffer->data + offsets_buffer->size_bytes);
+    for (int64_t i = 0; i < length; i++) {
+      dst[i] = src[i + 1] + base;
     }
+    offsets_buffer->size_bytes += length * (int64_t)sizeof(int64_t);
   }
 
+  *first_out = first;
+  *n_out = last - first;
   return NANOARROW_OK;
 }
 
-void ArrowArrayViewReset(struct ArrowArrayView* array_view) {
-  if (array_view->children != NULL) {
-    for (int64_t i = 0; i < array_view->n_children; i++) {
-      if (array_view->children[i] != NULL) {
-        ArrowArrayViewReset(array_view->children[i]);
-        ArrowFree(array_view->children[i]);
-      }
-    }
+// Calculate the range [child_start[i], child_end[i]) of each child referred to
+// by elements [offset, offset + length) of a dense union view. Union offsets for
+// each child are increasing, so the elements of each child referred to by a
+// range of the union are contiguous.
+static ArrowErrorCode ArrowArrayViewDenseUnionChildRanges(
+    struct ArrowArrayView* array_view, int64_t offset, int64_t length,
+    int64_t* child_start, int64_t* child_end) {
+  const int8_t* type_ids = array_view->buffer_views[0].data.as_int8 + offset;
+  const int32_t* offsets = array_view->buffer_views[1].data.as_int32 + offset;
 
-    ArrowFree(array_view->children);
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    child_start[i] = INT64_MAX;
+    child_end[i] = 0;
   }
 
-  if (array_view->dictionary != NULL) {
-    ArrowArrayViewReset(array_view->dictionary);
-    ArrowFree(array_view->dictionary);
-  }
+  for (int64_t i = 0; i < length; i++) {
+    if (type_ids[i] < 0) {
+      return EINVAL;
+    }
 
-  if (array_view->union_type_id_map != NULL) {
-    ArrowFree(array_view->union_type_id_map);
+    int8_t child_index = type_ids[i];
+    if (array_view->union_type_id_map != NULL) {
+      child_index = array_view->union_type_id_map[type_ids[i]];
+    }
+
+    if (child_index < 0 || child_index >= array_view->n_children) {
+      return EINVAL;
+    }
+
+    if (offsets[i] < child_start[child_index]) {
+      child_start[child_index] = offsets[i];
+    }
+
+    if ((offsets[i] + 1) > child_end[child_index]) {
+      child_end[child_index] = offsets[i] + 1;
+    }
   }
 
-  ArrowArrayViewInitFromType(array_view, NANOARROW_TYPE_UNINITIALIZED);
+  return NANOARROW_OK;
 }
 
-void ArrowArrayViewSetLength(struct ArrowArrayView* array_view, int64_t length) {
-  for (int i = 0; i < 3; i++) {
-    int64_t element_size_bytes = array_view->layout.element_size_bits[i] / 8;
+// Append the type ids and rebased union offsets for elements
+// [offset, offset + length) of a dense union view, appending the range of each
+// child referred to by those elements to the corresponding child of array
+static ArrowErrorCode ArrowArrayAppendDenseUnionFromView(
+    struct ArrowArray* array, struct ArrowArrayView* array_view, int64_t offset,
+    int64_t length) {
+  const int8_t* type_ids = array_view->buffer_views[0].data.as_int8 + offset;
+  const int32_t* offsets = array_view->buffer_views[1].data.as_int32 + offset;
+
+  int64_t child_start[128];
+  int64_t child_end[128];
+  int64_t child_base[128];
+  NANOARROW_RETURN_NOT_OK(ArrowArrayViewDenseUnionChildRanges(array_view, offset, length,
+                                                              child_start, child_end));
 
-    switch (array_view->layout.buffer_type[i]) {
-      case NANOARROW_BUFFER_TYPE_VALIDITY:
-        array_view->buffer_views[i].size_bytes = _ArrowBytesForBits(length);
-        continue;
-      case NANOARROW_BUFFER_TYPE_DATA_OFFSET:
-        // Probably don't want/need to rely on the producer to have allocated an
-        // offsets buffer of length 1 for a zero-size array
-        array_view->buffer_views[i].size_bytes =
-            (length != 0) * element_size_bytes * (length + 1);
-        continue;
-      case NANOARROW_BUFFER_TYPE_DATA:
-        array_view->buffer_views[i].size_bytes =
-            _ArrowRoundUpToMultipleOf8(array_view->layout.element_size_bits[i] * length) /
-            8;
-        continue;
-      case NANOARROW_BUFFER_TYPE_TYPE_ID:
-      case NANOARROW_BUFFER_TYPE_UNION_OFFSET:
-        array_view->buffer_views[i].size_bytes = element_size_bytes * length;
-        continue;
-      case NANOARROW_BUFFER_TYPE_NONE:
-        array_view->buffer_views[i].size_bytes = 0;
-        continue;
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    if (child_end[i] <= child_start[i]) {
+      continue;
     }
-  }
-
-  switch (array_view->storage_type) {
-    case NANOARROW_TYPE_STRUCT:
-    case NANOARROW_TYPE_SPARSE_UNION:
-      for (int64_t i = 0; i < array_view->n_children; i++) {
-        ArrowArrayViewSetLength(array_view->children[i], length);
-      }
-      break;
-    case NANOARROW_TYPE_FIXED_SIZE_LIST:
-      if (array_view->n_children >= 1) {
-        ArrowArrayViewSetLength(array_view->children[0],
-                                length * array_view->layout.child_size_elements);
-      }
-    default:
-      break;
-  }
-}
 
-// This version recursively extracts information from the array and stores it
-// in the array view, performing any checks that require the original array.
-static int ArrowArrayViewSetArrayInternal(struct ArrowArrayView* array_view,
-                                          struct ArrowArray* array,
-                                          struct ArrowError* error) {
-  // Check length and offset
-  if (array->offset < 0) {
-    ArrowErrorSet(error, "Expected array offset >= 0 but found array offset of %ld",
-                  (long)array->offset);
-    return EINVAL;
-  }
+    child_base[i] = array->children[i]->length - child_start[i];
+    if ((child_end[i] + child_base[i]) > INT32_MAX) {
+      return EOVERFLOW;
+    }
 
-  if (array->length < 0) {
-    ArrowErrorSet(error, "Expected array length >= 0 but found array length of %ld",
-                  (long)array->length);
-    return EINVAL;
+    NANOARROW_RETURN_NOT_OK(ArrowArrayAppendArrayView(
+        array->children[i], array_view->children[i], child_start[i],
+        child_end[i] - child_start[i]));
   }
 
-  array_view->array = array;
-  array_view->offset = array->offset;
-  array_view->length = array->length;
-  array_view->null_count = array->null_count;
-
-  int64_t buffers_required = 0;
-  for (int i = 0; i < 3; i++) {
-    if (array_view->layout.buffer_type[i] == NANOARROW_BUFFER_TYPE_NONE) {
-      break;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowBufferAppend(_ArrowArrayBuffer(array, 0), type_ids, length));
+  struct ArrowBuffer* offsets_buffer = _ArrowArrayBuffer(array, 1);
+  NANOARROW_RETURN_NOT_OK(
+      ArrowBufferReserve(offsets_buffer, length * (int64_t)sizeof(int32_t)));
+  int32_t* dst = (int32_t*)(offsets_buffer->data + offsets_buffer->size_bytes);
+  for (int64_t i = 0; i < length; i++) {
+    int8_t child_index = type_ids[i];
+    if (array_view->union_type_id_map != NULL) {
+      child_index = array_view->union_type_id_map[type_ids[i]];
     }
 
-    buffers_required++;
-
-    // Set buffer pointer
-    array_view->buffer_views[i].data.data = array->buffers[i];
-
-    // If non-null, set buffer size to unknown.
-    if (array->buffers[i] == NULL) {
-      array_view->buffer_views[i].size_bytes = 0;
-    } else {
-      array_view->buffer_views[i].size_bytes = -1;
-    }
+    dst[i] = (int32_t)(offsets[i] + child_base[child_index]);
   }
+  offsets_buffer->size_bytes += length * (int64_t)sizeof(int32_t);
 
-  // Check the number of buffers
-  if (buffers_required != array->n_buffers) {
-    ArrowErrorSet(error, "Expected array with %d buffer(s) but found %d buffer(s)",
-                  (int)buffers_required, (int)array->n_buffers);
-    return EINVAL;
-  }
+  return NANOARROW_OK;
+}
 
-  // Check number of children
-  if (array_view->n_children != array->n_children) {
-    ArrowErrorSet(error, "Expected %ld children but found %ld children",
-                  (long)array_view->n_children, (long)array->n_children);
-    return EINVAL;
-  }
+// Check that elements of array_view can be appended to array
+static int ArrowArrayMatchesArrayView(struct ArrowArray* array,
+                                      struct ArrowArrayView* array_view) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  return private_data->storage_type == array_view->storage_type &&
+         array->n_children == array_view->n_children &&
+         private_data->layout.element_size_bits[1] ==
+             array_view->layout.element_size_bits[1] &&
+         private_data->layout.child_size_elements ==
+             array_view->layout.child_size_elements;
+}
 
-  // Recurse for children
-  for (int64_t i = 0; i < array_view->n_children; i++) {
-    NANOARROW_RETURN_NOT_OK(ArrowArrayViewSetArrayInternal(array_view->children[i],
-                                                           array->children[i], error));
-  }
+ArrowErrorCode ArrowArrayAppendArrayView(struct ArrowArray* array,
+                                         struct ArrowArrayView* array_view,
+                                         int64_t offset, int64_t length) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
 
-  // Check dictionary
-  if (array->dictionary == NULL && array_view->dictionary != NULL) {
-    ArrowErrorSet(error, "Expected dictionary but found NULL");
+  if (offset < 0 || length < 0 || (offset + length) > array_view->length) {
     return EINVAL;
   }
 
-  if (array->dictionary != NULL && array_view->dictionary == NULL) {
-    ArrowErrorSet(error, "Expected NULL dictionary but found dictionary member");
+  if (!ArrowArrayMatchesArrayView(array, array_view)) {
     return EINVAL;
   }
 
-  if (array->dictionary != NULL) {
-    NANOARROW_RETURN_NOT_OK(
-        ArrowArrayViewSetArrayInternal(array_view->dictionary, array->dictionary, error));
+  if (length == 0) {
+    return NANOARROW_OK;
   }
 
-  return NANOARROW_OK;
-}
+  // Offsets and validity are copied from array_view, which may not have been
+  // fully validated
+  private_data->built_by_append = 0;
 
-static int ArrowArrayViewValidateMinimal(struct ArrowArrayView* array_view,
-                                         struct ArrowError* error) {
-  // Calculate buffer sizes that do not require buffer access. If marked as
-  // unknown, assign the buffer size; otherwise, validate it.
-  int64_t offset_plus_length = array_view->offset + array_view->length;
+  // The position of the first element in the buffers of array_view and (for
+  // types whose children are not indexed by offsets) its children
+  int64_t start = array_view->offset + offset;
 
-  // Only loop over the first two buffers because the size of the third buffer
-  // is always data dependent for all current Arrow types.
-  for (int i = 0; i < 2; i++) {
-    int64_t element_size_bytes = array_view->layout.element_size_bits[i] / 8;
-    // Initialize with a value that will cause an error if accidentally used uninitialized
-    int64_t min_buffer_size_bytes = array_view->buffer_views[i].size_bytes + 1;
+  int64_t values_first = 0;
+  int64_t values_n = 0;
+
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_NA:
+      return ArrowArrayAppendNull(array, length);
+    case NANOARROW_TYPE_RUN_END_ENCODED:
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_STRING_VIEW:
+    case NANOARROW_TYPE_LIST_VIEW:
+    case NANOARROW_TYPE_LARGE_LIST_VIEW:
+      return ENOTSUP;
+    case NANOARROW_TYPE_DENSE_UNION:
+      NANOARROW_RETURN_NOT_OK(
+          ArrowArrayAppendDenseUnionFromView(array, array_view, start, length));
+      array->length += length;
+      return NANOARROW_OK;
+    default:
+      break;
+  }
+
+  for (int64_t i = 0; i < 3; i++) {
+    struct ArrowBufferView buffer_view = array_view->buffer_views[i];
+    int64_t element_size_bits = array_view->layout.element_size_bits[i];
 
     switch (array_view->layout.buffer_type[i]) {
       case NANOARROW_BUFFER_TYPE_VALIDITY:
-        if (array_view->null_count == 0 && array_view->buffer_views[i].size_bytes == 0) {
-          continue;
-        }
-
-        min_buffer_size_bytes = _ArrowBytesForBits(offset_plus_length);
+        NANOARROW_RETURN_NOT_OK(_ArrowArrayAppendValidity(
+            array, buffer_view.size_bytes == 0 ? NULL : buffer_view.data.as_uint8, start,
+            length));
+        break;
+      case NANOARROW_BUFFER_TYPE_TYPE_ID:
+        NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(_ArrowArrayBuffer(array, i),
+                                                  buffer_view.data.as_int8 + start,
+                                                  length));
         break;
       case NANOARROW_BUFFER_TYPE_DATA_OFFSET:
-        // Probably don't want/need to rely on the producer to have allocated an
-        // offsets buffer of length 1 for a zero-size array
-        min_buffer_size_bytes =
-            (offset_plus_length != 0) * element_size_bytes * (offset_plus_length + 1);
+        NANOARROW_RETURN_NOT_OK(ArrowArrayAppendOffsetsFromView(
+            _ArrowArrayBuffer(array, i), array_view->layout.buffer_data_type[i],
+            buffer_view, start, length, &values_first, &values_n));
         break;
       case NANOARROW_BUFFER_TYPE_DATA:
-        min_buffer_size_bytes =
-            _ArrowRoundUpToMultipleOf8(array_view->layout.element_size_bits[i] *
-                                       offset_plus_length) /
-            8;
+        if (i == 2) {
+          // The data buffer of a string or binary array
+          NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(
+              _ArrowArrayBuffer(array, i), buffer_view.data.as_uint8 + values_first,
+              values_n));
+        } else if (element_size_bits == 1) {
+          NANOARROW_RETURN_NOT_OK(
+              ArrowArrayAppendBitsFromView(_ArrowArrayBuffer(array, i), array->length,
+                                           buffer_view.data.as_uint8, start, length));
+        } else {
+          NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(
+              _ArrowArrayBuffer(array, i),
+              buffer_view.data.as_uint8 + start * element_size_bits / 8,
+              length * element_size_bits / 8));
+        }
         break;
-      case NANOARROW_BUFFER_TYPE_TYPE_ID:
-      case NANOARROW_BUFFER_TYPE_UNION_OFFSET:
-        min_buffer_size_bytes = element_size_bytes * offset_plus_length;
+      default:
         break;
-      case NANOARROW_BUFFER_TYPE_NONE:
-        continue;
-    }
-
-    // Assign or validate buffer size
-    if (array_view->buffer_views[i].size_bytes == -1) {
-      array_view->buffer_views[i].size_bytes = min_buffer_size_bytes;
-    } else if (array_view->buffer_views[i].size_bytes < min_buffer_size_bytes) {
-      ArrowErrorSet(error,
-                    "Expected %s array buffer %d to have size >= %ld bytes but found "
-                    "buffer with %ld bytes",
-                    ArrowTypeString(array_view->storage_type), (int)i,
-                    (long)min_buffer_size_bytes,
-                    (long)array_view->buffer_views[i].size_bytes);
-      return EINVAL;
     }
   }
 
-  // For list, fixed-size list and map views, we can validate the number of children
   switch (array_view->storage_type) {
     case NANOARROW_TYPE_LIST:
     case NANOARROW_TYPE_LARGE_LIST:
-    case NANOARROW_TYPE_FIXED_SIZE_LIST:
     case NANOARROW_TYPE_MAP:
-      if (array_view->n_children != 1) {
-        ArrowErrorSet(error, "Expected 1 child of %s array but found %ld child arrays",
-                      ArrowTypeString(array_view->storage_type),
-                      (long)array_view->n_children);
-        return EINVAL;
+      NANOARROW_RETURN_NOT_OK(ArrowArrayAppendArrayView(
+          array->children[0], array_view->children[0], values_first, values_n));
+      break;
+    case NANOARROW_TYPE_FIXED_SIZE_LIST:
+      NANOARROW_RETURN_NOT_OK(ArrowArrayAppendArrayView(
+          array->children[0], array_view->children[0],
+          start * array_view->layout.child_size_elements,
+          length * array_view->layout.child_size_elements));
+      break;
+    case NANOARROW_TYPE_STRUCT:
+    case NANOARROW_TYPE_SPARSE_UNION:
+      for (int64_t i = 0; i < array_view->n_children; i++) {
+        NANOARROW_RETURN_NOT_OK(ArrowArrayAppendArrayView(
+            array->children[i], array_view->children[i], start, length));
       }
+      break;
     default:
       break;
   }
 
-  // For struct, the sparse union, and the fixed-size list views, we can validate child
-  // lengths.
-  int64_t child_min_length;
-  switch (array_view->storage_type) {
-    case NANOARROW_TYPE_SPARSE_UNION:
-    case NANOARROW_TYPE_STRUCT:
-      child_min_length = (array_view->offset + array_view->length);
-      for (int64_t i = 0; i < array_view->n_children; i++) {
-        if (array_view->children[i]->length < child_min_length) {
-          ArrowErrorSet(
-              error,
-              "Expected struct child %d to have length >= %ld but found child with "
-              "length %ld",
-              (int)(i + 1), (long)(child_min_length),
-              (long)array_view->children[i]->length);
-          return EINVAL;
-        }
+  array->length += length;
+  return NANOARROW_OK;
+}
+
+// Set bits [out_offset, out_offset + n) of buffer to the bits of bits at positions
+// start + indices[i], extending buffer as needed
+static ArrowErrorCode ArrowArrayTakeBits(struct ArrowBuffer* buffer, int64_t out_offset,
+                                         const uint8_t* bits, int64_t start,
+                                         const int64_t* indices, int64_t n) {
+  int64_t bytes_required = _ArrowBytesForBits(out_offset + n);
+  if (bytes_required > buffer->size_bytes) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferAppendFill(buffer, 0, bytes_required - buffer->size_bytes));
+  }
+
+  for (int64_t i = 0; i < n; i++) {
+    ArrowBitSetTo(buffer->data, out_offset + i, ArrowBitGet(bits, start + indices[i]));
+  }
+
+  return NANOARROW_OK;
+}
+
+// Append the elements of values of element_size_bytes bytes at positions
+// start + indices[i] to buffer
+static ArrowErrorCode ArrowArrayTakeFixedWidth(struct ArrowBuffer* buffer,
+                                               const uint8_t* values,
+                                               int64_t element_size_bytes, int64_t start,
+                                               const int64_t* indices, int64_t n) {
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(buffer, n * element_size_bytes));
+  uint8_t* out = buffer->data + buffer->size_bytes;
+
+  // Specialize the common widths so that each gather is a single load and store
+  switch (element_size_bytes) {
+    case 1:
+      for (int64_t i = 0; i < n; i++) {
+        out[i] = values[start + indices[i]];
       }
       break;
-
-    case NANOARROW_TYPE_FIXED_SIZE_LIST:
-      child_min_length = (array_view->offset + array_view->length) *
-                         array_view->layout.child_size_elements;
-      if (array_view->children[0]->length < child_min_length) {
-        ArrowErrorSet(error,
-                      "Expected child of fixed_size_list array to have length >= %ld but "
-                      "found array with length %ld",
-                      (long)child_min_length, (long)array_view->children[0]->length);
-        return EINVAL;
+    case 2:
+      for (int64_t i = 0; i < n; i++) {
+        ((int16_t*)out)[i] = ((const int16_t*)values)[start + indices[i]];
+      }
+      break;
+    case 4:
+      for (int64_t i = 0; i < n; i++) {
+        ((int32_t*)out)[i] = ((const int32_t*)values)[start + indices[i]];
+      }
+      break;
+    case 8:
+      for (int64_t i = 0; i < n; i++) {
+        ((int64_t*)out)[i] = ((const int64_t*)values)[start + indices[i]];
       }
       break;
     default:
+      for (int64_t i = 0; i < n; i++) {
+        memcpy(out + i * element_size_bytes,
+               values + (start + indices[i]) * element_size_bytes,
+               (size_t)element_size_bytes);
+      }
       break;
   }
 
-  // Recurse for children
-  for (int64_t i = 0; i < array_view->n_children; i++) {
-    NANOARROW_RETURN_NOT_OK(
-        ArrowArrayViewValidateMinimal(array_view->children[i], error));
+  buffer->size_bytes += n * element_size_bytes;
+  return NANOARROW_OK;
+}
+
+// Append the validity of the elements of array_view at positions start + indices[i]
+// to array and update its null count
+static ArrowErrorCode ArrowArrayTakeValidity(struct ArrowArray* array,
+                                             struct ArrowArrayView* array_view,
+                                             int64_t start, const int64_t* indices,
+                                             int64_t n) {
+  const uint8_t* validity = array_view->buffer_views[0].size_bytes == 0
+                                ? NULL
+                                : array_view->buffer_views[0].data.as_uint8;
+  int64_t n_null = 0;
+  if (validity != NULL) {
+    for (int64_t i = 0; i < n; i++) {
+      n_null += !ArrowBitGet(validity, start + indices[i]);
+    }
   }
 
-  // Recurse for dictionary
-  if (array_view->dictionary != NULL) {
-    NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateMinimal(array_view->dictionary, error));
+  // If we haven't allocated a bitmap yet and we need to append nulls, do it now
+  struct ArrowBitmap* bitmap = _ArrowArrayValidityBitmap(array);
+  if (n_null > 0 && bitmap->buffer.data == NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapReserve(bitmap, array->length + n));
+    ArrowBitmapAppendUnsafe(bitmap, 1, array->length);
   }
 
+  if (bitmap->buffer.data != NULL && validity != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayTakeBits(&bitmap->buffer, bitmap->size_bits,
+                                               validity, start, indices, n));
+    bitmap->size_bits += n;
+  } else if (bitmap->buffer.data != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(bitmap, 1, n));
+  }
+
+  array->null_count += n_null;
   return NANOARROW_OK;
 }
 
-static int ArrowArrayViewValidateDefault(struct ArrowArrayView* array_view,
-                                         struct ArrowError* error) {
-  // Perform minimal validation. This will validate or assign
-  // buffer sizes as long as buffer access is not required.
-  NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateMinimal(array_view, error));
+// Append the string or binary values of array_view at positions start + indices[i]
+// to array after reserving the exact number of bytes required
+static ArrowErrorCode ArrowArrayTakeStrings(struct ArrowArray* array,
+                                            struct ArrowArrayView* array_view,
+                                            int64_t start, const int64_t* indices,
+                                            int64_t n) {
+  struct ArrowBuffer* offsets_buffer = _ArrowArrayBuffer(array, 1);
+  struct ArrowBuffer* data_buffer = _ArrowArrayBuffer(array, 2);
+  const uint8_t* data = array_view->buffer_views[2].data.as_uint8;
+
+  if (array_view->layout.element_size_bits[1] == 32) {
+    const int32_t* offsets = array_view->buffer_views[1].data.as_int32 + start;
+    int64_t total_size_bytes = 0;
+    for (int64_t i = 0; i < n; i++) {
+      total_size_bytes += (int64_t)offsets[indices[i] + 1] - offsets[indices[i]];
+    }
 
-  // Calculate buffer sizes or child lengths that require accessing the offsets
-  // buffer. Where appropriate, validate that the first offset is >= 0.
-  // If a buffer size is marked as unknown, assign it; otherwise, validate it.
-  int64_t offset_plus_length = array_view->offset + array_view->length;
+    int64_t last = ((int32_t*)offsets_buffer->data)[array->length];
+    if (total_size_bytes < 0 || (last + total_size_bytes) > INT32_MAX) {
+      return EOVERFLOW;
+    }
 
-  int64_t first_offset;
-  int64_t last_offset;
-  switch (array_view->storage_type) {
-    case NANOARROW_TYPE_STRING:
-    case NANOARROW_TYPE_BINARY:
-      if (array_view->buffer_views[1].size_bytes != 0) {
-        first_offset = array_view->buffer_views[1].data.as_int32[0];
-        if (first_offset < 0) {
-          ArrowErrorSet(error, "Expected first offset >= 0 but found %ld",
-                        (long)first_offset);
-          return EINVAL;
-        }
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferReserve(offsets_buffer, n * (int64_t)sizeof(int32_t)));
+    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(data_buffer, total_size_bytes));
+    int32_t* offsets_out = (int32_t*)(offsets_buffer->data + offsets_buffer->size_bytes);
+    for (int64_t i = 0; i < n; i++) {
+      int32_t value_start = offsets[indices[i]];
+      int32_t size_bytes = offsets[indices[i] + 1] - value_start;
+      if (total_size_bytes > 0) {
+        ArrowBufferAppendUnsafe(data_buffer, data + value_start, size_bytes);
+      }
+      last += size_bytes;
+      offsets_out[i] = (int32_t)last;
+    }
+    offsets_buffer->size_bytes += n * (int64_t)sizeof(int32_t);
+  } else {
+    const int64_t* offsets = array_view->buffer_views[1].data.as_int64 + start;
+    int64_t total_size_bytes = 0;
+    for (int64_t i = 0; i < n; i++) {
+      total_size_bytes += offsets[indices[i] + 1] - offsets[indices[i]];
+    }
 
-        last_offset = array_view->buffer_views[1].data.as_int32[offset_plus_length];
+    if (total_size_bytes < 0) {
+      return EINVAL;
+    }
 
-        // If the data buffer size is unknown, assign it; otherwise, check it
-        if (array_view->buffer_views[2].size_bytes == -1) {
-          array_view->buffer_views[2].size_bytes = last_offset;
-        } else if (array_view->buffer_views[2].size_bytes < last_offset) {
-          ArrowErrorSet(error,
-                        "Expected %s array buffer 2 to have size >= %ld bytes but found "
-                        "buffer with %ld bytes",
-                        ArrowTypeString(array_view->storage_type), (long)last_offset,
-                        (long)array_view->buffer_views[2].size_bytes);
-          return EINVAL;
-        }
+    int64_t last = ((int64_t*)offsets_buffer->data)[array->length];
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferReserve(offsets_buffer, n * (int64_t)sizeof(int64_t)));
+    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(data_buffer, total_size_bytes));
+    int64_t* offsets_out = (int64_t*)(offsets_buffer->data + offsets_buffer->size_bytes);
+    for (int64_t i = 0; i < n; i++) {
+      int64_t value_start = offsets[indices[i]];
+      int64_t size_bytes = offsets[indices[i] + 1] - value_start;
+      if (total_size_bytes > 0) {
+        ArrowBufferAppendUnsafe(data_buffer, data + value_start, size_bytes);
+      }
+      last += size_bytes;
+      offsets_out[i] = last;
+    }
+    offsets_buffer->size_bytes += n * (int64_t)sizeof(int64_t);
+  }
+
+  return NANOARROW_OK;
+}
+
+// Append the list offsets of the elements of array_view at positions
+// start + indices[i] to array and the child elements they refer to to the child
+// of array, appending consecutive child ranges together
+static ArrowErrorCode ArrowArrayTakeLists(struct ArrowArray* array,
+                                          struct ArrowArrayView* array_view,
+                                          int64_t start, const int64_t* indices,
+                                          int64_t n) {
+  struct ArrowBuffer* offsets_buffer = _ArrowArrayBuffer(array, 1);
+  struct ArrowArray* child = array->children[0];
+  struct ArrowArrayView* child_view = array_view->children[0];
+  int64_t child_size = array_view->layout.child_size_elements;
+  int is_large = array_view->storage_type == NANOARROW_TYPE_LARGE_LIST;
+
+  int64_t last = 0;
+  if (array_view->storage_type == NANOARROW_TYPE_FIXED_SIZE_LIST) {
+    // No offsets to append
+  } else if (is_large) {
+    last = ((int64_t*)offsets_buffer->data)[array->length];
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferReserve(offsets_buffer, n * (int64_t)sizeof(int64_t)));
+  } else {
+    last = ((int32_t*)offsets_buffer->data)[array->length];
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferReserve(offsets_buffer, n * (int64_t)sizeof(int32_t)));
+  }
+
+  int64_t pending_start = 0;
+  int64_t pending_end = 0;
+  for (int64_t i = 0; i < n; i++) {
+    int64_t value_start;
+    int64_t value_end;
+    switch (array_view->storage_type) {
+      case NANOARROW_TYPE_FIXED_SIZE_LIST:
+        value_start = (start + indices[i]) * child_size;
+        value_end = value_start + child_size;
+        break;
+      case NANOARROW_TYPE_LARGE_LIST:
+        value_start = array_view->buffer_views[1].data.as_int64[start + indices[i]];
+        value_end = array_view->buffer_views[1].data.as_int64[start + indices[i] + 1];
+        break;
+      default:
+        value_start = array_view->buffer_views[1].data.as_int32[start + indices[i]];
+        value_end = array_view->buffer_views[1].data.as_int32[start + indices[i] + 1];
+        break;
+    }
+
+    if (value_end < value_start) {
+      return EINVAL;
+    }
+
+    if (array_view->storage_type != NANOARROW_TYPE_FIXED_SIZE_LIST) {
+      last += value_end - value_start;
+      if (is_large) {
+        ArrowBufferAppendUnsafe(offsets_buffer, &last, sizeof(int64_t));
+      } else if (last > INT32_MAX) {
+        return EOVERFLOW;
+      } else {
+        int32_t last32 = (int32_t)last;
+        ArrowBufferAppendUnsafe(offsets_buffer, &last32, sizeof(int32_t));
       }
+    }
+
+    if (value_start != pending_end) {
+      NANOARROW_RETURN_NOT_OK(ArrowArrayAppendArrayView(
+          child, child_view, pending_start, pending_end - pending_start));
+      pending_start = value_start;
+    }
+
+    pending_end = value_end;
+  }
+
+  return ArrowArrayAppendArrayView(child, child_view, pending_start,
+                                   pending_end - pending_start);
+}
+
+// Append the elements of array_view at logical positions base + indices[i], where
+// base is nonzero for the children of a struct or sparse union whose elements are
+// offset by that of the parent
+static ArrowErrorCode ArrowArrayAppendTakeInternal(struct ArrowArray* array,
+                                                   struct ArrowArrayView* array_view,
+                                                   const int64_t* indices, int64_t n,
+                                                   int64_t base) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+
+  if (!ArrowArrayMatchesArrayView(array, array_view)) {
+    return EINVAL;
+  }
+
+  // Offsets and validity are copied from array_view, which may not have been
+  // fully validated
+  private_data->built_by_append = 0;
+
+  // The position in the buffers of array_view that indices are relative to
+  int64_t start = array_view->offset + base;
+
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_NA:
+      return ArrowArrayAppendNull(array, n);
+    case NANOARROW_TYPE_RUN_END_ENCODED:
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_STRING_VIEW:
+    case NANOARROW_TYPE_LIST_VIEW:
+    case NANOARROW_TYPE_LARGE_LIST_VIEW:
+    case NANOARROW_TYPE_DENSE_UNION:
+      return ENOTSUP;
+    default:
       break;
+  }
+
+  if (array_view->layout.buffer_type[0] == NANOARROW_BUFFER_TYPE_VALIDITY) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayTakeValidity(array, array_view, start, indices, n));
+  } else if (array_view->layout.buffer_type[0] == NANOARROW_BUFFER_TYPE_TYPE_ID) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayTakeFixedWidth(_ArrowArrayBuffer(array, 0),
+                                 array_view->buffer_views[0].data.as_uint8, 1, start,
+                                 indices, n));
+  }
 
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY:
     case NANOARROW_TYPE_LARGE_STRING:
     case NANOARROW_TYPE_LARGE_BINARY:
-      if (array_view->buffer_views[1].size_bytes != 0) {
-        first_offset = array_view->buffer_views[1].data.as_int64[0];
-        if (first_offset < 0) {
-          ArrowErrorSet(error, "Expected first offset >= 0 but found %ld",
-                        (long)first_offset);
-          return EINVAL;
-        }
+      NANOARROW_RETURN_NOT_OK(
+          ArrowArrayTakeStrings(array, array_view, start, indices, n));
+      break;
+    case NANOARROW_TYPE_LIST:
+    case NANOARROW_TYPE_LARGE_LIST:
+    case NANOARROW_TYPE_MAP:
+    case NANOARROW_TYPE_FIXED_SIZE_LIST:
+      NANOARROW_RETURN_NOT_OK(ArrowArrayTakeLists(array, array_view, start, indices, n));
+      break;
+    case NANOARROW_TYPE_STRUCT:
+    case NANOARROW_TYPE_SPARSE_UNION:
+      for (int64_t i = 0; i < array_view->n_children; i++) {
+        NANOARROW_RETURN_NOT_OK(ArrowArrayAppendTakeInternal(
+            array->children[i], array_view->children[i], indices, n, start));
+      }
+      break;
+    case NANOARROW_TYPE_BOOL:
+      NANOARROW_RETURN_NOT_OK(ArrowArrayTakeBits(
+          _ArrowArrayBuffer(array, 1), array->length,
+          array_view->buffer_views[1].data.as_uint8, start, indices, n));
+      break;
+    default:
+      if (array_view->layout.buffer_type[1] == NANOARROW_BUFFER_TYPE_DATA) {
+        NANOARROW_RETURN_NOT_OK(ArrowArrayTakeFixedWidth(
+            _ArrowArrayBuffer(array, 1), array_view->buffer_views[1].data.as_uint8,
+            array_view->layout.element_size_bits[1] / 8, start, indices, n));
+      }
+      break;
+  }
 
-        last_offset = array_view->buffer_views[1].data.as_int64[offset_plus_length];
+  array->length += n;
+  return NANOARROW_OK;
+}
 
-        // If the data buffer size is unknown, assign it; otherwise, check it
-        if (array_view->buffer_views[2].size_bytes == -1) {
-          array_view->buffer_views[2].size_bytes = last_offset;
-        } else if (array_view->buffer_views[2].size_bytes < last_offset) {
-          ArrowErrorSet(error,
-                        "Expected %s array buffer 2 to have size >= %ld bytes but found "
-                        "buffer with %ld bytes",
-                        ArrowTypeString(array_view->storage_type), (long)last_offset,
-                        (long)array_view->buffer_views[2].size_bytes);
-          return EINVAL;
-        }
+ArrowErrorCode ArrowArrayAppendTake(struct ArrowArray* array,
+                                    struct ArrowArrayView* array_view,
+                                    const int64_t* indices, int64_t n) {
+  if (n < 0) {
+    return EINVAL;
+  }
+
+  for (int64_t i = 0; i < n; i++) {
+    if (indices[i] < 0 || indices[i] >= array_view->length) {
+      return EINVAL;
+    }
+  }
+
+  if (n == 0) {
+    return ArrowArrayMatchesArrayView(array, array_view) ? NANOARROW_OK : EINVAL;
+  }
+
+  return ArrowArrayAppendTakeInternal(array, array_view, indices, n, 0);
+}
+
+ArrowErrorCode ArrowArrayAppendFilter(struct ArrowArray* array,
+                                      struct ArrowArrayView* array_view,
+                                      const uint8_t* filter) {
+  int64_t n = ArrowBitCountSet(filter, 0, array_view->length);
+  if (n == 0) {
+    return ArrowArrayMatchesArrayView(array, array_view) ? NANOARROW_OK : EINVAL;
+  }
+
+  // One extra element allows the index of each element to be written whether or
+  // not it is selected
+  int64_t* indices = (int64_t*)ArrowMalloc((n + 1) * sizeof(int64_t));
+  if (indices == NULL) {
+    return ENOMEM;
+  }
+
+  int64_t n_selected = 0;
+  for (int64_t i = 0; i < array_view->length; i++) {
+    indices[n_selected] = i;
+    n_selected += ArrowBitGet(filter, i);
+  }
+
+  int result = ArrowArrayAppendTakeInternal(array, array_view, indices, n, 0);
+  ArrowFree(indices);
+  return result;
+}
+
+// Copy the element_size_bytes member at offset of each of n records into out.
+// Constant sizes let the compiler replace each copy with a single load and store.
+static void ArrowRecordsGather(const uint8_t* records, int64_t stride, int64_t offset,
+                               int64_t n, int64_t element_size_bytes, uint8_t* out) {
+  records += offset;
+  switch (element_size_bytes) {
+    case 1:
+      for (int64_t j = 0; j < n; j++) {
+        out[j] = records[j * stride];
+      }
+      break;
+    case 2:
+      for (int64_t j = 0; j < n; j++) {
+        memcpy(out + j * 2, records + j * stride, 2);
+      }
+      break;
+    case 4:
+      for (int64_t j = 0; j < n; j++) {
+        memcpy(out + j * 4, records + j * stride, 4);
+      }
+      break;
+    case 8:
+      for (int64_t j = 0; j < n; j++) {
+        memcpy(out + j * 8, records + j * stride, 8);
+      }
+      break;
+    default:
+      for (int64_t j = 0; j < n; j++) {
+        memcpy(out + j * element_size_bytes, records + j * stride,
+               (size_t)element_size_bytes);
       }
       break;
+  }
+}
 
-    case NANOARROW_TYPE_STRUCT:
-      for (int64_t i = 0; i < array_view->n_children; i++) {
-        if (array_view->children[i]->length < offset_plus_length) {
-          ArrowErrorSet(
-              error,
-              "Expected struct child %d to have length >= %ld but found child with "
-              "length %ld",
-              (int)(i + 1), (long)offset_plus_length,
-              (long)array_view->children[i]->length);
-          return EINVAL;
+static ArrowErrorCode ArrowArrayAppendRecordsChild(struct ArrowArray* array,
+                                                   const uint8_t* records, int64_t n,
+                                                   int64_t stride,
+                                                   const struct ArrowRecordField* field) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  enum ArrowType storage_type = private_data->storage_type;
+  int64_t element_size_bytes = private_data->layout.element_size_bits[1] / 8;
+  int is_string = storage_type == NANOARROW_TYPE_STRING ||
+                  storage_type == NANOARROW_TYPE_LARGE_STRING;
+  int is_fixed_width =
+      private_data->layout.buffer_type[1] == NANOARROW_BUFFER_TYPE_DATA &&
+      private_data->layout.buffer_type[2] == NANOARROW_BUFFER_TYPE_NONE &&
+      array->n_children == 0 && array->dictionary == NULL;
+
+  if (field->type != storage_type || (!is_string && !is_fixed_width) ||
+      field->offset < 0) {
+    return EINVAL;
+  }
+
+  if (storage_type != NANOARROW_TYPE_BOOL && !is_string) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferReserve(ArrowArrayBuffer(array, 1), n * element_size_bytes));
+  }
+
+  uint8_t validity[NANOARROW_KERNEL_BLOCK_SIZE / 8];
+  uint8_t values[NANOARROW_KERNEL_BLOCK_SIZE];
+  struct ArrowStringView strings[NANOARROW_KERNEL_BLOCK_SIZE];
+
+  for (int64_t start = 0; start < n; start += NANOARROW_KERNEL_BLOCK_SIZE) {
+    int64_t block_n = n - start;
+    if (block_n > NANOARROW_KERNEL_BLOCK_SIZE) {
+      block_n = NANOARROW_KERNEL_BLOCK_SIZE;
+    }
+
+    const uint8_t* block = records + start * stride;
+    int has_nulls = 0;
+    if (field->null_flag_offset >= 0) {
+      ArrowRecordsGather(block, stride, field->null_flag_offset, block_n, 1, values);
+      memset(validity, 0, sizeof(validity));
+      for (int64_t j = 0; j < block_n; j++) {
+        has_nulls |= values[j];
+        validity[j / 8] |= (uint8_t)((values[j] == 0) << (j % 8));
+      }
+    } else {
+      memset(validity, 0xff, sizeof(validity));
+    }
+
+    if (is_string) {
+      // A NULL pointer is also a null value
+      for (int64_t j = 0; j < block_n; j++) {
+        const char* value = NULL;
+        if (ArrowBitGet(validity, j)) {
+          memcpy(&value, block + j * stride + field->offset, sizeof(const char*));
+        }
+
+        if (value == NULL) {
+          has_nulls = 1;
+          ArrowBitClear(validity, j);
+        } else {
+          strings[j] = ArrowCharView(value);
         }
       }
+
+      NANOARROW_RETURN_NOT_OK(
+          ArrowArrayAppendStrings(array, strings, block_n, has_nulls ? validity : NULL));
+      continue;
+    }
+
+    if (storage_type == NANOARROW_TYPE_BOOL) {
+      struct ArrowBuffer* data = ArrowArrayBuffer(array, 1);
+      int64_t bytes_required = _ArrowBytesForBits(array->length + block_n);
+      if (bytes_required > data->size_bytes) {
+        NANOARROW_RETURN_NOT_OK(
+            ArrowBufferAppendFill(data, 0, bytes_required - data->size_bytes));
+      }
+
+      ArrowRecordsGather(block, stride, field->offset, block_n, 1, values);
+      for (int64_t j = 0; j < block_n; j++) {
+        ArrowBitSetTo(data->data, array->length + j, values[j] != 0);
+      }
+    } else {
+      struct ArrowBuffer* data = ArrowArrayBuffer(array, 1);
+      ArrowRecordsGather(block, stride, field->offset, block_n, element_size_bytes,
+                         data->data + data->size_bytes);
+      data->size_bytes += block_n * element_size_bytes;
+    }
+
+    NANOARROW_RETURN_NOT_OK(
+        _ArrowArrayAppendValidity(array, has_nulls ? validity : NULL, 0, block_n));
+    array->length += block_n;
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayAppendRecords(struct ArrowArray* array, const void* records,
+                                       int64_t n, int64_t stride,
+                                       const struct ArrowRecordField* fields) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  if (private_data->storage_type != NANOARROW_TYPE_STRUCT || n < 0 || stride < 0) {
+    return EINVAL;
+  }
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayAppendRecordsChild(
+        array->children[i], (const uint8_t*)records, n, stride, fields + i));
+  }
+
+  NANOARROW_RETURN_NOT_OK(_ArrowArrayAppendValidity(array, NULL, 0, n));
+  array->length += n;
+  return NANOARROW_OK;
+}
+
+// Accumulate the number of elements, the number of nulls, and the number of bytes
+// required for each buffer to append elements [offset, offset + length) of
+// array_view into the length, null_count, and buffer_views[i].size_bytes of sizes
+// (recursively for children)
+static ArrowErrorCode ArrowArrayViewAddRangeSizes(struct ArrowArrayView* sizes,
+                                                  struct ArrowArrayView* array_view,
+                                                  int64_t offset, int64_t length) {
+  if (offset < 0 || length < 0 || (offset + length) > array_view->length) {
+    return EINVAL;
+  }
+
+  int64_t start = array_view->offset + offset;
+  sizes->length += length;
+
+  int64_t values_first = 0;
+  int64_t values_n = 0;
+
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_RUN_END_ENCODED:
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_STRING_VIEW:
+    case NANOARROW_TYPE_LIST_VIEW:
+    case NANOARROW_TYPE_LARGE_LIST_VIEW:
+      return ENOTSUP;
+    default:
       break;
+  }
 
-    case NANOARROW_TYPE_LIST:
-    case NANOARROW_TYPE_MAP:
-      if (array_view->buffer_views[1].size_bytes != 0) {
-        first_offset = array_view->buffer_views[1].data.as_int32[0];
-        if (first_offset < 0) {
-          ArrowErrorSet(error, "Expected first offset >= 0 but found %ld",
-                        (long)first_offset);
-          return EINVAL;
+  if (array_view->storage_type == NANOARROW_TYPE_DENSE_UNION) {
+    int64_t child_start[128];
+    int64_t child_end[128];
+    NANOARROW_RETURN_NOT_OK(ArrowArrayViewDenseUnionChildRanges(
+        array_view, start, length, child_start, child_end));
+    sizes->buffer_views[0].size_bytes += length;
+    sizes->buffer_views[1].size_bytes += length * (int64_t)sizeof(int32_t);
+    for (int64_t i = 0; i < array_view->n_children; i++) {
+      if (child_end[i] > child_start[i]) {
+        NANOARROW_RETURN_NOT_OK(
+            ArrowArrayViewAddRangeSizes(sizes->children[i], array_view->children[i],
+                                        child_start[i], child_end[i] - child_start[i]));
+      }
+    }
+
+    return NANOARROW_OK;
+  }
+
+  for (int64_t i = 0; i < 3; i++) {
+    struct ArrowBufferView buffer_view = array_view->buffer_views[i];
+    int64_t element_size_bits = array_view->layout.element_size_bits[i];
+
+    switch (array_view->layout.buffer_type[i]) {
+      case NANOARROW_BUFFER_TYPE_VALIDITY:
+        if (buffer_view.size_bytes != 0) {
+          sizes->null_count +=
+              length - ArrowBitCountSet(buffer_view.data.as_uint8, start, length);
+        }
+        break;
+      case NANOARROW_BUFFER_TYPE_TYPE_ID:
+        sizes->buffer_views[i].size_bytes += length;
+        break;
+      case NANOARROW_BUFFER_TYPE_DATA_OFFSET:
+        if (element_size_bits == 32) {
+          values_first = buffer_view.data.as_int32[start];
+          values_n = buffer_view.data.as_int32[start + length] - values_first;
+        } else {
+          values_first = buffer_view.data.as_int64[start];
+          values_n = buffer_view.data.as_int64[start + length] - values_first;
         }
 
-        last_offset = array_view->buffer_views[1].data.as_int32[offset_plus_length];
-        if (array_view->children[0]->length < last_offset) {
-          ArrowErrorSet(
-              error,
-              "Expected child of %s array to have length >= %ld but found array with "
-              "length %ld",
-              ArrowTypeString(array_view->storage_type), (long)last_offset,
-              (long)array_view->children[0]->length);
+        if (values_n < 0) {
           return EINVAL;
         }
-      }
-      break;
 
-    case NANOARROW_TYPE_LARGE_LIST:
-      if (array_view->buffer_views[1].size_bytes != 0) {
-        first_offset = array_view->buffer_views[1].data.as_int64[0];
-        if (first_offset < 0) {
-          ArrowErrorSet(error, "Expected first offset >= 0 but found %ld",
-                        (long)first_offset);
-          return EINVAL;
-        }
+        sizes->buffer_views[i].size_bytes += length * element_size_bits / 8;
+        break;
+      case NANOARROW_BUFFER_TYPE_DATA:
+        if (i == 2) {
+          sizes->buffer_views[i].size_bytes += values_n;
+        } else if (element_size_bits != 1) {
+          // Bit-packed data buffer sizes are calculated from the final length
+          sizes->buffer_views[i].size_bytes += length * element_size_bits / 8;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_LIST:
+    case NANOARROW_TYPE_LARGE_LIST:
+    case NANOARROW_TYPE_MAP:
+      NANOARROW_RETURN_NOT_OK(ArrowArrayViewAddRangeSizes(
+          sizes->children[0], array_view->children[0], values_first, values_n));
+      break;
+    case NANOARROW_TYPE_FIXED_SIZE_LIST:
+      NANOARROW_RETURN_NOT_OK(ArrowArrayViewAddRangeSizes(
+          sizes->children[0], array_view->children[0],
+          start * array_view->layout.child_size_elements,
+          length * array_view->layout.child_size_elements));
+      break;
+    case NANOARROW_TYPE_STRUCT:
+    case NANOARROW_TYPE_SPARSE_UNION:
+      for (int64_t i = 0; i < array_view->n_children; i++) {
+        NANOARROW_RETURN_NOT_OK(ArrowArrayViewAddRangeSizes(
+            sizes->children[i], array_view->children[i], start, length));
+      }
+      break;
+    default:
+      break;
+  }
+
+  return NANOARROW_OK;
+}
+
+// Reserve the exact number of bytes accumulated by ArrowArrayViewAddRangeSizes()
+// for each buffer of array (recursively for children)
+static ArrowErrorCode ArrowArrayReserveFromSizes(struct ArrowArray* array,
+                                                 struct ArrowArrayView* sizes) {
+  for (int64_t i = 0; i < 3; i++) {
+    switch (sizes->layout.buffer_type[i]) {
+      case NANOARROW_BUFFER_TYPE_NONE:
+        break;
+      case NANOARROW_BUFFER_TYPE_VALIDITY:
+        // Only allocate a validity buffer if there will be nulls
+        if (sizes->null_count > 0) {
+          NANOARROW_RETURN_NOT_OK(
+              ArrowBitmapReserve(_ArrowArrayValidityBitmap(array), sizes->length));
+        }
+        break;
+      default:
+        if (sizes->layout.element_size_bits[i] == 1) {
+          sizes->buffer_views[i].size_bytes = _ArrowBytesForBits(sizes->length);
+        }
+
+        NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(_ArrowArrayBuffer(array, i),
+                                                   sizes->buffer_views[i].size_bytes));
+        break;
+    }
+  }
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayReserveFromSizes(array->children[i], sizes->children[i]));
+  }
+
+  return NANOARROW_OK;
+}
+
+static int ArrowArrayViewHasDictionary(struct ArrowArrayView* array_view) {
+  if (array_view->dictionary != NULL) {
+    return 1;
+  }
+
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    if (ArrowArrayViewHasDictionary(array_view->children[i])) {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+static ArrowErrorCode ArrowArrayConcatenateInternal(struct ArrowArray** arrays,
+                                                    int64_t n,
+                                                    struct ArrowArrayView* array_view,
+                                                    struct ArrowArrayView* sizes,
+                                                    struct ArrowArray* out,
+                                                    struct ArrowError* error) {
+  if (ArrowArrayViewHasDictionary(array_view)) {
+    ArrowErrorSet(error, "Concatenation of dictionary-encoded arrays is not supported");
+    return EINVAL;
+  }
+
+  // Calculate the exact size of every buffer in the output
+  for (int64_t i = 0; i < n; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayViewSetArray(array_view, arrays[i], error));
+    int result = ArrowArrayViewAddRangeSizes(sizes, array_view, 0, array_view->length);
+    if (result != NANOARROW_OK) {
+      ArrowErrorSet(error, "Failed to calculate buffer sizes for array %ld", (long)i);
+      return result;
+    }
+  }
+
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowArrayStartAppending(out), error);
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowArrayReserveFromSizes(out, sizes), error);
+
+  // Copy the contents of each array
+  for (int64_t i = 0; i < n; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayViewSetArray(array_view, arrays[i], error));
+    int result = ArrowArrayAppendArrayView(out, array_view, 0, array_view->length);
+    if (result != NANOARROW_OK) {
+      ArrowErrorSet(error, "Failed to append array %ld", (long)i);
+      return result;
+    }
+  }
+
+  return ArrowArrayFinishBuildingDefault(out, error);
+}
+
+ArrowErrorCode ArrowArrayConcatenate(struct ArrowArray** arrays, int64_t n,
+                                     struct ArrowSchema* schema, struct ArrowArray* out,
+                                     struct ArrowError* error) {
+  struct ArrowArrayView array_view;
+  struct ArrowArrayView sizes;
+  NANOARROW_RETURN_NOT_OK(ArrowArrayViewInitFromSchema(&array_view, schema, error));
+
+  int result = ArrowArrayViewInitFromSchema(&sizes, schema, error);
+  if (result != NANOARROW_OK) {
+    ArrowArrayViewReset(&array_view);
+    return result;
+  }
+
+  result = ArrowArrayInitFromSchema(out, schema, error);
+  if (result != NANOARROW_OK) {
+    ArrowArrayViewReset(&sizes);
+    ArrowArrayViewReset(&array_view);
+    return result;
+  }
+
+  result = ArrowArrayConcatenateInternal(arrays, n, &array_view, &sizes, out, error);
+  ArrowArrayViewReset(&sizes);
+  ArrowArrayViewReset(&array_view);
+  if (result != NANOARROW_OK) {
+    out->release(out);
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+struct ArrowArraySliceShared {
+  struct ArrowArray array;
+  ArrowRefCount reference_count;
+};
+
+static int64_t ArrowArraySliceSharedUpdate(struct ArrowArraySliceShared* shared,
+                                           int delta) {
+  return ArrowRefCountAdd(&shared->reference_count, delta);
+}
+
+static void ArrowArraySliceSharedSet(struct ArrowArraySliceShared* shared,
+                                     int64_t count) {
+  ArrowRefCountInit(&shared->reference_count, count);
+}
+
+int ArrowArraySliceIsThreadSafe(void) { return NANOARROW_USE_STDATOMIC; }
+
+static void ArrowArraySliceSharedRelease(struct ArrowArraySliceShared* shared) {
+  if (ArrowArraySliceSharedUpdate(shared, -1) == 0) {
+    shared->array.release(&shared->array);
+    ArrowFree(shared);
+  }
+}
+
+// Each node of a slice (including its children and dictionary) holds its own
+// reference to the shared source so that a child moved out of a slice keeps the
+// buffers it points to alive.
+struct ArrowArraySlicePrivate {
+  struct ArrowArraySliceShared* shared;
+  struct ArrowArray* children;
+  struct ArrowArray** child_pointers;
+  struct ArrowArray dictionary;
+};
+
+static void ArrowArraySliceRelease(struct ArrowArray* array) {
+  if (array->release == NULL) {
+    return;
+  }
+
+  struct ArrowArraySlicePrivate* private_data =
+      (struct ArrowArraySlicePrivate*)array->private_data;
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    if (array->children[i]->release != NULL) {
+      array->children[i]->release(array->children[i]);
+    }
+  }
+
+  if (array->dictionary != NULL && array->dictionary->release != NULL) {
+    array->dictionary->release(array->dictionary);
+  }
+
+  ArrowFree(private_data->children);
+  ArrowFree(private_data->child_pointers);
+  ArrowArraySliceSharedRelease(private_data->shared);
+  ArrowFree(private_data);
+  array->release = NULL;
+}
+
+static ArrowErrorCode ArrowArraySliceInitNode(struct ArrowArray* out,
+                                              const struct ArrowArray* src,
+                                              struct ArrowArraySliceShared* shared) {
+  if (src->release == NULL) {
+    return EINVAL;
+  }
+
+  struct ArrowArraySlicePrivate* private_data =
+      (struct ArrowArraySlicePrivate*)ArrowMalloc(sizeof(struct ArrowArraySlicePrivate));
+  if (private_data == NULL) {
+    return ENOMEM;
+  }
+
+  ArrowArraySliceSharedUpdate(shared, 1);
+  private_data->shared = shared;
+  private_data->children = NULL;
+  private_data->child_pointers = NULL;
+
+  // The buffer pointers are borrowed from the source, which the shared reference
+  // keeps alive; children are assigned once they can be released safely
+  out->length = src->length;
+  out->null_count = src->null_count;
+  out->offset = src->offset;
+  out->n_buffers = src->n_buffers;
+  out->n_children = 0;
+  out->buffers = src->buffers;
+  out->children = NULL;
+  out->dictionary = NULL;
+  out->release = &ArrowArraySliceRelease;
+  out->private_data = private_data;
+
+  if (src->n_children > 0) {
+    private_data->children =
+        (struct ArrowArray*)ArrowMalloc(src->n_children * sizeof(struct ArrowArray));
+    private_data->child_pointers =
+        (struct ArrowArray**)ArrowMalloc(src->n_children * sizeof(struct ArrowArray*));
+    if (private_data->children == NULL || private_data->child_pointers == NULL) {
+      out->release(out);
+      return ENOMEM;
+    }
+
+    for (int64_t i = 0; i < src->n_children; i++) {
+      private_data->children[i].release = NULL;
+      private_data->child_pointers[i] = private_data->children + i;
+    }
+
+    out->children = private_data->child_pointers;
+    out->n_children = src->n_children;
+
+    for (int64_t i = 0; i < src->n_children; i++) {
+      int result = ArrowArraySliceInitNode(out->children[i], src->children[i], shared);
+      if (result != NANOARROW_OK) {
+        out->release(out);
+        return result;
+      }
+    }
+  }
+
+  if (src->dictionary != NULL) {
+    private_data->dictionary.release = NULL;
+    out->dictionary = &private_data->dictionary;
+    int result = ArrowArraySliceInitNode(out->dictionary, src->dictionary, shared);
+    if (result != NANOARROW_OK) {
+      out->release(out);
+      return result;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArraySlice(struct ArrowArray* array, int64_t offset,
+                               int64_t length, struct ArrowArray* out) {
+  if (array->release == NULL || offset < 0 || length < 0 ||
+      offset > array->length - length) {
+    return EINVAL;
+  }
+
+  // The reference taken here is released once out has been created
+  struct ArrowArraySliceShared* shared;
+  if (array->release == &ArrowArraySliceRelease) {
+    shared = ((struct ArrowArraySlicePrivate*)array->private_data)->shared;
+    ArrowArraySliceSharedUpdate(shared, 1);
+  } else {
+    // Move the source into a shared holder and replace it with a slice of its
+    // full range so that array and out can be released in any order
+    shared = (struct ArrowArraySliceShared*)ArrowMalloc(
+        sizeof(struct ArrowArraySliceShared));
+    if (shared == NULL) {
+      return ENOMEM;
+    }
+
+    ArrowArraySliceSharedSet(shared, 1);
+    ArrowArrayMove(array, &shared->array);
+    int result = ArrowArraySliceInitNode(array, &shared->array, shared);
+    if (result != NANOARROW_OK) {
+      ArrowArrayMove(&shared->array, array);
+      ArrowFree(shared);
+      return result;
+    }
+  }
+
+  int result = ArrowArraySliceInitNode(out, array, shared);
+  ArrowArraySliceSharedRelease(shared);
+  NANOARROW_RETURN_NOT_OK(result);
+
+  // Only the top level is sliced: children keep the offset and length of the
+  // source so that they remain valid for any parent type
+  if (offset != 0 || length != array->length) {
+    out->offset = array->offset + offset;
+    out->length = length;
+    if (array->null_count != 0) {
+      out->null_count = -1;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+// A block written by ArrowArrayWriteRelocatable() starts with a header followed by
+// the nodes of the schema and array (written after their children, such that every
+// node refers only to nodes at smaller offsets), their strings and pointer arrays,
+// and the contents of every buffer. Pointers are written as offsets from the start
+// of the block (with zero representing NULL) and replaced with addresses when the
+// block is read.
+#define NANOARROW_RELOCATABLE_MAGIC "NARELOC1"
+#define NANOARROW_RELOCATABLE_ALIGNMENT 64
+
+struct ArrowRelocatableHeader {
+  char magic[8];
+  int64_t byte_order;
+  int64_t pointer_size;
+  int64_t size_bytes;
+  int64_t schema_offset;
+  int64_t array_offset;
+};
+
+struct ArrowRelocatableWriter {
+  struct ArrowBuffer* out;
+  int64_t base;
+};
+
+static ArrowErrorCode ArrowRelocatableWrite(struct ArrowRelocatableWriter* writer,
+                                            const void* data, int64_t size_bytes,
+                                            int64_t alignment, void** pointer_out) {
+  int64_t offset = writer->out->size_bytes - writer->base;
+  int64_t padding = (alignment - offset % alignment) % alignment;
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(writer->out, padding + size_bytes));
+  ArrowBufferAppendFill(writer->out, 0, padding);
+  ArrowBufferAppendUnsafe(writer->out, data, size_bytes);
+  *pointer_out = (void*)(uintptr_t)(offset + padding);
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowRelocatableWriteSchema(struct ArrowRelocatableWriter* writer,
+                                                  struct ArrowSchema* schema,
+                                                  void** pointer_out) {
+  struct ArrowSchema node;
+  memset(&node, 0, sizeof(struct ArrowSchema));
+  node.flags = schema->flags;
+  node.n_children = schema->n_children;
+
+  NANOARROW_RETURN_NOT_OK(ArrowRelocatableWrite(
+      writer, schema->format, strlen(schema->format) + 1, 1, (void**)&node.format));
+  if (schema->name != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowRelocatableWrite(
+        writer, schema->name, strlen(schema->name) + 1, 1, (void**)&node.name));
+  }
+  if (schema->metadata != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowRelocatableWrite(writer, schema->metadata,
+                                                  ArrowMetadataSizeOf(schema->metadata),
+                                                  1, (void**)&node.metadata));
+  }
+
+  if (schema->n_children > 0) {
+    void** children = (void**)ArrowMalloc(schema->n_children * sizeof(void*));
+    if (children == NULL) {
+      return ENOMEM;
+    }
+
+    int result = NANOARROW_OK;
+    for (int64_t i = 0; i < schema->n_children && result == NANOARROW_OK; i++) {
+      result = ArrowRelocatableWriteSchema(writer, schema->children[i], children + i);
+    }
+    if (result == NANOARROW_OK) {
+      result = ArrowRelocatableWrite(writer, children,
+                                     schema->n_children * sizeof(void*),
+                                     sizeof(void*), (void**)&node.children);
+    }
+
+    ArrowFree(children);
+    NANOARROW_RETURN_NOT_OK(result);
+  }
+
+  if (schema->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowRelocatableWriteSchema(writer, schema->dictionary,
+                                                        (void**)&node.dictionary));
+  }
+
+  return ArrowRelocatableWrite(writer, &node, sizeof(struct ArrowSchema),
+                               sizeof(void*), pointer_out);
+}
+
+// The number of bytes of buffer i of the array of array_view
+static int64_t ArrowRelocatableBufferSize(struct ArrowArrayView* array_view, int64_t i) {
+  int64_t n_buffers = array_view->array->n_buffers;
+  if ((array_view->storage_type == NANOARROW_TYPE_BINARY_VIEW ||
+       array_view->storage_type == NANOARROW_TYPE_STRING_VIEW) &&
+      i >= 2) {
+    if (i == n_buffers - 1) {
+      return array_view->n_variadic_buffers * (int64_t)sizeof(int64_t);
+    } else {
+      return array_view->variadic_buffer_sizes[i - 2];
+    }
+  }
+
+  return array_view->buffer_views[i].size_bytes;
+}
+
+static ArrowErrorCode ArrowRelocatableWriteArray(struct ArrowRelocatableWriter* writer,
+                                                 struct ArrowArrayView* array_view,
+                                                 void** pointer_out) {
+  struct ArrowArray* array = array_view->array;
+  struct ArrowArray node;
+  memset(&node, 0, sizeof(struct ArrowArray));
+  node.length = array->length;
+  node.null_count = array->null_count;
+  node.offset = array->offset;
+  node.n_buffers = array->n_buffers;
+  node.n_children = array->n_children;
+
+  // The pointers to buffers followed by the pointers to children
+  int64_t n_pointers = array->n_buffers + array->n_children;
+  void** pointers = NULL;
+  if (n_pointers > 0) {
+    pointers = (void**)ArrowMalloc(n_pointers * sizeof(void*));
+    if (pointers == NULL) {
+      return ENOMEM;
+    }
+  }
+
+  int result = NANOARROW_OK;
+  for (int64_t i = 0; i < array->n_buffers && result == NANOARROW_OK; i++) {
+    pointers[i] = NULL;
+    if (array->buffers[i] != NULL) {
+      result = ArrowRelocatableWrite(writer, array->buffers[i],
+                                     ArrowRelocatableBufferSize(array_view, i),
+                                     NANOARROW_RELOCATABLE_ALIGNMENT, pointers + i);
+    }
+  }
+
+  for (int64_t i = 0; i < array->n_children && result == NANOARROW_OK; i++) {
+    result = ArrowRelocatableWriteArray(writer, array_view->children[i],
+                                        pointers + array->n_buffers + i);
+  }
+
+  if (result == NANOARROW_OK && array->n_buffers > 0) {
+    result = ArrowRelocatableWrite(writer, pointers, array->n_buffers * sizeof(void*),
+                                   sizeof(void*), (void**)&node.buffers);
+  }
+
+  if (result == NANOARROW_OK && array->n_children > 0) {
+    result = ArrowRelocatableWrite(writer, pointers + array->n_buffers,
+                                   array->n_children * sizeof(void*), sizeof(void*),
+                                   (void**)&node.children);
+  }
+
+  if (pointers != NULL) {
+    ArrowFree(pointers);
+  }
+  NANOARROW_RETURN_NOT_OK(result);
+
+  if (array->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowRelocatableWriteArray(writer, array_view->dictionary,
+                                                       (void**)&node.dictionary));
+  }
+
+  return ArrowRelocatableWrite(writer, &node, sizeof(struct ArrowArray), sizeof(void*),
+                               pointer_out);
+}
+
+ArrowErrorCode ArrowArrayWriteRelocatable(struct ArrowSchema* schema,
+                                          struct ArrowArray* array,
+                                          struct ArrowBuffer* out,
+                                          struct ArrowError* error) {
+  struct ArrowArrayView array_view;
+  NANOARROW_RETURN_NOT_OK(ArrowArrayViewInitFromSchema(&array_view, schema, error));
+  int result = ArrowArrayViewSetArray(&array_view, array, error);
+  if (result != NANOARROW_OK) {
+    ArrowArrayViewReset(&array_view);
+    return result;
+  }
+
+  // The block starts at a multiple of the alignment from the start of out
+  struct ArrowRelocatableWriter writer;
+  struct ArrowRelocatableHeader header;
+  memset(&header, 0, sizeof(struct ArrowRelocatableHeader));
+  writer.out = out;
+  writer.base = 0;
+  void* header_offset = NULL;
+  result = ArrowRelocatableWrite(&writer, &header, sizeof(header),
+                                 NANOARROW_RELOCATABLE_ALIGNMENT, &header_offset);
+  writer.base = (int64_t)(uintptr_t)header_offset;
+
+  void* schema_offset = NULL;
+  void* array_offset = NULL;
+  if (result == NANOARROW_OK) {
+    result = ArrowRelocatableWriteSchema(&writer, schema, &schema_offset);
+  }
+  if (result == NANOARROW_OK) {
+    result = ArrowRelocatableWriteArray(&writer, &array_view, &array_offset);
+  }
+
+  ArrowArrayViewReset(&array_view);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "Failed to write relocatable block");
+    return result;
+  }
+
+  memcpy(header.magic, NANOARROW_RELOCATABLE_MAGIC, sizeof(header.magic));
+  header.byte_order = 1;
+  header.pointer_size = sizeof(void*);
+  header.size_bytes = out->size_bytes - writer.base;
+  header.schema_offset = (int64_t)(uintptr_t)schema_offset;
+  header.array_offset = (int64_t)(uintptr_t)array_offset;
+  memcpy(out->data + writer.base, &header, sizeof(header));
+  return NANOARROW_OK;
+}
+
+struct ArrowRelocatableReader {
+  uint8_t* data;
+  int64_t size_bytes;
+  int64_t n_nodes;
+  struct ArrowArraySliceShared* shared;
+  struct ArrowError* error;
+};
+
+// Replace the offset at *pointer (which may be NULL) with the address of a range of
+// at least size_bytes bytes that ends before the offset limit
+static ArrowErrorCode ArrowRelocatableResolve(struct ArrowRelocatableReader* reader,
+                                             void** pointer, int64_t size_bytes,
+                                             int64_t alignment, int64_t limit) {
+  int64_t offset = (int64_t)(uintptr_t)(*pointer);
+  if (offset == 0) {
+    return NANOARROW_OK;
+  }
+
+  if (offset < (int64_t)sizeof(struct ArrowRelocatableHeader) || offset > limit ||
+      size_bytes > (limit - offset) || (offset % alignment) != 0) {
+    ArrowErrorSet(reader->error,
+                  "Expected range of %ld bytes at offset %ld to be within %ld bytes of "
+                  "relocatable block",
+                  (long)size_bytes, (long)offset, (long)limit);
+    return EINVAL;
+  }
+
+  *pointer = reader->data + offset;
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowRelocatableResolveString(struct ArrowRelocatableReader* reader,
+                                                   const char** pointer) {
+  NANOARROW_RETURN_NOT_OK(
+      ArrowRelocatableResolve(reader, (void**)pointer, 1, 1, reader->size_bytes));
+  if (*pointer != NULL &&
+      memchr(*pointer, '\0', reader->data + reader->size_bytes - (uint8_t*)*pointer) ==
+          NULL) {
+    ArrowErrorSet(reader->error, "Expected null-terminated string in relocatable block");
+    return EINVAL;
+  }
+
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowRelocatableResolveMetadata(
+    struct ArrowRelocatableReader* reader, const char** pointer) {
+  NANOARROW_RETURN_NOT_OK(ArrowRelocatableResolve(
+      reader, (void**)pointer, sizeof(int32_t), 1, reader->size_bytes));
+  if (*pointer == NULL) {
+    return NANOARROW_OK;
+  }
+
+  // Check that each length-prefixed key and value is within the block
+  const uint8_t* end = reader->data + reader->size_bytes;
+  const uint8_t* position = (const uint8_t*)*pointer;
+  int32_t n_pairs;
+  memcpy(&n_pairs, position, sizeof(int32_t));
+  position += sizeof(int32_t);
+  for (int64_t i = 0; i < 2 * (int64_t)n_pairs; i++) {
+    int32_t size_bytes = -1;
+    if ((end - position) >= (int64_t)sizeof(int32_t)) {
+      memcpy(&size_bytes, position, sizeof(int32_t));
+      position += sizeof(int32_t);
+    }
+
+    if (size_bytes < 0 || size_bytes > (end - position)) {
+      ArrowErrorSet(reader->error, "Expected metadata to be within relocatable block");
+      return EINVAL;
+    }
+
+    position += size_bytes;
+  }
+
+  return NANOARROW_OK;
+}
+
+static void ArrowRelocatableSchemaRelease(struct ArrowSchema* schema) {
+  schema->release = NULL;
+}
+
+static ArrowErrorCode ArrowRelocatableReadSchema(struct ArrowRelocatableReader* reader,
+                                                struct ArrowSchema** pointer,
+                                                int64_t limit) {
+  NANOARROW_RETURN_NOT_OK(ArrowRelocatableResolve(
+      reader, (void**)pointer, sizeof(struct ArrowSchema), sizeof(void*), limit));
+  struct ArrowSchema* schema = *pointer;
+  if (schema == NULL) {
+    return NANOARROW_OK;
+  }
+
+  // Children and the dictionary were written before (i.e., at a smaller offset
+  // than) their parent, which rules out cycles
+  int64_t offset = (uint8_t*)schema - reader->data;
+  if (schema->format == NULL || schema->n_children < 0 ||
+      schema->n_children > (int64_t)(offset / sizeof(void*))) {
+    ArrowErrorSet(reader->error, "Invalid schema in relocatable block");
+    return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowRelocatableResolveString(reader, &schema->format));
+  NANOARROW_RETURN_NOT_OK(ArrowRelocatableResolveString(reader, &schema->name));
+  NANOARROW_RETURN_NOT_OK(ArrowRelocatableResolveMetadata(reader, &schema->metadata));
+  NANOARROW_RETURN_NOT_OK(ArrowRelocatableResolve(
+      reader, (void**)&schema->children, schema->n_children * sizeof(void*),
+      sizeof(void*), offset));
+  if (schema->n_children > 0 && schema->children == NULL) {
+    ArrowErrorSet(reader->error,
+                  "Expected %ld schema children in relocatable block but found NULL",
+                  (long)schema->n_children);
+    return EINVAL;
+  }
+
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowRelocatableReadSchema(reader, schema->children + i, offset));
+    if (schema->children[i] == NULL) {
+      ArrowErrorSet(reader->error, "Expected schema child %ld in relocatable block",
+                    (long)i);
+      return EINVAL;
+    }
+  }
+  NANOARROW_RETURN_NOT_OK(
+      ArrowRelocatableReadSchema(reader, &schema->dictionary, offset));
+
+  schema->release = &ArrowRelocatableSchemaRelease;
+  schema->private_data = NULL;
+  return NANOARROW_OK;
+}
+
+// Each node of a relocatable array (including its children and dictionary) lives in
+// the block and holds a reference to a shared holder of the block
+static void ArrowRelocatableArrayRelease(struct ArrowArray* array) {
+  if (array->release == NULL) {
+    return;
+  }
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    if (array->children[i]->release != NULL) {
+      array->children[i]->release(array->children[i]);
+    }
+  }
+
+  if (array->dictionary != NULL && array->dictionary->release != NULL) {
+    array->dictionary->release(array->dictionary);
+  }
+
+  array->release = NULL;
+  ArrowArraySliceSharedRelease((struct ArrowArraySliceShared*)array->private_data);
+}
+
+static ArrowErrorCode ArrowRelocatableReadArray(struct ArrowRelocatableReader* reader,
+                                               struct ArrowArray** pointer,
+                                               int64_t limit) {
+  NANOARROW_RETURN_NOT_OK(ArrowRelocatableResolve(
+      reader, (void**)pointer, sizeof(struct ArrowArray), sizeof(void*), limit));
+  struct ArrowArray* array = *pointer;
+  if (array == NULL) {
+    return NANOARROW_OK;
+  }
+
+  int64_t offset = (uint8_t*)array - reader->data;
+  int64_t max_pointers = offset / sizeof(void*);
+  if (array->n_buffers < 0 || array->n_buffers > max_pointers ||
+      array->n_children < 0 || array->n_children > max_pointers) {
+    ArrowErrorSet(reader->error, "Invalid array in relocatable block");
+    return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowRelocatableResolve(reader, (void**)&array->buffers,
+                                                  array->n_buffers * sizeof(void*),
+                                                  sizeof(void*), offset));
+  if (array->n_buffers > 0 && array->buffers == NULL) {
+    ArrowErrorSet(reader->error,
+                  "Expected %ld array buffers in relocatable block but found NULL",
+                  (long)array->n_buffers);
+    return EINVAL;
+  }
+
+  for (int64_t i = 0; i < array->n_buffers; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowRelocatableResolve(
+        reader, (void**)(array->buffers + i), 0, NANOARROW_RELOCATABLE_ALIGNMENT,
+        offset));
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowRelocatableResolve(reader, (void**)&array->children,
+                                                  array->n_children * sizeof(void*),
+                                                  sizeof(void*), offset));
+  if (array->n_children > 0 && array->children == NULL) {
+    ArrowErrorSet(reader->error,
+                  "Expected %ld array children in relocatable block but found NULL",
+                  (long)array->n_children);
+    return EINVAL;
+  }
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowRelocatableReadArray(reader, array->children + i, offset));
+    if (array->children[i] == NULL) {
+      ArrowErrorSet(reader->error, "Expected array child %ld in relocatable block",
+                    (long)i);
+      return EINVAL;
+    }
+  }
+  NANOARROW_RETURN_NOT_OK(ArrowRelocatableReadArray(reader, &array->dictionary, offset));
+
+  // Nodes are only released once the whole block has been read
+  array->release = NULL;
+  array->private_data = reader->shared;
+  reader->n_nodes++;
+  return NANOARROW_OK;
+}
+
+static void ArrowRelocatableArraySetRelease(struct ArrowArray* array) {
+  for (int64_t i = 0; i < array->n_children; i++) {
+    ArrowRelocatableArraySetRelease(array->children[i]);
+  }
+
+  if (array->dictionary != NULL) {
+    ArrowRelocatableArraySetRelease(array->dictionary);
+  }
+
+  array->release = &ArrowRelocatableArrayRelease;
+}
+
+static void ArrowRelocatableBlockRelease(struct ArrowArray* array) {
+  struct ArrowBuffer* block = (struct ArrowBuffer*)array->private_data;
+  ArrowBufferReset(block);
+  ArrowFree(block);
+  array->release = NULL;
+}
+
+ArrowErrorCode ArrowArrayReadRelocatable(struct ArrowBuffer* block,
+                                         struct ArrowSchema* schema_out,
+                                         struct ArrowArray* array_out,
+                                         struct ArrowError* error) {
+  struct ArrowRelocatableHeader header;
+  if (block->size_bytes < (int64_t)sizeof(header) ||
+      ((uintptr_t)block->data % sizeof(void*)) != 0) {
+    ArrowErrorSet(error, "Expected pointer-aligned relocatable block of >= %ld bytes",
+                  (long)sizeof(header));
+    return EINVAL;
+  }
+
+  memcpy(&header, block->data, sizeof(header));
+  if (memcmp(header.magic, NANOARROW_RELOCATABLE_MAGIC, sizeof(header.magic)) != 0 ||
+      header.byte_order != 1 || header.pointer_size != (int64_t)sizeof(void*)) {
+    ArrowErrorSet(error,
+                  "Expected relocatable block written on a platform with the same byte "
+                  "order and pointer size");
+    return EINVAL;
+  }
+
+  if (header.size_bytes > block->size_bytes) {
+    ArrowErrorSet(error, "Expected relocatable block of %ld bytes but found %ld",
+                  (long)header.size_bytes, (long)block->size_bytes);
+    return EINVAL;
+  }
+
+  struct ArrowArraySliceShared* shared =
+      (struct ArrowArraySliceShared*)ArrowMalloc(sizeof(struct ArrowArraySliceShared));
+  struct ArrowBuffer* holder =
+      (struct ArrowBuffer*)ArrowMalloc(sizeof(struct ArrowBuffer));
+  if (shared == NULL || holder == NULL) {
+    ArrowFree(shared);
+    ArrowFree(holder);
+    ArrowErrorSet(error, "Failed to allocate holder of relocatable block");
+    return ENOMEM;
+  }
+
+  struct ArrowRelocatableReader reader;
+  reader.data = block->data;
+  reader.size_bytes = header.size_bytes;
+  reader.n_nodes = 0;
+  reader.shared = shared;
+  reader.error = error;
+
+  struct ArrowSchema* schema = (struct ArrowSchema*)(uintptr_t)header.schema_offset;
+  struct ArrowArray* array = (struct ArrowArray*)(uintptr_t)header.array_offset;
+  int result = ArrowRelocatableReadSchema(&reader, &schema, header.size_bytes);
+  if (result == NANOARROW_OK) {
+    result = ArrowRelocatableReadArray(&reader, &array, header.size_bytes);
+  }
+  if (result == NANOARROW_OK && (schema == NULL || array == NULL)) {
+    ArrowErrorSet(error, "Expected schema and array in relocatable block");
+    result = EINVAL;
+  }
+  if (result == NANOARROW_OK && schema_out != NULL) {
+    result = ArrowSchemaDeepCopy(schema, schema_out);
+  }
+  if (result != NANOARROW_OK) {
+    ArrowFree(shared);
+    ArrowFree(holder);
+    return result;
+  }
+
+  // The block is owned by the shared holder from here
+  ArrowBufferMove(block, holder);
+  shared->array.release = &ArrowRelocatableBlockRelease;
+  shared->array.private_data = holder;
+  ArrowArraySliceSharedSet(shared, reader.n_nodes);
+  ArrowRelocatableArraySetRelease(array);
+  ArrowArrayMove(array, array_out);
+  return NANOARROW_OK;
+}
+
+struct ArrowArrayProjectChild {
+  struct ArrowArray* child;
+  int64_t position;
+};
+
+// array is a node of a slice, whose children can be released individually
+static ArrowErrorCode ArrowArrayProjectNode(
+    struct ArrowArray* array, const struct ArrowSchemaProjection* projection,
+    int64_t* node) {
+  int64_t n_children = projection->n_children[(*node)++];
+  if (n_children == -1) {
+    return NANOARROW_OK;
+  }
+
+  if (n_children > array->n_children) {
+    return EINVAL;
+  }
+
+  struct ArrowArrayProjectChild* selected = NULL;
+  if (n_children > 0) {
+    selected = (struct ArrowArrayProjectChild*)ArrowMalloc(
+        n_children * sizeof(struct ArrowArrayProjectChild));
+    if (selected == NULL) {
+      return ENOMEM;
+    }
+  }
+
+  // Selected children are taken from array->children so that each can only be
+  // selected once and are restored if the projection is not compatible
+  int result = NANOARROW_OK;
+  int64_t n_selected = 0;
+  while (n_selected < n_children) {
+    int64_t position = *node < projection->n_nodes ? projection->child_index[*node] : -1;
+    if (position < 0 || position >= array->n_children ||
+        array->children[position] == NULL) {
+      result = EINVAL;
+      break;
+    }
+
+    selected[n_selected].child = array->children[position];
+    selected[n_selected].position = position;
+    array->children[position] = NULL;
+    n_selected++;
+
+    result = ArrowArrayProjectNode(selected[n_selected - 1].child, projection, node);
+    if (result != NANOARROW_OK) {
+      break;
+    }
+  }
+
+  if (result != NANOARROW_OK) {
+    for (int64_t i = 0; i < n_selected; i++) {
+      array->children[selected[i].position] = selected[i].child;
+    }
+  } else {
+    for (int64_t i = 0; i < array->n_children; i++) {
+      if (array->children[i] != NULL) {
+        array->children[i]->release(array->children[i]);
+      }
+    }
+
+    for (int64_t i = 0; i < n_children; i++) {
+      array->children[i] = selected[i].child;
+    }
+
+    array->n_children = n_children;
+  }
+
+  if (selected != NULL) {
+    ArrowFree(selected);
+  }
+
+  return result;
+}
+
+ArrowErrorCode ArrowArrayProject(struct ArrowArray* array,
+                                 const struct ArrowSchemaProjection* projection,
+                                 struct ArrowArray* out, struct ArrowError* error) {
+  if (projection->n_nodes == 0) {
+    ArrowErrorSet(error, "Expected initialized projection");
+    return EINVAL;
+  }
+
+  int result = ArrowArraySlice(array, 0, array->length, out);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "ArrowArraySlice() failed with errno %d", result);
+    return result;
+  }
+
+  int64_t node = 0;
+  result = ArrowArrayProjectNode(out, projection, &node);
+  if (result != NANOARROW_OK) {
+    out->release(out);
+    ArrowErrorSet(error, "ArrowArrayProject() failed with errno %d", result);
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+// Copy the dictionaries of array_view and its children, which
+// ArrowArrayAppendArrayView() does not append
+static ArrowErrorCode ArrowArrayDeepCopyDictionaries(struct ArrowArray* array,
+                                                     struct ArrowArrayView* array_view) {
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayDeepCopyDictionaries(array->children[i], array_view->children[i]));
+  }
+
+  if (array_view->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayAppendArrayView(
+        array->dictionary, array_view->dictionary, 0, array_view->dictionary->length));
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayDeepCopyDictionaries(array->dictionary, array_view->dictionary));
+  }
+
+  return NANOARROW_OK;
+}
+
+struct ArrowArrayDeepCopyTask {
+  struct ArrowArray* array;
+  struct ArrowArrayView* array_view;
+  int* results;
+};
+
+// Copy the elements of child i of a struct that correspond to the elements of
+// the struct
+static void ArrowArrayDeepCopyColumn(void* task_private, int64_t i) {
+  struct ArrowArrayDeepCopyTask* task = (struct ArrowArrayDeepCopyTask*)task_private;
+  struct ArrowArray* child = task->array->children[i];
+  struct ArrowArrayView* child_view = task->array_view->children[i];
+
+  task->results[i] = ArrowArrayAppendArrayView(
+      child, child_view, task->array_view->offset, task->array_view->length);
+  if (task->results[i] == NANOARROW_OK) {
+    task->results[i] = ArrowArrayDeepCopyDictionaries(child, child_view);
+  }
+}
+
+static ArrowErrorCode ArrowArrayDeepCopyInternal(struct ArrowArrayView* array_view,
+                                                 struct ArrowExecutor* executor,
+                                                 struct ArrowArray* out) {
+  NANOARROW_RETURN_NOT_OK(ArrowArrayStartAppending(out));
+
+  if (executor == NULL || array_view->storage_type != NANOARROW_TYPE_STRUCT ||
+      array_view->n_children < 2) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayAppendArrayView(out, array_view, 0, array_view->length));
+    return ArrowArrayDeepCopyDictionaries(out, array_view);
+  }
+
+  // The validity of the struct is copied on this thread and each column is
+  // copied by its own task. Each child of out has its own buffers and allocator,
+  // so tasks do not share any state other than their result.
+  int* results = (int*)ArrowMalloc(array_view->n_children * sizeof(int));
+  if (results == NULL) {
+    return ENOMEM;
+  }
+
+  struct ArrowArrayDeepCopyTask task;
+  task.array = out;
+  task.array_view = array_view;
+  task.results = results;
+  executor->parallel_for(executor, &ArrowArrayDeepCopyColumn, &task,
+                         array_view->n_children);
+
+  int result = NANOARROW_OK;
+  for (int64_t i = 0; i < array_view->n_children && result == NANOARROW_OK; i++) {
+    result = results[i];
+  }
+  ArrowFree(results);
+  NANOARROW_RETURN_NOT_OK(result);
+
+  const uint8_t* validity = array_view->buffer_views[0].data.as_uint8;
+  if (array_view->buffer_views[0].size_bytes == 0) {
+    validity = NULL;
+  }
+
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)out->private_data;
+  private_data->built_by_append = 0;
+  NANOARROW_RETURN_NOT_OK(
+      _ArrowArrayAppendValidity(out, validity, array_view->offset, array_view->length));
+  out->length = array_view->length;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayViewDeepCopy(struct ArrowArrayView* array_view,
+                                      struct ArrowExecutor* executor,
+                                      struct ArrowArray* out, struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromArrayView(out, array_view, error));
+
+  int result = ArrowArrayDeepCopyInternal(array_view, executor, out);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "ArrowArrayViewDeepCopy() failed with errno %d", result);
+    out->release(out);
+    return result;
+  }
+
+  result = ArrowArrayFinishBuildingDefault(out, error);
+  if (result != NANOARROW_OK) {
+    out->release(out);
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+struct ArrowArrayViewMorselTask {
+  struct ArrowArrayView* array_view;
+  int64_t morsel_size;
+  ArrowErrorCode (*task)(void* task_private, struct ArrowArrayView* morsel,
+                         int64_t start, struct ArrowError* error);
+  void* task_private;
+  int* results;
+  struct ArrowError* errors;
+};
+
+// Run the task for morsel i, a shallow copy of the top level of the view whose
+// offset and length are adjusted such that children are interpreted as before
+static void ArrowArrayViewRunMorsel(void* task_private, int64_t i) {
+  struct ArrowArrayViewMorselTask* morsels =
+      (struct ArrowArrayViewMorselTask*)task_private;
+  int64_t start = i * morsels->morsel_size;
+  int64_t length = morsels->array_view->length - start;
+  if (length > morsels->morsel_size) {
+    length = morsels->morsel_size;
+  }
+
+  struct ArrowArrayView morsel = *morsels->array_view;
+  morsel.offset += start;
+  morsel.length = length;
+  if (morsel.null_count != 0) {
+    morsel.null_count = -1;
+  }
+
+  morsels->errors[i].message[0] = '\0';
+  morsels->results[i] =
+      morsels->task(morsels->task_private, &morsel, start, &morsels->errors[i]);
+}
+
+ArrowErrorCode ArrowArrayViewParallelFor(
+    struct ArrowArrayView* array_view, int64_t n_morsels, struct ArrowExecutor* executor,
+    ArrowErrorCode (*task)(void* task_private, struct ArrowArrayView* morsel,
+                           int64_t start, struct ArrowError* error),
+    void* task_private, struct ArrowError* error) {
+  if (n_morsels <= 0) {
+    ArrowErrorSet(error, "Expected n_morsels > 0 but got %ld", (long)n_morsels);
+    return EINVAL;
+  }
+
+  int64_t length = array_view->length;
+  if (length == 0) {
+    return NANOARROW_OK;
+  }
+
+  // Morsels start at a multiple of 64 elements so that tasks writing bitmaps or
+  // blocks of output never share a byte (or word) with another task
+  int64_t morsel_size = (length + n_morsels - 1) / n_morsels;
+  morsel_size = ((morsel_size + 63) / 64) * 64;
+  n_morsels = (length + morsel_size - 1) / morsel_size;
+
+  int* results = (int*)ArrowMalloc(n_morsels * sizeof(int));
+  struct ArrowError* errors =
+      (struct ArrowError*)ArrowMalloc(n_morsels * sizeof(struct ArrowError));
+  if (results == NULL || errors == NULL) {
+    ArrowFree(results);
+    ArrowFree(errors);
+    ArrowErrorSet(error, "Failed to allocate results of %ld morsels", (long)n_morsels);
+    return ENOMEM;
+  }
+
+  struct ArrowArrayViewMorselTask morsels;
+  morsels.array_view = array_view;
+  morsels.morsel_size = morsel_size;
+  morsels.task = task;
+  morsels.task_private = task_private;
+  morsels.results = results;
+  morsels.errors = errors;
+
+  if (executor == NULL) {
+    for (int64_t i = 0; i < n_morsels; i++) {
+      ArrowArrayViewRunMorsel(&morsels, i);
+    }
+  } else {
+    executor->parallel_for(executor, &ArrowArrayViewRunMorsel, &morsels, n_morsels);
+  }
+
+  int result = NANOARROW_OK;
+  for (int64_t i = 0; i < n_morsels; i++) {
+    if (results[i] == NANOARROW_OK) {
+      continue;
+    }
+
+    result = results[i];
+    if (errors[i].message[0] != '\0') {
+      ArrowErrorSet(error, "%s", errors[i].message);
+    } else {
+      ArrowErrorSet(error, "Morsel starting at element %ld failed with errno %d",
+                    (long)(i * morsel_size), result);
+    }
+    break;
+  }
+
+  ArrowFree(results);
+  ArrowFree(errors);
+  return result;
+}
+
+static ArrowErrorCode ArrowArrayFinalizeBuffers(struct ArrowArray* array) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+
+  // A validity bitmap is only allocated when the first null is appended; however,
+  // the append functions may still hold one without any nulls (e.g., one whose
+  // capacity was kept by ArrowArrayResetForReuse()). Omitting it reduces the size of
+  // the output and lets consumers skip null handling. A bitmap that may have been
+  // supplied or modified by the caller is always kept.
+  struct ArrowBitmap* bitmap = &private_data->bitmap;
+  if (private_data->layout.buffer_type[0] == NANOARROW_BUFFER_TYPE_VALIDITY &&
+      bitmap->buffer.data != NULL && private_data->built_by_append &&
+      array->null_count == 0) {
+    ArrowBitmapReset(bitmap);
+  }
+
+  // Otherwise, the only buffer finalizing this currently does is make sure the data
+  // buffer for (Large)String|Binary is never NULL
+  switch (private_data->storage_type) {
+    case NANOARROW_TYPE_BINARY:
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY:
+    case NANOARROW_TYPE_LARGE_STRING:
+      if (_ArrowArrayBuffer(array, 2)->data == NULL) {
+        ArrowBufferAppendUInt8(_ArrowArrayBuffer(array, 2), 0);
+      }
+      break;
+    default:
+      break;
+  }
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayFinalizeBuffers(array->children[i]));
+  }
+
+  if (array->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayFinalizeBuffers(array->dictionary));
+  }
+
+  return NANOARROW_OK;
+}
+
+static void ArrowArrayFlushInternalPointers(struct ArrowArray* array) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+
+  for (int64_t i = 0; i < 3; i++) {
+    private_data->buffer_data[i] = _ArrowArrayBuffer(array, i)->data;
+  }
+
+  // Binary and string view arrays with variadic buffers export validity, views,
+  // each variadic buffer, and the variadic buffer sizes
+  int64_t n_variadic_buffers = private_data->n_variadic_buffers;
+  if (n_variadic_buffers > 0) {
+    const void** buffer_data = private_data->variadic_buffer_data;
+    buffer_data[0] = private_data->buffer_data[0];
+    buffer_data[1] = private_data->buffer_data[1];
+    for (int64_t i = 0; i < n_variadic_buffers; i++) {
+      buffer_data[2 + i] = private_data->variadic_buffers[i].data;
+      private_data->variadic_buffer_sizes[i] =
+          private_data->variadic_buffers[i].size_bytes;
+    }
+    buffer_data[2 + n_variadic_buffers] = private_data->variadic_buffer_sizes;
+
+    array->buffers = buffer_data;
+    array->n_buffers = 3 + n_variadic_buffers;
+  }
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    ArrowArrayFlushInternalPointers(array->children[i]);
+  }
+
+  if (array->dictionary != NULL) {
+    ArrowArrayFlushInternalPointers(array->dictionary);
+  }
+}
+
+static int ArrowArrayValidateFullAppended(struct ArrowArray* array,
+                                          struct ArrowArrayView* array_view,
+                                          struct ArrowError* error);
+
+static void ArrowArrayClearBuiltByAppend(struct ArrowArray* array) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  private_data->built_by_append = 0;
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    ArrowArrayClearBuiltByAppend(array->children[i]);
+  }
+
+  if (array->dictionary != NULL) {
+    ArrowArrayClearBuiltByAppend(array->dictionary);
+  }
+}
+
+static ArrowErrorCode ArrowArrayFinishBuildingInternal(
+    struct ArrowArray* array, enum ArrowValidationLevel validation_level,
+    struct ArrowError* error) {
+  // Even if the data buffer is size zero, the pointer value needed to be non-null
+  // in some implementations (at least one version of Arrow C++ at the time this
+  // was added). Only do this fix if we can assume CPU data access.
+  if (validation_level >= NANOARROW_VALIDATION_LEVEL_DEFAULT) {
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowArrayFinalizeBuffers(array), error);
+  }
+
+  // Make sure the value we get with array->buffers[i] is set to the actual
+  // pointer (which may have changed from the original due to reallocation)
+  ArrowArrayFlushInternalPointers(array);
+
+  if (validation_level == NANOARROW_VALIDATION_LEVEL_NONE) {
+    return NANOARROW_OK;
+  }
+
+  // For validation, initialize an ArrowArrayView with our known buffer sizes
+  struct ArrowArrayView array_view;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowArrayViewInitFromArray(&array_view, array),
+                                     error);
+
+  // Full validation of offsets and views is only needed for arrays whose buffers may
+  // have been modified other than by the append functions
+  int result;
+  if (validation_level == NANOARROW_VALIDATION_LEVEL_FULL) {
+    result = ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_DEFAULT,
+                                    error);
+    if (result == NANOARROW_OK) {
+      result = ArrowArrayValidateFullAppended(array, &array_view, error);
+    }
+  } else {
+    result = ArrowArrayViewValidate(&array_view, validation_level, error);
+  }
+
+  ArrowArrayViewReset(&array_view);
+  return result;
+}
+
+ArrowErrorCode ArrowArrayFinishBuilding(struct ArrowArray* array,
+                                        enum ArrowValidationLevel validation_level,
+                                        struct ArrowError* error) {
+  NANOARROW_TRACE(NANOARROW_TRACE_ARRAY_FINISH_BUILDING_BEGIN, validation_level,
+                  array->length);
+  int result = ArrowArrayFinishBuildingInternal(array, validation_level, error);
+  NANOARROW_TRACE(NANOARROW_TRACE_ARRAY_FINISH_BUILDING_END, result, 0);
+
+  // Once buffers are exported they may be modified through array->buffers, so
+  // subsequent calls can no longer rely on the guarantees of the append functions
+  ArrowArrayClearBuiltByAppend(array);
+  return result;
+}
+
+ArrowErrorCode ArrowArrayFinishBuildingDefault(struct ArrowArray* array,
+                                               struct ArrowError* error) {
+  return ArrowArrayFinishBuilding(array, NANOARROW_VALIDATION_LEVEL_DEFAULT, error);
+}
+
+// The number of elements of the children of array that are referenced by its
+// elements or -1 for types whose children are not trimmed
+static int64_t ArrowArrayReferencedChildLength(struct ArrowArray* array) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  int64_t n = array->offset + array->length;
+  struct ArrowBuffer* offsets = &private_data->buffers[0];
+
+  switch (private_data->storage_type) {
+    case NANOARROW_TYPE_LIST:
+    case NANOARROW_TYPE_MAP:
+      if (offsets->size_bytes < (n + 1) * (int64_t)sizeof(int32_t)) {
+        return n == 0 ? 0 : -1;
+      }
+      return ((const int32_t*)offsets->data)[n];
+    case NANOARROW_TYPE_LARGE_LIST:
+      if (offsets->size_bytes < (n + 1) * (int64_t)sizeof(int64_t)) {
+        return n == 0 ? 0 : -1;
+      }
+      return ((const int64_t*)offsets->data)[n];
+    case NANOARROW_TYPE_FIXED_SIZE_LIST:
+      return n * private_data->layout.child_size_elements;
+    case NANOARROW_TYPE_STRUCT:
+    case NANOARROW_TYPE_SPARSE_UNION:
+      return n;
+    default:
+      return -1;
+  }
+}
+
+// The number of bytes of buffer i (which is not the validity buffer) referenced by
+// the elements of array or -1 if the buffer is not trimmed
+static int64_t ArrowArrayReferencedBufferSize(struct ArrowArray* array, int64_t i) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  int64_t n = array->offset + array->length;
+  int64_t element_size_bits = private_data->layout.element_size_bits[i];
+
+  switch (private_data->layout.buffer_type[i]) {
+    case NANOARROW_BUFFER_TYPE_TYPE_ID:
+    case NANOARROW_BUFFER_TYPE_UNION_OFFSET:
+    case NANOARROW_BUFFER_TYPE_VIEW_OFFSET:
+    case NANOARROW_BUFFER_TYPE_SIZE:
+      return n * element_size_bits / 8;
+    case NANOARROW_BUFFER_TYPE_DATA_OFFSET:
+      return (n + 1) * element_size_bits / 8;
+    case NANOARROW_BUFFER_TYPE_DATA:
+      break;
+    default:
+      return -1;
+  }
+
+  if (element_size_bits > 0) {
+    return _ArrowBytesForBits(n * element_size_bits);
+  }
+
+  // The data of a string or binary array ends at its last offset
+  struct ArrowBuffer* offsets = &private_data->buffers[0];
+  if (i != 2 ||
+      private_data->layout.buffer_type[1] != NANOARROW_BUFFER_TYPE_DATA_OFFSET) {
+    return -1;
+  } else if (private_data->layout.element_size_bits[1] == 32 &&
+             offsets->size_bytes >= (n + 1) * (int64_t)sizeof(int32_t)) {
+    return ((const int32_t*)offsets->data)[n];
+  } else if (private_data->layout.element_size_bits[1] == 64 &&
+             offsets->size_bytes >= (n + 1) * (int64_t)sizeof(int64_t)) {
+    return ((const int64_t*)offsets->data)[n];
+  } else {
+    return n == 0 ? 0 : -1;
+  }
+}
+
+static ArrowErrorCode ArrowArrayShrinkToFitInternal(struct ArrowArray* array) {
+  if (array->release != &ArrowArrayRelease) {
+    return EINVAL;
+  }
+
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  int64_t n = array->offset + array->length;
+
+  // Trim values past the end of the array (e.g., left by ArrowArraySetBuffer() or
+  // values of a child that are no longer referenced) before releasing capacity
+  struct ArrowBitmap* bitmap = &private_data->bitmap;
+  if (bitmap->size_bits > n) {
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapResize(bitmap, n, 0));
+  }
+  NANOARROW_RETURN_NOT_OK(ArrowBitmapResize(bitmap, bitmap->size_bits, 1));
+
+  for (int64_t i = 1; i < 3; i++) {
+    struct ArrowBuffer* buffer = _ArrowArrayBuffer(array, i);
+    int64_t size_bytes = ArrowArrayReferencedBufferSize(array, i);
+    if (size_bytes >= 0 && size_bytes < buffer->size_bytes) {
+      buffer->size_bytes = size_bytes;
+    }
+  }
+
+  for (int64_t i = 1; i < 3; i++) {
+    struct ArrowBuffer* buffer = _ArrowArrayBuffer(array, i);
+    NANOARROW_RETURN_NOT_OK(ArrowBufferResize(buffer, buffer->size_bytes, 1));
+  }
+
+  for (int64_t i = 0; i < private_data->n_variadic_buffers; i++) {
+    struct ArrowBuffer* buffer = private_data->variadic_buffers + i;
+    NANOARROW_RETURN_NOT_OK(ArrowBufferResize(buffer, buffer->size_bytes, 1));
+  }
+
+  int64_t child_length = ArrowArrayReferencedChildLength(array);
+  for (int64_t i = 0; i < array->n_children; i++) {
+    struct ArrowArray* child = array->children[i];
+    if (child_length >= 0 && child->length > child_length) {
+      child->length = child_length;
+      if (child->null_count != 0) {
+        child->null_count = -1;
+      }
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowArrayShrinkToFitInternal(child));
+  }
+
+  if (array->null_count == -1) {
+    const uint8_t* validity = bitmap->buffer.data;
+    array->null_count =
+        validity == NULL
+            ? 0
+            : array->length - ArrowBitCountSet(validity, array->offset, array->length);
+  }
+
+  if (array->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayShrinkToFitInternal(array->dictionary));
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayShrinkToFit(struct ArrowArray* array) {
+  NANOARROW_RETURN_NOT_OK(ArrowArrayShrinkToFitInternal(array));
+
+  // Buffers may have been reallocated after being exported to array->buffers
+  ArrowArrayFlushInternalPointers(array);
+  return NANOARROW_OK;
+}
+
+static int64_t ArrowIntTypeSizeBytes(enum ArrowType type) {
+  switch (type) {
+    case NANOARROW_TYPE_INT8:
+    case NANOARROW_TYPE_UINT8:
+      return 1;
+    case NANOARROW_TYPE_INT16:
+    case NANOARROW_TYPE_UINT16:
+      return 2;
+    case NANOARROW_TYPE_INT32:
+    case NANOARROW_TYPE_UINT32:
+      return 4;
+    default:
+      return 8;
+  }
+}
+
+// Load n integers of the given storage type into int64_t values
+static void ArrowIntsLoad(const uint8_t* data, enum ArrowType type, int64_t n,
+                          int64_t* out) {
+  switch (type) {
+    case NANOARROW_TYPE_INT64:
+      memcpy(out, data, n * sizeof(int64_t));
+      break;
+    case NANOARROW_TYPE_UINT64:
+      _NANOARROW_CONVERT_VALUES(out, (const uint64_t*)data, n, int64_t);
+      break;
+    case NANOARROW_TYPE_INT32:
+      _NANOARROW_CONVERT_VALUES(out, (const int32_t*)data, n, int64_t);
+      break;
+    case NANOARROW_TYPE_UINT32:
+      _NANOARROW_CONVERT_VALUES(out, (const uint32_t*)data, n, int64_t);
+      break;
+    case NANOARROW_TYPE_INT16:
+      _NANOARROW_CONVERT_VALUES(out, (const int16_t*)data, n, int64_t);
+      break;
+    default:
+      _NANOARROW_CONVERT_VALUES(out, (const uint16_t*)data, n, int64_t);
+      break;
+  }
+}
+
+// Store n int64_t values as integers of a narrower storage type
+static void ArrowIntsStore(uint8_t* data, enum ArrowType type, int64_t n,
+                           const int64_t* values) {
+  switch (type) {
+    case NANOARROW_TYPE_INT32:
+      _NANOARROW_CONVERT_VALUES((int32_t*)data, values, n, int32_t);
+      break;
+    case NANOARROW_TYPE_UINT32:
+      _NANOARROW_CONVERT_VALUES((uint32_t*)data, values, n, uint32_t);
+      break;
+    case NANOARROW_TYPE_INT16:
+      _NANOARROW_CONVERT_VALUES((int16_t*)data, values, n, int16_t);
+      break;
+    case NANOARROW_TYPE_UINT16:
+      _NANOARROW_CONVERT_VALUES((uint16_t*)data, values, n, uint16_t);
+      break;
+    case NANOARROW_TYPE_INT8:
+      _NANOARROW_CONVERT_VALUES((int8_t*)data, values, n, int8_t);
+      break;
+    default:
+      _NANOARROW_CONVERT_VALUES(data, values, n, uint8_t);
+      break;
+  }
+}
+
+// The narrowest integer type of the same signedness as type that can represent
+// the n values of data
+static enum ArrowType ArrowIntsNarrowestType(const uint8_t* data, enum ArrowType type,
+                                             int64_t n) {
+  int64_t values[NANOARROW_KERNEL_BLOCK_SIZE];
+  int64_t element_size = ArrowIntTypeSizeBytes(type);
+  int is_signed = type == NANOARROW_TYPE_INT16 || type == NANOARROW_TYPE_INT32 ||
+                  type == NANOARROW_TYPE_INT64;
+
+  int64_t min_value = 0;
+  uint64_t max_value = 0;
+  for (int64_t i = 0; i < n; i += NANOARROW_KERNEL_BLOCK_SIZE) {
+    int64_t block_n = n - i;
+    if (block_n > NANOARROW_KERNEL_BLOCK_SIZE) {
+      block_n = NANOARROW_KERNEL_BLOCK_SIZE;
+    }
+
+    ArrowIntsLoad(data + i * element_size, type, block_n, values);
+    for (int64_t j = 0; j < block_n; j++) {
+      if (is_signed && values[j] < min_value) {
+        min_value = values[j];
+      }
+
+      // Negative signed values are compared by magnitude
+      uint64_t magnitude = (is_signed && values[j] < 0) ? (uint64_t)(-(values[j] + 1))
+                                                         : (uint64_t)values[j];
+      if (magnitude > max_value) {
+        max_value = magnitude;
+      }
+    }
+  }
+
+  if (is_signed) {
+    if (min_value >= INT8_MIN && max_value <= INT8_MAX) {
+      return NANOARROW_TYPE_INT8;
+    } else if (min_value >= INT16_MIN && max_value <= INT16_MAX) {
+      return NANOARROW_TYPE_INT16;
+    } else if (min_value >= INT32_MIN && max_value <= INT32_MAX) {
+      return NANOARROW_TYPE_INT32;
+    } else {
+      return NANOARROW_TYPE_INT64;
+    }
+  } else {
+    if (max_value <= UINT8_MAX) {
+      return NANOARROW_TYPE_UINT8;
+    } else if (max_value <= UINT16_MAX) {
+      return NANOARROW_TYPE_UINT16;
+    } else if (max_value <= UINT32_MAX) {
+      return NANOARROW_TYPE_UINT32;
+    } else {
+      return NANOARROW_TYPE_UINT64;
+    }
+  }
+}
+
+// Rewrite the n integers of buffer as a narrower type in place (each block of
+// narrower values never extends past the start of the next block of wider values)
+static ArrowErrorCode ArrowBufferNarrowInts(struct ArrowBuffer* buffer,
+                                            enum ArrowType type,
+                                            enum ArrowType narrow_type, int64_t n) {
+  int64_t values[NANOARROW_KERNEL_BLOCK_SIZE];
+  int64_t element_size = ArrowIntTypeSizeBytes(type);
+  int64_t narrow_element_size = ArrowIntTypeSizeBytes(narrow_type);
+  for (int64_t i = 0; i < n; i += NANOARROW_KERNEL_BLOCK_SIZE) {
+    int64_t block_n = n - i;
+    if (block_n > NANOARROW_KERNEL_BLOCK_SIZE) {
+      block_n = NANOARROW_KERNEL_BLOCK_SIZE;
+    }
+
+    ArrowIntsLoad(buffer->data + i * element_size, type, block_n, values);
+    ArrowIntsStore(buffer->data + i * narrow_element_size, narrow_type, block_n, values);
+  }
+
+  return ArrowBufferResize(buffer, n * narrow_element_size, 1);
+}
+
+static const char* ArrowNarrowTypeFormat(enum ArrowType type) {
+  switch (type) {
+    case NANOARROW_TYPE_INT8:
+      return "c";
+    case NANOARROW_TYPE_UINT8:
+      return "C";
+    case NANOARROW_TYPE_INT16:
+      return "s";
+    case NANOARROW_TYPE_UINT16:
+      return "S";
+    case NANOARROW_TYPE_INT32:
+      return "i";
+    case NANOARROW_TYPE_UINT32:
+      return "I";
+    case NANOARROW_TYPE_STRING:
+      return "u";
+    case NANOARROW_TYPE_BINARY:
+      return "z";
+    default:
+      return "+l";
+  }
+}
+
+static ArrowErrorCode ArrowArrayNarrow(struct ArrowArray* array,
+                                       struct ArrowSchema* schema,
+                                       struct ArrowError* error) {
+  if (array->release != &ArrowArrayRelease || array->n_children != schema->n_children ||
+      (array->dictionary == NULL) != (schema->dictionary == NULL)) {
+    ArrowErrorSet(error, "Expected array allocated by nanoarrow from schema");
+    return EINVAL;
+  }
+
+  struct ArrowSchemaView schema_view;
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaViewInit(&schema_view, schema, error));
+
+  // The storage of extension types may have to be of a specific type
+  if (schema_view.extension_name.size_bytes > 0) {
+    return NANOARROW_OK;
+  }
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayNarrow(array->children[i], schema->children[i], error));
+  }
+
+  // Dictionary indices are left as they are
+  if (schema->dictionary != NULL) {
+    return ArrowArrayNarrow(array->dictionary, schema->dictionary, error);
+  }
+
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  struct ArrowBuffer* data = _ArrowArrayBuffer(array, 1);
+  int64_t n = array->offset + array->length;
+  if (n == 0) {
+    return NANOARROW_OK;
+  }
+
+  // Only the storage of integer types (e.g., not timestamps) is narrowed
+  enum ArrowType type = private_data->storage_type;
+  enum ArrowType narrow_type;
+  switch (schema_view.type) {
+    case NANOARROW_TYPE_INT16:
+    case NANOARROW_TYPE_INT32:
+    case NANOARROW_TYPE_INT64:
+    case NANOARROW_TYPE_UINT16:
+    case NANOARROW_TYPE_UINT32:
+    case NANOARROW_TYPE_UINT64:
+      if (data->size_bytes < n * ArrowIntTypeSizeBytes(type)) {
+        return NANOARROW_OK;
+      }
+
+      narrow_type = ArrowIntsNarrowestType(data->data, type, n);
+      if (ArrowIntTypeSizeBytes(narrow_type) == ArrowIntTypeSizeBytes(type)) {
+        return NANOARROW_OK;
+      }
+
+      NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+          ArrowBufferNarrowInts(data, type, narrow_type, n), error);
+      break;
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY:
+    case NANOARROW_TYPE_LARGE_LIST:
+      if (data->size_bytes < (n + 1) * (int64_t)sizeof(int64_t) ||
+          ((const int64_t*)data->data)[n] > INT32_MAX) {
+        return NANOARROW_OK;
+      }
+
+      narrow_type = type == NANOARROW_TYPE_LARGE_STRING   ? NANOARROW_TYPE_STRING
+                    : type == NANOARROW_TYPE_LARGE_BINARY ? NANOARROW_TYPE_BINARY
+                                                          : NANOARROW_TYPE_LIST;
+      NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+          ArrowBufferNarrowInts(data, NANOARROW_TYPE_INT64, NANOARROW_TYPE_INT32, n + 1),
+          error);
+      break;
+    default:
+      return NANOARROW_OK;
+  }
+
+  private_data->storage_type = narrow_type;
+  ArrowLayoutInit(&private_data->layout, narrow_type);
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowSchemaSetFormat(schema, ArrowNarrowTypeFormat(narrow_type)), error);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayFinishBuildingNarrow(struct ArrowArray* array,
+                                              struct ArrowSchema* schema,
+                                              enum ArrowValidationLevel validation_level,
+                                              struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(ArrowArrayNarrow(array, schema, error));
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowArrayShrinkToFit(array), error);
+  return ArrowArrayFinishBuilding(array, validation_level, error);
+}
+
+static ArrowErrorCode ArrowArrayResetForReuseInternal(struct ArrowArray* array) {
+  if (array->release != &ArrowArrayRelease) {
+    return EINVAL;
+  }
+
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+
+  // Keep the capacity of every buffer but discard its contents
+  NANOARROW_RETURN_NOT_OK(ArrowBitmapResize(&private_data->bitmap, 0, 0));
+  NANOARROW_RETURN_NOT_OK(ArrowBufferResize(&private_data->buffers[0], 0, 0));
+  NANOARROW_RETURN_NOT_OK(ArrowBufferResize(&private_data->buffers[1], 0, 0));
+
+  // Variadic buffers are allocated in blocks as needed and are not kept
+  for (int64_t i = 0; i < private_data->n_variadic_buffers; i++) {
+    ArrowBufferReset(&private_data->variadic_buffers[i]);
+  }
+  if (private_data->n_variadic_buffers > 0) {
+    private_data->n_variadic_buffers = 0;
+    array->buffers = private_data->buffer_data;
+    array->n_buffers = 3;
+  }
+
+  array->length = 0;
+  array->null_count = 0;
+  array->offset = 0;
+  private_data->built_by_append = 1;
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayResetForReuseInternal(array->children[i]));
+  }
+
+  if (array->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayResetForReuseInternal(array->dictionary));
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayResetForReuse(struct ArrowArray* array) {
+  NANOARROW_RETURN_NOT_OK(ArrowArrayResetForReuseInternal(array));
+  return ArrowArrayStartAppending(array);
+}
+
+void ArrowArrayViewInitFromType(struct ArrowArrayView* array_view,
+                                enum ArrowType storage_type) {
+  memset(array_view, 0, sizeof(struct ArrowArrayView));
+  array_view->storage_type = storage_type;
+  ArrowLayoutInit(&array_view->layout, storage_type);
+}
+
+ArrowErrorCode ArrowArrayViewAllocateChildren(struct ArrowArrayView* array_view,
+                                              int64_t n_children) {
+  if (array_view->children != NULL) {
+    return EINVAL;
+  }
+
+  array_view->children =
+      (struct ArrowArrayView**)ArrowMalloc(n_children * sizeof(struct ArrowArrayView*));
+  if (array_view->children == NULL) {
+    return ENOMEM;
+  }
+
+  for (int64_t i = 0; i < n_children; i++) {
+    array_view->children[i] = NULL;
+  }
+
+  array_view->n_children = n_children;
+
+  for (int64_t i = 0; i < n_children; i++) {
+    array_view->children[i] =
+        (struct ArrowArrayView*)ArrowMalloc(sizeof(struct ArrowArrayView));
+    if (array_view->children[i] == NULL) {
+      return ENOMEM;
+    }
+    ArrowArrayViewInitFromType(array_view->children[i], NANOARROW_TYPE_UNINITIALIZED);
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayViewAllocateDictionary(struct ArrowArrayView* array_view) {
+  if (array_view->dictionary != NULL) {
+    return EINVAL;
+  }
+
+  array_view->dictionary =
+      (struct ArrowArrayView*)ArrowMalloc(sizeof(struct ArrowArrayView));
+  if (array_view->dictionary == NULL) {
+    return ENOMEM;
+  }
+
+  ArrowArrayViewInitFromType(array_view->dictionary, NANOARROW_TYPE_UNINITIALIZED);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayViewInitFromSchema(struct ArrowArrayView* array_view,
+                                            struct ArrowSchema* schema,
+                                            struct ArrowError* error) {
+  struct ArrowSchemaView schema_view;
+  int result = ArrowSchemaViewInit(&schema_view, schema, error);
+  if (result != NANOARROW_OK) {
+    return result;
+  }
+
+  ArrowArrayViewInitFromType(array_view, schema_view.storage_type);
+  array_view->layout = schema_view.layout;
+
+  result = ArrowArrayViewAllocateChildren(array_view, schema->n_children);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "ArrowArrayViewAllocateChildren() failed");
+    ArrowArrayViewReset(array_view);
+    return result;
+  }
+
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    result =
+        ArrowArrayViewInitFromSchema(array_view->children[i], schema->children[i], error);
+    if (result != NANOARROW_OK) {
+      ArrowArrayViewReset(array_view);
+      return result;
+    }
+  }
+
+  if (schema->dictionary != NULL) {
+    result = ArrowArrayViewAllocateDictionary(array_view);
+    if (result != NANOARROW_OK) {
+      ArrowArrayViewReset(array_view);
+      return result;
+    }
+
+    result =
+        ArrowArrayViewInitFromSchema(array_view->dictionary, schema->dictionary, error);
+    if (result != NANOARROW_OK) {
+      ArrowArrayViewReset(array_view);
+      return result;
+    }
+  }
+
+  if (array_view->storage_type == NANOARROW_TYPE_SPARSE_UNION ||
+      array_view->storage_type == NANOARROW_TYPE_DENSE_UNION) {
+    array_view->union_type_id_map = (int8_t*)ArrowMalloc(256 * sizeof(int8_t));
+    if (array_view->union_type_id_map == NULL) {
+      return ENOMEM;
+    }
+
+    memset(array_view->union_type_id_map, -1, 256);
+    int8_t n_type_ids = _ArrowParseUnionTypeIds(schema_view.union_type_ids,
+                                                array_view->union_type_id_map + 128);
+    for (int8_t child_index = 0; child_index < n_type_ids; child_index++) {
+      int8_t type_id = array_view->union_type_id_map[128 + child_index];
+      array_view->union_type_id_map[type_id] = child_index;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+// Invalid nodes are not counted here because ArrowSchemaLayoutInitNode() rejects
+// them before reserving any indices for them
+static int64_t ArrowSchemaLayoutCountNodes(struct ArrowSchema* schema) {
+  if (schema == NULL || schema->release == NULL) {
+    return 0;
+  }
+
+  int64_t n_nodes = 1;
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    n_nodes += ArrowSchemaLayoutCountNodes(schema->children[i]);
+  }
+
+  if (schema->dictionary != NULL) {
+    n_nodes += ArrowSchemaLayoutCountNodes(schema->dictionary);
+  }
+
+  return n_nodes;
+}
+
+// Nodes are assigned such that the children of a node are contiguous: the indices of
+// a node's children (and dictionary) are reserved before any of them are visited
+static ArrowErrorCode ArrowSchemaLayoutInitNode(struct ArrowSchemaLayout* layout,
+                                                int64_t i, int64_t* next_index,
+                                                struct ArrowSchema* schema,
+                                                struct ArrowError* error) {
+  struct ArrowSchemaView schema_view;
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaViewInit(&schema_view, schema, error));
+
+  struct ArrowSchemaLayoutNode* node = layout->nodes + i;
+  node->storage_type = schema_view.storage_type;
+  node->layout = schema_view.layout;
+  node->n_children = schema->n_children;
+  node->child_index = *next_index;
+  *next_index += schema->n_children;
+
+  if (schema->dictionary != NULL) {
+    node->dictionary_index = *next_index;
+    *next_index += 1;
+  }
+
+  if (node->storage_type == NANOARROW_TYPE_SPARSE_UNION ||
+      node->storage_type == NANOARROW_TYPE_DENSE_UNION) {
+    node->union_type_id_map = (int8_t*)ArrowMalloc(256 * sizeof(int8_t));
+    if (node->union_type_id_map == NULL) {
+      ArrowErrorSet(error, "Failed to allocate union type id map");
+      return ENOMEM;
+    }
+
+    memset(node->union_type_id_map, -1, 256);
+    int8_t n_type_ids = _ArrowParseUnionTypeIds(schema_view.union_type_ids,
+                                                node->union_type_id_map + 128);
+    for (int8_t child_index = 0; child_index < n_type_ids; child_index++) {
+      int8_t type_id = node->union_type_id_map[128 + child_index];
+      node->union_type_id_map[type_id] = child_index;
+    }
+  }
+
+  for (int64_t j = 0; j < schema->n_children; j++) {
+    NANOARROW_RETURN_NOT_OK(ArrowSchemaLayoutInitNode(layout, node->child_index + j,
+                                                      next_index, schema->children[j],
+                                                      error));
+  }
+
+  if (schema->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowSchemaLayoutInitNode(layout, node->dictionary_index,
+                                                      next_index, schema->dictionary,
+                                                      error));
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowSchemaLayoutInit(struct ArrowSchemaLayout* layout,
+                                     struct ArrowSchema* schema,
+                                     struct ArrowError* error) {
+  struct ArrowSchemaView schema_view;
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaViewInit(&schema_view, schema, error));
+
+  layout->n_nodes = ArrowSchemaLayoutCountNodes(schema);
+  layout->nodes = (struct ArrowSchemaLayoutNode*)ArrowMalloc(
+      layout->n_nodes * sizeof(struct ArrowSchemaLayoutNode));
+  if (layout->nodes == NULL) {
+    ArrowErrorSet(error, "Failed to allocate ArrowSchemaLayout with %ld nodes",
+                  (long)layout->n_nodes);
+    return ENOMEM;
+  }
+
+  for (int64_t i = 0; i < layout->n_nodes; i++) {
+    layout->nodes[i].dictionary_index = -1;
+    layout->nodes[i].union_type_id_map = NULL;
+  }
+
+  int64_t next_index = 1;
+  int result = ArrowSchemaLayoutInitNode(layout, 0, &next_index, schema, error);
+  if (result != NANOARROW_OK) {
+    ArrowSchemaLayoutReset(layout);
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+void ArrowSchemaLayoutReset(struct ArrowSchemaLayout* layout) {
+  if (layout->nodes != NULL) {
+    for (int64_t i = 0; i < layout->n_nodes; i++) {
+      if (layout->nodes[i].union_type_id_map != NULL) {
+        ArrowFree(layout->nodes[i].union_type_id_map);
+      }
+    }
+
+    ArrowFree(layout->nodes);
+  }
+
+  layout->n_nodes = 0;
+  layout->nodes = NULL;
+}
+
+static ArrowErrorCode ArrowArrayViewInitFromSchemaLayoutNode(
+    struct ArrowArrayView* array_view, const struct ArrowSchemaLayout* layout,
+    int64_t i) {
+  const struct ArrowSchemaLayoutNode* node = layout->nodes + i;
+  ArrowArrayViewInitFromType(array_view, node->storage_type);
+  array_view->layout = node->layout;
+
+  NANOARROW_RETURN_NOT_OK(ArrowArrayViewAllocateChildren(array_view, node->n_children));
+  for (int64_t j = 0; j < node->n_children; j++) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayViewInitFromSchemaLayoutNode(
+        array_view->children[j], layout, node->child_index + j));
+  }
+
+  if (node->dictionary_index >= 0) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayViewAllocateDictionary(array_view));
+    NANOARROW_RETURN_NOT_OK(ArrowArrayViewInitFromSchemaLayoutNode(
+        array_view->dictionary, layout, node->dictionary_index));
+  }
+
+  if (node->union_type_id_map != NULL) {
+    array_view->union_type_id_map = (int8_t*)ArrowMalloc(256 * sizeof(int8_t));
+    if (array_view->union_type_id_map == NULL) {
+      return ENOMEM;
+    }
+
+    memcpy(array_view->union_type_id_map, node->union_type_id_map, 256);
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayViewInitFromSchemaLayout(struct ArrowArrayView* array_view,
+                                                  const struct ArrowSchemaLayout* layout,
+                                                  struct ArrowError* error) {
+  int result = ArrowArrayViewInitFromSchemaLayoutNode(array_view, layout, 0);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "ArrowArrayViewInitFromSchemaLayout() failed");
+    ArrowArrayViewReset(array_view);
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+void ArrowArrayViewReset(struct ArrowArrayView* array_view) {
+  if (array_view->children != NULL) {
+    for (int64_t i = 0; i < array_view->n_children; i++) {
+      if (array_view->children[i] != NULL) {
+        ArrowArrayViewReset(array_view->children[i]);
+        ArrowFree(array_view->children[i]);
+      }
+    }
+
+    ArrowFree(array_view->children);
+  }
+
+  if (array_view->dictionary != NULL) {
+    ArrowArrayViewReset(array_view->dictionary);
+    ArrowFree(array_view->dictionary);
+  }
+
+  if (array_view->union_type_id_map != NULL) {
+    ArrowFree(array_view->union_type_id_map);
+  }
+
+  ArrowArrayViewInitFromType(array_view, NANOARROW_TYPE_UNINITIALIZED);
+}
+
+void ArrowArrayViewSetLength(struct ArrowArrayView* array_view, int64_t length) {
+  for (int i = 0; i < 3; i++) {
+    int64_t element_size_bytes = array_view->layout.element_size_bits[i] / 8;
+
+    switch (array_view->layout.buffer_type[i]) {
+      case NANOARROW_BUFFER_TYPE_VALIDITY:
+        array_view->buffer_views[i].size_bytes = _ArrowBytesForBits(length);
+        continue;
+      case NANOARROW_BUFFER_TYPE_DATA_OFFSET:
+        // Probably don't want/need to rely on the producer to have allocated an
+        // offsets buffer of length 1 for a zero-size array
+        array_view->buffer_views[i].size_bytes =
+            (length != 0) * element_size_bytes * (length + 1);
+        continue;
+      case NANOARROW_BUFFER_TYPE_DATA:
+        array_view->buffer_views[i].size_bytes =
+            _ArrowRoundUpToMultipleOf8(array_view->layout.element_size_bits[i] * length) /
+            8;
+        continue;
+      case NANOARROW_BUFFER_TYPE_TYPE_ID:
+      case NANOARROW_BUFFER_TYPE_UNION_OFFSET:
+      case NANOARROW_BUFFER_TYPE_VIEW_OFFSET:
+      case NANOARROW_BUFFER_TYPE_SIZE:
+        array_view->buffer_views[i].size_bytes = element_size_bytes * length;
+        continue;
+      case NANOARROW_BUFFER_TYPE_NONE:
+        array_view->buffer_views[i].size_bytes = 0;
+        continue;
+    }
+  }
+
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_STRUCT:
+    case NANOARROW_TYPE_SPARSE_UNION:
+      for (int64_t i = 0; i < array_view->n_children; i++) {
+        ArrowArrayViewSetLength(array_view->children[i], length);
+      }
+      break;
+    case NANOARROW_TYPE_FIXED_SIZE_LIST:
+      if (array_view->n_children >= 1) {
+        ArrowArrayViewSetLength(array_view->children[0],
+                                length * array_view->layout.child_size_elements);
+      }
+    default:
+      break;
+  }
+}
+
+// This version recursively extracts information from the array and stores it
+// in the array view, performing any checks that require the original array.
+static int ArrowArrayViewSetArrayInternal(struct ArrowArrayView* array_view,
+                                          struct ArrowArray* array,
+                                          struct ArrowError* error) {
+  // Check length and offset
+  if (array->offset < 0) {
+    ArrowErrorSet(error, "Expected array offset >= 0 but found array offset of %ld",
+                  (long)array->offset);
+    return EINVAL;
+  }
+
+  if (array->length < 0) {
+    ArrowErrorSet(error, "Expected array length >= 0 but found array length of %ld",
+                  (long)array->length);
+    return EINVAL;
+  }
+
+  array_view->array = array;
+  array_view->offset = array->offset;
+  array_view->length = array->length;
+  array_view->null_count = array->null_count;
+
+  int64_t buffers_required = 0;
+  for (int i = 0; i < 3; i++) {
+    if (array_view->layout.buffer_type[i] == NANOARROW_BUFFER_TYPE_NONE) {
+      break;
+    }
+
+    buffers_required++;
+
+    // Set buffer pointer
+    array_view->buffer_views[i].data.data = array->buffers[i];
+
+    // If non-null, set buffer size to unknown.
+    if (array->buffers[i] == NULL) {
+      array_view->buffer_views[i].size_bytes = 0;
+    } else {
+      array_view->buffer_views[i].size_bytes = -1;
+    }
+  }
+
+  // Binary and string views have a variable number of buffers: validity, views,
+  // each variadic data buffer, and a buffer containing the variadic buffer sizes
+  if (array_view->storage_type == NANOARROW_TYPE_BINARY_VIEW ||
+      array_view->storage_type == NANOARROW_TYPE_STRING_VIEW) {
+    if (array->n_buffers < 3) {
+      ArrowErrorSet(error, "Expected array with >= 3 buffer(s) but found %d buffer(s)",
+                    (int)array->n_buffers);
+      return EINVAL;
+    }
+
+    array_view->n_variadic_buffers = array->n_buffers - 3;
+    array_view->variadic_buffers = array->buffers + 2;
+    array_view->variadic_buffer_sizes =
+        (const int64_t*)array->buffers[array->n_buffers - 1];
+    if (array_view->n_variadic_buffers > 0 && array_view->variadic_buffer_sizes == NULL) {
+      ArrowErrorSet(error, "Expected non-NULL variadic buffer sizes for %s array",
+                    ArrowTypeString(array_view->storage_type));
+      return EINVAL;
+    }
+
+    buffers_required = array->n_buffers;
+  }
+
+  // Check the number of buffers
+  if (buffers_required != array->n_buffers) {
+    ArrowErrorSet(error, "Expected array with %d buffer(s) but found %d buffer(s)",
+                  (int)buffers_required, (int)array->n_buffers);
+    return EINVAL;
+  }
+
+  // Check number of children
+  if (array_view->n_children != array->n_children) {
+    ArrowErrorSet(error, "Expected %ld children but found %ld children",
+                  (long)array_view->n_children, (long)array->n_children);
+    return EINVAL;
+  }
+
+  // Recurse for children
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayViewSetArrayInternal(array_view->children[i],
+                                                           array->children[i], error));
+  }
+
+  // Check dictionary
+  if (array->dictionary == NULL && array_view->dictionary != NULL) {
+    ArrowErrorSet(error, "Expected dictionary but found NULL");
+    return EINVAL;
+  }
+
+  if (array->dictionary != NULL && array_view->dictionary == NULL) {
+    ArrowErrorSet(error, "Expected NULL dictionary but found dictionary member");
+    return EINVAL;
+  }
+
+  if (array->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayViewSetArrayInternal(array_view->dictionary, array->dictionary, error));
+  }
+
+  return NANOARROW_OK;
+}
+
+static int ArrowArrayViewValidateMinimal(struct ArrowArrayView* array_view,
+                                         struct ArrowError* error) {
+  // Calculate buffer sizes that do not require buffer access. If marked as
+  // unknown, assign the buffer size; otherwise, validate it.
+  int64_t offset_plus_length = array_view->offset + array_view->length;
+
+  // Only loop over the first two buffers and the sizes buffer of list views because
+  // the size of any other third buffer is data dependent.
+  for (int i = 0; i < 3; i++) {
+    if (i == 2 && array_view->layout.buffer_type[i] != NANOARROW_BUFFER_TYPE_SIZE) {
+      break;
+    }
+
+    int64_t element_size_bytes = array_view->layout.element_size_bits[i] / 8;
+    // Initialize with a value that will cause an error if accidentally used uninitialized
+    int64_t min_buffer_size_bytes = array_view->buffer_views[i].size_bytes + 1;
+
+    switch (array_view->layout.buffer_type[i]) {
+      case NANOARROW_BUFFER_TYPE_VALIDITY:
+        if (array_view->null_count == 0 && array_view->buffer_views[i].size_bytes == 0) {
+          continue;
+        }
+
+        min_buffer_size_bytes = _ArrowBytesForBits(offset_plus_length);
+        break;
+      case NANOARROW_BUFFER_TYPE_DATA_OFFSET:
+        // Probably don't want/need to rely on the producer to have allocated an
+        // offsets buffer of length 1 for a zero-size array
+        min_buffer_size_bytes =
+            (offset_plus_length != 0) * element_size_bytes * (offset_plus_length + 1);
+        break;
+      case NANOARROW_BUFFER_TYPE_DATA:
+        min_buffer_size_bytes =
+            _ArrowRoundUpToMultipleOf8(array_view->layout.element_size_bits[i] *
+                                       offset_plus_length) /
+            8;
+        break;
+      case NANOARROW_BUFFER_TYPE_TYPE_ID:
+      case NANOARROW_BUFFER_TYPE_UNION_OFFSET:
+      case NANOARROW_BUFFER_TYPE_VIEW_OFFSET:
+      case NANOARROW_BUFFER_TYPE_SIZE:
+        min_buffer_size_bytes = element_size_bytes * offset_plus_length;
+        break;
+      case NANOARROW_BUFFER_TYPE_NONE:
+        continue;
+    }
+
+    // Assign or validate buffer size
+    if (array_view->buffer_views[i].size_bytes == -1) {
+      array_view->buffer_views[i].size_bytes = min_buffer_size_bytes;
+    } else if (array_view->buffer_views[i].size_bytes < min_buffer_size_bytes) {
+      ArrowErrorSet(error,
+                    "Expected %s array buffer %d to have size >= %ld bytes but found "
+                    "buffer with %ld bytes",
+                    ArrowTypeString(array_view->storage_type), (int)i,
+                    (long)min_buffer_size_bytes,
+                    (long)array_view->buffer_views[i].size_bytes);
+      return EINVAL;
+    }
+  }
+
+  // For list, list view, fixed-size list and map views, we can validate the number of
+  // children
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_LIST:
+    case NANOARROW_TYPE_LARGE_LIST:
+    case NANOARROW_TYPE_LIST_VIEW:
+    case NANOARROW_TYPE_LARGE_LIST_VIEW:
+    case NANOARROW_TYPE_FIXED_SIZE_LIST:
+    case NANOARROW_TYPE_MAP:
+      if (array_view->n_children != 1) {
+        ArrowErrorSet(error, "Expected 1 child of %s array but found %ld child arrays",
+                      ArrowTypeString(array_view->storage_type),
+                      (long)array_view->n_children);
+        return EINVAL;
+      }
+    default:
+      break;
+  }
+
+  // For struct, the sparse union, and the fixed-size list views, we can validate child
+  // lengths.
+  int64_t child_min_length;
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_SPARSE_UNION:
+    case NANOARROW_TYPE_STRUCT:
+      child_min_length = (array_view->offset + array_view->length);
+      for (int64_t i = 0; i < array_view->n_children; i++) {
+        if (array_view->children[i]->length < child_min_length) {
+          ArrowErrorSet(
+              error,
+              "Expected struct child %d to have length >= %ld but found child with "
+              "length %ld",
+              (int)(i + 1), (long)(child_min_length),
+              (long)array_view->children[i]->length);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case NANOARROW_TYPE_FIXED_SIZE_LIST:
+      child_min_length = (array_view->offset + array_view->length) *
+                         array_view->layout.child_size_elements;
+      if (array_view->children[0]->length < child_min_length) {
+        ArrowErrorSet(error,
+                      "Expected child of fixed_size_list array to have length >= %ld but "
+                      "found array with length %ld",
+                      (long)child_min_length, (long)array_view->children[0]->length);
+        return EINVAL;
+      }
+      break;
+
+    case NANOARROW_TYPE_RUN_END_ENCODED:
+      if (array_view->n_children != 2) {
+        ArrowErrorSet(error,
+                      "Expected 2 children for run_end_encoded array but found %ld child "
+                      "arrays",
+                      (long)array_view->n_children);
+        return EINVAL;
+      }
+
+      switch (array_view->children[0]->storage_type) {
+        case NANOARROW_TYPE_INT16:
+        case NANOARROW_TYPE_INT32:
+        case NANOARROW_TYPE_INT64:
+          break;
+        default:
+          ArrowErrorSet(error,
+                        "Expected run_ends child of run_end_encoded array to be int16, "
+                        "int32, or int64 but found %s",
+                        ArrowTypeString(array_view->children[0]->storage_type));
+          return EINVAL;
+      }
+
+      if (array_view->children[0]->length != array_view->children[1]->length) {
+        ArrowErrorSet(error,
+                      "Expected run_ends and values children of run_end_encoded array "
+                      "to have equal lengths but found lengths %ld and %ld",
+                      (long)array_view->children[0]->length,
+                      (long)array_view->children[1]->length);
+        return EINVAL;
+      }
+
+      if (array_view->children[0]->null_count > 0) {
+        ArrowErrorSet(error,
+                      "Expected run_ends child of run_end_encoded array to have no nulls "
+                      "but found %ld null(s)",
+                      (long)array_view->children[0]->null_count);
+        return EINVAL;
+      }
+
+      if (offset_plus_length > 0 && array_view->children[0]->length == 0) {
+        ArrowErrorSet(error,
+                      "Expected non-empty run_ends child for run_end_encoded array with "
+                      "offset + length %ld",
+                      (long)offset_plus_length);
+        return EINVAL;
+      }
+      break;
+
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_STRING_VIEW:
+      for (int64_t i = 0; i < array_view->n_variadic_buffers; i++) {
+        if (array_view->variadic_buffer_sizes[i] < 0) {
+          ArrowErrorSet(error,
+                        "Expected variadic buffer %ld of %s array to have size >= 0 but "
+                        "found size %ld",
+                        (long)i, ArrowTypeString(array_view->storage_type),
+                        (long)array_view->variadic_buffer_sizes[i]);
+          return EINVAL;
+        }
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  // Recurse for children
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayViewValidateMinimal(array_view->children[i], error));
+  }
+
+  // Recurse for dictionary
+  if (array_view->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateMinimal(array_view->dictionary, error));
+  }
+
+  return NANOARROW_OK;
+}
+
+static int ArrowArrayViewValidateDefault(struct ArrowArrayView* array_view,
+                                         struct ArrowError* error) {
+  // Perform minimal validation. This will validate or assign
+  // buffer sizes as long as buffer access is not required.
+  NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateMinimal(array_view, error));
+
+  // Calculate buffer sizes or child lengths that require accessing the offsets
+  // buffer. Where appropriate, validate that the first offset is >= 0.
+  // If a buffer size is marked as unknown, assign it; otherwise, validate it.
+  int64_t offset_plus_length = array_view->offset + array_view->length;
+
+  int64_t first_offset;
+  int64_t last_offset;
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY:
+      if (array_view->buffer_views[1].size_bytes != 0) {
+        first_offset = array_view->buffer_views[1].data.as_int32[0];
+        if (first_offset < 0) {
+          ArrowErrorSet(error, "Expected first offset >= 0 but found %ld",
+                        (long)first_offset);
+          return EINVAL;
+        }
+
+        last_offset = array_view->buffer_views[1].data.as_int32[offset_plus_length];
+
+        // If the data buffer size is unknown, assign it; otherwise, check it
+        if (array_view->buffer_views[2].size_bytes == -1) {
+          array_view->buffer_views[2].size_bytes = last_offset;
+        } else if (array_view->buffer_views[2].size_bytes < last_offset) {
+          ArrowErrorSet(error,
+                        "Expected %s array buffer 2 to have size >= %ld bytes but found "
+                        "buffer with %ld bytes",
+                        ArrowTypeString(array_view->storage_type), (long)last_offset,
+                        (long)array_view->buffer_views[2].size_bytes);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY:
+      if (array_view->buffer_views[1].size_bytes != 0) {
+        first_offset = array_view->buffer_views[1].data.as_int64[0];
+        if (first_offset < 0) {
+          ArrowErrorSet(error, "Expected first offset >= 0 but found %ld",
+                        (long)first_offset);
+          return EINVAL;
+        }
+
+        last_offset = array_view->buffer_views[1].data.as_int64[offset_plus_length];
+
+        // If the data buffer size is unknown, assign it; otherwise, check it
+        if (array_view->buffer_views[2].size_bytes == -1) {
+          array_view->buffer_views[2].size_bytes = last_offset;
+        } else if (array_view->buffer_views[2].size_bytes < last_offset) {
+          ArrowErrorSet(error,
+                        "Expected %s array buffer 2 to have size >= %ld bytes but found "
+                        "buffer with %ld bytes",
+                        ArrowTypeString(array_view->storage_type), (long)last_offset,
+                        (long)array_view->buffer_views[2].size_bytes);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case NANOARROW_TYPE_STRUCT:
+      for (int64_t i = 0; i < array_view->n_children; i++) {
+        if (array_view->children[i]->length < offset_plus_length) {
+          ArrowErrorSet(
+              error,
+              "Expected struct child %d to have length >= %ld but found child with "
+              "length %ld",
+              (int)(i + 1), (long)offset_plus_length,
+              (long)array_view->children[i]->length);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case NANOARROW_TYPE_LIST:
+    case NANOARROW_TYPE_MAP:
+      if (array_view->buffer_views[1].size_bytes != 0) {
+        first_offset = array_view->buffer_views[1].data.as_int32[0];
+        if (first_offset < 0) {
+          ArrowErrorSet(error, "Expected first offset >= 0 but found %ld",
+                        (long)first_offset);
+          return EINVAL;
+        }
+
+        last_offset = array_view->buffer_views[1].data.as_int32[offset_plus_length];
+        if (array_view->children[0]->length < last_offset) {
+          ArrowErrorSet(
+              error,
+              "Expected child of %s array to have length >= %ld but found array with "
+              "length %ld",
+              ArrowTypeString(array_view->storage_type), (long)last_offset,
+              (long)array_view->children[0]->length);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case NANOARROW_TYPE_LARGE_LIST:
+      if (array_view->buffer_views[1].size_bytes != 0) {
+        first_offset = array_view->buffer_views[1].data.as_int64[0];
+        if (first_offset < 0) {
+          ArrowErrorSet(error, "Expected first offset >= 0 but found %ld",
+                        (long)first_offset);
+          return EINVAL;
+        }
+
+        last_offset = array_view->buffer_views[1].data.as_int64[offset_plus_length];
+        if (array_view->children[0]->length < last_offset) {
+          ArrowErrorSet(
+              error,
+              "Expected child of large list array to have length >= %ld but found array "
+              "with length %ld",
+              (long)last_offset, (long)array_view->children[0]->length);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case NANOARROW_TYPE_RUN_END_ENCODED:
+      if (array_view->children[0]->length != 0) {
+        struct ArrowArrayView* run_ends = array_view->children[0];
+        last_offset = ArrowArrayViewGetIntUnsafe(run_ends, run_ends->length - 1);
+        if (last_offset < offset_plus_length) {
+          ArrowErrorSet(error,
+                        "Expected last run end of run_end_encoded array to be >= %ld but "
+                        "found %ld",
+                        (long)offset_plus_length, (long)last_offset);
+          return EINVAL;
+        }
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  // Recurse for children
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayViewValidateDefault(array_view->children[i], error));
+  }
+
+  // Recurse for dictionary
+  if (array_view->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateDefault(array_view->dictionary, error));
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayViewSetArray(struct ArrowArrayView* array_view,
+                                      struct ArrowArray* array,
+                                      struct ArrowError* error) {
+  NANOARROW_TRACE(NANOARROW_TRACE_ARRAY_VIEW_SET_ARRAY_BEGIN, array->length, 0);
+
+  // Extract information from the array into the array view
+  int result = ArrowArrayViewSetArrayInternal(array_view, array, error);
+
+  // Run default validation. Because we've marked all non-NULL buffers as having unknown
+  // size, validation will also update the buffer sizes as it goes.
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayViewValidateDefault(array_view, error);
+  }
+
+  NANOARROW_TRACE(NANOARROW_TRACE_ARRAY_VIEW_SET_ARRAY_END, result, 0);
+  return result;
+}
+
+ArrowErrorCode ArrowArrayViewSetArrayMinimal(struct ArrowArrayView* array_view,
+                                             struct ArrowArray* array,
+                                             struct ArrowError* error) {
+  // Extract information from the array into the array view
+  NANOARROW_RETURN_NOT_OK(ArrowArrayViewSetArrayInternal(array_view, array, error));
+
+  // Run default validation. Because we've marked all non-NULL buffers as having unknown
+  // size, validation will also update the buffer sizes as it goes.
+  NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateMinimal(array_view, error));
+
+  return NANOARROW_OK;
+}
+
+// Full validation checks values in blocks of this many elements without branching
+// on each element so that compilers can vectorize the inner loops. Only once a block
+// is known to contain an invalid value is it searched for the first one to report.
+#define NANOARROW_VALIDATE_BLOCK_SIZE 256
+
+static int ArrowAssertIncreasingInt32(struct ArrowBufferView view,
+                                      struct ArrowError* error) {
+  if (view.size_bytes <= (int64_t)sizeof(int32_t)) {
+    return NANOARROW_OK;
+  }
+
+  const int32_t* values = view.data.as_int32;
+  int64_t n = view.size_bytes / (int64_t)sizeof(int32_t);
+  for (int64_t block_start = 1; block_start < n;
+       block_start += NANOARROW_VALIDATE_BLOCK_SIZE) {
+    int64_t block_end = block_start + NANOARROW_VALIDATE_BLOCK_SIZE;
+    if (block_end > n) {
+      block_end = n;
+    }
+
+    int decreasing = 0;
+    for (int64_t i = block_start; i < block_end; i++) {
+      decreasing |= values[i] < values[i - 1];
+    }
+
+    if (!decreasing) {
+      continue;
+    }
+
+    for (int64_t i = block_start; i < block_end; i++) {
+      if (values[i] < values[i - 1]) {
+        ArrowErrorSet(error, "[%ld] Expected element size >= 0", (long)i);
+        return EINVAL;
+      }
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+static int ArrowAssertIncreasingInt64(struct ArrowBufferView view,
+                                      struct ArrowError* error) {
+  if (view.size_bytes <= (int64_t)sizeof(int64_t)) {
+    return NANOARROW_OK;
+  }
+
+  const int64_t* values = view.data.as_int64;
+  int64_t n = view.size_bytes / (int64_t)sizeof(int64_t);
+  for (int64_t block_start = 1; block_start < n;
+       block_start += NANOARROW_VALIDATE_BLOCK_SIZE) {
+    int64_t block_end = block_start + NANOARROW_VALIDATE_BLOCK_SIZE;
+    if (block_end > n) {
+      block_end = n;
+    }
+
+    int decreasing = 0;
+    for (int64_t i = block_start; i < block_end; i++) {
+      decreasing |= values[i] < values[i - 1];
+    }
+
+    if (!decreasing) {
+      continue;
+    }
+
+    for (int64_t i = block_start; i < block_end; i++) {
+      if (values[i] < values[i - 1]) {
+        ArrowErrorSet(error, "[%ld] Expected element size >= 0", (long)i);
+        return EINVAL;
+      }
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+static int ArrowAssertRangeInt8(struct ArrowBufferView view, int8_t min_value,
+                                int8_t max_value, struct ArrowError* error) {
+  const int8_t* values = view.data.as_int8;
+  for (int64_t block_start = 0; block_start < view.size_bytes;
+       block_start += NANOARROW_VALIDATE_BLOCK_SIZE) {
+    int64_t block_end = block_start + NANOARROW_VALIDATE_BLOCK_SIZE;
+    if (block_end > view.size_bytes) {
+      block_end = view.size_bytes;
+    }
+
+    int out_of_range = 0;
+    for (int64_t i = block_start; i < block_end; i++) {
+      out_of_range |= (values[i] < min_value) | (values[i] > max_value);
+    }
+
+    if (!out_of_range) {
+      continue;
+    }
+
+    for (int64_t i = block_start; i < block_end; i++) {
+      if (values[i] < min_value || values[i] > max_value) {
+        ArrowErrorSet(error,
+                      "[%ld] Expected buffer value between %d and %d but found value %d",
+                      (long)i, (int)min_value, (int)max_value, (int)values[i]);
+        return EINVAL;
+      }
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+static int ArrowAssertInt8In(struct ArrowBufferView view, const int8_t* values,
+                             int64_t n_values, struct ArrowError* error) {
+  // Look up each value in a table of all possible int8 values rather than
+  // searching values for each element
+  uint8_t is_valid[256];
+  memset(is_valid, 0, sizeof(is_valid));
+  for (int64_t j = 0; j < n_values; j++) {
+    is_valid[(uint8_t)values[j]] = 1;
+  }
+
+  const uint8_t* data = view.data.as_uint8;
+  for (int64_t block_start = 0; block_start < view.size_bytes;
+       block_start += NANOARROW_VALIDATE_BLOCK_SIZE) {
+    int64_t block_end = block_start + NANOARROW_VALIDATE_BLOCK_SIZE;
+    if (block_end > view.size_bytes) {
+      block_end = view.size_bytes;
+    }
+
+    uint8_t all_valid = 1;
+    for (int64_t i = block_start; i < block_end; i++) {
+      all_valid &= is_valid[data[i]];
+    }
+
+    if (all_valid) {
+      continue;
+    }
+
+    for (int64_t i = block_start; i < block_end; i++) {
+      if (!is_valid[data[i]]) {
+        ArrowErrorSet(error, "[%ld] Unexpected buffer value %d", (long)i,
+                      (int)view.data.as_int8[i]);
+        return EINVAL;
+      }
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+// Returns the number of bytes at the start of data that form complete, valid UTF-8
+// sequences (i.e., size_bytes if all of data is valid UTF-8)
+static int64_t ArrowUtf8ValidPrefix(const uint8_t* data, int64_t size_bytes) {
+  int64_t i = 0;
+  while (i < size_bytes) {
+    // Skip ASCII eight bytes at a time
+    uint64_t word;
+    while ((i + 8) <= size_bytes) {
+      memcpy(&word, data + i, sizeof(uint64_t));
+      if (word & 0x8080808080808080ULL) {
+        break;
+      }
+
+      i += 8;
+    }
+
+    if (i >= size_bytes) {
+      break;
+    }
+
+    uint8_t lead = data[i];
+    if (lead < 0x80) {
+      i++;
+      continue;
+    }
+
+    // The number of continuation bytes and the valid range of the first one, which
+    // excludes overlong encodings, surrogates, and code points above U+10FFFF
+    int64_t n_continuation;
+    uint8_t min_first = 0x80;
+    uint8_t max_first = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+      n_continuation = 1;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+      n_continuation = 2;
+      min_first = lead == 0xE0 ? 0xA0 : min_first;
+      max_first = lead == 0xED ? 0x9F : max_first;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+      n_continuation = 3;
+      min_first = lead == 0xF0 ? 0x90 : min_first;
+      max_first = lead == 0xF4 ? 0x8F : max_first;
+    } else {
+      return i;
+    }
+
+    if ((i + n_continuation) >= size_bytes || data[i + 1] < min_first ||
+        data[i + 1] > max_first) {
+      return i;
+    }
+
+    for (int64_t j = 2; j <= n_continuation; j++) {
+      if ((data[i + j] & 0xC0) != 0x80) {
+        return i;
+      }
+    }
+
+    i += n_continuation + 1;
+  }
+
+  return size_bytes;
+}
+
+static inline int64_t ArrowArrayViewStringOffset(struct ArrowArrayView* array_view,
+                                                 int64_t i) {
+  if (array_view->storage_type == NANOARROW_TYPE_STRING) {
+    return array_view->buffer_views[1].data.as_int32[i];
+  } else {
+    return array_view->buffer_views[1].data.as_int64[i];
+  }
+}
+
+// Validates that the non-null elements of a string, large string, or string view
+// array are valid UTF-8. For strings with offsets, all the data referenced by the
+// array is validated at once and the elements are only checked individually if
+// this fails (e.g., to allow invalid content in the data of null elements).
+static int ArrowArrayViewValidateUtf8(struct ArrowArrayView* array_view,
+                                      struct ArrowError* error) {
+  if (array_view->length == 0) {
+    return NANOARROW_OK;
+  }
+
+  const uint8_t* validity = array_view->buffer_views[0].data.as_uint8;
+  int64_t end = array_view->offset + array_view->length;
+
+  if (array_view->storage_type == NANOARROW_TYPE_STRING_VIEW) {
+    for (int64_t i = array_view->offset; i < end; i++) {
+      if (validity != NULL && !ArrowBitGet(validity, i)) {
+        continue;
+      }
+
+      struct ArrowBufferView value = _ArrowArrayViewGetBinaryView(array_view, i);
+      if (ArrowUtf8ValidPrefix(value.data.as_uint8, value.size_bytes) !=
+          value.size_bytes) {
+        ArrowErrorSet(error, "[%ld] Expected valid UTF-8 string", (long)i);
+        return EINVAL;
+      }
+    }
+
+    return NANOARROW_OK;
+  }
+
+  const uint8_t* data = array_view->buffer_views[2].data.as_uint8;
+  int64_t first_offset = ArrowArrayViewStringOffset(array_view, array_view->offset);
+  int64_t last_offset = ArrowArrayViewStringOffset(array_view, end);
+  if (last_offset == first_offset) {
+    return NANOARROW_OK;
+  }
+
+  // If all of the data is valid UTF-8, each element is as long as it does not start
+  // in the middle of a multi-byte sequence
+  int is_valid = ArrowUtf8ValidPrefix(data + first_offset, last_offset - first_offset) ==
+                 (last_offset - first_offset);
+  for (int64_t i = array_view->offset + 1; i < end && is_valid; i++) {
+    int64_t offset = ArrowArrayViewStringOffset(array_view, i);
+    is_valid = offset >= last_offset || (data[offset] & 0xC0) != 0x80;
+  }
+
+  if (is_valid) {
+    return NANOARROW_OK;
+  }
+
+  for (int64_t i = array_view->offset; i < end; i++) {
+    if (validity != NULL && !ArrowBitGet(validity, i)) {
+      continue;
+    }
+
+    int64_t start = ArrowArrayViewStringOffset(array_view, i);
+    int64_t size_bytes = ArrowArrayViewStringOffset(array_view, i + 1) - start;
+    if (ArrowUtf8ValidPrefix(data + start, size_bytes) != size_bytes) {
+      ArrowErrorSet(error, "[%ld] Expected valid UTF-8 string", (long)i);
+      return EINVAL;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+// Performs full validation of array_view without recursing into its children. When
+// built_by_append is nonzero, checks of offsets and views that append functions
+// already guarantee are skipped.
+static int ArrowArrayViewValidateFullNode(struct ArrowArrayView* array_view,
+                                          int8_t built_by_append,
+                                          struct ArrowError* error) {
+  for (int i = 0; i < 3 && !built_by_append; i++) {
+    switch (array_view->layout.buffer_type[i]) {
+      case NANOARROW_BUFFER_TYPE_DATA_OFFSET:
+        if (array_view->layout.element_size_bits[i] == 32) {
+          NANOARROW_RETURN_NOT_OK(
+              ArrowAssertIncreasingInt32(array_view->buffer_views[i], error));
+        } else {
+          NANOARROW_RETURN_NOT_OK(
+              ArrowAssertIncreasingInt64(array_view->buffer_views[i], error));
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
+  if (array_view->storage_type == NANOARROW_TYPE_DENSE_UNION ||
+      array_view->storage_type == NANOARROW_TYPE_SPARSE_UNION) {
+    if (array_view->union_type_id_map == NULL) {
+      // If the union_type_id map is NULL (e.g., when using ArrowArrayInitFromType() +
+      // ArrowArrayAllocateChildren() + ArrowArrayFinishBuilding()), we don't have enough
+      // information to validate this buffer.
+      ArrowErrorSet(error,
+                    "Insufficient information provided for validation of union array");
+      return EINVAL;
+    } else if (_ArrowParsedUnionTypeIdsWillEqualChildIndices(
+                   array_view->union_type_id_map, array_view->n_children,
+                   array_view->n_children)) {
+      NANOARROW_RETURN_NOT_OK(ArrowAssertRangeInt8(
+          array_view->buffer_views[0], 0, (int8_t)(array_view->n_children - 1), error));
+    } else {
+      NANOARROW_RETURN_NOT_OK(ArrowAssertInt8In(array_view->buffer_views[0],
+                                                array_view->union_type_id_map + 128,
+                                                array_view->n_children, error));
+    }
+  }
+
+  if (array_view->storage_type == NANOARROW_TYPE_DENSE_UNION &&
+      array_view->union_type_id_map != NULL) {
+    // Check that offsets refer to child elements that actually exist
+    for (int64_t i = 0; i < array_view->length; i++) {
+      int8_t child_id = ArrowArrayViewUnionChildIndex(array_view, i);
+      int64_t offset = ArrowArrayViewUnionChildOffset(array_view, i);
+      int64_t child_length = array_view->children[child_id]->length;
+      if (offset < 0 || offset > child_length) {
+        ArrowErrorSet(
+            error,
+            "[%ld] Expected union offset for child id %d to be between 0 and %ld but "
+            "found offset value %ld",
+            (long)i, (int)child_id, (long)child_length, offset);
+        return EINVAL;
+      }
+    }
+  }
+
+  if (array_view->storage_type == NANOARROW_TYPE_RUN_END_ENCODED) {
+    // Check that run ends are positive and strictly increasing
+    struct ArrowArrayView* run_ends = array_view->children[0];
+    int64_t last_run_end = 0;
+    for (int64_t i = 0; i < run_ends->length; i++) {
+      int64_t run_end = ArrowArrayViewGetIntUnsafe(run_ends, i);
+      if (run_end <= last_run_end) {
+        ArrowErrorSet(error,
+                      "[%ld] Expected run end > %ld for run_end_encoded array but found "
+                      "run end %ld",
+                      (long)i, (long)last_run_end, (long)run_end);
+        return EINVAL;
+      }
+      last_run_end = run_end;
+    }
+  }
+
+  if (array_view->storage_type == NANOARROW_TYPE_LIST_VIEW ||
+      array_view->storage_type == NANOARROW_TYPE_LARGE_LIST_VIEW) {
+    // Check that views refer to child elements that actually exist. This is checked
+    // even for arrays built by appending because a view may be appended before the
+    // child elements it refers to.
+    int64_t child_length = array_view->children[0]->length;
+    for (int64_t i = array_view->offset; i < array_view->offset + array_view->length;
+         i++) {
+      int64_t offset = ArrowArrayViewListChildOffset(array_view, i);
+      int64_t size = ArrowArrayViewListChildSize(array_view, i);
+      if (offset < 0 || size < 0 || size > (child_length - offset)) {
+        ArrowErrorSet(error,
+                      "[%ld] Expected %s offset %ld and size %ld to be within child "
+                      "array of length %ld",
+                      (long)i, ArrowTypeString(array_view->storage_type), (long)offset,
+                      (long)size, (long)child_length);
+        return EINVAL;
+      }
+    }
+  }
+
+  if (!built_by_append && (array_view->storage_type == NANOARROW_TYPE_BINARY_VIEW ||
+                           array_view->storage_type == NANOARROW_TYPE_STRING_VIEW)) {
+    // Check that views that are not inlined refer to data that actually exists
+    const union ArrowBinaryView* views = array_view->buffer_views[1].data.as_binary_view;
+    for (int64_t i = array_view->offset; i < array_view->offset + array_view->length;
+         i++) {
+      int32_t size = views[i].inlined.size;
+      if (size < 0) {
+        ArrowErrorSet(error, "[%ld] Expected view size >= 0 but found size %d", (long)i,
+                      (int)size);
+        return EINVAL;
+      }
+
+      if (size <= NANOARROW_BINARY_VIEW_INLINE_SIZE) {
+        continue;
+      }
+
+      int32_t buffer_index = views[i].ref.buffer_index;
+      int32_t offset = views[i].ref.offset;
+      if (buffer_index < 0 || buffer_index >= array_view->n_variadic_buffers) {
+        ArrowErrorSet(error,
+                      "[%ld] Expected view buffer index between 0 and %ld but found %d",
+                      (long)i, (long)array_view->n_variadic_buffers - 1,
+                      (int)buffer_index);
+        return EINVAL;
+      }
+
+      if (offset < 0 ||
+          ((int64_t)offset + size) > array_view->variadic_buffer_sizes[buffer_index]) {
+        ArrowErrorSet(error,
+                      "[%ld] Expected view range [%d, %ld) to be within variadic buffer "
+                      "%d of size %ld",
+                      (long)i, (int)offset, (long)offset + size, (int)buffer_index,
+                      (long)array_view->variadic_buffer_sizes[buffer_index]);
+        return EINVAL;
+      }
+    }
+  }
+
+  // Append functions do not check that strings are valid UTF-8, so this is
+  // performed regardless of how the array was built
+  if (array_view->storage_type == NANOARROW_TYPE_STRING ||
+      array_view->storage_type == NANOARROW_TYPE_LARGE_STRING ||
+      array_view->storage_type == NANOARROW_TYPE_STRING_VIEW) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateUtf8(array_view, error));
+  }
+
+  return NANOARROW_OK;
+}
+
+// Checks that each non-null index of a dictionary-encoded array refers to an
+// element of its dictionary (whose values are validated separately)
+static int ArrowArrayViewValidateDictionaryIndices(struct ArrowArrayView* array_view,
+                                                   struct ArrowError* error) {
+  int64_t dictionary_length = array_view->dictionary->length;
+  for (int64_t i = 0; i < array_view->length; i++) {
+    if (ArrowArrayViewIsNull(array_view, i)) {
+      continue;
+    }
+
+    int64_t index = ArrowArrayViewGetIntUnsafe(array_view, i);
+    if (index < 0 || index >= dictionary_length) {
+      ArrowErrorSet(error,
+                    "[%ld] Expected dictionary index between 0 and %ld but found %ld",
+                    (long)i, (long)(dictionary_length - 1), (long)index);
+      return EINVAL;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+static int ArrowArrayViewValidateFull(struct ArrowArrayView* array_view,
+                                      struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateFullNode(array_view, 0, error));
+
+  // Recurse for children
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateFull(array_view->children[i], error));
+  }
+
+  if (array_view->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateFull(array_view->dictionary, error));
+    NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateDictionaryIndices(array_view, error));
+  }
+
+  return NANOARROW_OK;
+}
+
+static int ArrowArrayValidateFullAppended(struct ArrowArray* array,
+                                          struct ArrowArrayView* array_view,
+                                          struct ArrowError* error) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateFullNode(
+      array_view, private_data->built_by_append, error));
+
+  // Recurse for children
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayValidateFullAppended(
+        array->children[i], array_view->children[i], error));
+  }
+
+  if (array_view->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayValidateFullAppended(
+        array->dictionary, array_view->dictionary, error));
+    NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateDictionaryIndices(array_view, error));
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayViewValidate(struct ArrowArrayView* array_view,
+                                      enum ArrowValidationLevel validation_level,
+                                      struct ArrowError* error) {
+  switch (validation_level) {
+    case NANOARROW_VALIDATION_LEVEL_NONE:
+      return NANOARROW_OK;
+    case NANOARROW_VALIDATION_LEVEL_MINIMAL:
+      return ArrowArrayViewValidateMinimal(array_view, error);
+    case NANOARROW_VALIDATION_LEVEL_DEFAULT:
+      return ArrowArrayViewValidateDefault(array_view, error);
+    case NANOARROW_VALIDATION_LEVEL_FULL:
+      NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateDefault(array_view, error));
+      return ArrowArrayViewValidateFull(array_view, error);
+  }
+
+  ArrowErrorSet(error, "validation_level not recognized");
+  return EINVAL;
+}
+
+static ArrowErrorCode ArrowArrayViewHashInternal(struct ArrowArrayView* array_view,
+                                                 int64_t start, int64_t n,
+                                                 uint64_t* hashes,
+                                                 struct ArrowError* error);
+
+// The hash of a null element only depends on the incoming hash
+static inline uint64_t ArrowHashNull(uint64_t seed) {
+  return _ArrowHashFinalize(seed ^ 0xA0761D6478BD642FULL);
+}
+
+// Combine the values of elements start, ..., start + n - 1 of array_view into hashes
+// without regard to validity (except for view types, whose null elements may not
+// point to valid data)
+static ArrowErrorCode ArrowArrayViewHashValues(struct ArrowArrayView* array_view,
+                                               const uint8_t* validity, int64_t start,
+                                               int64_t n, uint64_t* hashes,
+                                               struct ArrowError* error) {
+  int64_t physical_start = array_view->offset + start;
+  const uint8_t* data = array_view->buffer_views[1].data.as_uint8;
+  int64_t element_size_bytes = array_view->layout.element_size_bits[1] / 8;
+
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_BOOL:
+      for (int64_t i = 0; i < n; i++) {
+        hashes[i] = _ArrowHashWord(hashes[i], ArrowBitGet(data, physical_start + i));
+      }
+      break;
+
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY: {
+      const int32_t* offsets = array_view->buffer_views[1].data.as_int32;
+      const uint8_t* values = array_view->buffer_views[2].data.as_uint8;
+      for (int64_t i = 0; i < n; i++) {
+        int64_t value_start = offsets[physical_start + i];
+        hashes[i] = _ArrowHashBytes(hashes[i], values + value_start,
+                                   offsets[physical_start + i + 1] - value_start);
+      }
+      break;
+    }
+
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY: {
+      const int64_t* offsets = array_view->buffer_views[1].data.as_int64;
+      const uint8_t* values = array_view->buffer_views[2].data.as_uint8;
+      for (int64_t i = 0; i < n; i++) {
+        int64_t value_start = offsets[physical_start + i];
+        hashes[i] = _ArrowHashBytes(hashes[i], values + value_start,
+                                   offsets[physical_start + i + 1] - value_start);
+      }
+      break;
+    }
+
+    case NANOARROW_TYPE_STRING_VIEW:
+    case NANOARROW_TYPE_BINARY_VIEW:
+      for (int64_t i = 0; i < n; i++) {
+        if (validity != NULL && !ArrowBitGet(validity, physical_start + i)) {
+          continue;
+        }
+
+        struct ArrowBufferView value =
+            ArrowArrayViewGetBytesUnsafe(array_view, start + i);
+        hashes[i] = _ArrowHashBytes(hashes[i], value.data.as_uint8, value.size_bytes);
+      }
+      break;
+
+    case NANOARROW_TYPE_STRUCT:
+      for (int64_t j = 0; j < array_view->n_children; j++) {
+        NANOARROW_RETURN_NOT_OK(ArrowArrayViewHashInternal(
+            array_view->children[j], physical_start, n, hashes, error));
+      }
+      break;
+
+    default:
+      if (array_view->layout.buffer_type[1] != NANOARROW_BUFFER_TYPE_DATA ||
+          array_view->layout.buffer_type[2] != NANOARROW_BUFFER_TYPE_NONE ||
+          element_size_bytes == 0) {
+        ArrowErrorSet(error, "Hashing arrays of type %s is not supported",
+                      ArrowTypeString(array_view->storage_type));
+        return ENOTSUP;
+      }
+
+      // Fixed-width values (including fixed-size binary and decimals) are hashed by
+      // their bytes
+      if (element_size_bytes <= 8) {
+        for (int64_t i = 0; i < n; i++) {
+          uint64_t word = 0;
+          memcpy(&word, data + (physical_start + i) * element_size_bytes,
+                 (size_t)element_size_bytes);
+          hashes[i] = _ArrowHashWord(hashes[i], word);
+        }
+      } else {
+        for (int64_t i = 0; i < n; i++) {
+          hashes[i] =
+              _ArrowHashBytes(hashes[i], data + (physical_start + i) * element_size_bytes,
+                             element_size_bytes);
+        }
+      }
+      break;
+  }
+
+  return NANOARROW_OK;
+}
+
+// Combine elements start, ..., start + n - 1 of array_view into hashes
+static ArrowErrorCode ArrowArrayViewHashInternal(struct ArrowArrayView* array_view,
+                                                 int64_t start, int64_t n,
+                                                 uint64_t* hashes,
+                                                 struct ArrowError* error) {
+  if (array_view->dictionary != NULL) {
+    ArrowErrorSet(error, "Hashing dictionary-encoded arrays is not supported");
+    return ENOTSUP;
+  }
+
+  if (array_view->storage_type == NANOARROW_TYPE_NA) {
+    for (int64_t i = 0; i < n; i++) {
+      hashes[i] = ArrowHashNull(hashes[i]);
+    }
+    return NANOARROW_OK;
+  }
+
+  const uint8_t* validity = array_view->buffer_views[0].data.as_uint8;
+  if (validity == NULL || array_view->null_count == 0 || n == 0) {
+    return ArrowArrayViewHashValues(array_view, NULL, start, n, hashes, error);
+  }
+
+  // Values are combined in bulk and the hashes of null elements are replaced
+  // afterwards, which requires keeping the incoming hashes
+  uint64_t* incoming = (uint64_t*)ArrowMalloc(n * sizeof(uint64_t));
+  if (incoming == NULL) {
+    return ENOMEM;
+  }
+  memcpy(incoming, hashes, n * sizeof(uint64_t));
+
+  int result = ArrowArrayViewHashValues(array_view, validity, start, n, hashes, error);
+  if (result == NANOARROW_OK) {
+    int64_t physical_start = array_view->offset + start;
+    for (int64_t i = 0; i < n; i++) {
+      if (!ArrowBitGet(validity, physical_start + i)) {
+        hashes[i] = ArrowHashNull(incoming[i]);
+      }
+    }
+  }
+
+  ArrowFree(incoming);
+  return result;
+}
+
+ArrowErrorCode ArrowArrayViewHash(struct ArrowArrayView* array_view, uint64_t seed,
+                                  uint64_t* out, struct ArrowError* error) {
+  for (int64_t i = 0; i < array_view->length; i++) {
+    out[i] = seed;
+  }
+
+  return ArrowArrayViewHashInternal(array_view, 0, array_view->length, out, error);
+}
+
+// The number of bits of each hash used to choose a HyperLogLog register. 1024
+// registers give a standard error of about 3% for the distinct count.
+#define NANOARROW_HLL_PRECISION 10
+
+static void ArrowHyperLogLogAdd(uint8_t* registers, uint64_t hash) {
+  uint64_t index = hash >> (64 - NANOARROW_HLL_PRECISION);
+  // A sentinel bit bounds the rank when the remaining bits are all zero
+  uint64_t remaining =
+      (hash << NANOARROW_HLL_PRECISION) | ((uint64_t)1 << (NANOARROW_HLL_PRECISION - 1));
+  uint8_t rank = 1;
+  while ((remaining & 0x8000000000000000ULL) == 0) {
+    remaining <<= 1;
+    rank++;
+  }
+
+  if (rank > registers[index]) {
+    registers[index] = rank;
+  }
+}
+
+// The natural logarithm of x >= 1 (to avoid a dependency on libm)
+static double ArrowHyperLogLogLog(double x) {
+  int64_t n_halvings = 0;
+  while (x >= 2.0) {
+    x /= 2.0;
+    n_halvings++;
+  }
+
+  // ln(x) = 2 * atanh(y) with y = (x - 1) / (x + 1) <= 1 / 3
+  double y = (x - 1.0) / (x + 1.0);
+  double term = y;
+  double sum = 0;
+  for (int k = 1; k < 40; k += 2) {
+    sum += term / k;
+    term *= y * y;
+  }
+
+  return n_halvings * 0.6931471805599453 + 2.0 * sum;
+}
+
+static int64_t ArrowHyperLogLogEstimate(const uint8_t* registers) {
+  const int64_t n_registers = (int64_t)1 << NANOARROW_HLL_PRECISION;
+  const double m = (double)n_registers;
+  double sum = 0;
+  int64_t n_zero = 0;
+  for (int64_t i = 0; i < n_registers; i++) {
+    sum += 1.0 / (double)((uint64_t)1 << registers[i]);
+    n_zero += registers[i] == 0;
+  }
+
+  double estimate = (0.7213 / (1.0 + 1.079 / m)) * m * m / sum;
+
+  // Use linear counting for small cardinalities, where it is more accurate
+  if (estimate <= 2.5 * m && n_zero > 0) {
+    estimate = m * ArrowHyperLogLogLog(m / (double)n_zero);
+  }
+
+  return (int64_t)(estimate + 0.5);
+}
+
+// Compare two decimals of the same bit width
+static int ArrowDecimalCompare(const struct ArrowDecimal* lhs,
+                               const struct ArrowDecimal* rhs) {
+  int i = lhs->high_word_index;
+  if ((int64_t)lhs->words[i] != (int64_t)rhs->words[i]) {
+    return (int64_t)lhs->words[i] < (int64_t)rhs->words[i] ? -1 : 1;
+  }
+
+  int step = lhs->low_word_index > lhs->high_word_index ? 1 : -1;
+  while (i != lhs->low_word_index) {
+    i += step;
+    if (lhs->words[i] != rhs->words[i]) {
+      return lhs->words[i] < rhs->words[i] ? -1 : 1;
+    }
+  }
+
+  return 0;
+}
+
+// Compare the bytes of two strings lexicographically
+static int ArrowStringViewCompare(struct ArrowStringView lhs,
+                                  struct ArrowStringView rhs) {
+  int64_t size_bytes = lhs.size_bytes < rhs.size_bytes ? lhs.size_bytes : rhs.size_bytes;
+  int result = size_bytes > 0 ? memcmp(lhs.data, rhs.data, (size_t)size_bytes) : 0;
+  if (result != 0) {
+    return result;
+  }
+
+  return (lhs.size_bytes > rhs.size_bytes) - (lhs.size_bytes < rhs.size_bytes);
+}
+
+enum ArrowStatisticsKind {
+  NANOARROW_STATISTICS_INT,
+  NANOARROW_STATISTICS_UINT,
+  NANOARROW_STATISTICS_DOUBLE,
+  NANOARROW_STATISTICS_DECIMAL,
+  NANOARROW_STATISTICS_BYTES
+};
+
+// Update the minimum and maximum of out with elements start, ..., start + n - 1
+static void ArrowArrayViewUpdateMinMax(struct ArrowArrayView* array_view,
+                                       enum ArrowStatisticsKind kind,
+                                       const uint8_t* validity, int64_t start,
+                                       int64_t n, struct ArrowArrayStatistics* out) {
+  int64_t physical_start = array_view->offset + start;
+
+  switch (kind) {
+    case NANOARROW_STATISTICS_INT: {
+      int64_t values[NANOARROW_KERNEL_BLOCK_SIZE];
+      ArrowArrayViewGetIntsUnsafe(array_view, start, n, values);
+      int64_t min = out->min.as_int64;
+      int64_t max = out->max.as_int64;
+      for (int64_t i = 0; i < n; i++) {
+        if (validity == NULL || ArrowBitGet(validity, physical_start + i)) {
+          min = values[i] < min ? values[i] : min;
+          max = values[i] > max ? values[i] : max;
+        }
+      }
+      out->min.as_int64 = min;
+      out->max.as_int64 = max;
+      break;
+    }
+
+    case NANOARROW_STATISTICS_UINT: {
+      // Unsigned values are read as int64_t with the same bit pattern
+      int64_t values[NANOARROW_KERNEL_BLOCK_SIZE];
+      ArrowArrayViewGetIntsUnsafe(array_view, start, n, values);
+      uint64_t min = out->min.as_uint64;
+      uint64_t max = out->max.as_uint64;
+      for (int64_t i = 0; i < n; i++) {
+        if (validity == NULL || ArrowBitGet(validity, physical_start + i)) {
+          min = (uint64_t)values[i] < min ? (uint64_t)values[i] : min;
+          max = (uint64_t)values[i] > max ? (uint64_t)values[i] : max;
+        }
+      }
+      out->min.as_uint64 = min;
+      out->max.as_uint64 = max;
+      break;
+    }
+
+    case NANOARROW_STATISTICS_DOUBLE: {
+      double values[NANOARROW_KERNEL_BLOCK_SIZE];
+      ArrowArrayViewGetDoublesUnsafe(array_view, start, n, values);
+      for (int64_t i = 0; i < n; i++) {
+        if ((validity != NULL && !ArrowBitGet(validity, physical_start + i)) ||
+            values[i] != values[i]) {
+          continue;
+        }
+
+        if (!out->has_min_max) {
+          out->min.as_double = values[i];
+          out->max.as_double = values[i];
+          out->has_min_max = 1;
+        } else {
+          out->min.as_double =
+              values[i] < out->min.as_double ? values[i] : out->min.as_double;
+          out->max.as_double =
+              values[i] > out->max.as_double ? values[i] : out->max.as_double;
+        }
+      }
+      break;
+    }
+
+    case NANOARROW_STATISTICS_DECIMAL: {
+      int64_t size_bytes = array_view->layout.element_size_bits[1] / 8;
+      struct ArrowDecimal value;
+      struct ArrowDecimal min;
+      struct ArrowDecimal max;
+      ArrowDecimalInit(&value, (int32_t)(size_bytes * 8), 0, 0);
+      ArrowDecimalInit(&min, (int32_t)(size_bytes * 8), 0, 0);
+      ArrowDecimalInit(&max, (int32_t)(size_bytes * 8), 0, 0);
+      if (out->has_min_max) {
+        ArrowDecimalSetBytes(&min, out->min.as_bytes.data.as_uint8);
+        ArrowDecimalSetBytes(&max, out->max.as_bytes.data.as_uint8);
+      }
+
+      const uint8_t* data = array_view->buffer_views[1].data.as_uint8;
+      for (int64_t i = 0; i < n; i++) {
+        if (validity != NULL && !ArrowBitGet(validity, physical_start + i)) {
+          continue;
+        }
+
+        const uint8_t* bytes = data + (physical_start + i) * size_bytes;
+        ArrowDecimalSetBytes(&value, bytes);
+        if (!out->has_min_max || ArrowDecimalCompare(&value, &min) < 0) {
+          min = value;
+          out->min.as_bytes.data.as_uint8 = bytes;
+        }
+        if (!out->has_min_max || ArrowDecimalCompare(&value, &max) > 0) {
+          max = value;
+          out->max.as_bytes.data.as_uint8 = bytes;
+        }
+        out->has_min_max = 1;
+      }
+
+      out->min.as_bytes.size_bytes = size_bytes;
+      out->max.as_bytes.size_bytes = size_bytes;
+      break;
+    }
+
+    case NANOARROW_STATISTICS_BYTES: {
+      struct ArrowStringView min;
+      struct ArrowStringView max;
+      min.data = out->min.as_bytes.data.as_char;
+      min.size_bytes = out->min.as_bytes.size_bytes;
+      max.data = out->max.as_bytes.data.as_char;
+      max.size_bytes = out->max.as_bytes.size_bytes;
+
+      for (int64_t i = 0; i < n; i++) {
+        if (validity != NULL && !ArrowBitGet(validity, physical_start + i)) {
+          continue;
+        }
+
+        struct ArrowStringView value =
+            ArrowArrayViewGetStringUnsafe(array_view, start + i);
+        if (!out->has_min_max || ArrowStringViewCompare(value, min) < 0) {
+          min = value;
+        }
+        if (!out->has_min_max || ArrowStringViewCompare(value, max) > 0) {
+          max = value;
+        }
+        out->has_min_max = 1;
+      }
+
+      out->min.as_bytes.data.as_char = min.data;
+      out->min.as_bytes.size_bytes = min.size_bytes;
+      out->max.as_bytes.data.as_char = max.data;
+      out->max.as_bytes.size_bytes = max.size_bytes;
+      break;
+    }
+  }
+}
+
+// Returns ENOTSUP for storage types that have no statistics
+static ArrowErrorCode ArrowStatisticsKindOf(enum ArrowType storage_type,
+                                            enum ArrowStatisticsKind* out) {
+  switch (storage_type) {
+    case NANOARROW_TYPE_INT8:
+    case NANOARROW_TYPE_INT16:
+    case NANOARROW_TYPE_INT32:
+    case NANOARROW_TYPE_INT64:
+      *out = NANOARROW_STATISTICS_INT;
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_UINT8:
+    case NANOARROW_TYPE_UINT16:
+    case NANOARROW_TYPE_UINT32:
+    case NANOARROW_TYPE_UINT64:
+      *out = NANOARROW_STATISTICS_UINT;
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_FLOAT:
+    case NANOARROW_TYPE_DOUBLE:
+      *out = NANOARROW_STATISTICS_DOUBLE;
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_DECIMAL128:
+    case NANOARROW_TYPE_DECIMAL256:
+      *out = NANOARROW_STATISTICS_DECIMAL;
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY:
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY:
+    case NANOARROW_TYPE_FIXED_SIZE_BINARY:
+    case NANOARROW_TYPE_STRING_VIEW:
+    case NANOARROW_TYPE_BINARY_VIEW:
+      *out = NANOARROW_STATISTICS_BYTES;
+      return NANOARROW_OK;
+    default:
+      return ENOTSUP;
+  }
+}
+
+ArrowErrorCode ArrowArrayViewComputeStatistics(struct ArrowArrayView* array_view,
+                                               struct ArrowArrayStatistics* out,
+                                               struct ArrowError* error) {
+  enum ArrowStatisticsKind kind;
+  if (ArrowStatisticsKindOf(array_view->storage_type, &kind) != NANOARROW_OK) {
+    ArrowErrorSet(error, "Computing statistics of arrays of type %s is not supported",
+                  ArrowTypeString(array_view->storage_type));
+    return ENOTSUP;
+  }
+
+  if (array_view->dictionary != NULL) {
+    ArrowErrorSet(error,
+                  "Computing statistics of dictionary-encoded arrays is not supported");
+    return ENOTSUP;
+  }
+
+  out->null_count = ArrowArrayViewComputeNullCount(array_view);
+  out->distinct_count = 0;
+  // Integer minimums and maximums start from the extremes of their range; other
+  // kinds are set by the first non-null value
+  out->has_min_max =
+      array_view->length > out->null_count &&
+      (kind == NANOARROW_STATISTICS_INT || kind == NANOARROW_STATISTICS_UINT);
+  memset(&out->min, 0, sizeof(union ArrowStatisticsValue));
+  memset(&out->max, 0, sizeof(union ArrowStatisticsValue));
+  if (kind == NANOARROW_STATISTICS_INT) {
+    out->min.as_int64 = INT64_MAX;
+    out->max.as_int64 = INT64_MIN;
+  } else if (kind == NANOARROW_STATISTICS_UINT) {
+    out->min.as_uint64 = UINT64_MAX;
+  }
+
+  const uint8_t* validity = array_view->buffer_views[0].data.as_uint8;
+  if (out->null_count == 0) {
+    validity = NULL;
+  }
+
+  uint8_t registers[(int64_t)1 << NANOARROW_HLL_PRECISION];
+  memset(registers, 0, sizeof(registers));
+  uint64_t hashes[NANOARROW_KERNEL_BLOCK_SIZE];
+
+  for (int64_t start = 0; start < array_view->length;
+       start += NANOARROW_KERNEL_BLOCK_SIZE) {
+    int64_t n = array_view->length - start;
+    if (n > NANOARROW_KERNEL_BLOCK_SIZE) {
+      n = NANOARROW_KERNEL_BLOCK_SIZE;
+    }
+
+    ArrowArrayViewUpdateMinMax(array_view, kind, validity, start, n, out);
+
+    // The hashes of null elements are not used
+    memset(hashes, 0, sizeof(hashes));
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayViewHashValues(array_view, validity, start, n, hashes, error));
+    int64_t physical_start = array_view->offset + start;
+    for (int64_t i = 0; i < n; i++) {
+      if (validity == NULL || ArrowBitGet(validity, physical_start + i)) {
+        ArrowHyperLogLogAdd(registers, hashes[i]);
+      }
+    }
+  }
+
+  out->distinct_count = ArrowHyperLogLogEstimate(registers);
+  return NANOARROW_OK;
+}
+
+// The salts of the split-block Bloom filters of the Parquet format, each of which
+// selects the bit set in one word of a block
+static const uint32_t kArrowBloomFilterSalt[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU,
+                                                  0xa2b7289dU, 0x705495c7U, 0x2df1424bU,
+                                                  0x9efc4947U, 0x5c6bfb31U};
+
+#define NANOARROW_BLOOM_FILTER_MAX_BLOCKS ((int64_t)1 << 22)
+
+// The square root of x > 0 (to avoid a dependency on libm)
+static double ArrowBloomFilterSqrt(double x) {
+  double y = x < 1.0 ? 1.0 : x;
+  for (int i = 0; i < 64; i++) {
+    y = 0.5 * (y + x / y);
+  }
+  return y;
+}
+
+static inline uint32_t* ArrowBloomFilterBlock(const struct ArrowBloomFilter* filter,
+                                              uint64_t hash) {
+  uint64_t block = ((hash >> 32) * (uint64_t)filter->n_blocks) >> 32;
+  return (uint32_t*)filter->blocks.data + block * 8;
+}
+
+ArrowErrorCode ArrowBloomFilterInit(struct ArrowBloomFilter* filter, int64_t n_distinct,
+                                    double false_positive_rate) {
+  ArrowBufferInit(&filter->blocks);
+  filter->n_blocks = 0;
+  if (n_distinct < 0 || !(false_positive_rate > 0 && false_positive_rate < 1)) {
+    return EINVAL;
+  }
+
+  // With eight bits set per hash, the number of bits required is
+  // -8 * n_distinct / ln(1 - false_positive_rate ^ (1 / 8))
+  double root = false_positive_rate;
+  for (int i = 0; i < 3; i++) {
+    root = ArrowBloomFilterSqrt(root);
+  }
+
+  double n_bits = 8.0 * (double)n_distinct / ArrowHyperLogLogLog(1.0 / (1.0 - root));
+  int64_t n_blocks = NANOARROW_BLOOM_FILTER_MAX_BLOCKS;
+  if (n_bits / 256.0 < (double)NANOARROW_BLOOM_FILTER_MAX_BLOCKS) {
+    n_blocks = (int64_t)(n_bits / 256.0) + 1;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowBufferAppendFill(&filter->blocks, 0, n_blocks * 32));
+  filter->n_blocks = n_blocks;
+  return NANOARROW_OK;
+}
+
+void ArrowBloomFilterInsert(struct ArrowBloomFilter* filter, const uint64_t* hashes,
+                            int64_t n) {
+  if (filter->n_blocks == 0) {
+    return;
+  }
+
+  for (int64_t i = 0; i < n; i++) {
+    uint32_t* block = ArrowBloomFilterBlock(filter, hashes[i]);
+    uint32_t key = (uint32_t)hashes[i];
+    for (int j = 0; j < 8; j++) {
+      block[j] |= (uint32_t)1 << ((key * kArrowBloomFilterSalt[j]) >> 27);
+    }
+  }
+}
+
+int ArrowBloomFilterMightContain(const struct ArrowBloomFilter* filter, uint64_t hash) {
+  if (filter->n_blocks == 0) {
+    return 1;
+  }
+
+  const uint32_t* block = ArrowBloomFilterBlock(filter, hash);
+  uint32_t key = (uint32_t)hash;
+  uint32_t missing = 0;
+  for (int j = 0; j < 8; j++) {
+    missing |= ~block[j] & ((uint32_t)1 << ((key * kArrowBloomFilterSalt[j]) >> 27));
+  }
+
+  return missing == 0;
+}
+
+void ArrowBloomFilterReset(struct ArrowBloomFilter* filter) {
+  ArrowBufferReset(&filter->blocks);
+  filter->n_blocks = 0;
+}
+
+// Columns are hashed with a fixed seed such that values looked up using
+// ArrowBatchSummaryMightContain() have the same hashes
+#define NANOARROW_BATCH_SUMMARY_SEED 0
+
+#define NANOARROW_BATCH_SUMMARY_VERSION 1
+
+// A copy of the top level of array_view that selects length elements starting at
+// element start (as for the morsels of ArrowArrayViewParallelFor())
+static void ArrowBatchSummarySlice(struct ArrowArrayView* array_view, int64_t start,
+                                   int64_t length, struct ArrowArrayView* out) {
+  *out = *array_view;
+  out->offset += start;
+  out->length = length;
+  if (array_view->null_count != 0) {
+    out->null_count = -1;
+  }
+}
+
+static void ArrowColumnSummaryInit(struct ArrowColumnSummary* column) {
+  memset(column, 0, sizeof(struct ArrowColumnSummary));
+  column->storage_type = NANOARROW_TYPE_UNINITIALIZED;
+  ArrowBufferInit(&column->bloom_filter.blocks);
+  ArrowBufferInit(&column->min_max_data);
+}
+
+// Copies the bytes referred to by the min and max of column->statistics to
+// column->min_max_data
+static ArrowErrorCode ArrowColumnSummaryOwnMinMax(struct ArrowColumnSummary* column) {
+  struct ArrowBufferView* min = &column->statistics.min.as_bytes;
+  struct ArrowBufferView* max = &column->statistics.max.as_bytes;
+  struct ArrowBuffer* data = &column->min_max_data;
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(data, min->size_bytes + max->size_bytes));
+  NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(data, min->data.data, min->size_bytes));
+  NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(data, max->data.data, max->size_bytes));
+  min->data.as_uint8 = data->data;
+  max->data.as_uint8 = data->data + min->size_bytes;
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowColumnSummaryCompute(struct ArrowColumnSummary* out,
+                                                struct ArrowArrayView* column,
+                                                double false_positive_rate,
+                                                struct ArrowError* error) {
+  out->storage_type = column->storage_type;
+
+  enum ArrowStatisticsKind kind;
+  if (column->dictionary != NULL ||
+      ArrowStatisticsKindOf(column->storage_type, &kind) != NANOARROW_OK) {
+    out->statistics.null_count = ArrowArrayViewComputeNullCount(column);
+    return NANOARROW_OK;
+  }
+
+  NANOARROW_RETURN_NOT_OK(
+      ArrowArrayViewComputeStatistics(column, &out->statistics, error));
+  if (out->statistics.has_min_max &&
+      (kind == NANOARROW_STATISTICS_DECIMAL || kind == NANOARROW_STATISTICS_BYTES)) {
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowColumnSummaryOwnMinMax(out), error);
+  }
+
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBloomFilterInit(&out->bloom_filter, out->statistics.distinct_count,
+                           false_positive_rate),
+      error);
+
+  const uint8_t* validity = column->buffer_views[0].data.as_uint8;
+  if (out->statistics.null_count == 0) {
+    validity = NULL;
+  }
+
+  uint64_t hashes[NANOARROW_KERNEL_BLOCK_SIZE];
+  struct ArrowArrayView block;
+  for (int64_t start = 0; start < column->length; start += NANOARROW_KERNEL_BLOCK_SIZE) {
+    int64_t n = column->length - start;
+    if (n > NANOARROW_KERNEL_BLOCK_SIZE) {
+      n = NANOARROW_KERNEL_BLOCK_SIZE;
+    }
+
+    ArrowBatchSummarySlice(column, start, n, &block);
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayViewHash(&block, NANOARROW_BATCH_SUMMARY_SEED, hashes, error));
+
+    // Only the hashes of non-null values are inserted
+    int64_t n_valid = n;
+    if (validity != NULL) {
+      n_valid = 0;
+      for (int64_t j = 0; j < n; j++) {
+        hashes[n_valid] = hashes[j];
+        n_valid += ArrowBitGet(validity, block.offset + j);
+      }
+    }
+
+    ArrowBloomFilterInsert(&out->bloom_filter, hashes, n_valid);
+  }
+
+  out->has_statistics = 1;
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowBatchSummaryAllocate(struct ArrowBatchSummary* summary,
+                                                int64_t n_columns) {
+  summary->length = 0;
+  summary->n_columns = 0;
+  summary->columns = NULL;
+  if (n_columns == 0) {
+    return NANOARROW_OK;
+  }
+
+  summary->columns = (struct ArrowColumnSummary*)ArrowMalloc(
+      n_columns * sizeof(struct ArrowColumnSummary));
+  if (summary->columns == NULL) {
+    return ENOMEM;
+  }
+
+  for (int64_t i = 0; i < n_columns; i++) {
+    ArrowColumnSummaryInit(summary->columns + i);
+  }
+
+  summary->n_columns = n_columns;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowBatchSummaryInit(struct ArrowBatchSummary* summary,
+                                     struct ArrowArrayView* batch,
+                                     double false_positive_rate,
+                                     struct ArrowError* error) {
+  summary->length = 0;
+  summary->n_columns = 0;
+  summary->columns = NULL;
+
+  if (batch->storage_type != NANOARROW_TYPE_STRUCT) {
+    ArrowErrorSet(error, "Expected struct array view but found %s",
+                  ArrowTypeString(batch->storage_type));
+    return EINVAL;
+  }
+
+  if (!(false_positive_rate > 0 && false_positive_rate < 1)) {
+    ArrowErrorSet(error, "Expected false positive rate between 0 and 1 but found %g",
+                  false_positive_rate);
+    return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBatchSummaryAllocate(summary, batch->n_children), error);
+  summary->length = batch->length;
+
+  struct ArrowArrayView column;
+  for (int64_t i = 0; i < batch->n_children; i++) {
+    // The offset of a struct applies to its children
+    ArrowBatchSummarySlice(batch->children[i], batch->offset, batch->length, &column);
+    if (batch->offset == 0 && batch->children[i]->length == batch->length) {
+      column.null_count = batch->children[i]->null_count;
+    }
+
+    int result = ArrowColumnSummaryCompute(summary->columns + i, &column,
+                                           false_positive_rate, error);
+    if (result != NANOARROW_OK) {
+      ArrowBatchSummaryReset(summary);
+      return result;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+// Returns non-zero if the non-null element i of values is within the minimum and
+// maximum of column. NaN values are not considered for the minimum and maximum and
+// are always in range.
+static int ArrowColumnSummaryInRange(const struct ArrowColumnSummary* column,
+                                     enum ArrowStatisticsKind kind,
+                                     struct ArrowArrayView* values, int64_t i) {
+  const struct ArrowArrayStatistics* statistics = &column->statistics;
+  switch (kind) {
+    case NANOARROW_STATISTICS_INT: {
+      int64_t value = ArrowArrayViewGetIntUnsafe(values, i);
+      return value >= statistics->min.as_int64 && value <= statistics->max.as_int64;
+    }
+    case NANOARROW_STATISTICS_UINT: {
+      uint64_t value = ArrowArrayViewGetUIntUnsafe(values, i);
+      return value >= statistics->min.as_uint64 && value <= statistics->max.as_uint64;
+    }
+    case NANOARROW_STATISTICS_DOUBLE: {
+      double value = ArrowArrayViewGetDoubleUnsafe(values, i);
+      return value != value ||
+             (statistics->has_min_max && value >= statistics->min.as_double &&
+              value <= statistics->max.as_double);
+    }
+    case NANOARROW_STATISTICS_DECIMAL: {
+      int64_t size_bytes = values->layout.element_size_bits[1] / 8;
+      struct ArrowDecimal value;
+      struct ArrowDecimal min;
+      struct ArrowDecimal max;
+      ArrowDecimalInit(&value, (int32_t)(size_bytes * 8), 0, 0);
+      ArrowDecimalInit(&min, (int32_t)(size_bytes * 8), 0, 0);
+      ArrowDecimalInit(&max, (int32_t)(size_bytes * 8), 0, 0);
+      ArrowDecimalSetBytes(&value, values->buffer_views[1].data.as_uint8 +
+                                       (values->offset + i) * size_bytes);
+      ArrowDecimalSetBytes(&min, statistics->min.as_bytes.data.as_uint8);
+      ArrowDecimalSetBytes(&max, statistics->max.as_bytes.data.as_uint8);
+      return ArrowDecimalCompare(&value, &min) >= 0 &&
+             ArrowDecimalCompare(&value, &max) <= 0;
+    }
+    case NANOARROW_STATISTICS_BYTES: {
+      struct ArrowStringView value = ArrowArrayViewGetStringUnsafe(values, i);
+      struct ArrowStringView min;
+      struct ArrowStringView max;
+      min.data = statistics->min.as_bytes.data.as_char;
+      min.size_bytes = statistics->min.as_bytes.size_bytes;
+      max.data = statistics->max.as_bytes.data.as_char;
+      max.size_bytes = statistics->max.as_bytes.size_bytes;
+      return ArrowStringViewCompare(value, min) >= 0 &&
+             ArrowStringViewCompare(value, max) <= 0;
+    }
+    default:
+      return 1;
+  }
+}
+
+ArrowErrorCode ArrowBatchSummaryMightContain(const struct ArrowBatchSummary* summary,
+                                             int64_t i, struct ArrowArrayView* values,
+                                             uint8_t* out, struct ArrowError* error) {
+  if (i < 0 || i >= summary->n_columns) {
+    ArrowErrorSet(error, "Expected column index between 0 and %ld but found %ld",
+                  (long)(summary->n_columns - 1), (long)i);
+    return EINVAL;
+  }
+
+  const struct ArrowColumnSummary* column = summary->columns + i;
+  if (values->storage_type != column->storage_type || values->dictionary != NULL) {
+    ArrowErrorSet(error, "Expected values of storage type %s but found %s%s",
+                  ArrowTypeString(column->storage_type),
+                  values->dictionary != NULL ? "dictionary-encoded " : "",
+                  ArrowTypeString(values->storage_type));
+    return EINVAL;
+  }
+
+  const uint8_t* validity = values->buffer_views[0].data.as_uint8;
+  if (values->buffer_views[0].size_bytes == 0 ||
+      ArrowArrayViewComputeNullCount(values) == 0) {
+    validity = NULL;
+  }
+
+  uint8_t has_nulls = column->statistics.null_count > 0;
+  if (!column->has_statistics) {
+    for (int64_t j = 0; j < values->length; j++) {
+      out[j] = validity == NULL || ArrowBitGet(validity, values->offset + j) || has_nulls;
+    }
+    return NANOARROW_OK;
+  }
+
+  enum ArrowStatisticsKind kind;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowStatisticsKindOf(column->storage_type, &kind),
+                                     error);
+  int has_values = column->statistics.has_min_max || kind == NANOARROW_STATISTICS_DOUBLE;
+
+  uint64_t hashes[NANOARROW_KERNEL_BLOCK_SIZE];
+  struct ArrowArrayView block;
+  for (int64_t start = 0; start < values->length; start += NANOARROW_KERNEL_BLOCK_SIZE) {
+    int64_t n = values->length - start;
+    if (n > NANOARROW_KERNEL_BLOCK_SIZE) {
+      n = NANOARROW_KERNEL_BLOCK_SIZE;
+    }
+
+    ArrowBatchSummarySlice(values, start, n, &block);
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayViewHash(&block, NANOARROW_BATCH_SUMMARY_SEED, hashes, error));
+
+    for (int64_t j = 0; j < n; j++) {
+      if (validity != NULL && !ArrowBitGet(validity, block.offset + j)) {
+        out[start + j] = has_nulls;
+      } else {
+        out[start + j] = has_values &&
+                         ArrowColumnSummaryInRange(column, kind, values, start + j) &&
+                         ArrowBloomFilterMightContain(&column->bloom_filter, hashes[j]);
+      }
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowBatchSummaryAppendInt64(struct ArrowBuffer* out,
+                                                   int64_t value) {
+  uint8_t bytes[8];
+  for (int k = 0; k < 8; k++) {
+    bytes[k] = (uint8_t)((uint64_t)value >> (8 * k));
+  }
+  return ArrowBufferAppend(out, bytes, sizeof(bytes));
+}
+
+static ArrowErrorCode ArrowBatchSummaryAppendValue(
+    struct ArrowBuffer* out, enum ArrowStatisticsKind kind,
+    const union ArrowStatisticsValue* value) {
+  int64_t bits;
+  switch (kind) {
+    case NANOARROW_STATISTICS_DECIMAL:
+    case NANOARROW_STATISTICS_BYTES:
+      NANOARROW_RETURN_NOT_OK(
+          ArrowBatchSummaryAppendInt64(out, value->as_bytes.size_bytes));
+      return ArrowBufferAppend(out, value->as_bytes.data.data,
+                               value->as_bytes.size_bytes);
+    case NANOARROW_STATISTICS_DOUBLE:
+      memcpy(&bits, &value->as_double, sizeof(double));
+      return ArrowBatchSummaryAppendInt64(out, bits);
+    default:
+      return ArrowBatchSummaryAppendInt64(out, value->as_int64);
+  }
+}
+
+ArrowErrorCode ArrowBatchSummarySerialize(const struct ArrowBatchSummary* summary,
+                                          struct ArrowBuffer* out) {
+  NANOARROW_RETURN_NOT_OK(
+      ArrowBatchSummaryAppendInt64(out, NANOARROW_BATCH_SUMMARY_VERSION));
+  NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryAppendInt64(out, summary->length));
+  NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryAppendInt64(out, summary->n_columns));
+
+  for (int64_t i = 0; i < summary->n_columns; i++) {
+    const struct ArrowColumnSummary* column = summary->columns + i;
+    const struct ArrowArrayStatistics* statistics = &column->statistics;
+    NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryAppendInt64(out, column->storage_type));
+    NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryAppendInt64(out, statistics->null_count));
+    NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryAppendInt64(out, column->has_statistics));
+    if (!column->has_statistics) {
+      continue;
+    }
+
+    enum ArrowStatisticsKind kind;
+    NANOARROW_RETURN_NOT_OK(ArrowStatisticsKindOf(column->storage_type, &kind));
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBatchSummaryAppendInt64(out, statistics->distinct_count));
+    NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryAppendInt64(out, statistics->has_min_max));
+    if (statistics->has_min_max) {
+      NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryAppendValue(out, kind, &statistics->min));
+      NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryAppendValue(out, kind, &statistics->max));
+    }
+
+    const struct ArrowBloomFilter* filter = &column->bloom_filter;
+    NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryAppendInt64(out, filter->n_blocks));
+    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(out, filter->n_blocks * 32));
+    const uint32_t* words = (const uint32_t*)filter->blocks.data;
+    for (int64_t j = 0; j < filter->n_blocks * 8; j++) {
+      uint8_t bytes[4] = {(uint8_t)words[j], (uint8_t)(words[j] >> 8),
+                          (uint8_t)(words[j] >> 16), (uint8_t)(words[j] >> 24)};
+      ArrowBufferAppendUnsafe(out, bytes, sizeof(bytes));
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+// Reads the little-endian values written by ArrowBatchSummarySerialize()
+struct ArrowBatchSummaryReader {
+  const uint8_t* data;
+  int64_t size_bytes;
+  struct ArrowError* error;
+};
+
+static ArrowErrorCode ArrowBatchSummaryReadBytes(struct ArrowBatchSummaryReader* reader,
+                                                 int64_t size_bytes,
+                                                 const uint8_t** out) {
+  if (size_bytes < 0 || size_bytes > reader->size_bytes) {
+    ArrowErrorSet(reader->error,
+                  "Expected %ld bytes of serialized batch summary but found %ld",
+                  (long)size_bytes, (long)reader->size_bytes);
+    return EINVAL;
+  }
+
+  *out = reader->data;
+  reader->data += size_bytes;
+  reader->size_bytes -= size_bytes;
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowBatchSummaryReadInt64(struct ArrowBatchSummaryReader* reader,
+                                                 int64_t* out) {
+  const uint8_t* bytes;
+  NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryReadBytes(reader, 8, &bytes));
+  uint64_t value = 0;
+  for (int k = 0; k < 8; k++) {
+    value |= (uint64_t)bytes[k] << (8 * k);
+  }
+  *out = (int64_t)value;
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowBatchSummaryReadValue(struct ArrowBatchSummaryReader* reader,
+                                                 enum ArrowStatisticsKind kind,
+                                                 union ArrowStatisticsValue* out) {
+  int64_t value;
+  NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryReadInt64(reader, &value));
+  switch (kind) {
+    case NANOARROW_STATISTICS_DECIMAL:
+    case NANOARROW_STATISTICS_BYTES:
+      out->as_bytes.size_bytes = value;
+      return ArrowBatchSummaryReadBytes(reader, value, &out->as_bytes.data.as_uint8);
+    case NANOARROW_STATISTICS_DOUBLE:
+      memcpy(&out->as_double, &value, sizeof(double));
+      return NANOARROW_OK;
+    default:
+      out->as_int64 = value;
+      return NANOARROW_OK;
+  }
+}
+
+static ArrowErrorCode ArrowColumnSummaryRead(struct ArrowColumnSummary* column,
+                                             struct ArrowBatchSummaryReader* reader) {
+  struct ArrowArrayStatistics* statistics = &column->statistics;
+  int64_t value;
+  NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryReadInt64(reader, &value));
+  column->storage_type = (enum ArrowType)value;
+  NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryReadInt64(reader, &statistics->null_count));
+  NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryReadInt64(reader, &value));
+  if (value == 0) {
+    return NANOARROW_OK;
+  }
+
+  enum ArrowStatisticsKind kind;
+  if (ArrowStatisticsKindOf(column->storage_type, &kind) != NANOARROW_OK) {
+    ArrowErrorSet(reader->error, "Unexpected statistics for column of type %s",
+                  ArrowTypeString(column->storage_type));
+    return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK(
+      ArrowBatchSummaryReadInt64(reader, &statistics->distinct_count));
+  NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryReadInt64(reader, &value));
+  statistics->has_min_max = value != 0;
+  if (statistics->has_min_max) {
+    NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryReadValue(reader, kind, &statistics->min));
+    NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryReadValue(reader, kind, &statistics->max));
+    if (kind == NANOARROW_STATISTICS_DECIMAL || kind == NANOARROW_STATISTICS_BYTES) {
+      NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowColumnSummaryOwnMinMax(column),
+                                         reader->error);
+    }
+  }
+
+  int64_t n_blocks;
+  NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryReadInt64(reader, &n_blocks));
+  if (n_blocks < 0 || n_blocks > NANOARROW_BLOOM_FILTER_MAX_BLOCKS) {
+    ArrowErrorSet(reader->error,
+                  "Expected between 0 and %ld Bloom filter blocks but found %ld",
+                  (long)NANOARROW_BLOOM_FILTER_MAX_BLOCKS, (long)n_blocks);
+    return EINVAL;
+  }
+
+  const uint8_t* bytes;
+  NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryReadBytes(reader, n_blocks * 32, &bytes));
+  struct ArrowBuffer* blocks = &column->bloom_filter.blocks;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowBufferReserve(blocks, n_blocks * 32),
+                                     reader->error);
+  for (int64_t j = 0; j < n_blocks * 8; j++) {
+    const uint8_t* word = bytes + j * 4;
+    uint32_t value = (uint32_t)word[0] | (uint32_t)word[1] << 8 |
+                     (uint32_t)word[2] << 16 | (uint32_t)word[3] << 24;
+    ArrowBufferAppendUnsafe(blocks, &value, sizeof(uint32_t));
+  }
+
+  column->bloom_filter.n_blocks = n_blocks;
+  column->has_statistics = 1;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowBatchSummaryDeserialize(struct ArrowBatchSummary* summary,
+                                            struct ArrowBufferView data,
+                                            struct ArrowError* error) {
+  summary->length = 0;
+  summary->n_columns = 0;
+  summary->columns = NULL;
+
+  struct ArrowBatchSummaryReader reader;
+  reader.data = data.data.as_uint8;
+  reader.size_bytes = data.size_bytes;
+  reader.error = error;
+
+  int64_t version;
+  int64_t length;
+  int64_t n_columns;
+  NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryReadInt64(&reader, &version));
+  if (version != NANOARROW_BATCH_SUMMARY_VERSION) {
+    ArrowErrorSet(error, "Expected batch summary version %d but found %ld",
+                  NANOARROW_BATCH_SUMMARY_VERSION, (long)version);
+    return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryReadInt64(&reader, &length));
+  NANOARROW_RETURN_NOT_OK(ArrowBatchSummaryReadInt64(&reader, &n_columns));
+  // Every column is serialized in at least 24 bytes
+  if (length < 0 || n_columns < 0 || n_columns > reader.size_bytes / 24) {
+    ArrowErrorSet(error, "Invalid batch summary of %ld rows and %ld columns",
+                  (long)length, (long)n_columns);
+    return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowBatchSummaryAllocate(summary, n_columns),
+                                     error);
+  summary->length = length;
+
+  for (int64_t i = 0; i < n_columns; i++) {
+    int result = ArrowColumnSummaryRead(summary->columns + i, &reader);
+    if (result != NANOARROW_OK) {
+      ArrowBatchSummaryReset(summary);
+      return result;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+void ArrowBatchSummaryReset(struct ArrowBatchSummary* summary) {
+  for (int64_t i = 0; i < summary->n_columns; i++) {
+    ArrowBloomFilterReset(&summary->columns[i].bloom_filter);
+    ArrowBufferReset(&summary->columns[i].min_max_data);
+  }
+
+  if (summary->columns != NULL) {
+    ArrowFree(summary->columns);
+  }
+
+  summary->length = 0;
+  summary->n_columns = 0;
+  summary->columns = NULL;
+}
+
+ArrowErrorCode ArrowArrayViewDecodeDictionary(struct ArrowArrayView* array_view,
+                                              int64_t i, int64_t n, void* out,
+                                              struct ArrowError* error) {
+  struct ArrowArrayView* dictionary = array_view->dictionary;
+  if (dictionary == NULL) {
+    ArrowErrorSet(error, "Expected dictionary-encoded array view");
+    return EINVAL;
+  }
+
+  if (i < 0 || n < 0 || i > array_view->length - n) {
+    ArrowErrorSet(error, "Expected range [%ld, %ld) within array of length %ld",
+                  (long)i, (long)(i + n), (long)array_view->length);
+    return EINVAL;
+  }
+
+  int is_string = 0;
+  int64_t element_size_bytes = dictionary->layout.element_size_bits[1] / 8;
+  switch (dictionary->storage_type) {
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY:
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY:
+    case NANOARROW_TYPE_STRING_VIEW:
+    case NANOARROW_TYPE_BINARY_VIEW:
+      is_string = 1;
+      break;
+    default:
+      if (dictionary->storage_type == NANOARROW_TYPE_BOOL ||
+          dictionary->layout.buffer_type[1] != NANOARROW_BUFFER_TYPE_DATA ||
+          dictionary->layout.buffer_type[2] != NANOARROW_BUFFER_TYPE_NONE ||
+          element_size_bytes == 0) {
+        ArrowErrorSet(error, "Decoding dictionaries of type %s is not supported",
+                      ArrowTypeString(dictionary->storage_type));
+        return ENOTSUP;
+      }
+      break;
+  }
+
+  const uint8_t* validity = array_view->buffer_views[0].data.as_uint8;
+  if (array_view->null_count == 0) {
+    validity = NULL;
+  }
+
+  struct ArrowStringView* out_strings = (struct ArrowStringView*)out;
+  uint8_t* out_bytes = (uint8_t*)out;
+  const uint8_t* values =
+      dictionary->buffer_views[1].data.as_uint8 + dictionary->offset * element_size_bytes;
+  int64_t indices[NANOARROW_KERNEL_BLOCK_SIZE];
+
+  for (int64_t start = 0; start < n; start += NANOARROW_KERNEL_BLOCK_SIZE) {
+    int64_t block_n = n - start;
+    if (block_n > NANOARROW_KERNEL_BLOCK_SIZE) {
+      block_n = NANOARROW_KERNEL_BLOCK_SIZE;
+    }
+
+    ArrowArrayViewGetIntsUnsafe(array_view, i + start, block_n, indices);
+    for (int64_t j = 0; j < block_n; j++) {
+      int64_t k = start + j;
+      if (validity != NULL && !ArrowBitGet(validity, array_view->offset + i + k)) {
+        if (is_string) {
+          out_strings[k].data = NULL;
+          out_strings[k].size_bytes = 0;
+        } else {
+          memset(out_bytes + k * element_size_bytes, 0, (size_t)element_size_bytes);
+        }
+        continue;
+      }
+
+      if (indices[j] < 0 || indices[j] >= dictionary->length) {
+        ArrowErrorSet(error, "[%ld] Expected dictionary index in [0, %ld) but found %ld",
+                      (long)(i + k), (long)dictionary->length, (long)indices[j]);
+        return EINVAL;
+      }
+
+      if (is_string) {
+        out_strings[k] = ArrowArrayViewGetStringUnsafe(dictionary, indices[j]);
+      } else {
+        memcpy(out_bytes + k * element_size_bytes,
+               values + indices[j] * element_size_bytes, (size_t)element_size_bytes);
+      }
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+// The kinds of values converted by ArrowArrayViewCast(). Values of types of the same
+// kind (or of the integer and decimal kinds) are converted by their scale or unit.
+enum ArrowCastKind {
+  NANOARROW_CAST_KIND_UNSUPPORTED,
+  NANOARROW_CAST_KIND_INTEGER,
+  NANOARROW_CAST_KIND_FLOAT,
+  NANOARROW_CAST_KIND_DECIMAL,
+  // Temporal kinds must follow all other kinds
+  NANOARROW_CAST_KIND_TIMESTAMP,
+  NANOARROW_CAST_KIND_TIME,
+  NANOARROW_CAST_KIND_DURATION
+};
+
+static const int64_t kArrowCastPowersOfTen[] = {1LL,
+                                                10LL,
+                                                100LL,
+                                                1000LL,
+                                                10000LL,
+                                                100000LL,
+                                                1000000LL,
+                                                10000000LL,
+                                                100000000LL,
+                                                1000000000LL,
+                                                10000000000LL,
+                                                100000000000LL,
+                                                1000000000000LL,
+                                                10000000000000LL,
+                                                100000000000000LL,
+                                                1000000000000000LL,
+                                                10000000000000000LL,
+                                                100000000000000000LL,
+                                                1000000000000000000LL};
+
+static int64_t ArrowCastTimeUnitNanos(enum ArrowTimeUnit time_unit) {
+  switch (time_unit) {
+    case NANOARROW_TIME_UNIT_SECOND:
+      return 1000000000LL;
+    case NANOARROW_TIME_UNIT_MILLI:
+      return 1000000LL;
+    case NANOARROW_TIME_UNIT_MICRO:
+      return 1000LL;
+    default:
+      return 1;
+  }
+}
+
+// Sets *unit to the scale of a decimal or the number of nanoseconds per stored
+// value of a temporal type
+static enum ArrowCastKind ArrowCastKindOf(const struct ArrowSchemaView* type,
+                                          int64_t* unit) {
+  *unit = 0;
+  switch (type->type) {
+    case NANOARROW_TYPE_INT8:
+    case NANOARROW_TYPE_UINT8:
+    case NANOARROW_TYPE_INT16:
+    case NANOARROW_TYPE_UINT16:
+    case NANOARROW_TYPE_INT32:
+    case NANOARROW_TYPE_UINT32:
+    case NANOARROW_TYPE_INT64:
+    case NANOARROW_TYPE_UINT64:
+      return NANOARROW_CAST_KIND_INTEGER;
+    case NANOARROW_TYPE_FLOAT:
+    case NANOARROW_TYPE_DOUBLE:
+      return NANOARROW_CAST_KIND_FLOAT;
+    case NANOARROW_TYPE_DECIMAL128:
+      *unit = type->decimal_scale;
+      return NANOARROW_CAST_KIND_DECIMAL;
+    case NANOARROW_TYPE_DATE32:
+      *unit = 86400LL * 1000000000LL;
+      return NANOARROW_CAST_KIND_TIMESTAMP;
+    case NANOARROW_TYPE_DATE64:
+      *unit = 1000000LL;
+      return NANOARROW_CAST_KIND_TIMESTAMP;
+    case NANOARROW_TYPE_TIMESTAMP:
+      *unit = ArrowCastTimeUnitNanos(type->time_unit);
+      return NANOARROW_CAST_KIND_TIMESTAMP;
+    case NANOARROW_TYPE_TIME32:
+    case NANOARROW_TYPE_TIME64:
+      *unit = ArrowCastTimeUnitNanos(type->time_unit);
+      return NANOARROW_CAST_KIND_TIME;
+    case NANOARROW_TYPE_DURATION:
+      *unit = ArrowCastTimeUnitNanos(type->time_unit);
+      return NANOARROW_CAST_KIND_DURATION;
+    default:
+      return NANOARROW_CAST_KIND_UNSUPPORTED;
+  }
+}
+
+// The steps used by ArrowArrayViewCast() to convert each block of values. Values
+// are converted as int64_t unless the source or target is a floating point type.
+struct ArrowCastPlan {
+  int source_is_float;
+  int target_is_float;
+  // Integer values are multiplied by multiply and divided by divide (rounding
+  // towards negative infinity if floor_divide is set or towards zero otherwise)
+  int64_t multiply;
+  int64_t divide;
+  int floor_divide;
+  // Floating point values are multiplied by float_multiply and divided by
+  // float_divide when converting to or from decimals
+  double float_multiply;
+  double float_divide;
+  // Non-zero if floating point values are rounded rather than truncated
+  int round;
+  // The range of integer values of the target
+  int64_t min_value;
+  int64_t max_value;
+};
+
+static ArrowErrorCode ArrowCastPlanInit(struct ArrowCastPlan* plan,
+                                        const struct ArrowSchemaView* source_type,
+                                        const struct ArrowSchemaView* target_type,
+                                        struct ArrowError* error) {
+  int64_t source_unit;
+  int64_t target_unit;
+  enum ArrowCastKind source_kind = ArrowCastKindOf(source_type, &source_unit);
+  enum ArrowCastKind target_kind = ArrowCastKindOf(target_type, &target_unit);
+
+  plan->source_is_float = source_kind == NANOARROW_CAST_KIND_FLOAT;
+  plan->target_is_float = target_kind == NANOARROW_CAST_KIND_FLOAT;
+  plan->multiply = 1;
+  plan->divide = 1;
+  plan->floor_divide = 0;
+  plan->float_multiply = 1;
+  plan->float_divide = 1;
+  plan->round = 0;
+
+  int source_is_number = source_kind == NANOARROW_CAST_KIND_INTEGER ||
+                         source_kind == NANOARROW_CAST_KIND_DECIMAL;
+  int target_is_number = target_kind == NANOARROW_CAST_KIND_INTEGER ||
+                         target_kind == NANOARROW_CAST_KIND_DECIMAL;
+  int source_is_temporal = source_kind >= NANOARROW_CAST_KIND_TIMESTAMP;
+  int target_is_temporal = target_kind >= NANOARROW_CAST_KIND_TIMESTAMP;
+  int supported = 1;
+
+  if (source_is_number && target_is_number) {
+    int64_t scale_diff = target_unit - source_unit;
+    if (scale_diff > 18 || scale_diff < -18) {
+      supported = 0;
+    } else if (scale_diff > 0) {
+      plan->multiply = kArrowCastPowersOfTen[scale_diff];
+    } else {
+      plan->divide = kArrowCastPowersOfTen[-scale_diff];
+    }
+  } else if (plan->source_is_float && target_is_number) {
+    // Decimals are rounded to the nearest value of their scale
+    plan->round = target_kind == NANOARROW_CAST_KIND_DECIMAL;
+    for (int64_t i = 0; i < target_unit; i++) {
+      plan->float_multiply *= 10;
+    }
+    for (int64_t i = 0; i > target_unit; i--) {
+      plan->float_divide *= 10;
+    }
+  } else if (source_is_number && plan->target_is_float) {
+    for (int64_t i = 0; i < source_unit; i++) {
+      plan->float_divide *= 10;
+    }
+    for (int64_t i = 0; i > source_unit; i--) {
+      plan->float_multiply *= 10;
+    }
+  } else if (plan->source_is_float && plan->target_is_float) {
+    // Only a conversion between float and double is required
+  } else if (source_is_temporal && source_kind == target_kind) {
+    // Temporal values of the same kind are converted by unit
+    plan->floor_divide = 1;
+    if (source_unit >= target_unit) {
+      plan->multiply = source_unit / target_unit;
+    } else {
+      plan->divide = target_unit / source_unit;
+    }
+  } else if (!(source_kind == NANOARROW_CAST_KIND_INTEGER && target_is_temporal) &&
+             !(source_is_temporal && target_kind == NANOARROW_CAST_KIND_INTEGER)) {
+    // Temporal values are only converted to and from integers by their stored value
+    supported = 0;
+  }
+
+  if (!supported) {
+    ArrowErrorSet(error, "Cast from %s to %s is not supported",
+                  ArrowTypeString(source_type->type), ArrowTypeString(target_type->type));
+    return ENOTSUP;
+  }
+
+  plan->min_value = INT64_MIN;
+  plan->max_value = INT64_MAX;
+  switch (target_type->storage_type) {
+    case NANOARROW_TYPE_INT8:
+      plan->min_value = INT8_MIN;
+      plan->max_value = INT8_MAX;
+      break;
+    case NANOARROW_TYPE_UINT8:
+      plan->min_value = 0;
+      plan->max_value = UINT8_MAX;
+      break;
+    case NANOARROW_TYPE_INT16:
+      plan->min_value = INT16_MIN;
+      plan->max_value = INT16_MAX;
+      break;
+    case NANOARROW_TYPE_UINT16:
+      plan->min_value = 0;
+      plan->max_value = UINT16_MAX;
+      break;
+    case NANOARROW_TYPE_INT32:
+      plan->min_value = INT32_MIN;
+      plan->max_value = INT32_MAX;
+      break;
+    case NANOARROW_TYPE_UINT32:
+      plan->min_value = 0;
+      plan->max_value = UINT32_MAX;
+      break;
+    case NANOARROW_TYPE_UINT64:
+      plan->min_value = 0;
+      break;
+    case NANOARROW_TYPE_DECIMAL128:
+      if (target_type->decimal_precision <= 18) {
+        plan->max_value = kArrowCastPowersOfTen[target_type->decimal_precision] - 1;
+        plan->min_value = -plan->max_value;
+      }
+      break;
+    default:
+      break;
+  }
+
+  return NANOARROW_OK;
+}
+
+// Returns the index of the first element of a block that is flagged by a
+// vectorized check and is not null, or -1 if there is no such element
+static int64_t ArrowCastFirstFlagged(const uint8_t* flagged, int64_t n,
+                                     const uint8_t* validity, int64_t offset) {
+  uint8_t any = 0;
+  for (int64_t j = 0; j < n; j++) {
+    any |= flagged[j];
+  }
+
+  if (!any) {
+    return -1;
+  }
+
+  for (int64_t j = 0; j < n; j++) {
+    if (flagged[j] && (validity == NULL || ArrowBitGet(validity, offset + j))) {
+      return j;
+    }
+  }
+
+  return -1;
+}
+
+// Reads the unscaled values of decimal128 elements i, ..., i + n - 1, flagging
+// those that do not fit in an int64_t
+static void ArrowCastReadDecimals(struct ArrowArrayView* array_view, int64_t i,
+                                  int64_t n, int64_t* out, uint8_t* flagged) {
+  const uint8_t* data =
+      array_view->buffer_views[1].data.as_uint8 + (array_view->offset + i) * 16;
+  int low_index = _ArrowIsLittleEndian() ? 0 : 1;
+  uint64_t words[2];
+  for (int64_t j = 0; j < n; j++) {
+    memcpy(words, data + j * 16, sizeof(words));
+    out[j] = (int64_t)words[low_index];
+    flagged[j] = words[1 - low_index] != (out[j] < 0 ? UINT64_MAX : 0);
+  }
+}
+
+static void ArrowCastWriteInts(const int64_t* values, int64_t n,
+                               enum ArrowType storage_type, uint8_t* out) {
+  switch (storage_type) {
+    case NANOARROW_TYPE_INT8:
+      _NANOARROW_CONVERT_VALUES((int8_t*)out, values, n, int8_t);
+      break;
+    case NANOARROW_TYPE_UINT8:
+      _NANOARROW_CONVERT_VALUES(out, values, n, uint8_t);
+      break;
+    case NANOARROW_TYPE_INT16:
+      _NANOARROW_CONVERT_VALUES((int16_t*)out, values, n, int16_t);
+      break;
+    case NANOARROW_TYPE_UINT16:
+      _NANOARROW_CONVERT_VALUES((uint16_t*)out, values, n, uint16_t);
+      break;
+    case NANOARROW_TYPE_INT32:
+      _NANOARROW_CONVERT_VALUES((int32_t*)out, values, n, int32_t);
+      break;
+    case NANOARROW_TYPE_UINT32:
+      _NANOARROW_CONVERT_VALUES((uint32_t*)out, values, n, uint32_t);
+      break;
+    case NANOARROW_TYPE_INT64:
+      memcpy(out, values, n * sizeof(int64_t));
+      break;
+    case NANOARROW_TYPE_UINT64:
+      _NANOARROW_CONVERT_VALUES((uint64_t*)out, values, n, uint64_t);
+      break;
+    case NANOARROW_TYPE_DECIMAL128: {
+      int low_index = _ArrowIsLittleEndian() ? 0 : 1;
+      uint64_t words[2];
+      for (int64_t j = 0; j < n; j++) {
+        words[low_index] = (uint64_t)values[j];
+        words[1 - low_index] = values[j] < 0 ? UINT64_MAX : 0;
+        memcpy(out + j * 16, words, sizeof(words));
+      }
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+static ArrowErrorCode ArrowArrayViewCastInternal(
+    struct ArrowArrayView* array_view, const struct ArrowSchemaView* source_type,
+    const struct ArrowSchemaView* target_type, const struct ArrowCastPlan* plan,
+    int options, struct ArrowArray* out, struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(ArrowArrayStartAppending(out));
+
+  const uint8_t* validity = array_view->buffer_views[0].data.as_uint8;
+  if (array_view->buffer_views[0].size_bytes == 0 || array_view->null_count == 0) {
+    validity = NULL;
+  }
+
+  int64_t element_size_bytes = target_type->layout.element_size_bits[1] / 8;
+  struct ArrowBuffer* data = ArrowArrayBuffer(out, 1);
+  NANOARROW_RETURN_NOT_OK(
+      ArrowBufferReserve(data, array_view->length * element_size_bytes));
+
+  int check_overflow = !(options & NANOARROW_CAST_ALLOW_OVERFLOW);
+  int check_truncate = !(options & NANOARROW_CAST_ALLOW_TRUNCATE);
+  int64_t ints[NANOARROW_KERNEL_BLOCK_SIZE];
+  double doubles[NANOARROW_KERNEL_BLOCK_SIZE];
+  uint8_t flagged[NANOARROW_KERNEL_BLOCK_SIZE];
+
+  for (int64_t start = 0; start < array_view->length;
+       start += NANOARROW_KERNEL_BLOCK_SIZE) {
+    int64_t n = array_view->length - start;
+    if (n > NANOARROW_KERNEL_BLOCK_SIZE) {
+      n = NANOARROW_KERNEL_BLOCK_SIZE;
+    }
+
+    int64_t validity_offset = array_view->offset + start;
+    uint8_t* block_out = data->data + start * element_size_bytes;
+    int64_t k;
+
+    // Read the block as doubles if either type is floating point (except for
+    // decimals, whose unscaled values are read as integers first)
+    if (plan->source_is_float ||
+        (plan->target_is_float && source_type->type != NANOARROW_TYPE_DECIMAL128)) {
+      ArrowArrayViewGetDoublesUnsafe(array_view, start, n, doubles);
+    } else if (source_type->type == NANOARROW_TYPE_DECIMAL128) {
+      ArrowCastReadDecimals(array_view, start, n, ints, flagged);
+      k = ArrowCastFirstFlagged(flagged, n, validity, validity_offset);
+      if (k >= 0) {
+        ArrowErrorSet(error, "[%ld] Decimal value overflows %s", (long)(start + k),
+                      ArrowTypeString(target_type->type));
+        return EOVERFLOW;
+      }
+
+      if (plan->target_is_float) {
+        for (int64_t j = 0; j < n; j++) {
+          doubles[j] = (double)ints[j];
+        }
+      }
+    } else {
+      ArrowArrayViewGetIntsUnsafe(array_view, start, n, ints);
+
+      // Values of a uint64 source greater than INT64_MAX were read as negative
+      if (check_overflow && source_type->storage_type == NANOARROW_TYPE_UINT64) {
+        for (int64_t j = 0; j < n; j++) {
+          flagged[j] = ints[j] < 0;
+        }
+
+        k = ArrowCastFirstFlagged(flagged, n, validity, validity_offset);
+        if (k >= 0) {
+          ArrowErrorSet(error, "[%ld] Value %llu overflows %s", (long)(start + k),
+                        (unsigned long long)ints[k], ArrowTypeString(target_type->type));
+          return EOVERFLOW;
+        }
+      }
+    }
+
+    if (plan->float_multiply != 1 || plan->float_divide != 1) {
+      for (int64_t j = 0; j < n; j++) {
+        doubles[j] = doubles[j] * plan->float_multiply / plan->float_divide;
+      }
+    }
+
+    if (plan->target_is_float) {
+      if (target_type->storage_type == NANOARROW_TYPE_FLOAT) {
+        // Only finite values can overflow a float
+        for (int64_t j = 0; j < n; j++) {
+          flagged[j] = (doubles[j] > FLT_MAX || doubles[j] < -FLT_MAX) &&
+                       (doubles[j] - doubles[j]) == 0;
+        }
+
+        k = ArrowCastFirstFlagged(flagged, n, validity, validity_offset);
+        if (k >= 0 && check_overflow) {
+          ArrowErrorSet(error, "[%ld] Value %g overflows %s", (long)(start + k),
+                        doubles[k], ArrowTypeString(target_type->type));
+          return EOVERFLOW;
+        }
+
+        // Converting an out of range double to a float is undefined
+        for (int64_t j = 0; j < n; j++) {
+          if (flagged[j]) {
+            doubles[j] = doubles[j] > 0 ? FLT_MAX : -FLT_MAX;
+          }
+        }
+
+        _NANOARROW_CONVERT_VALUES((float*)block_out, doubles, n, float);
+      } else {
+        memcpy(block_out, doubles, n * sizeof(double));
+      }
+
+      continue;
+    }
+
+    if (plan->source_is_float) {
+      if (plan->round) {
+        for (int64_t j = 0; j < n; j++) {
+          doubles[j] += doubles[j] < 0 ? -0.5 : 0.5;
+        }
+      }
+
+      // NaN fails both comparisons
+      for (int64_t j = 0; j < n; j++) {
+        flagged[j] =
+            !(doubles[j] >= -9223372036854775808.0 && doubles[j] < 9223372036854775808.0);
+      }
+
+      k = ArrowCastFirstFlagged(flagged, n, validity, validity_offset);
+      if (k >= 0 && check_overflow) {
+        ArrowErrorSet(error, "[%ld] Value %g overflows %s", (long)(start + k),
+                      doubles[k], ArrowTypeString(target_type->type));
+        return EOVERFLOW;
+      }
+
+      // Converting an out of range double to an integer is undefined
+      for (int64_t j = 0; j < n; j++) {
+        if (flagged[j]) {
+          doubles[j] = 0;
+        }
+      }
+
+      _NANOARROW_CONVERT_VALUES(ints, doubles, n, int64_t);
+
+      if (!plan->round && check_truncate) {
+        for (int64_t j = 0; j < n; j++) {
+          flagged[j] = (double)ints[j] != doubles[j];
+        }
+
+        k = ArrowCastFirstFlagged(flagged, n, validity, validity_offset);
+        if (k >= 0) {
+          ArrowErrorSet(error, "[%ld] Value %g would be truncated casting to %s",
+                        (long)(start + k), doubles[k],
+                        ArrowTypeString(target_type->type));
+          return EINVAL;
+        }
+      }
+    }
+
+    if (plan->multiply != 1) {
+      if (check_overflow) {
+        int64_t max_value = INT64_MAX / plan->multiply;
+        int64_t min_value = INT64_MIN / plan->multiply;
+        for (int64_t j = 0; j < n; j++) {
+          flagged[j] = ints[j] > max_value || ints[j] < min_value;
+        }
+
+        k = ArrowCastFirstFlagged(flagged, n, validity, validity_offset);
+        if (k >= 0) {
+          ArrowErrorSet(error, "[%ld] Value %ld overflows %s", (long)(start + k),
+                        (long)ints[k], ArrowTypeString(target_type->type));
+          return EOVERFLOW;
+        }
+      }
+
+      // Unsigned multiplication wraps instead of overflowing for null elements
+      for (int64_t j = 0; j < n; j++) {
+        ints[j] = (int64_t)((uint64_t)ints[j] * (uint64_t)plan->multiply);
+      }
+    } else if (plan->divide != 1) {
+      int64_t divide = plan->divide;
+      for (int64_t j = 0; j < n; j++) {
+        flagged[j] = (ints[j] % divide) != 0;
+      }
+
+      if (check_truncate) {
+        k = ArrowCastFirstFlagged(flagged, n, validity, validity_offset);
+        if (k >= 0) {
+          ArrowErrorSet(error, "[%ld] Value %ld would be truncated casting to %s",
+                        (long)(start + k), (long)ints[k],
+                        ArrowTypeString(target_type->type));
+          return EINVAL;
+        }
+      }
+
+      if (plan->floor_divide) {
+        for (int64_t j = 0; j < n; j++) {
+          ints[j] = ints[j] / divide - (flagged[j] && ints[j] < 0);
+        }
+      } else {
+        for (int64_t j = 0; j < n; j++) {
+          ints[j] = ints[j] / divide;
+        }
+      }
+    }
+
+    if (check_overflow &&
+        (plan->min_value != INT64_MIN || plan->max_value != INT64_MAX)) {
+      for (int64_t j = 0; j < n; j++) {
+        flagged[j] = ints[j] < plan->min_value || ints[j] > plan->max_value;
+      }
+
+      k = ArrowCastFirstFlagged(flagged, n, validity, validity_offset);
+      if (k >= 0) {
+        ArrowErrorSet(error, "[%ld] Value %ld overflows %s", (long)(start + k),
+                      (long)ints[k], ArrowTypeString(target_type->type));
+        return EOVERFLOW;
+      }
+    }
+
+    ArrowCastWriteInts(ints, n, target_type->storage_type, block_out);
+  }
+
+  data->size_bytes = array_view->length * element_size_bytes;
+
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)out->private_data;
+  private_data->built_by_append = 0;
+  NANOARROW_RETURN_NOT_OK(
+      _ArrowArrayAppendValidity(out, validity, array_view->offset, array_view->length));
+  out->length = array_view->length;
+  return NANOARROW_OK;
+}
+
+// Formats each decimal128 or decimal256 element of array_view into the string or
+// large string array out in a single pass over the values
+static ArrowErrorCode ArrowArrayViewCastDecimalsToStrings(
+    struct ArrowArrayView* array_view, const struct ArrowSchemaView* source_type,
+    const struct ArrowSchemaView* target_type, struct ArrowArray* out,
+    struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(ArrowArrayStartAppending(out));
+
+  const uint8_t* validity = array_view->buffer_views[0].data.as_uint8;
+  if (array_view->buffer_views[0].size_bytes == 0 || array_view->null_count == 0) {
+    validity = NULL;
+  }
+
+  int large = target_type->storage_type == NANOARROW_TYPE_LARGE_STRING;
+  struct ArrowBuffer* offsets = ArrowArrayBuffer(out, 1);
+  struct ArrowBuffer* data = ArrowArrayBuffer(out, 2);
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(
+      offsets, array_view->length * (large ? sizeof(int64_t) : sizeof(int32_t))));
+
+  // Most values need no more than their precision plus a sign, a decimal point,
+  // and a leading zero
+  int64_t value_size_bytes = source_type->decimal_precision + 3;
+  if (source_type->decimal_scale < 0) {
+    value_size_bytes -= source_type->decimal_scale;
+  }
+  NANOARROW_RETURN_NOT_OK(
+      ArrowBufferReserve(data, array_view->length * value_size_bytes));
+
+  struct ArrowDecimal decimal;
+  ArrowDecimalInit(&decimal, source_type->decimal_bitwidth,
+                   source_type->decimal_precision, source_type->decimal_scale);
+
+  for (int64_t i = 0; i < array_view->length; i++) {
+    if (validity == NULL || ArrowBitGet(validity, array_view->offset + i)) {
+      ArrowArrayViewGetDecimalUnsafe(array_view, i, &decimal);
+      NANOARROW_RETURN_NOT_OK(ArrowDecimalAppendStringToBuffer(&decimal, data));
+    }
+
+    if (large) {
+      NANOARROW_RETURN_NOT_OK(ArrowBufferAppendInt64(offsets, data->size_bytes));
+    } else if (data->size_bytes > INT32_MAX) {
+      ArrowErrorSet(error, "[%ld] Formatted decimals overflow %s", (long)i,
+                    ArrowTypeString(target_type->type));
+      return EOVERFLOW;
+    } else {
+      NANOARROW_RETURN_NOT_OK(ArrowBufferAppendInt32(offsets, (int32_t)data->size_bytes));
+    }
+  }
+
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)out->private_data;
+  private_data->built_by_append = 0;
+  NANOARROW_RETURN_NOT_OK(
+      _ArrowArrayAppendValidity(out, validity, array_view->offset, array_view->length));
+  out->length = array_view->length;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayViewCast(struct ArrowArrayView* array_view,
+                                  const struct ArrowSchemaView* source_type,
+                                  const struct ArrowSchemaView* target_type,
+                                  int options, struct ArrowArray* out,
+                                  struct ArrowError* error) {
+  if (array_view->storage_type != source_type->storage_type) {
+    ArrowErrorSet(error, "Expected array view with storage type %s but found %s",
+                  ArrowTypeString(source_type->storage_type),
+                  ArrowTypeString(array_view->storage_type));
+    return EINVAL;
+  }
+
+  if (array_view->dictionary != NULL) {
+    ArrowErrorSet(error, "Cast of dictionary-encoded arrays is not supported");
+    return ENOTSUP;
+  }
+
+  int decimal_to_string = (source_type->type == NANOARROW_TYPE_DECIMAL128 ||
+                           source_type->type == NANOARROW_TYPE_DECIMAL256) &&
+                          (target_type->type == NANOARROW_TYPE_STRING ||
+                           target_type->type == NANOARROW_TYPE_LARGE_STRING);
+
+  struct ArrowCastPlan plan;
+  if (!decimal_to_string) {
+    NANOARROW_RETURN_NOT_OK(ArrowCastPlanInit(&plan, source_type, target_type, error));
+  }
+
+  // Values with identical storage that do not need to be rescaled or checked
+  // (e.g., date32 to int32 or decimal(10, 2) to decimal(12, 2)) are passed through
+  int passthrough = !decimal_to_string &&
+                    source_type->storage_type == target_type->storage_type &&
+                    plan.multiply == 1 && plan.divide == 1 &&
+                    plan.float_multiply == 1 && plan.float_divide == 1 &&
+                    (target_type->type != NANOARROW_TYPE_DECIMAL128 ||
+                     target_type->decimal_precision >= source_type->decimal_precision ||
+                     (options & NANOARROW_CAST_ALLOW_OVERFLOW));
+  if (passthrough && array_view->array != NULL &&
+      ArrowArraySlice(array_view->array, array_view->offset - array_view->array->offset,
+                      array_view->length, out) == NANOARROW_OK) {
+    return NANOARROW_OK;
+  } else if (passthrough) {
+    return ArrowArrayViewDeepCopy(array_view, NULL, out, error);
+  }
+
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowArrayInitFromType(out, target_type->storage_type), error);
+
+  int result;
+  if (decimal_to_string) {
+    result = ArrowArrayViewCastDecimalsToStrings(array_view, source_type, target_type,
+                                                 out, error);
+  } else {
+    result = ArrowArrayViewCastInternal(array_view, source_type, target_type, &plan,
+                                        options, out, error);
+  }
+  if (result != NANOARROW_OK) {
+    out->release(out);
+    return result;
+  }
+
+  result = ArrowArrayFinishBuildingDefault(out, error);
+  if (result != NANOARROW_OK) {
+    out->release(out);
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+// Days since the epoch of the first day of a month of the proleptic Gregorian
+// calendar (month is 1-12)
+static inline int64_t ArrowTemporalDaysFromCivil(int64_t year, int64_t month) {
+  year -= month <= 2;
+  int64_t era = (year >= 0 ? year : year - 399) / 400;
+  int64_t year_of_era = year - era * 400;
+  int64_t day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5;
+  int64_t day_of_era =
+      year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
+// Months since January 1970 of a number of days since the epoch
+static inline int64_t ArrowTemporalMonthsFromDays(int64_t days) {
+  days += 719468;
+  int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+  int64_t day_of_era = days - era * 146097;
+  int64_t year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 -
+                         day_of_era / 146096) /
+                        365;
+  int64_t day_of_year =
+      day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  // Months counted from March
+  int64_t month = (5 * day_of_year + 2) / 153;
+  int64_t year = year_of_era + era * 400 + (month >= 10);
+  return (year - 1970) * 12 + (month < 10 ? month + 2 : month - 10);
+}
+
+static inline int64_t ArrowTemporalFloorMod(int64_t value, int64_t divisor) {
+  int64_t remainder = value % divisor;
+  return remainder < 0 ? remainder + divisor : remainder;
+}
+
+static ArrowErrorCode ArrowArrayViewTemporalTruncateInternal(
+    struct ArrowArrayView* array_view, const struct ArrowSchemaView* type,
+    int64_t bucket, int64_t origin, int64_t months, int64_t values_per_day,
+    struct ArrowArray* out, struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(ArrowArrayStartAppending(out));
+
+  const uint8_t* validity = array_view->buffer_views[0].data.as_uint8;
+  if (array_view->buffer_views[0].size_bytes == 0 || array_view->null_count == 0) {
+    validity = NULL;
+  }
+
+  int64_t element_size_bytes = type->layout.element_size_bits[1] / 8;
+  struct ArrowBuffer* data = ArrowArrayBuffer(out, 1);
+  NANOARROW_RETURN_NOT_OK(
+      ArrowBufferReserve(data, array_view->length * element_size_bytes));
+
+  int64_t min_value =
+      type->storage_type == NANOARROW_TYPE_INT32 ? INT32_MIN : INT64_MIN;
+  int64_t min_days = min_value / values_per_day;
+  int64_t ints[NANOARROW_KERNEL_BLOCK_SIZE];
+  int64_t shifts[NANOARROW_KERNEL_BLOCK_SIZE];
+  uint8_t flagged[NANOARROW_KERNEL_BLOCK_SIZE];
+
+  for (int64_t start = 0; start < array_view->length;
+       start += NANOARROW_KERNEL_BLOCK_SIZE) {
+    int64_t n = array_view->length - start;
+    if (n > NANOARROW_KERNEL_BLOCK_SIZE) {
+      n = NANOARROW_KERNEL_BLOCK_SIZE;
+    }
+
+    ArrowArrayViewGetIntsUnsafe(array_view, start, n, ints);
+
+    if (months > 0) {
+      // Values are converted to days, to months, and back to the days of the
+      // first month of their bucket
+      for (int64_t j = 0; j < n; j++) {
+        int64_t days = ints[j] / values_per_day -
+                       (ints[j] % values_per_day < 0);
+        int64_t month = ArrowTemporalMonthsFromDays(days);
+        month -= ArrowTemporalFloorMod(month, months);
+        shifts[j] = ArrowTemporalDaysFromCivil(
+            1970 + (month - ArrowTemporalFloorMod(month, 12)) / 12,
+            ArrowTemporalFloorMod(month, 12) + 1);
+        flagged[j] = shifts[j] < min_days;
+      }
+    } else {
+      // Values are moved back to the start of their bucket, which can only
+      // overflow below the minimum value
+      for (int64_t j = 0; j < n; j++) {
+        shifts[j] = ArrowTemporalFloorMod(ArrowTemporalFloorMod(ints[j], bucket) -
+                                              origin, bucket);
+        flagged[j] = ints[j] < min_value + shifts[j];
+      }
+    }
+
+    int64_t k = ArrowCastFirstFlagged(flagged, n, validity, array_view->offset + start);
+    if (k >= 0) {
+      ArrowErrorSet(error, "[%ld] Truncated value %ld overflows %s", (long)(start + k),
+                    (long)ints[k], ArrowTypeString(type->type));
+      return EOVERFLOW;
+    }
+
+    // Unsigned arithmetic wraps instead of overflowing for null elements
+    if (months > 0) {
+      for (int64_t j = 0; j < n; j++) {
+        ints[j] = (int64_t)((uint64_t)shifts[j] * (uint64_t)values_per_day);
+      }
+    } else {
+      for (int64_t j = 0; j < n; j++) {
+        ints[j] = (int64_t)((uint64_t)ints[j] - (uint64_t)shifts[j]);
+      }
+    }
+
+    ArrowCastWriteInts(ints, n, type->storage_type,
+                       data->data + start * element_size_bytes);
+  }
+
+  data->size_bytes = array_view->length * element_size_bytes;
+
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)out->private_data;
+  private_data->built_by_append = 0;
+  NANOARROW_RETURN_NOT_OK(
+      _ArrowArrayAppendValidity(out, validity, array_view->offset, array_view->length));
+  out->length = array_view->length;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayViewTemporalTruncate(struct ArrowArrayView* array_view,
+                                              const struct ArrowSchemaView* type,
+                                              enum ArrowCalendarUnit unit,
+                                              int64_t multiple, struct ArrowArray* out,
+                                              struct ArrowError* error) {
+  if (array_view->storage_type != type->storage_type) {
+    ArrowErrorSet(error, "Expected array view with storage type %s but found %s",
+                  ArrowTypeString(type->storage_type),
+                  ArrowTypeString(array_view->storage_type));
+    return EINVAL;
+  }
+
+  if (array_view->dictionary != NULL) {
+    ArrowErrorSet(error, "Truncation of dictionary-encoded arrays is not supported");
+    return ENOTSUP;
+  }
+
+  int64_t value_nanos;
+  enum ArrowCastKind kind = ArrowCastKindOf(type, &value_nanos);
+  if (kind != NANOARROW_CAST_KIND_TIMESTAMP && kind != NANOARROW_CAST_KIND_DURATION) {
+    ArrowErrorSet(error, "Truncation of %s is not supported",
+                  ArrowTypeString(type->type));
+    return ENOTSUP;
+  }
+
+  if (multiple <= 0) {
+    ArrowErrorSet(error, "Expected multiple > 0 but found %ld", (long)multiple);
+    return EINVAL;
+  }
+
+  int64_t values_per_day = 86400LL * 1000000000LL / value_nanos;
+  int64_t unit_nanos;
+  int64_t months = 0;
+  int64_t origin = 0;
+  switch (unit) {
+    case NANOARROW_CALENDAR_UNIT_NANOSECOND:
+      unit_nanos = 1;
+      break;
+    case NANOARROW_CALENDAR_UNIT_MICROSECOND:
+      unit_nanos = 1000LL;
+      break;
+    case NANOARROW_CALENDAR_UNIT_MILLISECOND:
+      unit_nanos = 1000000LL;
+      break;
+    case NANOARROW_CALENDAR_UNIT_SECOND:
+      unit_nanos = 1000000000LL;
+      break;
+    case NANOARROW_CALENDAR_UNIT_MINUTE:
+      unit_nanos = 60LL * 1000000000LL;
+      break;
+    case NANOARROW_CALENDAR_UNIT_HOUR:
+      unit_nanos = 3600LL * 1000000000LL;
+      break;
+    case NANOARROW_CALENDAR_UNIT_DAY:
+      unit_nanos = 86400LL * 1000000000LL;
+      break;
+    case NANOARROW_CALENDAR_UNIT_WEEK:
+      // The first Monday after the epoch is four days later
+      unit_nanos = 7 * 86400LL * 1000000000LL;
+      origin = kind == NANOARROW_CAST_KIND_TIMESTAMP ? 4 * values_per_day : 0;
+      break;
+    case NANOARROW_CALENDAR_UNIT_MONTH:
+    case NANOARROW_CALENDAR_UNIT_YEAR:
+      if (kind == NANOARROW_CAST_KIND_DURATION) {
+        ArrowErrorSet(error,
+                      "Truncation of duration to months or years is not supported");
+        return ENOTSUP;
+      }
+
+      if (unit == NANOARROW_CALENDAR_UNIT_YEAR && multiple > INT64_MAX / 12) {
+        ArrowErrorSet(error, "Buckets of %ld years overflow", (long)multiple);
+        return EOVERFLOW;
+      }
+
+      unit_nanos = 86400LL * 1000000000LL;
+      months = unit == NANOARROW_CALENDAR_UNIT_YEAR ? multiple * 12 : multiple;
+      break;
+    default:
+      ArrowErrorSet(error, "Unknown calendar unit %d", (int)unit);
+      return EINVAL;
+  }
+
+  // Buckets are counted in values of type, e.g., 90 minutes of timestamps in
+  // seconds are 5400 values
+  int64_t bucket = 1;
+  if (months == 0) {
+    int64_t a = unit_nanos;
+    int64_t b = value_nanos;
+    while (b != 0) {
+      int64_t remainder = a % b;
+      a = b;
+      b = remainder;
+    }
+
+    int64_t values_per_unit = value_nanos / a;
+    if (multiple % values_per_unit == 0) {
+      if (multiple / values_per_unit > INT64_MAX / (unit_nanos / a)) {
+        ArrowErrorSet(error, "Buckets of %ld units overflow %s", (long)multiple,
+                      ArrowTypeString(type->type));
+        return EOVERFLOW;
+      }
+
+      bucket = (multiple / values_per_unit) * (unit_nanos / a);
+    } else if (multiple >= value_nanos / unit_nanos ||
+               value_nanos % (multiple * unit_nanos) != 0) {
+      ArrowErrorSet(error,
+                    "Buckets of %ld units are not a multiple or divisor of the unit "
+                    "of %s",
+                    (long)multiple, ArrowTypeString(type->type));
+      return EINVAL;
+    }
+  }
+
+  // Every value is already the start of a bucket
+  if (bucket == 1 && months == 0) {
+    return ArrowArrayViewCast(array_view, type, type, NANOARROW_CAST_DEFAULT, out,
+                              error);
+  }
+
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowArrayInitFromType(out, type->storage_type),
+                                     error);
+
+  int result = ArrowArrayViewTemporalTruncateInternal(
+      array_view, type, bucket, ArrowTemporalFloorMod(origin, bucket), months,
+      values_per_day, out, error);
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayFinishBuildingDefault(out, error);
+  }
+
+  if (result != NANOARROW_OK) {
+    out->release(out);
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+// Scratch space shared by the passes of ArrowArrayViewSortIndices()
+struct ArrowSortScratch {
+  uint64_t* keys;
+  uint64_t* keys_tmp;
+  int64_t* indices_tmp;
+};
+
+// A key whose unsigned order is the order of a double. NaN is ordered after
+// positive infinity.
+static inline uint64_t ArrowSortDoubleKey(double value) {
+  uint64_t bits;
+  if (value != value) {
+    bits = 0x7FF8000000000000ULL;
+  } else {
+    memcpy(&bits, &value, sizeof(double));
+  }
+
+  if (bits >> 63) {
+    return ~bits;
+  } else {
+    return bits | 0x8000000000000000ULL;
+  }
+}
+
+// The first eight bytes of a value packed such that their unsigned order is the
+// lexicographic order of the bytes
+static inline uint64_t ArrowSortPrefixKey(struct ArrowBufferView value) {
+  uint64_t key = 0;
+  int64_t n = value.size_bytes < 8 ? value.size_bytes : 8;
+  for (int64_t i = 0; i < n; i++) {
+    key |= (uint64_t)value.data.as_uint8[i] << (56 - 8 * i);
+  }
+  return key;
+}
+
+static inline int ArrowSortCompareBytes(struct ArrowBufferView lhs,
+                                        struct ArrowBufferView rhs) {
+  int64_t n = lhs.size_bytes < rhs.size_bytes ? lhs.size_bytes : rhs.size_bytes;
+  int result = n == 0 ? 0 : memcmp(lhs.data.data, rhs.data.data, (size_t)n);
+  if (result != 0) {
+    return result;
+  }
+
+  return (lhs.size_bytes > rhs.size_bytes) - (lhs.size_bytes < rhs.size_bytes);
+}
+
+// Stable LSD radix sort of keys and indices by 8-bit digits. Digits that are the
+// same for every key are skipped.
+static void ArrowSortRadix(uint64_t* keys, int64_t* indices, int64_t n,
+                           struct ArrowSortScratch* scratch) {
+  int64_t counts[8][256];
+  memset(counts, 0, sizeof(counts));
+  for (int64_t i = 0; i < n; i++) {
+    uint64_t key = keys[i];
+    for (int digit = 0; digit < 8; digit++) {
+      counts[digit][(key >> (8 * digit)) & 0xFF]++;
+    }
+  }
+
+  uint64_t* keys_in = keys;
+  uint64_t* keys_out = scratch->keys_tmp;
+  int64_t* indices_in = indices;
+  int64_t* indices_out = scratch->indices_tmp;
+
+  for (int digit = 0; digit < 8; digit++) {
+    int shift = 8 * digit;
+    if (counts[digit][(keys_in[0] >> shift) & 0xFF] == n) {
+      continue;
+    }
+
+    int64_t positions[256];
+    int64_t position = 0;
+    for (int bucket = 0; bucket < 256; bucket++) {
+      positions[bucket] = position;
+      position += counts[digit][bucket];
+    }
+
+    for (int64_t i = 0; i < n; i++) {
+      int64_t j = positions[(keys_in[i] >> shift) & 0xFF]++;
+      keys_out[j] = keys_in[i];
+      indices_out[j] = indices_in[i];
+    }
+
+    uint64_t* keys_swap = keys_in;
+    keys_in = keys_out;
+    keys_out = keys_swap;
+    int64_t* indices_swap = indices_in;
+    indices_in = indices_out;
+    indices_out = indices_swap;
+  }
+
+  if (keys_in != keys) {
+    memcpy(keys, keys_in, n * sizeof(uint64_t));
+    memcpy(indices, indices_in, n * sizeof(int64_t));
+  }
+}
+
+// Stable bottom-up merge sort of indices by the complete bytes of each value
+static void ArrowSortMergeBytes(struct ArrowArrayView* column, int64_t base,
+                                int descending, int64_t* indices, int64_t n,
+                                int64_t* indices_tmp) {
+  int64_t* in = indices;
+  int64_t* out = indices_tmp;
+  for (int64_t width = 1; width < n; width *= 2) {
+    for (int64_t left = 0; left < n; left += 2 * width) {
+      int64_t mid = left + width < n ? left + width : n;
+      int64_t right = left + 2 * width < n ? left + 2 * width : n;
+      int64_t i = left;
+      int64_t j = mid;
+      int64_t k = left;
+      while (i < mid && j < right) {
+        int result =
+            ArrowSortCompareBytes(ArrowArrayViewGetBytesUnsafe(column, base + in[j]),
+                                  ArrowArrayViewGetBytesUnsafe(column, base + in[i]));
+        // Take from the right only if it is strictly ordered first
+        if (descending ? result > 0 : result < 0) {
+          out[k++] = in[j++];
+        } else {
+          out[k++] = in[i++];
+        }
+      }
+
+      while (i < mid) {
+        out[k++] = in[i++];
+      }
+      while (j < right) {
+        out[k++] = in[j++];
+      }
+    }
+
+    int64_t* swap = in;
+    in = out;
+    out = swap;
+  }
+
+  if (in != indices) {
+    memcpy(indices, in, n * sizeof(int64_t));
+  }
+}
+
+static ArrowErrorCode ArrowSortIndicesByColumn(struct ArrowArrayView* column,
+                                               int64_t base, int options,
+                                               int64_t* indices, int64_t n,
+                                               struct ArrowSortScratch* scratch,
+                                               struct ArrowError* error);
+
+// Sort the non-null elements of column referred to by indices
+static ArrowErrorCode ArrowSortIndicesByValues(struct ArrowArrayView* column,
+                                               int64_t base, int options,
+                                               int64_t* indices, int64_t n,
+                                               struct ArrowSortScratch* scratch,
+                                               struct ArrowError* error) {
+  uint64_t* keys = scratch->keys;
+  int is_bytes = 0;
+
+  switch (column->storage_type) {
+    case NANOARROW_TYPE_BOOL:
+    case NANOARROW_TYPE_UINT8:
+    case NANOARROW_TYPE_UINT16:
+    case NANOARROW_TYPE_UINT32:
+    case NANOARROW_TYPE_UINT64:
+      for (int64_t i = 0; i < n; i++) {
+        keys[i] = ArrowArrayViewGetUIntUnsafe(column, base + indices[i]);
+      }
+      break;
+    case NANOARROW_TYPE_INT8:
+    case NANOARROW_TYPE_INT16:
+    case NANOARROW_TYPE_INT32:
+    case NANOARROW_TYPE_INT64:
+      for (int64_t i = 0; i < n; i++) {
+        keys[i] = (uint64_t)ArrowArrayViewGetIntUnsafe(column, base + indices[i]) ^
+                  0x8000000000000000ULL;
+      }
+      break;
+    case NANOARROW_TYPE_FLOAT:
+    case NANOARROW_TYPE_DOUBLE:
+      for (int64_t i = 0; i < n; i++) {
+        keys[i] =
+            ArrowSortDoubleKey(ArrowArrayViewGetDoubleUnsafe(column, base + indices[i]));
+      }
+      break;
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY:
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY:
+    case NANOARROW_TYPE_STRING_VIEW:
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_FIXED_SIZE_BINARY:
+      is_bytes = 1;
+      for (int64_t i = 0; i < n; i++) {
+        keys[i] =
+            ArrowSortPrefixKey(ArrowArrayViewGetBytesUnsafe(column, base + indices[i]));
+      }
+      break;
+    case NANOARROW_TYPE_STRUCT:
+      // The least significant children are sorted first such that each stable
+      // pass leaves the order of more significant children intact
+      for (int64_t j = column->n_children - 1; j >= 0; j--) {
+        NANOARROW_RETURN_NOT_OK(ArrowSortIndicesByColumn(column->children[j],
+                                                         base + column->offset, options,
+                                                         indices, n, scratch, error));
+      }
+      return NANOARROW_OK;
+    default:
+      ArrowErrorSet(error, "Sorting arrays of type %s is not supported",
+                    ArrowTypeString(column->storage_type));
+      return ENOTSUP;
+  }
+
+  if (n <= 1) {
+    return NANOARROW_OK;
+  }
+
+  int descending = (options & NANOARROW_SORT_DESCENDING) != 0;
+  if (descending) {
+    for (int64_t i = 0; i < n; i++) {
+      keys[i] = ~keys[i];
+    }
+  }
+
+  ArrowSortRadix(keys, indices, n, scratch);
+  if (!is_bytes) {
+    return NANOARROW_OK;
+  }
+
+  // Values with the same prefix are only ordered by their prefix if they are
+  // equal (i.e., have the same length of at most eight bytes)
+  int64_t run_start = 0;
+  for (int64_t i = 1; i <= n; i++) {
+    if (i < n && keys[i] == keys[run_start]) {
+      continue;
+    }
+
+    int needs_sort = 0;
+    int64_t size_bytes =
+        ArrowArrayViewGetBytesUnsafe(column, base + indices[run_start]).size_bytes;
+    for (int64_t j = run_start; j < i && !needs_sort; j++) {
+      int64_t value_size_bytes =
+          ArrowArrayViewGetBytesUnsafe(column, base + indices[j]).size_bytes;
+      needs_sort = value_size_bytes > 8 || value_size_bytes != size_bytes;
+    }
+
+    if (needs_sort) {
+      ArrowSortMergeBytes(column, base, descending, indices + run_start, i - run_start,
+                          scratch->indices_tmp);
+    }
+
+    run_start = i;
+  }
+
+  return NANOARROW_OK;
+}
+
+// Stable sort of indices by the elements base + indices[i] of column
+static ArrowErrorCode ArrowSortIndicesByColumn(struct ArrowArrayView* column,
+                                               int64_t base, int options,
+                                               int64_t* indices, int64_t n,
+                                               struct ArrowSortScratch* scratch,
+                                               struct ArrowError* error) {
+  if (column->dictionary != NULL) {
+    ArrowErrorSet(error, "Sorting dictionary-encoded arrays is not supported");
+    return ENOTSUP;
+  }
+
+  if (column->storage_type == NANOARROW_TYPE_NA) {
+    return NANOARROW_OK;
+  }
+
+  const uint8_t* validity = column->buffer_views[0].data.as_uint8;
+  if (validity == NULL || column->null_count == 0) {
+    return ArrowSortIndicesByValues(column, base, options, indices, n, scratch, error);
+  }
+
+  // Stable partition of the non-null and null elements, after which only the
+  // non-null elements are sorted (such that nulls keep their original order)
+  int64_t* indices_tmp = scratch->indices_tmp;
+  int64_t n_valid = 0;
+  for (int64_t i = 0; i < n; i++) {
+    n_valid += ArrowBitGet(validity, column->offset + base + indices[i]);
+  }
+
+  int nulls_first = (options & NANOARROW_SORT_NULLS_FIRST) != 0;
+  int64_t valid_out = nulls_first ? n - n_valid : 0;
+  int64_t null_out = nulls_first ? 0 : n_valid;
+  for (int64_t i = 0; i < n; i++) {
+    if (ArrowBitGet(validity, column->offset + base + indices[i])) {
+      indices_tmp[valid_out++] = indices[i];
+    } else {
+      indices_tmp[null_out++] = indices[i];
+    }
+  }
+  memcpy(indices, indices_tmp, n * sizeof(int64_t));
+
+  int64_t* valid_indices = indices + (nulls_first ? n - n_valid : 0);
+  return ArrowSortIndicesByValues(column, base, options, valid_indices, n_valid, scratch,
+                                  error);
+}
+
+ArrowErrorCode ArrowArrayViewSortIndices(struct ArrowArrayView* array_view, int options,
+                                         int64_t* out, struct ArrowError* error) {
+  int64_t n = array_view->length;
+  for (int64_t i = 0; i < n; i++) {
+    out[i] = i;
+  }
+
+  if (n == 0) {
+    return NANOARROW_OK;
+  }
+
+  struct ArrowSortScratch scratch;
+  scratch.keys = (uint64_t*)ArrowMalloc(3 * n * sizeof(uint64_t));
+  if (scratch.keys == NULL) {
+    ArrowErrorSet(error, "Failed to allocate scratch space for %ld elements", (long)n);
+    return ENOMEM;
+  }
+  scratch.keys_tmp = scratch.keys + n;
+  scratch.indices_tmp = (int64_t*)(scratch.keys + 2 * n);
+
+  int result = ArrowSortIndicesByColumn(array_view, 0, options, out, n, &scratch, error);
+  ArrowFree(scratch.keys);
+  return result;
+}
+
+// How the values of a sorted array are compared by ArrowArrayViewLowerBound() and
+// ArrowArrayViewUpperBound()
+enum ArrowSearchKind {
+  NANOARROW_SEARCH_KIND_UNSUPPORTED,
+  NANOARROW_SEARCH_KIND_INT,
+  NANOARROW_SEARCH_KIND_UINT,
+  NANOARROW_SEARCH_KIND_DOUBLE,
+  NANOARROW_SEARCH_KIND_BYTES
+};
+
+static enum ArrowSearchKind ArrowSearchKindOf(enum ArrowType storage_type) {
+  switch (storage_type) {
+    case NANOARROW_TYPE_INT8:
+    case NANOARROW_TYPE_INT16:
+    case NANOARROW_TYPE_INT32:
+    case NANOARROW_TYPE_INT64:
+      return NANOARROW_SEARCH_KIND_INT;
+    case NANOARROW_TYPE_BOOL:
+    case NANOARROW_TYPE_UINT8:
+    case NANOARROW_TYPE_UINT16:
+    case NANOARROW_TYPE_UINT32:
+    case NANOARROW_TYPE_UINT64:
+      return NANOARROW_SEARCH_KIND_UINT;
+    case NANOARROW_TYPE_FLOAT:
+    case NANOARROW_TYPE_DOUBLE:
+      return NANOARROW_SEARCH_KIND_DOUBLE;
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY:
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY:
+    case NANOARROW_TYPE_STRING_VIEW:
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_FIXED_SIZE_BINARY:
+      return NANOARROW_SEARCH_KIND_BYTES;
+    default:
+      return NANOARROW_SEARCH_KIND_UNSUPPORTED;
+  }
+}
+
+// The key of element i as ordered by ArrowArrayViewSortIndices(), which is exact
+// except for the bytes of values longer than eight bytes
+static inline uint64_t ArrowSearchElementKey(struct ArrowArrayView* array_view,
+                                             enum ArrowSearchKind kind, int64_t i) {
+  switch (kind) {
+    case NANOARROW_SEARCH_KIND_INT:
+      return (uint64_t)ArrowArrayViewGetIntUnsafe(array_view, i) ^ 0x8000000000000000ULL;
+    case NANOARROW_SEARCH_KIND_UINT:
+      return ArrowArrayViewGetUIntUnsafe(array_view, i);
+    case NANOARROW_SEARCH_KIND_DOUBLE:
+      return ArrowSortDoubleKey(ArrowArrayViewGetDoubleUnsafe(array_view, i));
+    default:
+      return ArrowSortPrefixKey(ArrowArrayViewGetBytesUnsafe(array_view, i));
+  }
+}
+
+static inline uint64_t ArrowSearchValueKey(enum ArrowSearchKind kind,
+                                           const union ArrowStatisticsValue* value) {
+  switch (kind) {
+    case NANOARROW_SEARCH_KIND_INT:
+      return (uint64_t)value->as_int64 ^ 0x8000000000000000ULL;
+    case NANOARROW_SEARCH_KIND_UINT:
+      return value->as_uint64;
+    case NANOARROW_SEARCH_KIND_DOUBLE:
+      return ArrowSortDoubleKey(value->as_double);
+    default:
+      return ArrowSortPrefixKey(value->as_bytes);
+  }
+}
+
+// Compare element i of array_view to value
+static inline int ArrowSearchCompare(struct ArrowArrayView* array_view,
+                                     enum ArrowSearchKind kind, int64_t i,
+                                     const union ArrowStatisticsValue* value,
+                                     uint64_t value_key) {
+  uint64_t key = ArrowSearchElementKey(array_view, kind, i);
+  if (key != value_key || kind != NANOARROW_SEARCH_KIND_BYTES) {
+    return (key > value_key) - (key < value_key);
+  }
+
+  return ArrowSortCompareBytes(ArrowArrayViewGetBytesUnsafe(array_view, i),
+                               value->as_bytes);
+}
+
+// Find the range [*begin, *end) of non-null elements of array_view, whose nulls
+// must be placed before or after all other elements
+static void ArrowSearchNonNullRange(struct ArrowArrayView* array_view, int64_t* begin,
+                                    int64_t* end) {
+  *begin = 0;
+  *end = array_view->length;
+  const uint8_t* validity = array_view->buffer_views[0].data.as_uint8;
+  if (validity == NULL || array_view->null_count == 0 || array_view->length == 0) {
+    return;
+  }
+
+  int nulls_first = !ArrowBitGet(validity, array_view->offset);
+  int64_t lo = 0;
+  int64_t hi = array_view->length;
+  while (lo < hi) {
+    int64_t mid = lo + (hi - lo) / 2;
+    int is_valid = ArrowBitGet(validity, array_view->offset + mid);
+    if (is_valid == nulls_first) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+
+  if (nulls_first) {
+    *begin = lo;
+  } else {
+    *end = lo;
+  }
+}
+
+ArrowErrorCode ArrowArrayViewFenceInit(struct ArrowArrayViewFence* fence,
+                                       struct ArrowArrayView* array_view,
+                                       int64_t stride, struct ArrowError* error) {
+  enum ArrowSearchKind kind = ArrowSearchKindOf(array_view->storage_type);
+  if (kind == NANOARROW_SEARCH_KIND_UNSUPPORTED || array_view->dictionary != NULL) {
+    ArrowErrorSet(error, "Searching arrays of type %s is not supported",
+                  ArrowTypeString(array_view->storage_type));
+    return ENOTSUP;
+  }
+
+  if (stride <= 0) {
+    ArrowErrorSet(error, "Expected fence stride > 0 but found %ld", (long)stride);
+    return EINVAL;
+  }
+
+  fence->stride = stride;
+  ArrowSearchNonNullRange(array_view, &fence->begin, &fence->end);
+  fence->n_keys = (fence->end - fence->begin + stride - 1) / stride;
+  fence->keys = NULL;
+  if (fence->n_keys == 0) {
+    return NANOARROW_OK;
+  }
+
+  fence->keys = (uint64_t*)ArrowMalloc(fence->n_keys * sizeof(uint64_t));
+  if (fence->keys == NULL) {
+    ArrowErrorSet(error, "Failed to allocate %ld fence keys", (long)fence->n_keys);
+    return ENOMEM;
+  }
+
+  for (int64_t i = 0; i < fence->n_keys; i++) {
+    fence->keys[i] = ArrowSearchElementKey(array_view, kind, fence->begin + i * stride);
+  }
+
+  return NANOARROW_OK;
+}
+
+void ArrowArrayViewFenceReset(struct ArrowArrayViewFence* fence) {
+  if (fence->keys != NULL) {
+    ArrowFree(fence->keys);
+    fence->keys = NULL;
+  }
+
+  fence->n_keys = 0;
+}
+
+// Find the first non-null element that is greater than (or, if !upper, not less
+// than) value
+static ArrowErrorCode ArrowArrayViewBound(struct ArrowArrayView* array_view,
+                                          const union ArrowStatisticsValue* value,
+                                          const struct ArrowArrayViewFence* fence,
+                                          int upper, int64_t* out,
+                                          struct ArrowError* error) {
+  enum ArrowSearchKind kind = ArrowSearchKindOf(array_view->storage_type);
+  if (kind == NANOARROW_SEARCH_KIND_UNSUPPORTED || array_view->dictionary != NULL) {
+    ArrowErrorSet(error, "Searching arrays of type %s is not supported",
+                  ArrowTypeString(array_view->storage_type));
+    return ENOTSUP;
+  }
+
+  uint64_t value_key = ArrowSearchValueKey(kind, value);
+  int64_t lo;
+  int64_t hi;
+
+  if (fence != NULL) {
+    // Elements whose keys are less than the key of value are less than value and
+    // elements whose keys are greater are greater, such that the fence narrows the
+    // search to the blocks whose first element may have the same key as value
+    lo = fence->begin;
+    hi = fence->end;
+
+    int64_t first = 0;
+    int64_t last = fence->n_keys;
+    while (first < last) {
+      int64_t mid = first + (last - first) / 2;
+      if (fence->keys[mid] < value_key) {
+        first = mid + 1;
+      } else {
+        last = mid;
+      }
+    }
+
+    if (first > 0) {
+      lo = fence->begin + (first - 1) * fence->stride + 1;
+    }
+
+    last = fence->n_keys;
+    while (first < last) {
+      int64_t mid = first + (last - first) / 2;
+      if (fence->keys[mid] <= value_key) {
+        first = mid + 1;
+      } else {
+        last = mid;
+      }
+    }
+
+    if (first < fence->n_keys) {
+      hi = fence->begin + first * fence->stride;
+    }
+  } else {
+    ArrowSearchNonNullRange(array_view, &lo, &hi);
+  }
+
+  while (lo < hi) {
+    int64_t mid = lo + (hi - lo) / 2;
+    int result = ArrowSearchCompare(array_view, kind, mid, value, value_key);
+    if (result < 0 || (upper && result == 0)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  *out = lo;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayViewLowerBound(struct ArrowArrayView* array_view,
+                                        const union ArrowStatisticsValue* value,
+                                        const struct ArrowArrayViewFence* fence,
+                                        int64_t* out, struct ArrowError* error) {
+  return ArrowArrayViewBound(array_view, value, fence, 0, out, error);
+}
+
+ArrowErrorCode ArrowArrayViewUpperBound(struct ArrowArrayView* array_view,
+                                        const union ArrowStatisticsValue* value,
+                                        const struct ArrowArrayViewFence* fence,
+                                        int64_t* out, struct ArrowError* error) {
+  return ArrowArrayViewBound(array_view, value, fence, 1, out, error);
+}
+
+// Compare element i of lhs and element j of rhs, which have the same type, as
+// grouping keys: nulls are equal to each other and values are compared by their bytes
+// as hashed by ArrowArrayViewHash()
+static int ArrowGroupKeyEqual(struct ArrowArrayView* lhs, int64_t i,
+                              struct ArrowArrayView* rhs, int64_t j) {
+  int8_t lhs_is_null = ArrowArrayViewIsNull(lhs, i);
+  if (lhs_is_null || ArrowArrayViewIsNull(rhs, j)) {
+    return lhs_is_null == ArrowArrayViewIsNull(rhs, j);
+  }
+
+  switch (lhs->storage_type) {
+    case NANOARROW_TYPE_BOOL:
+      return ArrowArrayViewGetUIntUnsafe(lhs, i) == ArrowArrayViewGetUIntUnsafe(rhs, j);
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY:
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY:
+    case NANOARROW_TYPE_STRING_VIEW:
+    case NANOARROW_TYPE_BINARY_VIEW: {
+      struct ArrowBufferView lhs_value = ArrowArrayViewGetBytesUnsafe(lhs, i);
+      struct ArrowBufferView rhs_value = ArrowArrayViewGetBytesUnsafe(rhs, j);
+      return lhs_value.size_bytes == rhs_value.size_bytes &&
+             (lhs_value.size_bytes == 0 ||
+              memcmp(lhs_value.data.data, rhs_value.data.data,
+                     (size_t)lhs_value.size_bytes) == 0);
+    }
+    case NANOARROW_TYPE_STRUCT:
+      for (int64_t k = 0; k < lhs->n_children; k++) {
+        if (!ArrowGroupKeyEqual(lhs->children[k], lhs->offset + i, rhs->children[k],
+                                rhs->offset + j)) {
+          return 0;
+        }
+      }
+      return 1;
+    default: {
+      // Fixed-width types were validated by ArrowArrayViewHash()
+      int64_t element_size_bytes = lhs->layout.element_size_bits[1] / 8;
+      return memcmp(lhs->buffer_views[1].data.as_uint8 +
+                        (lhs->offset + i) * element_size_bytes,
+                    rhs->buffer_views[1].data.as_uint8 +
+                        (rhs->offset + j) * element_size_bytes,
+                    (size_t)element_size_bytes) == 0;
+    }
+  }
+}
+
+struct ArrowGrouperPrivate {
+  // The key of each group in order of group id
+  struct ArrowArray keys;
+  struct ArrowArrayView keys_view;
+
+  // An open addressing table with linear probing whose capacity is a power of two.
+  // Empty slots have a group id of -1.
+  int64_t capacity;
+  uint64_t* slot_hashes;
+  int64_t* slot_groups;
+
+  // Per-batch scratch space
+  struct ArrowBuffer hashes;
+  struct ArrowBuffer new_rows;
+};
+
+static ArrowErrorCode ArrowGrouperAllocateSlots(struct ArrowGrouperPrivate* private_data,
+                                                int64_t capacity) {
+  uint64_t* slot_hashes = (uint64_t*)ArrowMalloc(capacity * sizeof(uint64_t));
+  int64_t* slot_groups = (int64_t*)ArrowMalloc(capacity * sizeof(int64_t));
+  if (slot_hashes == NULL || slot_groups == NULL) {
+    ArrowFree(slot_hashes);
+    ArrowFree(slot_groups);
+    return ENOMEM;
+  }
+
+  memset(slot_groups, 0xff, capacity * sizeof(int64_t));
+
+  // Move the existing entries (whose hashes are kept) into the new slots
+  int64_t mask = capacity - 1;
+  for (int64_t i = 0; i < private_data->capacity; i++) {
+    if (private_data->slot_groups[i] < 0) {
+      continue;
+    }
+
+    int64_t slot = (int64_t)(private_data->slot_hashes[i] & (uint64_t)mask);
+    while (slot_groups[slot] >= 0) {
+      slot = (slot + 1) & mask;
+    }
+
+    slot_hashes[slot] = private_data->slot_hashes[i];
+    slot_groups[slot] = private_data->slot_groups[i];
+  }
+
+  ArrowFree(private_data->slot_hashes);
+  ArrowFree(private_data->slot_groups);
+  private_data->capacity = capacity;
+  private_data->slot_hashes = slot_hashes;
+  private_data->slot_groups = slot_groups;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowGrouperInit(struct ArrowGrouper* grouper, struct ArrowSchema* schema,
+                                struct ArrowError* error) {
+  struct ArrowGrouperPrivate* private_data =
+      (struct ArrowGrouperPrivate*)ArrowMalloc(sizeof(struct ArrowGrouperPrivate));
+  if (private_data == NULL) {
+    ArrowErrorSet(error, "Failed to allocate ArrowGrouperPrivate");
+    return ENOMEM;
+  }
+
+  memset(private_data, 0, sizeof(struct ArrowGrouperPrivate));
+  ArrowBufferInit(&private_data->hashes);
+  ArrowBufferInit(&private_data->new_rows);
+  grouper->n_groups = 0;
+  grouper->private_data = private_data;
+
+  int result = ArrowArrayInitFromSchema(&private_data->keys, schema, error);
+  if (result != NANOARROW_OK) {
+    ArrowFree(private_data);
+    grouper->private_data = NULL;
+    return result;
+  }
+
+  result = ArrowArrayViewInitFromSchema(&private_data->keys_view, schema, error);
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayStartAppending(&private_data->keys);
+  }
+
+  if (result == NANOARROW_OK) {
+    result = ArrowGrouperAllocateSlots(private_data, 64);
+  }
+
+  if (result != NANOARROW_OK) {
+    ArrowGrouperReset(grouper);
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowGrouperConsume(struct ArrowGrouper* grouper,
+                                   struct ArrowArrayView* array_view, int64_t* group_ids,
+                                   struct ArrowError* error) {
+  struct ArrowGrouperPrivate* private_data =
+      (struct ArrowGrouperPrivate*)grouper->private_data;
+  int64_t n = array_view->length;
+
+  // Hash all keys of the batch in bulk before probing
+  private_data->hashes.size_bytes = 0;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferReserve(&private_data->hashes, n * sizeof(uint64_t)), error);
+  uint64_t* hashes = (uint64_t*)private_data->hashes.data;
+  NANOARROW_RETURN_NOT_OK(ArrowArrayViewHash(array_view, 0, hashes, error));
+
+  // Groups created by this batch refer to the row that created them until the
+  // batch has been probed and their keys are appended
+  int64_t base_groups = grouper->n_groups;
+  private_data->new_rows.size_bytes = 0;
+  int64_t slots[NANOARROW_KERNEL_BLOCK_SIZE];
+
+  for (int64_t start = 0; start < n; start += NANOARROW_KERNEL_BLOCK_SIZE) {
+    int64_t block_n = n - start;
+    if (block_n > NANOARROW_KERNEL_BLOCK_SIZE) {
+      block_n = NANOARROW_KERNEL_BLOCK_SIZE;
+    }
+
+    // Grow before the block such that its first slots stay valid
+    if ((grouper->n_groups + block_n) * 2 > private_data->capacity) {
+      int64_t capacity = private_data->capacity;
+      while ((grouper->n_groups + block_n) * 2 > capacity) {
+        capacity *= 2;
+      }
+      NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+          ArrowGrouperAllocateSlots(private_data, capacity), error);
+    }
+
+    int64_t mask = private_data->capacity - 1;
+    for (int64_t j = 0; j < block_n; j++) {
+      slots[j] = (int64_t)(hashes[start + j] & (uint64_t)mask);
+    }
+
+    for (int64_t j = 0; j < block_n; j++) {
+      int64_t i = start + j;
+      int64_t slot = slots[j];
+      for (;;) {
+        int64_t group = private_data->slot_groups[slot];
+        if (group < 0) {
+          private_data->slot_hashes[slot] = hashes[i];
+          private_data->slot_groups[slot] = grouper->n_groups;
+          NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+              ArrowBufferAppendInt64(&private_data->new_rows, i), error);
+          group_ids[i] = grouper->n_groups++;
+          break;
+        }
+
+        if (private_data->slot_hashes[slot] == hashes[i]) {
+          int equal;
+          if (group < base_groups) {
+            equal = ArrowGroupKeyEqual(array_view, i, &private_data->keys_view, group);
+          } else {
+            const int64_t* new_rows = (const int64_t*)private_data->new_rows.data;
+            equal = ArrowGroupKeyEqual(array_view, i, array_view,
+                                       new_rows[group - base_groups]);
+          }
+
+          if (equal) {
+            group_ids[i] = group;
+            break;
+          }
+        }
+
+        slot = (slot + 1) & mask;
+      }
+    }
+  }
+
+  int64_t n_new = grouper->n_groups - base_groups;
+  if (n_new == 0) {
+    return NANOARROW_OK;
+  }
+
+  int result =
+      ArrowArrayAppendTake(&private_data->keys, array_view,
+                           (const int64_t*)private_data->new_rows.data, n_new);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "Failed to append %ld group keys with errno %d", (long)n_new,
+                  result);
+    return result;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowArrayFinishBuilding(
+      &private_data->keys, NANOARROW_VALIDATION_LEVEL_NONE, error));
+  return ArrowArrayViewSetArrayMinimal(&private_data->keys_view, &private_data->keys,
+                                       error);
+}
+
+ArrowErrorCode ArrowGrouperGetKeys(struct ArrowGrouper* grouper, struct ArrowArray* out,
+                                   struct ArrowError* error) {
+  struct ArrowGrouperPrivate* private_data =
+      (struct ArrowGrouperPrivate*)grouper->private_data;
+  if (grouper->n_groups > 0) {
+    return ArrowArrayViewDeepCopy(&private_data->keys_view, NULL, out, error);
+  }
+
+  // The view of the keys has no buffers until the first group is added
+  NANOARROW_RETURN_NOT_OK(
+      ArrowArrayInitFromArrayView(out, &private_data->keys_view, error));
+  int result = ArrowArrayStartAppending(out);
+  if (result != NANOARROW_OK) {
+    out->release(out);
+    return result;
+  }
+
+  result = ArrowArrayFinishBuildingDefault(out, error);
+  if (result != NANOARROW_OK) {
+    out->release(out);
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+void ArrowGrouperReset(struct ArrowGrouper* grouper) {
+  struct ArrowGrouperPrivate* private_data =
+      (struct ArrowGrouperPrivate*)grouper->private_data;
+  if (private_data == NULL) {
+    return;
+  }
+
+  if (private_data->keys.release != NULL) {
+    private_data->keys.release(&private_data->keys);
+  }
+
+  ArrowArrayViewReset(&private_data->keys_view);
+  ArrowFree(private_data->slot_hashes);
+  ArrowFree(private_data->slot_groups);
+  ArrowBufferReset(&private_data->hashes);
+  ArrowBufferReset(&private_data->new_rows);
+  ArrowFree(private_data);
+  grouper->private_data = NULL;
+  grouper->n_groups = 0;
+}
+
+ArrowErrorCode ArrowGroupedAggregateInit(struct ArrowGroupedAggregate* aggregate,
+                                         enum ArrowAggregateFunction function,
+                                         enum ArrowType storage_type,
+                                         struct ArrowError* error) {
+  switch (storage_type) {
+    case NANOARROW_TYPE_BOOL:
+    case NANOARROW_TYPE_INT8:
+    case NANOARROW_TYPE_UINT8:
+    case NANOARROW_TYPE_INT16:
+    case NANOARROW_TYPE_UINT16:
+    case NANOARROW_TYPE_INT32:
+    case NANOARROW_TYPE_UINT32:
+    case NANOARROW_TYPE_INT64:
+    case NANOARROW_TYPE_UINT64:
+    case NANOARROW_TYPE_FLOAT:
+    case NANOARROW_TYPE_DOUBLE:
+      break;
+    default:
+      if (function != NANOARROW_AGGREGATE_COUNT) {
+        ArrowErrorSet(error, "Aggregating arrays of type %s is not supported",
+                      ArrowTypeString(storage_type));
+        return ENOTSUP;
+      }
+      break;
+  }
+
+  aggregate->function = function;
+  aggregate->storage_type = storage_type;
+  aggregate->n_groups = 0;
+  ArrowBufferInit(&aggregate->values);
+  ArrowBufferInit(&aggregate->counts);
+  return NANOARROW_OK;
+}
+
+static int ArrowGroupedAggregateIsDouble(struct ArrowGroupedAggregate* aggregate) {
+  return aggregate->function != NANOARROW_AGGREGATE_COUNT &&
+         (aggregate->storage_type == NANOARROW_TYPE_FLOAT ||
+          aggregate->storage_type == NANOARROW_TYPE_DOUBLE);
+}
+
+// Add the accumulators of groups aggregate->n_groups, ..., n_groups - 1
+static ArrowErrorCode ArrowGroupedAggregateGrow(struct ArrowGroupedAggregate* aggregate,
+                                                int64_t n_groups) {
+  int64_t n_new = n_groups - aggregate->n_groups;
+  if (n_new <= 0) {
+    return NANOARROW_OK;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowBufferAppendFill(&aggregate->counts, 0,
+                                                n_new * sizeof(int64_t)));
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(&aggregate->values,
+                                             n_new * sizeof(int64_t)));
+  for (int64_t i = 0; i < n_new; i++) {
+    if (ArrowGroupedAggregateIsDouble(aggregate)) {
+      double initial = 0;
+      if (aggregate->function == NANOARROW_AGGREGATE_MIN) {
+        initial = DBL_MAX;
+      } else if (aggregate->function == NANOARROW_AGGREGATE_MAX) {
+        initial = -DBL_MAX;
+      }
+      ArrowBufferAppendUnsafe(&aggregate->values, &initial, sizeof(double));
+    } else {
+      int64_t initial = 0;
+      if (aggregate->function == NANOARROW_AGGREGATE_MIN) {
+        initial = INT64_MAX;
+      } else if (aggregate->function == NANOARROW_AGGREGATE_MAX) {
+        initial = INT64_MIN;
+      }
+      ArrowBufferAppendUnsafe(&aggregate->values, &initial, sizeof(int64_t));
+    }
+  }
+
+  aggregate->n_groups = n_groups;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowGroupedAggregateUpdate(struct ArrowGroupedAggregate* aggregate,
+                                           struct ArrowArrayView* array_view,
+                                           const int64_t* group_ids, int64_t n_groups,
+                                           struct ArrowError* error) {
+  if (array_view->storage_type != aggregate->storage_type) {
+    ArrowErrorSet(error, "Expected array view with storage type %s but found %s",
+                  ArrowTypeString(aggregate->storage_type),
+                  ArrowTypeString(array_view->storage_type));
+    return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowGroupedAggregateGrow(aggregate, n_groups),
+                                     error);
+  if (array_view->storage_type == NANOARROW_TYPE_NA) {
+    return NANOARROW_OK;
+  }
+
+  const uint8_t* validity = array_view->buffer_views[0].data.as_uint8;
+  if (array_view->null_count == 0 ||
+      array_view->layout.buffer_type[0] != NANOARROW_BUFFER_TYPE_VALIDITY) {
+    validity = NULL;
+  }
+
+  int64_t* counts = (int64_t*)aggregate->counts.data;
+  int64_t* int_values = (int64_t*)aggregate->values.data;
+  double* double_values = (double*)aggregate->values.data;
+  int is_double = ArrowGroupedAggregateIsDouble(aggregate);
+  int64_t ints[NANOARROW_KERNEL_BLOCK_SIZE];
+  double doubles[NANOARROW_KERNEL_BLOCK_SIZE];
+
+  for (int64_t start = 0; start < array_view->length;
+       start += NANOARROW_KERNEL_BLOCK_SIZE) {
+    int64_t n = array_view->length - start;
+    if (n > NANOARROW_KERNEL_BLOCK_SIZE) {
+      n = NANOARROW_KERNEL_BLOCK_SIZE;
+    }
+
+    const int64_t* block_groups = group_ids + start;
+    int64_t validity_offset = array_view->offset + start;
+
+    if (aggregate->function == NANOARROW_AGGREGATE_COUNT) {
+      for (int64_t j = 0; j < n; j++) {
+        counts[block_groups[j]] +=
+            validity == NULL || ArrowBitGet(validity, validity_offset + j);
+      }
+      continue;
+    }
+
+    if (is_double) {
+      ArrowArrayViewGetDoublesUnsafe(array_view, start, n, doubles);
+      for (int64_t j = 0; j < n; j++) {
+        double value = doubles[j];
+        int64_t group = block_groups[j];
+        // NaN values are not considered for the minimum or maximum
+        if ((validity != NULL && !ArrowBitGet(validity, validity_offset + j)) ||
+            (aggregate->function != NANOARROW_AGGREGATE_SUM && value != value)) {
+          continue;
+        }
+
+        counts[group]++;
+        switch (aggregate->function) {
+          case NANOARROW_AGGREGATE_SUM:
+            double_values[group] += value;
+            break;
+          case NANOARROW_AGGREGATE_MIN:
+            double_values[group] = value < double_values[group] ? value
+                                                                : double_values[group];
+            break;
+          default:
+            double_values[group] = value > double_values[group] ? value
+                                                                : double_values[group];
+            break;
+        }
+      }
+      continue;
+    }
+
+    ArrowArrayViewGetIntsUnsafe(array_view, start, n, ints);
+    for (int64_t j = 0; j < n; j++) {
+      int64_t value = ints[j];
+      int64_t group = block_groups[j];
+      if (validity != NULL && !ArrowBitGet(validity, validity_offset + j)) {
+        continue;
+      }
+
+      // Values of a uint64 array greater than INT64_MAX were read as negative
+      if (value < 0 && aggregate->storage_type == NANOARROW_TYPE_UINT64) {
+        ArrowErrorSet(error, "[%ld] Value overflows int64", (long)(start + j));
+        return EOVERFLOW;
+      }
+
+      counts[group]++;
+      switch (aggregate->function) {
+        case NANOARROW_AGGREGATE_SUM: {
+          int64_t sum = (int64_t)((uint64_t)int_values[group] + (uint64_t)value);
+          if (((int_values[group] ^ sum) & (value ^ sum)) < 0) {
+            ArrowErrorSet(error, "[%ld] Sum of group %ld overflows int64",
+                          (long)(start + j), (long)group);
+            return EOVERFLOW;
+          }
+          int_values[group] = sum;
+          break;
+        }
+        case NANOARROW_AGGREGATE_MIN:
+          int_values[group] = value < int_values[group] ? value : int_values[group];
+          break;
+        default:
+          int_values[group] = value > int_values[group] ? value : int_values[group];
+          break;
+      }
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowGroupedAggregateFinish(struct ArrowGroupedAggregate* aggregate,
+                                           int64_t n_groups, struct ArrowArray* out,
+                                           struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowGroupedAggregateGrow(aggregate, n_groups),
+                                     error);
+
+  int is_double = ArrowGroupedAggregateIsDouble(aggregate);
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowArrayInitFromType(out, is_double ? NANOARROW_TYPE_DOUBLE
+                                            : NANOARROW_TYPE_INT64),
+      error);
+
+  const int64_t* counts = (const int64_t*)aggregate->counts.data;
+  int result = ArrowArrayStartAppending(out);
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayReserve(out, aggregate->n_groups);
+  }
+
+  // Groups without any values have a count of zero and a null sum, min, and max
+  for (int64_t i = 0; i < aggregate->n_groups && result == NANOARROW_OK; i++) {
+    if (aggregate->function == NANOARROW_AGGREGATE_COUNT) {
+      result = ArrowArrayAppendInt(out, counts[i]);
+    } else if (counts[i] == 0) {
+      result = ArrowArrayAppendNull(out, 1);
+    } else if (is_double) {
+      result = ArrowArrayAppendDouble(out, ((const double*)aggregate->values.data)[i]);
+    } else {
+      result = ArrowArrayAppendInt(out, ((const int64_t*)aggregate->values.data)[i]);
+    }
+  }
+
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayFinishBuildingDefault(out, error);
+  }
+
+  if (result != NANOARROW_OK) {
+    out->release(out);
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+void ArrowGroupedAggregateReset(struct ArrowGroupedAggregate* aggregate) {
+  ArrowBufferReset(&aggregate->values);
+  ArrowBufferReset(&aggregate->counts);
+  aggregate->n_groups = 0;
+}
+
+// Find the first occurrence of pattern (which must not be empty) in the size_bytes
+// bytes at data, scanning for its first byte with memchr(), which is vectorized by
+// common C libraries
+static const uint8_t* ArrowStringFind(const uint8_t* data, int64_t size_bytes,
+                                      struct ArrowStringView pattern) {
+  const uint8_t* first = (const uint8_t*)pattern.data;
+  const uint8_t* end = data + size_bytes - pattern.size_bytes + 1;
+  while (data < end) {
+    data = (const uint8_t*)memchr(data, first[0], end - data);
+    if (data == NULL) {
+      return NULL;
+    }
+
+    if (memcmp(data + 1, first + 1, pattern.size_bytes - 1) == 0) {
+      return data;
+    }
+
+    data++;
+  }
+
+  return NULL;
+}
+
+// Whether value satisfies predicate for pattern (which must not be empty unless
+// predicate is NANOARROW_STRING_EQUALS)
+static int ArrowStringMatches(struct ArrowBufferView value,
+                              enum ArrowStringPredicate predicate,
+                              struct ArrowStringView pattern) {
+  int64_t m = pattern.size_bytes;
+  switch (predicate) {
+    case NANOARROW_STRING_EQUALS:
+      return value.size_bytes == m &&
+             (m == 0 || memcmp(value.data.data, pattern.data, m) == 0);
+    case NANOARROW_STRING_STARTS_WITH:
+      return value.size_bytes >= m && memcmp(value.data.data, pattern.data, m) == 0;
+    case NANOARROW_STRING_ENDS_WITH:
+      return value.size_bytes >= m &&
+             memcmp(value.data.as_uint8 + value.size_bytes - m, pattern.data, m) == 0;
+    default:
+      return value.size_bytes >= m &&
+             ArrowStringFind(value.data.as_uint8, value.size_bytes, pattern) != NULL;
+  }
+}
+
+static inline int64_t ArrowStringOffset(const struct ArrowBufferView* offsets,
+                                        int large, int64_t i) {
+  return large ? offsets->data.as_int64[i] : offsets->data.as_int32[i];
+}
+
+// Set bit i of out for each element i of a string or binary array_view with int32
+// (or, if large, int64) offsets that contains pattern (which must not be empty).
+// Rather than searching each element separately, the data buffer is scanned as a
+// whole and the offsets are only used to find the element that contains each
+// candidate match.
+static void ArrowStringContainsContiguous(struct ArrowArrayView* array_view, int large,
+                                          struct ArrowStringView pattern,
+                                          uint8_t* out) {
+  const struct ArrowBufferView* offsets = &array_view->buffer_views[1];
+  const uint8_t* data = array_view->buffer_views[2].data.as_uint8;
+  const uint8_t* first = (const uint8_t*)pattern.data;
+  int64_t m = pattern.size_bytes;
+
+  int64_t offset = array_view->offset;
+  int64_t n = array_view->length;
+  int64_t data_end = ArrowStringOffset(offsets, large, offset + n);
+  int64_t pos = ArrowStringOffset(offsets, large, offset);
+  int64_t i = 0;
+  int64_t element_end = ArrowStringOffset(offsets, large, offset + 1);
+
+  while (i < n && (data_end - pos) >= m) {
+    const uint8_t* hit =
+        (const uint8_t*)memchr(data + pos, first[0], data_end - m - pos + 1);
+    if (hit == NULL) {
+      break;
+    }
+
+    pos = hit - data;
+    while (element_end <= pos) {
+      i++;
+      element_end = ArrowStringOffset(offsets, large, offset + i + 1);
+    }
+
+    if ((pos + m) <= element_end && memcmp(hit + 1, first + 1, m - 1) == 0) {
+      ArrowBitSet(out, i);
+      if (++i == n) {
+        break;
+      }
+
+      pos = element_end;
+      element_end = ArrowStringOffset(offsets, large, offset + i + 1);
+    } else {
+      pos++;
+    }
+  }
+}
+
+ArrowErrorCode ArrowArrayViewMatchStrings(struct ArrowArrayView* array_view,
+                                          enum ArrowStringPredicate predicate,
+                                          struct ArrowStringView pattern, uint8_t* out,
+                                          struct ArrowError* error) {
+  int large;
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY:
+      large = 0;
+      break;
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY:
+      large = 1;
+      break;
+    case NANOARROW_TYPE_STRING_VIEW:
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_FIXED_SIZE_BINARY:
+      large = -1;
+      break;
+    default:
+      ArrowErrorSet(error, "Matching strings in arrays of type %s is not supported",
+                    ArrowTypeString(array_view->storage_type));
+      return ENOTSUP;
+  }
+
+  if (array_view->dictionary != NULL) {
+    ArrowErrorSet(error, "Matching dictionary-encoded strings is not supported");
+    return ENOTSUP;
+  }
+
+  if (pattern.size_bytes < 0 || (pattern.size_bytes > 0 && pattern.data == NULL)) {
+    ArrowErrorSet(error, "Expected a valid string pattern");
+    return EINVAL;
+  }
+
+  int64_t n = array_view->length;
+  if (n == 0) {
+    return NANOARROW_OK;
+  }
+
+  memset(out, 0, _ArrowBytesForBits(n));
+
+  if (pattern.size_bytes == 0 && predicate != NANOARROW_STRING_EQUALS) {
+    ArrowBitsSetTo(out, 0, n, 1);
+  } else if (predicate == NANOARROW_STRING_CONTAINS && large >= 0) {
+    ArrowStringContainsContiguous(array_view, large, pattern, out);
+  } else if (large >= 0) {
+    // Only values whose length (from the offsets) allows a match are compared, and
+    // only by the bytes the predicate depends on
+    const struct ArrowBufferView* offsets = &array_view->buffer_views[1];
+    const uint8_t* data = array_view->buffer_views[2].data.as_uint8;
+    int64_t m = pattern.size_bytes;
+    int64_t start = ArrowStringOffset(offsets, large, array_view->offset);
+    for (int64_t i = 0; i < n; i++) {
+      int64_t end = ArrowStringOffset(offsets, large, array_view->offset + i + 1);
+      int64_t size_bytes = end - start;
+      int matches;
+      switch (predicate) {
+        case NANOARROW_STRING_EQUALS:
+          matches =
+              size_bytes == m && (m == 0 || memcmp(data + start, pattern.data, m) == 0);
+          break;
+        case NANOARROW_STRING_STARTS_WITH:
+          matches = size_bytes >= m && memcmp(data + start, pattern.data, m) == 0;
+          break;
+        default:
+          matches = size_bytes >= m && memcmp(data + end - m, pattern.data, m) == 0;
+          break;
+      }
+
+      if (matches) {
+        ArrowBitSet(out, i);
+      }
+
+      start = end;
+    }
+  } else {
+    for (int64_t i = 0; i < n; i++) {
+      if (ArrowStringMatches(ArrowArrayViewGetBytesUnsafe(array_view, i), predicate,
+                             pattern)) {
+        ArrowBitSet(out, i);
+      }
+    }
+  }
+
+  const uint8_t* validity = array_view->buffer_views[0].data.as_uint8;
+  if (validity != NULL && array_view->null_count != 0) {
+    ArrowBitsAnd(out, 0, validity, array_view->offset, n, out, 0);
+  }
+
+  return NANOARROW_OK;
+}
+
+// Check that array_view is a list, large list, map, or fixed-size list and set
+// large to 0 (int32 offsets), 1 (int64 offsets), or -1 (constant list size)
+static ArrowErrorCode ArrowListLayout(struct ArrowArrayView* array_view, int* large,
+                                      struct ArrowError* error) {
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_LIST:
+    case NANOARROW_TYPE_MAP:
+      *large = 0;
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_LARGE_LIST:
+      *large = 1;
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_FIXED_SIZE_LIST:
+      *large = -1;
+      return NANOARROW_OK;
+    default:
+      ArrowErrorSet(error,
+                    "Expected list, large list, map, or fixed-size list but got %s",
+                    ArrowTypeString(array_view->storage_type));
+      return ENOTSUP;
+  }
+}
+
+// The offset into the child of the start of list i (including array_view->offset)
+static inline int64_t ArrowListOffset(struct ArrowArrayView* array_view, int large,
+                                      int64_t i) {
+  if (large < 0) {
+    return i * array_view->layout.child_size_elements;
+  } else {
+    return ArrowStringOffset(&array_view->buffer_views[1], large, i);
+  }
+}
+
+ArrowErrorCode ArrowArrayViewListLengths(struct ArrowArrayView* array_view, int64_t* out,
+                                         struct ArrowError* error) {
+  int large;
+  NANOARROW_RETURN_NOT_OK(ArrowListLayout(array_view, &large, error));
+
+  int64_t n = array_view->length;
+  if (large < 0) {
+    int64_t list_size = array_view->layout.child_size_elements;
+    for (int64_t i = 0; i < n; i++) {
+      out[i] = list_size;
+    }
+  } else if (large) {
+    const int64_t* offsets =
+        array_view->buffer_views[1].data.as_int64 + array_view->offset;
+    for (int64_t i = 0; i < n; i++) {
+      out[i] = offsets[i + 1] - offsets[i];
+    }
+  } else {
+    const int32_t* offsets =
+        array_view->buffer_views[1].data.as_int32 + array_view->offset;
+    for (int64_t i = 0; i < n; i++) {
+      out[i] = (int64_t)offsets[i + 1] - offsets[i];
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayViewListParentIds(struct ArrowArrayView* array_view,
+                                           int64_t* out, struct ArrowError* error) {
+  int large;
+  NANOARROW_RETURN_NOT_OK(ArrowListLayout(array_view, &large, error));
+
+  int64_t n = array_view->length;
+  if (n == 0) {
+    return NANOARROW_OK;
+  }
+
+  // Each parent index is repeated once for each element of its list
+  int64_t start = ArrowListOffset(array_view, large, array_view->offset);
+  for (int64_t i = 0; i < n; i++) {
+    int64_t end = ArrowListOffset(array_view, large, array_view->offset + i + 1);
+    for (int64_t j = start; j < end; j++) {
+      *out++ = i;
+    }
+    start = end;
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayViewListFlatten(struct ArrowArrayView* array_view,
+                                         struct ArrowArray* out,
+                                         struct ArrowError* error) {
+  int large;
+  NANOARROW_RETURN_NOT_OK(ArrowListLayout(array_view, &large, error));
+
+  if (array_view->array == NULL) {
+    ArrowErrorSet(error, "Expected ArrowArrayView backed by an ArrowArray");
+    return EINVAL;
+  }
+
+  int64_t start = 0;
+  int64_t end = 0;
+  if (array_view->length > 0) {
+    start = ArrowListOffset(array_view, large, array_view->offset);
+    end = ArrowListOffset(array_view, large, array_view->offset + array_view->length);
+  }
+
+  if (start < 0 || end < start || end > array_view->children[0]->length) {
+    ArrowErrorSet(error,
+                  "List offsets [%ld, %ld) are out of range of child of length %ld",
+                  (long)start, (long)end, (long)array_view->children[0]->length);
+    return EINVAL;
+  }
+
+  // The child of a slice holds its own reference to the buffers of the source and
+  // can be moved out of it
+  struct ArrowArray parent;
+  int result = ArrowArraySlice(array_view->array, 0, array_view->array->length, &parent);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "ArrowArraySlice() failed with errno %d", result);
+    return result;
+  }
+
+  ArrowArrayMove(parent.children[0], out);
+  parent.release(&parent);
+
+  if (start != 0 || end != out->length) {
+    out->offset += start;
+    out->length = end - start;
+    if (out->null_count != 0) {
+      out->null_count = -1;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayViewUnionSelect(struct ArrowArrayView* array_view,
+                                         int64_t offset, int64_t length,
+                                         int64_t* child_counts, int64_t* rows,
+                                         int64_t* child_offsets,
+                                         struct ArrowError* error) {
+  int dense;
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_DENSE_UNION:
+      dense = 1;
+      break;
+    case NANOARROW_TYPE_SPARSE_UNION:
+      dense = 0;
+      break;
+    default:
+      ArrowErrorSet(error, "Expected dense or sparse union but got %s",
+                    ArrowTypeString(array_view->storage_type));
+      return ENOTSUP;
+  }
+
+  if (offset < 0 || length < 0 || offset > array_view->length - length) {
+    ArrowErrorSet(error, "Range [%ld, %ld) is out of bounds of union of length %ld",
+                  (long)offset, (long)(offset + length), (long)array_view->length);
+    return EINVAL;
+  }
+
+  int64_t n_children = array_view->n_children;
+  for (int64_t i = 0; i < n_children; i++) {
+    child_counts[i] = 0;
+  }
+
+  if (length == 0) {
+    return NANOARROW_OK;
+  }
+
+  // Count the elements of each type id before mapping the (at most 128) distinct
+  // type ids to children so that the type id map is not consulted per element
+  int64_t start = array_view->offset + offset;
+  const uint8_t* type_ids = array_view->buffer_views[0].data.as_uint8 + start;
+  int64_t type_id_counts[256];
+  memset(type_id_counts, 0, sizeof(type_id_counts));
+  for (int64_t i = 0; i < length; i++) {
+    type_id_counts[type_ids[i]]++;
+  }
+
+  int64_t type_id_child[256];
+  for (int type_id = 0; type_id < 256; type_id++) {
+    if (type_id_counts[type_id] == 0) {
+      continue;
+    }
+
+    int64_t child_index = -1;
+    if (type_id < 128) {
+      child_index = array_view->union_type_id_map == NULL
+                        ? type_id
+                        : array_view->union_type_id_map[type_id];
+    }
+
+    if (child_index < 0 || child_index >= n_children) {
+      ArrowErrorSet(error, "Union type id %d does not refer to a child",
+                    (int)(int8_t)type_id);
+      return EINVAL;
+    }
+
+    type_id_child[type_id] = child_index;
+    child_counts[child_index] += type_id_counts[type_id];
+  }
+
+  // The position in rows of the first element of each child
+  int64_t child_start[128];
+  int64_t position = 0;
+  for (int64_t i = 0; i < n_children; i++) {
+    child_start[i] = position;
+    position += child_counts[i];
+  }
+
+  // The next position in rows of each type id
+  int64_t type_id_position[256];
+  for (int type_id = 0; type_id < 256; type_id++) {
+    if (type_id_counts[type_id] != 0) {
+      type_id_position[type_id] = child_start[type_id_child[type_id]];
+    }
+  }
+
+  if (child_offsets == NULL) {
+    for (int64_t i = 0; i < length; i++) {
+      rows[type_id_position[type_ids[i]]++] = offset + i;
+    }
+  } else if (dense) {
+    const int32_t* offsets = array_view->buffer_views[1].data.as_int32 + start;
+    for (int64_t i = 0; i < length; i++) {
+      int64_t dst = type_id_position[type_ids[i]]++;
+      rows[dst] = offset + i;
+      child_offsets[dst] = offsets[i];
+    }
+  } else {
+    for (int64_t i = 0; i < length; i++) {
+      int64_t dst = type_id_position[type_ids[i]]++;
+      rows[dst] = offset + i;
+      child_offsets[dst] = start + i;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+// Compare two keys bytewise such that a key sorts after any of its prefixes
+static inline int ArrowMapKeyCompare(struct ArrowBufferView lhs,
+                                     struct ArrowStringView rhs) {
+  int64_t n = lhs.size_bytes < rhs.size_bytes ? lhs.size_bytes : rhs.size_bytes;
+  int result = n == 0 ? 0 : memcmp(lhs.data.data, rhs.data, n);
+  if (result != 0) {
+    return result;
+  }
+
+  return (lhs.size_bytes > rhs.size_bytes) - (lhs.size_bytes < rhs.size_bytes);
+}
+
+// Binary search the sorted keys [start, end) of one map for key
+static int64_t ArrowMapLookupSorted(struct ArrowArrayView* keys, int64_t start,
+                                    int64_t end, struct ArrowStringView key) {
+  int64_t stop = end;
+  while (start < end) {
+    int64_t mid = start + (end - start) / 2;
+    if (ArrowMapKeyCompare(ArrowArrayViewGetBytesUnsafe(keys, mid), key) < 0) {
+      start = mid + 1;
+    } else {
+      end = mid;
+    }
+  }
+
+  if (start < stop &&
+      ArrowMapKeyCompare(ArrowArrayViewGetBytesUnsafe(keys, start), key) == 0) {
+    return start;
+  }
+
+  return -1;
+}
+
+ArrowErrorCode ArrowArrayViewMapLookup(struct ArrowArrayView* array_view,
+                                       const struct ArrowStringView* keys, int64_t n_keys,
+                                       int options, int64_t* out,
+                                       struct ArrowError* error) {
+  if (array_view->storage_type != NANOARROW_TYPE_MAP) {
+    ArrowErrorSet(error, "Expected map but got %s",
+                  ArrowTypeString(array_view->storage_type));
+    return ENOTSUP;
+  }
+
+  struct ArrowArrayView* key_view = array_view->children[0]->children[0];
+  switch (key_view->storage_type) {
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY:
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY:
+    case NANOARROW_TYPE_STRING_VIEW:
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_FIXED_SIZE_BINARY:
+      break;
+    default:
+      ArrowErrorSet(error, "Looking up map keys of type %s is not supported",
+                    ArrowTypeString(key_view->storage_type));
+      return ENOTSUP;
+  }
+
+  int64_t n = array_view->length;
+  if (n == 0 || n_keys == 0) {
+    return NANOARROW_OK;
+  }
+
+  // Offsets refer to the entries, whose offset also applies to the keys
+  const int32_t* offsets = array_view->buffer_views[1].data.as_int32 + array_view->offset;
+  int64_t base = array_view->children[0]->offset;
+  int64_t start = base + offsets[0];
+  int64_t end = base + offsets[n];
+  if (offsets[0] < 0 || end < start || end > key_view->length) {
+    ArrowErrorSet(error, "Map entries [%ld, %ld) are out of range of %ld keys",
+                  (long)start, (long)end, (long)key_view->length);
+    return EINVAL;
+  }
+
+  if (options & NANOARROW_MAP_LOOKUP_KEYS_SORTED) {
+    for (int64_t k = 0; k < n_keys; k++) {
+      int64_t* out_key = out + k * n;
+      for (int64_t i = 0; i < n; i++) {
+        out_key[i] = ArrowMapLookupSorted(key_view, base + offsets[i],
+                                          base + offsets[i + 1], keys[k]);
+      }
+    }
+  } else {
+    // Every key referenced by array_view is compared at once into a bitmap, after
+    // which the first match within the entries of each map is found a byte at a time
+    uint8_t* matches = (uint8_t*)ArrowMalloc(_ArrowBytesForBits(end - start));
+    if (matches == NULL && end > start) {
+      ArrowErrorSet(error, "Failed to allocate bitmap of %ld key matches",
+                    (long)(end - start));
+      return ENOMEM;
+    }
+
+    struct ArrowArrayView key_range = *key_view;
+    key_range.offset += start;
+    key_range.length = end - start;
+    for (int64_t k = 0; k < n_keys; k++) {
+      int result = ArrowArrayViewMatchStrings(&key_range, NANOARROW_STRING_EQUALS,
+                                              keys[k], matches, error);
+      if (result != NANOARROW_OK) {
+        ArrowFree(matches);
+        return result;
+      }
+
+      int64_t* out_key = out + k * n;
+      for (int64_t i = 0; i < n; i++) {
+        out_key[i] = -1;
+        int64_t j = base + offsets[i] - start;
+        int64_t j_end = base + offsets[i + 1] - start;
+        while (j < j_end) {
+          if ((j % 8) == 0 && matches[j / 8] == 0) {
+            j += 8;
+          } else if (ArrowBitGet(matches, j)) {
+            out_key[i] = j + start;
+            break;
+          } else {
+            j++;
+          }
+        }
+      }
+    }
+
+    ArrowFree(matches);
+  }
+
+  const uint8_t* validity = array_view->buffer_views[0].data.as_uint8;
+  if (validity != NULL && array_view->null_count != 0) {
+    for (int64_t i = 0; i < n; i++) {
+      if (!ArrowBitGet(validity, array_view->offset + i)) {
+        for (int64_t k = 0; k < n_keys; k++) {
+          out[k * n + i] = -1;
+        }
+      }
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+// The element width in bytes of a storage type whose values can be compared and
+// repeated byte-wise (0 for boolean, -1 for binary and string types, or -2 if runs of
+// array_view can't be found or expanded)
+static int64_t ArrowRunEndElementWidth(struct ArrowArrayView* array_view) {
+  if (array_view->dictionary != NULL || array_view->n_children != 0) {
+    return -2;
+  }
+
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_BOOL:
+      return 0;
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY:
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY:
+      return -1;
+    case NANOARROW_TYPE_NA:
+    case NANOARROW_TYPE_STRING_VIEW:
+    case NANOARROW_TYPE_BINARY_VIEW:
+      return -2;
+    default:
+      break;
+  }
+
+  if (array_view->layout.buffer_type[1] != NANOARROW_BUFFER_TYPE_DATA ||
+      array_view->layout.buffer_type[2] != NANOARROW_BUFFER_TYPE_NONE ||
+      array_view->layout.element_size_bits[1] == 0 ||
+      (array_view->layout.element_size_bits[1] % 8) != 0) {
+    return -2;
+  }
+
+  return array_view->layout.element_size_bits[1] / 8;
+}
+
+#define _NANOARROW_RUN_DIFFERS(type_)                                                \
+  do {                                                                               \
+    const type_* values = (const type_*)data + i;                                    \
+    for (int64_t j = 0; j < n; j++) {                                                \
+      differs[j] = values[j] != values[j - 1];                                       \
+    }                                                                                \
+  } while (0)
+
+// Sets differs[j] to non-zero if element start + j of array_view (for 1 <= start and
+// j < n) is not equal to the element before it, where two nulls are equal
+static void ArrowRunEndCompareAdjacent(struct ArrowArrayView* array_view, int64_t width,
+                                       int64_t start, int64_t n, uint8_t* differs) {
+  const uint8_t* data = array_view->buffer_views[1].data.as_uint8;
+  int64_t i = array_view->offset + start;
+  struct ArrowBufferView item;
+  struct ArrowBufferView previous;
+
+  switch (width) {
+    case -1:
+      previous = ArrowArrayViewGetBytesUnsafe(array_view, start - 1);
+      for (int64_t j = 0; j < n; j++) {
+        item = ArrowArrayViewGetBytesUnsafe(array_view, start + j);
+        differs[j] = item.size_bytes != previous.size_bytes ||
+                     (item.size_bytes > 0 &&
+                      memcmp(item.data.data, previous.data.data, item.size_bytes) != 0);
+        previous = item;
+      }
+      break;
+    case 0:
+      for (int64_t j = 0; j < n; j++) {
+        differs[j] = ArrowBitGet(data, i + j) != ArrowBitGet(data, i + j - 1);
+      }
+      break;
+    case 1:
+      _NANOARROW_RUN_DIFFERS(uint8_t);
+      break;
+    case 2:
+      _NANOARROW_RUN_DIFFERS(uint16_t);
+      break;
+    case 4:
+      _NANOARROW_RUN_DIFFERS(uint32_t);
+      break;
+    case 8:
+      _NANOARROW_RUN_DIFFERS(uint64_t);
+      break;
+    default:
+      for (int64_t j = 0; j < n; j++) {
+        differs[j] =
+            memcmp(data + (i + j) * width, data + (i + j - 1) * width, width) != 0;
+      }
+      break;
+  }
+
+  const uint8_t* validity = array_view->buffer_views[0].data.as_uint8;
+  if (validity != NULL && array_view->null_count != 0) {
+    for (int64_t j = 0; j < n; j++) {
+      int8_t is_valid = ArrowBitGet(validity, i + j);
+      int8_t previous_is_valid = ArrowBitGet(validity, i + j - 1);
+      differs[j] = is_valid != previous_is_valid || (is_valid && differs[j]);
+    }
+  }
+}
+
+#undef _NANOARROW_RUN_DIFFERS
+
+ArrowErrorCode ArrowArrayViewRunEndEncode(struct ArrowArrayView* array_view,
+                                          enum ArrowType run_end_type,
+                                          struct ArrowArray* out,
+                                          struct ArrowError* error) {
+  int64_t max_run_end;
+  int64_t run_end_size;
+  switch (run_end_type) {
+    case NANOARROW_TYPE_INT16:
+      max_run_end = INT16_MAX;
+      run_end_size = sizeof(int16_t);
+      break;
+    case NANOARROW_TYPE_INT32:
+      max_run_end = INT32_MAX;
+      run_end_size = sizeof(int32_t);
+      break;
+    case NANOARROW_TYPE_INT64:
+      max_run_end = INT64_MAX;
+      run_end_size = sizeof(int64_t);
+      break;
+    default:
+      ArrowErrorSet(error, "Expected run end type int16, int32, or int64 but found %s",
+                    ArrowTypeString(run_end_type));
+      return EINVAL;
+  }
+
+  int64_t width = ArrowRunEndElementWidth(array_view);
+  if (width == -2) {
+    ArrowErrorSet(error, "Run-end encoding of %s arrays is not supported",
+                  ArrowTypeString(array_view->storage_type));
+    return ENOTSUP;
+  }
+
+  if (array_view->length > max_run_end) {
+    ArrowErrorSet(error, "Array of length %ld overflows run end type %s",
+                  (long)array_view->length, ArrowTypeString(run_end_type));
+    return EOVERFLOW;
+  }
+
+  // Collect the index of the first element of each run
+  struct ArrowBuffer run_starts;
+  ArrowBufferInit(&run_starts);
+  int result = NANOARROW_OK;
+  if (array_view->length > 0) {
+    result = ArrowBufferAppendInt64(&run_starts, 0);
+  }
+
+  uint8_t differs[NANOARROW_KERNEL_BLOCK_SIZE];
+  for (int64_t start = 1; start < array_view->length && result == NANOARROW_OK;
+       start += NANOARROW_KERNEL_BLOCK_SIZE) {
+    int64_t n = array_view->length - start;
+    if (n > NANOARROW_KERNEL_BLOCK_SIZE) {
+      n = NANOARROW_KERNEL_BLOCK_SIZE;
+    }
+
+    ArrowRunEndCompareAdjacent(array_view, width, start, n, differs);
+    for (int64_t j = 0; j < n && result == NANOARROW_OK; j++) {
+      if (differs[j]) {
+        result = ArrowBufferAppendInt64(&run_starts, start + j);
+      }
+    }
+  }
+
+  if (result != NANOARROW_OK) {
+    ArrowBufferReset(&run_starts);
+    ArrowErrorSet(error, "Failed to allocate run starts");
+    return result;
+  }
+
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowArrayInitFromType(out, NANOARROW_TYPE_RUN_END_ENCODED), error);
+  result = ArrowArrayAllocateChildren(out, 2);
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayInitFromType(out->children[0], run_end_type);
+  }
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayInitFromArrayView(out->children[1], array_view, error);
+  }
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayStartAppending(out);
+  }
+
+  // The value of each run is its first element and each run ends where the next
+  // one starts
+  const int64_t* starts = (const int64_t*)run_starts.data;
+  int64_t n_runs = run_starts.size_bytes / (int64_t)sizeof(int64_t);
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayAppendTake(out->children[1], array_view, starts, n_runs);
+  }
+
+  struct ArrowBuffer* run_ends = ArrowArrayBuffer(out->children[0], 1);
+  if (result == NANOARROW_OK) {
+    result = ArrowBufferReserve(run_ends, n_runs * run_end_size);
+  }
+
+  for (int64_t k = 0; k < n_runs && result == NANOARROW_OK; k++) {
+    int64_t run_end = (k + 1) < n_runs ? starts[k + 1] : array_view->length;
+    int16_t run_end16 = (int16_t)run_end;
+    int32_t run_end32 = (int32_t)run_end;
+    switch (run_end_type) {
+      case NANOARROW_TYPE_INT16:
+        ArrowBufferAppendUnsafe(run_ends, &run_end16, sizeof(int16_t));
+        break;
+      case NANOARROW_TYPE_INT32:
+        ArrowBufferAppendUnsafe(run_ends, &run_end32, sizeof(int32_t));
+        break;
+      default:
+        ArrowBufferAppendUnsafe(run_ends, &run_end, sizeof(int64_t));
+        break;
+    }
+  }
+
+  ArrowBufferReset(&run_starts);
+  if (result != NANOARROW_OK) {
+    if (out->release != NULL) {
+      out->release(out);
+    }
+    return result;
+  }
+
+  out->children[0]->length = n_runs;
+  out->children[0]->null_count = 0;
+  out->length = array_view->length;
+  out->null_count = 0;
+
+  result = ArrowArrayFinishBuildingDefault(out, error);
+  if (result != NANOARROW_OK) {
+    out->release(out);
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+// Appends n copies of the element at physical index i of the fixed-width or boolean
+// values of a run-end encoded array to out, which has enough space reserved
+static void ArrowRunEndAppendRepeated(struct ArrowArrayView* values, int64_t width,
+                                      int64_t i, int64_t n, struct ArrowArray* out) {
+  const uint8_t* data = values->buffer_views[1].data.as_uint8;
+  struct ArrowBuffer* out_data = ArrowArrayBuffer(out, 1);
+  i += values->offset;
+
+  if (width == 0) {
+    ArrowBitsSetTo(out_data->data, out->length, n, ArrowBitGet(data, i));
+    out_data->size_bytes = _ArrowBytesForBits(out->length + n);
+  } else if (n > 0) {
+    // Copy the value once and then double the copied region
+    uint8_t* dst = out_data->data + out_data->size_bytes;
+    memcpy(dst, data + i * width, width);
+    int64_t n_copied = 1;
+    while (n_copied < n) {
+      int64_t n_copy = n_copied < (n - n_copied) ? n_copied : (n - n_copied);
+      memcpy(dst + n_copied * width, dst, n_copy * width);
+      n_copied += n_copy;
+    }
+
+    out_data->size_bytes += n * width;
+  }
+
+  out->length += n;
+}
+
+ArrowErrorCode ArrowArrayViewRunEndDecode(struct ArrowArrayView* array_view,
+                                          struct ArrowArray* out,
+                                          struct ArrowError* error) {
+  if (array_view->storage_type != NANOARROW_TYPE_RUN_END_ENCODED) {
+    ArrowErrorSet(error, "Expected run-end encoded array view but found %s",
+                  ArrowTypeString(array_view->storage_type));
+    return EINVAL;
+  }
+
+  struct ArrowArrayView* run_ends = array_view->children[0];
+  struct ArrowArrayView* values = array_view->children[1];
+  int64_t width = ArrowRunEndElementWidth(values);
+  if (width == -2) {
+    ArrowErrorSet(error, "Run-end decoding of %s values is not supported",
+                  ArrowTypeString(values->storage_type));
+    return ENOTSUP;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromArrayView(out, values, error));
+  int result = ArrowArrayStartAppending(out);
+
+  // Fixed-width and boolean values are repeated in bulk; the values of other runs are
+  // taken in blocks of indices
+  const uint8_t* validity = values->buffer_views[0].data.as_uint8;
+  if (values->null_count == 0) {
+    validity = NULL;
+  }
+
+  struct ArrowBitmap* out_validity = ArrowArrayValidityBitmap(out);
+  if (result == NANOARROW_OK && width >= 0) {
+    if (validity != NULL) {
+      result = ArrowBitmapReserve(out_validity, array_view->length);
+    }
+
+    struct ArrowBuffer* out_data = ArrowArrayBuffer(out, 1);
+    if (result == NANOARROW_OK && width == 0) {
+      result = ArrowBufferReserve(out_data, _ArrowBytesForBits(array_view->length));
+    } else if (result == NANOARROW_OK) {
+      result = ArrowBufferReserve(out_data, array_view->length * width);
+    }
+  }
+
+  int64_t indices[NANOARROW_KERNEL_BLOCK_SIZE];
+  int64_t n_indices = 0;
+
+  int64_t logical_start = array_view->offset;
+  int64_t logical_end = array_view->offset + array_view->length;
+  int64_t physical = ArrowArrayViewRunEndPhysicalIndex(array_view, 0);
+  int64_t null_count = 0;
+  for (int64_t pos = logical_start; pos < logical_end && result == NANOARROW_OK;
+       physical++) {
+    if (physical >= run_ends->length || physical >= values->length) {
+      ArrowErrorSet(error, "Run ends do not cover array of length %ld",
+                    (long)array_view->length);
+      result = EINVAL;
+      break;
+    }
+
+    int64_t run_end = ArrowArrayViewGetIntUnsafe(run_ends, physical);
+    if (run_end > logical_end) {
+      run_end = logical_end;
+    }
+
+    int64_t n = run_end - pos;
+    if (n <= 0) {
+      ArrowErrorSet(error, "Expected increasing run ends");
+      result = EINVAL;
+      break;
+    }
+
+    if (width >= 0) {
+      if (validity != NULL) {
+        int8_t is_valid = ArrowBitGet(validity, values->offset + physical);
+        ArrowBitmapAppendUnsafe(out_validity, is_valid, n);
+        null_count += is_valid ? 0 : n;
+      }
+
+      ArrowRunEndAppendRepeated(values, width, physical, n, out);
+    } else {
+      for (int64_t j = 0; j < n && result == NANOARROW_OK; j++) {
+        indices[n_indices++] = physical;
+        if (n_indices == NANOARROW_KERNEL_BLOCK_SIZE) {
+          result = ArrowArrayAppendTake(out, values, indices, n_indices);
+          n_indices = 0;
+        }
+      }
+    }
+
+    pos = run_end;
+  }
+
+  if (result == NANOARROW_OK && n_indices > 0) {
+    result = ArrowArrayAppendTake(out, values, indices, n_indices);
+  }
+
+  if (result == NANOARROW_OK && width >= 0) {
+    out->null_count = null_count;
+  }
+
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayFinishBuildingDefault(out, error);
+  }
+
+  if (result != NANOARROW_OK) {
+    out->release(out);
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowChunkedArrayViewInitFromSchema(
+    struct ArrowChunkedArrayView* chunked_array_view, struct ArrowSchema* schema,
+    struct ArrowError* error) {
+  memset(chunked_array_view, 0, sizeof(struct ArrowChunkedArrayView));
+
+  // Check the schema once rather than when each chunk is appended
+  struct ArrowArrayView array_view;
+  NANOARROW_RETURN_NOT_OK(ArrowArrayViewInitFromSchema(&array_view, schema, error));
+  ArrowArrayViewReset(&array_view);
+
+  chunked_array_view->chunk_offsets = (int64_t*)ArrowMalloc(sizeof(int64_t));
+  if (chunked_array_view->chunk_offsets == NULL) {
+    ArrowErrorSet(error, "Failed to allocate chunk offsets");
+    return ENOMEM;
+  }
+  chunked_array_view->chunk_offsets[0] = 0;
+
+  int result = ArrowSchemaDeepCopy(schema, &chunked_array_view->schema);
+  if (result != NANOARROW_OK) {
+    ArrowFree(chunked_array_view->chunk_offsets);
+    chunked_array_view->chunk_offsets = NULL;
+    ArrowErrorSet(error, "Failed to copy schema");
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowChunkedArrayViewAppendArray(
+    struct ArrowChunkedArrayView* chunked_array_view, struct ArrowArray* array,
+    struct ArrowError* error) {
+  if (chunked_array_view->n_chunks == chunked_array_view->capacity) {
+    int64_t capacity = chunked_array_view->capacity == 0
+                           ? 8
+                           : chunked_array_view->capacity * 2;
+    struct ArrowArrayView* chunks = (struct ArrowArrayView*)ArrowRealloc(
+        chunked_array_view->chunks, capacity * sizeof(struct ArrowArrayView));
+    if (chunks == NULL) {
+      ArrowErrorSet(error, "Failed to allocate views of %ld chunks", (long)capacity);
+      return ENOMEM;
+    }
+    chunked_array_view->chunks = chunks;
+
+    int64_t* chunk_offsets = (int64_t*)ArrowRealloc(chunked_array_view->chunk_offsets,
+                                                    (capacity + 1) * sizeof(int64_t));
+    if (chunk_offsets == NULL) {
+      ArrowErrorSet(error, "Failed to allocate offsets of %ld chunks", (long)capacity);
+      return ENOMEM;
+    }
+    chunked_array_view->chunk_offsets = chunk_offsets;
+    chunked_array_view->capacity = capacity;
+  }
+
+  struct ArrowArrayView* chunk =
+      chunked_array_view->chunks + chunked_array_view->n_chunks;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowArrayViewInitFromSchema(chunk, &chunked_array_view->schema, error));
+  int result = ArrowArrayViewSetArray(chunk, array, error);
+  if (result != NANOARROW_OK) {
+    ArrowArrayViewReset(chunk);
+    return result;
+  }
+
+  chunked_array_view->null_count += ArrowArrayViewComputeNullCount(chunk);
+  chunked_array_view->length += chunk->length;
+  chunked_array_view->n_chunks++;
+  chunked_array_view->chunk_offsets[chunked_array_view->n_chunks] =
+      chunked_array_view->length;
+  return NANOARROW_OK;
+}
+
+void ArrowChunkedArrayViewReset(struct ArrowChunkedArrayView* chunked_array_view) {
+  for (int64_t i = 0; i < chunked_array_view->n_chunks; i++) {
+    ArrowArrayViewReset(chunked_array_view->chunks + i);
+  }
+
+  if (chunked_array_view->chunks != NULL) {
+    ArrowFree(chunked_array_view->chunks);
+  }
+
+  if (chunked_array_view->chunk_offsets != NULL) {
+    ArrowFree(chunked_array_view->chunk_offsets);
+  }
+
+  if (chunked_array_view->schema.release != NULL) {
+    chunked_array_view->schema.release(&chunked_array_view->schema);
+  }
+
+  memset(chunked_array_view, 0, sizeof(struct ArrowChunkedArrayView));
+}
+
+// Load n <= 64 bits starting at an arbitrary bit offset (such that bit j of the
+// result is bit offset + j of the bitmap) without reading past size_bytes
+static uint64_t ArrowArrayViewCompareLoadBits(const uint8_t* bits, int64_t size_bytes,
+                                              int64_t offset, int64_t n) {
+  uint64_t mask = n == 64 ? UINT64_MAX : (((uint64_t)1 << n) - 1);
+  if ((offset / 8 + 9) <= size_bytes) {
+    return _ArrowBitsLoadWord(bits, offset) & mask;
+  }
+
+  uint64_t word = 0;
+  for (int64_t j = 0; j < n; j++) {
+    word |= (uint64_t)ArrowBitGet(bits, offset + j) << j;
+  }
+
+  return word;
+}
+
+// The validity of rows i, ..., i + n - 1 (n <= 64) of array_view as a bitmask
+static uint64_t ArrowArrayViewCompareValidity(struct ArrowArrayView* array_view,
+                                              int64_t i, int64_t n) {
+  const uint8_t* bits = array_view->buffer_views[0].data.as_uint8;
+  if (array_view->layout.buffer_type[0] != NANOARROW_BUFFER_TYPE_VALIDITY ||
+      bits == NULL) {
+    return n == 64 ? UINT64_MAX : (((uint64_t)1 << n) - 1);
+  }
+
+  return ArrowArrayViewCompareLoadBits(bits, array_view->buffer_views[0].size_bytes,
+                                       array_view->offset + i, n);
+}
+
+static int64_t ArrowArrayViewFirstDifference(struct ArrowArrayView* lhs, int64_t lhs_i,
+                                             struct ArrowArrayView* rhs, int64_t rhs_i,
+                                             int64_t n, int options);
+
+// The index of the first of n elements of size_bytes bytes each that differ, or -1
+static int64_t ArrowArrayViewCompareFixedWidth(const uint8_t* lhs, const uint8_t* rhs,
+                                               int64_t size_bytes, int64_t n) {
+  // Compare blocks of elements with memcmp() and only look for the element that
+  // differs within a block that does
+  for (int64_t i = 0; i < n; i += 256) {
+    int64_t block_size = n - i < 256 ? n - i : 256;
+    if (memcmp(lhs + i * size_bytes, rhs + i * size_bytes,
+               (size_t)(block_size * size_bytes)) == 0) {
+      continue;
+    }
+
+    for (int64_t j = i; j < (i + block_size); j++) {
+      if (memcmp(lhs + j * size_bytes, rhs + j * size_bytes, (size_t)size_bytes) != 0) {
+        return j;
+      }
+    }
+  }
+
+  return -1;
+}
+
+static int64_t ArrowArrayViewCompareBits(const uint8_t* lhs, int64_t lhs_size_bytes,
+                                         int64_t lhs_offset, const uint8_t* rhs,
+                                         int64_t rhs_size_bytes, int64_t rhs_offset,
+                                         int64_t n) {
+  for (int64_t i = 0; i < n; i += 64) {
+    int64_t block_size = n - i < 64 ? n - i : 64;
+    uint64_t differ =
+        ArrowArrayViewCompareLoadBits(lhs, lhs_size_bytes, lhs_offset + i, block_size) ^
+        ArrowArrayViewCompareLoadBits(rhs, rhs_size_bytes, rhs_offset + i, block_size);
+    if (differ != 0) {
+      return i + _ArrowCountTrailingZerosUInt64(differ);
+    }
+  }
+
+  return -1;
+}
+
+// Numerically equal floating point values have identical bits except for zeroes
+// (0.0 == -0.0) and NaNs (which are all considered equal here)
+static int64_t ArrowArrayViewCompareFloats(struct ArrowArrayView* lhs, int64_t lhs_i,
+                                           struct ArrowArrayView* rhs, int64_t rhs_i,
+                                           int64_t n) {
+  const union ArrowBufferViewData lhs_data = lhs->buffer_views[1].data;
+  const union ArrowBufferViewData rhs_data = rhs->buffer_views[1].data;
+  lhs_i += lhs->offset;
+  rhs_i += rhs->offset;
+
+  for (int64_t j = 0; j < n; j++) {
+    int equal;
+    switch (lhs->storage_type) {
+      case NANOARROW_TYPE_HALF_FLOAT: {
+        uint16_t lhs_value = lhs_data.as_uint16[lhs_i + j];
+        uint16_t rhs_value = rhs_data.as_uint16[rhs_i + j];
+        int lhs_nan = (lhs_value & 0x7c00) == 0x7c00 && (lhs_value & 0x03ff) != 0;
+        int rhs_nan = (rhs_value & 0x7c00) == 0x7c00 && (rhs_value & 0x03ff) != 0;
+        equal = lhs_value == rhs_value || (lhs_nan && rhs_nan) ||
+                ((lhs_value & 0x7fff) == 0 && (rhs_value & 0x7fff) == 0);
+        break;
+      }
+      case NANOARROW_TYPE_FLOAT: {
+        float lhs_value = lhs_data.as_float[lhs_i + j];
+        float rhs_value = rhs_data.as_float[rhs_i + j];
+        equal = lhs_value == rhs_value ||
+                (lhs_value != lhs_value && rhs_value != rhs_value);
+        break;
+      }
+      default: {
+        double lhs_value = lhs_data.as_double[lhs_i + j];
+        double rhs_value = rhs_data.as_double[rhs_i + j];
+        equal = lhs_value == rhs_value ||
+                (lhs_value != lhs_value && rhs_value != rhs_value);
+        break;
+      }
+    }
+
+    if (!equal) {
+      return j;
+    }
+  }
+
+  return -1;
+}
+
+// Offset i of a string, binary, list, or map (including the array_view's offset)
+static inline int64_t ArrowArrayViewCompareOffset(struct ArrowArrayView* array_view,
+                                                  int64_t i) {
+  i += array_view->offset;
+  if (array_view->layout.element_size_bits[1] == 64) {
+    return array_view->buffer_views[1].data.as_int64[i];
+  } else {
+    return array_view->buffer_views[1].data.as_int32[i];
+  }
+}
+
+// The first of n rows whose size (from the offsets buffer) differs, or n
+static int64_t ArrowArrayViewCompareSizes(struct ArrowArrayView* lhs, int64_t lhs_i,
+                                          struct ArrowArrayView* rhs, int64_t rhs_i,
+                                          int64_t n) {
+  int64_t lhs_start = ArrowArrayViewCompareOffset(lhs, lhs_i);
+  int64_t rhs_start = ArrowArrayViewCompareOffset(rhs, rhs_i);
+  for (int64_t j = 1; j <= n; j++) {
+    if ((ArrowArrayViewCompareOffset(lhs, lhs_i + j) - lhs_start) !=
+        (ArrowArrayViewCompareOffset(rhs, rhs_i + j) - rhs_start)) {
+      return j - 1;
+    }
+  }
+
+  return n;
+}
+
+static int64_t ArrowArrayViewCompareBinary(struct ArrowArrayView* lhs, int64_t lhs_i,
+                                           struct ArrowArrayView* rhs, int64_t rhs_i,
+                                           int64_t n) {
+  // Rows before the first size difference occupy the same number of bytes such that
+  // they can be compared with a single memcmp()
+  int64_t n_same_size = ArrowArrayViewCompareSizes(lhs, lhs_i, rhs, rhs_i, n);
+  int64_t lhs_start = ArrowArrayViewCompareOffset(lhs, lhs_i);
+  int64_t rhs_start = ArrowArrayViewCompareOffset(rhs, rhs_i);
+  int64_t size_bytes = ArrowArrayViewCompareOffset(lhs, lhs_i + n_same_size) - lhs_start;
+  const uint8_t* lhs_data = lhs->buffer_views[2].data.as_uint8 + lhs_start;
+  const uint8_t* rhs_data = rhs->buffer_views[2].data.as_uint8 + rhs_start;
+
+  if (size_bytes > 0 && memcmp(lhs_data, rhs_data, (size_t)size_bytes) != 0) {
+    for (int64_t j = 0; j < n_same_size; j++) {
+      int64_t start = ArrowArrayViewCompareOffset(lhs, lhs_i + j) - lhs_start;
+      int64_t end = ArrowArrayViewCompareOffset(lhs, lhs_i + j + 1) - lhs_start;
+      if (memcmp(lhs_data + start, rhs_data + start, (size_t)(end - start)) != 0) {
+        return j;
+      }
+    }
+  }
+
+  return n_same_size < n ? n_same_size : -1;
+}
+
+static int64_t ArrowArrayViewCompareBinaryView(struct ArrowArrayView* lhs, int64_t lhs_i,
+                                               struct ArrowArrayView* rhs, int64_t rhs_i,
+                                               int64_t n) {
+  const union ArrowBinaryView* lhs_views =
+      lhs->buffer_views[1].data.as_binary_view + lhs->offset + lhs_i;
+  const union ArrowBinaryView* rhs_views =
+      rhs->buffer_views[1].data.as_binary_view + rhs->offset + rhs_i;
+
+  for (int64_t j = 0; j < n; j++) {
+    // Values with equal sizes that are inlined (or have an equal prefix) can often be
+    // compared without dereferencing a variadic buffer
+    if (lhs_views[j].inlined.size != rhs_views[j].inlined.size) {
+      return j;
+    }
+
+    if (lhs_views[j].inlined.size <= NANOARROW_BINARY_VIEW_INLINE_SIZE) {
+      if (memcmp(lhs_views + j, rhs_views + j, sizeof(union ArrowBinaryView)) != 0) {
+        return j;
+      }
+      continue;
+    }
+
+    if (memcmp(lhs_views[j].ref.prefix, rhs_views[j].ref.prefix,
+               sizeof(lhs_views[j].ref.prefix)) != 0) {
+      return j;
+    }
+
+    struct ArrowBufferView lhs_value = ArrowArrayViewGetBytesUnsafe(lhs, lhs_i + j);
+    struct ArrowBufferView rhs_value = ArrowArrayViewGetBytesUnsafe(rhs, rhs_i + j);
+    if (memcmp(lhs_value.data.data, rhs_value.data.data, (size_t)lhs_value.size_bytes) !=
+        0) {
+      return j;
+    }
+  }
+
+  return -1;
+}
+
+static int64_t ArrowArrayViewCompareList(struct ArrowArrayView* lhs, int64_t lhs_i,
+                                         struct ArrowArrayView* rhs, int64_t rhs_i,
+                                         int64_t n, int options) {
+  // Rows before the first size difference refer to child ranges of the same length
+  // that can be compared in one pass
+  int64_t n_same_size = ArrowArrayViewCompareSizes(lhs, lhs_i, rhs, rhs_i, n);
+  int64_t lhs_start = ArrowArrayViewCompareOffset(lhs, lhs_i);
+  int64_t rhs_start = ArrowArrayViewCompareOffset(rhs, rhs_i);
+  int64_t child_length =
+      ArrowArrayViewCompareOffset(lhs, lhs_i + n_same_size) - lhs_start;
+  int64_t child_difference = ArrowArrayViewFirstDifference(
+      lhs->children[0], lhs_start, rhs->children[0], rhs_start, child_length, options);
+
+  if (child_difference >= 0) {
+    // Find the row that contains the child element that differs
+    int64_t j = 0;
+    while ((ArrowArrayViewCompareOffset(lhs, lhs_i + j + 1) - lhs_start) <=
+           child_difference) {
+      j++;
+    }
+
+    return j;
+  }
+
+  return n_same_size < n ? n_same_size : -1;
+}
+
+static int64_t ArrowArrayViewCompareListView(struct ArrowArrayView* lhs, int64_t lhs_i,
+                                             struct ArrowArrayView* rhs, int64_t rhs_i,
+                                             int64_t n, int options) {
+  lhs_i += lhs->offset;
+  rhs_i += rhs->offset;
+  for (int64_t j = 0; j < n; j++) {
+    int64_t size = ArrowArrayViewListChildSize(lhs, lhs_i + j);
+    if (size != ArrowArrayViewListChildSize(rhs, rhs_i + j)) {
+      return j;
+    }
+
+    if (ArrowArrayViewFirstDifference(
+            lhs->children[0], ArrowArrayViewListChildOffset(lhs, lhs_i + j),
+            rhs->children[0], ArrowArrayViewListChildOffset(rhs, rhs_i + j), size,
+            options) >= 0) {
+      return j;
+    }
+  }
+
+  return -1;
+}
+
+static int64_t ArrowArrayViewCompareUnion(struct ArrowArrayView* lhs, int64_t lhs_i,
+                                          struct ArrowArrayView* rhs, int64_t rhs_i,
+                                          int64_t n, int options) {
+  lhs_i += lhs->offset;
+  rhs_i += rhs->offset;
+  for (int64_t j = 0; j < n; j++) {
+    int8_t child_index = ArrowArrayViewUnionChildIndex(lhs, lhs_i + j);
+    if (ArrowArrayViewUnionTypeId(lhs, lhs_i + j) !=
+            ArrowArrayViewUnionTypeId(rhs, rhs_i + j) ||
+        child_index != ArrowArrayViewUnionChildIndex(rhs, rhs_i + j)) {
+      return j;
+    }
+
+    if (ArrowArrayViewFirstDifference(
+            lhs->children[child_index], ArrowArrayViewUnionChildOffset(lhs, lhs_i + j),
+            rhs->children[child_index], ArrowArrayViewUnionChildOffset(rhs, rhs_i + j), 1,
+            options) >= 0) {
+      return j;
+    }
+  }
+
+  return -1;
+}
+
+static int64_t ArrowArrayViewCompareRunEnds(struct ArrowArrayView* lhs, int64_t lhs_i,
+                                            struct ArrowArrayView* rhs, int64_t rhs_i,
+                                            int64_t n, int options) {
+  // Compare one value for each (possibly partial) run that both arrays have in common
+  int64_t j = 0;
+  while (j < n) {
+    int64_t lhs_run = ArrowArrayViewRunEndPhysicalIndex(lhs, lhs_i + j);
+    int64_t rhs_run = ArrowArrayViewRunEndPhysicalIndex(rhs, rhs_i + j);
+    if (ArrowArrayViewFirstDifference(lhs->children[1], lhs_run, rhs->children[1],
+                                      rhs_run, 1, options) >= 0) {
+      return j;
+    }
+
+    int64_t lhs_remaining = ArrowArrayViewGetIntUnsafe(lhs->children[0], lhs_run) -
+                            (lhs->offset + lhs_i + j);
+    int64_t rhs_remaining = ArrowArrayViewGetIntUnsafe(rhs->children[0], rhs_run) -
+                            (rhs->offset + rhs_i + j);
+    j += lhs_remaining < rhs_remaining ? lhs_remaining : rhs_remaining;
+  }
+
+  return -1;
+}
+
+// The first of rows lhs_i, ..., lhs_i + n - 1 of lhs whose value (ignoring validity)
+// differs from rows rhs_i, ..., rhs_i + n - 1 of rhs, or -1
+static int64_t ArrowArrayViewCompareValues(struct ArrowArrayView* lhs, int64_t lhs_i,
+                                           struct ArrowArrayView* rhs, int64_t rhs_i,
+                                           int64_t n, int options) {
+  switch (lhs->storage_type) {
+    case NANOARROW_TYPE_NA:
+      return -1;
+    case NANOARROW_TYPE_BOOL:
+      return ArrowArrayViewCompareBits(
+          lhs->buffer_views[1].data.as_uint8, lhs->buffer_views[1].size_bytes,
+          lhs->offset + lhs_i, rhs->buffer_views[1].data.as_uint8,
+          rhs->buffer_views[1].size_bytes, rhs->offset + rhs_i, n);
+    case NANOARROW_TYPE_HALF_FLOAT:
+    case NANOARROW_TYPE_FLOAT:
+    case NANOARROW_TYPE_DOUBLE:
+      if (options & NANOARROW_ARRAY_COMPARE_FLOAT_VALUES) {
+        return ArrowArrayViewCompareFloats(lhs, lhs_i, rhs, rhs_i, n);
+      }
+      break;
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY:
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY:
+      return ArrowArrayViewCompareBinary(lhs, lhs_i, rhs, rhs_i, n);
+    case NANOARROW_TYPE_STRING_VIEW:
+    case NANOARROW_TYPE_BINARY_VIEW:
+      return ArrowArrayViewCompareBinaryView(lhs, lhs_i, rhs, rhs_i, n);
+    case NANOARROW_TYPE_LIST:
+    case NANOARROW_TYPE_LARGE_LIST:
+    case NANOARROW_TYPE_MAP:
+      return ArrowArrayViewCompareList(lhs, lhs_i, rhs, rhs_i, n, options);
+    case NANOARROW_TYPE_LIST_VIEW:
+    case NANOARROW_TYPE_LARGE_LIST_VIEW:
+      return ArrowArrayViewCompareListView(lhs, lhs_i, rhs, rhs_i, n, options);
+    case NANOARROW_TYPE_FIXED_SIZE_LIST: {
+      int64_t list_size = lhs->layout.child_size_elements;
+      int64_t child_difference = ArrowArrayViewFirstDifference(
+          lhs->children[0], (lhs->offset + lhs_i) * list_size, rhs->children[0],
+          (rhs->offset + rhs_i) * list_size, n * list_size, options);
+      return child_difference >= 0 ? child_difference / list_size : -1;
+    }
+    case NANOARROW_TYPE_STRUCT: {
+      // Only rows before a difference in a previous child need to be compared
+      int64_t difference = -1;
+      for (int64_t i = 0; i < lhs->n_children; i++) {
+        int64_t child_difference = ArrowArrayViewFirstDifference(
+            lhs->children[i], lhs->offset + lhs_i, rhs->children[i], rhs->offset + rhs_i,
+            difference >= 0 ? difference : n, options);
+        if (child_difference >= 0) {
+          difference = child_difference;
+        }
+      }
+      return difference;
+    }
+    case NANOARROW_TYPE_SPARSE_UNION:
+    case NANOARROW_TYPE_DENSE_UNION:
+      return ArrowArrayViewCompareUnion(lhs, lhs_i, rhs, rhs_i, n, options);
+    case NANOARROW_TYPE_RUN_END_ENCODED:
+      return ArrowArrayViewCompareRunEnds(lhs, lhs_i, rhs, rhs_i, n, options);
+    default:
+      break;
+  }
+
+  int64_t size_bytes = lhs->layout.element_size_bits[1] / 8;
+  return ArrowArrayViewCompareFixedWidth(
+      lhs->buffer_views[1].data.as_uint8 + (lhs->offset + lhs_i) * size_bytes,
+      rhs->buffer_views[1].data.as_uint8 + (rhs->offset + rhs_i) * size_bytes,
+      size_bytes, n);
+}
+
+// The first of rows lhs_i, ..., lhs_i + n - 1 of lhs that differs from rows
+// rhs_i, ..., rhs_i + n - 1 of rhs (i.e., is null in only one of them or is non-null
+// in both with a different value), or -1. Rows are relative to the offset of each
+// ArrowArrayView.
+static int64_t ArrowArrayViewFirstDifference(struct ArrowArrayView* lhs, int64_t lhs_i,
+                                             struct ArrowArrayView* rhs, int64_t rhs_i,
+                                             int64_t n, int options) {
+  if (n == 0) {
+    return -1;
+  }
+
+  if ((lhs->layout.buffer_type[0] != NANOARROW_BUFFER_TYPE_VALIDITY ||
+       lhs->buffer_views[0].data.data == NULL) &&
+      (rhs->layout.buffer_type[0] != NANOARROW_BUFFER_TYPE_VALIDITY ||
+       rhs->buffer_views[0].data.data == NULL)) {
+    return ArrowArrayViewCompareValues(lhs, lhs_i, rhs, rhs_i, n, options);
+  }
+
+  for (int64_t i = 0; i < n; i += 64) {
+    int64_t block_size = n - i < 64 ? n - i : 64;
+    uint64_t lhs_valid = ArrowArrayViewCompareValidity(lhs, lhs_i + i, block_size);
+    uint64_t rhs_valid = ArrowArrayViewCompareValidity(rhs, rhs_i + i, block_size);
+    uint64_t valid = lhs_valid & rhs_valid;
+    int64_t first_difference = block_size;
+    if (lhs_valid != rhs_valid) {
+      first_difference = _ArrowCountTrailingZerosUInt64(lhs_valid ^ rhs_valid);
+    }
+
+    // Compare the values of each run of rows that are valid in both before the first
+    // difference in validity
+    int64_t j = 0;
+    while (j < first_difference && (valid >> j) != 0) {
+      j += _ArrowCountTrailingZerosUInt64(valid >> j);
+      if (j >= first_difference) {
+        break;
+      }
+
+      uint64_t invalid = ~(valid >> j);
+      int64_t run_length = invalid == 0 ? 64 : _ArrowCountTrailingZerosUInt64(invalid);
+      if (run_length > (first_difference - j)) {
+        run_length = first_difference - j;
+      }
+
+      int64_t difference = ArrowArrayViewCompareValues(
+          lhs, lhs_i + i + j, rhs, rhs_i + i + j, run_length, options);
+      if (difference >= 0) {
+        return i + j + difference;
+      }
+
+      j += run_length;
+      if (j >= 64) {
+        break;
+      }
+    }
+
+    if (first_difference < block_size) {
+      return i + first_difference;
+    }
+  }
+
+  return -1;
+}
+
+// Check that lhs and rhs have the same layout (recursively) and equal dictionaries
+static int ArrowArrayViewCompareLayout(struct ArrowArrayView* lhs,
+                                       struct ArrowArrayView* rhs, int options) {
+  if (lhs->storage_type != rhs->storage_type || lhs->n_children != rhs->n_children ||
+      lhs->layout.element_size_bits[1] != rhs->layout.element_size_bits[1] ||
+      lhs->layout.child_size_elements != rhs->layout.child_size_elements) {
+    return 0;
+  }
+
+  for (int64_t i = 0; i < lhs->n_children; i++) {
+    if (!ArrowArrayViewCompareLayout(lhs->children[i], rhs->children[i], options)) {
+      return 0;
+    }
+  }
 
-        last_offset = array_view->buffer_views[1].data.as_int64[offset_plus_length];
-        if (array_view->children[0]->length < last_offset) {
-          ArrowErrorSet(
-              error,
-              "Expected child of large list array to have length >= %ld but found array "
-              "with length %ld",
-              (long)last_offset, (long)array_view->children[0]->length);
-          return EINVAL;
-        }
+  if (lhs->dictionary == NULL || rhs->dictionary == NULL) {
+    return lhs->dictionary == rhs->dictionary;
+  }
+
+  return ArrowArrayViewCompareLayout(lhs->dictionary, rhs->dictionary, options) &&
+         lhs->dictionary->length == rhs->dictionary->length &&
+         ArrowArrayViewFirstDifference(lhs->dictionary, 0, rhs->dictionary, 0,
+                                       lhs->dictionary->length, options) < 0;
+}
+
+int ArrowArrayViewEquals(struct ArrowArrayView* lhs, struct ArrowArrayView* rhs,
+                         int options, int64_t* first_difference) {
+  int64_t difference;
+  if (!ArrowArrayViewCompareLayout(lhs, rhs, options)) {
+    difference = -1;
+  } else {
+    int64_t length = lhs->length < rhs->length ? lhs->length : rhs->length;
+    difference = ArrowArrayViewFirstDifference(lhs, 0, rhs, 0, length, options);
+    if (difference < 0 && lhs->length == rhs->length) {
+      return 1;
+    } else if (difference < 0) {
+      difference = length;
+    }
+  }
+
+  if (first_difference != NULL) {
+    *first_difference = difference;
+  }
+
+  return 0;
+}
+
+// The bytes of the ith value of dictionary (a string, binary, or fixed-width array
+// without nulls)
+static struct ArrowBufferView ArrowDictionaryBuilderValue(struct ArrowArray* dictionary,
+                                                         int64_t i) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)dictionary->private_data;
+  struct ArrowBufferView out;
+
+  switch (private_data->layout.buffer_type[1]) {
+    case NANOARROW_BUFFER_TYPE_DATA_OFFSET: {
+      const uint8_t* offsets = _ArrowArrayBuffer(dictionary, 1)->data;
+      int64_t start;
+      int64_t end;
+      if (private_data->layout.element_size_bits[1] == 32) {
+        start = ((const int32_t*)offsets)[i];
+        end = ((const int32_t*)offsets)[i + 1];
+      } else {
+        start = ((const int64_t*)offsets)[i];
+        end = ((const int64_t*)offsets)[i + 1];
       }
+
+      out.data.as_uint8 = _ArrowArrayBuffer(dictionary, 2)->data + start;
+      out.size_bytes = end - start;
       break;
+    }
     default:
+      out.size_bytes = private_data->layout.element_size_bits[1] / 8;
+      out.data.as_uint8 = _ArrowArrayBuffer(dictionary, 1)->data + i * out.size_bytes;
       break;
   }
 
-  // Recurse for children
-  for (int64_t i = 0; i < array_view->n_children; i++) {
-    NANOARROW_RETURN_NOT_OK(
-        ArrowArrayViewValidateDefault(array_view->children[i], error));
+  return out;
+}
+
+// Remove the last value of dictionary (which was appended without nulls)
+static void ArrowDictionaryBuilderRemoveLast(struct ArrowArray* dictionary,
+                                             struct ArrowBufferView value) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)dictionary->private_data;
+
+  if (private_data->layout.buffer_type[1] == NANOARROW_BUFFER_TYPE_DATA_OFFSET) {
+    _ArrowArrayBuffer(dictionary, 1)->size_bytes -=
+        private_data->layout.element_size_bits[1] / 8;
+    _ArrowArrayBuffer(dictionary, 2)->size_bytes -= value.size_bytes;
+  } else {
+    _ArrowArrayBuffer(dictionary, 1)->size_bytes -= value.size_bytes;
   }
 
-  // Recurse for dictionary
-  if (array_view->dictionary != NULL) {
-    NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateDefault(array_view->dictionary, error));
+  if (private_data->bitmap.buffer.data != NULL) {
+    private_data->bitmap.size_bits--;
+    private_data->bitmap.buffer.size_bytes =
+        _ArrowBytesForBits(private_data->bitmap.size_bits);
   }
 
-  return NANOARROW_OK;
+  dictionary->length--;
 }
 
-ArrowErrorCode ArrowArrayViewSetArray(struct ArrowArrayView* array_view,
-                                      struct ArrowArray* array,
-                                      struct ArrowError* error) {
-  // Extract information from the array into the array view
-  NANOARROW_RETURN_NOT_OK(ArrowArrayViewSetArrayInternal(array_view, array, error));
-
-  // Run default validation. Because we've marked all non-NULL buffers as having unknown
-  // size, validation will also update the buffer sizes as it goes.
-  NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateDefault(array_view, error));
+static void ArrowDictionaryBuilderInsert(struct ArrowDictionaryBuilder* builder,
+                                         uint64_t hash, int64_t dictionary_index) {
+  int32_t* slots = (int32_t*)builder->slots.data;
+  int64_t mask = builder->n_slots - 1;
+  int64_t slot = (int64_t)(hash & (uint64_t)mask);
+  while (slots[slot] != 0) {
+    slot = (slot + 1) & mask;
+  }
 
-  return NANOARROW_OK;
+  slots[slot] = (int32_t)(dictionary_index + 1);
 }
 
-ArrowErrorCode ArrowArrayViewSetArrayMinimal(struct ArrowArrayView* array_view,
-                                             struct ArrowArray* array,
-                                             struct ArrowError* error) {
-  // Extract information from the array into the array view
-  NANOARROW_RETURN_NOT_OK(ArrowArrayViewSetArrayInternal(array_view, array, error));
+// Grow the hash table such that it can hold n_values while remaining at most
+// half full
+static ArrowErrorCode ArrowDictionaryBuilderReserve(
+    struct ArrowDictionaryBuilder* builder, int64_t n_values) {
+  if ((n_values * 2) <= builder->n_slots) {
+    return NANOARROW_OK;
+  }
 
-  // Run default validation. Because we've marked all non-NULL buffers as having unknown
-  // size, validation will also update the buffer sizes as it goes.
-  NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateMinimal(array_view, error));
+  int64_t n_slots = builder->n_slots == 0 ? 64 : builder->n_slots;
+  while ((n_values * 2) > n_slots) {
+    n_slots *= 2;
+  }
+
+  ArrowBufferReset(&builder->slots);
+  NANOARROW_RETURN_NOT_OK(
+      ArrowBufferAppendFill(&builder->slots, 0, n_slots * (int64_t)sizeof(int32_t)));
+  builder->n_slots = n_slots;
+
+  const uint64_t* hashes = (const uint64_t*)builder->hashes.data;
+  int64_t n_hashes = builder->hashes.size_bytes / (int64_t)sizeof(uint64_t);
+  for (int64_t i = 0; i < n_hashes; i++) {
+    ArrowDictionaryBuilderInsert(builder, hashes[i], i);
+  }
 
   return NANOARROW_OK;
 }
 
-static int ArrowAssertIncreasingInt32(struct ArrowBufferView view,
-                                      struct ArrowError* error) {
-  if (view.size_bytes <= (int64_t)sizeof(int32_t)) {
-    return NANOARROW_OK;
+// Rewrite the indices of array using the next widest index type
+static ArrowErrorCode ArrowDictionaryBuilderWidenIndices(
+    struct ArrowDictionaryBuilder* builder) {
+  struct ArrowArray* array = builder->array;
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  struct ArrowBuffer* indices = _ArrowArrayBuffer(array, 1);
+
+  enum ArrowType index_type;
+  switch (builder->index_type) {
+    case NANOARROW_TYPE_INT8:
+      index_type = NANOARROW_TYPE_INT16;
+      break;
+    case NANOARROW_TYPE_INT16:
+      index_type = NANOARROW_TYPE_INT32;
+      break;
+    default:
+      return EOVERFLOW;
   }
 
-  for (int64_t i = 1; i < view.size_bytes / (int64_t)sizeof(int32_t); i++) {
-    if (view.data.as_int32[i] < view.data.as_int32[i - 1]) {
-      ArrowErrorSet(error, "[%ld] Expected element size >= 0", (long)i);
-      return EINVAL;
+  struct ArrowBuffer widened;
+  ArrowBufferInit(&widened);
+  NANOARROW_RETURN_NOT_OK(ArrowBufferSetAllocator(&widened, indices->allocator));
+  ArrowBufferSetGrowthPolicy(&widened, indices->growth_policy);
+
+  int64_t index_size_bytes = index_type == NANOARROW_TYPE_INT16 ? 2 : 4;
+  int result = ArrowBufferReserve(&widened, array->length * index_size_bytes);
+  if (result != NANOARROW_OK) {
+    ArrowBufferReset(&widened);
+    return result;
+  }
+
+  if (index_type == NANOARROW_TYPE_INT16) {
+    int16_t* out = (int16_t*)widened.data;
+    for (int64_t i = 0; i < array->length; i++) {
+      out[i] = ((const int8_t*)indices->data)[i];
+    }
+  } else {
+    int32_t* out = (int32_t*)widened.data;
+    for (int64_t i = 0; i < array->length; i++) {
+      out[i] = ((const int16_t*)indices->data)[i];
     }
   }
+  widened.size_bytes = array->length * index_size_bytes;
 
+  ArrowBufferReset(indices);
+  ArrowBufferMove(&widened, indices);
+  private_data->storage_type = index_type;
+  ArrowLayoutInit(&private_data->layout, index_type);
+  builder->index_type = index_type;
   return NANOARROW_OK;
 }
 
-static int ArrowAssertIncreasingInt64(struct ArrowBufferView view,
-                                      struct ArrowError* error) {
-  if (view.size_bytes <= (int64_t)sizeof(int64_t)) {
-    return NANOARROW_OK;
+// Look up the value that was just appended to the dictionary, removing it again if
+// it was already present, and set *index_out to its index
+static ArrowErrorCode ArrowDictionaryBuilderInsertLast(
+    struct ArrowDictionaryBuilder* builder, int64_t* index_out) {
+  struct ArrowArray* dictionary = builder->array->dictionary;
+  int64_t dictionary_index = dictionary->length - 1;
+  struct ArrowBufferView value =
+      ArrowDictionaryBuilderValue(dictionary, dictionary_index);
+  uint64_t hash = _ArrowHashBytes(0, value.data.as_uint8, value.size_bytes);
+
+  const int32_t* slots = (const int32_t*)builder->slots.data;
+  const uint64_t* hashes = (const uint64_t*)builder->hashes.data;
+  int64_t mask = builder->n_slots - 1;
+  for (int64_t slot = (int64_t)(hash & (uint64_t)mask);
+       builder->n_slots > 0 && slots[slot] != 0; slot = (slot + 1) & mask) {
+    int64_t existing_index = slots[slot] - 1;
+    if (hashes[existing_index] != hash) {
+      continue;
+    }
+
+    struct ArrowBufferView existing =
+        ArrowDictionaryBuilderValue(dictionary, existing_index);
+    if (existing.size_bytes == value.size_bytes &&
+        memcmp(existing.data.data, value.data.data, (size_t)value.size_bytes) == 0) {
+      ArrowDictionaryBuilderRemoveLast(dictionary, value);
+      *index_out = existing_index;
+      return NANOARROW_OK;
+    }
   }
 
-  for (int64_t i = 1; i < view.size_bytes / (int64_t)sizeof(int64_t); i++) {
-    if (view.data.as_int64[i] < view.data.as_int64[i - 1]) {
-      ArrowErrorSet(error, "[%ld] Expected element size >= 0", (long)i);
-      return EINVAL;
+  // A new value: make sure its index can be represented before adding it
+  int64_t max_index = INT32_MAX - 1;
+  switch (builder->index_type) {
+    case NANOARROW_TYPE_INT8:
+      max_index = INT8_MAX;
+      break;
+    case NANOARROW_TYPE_INT16:
+      max_index = INT16_MAX;
+      break;
+    default:
+      break;
+  }
+
+  if (dictionary_index > max_index) {
+    int result = ArrowDictionaryBuilderWidenIndices(builder);
+    if (result != NANOARROW_OK) {
+      ArrowDictionaryBuilderRemoveLast(dictionary, value);
+      return result;
     }
   }
 
+  int result = ArrowDictionaryBuilderReserve(builder, dictionary->length);
+  if (result == NANOARROW_OK) {
+    result = ArrowBufferAppend(&builder->hashes, &hash, sizeof(uint64_t));
+  }
+
+  if (result != NANOARROW_OK) {
+    ArrowDictionaryBuilderRemoveLast(dictionary, value);
+    return result;
+  }
+
+  ArrowDictionaryBuilderInsert(builder, hash, dictionary_index);
+  *index_out = dictionary_index;
   return NANOARROW_OK;
 }
 
-static int ArrowAssertRangeInt8(struct ArrowBufferView view, int8_t min_value,
-                                int8_t max_value, struct ArrowError* error) {
-  for (int64_t i = 0; i < view.size_bytes; i++) {
-    if (view.data.as_int8[i] < min_value || view.data.as_int8[i] > max_value) {
-      ArrowErrorSet(error,
-                    "[%ld] Expected buffer value between %d and %d but found value %d",
-                    (long)i, (int)min_value, (int)max_value, (int)view.data.as_int8[i]);
+// Look up the value that was just appended to the dictionary and append its index
+// to the array
+static ArrowErrorCode ArrowDictionaryBuilderAppendLast(
+    struct ArrowDictionaryBuilder* builder) {
+  int64_t dictionary_index;
+  NANOARROW_RETURN_NOT_OK(ArrowDictionaryBuilderInsertLast(builder, &dictionary_index));
+  return ArrowArrayAppendInt(builder->array, dictionary_index);
+}
+
+ArrowErrorCode ArrowDictionaryBuilderInit(struct ArrowDictionaryBuilder* builder,
+                                          struct ArrowArray* array) {
+  if (array->release != &ArrowArrayRelease || array->dictionary == NULL ||
+      array->dictionary->release != &ArrowArrayRelease) {
+    return EINVAL;
+  }
+
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  struct ArrowArrayPrivateData* dictionary_private =
+      (struct ArrowArrayPrivateData*)array->dictionary->private_data;
+
+  switch (private_data->storage_type) {
+    case NANOARROW_TYPE_INT8:
+    case NANOARROW_TYPE_INT16:
+    case NANOARROW_TYPE_INT32:
+    case NANOARROW_TYPE_INT64:
+      break;
+    default:
+      return EINVAL;
+  }
+
+  switch (dictionary_private->layout.buffer_type[1]) {
+    case NANOARROW_BUFFER_TYPE_DATA_OFFSET:
+      if (array->dictionary->n_children != 0) {
+        return EINVAL;
+      }
+      break;
+    case NANOARROW_BUFFER_TYPE_DATA:
+      // The bytes of a binary or string view are not the value it represents
+      if (dictionary_private->layout.element_size_bits[1] == 0 ||
+          (dictionary_private->layout.element_size_bits[1] % 8) != 0 ||
+          dictionary_private->storage_type == NANOARROW_TYPE_BINARY_VIEW ||
+          dictionary_private->storage_type == NANOARROW_TYPE_STRING_VIEW) {
+        return EINVAL;
+      }
+      break;
+    default:
       return EINVAL;
+  }
+
+  if (array->dictionary->null_count != 0) {
+    return EINVAL;
+  }
+
+  builder->array = array;
+  builder->index_type = private_data->storage_type;
+  builder->n_slots = 0;
+  ArrowBufferInit(&builder->slots);
+  ArrowBufferInit(&builder->hashes);
+
+  // Add any values already present in the dictionary
+  int64_t n_values = array->dictionary->length;
+  int result = ArrowDictionaryBuilderReserve(builder, n_values);
+  for (int64_t i = 0; i < n_values && result == NANOARROW_OK; i++) {
+    struct ArrowBufferView value = ArrowDictionaryBuilderValue(array->dictionary, i);
+    uint64_t hash = _ArrowHashBytes(0, value.data.as_uint8, value.size_bytes);
+    result = ArrowBufferAppend(&builder->hashes, &hash, sizeof(uint64_t));
+    if (result == NANOARROW_OK) {
+      ArrowDictionaryBuilderInsert(builder, hash, i);
     }
   }
 
+  if (result != NANOARROW_OK) {
+    ArrowDictionaryBuilderReset(builder);
+    return result;
+  }
+
   return NANOARROW_OK;
 }
 
-static int ArrowAssertInt8In(struct ArrowBufferView view, const int8_t* values,
-                             int64_t n_values, struct ArrowError* error) {
-  for (int64_t i = 0; i < view.size_bytes; i++) {
-    int item_found = 0;
-    for (int64_t j = 0; j < n_values; j++) {
-      if (view.data.as_int8[i] == values[j]) {
-        item_found = 1;
-        break;
-      }
+ArrowErrorCode ArrowDictionaryBuilderAppendInt(struct ArrowDictionaryBuilder* builder,
+                                               int64_t value) {
+  NANOARROW_RETURN_NOT_OK(ArrowArrayAppendInt(builder->array->dictionary, value));
+  return ArrowDictionaryBuilderAppendLast(builder);
+}
+
+ArrowErrorCode ArrowDictionaryBuilderAppendUInt(struct ArrowDictionaryBuilder* builder,
+                                                uint64_t value) {
+  NANOARROW_RETURN_NOT_OK(ArrowArrayAppendUInt(builder->array->dictionary, value));
+  return ArrowDictionaryBuilderAppendLast(builder);
+}
+
+ArrowErrorCode ArrowDictionaryBuilderAppendDouble(struct ArrowDictionaryBuilder* builder,
+                                                  double value) {
+  NANOARROW_RETURN_NOT_OK(ArrowArrayAppendDouble(builder->array->dictionary, value));
+  return ArrowDictionaryBuilderAppendLast(builder);
+}
+
+ArrowErrorCode ArrowDictionaryBuilderAppendBytes(struct ArrowDictionaryBuilder* builder,
+                                                 struct ArrowBufferView value) {
+  NANOARROW_RETURN_NOT_OK(ArrowArrayAppendBytes(builder->array->dictionary, value));
+  return ArrowDictionaryBuilderAppendLast(builder);
+}
+
+ArrowErrorCode ArrowDictionaryBuilderAppendString(struct ArrowDictionaryBuilder* builder,
+                                                  struct ArrowStringView value) {
+  NANOARROW_RETURN_NOT_OK(ArrowArrayAppendString(builder->array->dictionary, value));
+  return ArrowDictionaryBuilderAppendLast(builder);
+}
+
+ArrowErrorCode ArrowDictionaryBuilderAppendNull(struct ArrowDictionaryBuilder* builder,
+                                                int64_t n) {
+  return ArrowArrayAppendNull(builder->array, n);
+}
+
+// Add the values of dictionary_view referred to by the non-null elements of
+// array_view to the dictionary being built (once each), recording their index in
+// the unified dictionary in mapping (or -1 for null values)
+static ArrowErrorCode ArrowDictionaryBuilderUnify(struct ArrowDictionaryBuilder* builder,
+                                                  struct ArrowArrayView* array_view,
+                                                  int64_t* mapping) {
+  struct ArrowArrayView* dictionary_view = array_view->dictionary;
+  for (int64_t i = 0; i < array_view->length; i++) {
+    if (ArrowArrayViewIsNull(array_view, i)) {
+      continue;
     }
 
-    if (!item_found) {
-      ArrowErrorSet(error, "[%ld] Unexpected buffer value %d", (long)i,
-                    (int)view.data.as_int8[i]);
+    int64_t index = ArrowArrayViewGetIntUnsafe(array_view, i);
+    if (index < 0 || index >= dictionary_view->length) {
       return EINVAL;
     }
+
+    if (mapping[index] != -2) {
+      continue;
+    }
+
+    if (ArrowArrayViewIsNull(dictionary_view, index)) {
+      mapping[index] = -1;
+      continue;
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowArrayAppendArrayView(builder->array->dictionary,
+                                                      dictionary_view, index, 1));
+    NANOARROW_RETURN_NOT_OK(ArrowDictionaryBuilderInsertLast(builder, mapping + index));
   }
 
   return NANOARROW_OK;
 }
 
-static int ArrowArrayViewValidateFull(struct ArrowArrayView* array_view,
-                                      struct ArrowError* error) {
-  for (int i = 0; i < 3; i++) {
-    switch (array_view->layout.buffer_type[i]) {
-      case NANOARROW_BUFFER_TYPE_DATA_OFFSET:
-        if (array_view->layout.element_size_bits[i] == 32) {
-          NANOARROW_RETURN_NOT_OK(
-              ArrowAssertIncreasingInt32(array_view->buffer_views[i], error));
-        } else {
-          NANOARROW_RETURN_NOT_OK(
-              ArrowAssertIncreasingInt64(array_view->buffer_views[i], error));
-        }
-        break;
-      default:
-        break;
-    }
+ArrowErrorCode ArrowDictionaryBuilderAppendArrayView(
+    struct ArrowDictionaryBuilder* builder, struct ArrowArrayView* array_view) {
+  struct ArrowArrayView* dictionary_view = array_view->dictionary;
+  if (dictionary_view == NULL ||
+      !ArrowArrayMatchesArrayView(builder->array->dictionary, dictionary_view)) {
+    return EINVAL;
   }
 
-  if (array_view->storage_type == NANOARROW_TYPE_DENSE_UNION ||
-      array_view->storage_type == NANOARROW_TYPE_SPARSE_UNION) {
-    if (array_view->union_type_id_map == NULL) {
-      // If the union_type_id map is NULL (e.g., when using ArrowArrayInitFromType() +
-      // ArrowArrayAllocateChildren() + ArrowArrayFinishBuilding()), we don't have enough
-      // information to validate this buffer.
-      ArrowErrorSet(error,
-                    "Insufficient information provided for validation of union array");
-      return EINVAL;
-    } else if (_ArrowParsedUnionTypeIdsWillEqualChildIndices(
-                   array_view->union_type_id_map, array_view->n_children,
-                   array_view->n_children)) {
-      NANOARROW_RETURN_NOT_OK(ArrowAssertRangeInt8(
-          array_view->buffer_views[0], 0, (int8_t)(array_view->n_children - 1), error));
-    } else {
-      NANOARROW_RETURN_NOT_OK(ArrowAssertInt8In(array_view->buffer_views[0],
-                                                array_view->union_type_id_map + 128,
-                                                array_view->n_children, error));
-    }
+  if (array_view->length == 0) {
+    return NANOARROW_OK;
   }
 
-  if (array_view->storage_type == NANOARROW_TYPE_DENSE_UNION &&
-      array_view->union_type_id_map != NULL) {
-    // Check that offsets refer to child elements that actually exist
-    for (int64_t i = 0; i < array_view->length; i++) {
-      int8_t child_id = ArrowArrayViewUnionChildIndex(array_view, i);
-      int64_t offset = ArrowArrayViewUnionChildOffset(array_view, i);
-      int64_t child_length = array_view->children[child_id]->length;
-      if (offset < 0 || offset > child_length) {
-        ArrowErrorSet(
-            error,
-            "[%ld] Expected union offset for child id %d to be between 0 and %ld but "
-            "found offset value %ld",
-            (long)i, (int)child_id, (long)child_length, offset);
-        return EINVAL;
-      }
-    }
+  // -2 marks dictionary values that have not been looked up yet
+  int64_t* mapping = (int64_t*)ArrowMalloc(
+      (dictionary_view->length > 0 ? dictionary_view->length : 1) * sizeof(int64_t));
+  if (mapping == NULL) {
+    return ENOMEM;
   }
 
-  // Recurse for children
-  for (int64_t i = 0; i < array_view->n_children; i++) {
-    NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateFull(array_view->children[i], error));
+  for (int64_t i = 0; i < dictionary_view->length; i++) {
+    mapping[i] = -2;
   }
 
-  // Dictionary valiation not implemented
-  if (array_view->dictionary != NULL) {
-    ArrowErrorSet(error, "Validation for dictionary-encoded arrays is not implemented");
-    return ENOTSUP;
+  // Unify before appending any indices such that the index type is only widened
+  // once per batch
+  int result = ArrowDictionaryBuilderUnify(builder, array_view, mapping);
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayReserve(builder->array, array_view->length);
   }
 
-  return NANOARROW_OK;
-}
+  for (int64_t i = 0; i < array_view->length && result == NANOARROW_OK; i++) {
+    int64_t index = -1;
+    if (!ArrowArrayViewIsNull(array_view, i)) {
+      index = mapping[ArrowArrayViewGetIntUnsafe(array_view, i)];
+    }
 
-ArrowErrorCode ArrowArrayViewValidate(struct ArrowArrayView* array_view,
-                                      enum ArrowValidationLevel validation_level,
-                                      struct ArrowError* error) {
-  switch (validation_level) {
-    case NANOARROW_VALIDATION_LEVEL_NONE:
-      return NANOARROW_OK;
-    case NANOARROW_VALIDATION_LEVEL_MINIMAL:
-      return ArrowArrayViewValidateMinimal(array_view, error);
-    case NANOARROW_VALIDATION_LEVEL_DEFAULT:
-      return ArrowArrayViewValidateDefault(array_view, error);
-    case NANOARROW_VALIDATION_LEVEL_FULL:
-      NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidateDefault(array_view, error));
-      return ArrowArrayViewValidateFull(array_view, error);
+    if (index < 0) {
+      result = ArrowArrayAppendNull(builder->array, 1);
+    } else {
+      result = ArrowArrayAppendInt(builder->array, index);
+    }
   }
 
-  ArrowErrorSet(error, "validation_level not recognized");
-  return EINVAL;
+  ArrowFree(mapping);
+  return result;
+}
+
+void ArrowDictionaryBuilderReset(struct ArrowDictionaryBuilder* builder) {
+  ArrowBufferReset(&builder->slots);
+  ArrowBufferReset(&builder->hashes);
+  builder->n_slots = 0;
 }
@@ -31,13 +31,14 @@
 extern "C" {
 #endif
 
-static inline struct ArrowBitmap* ArrowArrayValidityBitmap(struct ArrowArray* array) {
+// Access to buffers that does not mark the array as having been modified directly
+static inline struct ArrowBitmap* _ArrowArrayValidityBitmap(struct ArrowArray* array) {
   struct ArrowArrayPrivateData* private_data =
       (struct ArrowArrayPrivateData*)array->private_data;
   return &private_data->bitmap;
 }
 
-static inline struct ArrowBuffer* ArrowArrayBuffer(struct ArrowArray* array, int64_t i) {
+static inline struct ArrowBuffer* _ArrowArrayBuffer(struct ArrowArray* array, int64_t i) {
   struct ArrowArrayPrivateData* private_data =
       (struct ArrowArrayPrivateData*)array->private_data;
   switch (i) {
@@ -48,6 +49,20 @@ static inline struct ArrowBuffer* ArrowArrayBuffer(struct ArrowArray* array, int
   }
 }
 
+static inline struct ArrowBitmap* ArrowArrayValidityBitmap(struct ArrowArray* array) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  private_data->built_by_append = 0;
+  return &private_data->bitmap;
+}
+
+static inline struct ArrowBuffer* ArrowArrayBuffer(struct ArrowArray* array, int64_t i) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  private_data->built_by_append = 0;
+  return _ArrowArrayBuffer(array, i);
+}
+
 // We don't currently support the case of unions where type_id != child_index;
 // however, these functions are used to keep track of where that assumption
 // is made.
@@ -143,10 +158,10 @@ static inline ArrowErrorCode ArrowArrayStartAppending(struct ArrowArray* array)
   for (int i = 0; i < 3; i++) {
     if (private_data->layout.buffer_type[i] == NANOARROW_BUFFER_TYPE_DATA_OFFSET &&
         private_data->layout.element_size_bits[i] == 64) {
-      NANOARROW_RETURN_NOT_OK(ArrowBufferAppendInt64(ArrowArrayBuffer(array, i), 0));
+      NANOARROW_RETURN_NOT_OK(ArrowBufferAppendInt64(_ArrowArrayBuffer(array, i), 0));
     } else if (private_data->layout.buffer_type[i] == NANOARROW_BUFFER_TYPE_DATA_OFFSET &&
                private_data->layout.element_size_bits[i] == 32) {
-      NANOARROW_RETURN_NOT_OK(ArrowBufferAppendInt32(ArrowArrayBuffer(array, i), 0));
+      NANOARROW_RETURN_NOT_OK(ArrowBufferAppendInt32(_ArrowArrayBuffer(array, i), 0));
     }
   }
 
@@ -162,29 +177,12 @@ static inline ArrowErrorCode ArrowArrayStartAppending(struct ArrowArray* array)
   return NANOARROW_OK;
 }
 
-static inline ArrowErrorCode ArrowArrayShrinkToFit(struct ArrowArray* array) {
-  for (int64_t i = 0; i < 3; i++) {
-    struct ArrowBuffer* buffer = ArrowArrayBuffer(array, i);
-    NANOARROW_RETURN_NOT_OK(ArrowBufferResize(buffer, buffer->size_bytes, 1));
-  }
-
-  for (int64_t i = 0; i < array->n_children; i++) {
-    NANOARROW_RETURN_NOT_OK(ArrowArrayShrinkToFit(array->children[i]));
-  }
-
-  if (array->dictionary != NULL) {
-    NANOARROW_RETURN_NOT_OK(ArrowArrayShrinkToFit(array->dictionary));
-  }
-
-  return NANOARROW_OK;
-}
-
 static inline ArrowErrorCode _ArrowArrayAppendBits(struct ArrowArray* array,
                                                    int64_t buffer_i, uint8_t value,
                                                    int64_t n) {
   struct ArrowArrayPrivateData* private_data =
       (struct ArrowArrayPrivateData*)array->private_data;
-  struct ArrowBuffer* buffer = ArrowArrayBuffer(array, buffer_i);
+  struct ArrowBuffer* buffer = _ArrowArrayBuffer(array, buffer_i);
   int64_t bytes_required =
       _ArrowRoundUpToMultipleOf8(private_data->layout.element_size_bits[buffer_i] *
                                  (array->length + 1)) /
@@ -221,10 +219,10 @@ static inline ArrowErrorCode _ArrowArrayAppendEmptyInternal(struct ArrowArray* a
       NANOARROW_RETURN_NOT_OK(
           _ArrowArrayAppendEmptyInternal(array->children[0], 1, is_valid));
       NANOARROW_RETURN_NOT_OK(
-          ArrowBufferAppendFill(ArrowArrayBuffer(array, 0), type_id, n));
+          ArrowBufferAppendFill(_ArrowArrayBuffer(array, 0), type_id, n));
       for (int64_t i = 0; i < n; i++) {
         NANOARROW_RETURN_NOT_OK(ArrowBufferAppendInt32(
-            ArrowArrayBuffer(array, 1), (int32_t)array->children[0]->length - 1));
+            _ArrowArrayBuffer(array, 1), (int32_t)array->children[0]->length - 1));
       }
       // For the purposes of array->null_count, union elements are never considered "null"
       // even if some children contain nulls.
@@ -242,17 +240,31 @@ static inline ArrowErrorCode _ArrowArrayAppendEmptyInternal(struct ArrowArray* a
       }
 
       NANOARROW_RETURN_NOT_OK(
-          ArrowBufferAppendFill(ArrowArrayBuffer(array, 0), type_id, n));
+          ArrowBufferAppendFill(_ArrowArrayBuffer(array, 0), type_id, n));
       // For the purposes of array->null_count, union elements are never considered "null"
       // even if some children contain nulls.
       array->length += n;
       return NANOARROW_OK;
     }
 
+    case NANOARROW_TYPE_RUN_END_ENCODED:
+      // Add one empty or null value and a single run covering all n elements
+      NANOARROW_RETURN_NOT_OK(
+          _ArrowArrayAppendEmptyInternal(array->children[1], 1, is_valid));
+      NANOARROW_RETURN_NOT_OK(ArrowArrayAppendInt(array->children[0], array->length + n));
+      // Run-end encoded arrays have no validity buffer and a null_count of zero
+      array->length += n;
+      return NANOARROW_OK;
+
     case NANOARROW_TYPE_FIXED_SIZE_LIST:
       NANOARROW_RETURN_NOT_OK(ArrowArrayAppendEmpty(
           array->children[0], n * private_data->layout.child_size_elements));
       break;
+    case NANOARROW_TYPE_LIST_VIEW:
+      if (array->children[0]->length > INT32_MAX) {
+        return EOVERFLOW;
+      }
+      break;
     case NANOARROW_TYPE_STRUCT:
       for (int64_t i = 0; i < array->n_children; i++) {
         NANOARROW_RETURN_NOT_OK(ArrowArrayAppendEmpty(array->children[i], n));
@@ -279,7 +291,7 @@ static inline ArrowErrorCode _ArrowArrayAppendEmptyInternal(struct ArrowArray* a
   int64_t size_bytes;
 
   for (int i = 0; i < 3; i++) {
-    buffer = ArrowArrayBuffer(array, i);
+    buffer = _ArrowArrayBuffer(array, i);
     size_bytes = private_data->layout.element_size_bits[i] / 8;
 
     switch (private_data->layout.buffer_type[i]) {
@@ -307,6 +319,23 @@ static inline ArrowErrorCode _ArrowArrayAppendEmptyInternal(struct ArrowArray* a
         }
         continue;
 
+      case NANOARROW_BUFFER_TYPE_VIEW_OFFSET:
+        // Append empty views at the end of the child (which are valid for any
+        // subsequent child length)
+        for (int64_t j = 0; j < n; j++) {
+          if (size_bytes == 4) {
+            NANOARROW_RETURN_NOT_OK(ArrowBufferAppendInt32(
+                buffer, (int32_t)array->children[0]->length));
+          } else {
+            NANOARROW_RETURN_NOT_OK(
+                ArrowBufferAppendInt64(buffer, array->children[0]->length));
+          }
+        }
+        continue;
+      case NANOARROW_BUFFER_TYPE_SIZE:
+        NANOARROW_RETURN_NOT_OK(ArrowBufferAppendFill(buffer, 0, size_bytes * n));
+        continue;
+
       case NANOARROW_BUFFER_TYPE_TYPE_ID:
       case NANOARROW_BUFFER_TYPE_UNION_OFFSET:
         // These cases return above
@@ -332,7 +361,7 @@ static inline ArrowErrorCode ArrowArrayAppendInt(struct ArrowArray* array,
   struct ArrowArrayPrivateData* private_data =
       (struct ArrowArrayPrivateData*)array->private_data;
 
-  struct ArrowBuffer* data_buffer = ArrowArrayBuffer(array, 1);
+  struct ArrowBuffer* data_buffer = _ArrowArrayBuffer(array, 1);
 
   switch (private_data->storage_type) {
     case NANOARROW_TYPE_INT64:
@@ -370,7 +399,7 @@ static inline ArrowErrorCode ArrowArrayAppendInt(struct ArrowArray* array,
   }
 
   if (private_data->bitmap.buffer.data != NULL) {
-    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(ArrowArrayValidityBitmap(array), 1, 1));
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(_ArrowArrayValidityBitmap(array), 1, 1));
   }
 
   array->length++;
@@ -382,7 +411,7 @@ static inline ArrowErrorCode ArrowArrayAppendUInt(struct ArrowArray* array,
   struct ArrowArrayPrivateData* private_data =
       (struct ArrowArrayPrivateData*)array->private_data;
 
-  struct ArrowBuffer* data_buffer = ArrowArrayBuffer(array, 1);
+  struct ArrowBuffer* data_buffer = _ArrowArrayBuffer(array, 1);
 
   switch (private_data->storage_type) {
     case NANOARROW_TYPE_UINT64:
@@ -420,7 +449,7 @@ static inline ArrowErrorCode ArrowArrayAppendUInt(struct ArrowArray* array,
   }
 
   if (private_data->bitmap.buffer.data != NULL) {
-    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(ArrowArrayValidityBitmap(array), 1, 1));
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(_ArrowArrayValidityBitmap(array), 1, 1));
   }
 
   array->length++;
@@ -432,7 +461,7 @@ static inline ArrowErrorCode ArrowArrayAppendDouble(struct ArrowArray* array,
   struct ArrowArrayPrivateData* private_data =
       (struct ArrowArrayPrivateData*)array->private_data;
 
-  struct ArrowBuffer* data_buffer = ArrowArrayBuffer(array, 1);
+  struct ArrowBuffer* data_buffer = _ArrowArrayBuffer(array, 1);
 
   switch (private_data->storage_type) {
     case NANOARROW_TYPE_DOUBLE:
@@ -446,20 +475,293 @@ static inline ArrowErrorCode ArrowArrayAppendDouble(struct ArrowArray* array,
   }
 
   if (private_data->bitmap.buffer.data != NULL) {
-    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(ArrowArrayValidityBitmap(array), 1, 1));
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(_ArrowArrayValidityBitmap(array), 1, 1));
   }
 
   array->length++;
   return NANOARROW_OK;
 }
 
+// Append n validity bits starting at bit offset (or n valid bits if validity is
+// NULL) to the bitmap of array for a bulk append and update the null count.
+// Does not update the length of array.
+static inline ArrowErrorCode _ArrowArrayAppendValidity(struct ArrowArray* array,
+                                                       const uint8_t* validity,
+                                                       int64_t offset, int64_t n) {
+  struct ArrowBitmap* bitmap = _ArrowArrayValidityBitmap(array);
+  int64_t n_valid = n;
+  if (validity != NULL) {
+    n_valid = ArrowBitCountSet(validity, offset, n);
+  }
+
+  // If we haven't allocated a bitmap yet and we need to append nulls, do it now
+  if (n_valid < n && bitmap->buffer.data == NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapReserve(bitmap, array->length + n));
+    ArrowBitmapAppendUnsafe(bitmap, 1, array->length);
+  }
+
+  if (bitmap->buffer.data != NULL && validity != NULL) {
+    // x & x == x, which copies validity in whole words
+    NANOARROW_RETURN_NOT_OK(_ArrowBitmapAppendBinaryOp(
+        bitmap, _NANOARROW_BITS_AND, validity, offset, validity, offset, n));
+  } else if (bitmap->buffer.data != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(bitmap, 1, n));
+  }
+
+  array->null_count += n - n_valid;
+  return NANOARROW_OK;
+}
+
+static inline ArrowErrorCode _ArrowArrayAppendSliceElement(struct ArrowArray* array,
+                                                           enum ArrowType value_type,
+                                                           const void* values,
+                                                           int64_t i) {
+  switch (value_type) {
+    case NANOARROW_TYPE_INT8:
+      return ArrowArrayAppendInt(array, ((const int8_t*)values)[i]);
+    case NANOARROW_TYPE_UINT8:
+      return ArrowArrayAppendUInt(array, ((const uint8_t*)values)[i]);
+    case NANOARROW_TYPE_INT16:
+      return ArrowArrayAppendInt(array, ((const int16_t*)values)[i]);
+    case NANOARROW_TYPE_UINT16:
+      return ArrowArrayAppendUInt(array, ((const uint16_t*)values)[i]);
+    case NANOARROW_TYPE_INT32:
+      return ArrowArrayAppendInt(array, ((const int32_t*)values)[i]);
+    case NANOARROW_TYPE_UINT32:
+      return ArrowArrayAppendUInt(array, ((const uint32_t*)values)[i]);
+    case NANOARROW_TYPE_INT64:
+      return ArrowArrayAppendInt(array, ((const int64_t*)values)[i]);
+    case NANOARROW_TYPE_UINT64:
+      return ArrowArrayAppendUInt(array, ((const uint64_t*)values)[i]);
+    case NANOARROW_TYPE_FLOAT:
+      return ArrowArrayAppendDouble(array, ((const float*)values)[i]);
+    case NANOARROW_TYPE_DOUBLE:
+      return ArrowArrayAppendDouble(array, ((const double*)values)[i]);
+    default:
+      return EINVAL;
+  }
+}
+
+static inline ArrowErrorCode _ArrowArrayAppendSlice(struct ArrowArray* array,
+                                                    enum ArrowType value_type,
+                                                    const void* values, int64_t n,
+                                                    const uint8_t* validity) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+
+  if (n == 0) {
+    return NANOARROW_OK;
+  }
+
+  // If a conversion is required, append element-wise so that each value is
+  // range-checked
+  if (private_data->storage_type != value_type) {
+    for (int64_t i = 0; i < n; i++) {
+      if (validity != NULL && !ArrowBitGet(validity, i)) {
+        NANOARROW_RETURN_NOT_OK(ArrowArrayAppendNull(array, 1));
+      } else {
+        NANOARROW_RETURN_NOT_OK(
+            _ArrowArrayAppendSliceElement(array, value_type, values, i));
+      }
+    }
+
+    return NANOARROW_OK;
+  }
+
+  int64_t element_size_bytes = private_data->layout.element_size_bits[1] / 8;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowBufferAppend(_ArrowArrayBuffer(array, 1), values, n * element_size_bytes));
+
+  NANOARROW_RETURN_NOT_OK(_ArrowArrayAppendValidity(array, validity, 0, n));
+  array->length += n;
+  return NANOARROW_OK;
+}
+
+static inline ArrowErrorCode ArrowArrayAppendInt8Slice(struct ArrowArray* array,
+                                                       const int8_t* values, int64_t n,
+                                                       const uint8_t* validity) {
+  return _ArrowArrayAppendSlice(array, NANOARROW_TYPE_INT8, values, n, validity);
+}
+
+static inline ArrowErrorCode ArrowArrayAppendUInt8Slice(struct ArrowArray* array,
+                                                        const uint8_t* values, int64_t n,
+                                                        const uint8_t* validity) {
+  return _ArrowArrayAppendSlice(array, NANOARROW_TYPE_UINT8, values, n, validity);
+}
+
+static inline ArrowErrorCode ArrowArrayAppendInt16Slice(struct ArrowArray* array,
+                                                        const int16_t* values, int64_t n,
+                                                        const uint8_t* validity) {
+  return _ArrowArrayAppendSlice(array, NANOARROW_TYPE_INT16, values, n, validity);
+}
+
+static inline ArrowErrorCode ArrowArrayAppendUInt16Slice(struct ArrowArray* array,
+                                                         const uint16_t* values,
+                                                         int64_t n,
+                                                         const uint8_t* validity) {
+  return _ArrowArrayAppendSlice(array, NANOARROW_TYPE_UINT16, values, n, validity);
+}
+
+static inline ArrowErrorCode ArrowArrayAppendInt32Slice(struct ArrowArray* array,
+                                                        const int32_t* values, int64_t n,
+                                                        const uint8_t* validity) {
+  return _ArrowArrayAppendSlice(array, NANOARROW_TYPE_INT32, values, n, validity);
+}
+
+static inline ArrowErrorCode ArrowArrayAppendUInt32Slice(struct ArrowArray* array,
+                                                         const uint32_t* values,
+                                                         int64_t n,
+                                                         const uint8_t* validity) {
+  return _ArrowArrayAppendSlice(array, NANOARROW_TYPE_UINT32, values, n, validity);
+}
+
+static inline ArrowErrorCode ArrowArrayAppendInt64Slice(struct ArrowArray* array,
+                                                        const int64_t* values, int64_t n,
+                                                        const uint8_t* validity) {
+  return _ArrowArrayAppendSlice(array, NANOARROW_TYPE_INT64, values, n, validity);
+}
+
+static inline ArrowErrorCode ArrowArrayAppendUInt64Slice(struct ArrowArray* array,
+                                                         const uint64_t* values,
+                                                         int64_t n,
+                                                         const uint8_t* validity) {
+  return _ArrowArrayAppendSlice(array, NANOARROW_TYPE_UINT64, values, n, validity);
+}
+
+static inline ArrowErrorCode ArrowArrayAppendFloatSlice(struct ArrowArray* array,
+                                                        const float* values, int64_t n,
+                                                        const uint8_t* validity) {
+  return _ArrowArrayAppendSlice(array, NANOARROW_TYPE_FLOAT, values, n, validity);
+}
+
+static inline ArrowErrorCode ArrowArrayAppendDoubleSlice(struct ArrowArray* array,
+                                                         const double* values, int64_t n,
+                                                         const uint8_t* validity) {
+  return _ArrowArrayAppendSlice(array, NANOARROW_TYPE_DOUBLE, values, n, validity);
+}
+
+static inline ArrowErrorCode ArrowArrayAppendFixedSizeListSlice(
+    struct ArrowArray* array, const void* values, int64_t n, const uint8_t* validity) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  if (private_data->storage_type != NANOARROW_TYPE_FIXED_SIZE_LIST) {
+    return EINVAL;
+  }
+
+  struct ArrowArray* child = array->children[0];
+  struct ArrowArrayPrivateData* child_private_data =
+      (struct ArrowArrayPrivateData*)child->private_data;
+  int64_t element_size_bits = child_private_data->layout.element_size_bits[1];
+  if (child_private_data->layout.buffer_type[1] != NANOARROW_BUFFER_TYPE_DATA ||
+      child_private_data->layout.buffer_type[2] != NANOARROW_BUFFER_TYPE_NONE ||
+      element_size_bits < 8 || child->n_children != 0 || child->dictionary != NULL) {
+    return EINVAL;
+  }
+
+  if (n == 0) {
+    return NANOARROW_OK;
+  }
+
+  // The values of all n lists are copied into the child at once
+  int64_t n_values = n * private_data->layout.child_size_elements;
+  NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(_ArrowArrayBuffer(child, 1), values,
+                                            n_values * (element_size_bits / 8)));
+  NANOARROW_RETURN_NOT_OK(_ArrowArrayAppendValidity(child, NULL, 0, n_values));
+  child->length += n_values;
+
+  NANOARROW_RETURN_NOT_OK(_ArrowArrayAppendValidity(array, validity, 0, n));
+  array->length += n;
+  return NANOARROW_OK;
+}
+
+static inline ArrowErrorCode _ArrowArrayAddVariadicBuffer(struct ArrowArray* array,
+                                                          int64_t capacity_bytes) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  int64_t n = private_data->n_variadic_buffers;
+
+  struct ArrowBuffer* buffers = (struct ArrowBuffer*)ArrowRealloc(
+      private_data->variadic_buffers, (n + 1) * sizeof(struct ArrowBuffer));
+  if (buffers == NULL) {
+    return ENOMEM;
+  }
+  private_data->variadic_buffers = buffers;
+
+  int64_t* sizes = (int64_t*)ArrowRealloc(private_data->variadic_buffer_sizes,
+                                          (n + 1) * sizeof(int64_t));
+  if (sizes == NULL) {
+    return ENOMEM;
+  }
+  private_data->variadic_buffer_sizes = sizes;
+
+  // Validity, views, each variadic buffer, and the variadic buffer sizes
+  const void** buffer_data = (const void**)ArrowRealloc(
+      (void*)private_data->variadic_buffer_data, (n + 4) * sizeof(const void*));
+  if (buffer_data == NULL) {
+    return ENOMEM;
+  }
+  private_data->variadic_buffer_data = buffer_data;
+
+  ArrowBufferInit(buffers + n);
+  buffers[n].allocator = _ArrowArrayBuffer(array, 1)->allocator;
+  sizes[n] = 0;
+  private_data->n_variadic_buffers = n + 1;
+  return ArrowBufferReserve(buffers + n, capacity_bytes);
+}
+
+static inline ArrowErrorCode _ArrowArrayAppendBinaryView(struct ArrowArray* array,
+                                                         struct ArrowBufferView value) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+
+  if (value.size_bytes > INT32_MAX) {
+    return EOVERFLOW;
+  }
+
+  union ArrowBinaryView view;
+  memset(&view, 0, sizeof(union ArrowBinaryView));
+  view.inlined.size = (int32_t)value.size_bytes;
+
+  if (value.size_bytes <= NANOARROW_BINARY_VIEW_INLINE_SIZE) {
+    if (value.size_bytes > 0) {
+      memcpy(view.inlined.data, value.data.data, value.size_bytes);
+    }
+  } else {
+    // Use the last variadic buffer if it can hold the value without reallocating
+    int64_t n = private_data->n_variadic_buffers;
+    struct ArrowBuffer* data_buffer = NULL;
+    if (n > 0) {
+      data_buffer = private_data->variadic_buffers + n - 1;
+    }
+
+    if (data_buffer == NULL ||
+        (data_buffer->capacity_bytes - data_buffer->size_bytes) < value.size_bytes) {
+      int64_t capacity_bytes = value.size_bytes > NANOARROW_BINARY_VIEW_BLOCK_SIZE
+                                   ? value.size_bytes
+                                   : NANOARROW_BINARY_VIEW_BLOCK_SIZE;
+      NANOARROW_RETURN_NOT_OK(_ArrowArrayAddVariadicBuffer(array, capacity_bytes));
+      n = private_data->n_variadic_buffers;
+      data_buffer = private_data->variadic_buffers + n - 1;
+    }
+
+    memcpy(view.ref.prefix, value.data.data, sizeof(view.ref.prefix));
+    view.ref.buffer_index = (int32_t)(n - 1);
+    view.ref.offset = (int32_t)data_buffer->size_bytes;
+    ArrowBufferAppendUnsafe(data_buffer, value.data.data, value.size_bytes);
+    private_data->variadic_buffer_sizes[n - 1] = data_buffer->size_bytes;
+  }
+
+  return ArrowBufferAppend(_ArrowArrayBuffer(array, 1), &view,
+                           sizeof(union ArrowBinaryView));
+}
+
 static inline ArrowErrorCode ArrowArrayAppendBytes(struct ArrowArray* array,
                                                    struct ArrowBufferView value) {
   struct ArrowArrayPrivateData* private_data =
       (struct ArrowArrayPrivateData*)array->private_data;
 
-  struct ArrowBuffer* offset_buffer = ArrowArrayBuffer(array, 1);
-  struct ArrowBuffer* data_buffer = ArrowArrayBuffer(
+  struct ArrowBuffer* offset_buffer = _ArrowArrayBuffer(array, 1);
+  struct ArrowBuffer* data_buffer = _ArrowArrayBuffer(
       array, 1 + (private_data->storage_type != NANOARROW_TYPE_FIXED_SIZE_BINARY));
   int32_t offset;
   int64_t large_offset;
@@ -497,12 +799,18 @@ static inline ArrowErrorCode ArrowArrayAppendBytes(struct ArrowArray* array,
       NANOARROW_RETURN_NOT_OK(
           ArrowBufferAppend(data_buffer, value.data.data, value.size_bytes));
       break;
+
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_STRING_VIEW:
+      NANOARROW_RETURN_NOT_OK(_ArrowArrayAppendBinaryView(array, value));
+      break;
+
     default:
       return EINVAL;
   }
 
   if (private_data->bitmap.buffer.data != NULL) {
-    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(ArrowArrayValidityBitmap(array), 1, 1));
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(_ArrowArrayValidityBitmap(array), 1, 1));
   }
 
   array->length++;
@@ -523,18 +831,192 @@ static inline ArrowErrorCode ArrowArrayAppendString(struct ArrowArray* array,
     case NANOARROW_TYPE_LARGE_STRING:
     case NANOARROW_TYPE_BINARY:
     case NANOARROW_TYPE_LARGE_BINARY:
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_STRING_VIEW:
       return ArrowArrayAppendBytes(array, buffer_view);
     default:
       return EINVAL;
   }
 }
 
+static inline ArrowErrorCode ArrowArrayAppendStrings(struct ArrowArray* array,
+                                                     const struct ArrowStringView* values,
+                                                     int64_t n, const uint8_t* validity) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  struct ArrowBuffer* offset_buffer = _ArrowArrayBuffer(array, 1);
+  struct ArrowBuffer* data_buffer = _ArrowArrayBuffer(array, 2);
+
+  if (n == 0) {
+    return NANOARROW_OK;
+  }
+
+  int64_t total_size_bytes = 0;
+  for (int64_t i = 0; i < n; i++) {
+    if (validity == NULL || ArrowBitGet(validity, i)) {
+      total_size_bytes += values[i].size_bytes;
+    }
+  }
+
+  switch (private_data->storage_type) {
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY: {
+      int32_t offset = ((int32_t*)offset_buffer->data)[array->length];
+      if ((((int64_t)offset) + total_size_bytes) > INT32_MAX) {
+        return EOVERFLOW;
+      }
+
+      NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(offset_buffer, n * sizeof(int32_t)));
+      NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(data_buffer, total_size_bytes));
+      int32_t* offsets_out = (int32_t*)(offset_buffer->data + offset_buffer->size_bytes);
+      for (int64_t i = 0; i < n; i++) {
+        if (validity == NULL || ArrowBitGet(validity, i)) {
+          ArrowBufferAppendUnsafe(data_buffer, values[i].data, values[i].size_bytes);
+          offset += (int32_t)values[i].size_bytes;
+        }
+
+        offsets_out[i] = offset;
+      }
+
+      offset_buffer->size_bytes += n * sizeof(int32_t);
+      break;
+    }
+
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY: {
+      int64_t large_offset = ((int64_t*)offset_buffer->data)[array->length];
+      NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(offset_buffer, n * sizeof(int64_t)));
+      NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(data_buffer, total_size_bytes));
+      int64_t* offsets_out = (int64_t*)(offset_buffer->data + offset_buffer->size_bytes);
+      for (int64_t i = 0; i < n; i++) {
+        if (validity == NULL || ArrowBitGet(validity, i)) {
+          ArrowBufferAppendUnsafe(data_buffer, values[i].data, values[i].size_bytes);
+          large_offset += values[i].size_bytes;
+        }
+
+        offsets_out[i] = large_offset;
+      }
+
+      offset_buffer->size_bytes += n * sizeof(int64_t);
+      break;
+    }
+
+    default:
+      // e.g., fixed-size binary, or an invalid storage type
+      for (int64_t i = 0; i < n; i++) {
+        if (validity == NULL || ArrowBitGet(validity, i)) {
+          struct ArrowBufferView value;
+          value.data.data = values[i].data;
+          value.size_bytes = values[i].size_bytes;
+          NANOARROW_RETURN_NOT_OK(ArrowArrayAppendBytes(array, value));
+        } else {
+          NANOARROW_RETURN_NOT_OK(ArrowArrayAppendNull(array, 1));
+        }
+      }
+
+      return NANOARROW_OK;
+  }
+
+  NANOARROW_RETURN_NOT_OK(_ArrowArrayAppendValidity(array, validity, 0, n));
+  array->length += n;
+  return NANOARROW_OK;
+}
+
+// Exactly one of offsets32 and offsets64 must be non-NULL
+static inline ArrowErrorCode _ArrowArrayAppendStringsFromOffsets(
+    struct ArrowArray* array, const int32_t* offsets32, const int64_t* offsets64,
+    const char* data, int64_t n, const uint8_t* validity) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  struct ArrowBuffer* offset_buffer = _ArrowArrayBuffer(array, 1);
+  struct ArrowBuffer* data_buffer = _ArrowArrayBuffer(array, 2);
+
+  if (n == 0) {
+    return NANOARROW_OK;
+  }
+
+  int64_t first_offset = offsets32 != NULL ? offsets32[0] : offsets64[0];
+  int64_t last_offset = offsets32 != NULL ? offsets32[n] : offsets64[n];
+  int64_t total_size_bytes = last_offset - first_offset;
+  if (total_size_bytes < 0) {
+    return EINVAL;
+  }
+
+  switch (private_data->storage_type) {
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY: {
+      int64_t base = ((int32_t*)offset_buffer->data)[array->length] - first_offset;
+      if ((last_offset + base) > INT32_MAX) {
+        return EOVERFLOW;
+      }
+
+      NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(offset_buffer, n * sizeof(int32_t)));
+      int32_t* offsets_out = (int32_t*)(offset_buffer->data + offset_buffer->size_bytes);
+      if (offsets32 != NULL) {
+        for (int64_t i = 0; i < n; i++) {
+          offsets_out[i] = (int32_t)(offsets32[i + 1] + base);
+        }
+      } else {
+        for (int64_t i = 0; i < n; i++) {
+          offsets_out[i] = (int32_t)(offsets64[i + 1] + base);
+        }
+      }
+
+      offset_buffer->size_bytes += n * sizeof(int32_t);
+      break;
+    }
+
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY: {
+      int64_t base = ((int64_t*)offset_buffer->data)[array->length] - first_offset;
+      NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(offset_buffer, n * sizeof(int64_t)));
+      int64_t* offsets_out = (int64_t*)(offset_buffer->data + offset_buffer->size_bytes);
+      if (offsets32 != NULL) {
+        for (int64_t i = 0; i < n; i++) {
+          offsets_out[i] = offsets32[i + 1] + base;
+        }
+      } else {
+        for (int64_t i = 0; i < n; i++) {
+          offsets_out[i] = offsets64[i + 1] + base;
+        }
+      }
+
+      offset_buffer->size_bytes += n * sizeof(int64_t);
+      break;
+    }
+
+    default:
+      return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK(
+      ArrowBufferAppend(data_buffer, data + first_offset, total_size_bytes));
+  NANOARROW_RETURN_NOT_OK(_ArrowArrayAppendValidity(array, validity, 0, n));
+  array->length += n;
+
+  // The input offsets are not checked for being non-decreasing
+  private_data->built_by_append = 0;
+  return NANOARROW_OK;
+}
+
+static inline ArrowErrorCode ArrowArrayAppendStringsFromOffsets(
+    struct ArrowArray* array, const int32_t* offsets, const char* data, int64_t n,
+    const uint8_t* validity) {
+  return _ArrowArrayAppendStringsFromOffsets(array, offsets, NULL, data, n, validity);
+}
+
+static inline ArrowErrorCode ArrowArrayAppendStringsFromLargeOffsets(
+    struct ArrowArray* array, const int64_t* offsets, const char* data, int64_t n,
+    const uint8_t* validity) {
+  return _ArrowArrayAppendStringsFromOffsets(array, NULL, offsets, data, n, validity);
+}
+
 static inline ArrowErrorCode ArrowArrayAppendInterval(struct ArrowArray* array,
                                                       struct ArrowInterval* value) {
   struct ArrowArrayPrivateData* private_data =
       (struct ArrowArrayPrivateData*)array->private_data;
 
-  struct ArrowBuffer* data_buffer = ArrowArrayBuffer(array, 1);
+  struct ArrowBuffer* data_buffer = _ArrowArrayBuffer(array, 1);
 
   switch (private_data->storage_type) {
     case NANOARROW_TYPE_INTERVAL_MONTHS: {
@@ -576,7 +1058,7 @@ static inline ArrowErrorCode ArrowArrayAppendDecimal(struct ArrowArray* array,
                                                      struct ArrowDecimal* value) {
   struct ArrowArrayPrivateData* private_data =
       (struct ArrowArrayPrivateData*)array->private_data;
-  struct ArrowBuffer* data_buffer = ArrowArrayBuffer(array, 1);
+  struct ArrowBuffer* data_buffer = _ArrowArrayBuffer(array, 1);
 
   switch (private_data->storage_type) {
     case NANOARROW_TYPE_DECIMAL128:
@@ -600,13 +1082,72 @@ static inline ArrowErrorCode ArrowArrayAppendDecimal(struct ArrowArray* array,
   }
 
   if (private_data->bitmap.buffer.data != NULL) {
-    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(ArrowArrayValidityBitmap(array), 1, 1));
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(_ArrowArrayValidityBitmap(array), 1, 1));
   }
 
   array->length++;
   return NANOARROW_OK;
 }
 
+static inline ArrowErrorCode ArrowArrayAppendListView(struct ArrowArray* array,
+                                                     int64_t child_offset,
+                                                     int64_t size) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+
+  if (child_offset < 0 || size < 0) {
+    return EINVAL;
+  }
+
+  switch (private_data->storage_type) {
+    case NANOARROW_TYPE_LIST_VIEW:
+      if (child_offset > INT32_MAX || size > (INT32_MAX - child_offset)) {
+        return EOVERFLOW;
+      }
+      NANOARROW_RETURN_NOT_OK(
+          ArrowBufferAppendInt32(_ArrowArrayBuffer(array, 1), (int32_t)child_offset));
+      NANOARROW_RETURN_NOT_OK(
+          ArrowBufferAppendInt32(_ArrowArrayBuffer(array, 2), (int32_t)size));
+      break;
+    case NANOARROW_TYPE_LARGE_LIST_VIEW:
+      if (size > (INT64_MAX - child_offset)) {
+        return EOVERFLOW;
+      }
+      NANOARROW_RETURN_NOT_OK(
+          ArrowBufferAppendInt64(_ArrowArrayBuffer(array, 1), child_offset));
+      NANOARROW_RETURN_NOT_OK(ArrowBufferAppendInt64(_ArrowArrayBuffer(array, 2), size));
+      break;
+    default:
+      return EINVAL;
+  }
+
+  if (private_data->bitmap.buffer.data != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(_ArrowArrayValidityBitmap(array), 1, 1));
+  }
+
+  array->length++;
+  return NANOARROW_OK;
+}
+
+// The end of the range of child values referenced by the last element of a
+// list view array that is being built
+static inline int64_t _ArrowArrayListViewEnd(struct ArrowArray* array) {
+  if (array->length == 0) {
+    return 0;
+  }
+
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  const uint8_t* offsets = _ArrowArrayBuffer(array, 1)->data;
+  const uint8_t* sizes = _ArrowArrayBuffer(array, 2)->data;
+  int64_t i = array->length - 1;
+  if (private_data->storage_type == NANOARROW_TYPE_LIST_VIEW) {
+    return (int64_t)((const int32_t*)offsets)[i] + ((const int32_t*)sizes)[i];
+  } else {
+    return ((const int64_t*)offsets)[i] + ((const int64_t*)sizes)[i];
+  }
+}
+
 static inline ArrowErrorCode ArrowArrayFinishElement(struct ArrowArray* array) {
   struct ArrowArrayPrivateData* private_data =
       (struct ArrowArrayPrivateData*)array->private_data;
@@ -621,13 +1162,23 @@ static inline ArrowErrorCode ArrowArrayFinishElement(struct ArrowArray* array) {
         return EOVERFLOW;
       }
       NANOARROW_RETURN_NOT_OK(
-          ArrowBufferAppendInt32(ArrowArrayBuffer(array, 1), (int32_t)child_length));
+          ArrowBufferAppendInt32(_ArrowArrayBuffer(array, 1), (int32_t)child_length));
       break;
     case NANOARROW_TYPE_LARGE_LIST:
       child_length = array->children[0]->length;
       NANOARROW_RETURN_NOT_OK(
-          ArrowBufferAppendInt64(ArrowArrayBuffer(array, 1), child_length));
+          ArrowBufferAppendInt64(_ArrowArrayBuffer(array, 1), child_length));
       break;
+    case NANOARROW_TYPE_LIST_VIEW:
+    case NANOARROW_TYPE_LARGE_LIST_VIEW: {
+      // The element refers to the child values appended since the end of the
+      // previous element
+      int64_t start = _ArrowArrayListViewEnd(array);
+      if (start > array->children[0]->length) {
+        return EINVAL;
+      }
+      return ArrowArrayAppendListView(array, start, array->children[0]->length - start);
+    }
     case NANOARROW_TYPE_FIXED_SIZE_LIST:
       child_length = array->children[0]->length;
       if (child_length !=
@@ -648,7 +1199,7 @@ static inline ArrowErrorCode ArrowArrayFinishElement(struct ArrowArray* array) {
   }
 
   if (private_data->bitmap.buffer.data != NULL) {
-    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(ArrowArrayValidityBitmap(array), 1, 1));
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(_ArrowArrayValidityBitmap(array), 1, 1));
   }
 
   array->length++;
@@ -669,8 +1220,9 @@ static inline ArrowErrorCode ArrowArrayFinishUnionElement(struct ArrowArray* arr
     case NANOARROW_TYPE_DENSE_UNION:
       // Append the target child length to the union offsets buffer
       _NANOARROW_CHECK_RANGE(array->children[child_index]->length, 0, INT32_MAX);
-      NANOARROW_RETURN_NOT_OK(ArrowBufferAppendInt32(
-          ArrowArrayBuffer(array, 1), (int32_t)array->children[child_index]->length - 1));
+      NANOARROW_RETURN_NOT_OK(
+          ArrowBufferAppendInt32(_ArrowArrayBuffer(array, 1),
+                                 (int32_t)array->children[child_index]->length - 1));
       break;
     case NANOARROW_TYPE_SPARSE_UNION:
       // Append one empty to any non-target column that isn't already the right length
@@ -694,19 +1246,90 @@ static inline ArrowErrorCode ArrowArrayFinishUnionElement(struct ArrowArray* arr
 
   // Write to the type_ids buffer
   NANOARROW_RETURN_NOT_OK(
-      ArrowBufferAppendInt8(ArrowArrayBuffer(array, 0), (int8_t)type_id));
+      ArrowBufferAppendInt8(_ArrowArrayBuffer(array, 0), (int8_t)type_id));
   array->length++;
   return NANOARROW_OK;
 }
 
+static inline ArrowErrorCode ArrowArrayFinishRunEndElement(struct ArrowArray* array,
+                                                           int64_t run_length) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+
+  if (private_data->storage_type != NANOARROW_TYPE_RUN_END_ENCODED ||
+      run_length <= 0) {
+    return EINVAL;
+  }
+
+  // Exactly one value must have been appended to the values child for this run
+  struct ArrowArray* run_ends = array->children[0];
+  if (array->children[1]->length != (run_ends->length + 1)) {
+    return EINVAL;
+  }
+
+  if (run_length > (INT64_MAX - array->length)) {
+    return EOVERFLOW;
+  }
+
+  // ArrowArrayAppendInt() checks that the run end fits in the run end type
+  NANOARROW_RETURN_NOT_OK(ArrowArrayAppendInt(run_ends, array->length + run_length));
+  array->length += run_length;
+  return NANOARROW_OK;
+}
+
 static inline void ArrowArrayViewMove(struct ArrowArrayView* src,
                                       struct ArrowArrayView* dst) {
   memcpy(dst, src, sizeof(struct ArrowArrayView));
   ArrowArrayViewInitFromType(src, NANOARROW_TYPE_UNINITIALIZED);
 }
 
+static inline int64_t ArrowArrayViewRunEndPhysicalIndex(struct ArrowArrayView* array_view,
+                                                        int64_t i) {
+  if (array_view->storage_type != NANOARROW_TYPE_RUN_END_ENCODED) {
+    return -1;
+  }
+
+  // Find the first run whose end is greater than the logical index
+  struct ArrowArrayView* run_ends = array_view->children[0];
+  int64_t logical_index = array_view->offset + i;
+  int64_t lo = 0;
+  int64_t hi = run_ends->length;
+  while (lo < hi) {
+    int64_t mid = lo + (hi - lo) / 2;
+    if (ArrowArrayViewGetIntUnsafe(run_ends, mid) > logical_index) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+
+  return lo;
+}
+
+static inline struct ArrowBufferView _ArrowArrayViewGetBinaryView(
+    struct ArrowArrayView* array_view, int64_t i) {
+  const union ArrowBinaryView* view = array_view->buffer_views[1].data.as_binary_view + i;
+
+  struct ArrowBufferView out;
+  out.size_bytes = view->inlined.size;
+  if (view->inlined.size <= NANOARROW_BINARY_VIEW_INLINE_SIZE) {
+    out.data.as_uint8 = view->inlined.data;
+  } else {
+    out.data.as_uint8 =
+        (const uint8_t*)array_view->variadic_buffers[view->ref.buffer_index] +
+        view->ref.offset;
+  }
+
+  return out;
+}
+
 static inline int8_t ArrowArrayViewIsNull(struct ArrowArrayView* array_view, int64_t i) {
   const uint8_t* validity_buffer = array_view->buffer_views[0].data.as_uint8;
+  if (array_view->storage_type == NANOARROW_TYPE_RUN_END_ENCODED) {
+    return ArrowArrayViewIsNull(array_view->children[1],
+                                ArrowArrayViewRunEndPhysicalIndex(array_view, i));
+  }
+
   i += array_view->offset;
   switch (array_view->storage_type) {
     case NANOARROW_TYPE_NA:
@@ -720,6 +1343,37 @@ static inline int8_t ArrowArrayViewIsNull(struct ArrowArrayView* array_view, int
   }
 }
 
+static inline int64_t ArrowArrayViewComputeNullCount(struct ArrowArrayView* array_view) {
+  int64_t null_count = array_view->null_count;
+  if (null_count < 0) {
+    null_count = 0;
+    const uint8_t* validity_buffer = array_view->buffer_views[0].data.as_uint8;
+    switch (array_view->storage_type) {
+      case NANOARROW_TYPE_NA:
+        null_count = array_view->length;
+        break;
+      case NANOARROW_TYPE_DENSE_UNION:
+      case NANOARROW_TYPE_SPARSE_UNION:
+        // Unions are "never null" in Arrow land
+        break;
+      case NANOARROW_TYPE_RUN_END_ENCODED:
+        // Run-end encoded arrays have no validity buffer and a null_count of zero
+        break;
+      default:
+        if (validity_buffer != NULL) {
+          null_count = array_view->length - ArrowBitCountSet(validity_buffer,
+                                                             array_view->offset,
+                                                             array_view->length);
+        }
+        break;
+    }
+
+    array_view->null_count = null_count;
+  }
+
+  return null_count;
+}
+
 static inline int8_t ArrowArrayViewUnionTypeId(struct ArrowArrayView* array_view,
                                                int64_t i) {
   switch (array_view->storage_type) {
@@ -757,17 +1411,40 @@ static inline int64_t ArrowArrayViewListChildOffset(struct ArrowArrayView* array
                                                     int64_t i) {
   switch (array_view->storage_type) {
     case NANOARROW_TYPE_LIST:
+    case NANOARROW_TYPE_LIST_VIEW:
       return array_view->buffer_views[1].data.as_int32[i];
     case NANOARROW_TYPE_LARGE_LIST:
+    case NANOARROW_TYPE_LARGE_LIST_VIEW:
       return array_view->buffer_views[1].data.as_int64[i];
     default:
       return -1;
   }
 }
 
+static inline int64_t ArrowArrayViewListChildSize(struct ArrowArrayView* array_view,
+                                                  int64_t i) {
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_LIST:
+    case NANOARROW_TYPE_LARGE_LIST:
+      return ArrowArrayViewListChildOffset(array_view, i + 1) -
+             ArrowArrayViewListChildOffset(array_view, i);
+    case NANOARROW_TYPE_LIST_VIEW:
+      return array_view->buffer_views[2].data.as_int32[i];
+    case NANOARROW_TYPE_LARGE_LIST_VIEW:
+      return array_view->buffer_views[2].data.as_int64[i];
+    default:
+      return -1;
+  }
+}
+
 static inline int64_t ArrowArrayViewGetIntUnsafe(struct ArrowArrayView* array_view,
                                                  int64_t i) {
   struct ArrowBufferView* data_view = &array_view->buffer_views[1];
+  if (array_view->storage_type == NANOARROW_TYPE_RUN_END_ENCODED) {
+    return ArrowArrayViewGetIntUnsafe(array_view->children[1],
+                                      ArrowArrayViewRunEndPhysicalIndex(array_view, i));
+  }
+
   i += array_view->offset;
   switch (array_view->storage_type) {
     case NANOARROW_TYPE_INT64:
@@ -799,6 +1476,11 @@ static inline int64_t ArrowArrayViewGetIntUnsafe(struct ArrowArrayView* array_vi
 
 static inline uint64_t ArrowArrayViewGetUIntUnsafe(struct ArrowArrayView* array_view,
                                                    int64_t i) {
+  if (array_view->storage_type == NANOARROW_TYPE_RUN_END_ENCODED) {
+    return ArrowArrayViewGetUIntUnsafe(array_view->children[1],
+                                       ArrowArrayViewRunEndPhysicalIndex(array_view, i));
+  }
+
   i += array_view->offset;
   struct ArrowBufferView* data_view = &array_view->buffer_views[1];
   switch (array_view->storage_type) {
@@ -831,6 +1513,11 @@ static inline uint64_t ArrowArrayViewGetUIntUnsafe(struct ArrowArrayView* array_
 
 static inline double ArrowArrayViewGetDoubleUnsafe(struct ArrowArrayView* array_view,
                                                    int64_t i) {
+  if (array_view->storage_type == NANOARROW_TYPE_RUN_END_ENCODED) {
+    return ArrowArrayViewGetDoubleUnsafe(
+        array_view->children[1], ArrowArrayViewRunEndPhysicalIndex(array_view, i));
+  }
+
   i += array_view->offset;
   struct ArrowBufferView* data_view = &array_view->buffer_views[1];
   switch (array_view->storage_type) {
@@ -863,11 +1550,17 @@ static inline double ArrowArrayViewGetDoubleUnsafe(struct ArrowArrayView* array_
 
 static inline struct ArrowStringView ArrowArrayViewGetStringUnsafe(
     struct ArrowArrayView* array_view, int64_t i) {
+  if (array_view->storage_type == NANOARROW_TYPE_RUN_END_ENCODED) {
+    return ArrowArrayViewGetStringUnsafe(
+        array_view->children[1], ArrowArrayViewRunEndPhysicalIndex(array_view, i));
+  }
+
   i += array_view->offset;
   struct ArrowBufferView* offsets_view = &array_view->buffer_views[1];
   const char* data_view = array_view->buffer_views[2].data.as_char;
 
   struct ArrowStringView view;
+  struct ArrowBufferView binary_view;
   switch (array_view->storage_type) {
     case NANOARROW_TYPE_STRING:
     case NANOARROW_TYPE_BINARY:
@@ -885,6 +1578,12 @@ static inline struct ArrowStringView ArrowArrayViewGetStringUnsafe(
       view.size_bytes = array_view->layout.element_size_bits[1] / 8;
       view.data = array_view->buffer_views[1].data.as_char + (i * view.size_bytes);
       break;
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_STRING_VIEW:
+      binary_view = _ArrowArrayViewGetBinaryView(array_view, i);
+      view.data = binary_view.data.as_char;
+      view.size_bytes = binary_view.size_bytes;
+      break;
     default:
       view.data = NULL;
       view.size_bytes = 0;
@@ -896,6 +1595,11 @@ static inline struct ArrowStringView ArrowArrayViewGetStringUnsafe(
 
 static inline struct ArrowBufferView ArrowArrayViewGetBytesUnsafe(
     struct ArrowArrayView* array_view, int64_t i) {
+  if (array_view->storage_type == NANOARROW_TYPE_RUN_END_ENCODED) {
+    return ArrowArrayViewGetBytesUnsafe(array_view->children[1],
+                                        ArrowArrayViewRunEndPhysicalIndex(array_view, i));
+  }
+
   i += array_view->offset;
   struct ArrowBufferView* offsets_view = &array_view->buffer_views[1];
   const uint8_t* data_view = array_view->buffer_views[2].data.as_uint8;
@@ -919,6 +1623,10 @@ static inline struct ArrowBufferView ArrowArrayViewGetBytesUnsafe(
       view.data.as_uint8 =
           array_view->buffer_views[1].data.as_uint8 + (i * view.size_bytes);
       break;
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_STRING_VIEW:
+      view = _ArrowArrayViewGetBinaryView(array_view, i);
+      break;
     default:
       view.data.data = NULL;
       view.size_bytes = 0;
@@ -928,6 +1636,153 @@ static inline struct ArrowBufferView ArrowArrayViewGetBytesUnsafe(
   return view;
 }
 
+// Converts n values of the C type of in into out with a loop that compilers can
+// vectorize
+#define _NANOARROW_CONVERT_VALUES(out, in, n, out_type) \
+  for (int64_t j = 0; j < (n); j++) {                   \
+    (out)[j] = (out_type)(in)[j];                       \
+  }
+
+static inline void ArrowArrayViewGetIntsUnsafe(struct ArrowArrayView* array_view,
+                                               int64_t i, int64_t n, int64_t* out) {
+  if (n <= 0) {
+    return;
+  }
+
+  struct ArrowBufferView* data_view = &array_view->buffer_views[1];
+  int64_t start = array_view->offset + i;
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_INT64:
+      memcpy(out, data_view->data.as_int64 + start, n * sizeof(int64_t));
+      break;
+    case NANOARROW_TYPE_UINT64:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_uint64 + start, n, int64_t);
+      break;
+    case NANOARROW_TYPE_INT32:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_int32 + start, n, int64_t);
+      break;
+    case NANOARROW_TYPE_UINT32:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_uint32 + start, n, int64_t);
+      break;
+    case NANOARROW_TYPE_INT16:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_int16 + start, n, int64_t);
+      break;
+    case NANOARROW_TYPE_UINT16:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_uint16 + start, n, int64_t);
+      break;
+    case NANOARROW_TYPE_INT8:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_int8 + start, n, int64_t);
+      break;
+    case NANOARROW_TYPE_UINT8:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_uint8 + start, n, int64_t);
+      break;
+    case NANOARROW_TYPE_DOUBLE:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_double + start, n, int64_t);
+      break;
+    case NANOARROW_TYPE_FLOAT:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_float + start, n, int64_t);
+      break;
+    default:
+      for (int64_t j = 0; j < n; j++) {
+        out[j] = ArrowArrayViewGetIntUnsafe(array_view, i + j);
+      }
+      break;
+  }
+}
+
+static inline void ArrowArrayViewGetDoublesUnsafe(struct ArrowArrayView* array_view,
+                                                  int64_t i, int64_t n, double* out) {
+  if (n <= 0) {
+    return;
+  }
+
+  struct ArrowBufferView* data_view = &array_view->buffer_views[1];
+  int64_t start = array_view->offset + i;
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_INT64:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_int64 + start, n, double);
+      break;
+    case NANOARROW_TYPE_UINT64:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_uint64 + start, n, double);
+      break;
+    case NANOARROW_TYPE_INT32:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_int32 + start, n, double);
+      break;
+    case NANOARROW_TYPE_UINT32:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_uint32 + start, n, double);
+      break;
+    case NANOARROW_TYPE_INT16:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_int16 + start, n, double);
+      break;
+    case NANOARROW_TYPE_UINT16:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_uint16 + start, n, double);
+      break;
+    case NANOARROW_TYPE_INT8:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_int8 + start, n, double);
+      break;
+    case NANOARROW_TYPE_UINT8:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_uint8 + start, n, double);
+      break;
+    case NANOARROW_TYPE_DOUBLE:
+      memcpy(out, data_view->data.as_double + start, n * sizeof(double));
+      break;
+    case NANOARROW_TYPE_FLOAT:
+      _NANOARROW_CONVERT_VALUES(out, data_view->data.as_float + start, n, double);
+      break;
+    default:
+      for (int64_t j = 0; j < n; j++) {
+        out[j] = ArrowArrayViewGetDoubleUnsafe(array_view, i + j);
+      }
+      break;
+  }
+}
+
+static inline void ArrowArrayViewGetStringsUnsafe(struct ArrowArrayView* array_view,
+                                                  int64_t i, int64_t n,
+                                                  struct ArrowStringView* out) {
+  if (n <= 0) {
+    return;
+  }
+
+  struct ArrowBufferView* offsets_view = &array_view->buffer_views[1];
+  const char* data_view = array_view->buffer_views[2].data.as_char;
+  int64_t start = array_view->offset + i;
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY: {
+      const int32_t* offsets = offsets_view->data.as_int32 + start;
+      for (int64_t j = 0; j < n; j++) {
+        out[j].data = data_view + offsets[j];
+        out[j].size_bytes = offsets[j + 1] - offsets[j];
+      }
+      break;
+    }
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY: {
+      const int64_t* offsets = offsets_view->data.as_int64 + start;
+      for (int64_t j = 0; j < n; j++) {
+        out[j].data = data_view + offsets[j];
+        out[j].size_bytes = offsets[j + 1] - offsets[j];
+      }
+      break;
+    }
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_STRING_VIEW:
+      for (int64_t j = 0; j < n; j++) {
+        struct ArrowBufferView value =
+            _ArrowArrayViewGetBinaryView(array_view, start + j);
+        out[j].data = value.data.as_char;
+        out[j].size_bytes = value.size_bytes;
+      }
+      break;
+    default:
+      for (int64_t j = 0; j < n; j++) {
+        out[j] = ArrowArrayViewGetStringUnsafe(array_view, i + j);
+      }
+      break;
+  }
+}
+
 static inline void ArrowArrayViewGetIntervalUnsafe(struct ArrowArrayView* array_view,
                                                    int64_t i, struct ArrowInterval* out) {
   const uint8_t* data_view = array_view->buffer_views[1].data.as_uint8;
@@ -972,6 +1827,145 @@ static inline void ArrowArrayViewGetDecimalUnsafe(struct ArrowArrayView* array_v
   }
 }
 
+static inline int64_t ArrowArrayViewGetDictionaryIntUnsafe(
+    struct ArrowArrayView* array_view, int64_t i) {
+  return ArrowArrayViewGetIntUnsafe(array_view->dictionary,
+                                    ArrowArrayViewGetIntUnsafe(array_view, i));
+}
+
+static inline uint64_t ArrowArrayViewGetDictionaryUIntUnsafe(
+    struct ArrowArrayView* array_view, int64_t i) {
+  return ArrowArrayViewGetUIntUnsafe(array_view->dictionary,
+                                     ArrowArrayViewGetIntUnsafe(array_view, i));
+}
+
+static inline double ArrowArrayViewGetDictionaryDoubleUnsafe(
+    struct ArrowArrayView* array_view, int64_t i) {
+  return ArrowArrayViewGetDoubleUnsafe(array_view->dictionary,
+                                       ArrowArrayViewGetIntUnsafe(array_view, i));
+}
+
+static inline struct ArrowStringView ArrowArrayViewGetDictionaryStringUnsafe(
+    struct ArrowArrayView* array_view, int64_t i) {
+  return ArrowArrayViewGetStringUnsafe(array_view->dictionary,
+                                       ArrowArrayViewGetIntUnsafe(array_view, i));
+}
+
+static inline struct ArrowBufferView ArrowArrayViewGetDictionaryBytesUnsafe(
+    struct ArrowArrayView* array_view, int64_t i) {
+  return ArrowArrayViewGetBytesUnsafe(array_view->dictionary,
+                                      ArrowArrayViewGetIntUnsafe(array_view, i));
+}
+
+static inline int64_t ArrowChunkedArrayViewFindChunk(
+    const struct ArrowChunkedArrayView* chunked_array_view, int64_t i) {
+  // Maintain chunk_offsets[lo] <= i < chunk_offsets[hi], such that empty chunks
+  // are never returned
+  const int64_t* chunk_offsets = chunked_array_view->chunk_offsets;
+  int64_t lo = 0;
+  int64_t hi = chunked_array_view->n_chunks;
+  while ((hi - lo) > 1) {
+    int64_t mid = lo + (hi - lo) / 2;
+    if (chunk_offsets[mid] <= i) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return lo;
+}
+
+static inline int64_t ArrowChunkedArrayViewChunkRange(
+    const struct ArrowChunkedArrayView* chunked_array_view, int64_t i, int64_t end,
+    int64_t* chunk, int64_t* chunk_i) {
+  *chunk = ArrowChunkedArrayViewFindChunk(chunked_array_view, i);
+  *chunk_i = i - chunked_array_view->chunk_offsets[*chunk];
+  int64_t chunk_end = chunked_array_view->chunk_offsets[*chunk + 1];
+  return (end < chunk_end ? end : chunk_end) - i;
+}
+
+static inline int8_t ArrowChunkedArrayViewIsNull(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i) {
+  int64_t chunk = ArrowChunkedArrayViewFindChunk(chunked_array_view, i);
+  return ArrowArrayViewIsNull(chunked_array_view->chunks + chunk,
+                              i - chunked_array_view->chunk_offsets[chunk]);
+}
+
+static inline int64_t ArrowChunkedArrayViewGetIntUnsafe(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i) {
+  int64_t chunk = ArrowChunkedArrayViewFindChunk(chunked_array_view, i);
+  return ArrowArrayViewGetIntUnsafe(chunked_array_view->chunks + chunk,
+                                    i - chunked_array_view->chunk_offsets[chunk]);
+}
+
+static inline uint64_t ArrowChunkedArrayViewGetUIntUnsafe(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i) {
+  int64_t chunk = ArrowChunkedArrayViewFindChunk(chunked_array_view, i);
+  return ArrowArrayViewGetUIntUnsafe(chunked_array_view->chunks + chunk,
+                                     i - chunked_array_view->chunk_offsets[chunk]);
+}
+
+static inline double ArrowChunkedArrayViewGetDoubleUnsafe(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i) {
+  int64_t chunk = ArrowChunkedArrayViewFindChunk(chunked_array_view, i);
+  return ArrowArrayViewGetDoubleUnsafe(chunked_array_view->chunks + chunk,
+                                       i - chunked_array_view->chunk_offsets[chunk]);
+}
+
+static inline struct ArrowStringView ArrowChunkedArrayViewGetStringUnsafe(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i) {
+  int64_t chunk = ArrowChunkedArrayViewFindChunk(chunked_array_view, i);
+  return ArrowArrayViewGetStringUnsafe(chunked_array_view->chunks + chunk,
+                                       i - chunked_array_view->chunk_offsets[chunk]);
+}
+
+static inline struct ArrowBufferView ArrowChunkedArrayViewGetBytesUnsafe(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i) {
+  int64_t chunk = ArrowChunkedArrayViewFindChunk(chunked_array_view, i);
+  return ArrowArrayViewGetBytesUnsafe(chunked_array_view->chunks + chunk,
+                                      i - chunked_array_view->chunk_offsets[chunk]);
+}
+
+static inline void ArrowChunkedArrayViewGetIntsUnsafe(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i, int64_t n,
+    int64_t* out) {
+  int64_t chunk;
+  int64_t chunk_i;
+  for (int64_t j = 0, chunk_n = 0; j < n; j += chunk_n) {
+    chunk_n = ArrowChunkedArrayViewChunkRange(chunked_array_view, i + j, i + n, &chunk,
+                                              &chunk_i);
+    ArrowArrayViewGetIntsUnsafe(chunked_array_view->chunks + chunk, chunk_i, chunk_n,
+                                out + j);
+  }
+}
+
+static inline void ArrowChunkedArrayViewGetDoublesUnsafe(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i, int64_t n,
+    double* out) {
+  int64_t chunk;
+  int64_t chunk_i;
+  for (int64_t j = 0, chunk_n = 0; j < n; j += chunk_n) {
+    chunk_n = ArrowChunkedArrayViewChunkRange(chunked_array_view, i + j, i + n, &chunk,
+                                              &chunk_i);
+    ArrowArrayViewGetDoublesUnsafe(chunked_array_view->chunks + chunk, chunk_i, chunk_n,
+                                   out + j);
+  }
+}
+
+static inline void ArrowChunkedArrayViewGetStringsUnsafe(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i, int64_t n,
+    struct ArrowStringView* out) {
+  int64_t chunk;
+  int64_t chunk_i;
+  for (int64_t j = 0, chunk_n = 0; j < n; j += chunk_n) {
+    chunk_n = ArrowChunkedArrayViewChunkRange(chunked_array_view, i + j, i + n, &chunk,
+                                              &chunk_i);
+    ArrowArrayViewGetStringsUnsafe(chunked_array_view->chunks + chunk, chunk_i, chunk_n,
+                                   out + j);
+  }
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -15,7 +15,28 @@
 // specific language governing permissions and limitations
 // under the License.
 
+// mkstemp(), fdopen(), and fileno() require _GNU_SOURCE on Linux
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+// Spill files may be larger than 2 GiB on platforms where off_t is 32 bits by default
+#if !defined(_FILE_OFFSET_BITS)
+#define _FILE_OFFSET_BITS 64
+#endif
+
 #include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define NANOARROW_HAVE_MMAP 1
+#else
+#define NANOARROW_HAVE_MMAP 0
+#endif
 
 #include "nanoarrow.h"
 
@@ -24,6 +45,7 @@ struct BasicArrayStreamPrivate {
   int64_t n_arrays;
   struct ArrowArray* arrays;
   int64_t arrays_i;
+  char share_schema;
 };
 
 static int ArrowBasicArrayStreamGetSchema(struct ArrowArrayStream* array_stream,
@@ -34,6 +56,10 @@ static int ArrowBasicArrayStreamGetSchema(struct ArrowArrayStream* array_stream,
 
   struct BasicArrayStreamPrivate* private_data =
       (struct BasicArrayStreamPrivate*)array_stream->private_data;
+  if (private_data->share_schema) {
+    return ArrowSchemaShare(&private_data->schema, schema);
+  }
+
   return ArrowSchemaDeepCopy(&private_data->schema, schema);
 }
 
@@ -100,6 +126,7 @@ ArrowErrorCode ArrowBasicArrayStreamInit(struct ArrowArrayStream* array_stream,
   private_data->n_arrays = n_arrays;
   private_data->arrays = NULL;
   private_data->arrays_i = 0;
+  private_data->share_schema = 0;
 
   if (n_arrays > 0) {
     private_data->arrays =
@@ -129,6 +156,13 @@ void ArrowBasicArrayStreamSetArray(struct ArrowArrayStream* array_stream, int64_
   ArrowArrayMove(array, &private_data->arrays[i]);
 }
 
+void ArrowBasicArrayStreamSetShareSchema(struct ArrowArrayStream* array_stream,
+                                         char share_schema) {
+  struct BasicArrayStreamPrivate* private_data =
+      (struct BasicArrayStreamPrivate*)array_stream->private_data;
+  private_data->share_schema = share_schema;
+}
+
 ArrowErrorCode ArrowBasicArrayStreamValidate(struct ArrowArrayStream* array_stream,
                                              struct ArrowError* error) {
   struct BasicArrayStreamPrivate* private_data =
@@ -151,3 +185,1160 @@ ArrowErrorCode ArrowBasicArrayStreamValidate(struct ArrowArrayStream* array_stre
   ArrowArrayViewReset(&array_view);
   return NANOARROW_OK;
 }
+
+struct RebatchArrayStreamPrivate {
+  struct ArrowArrayStream input;
+  struct ArrowSchema schema;
+  int64_t target_length;
+  // The input array currently being consumed and the number of its elements
+  // that have already been emitted
+  struct ArrowArray current;
+  int64_t current_offset;
+  // Slices waiting to be concatenated (struct ArrowArray values) and scratch
+  // space for pointers to them
+  struct ArrowBuffer pending;
+  struct ArrowBuffer pending_pointers;
+  int64_t pending_length;
+  struct ArrowError error;
+};
+
+static int ArrowRebatchArrayStreamGetSchema(struct ArrowArrayStream* array_stream,
+                                            struct ArrowSchema* schema) {
+  if (array_stream == NULL || array_stream->release == NULL) {
+    return EINVAL;
+  }
+
+  struct RebatchArrayStreamPrivate* private_data =
+      (struct RebatchArrayStreamPrivate*)array_stream->private_data;
+  return ArrowSchemaDeepCopy(&private_data->schema, schema);
+}
+
+static void ArrowRebatchArrayStreamReleasePending(
+    struct RebatchArrayStreamPrivate* private_data) {
+  struct ArrowArray* pending = (struct ArrowArray*)private_data->pending.data;
+  int64_t n_pending = private_data->pending.size_bytes / sizeof(struct ArrowArray);
+  for (int64_t i = 0; i < n_pending; i++) {
+    if (pending[i].release != NULL) {
+      pending[i].release(&pending[i]);
+    }
+  }
+
+  private_data->pending.size_bytes = 0;
+  private_data->pending_length = 0;
+}
+
+// Emit the pending slices as a single array, moving a lone slice without copying
+static int ArrowRebatchArrayStreamEmit(struct RebatchArrayStreamPrivate* private_data,
+                                       struct ArrowArray* out) {
+  struct ArrowArray* pending = (struct ArrowArray*)private_data->pending.data;
+  int64_t n_pending = private_data->pending.size_bytes / sizeof(struct ArrowArray);
+
+  if (n_pending == 1) {
+    ArrowArrayMove(pending, out);
+    ArrowRebatchArrayStreamReleasePending(private_data);
+    return NANOARROW_OK;
+  }
+
+  private_data->pending_pointers.size_bytes = 0;
+  for (int64_t i = 0; i < n_pending; i++) {
+    struct ArrowArray* pointer = pending + i;
+    NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(&private_data->pending_pointers, &pointer,
+                                              sizeof(struct ArrowArray*)));
+  }
+
+  int result = ArrowArrayConcatenate(
+      (struct ArrowArray**)private_data->pending_pointers.data, n_pending,
+      &private_data->schema, out, &private_data->error);
+  ArrowRebatchArrayStreamReleasePending(private_data);
+  return result;
+}
+
+// Move the next length elements of the current input array to pending
+static int ArrowRebatchArrayStreamTake(struct RebatchArrayStreamPrivate* private_data,
+                                       int64_t length) {
+  struct ArrowArray slice;
+  if (private_data->current_offset == 0 && length == private_data->current.length) {
+    ArrowArrayMove(&private_data->current, &slice);
+  } else {
+    NANOARROW_RETURN_NOT_OK(ArrowArraySlice(
+        &private_data->current, private_data->current_offset, length, &slice));
+  }
+
+  int result =
+      ArrowBufferAppend(&private_data->pending, &slice, sizeof(struct ArrowArray));
+  if (result != NANOARROW_OK) {
+    slice.release(&slice);
+    return result;
+  }
+
+  private_data->current_offset += length;
+  private_data->pending_length += length;
+  return NANOARROW_OK;
+}
+
+static int ArrowRebatchArrayStreamGetNextInternal(
+    struct RebatchArrayStreamPrivate* private_data, struct ArrowArray* array) {
+  while (1) {
+    if (private_data->current.release != NULL &&
+        private_data->current_offset == private_data->current.length) {
+      private_data->current.release(&private_data->current);
+    }
+
+    if (private_data->current.release == NULL) {
+      int result = private_data->input.get_next(&private_data->input,
+                                                &private_data->current);
+      if (result != NANOARROW_OK) {
+        const char* message = private_data->input.get_last_error(&private_data->input);
+        ArrowErrorSet(&private_data->error, "%s", message == NULL ? "" : message);
+        return result;
+      }
+
+      // End of input: emit whatever is left
+      if (private_data->current.release == NULL) {
+        if (private_data->pending_length > 0) {
+          return ArrowRebatchArrayStreamEmit(private_data, array);
+        }
+
+        array->release = NULL;
+        return NANOARROW_OK;
+      }
+
+      private_data->current_offset = 0;
+      continue;
+    }
+
+    int64_t n_remaining = private_data->current.length - private_data->current_offset;
+    int64_t n_needed = private_data->target_length - private_data->pending_length;
+    NANOARROW_RETURN_NOT_OK(ArrowRebatchArrayStreamTake(
+        private_data, n_remaining < n_needed ? n_remaining : n_needed));
+
+    if (private_data->pending_length == private_data->target_length) {
+      return ArrowRebatchArrayStreamEmit(private_data, array);
+    }
+  }
+}
+
+static int ArrowRebatchArrayStreamGetNext(struct ArrowArrayStream* array_stream,
+                                          struct ArrowArray* array) {
+  if (array_stream == NULL || array_stream->release == NULL) {
+    return EINVAL;
+  }
+
+  struct RebatchArrayStreamPrivate* private_data =
+      (struct RebatchArrayStreamPrivate*)array_stream->private_data;
+  private_data->error.message[0] = '\0';
+  return ArrowRebatchArrayStreamGetNextInternal(private_data, array);
+}
+
+static const char* ArrowRebatchArrayStreamGetLastError(
+    struct ArrowArrayStream* array_stream) {
+  if (array_stream == NULL || array_stream->release == NULL) {
+    return NULL;
+  }
+
+  struct RebatchArrayStreamPrivate* private_data =
+      (struct RebatchArrayStreamPrivate*)array_stream->private_data;
+  return private_data->error.message;
+}
+
+static void ArrowRebatchArrayStreamRelease(struct ArrowArrayStream* array_stream) {
+  if (array_stream == NULL || array_stream->release == NULL) {
+    return;
+  }
+
+  struct RebatchArrayStreamPrivate* private_data =
+      (struct RebatchArrayStreamPrivate*)array_stream->private_data;
+
+  ArrowRebatchArrayStreamReleasePending(private_data);
+  ArrowBufferReset(&private_data->pending);
+  ArrowBufferReset(&private_data->pending_pointers);
+
+  if (private_data->current.release != NULL) {
+    private_data->current.release(&private_data->current);
+  }
+
+  if (private_data->schema.release != NULL) {
+    private_data->schema.release(&private_data->schema);
+  }
+
+  if (private_data->input.release != NULL) {
+    private_data->input.release(&private_data->input);
+  }
+
+  ArrowFree(private_data);
+  array_stream->release = NULL;
+}
+
+ArrowErrorCode ArrowRebatchArrayStreamInit(struct ArrowArrayStream* array_stream,
+                                           struct ArrowArrayStream* input,
+                                           int64_t target_length,
+                                           struct ArrowError* error) {
+  if (target_length <= 0) {
+    ArrowErrorSet(error, "Expected target_length > 0 but found %ld",
+                  (long)target_length);
+    return EINVAL;
+  }
+
+  // The schema is required to concatenate arrays
+  struct ArrowSchema schema;
+  int result = input->get_schema(input, &schema);
+  if (result != NANOARROW_OK) {
+    const char* message = input->get_last_error(input);
+    ArrowErrorSet(error, "get_schema() failed: %s", message == NULL ? "" : message);
+    return result;
+  }
+
+  struct RebatchArrayStreamPrivate* private_data =
+      (struct RebatchArrayStreamPrivate*)ArrowMalloc(
+          sizeof(struct RebatchArrayStreamPrivate));
+  if (private_data == NULL) {
+    schema.release(&schema);
+    ArrowErrorSet(error, "Failed to allocate RebatchArrayStreamPrivate");
+    return ENOMEM;
+  }
+
+  ArrowArrayStreamMove(input, &private_data->input);
+  ArrowSchemaMove(&schema, &private_data->schema);
+  private_data->target_length = target_length;
+  private_data->current.release = NULL;
+  private_data->current_offset = 0;
+  ArrowBufferInit(&private_data->pending);
+  ArrowBufferInit(&private_data->pending_pointers);
+  private_data->pending_length = 0;
+  private_data->error.message[0] = '\0';
+
+  array_stream->get_schema = &ArrowRebatchArrayStreamGetSchema;
+  array_stream->get_next = &ArrowRebatchArrayStreamGetNext;
+  array_stream->get_last_error = &ArrowRebatchArrayStreamGetLastError;
+  array_stream->release = &ArrowRebatchArrayStreamRelease;
+  array_stream->private_data = private_data;
+  return NANOARROW_OK;
+}
+
+struct InstrumentedArrayStreamPrivate {
+  struct ArrowArrayStream input;
+  struct ArrowArrayStreamInstrumentation instrumentation;
+  struct ArrowArrayView array_view;
+  struct ArrowArrayStreamStats stats;
+  int64_t n_calls;
+};
+
+// The number of buffer bytes referenced by an ArrowArrayView whose buffer sizes
+// are all known (e.g., after ArrowArrayViewSetArray())
+static int64_t ArrowArrayViewReferencedBytes(struct ArrowArrayView* array_view) {
+  int64_t n_bytes = 0;
+  for (int i = 0; i < 3; i++) {
+    if (array_view->buffer_views[i].size_bytes > 0) {
+      n_bytes += array_view->buffer_views[i].size_bytes;
+    }
+  }
+
+  for (int64_t i = 0; i < array_view->n_variadic_buffers; i++) {
+    n_bytes += array_view->variadic_buffer_sizes[i] + (int64_t)sizeof(int64_t);
+  }
+
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    n_bytes += ArrowArrayViewReferencedBytes(array_view->children[i]);
+  }
+
+  if (array_view->dictionary != NULL) {
+    n_bytes += ArrowArrayViewReferencedBytes(array_view->dictionary);
+  }
+
+  return n_bytes;
+}
+
+static int ArrowInstrumentedArrayStreamGetSchema(struct ArrowArrayStream* array_stream,
+                                                 struct ArrowSchema* schema) {
+  if (array_stream == NULL || array_stream->release == NULL) {
+    return EINVAL;
+  }
+
+  struct InstrumentedArrayStreamPrivate* private_data =
+      (struct InstrumentedArrayStreamPrivate*)array_stream->private_data;
+  return private_data->input.get_schema(&private_data->input, schema);
+}
+
+static int ArrowInstrumentedArrayStreamGetNext(struct ArrowArrayStream* array_stream,
+                                               struct ArrowArray* array) {
+  if (array_stream == NULL || array_stream->release == NULL) {
+    return EINVAL;
+  }
+
+  struct InstrumentedArrayStreamPrivate* private_data =
+      (struct InstrumentedArrayStreamPrivate*)array_stream->private_data;
+  struct ArrowArrayStreamInstrumentation* instrumentation =
+      &private_data->instrumentation;
+
+  struct ArrowArrayStreamSpan span;
+  span.call_index = private_data->n_calls++;
+  span.start_ns = 0;
+  span.end_ns = 0;
+  span.n_rows = -1;
+  span.n_bytes = -1;
+
+  if (instrumentation->now_ns != NULL) {
+    span.start_ns = instrumentation->now_ns(instrumentation);
+  }
+
+  span.code = private_data->input.get_next(&private_data->input, array);
+
+  if (instrumentation->now_ns != NULL) {
+    span.end_ns = instrumentation->now_ns(instrumentation);
+    private_data->stats.get_next_ns += span.end_ns - span.start_ns;
+  }
+
+  if (span.code != NANOARROW_OK) {
+    private_data->stats.n_errors++;
+  } else if (array->release != NULL) {
+    span.n_rows = array->length;
+    private_data->stats.n_batches++;
+    private_data->stats.n_rows += array->length;
+
+    // An array whose buffer sizes can't be determined is passed on uncounted so
+    // that the instrumentation never changes the behaviour of the stream
+    if (instrumentation->count_bytes &&
+        ArrowArrayViewSetArray(&private_data->array_view, array, NULL) ==
+            NANOARROW_OK) {
+      span.n_bytes = ArrowArrayViewReferencedBytes(&private_data->array_view);
+      private_data->stats.n_bytes += span.n_bytes;
+      if (span.n_bytes > private_data->stats.max_batch_bytes) {
+        private_data->stats.max_batch_bytes = span.n_bytes;
+      }
+    }
+  }
+
+  if (instrumentation->on_span != NULL) {
+    instrumentation->on_span(instrumentation, &span);
+  }
+
+  return span.code;
+}
+
+static const char* ArrowInstrumentedArrayStreamGetLastError(
+    struct ArrowArrayStream* array_stream) {
+  if (array_stream == NULL || array_stream->release == NULL) {
+    return NULL;
+  }
+
+  struct InstrumentedArrayStreamPrivate* private_data =
+      (struct InstrumentedArrayStreamPrivate*)array_stream->private_data;
+  return private_data->input.get_last_error(&private_data->input);
+}
+
+static void ArrowInstrumentedArrayStreamRelease(struct ArrowArrayStream* array_stream) {
+  if (array_stream == NULL || array_stream->release == NULL) {
+    return;
+  }
+
+  struct InstrumentedArrayStreamPrivate* private_data =
+      (struct InstrumentedArrayStreamPrivate*)array_stream->private_data;
+  ArrowArrayViewReset(&private_data->array_view);
+  if (private_data->input.release != NULL) {
+    private_data->input.release(&private_data->input);
+  }
+
+  ArrowFree(private_data);
+  array_stream->release = NULL;
+}
+
+ArrowErrorCode ArrowInstrumentedArrayStreamInit(
+    struct ArrowArrayStream* array_stream, struct ArrowArrayStream* input,
+    struct ArrowArrayStreamInstrumentation* instrumentation, struct ArrowError* error) {
+  struct InstrumentedArrayStreamPrivate* private_data =
+      (struct InstrumentedArrayStreamPrivate*)ArrowMalloc(
+          sizeof(struct InstrumentedArrayStreamPrivate));
+  if (private_data == NULL) {
+    ArrowErrorSet(error, "Failed to allocate InstrumentedArrayStreamPrivate");
+    return ENOMEM;
+  }
+
+  memset(private_data, 0, sizeof(struct InstrumentedArrayStreamPrivate));
+  if (instrumentation != NULL) {
+    private_data->instrumentation = *instrumentation;
+  }
+
+  ArrowArrayViewInitFromType(&private_data->array_view, NANOARROW_TYPE_UNINITIALIZED);
+
+  // The schema is only needed to count bytes
+  if (private_data->instrumentation.count_bytes) {
+    struct ArrowSchema schema;
+    int result = input->get_schema(input, &schema);
+    if (result != NANOARROW_OK) {
+      const char* message = input->get_last_error(input);
+      ArrowErrorSet(error, "get_schema() failed: %s", message == NULL ? "" : message);
+      ArrowFree(private_data);
+      return result;
+    }
+
+    result = ArrowArrayViewInitFromSchema(&private_data->array_view, &schema, error);
+    schema.release(&schema);
+    if (result != NANOARROW_OK) {
+      ArrowFree(private_data);
+      return result;
+    }
+  }
+
+  ArrowArrayStreamMove(input, &private_data->input);
+
+  array_stream->get_schema = &ArrowInstrumentedArrayStreamGetSchema;
+  array_stream->get_next = &ArrowInstrumentedArrayStreamGetNext;
+  array_stream->get_last_error = &ArrowInstrumentedArrayStreamGetLastError;
+  array_stream->release = &ArrowInstrumentedArrayStreamRelease;
+  array_stream->private_data = private_data;
+  return NANOARROW_OK;
+}
+
+void ArrowInstrumentedArrayStreamGetStats(struct ArrowArrayStream* array_stream,
+                                          struct ArrowArrayStreamStats* out) {
+  struct InstrumentedArrayStreamPrivate* private_data =
+      (struct InstrumentedArrayStreamPrivate*)array_stream->private_data;
+  *out = private_data->stats;
+}
+
+struct SpillingArrayStreamEntry {
+  // Released if the array was spilled
+  struct ArrowArray array;
+  int64_t n_bytes;
+  int64_t spill_offset;
+  int64_t spill_size_bytes;
+};
+
+struct SpillingArrayStreamPrivate {
+  struct ArrowSchema schema;
+  struct ArrowArrayView array_view;
+  int64_t memory_budget_bytes;
+  char* spill_directory;
+  struct ArrowBuffer queue;
+  int64_t queue_offset;
+  struct ArrowBuffer block;
+  FILE* spill_file;
+  int64_t spill_file_size;
+  int64_t spill_alignment;
+  char finished;
+  struct ArrowSpillingArrayStreamStats stats;
+  struct ArrowError error;
+};
+
+static int64_t ArrowSpillingArrayStreamQueueLength(
+    struct SpillingArrayStreamPrivate* private_data) {
+  return private_data->queue.size_bytes /
+             (int64_t)sizeof(struct SpillingArrayStreamEntry) -
+         private_data->queue_offset;
+}
+
+// The spill file is unlinked (or created with tmpfile()) such that it is removed
+// when it is closed. Arrays mapped from it remain valid after that.
+static ArrowErrorCode ArrowSpillingArrayStreamOpenFile(
+    struct SpillingArrayStreamPrivate* private_data, struct ArrowError* error) {
+  if (private_data->spill_directory == NULL) {
+    private_data->spill_file = tmpfile();
+    if (private_data->spill_file == NULL) {
+      ArrowErrorSet(error, "tmpfile() failed: %s", strerror(errno));
+      return errno != 0 ? errno : EIO;
+    }
+
+    return NANOARROW_OK;
+  }
+
+#if NANOARROW_HAVE_MMAP
+  const char* name = "/nanoarrow-spill-XXXXXX";
+  size_t directory_size = strlen(private_data->spill_directory);
+  char* path = (char*)ArrowMalloc(directory_size + strlen(name) + 1);
+  if (path == NULL) {
+    ArrowErrorSet(error, "Failed to allocate spill file path");
+    return ENOMEM;
+  }
+
+  memcpy(path, private_data->spill_directory, directory_size);
+  memcpy(path + directory_size, name, strlen(name) + 1);
+  int file_descriptor = mkstemp(path);
+  if (file_descriptor == -1) {
+    int result = errno;
+    ArrowErrorSet(error, "mkstemp('%s') failed: %s", path, strerror(result));
+    ArrowFree(path);
+    return result;
+  }
+
+  unlink(path);
+  ArrowFree(path);
+  private_data->spill_file = fdopen(file_descriptor, "w+b");
+  if (private_data->spill_file == NULL) {
+    int result = errno;
+    ArrowErrorSet(error, "fdopen() failed: %s", strerror(result));
+    close(file_descriptor);
+    return result;
+  }
+
+  return NANOARROW_OK;
+#else
+  ArrowErrorSet(error, "spill_directory is not supported on this platform");
+  return ENOTSUP;
+#endif
+}
+
+// fseek() takes a long, which is 32 bits on Windows and 32-bit platforms
+static int ArrowSpillingArrayStreamSeek(FILE* file, int64_t offset) {
+#if defined(_WIN32)
+  return _fseeki64(file, offset, SEEK_SET);
+#elif NANOARROW_HAVE_MMAP
+  return fseeko(file, (off_t)offset, SEEK_SET);
+#else
+  if (offset > LONG_MAX) {
+    errno = EOVERFLOW;
+    return -1;
+  }
+
+  return fseek(file, (long)offset, SEEK_SET);
+#endif
+}
+
+static ArrowErrorCode ArrowSpillingArrayStreamSpill(
+    struct SpillingArrayStreamPrivate* private_data,
+    struct SpillingArrayStreamEntry* entry, struct ArrowError* error) {
+  if (private_data->spill_file == NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowSpillingArrayStreamOpenFile(private_data, error));
+  }
+
+  private_data->block.size_bytes = 0;
+  NANOARROW_RETURN_NOT_OK(ArrowArrayWriteRelocatable(
+      &private_data->schema, &entry->array, &private_data->block, error));
+
+  // Blocks start at a multiple of the page size such that they can be mapped
+  static const uint8_t kZeroes[512] = {0};
+  int64_t padding =
+      (private_data->spill_alignment -
+       private_data->spill_file_size % private_data->spill_alignment) %
+      private_data->spill_alignment;
+  int result = ArrowSpillingArrayStreamSeek(private_data->spill_file,
+                                            private_data->spill_file_size);
+  while (result == 0 && padding > 0) {
+    size_t chunk_size = padding < (int64_t)sizeof(kZeroes) ? (size_t)padding
+                                                           : sizeof(kZeroes);
+    if (fwrite(kZeroes, 1, chunk_size, private_data->spill_file) != chunk_size) {
+      result = -1;
+    }
+
+    padding -= (int64_t)chunk_size;
+    private_data->spill_file_size += (int64_t)chunk_size;
+  }
+
+  if (result == 0 &&
+      fwrite(private_data->block.data, 1, (size_t)private_data->block.size_bytes,
+             private_data->spill_file) != (size_t)private_data->block.size_bytes) {
+    result = -1;
+  }
+
+  if (result == 0) {
+    result = fflush(private_data->spill_file);
+  }
+
+  if (result != 0) {
+    result = errno != 0 ? errno : EIO;
+    ArrowErrorSet(error, "Failed to write %ld bytes to spill file: %s",
+                  (long)private_data->block.size_bytes, strerror(result));
+    return result;
+  }
+
+  entry->spill_offset = private_data->spill_file_size;
+  entry->spill_size_bytes = private_data->block.size_bytes;
+  private_data->spill_file_size += private_data->block.size_bytes;
+  private_data->stats.n_batches_spilled++;
+  private_data->stats.n_bytes_spilled += private_data->block.size_bytes;
+  entry->array.release(&entry->array);
+  return NANOARROW_OK;
+}
+
+#if NANOARROW_HAVE_MMAP
+static void ArrowSpillingArrayStreamUnmap(struct ArrowBufferAllocator* allocator,
+                                          uint8_t* ptr, int64_t size) {
+  munmap(ptr, (size_t)size);
+}
+#endif
+
+static ArrowErrorCode ArrowSpillingArrayStreamReadBack(
+    struct SpillingArrayStreamPrivate* private_data,
+    struct SpillingArrayStreamEntry* entry, struct ArrowArray* array) {
+  struct ArrowBuffer block;
+  ArrowBufferInit(&block);
+
+#if NANOARROW_HAVE_MMAP
+  // A private mapping lets the reader fix up pointers without touching the file
+  void* ptr = mmap(NULL, (size_t)entry->spill_size_bytes, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE, fileno(private_data->spill_file),
+                   (off_t)entry->spill_offset);
+  if (ptr == MAP_FAILED) {
+    ArrowErrorSet(&private_data->error, "mmap() of %ld bytes failed: %s",
+                  (long)entry->spill_size_bytes, strerror(errno));
+    return errno;
+  }
+
+  ArrowBufferSetAllocator(&block,
+                          ArrowBufferDeallocator(&ArrowSpillingArrayStreamUnmap, NULL));
+  // The deallocator is passed capacity_bytes as the length to unmap
+  block.data = (uint8_t*)ptr;
+  block.size_bytes = entry->spill_size_bytes;
+  block.capacity_bytes = entry->spill_size_bytes;
+#else
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(&block, entry->spill_size_bytes));
+  if (ArrowSpillingArrayStreamSeek(private_data->spill_file, entry->spill_offset) != 0 ||
+      fread(block.data, 1, (size_t)entry->spill_size_bytes, private_data->spill_file) !=
+          (size_t)entry->spill_size_bytes) {
+    ArrowErrorSet(&private_data->error, "Failed to read %ld bytes from spill file",
+                  (long)entry->spill_size_bytes);
+    ArrowBufferReset(&block);
+    return EIO;
+  }
+
+  block.size_bytes = entry->spill_size_bytes;
+#endif
+
+  int result = ArrowArrayReadRelocatable(&block, NULL, array, &private_data->error);
+  ArrowBufferReset(&block);
+  return result;
+}
+
+static int ArrowSpillingArrayStreamGetSchema(struct ArrowArrayStream* array_stream,
+                                             struct ArrowSchema* schema) {
+  if (array_stream == NULL || array_stream->release == NULL) {
+    return EINVAL;
+  }
+
+  struct SpillingArrayStreamPrivate* private_data =
+      (struct SpillingArrayStreamPrivate*)array_stream->private_data;
+  return ArrowSchemaDeepCopy(&private_data->schema, schema);
+}
+
+static int ArrowSpillingArrayStreamGetNext(struct ArrowArrayStream* array_stream,
+                                           struct ArrowArray* array) {
+  if (array_stream == NULL || array_stream->release == NULL) {
+    return EINVAL;
+  }
+
+  struct SpillingArrayStreamPrivate* private_data =
+      (struct SpillingArrayStreamPrivate*)array_stream->private_data;
+  if (ArrowSpillingArrayStreamQueueLength(private_data) == 0) {
+    if (private_data->finished) {
+      array->release = NULL;
+      return NANOARROW_OK;
+    }
+
+    ArrowErrorSet(&private_data->error, "No array is available yet");
+    return EAGAIN;
+  }
+
+  struct SpillingArrayStreamEntry* entry =
+      (struct SpillingArrayStreamEntry*)private_data->queue.data +
+      private_data->queue_offset;
+  if (entry->array.release != NULL) {
+    ArrowArrayMove(&entry->array, array);
+    private_data->stats.memory_bytes -= entry->n_bytes;
+  } else {
+    NANOARROW_RETURN_NOT_OK(ArrowSpillingArrayStreamReadBack(private_data, entry, array));
+  }
+
+  private_data->queue_offset++;
+  if (ArrowSpillingArrayStreamQueueLength(private_data) == 0) {
+    private_data->queue.size_bytes = 0;
+    private_data->queue_offset = 0;
+  }
+
+  return NANOARROW_OK;
+}
+
+static const char* ArrowSpillingArrayStreamGetLastError(
+    struct ArrowArrayStream* array_stream) {
+  if (array_stream == NULL || array_stream->release == NULL) {
+    return NULL;
+  }
+
+  struct SpillingArrayStreamPrivate* private_data =
+      (struct SpillingArrayStreamPrivate*)array_stream->private_data;
+  return private_data->error.message;
+}
+
+static void ArrowSpillingArrayStreamRelease(struct ArrowArrayStream* array_stream) {
+  if (array_stream == NULL || array_stream->release == NULL) {
+    return;
+  }
+
+  struct SpillingArrayStreamPrivate* private_data =
+      (struct SpillingArrayStreamPrivate*)array_stream->private_data;
+  struct SpillingArrayStreamEntry* queue =
+      (struct SpillingArrayStreamEntry*)private_data->queue.data;
+  int64_t n_queued =
+      private_data->queue.size_bytes / (int64_t)sizeof(struct SpillingArrayStreamEntry);
+  for (int64_t i = private_data->queue_offset; i < n_queued; i++) {
+    if (queue[i].array.release != NULL) {
+      queue[i].array.release(&queue[i].array);
+    }
+  }
+
+  ArrowBufferReset(&private_data->queue);
+  ArrowBufferReset(&private_data->block);
+  ArrowArrayViewReset(&private_data->array_view);
+  if (private_data->spill_file != NULL) {
+    fclose(private_data->spill_file);
+  }
+
+  if (private_data->spill_directory != NULL) {
+    ArrowFree(private_data->spill_directory);
+  }
+
+  if (private_data->schema.release != NULL) {
+    private_data->schema.release(&private_data->schema);
+  }
+
+  ArrowFree(private_data);
+  array_stream->release = NULL;
+}
+
+ArrowErrorCode ArrowSpillingArrayStreamInit(
+    struct ArrowArrayStream* array_stream, struct ArrowSchema* schema,
+    const struct ArrowSpillingArrayStreamOptions* options, struct ArrowError* error) {
+  struct SpillingArrayStreamPrivate* private_data =
+      (struct SpillingArrayStreamPrivate*)ArrowMalloc(
+          sizeof(struct SpillingArrayStreamPrivate));
+  if (private_data == NULL) {
+    ArrowErrorSet(error, "Failed to allocate SpillingArrayStreamPrivate");
+    return ENOMEM;
+  }
+
+  memset(private_data, 0, sizeof(struct SpillingArrayStreamPrivate));
+  ArrowBufferInit(&private_data->queue);
+  ArrowBufferInit(&private_data->block);
+  private_data->memory_budget_bytes = options->memory_budget_bytes;
+  private_data->spill_alignment = 64;
+#if NANOARROW_HAVE_MMAP
+  private_data->spill_alignment = (int64_t)sysconf(_SC_PAGESIZE);
+#endif
+
+  int result = ArrowArrayViewInitFromSchema(&private_data->array_view, schema, error);
+  if (result == NANOARROW_OK && options->spill_directory != NULL) {
+    size_t directory_size = strlen(options->spill_directory) + 1;
+    private_data->spill_directory = (char*)ArrowMalloc(directory_size);
+    if (private_data->spill_directory == NULL) {
+      ArrowErrorSet(error, "Failed to allocate spill_directory");
+      result = ENOMEM;
+    } else {
+      memcpy(private_data->spill_directory, options->spill_directory, directory_size);
+    }
+  }
+
+  if (result != NANOARROW_OK) {
+    ArrowArrayViewReset(&private_data->array_view);
+    ArrowFree(private_data);
+    return result;
+  }
+
+  ArrowSchemaMove(schema, &private_data->schema);
+
+  array_stream->get_schema = &ArrowSpillingArrayStreamGetSchema;
+  array_stream->get_next = &ArrowSpillingArrayStreamGetNext;
+  array_stream->get_last_error = &ArrowSpillingArrayStreamGetLastError;
+  array_stream->release = &ArrowSpillingArrayStreamRelease;
+  array_stream->private_data = private_data;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowSpillingArrayStreamPush(struct ArrowArrayStream* array_stream,
+                                            struct ArrowArray* array,
+                                            struct ArrowError* error) {
+  struct SpillingArrayStreamPrivate* private_data =
+      (struct SpillingArrayStreamPrivate*)array_stream->private_data;
+  if (private_data->finished) {
+    ArrowErrorSet(error, "Can't push to a finished stream");
+    return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK(
+      ArrowArrayViewSetArray(&private_data->array_view, array, error));
+  int64_t n_bytes = ArrowArrayViewReferencedBytes(&private_data->array_view);
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferReserve(&private_data->queue, sizeof(struct SpillingArrayStreamEntry)),
+      error);
+
+  struct SpillingArrayStreamEntry* entry =
+      (struct SpillingArrayStreamEntry*)(private_data->queue.data +
+                                         private_data->queue.size_bytes);
+  ArrowArrayMove(array, &entry->array);
+  entry->n_bytes = n_bytes;
+  entry->spill_offset = -1;
+  entry->spill_size_bytes = 0;
+
+  // Arrays that would exceed the budget are spilled in the order that they arrive
+  // such that reading them back preserves the order of the stream
+  if ((private_data->stats.memory_bytes + n_bytes) >
+      private_data->memory_budget_bytes) {
+    int result = ArrowSpillingArrayStreamSpill(private_data, entry, error);
+    if (result != NANOARROW_OK) {
+      ArrowArrayMove(&entry->array, array);
+      return result;
+    }
+  } else {
+    private_data->stats.memory_bytes += n_bytes;
+    if (private_data->stats.memory_bytes > private_data->stats.max_memory_bytes) {
+      private_data->stats.max_memory_bytes = private_data->stats.memory_bytes;
+    }
+  }
+
+  private_data->queue.size_bytes += sizeof(struct SpillingArrayStreamEntry);
+  private_data->stats.n_batches++;
+  return NANOARROW_OK;
+}
+
+void ArrowSpillingArrayStreamFinish(struct ArrowArrayStream* array_stream) {
+  struct SpillingArrayStreamPrivate* private_data =
+      (struct SpillingArrayStreamPrivate*)array_stream->private_data;
+  private_data->finished = 1;
+}
+
+void ArrowSpillingArrayStreamGetStats(struct ArrowArrayStream* array_stream,
+                                      struct ArrowSpillingArrayStreamStats* out) {
+  struct SpillingArrayStreamPrivate* private_data =
+      (struct SpillingArrayStreamPrivate*)array_stream->private_data;
+  *out = private_data->stats;
+}
+
+struct AsyncFromStreamPrivate {
+  struct ArrowArrayStream stream;
+  struct ArrowAsyncArrayStreamHandler handler;
+  struct ArrowAsyncProducer producer;
+  int64_t n_requested;
+  char delivering;
+  char done;
+};
+
+static void ArrowAsyncFromStreamFinish(struct AsyncFromStreamPrivate* private_data) {
+  private_data->handler.release(&private_data->handler);
+  private_data->stream.release(&private_data->stream);
+  ArrowFree(private_data);
+}
+
+// Delivers requested arrays until there are no more outstanding requests or
+// the stream is done. Requests made from within on_next() only increment
+// n_requested (i.e., they are handled by this loop rather than recursively).
+static void ArrowAsyncFromStreamDeliver(struct AsyncFromStreamPrivate* private_data) {
+  private_data->delivering = 1;
+  while (!private_data->done && private_data->n_requested > 0) {
+    struct ArrowArray array;
+    int result = private_data->stream.get_next(&private_data->stream, &array);
+    if (result != NANOARROW_OK) {
+      const char* message = private_data->stream.get_last_error(&private_data->stream);
+      private_data->handler.on_error(&private_data->handler, result,
+                                     message == NULL ? "" : message);
+      private_data->done = 1;
+      break;
+    }
+
+    private_data->n_requested--;
+    char is_end = array.release == NULL;
+    result = private_data->handler.on_next(&private_data->handler, &array);
+    if (result != NANOARROW_OK || is_end) {
+      private_data->done = 1;
+    }
+  }
+  private_data->delivering = 0;
+
+  if (private_data->done) {
+    ArrowAsyncFromStreamFinish(private_data);
+  }
+}
+
+static void ArrowAsyncFromStreamRequest(struct ArrowAsyncProducer* producer, int64_t n) {
+  struct AsyncFromStreamPrivate* private_data =
+      (struct AsyncFromStreamPrivate*)producer->private_data;
+  if (private_data->done || n <= 0) {
+    return;
+  }
+
+  private_data->n_requested += n;
+  if (!private_data->delivering) {
+    ArrowAsyncFromStreamDeliver(private_data);
+  }
+}
+
+static void ArrowAsyncFromStreamCancel(struct ArrowAsyncProducer* producer) {
+  struct AsyncFromStreamPrivate* private_data =
+      (struct AsyncFromStreamPrivate*)producer->private_data;
+  private_data->done = 1;
+  if (!private_data->delivering) {
+    ArrowAsyncFromStreamFinish(private_data);
+  }
+}
+
+ArrowErrorCode ArrowArrayStreamToAsync(struct ArrowArrayStream* array_stream,
+                                       struct ArrowAsyncArrayStreamHandler* handler,
+                                       struct ArrowError* error) {
+  struct ArrowSchema schema;
+  int result = array_stream->get_schema(array_stream, &schema);
+  if (result != NANOARROW_OK) {
+    const char* message = array_stream->get_last_error(array_stream);
+    ArrowErrorSet(error, "get_schema() failed: %s", message == NULL ? "" : message);
+    return result;
+  }
+
+  struct AsyncFromStreamPrivate* private_data =
+      (struct AsyncFromStreamPrivate*)ArrowMalloc(sizeof(struct AsyncFromStreamPrivate));
+  if (private_data == NULL) {
+    schema.release(&schema);
+    ArrowErrorSet(error, "Failed to allocate AsyncFromStreamPrivate");
+    return ENOMEM;
+  }
+
+  ArrowArrayStreamMove(array_stream, &private_data->stream);
+  memcpy(&private_data->handler, handler, sizeof(struct ArrowAsyncArrayStreamHandler));
+  handler->release = NULL;
+  private_data->producer.request = &ArrowAsyncFromStreamRequest;
+  private_data->producer.cancel = &ArrowAsyncFromStreamCancel;
+  private_data->producer.private_data = private_data;
+  private_data->n_requested = 0;
+  private_data->done = 0;
+
+  // Requests made from within on_schema() are deferred until it returns
+  private_data->delivering = 1;
+  result = private_data->handler.on_schema(&private_data->handler,
+                                           &private_data->producer, &schema);
+  if (result != NANOARROW_OK) {
+    private_data->done = 1;
+  }
+
+  ArrowAsyncFromStreamDeliver(private_data);
+  return NANOARROW_OK;
+}
+
+struct AsyncToStreamPrivate {
+  int64_t refcount;
+  struct ArrowAsyncProducer* producer;
+  struct ArrowSchema schema;
+  struct ArrowBuffer queue;
+  int64_t queue_offset;
+  int64_t n_outstanding;
+  char finished;
+  char stream_released;
+  int error_code;
+  struct ArrowError error;
+};
+
+static int64_t ArrowAsyncToStreamQueueLength(struct AsyncToStreamPrivate* private_data) {
+  return private_data->queue.size_bytes / (int64_t)sizeof(struct ArrowArray) -
+         private_data->queue_offset;
+}
+
+static void ArrowAsyncToStreamDecref(struct AsyncToStreamPrivate* private_data) {
+  private_data->refcount--;
+  if (private_data->refcount > 0) {
+    return;
+  }
+
+  struct ArrowArray* queue = (struct ArrowArray*)private_data->queue.data;
+  int64_t n_queued = private_data->queue.size_bytes / (int64_t)sizeof(struct ArrowArray);
+  for (int64_t i = private_data->queue_offset; i < n_queued; i++) {
+    queue[i].release(queue + i);
+  }
+  ArrowBufferReset(&private_data->queue);
+
+  if (private_data->schema.release != NULL) {
+    private_data->schema.release(&private_data->schema);
+  }
+
+  ArrowFree(private_data);
+}
+
+static int ArrowAsyncToStreamOnSchema(struct ArrowAsyncArrayStreamHandler* handler,
+                                      struct ArrowAsyncProducer* producer,
+                                      struct ArrowSchema* schema) {
+  struct AsyncToStreamPrivate* private_data =
+      (struct AsyncToStreamPrivate*)handler->private_data;
+  if (private_data->stream_released) {
+    schema->release(schema);
+    return ECANCELED;
+  }
+
+  private_data->producer = producer;
+  ArrowSchemaMove(schema, &private_data->schema);
+  return NANOARROW_OK;
+}
+
+static int ArrowAsyncToStreamOnNext(struct ArrowAsyncArrayStreamHandler* handler,
+                                    struct ArrowArray* array) {
+  struct AsyncToStreamPrivate* private_data =
+      (struct AsyncToStreamPrivate*)handler->private_data;
+  if (private_data->n_outstanding > 0) {
+    private_data->n_outstanding--;
+  }
+
+  if (array->release == NULL) {
+    private_data->finished = 1;
+    return NANOARROW_OK;
+  }
+
+  if (private_data->stream_released) {
+    array->release(array);
+    return ECANCELED;
+  }
+
+  int result =
+      ArrowBufferAppend(&private_data->queue, array, sizeof(struct ArrowArray));
+  if (result != NANOARROW_OK) {
+    array->release(array);
+    private_data->error_code = result;
+    ArrowErrorSet(&private_data->error, "Failed to enqueue array");
+    return result;
+  }
+
+  array->release = NULL;
+  return NANOARROW_OK;
+}
+
+static void ArrowAsyncToStreamOnError(struct ArrowAsyncArrayStreamHandler* handler,
+                                      int code, const char* message) {
+  struct AsyncToStreamPrivate* private_data =
+      (struct AsyncToStreamPrivate*)handler->private_data;
+  private_data->error_code = code;
+  ArrowErrorSet(&private_data->error, "%s", message);
+}
+
+static void ArrowAsyncToStreamHandlerRelease(
+    struct ArrowAsyncArrayStreamHandler* handler) {
+  struct AsyncToStreamPrivate* private_data =
+      (struct AsyncToStreamPrivate*)handler->private_data;
+  private_data->producer = NULL;
+
+  // Make sure a consumer that is still waiting for arrays does not wait forever
+  if (!private_data->finished && private_data->error_code == NANOARROW_OK) {
+    private_data->error_code = ECANCELED;
+    ArrowErrorSet(&private_data->error, "Producer stopped before the end of the stream");
+  }
+
+  handler->release = NULL;
+  ArrowAsyncToStreamDecref(private_data);
+}
+
+static int ArrowAsyncToStreamGetSchema(struct ArrowArrayStream* array_stream,
+                                       struct ArrowSchema* schema) {
+  if (array_stream == NULL || array_stream->release == NULL) {
+    return EINVAL;
+  }
+
+  struct AsyncToStreamPrivate* private_data =
+      (struct AsyncToStreamPrivate*)array_stream->private_data;
+  if (private_data->schema.release != NULL) {
+    return ArrowSchemaDeepCopy(&private_data->schema, schema);
+  } else if (private_data->error_code != NANOARROW_OK) {
+    return private_data->error_code;
+  }
+
+  ArrowErrorSet(&private_data->error, "Schema has not yet been received");
+  return EAGAIN;
+}
+
+static int ArrowAsyncToStreamPop(struct AsyncToStreamPrivate* private_data,
+                                 struct ArrowArray* array) {
+  if (ArrowAsyncToStreamQueueLength(private_data) > 0) {
+    struct ArrowArray* queue = (struct ArrowArray*)private_data->queue.data;
+    ArrowArrayMove(queue + private_data->queue_offset, array);
+    private_data->queue_offset++;
+    if (ArrowAsyncToStreamQueueLength(private_data) == 0) {
+      private_data->queue.size_bytes = 0;
+      private_data->queue_offset = 0;
+    }
+    return NANOARROW_OK;
+  } else if (private_data->finished) {
+    array->release = NULL;
+    return NANOARROW_OK;
+  } else if (private_data->error_code != NANOARROW_OK) {
+    return private_data->error_code;
+  }
+
+  return EAGAIN;
+}
+
+static int ArrowAsyncToStreamGetNext(struct ArrowArrayStream* array_stream,
+                                     struct ArrowArray* array) {
+  if (array_stream == NULL || array_stream->release == NULL) {
+    return EINVAL;
+  }
+
+  struct AsyncToStreamPrivate* private_data =
+      (struct AsyncToStreamPrivate*)array_stream->private_data;
+  int result = ArrowAsyncToStreamPop(private_data, array);
+  if (result != EAGAIN) {
+    return result;
+  }
+
+  // Ask for one more array unless a request is already pending
+  if (private_data->producer != NULL && private_data->n_outstanding == 0) {
+    private_data->n_outstanding++;
+    private_data->producer->request(private_data->producer, 1);
+    result = ArrowAsyncToStreamPop(private_data, array);
+  }
+
+  if (result == EAGAIN) {
+    ArrowErrorSet(&private_data->error, "No array is available yet");
+  }
+
+  return result;
+}
+
+static const char* ArrowAsyncToStreamGetLastError(struct ArrowArrayStream* array_stream) {
+  if (array_stream == NULL || array_stream->release == NULL) {
+    return NULL;
+  }
+
+  struct AsyncToStreamPrivate* private_data =
+      (struct AsyncToStreamPrivate*)array_stream->private_data;
+  return private_data->error.message;
+}
+
+static void ArrowAsyncToStreamRelease(struct ArrowArrayStream* array_stream) {
+  if (array_stream == NULL || array_stream->release == NULL) {
+    return;
+  }
+
+  struct AsyncToStreamPrivate* private_data =
+      (struct AsyncToStreamPrivate*)array_stream->private_data;
+  private_data->stream_released = 1;
+
+  // The producer may release the handler before cancel() returns; however, the
+  // reference held by this stream keeps private_data valid until the Decref below.
+  if (private_data->producer != NULL) {
+    private_data->producer->cancel(private_data->producer);
+  }
+
+  array_stream->release = NULL;
+  ArrowAsyncToStreamDecref(private_data);
+}
+
+ArrowErrorCode ArrowArrayStreamInitFromAsync(
+    struct ArrowArrayStream* array_stream, struct ArrowAsyncArrayStreamHandler* handler) {
+  struct AsyncToStreamPrivate* private_data =
+      (struct AsyncToStreamPrivate*)ArrowMalloc(sizeof(struct AsyncToStreamPrivate));
+  if (private_data == NULL) {
+    return ENOMEM;
+  }
+
+  private_data->refcount = 2;
+  private_data->producer = NULL;
+  private_data->schema.release = NULL;
+  ArrowBufferInit(&private_data->queue);
+  private_data->queue_offset = 0;
+  private_data->n_outstanding = 0;
+  private_data->finished = 0;
+  private_data->stream_released = 0;
+  private_data->error_code = NANOARROW_OK;
+  private_data->error.message[0] = '\0';
+
+  handler->on_schema = &ArrowAsyncToStreamOnSchema;
+  handler->on_next = &ArrowAsyncToStreamOnNext;
+  handler->on_error = &ArrowAsyncToStreamOnError;
+  handler->release = &ArrowAsyncToStreamHandlerRelease;
+  handler->private_data = private_data;
+
+  array_stream->get_schema = &ArrowAsyncToStreamGetSchema;
+  array_stream->get_next = &ArrowAsyncToStreamGetNext;
+  array_stream->get_last_error = &ArrowAsyncToStreamGetLastError;
+  array_stream->release = &ArrowAsyncToStreamRelease;
+  array_stream->private_data = private_data;
+  return NANOARROW_OK;
+}
@@ -15,6 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "nanoarrow/nanoarrow.h"
@@ -58,6 +63,33 @@ TEST(ArrayStreamTest, ArrayStreamTestBasic) {
   EXPECT_EQ(array_stream.release, nullptr);
 }
 
+TEST(ArrayStreamTest, ArrayStreamTestShareSchema) {
+  struct ArrowArrayStream array_stream;
+  struct ArrowSchema schema;
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowBasicArrayStreamInit(&array_stream, &schema, 0), NANOARROW_OK);
+  ArrowBasicArrayStreamSetShareSchema(&array_stream, 1);
+
+  // Shared references point to the same nodes
+  struct ArrowSchema schema1;
+  struct ArrowSchema schema2;
+  ASSERT_EQ(array_stream.get_schema(&array_stream, &schema1), NANOARROW_OK);
+  ASSERT_EQ(array_stream.get_schema(&array_stream, &schema2), NANOARROW_OK);
+  EXPECT_STREQ(schema1.format, "+s");
+  EXPECT_EQ(schema1.children[0]->format, schema2.children[0]->format);
+  EXPECT_STREQ(schema2.children[0]->format, "i");
+
+  // References outlive the stream
+  array_stream.release(&array_stream);
+  schema1.release(&schema1);
+  EXPECT_STREQ(schema2.children[0]->format, "i");
+  schema2.release(&schema2);
+}
+
 TEST(ArrayStreamTest, ArrayStreamTestEmpty) {
   struct ArrowArrayStream array_stream;
   struct ArrowArray array;
@@ -123,3 +155,518 @@ TEST(ArrayStreamTest, ArrayStreamTestInvalid) {
 
   array_stream.release(&array_stream);
 }
+
+// Create a basic stream of int32 arrays with the given lengths whose values count
+// up from zero across arrays
+static void MakeCountingStream(struct ArrowArrayStream* array_stream,
+                               const std::vector<int64_t>& lengths) {
+  struct ArrowSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowBasicArrayStreamInit(array_stream, &schema, lengths.size()),
+            NANOARROW_OK);
+
+  int32_t value = 0;
+  for (size_t i = 0; i < lengths.size(); i++) {
+    struct ArrowArray array;
+    ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    for (int64_t j = 0; j < lengths[i]; j++) {
+      ASSERT_EQ(ArrowArrayAppendInt(&array, value++), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+    ArrowBasicArrayStreamSetArray(array_stream, i, &array);
+  }
+}
+
+TEST(ArrayStreamTest, ArrayStreamTestRebatch) {
+  struct ArrowArrayStream input;
+  struct ArrowArrayStream array_stream;
+  struct ArrowArrayView array_view;
+  struct ArrowArray array;
+  struct ArrowError error;
+
+  // Small arrays are combined and large arrays are split
+  MakeCountingStream(&input, {2, 0, 3, 11, 1, 3});
+  ASSERT_EQ(ArrowRebatchArrayStreamInit(&array_stream, &input, 4, &error), NANOARROW_OK);
+  EXPECT_EQ(input.release, nullptr);
+
+  struct ArrowSchema schema;
+  ASSERT_EQ(array_stream.get_schema(&array_stream, &schema), NANOARROW_OK);
+  EXPECT_STREQ(schema.format, "i");
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  schema.release(&schema);
+
+  std::vector<int64_t> lengths;
+  int32_t expected_value = 0;
+  while (true) {
+    ASSERT_EQ(array_stream.get_next(&array_stream, &array), NANOARROW_OK);
+    if (array.release == nullptr) {
+      break;
+    }
+
+    lengths.push_back(array.length);
+    ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+    for (int64_t i = 0; i < array.length; i++) {
+      EXPECT_EQ(ArrowArrayViewGetIntUnsafe(&array_view, i), expected_value++);
+    }
+
+    array.release(&array);
+  }
+
+  EXPECT_EQ(lengths, std::vector<int64_t>({4, 4, 4, 4, 4}));
+  EXPECT_EQ(expected_value, 20);
+
+  ArrowArrayViewReset(&array_view);
+  array_stream.release(&array_stream);
+
+  // The remainder is emitted at the end of the input
+  MakeCountingStream(&input, {5});
+  ASSERT_EQ(ArrowRebatchArrayStreamInit(&array_stream, &input, 3, &error), NANOARROW_OK);
+  ASSERT_EQ(array_stream.get_next(&array_stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.length, 3);
+  array.release(&array);
+  ASSERT_EQ(array_stream.get_next(&array_stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.offset, 3);
+  EXPECT_EQ(array.length, 2);
+  array.release(&array);
+  ASSERT_EQ(array_stream.get_next(&array_stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.release, nullptr);
+  array_stream.release(&array_stream);
+
+  MakeCountingStream(&input, {});
+  EXPECT_EQ(ArrowRebatchArrayStreamInit(&array_stream, &input, 0, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected target_length > 0 but found 0");
+  input.release(&input);
+}
+
+struct RecordingHandlerState {
+  struct ArrowAsyncProducer* producer;
+  std::vector<int64_t> lengths;
+  bool finished;
+  int error_code;
+  std::string error_message;
+  int on_next_result;
+  bool released;
+};
+
+static int RecordingHandlerOnSchema(struct ArrowAsyncArrayStreamHandler* self,
+                                    struct ArrowAsyncProducer* producer,
+                                    struct ArrowSchema* schema) {
+  auto state = reinterpret_cast<RecordingHandlerState*>(self->private_data);
+  state->producer = producer;
+  schema->release(schema);
+  producer->request(producer, 1);
+  return NANOARROW_OK;
+}
+
+static int RecordingHandlerOnNext(struct ArrowAsyncArrayStreamHandler* self,
+                                  struct ArrowArray* array) {
+  auto state = reinterpret_cast<RecordingHandlerState*>(self->private_data);
+  if (array->release == nullptr) {
+    state->finished = true;
+    return NANOARROW_OK;
+  }
+
+  state->lengths.push_back(array->length);
+  array->release(array);
+
+  // Requesting from within on_next() must not recurse into on_next()
+  state->producer->request(state->producer, 1);
+  return state->on_next_result;
+}
+
+static void RecordingHandlerOnError(struct ArrowAsyncArrayStreamHandler* self, int code,
+                                    const char* message) {
+  auto state = reinterpret_cast<RecordingHandlerState*>(self->private_data);
+  state->error_code = code;
+  state->error_message = message;
+}
+
+static void RecordingHandlerRelease(struct ArrowAsyncArrayStreamHandler* self) {
+  auto state = reinterpret_cast<RecordingHandlerState*>(self->private_data);
+  state->released = true;
+}
+
+static void InitRecordingHandler(struct ArrowAsyncArrayStreamHandler* handler,
+                                 RecordingHandlerState* state) {
+  state->producer = nullptr;
+  state->lengths.clear();
+  state->finished = false;
+  state->error_code = NANOARROW_OK;
+  state->on_next_result = NANOARROW_OK;
+  state->released = false;
+
+  handler->on_schema = &RecordingHandlerOnSchema;
+  handler->on_next = &RecordingHandlerOnNext;
+  handler->on_error = &RecordingHandlerOnError;
+  handler->release = &RecordingHandlerRelease;
+  handler->private_data = state;
+}
+
+static int FailingStreamGetSchema(struct ArrowArrayStream* array_stream,
+                                  struct ArrowSchema* schema) {
+  return ArrowSchemaInitFromType(schema, NANOARROW_TYPE_INT32);
+}
+
+static int FailingStreamGetNext(struct ArrowArrayStream* array_stream,
+                                struct ArrowArray* array) {
+  return EIO;
+}
+
+static const char* FailingStreamGetLastError(struct ArrowArrayStream* array_stream) {
+  return "upstream failed";
+}
+
+static void FailingStreamRelease(struct ArrowArrayStream* array_stream) {
+  array_stream->release = nullptr;
+}
+
+TEST(ArrayStreamTest, ArrayStreamTestToAsync) {
+  struct ArrowArrayStream input;
+  struct ArrowAsyncArrayStreamHandler handler;
+  RecordingHandlerState state;
+  struct ArrowError error;
+
+  MakeCountingStream(&input, {2, 0, 3});
+  InitRecordingHandler(&handler, &state);
+  ASSERT_EQ(ArrowArrayStreamToAsync(&input, &handler, &error), NANOARROW_OK);
+  EXPECT_EQ(input.release, nullptr);
+  EXPECT_EQ(handler.release, nullptr);
+
+  EXPECT_EQ(state.lengths, std::vector<int64_t>({2, 0, 3}));
+  EXPECT_TRUE(state.finished);
+  EXPECT_EQ(state.error_code, NANOARROW_OK);
+  EXPECT_TRUE(state.released);
+
+  // A non-zero return value from on_next() cancels the stream
+  MakeCountingStream(&input, {2, 0, 3});
+  InitRecordingHandler(&handler, &state);
+  state.on_next_result = ECANCELED;
+  ASSERT_EQ(ArrowArrayStreamToAsync(&input, &handler, &error), NANOARROW_OK);
+  EXPECT_EQ(state.lengths, std::vector<int64_t>({2}));
+  EXPECT_FALSE(state.finished);
+  EXPECT_TRUE(state.released);
+
+  // Errors from get_next() are passed to on_error()
+  input.get_schema = &FailingStreamGetSchema;
+  input.get_next = &FailingStreamGetNext;
+  input.get_last_error = &FailingStreamGetLastError;
+  input.release = &FailingStreamRelease;
+  input.private_data = nullptr;
+  InitRecordingHandler(&handler, &state);
+  ASSERT_EQ(ArrowArrayStreamToAsync(&input, &handler, &error), NANOARROW_OK);
+  EXPECT_TRUE(state.lengths.empty());
+  EXPECT_EQ(state.error_code, EIO);
+  EXPECT_EQ(state.error_message, "upstream failed");
+  EXPECT_TRUE(state.released);
+}
+
+TEST(ArrayStreamTest, ArrayStreamTestFromAsync) {
+  struct ArrowArrayStream input;
+  struct ArrowArrayStream array_stream;
+  struct ArrowAsyncArrayStreamHandler handler;
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowError error;
+
+  // Round trip a synchronous stream through the push interface
+  MakeCountingStream(&input, {2, 0, 3});
+  ASSERT_EQ(ArrowArrayStreamInitFromAsync(&array_stream, &handler), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStreamToAsync(&input, &handler, &error), NANOARROW_OK);
+
+  ASSERT_EQ(array_stream.get_schema(&array_stream, &schema), NANOARROW_OK);
+  EXPECT_STREQ(schema.format, "i");
+  schema.release(&schema);
+
+  std::vector<int64_t> lengths;
+  while (true) {
+    ASSERT_EQ(array_stream.get_next(&array_stream, &array), NANOARROW_OK);
+    if (array.release == nullptr) {
+      break;
+    }
+
+    lengths.push_back(array.length);
+    array.release(&array);
+  }
+  EXPECT_EQ(lengths, std::vector<int64_t>({2, 0, 3}));
+  array_stream.release(&array_stream);
+
+  // Releasing the stream early cancels the producer
+  MakeCountingStream(&input, {2, 0, 3});
+  ASSERT_EQ(ArrowArrayStreamInitFromAsync(&array_stream, &handler), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStreamToAsync(&input, &handler, &error), NANOARROW_OK);
+  ASSERT_EQ(array_stream.get_next(&array_stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.length, 2);
+  array.release(&array);
+  array_stream.release(&array_stream);
+
+  // Errors passed to on_error() are returned by get_next()
+  input.get_schema = &FailingStreamGetSchema;
+  input.get_next = &FailingStreamGetNext;
+  input.get_last_error = &FailingStreamGetLastError;
+  input.release = &FailingStreamRelease;
+  input.private_data = nullptr;
+  ASSERT_EQ(ArrowArrayStreamInitFromAsync(&array_stream, &handler), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStreamToAsync(&input, &handler, &error), NANOARROW_OK);
+  EXPECT_EQ(array_stream.get_next(&array_stream, &array), EIO);
+  EXPECT_STREQ(array_stream.get_last_error(&array_stream), "upstream failed");
+  array_stream.release(&array_stream);
+
+  // Nothing is available before the producer calls on_schema()
+  ASSERT_EQ(ArrowArrayStreamInitFromAsync(&array_stream, &handler), NANOARROW_OK);
+  EXPECT_EQ(array_stream.get_schema(&array_stream, &schema), EAGAIN);
+  EXPECT_EQ(array_stream.get_next(&array_stream, &array), EAGAIN);
+  array_stream.release(&array_stream);
+  handler.release(&handler);
+}
+
+struct SpanRecorder {
+  int64_t now;
+  std::vector<struct ArrowArrayStreamSpan> spans;
+};
+
+static int64_t SpanRecorderNow(struct ArrowArrayStreamInstrumentation* self) {
+  auto recorder = reinterpret_cast<SpanRecorder*>(self->private_data);
+  recorder->now += 10;
+  return recorder->now;
+}
+
+static void SpanRecorderOnSpan(struct ArrowArrayStreamInstrumentation* self,
+                               const struct ArrowArrayStreamSpan* span) {
+  auto recorder = reinterpret_cast<SpanRecorder*>(self->private_data);
+  recorder->spans.push_back(*span);
+}
+
+TEST(ArrayStreamTest, ArrayStreamTestInstrumented) {
+  struct ArrowArrayStream input;
+  struct ArrowArrayStream array_stream;
+  struct ArrowArray array;
+  struct ArrowSchema schema;
+  struct ArrowArrayStreamStats stats;
+  struct ArrowError error;
+
+  SpanRecorder recorder;
+  recorder.now = 0;
+  struct ArrowArrayStreamInstrumentation instrumentation;
+  instrumentation.count_bytes = 1;
+  instrumentation.now_ns = &SpanRecorderNow;
+  instrumentation.on_span = &SpanRecorderOnSpan;
+  instrumentation.private_data = &recorder;
+
+  MakeCountingStream(&input, {2, 0, 3});
+  ASSERT_EQ(ArrowInstrumentedArrayStreamInit(&array_stream, &input, &instrumentation,
+                                             &error),
+            NANOARROW_OK);
+  EXPECT_EQ(input.release, nullptr);
+
+  ASSERT_EQ(array_stream.get_schema(&array_stream, &schema), NANOARROW_OK);
+  EXPECT_STREQ(schema.format, "i");
+  schema.release(&schema);
+
+  while (true) {
+    ASSERT_EQ(array_stream.get_next(&array_stream, &array), NANOARROW_OK);
+    if (array.release == nullptr) {
+      break;
+    }
+
+    array.release(&array);
+  }
+
+  ArrowInstrumentedArrayStreamGetStats(&array_stream, &stats);
+  EXPECT_EQ(stats.n_batches, 3);
+  EXPECT_EQ(stats.n_rows, 5);
+  EXPECT_EQ(stats.n_bytes, 5 * sizeof(int32_t));
+  EXPECT_EQ(stats.max_batch_bytes, 3 * sizeof(int32_t));
+  EXPECT_EQ(stats.n_errors, 0);
+  EXPECT_EQ(stats.get_next_ns, 4 * 10);
+
+  ASSERT_EQ(recorder.spans.size(), 4);
+  EXPECT_EQ(recorder.spans[0].call_index, 0);
+  EXPECT_EQ(recorder.spans[0].start_ns, 10);
+  EXPECT_EQ(recorder.spans[0].end_ns, 20);
+  EXPECT_EQ(recorder.spans[0].n_rows, 2);
+  EXPECT_EQ(recorder.spans[0].n_bytes, 2 * sizeof(int32_t));
+  EXPECT_EQ(recorder.spans[3].call_index, 3);
+  EXPECT_EQ(recorder.spans[3].code, NANOARROW_OK);
+  EXPECT_EQ(recorder.spans[3].n_rows, -1);
+  array_stream.release(&array_stream);
+
+  // Without instrumentation only batches, rows, and errors are counted and errors
+  // are passed through
+  input.get_schema = &FailingStreamGetSchema;
+  input.get_next = &FailingStreamGetNext;
+  input.get_last_error = &FailingStreamGetLastError;
+  input.release = &FailingStreamRelease;
+  input.private_data = nullptr;
+  ASSERT_EQ(ArrowInstrumentedArrayStreamInit(&array_stream, &input, nullptr, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(array_stream.get_next(&array_stream, &array), EIO);
+  EXPECT_STREQ(array_stream.get_last_error(&array_stream), "upstream failed");
+
+  ArrowInstrumentedArrayStreamGetStats(&array_stream, &stats);
+  EXPECT_EQ(stats.n_batches, 0);
+  EXPECT_EQ(stats.n_bytes, 0);
+  EXPECT_EQ(stats.n_errors, 1);
+  EXPECT_EQ(stats.get_next_ns, 0);
+  array_stream.release(&array_stream);
+}
+
+TEST(ArrayStreamTest, ArrayStreamTestSpilling) {
+  struct ArrowArrayStream array_stream;
+  struct ArrowArray array;
+  struct ArrowArray held;
+  struct ArrowSchema schema;
+  struct ArrowArrayView array_view;
+  struct ArrowSpillingArrayStreamStats stats;
+  struct ArrowError error;
+
+  // Each array has 4 non-null rows of 1 byte each (20 + 4 = 24 buffer bytes) such
+  // that only two arrays fit in the budget at a time
+  struct ArrowSpillingArrayStreamOptions options;
+  options.memory_budget_bytes = 50;
+  options.spill_directory = nullptr;
+
+  auto push = [&](int64_t i) {
+    ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    for (int64_t j = 0; j < 4; j++) {
+      std::string item = std::to_string((i + j) % 10);
+      ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView(item.c_str())),
+                NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowSpillingArrayStreamPush(&array_stream, &array, &error), NANOARROW_OK)
+        << error.message;
+    EXPECT_EQ(array.release, nullptr);
+  };
+
+  auto check = [&](struct ArrowArray* array, int64_t i) {
+    ASSERT_NE(array->release, nullptr);
+    ASSERT_EQ(ArrowArrayViewSetArray(&array_view, array, &error), NANOARROW_OK)
+        << error.message;
+    ASSERT_EQ(array_view.length, 4);
+    for (int64_t j = 0; j < 4; j++) {
+      struct ArrowStringView item = ArrowArrayViewGetStringUnsafe(&array_view, j);
+      EXPECT_EQ(std::string(item.data, item.size_bytes), std::to_string((i + j) % 10));
+    }
+  };
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowSpillingArrayStreamInit(&array_stream, &schema, &options, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(schema.release, nullptr);
+
+  EXPECT_EQ(array_stream.get_next(&array_stream, &array), EAGAIN);
+  EXPECT_STREQ(array_stream.get_last_error(&array_stream), "No array is available yet");
+
+  // A burst of arrays: everything after the second one is spilled
+  for (int64_t i = 0; i < 5; i++) {
+    push(i);
+  }
+
+  ArrowSpillingArrayStreamGetStats(&array_stream, &stats);
+  EXPECT_EQ(stats.n_batches, 5);
+  EXPECT_EQ(stats.n_batches_spilled, 3);
+  EXPECT_GT(stats.n_bytes_spilled, 3 * 24);
+  EXPECT_EQ(stats.memory_bytes, 48);
+  EXPECT_EQ(stats.max_memory_bytes, 48);
+
+  // Arrays are returned in order regardless of where they were kept
+  for (int64_t i = 0; i < 3; i++) {
+    ASSERT_EQ(array_stream.get_next(&array_stream, &array), NANOARROW_OK);
+    check(&array, i);
+    array.release(&array);
+  }
+
+  // Memory freed by the consumer is available to the producer again
+  ArrowSpillingArrayStreamGetStats(&array_stream, &stats);
+  EXPECT_EQ(stats.memory_bytes, 0);
+  push(5);
+  ArrowSpillingArrayStreamGetStats(&array_stream, &stats);
+  EXPECT_EQ(stats.n_batches_spilled, 3);
+  EXPECT_EQ(stats.memory_bytes, 24);
+  ArrowSpillingArrayStreamFinish(&array_stream);
+
+  // Keep a spilled array that outlives the stream
+  ASSERT_EQ(array_stream.get_next(&array_stream, &held), NANOARROW_OK);
+  check(&held, 3);
+  for (int64_t i = 4; i < 6; i++) {
+    ASSERT_EQ(array_stream.get_next(&array_stream, &array), NANOARROW_OK);
+    check(&array, i);
+    array.release(&array);
+  }
+
+  ASSERT_EQ(array_stream.get_next(&array_stream, &array), NANOARROW_OK);
+  EXPECT_EQ(array.release, nullptr);
+  EXPECT_EQ(ArrowSpillingArrayStreamPush(&array_stream, &held, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Can't push to a finished stream");
+  array_stream.release(&array_stream);
+
+  check(&held, 3);
+  held.release(&held);
+  ArrowArrayViewReset(&array_view);
+}
+
+#if defined(__linux__)
+// The number of mappings of files whose name contains "nanoarrow-spill-"
+static int64_t CountSpillFileMappings() {
+  FILE* maps = fopen("/proc/self/maps", "r");
+  if (maps == nullptr) {
+    return -1;
+  }
+
+  int64_t n = 0;
+  char line[4096];
+  while (fgets(line, sizeof(line), maps) != nullptr) {
+    if (strstr(line, "nanoarrow-spill-") != nullptr) {
+      n++;
+    }
+  }
+
+  fclose(maps);
+  return n;
+}
+
+TEST(ArrayStreamTest, ArrayStreamTestSpillingReleasesMappings) {
+  struct ArrowArrayStream array_stream;
+  struct ArrowArray array;
+  struct ArrowSchema schema;
+  struct ArrowError error;
+
+  std::string spill_directory = ::testing::TempDir();
+  struct ArrowSpillingArrayStreamOptions options;
+  options.memory_budget_bytes = 0;
+  options.spill_directory = spill_directory.c_str();
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSpillingArrayStreamInit(&array_stream, &schema, &options, &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(CountSpillFileMappings(), 0);
+
+  for (int64_t i = 0; i < 50; i++) {
+    ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendInt(&array, i), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowSpillingArrayStreamPush(&array_stream, &array, &error), NANOARROW_OK)
+        << error.message;
+  }
+  ArrowSpillingArrayStreamFinish(&array_stream);
+
+  // Arrays that are alive keep their mapping; released ones don't
+  std::vector<struct ArrowArray> arrays(50);
+  for (auto& item : arrays) {
+    ASSERT_EQ(array_stream.get_next(&array_stream, &item), NANOARROW_OK);
+    ASSERT_NE(item.release, nullptr);
+  }
+  EXPECT_EQ(CountSpillFileMappings(), 50);
+
+  array_stream.release(&array_stream);
+  for (auto& item : arrays) {
+    item.release(&item);
+  }
+  EXPECT_EQ(CountSpillFileMappings(), 0);
+}
+#endif
@@ -16,7 +16,10 @@
 // under the License.
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <thread>
 
 #include <arrow/array.h>
 #include <arrow/array/builder_binary.h>
@@ -137,6 +140,54 @@ TEST(ArrayTest, ArrayTestInitFromSchema) {
   schema.release(&schema);
 }
 
+TEST(ArrayTest, ArrayTestSetAllocator) {
+  struct ArrowArray array;
+  struct ArrowSchema schema;
+  struct ArrowError error;
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[1], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArraySetAllocator(&array, ArrowBufferAllocatorAligned(64)),
+            NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int64_t i = 0; i < 100; i++) {
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[0], i), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView("abc")),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
+
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(array.buffers[0]) % 64, 0);
+  for (int64_t i = 0; i < array.n_children; i++) {
+    for (int64_t j = 1; j < array.children[i]->n_buffers; j++) {
+      EXPECT_EQ(reinterpret_cast<uintptr_t>(array.children[i]->buffers[j]) % 64, 0);
+      EXPECT_EQ(ArrowArrayBuffer(array.children[i], j)->allocator.free,
+                ArrowBufferAllocatorAligned(64).free);
+    }
+  }
+
+  auto arrow_array = ImportArray(&array, &schema);
+  ARROW_EXPECT_OK(arrow_array);
+  ARROW_EXPECT_OK(arrow_array.ValueUnsafe()->ValidateFull());
+  EXPECT_EQ(arrow_array.ValueUnsafe()->length(), 101);
+
+  // Can't change the allocator once buffers have been allocated
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 1), NANOARROW_OK);
+  EXPECT_EQ(ArrowArraySetAllocator(&array, ArrowBufferAllocatorAligned(64)), EINVAL);
+  array.release(&array);
+}
+
 TEST(ArrayTest, ArrayTestSetBitmap) {
   struct ArrowBitmap bitmap;
   ArrowBitmapInit(&bitmap);
@@ -298,6 +349,50 @@ TEST(ArrayTest, ArrayTestExplicitValidationLevel) {
   array.release(&array);
 }
 
+TEST(ArrayTest, ArrayTestFinishBuildingBuiltByAppend) {
+  struct ArrowArray array;
+  struct ArrowError error;
+
+  // Arrays built by the append functions pass full validation
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("abc")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayFinishBuilding(&array, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(array.null_count, 1);
+  EXPECT_NE(array.buffers[0], nullptr);
+
+  // A validity bitmap kept by ArrowArrayResetForReuse() is released if no nulls
+  // are appended
+  ASSERT_EQ(ArrowArrayResetForReuse(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("def")), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayFinishBuilding(&array, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(array.null_count, 0);
+  EXPECT_EQ(array.buffers[0], nullptr);
+
+  // Offsets modified through ArrowArrayBuffer() are still fully validated
+  ASSERT_EQ(ArrowArrayResetForReuse(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("abc")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("def")), NANOARROW_OK);
+  reinterpret_cast<int32_t*>(ArrowArrayBuffer(&array, 1)->data)[1] = 7;
+  EXPECT_EQ(ArrowArrayFinishBuilding(&array, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "[2] Expected element size >= 0");
+
+  // ...as are offsets appended from a caller-provided buffer
+  ASSERT_EQ(ArrowArrayResetForReuse(&array), NANOARROW_OK);
+  int32_t offsets[] = {0, 3, 1, 4};
+  ASSERT_EQ(ArrowArrayAppendStringsFromOffsets(&array, offsets, "abcd", 3, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayFinishBuilding(&array, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "[2] Expected element size >= 0");
+
+  array.release(&array);
+}
+
 TEST(ArrayTest, ArrayTestValidateMinimalBufferAccess) {
   struct ArrowArray array;
 
@@ -324,6 +419,271 @@ TEST(ArrayTest, ArrayTestValidateMinimalBufferAccess) {
   array.release(&array);
 }
 
+TEST(ArrayTest, ArrayTestFinishBuildingOmitsAllValidBitmap) {
+  struct ArrowArray array;
+
+  // Appending only non-null values never allocates a validity bitmap
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 1), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayValidityBitmap(&array)->buffer.data, nullptr);
+
+  // The first null allocates the bitmap and backfills the previous values
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_NE(ArrowArrayValidityBitmap(&array)->buffer.data, nullptr);
+  EXPECT_EQ(ArrowArrayValidityBitmap(&array)->buffer.data[0], 0x01);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  EXPECT_NE(array.buffers[0], nullptr);
+  EXPECT_EQ(array.null_count, 1);
+  array.release(&array);
+
+  // A bitmap kept by the append functions that contains no nulls is omitted
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayResetForReuse(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(array.buffers[0], nullptr);
+  EXPECT_EQ(array.null_count, 0);
+  array.release(&array);
+
+  // A bitmap supplied by the caller is kept even if all of its bits are set
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowBitmapReserve(ArrowArrayValidityBitmap(&array), 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 3), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayValidityBitmap(&array)->size_bits, 3);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  EXPECT_NE(array.buffers[0], nullptr);
+  EXPECT_EQ(array.null_count, 0);
+  array.release(&array);
+
+  struct ArrowBitmap bitmap;
+  ArrowBitmapInit(&bitmap);
+  ASSERT_EQ(ArrowBitmapAppend(&bitmap, 1, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ArrowArraySetValidityBitmap(&array, &bitmap);
+  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(&array, 1), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(&array, 1), 2), NANOARROW_OK);
+  array.length = 2;
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  EXPECT_NE(array.buffers[0], nullptr);
+  array.release(&array);
+}
+
+TEST(ArrayTest, ArrayTestShrinkToFitTrim) {
+  struct ArrowArray array;
+  struct ArrowError error;
+
+  // A struct whose child has more values than the struct and whose child's data
+  // buffer has more bytes than its values require
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAllocateChildren(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromType(array.children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int32_t i = 0; i < 10; i++) {
+    if (i == 8) {
+      ASSERT_EQ(ArrowArrayAppendNull(array.children[0], 1), NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowArrayAppendInt(array.children[0], i), NANOARROW_OK);
+    }
+  }
+  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(array.children[0], 1), 10),
+            NANOARROW_OK);
+  array.length = 4;
+
+  ASSERT_EQ(ArrowArrayShrinkToFit(&array), NANOARROW_OK);
+  EXPECT_EQ(array.children[0]->length, 4);
+  EXPECT_EQ(array.children[0]->null_count, 0);
+  EXPECT_EQ(ArrowArrayBuffer(array.children[0], 1)->size_bytes, 4 * sizeof(int32_t));
+  EXPECT_EQ(ArrowArrayBuffer(array.children[0], 1)->capacity_bytes,
+            4 * sizeof(int32_t));
+  EXPECT_EQ(ArrowArrayValidityBitmap(array.children[0])->size_bits, 4);
+  EXPECT_EQ(array.children[0]->buffers[1], ArrowArrayBuffer(array.children[0], 1)->data);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
+  array.release(&array);
+
+  // A string array whose data buffer has bytes past its last offset
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("abc")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("de")), NANOARROW_OK);
+  ASSERT_EQ(ArrowBufferAppend(ArrowArrayBuffer(&array, 2), "fgh", 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayShrinkToFit(&array), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayBuffer(&array, 1)->size_bytes, 3 * sizeof(int32_t));
+  EXPECT_EQ(ArrowArrayBuffer(&array, 2)->size_bytes, 5);
+  EXPECT_EQ(ArrowArrayBuffer(&array, 2)->capacity_bytes, 5);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
+  array.release(&array);
+
+  // Arrays not allocated by nanoarrow can't be shrunk
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  struct ArrowArray array_copy = array;
+  array_copy.release = nullptr;
+  EXPECT_EQ(ArrowArrayShrinkToFit(&array_copy), EINVAL);
+  array.release(&array);
+}
+
+TEST(ArrayTest, ArrayTestFinishBuildingNarrow) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowError error;
+  struct ArrowArrayView array_view;
+
+  // struct<a: int64, b: uint32, c: large_string, d: int64, e: timestamp>
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 5), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0], NANOARROW_TYPE_INT64),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[1], NANOARROW_TYPE_UINT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[2], NANOARROW_TYPE_LARGE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[3], NANOARROW_TYPE_INT64),
+            NANOARROW_OK);
+  ArrowSchemaInit(schema.children[4]);
+  ASSERT_EQ(ArrowSchemaSetTypeDateTime(schema.children[4], NANOARROW_TYPE_TIMESTAMP,
+                                       NANOARROW_TIME_UNIT_SECOND, nullptr),
+            NANOARROW_OK);
+  for (int64_t i = 0; i < 5; i++) {
+    char name[] = {static_cast<char>('a' + i), '\0'};
+    ASSERT_EQ(ArrowSchemaSetName(schema.children[i], name), NANOARROW_OK);
+  }
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, &error), NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int64_t i = 0; i < 1000; i++) {
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[0], i % 256 - 128), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendUInt(array.children[1], i * 60), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(array.children[2], ArrowCharView("abc")),
+              NANOARROW_OK);
+    if (i == 500) {
+      ASSERT_EQ(ArrowArrayAppendNull(array.children[3], 1), NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowArrayAppendInt(array.children[3], (i - 500) * 4000000),
+                NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[4], i), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
+
+  ASSERT_EQ(ArrowArrayFinishBuildingNarrow(&array, &schema,
+                                           NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  EXPECT_STREQ(schema.children[0]->format, "c");
+  EXPECT_STREQ(schema.children[1]->format, "S");
+  EXPECT_STREQ(schema.children[2]->format, "u");
+  EXPECT_STREQ(schema.children[3]->format, "i");
+  EXPECT_STREQ(schema.children[4]->format, "tss:");
+  EXPECT_EQ(ArrowArrayBuffer(array.children[0], 1)->size_bytes, 1000);
+  EXPECT_EQ(ArrowArrayBuffer(array.children[1], 1)->size_bytes, 1000 * 2);
+  EXPECT_EQ(ArrowArrayBuffer(array.children[2], 1)->size_bytes, 1001 * 4);
+  EXPECT_EQ(ArrowArrayBuffer(array.children[3], 1)->size_bytes, 1000 * 4);
+  EXPECT_EQ(ArrowArrayBuffer(array.children[4], 1)->size_bytes, 1000 * 8);
+
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  for (int64_t i = 0; i < 1000; i++) {
+    EXPECT_EQ(ArrowArrayViewGetIntUnsafe(array_view.children[0], i), i % 256 - 128);
+    EXPECT_EQ(ArrowArrayViewGetUIntUnsafe(array_view.children[1], i), i * 60);
+    struct ArrowStringView value =
+        ArrowArrayViewGetStringUnsafe(array_view.children[2], i);
+    EXPECT_EQ(std::string(value.data, value.size_bytes), "abc");
+    if (i == 500) {
+      EXPECT_TRUE(ArrowArrayViewIsNull(array_view.children[3], i));
+    } else {
+      EXPECT_EQ(ArrowArrayViewGetIntUnsafe(array_view.children[3], i),
+                (i - 500) * 4000000);
+    }
+  }
+  ArrowArrayViewReset(&array_view);
+
+  array.release(&array);
+  schema.release(&schema);
+
+  // Values that require the full width are left as they are
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_UINT64), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendUInt(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendUInt(&array, UINT64_MAX), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingNarrow(&array, &schema,
+                                           NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK);
+  EXPECT_STREQ(schema.format, "L");
+  EXPECT_EQ(reinterpret_cast<const uint64_t*>(array.buffers[1])[1], UINT64_MAX);
+  array.release(&array);
+  schema.release(&schema);
+}
+
+TEST(ArrayTest, ArrayTestResetForReuse) {
+  struct ArrowArray array;
+  struct ArrowSchema schema;
+
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int32_t i = 0; i < 100; i++) {
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[0], i), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView("abcdef")),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(array.length, 101);
+
+  const void* ints_data = array.children[0]->buffers[1];
+  const void* strings_data = array.children[1]->buffers[2];
+  int64_t ints_capacity = ArrowArrayBuffer(array.children[0], 1)->capacity_bytes;
+
+  // Building a smaller batch reuses the existing allocations
+  ASSERT_EQ(ArrowArrayResetForReuse(&array), NANOARROW_OK);
+  EXPECT_EQ(array.length, 0);
+  EXPECT_EQ(array.null_count, 0);
+  EXPECT_EQ(array.children[0]->length, 0);
+  EXPECT_EQ(ArrowArrayBuffer(array.children[0], 1)->size_bytes, 0);
+  EXPECT_EQ(ArrowArrayBuffer(array.children[0], 1)->capacity_bytes, ints_capacity);
+  EXPECT_EQ(ArrowArrayBuffer(array.children[1], 1)->size_bytes, sizeof(int32_t));
+
+  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 123), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView("xyz")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  EXPECT_EQ(array.length, 1);
+  EXPECT_EQ(array.null_count, 0);
+  EXPECT_EQ(array.buffers[0], nullptr);
+  EXPECT_EQ(array.children[0]->buffers[1], ints_data);
+  EXPECT_EQ(array.children[1]->buffers[2], strings_data);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(array.children[0]->buffers[1])[0], 123);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(array.children[1]->buffers[1])[1], 3);
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(array.children[1]->buffers[2]), 3),
+            "xyz");
+
+  // Arrays that were not allocated by nanoarrow can't be reset
+  struct ArrowArray child = *array.children[0];
+  child.release = [](struct ArrowArray* array) { array->release = nullptr; };
+  EXPECT_EQ(ArrowArrayResetForReuse(&child), EINVAL);
+
+  schema.release(&schema);
+  array.release(&array);
+}
+
 TEST(ArrayTest, ArrayTestAppendToNullArray) {
   struct ArrowArray array;
   ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_NA), NANOARROW_OK);
@@ -759,6 +1119,193 @@ TEST(ArrayTest, ArrayTestAppendToFloatArray) {
   EXPECT_TRUE(arrow_array.ValueUnsafe()->Equals(expected_array.ValueUnsafe(), options));
 }
 
+TEST(ArrayTest, ArrayTestAppendSlice) {
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+
+  // Matching storage type without validity
+  std::vector<int32_t> values(100);
+  for (int32_t i = 0; i < 100; i++) {
+    values[i] = i * 3;
+  }
+
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, -1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt32Slice(&array, values.data(), 100, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(array.length, 101);
+  EXPECT_EQ(array.null_count, 0);
+  EXPECT_EQ(ArrowArrayValidityBitmap(&array)->buffer.data, nullptr);
+
+  // Matching storage type with validity (every third value null)
+  uint8_t validity[13];
+  memset(validity, 0, sizeof(validity));
+  for (int64_t i = 0; i < 100; i++) {
+    ArrowBitSetTo(validity, i, i % 3 != 0);
+  }
+  ASSERT_EQ(ArrowArrayAppendInt32Slice(&array, values.data(), 100, validity),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt32Slice(&array, values.data(), 0, validity),
+            NANOARROW_OK);
+  EXPECT_EQ(array.length, 201);
+  EXPECT_EQ(array.null_count, 34);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT32);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(&array_view, 0), -1);
+  for (int64_t i = 0; i < 100; i++) {
+    EXPECT_FALSE(ArrowArrayViewIsNull(&array_view, 1 + i));
+    EXPECT_EQ(ArrowArrayViewGetIntUnsafe(&array_view, 1 + i), i * 3);
+    EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 101 + i), i % 3 == 0);
+    if (i % 3 != 0) {
+      EXPECT_EQ(ArrowArrayViewGetIntUnsafe(&array_view, 101 + i), i * 3);
+    }
+  }
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+
+  // Non-matching storage type falls back to a checked conversion
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_DOUBLE), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt32Slice(&array, values.data(), 10, validity),
+            NANOARROW_OK);
+  EXPECT_EQ(array.length, 10);
+  EXPECT_EQ(array.null_count, 4);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_DOUBLE);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  EXPECT_TRUE(ArrowArrayViewIsNull(&array_view, 0));
+  EXPECT_EQ(ArrowArrayViewGetDoubleUnsafe(&array_view, 1), 3);
+  EXPECT_EQ(ArrowArrayViewGetDoubleUnsafe(&array_view, 8), 24);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+
+  int64_t big[] = {1, std::numeric_limits<int64_t>::max()};
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT8), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayAppendInt64Slice(&array, big, 2, nullptr), EINVAL);
+  array.release(&array);
+
+  // Types that can't be appended to
+  double doubles[] = {1.5};
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayAppendDoubleSlice(&array, doubles, 1, nullptr), EINVAL);
+  array.release(&array);
+}
+
+TEST(ArrayTest, ArrayTestAppendStrings) {
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  struct ArrowStringView values[] = {ArrowCharView("abc"), ArrowCharView(""),
+                                     ArrowCharView("defg"), ArrowCharView("h")};
+  uint8_t validity = 0x0b;  // values[2] is null
+
+  for (auto type : {NANOARROW_TYPE_STRING, NANOARROW_TYPE_LARGE_BINARY}) {
+    ASSERT_EQ(ArrowArrayInitFromType(&array, type), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("first")), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendStrings(&array, values, 4, nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendStrings(&array, values, 4, &validity), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendStrings(&array, values, 0, nullptr), NANOARROW_OK);
+    EXPECT_EQ(array.length, 9);
+    EXPECT_EQ(array.null_count, 1);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+    ArrowArrayViewInitFromType(&array_view, type);
+    ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+    struct ArrowStringView item = ArrowArrayViewGetStringUnsafe(&array_view, 0);
+    EXPECT_EQ(std::string(item.data, item.size_bytes), "first");
+    for (int64_t i = 0; i < 4; i++) {
+      item = ArrowArrayViewGetStringUnsafe(&array_view, 1 + i);
+      EXPECT_EQ(std::string(item.data, item.size_bytes),
+                std::string(values[i].data, values[i].size_bytes));
+      EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 5 + i), i == 2);
+      item = ArrowArrayViewGetStringUnsafe(&array_view, 5 + i);
+      if (i == 2) {
+        EXPECT_EQ(item.size_bytes, 0);
+      } else {
+        EXPECT_EQ(std::string(item.data, item.size_bytes),
+                  std::string(values[i].data, values[i].size_bytes));
+      }
+    }
+
+    ArrowArrayViewReset(&array_view);
+    array.release(&array);
+  }
+
+  // Fixed-size binary falls back to appending element-wise
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_FIXED_SIZE_BINARY),
+            NANOARROW_OK);
+  ArrowArrayPrivateData* private_data =
+      reinterpret_cast<ArrowArrayPrivateData*>(array.private_data);
+  private_data->layout.element_size_bits[1] = 3 * 8;
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayAppendStrings(&array, values, 1, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayAppendStrings(&array, values, 2, nullptr), EINVAL);
+  array.release(&array);
+
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayAppendStrings(&array, values, 1, nullptr), EINVAL);
+  array.release(&array);
+}
+
+TEST(ArrayTest, ArrayTestAppendStringsFromOffsets) {
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+
+  // A slice of the array ["zz", "abc", "", "defg", "h"] starting at element 1
+  const char* data = "zzabcdefgh";
+  int32_t offsets[] = {0, 2, 5, 5, 9, 10};
+  int64_t large_offsets[] = {0, 2, 5, 5, 9, 10};
+  uint8_t validity = 0x0b;
+
+  for (auto type : {NANOARROW_TYPE_STRING, NANOARROW_TYPE_LARGE_STRING}) {
+    ASSERT_EQ(ArrowArrayInitFromType(&array, type), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("first")), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendStringsFromOffsets(&array, offsets + 1, data, 4, nullptr),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendStringsFromLargeOffsets(&array, large_offsets + 1, data, 4,
+                                                      &validity),
+              NANOARROW_OK);
+    EXPECT_EQ(array.length, 9);
+    EXPECT_EQ(array.null_count, 1);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+    ArrowArrayViewInitFromType(&array_view, type);
+    ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+    const char* expected[] = {"first", "abc", "", "defg", "h", "abc", "", "defg", "h"};
+    for (int64_t i = 0; i < 9; i++) {
+      struct ArrowStringView item = ArrowArrayViewGetStringUnsafe(&array_view, i);
+      EXPECT_EQ(std::string(item.data, item.size_bytes), expected[i]);
+      EXPECT_EQ(ArrowArrayViewIsNull(&array_view, i), i == 7);
+    }
+
+    ArrowArrayViewReset(&array_view);
+    array.release(&array);
+  }
+
+  // Offsets that would overflow a 32-bit offset buffer
+  int64_t huge_offsets[] = {0, static_cast<int64_t>(INT32_MAX) + 1};
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayAppendStringsFromLargeOffsets(&array, huge_offsets, data, 1,
+                                                    nullptr),
+            EOVERFLOW);
+  array.release(&array);
+
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayAppendStringsFromOffsets(&array, offsets, data, 1, nullptr),
+            EINVAL);
+  array.release(&array);
+}
+
 TEST(ArrayTest, ArrayTestAppendToBoolArray) {
   struct ArrowArray array;
 
@@ -1196,20 +1743,120 @@ TEST(ArrayTest, ArrayTestAppendToLargeListArray) {
   EXPECT_TRUE(arrow_array.ValueUnsafe()->Equals(expected_array.ValueUnsafe()));
 }
 
-TEST(ArrayTest, ArrayTestAppendToMapArray) {
+TEST(ArrayTest, ArrayTestAppendToListViewArray) {
   struct ArrowArray array;
   struct ArrowSchema schema;
+  struct ArrowArrayView array_view;
   struct ArrowError error;
 
-  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_MAP), NANOARROW_OK);
-  ASSERT_EQ(ArrowSchemaSetType(schema.children[0]->children[0], NANOARROW_TYPE_INT32),
-            NANOARROW_OK);
-  ASSERT_EQ(ArrowSchemaSetType(schema.children[0]->children[1], NANOARROW_TYPE_STRING),
-            NANOARROW_OK);
-
-  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  for (auto type : {NANOARROW_TYPE_LIST_VIEW, NANOARROW_TYPE_LARGE_LIST_VIEW}) {
+    ASSERT_EQ(ArrowSchemaInitFromType(&schema, type), NANOARROW_OK);
+    ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT64),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, &error), NANOARROW_OK);
+    ASSERT_EQ(array.n_buffers, 3);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+
+    // [[3, 4], null, [0, 1, 2], [], [1, 2, 3, 4], [5]]: the first element refers to
+    // values that have not yet been appended and the fifth overlaps the others
+    ASSERT_EQ(ArrowArrayAppendListView(&array, 3, 2), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+    for (int64_t i = 0; i < 3; i++) {
+      ASSERT_EQ(ArrowArrayAppendInt(array.children[0], i), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendEmpty(&array, 1), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 3), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 4), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendListView(&array, 1, 4), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 5), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+
+    EXPECT_EQ(ArrowArrayAppendListView(&array, -1, 1), EINVAL);
+    EXPECT_EQ(ArrowArrayAppendListView(&array, 0, -1), EINVAL);
+    if (type == NANOARROW_TYPE_LIST_VIEW) {
+      EXPECT_EQ(ArrowArrayAppendListView(&array, INT32_MAX, 1), EOVERFLOW);
+    }
+
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK)
+        << error.message;
+    EXPECT_EQ(array.length, 6);
+    EXPECT_EQ(array.null_count, 1);
+
+    ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL,
+                                     &error),
+              NANOARROW_OK)
+        << error.message;
+
+    std::vector<int64_t> offsets;
+    std::vector<int64_t> sizes;
+    for (int64_t i = 0; i < array_view.length; i++) {
+      offsets.push_back(ArrowArrayViewListChildOffset(&array_view, i));
+      sizes.push_back(ArrowArrayViewListChildSize(&array_view, i));
+    }
+    EXPECT_EQ(offsets, std::vector<int64_t>({3, 0, 0, 3, 1, 5}));
+    EXPECT_EQ(sizes, std::vector<int64_t>({2, 0, 3, 0, 4, 1}));
+    EXPECT_TRUE(ArrowArrayViewIsNull(&array_view, 1));
+    EXPECT_EQ(ArrowArrayViewGetIntUnsafe(array_view.children[0], offsets[0]), 3);
+
+    // A view that refers past the end of the child is only detected by full
+    // validation
+    if (type == NANOARROW_TYPE_LIST_VIEW) {
+      const_cast<int32_t*>(array_view.buffer_views[2].data.as_int32)[5] = 2;
+    } else {
+      const_cast<int64_t*>(array_view.buffer_views[2].data.as_int64)[5] = 2;
+    }
+    EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_DEFAULT,
+                                     &error),
+              NANOARROW_OK);
+    EXPECT_EQ(
+        ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+        EINVAL);
+    EXPECT_EQ(std::string(error.message),
+              std::string("[5] Expected ") + ArrowTypeString(type) +
+                  " offset 5 and size 2 to be within child array of length 6");
+
+    // The sizes buffer must have room for each element
+    int64_t element_size = type == NANOARROW_TYPE_LIST_VIEW ? 4 : 8;
+    ArrowArrayBuffer(&array, 2)->size_bytes -= element_size;
+    EXPECT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), EINVAL);
+    EXPECT_EQ(std::string(error.message),
+              std::string("Expected ") + ArrowTypeString(type) +
+                  " array buffer 2 to have size >= " + std::to_string(6 * element_size) +
+                  " bytes but found buffer with " +
+                  std::to_string(5 * element_size) + " bytes");
+
+    ArrowArrayViewReset(&array_view);
+    array.release(&array);
+    schema.release(&schema);
+  }
 
-  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  // Only list view arrays accept list view elements
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_LIST_VIEW), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAllocateChildren(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromType(array.children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayAppendListView(array.children[0], 0, 0), EINVAL);
+  array.release(&array);
+}
+
+TEST(ArrayTest, ArrayTestAppendToMapArray) {
+  struct ArrowArray array;
+  struct ArrowSchema schema;
+  struct ArrowError error;
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_MAP), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0]->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0]->children[1], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
 
   // Check that we can reserve recursively without erroring
   ASSERT_EQ(ArrowArrayReserve(&array, 5), NANOARROW_OK);
@@ -1330,6 +1977,134 @@ TEST(ArrayTest, ArrayTestAppendToFixedSizeListArray) {
   EXPECT_TRUE(arrow_array.ValueUnsafe()->Equals(expected_array.ValueUnsafe()));
 }
 
+TEST(ArrayTest, ArrayTestReserveShape) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+
+  // list<struct<strings: string, ints: int32>>
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_LIST), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema.children[0], 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0]->children[0], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0]->children[1], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+
+  // 10 lists of 3 structs each whose string is "abcd"
+  struct ArrowArrayShape strings_shape = {30, 120, 0, nullptr};
+  struct ArrowArrayShape ints_shape = {30, 0, 0, nullptr};
+  struct ArrowArrayShape* struct_children[] = {&strings_shape, &ints_shape};
+  struct ArrowArrayShape struct_shape = {30, 0, 2, struct_children};
+  struct ArrowArrayShape* list_children[] = {&struct_shape};
+  struct ArrowArrayShape shape = {10, 0, 1, list_children};
+  ASSERT_EQ(ArrowArrayReserveShape(&array, &shape), NANOARROW_OK);
+
+  struct ArrowArray* strings = array.children[0]->children[0];
+  struct ArrowArray* ints = array.children[0]->children[1];
+  EXPECT_EQ(ArrowArrayBuffer(&array, 1)->capacity_bytes, 11 * sizeof(int32_t));
+  EXPECT_EQ(ArrowArrayBuffer(strings, 1)->capacity_bytes, 31 * sizeof(int32_t));
+  EXPECT_EQ(ArrowArrayBuffer(strings, 2)->capacity_bytes, 120);
+  EXPECT_EQ(ArrowArrayBuffer(ints, 1)->capacity_bytes, 30 * sizeof(int32_t));
+
+  // Appending the expected values does not reallocate any buffer
+  const uint8_t* strings_data = ArrowArrayBuffer(strings, 2)->data;
+  const uint8_t* ints_data = ArrowArrayBuffer(ints, 1)->data;
+  for (int64_t i = 0; i < 10; i++) {
+    for (int64_t j = 0; j < 3; j++) {
+      ASSERT_EQ(ArrowArrayAppendString(strings, ArrowCharView("abcd")), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayAppendInt(ints, j), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayFinishElement(array.children[0]), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
+  EXPECT_EQ(ArrowArrayBuffer(strings, 2)->data, strings_data);
+  EXPECT_EQ(ArrowArrayBuffer(ints, 1)->data, ints_data);
+  EXPECT_EQ(ArrowArrayBuffer(strings, 2)->capacity_bytes, 120);
+  EXPECT_EQ(ArrowArrayBuffer(&array, 1)->capacity_bytes, 11 * sizeof(int32_t));
+  EXPECT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  // Children of struct arrays can be derived from the parent
+  struct ArrowArrayShape derived_shape = {5, 0, 0, nullptr};
+  ASSERT_EQ(ArrowArrayReserveShape(array.children[0], &derived_shape), NANOARROW_OK);
+  EXPECT_GE(ArrowArrayBuffer(ints, 1)->capacity_bytes, 35 * sizeof(int32_t));
+
+  // Shapes that don't match the array are an error
+  struct ArrowArrayShape bad_shape = {5, 0, 2, struct_children};
+  EXPECT_EQ(ArrowArrayReserveShape(&array, &bad_shape), EINVAL);
+  bad_shape = {-1, 0, 0, nullptr};
+  EXPECT_EQ(ArrowArrayReserveShape(&array, &bad_shape), EINVAL);
+
+  array.release(&array);
+  schema.release(&schema);
+}
+
+TEST(ArrayTest, ArrayTestCapacityHint) {
+  struct ArrowSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[1], NANOARROW_TYPE_INT64),
+            NANOARROW_OK);
+
+  struct ArrowBuffer hint;
+  ArrowBufferInit(&hint);
+
+  struct ArrowArrayBuildStats stats;
+  for (int batch = 0; batch < 3; batch++) {
+    struct ArrowArray array;
+    ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+    if (batch > 0) {
+      ASSERT_EQ(ArrowArrayReserveFromHint(&array, &hint), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+
+    for (int64_t i = 0; i < 1000; i++) {
+      if (i % 10 == 0) {
+        ASSERT_EQ(ArrowArrayAppendNull(array.children[0], 1), NANOARROW_OK);
+      } else {
+        ASSERT_EQ(ArrowArrayAppendString(array.children[0], ArrowCharView("abcdefgh")),
+                  NANOARROW_OK);
+      }
+      ASSERT_EQ(ArrowArrayAppendInt(array.children[1], i), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+    }
+
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+#if defined(NANOARROW_WITH_BUFFER_STATS)
+    ASSERT_EQ(ArrowArrayGetBuildStats(&array, &stats), NANOARROW_OK);
+    if (batch == 0) {
+      EXPECT_GT(stats.n_reallocations, 0);
+      EXPECT_GT(stats.bytes_reallocated, 0);
+    } else {
+      // A batch of the same shape as the hint is built without reallocating
+      EXPECT_EQ(stats.n_reallocations, 0);
+      EXPECT_EQ(stats.bytes_reallocated, 0);
+    }
+#else
+    EXPECT_EQ(ArrowArrayGetBuildStats(&array, &stats), ENOTSUP);
+    EXPECT_EQ(stats.n_reallocations, 0);
+#endif
+
+    ASSERT_EQ(ArrowArrayCapacityHintUpdate(&array, &hint), NANOARROW_OK);
+    array.release(&array);
+  }
+
+  // One value per fixed buffer of the struct and each of its children
+  EXPECT_EQ(hint.size_bytes, 3 * NANOARROW_MAX_FIXED_BUFFERS * sizeof(int64_t));
+
+  // A hint can't be used for an array with a different structure
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayReserveFromHint(&array, &hint), EINVAL);
+  EXPECT_EQ(ArrowArrayCapacityHintUpdate(&array, &hint), EINVAL);
+  array.release(&array);
+
+  ArrowBufferReset(&hint);
+  schema.release(&schema);
+}
+
 TEST(ArrayTest, ArrayTestAppendToListArrayErrors) {
   struct ArrowArray array;
   struct ArrowSchema schema;
@@ -1539,958 +2314,5044 @@ TEST(ArrayTest, ArrayTestAppendToUnionArrayErrors) {
   array.release(&array);
 }
 
-TEST(ArrayTest, ArrayViewTestBasic) {
+TEST(ArrayTest, ArrayTestAppendToRunEndEncodedArray) {
+  struct ArrowArray array;
+  struct ArrowSchema schema;
   struct ArrowArrayView array_view;
   struct ArrowError error;
-  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT32);
-
-  EXPECT_EQ(array_view.array, nullptr);
-  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_INT32);
-  EXPECT_EQ(array_view.layout.buffer_type[0], NANOARROW_BUFFER_TYPE_VALIDITY);
-  EXPECT_EQ(array_view.layout.buffer_type[1], NANOARROW_BUFFER_TYPE_DATA);
-  EXPECT_EQ(array_view.layout.element_size_bits[0], 1);
-  EXPECT_EQ(array_view.layout.element_size_bits[1], 32);
 
-  ArrowArrayViewSetLength(&array_view, 5);
-  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 1);
-  EXPECT_EQ(array_view.buffer_views[1].size_bytes, 5 * sizeof(int32_t));
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeRunEndEncoded(&schema, NANOARROW_TYPE_INT16), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  EXPECT_EQ(array.n_buffers, 0);
 
-  struct ArrowArray array;
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView("abc")),
+            NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayFinishRunEndElement(&array, 3), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayAppendNull(&array, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView("defg")),
+            NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayFinishRunEndElement(&array, 1), NANOARROW_OK);
 
-  // Build with no validity buffer
-  ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32);
-  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(&array, 1), 11), NANOARROW_OK);
-  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(&array, 1), 12), NANOARROW_OK);
-  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(&array, 1), 13), NANOARROW_OK);
-  array.length = 3;
-  array.null_count = 0;
-  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  // A run must have a positive length and exactly one value
+  EXPECT_EQ(ArrowArrayFinishRunEndElement(&array, 1), EINVAL);
+  ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView("h")), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayFinishRunEndElement(&array, 0), EINVAL);
 
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
-            NANOARROW_OK);
-  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 0);
-  EXPECT_EQ(array_view.buffer_views[1].size_bytes, 3 * sizeof(int32_t));
-  EXPECT_EQ(array_view.buffer_views[1].data.as_int32[0], 11);
-  EXPECT_EQ(array_view.buffer_views[1].data.as_int32[1], 12);
-  EXPECT_EQ(array_view.buffer_views[1].data.as_int32[2], 13);
+  // The run end must fit in the run end type
+  EXPECT_EQ(ArrowArrayFinishRunEndElement(&array, INT16_MAX), EINVAL);
+  ASSERT_EQ(ArrowArrayFinishRunEndElement(&array, 2), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
 
-  // Build with validity buffer
-  ASSERT_EQ(ArrowBitmapAppend(ArrowArrayValidityBitmap(&array), 1, 3), NANOARROW_OK);
-  array.null_count = -1;
-  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(array.length, 8);
+  EXPECT_EQ(array.null_count, 0);
+  EXPECT_EQ(array.children[0]->length, 4);
+  EXPECT_EQ(array.children[1]->length, 4);
 
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
   EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
             NANOARROW_OK);
-  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 1);
-  EXPECT_EQ(array_view.buffer_views[1].size_bytes, 3 * sizeof(int32_t));
 
-  // Expect error for bad offset + length
-  array.length = -1;
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
-  EXPECT_STREQ(error.message, "Expected array length >= 0 but found array length of -1");
-  array.length = 3;
+  const int64_t expected_physical[] = {0, 0, 0, 1, 1, 2, 3, 3};
+  for (int64_t i = 0; i < array.length; i++) {
+    EXPECT_EQ(ArrowArrayViewRunEndPhysicalIndex(&array_view, i), expected_physical[i]);
+  }
 
-  array.offset = -1;
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
-  EXPECT_STREQ(error.message, "Expected array offset >= 0 but found array offset of -1");
-  array.offset = 0;
+  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 2), 0);
+  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 3), 1);
+  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 4), 1);
+  auto item = ArrowArrayViewGetStringUnsafe(&array_view, 5);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), "defg");
+  item = ArrowArrayViewGetStringUnsafe(&array_view, 7);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), "h");
+
+  // Check that a slice uses the parent offset to look up runs
+  array_view.offset = 4;
+  array_view.length = 3;
+  EXPECT_EQ(ArrowArrayViewRunEndPhysicalIndex(&array_view, 0), 1);
+  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 0), 1);
+  item = ArrowArrayViewGetStringUnsafe(&array_view, 1);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), "defg");
+
+  // Check run end validation
+  array_view.length = 5;
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_DEFAULT,
+                                   &error),
+            EINVAL);
+  EXPECT_STREQ(ArrowErrorMessage(&error),
+               "Expected last run end of run_end_encoded array to be >= 9 but found 8");
 
-  // Expect error for the wrong number of buffers
-  ArrowArrayViewReset(&array_view);
-  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING);
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
+  array_view.offset = 0;
+  array_view.length = 8;
+  const_cast<int16_t*>(array_view.children[0]->buffer_views[1].data.as_int16)[1] = 2;
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            EINVAL);
+  EXPECT_STREQ(ArrowErrorMessage(&error),
+               "[1] Expected run end > 3 for run_end_encoded array but found run end 2");
 
-  array.release(&array);
   ArrowArrayViewReset(&array_view);
+  schema.release(&schema);
+  array.release(&array);
 }
 
-TEST(ArrayTest, ArrayViewTestMove) {
-  struct ArrowArrayView array_view;
-  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING);
-  ASSERT_EQ(array_view.storage_type, NANOARROW_TYPE_STRING);
-
-  struct ArrowArrayView array_view2;
-  ArrowArrayViewInitFromType(&array_view2, NANOARROW_TYPE_UNINITIALIZED);
-  ASSERT_EQ(array_view2.storage_type, NANOARROW_TYPE_UNINITIALIZED);
-
-  ArrowArrayViewMove(&array_view, &array_view2);
-  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_UNINITIALIZED);
-  EXPECT_EQ(array_view2.storage_type, NANOARROW_TYPE_STRING);
-
-  ArrowArrayViewReset(&array_view2);
-}
-
-TEST(ArrayTest, ArrayViewTestString) {
+TEST(ArrayTest, ArrayTestAppendToStringViewArray) {
+  struct ArrowArray array;
+  struct ArrowSchema schema;
   struct ArrowArrayView array_view;
   struct ArrowError error;
-  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING);
-
-  EXPECT_EQ(array_view.array, nullptr);
-  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_STRING);
-  EXPECT_EQ(array_view.layout.buffer_type[0], NANOARROW_BUFFER_TYPE_VALIDITY);
-  EXPECT_EQ(array_view.layout.buffer_type[1], NANOARROW_BUFFER_TYPE_DATA_OFFSET);
-  EXPECT_EQ(array_view.layout.buffer_type[2], NANOARROW_BUFFER_TYPE_DATA);
-  EXPECT_EQ(array_view.layout.element_size_bits[0], 1);
-  EXPECT_EQ(array_view.layout.element_size_bits[1], 32);
-  EXPECT_EQ(array_view.layout.element_size_bits[2], 0);
-
-  // Can't assume offset buffer size > 0 if length == 0
-  ArrowArrayViewSetLength(&array_view, 0);
-  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 0);
-  EXPECT_EQ(array_view.buffer_views[1].size_bytes, 0);
-  EXPECT_EQ(array_view.buffer_views[2].size_bytes, 0);
 
-  ArrowArrayViewSetLength(&array_view, 5);
-  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 1);
-  EXPECT_EQ(array_view.buffer_views[1].size_bytes, (5 + 1) * sizeof(int32_t));
-  EXPECT_EQ(array_view.buffer_views[2].size_bytes, 0);
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRING_VIEW), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  EXPECT_EQ(array.n_buffers, 3);
 
-  struct ArrowArray array;
+  // Values of up to 12 bytes are stored inline
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("short")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("twelve bytes")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
+  EXPECT_EQ(array.n_buffers, 3);
+  EXPECT_EQ(array.buffers[2], nullptr);
+  array.release(&array);
 
-  // Build + check zero length
-  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
-  array.null_count = 0;
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+  // Longer values are stored in variadic buffers of at most 32 KiB unless a single
+  // value is longer
+  std::string long_value(20, 'a');
+  std::string huge_value(40000, 'b');
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("short")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView(long_value.c_str())),
             NANOARROW_OK);
-  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 0);
-  EXPECT_EQ(array_view.buffer_views[1].size_bytes, 0);
-  EXPECT_EQ(array_view.buffer_views[2].size_bytes, 0);
-
-  // Build non-zero length (the array ["abcd", "efg"])
-  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(&array, 1), 0), NANOARROW_OK);
-  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(&array, 1), 4), NANOARROW_OK);
-  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(&array, 1), 7), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView(long_value.c_str())),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView(huge_value.c_str())),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
 
-  ASSERT_EQ(ArrowBufferReserve(ArrowArrayBuffer(&array, 2), 7), NANOARROW_OK);
-  ArrowBufferAppendUnsafe(ArrowArrayBuffer(&array, 2), "abcd", 4);
-  ArrowBufferAppendUnsafe(ArrowArrayBuffer(&array, 2), "efg", 3);
-  array.length = 2;
-  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(array.length, 5);
+  EXPECT_EQ(array.null_count, 1);
+  ASSERT_EQ(array.n_buffers, 5);
+  const int64_t* sizes = reinterpret_cast<const int64_t*>(array.buffers[4]);
+  EXPECT_EQ(sizes[0], 40);
+  EXPECT_EQ(sizes[1], 40000);
+
+  const union ArrowBinaryView* views =
+      reinterpret_cast<const union ArrowBinaryView*>(array.buffers[1]);
+  EXPECT_EQ(views[1].ref.size, 20);
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(views[1].ref.prefix), 4), "aaaa");
+  EXPECT_EQ(views[1].ref.buffer_index, 0);
+  EXPECT_EQ(views[1].ref.offset, 0);
+  EXPECT_EQ(views[3].ref.buffer_index, 0);
+  EXPECT_EQ(views[3].ref.offset, 20);
+  EXPECT_EQ(views[4].ref.buffer_index, 1);
+  EXPECT_EQ(views[4].ref.offset, 0);
 
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
   EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
             NANOARROW_OK);
-  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 0);
-  EXPECT_EQ(array_view.buffer_views[1].size_bytes, (1 + array.length) * sizeof(int32_t));
-  EXPECT_EQ(array_view.buffer_views[2].size_bytes, 7);
-
-  // Expect error for offsets that will cause bad access
-  int32_t* offsets =
-      const_cast<int32_t*>(reinterpret_cast<const int32_t*>(array.buffers[1]));
-
-  offsets[0] = -1;
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
-  EXPECT_STREQ(error.message, "Expected first offset >= 0 but found -1");
-  offsets[0] = 0;
+  EXPECT_EQ(array_view.n_variadic_buffers, 2);
 
-  offsets[1] = -1;
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  auto item = ArrowArrayViewGetStringUnsafe(&array_view, 0);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), "short");
+  item = ArrowArrayViewGetStringUnsafe(&array_view, 1);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), long_value);
+  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 2), 1);
+  item = ArrowArrayViewGetStringUnsafe(&array_view, 3);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), long_value);
+  auto bytes = ArrowArrayViewGetBytesUnsafe(&array_view, 4);
+  EXPECT_EQ(std::string(bytes.data.as_char, bytes.size_bytes), huge_value);
+
+  // Check validation of views that refer to variadic buffers
+  union ArrowBinaryView* mutable_views =
+      const_cast<union ArrowBinaryView*>(array_view.buffer_views[1].data.as_binary_view);
+  mutable_views[3].ref.buffer_index = 2;
   EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
             EINVAL);
-  EXPECT_STREQ(error.message, "[1] Expected element size >= 0");
+  EXPECT_STREQ(ArrowErrorMessage(&error),
+               "[3] Expected view buffer index between 0 and 1 but found 2");
 
-  // Check sequential offsets whose diff causes overflow
-  offsets[1] = 2080374784;
-  offsets[2] = INT_MIN;
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  mutable_views[3].ref.buffer_index = 0;
+  mutable_views[3].ref.offset = 21;
   EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
             EINVAL);
-  EXPECT_STREQ(error.message, "[2] Expected element size >= 0");
+  EXPECT_STREQ(ArrowErrorMessage(&error),
+               "[3] Expected view range [21, 41) to be within variadic buffer 0 of size "
+               "40");
+
+  // Too few buffers
+  array.n_buffers = 2;
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
+  EXPECT_STREQ(ArrowErrorMessage(&error),
+               "Expected array with >= 3 buffer(s) but found 2 buffer(s)");
+  array.n_buffers = 5;
 
-  array.release(&array);
   ArrowArrayViewReset(&array_view);
+  schema.release(&schema);
+  array.release(&array);
 }
 
-TEST(ArrayTest, ArrayViewTestLargeString) {
-  struct ArrowArrayView array_view;
+TEST(ArrayTest, ArrayTestAppendArrayView) {
+  struct ArrowSchema schema;
+  struct ArrowArray src;
+  struct ArrowArray dst;
+  struct ArrowArrayView src_view;
+  struct ArrowArrayView dst_view;
   struct ArrowError error;
-  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_LARGE_STRING);
 
-  EXPECT_EQ(array_view.array, nullptr);
-  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_LARGE_STRING);
-  EXPECT_EQ(array_view.layout.buffer_type[0], NANOARROW_BUFFER_TYPE_VALIDITY);
-  EXPECT_EQ(array_view.layout.buffer_type[1], NANOARROW_BUFFER_TYPE_DATA_OFFSET);
-  EXPECT_EQ(array_view.layout.buffer_type[2], NANOARROW_BUFFER_TYPE_DATA);
-  EXPECT_EQ(array_view.layout.element_size_bits[0], 1);
-  EXPECT_EQ(array_view.layout.element_size_bits[1], 64);
-  EXPECT_EQ(array_view.layout.element_size_bits[2], 0);
+  // struct<ints: int32, bools: bool, strings: string, lists: list<int64>>
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 4), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_BOOL), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[2], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[3], NANOARROW_TYPE_LIST), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[3]->children[0], NANOARROW_TYPE_INT64),
+            NANOARROW_OK);
 
-  // Can't assume offset buffer size > 0 if length == 0
-  ArrowArrayViewSetLength(&array_view, 0);
-  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 0);
-  EXPECT_EQ(array_view.buffer_views[1].size_bytes, 0);
-  EXPECT_EQ(array_view.buffer_views[2].size_bytes, 0);
+  // Element i is null if i % 3 == 0 and otherwise {i, i % 2 == 0, "i", [0..i % 4)}
+  ASSERT_EQ(ArrowArrayInitFromSchema(&src, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&src), NANOARROW_OK);
+  for (int64_t i = 0; i < 100; i++) {
+    if (i % 3 == 0) {
+      ASSERT_EQ(ArrowArrayAppendNull(&src, 1), NANOARROW_OK);
+      continue;
+    }
+
+    std::string item = std::to_string(i);
+    ASSERT_EQ(ArrowArrayAppendInt(src.children[0], i), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendInt(src.children[1], i % 2 == 0), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(src.children[2], ArrowCharView(item.c_str())),
+              NANOARROW_OK);
+    for (int64_t j = 0; j < i % 4; j++) {
+      ASSERT_EQ(ArrowArrayAppendInt(src.children[3]->children[0], j), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishElement(src.children[3]), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(&src), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&src, nullptr), NANOARROW_OK);
+
+  // Make sure the offset of the source array is respected
+  src.offset = 1;
+  src.length = 99;
+  src.null_count = -1;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&src_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&src_view, &src, &error), NANOARROW_OK);
+
+  // Append unaligned ranges (and an empty one)
+  ASSERT_EQ(ArrowArrayInitFromSchema(&dst, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&dst), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&dst, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendArrayView(&dst, &src_view, 4, 13), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendArrayView(&dst, &src_view, 0, 0), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendArrayView(&dst, &src_view, 30, 69), NANOARROW_OK);
+  EXPECT_EQ(dst.length, 83);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&dst, &error), NANOARROW_OK);
+
+  ArrowArrayViewInitFromSchema(&dst_view, &schema, &error);
+  ASSERT_EQ(ArrowArrayViewSetArray(&dst_view, &dst, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewValidate(&dst_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  int64_t null_count = 1;
+  for (int64_t i = 1; i < dst.length; i++) {
+    // The original index of element i
+    int64_t k = 1 + (i <= 13 ? (i - 1 + 4) : (i - 14 + 30));
+    EXPECT_EQ(ArrowArrayViewIsNull(&dst_view, i), k % 3 == 0);
+    if (k % 3 == 0) {
+      null_count++;
+      continue;
+    }
+
+    EXPECT_EQ(ArrowArrayViewGetIntUnsafe(dst_view.children[0], i), k);
+    EXPECT_EQ(ArrowArrayViewGetIntUnsafe(dst_view.children[1], i), k % 2 == 0);
+    struct ArrowStringView item = ArrowArrayViewGetStringUnsafe(dst_view.children[2], i);
+    EXPECT_EQ(std::string(item.data, item.size_bytes), std::to_string(k));
+    const int32_t* list_offsets = dst_view.children[3]->buffer_views[1].data.as_int32;
+    int64_t list_start = list_offsets[i];
+    int64_t list_end = list_offsets[i + 1];
+    ASSERT_EQ(list_end - list_start, k % 4);
+    for (int64_t j = 0; j < k % 4; j++) {
+      EXPECT_EQ(
+          ArrowArrayViewGetIntUnsafe(dst_view.children[3]->children[0], list_start + j),
+          j);
+    }
+  }
+  EXPECT_EQ(dst.null_count, null_count);
+
+  // Out of bounds or mismatched appends error
+  struct ArrowArray other;
+  ASSERT_EQ(ArrowArrayInitFromSchema(&other, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&other), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayAppendArrayView(&other, &src_view, 90, 10), EINVAL);
+  EXPECT_EQ(ArrowArrayAppendArrayView(&other, &src_view, -1, 1), EINVAL);
+  EXPECT_EQ(ArrowArrayAppendArrayView(other.children[0], src_view.children[1], 0, 1),
+            EINVAL);
+  other.release(&other);
 
-  ArrowArrayViewSetLength(&array_view, 5);
-  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 1);
+  ArrowArrayViewReset(&dst_view);
+  ArrowArrayViewReset(&src_view);
+  dst.release(&dst);
+  src.release(&src);
+  schema.release(&schema);
+}
+
+TEST(ArrayTest, ArrayTestAppendArrayViewUnion) {
+  struct ArrowSchema schema;
+  struct ArrowArray src;
+  struct ArrowArray dst;
+  struct ArrowArrayView src_view;
+  struct ArrowArrayView dst_view;
+  struct ArrowError error;
+
+  for (auto type : {NANOARROW_TYPE_DENSE_UNION, NANOARROW_TYPE_SPARSE_UNION}) {
+    ArrowSchemaInit(&schema);
+    ASSERT_EQ(ArrowSchemaSetTypeUnion(&schema, type, 2), NANOARROW_OK);
+    ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT64),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING),
+              NANOARROW_OK);
+
+    // Even elements are integers and odd elements are strings
+    ASSERT_EQ(ArrowArrayInitFromSchema(&src, &schema, nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&src), NANOARROW_OK);
+    for (int64_t i = 0; i < 20; i++) {
+      std::string item = std::to_string(i);
+      if (i % 2 == 0) {
+        ASSERT_EQ(ArrowArrayAppendInt(src.children[0], i), NANOARROW_OK);
+      } else {
+        ASSERT_EQ(ArrowArrayAppendString(src.children[1], ArrowCharView(item.c_str())),
+                  NANOARROW_OK);
+      }
+      ASSERT_EQ(ArrowArrayFinishUnionElement(&src, i % 2), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&src, nullptr), NANOARROW_OK);
+
+    ASSERT_EQ(ArrowArrayViewInitFromSchema(&src_view, &schema, &error), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewSetArray(&src_view, &src, &error), NANOARROW_OK);
+
+    ASSERT_EQ(ArrowArrayInitFromSchema(&dst, &schema, nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&dst), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendArrayView(&dst, &src_view, 3, 5), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendArrayView(&dst, &src_view, 10, 10), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&dst, &error), NANOARROW_OK);
+
+    ArrowArrayViewInitFromSchema(&dst_view, &schema, &error);
+    ASSERT_EQ(ArrowArrayViewSetArray(&dst_view, &dst, &error), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewValidate(&dst_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+              NANOARROW_OK)
+        << error.message;
+
+    ASSERT_EQ(dst.length, 15);
+    for (int64_t i = 0; i < dst.length; i++) {
+      int64_t k = i < 5 ? (i + 3) : (i - 5 + 10);
+      ASSERT_EQ(ArrowArrayViewUnionChildIndex(&dst_view, i), k % 2);
+      int64_t child_offset = ArrowArrayViewUnionChildOffset(&dst_view, i);
+      if (k % 2 == 0) {
+        EXPECT_EQ(ArrowArrayViewGetIntUnsafe(dst_view.children[0], child_offset), k);
+      } else {
+        struct ArrowStringView item =
+            ArrowArrayViewGetStringUnsafe(dst_view.children[1], child_offset);
+        EXPECT_EQ(std::string(item.data, item.size_bytes), std::to_string(k));
+      }
+    }
+
+    ArrowArrayViewReset(&dst_view);
+    ArrowArrayViewReset(&src_view);
+    dst.release(&dst);
+    src.release(&src);
+    schema.release(&schema);
+  }
+}
+
+TEST(ArrayTest, ArrayTestAppendTakeAndFilter) {
+  struct ArrowSchema schema;
+  struct ArrowArray src;
+  struct ArrowArray dst;
+  struct ArrowArrayView src_view;
+  struct ArrowArrayView dst_view;
+  struct ArrowError error;
+
+  // struct<ints: int32, bools: bool, strings: string, lists: list<int64>>
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 4), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_BOOL), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[2], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[3], NANOARROW_TYPE_LIST), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[3]->children[0], NANOARROW_TYPE_INT64),
+            NANOARROW_OK);
+
+  // Element i is null if i % 3 == 0 and otherwise {i, i % 2 == 0, "i", [0..i % 4)}
+  ASSERT_EQ(ArrowArrayInitFromSchema(&src, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&src), NANOARROW_OK);
+  for (int64_t i = 0; i < 100; i++) {
+    if (i % 3 == 0) {
+      ASSERT_EQ(ArrowArrayAppendNull(&src, 1), NANOARROW_OK);
+      continue;
+    }
+
+    std::string item = std::to_string(i);
+    ASSERT_EQ(ArrowArrayAppendInt(src.children[0], i), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendInt(src.children[1], i % 2 == 0), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(src.children[2], ArrowCharView(item.c_str())),
+              NANOARROW_OK);
+    for (int64_t j = 0; j < i % 4; j++) {
+      ASSERT_EQ(ArrowArrayAppendInt(src.children[3]->children[0], j), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishElement(src.children[3]), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(&src), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&src, nullptr), NANOARROW_OK);
+
+  // Make sure the offset of the source array is respected
+  src.offset = 1;
+  src.length = 99;
+  src.null_count = -1;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&src_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&src_view, &src, &error), NANOARROW_OK);
+
+  // Take elements in reverse with repeats, then those selected by a filter
+  std::vector<int64_t> indices;
+  for (int64_t i = 98; i >= 0; i -= 7) {
+    indices.push_back(i);
+    indices.push_back(i);
+  }
+
+  std::vector<uint8_t> filter(_ArrowBytesForBits(99));
+  for (int64_t i = 0; i < 99; i++) {
+    if (i % 5 < 3) {
+      ArrowBitSet(filter.data(), i);
+      indices.push_back(i);
+    }
+  }
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(&dst, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&dst), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendTake(&dst, &src_view, indices.data(), 30), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendTake(&dst, &src_view, indices.data(), 0), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendFilter(&dst, &src_view, filter.data()), NANOARROW_OK);
+  ASSERT_EQ(dst.length, static_cast<int64_t>(indices.size()));
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&dst, &error), NANOARROW_OK);
+
+  ArrowArrayViewInitFromSchema(&dst_view, &schema, &error);
+  ASSERT_EQ(ArrowArrayViewSetArray(&dst_view, &dst, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewValidate(&dst_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  int64_t null_count = 0;
+  for (int64_t i = 0; i < dst.length; i++) {
+    // The original index of element i
+    int64_t k = 1 + indices[i];
+    EXPECT_EQ(ArrowArrayViewIsNull(&dst_view, i), k % 3 == 0);
+    if (k % 3 == 0) {
+      null_count++;
+      continue;
+    }
+
+    EXPECT_EQ(ArrowArrayViewGetIntUnsafe(dst_view.children[0], i), k);
+    EXPECT_EQ(ArrowArrayViewGetIntUnsafe(dst_view.children[1], i), k % 2 == 0);
+    struct ArrowStringView item = ArrowArrayViewGetStringUnsafe(dst_view.children[2], i);
+    EXPECT_EQ(std::string(item.data, item.size_bytes), std::to_string(k));
+    const int32_t* list_offsets = dst_view.children[3]->buffer_views[1].data.as_int32;
+    int64_t list_start = list_offsets[i];
+    int64_t list_end = list_offsets[i + 1];
+    ASSERT_EQ(list_end - list_start, k % 4);
+    for (int64_t j = 0; j < k % 4; j++) {
+      EXPECT_EQ(
+          ArrowArrayViewGetIntUnsafe(dst_view.children[3]->children[0], list_start + j),
+          j);
+    }
+  }
+  EXPECT_EQ(dst.null_count, null_count);
+
+  // Out of bounds or mismatched takes error
+  struct ArrowArray other;
+  int64_t bad_indices[] = {0, 99};
+  ASSERT_EQ(ArrowArrayInitFromSchema(&other, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&other), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayAppendTake(&other, &src_view, bad_indices, 2), EINVAL);
+  EXPECT_EQ(ArrowArrayAppendTake(other.children[0], src_view.children[1], bad_indices,
+                                 1),
+            EINVAL);
+  other.release(&other);
+
+  ArrowArrayViewReset(&dst_view);
+  ArrowArrayViewReset(&src_view);
+  dst.release(&dst);
+  src.release(&src);
+  schema.release(&schema);
+}
+
+TEST(ArrayTest, ArrayTestAppendRecords) {
+  struct Record {
+    int32_t id;
+    bool flag;
+    double value;
+    uint8_t value_is_null;
+    const char* name;
+  };
+
+  std::vector<Record> records;
+  for (int32_t i = 0; i < 300; i++) {
+    records.push_back({i, i % 3 == 0, i * 0.5, static_cast<uint8_t>(i % 7 == 0),
+                       i % 5 == 0 ? nullptr : (i % 2 == 0 ? "even" : "odd")});
+  }
+
+  struct ArrowSchema schema;
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 4), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_BOOL), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[2], NANOARROW_TYPE_DOUBLE), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[3], NANOARROW_TYPE_STRING), NANOARROW_OK);
+
+  std::vector<struct ArrowRecordField> fields = {
+      {offsetof(Record, id), NANOARROW_TYPE_INT32, -1},
+      {offsetof(Record, flag), NANOARROW_TYPE_BOOL, -1},
+      {offsetof(Record, value), NANOARROW_TYPE_DOUBLE, offsetof(Record, value_is_null)},
+      {offsetof(Record, name), NANOARROW_TYPE_STRING, -1}};
+
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendRecords(&array, records.data(), 1, sizeof(Record),
+                                    fields.data()),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendRecords(&array, records.data() + 1, 299, sizeof(Record),
+                                    fields.data()),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(array.length, 300);
+  EXPECT_EQ(array.children[0]->null_count, 0);
+  EXPECT_EQ(array.children[2]->null_count, 43);
+  EXPECT_EQ(array.children[3]->null_count, 60);
+
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK);
+  for (int64_t i = 0; i < 300; i++) {
+    EXPECT_EQ(ArrowArrayViewGetIntUnsafe(array_view.children[0], i), i);
+    EXPECT_EQ(ArrowArrayViewGetIntUnsafe(array_view.children[1], i), i % 3 == 0);
+    EXPECT_EQ(ArrowArrayViewIsNull(array_view.children[2], i), i % 7 == 0);
+    if (i % 7 != 0) {
+      EXPECT_EQ(ArrowArrayViewGetDoubleUnsafe(array_view.children[2], i), i * 0.5);
+    }
+    EXPECT_EQ(ArrowArrayViewIsNull(array_view.children[3], i), i % 5 == 0);
+    if (i % 5 != 0) {
+      struct ArrowStringView name =
+          ArrowArrayViewGetStringUnsafe(array_view.children[3], i);
+      EXPECT_EQ(std::string(name.data, name.size_bytes), i % 2 == 0 ? "even" : "odd");
+    }
+  }
+  ArrowArrayViewReset(&array_view);
+
+  // Fields must match the storage type of their child
+  fields[0].type = NANOARROW_TYPE_INT64;
+  EXPECT_EQ(ArrowArrayAppendRecords(&array, records.data(), 1, sizeof(Record),
+                                    fields.data()),
+            EINVAL);
+  EXPECT_EQ(ArrowArrayAppendRecords(array.children[0], records.data(), 1,
+                                    sizeof(Record), fields.data()),
+            EINVAL);
+
+  array.release(&array);
+  schema.release(&schema);
+}
+
+TEST(ArrayTest, ArrayTestAppendFixedSizeListSlice) {
+  struct ArrowArray array;
+  struct ArrowSchema schema;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_UNINITIALIZED), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetTypeFixedSize(&schema, NANOARROW_TYPE_FIXED_SIZE_LIST, 3),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_FLOAT), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+
+  std::vector<float> values = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+  ASSERT_EQ(ArrowArrayAppendFixedSizeListSlice(&array, values.data(), 2, nullptr),
+            NANOARROW_OK);
+  uint8_t validity = 0x02;
+  ASSERT_EQ(ArrowArrayAppendFixedSizeListSlice(&array, values.data() + 6, 1, &validity),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
+  EXPECT_EQ(array.length, 3);
+  EXPECT_EQ(array.null_count, 1);
+  EXPECT_EQ(array.children[0]->length, 9);
+  EXPECT_EQ(array.children[0]->null_count, 0);
+
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_FALSE(ArrowArrayViewIsNull(&array_view, 1));
+  EXPECT_TRUE(ArrowArrayViewIsNull(&array_view, 2));
+  for (int64_t i = 0; i < 9; i++) {
+    EXPECT_EQ(ArrowArrayViewGetDoubleUnsafe(array_view.children[0], i), i);
+  }
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+
+  // Lists of a non-fixed-width child can't be appended from a buffer
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayAppendFixedSizeListSlice(&array, values.data(), 1, nullptr),
+            EINVAL);
+  array.release(&array);
+  schema.release(&schema);
+}
+
+static void FixedSizeListTestFree(struct ArrowBufferAllocator* allocator, uint8_t* ptr,
+                                  int64_t size) {
+  *reinterpret_cast<int*>(allocator->private_data) += 1;
+}
+
+TEST(ArrayTest, ArrayTestSetFixedSizeListValues) {
+  struct ArrowArray array;
+  struct ArrowSchema schema;
+  struct ArrowArrayView array_view;
+  struct ArrowBuffer buffer;
+  struct ArrowError error;
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_UNINITIALIZED), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetTypeFixedSize(&schema, NANOARROW_TYPE_FIXED_SIZE_LIST, 2),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_DOUBLE), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+
+  double values[] = {0, 1, 2, 3, 4, 5};
+  int n_freed = 0;
+  ArrowBufferInit(&buffer);
+  ASSERT_EQ(ArrowBufferSetAllocator(
+                &buffer, ArrowBufferDeallocator(&FixedSizeListTestFree, &n_freed)),
+            NANOARROW_OK);
+  buffer.data = reinterpret_cast<uint8_t*>(values);
+
+  // Not a whole number of lists
+  buffer.size_bytes = 3 * sizeof(double);
+  EXPECT_EQ(ArrowArraySetFixedSizeListValues(&array, &buffer), EINVAL);
+
+  buffer.size_bytes = sizeof(values);
+  ASSERT_EQ(ArrowArraySetFixedSizeListValues(&array, &buffer), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
+  EXPECT_EQ(array.length, 3);
+  EXPECT_EQ(array.null_count, 0);
+  EXPECT_EQ(array.children[0]->length, 6);
+  EXPECT_EQ(array.children[0]->buffers[1], values);
+
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  for (int64_t i = 0; i < 6; i++) {
+    EXPECT_EQ(ArrowArrayViewGetDoubleUnsafe(array_view.children[0], i), i);
+  }
+  ArrowArrayViewReset(&array_view);
+
+  // The array is no longer empty
+  EXPECT_EQ(ArrowArraySetFixedSizeListValues(&array, &buffer), EINVAL);
+
+  EXPECT_EQ(n_freed, 0);
+  array.release(&array);
+  EXPECT_EQ(n_freed, 1);
+  schema.release(&schema);
+}
+
+TEST(ArrayTest, ArrayTestConcatenate) {
+  struct ArrowSchema schema;
+  struct ArrowArray arrays[3];
+  struct ArrowArray out;
+  struct ArrowArrayView out_view;
+  struct ArrowError error;
+
+  // struct<ints: int32, strings: string, lists: list<bool>>
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[2], NANOARROW_TYPE_LIST), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[2]->children[0], NANOARROW_TYPE_BOOL),
+            NANOARROW_OK);
+
+  // Array i contains 5 * (i + 1) elements; element k overall is null if k % 4 == 3
+  // and is otherwise {k, "k", [true, false, ...] of length k % 3}
+  int64_t k = 0;
+  struct ArrowArray* array_ptrs[3];
+  for (int64_t i = 0; i < 3; i++) {
+    array_ptrs[i] = arrays + i;
+    ASSERT_EQ(ArrowArrayInitFromSchema(arrays + i, &schema, nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(arrays + i), NANOARROW_OK);
+    for (int64_t j = 0; j < 5 * (i + 1); j++, k++) {
+      if (k % 4 == 3) {
+        ASSERT_EQ(ArrowArrayAppendNull(arrays + i, 1), NANOARROW_OK);
+        continue;
+      }
+
+      std::string item = std::to_string(k);
+      ASSERT_EQ(ArrowArrayAppendInt(arrays[i].children[0], k), NANOARROW_OK);
+      struct ArrowStringView item_view = ArrowCharView(item.c_str());
+      ASSERT_EQ(ArrowArrayAppendString(arrays[i].children[1], item_view), NANOARROW_OK);
+      for (int64_t m = 0; m < k % 3; m++) {
+        ASSERT_EQ(ArrowArrayAppendInt(arrays[i].children[2]->children[0], m % 2 == 0),
+                  NANOARROW_OK);
+      }
+      ASSERT_EQ(ArrowArrayFinishElement(arrays[i].children[2]), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayFinishElement(arrays + i), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(arrays + i, nullptr), NANOARROW_OK);
+  }
+
+  ASSERT_EQ(ArrowArrayConcatenate(array_ptrs, 3, &schema, &out, &error), NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(out.length, 30);
+  EXPECT_EQ(out.null_count, 7);
+
+  // Buffers are allocated exactly once with the exact size
+  EXPECT_EQ(ArrowArrayBuffer(out.children[1], 2)->size_bytes,
+            ArrowArrayBuffer(out.children[1], 2)->capacity_bytes);
+  EXPECT_EQ(ArrowArrayBuffer(out.children[0], 1)->size_bytes,
+            ArrowArrayBuffer(out.children[0], 1)->capacity_bytes);
+
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&out_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&out_view, &out, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewValidate(&out_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  for (k = 0; k < out.length; k++) {
+    ASSERT_EQ(ArrowArrayViewIsNull(&out_view, k), k % 4 == 3);
+    if (k % 4 == 3) {
+      continue;
+    }
+
+    EXPECT_EQ(ArrowArrayViewGetIntUnsafe(out_view.children[0], k), k);
+    struct ArrowStringView item = ArrowArrayViewGetStringUnsafe(out_view.children[1], k);
+    EXPECT_EQ(std::string(item.data, item.size_bytes), std::to_string(k));
+    const int32_t* list_offsets = out_view.children[2]->buffer_views[1].data.as_int32;
+    ASSERT_EQ(list_offsets[k + 1] - list_offsets[k], k % 3);
+    for (int64_t m = 0; m < k % 3; m++) {
+      EXPECT_EQ(ArrowArrayViewGetIntUnsafe(out_view.children[2]->children[0],
+                                           list_offsets[k] + m),
+                m % 2 == 0);
+    }
+  }
+  ArrowArrayViewReset(&out_view);
+  out.release(&out);
+
+  // Concatenating zero arrays results in an empty array
+  ASSERT_EQ(ArrowArrayConcatenate(array_ptrs, 0, &schema, &out, &error), NANOARROW_OK);
+  EXPECT_EQ(out.length, 0);
+  out.release(&out);
+
+  for (int64_t i = 0; i < 3; i++) {
+    arrays[i].release(arrays + i);
+  }
+  schema.release(&schema);
+
+  // Dictionary-encoded arrays are not supported
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(&schema), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.dictionary, NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayConcatenate(array_ptrs, 0, &schema, &out, &error), EINVAL);
+  EXPECT_STREQ(error.message,
+               "Concatenation of dictionary-encoded arrays is not supported");
+  schema.release(&schema);
+}
+
+TEST(ArrayTest, ArrayTestSlice) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowArray slice;
+  struct ArrowArray slice2;
+  struct ArrowArray child;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+
+  // struct<ints: int32, strings: string> with a null at every third element
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int64_t i = 0; i < 10; i++) {
+    if (i % 3 == 2) {
+      ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+      continue;
+    }
+
+    std::string item = std::to_string(i);
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[0], i), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView(item.c_str())),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  const void* validity = array.buffers[0];
+
+  // Out of bounds ranges are rejected before array is modified
+  EXPECT_EQ(ArrowArraySlice(&array, -1, 2, &slice), EINVAL);
+  EXPECT_EQ(ArrowArraySlice(&array, 0, -1, &slice), EINVAL);
+  EXPECT_EQ(ArrowArraySlice(&array, 4, 7, &slice), EINVAL);
+
+  ASSERT_EQ(ArrowArraySlice(&array, 4, 5, &slice), NANOARROW_OK);
+  EXPECT_EQ(slice.offset, 4);
+  EXPECT_EQ(slice.length, 5);
+  EXPECT_EQ(slice.null_count, -1);
+  EXPECT_EQ(slice.buffers[0], validity);
+  ASSERT_EQ(slice.n_children, 2);
+  EXPECT_EQ(slice.children[0]->length, 10);
+
+  // The source is now a slice of its full range that refers to the same buffers
+  EXPECT_EQ(array.offset, 0);
+  EXPECT_EQ(array.length, 10);
+  EXPECT_EQ(array.null_count, 3);
+  EXPECT_EQ(array.buffers[0], validity);
+
+  // A slice of a slice refers to the same buffers relative to the original offset
+  ASSERT_EQ(ArrowArraySlice(&slice, 1, 3, &slice2), NANOARROW_OK);
+  EXPECT_EQ(slice2.offset, 5);
+  EXPECT_EQ(slice2.length, 3);
+
+  // Slices remain valid after the source and other slices are released; a child
+  // moved out of a slice remains valid after its parent is released
+  array.release(&array);
+  slice.release(&slice);
+  ArrowArrayMove(slice2.children[1], &child);
+
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &slice2, &error), NANOARROW_OK);
+  EXPECT_TRUE(ArrowArrayViewIsNull(&array_view, 0));
+  EXPECT_FALSE(ArrowArrayViewIsNull(&array_view, 1));
+  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(array_view.children[0], slice2.offset + 1), 6);
+  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(array_view.children[0], slice2.offset + 2), 7);
+  ArrowArrayViewReset(&array_view);
+  slice2.release(&slice2);
+
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, schema.children[1], &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &child, &error), NANOARROW_OK);
+  struct ArrowStringView item = ArrowArrayViewGetStringUnsafe(&array_view, 6);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), "6");
+  ArrowArrayViewReset(&array_view);
+  child.release(&child);
+
+  // A slice of the full range keeps the null count; a slice without nulls in its
+  // source has a null count of zero
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArraySlice(&array, 0, 2, &slice), NANOARROW_OK);
+  EXPECT_EQ(slice.null_count, 0);
+  slice.release(&slice);
+  ASSERT_EQ(ArrowArraySlice(&array, 2, 0, &slice), NANOARROW_OK);
+  EXPECT_EQ(slice.offset, 2);
+  EXPECT_EQ(slice.length, 0);
+  EXPECT_EQ(slice.null_count, 0);
+  slice.release(&slice);
+  array.release(&array);
+
+  schema.release(&schema);
+}
+
+static void RelocatableTestFree(struct ArrowBufferAllocator* allocator, uint8_t* ptr,
+                                int64_t size) {
+  ArrowFree(ptr);
+  *reinterpret_cast<int*>(allocator->private_data) += 1;
+}
+
+TEST(ArrayTest, ArrayTestRelocatable) {
+  struct ArrowSchema schema;
+  struct ArrowSchema schema_out;
+  struct ArrowArray array;
+  struct ArrowArray array_out;
+  struct ArrowArray child;
+  struct ArrowArrayView array_view;
+  struct ArrowBuffer out;
+  struct ArrowBuffer block;
+  struct ArrowError error;
+
+  // struct<ints: int32, strings: string, codes: dictionary<int8, string>>
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(&schema, "col"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[2], NANOARROW_TYPE_INT8), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(schema.children[2]), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[2]->dictionary,
+                                    NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+
+  ArrowBufferInit(&out);
+  ASSERT_EQ(ArrowMetadataBuilderInit(&out, nullptr), NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowMetadataBuilderAppend(&out, ArrowCharView("key"), ArrowCharView("value")),
+      NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetMetadata(&schema, reinterpret_cast<const char*>(out.data)),
+            NANOARROW_OK);
+  ArrowBufferReset(&out);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.children[2]->dictionary, ArrowCharView("abc")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.children[2]->dictionary, ArrowCharView("def")),
+            NANOARROW_OK);
+  for (int64_t i = 0; i < 10; i++) {
+    if (i % 3 == 2) {
+      ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+      continue;
+    }
+
+    std::string item = std::to_string(i);
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[0], i), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView(item.c_str())),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[2], i % 2), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK)
+      << error.message;
+
+  // Write after some existing content
+  ArrowBufferInit(&out);
+  ASSERT_EQ(ArrowBufferAppendUInt8(&out, 0xff), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayWriteRelocatable(&schema, &array, &out, &error), NANOARROW_OK)
+      << error.message;
+  array.release(&array);
+
+  // Copy the block into a buffer whose deallocation can be observed (e.g., as if it
+  // had been read from a file)
+  int64_t block_size = out.size_bytes - 64;
+  int n_freed = 0;
+  ArrowBufferInit(&block);
+  ASSERT_EQ(ArrowBufferSetAllocator(
+                &block, ArrowBufferDeallocator(&RelocatableTestFree, &n_freed)),
+            NANOARROW_OK);
+  block.data = reinterpret_cast<uint8_t*>(ArrowMalloc(block_size));
+  block.size_bytes = block_size;
+  memcpy(block.data, out.data + 64, block_size);
+  const uint8_t* block_data = block.data;
+
+  // Truncated blocks are rejected
+  block.size_bytes = block_size - 1;
+  EXPECT_EQ(ArrowArrayReadRelocatable(&block, nullptr, &array_out, &error), EINVAL);
+  EXPECT_EQ(std::string(error.message),
+            "Expected relocatable block of " + std::to_string(block_size) +
+                " bytes but found " + std::to_string(block_size - 1));
+  block.size_bytes = block_size;
+
+  ASSERT_EQ(ArrowArrayReadRelocatable(&block, &schema_out, &array_out, &error),
+            NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(block.data, nullptr);
+  char schema_out_str[1024];
+  char schema_str[1024];
+  ArrowSchemaToString(&schema_out, schema_out_str, sizeof(schema_out_str), 1);
+  ArrowSchemaToString(&schema, schema_str, sizeof(schema_str), 1);
+  EXPECT_STREQ(schema_out_str, schema_str);
+  EXPECT_STREQ(schema_out.name, "col");
+  EXPECT_EQ(ArrowMetadataSizeOf(schema_out.metadata),
+            ArrowMetadataSizeOf(schema.metadata));
+  schema.release(&schema);
+
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema_out, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array_out, &error), NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(array_view.length, 10);
+  EXPECT_EQ(array_view.null_count, 3);
+  EXPECT_EQ((array_view.children[1]->buffer_views[1].data.as_uint8 - block_data) % 64, 0);
+  for (int64_t i = 0; i < 10; i++) {
+    if (i % 3 == 2) {
+      EXPECT_TRUE(ArrowArrayViewIsNull(&array_view, i));
+      continue;
+    }
+
+    std::string item = std::to_string(i);
+    int64_t code = ArrowArrayViewGetIntUnsafe(array_view.children[2], i);
+    struct ArrowStringView value =
+        ArrowArrayViewGetStringUnsafe(array_view.children[1], i);
+    EXPECT_EQ(ArrowArrayViewGetIntUnsafe(array_view.children[0], i), i);
+    EXPECT_EQ(std::string(value.data, value.size_bytes), item);
+    value = ArrowArrayViewGetStringUnsafe(array_view.children[2]->dictionary, code);
+    EXPECT_EQ(std::string(value.data, value.size_bytes), i % 2 ? "def" : "abc");
+  }
+  ArrowArrayViewReset(&array_view);
+  schema_out.release(&schema_out);
+
+  // A child moved out of the array keeps the block alive
+  ArrowArrayMove(array_out.children[1], &child);
+  array_out.release(&array_out);
+  EXPECT_EQ(n_freed, 0);
+  EXPECT_EQ(child.length, 10);
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(child.buffers[2]), 2), "01");
+  child.release(&child);
+  EXPECT_EQ(n_freed, 1);
+
+  ArrowBufferReset(&out);
+}
+
+TEST(ArrayTest, ArrayTestRelocatableCorrupt) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowBuffer out;
+  struct ArrowError error;
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0], "col"), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  ArrowBufferInit(&out);
+  ASSERT_EQ(ArrowArrayWriteRelocatable(&schema, &array, &out, &error), NANOARROW_OK)
+      << error.message;
+  schema.release(&schema);
+  array.release(&array);
+
+  // The header holds the offsets of the root schema and array after the magic,
+  // byte order, pointer size, and block size
+  int64_t schema_offset;
+  int64_t array_offset;
+  memcpy(&schema_offset, out.data + 32, sizeof(int64_t));
+  memcpy(&array_offset, out.data + 40, sizeof(int64_t));
+
+  // Reading a block replaces offsets in place, so each read uses a fresh copy in
+  // which the pointer-sized value at one offset is replaced by 0
+  auto read_with_null = [&](int64_t offset) {
+    struct ArrowBuffer block;
+    struct ArrowArray array_out;
+    ArrowBufferInit(&block);
+    EXPECT_EQ(ArrowBufferAppend(&block, out.data, out.size_bytes), NANOARROW_OK);
+    memset(block.data + offset, 0, sizeof(void*));
+    int result = ArrowArrayReadRelocatable(&block, nullptr, &array_out, &error);
+    if (result == NANOARROW_OK) {
+      array_out.release(&array_out);
+    }
+    ArrowBufferReset(&block);
+    return result;
+  };
+
+  auto pointer_at = [&](int64_t offset) {
+    void* pointer;
+    memcpy(&pointer, out.data + offset, sizeof(void*));
+    return static_cast<int64_t>(reinterpret_cast<uintptr_t>(pointer));
+  };
+
+  int64_t schema_children = schema_offset + offsetof(struct ArrowSchema, children);
+  EXPECT_EQ(read_with_null(schema_children), EINVAL);
+  EXPECT_STREQ(error.message,
+               "Expected 1 schema children in relocatable block but found NULL");
+
+  EXPECT_EQ(read_with_null(pointer_at(schema_children)), EINVAL);
+  EXPECT_STREQ(error.message, "Expected schema child 0 in relocatable block");
+
+  int64_t array_buffers = array_offset + offsetof(struct ArrowArray, buffers);
+  EXPECT_EQ(read_with_null(array_buffers), EINVAL);
+  EXPECT_STREQ(error.message,
+               "Expected 1 array buffers in relocatable block but found NULL");
+
+  int64_t array_children = array_offset + offsetof(struct ArrowArray, children);
+  EXPECT_EQ(read_with_null(array_children), EINVAL);
+  EXPECT_STREQ(error.message,
+               "Expected 1 array children in relocatable block but found NULL");
+
+  EXPECT_EQ(read_with_null(pointer_at(array_children)), EINVAL);
+  EXPECT_STREQ(error.message, "Expected array child 0 in relocatable block");
+
+  // A NULL buffer (e.g., an omitted validity bitmap) is valid
+  EXPECT_EQ(read_with_null(pointer_at(array_buffers)), NANOARROW_OK);
+
+  ArrowBufferReset(&out);
+}
+
+TEST(ArrayTest, ArrayTestProject) {
+  struct ArrowSchema schema;
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema.children[0], 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0], "a"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0]->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0]->children[0], "b"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0]->children[1], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0]->children[1], "c"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_INT64), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[1], "d"), NANOARROW_OK);
+
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int64_t i = 0; i < 3; i++) {
+    std::string value = "value" + std::to_string(i);
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[0]->children[0], i), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(array.children[0]->children[1],
+                                     ArrowCharView(value.c_str())),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(array.children[0]), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[1], i * 10), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  const void* string_data = array.children[0]->children[1]->buffers[2];
+
+  struct ArrowSchemaProjection projection;
+  std::vector<struct ArrowStringView> paths = {ArrowCharView("d"), ArrowCharView("a.c")};
+  ASSERT_EQ(ArrowSchemaProjectionInit(&projection, &schema, paths.data(), paths.size(),
+                                      nullptr),
+            NANOARROW_OK);
+
+  struct ArrowSchema projected_schema;
+  struct ArrowArray projected;
+  ASSERT_EQ(ArrowSchemaProject(&schema, &projection, &projected_schema, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayProject(&array, &projection, &projected, nullptr), NANOARROW_OK);
+
+  // The source remains valid and can be released first
+  ASSERT_NE(array.release, nullptr);
+  EXPECT_EQ(array.n_children, 2);
+  array.release(&array);
+
+  ASSERT_EQ(projected.length, 3);
+  ASSERT_EQ(projected.n_children, 2);
+  ASSERT_EQ(projected.children[1]->n_children, 1);
+  EXPECT_EQ(projected.children[1]->children[0]->buffers[2], string_data);
+
+  struct ArrowArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &projected_schema, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &projected, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(array_view.children[0], 2), 20);
+  struct ArrowStringView value =
+      ArrowArrayViewGetStringUnsafe(array_view.children[1]->children[0], 1);
+  EXPECT_EQ(std::string(value.data, value.size_bytes), "value1");
+  ArrowArrayViewReset(&array_view);
+  projected.release(&projected);
+  projected_schema.release(&projected_schema);
+
+  // A projection that doesn't match the array is rejected
+  struct ArrowArray incompatible;
+  ASSERT_EQ(ArrowArrayInitFromType(&incompatible, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&incompatible), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&incompatible, nullptr), NANOARROW_OK);
+  struct ArrowError error;
+  EXPECT_EQ(ArrowArrayProject(&incompatible, &projection, &projected, &error), EINVAL);
+  EXPECT_STREQ(error.message, "ArrowArrayProject() failed with errno 22");
+  incompatible.release(&incompatible);
+
+  ArrowSchemaProjectionReset(&projection);
+  schema.release(&schema);
+}
+
+static void ParallelForThreads(struct ArrowExecutor* executor,
+                               void (*task)(void* task_private, int64_t i),
+                               void* task_private, int64_t n_tasks) {
+  std::vector<std::thread> threads;
+  for (int64_t i = 0; i < n_tasks; i++) {
+    threads.emplace_back(task, task_private, i);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  *reinterpret_cast<int64_t*>(executor->private_data) += n_tasks;
+}
+
+TEST(ArrayTest, ArrayTestViewDeepCopy) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowArray out;
+  struct ArrowArrayView array_view;
+  struct ArrowArrayView out_view;
+  struct ArrowError error;
+
+  // struct<ints: int32, strings: string, codes: dictionary<int8, string>>
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[2], NANOARROW_TYPE_INT8), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(schema.children[2]), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[2]->dictionary,
+                                    NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.children[2]->dictionary, ArrowCharView("x")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.children[2]->dictionary, ArrowCharView("y")),
+            NANOARROW_OK);
+  for (int64_t i = 0; i < 10; i++) {
+    if (i == 4) {
+      ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+      continue;
+    }
+
+    std::string item = std::to_string(i);
+    if (i % 3 == 0) {
+      ASSERT_EQ(ArrowArrayAppendNull(array.children[0], 1), NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowArrayAppendInt(array.children[0], i), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView(item.c_str())),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[2], i % 2), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  // Copy elements 2, ..., 8
+  array.offset = 2;
+  array.length = 7;
+  array.null_count = -1;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+
+  int64_t n_tasks = 0;
+  struct ArrowExecutor executor;
+  executor.parallel_for = &ParallelForThreads;
+  executor.private_data = &n_tasks;
+
+  for (struct ArrowExecutor* executor_ptr : {&executor, (struct ArrowExecutor*)nullptr}) {
+    ASSERT_EQ(ArrowArrayViewDeepCopy(&array_view, executor_ptr, &out, &error),
+              NANOARROW_OK)
+        << error.message;
+
+    // out does not share any buffers with array
+    EXPECT_EQ(out.offset, 0);
+    EXPECT_EQ(out.length, 7);
+    EXPECT_EQ(out.null_count, 1);
+    EXPECT_NE(out.children[1]->buffers[2], array.children[1]->buffers[2]);
+    EXPECT_EQ(ArrowArrayBuffer(out.children[1], 2)->size_bytes,
+              ArrowArrayBuffer(out.children[1], 2)->capacity_bytes);
+
+    ASSERT_EQ(ArrowArrayViewInitFromSchema(&out_view, &schema, &error), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewSetArray(&out_view, &out, &error), NANOARROW_OK);
+    ASSERT_EQ(
+        ArrowArrayViewValidate(&out_view, NANOARROW_VALIDATION_LEVEL_DEFAULT, &error),
+        NANOARROW_OK)
+        << error.message;
+    for (int64_t i = 0; i < out.length; i++) {
+      int64_t src = i + 2;
+      ASSERT_EQ(ArrowArrayViewIsNull(&out_view, i), src == 4);
+      if (src == 4) {
+        continue;
+      }
+
+      ASSERT_EQ(ArrowArrayViewIsNull(out_view.children[0], i), src % 3 == 0);
+      if (src % 3 != 0) {
+        EXPECT_EQ(ArrowArrayViewGetIntUnsafe(out_view.children[0], i), src);
+      }
+      struct ArrowStringView item =
+          ArrowArrayViewGetStringUnsafe(out_view.children[1], i);
+      EXPECT_EQ(std::string(item.data, item.size_bytes), std::to_string(src));
+      EXPECT_EQ(ArrowArrayViewGetIntUnsafe(out_view.children[2], i), src % 2);
+    }
+    ASSERT_EQ(out_view.children[2]->dictionary->length, 2);
+    struct ArrowStringView item =
+        ArrowArrayViewGetStringUnsafe(out_view.children[2]->dictionary, 1);
+    EXPECT_EQ(std::string(item.data, item.size_bytes), "y");
+    ArrowArrayViewReset(&out_view);
+    out.release(&out);
+  }
+
+  // Each column was copied by its own task
+  EXPECT_EQ(n_tasks, 3);
+
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
+
+  // Types that cannot be appended from a view are not supported
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING_VIEW);
+  array_view.length = 1;
+  EXPECT_EQ(ArrowArrayViewDeepCopy(&array_view, nullptr, &out, &error), ENOTSUP);
+  ArrowArrayViewReset(&array_view);
+}
+
+struct ParallelForTestOutput {
+  std::vector<int64_t> values;
+  std::vector<int64_t> lengths;
+  int64_t fail_after = INT64_MAX;
+};
+
+static ArrowErrorCode ParallelForTestTask(void* task_private,
+                                          struct ArrowArrayView* morsel, int64_t start,
+                                          struct ArrowError* error) {
+  auto output = reinterpret_cast<struct ParallelForTestOutput*>(task_private);
+  if (morsel->storage_type == NANOARROW_TYPE_LIST) {
+    return ArrowArrayViewListLengths(morsel, output->lengths.data() + start, error);
+  }
+
+  if (start > output->fail_after) {
+    ArrowErrorSet(error, "Morsel at %ld failed", (long)start);
+    return EINVAL;
+  }
+
+  for (int64_t i = 0; i < morsel->length; i++) {
+    output->values[start + i] =
+        ArrowArrayViewIsNull(morsel, i) ? -1 : ArrowArrayViewGetIntUnsafe(morsel, i);
+  }
+  return NANOARROW_OK;
+}
+
+TEST(ArrayViewTest, ArrayViewTestParallelFor) {
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+
+  // [[0], null, [2, 2], [], [4, 4, 4, 4], ...]
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_LIST), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAllocateChildren(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromType(array.children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int64_t i = 0; i < 1000; i++) {
+    if (i % 3 == 1) {
+      ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+      continue;
+    }
+
+    for (int64_t j = 0; j < i % 5; j++) {
+      ASSERT_EQ(ArrowArrayAppendInt(array.children[0], i), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
+
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_LIST);
+  ASSERT_EQ(ArrowArrayViewAllocateChildren(&array_view, 1), NANOARROW_OK);
+  ArrowArrayViewInitFromType(array_view.children[0], NANOARROW_TYPE_INT32);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  array_view.offset = 5;
+  array_view.length = 990;
+
+  std::vector<int64_t> expected(990);
+  ASSERT_EQ(ArrowArrayViewListLengths(&array_view, expected.data(), &error),
+            NANOARROW_OK);
+
+  int64_t n_tasks = 0;
+  struct ArrowExecutor executor;
+  executor.parallel_for = &ParallelForThreads;
+  executor.private_data = &n_tasks;
+  for (struct ArrowExecutor* executor_ptr : {&executor, (struct ArrowExecutor*)nullptr}) {
+    struct ParallelForTestOutput output;
+    output.lengths.resize(990);
+    ASSERT_EQ(ArrowArrayViewParallelFor(&array_view, 4, executor_ptr,
+                                        &ParallelForTestTask, &output, &error),
+              NANOARROW_OK);
+    EXPECT_EQ(output.lengths, expected);
+  }
+
+  // 990 elements are split into four morsels of 256 elements
+  EXPECT_EQ(n_tasks, 4);
+
+  // Morsels of the child of a list are interpreted as for the child
+  struct ArrowArrayView* child_view = array_view.children[0];
+  struct ParallelForTestOutput output;
+  output.values.resize(child_view->length);
+  ASSERT_EQ(ArrowArrayViewParallelFor(child_view, 3, &executor, &ParallelForTestTask,
+                                      &output, &error),
+            NANOARROW_OK);
+  for (int64_t i = 0; i < child_view->length; i++) {
+    ASSERT_EQ(output.values[i], ArrowArrayViewGetIntUnsafe(child_view, i));
+  }
+
+  // The error of the first failing morsel is returned
+  output.fail_after = 100;
+  EXPECT_EQ(ArrowArrayViewParallelFor(child_view, 8, &executor, &ParallelForTestTask,
+                                      &output, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Morsel at 192 failed");
+
+  EXPECT_EQ(ArrowArrayViewParallelFor(&array_view, 0, nullptr, &ParallelForTestTask,
+                                      &output, &error),
+            EINVAL);
+
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+}
+
+TEST(ArrayViewTest, ArrayViewTestEquals) {
+  struct ArrowSchema schema;
+  struct ArrowArray lhs;
+  struct ArrowArray rhs;
+  struct ArrowArray rhs_slice;
+  struct ArrowArrayView lhs_view;
+  struct ArrowArrayView rhs_view;
+  struct ArrowError error;
+  int64_t first_difference = 0;
+
+  // list<int32> with a null every seventh element
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_LIST), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  // rhs has three extra elements at the start such that the validity bitmaps of the
+  // slice and lhs are not aligned
+  ASSERT_EQ(ArrowArrayInitFromSchema(&lhs, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&rhs, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&lhs), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&rhs), NANOARROW_OK);
+  for (int64_t i = -3; i < 200; i++) {
+    for (struct ArrowArray* array : {&lhs, &rhs}) {
+      if (array == &lhs && i < 0) {
+        continue;
+      }
+
+      if (i % 7 == 6) {
+        ASSERT_EQ(ArrowArrayAppendNull(array, 1), NANOARROW_OK);
+        continue;
+      }
+
+      for (int64_t j = 0; j < i % 3; j++) {
+        ASSERT_EQ(ArrowArrayAppendInt(array->children[0], i + j), NANOARROW_OK);
+      }
+      ASSERT_EQ(ArrowArrayFinishElement(array), NANOARROW_OK);
+    }
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&lhs, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&rhs, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArraySlice(&rhs, 3, 200, &rhs_slice), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&lhs_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&rhs_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&lhs_view, &lhs, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&rhs_view, &rhs_slice, &error), NANOARROW_OK);
+  EXPECT_TRUE(ArrowArrayViewEquals(&lhs_view, &rhs_view, NANOARROW_ARRAY_COMPARE_DEFAULT,
+                                   &first_difference));
+  EXPECT_EQ(first_difference, 0);
+
+  // A difference in a child value is reported as the row that contains it
+  int32_t* child_values =
+      reinterpret_cast<int32_t*>(ArrowArrayBuffer(lhs.children[0], 1)->data);
+  int64_t child_index = ArrowArrayViewListChildOffset(&lhs_view, 152) + 1;
+  child_values[child_index] = -1;
+  EXPECT_FALSE(ArrowArrayViewEquals(&lhs_view, &rhs_view, NANOARROW_ARRAY_COMPARE_DEFAULT,
+                                    &first_difference));
+  EXPECT_EQ(first_difference, 152);
+
+  // ...and a difference in validity before it is reported first
+  ArrowBitClear(ArrowArrayBuffer(&lhs, 0)->data, 100);
+  EXPECT_FALSE(ArrowArrayViewEquals(&lhs_view, &rhs_view, NANOARROW_ARRAY_COMPARE_DEFAULT,
+                                    &first_difference));
+  EXPECT_EQ(first_difference, 100);
+  EXPECT_FALSE(ArrowArrayViewEquals(&rhs_view, &lhs_view, NANOARROW_ARRAY_COMPARE_DEFAULT,
+                                    nullptr));
+
+  // If one view is a prefix of the other, the difference is at the shorter length
+  rhs_view.length = 50;
+  EXPECT_FALSE(ArrowArrayViewEquals(&lhs_view, &rhs_view, NANOARROW_ARRAY_COMPARE_DEFAULT,
+                                    &first_difference));
+  EXPECT_EQ(first_difference, 50);
+
+  ArrowArrayViewReset(&rhs_view);
+  rhs_slice.release(&rhs_slice);
+  rhs.release(&rhs);
+
+  // Different layouts
+  ArrowArrayViewInitFromType(&rhs_view, NANOARROW_TYPE_INT32);
+  EXPECT_FALSE(ArrowArrayViewEquals(&lhs_view, &rhs_view, NANOARROW_ARRAY_COMPARE_DEFAULT,
+                                    &first_difference));
+  EXPECT_EQ(first_difference, -1);
+  ArrowArrayViewReset(&rhs_view);
+  ArrowArrayViewReset(&lhs_view);
+  lhs.release(&lhs);
+  schema.release(&schema);
+
+  // Strings and floats (compared byte-wise unless requested otherwise)
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_DOUBLE), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&lhs, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&rhs, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&lhs), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&rhs), NANOARROW_OK);
+  for (int64_t i = 0; i < 10; i++) {
+    std::string item = std::to_string(i);
+    double value = static_cast<double>(i);
+    for (struct ArrowArray* array : {&lhs, &rhs}) {
+      if (i == 9 && array == &rhs) {
+        item = "90";
+      }
+      if (i == 4) {
+        value = array == &lhs ? 0.0 : -0.0;
+      }
+      if (i == 5) {
+        value = NAN;
+      }
+
+      ASSERT_EQ(ArrowArrayAppendString(array->children[0], ArrowCharView(item.c_str())),
+                NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayAppendDouble(array->children[1], value), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayFinishElement(array), NANOARROW_OK);
+    }
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&lhs, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&rhs, &error), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&lhs_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&rhs_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&lhs_view, &lhs, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&rhs_view, &rhs, &error), NANOARROW_OK);
+  EXPECT_FALSE(ArrowArrayViewEquals(&lhs_view, &rhs_view, NANOARROW_ARRAY_COMPARE_DEFAULT,
+                                    &first_difference));
+  EXPECT_EQ(first_difference, 4);
+  EXPECT_FALSE(ArrowArrayViewEquals(&lhs_view, &rhs_view,
+                                    NANOARROW_ARRAY_COMPARE_FLOAT_VALUES,
+                                    &first_difference));
+  EXPECT_EQ(first_difference, 9);
+
+  lhs_view.length = 9;
+  rhs_view.length = 9;
+  EXPECT_TRUE(ArrowArrayViewEquals(&lhs_view, &rhs_view,
+                                   NANOARROW_ARRAY_COMPARE_FLOAT_VALUES, nullptr));
+
+  ArrowArrayViewReset(&lhs_view);
+  ArrowArrayViewReset(&rhs_view);
+  lhs.release(&lhs);
+  rhs.release(&rhs);
+  schema.release(&schema);
+}
+
+TEST(ArrayViewTest, ArrayViewTestChunkedArrayView) {
+  struct ArrowSchema schema;
+  struct ArrowArray arrays[4];
+  struct ArrowError error;
+  struct ArrowChunkedArrayView chunked_array_view;
+
+  // Chunks of lengths 3, 0, 1, and 4 of the values 0, ..., 7 where multiples of
+  // three are null
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  int64_t chunk_lengths[] = {3, 0, 1, 4};
+  int64_t value = 0;
+  for (int i = 0; i < 4; i++) {
+    ASSERT_EQ(ArrowArrayInitFromSchema(&arrays[i], &schema, &error), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&arrays[i]), NANOARROW_OK);
+    for (int64_t j = 0; j < chunk_lengths[i]; j++, value++) {
+      if (value % 3 == 0) {
+        ASSERT_EQ(ArrowArrayAppendNull(&arrays[i], 1), NANOARROW_OK);
+      } else {
+        ASSERT_EQ(ArrowArrayAppendInt(&arrays[i], value), NANOARROW_OK);
+      }
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&arrays[i], &error), NANOARROW_OK);
+  }
+
+  ASSERT_EQ(ArrowChunkedArrayViewInitFromSchema(&chunked_array_view, &schema, &error),
+            NANOARROW_OK);
+  schema.release(&schema);
+  for (int i = 0; i < 4; i++) {
+    ASSERT_EQ(ArrowChunkedArrayViewAppendArray(&chunked_array_view, &arrays[i], &error),
+              NANOARROW_OK);
+  }
+
+  EXPECT_EQ(chunked_array_view.n_chunks, 4);
+  EXPECT_EQ(chunked_array_view.length, 8);
+  EXPECT_EQ(chunked_array_view.null_count, 3);
+  EXPECT_EQ(std::vector<int64_t>(chunked_array_view.chunk_offsets,
+                                 chunked_array_view.chunk_offsets + 5),
+            std::vector<int64_t>({0, 3, 3, 4, 8}));
+
+  std::vector<int64_t> chunks;
+  for (int64_t i = 0; i < chunked_array_view.length; i++) {
+    chunks.push_back(ArrowChunkedArrayViewFindChunk(&chunked_array_view, i));
+    EXPECT_EQ(ArrowChunkedArrayViewIsNull(&chunked_array_view, i), i % 3 == 0);
+    if (i % 3 != 0) {
+      EXPECT_EQ(ArrowChunkedArrayViewGetIntUnsafe(&chunked_array_view, i), i);
+      EXPECT_EQ(ArrowChunkedArrayViewGetUIntUnsafe(&chunked_array_view, i), i);
+      EXPECT_EQ(ArrowChunkedArrayViewGetDoubleUnsafe(&chunked_array_view, i), i);
+    }
+  }
+  EXPECT_EQ(chunks, std::vector<int64_t>({0, 0, 0, 2, 3, 3, 3, 3}));
+
+  // A range spanning an empty chunk is processed in one piece per non-empty chunk
+  int64_t chunk;
+  int64_t chunk_i;
+  std::vector<int64_t> pieces;
+  for (int64_t i = 1, n = 0; i < 6; i += n) {
+    n = ArrowChunkedArrayViewChunkRange(&chunked_array_view, i, 6, &chunk, &chunk_i);
+    pieces.insert(pieces.end(), {chunk, chunk_i, n});
+  }
+  EXPECT_EQ(pieces, std::vector<int64_t>({0, 1, 2, 2, 0, 1, 3, 0, 2}));
+
+  std::vector<int64_t> ints(6);
+  ArrowChunkedArrayViewGetIntsUnsafe(&chunked_array_view, 1, 6, ints.data());
+  EXPECT_EQ(ints, std::vector<int64_t>({1, 2, 0, 4, 5, 0}));
+  std::vector<double> doubles(2);
+  ArrowChunkedArrayViewGetDoublesUnsafe(&chunked_array_view, 4, 2, doubles.data());
+  EXPECT_EQ(doubles, std::vector<double>({4, 5}));
+
+  ArrowChunkedArrayViewReset(&chunked_array_view);
+  for (int i = 0; i < 4; i++) {
+    arrays[i].release(&arrays[i]);
+  }
+
+  // Many string chunks reallocate the views of chunks
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowChunkedArrayViewInitFromSchema(&chunked_array_view, &schema, &error),
+            NANOARROW_OK);
+  std::vector<struct ArrowArray> string_arrays(20);
+  for (auto& array : string_arrays) {
+    ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, &error), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("abc")), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("de")), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
+    ASSERT_EQ(ArrowChunkedArrayViewAppendArray(&chunked_array_view, &array, &error),
+              NANOARROW_OK);
+  }
+
+  EXPECT_EQ(chunked_array_view.length, 40);
+  struct ArrowStringView item =
+      ArrowChunkedArrayViewGetStringUnsafe(&chunked_array_view, 37);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), "de");
+  struct ArrowBufferView bytes =
+      ArrowChunkedArrayViewGetBytesUnsafe(&chunked_array_view, 38);
+  EXPECT_EQ(bytes.size_bytes, 3);
+  std::vector<struct ArrowStringView> strings(3);
+  ArrowChunkedArrayViewGetStringsUnsafe(&chunked_array_view, 17, 3, strings.data());
+  EXPECT_EQ(std::string(strings[0].data, strings[0].size_bytes), "de");
+  EXPECT_EQ(std::string(strings[1].data, strings[1].size_bytes), "abc");
+  EXPECT_EQ(std::string(strings[2].data, strings[2].size_bytes), "de");
+
+  // Arrays that do not match the schema are not appended
+  struct ArrowArray int_array;
+  ASSERT_EQ(ArrowArrayInitFromType(&int_array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&int_array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowChunkedArrayViewAppendArray(&chunked_array_view, &int_array, &error),
+            EINVAL);
+  EXPECT_EQ(chunked_array_view.n_chunks, 20);
+  int_array.release(&int_array);
+
+  ArrowChunkedArrayViewReset(&chunked_array_view);
+  for (auto& array : string_arrays) {
+    array.release(&array);
+  }
+  schema.release(&schema);
+}
+
+TEST(ArrayTest, ArrayTestDictionaryBuilderString) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowDictionaryBuilder builder;
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_INT8), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(&schema), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.dictionary, NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderInit(&builder, &array), NANOARROW_OK);
+  EXPECT_EQ(builder.index_type, NANOARROW_TYPE_INT8);
+
+  // Low cardinality values don't widen the index type
+  for (int64_t i = 0; i < 100; i++) {
+    std::string value = "value" + std::to_string(i % 10);
+    ASSERT_EQ(ArrowDictionaryBuilderAppendString(&builder, ArrowCharView(value.c_str())),
+              NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowDictionaryBuilderAppendNull(&builder, 1), NANOARROW_OK);
+  EXPECT_EQ(array.length, 101);
+  EXPECT_EQ(array.null_count, 1);
+  EXPECT_EQ(array.dictionary->length, 10);
+  EXPECT_EQ(builder.index_type, NANOARROW_TYPE_INT8);
+
+  // ...but more than 128 unique values do
+  for (int64_t i = 0; i < 1000; i++) {
+    std::string value = "value" + std::to_string(i % 500);
+    ASSERT_EQ(ArrowDictionaryBuilderAppendString(&builder, ArrowCharView(value.c_str())),
+              NANOARROW_OK);
+  }
+  EXPECT_EQ(array.length, 1101);
+  EXPECT_EQ(array.dictionary->length, 500);
+  EXPECT_EQ(builder.index_type, NANOARROW_TYPE_INT16);
+  ArrowDictionaryBuilderReset(&builder);
+
+  ASSERT_EQ(ArrowSchemaSetType(&schema, builder.index_type), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  struct ArrowArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  for (int64_t i = 0; i < array.length; i++) {
+    if (i == 100) {
+      EXPECT_TRUE(ArrowArrayViewIsNull(&array_view, i));
+      continue;
+    }
+
+    std::string expected =
+        "value" + std::to_string(i < 100 ? (i % 10) : ((i - 101) % 500));
+    int64_t index = ArrowArrayViewGetIntUnsafe(&array_view, i);
+    struct ArrowStringView value =
+        ArrowArrayViewGetStringUnsafe(array_view.dictionary, index);
+    EXPECT_EQ(std::string(value.data, value.size_bytes), expected);
+  }
+
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
+}
+
+TEST(ArrayTest, ArrayTestDictionaryBuilderPrimitive) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowDictionaryBuilder builder;
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(&schema), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.dictionary, NANOARROW_TYPE_DOUBLE),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+
+  // Values already in the dictionary are reused
+  ASSERT_EQ(ArrowArrayAppendDouble(array.dictionary, 1.5), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderInit(&builder, &array), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderAppendDouble(&builder, 2.5), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderAppendDouble(&builder, 1.5), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderAppendInt(&builder, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderAppendUInt(&builder, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderAppendDouble(&builder, 2.5), NANOARROW_OK);
+  EXPECT_EQ(ArrowDictionaryBuilderAppendString(&builder, ArrowCharView("abc")), EINVAL);
+  ArrowDictionaryBuilderReset(&builder);
+
+  EXPECT_EQ(array.length, 5);
+  EXPECT_EQ(array.dictionary->length, 3);
+  const int32_t* indices =
+      reinterpret_cast<const int32_t*>(ArrowArrayBuffer(&array, 1)->data);
+  EXPECT_EQ(indices[0], 1);
+  EXPECT_EQ(indices[1], 0);
+  EXPECT_EQ(indices[2], 2);
+  EXPECT_EQ(indices[3], 2);
+  EXPECT_EQ(indices[4], 1);
+  const double* values =
+      reinterpret_cast<const double*>(ArrowArrayBuffer(array.dictionary, 1)->data);
+  EXPECT_EQ(values[0], 1.5);
+  EXPECT_EQ(values[1], 2.5);
+  EXPECT_EQ(values[2], 2);
+
+  array.release(&array);
+  schema.release(&schema);
+
+  // Arrays must be dictionary-encoded with a signed integer index
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  EXPECT_EQ(ArrowDictionaryBuilderInit(&builder, &array), EINVAL);
+  array.release(&array);
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_UINT8), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(&schema), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.dictionary, NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowDictionaryBuilderInit(&builder, &array), EINVAL);
+  array.release(&array);
+  schema.release(&schema);
+}
+
+// Initializes array as a dictionary<int8, string> with the given dictionary values
+// and indices (where -1 is a null index)
+static void MakeStringDictionaryArray(struct ArrowSchema* schema,
+                                      struct ArrowArray* array,
+                                      std::vector<std::string> values,
+                                      std::vector<int64_t> indices) {
+  ASSERT_EQ(ArrowSchemaInitFromType(schema, NANOARROW_TYPE_INT8), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(schema), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->dictionary, NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(array, schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array), NANOARROW_OK);
+  for (const auto& value : values) {
+    ASSERT_EQ(ArrowArrayAppendString(array->dictionary, ArrowCharView(value.c_str())),
+              NANOARROW_OK);
+  }
+  for (int64_t index : indices) {
+    if (index < 0) {
+      ASSERT_EQ(ArrowArrayAppendNull(array, 1), NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowArrayAppendInt(array, index), NANOARROW_OK);
+    }
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array, nullptr), NANOARROW_OK);
+}
+
+TEST(ArrayTest, ArrayTestDictionaryBuilderAppendArrayView) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowSchema batch_schema;
+  struct ArrowArray batch;
+  struct ArrowArrayView batch_view;
+  struct ArrowDictionaryBuilder builder;
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_INT8), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(&schema), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.dictionary, NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderInit(&builder, &array), NANOARROW_OK);
+
+  // Only the dictionary values that are referred to are added
+  MakeStringDictionaryArray(&batch_schema, &batch, {"a", "b", "c"}, {2, 0, -1, 2});
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&batch_view, &batch_schema, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&batch_view, &batch, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderAppendArrayView(&builder, &batch_view), NANOARROW_OK);
+  EXPECT_EQ(array.length, 4);
+  EXPECT_EQ(array.null_count, 1);
+  EXPECT_EQ(array.dictionary->length, 2);
+  ArrowArrayViewReset(&batch_view);
+  batch.release(&batch);
+  batch_schema.release(&batch_schema);
+
+  // Values already in the unified dictionary are remapped to their existing index
+  MakeStringDictionaryArray(&batch_schema, &batch, {"b", "a", "c"}, {0, 1, 1, 2});
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&batch_view, &batch_schema, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&batch_view, &batch, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderAppendArrayView(&builder, &batch_view), NANOARROW_OK);
+  EXPECT_EQ(array.length, 8);
+  EXPECT_EQ(array.dictionary->length, 3);
+
+  // Indices outside the dictionary are rejected
+  ArrowArrayViewReset(&batch_view);
+  batch.release(&batch);
+  batch_schema.release(&batch_schema);
+  MakeStringDictionaryArray(&batch_schema, &batch, {"a"}, {1});
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&batch_view, &batch_schema, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&batch_view, &batch, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowDictionaryBuilderAppendArrayView(&builder, &batch_view), EINVAL);
+  ArrowArrayViewReset(&batch_view);
+  batch.release(&batch);
+  batch_schema.release(&batch_schema);
+
+  // Dictionaries of other value types cannot be unified
+  ArrowArrayViewInitFromType(&batch_view, NANOARROW_TYPE_INT8);
+  EXPECT_EQ(ArrowDictionaryBuilderAppendArrayView(&builder, &batch_view), EINVAL);
+  ASSERT_EQ(ArrowArrayViewAllocateDictionary(&batch_view), NANOARROW_OK);
+  ArrowArrayViewInitFromType(batch_view.dictionary, NANOARROW_TYPE_BINARY);
+  EXPECT_EQ(ArrowDictionaryBuilderAppendArrayView(&builder, &batch_view), EINVAL);
+  ArrowArrayViewReset(&batch_view);
+  ArrowDictionaryBuilderReset(&builder);
+
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  struct ArrowArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  const char* expected[] = {"c", "a", nullptr, "c", "b", "a", "a", "c"};
+  for (int64_t i = 0; i < array.length; i++) {
+    if (expected[i] == nullptr) {
+      EXPECT_TRUE(ArrowArrayViewIsNull(&array_view, i));
+      continue;
+    }
+
+    struct ArrowStringView value =
+        ArrowArrayViewGetDictionaryStringUnsafe(&array_view, i);
+    EXPECT_EQ(std::string(value.data, value.size_bytes), expected[i]);
+  }
+
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
+}
+
+TEST(ArrayTest, ArrayViewTestBasic) {
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT32);
+
+  EXPECT_EQ(array_view.array, nullptr);
+  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_INT32);
+  EXPECT_EQ(array_view.layout.buffer_type[0], NANOARROW_BUFFER_TYPE_VALIDITY);
+  EXPECT_EQ(array_view.layout.buffer_type[1], NANOARROW_BUFFER_TYPE_DATA);
+  EXPECT_EQ(array_view.layout.element_size_bits[0], 1);
+  EXPECT_EQ(array_view.layout.element_size_bits[1], 32);
+
+  ArrowArrayViewSetLength(&array_view, 5);
+  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 1);
+  EXPECT_EQ(array_view.buffer_views[1].size_bytes, 5 * sizeof(int32_t));
+
+  struct ArrowArray array;
+
+  // Build with no validity buffer
+  ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32);
+  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(&array, 1), 11), NANOARROW_OK);
+  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(&array, 1), 12), NANOARROW_OK);
+  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(&array, 1), 13), NANOARROW_OK);
+  array.length = 3;
+  array.null_count = 0;
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 0);
+  EXPECT_EQ(array_view.buffer_views[1].size_bytes, 3 * sizeof(int32_t));
+  EXPECT_EQ(array_view.buffer_views[1].data.as_int32[0], 11);
+  EXPECT_EQ(array_view.buffer_views[1].data.as_int32[1], 12);
+  EXPECT_EQ(array_view.buffer_views[1].data.as_int32[2], 13);
+
+  // Build with validity buffer
+  ASSERT_EQ(ArrowBitmapAppend(ArrowArrayValidityBitmap(&array), 1, 3), NANOARROW_OK);
+  array.null_count = -1;
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 1);
+  EXPECT_EQ(array_view.buffer_views[1].size_bytes, 3 * sizeof(int32_t));
+
+  // Expect error for bad offset + length
+  array.length = -1;
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected array length >= 0 but found array length of -1");
+  array.length = 3;
+
+  array.offset = -1;
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected array offset >= 0 but found array offset of -1");
+  array.offset = 0;
+
+  // Expect error for the wrong number of buffers
+  ArrowArrayViewReset(&array_view);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING);
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
+
+  array.release(&array);
+  ArrowArrayViewReset(&array_view);
+}
+
+TEST(ArrayTest, ArrayViewTestMove) {
+  struct ArrowArrayView array_view;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING);
+  ASSERT_EQ(array_view.storage_type, NANOARROW_TYPE_STRING);
+
+  struct ArrowArrayView array_view2;
+  ArrowArrayViewInitFromType(&array_view2, NANOARROW_TYPE_UNINITIALIZED);
+  ASSERT_EQ(array_view2.storage_type, NANOARROW_TYPE_UNINITIALIZED);
+
+  ArrowArrayViewMove(&array_view, &array_view2);
+  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_UNINITIALIZED);
+  EXPECT_EQ(array_view2.storage_type, NANOARROW_TYPE_STRING);
+
+  ArrowArrayViewReset(&array_view2);
+}
+
+static void ExpectArrayViewLayoutEqual(struct ArrowArrayView* actual,
+                                       struct ArrowArrayView* expected) {
+  ASSERT_EQ(actual->storage_type, expected->storage_type);
+  EXPECT_EQ(memcmp(&actual->layout, &expected->layout, sizeof(struct ArrowLayout)), 0);
+  ASSERT_EQ(actual->n_children, expected->n_children);
+  for (int64_t i = 0; i < actual->n_children; i++) {
+    ExpectArrayViewLayoutEqual(actual->children[i], expected->children[i]);
+  }
+
+  ASSERT_EQ(actual->dictionary == nullptr, expected->dictionary == nullptr);
+  if (actual->dictionary != nullptr) {
+    ExpectArrayViewLayoutEqual(actual->dictionary, expected->dictionary);
+  }
+
+  ASSERT_EQ(actual->union_type_id_map == nullptr,
+            expected->union_type_id_map == nullptr);
+  if (actual->union_type_id_map != nullptr) {
+    EXPECT_EQ(memcmp(actual->union_type_id_map, expected->union_type_id_map, 256), 0);
+  }
+}
+
+TEST(ArrayTest, ArrayViewTestInitFromSchemaLayout) {
+  struct ArrowSchema schema;
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 3), NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowSchemaSetTypeFixedSize(schema.children[0], NANOARROW_TYPE_FIXED_SIZE_LIST, 2),
+      NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetTypeFixedSize(schema.children[0]->children[0],
+                                        NANOARROW_TYPE_FIXED_SIZE_BINARY, 3),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetTypeUnion(schema.children[1], NANOARROW_TYPE_DENSE_UNION, 2),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetFormat(schema.children[1], "+ud:5,2"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1]->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1]->children[1], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[2], NANOARROW_TYPE_INT16), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(schema.children[2]), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[2]->dictionary,
+                                    NANOARROW_TYPE_LARGE_STRING),
+            NANOARROW_OK);
+
+  struct ArrowSchemaLayout layout;
+  ASSERT_EQ(ArrowSchemaLayoutInit(&layout, &schema, nullptr), NANOARROW_OK);
+  EXPECT_EQ(layout.n_nodes, 8);
+
+  struct ArrowArrayView expected;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&expected, &schema, nullptr), NANOARROW_OK);
+  schema.release(&schema);
+
+  // The layout can be reused after the schema has been released
+  for (int i = 0; i < 2; i++) {
+    struct ArrowArrayView array_view;
+    ASSERT_EQ(ArrowArrayViewInitFromSchemaLayout(&array_view, &layout, nullptr),
+              NANOARROW_OK);
+    ExpectArrayViewLayoutEqual(&array_view, &expected);
+    EXPECT_EQ(array_view.children[1]->union_type_id_map[5], 0);
+    EXPECT_EQ(array_view.children[1]->union_type_id_map[2], 1);
+    ArrowArrayViewReset(&array_view);
+  }
+
+  ArrowArrayViewReset(&expected);
+  ArrowSchemaLayoutReset(&layout);
+
+  // Errors from parsing a child are propagated
+  struct ArrowError error;
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0], NANOARROW_TYPE_LIST),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetFormat(schema.children[0]->children[0], "*"), NANOARROW_OK);
+  EXPECT_EQ(ArrowSchemaLayoutInit(&layout, &schema, &error), EINVAL);
+  EXPECT_EQ(layout.nodes, nullptr);
+  schema.release(&schema);
+}
+
+TEST(ArrayTest, ArrayViewTestString) {
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING);
+
+  EXPECT_EQ(array_view.array, nullptr);
+  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_STRING);
+  EXPECT_EQ(array_view.layout.buffer_type[0], NANOARROW_BUFFER_TYPE_VALIDITY);
+  EXPECT_EQ(array_view.layout.buffer_type[1], NANOARROW_BUFFER_TYPE_DATA_OFFSET);
+  EXPECT_EQ(array_view.layout.buffer_type[2], NANOARROW_BUFFER_TYPE_DATA);
+  EXPECT_EQ(array_view.layout.element_size_bits[0], 1);
+  EXPECT_EQ(array_view.layout.element_size_bits[1], 32);
+  EXPECT_EQ(array_view.layout.element_size_bits[2], 0);
+
+  // Can't assume offset buffer size > 0 if length == 0
+  ArrowArrayViewSetLength(&array_view, 0);
+  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 0);
+  EXPECT_EQ(array_view.buffer_views[1].size_bytes, 0);
+  EXPECT_EQ(array_view.buffer_views[2].size_bytes, 0);
+
+  ArrowArrayViewSetLength(&array_view, 5);
+  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 1);
+  EXPECT_EQ(array_view.buffer_views[1].size_bytes, (5 + 1) * sizeof(int32_t));
+  EXPECT_EQ(array_view.buffer_views[2].size_bytes, 0);
+
+  struct ArrowArray array;
+
+  // Build + check zero length
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  array.null_count = 0;
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 0);
+  EXPECT_EQ(array_view.buffer_views[1].size_bytes, 0);
+  EXPECT_EQ(array_view.buffer_views[2].size_bytes, 0);
+
+  // Build non-zero length (the array ["abcd", "efg"])
+  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(&array, 1), 0), NANOARROW_OK);
+  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(&array, 1), 4), NANOARROW_OK);
+  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(&array, 1), 7), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowBufferReserve(ArrowArrayBuffer(&array, 2), 7), NANOARROW_OK);
+  ArrowBufferAppendUnsafe(ArrowArrayBuffer(&array, 2), "abcd", 4);
+  ArrowBufferAppendUnsafe(ArrowArrayBuffer(&array, 2), "efg", 3);
+  array.length = 2;
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 0);
+  EXPECT_EQ(array_view.buffer_views[1].size_bytes, (1 + array.length) * sizeof(int32_t));
+  EXPECT_EQ(array_view.buffer_views[2].size_bytes, 7);
+
+  // Expect error for offsets that will cause bad access
+  int32_t* offsets =
+      const_cast<int32_t*>(reinterpret_cast<const int32_t*>(array.buffers[1]));
+
+  offsets[0] = -1;
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected first offset >= 0 but found -1");
+  offsets[0] = 0;
+
+  offsets[1] = -1;
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "[1] Expected element size >= 0");
+
+  // Check sequential offsets whose diff causes overflow
+  offsets[1] = 2080374784;
+  offsets[2] = INT_MIN;
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "[2] Expected element size >= 0");
+
+  array.release(&array);
+  ArrowArrayViewReset(&array_view);
+}
+
+// Builds an array of type from values (where nullptr is a null element) and
+// returns the result of full validation of a view of it
+ArrowErrorCode ValidateFullStrings(enum ArrowType type, const char** values, int64_t n,
+                                   struct ArrowError* error) {
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  EXPECT_EQ(ArrowArrayInitFromType(&array, type), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int64_t i = 0; i < n; i++) {
+    if (values[i] == nullptr) {
+      EXPECT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+    } else {
+      EXPECT_EQ(ArrowArrayAppendString(&array, ArrowCharView(values[i])), NANOARROW_OK);
+    }
+  }
+  EXPECT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  ArrowArrayViewInitFromType(&array_view, type);
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, error), NANOARROW_OK);
+  ArrowErrorCode result =
+      ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, error);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  return result;
+}
+
+TEST(ArrayTest, ArrayViewTestValidateUtf8) {
+  struct ArrowError error;
+
+  const char* valid[] = {"", "abcdefghijklmnop", "\xc3\xa9", nullptr,
+                         "\xe2\x82\xac\xf0\x9f\x98\x80 and some longer text"};
+  for (auto type : {NANOARROW_TYPE_STRING, NANOARROW_TYPE_LARGE_STRING,
+                    NANOARROW_TYPE_STRING_VIEW}) {
+    EXPECT_EQ(ValidateFullStrings(type, valid, 5, &error), NANOARROW_OK);
+  }
+
+  // Overlong encoding, surrogate, code point > U+10FFFF, invalid lead byte and
+  // truncated sequences
+  const char* invalid[] = {"\xc0\xaf", "\xed\xa0\x80", "\xf4\x90\x80\x80", "\xff",
+                           "abc\xe2\x82", "\xf0\x9f\x98"};
+  for (auto type : {NANOARROW_TYPE_STRING, NANOARROW_TYPE_LARGE_STRING,
+                    NANOARROW_TYPE_STRING_VIEW}) {
+    for (const char* value : invalid) {
+      const char* values[] = {"abcdefghijklmnop", nullptr, value};
+      EXPECT_EQ(ValidateFullStrings(type, values, 3, &error), EINVAL);
+      EXPECT_STREQ(error.message, "[2] Expected valid UTF-8 string");
+    }
+  }
+
+  // Data that is valid UTF-8 as a whole can still contain invalid elements
+  const char* split[] = {"a\xc3", "\xa9z"};
+  EXPECT_EQ(ValidateFullStrings(NANOARROW_TYPE_STRING, split, 2, &error), EINVAL);
+  EXPECT_STREQ(error.message, "[0] Expected valid UTF-8 string");
+
+  // The content of null elements is not validated
+  struct ArrowArray array;
+  struct ArrowBitmap bitmap;
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("ab")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("\xff")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("c")), NANOARROW_OK);
+  ArrowBitmapInit(&bitmap);
+  ASSERT_EQ(ArrowBitmapAppend(&bitmap, 1, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowBitmapAppend(&bitmap, 0, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowBitmapAppend(&bitmap, 1, 1), NANOARROW_OK);
+  ArrowArraySetValidityBitmap(&array, &bitmap);
+  EXPECT_EQ(ArrowArrayFinishBuilding(&array, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK);
+  array.release(&array);
+}
+
+TEST(ArrayTest, ArrayViewTestLargeString) {
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_LARGE_STRING);
+
+  EXPECT_EQ(array_view.array, nullptr);
+  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_LARGE_STRING);
+  EXPECT_EQ(array_view.layout.buffer_type[0], NANOARROW_BUFFER_TYPE_VALIDITY);
+  EXPECT_EQ(array_view.layout.buffer_type[1], NANOARROW_BUFFER_TYPE_DATA_OFFSET);
+  EXPECT_EQ(array_view.layout.buffer_type[2], NANOARROW_BUFFER_TYPE_DATA);
+  EXPECT_EQ(array_view.layout.element_size_bits[0], 1);
+  EXPECT_EQ(array_view.layout.element_size_bits[1], 64);
+  EXPECT_EQ(array_view.layout.element_size_bits[2], 0);
+
+  // Can't assume offset buffer size > 0 if length == 0
+  ArrowArrayViewSetLength(&array_view, 0);
+  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 0);
+  EXPECT_EQ(array_view.buffer_views[1].size_bytes, 0);
+  EXPECT_EQ(array_view.buffer_views[2].size_bytes, 0);
+
+  ArrowArrayViewSetLength(&array_view, 5);
+  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 1);
   EXPECT_EQ(array_view.buffer_views[1].size_bytes, (5 + 1) * sizeof(int64_t));
   EXPECT_EQ(array_view.buffer_views[2].size_bytes, 0);
 
-  struct ArrowArray array;
+  struct ArrowArray array;
+
+  // Build + check zero length
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  array.null_count = 0;
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 0);
+  EXPECT_EQ(array_view.buffer_views[1].size_bytes, 0);
+  EXPECT_EQ(array_view.buffer_views[2].size_bytes, 0);
+
+  // Build non-zero length (the array ["abcd"])
+  ASSERT_EQ(ArrowBufferAppendInt64(ArrowArrayBuffer(&array, 1), 0), NANOARROW_OK);
+  ASSERT_EQ(ArrowBufferAppendInt64(ArrowArrayBuffer(&array, 1), 4), NANOARROW_OK);
+  ASSERT_EQ(ArrowBufferReserve(ArrowArrayBuffer(&array, 2), 4), NANOARROW_OK);
+  ArrowBufferAppendUnsafe(ArrowArrayBuffer(&array, 2), "abcd", 4);
+  array.length = 1;
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 0);
+  EXPECT_EQ(array_view.buffer_views[1].size_bytes, (1 + 1) * sizeof(int64_t));
+  EXPECT_EQ(array_view.buffer_views[2].size_bytes, 4);
+
+  // Expect error for offsets that will cause bad access
+  int64_t* offsets =
+      const_cast<int64_t*>(reinterpret_cast<const int64_t*>(array.buffers[1]));
+
+  offsets[0] = -1;
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected first offset >= 0 but found -1");
+  offsets[0] = 0;
+
+  offsets[1] = -1;
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "[1] Expected element size >= 0");
+
+  array.release(&array);
+  ArrowArrayViewReset(&array_view);
+}
+
+TEST(ArrayTest, ArrayViewTestStruct) {
+  struct ArrowArrayView array_view;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRUCT);
+
+  EXPECT_EQ(array_view.array, nullptr);
+  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_STRUCT);
+  EXPECT_EQ(array_view.layout.buffer_type[0], NANOARROW_BUFFER_TYPE_VALIDITY);
+  EXPECT_EQ(array_view.layout.element_size_bits[0], 1);
+
+  // Expect error for out-of-memory
+  EXPECT_EQ(ArrowArrayViewAllocateChildren(
+                &array_view, std::numeric_limits<int64_t>::max() / sizeof(void*)),
+            ENOMEM);
+
+  EXPECT_EQ(ArrowArrayViewAllocateChildren(&array_view, 2), NANOARROW_OK);
+  EXPECT_EQ(array_view.n_children, 2);
+  ArrowArrayViewInitFromType(array_view.children[0], NANOARROW_TYPE_INT32);
+  EXPECT_EQ(array_view.children[0]->storage_type, NANOARROW_TYPE_INT32);
+  ArrowArrayViewInitFromType(array_view.children[1], NANOARROW_TYPE_NA);
+  EXPECT_EQ(array_view.children[1]->storage_type, NANOARROW_TYPE_NA);
+
+  ArrowArrayViewSetLength(&array_view, 5);
+  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 1);
+  EXPECT_EQ(array_view.children[0]->buffer_views[1].size_bytes, 5 * sizeof(int32_t));
+
+  // Except error for attempting to allocate a children array that already exists
+  EXPECT_EQ(ArrowArrayViewAllocateChildren(&array_view, 1), EINVAL);
+
+  ArrowArrayViewReset(&array_view);
+}
+
+TEST(ArrayTest, ArrayViewTestList) {
+  struct ArrowArrayView array_view;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_LIST);
+
+  EXPECT_EQ(array_view.array, nullptr);
+  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_LIST);
+  EXPECT_EQ(array_view.layout.buffer_type[0], NANOARROW_BUFFER_TYPE_VALIDITY);
+  EXPECT_EQ(array_view.layout.element_size_bits[0], 1);
+  EXPECT_EQ(array_view.layout.buffer_type[1], NANOARROW_BUFFER_TYPE_DATA_OFFSET);
+  EXPECT_EQ(array_view.layout.element_size_bits[1], 8 * sizeof(int32_t));
+
+  EXPECT_EQ(ArrowArrayViewAllocateChildren(&array_view, 1), NANOARROW_OK);
+  EXPECT_EQ(array_view.n_children, 1);
+  ArrowArrayViewInitFromType(array_view.children[0], NANOARROW_TYPE_INT32);
+  EXPECT_EQ(array_view.children[0]->storage_type, NANOARROW_TYPE_INT32);
+
+  ArrowArrayViewSetLength(&array_view, 5);
+  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 1);
+  EXPECT_EQ(array_view.buffer_views[1].size_bytes, (5 + 1) * sizeof(int32_t));
+
+  // Build a valid array
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_LIST), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAllocateChildren(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromType(array.children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 1234), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
+            NANOARROW_OK);
+
+  // Expect error for offsets that will cause bad access
+  struct ArrowError error;
+  int32_t* offsets =
+      const_cast<int32_t*>(reinterpret_cast<const int32_t*>(array.buffers[1]));
+
+  offsets[0] = -1;
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected first offset >= 0 but found -1");
+  offsets[0] = 0;
+
+  offsets[1] = -1;
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "[1] Expected element size >= 0");
+
+  array.release(&array);
+  ArrowArrayViewReset(&array_view);
+}
+
+TEST(ArrayTest, ArrayViewTestListGet) {
+  struct ArrowArrayView array_view;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_LIST);
+  EXPECT_EQ(ArrowArrayViewAllocateChildren(&array_view, 1), NANOARROW_OK);
+  ArrowArrayViewInitFromType(array_view.children[0], NANOARROW_TYPE_INT32);
+
+  // Build a valid array
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_LIST), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAllocateChildren(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromType(array.children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 1234), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 42), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
+            NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewListChildOffset(&array_view, 0), 0);
+  EXPECT_EQ(ArrowArrayViewListChildOffset(&array_view, 1), 1);
+  EXPECT_EQ(ArrowArrayViewListChildOffset(&array_view, 2), 1);
+  EXPECT_EQ(ArrowArrayViewListChildOffset(&array_view, 3), 2);
+
+  array.release(&array);
+  ArrowArrayViewReset(&array_view);
+}
+
+TEST(ArrayTest, ArrayViewTestLargeListGet) {
+  struct ArrowArrayView array_view;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_LARGE_LIST);
+  EXPECT_EQ(ArrowArrayViewAllocateChildren(&array_view, 1), NANOARROW_OK);
+  ArrowArrayViewInitFromType(array_view.children[0], NANOARROW_TYPE_INT32);
+
+  // Build a valid array
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_LARGE_LIST), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAllocateChildren(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromType(array.children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 1234), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 42), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
+            NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewListChildOffset(&array_view, 0), 0);
+  EXPECT_EQ(ArrowArrayViewListChildOffset(&array_view, 1), 1);
+  EXPECT_EQ(ArrowArrayViewListChildOffset(&array_view, 2), 1);
+  EXPECT_EQ(ArrowArrayViewListChildOffset(&array_view, 3), 2);
+
+  array.release(&array);
+  ArrowArrayViewReset(&array_view);
+}
+
+TEST(ArrayTest, ArrayViewTestLargeList) {
+  struct ArrowArrayView array_view;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_LARGE_LIST);
+
+  EXPECT_EQ(array_view.array, nullptr);
+  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_LARGE_LIST);
+  EXPECT_EQ(array_view.layout.buffer_type[0], NANOARROW_BUFFER_TYPE_VALIDITY);
+  EXPECT_EQ(array_view.layout.element_size_bits[0], 1);
+  EXPECT_EQ(array_view.layout.buffer_type[1], NANOARROW_BUFFER_TYPE_DATA_OFFSET);
+  EXPECT_EQ(array_view.layout.element_size_bits[1], 8 * sizeof(int64_t));
+
+  EXPECT_EQ(ArrowArrayViewAllocateChildren(&array_view, 1), NANOARROW_OK);
+  EXPECT_EQ(array_view.n_children, 1);
+  ArrowArrayViewInitFromType(array_view.children[0], NANOARROW_TYPE_INT32);
+  EXPECT_EQ(array_view.children[0]->storage_type, NANOARROW_TYPE_INT32);
+
+  ArrowArrayViewSetLength(&array_view, 5);
+  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 1);
+  EXPECT_EQ(array_view.buffer_views[1].size_bytes, (5 + 1) * sizeof(int64_t));
+
+  // Build a valid array
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_LARGE_LIST), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAllocateChildren(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromType(array.children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 1234), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
+            NANOARROW_OK);
+
+  // Expect error for offsets that will cause bad access
+  struct ArrowError error;
+  int64_t* offsets =
+      const_cast<int64_t*>(reinterpret_cast<const int64_t*>(array.buffers[1]));
+
+  offsets[0] = -1;
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected first offset >= 0 but found -1");
+  offsets[0] = 0;
+
+  offsets[1] = -1;
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "[1] Expected element size >= 0");
+
+  array.release(&array);
+  ArrowArrayViewReset(&array_view);
+}
+
+TEST(ArrayTest, ArrayViewTestFixedSizeList) {
+  struct ArrowArrayView array_view;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_FIXED_SIZE_LIST);
+  array_view.layout.child_size_elements = 3;
+
+  EXPECT_EQ(array_view.array, nullptr);
+  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_FIXED_SIZE_LIST);
+  EXPECT_EQ(array_view.layout.buffer_type[0], NANOARROW_BUFFER_TYPE_VALIDITY);
+  EXPECT_EQ(array_view.layout.element_size_bits[0], 1);
+
+  EXPECT_EQ(ArrowArrayViewAllocateChildren(&array_view, 1), NANOARROW_OK);
+  EXPECT_EQ(array_view.n_children, 1);
+  ArrowArrayViewInitFromType(array_view.children[0], NANOARROW_TYPE_INT32);
+  EXPECT_EQ(array_view.children[0]->storage_type, NANOARROW_TYPE_INT32);
+
+  ArrowArrayViewSetLength(&array_view, 5);
+  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 1);
+  EXPECT_EQ(array_view.children[0]->buffer_views[1].size_bytes, 15 * sizeof(int32_t));
+
+  ArrowArrayViewReset(&array_view);
+}
+
+TEST(ArrayTest, ArrayViewTestStructArray) {
+  struct ArrowArrayView array_view;
+  struct ArrowArray array;
+  struct ArrowSchema schema;
+  struct ArrowError error;
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  EXPECT_EQ(array_view.n_children, 1);
+  EXPECT_EQ(array_view.children[0]->storage_type, NANOARROW_TYPE_INT32);
+
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+
+  // Expect error for the wrong number of children
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
+
+  ASSERT_EQ(ArrowArrayAllocateChildren(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromType(array.children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+
+  // Expect error for the wrong number of child elements
+  array.length = 1;
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
+
+  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(array.children[0], 1), 123),
+            NANOARROW_OK);
+  array.children[0]->length = 1;
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(array_view.children[0]->buffer_views[1].size_bytes, sizeof(int32_t));
+  EXPECT_EQ(array_view.children[0]->buffer_views[1].data.as_int32[0], 123);
+
+  ArrowArrayViewReset(&array_view);
+  schema.release(&schema);
+  array.release(&array);
+}
+
+TEST(ArrayTest, ArrayViewTestFixedSizeListArray) {
+  struct ArrowArrayView array_view;
+  struct ArrowArray array;
+  struct ArrowSchema schema;
+  struct ArrowError error;
+
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeFixedSize(&schema, NANOARROW_TYPE_FIXED_SIZE_LIST, 3),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  EXPECT_EQ(array_view.n_children, 1);
+  EXPECT_EQ(array_view.children[0]->storage_type, NANOARROW_TYPE_INT32);
+
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_FIXED_SIZE_LIST), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAllocateChildren(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromType(array.children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+
+  // Expect error for the wrong number of child elements
+  array.length = 1;
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
+
+  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(array.children[0], 1), 123),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(array.children[0], 1), 456),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(array.children[0], 1), 789),
+            NANOARROW_OK);
+  array.children[0]->length = 3;
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(array_view.children[0]->buffer_views[1].size_bytes, 3 * sizeof(int32_t));
+  EXPECT_EQ(array_view.children[0]->buffer_views[1].data.as_int32[0], 123);
+
+  ArrowArrayViewReset(&array_view);
+  schema.release(&schema);
+  array.release(&array);
+}
+
+TEST(ArrayTest, ArrayViewTestDictionary) {
+  struct ArrowSchema schema;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(&schema), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.dictionary, NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
+
+  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_INT32);
+  ASSERT_NE(array_view.dictionary, nullptr);
+  EXPECT_EQ(array_view.dictionary->storage_type, NANOARROW_TYPE_STRING);
+
+  // Build a dictionary array
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.dictionary, ArrowCharView("abc")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.dictionary, ArrowCharView("def")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 0), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(array_view.buffer_views[1].size_bytes, 2 * sizeof(int32_t));
+  EXPECT_EQ(array_view.dictionary->buffer_views[2].size_bytes, 6);
+
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
+            NANOARROW_OK);
+
+  // Full validation checks that indices refer to an element of the dictionary
+  const_cast<int32_t*>(array_view.buffer_views[1].data.as_int32)[1] = 2;
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message,
+               "[1] Expected dictionary index between 0 and 1 but found 2");
+  const_cast<int32_t*>(array_view.buffer_views[1].data.as_int32)[1] = 1;
+
+  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(&array_view, 0), 0);
+  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(&array_view, 1), 1);
+
+  struct ArrowStringView item;
+  item = ArrowArrayViewGetStringUnsafe(array_view.dictionary, 0);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), "abc");
+  item = ArrowArrayViewGetStringUnsafe(array_view.dictionary, 1);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), "def");
+
+  array.release(&array);
+
+  // Setting a non-dictionary array should error
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected dictionary but found NULL");
+
+  array.release(&array);
+
+  // Setting a dictionary array to a non-dictionary array view should error
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ArrowArrayViewReset(&array_view);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT32);
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected NULL dictionary but found dictionary member");
+
+  schema.release(&schema);
+  array.release(&array);
+  ArrowArrayViewReset(&array_view);
+}
+
+TEST(ArrayTest, ArrayViewTestUnionChildIndices) {
+  struct ArrowArrayView array_view;
+  struct ArrowArray array;
+  struct ArrowSchema schema;
+
+  // Build a simple union with one int and one string
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeUnion(&schema, NANOARROW_TYPE_DENSE_UNION, 2),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 123), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishUnionElement(&array, 0), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView("one twenty four")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishUnionElement(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  // The ArrayView for a union could in theroy be created without a schema.
+  // Currently FULL validation will fail here since we can't guarantee that
+  // these are valid.
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_DENSE_UNION);
+  ASSERT_EQ(ArrowArrayViewAllocateChildren(&array_view, 2), NANOARROW_OK);
+  ArrowArrayViewInitFromType(array_view.children[0], NANOARROW_TYPE_INT32);
+  ArrowArrayViewInitFromType(array_view.children[1], NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
+            EINVAL);
+
+  EXPECT_EQ(ArrowArrayViewUnionTypeId(&array_view, 0), 0);
+  EXPECT_EQ(ArrowArrayViewUnionTypeId(&array_view, 1), 1);
+  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 0), 0);
+  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 1), 1);
+
+  ArrowArrayViewReset(&array_view);
+
+  // The test schema explicitly sets the type_ids 0,1 and this should validate properly
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
+            NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewUnionTypeId(&array_view, 0), 0);
+  EXPECT_EQ(ArrowArrayViewUnionTypeId(&array_view, 1), 1);
+  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 0), 0);
+  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 1), 1);
+
+  // Check that bad type ids/offset are caught by validate full
+  struct ArrowError error;
+  int8_t* type_ids =
+      const_cast<int8_t*>(reinterpret_cast<const int8_t*>(array.buffers[0]));
+  int32_t* offsets =
+      const_cast<int32_t*>(reinterpret_cast<const int32_t*>(array.buffers[1]));
+  type_ids[0] = -1;
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message,
+               "[0] Expected buffer value between 0 and 1 but found value -1");
+  type_ids[0] = 0;
+
+  offsets[0] = -1;
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message,
+               "[0] Expected union offset for child id 0 to be between 0 and 1 but found "
+               "offset value -1");
+  offsets[0] = 0;
+
+  ArrowArrayViewReset(&array_view);
+
+  // Reversing the type ids should result in the same type ids but
+  // reversed child indices
+  ASSERT_EQ(ArrowSchemaSetFormat(&schema, "+ud:1,0"), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
+            NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewUnionTypeId(&array_view, 0), 0);
+  EXPECT_EQ(ArrowArrayViewUnionTypeId(&array_view, 1), 1);
+  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 0), 1);
+  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 1), 0);
+
+  // Check that bad type ids are caught by validate full
+  type_ids[0] = -1;
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "[0] Unexpected buffer value -1");
+  type_ids[0] = 0;
+
+  ArrowArrayViewReset(&array_view);
+
+  // Check the raw mapping in the array view for numbers that are easier to check
+  ASSERT_EQ(ArrowSchemaSetFormat(&schema, "+ud:6,2"), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
+  EXPECT_EQ(array_view.union_type_id_map[6], 0);
+  EXPECT_EQ(array_view.union_type_id_map[2], 1);
+  EXPECT_EQ(array_view.union_type_id_map[128 + 0], 6);
+  EXPECT_EQ(array_view.union_type_id_map[128 + 1], 2);
+
+  ArrowArrayViewReset(&array_view);
+  schema.release(&schema);
+  array.release(&array);
+}
+
+TEST(ArrayTest, ArrayViewTestValidateFullLongBuffers) {
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+
+  // Check that invalid values are reported beyond the first block of checked values
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("a")), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK);
+
+  int32_t* offsets =
+      const_cast<int32_t*>(reinterpret_cast<const int32_t*>(array.buffers[1]));
+  offsets[700] = 0;
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "[700] Expected element size >= 0");
+
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+
+  // ...and for union type ids
+  struct ArrowSchema schema;
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeUnion(&schema, NANOARROW_TYPE_SPARSE_UNION, 2),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[i % 2], i), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishUnionElement(&array, i % 2), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  int8_t* type_ids =
+      const_cast<int8_t*>(reinterpret_cast<const int8_t*>(array.buffers[0]));
+  type_ids[500] = 2;
+
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message,
+               "[500] Expected buffer value between 0 and 1 but found value 2");
+  ArrowArrayViewReset(&array_view);
+
+  type_ids[500] = -1;
+  ASSERT_EQ(ArrowSchemaSetFormat(&schema, "+us:1,0"), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "[500] Unexpected buffer value -1");
+
+  ArrowArrayViewReset(&array_view);
+  schema.release(&schema);
+  array.release(&array);
+}
+
+TEST(ArrayTest, ArrayViewTestDenseUnionGet) {
+  struct ArrowArrayView array_view;
+  struct ArrowArray array;
+  struct ArrowSchema schema;
+
+  // Build a simple union with one int and one string and one null int
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeUnion(&schema, NANOARROW_TYPE_DENSE_UNION, 2),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 123), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishUnionElement(&array, 0), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView("one twenty four")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishUnionElement(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  // Initialize the array view
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
+            NANOARROW_OK);
+
+  // Check the values that will be used to index into children
+  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 0), 0);
+  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 1), 1);
+  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 2), 0);
+
+  // Check the values that will be used to index into the child arrays
+  EXPECT_EQ(ArrowArrayViewUnionChildOffset(&array_view, 0), 0);
+  EXPECT_EQ(ArrowArrayViewUnionChildOffset(&array_view, 1), 0);
+  EXPECT_EQ(ArrowArrayViewUnionChildOffset(&array_view, 2), 1);
+
+  // Union elements are "never null" (even if the corresponding child element is)
+  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 2), NANOARROW_OK);
+
+  ArrowArrayViewReset(&array_view);
+  schema.release(&schema);
+  array.release(&array);
+}
+
+TEST(ArrayTest, ArrayViewTestSparseUnionGet) {
+  struct ArrowArrayView array_view;
+  struct ArrowArray array;
+  struct ArrowSchema schema;
+
+  // Build a simple union with one int and one string and one null int
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeUnion(&schema, NANOARROW_TYPE_SPARSE_UNION, 2),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 123), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishUnionElement(&array, 0), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView("one twenty four")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishUnionElement(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  // Initialize the array view
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
+            NANOARROW_OK);
+
+  // Check the values that will be used to index into children
+  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 0), 0);
+  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 1), 1);
+  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 2), 0);
+
+  // Check the values that will be used to index into the child arrays
+  EXPECT_EQ(ArrowArrayViewUnionChildOffset(&array_view, 0), 0);
+  EXPECT_EQ(ArrowArrayViewUnionChildOffset(&array_view, 1), 1);
+  EXPECT_EQ(ArrowArrayViewUnionChildOffset(&array_view, 2), 2);
+
+  // Union elements are "never null" (even if the corresponding child element is)
+  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 2), NANOARROW_OK);
+
+  ArrowArrayViewReset(&array_view);
+  schema.release(&schema);
+  array.release(&array);
+}
+
+template <typename TypeClass>
+void TestGetFromNumericArrayView() {
+  struct ArrowArray array;
+  struct ArrowSchema schema;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+
+  auto type = TypeTraits<TypeClass>::type_singleton();
+
+  // Array with nulls
+  auto builder = NumericBuilder<TypeClass>();
+  ARROW_EXPECT_OK(builder.Append(1));
+  ARROW_EXPECT_OK(builder.AppendNulls(2));
+  ARROW_EXPECT_OK(builder.Append(4));
+  auto maybe_arrow_array = builder.Finish();
+  ARROW_EXPECT_OK(maybe_arrow_array);
+  auto arrow_array = maybe_arrow_array.ValueUnsafe();
+
+  ARROW_EXPECT_OK(ExportArray(*arrow_array, &array, &schema));
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 2), 1);
+  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 3), 0);
+
+  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(&array_view, 3), 4);
+  EXPECT_EQ(ArrowArrayViewGetUIntUnsafe(&array_view, 3), 4);
+  EXPECT_EQ(ArrowArrayViewGetDoubleUnsafe(&array_view, 3), 4.0);
+
+  auto string_view = ArrowArrayViewGetStringUnsafe(&array_view, 0);
+  EXPECT_EQ(string_view.data, nullptr);
+  EXPECT_EQ(string_view.size_bytes, 0);
+  auto buffer_view = ArrowArrayViewGetBytesUnsafe(&array_view, 0);
+  EXPECT_EQ(buffer_view.data.data, nullptr);
+  EXPECT_EQ(buffer_view.size_bytes, 0);
+
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
+
+  // Array without nulls (Arrow does not allocate the validity buffer)
+  builder = NumericBuilder<TypeClass>();
+  ARROW_EXPECT_OK(builder.Append(1));
+  ARROW_EXPECT_OK(builder.Append(2));
+  maybe_arrow_array = builder.Finish();
+  ARROW_EXPECT_OK(maybe_arrow_array);
+  arrow_array = maybe_arrow_array.ValueUnsafe();
+
+  ARROW_EXPECT_OK(ExportArray(*arrow_array, &array, &schema));
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK);
+
+  // We're trying to test behavior with no validity buffer, so make sure that's true
+  ASSERT_EQ(array_view.buffer_views[0].data.data, nullptr);
+
+  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 0), 0);
+  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 1), 0);
+
+  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(&array_view, 0), 1);
+  EXPECT_EQ(ArrowArrayViewGetUIntUnsafe(&array_view, 1), 2);
+
+  int64_t ints[2];
+  ArrowArrayViewGetIntsUnsafe(&array_view, 0, 2, ints);
+  EXPECT_EQ(ints[0], 1);
+  EXPECT_EQ(ints[1], 2);
+
+  double doubles[2];
+  ArrowArrayViewGetDoublesUnsafe(&array_view, 0, 2, doubles);
+  EXPECT_EQ(doubles[0], 1.0);
+  EXPECT_EQ(doubles[1], 2.0);
+
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
+}
+
+TEST(ArrayViewTest, ArrayViewTestGetNumeric) {
+  TestGetFromNumericArrayView<Int64Type>();
+  TestGetFromNumericArrayView<UInt64Type>();
+  TestGetFromNumericArrayView<Int32Type>();
+  TestGetFromNumericArrayView<UInt32Type>();
+  TestGetFromNumericArrayView<Int16Type>();
+  TestGetFromNumericArrayView<UInt32Type>();
+  TestGetFromNumericArrayView<Int8Type>();
+  TestGetFromNumericArrayView<UInt32Type>();
+  TestGetFromNumericArrayView<DoubleType>();
+  TestGetFromNumericArrayView<FloatType>();
+}
+
+template <typename BuilderClass>
+void TestGetFromBinary(BuilderClass& builder) {
+  struct ArrowArray array;
+  struct ArrowSchema schema;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+
+  auto type = builder.type();
+  ARROW_EXPECT_OK(builder.Append("1234"));
+  ARROW_EXPECT_OK(builder.AppendNulls(2));
+  ARROW_EXPECT_OK(builder.Append("four"));
+  auto maybe_arrow_array = builder.Finish();
+  ARROW_EXPECT_OK(maybe_arrow_array);
+  auto arrow_array = maybe_arrow_array.ValueUnsafe();
 
-  // Build + check zero length
-  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
-  array.null_count = 0;
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  ARROW_EXPECT_OK(ExportArray(*arrow_array, &array, &schema));
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
   EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
             NANOARROW_OK);
-  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 0);
-  EXPECT_EQ(array_view.buffer_views[1].size_bytes, 0);
-  EXPECT_EQ(array_view.buffer_views[2].size_bytes, 0);
-
-  // Build non-zero length (the array ["abcd"])
-  ASSERT_EQ(ArrowBufferAppendInt64(ArrowArrayBuffer(&array, 1), 0), NANOARROW_OK);
-  ASSERT_EQ(ArrowBufferAppendInt64(ArrowArrayBuffer(&array, 1), 4), NANOARROW_OK);
-  ASSERT_EQ(ArrowBufferReserve(ArrowArrayBuffer(&array, 2), 4), NANOARROW_OK);
-  ArrowBufferAppendUnsafe(ArrowArrayBuffer(&array, 2), "abcd", 4);
-  array.length = 1;
-  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
 
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
-            NANOARROW_OK);
-  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 0);
-  EXPECT_EQ(array_view.buffer_views[1].size_bytes, (1 + 1) * sizeof(int64_t));
-  EXPECT_EQ(array_view.buffer_views[2].size_bytes, 4);
+  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 2), 1);
+  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 3), 0);
 
-  // Expect error for offsets that will cause bad access
-  int64_t* offsets =
-      const_cast<int64_t*>(reinterpret_cast<const int64_t*>(array.buffers[1]));
+  auto string_view = ArrowArrayViewGetStringUnsafe(&array_view, 3);
+  EXPECT_EQ(string_view.size_bytes, strlen("four"));
+  EXPECT_EQ(memcmp(string_view.data, "four", string_view.size_bytes), 0);
 
-  offsets[0] = -1;
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
-  EXPECT_STREQ(error.message, "Expected first offset >= 0 but found -1");
-  offsets[0] = 0;
+  auto buffer_view = ArrowArrayViewGetBytesUnsafe(&array_view, 3);
+  EXPECT_EQ(buffer_view.size_bytes, strlen("four"));
+  EXPECT_EQ(memcmp(buffer_view.data.as_char, "four", buffer_view.size_bytes), 0);
 
-  offsets[1] = -1;
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
-            EINVAL);
-  EXPECT_STREQ(error.message, "[1] Expected element size >= 0");
+  struct ArrowStringView string_views[2];
+  ArrowArrayViewGetStringsUnsafe(&array_view, 2, 2, string_views);
+  EXPECT_EQ(string_views[1].size_bytes, strlen("four"));
+  EXPECT_EQ(memcmp(string_views[1].data, "four", string_views[1].size_bytes), 0);
 
-  array.release(&array);
   ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
 }
 
-TEST(ArrayTest, ArrayViewTestStruct) {
-  struct ArrowArrayView array_view;
-  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRUCT);
-
-  EXPECT_EQ(array_view.array, nullptr);
-  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_STRUCT);
-  EXPECT_EQ(array_view.layout.buffer_type[0], NANOARROW_BUFFER_TYPE_VALIDITY);
-  EXPECT_EQ(array_view.layout.element_size_bits[0], 1);
-
-  // Expect error for out-of-memory
-  EXPECT_EQ(ArrowArrayViewAllocateChildren(
-                &array_view, std::numeric_limits<int64_t>::max() / sizeof(void*)),
-            ENOMEM);
+TEST(ArrayViewTest, ArrayViewTestGetString) {
+  auto string_builder = StringBuilder();
+  TestGetFromBinary<StringBuilder>(string_builder);
 
-  EXPECT_EQ(ArrowArrayViewAllocateChildren(&array_view, 2), NANOARROW_OK);
-  EXPECT_EQ(array_view.n_children, 2);
-  ArrowArrayViewInitFromType(array_view.children[0], NANOARROW_TYPE_INT32);
-  EXPECT_EQ(array_view.children[0]->storage_type, NANOARROW_TYPE_INT32);
-  ArrowArrayViewInitFromType(array_view.children[1], NANOARROW_TYPE_NA);
-  EXPECT_EQ(array_view.children[1]->storage_type, NANOARROW_TYPE_NA);
+  auto binary_builder = BinaryBuilder();
+  TestGetFromBinary<BinaryBuilder>(binary_builder);
 
-  ArrowArrayViewSetLength(&array_view, 5);
-  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 1);
-  EXPECT_EQ(array_view.children[0]->buffer_views[1].size_bytes, 5 * sizeof(int32_t));
+  auto large_string_builder = LargeStringBuilder();
+  TestGetFromBinary<LargeStringBuilder>(large_string_builder);
 
-  // Except error for attempting to allocate a children array that already exists
-  EXPECT_EQ(ArrowArrayViewAllocateChildren(&array_view, 1), EINVAL);
+  auto large_binary_builder = LargeBinaryBuilder();
+  TestGetFromBinary<LargeBinaryBuilder>(large_binary_builder);
 
-  ArrowArrayViewReset(&array_view);
+  auto fixed_size_builder = FixedSizeBinaryBuilder(fixed_size_binary(4));
+  TestGetFromBinary<FixedSizeBinaryBuilder>(fixed_size_builder);
 }
 
-TEST(ArrayTest, ArrayViewTestList) {
+TEST(ArrayViewTest, ArrayViewTestDecodeDictionary) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
   struct ArrowArrayView array_view;
-  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_LIST);
+  struct ArrowError error;
 
-  EXPECT_EQ(array_view.array, nullptr);
-  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_LIST);
-  EXPECT_EQ(array_view.layout.buffer_type[0], NANOARROW_BUFFER_TYPE_VALIDITY);
-  EXPECT_EQ(array_view.layout.element_size_bits[0], 1);
-  EXPECT_EQ(array_view.layout.buffer_type[1], NANOARROW_BUFFER_TYPE_DATA_OFFSET);
-  EXPECT_EQ(array_view.layout.element_size_bits[1], 8 * sizeof(int32_t));
+  MakeStringDictionaryArray(&schema, &array, {"a", "bb", "ccc"}, {2, 0, -1, 1, 2});
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
 
-  EXPECT_EQ(ArrowArrayViewAllocateChildren(&array_view, 1), NANOARROW_OK);
-  EXPECT_EQ(array_view.n_children, 1);
-  ArrowArrayViewInitFromType(array_view.children[0], NANOARROW_TYPE_INT32);
-  EXPECT_EQ(array_view.children[0]->storage_type, NANOARROW_TYPE_INT32);
+  struct ArrowStringView value = ArrowArrayViewGetDictionaryStringUnsafe(&array_view, 0);
+  EXPECT_EQ(std::string(value.data, value.size_bytes), "ccc");
+  struct ArrowBufferView bytes = ArrowArrayViewGetDictionaryBytesUnsafe(&array_view, 3);
+  EXPECT_EQ(std::string(bytes.data.as_char, bytes.size_bytes), "bb");
 
-  ArrowArrayViewSetLength(&array_view, 5);
-  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 1);
-  EXPECT_EQ(array_view.buffer_views[1].size_bytes, (5 + 1) * sizeof(int32_t));
+  std::vector<struct ArrowStringView> strings(4);
+  ASSERT_EQ(ArrowArrayViewDecodeDictionary(&array_view, 1, 4, strings.data(), &error),
+            NANOARROW_OK);
+  EXPECT_EQ(std::string(strings[0].data, strings[0].size_bytes), "a");
+  EXPECT_EQ(strings[1].data, nullptr);
+  EXPECT_EQ(strings[1].size_bytes, 0);
+  EXPECT_EQ(std::string(strings[2].data, strings[2].size_bytes), "bb");
+  EXPECT_EQ(std::string(strings[3].data, strings[3].size_bytes), "ccc");
 
-  // Build a valid array
-  struct ArrowArray array;
-  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_LIST), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAllocateChildren(&array, 1), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayInitFromType(array.children[0], NANOARROW_TYPE_INT32),
+  EXPECT_EQ(ArrowArrayViewDecodeDictionary(&array_view, 2, 4, strings.data(), &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Expected range [2, 6) within array of length 5");
+  EXPECT_EQ(ArrowArrayViewDecodeDictionary(array_view.dictionary, 0, 1, strings.data(),
+                                           &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Expected dictionary-encoded array view");
+
+  // Indices are checked against the bounds of the dictionary
+  array_view.dictionary->length = 2;
+  EXPECT_EQ(ArrowArrayViewDecodeDictionary(&array_view, 0, 5, strings.data(), &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "[0] Expected dictionary index in [0, 2) but found 2");
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
+
+  // Fixed-width dictionaries are decoded into values of their width
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_INT16), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(&schema), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.dictionary, NANOARROW_TYPE_DOUBLE),
             NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 1234), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(array.dictionary, 1.5), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(array.dictionary, -2), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 0), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
 
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
+  EXPECT_EQ(ArrowArrayViewGetDictionaryDoubleUnsafe(&array_view, 0), -2);
+  EXPECT_EQ(ArrowArrayViewGetDictionaryIntUnsafe(&array_view, 2), 1);
+  EXPECT_EQ(ArrowArrayViewGetDictionaryUIntUnsafe(&array_view, 2), 1);
+
+  double doubles[3];
+  ASSERT_EQ(ArrowArrayViewDecodeDictionary(&array_view, 0, 3, doubles, &error),
             NANOARROW_OK);
+  EXPECT_EQ(doubles[0], -2);
+  EXPECT_EQ(doubles[1], 0);
+  EXPECT_EQ(doubles[2], 1.5);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
 
-  // Expect error for offsets that will cause bad access
+  // Boolean dictionaries are not supported
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT8);
+  ASSERT_EQ(ArrowArrayViewAllocateDictionary(&array_view), NANOARROW_OK);
+  ArrowArrayViewInitFromType(array_view.dictionary, NANOARROW_TYPE_BOOL);
+  EXPECT_EQ(ArrowArrayViewDecodeDictionary(&array_view, 0, 0, doubles, &error), ENOTSUP);
+  EXPECT_STREQ(error.message, "Decoding dictionaries of type bool is not supported");
+  ArrowArrayViewReset(&array_view);
+}
+
+TEST(ArrayViewTest, ArrayViewTestCast) {
+  struct ArrowSchema source_schema;
+  struct ArrowSchema target_schema;
+  struct ArrowSchemaView source_type;
+  struct ArrowSchemaView target_type;
+  struct ArrowArray array;
+  struct ArrowArray out;
+  struct ArrowArrayView array_view;
+  struct ArrowArrayView out_view;
   struct ArrowError error;
-  int32_t* offsets =
-      const_cast<int32_t*>(reinterpret_cast<const int32_t*>(array.buffers[1]));
 
-  offsets[0] = -1;
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
-  EXPECT_STREQ(error.message, "Expected first offset >= 0 but found -1");
-  offsets[0] = 0;
+  // int64 to int8 with a null, whose value is not checked
+  ASSERT_EQ(ArrowSchemaInitFromType(&source_schema, NANOARROW_TYPE_INT64), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(&target_schema, NANOARROW_TYPE_INT8), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInit(&source_type, &source_schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInit(&target_type, &target_schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &source_schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int64_t i = 0; i < 1000; i++) {
+    ASSERT_EQ(ArrowArrayAppendInt(&array, i % 200 - 100), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  reinterpret_cast<int64_t*>(ArrowArrayBuffer(&array, 1)->data)[1000] = 1000;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &source_schema, &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
 
-  offsets[1] = -1;
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+  ASSERT_EQ(ArrowArrayViewCast(&array_view, &source_type, &target_type,
+                               NANOARROW_CAST_DEFAULT, &out, &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&out_view, &target_schema, &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&out_view, &out, &error), NANOARROW_OK);
+  EXPECT_EQ(out.length, 1001);
+  EXPECT_EQ(out.null_count, 1);
+  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(&out_view, 0), -100);
+  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(&out_view, 999), 99);
+  EXPECT_TRUE(ArrowArrayViewIsNull(&out_view, 1000));
+  ArrowArrayViewReset(&out_view);
+  out.release(&out);
+
+  // A non-null value that overflows is an error unless overflow is allowed
+  reinterpret_cast<int64_t*>(ArrowArrayBuffer(&array, 1)->data)[500] = 128;
+  EXPECT_EQ(ArrowArrayViewCast(&array_view, &source_type, &target_type,
+                               NANOARROW_CAST_DEFAULT, &out, &error),
+            EOVERFLOW);
+  EXPECT_STREQ(error.message, "[500] Value 128 overflows int8");
+  ASSERT_EQ(ArrowArrayViewCast(&array_view, &source_type, &target_type,
+                               NANOARROW_CAST_ALLOW_OVERFLOW, &out, &error),
+            NANOARROW_OK);
+  out.release(&out);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  target_schema.release(&target_schema);
+  source_schema.release(&source_schema);
+
+  // Doubles to int32 check for truncation; doubles to decimal round
+  ASSERT_EQ(ArrowSchemaInitFromType(&source_schema, NANOARROW_TYPE_DOUBLE), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(&target_schema, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInit(&source_type, &source_schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInit(&target_type, &target_schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &source_schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(&array, 1.5), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(&array, -2.5), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &source_schema, &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewCast(&array_view, &source_type, &target_type,
+                               NANOARROW_CAST_DEFAULT, &out, &error),
             EINVAL);
-  EXPECT_STREQ(error.message, "[1] Expected element size >= 0");
+  EXPECT_STREQ(error.message, "[0] Value 1.5 would be truncated casting to int32");
+  ASSERT_EQ(ArrowArrayViewCast(&array_view, &source_type, &target_type,
+                               NANOARROW_CAST_ALLOW_TRUNCATE, &out, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(out.buffers[1])[0], 1);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(out.buffers[1])[1], -2);
+  out.release(&out);
+  target_schema.release(&target_schema);
 
-  array.release(&array);
+  ArrowSchemaInit(&target_schema);
+  ASSERT_EQ(ArrowSchemaSetTypeDecimal(&target_schema, NANOARROW_TYPE_DECIMAL128, 3, 0),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInit(&target_type, &target_schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewCast(&array_view, &source_type, &target_type,
+                               NANOARROW_CAST_DEFAULT, &out, &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&out_view, &target_schema, &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&out_view, &out, &error), NANOARROW_OK);
+  struct ArrowDecimal decimal;
+  ArrowDecimalInit(&decimal, 128, 3, 0);
+  ArrowArrayViewGetDecimalUnsafe(&out_view, 0, &decimal);
+  EXPECT_EQ(ArrowDecimalGetIntUnsafe(&decimal), 2);
+  ArrowArrayViewGetDecimalUnsafe(&out_view, 1, &decimal);
+  EXPECT_EQ(ArrowDecimalGetIntUnsafe(&decimal), -3);
+  EXPECT_EQ(ArrowDecimalSign(&decimal), -1);
+  ArrowArrayViewReset(&out_view);
+  out.release(&out);
   ArrowArrayViewReset(&array_view);
-}
-
-TEST(ArrayTest, ArrayViewTestListGet) {
-  struct ArrowArrayView array_view;
-  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_LIST);
-  EXPECT_EQ(ArrowArrayViewAllocateChildren(&array_view, 1), NANOARROW_OK);
-  ArrowArrayViewInitFromType(array_view.children[0], NANOARROW_TYPE_INT32);
+  array.release(&array);
+  source_schema.release(&source_schema);
 
-  // Build a valid array
-  struct ArrowArray array;
-  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_LIST), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAllocateChildren(&array, 1), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayInitFromType(array.children[0], NANOARROW_TYPE_INT32),
+  // Decimals are rescaled and checked against the target precision
+  ArrowSchemaInit(&source_schema);
+  ASSERT_EQ(ArrowSchemaSetTypeDecimal(&source_schema, NANOARROW_TYPE_DECIMAL128, 6, 2),
             NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInit(&source_type, &source_schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &source_schema, nullptr), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 1234), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 42), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  ArrowDecimalInit(&decimal, 128, 6, 2);
+  ArrowDecimalSetInt(&decimal, -1200);
+  ASSERT_EQ(ArrowArrayAppendDecimal(&array, &decimal), NANOARROW_OK);
+  ArrowDecimalSetInt(&decimal, 123400);
+  ASSERT_EQ(ArrowArrayAppendDecimal(&array, &decimal), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
-
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &source_schema, &error),
             NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
 
-  EXPECT_EQ(ArrowArrayViewListChildOffset(&array_view, 0), 0);
-  EXPECT_EQ(ArrowArrayViewListChildOffset(&array_view, 1), 1);
-  EXPECT_EQ(ArrowArrayViewListChildOffset(&array_view, 2), 1);
-  EXPECT_EQ(ArrowArrayViewListChildOffset(&array_view, 3), 2);
+  EXPECT_EQ(ArrowArrayViewCast(&array_view, &source_type, &target_type,
+                               NANOARROW_CAST_DEFAULT, &out, &error),
+            EOVERFLOW);
+  EXPECT_STREQ(error.message, "[1] Value 1234 overflows decimal128");
+  target_schema.release(&target_schema);
 
+  ASSERT_EQ(ArrowSchemaInitFromType(&target_schema, NANOARROW_TYPE_DOUBLE), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInit(&target_type, &target_schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewCast(&array_view, &source_type, &target_type,
+                               NANOARROW_CAST_DEFAULT, &out, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(reinterpret_cast<const double*>(out.buffers[1])[0], -12);
+  EXPECT_EQ(reinterpret_cast<const double*>(out.buffers[1])[1], 1234);
+  out.release(&out);
+  ArrowArrayViewReset(&array_view);
   array.release(&array);
+  target_schema.release(&target_schema);
+  source_schema.release(&source_schema);
+
+  // Timestamps are converted to dates rounding towards negative infinity
+  ArrowSchemaInit(&source_schema);
+  ASSERT_EQ(ArrowSchemaSetTypeDateTime(&source_schema, NANOARROW_TYPE_TIMESTAMP,
+                                       NANOARROW_TIME_UNIT_SECOND, "UTC"),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(&target_schema, NANOARROW_TYPE_DATE32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInit(&source_type, &source_schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInit(&target_type, &target_schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &source_schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 86400), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, -1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &source_schema, &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewCast(&array_view, &source_type, &target_type,
+                               NANOARROW_CAST_DEFAULT, &out, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "[1] Value -1 would be truncated casting to date32");
+  ASSERT_EQ(ArrowArrayViewCast(&array_view, &source_type, &target_type,
+                               NANOARROW_CAST_ALLOW_TRUNCATE, &out, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(out.buffers[1])[0], 1);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(out.buffers[1])[1], -1);
+  out.release(&out);
+  target_schema.release(&target_schema);
+
+  // Timestamps and int64 have identical storage and share buffers
+  ASSERT_EQ(ArrowSchemaInitFromType(&target_schema, NANOARROW_TYPE_INT64), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInit(&target_type, &target_schema, &error), NANOARROW_OK);
+  const void* data = array.buffers[1];
+  ASSERT_EQ(ArrowArrayViewCast(&array_view, &source_type, &target_type,
+                               NANOARROW_CAST_DEFAULT, &out, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(out.buffers[1], data);
+  EXPECT_EQ(out.length, 2);
+  out.release(&out);
+  target_schema.release(&target_schema);
+
+  // Temporal values are not converted to floating point or between kinds
+  ASSERT_EQ(ArrowSchemaInitFromType(&target_schema, NANOARROW_TYPE_DOUBLE), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInit(&target_type, &target_schema, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewCast(&array_view, &source_type, &target_type,
+                               NANOARROW_CAST_DEFAULT, &out, &error),
+            ENOTSUP);
+  EXPECT_STREQ(error.message, "Cast from timestamp to double is not supported");
+  target_schema.release(&target_schema);
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&target_schema, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInit(&target_type, &target_schema, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewCast(&array_view, &source_type, &target_type,
+                               NANOARROW_CAST_DEFAULT, &out, &error),
+            ENOTSUP);
   ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  target_schema.release(&target_schema);
+  source_schema.release(&source_schema);
 }
 
-TEST(ArrayTest, ArrayViewTestLargeListGet) {
+TEST(ArrayViewTest, ArrayViewTestCastDecimalToString) {
+  struct ArrowSchema source_schema;
+  struct ArrowSchema target_schema;
+  struct ArrowSchemaView source_type;
+  struct ArrowSchemaView target_type;
+  struct ArrowArray array;
   struct ArrowArrayView array_view;
-  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_LARGE_LIST);
-  EXPECT_EQ(ArrowArrayViewAllocateChildren(&array_view, 1), NANOARROW_OK);
-  ArrowArrayViewInitFromType(array_view.children[0], NANOARROW_TYPE_INT32);
+  struct ArrowArray out;
+  struct ArrowArrayView out_view;
+  struct ArrowDecimal decimal;
+  struct ArrowError error;
 
-  // Build a valid array
+  for (auto decimal_type : {NANOARROW_TYPE_DECIMAL128, NANOARROW_TYPE_DECIMAL256}) {
+    int32_t bitwidth = decimal_type == NANOARROW_TYPE_DECIMAL128 ? 128 : 256;
+    ArrowSchemaInit(&source_schema);
+    ASSERT_EQ(ArrowSchemaSetTypeDecimal(&source_schema, decimal_type, 30, 2),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowSchemaViewInit(&source_type, &source_schema, &error), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayInitFromSchema(&array, &source_schema, nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    ArrowDecimalInit(&decimal, bitwidth, 30, 2);
+    for (const char* value : {"123.45", "-0.05", "123456789012345678901234567.89"}) {
+      ASSERT_EQ(ArrowDecimalSetString(&decimal, ArrowCharView(value)), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayAppendDecimal(&array, &decimal), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &source_schema, &error),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+
+    for (auto string_type : {NANOARROW_TYPE_STRING, NANOARROW_TYPE_LARGE_STRING}) {
+      ASSERT_EQ(ArrowSchemaInitFromType(&target_schema, string_type), NANOARROW_OK);
+      ASSERT_EQ(ArrowSchemaViewInit(&target_type, &target_schema, &error),
+                NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayViewCast(&array_view, &source_type, &target_type,
+                                   NANOARROW_CAST_DEFAULT, &out, &error),
+                NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayViewInitFromSchema(&out_view, &target_schema, &error),
+                NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayViewSetArray(&out_view, &out, &error), NANOARROW_OK);
+      ASSERT_EQ(out_view.length, 4);
+      EXPECT_EQ(out_view.null_count, 1);
+
+      struct ArrowStringView value = ArrowArrayViewGetStringUnsafe(&out_view, 0);
+      EXPECT_EQ(std::string(value.data, value.size_bytes), "123.45");
+      value = ArrowArrayViewGetStringUnsafe(&out_view, 1);
+      EXPECT_EQ(std::string(value.data, value.size_bytes), "-0.05");
+      value = ArrowArrayViewGetStringUnsafe(&out_view, 2);
+      EXPECT_EQ(std::string(value.data, value.size_bytes),
+                "123456789012345678901234567.89");
+      EXPECT_TRUE(ArrowArrayViewIsNull(&out_view, 3));
+
+      ArrowArrayViewReset(&out_view);
+      out.release(&out);
+      target_schema.release(&target_schema);
+    }
+
+    ArrowArrayViewReset(&array_view);
+    array.release(&array);
+    source_schema.release(&source_schema);
+  }
+}
+
+TEST(ArrayViewTest, ArrayViewTestTemporalTruncate) {
+  struct ArrowSchema schema;
+  struct ArrowSchemaView type;
   struct ArrowArray array;
-  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_LARGE_LIST), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAllocateChildren(&array, 1), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayInitFromType(array.children[0], NANOARROW_TYPE_INT32),
+  struct ArrowArray out;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+
+  // Timestamps are truncated in UTC regardless of their timezone
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeDateTime(&schema, NANOARROW_TYPE_TIMESTAMP,
+                                       NANOARROW_TIME_UNIT_SECOND, "America/Halifax"),
             NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInit(&type, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  // 2024-03-15 13:47:12, 1969-12-31 23:59:59, and 2024-03-17 00:00:00
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 1710510432), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, -1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 1710633600), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  // Null values are not checked for overflow
+  reinterpret_cast<int64_t*>(ArrowArrayBuffer(&array, 1)->data)[3] = INT64_MIN;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+
+  struct {
+    enum ArrowCalendarUnit unit;
+    int64_t multiple;
+    int64_t expected[3];
+  } cases[] = {
+      {NANOARROW_CALENDAR_UNIT_MINUTE, 15, {1710510300, -900, 1710633600}},
+      {NANOARROW_CALENDAR_UNIT_DAY, 1, {1710460800, -86400, 1710633600}},
+      {NANOARROW_CALENDAR_UNIT_WEEK, 1, {1710115200, -259200, 1710115200}},
+      {NANOARROW_CALENDAR_UNIT_MONTH, 1, {1709251200, -2678400, 1709251200}},
+      {NANOARROW_CALENDAR_UNIT_MONTH, 3, {1704067200, -7948800, 1704067200}},
+      {NANOARROW_CALENDAR_UNIT_YEAR, 1, {1704067200, -31536000, 1704067200}}};
+
+  for (const auto& test_case : cases) {
+    SCOPED_TRACE(test_case.unit);
+    ASSERT_EQ(ArrowArrayViewTemporalTruncate(&array_view, &type, test_case.unit,
+                                             test_case.multiple, &out, &error),
+              NANOARROW_OK)
+        << error.message;
+    ASSERT_EQ(out.length, 4);
+    EXPECT_EQ(out.null_count, 1);
+    const int64_t* values = reinterpret_cast<const int64_t*>(out.buffers[1]);
+    EXPECT_EQ(values[0], test_case.expected[0]);
+    EXPECT_EQ(values[1], test_case.expected[1]);
+    EXPECT_EQ(values[2], test_case.expected[2]);
+    out.release(&out);
+  }
+
+  EXPECT_EQ(ArrowArrayViewTemporalTruncate(&array_view, &type,
+                                           NANOARROW_CALENDAR_UNIT_MILLISECOND, 1500,
+                                           &out, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message,
+               "Buckets of 1500 units are not a multiple or divisor of the unit of "
+               "timestamp");
+  EXPECT_EQ(ArrowArrayViewTemporalTruncate(&array_view, &type,
+                                           NANOARROW_CALENDAR_UNIT_DAY, 0, &out, &error),
+            EINVAL);
+
+  // The start of the bucket of a non-null value may overflow
+  reinterpret_cast<int64_t*>(ArrowArrayBuffer(&array, 1)->data)[1] = INT64_MIN + 1;
+  EXPECT_EQ(ArrowArrayViewTemporalTruncate(&array_view, &type,
+                                           NANOARROW_CALENDAR_UNIT_SECOND, 10, &out,
+                                           &error),
+            EOVERFLOW);
+  EXPECT_STREQ(error.message,
+               "[1] Truncated value -9223372036854775807 overflows timestamp");
+  EXPECT_EQ(ArrowArrayViewTemporalTruncate(&array_view, &type,
+                                           NANOARROW_CALENDAR_UNIT_YEAR, 1, &out,
+                                           &error),
+            EOVERFLOW);
+
+  // Buckets that divide the unit leave values unchanged and share buffers
+  ASSERT_EQ(ArrowArrayViewTemporalTruncate(&array_view, &type,
+                                           NANOARROW_CALENDAR_UNIT_MILLISECOND, 250,
+                                           &out, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(out.buffers[1], array.buffers[1]);
+  out.release(&out);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
+
+  // Dates are truncated to multiples of calendar units counted from 1970
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_DATE32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInit(&type, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 1234), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 42), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  // 2024-02-29 and 1900-03-01
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 19782), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, -25508), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
 
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
+  ASSERT_EQ(ArrowArrayViewTemporalTruncate(&array_view, &type,
+                                           NANOARROW_CALENDAR_UNIT_MONTH, 1, &out,
+                                           &error),
             NANOARROW_OK);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(out.buffers[1])[0], 19754);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(out.buffers[1])[1], -25508);
+  out.release(&out);
 
-  EXPECT_EQ(ArrowArrayViewListChildOffset(&array_view, 0), 0);
-  EXPECT_EQ(ArrowArrayViewListChildOffset(&array_view, 1), 1);
-  EXPECT_EQ(ArrowArrayViewListChildOffset(&array_view, 2), 1);
-  EXPECT_EQ(ArrowArrayViewListChildOffset(&array_view, 3), 2);
-
+  ASSERT_EQ(ArrowArrayViewTemporalTruncate(&array_view, &type,
+                                           NANOARROW_CALENDAR_UNIT_YEAR, 10, &out,
+                                           &error),
+            NANOARROW_OK);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(out.buffers[1])[0], 18262);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(out.buffers[1])[1], -25567);
+  out.release(&out);
+  ArrowArrayViewReset(&array_view);
   array.release(&array);
+  schema.release(&schema);
+
+  // Durations have no calendar
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeDateTime(&schema, NANOARROW_TYPE_DURATION,
+                                       NANOARROW_TIME_UNIT_MILLI, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInit(&type, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewTemporalTruncate(&array_view, &type,
+                                           NANOARROW_CALENDAR_UNIT_MONTH, 1, &out,
+                                           &error),
+            ENOTSUP);
+  ArrowArrayViewReset(&array_view);
+  schema.release(&schema);
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_INT64), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInit(&type, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewTemporalTruncate(&array_view, &type,
+                                           NANOARROW_CALENDAR_UNIT_DAY, 1, &out,
+                                           &error),
+            ENOTSUP);
+  EXPECT_STREQ(error.message, "Truncation of int64 is not supported");
   ArrowArrayViewReset(&array_view);
+  schema.release(&schema);
 }
 
-TEST(ArrayTest, ArrayViewTestLargeList) {
+TEST(ArrayViewTest, ArrayViewTestSortIndices) {
+  struct ArrowArray array;
   struct ArrowArrayView array_view;
-  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_LARGE_LIST);
+  struct ArrowError error;
 
-  EXPECT_EQ(array_view.array, nullptr);
-  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_LARGE_LIST);
-  EXPECT_EQ(array_view.layout.buffer_type[0], NANOARROW_BUFFER_TYPE_VALIDITY);
-  EXPECT_EQ(array_view.layout.element_size_bits[0], 1);
-  EXPECT_EQ(array_view.layout.buffer_type[1], NANOARROW_BUFFER_TYPE_DATA_OFFSET);
-  EXPECT_EQ(array_view.layout.element_size_bits[1], 8 * sizeof(int64_t));
+  // Integers across several radix digits with nulls, compared to a stable sort
+  std::vector<int64_t> values;
+  for (int64_t i = 0; i < 1000; i++) {
+    values.push_back(((i * 7919) % 1000 - 500) * 100003);
+  }
 
-  EXPECT_EQ(ArrowArrayViewAllocateChildren(&array_view, 1), NANOARROW_OK);
-  EXPECT_EQ(array_view.n_children, 1);
-  ArrowArrayViewInitFromType(array_view.children[0], NANOARROW_TYPE_INT32);
-  EXPECT_EQ(array_view.children[0]->storage_type, NANOARROW_TYPE_INT32);
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT64), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int64_t i = 0; i < 1000; i++) {
+    if (i % 10 == 3) {
+      ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowArrayAppendInt(&array, values[i]), NANOARROW_OK);
+    }
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT64);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
 
-  ArrowArrayViewSetLength(&array_view, 5);
-  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 1);
-  EXPECT_EQ(array_view.buffer_views[1].size_bytes, (5 + 1) * sizeof(int64_t));
+  std::vector<int64_t> expected;
+  for (int64_t i = 0; i < 1000; i++) {
+    expected.push_back(i);
+  }
+  auto is_null = [](int64_t i) { return i % 10 == 3; };
+  std::stable_sort(expected.begin(), expected.end(), [&](int64_t lhs, int64_t rhs) {
+    if (is_null(lhs) || is_null(rhs)) {
+      return !is_null(lhs) && is_null(rhs);
+    }
+    return values[lhs] > values[rhs];
+  });
+
+  std::vector<int64_t> indices(1000);
+  ASSERT_EQ(ArrowArrayViewSortIndices(&array_view, NANOARROW_SORT_DESCENDING,
+                                      indices.data(), &error),
+            NANOARROW_OK);
+  EXPECT_EQ(indices, expected);
 
-  // Build a valid array
-  struct ArrowArray array;
-  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_LARGE_LIST), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAllocateChildren(&array, 1), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayInitFromType(array.children[0], NANOARROW_TYPE_INT32),
+  ASSERT_EQ(ArrowArrayViewSortIndices(&array_view, NANOARROW_SORT_NULLS_FIRST,
+                                      indices.data(), &error),
             NANOARROW_OK);
+  EXPECT_EQ(indices[0], 3);
+  EXPECT_EQ(indices[99], 993);
+  EXPECT_EQ(values[indices[100]], -500 * 100003);
+  EXPECT_EQ(values[indices[999]], 499 * 100003);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+
+  // Doubles order negative zero before zero and NaN last
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_DOUBLE), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 1234), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  for (double value : std::vector<double>({1.5, NAN, -0.0, -INFINITY, 0.0, -2.0})) {
+    ASSERT_EQ(ArrowArrayAppendDouble(&array, value), NANOARROW_OK);
+  }
   ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
-
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_DOUBLE);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  indices.resize(6);
+  ASSERT_EQ(ArrowArrayViewSortIndices(&array_view, NANOARROW_SORT_DEFAULT,
+                                      indices.data(), &error),
             NANOARROW_OK);
+  EXPECT_EQ(indices, std::vector<int64_t>({3, 5, 2, 4, 0, 1}));
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
 
-  // Expect error for offsets that will cause bad access
-  struct ArrowError error;
-  int64_t* offsets =
-      const_cast<int64_t*>(reinterpret_cast<const int64_t*>(array.buffers[1]));
-
-  offsets[0] = -1;
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
-  EXPECT_STREQ(error.message, "Expected first offset >= 0 but found -1");
-  offsets[0] = 0;
+  // Strings that share a prefix of eight bytes are compared in full
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (const char* value :
+       {"abcdefghz", "b", "abcdefgh", "", "abcdefghij", "abcdefgha", "b"}) {
+    ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView(value)), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  indices.resize(7);
+  ASSERT_EQ(ArrowArrayViewSortIndices(&array_view, NANOARROW_SORT_DEFAULT,
+                                      indices.data(), &error),
+            NANOARROW_OK);
+  EXPECT_EQ(indices, std::vector<int64_t>({3, 2, 5, 4, 0, 1, 6}));
+  ASSERT_EQ(ArrowArrayViewSortIndices(&array_view, NANOARROW_SORT_DESCENDING,
+                                      indices.data(), &error),
+            NANOARROW_OK);
+  EXPECT_EQ(indices, std::vector<int64_t>({1, 6, 0, 4, 5, 2, 3}));
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
 
-  offsets[1] = -1;
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
-            EINVAL);
-  EXPECT_STREQ(error.message, "[1] Expected element size >= 0");
+  // Structs are sorted by each of their children in order
+  struct ArrowSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0], "key"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[1], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[1], "value"), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  std::vector<std::pair<int32_t, const char*>> rows = {
+      {2, "b"}, {1, "z"}, {2, "a"}, {1, "y"}, {2, nullptr}};
+  for (const auto& row : rows) {
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[0], row.first), NANOARROW_OK);
+    if (row.second == nullptr) {
+      ASSERT_EQ(ArrowArrayAppendNull(array.children[1], 1), NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView(row.second)),
+                NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
 
+  indices.resize(6);
+  ASSERT_EQ(ArrowArrayViewSortIndices(&array_view, NANOARROW_SORT_NULLS_FIRST,
+                                      indices.data(), &error),
+            NANOARROW_OK);
+  EXPECT_EQ(indices, std::vector<int64_t>({5, 3, 1, 4, 2, 0}));
+  ArrowArrayViewReset(&array_view);
   array.release(&array);
+  schema.release(&schema);
+
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_DECIMAL128);
+  array_view.length = 2;
+  EXPECT_EQ(ArrowArrayViewSortIndices(&array_view, NANOARROW_SORT_DEFAULT,
+                                      indices.data(), &error),
+            ENOTSUP);
+  EXPECT_STREQ(error.message, "Sorting arrays of type decimal128 is not supported");
   ArrowArrayViewReset(&array_view);
 }
 
-TEST(ArrayTest, ArrayViewTestFixedSizeList) {
+TEST(ArrayViewTest, ArrayViewTestLowerUpperBound) {
+  struct ArrowArray array;
   struct ArrowArrayView array_view;
-  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_FIXED_SIZE_LIST);
-  array_view.layout.child_size_elements = 3;
+  struct ArrowArrayViewFence fence;
+  struct ArrowError error;
+  union ArrowStatisticsValue value;
+  std::vector<const struct ArrowArrayViewFence*> fences = {&fence, nullptr};
+  int64_t lower;
+  int64_t upper;
+
+  // Sorted values with duplicates followed by nulls
+  std::vector<int64_t> values;
+  for (int64_t i = 0; i < 1000; i++) {
+    values.push_back((i / 3) * 10 - 500);
+  }
 
-  EXPECT_EQ(array_view.array, nullptr);
-  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_FIXED_SIZE_LIST);
-  EXPECT_EQ(array_view.layout.buffer_type[0], NANOARROW_BUFFER_TYPE_VALIDITY);
-  EXPECT_EQ(array_view.layout.element_size_bits[0], 1);
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT64), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int64_t v : values) {
+    ASSERT_EQ(ArrowArrayAppendInt(&array, v), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 5), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT64);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewFenceInit(&fence, &array_view, 64, &error), NANOARROW_OK);
+  EXPECT_EQ(fence.begin, 0);
+  EXPECT_EQ(fence.end, 1000);
+  EXPECT_EQ(fence.n_keys, 16);
+
+  for (int64_t v = -520; v <= 2850; v += 5) {
+    int64_t expected_lower = std::lower_bound(values.begin(), values.end(), v) -
+                             values.begin();
+    int64_t expected_upper = std::upper_bound(values.begin(), values.end(), v) -
+                             values.begin();
+    value.as_int64 = v;
+    for (const struct ArrowArrayViewFence* fence_ptr : fences) {
+      ASSERT_EQ(ArrowArrayViewLowerBound(&array_view, &value, fence_ptr, &lower, &error),
+                NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayViewUpperBound(&array_view, &value, fence_ptr, &upper, &error),
+                NANOARROW_OK);
+      EXPECT_EQ(lower, expected_lower) << v;
+      EXPECT_EQ(upper, expected_upper) << v;
+    }
+  }
 
-  EXPECT_EQ(ArrowArrayViewAllocateChildren(&array_view, 1), NANOARROW_OK);
-  EXPECT_EQ(array_view.n_children, 1);
-  ArrowArrayViewInitFromType(array_view.children[0], NANOARROW_TYPE_INT32);
-  EXPECT_EQ(array_view.children[0]->storage_type, NANOARROW_TYPE_INT32);
+  ArrowArrayViewFenceReset(&fence);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
 
-  ArrowArrayViewSetLength(&array_view, 5);
-  EXPECT_EQ(array_view.buffer_views[0].size_bytes, 1);
-  EXPECT_EQ(array_view.children[0]->buffer_views[1].size_bytes, 15 * sizeof(int32_t));
+  // Strings are compared in full after their prefix, with nulls first
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 2), NANOARROW_OK);
+  for (const char* v : {"a", "abcdefgh", "abcdefghij", "abcdefghij", "abcdefghk", "b"}) {
+    ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView(v)), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewFenceInit(&fence, &array_view, 2, &error), NANOARROW_OK);
+  EXPECT_EQ(fence.begin, 2);
+  EXPECT_EQ(fence.end, 8);
+
+  value.as_bytes.data.as_char = "abcdefghij";
+  value.as_bytes.size_bytes = 10;
+  for (const struct ArrowArrayViewFence* fence_ptr : fences) {
+    ASSERT_EQ(ArrowArrayViewLowerBound(&array_view, &value, fence_ptr, &lower, &error),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewUpperBound(&array_view, &value, fence_ptr, &upper, &error),
+              NANOARROW_OK);
+    EXPECT_EQ(lower, 4);
+    EXPECT_EQ(upper, 6);
+  }
+
+  value.as_bytes.size_bytes = 0;
+  ASSERT_EQ(ArrowArrayViewLowerBound(&array_view, &value, &fence, &lower, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(lower, 2);
+  value.as_bytes.data.as_char = "c";
+  value.as_bytes.size_bytes = 1;
+  ASSERT_EQ(ArrowArrayViewLowerBound(&array_view, &value, &fence, &lower, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(lower, 8);
+  ArrowArrayViewFenceReset(&fence);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
 
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_DECIMAL128);
+  EXPECT_EQ(ArrowArrayViewLowerBound(&array_view, &value, nullptr, &lower, &error),
+            ENOTSUP);
+  EXPECT_STREQ(error.message, "Searching arrays of type decimal128 is not supported");
+  EXPECT_EQ(ArrowArrayViewFenceInit(&fence, &array_view, 0, &error), ENOTSUP);
   ArrowArrayViewReset(&array_view);
 }
 
-TEST(ArrayTest, ArrayViewTestStructArray) {
-  struct ArrowArrayView array_view;
-  struct ArrowArray array;
+TEST(ArrayViewTest, ArrayViewTestGrouper) {
   struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  struct ArrowGrouper grouper;
   struct ArrowError error;
 
+  // Keys are a struct of an int32 and a string column
   ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
-  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 2), NANOARROW_OK);
   ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0], NANOARROW_TYPE_INT32),
             NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0], "a"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[1], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[1], "b"), NANOARROW_OK);
+  ASSERT_EQ(ArrowGrouperInit(&grouper, &schema, &error), NANOARROW_OK);
+
+  struct ArrowArray keys;
+  ASSERT_EQ(ArrowGrouperGetKeys(&grouper, &keys, &error), NANOARROW_OK);
+  EXPECT_EQ(keys.length, 0);
+  keys.release(&keys);
+
+  // Two batches of 1000 rows with 300 distinct keys (including a null string)
+  std::vector<int64_t> group_ids(1000);
+  for (int64_t batch = 0; batch < 2; batch++) {
+    ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    for (int64_t i = 0; i < 1000; i++) {
+      int64_t key = (i + batch * 100) % 300;
+      ASSERT_EQ(ArrowArrayAppendInt(array.children[0], key / 3), NANOARROW_OK);
+      if (key % 3 == 0) {
+        ASSERT_EQ(ArrowArrayAppendNull(array.children[1], 1), NANOARROW_OK);
+      } else {
+        std::string value = "value" + std::to_string(key % 3);
+        ASSERT_EQ(
+            ArrowArrayAppendString(array.children[1], ArrowCharView(value.c_str())),
+            NANOARROW_OK);
+      }
+      ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+
+    ASSERT_EQ(ArrowGrouperConsume(&grouper, &array_view, group_ids.data(), &error),
+              NANOARROW_OK);
+    EXPECT_EQ(grouper.n_groups, 300);
+    ArrowArrayViewReset(&array_view);
+    array.release(&array);
+  }
 
-  EXPECT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
-  EXPECT_EQ(array_view.n_children, 1);
-  EXPECT_EQ(array_view.children[0]->storage_type, NANOARROW_TYPE_INT32);
+  // The second batch starts at key 100, which was assigned group 100
+  EXPECT_EQ(group_ids[0], 100);
+  EXPECT_EQ(group_ids[199], 299);
+  EXPECT_EQ(group_ids[200], 0);
+  EXPECT_EQ(group_ids[999], 199);
 
-  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowGrouperGetKeys(&grouper, &keys, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &keys, &error), NANOARROW_OK);
+  EXPECT_EQ(keys.length, 300);
+  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(array_view.children[0], 299), 99);
+  EXPECT_TRUE(ArrowArrayViewIsNull(array_view.children[1], 297));
+  struct ArrowStringView value =
+      ArrowArrayViewGetStringUnsafe(array_view.children[1], 299);
+  EXPECT_EQ(std::string(value.data, value.size_bytes), "value2");
+  ArrowArrayViewReset(&array_view);
+  keys.release(&keys);
+  ArrowGrouperReset(&grouper);
+  schema.release(&schema);
+}
 
-  // Expect error for the wrong number of children
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
+TEST(ArrayViewTest, ArrayViewTestGroupedAggregate) {
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  struct ArrowArray out;
+  struct ArrowError error;
 
-  ASSERT_EQ(ArrowArrayAllocateChildren(&array, 1), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayInitFromType(array.children[0], NANOARROW_TYPE_INT32),
-            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, -5), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 7), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT32);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  std::vector<int64_t> group_ids = {0, 1, 2, 0};
+
+  std::vector<std::vector<int64_t>> expected = {{2, 1, 0}, {8, -5, 0}, {1, -5, 0},
+                                                {7, -5, 0}};
+  for (int function = NANOARROW_AGGREGATE_COUNT; function <= NANOARROW_AGGREGATE_MAX;
+       function++) {
+    struct ArrowGroupedAggregate aggregate;
+    auto aggregate_function = static_cast<enum ArrowAggregateFunction>(function);
+    ASSERT_EQ(ArrowGroupedAggregateInit(&aggregate, aggregate_function,
+                                        NANOARROW_TYPE_INT32, &error),
+              NANOARROW_OK);
+    ASSERT_EQ(
+        ArrowGroupedAggregateUpdate(&aggregate, &array_view, group_ids.data(), 3, &error),
+        NANOARROW_OK);
+    ASSERT_EQ(ArrowGroupedAggregateFinish(&aggregate, 4, &out, &error), NANOARROW_OK);
+    ASSERT_EQ(out.length, 4);
+    const int64_t* values = reinterpret_cast<const int64_t*>(out.buffers[1]);
+    for (int64_t i = 0; i < 3; i++) {
+      if (function != NANOARROW_AGGREGATE_COUNT && i == 2) {
+        EXPECT_FALSE(ArrowBitGet(reinterpret_cast<const uint8_t*>(out.buffers[0]), i));
+      } else {
+        EXPECT_EQ(values[i], expected[function][i]);
+      }
+    }
+    EXPECT_EQ(out.null_count, function == NANOARROW_AGGREGATE_COUNT ? 0 : 2);
+    out.release(&out);
+    ArrowGroupedAggregateReset(&aggregate);
+  }
 
-  // Expect error for the wrong number of child elements
-  array.length = 1;
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
 
-  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(array.children[0], 1), 123),
-            NANOARROW_OK);
-  array.children[0]->length = 1;
+  // Minimum and maximum of doubles do not consider NaN
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_DOUBLE), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(&array, NAN), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(&array, 2.5), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
-
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_DOUBLE);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  struct ArrowGroupedAggregate aggregate;
+  ASSERT_EQ(ArrowGroupedAggregateInit(&aggregate, NANOARROW_AGGREGATE_MAX,
+                                      NANOARROW_TYPE_DOUBLE, &error),
             NANOARROW_OK);
-  EXPECT_EQ(array_view.children[0]->buffer_views[1].size_bytes, sizeof(int32_t));
-  EXPECT_EQ(array_view.children[0]->buffer_views[1].data.as_int32[0], 123);
+  group_ids = {0, 0};
+  ASSERT_EQ(
+      ArrowGroupedAggregateUpdate(&aggregate, &array_view, group_ids.data(), 1, &error),
+      NANOARROW_OK);
+  ASSERT_EQ(ArrowGroupedAggregateFinish(&aggregate, 1, &out, &error), NANOARROW_OK);
+  EXPECT_EQ(reinterpret_cast<const double*>(out.buffers[1])[0], 2.5);
+  out.release(&out);
+  ArrowGroupedAggregateReset(&aggregate);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
 
+  // Integer sums that overflow are an error
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT64), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, INT64_MAX), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT64);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowGroupedAggregateInit(&aggregate, NANOARROW_AGGREGATE_SUM,
+                                      NANOARROW_TYPE_INT64, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(
+      ArrowGroupedAggregateUpdate(&aggregate, &array_view, group_ids.data(), 1, &error),
+      EOVERFLOW);
+  EXPECT_STREQ(error.message, "[1] Sum of group 0 overflows int64");
+  ArrowGroupedAggregateReset(&aggregate);
   ArrowArrayViewReset(&array_view);
-  schema.release(&schema);
   array.release(&array);
+
+  EXPECT_EQ(ArrowGroupedAggregateInit(&aggregate, NANOARROW_AGGREGATE_SUM,
+                                      NANOARROW_TYPE_STRING, &error),
+            ENOTSUP);
+  EXPECT_STREQ(error.message, "Aggregating arrays of type string is not supported");
 }
 
-TEST(ArrayTest, ArrayViewTestFixedSizeListArray) {
-  struct ArrowArrayView array_view;
+TEST(ArrayViewTest, ArrayViewTestMatchStrings) {
   struct ArrowArray array;
-  struct ArrowSchema schema;
+  struct ArrowArrayView array_view;
   struct ArrowError error;
+  uint8_t out[2];
+
+  std::vector<std::vector<int>> expected = {{0, 0, 0, 0, 1, 0, 0, 0},
+                                            {1, 0, 0, 0, 1, 0, 0, 0},
+                                            {0, 0, 0, 0, 1, 1, 0, 0},
+                                            {1, 0, 0, 1, 1, 1, 0, 0}};
+
+  for (auto type : {NANOARROW_TYPE_STRING, NANOARROW_TYPE_LARGE_STRING,
+                    NANOARROW_TYPE_STRING_VIEW}) {
+    ASSERT_EQ(ArrowArrayInitFromType(&array, type), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    std::vector<const char*> values = {"apple", "",     nullptr, "pineapple",
+                                       "app",   "xapp", "ap",    "pp"};
+    for (const char* value : values) {
+      if (value == nullptr) {
+        ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+      } else {
+        ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView(value)), NANOARROW_OK);
+      }
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+    ArrowArrayViewInitFromType(&array_view, type);
+    ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+
+    for (int predicate = NANOARROW_STRING_EQUALS; predicate <= NANOARROW_STRING_CONTAINS;
+         predicate++) {
+      ASSERT_EQ(ArrowArrayViewMatchStrings(
+                    &array_view, static_cast<enum ArrowStringPredicate>(predicate),
+                    ArrowCharView("app"), out, &error),
+                NANOARROW_OK);
+      for (int64_t i = 0; i < 8; i++) {
+        EXPECT_EQ(ArrowBitGet(out, i), expected[predicate][i]);
+      }
+    }
+
+    // An empty pattern is contained by every non-null value
+    ASSERT_EQ(ArrowArrayViewMatchStrings(&array_view, NANOARROW_STRING_CONTAINS,
+                                         ArrowCharView(""), out, &error),
+              NANOARROW_OK);
+    EXPECT_EQ(out[0], 0xfb);
+    ASSERT_EQ(ArrowArrayViewMatchStrings(&array_view, NANOARROW_STRING_EQUALS,
+                                         ArrowCharView(""), out, &error),
+              NANOARROW_OK);
+    EXPECT_EQ(out[0], 0x02);
+
+    // Matches are attributed relative to the offset of the array view
+    array_view.offset = 3;
+    array_view.length = 3;
+    array_view.null_count = 0;
+    ASSERT_EQ(ArrowArrayViewMatchStrings(&array_view, NANOARROW_STRING_CONTAINS,
+                                         ArrowCharView("app"), out, &error),
+              NANOARROW_OK);
+    EXPECT_EQ(out[0], 0x07);
+    ASSERT_EQ(ArrowArrayViewMatchStrings(&array_view, NANOARROW_STRING_CONTAINS,
+                                         ArrowCharView("apple"), out, &error),
+              NANOARROW_OK);
+    EXPECT_EQ(out[0], 0x01);
+
+    ArrowArrayViewReset(&array_view);
+    array.release(&array);
+  }
 
-  ArrowSchemaInit(&schema);
-  ASSERT_EQ(ArrowSchemaSetTypeFixedSize(&schema, NANOARROW_TYPE_FIXED_SIZE_LIST, 3),
-            NANOARROW_OK);
-  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT32);
+  EXPECT_EQ(ArrowArrayViewMatchStrings(&array_view, NANOARROW_STRING_EQUALS,
+                                       ArrowCharView("app"), out, &error),
+            ENOTSUP);
+  EXPECT_STREQ(ArrowErrorMessage(&error),
+               "Matching strings in arrays of type int32 is not supported");
+  ArrowArrayViewReset(&array_view);
+}
 
-  EXPECT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
-  EXPECT_EQ(array_view.n_children, 1);
-  EXPECT_EQ(array_view.children[0]->storage_type, NANOARROW_TYPE_INT32);
+TEST(ArrayViewTest, ArrayViewTestListFlatten) {
+  struct ArrowArray array;
+  struct ArrowArray sliced;
+  struct ArrowArray flat;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
 
-  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_FIXED_SIZE_LIST), NANOARROW_OK);
+  // [[0, 1], [], null, [2, 3, 4], [5]]
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_LIST), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayAllocateChildren(&array, 1), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayInitFromType(array.children[0], NANOARROW_TYPE_INT32),
             NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  std::vector<int64_t> sizes = {2, 0, -1, 3, 1};
+  int64_t value = 0;
+  for (int64_t size : sizes) {
+    if (size < 0) {
+      ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+      continue;
+    }
+
+    for (int64_t j = 0; j < size; j++) {
+      ASSERT_EQ(ArrowArrayAppendInt(array.children[0], value++), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
 
-  // Expect error for the wrong number of child elements
-  array.length = 1;
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_LIST);
+  ASSERT_EQ(ArrowArrayViewAllocateChildren(&array_view, 1), NANOARROW_OK);
+  ArrowArrayViewInitFromType(array_view.children[0], NANOARROW_TYPE_INT32);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
 
-  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(array.children[0], 1), 123),
-            NANOARROW_OK);
-  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(array.children[0], 1), 456),
+  std::vector<int64_t> lengths(5);
+  ASSERT_EQ(ArrowArrayViewListLengths(&array_view, lengths.data(), &error),
             NANOARROW_OK);
-  ASSERT_EQ(ArrowBufferAppendInt32(ArrowArrayBuffer(array.children[0], 1), 789),
+  EXPECT_EQ(lengths, std::vector<int64_t>({2, 0, 0, 3, 1}));
+
+  std::vector<int64_t> parent_ids(6);
+  ASSERT_EQ(ArrowArrayViewListParentIds(&array_view, parent_ids.data(), &error),
             NANOARROW_OK);
-  array.children[0]->length = 3;
-  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
+  EXPECT_EQ(parent_ids, std::vector<int64_t>({0, 0, 3, 3, 3, 4}));
 
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+  // Lists 1, 2, and 3 reference child values 2, 3, and 4
+  ASSERT_EQ(ArrowArraySlice(&array, 1, 3, &sliced), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &sliced, &error), NANOARROW_OK);
+  lengths.resize(3);
+  ASSERT_EQ(ArrowArrayViewListLengths(&array_view, lengths.data(), &error),
             NANOARROW_OK);
-  EXPECT_EQ(array_view.children[0]->buffer_views[1].size_bytes, 3 * sizeof(int32_t));
-  EXPECT_EQ(array_view.children[0]->buffer_views[1].data.as_int32[0], 123);
+  EXPECT_EQ(lengths, std::vector<int64_t>({0, 0, 3}));
+  parent_ids.resize(3);
+  ASSERT_EQ(ArrowArrayViewListParentIds(&array_view, parent_ids.data(), &error),
+            NANOARROW_OK);
+  EXPECT_EQ(parent_ids, std::vector<int64_t>({2, 2, 2}));
 
-  ArrowArrayViewReset(&array_view);
-  schema.release(&schema);
+  ASSERT_EQ(ArrowArrayViewListFlatten(&array_view, &flat, &error), NANOARROW_OK);
+  sliced.release(&sliced);
   array.release(&array);
+  EXPECT_EQ(flat.offset, 2);
+  EXPECT_EQ(flat.length, 3);
+  EXPECT_EQ(flat.null_count, 0);
+  ArrowArrayViewReset(&array_view);
+
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT32);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &flat, &error), NANOARROW_OK);
+  for (int64_t i = 0; i < 3; i++) {
+    EXPECT_EQ(ArrowArrayViewGetIntUnsafe(&array_view, i), i + 2);
+  }
+
+  EXPECT_EQ(ArrowArrayViewListLengths(&array_view, lengths.data(), &error), ENOTSUP);
+  EXPECT_STREQ(error.message,
+               "Expected list, large list, map, or fixed-size list but got int32");
+  ArrowArrayViewReset(&array_view);
+  flat.release(&flat);
 }
 
-TEST(ArrayTest, ArrayViewTestDictionary) {
+TEST(ArrayViewTest, ArrayViewTestFixedSizeListFlatten) {
+  struct ArrowArray array;
+  struct ArrowArray flat;
   struct ArrowSchema schema;
   struct ArrowArrayView array_view;
+  struct ArrowError error;
 
-  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_INT32), NANOARROW_OK);
-  ASSERT_EQ(ArrowSchemaAllocateDictionary(&schema), NANOARROW_OK);
-  ASSERT_EQ(ArrowSchemaInitFromType(schema.dictionary, NANOARROW_TYPE_STRING),
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_UNINITIALIZED), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetTypeFixedSize(&schema, NANOARROW_TYPE_FIXED_SIZE_LIST, 2),
             NANOARROW_OK);
-
-  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
-
-  EXPECT_EQ(array_view.storage_type, NANOARROW_TYPE_INT32);
-  ASSERT_NE(array_view.dictionary, nullptr);
-  EXPECT_EQ(array_view.dictionary->storage_type, NANOARROW_TYPE_STRING);
-
-  // Build a dictionary array
-  struct ArrowArray array;
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_DOUBLE), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendString(array.dictionary, ArrowCharView("abc")), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendString(array.dictionary, ArrowCharView("def")), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendInt(&array, 0), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendInt(&array, 1), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
-
-  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
-  EXPECT_EQ(array_view.buffer_views[1].size_bytes, 2 * sizeof(int32_t));
-  EXPECT_EQ(array_view.dictionary->buffer_views[2].size_bytes, 6);
+  std::vector<double> values = {0, 1, 2, 3, 4, 5};
+  ASSERT_EQ(ArrowArrayAppendFixedSizeListSlice(&array, values.data(), 3, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
 
-  // Full validation not yet supported for dictionary
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
-            ENOTSUP);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  array_view.length = 2;
+  array_view.offset = 1;
 
-  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(&array_view, 0), 0);
-  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(&array_view, 1), 1);
+  std::vector<int64_t> lengths(2);
+  ASSERT_EQ(ArrowArrayViewListLengths(&array_view, lengths.data(), &error),
+            NANOARROW_OK);
+  EXPECT_EQ(lengths, std::vector<int64_t>({2, 2}));
 
-  struct ArrowStringView item;
-  item = ArrowArrayViewGetStringUnsafe(array_view.dictionary, 0);
-  EXPECT_EQ(std::string(item.data, item.size_bytes), "abc");
-  item = ArrowArrayViewGetStringUnsafe(array_view.dictionary, 1);
-  EXPECT_EQ(std::string(item.data, item.size_bytes), "def");
+  std::vector<int64_t> parent_ids(4);
+  ASSERT_EQ(ArrowArrayViewListParentIds(&array_view, parent_ids.data(), &error),
+            NANOARROW_OK);
+  EXPECT_EQ(parent_ids, std::vector<int64_t>({0, 0, 1, 1}));
 
+  ASSERT_EQ(ArrowArrayViewListFlatten(&array_view, &flat, &error), NANOARROW_OK);
+  EXPECT_EQ(flat.offset, 2);
+  EXPECT_EQ(flat.length, 4);
+  EXPECT_EQ(reinterpret_cast<const double*>(flat.buffers[1])[flat.offset], 2);
+  ArrowArrayViewReset(&array_view);
   array.release(&array);
+  flat.release(&flat);
 
-  // Setting a non-dictionary array should error
+  // An ArrowArrayView that is not backed by an ArrowArray can't be sliced
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewListFlatten(&array_view, &flat, &error), EINVAL);
+  ArrowArrayViewReset(&array_view);
+  schema.release(&schema);
+}
+
+TEST(ArrayViewTest, ArrayViewTestUnionSelect) {
+  struct ArrowArray array;
+  struct ArrowSchema schema;
+  struct ArrowArrayView array_view;
   struct ArrowError error;
-  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
-  EXPECT_STREQ(error.message, "Expected dictionary but found NULL");
 
-  array.release(&array);
+  for (auto type : {NANOARROW_TYPE_DENSE_UNION, NANOARROW_TYPE_SPARSE_UNION}) {
+    ArrowSchemaInit(&schema);
+    ASSERT_EQ(ArrowSchemaSetTypeUnion(&schema, type, 2), NANOARROW_OK);
+    ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+
+    // [1, "a", "b", 2, 3, "c"]
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    for (const char* value : {"1", "a", "b", "2", "3", "c"}) {
+      if (value[0] >= 'a') {
+        ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView(value)),
+                  NANOARROW_OK);
+        ASSERT_EQ(ArrowArrayFinishUnionElement(&array, 1), NANOARROW_OK);
+      } else {
+        ASSERT_EQ(ArrowArrayAppendInt(array.children[0], value[0] - '0'),
+                  NANOARROW_OK);
+        ASSERT_EQ(ArrowArrayFinishUnionElement(&array, 0), NANOARROW_OK);
+      }
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
+
+    // Use type ids that are not equal to the child indices
+    int8_t* type_ids = reinterpret_cast<int8_t*>(ArrowArrayBuffer(&array, 0)->data);
+    for (int64_t i = 0; i < array.length; i++) {
+      type_ids[i] = type_ids[i] == 0 ? 5 : 2;
+    }
+    ASSERT_EQ(ArrowSchemaSetFormat(
+                  &schema, type == NANOARROW_TYPE_DENSE_UNION ? "+ud:5,2" : "+us:5,2"),
+              NANOARROW_OK);
+
+    ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+
+    std::vector<int64_t> child_counts(2);
+    std::vector<int64_t> rows(6);
+    std::vector<int64_t> child_offsets(6);
+    ASSERT_EQ(ArrowArrayViewUnionSelect(&array_view, 0, 6, child_counts.data(),
+                                        rows.data(), child_offsets.data(), &error),
+              NANOARROW_OK);
+    EXPECT_EQ(child_counts, std::vector<int64_t>({3, 3}));
+    EXPECT_EQ(rows, std::vector<int64_t>({0, 3, 4, 1, 2, 5}));
+    if (type == NANOARROW_TYPE_DENSE_UNION) {
+      EXPECT_EQ(child_offsets, std::vector<int64_t>({0, 1, 2, 0, 1, 2}));
+    } else {
+      EXPECT_EQ(child_offsets, rows);
+    }
+
+    // Each row refers to the value at its child offset
+    for (int64_t i = 0; i < 3; i++) {
+      EXPECT_EQ(ArrowArrayViewGetIntUnsafe(array_view.children[0], child_offsets[i]),
+                i + 1);
+      struct ArrowStringView value =
+          ArrowArrayViewGetStringUnsafe(array_view.children[1], child_offsets[3 + i]);
+      EXPECT_EQ(std::string(value.data, value.size_bytes), std::string(1, 'a' + i));
+    }
+
+    rows.assign(6, -1);
+    ASSERT_EQ(ArrowArrayViewUnionSelect(&array_view, 2, 3, child_counts.data(),
+                                        rows.data(), nullptr, &error),
+              NANOARROW_OK);
+    EXPECT_EQ(child_counts, std::vector<int64_t>({2, 1}));
+    EXPECT_EQ(rows, std::vector<int64_t>({3, 4, 2, -1, -1, -1}));
+
+    EXPECT_EQ(ArrowArrayViewUnionSelect(&array_view, 4, 3, child_counts.data(),
+                                        rows.data(), nullptr, &error),
+              EINVAL);
+
+    ArrowArrayViewReset(&array_view);
+    array.release(&array);
+    schema.release(&schema);
+  }
 
-  // Setting a dictionary array to a non-dictionary array view should error
-  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
-  ArrowArrayViewReset(&array_view);
   ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT32);
-  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), EINVAL);
-  EXPECT_STREQ(error.message, "Expected NULL dictionary but found dictionary member");
-
-  schema.release(&schema);
-  array.release(&array);
+  EXPECT_EQ(ArrowArrayViewUnionSelect(&array_view, 0, 0, nullptr, nullptr, nullptr,
+                                      &error),
+            ENOTSUP);
+  EXPECT_STREQ(error.message, "Expected dense or sparse union but got int32");
   ArrowArrayViewReset(&array_view);
 }
 
-TEST(ArrayTest, ArrayViewTestUnionChildIndices) {
-  struct ArrowArrayView array_view;
+TEST(ArrayViewTest, ArrayViewTestMapLookup) {
   struct ArrowArray array;
   struct ArrowSchema schema;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
 
-  // Build a simple union with one int and one string
-  ArrowSchemaInit(&schema);
-  ASSERT_EQ(ArrowSchemaSetTypeUnion(&schema, NANOARROW_TYPE_DENSE_UNION, 2),
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_MAP), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0]->children[0], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0]->children[1], NANOARROW_TYPE_INT32),
             NANOARROW_OK);
-  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
-  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
-
   ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+
+  // [{a: 0, c: 1}, {}, null, {b: 2, c: 3, d: 4}, {c: 5, cc: 6}]
+  std::vector<std::vector<std::string>> maps = {
+      {"a", "c"}, {}, {"null"}, {"b", "c", "d"}, {"c", "cc"}};
+  struct ArrowArray* entries = array.children[0];
   ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 123), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayFinishUnionElement(&array, 0), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView("one twenty four")),
-            NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayFinishUnionElement(&array, 1), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  int64_t value = 0;
+  for (const auto& map : maps) {
+    if (map.size() == 1 && map[0] == "null") {
+      ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+      continue;
+    }
+
+    for (const auto& key : map) {
+      ASSERT_EQ(ArrowArrayAppendString(entries->children[0], ArrowCharView(key.c_str())),
+                NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayAppendInt(entries->children[1], value++), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayFinishElement(entries), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
 
-  // The ArrayView for a union could in theroy be created without a schema.
-  // Currently FULL validation will fail here since we can't guarantee that
-  // these are valid.
-  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_DENSE_UNION);
-  ASSERT_EQ(ArrowArrayViewAllocateChildren(&array_view, 2), NANOARROW_OK);
-  ArrowArrayViewInitFromType(array_view.children[0], NANOARROW_TYPE_INT32);
-  ArrowArrayViewInitFromType(array_view.children[1], NANOARROW_TYPE_STRING);
-  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
-            EINVAL);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
 
-  EXPECT_EQ(ArrowArrayViewUnionTypeId(&array_view, 0), 0);
-  EXPECT_EQ(ArrowArrayViewUnionTypeId(&array_view, 1), 1);
-  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 0), 0);
-  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 1), 1);
+  std::vector<struct ArrowStringView> keys = {ArrowCharView("c"), ArrowCharView("d"),
+                                              ArrowCharView("")};
+  for (int options : {NANOARROW_MAP_LOOKUP_DEFAULT, NANOARROW_MAP_LOOKUP_KEYS_SORTED}) {
+    std::vector<int64_t> out(15);
+    ASSERT_EQ(ArrowArrayViewMapLookup(&array_view, keys.data(), 3, options, out.data(),
+                                      &error),
+              NANOARROW_OK);
+    EXPECT_EQ(out, std::vector<int64_t>({1, -1, -1, 3, 5, -1, -1, -1, 4, -1, -1, -1, -1,
+                                         -1, -1}));
+  }
 
+  // Elements 3 and 4 only
+  array_view.offset = 3;
+  array_view.length = 2;
+  std::vector<int64_t> out(2);
+  ASSERT_EQ(ArrowArrayViewMapLookup(&array_view, keys.data(), 1,
+                                    NANOARROW_MAP_LOOKUP_DEFAULT, out.data(), &error),
+            NANOARROW_OK);
+  EXPECT_EQ(out, std::vector<int64_t>({3, 5}));
   ArrowArrayViewReset(&array_view);
 
-  // The test schema explicitly sets the type_ids 0,1 and this should validate properly
-  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
-            NANOARROW_OK);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING);
+  EXPECT_EQ(ArrowArrayViewMapLookup(&array_view, keys.data(), 1,
+                                    NANOARROW_MAP_LOOKUP_DEFAULT, out.data(), &error),
+            ENOTSUP);
+  EXPECT_STREQ(error.message, "Expected map but got string");
+  ArrowArrayViewReset(&array_view);
 
-  EXPECT_EQ(ArrowArrayViewUnionTypeId(&array_view, 0), 0);
-  EXPECT_EQ(ArrowArrayViewUnionTypeId(&array_view, 1), 1);
-  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 0), 0);
-  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 1), 1);
+  array.release(&array);
+  schema.release(&schema);
+}
 
-  // Check that bad type ids/offset are caught by validate full
+TEST(ArrayViewTest, ArrayViewTestRunEndEncodeDecode) {
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
   struct ArrowError error;
-  int8_t* type_ids =
-      const_cast<int8_t*>(reinterpret_cast<const int8_t*>(array.buffers[0]));
-  int32_t* offsets =
-      const_cast<int32_t*>(reinterpret_cast<const int32_t*>(array.buffers[1]));
-  type_ids[0] = -1;
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
-            EINVAL);
-  EXPECT_STREQ(error.message,
-               "[0] Expected buffer value between 0 and 1 but found value -1");
-  type_ids[0] = 0;
 
-  offsets[0] = -1;
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
-            EINVAL);
-  EXPECT_STREQ(error.message,
-               "[0] Expected union offset for child id 0 to be between 0 and 1 but found "
-               "offset value -1");
-  offsets[0] = 0;
+  // [0, 1, 1, 1, null, null, 2, 2, 3] viewed without its first element
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int64_t value : {0, 1, 1, 1, -1, -1, 2, 2, 3}) {
+    if (value < 0) {
+      ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowArrayAppendInt(&array, value), NANOARROW_OK);
+    }
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
+  array.offset = 1;
+  array.length = 8;
+  array.null_count = -1;
 
-  ArrowArrayViewReset(&array_view);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT32);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
 
-  // Reversing the type ids should result in the same type ids but
-  // reversed child indices
-  ASSERT_EQ(ArrowSchemaSetFormat(&schema, "+ud:1,0"), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
+  struct ArrowArray encoded;
+  ASSERT_EQ(ArrowArrayViewRunEndEncode(&array_view, NANOARROW_TYPE_INT16, &encoded,
+                                       &error),
             NANOARROW_OK);
+  EXPECT_EQ(encoded.length, 8);
+  ASSERT_EQ(encoded.n_children, 2);
+  ASSERT_EQ(encoded.children[0]->length, 4);
+  const int16_t* run_ends =
+      reinterpret_cast<const int16_t*>(encoded.children[0]->buffers[1]);
+  EXPECT_EQ(std::vector<int16_t>(run_ends, run_ends + 4),
+            std::vector<int16_t>({3, 5, 7, 8}));
+  EXPECT_EQ(encoded.children[1]->length, 4);
+  EXPECT_EQ(encoded.children[1]->null_count, 1);
 
-  EXPECT_EQ(ArrowArrayViewUnionTypeId(&array_view, 0), 0);
-  EXPECT_EQ(ArrowArrayViewUnionTypeId(&array_view, 1), 1);
-  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 0), 1);
-  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 1), 0);
-
-  // Check that bad type ids are caught by validate full
-  type_ids[0] = -1;
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
-            EINVAL);
-  EXPECT_STREQ(error.message, "[0] Unexpected buffer value -1");
-  type_ids[0] = 0;
+  struct ArrowSchema schema;
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeRunEndEncoded(&schema, NANOARROW_TYPE_INT16), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  struct ArrowArrayView encoded_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&encoded_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&encoded_view, &encoded, &error), NANOARROW_OK);
+
+  // Decoding a slice of the run-end encoded array starts within a run
+  struct ArrowArray decoded;
+  for (int64_t offset : {0, 2}) {
+    encoded_view.offset = offset;
+    encoded_view.length = 8 - offset;
+    ASSERT_EQ(ArrowArrayViewRunEndDecode(&encoded_view, &decoded, &error),
+              NANOARROW_OK);
+    EXPECT_EQ(decoded.length, 8 - offset);
+    EXPECT_EQ(decoded.null_count, 2);
+
+    struct ArrowArrayView decoded_view;
+    ArrowArrayViewInitFromType(&decoded_view, NANOARROW_TYPE_INT32);
+    ASSERT_EQ(ArrowArrayViewSetArray(&decoded_view, &decoded, &error), NANOARROW_OK);
+    for (int64_t i = 0; i < decoded.length; i++) {
+      EXPECT_EQ(ArrowArrayViewIsNull(&decoded_view, i),
+                ArrowArrayViewIsNull(&array_view, offset + i));
+      if (!ArrowArrayViewIsNull(&decoded_view, i)) {
+        EXPECT_EQ(ArrowArrayViewGetIntUnsafe(&decoded_view, i),
+                  ArrowArrayViewGetIntUnsafe(&array_view, offset + i));
+      }
+    }
+
+    ArrowArrayViewReset(&decoded_view);
+    decoded.release(&decoded);
+  }
 
+  ArrowArrayViewReset(&encoded_view);
+  schema.release(&schema);
+  encoded.release(&encoded);
   ArrowArrayViewReset(&array_view);
+  array.release(&array);
 
-  // Check the raw mapping in the array view for numbers that are easier to check
-  ASSERT_EQ(ArrowSchemaSetFormat(&schema, "+ud:6,2"), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
-  EXPECT_EQ(array_view.union_type_id_map[6], 0);
-  EXPECT_EQ(array_view.union_type_id_map[2], 1);
-  EXPECT_EQ(array_view.union_type_id_map[128 + 0], 6);
-  EXPECT_EQ(array_view.union_type_id_map[128 + 1], 2);
+  // Strings and booleans round trip
+  for (auto type : {NANOARROW_TYPE_STRING, NANOARROW_TYPE_BOOL}) {
+    ASSERT_EQ(ArrowArrayInitFromType(&array, type), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    std::vector<const char*> values = {"a", "a", "", nullptr, "bc", "bc", "bc", "a"};
+    for (const char* value : values) {
+      if (value == nullptr) {
+        ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+      } else if (type == NANOARROW_TYPE_BOOL) {
+        ASSERT_EQ(ArrowArrayAppendInt(&array, strlen(value) > 1), NANOARROW_OK);
+      } else {
+        ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView(value)), NANOARROW_OK);
+      }
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
+    ArrowArrayViewInitFromType(&array_view, type);
+    ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+
+    ASSERT_EQ(ArrowArrayViewRunEndEncode(&array_view, NANOARROW_TYPE_INT64, &encoded,
+                                         &error),
+              NANOARROW_OK);
+    EXPECT_EQ(encoded.children[0]->length, type == NANOARROW_TYPE_BOOL ? 4 : 5);
+
+    ArrowSchemaInit(&schema);
+    ASSERT_EQ(ArrowSchemaSetTypeRunEndEncoded(&schema, NANOARROW_TYPE_INT64),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowSchemaSetType(schema.children[1], type), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewInitFromSchema(&encoded_view, &schema, &error),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewSetArray(&encoded_view, &encoded, &error), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewRunEndDecode(&encoded_view, &decoded, &error),
+              NANOARROW_OK);
+
+    struct ArrowArrayView decoded_view;
+    ArrowArrayViewInitFromType(&decoded_view, type);
+    ASSERT_EQ(ArrowArrayViewSetArray(&decoded_view, &decoded, &error), NANOARROW_OK);
+    EXPECT_TRUE(ArrowArrayViewEquals(&decoded_view, &array_view,
+                                     NANOARROW_ARRAY_COMPARE_DEFAULT, nullptr));
+
+    ArrowArrayViewReset(&decoded_view);
+    decoded.release(&decoded);
+    ArrowArrayViewReset(&encoded_view);
+    schema.release(&schema);
+    encoded.release(&encoded);
+    ArrowArrayViewReset(&array_view);
+    array.release(&array);
+  }
+
+  // Lengths that don't fit in the run end type and unsupported types
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT8), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendEmpty(&array, INT16_MAX + 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, &error), NANOARROW_OK);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT8);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewRunEndEncode(&array_view, NANOARROW_TYPE_INT16, &encoded,
+                                       &error),
+            EOVERFLOW);
+  ASSERT_EQ(ArrowArrayViewRunEndEncode(&array_view, NANOARROW_TYPE_INT32, &encoded,
+                                       &error),
+            NANOARROW_OK);
+  EXPECT_EQ(encoded.children[0]->length, 1);
+  encoded.release(&encoded);
 
+  EXPECT_EQ(ArrowArrayViewRunEndEncode(&array_view, NANOARROW_TYPE_INT8, &encoded,
+                                       &error),
+            EINVAL);
+  EXPECT_EQ(ArrowArrayViewRunEndDecode(&array_view, &decoded, &error), EINVAL);
   ArrowArrayViewReset(&array_view);
-  schema.release(&schema);
   array.release(&array);
+
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRUCT);
+  EXPECT_EQ(ArrowArrayViewRunEndEncode(&array_view, NANOARROW_TYPE_INT32, &encoded,
+                                       &error),
+            ENOTSUP);
+  EXPECT_STREQ(error.message, "Run-end encoding of struct arrays is not supported");
+  ArrowArrayViewReset(&array_view);
 }
 
-TEST(ArrayTest, ArrayViewTestDenseUnionGet) {
-  struct ArrowArrayView array_view;
-  struct ArrowArray array;
+TEST(ArrayViewTest, ArrayViewTestHash) {
   struct ArrowSchema schema;
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+  std::vector<uint64_t> hashes(5);
+  std::vector<uint64_t> other(5);
 
-  // Build a simple union with one int and one string and one null int
-  ArrowSchemaInit(&schema);
-  ASSERT_EQ(ArrowSchemaSetTypeUnion(&schema, NANOARROW_TYPE_DENSE_UNION, 2),
-            NANOARROW_OK);
-  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
-  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
-
-  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  // Equal values have equal hashes and all null elements hash to the same value
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 123), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayFinishUnionElement(&array, 0), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView("one twenty four")),
-            NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayFinishUnionElement(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 1), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
 
-  // Initialize the array view
-  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
-            NANOARROW_OK);
-
-  // Check the values that will be used to index into children
-  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 0), 0);
-  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 1), 1);
-  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 2), 0);
-
-  // Check the values that will be used to index into the child arrays
-  EXPECT_EQ(ArrowArrayViewUnionChildOffset(&array_view, 0), 0);
-  EXPECT_EQ(ArrowArrayViewUnionChildOffset(&array_view, 1), 0);
-  EXPECT_EQ(ArrowArrayViewUnionChildOffset(&array_view, 2), 1);
-
-  // Union elements are "never null" (even if the corresponding child element is)
-  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 2), NANOARROW_OK);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT32);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewHash(&array_view, 0, hashes.data(), &error), NANOARROW_OK);
+  EXPECT_EQ(hashes[0], hashes[3]);
+  EXPECT_NE(hashes[0], hashes[1]);
+  EXPECT_NE(hashes[0], hashes[2]);
+  EXPECT_EQ(hashes[2], hashes[4]);
+
+  // The seed changes every hash
+  ASSERT_EQ(ArrowArrayViewHash(&array_view, 1234, other.data(), &error), NANOARROW_OK);
+  for (int64_t i = 0; i < 5; i++) {
+    EXPECT_NE(hashes[i], other[i]);
+  }
 
+  // The hashes of a sliced array are those of the corresponding elements
+  array.offset = 1;
+  array.length = 3;
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewHash(&array_view, 0, other.data(), &error), NANOARROW_OK);
+  EXPECT_EQ(other[0], hashes[1]);
+  EXPECT_EQ(other[1], hashes[2]);
+  EXPECT_EQ(other[2], hashes[3]);
   ArrowArrayViewReset(&array_view);
-  schema.release(&schema);
   array.release(&array);
-}
 
-TEST(ArrayTest, ArrayViewTestSparseUnionGet) {
-  struct ArrowArrayView array_view;
-  struct ArrowArray array;
-  struct ArrowSchema schema;
+  // Null elements hash to the same value regardless of type
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_NA);
+  array_view.length = 1;
+  ASSERT_EQ(ArrowArrayViewHash(&array_view, 0, other.data(), &error), NANOARROW_OK);
+  EXPECT_EQ(other[0], hashes[2]);
+  ArrowArrayViewReset(&array_view);
+
+  // Strings are hashed by their content regardless of their layout
+  const char* values[] = {"abc", "", "a string longer than twelve bytes", "abc", "abcd"};
+  for (enum ArrowType type : {NANOARROW_TYPE_STRING, NANOARROW_TYPE_LARGE_STRING,
+                              NANOARROW_TYPE_STRING_VIEW}) {
+    ASSERT_EQ(ArrowArrayInitFromType(&array, type), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    for (const char* value : values) {
+      ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView(value)), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+    ArrowArrayViewInitFromType(&array_view, type);
+    ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewHash(&array_view, 0, other.data(), &error), NANOARROW_OK);
+    EXPECT_EQ(other[0], other[3]);
+    EXPECT_NE(other[0], other[1]);
+    EXPECT_NE(other[0], other[4]);
+    if (type == NANOARROW_TYPE_STRING) {
+      hashes = other;
+    } else {
+      EXPECT_EQ(other, hashes);
+    }
+    ArrowArrayViewReset(&array_view);
+    array.release(&array);
+  }
+
+  // Struct hashes combine the children such that rows are only equal if all of their
+  // children are equal; null rows hash to the same value as other null elements
+  uint64_t null_hash = 0;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_NA);
+  array_view.length = 1;
+  ASSERT_EQ(ArrowArrayViewHash(&array_view, 0, &null_hash, &error), NANOARROW_OK);
+  ArrowArrayViewReset(&array_view);
 
-  // Build a simple union with one int and one string and one null int
   ArrowSchemaInit(&schema);
-  ASSERT_EQ(ArrowSchemaSetTypeUnion(&schema, NANOARROW_TYPE_SPARSE_UNION, 2),
-            NANOARROW_OK);
-  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT64), NANOARROW_OK);
   ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
-
   ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendInt(array.children[0], 123), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayFinishUnionElement(&array, 0), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView("one twenty four")),
-            NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayFinishUnionElement(&array, 1), NANOARROW_OK);
+  int64_t ints[] = {1, 1, 2, 1};
+  const char* strings[] = {"a", "b", "a", "a"};
+  for (int64_t i = 0; i < 4; i++) {
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[0], ints[i]), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView(strings[i])),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
   ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
 
-  // Initialize the array view
-  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr), NANOARROW_OK);
-  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
-            NANOARROW_OK);
-
-  // Check the values that will be used to index into children
-  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 0), 0);
-  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 1), 1);
-  EXPECT_EQ(ArrowArrayViewUnionChildIndex(&array_view, 2), 0);
-
-  // Check the values that will be used to index into the child arrays
-  EXPECT_EQ(ArrowArrayViewUnionChildOffset(&array_view, 0), 0);
-  EXPECT_EQ(ArrowArrayViewUnionChildOffset(&array_view, 1), 1);
-  EXPECT_EQ(ArrowArrayViewUnionChildOffset(&array_view, 2), 2);
-
-  // Union elements are "never null" (even if the corresponding child element is)
-  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewHash(&array_view, 0, hashes.data(), &error), NANOARROW_OK);
+  EXPECT_EQ(hashes[0], hashes[3]);
+  EXPECT_NE(hashes[0], hashes[1]);
+  EXPECT_NE(hashes[0], hashes[2]);
+  EXPECT_EQ(hashes[4], null_hash);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
 
+  // Nested types are not supported
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_LIST), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ArrowArrayViewSetLength(&array_view, 0);
+  EXPECT_EQ(ArrowArrayViewHash(&array_view, 0, hashes.data(), &error), ENOTSUP);
+  EXPECT_STREQ(error.message, "Hashing arrays of type list is not supported");
   ArrowArrayViewReset(&array_view);
   schema.release(&schema);
-  array.release(&array);
 }
 
-template <typename TypeClass>
-void TestGetFromNumericArrayView() {
-  struct ArrowArray array;
+TEST(ArrayViewTest, ArrayViewTestComputeStatistics) {
   struct ArrowSchema schema;
+  struct ArrowArray array;
   struct ArrowArrayView array_view;
+  struct ArrowArrayStatistics statistics;
   struct ArrowError error;
 
-  auto type = TypeTraits<TypeClass>::type_singleton();
-
-  // Array with nulls
-  auto builder = NumericBuilder<TypeClass>();
-  ARROW_EXPECT_OK(builder.Append(1));
-  ARROW_EXPECT_OK(builder.AppendNulls(2));
-  ARROW_EXPECT_OK(builder.Append(4));
-  auto maybe_arrow_array = builder.Finish();
-  ARROW_EXPECT_OK(maybe_arrow_array);
-  auto arrow_array = maybe_arrow_array.ValueUnsafe();
-
-  ARROW_EXPECT_OK(ExportArray(*arrow_array, &array, &schema));
-  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  // Signed integers with nulls
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int64_t value : {3, -7, 3, 12, 0}) {
+    ASSERT_EQ(ArrowArrayAppendInt(&array, value), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT32);
   ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+  ASSERT_EQ(ArrowArrayViewComputeStatistics(&array_view, &statistics, &error),
             NANOARROW_OK);
+  EXPECT_EQ(statistics.null_count, 5);
+  EXPECT_EQ(statistics.distinct_count, 4);
+  ASSERT_TRUE(statistics.has_min_max);
+  EXPECT_EQ(statistics.min.as_int64, -7);
+  EXPECT_EQ(statistics.max.as_int64, 12);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
 
-  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 2), 1);
-  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 3), 0);
+  // Unsigned integers beyond the range of int64_t
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_UINT64), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendUInt(&array, 5), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendUInt(&array, UINT64_MAX), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_UINT64);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewComputeStatistics(&array_view, &statistics, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(statistics.null_count, 0);
+  EXPECT_EQ(statistics.distinct_count, 2);
+  EXPECT_EQ(statistics.min.as_uint64, 5);
+  EXPECT_EQ(statistics.max.as_uint64, UINT64_MAX);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
 
-  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(&array_view, 3), 4);
-  EXPECT_EQ(ArrowArrayViewGetUIntUnsafe(&array_view, 3), 4);
-  EXPECT_EQ(ArrowArrayViewGetDoubleUnsafe(&array_view, 3), 4.0);
+  // NaN is not considered for the minimum or maximum
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_DOUBLE), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(&array, NAN), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(&array, 1.5), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(&array, -INFINITY), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_DOUBLE);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewComputeStatistics(&array_view, &statistics, &error),
+            NANOARROW_OK);
+  ASSERT_TRUE(statistics.has_min_max);
+  EXPECT_EQ(statistics.min.as_double, -INFINITY);
+  EXPECT_EQ(statistics.max.as_double, 1.5);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
 
-  auto string_view = ArrowArrayViewGetStringUnsafe(&array_view, 0);
-  EXPECT_EQ(string_view.data, nullptr);
-  EXPECT_EQ(string_view.size_bytes, 0);
-  auto buffer_view = ArrowArrayViewGetBytesUnsafe(&array_view, 0);
-  EXPECT_EQ(buffer_view.data.data, nullptr);
-  EXPECT_EQ(buffer_view.size_bytes, 0);
+  // Only null values
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT64), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT64);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewComputeStatistics(&array_view, &statistics, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(statistics.null_count, 3);
+  EXPECT_EQ(statistics.distinct_count, 0);
+  EXPECT_FALSE(statistics.has_min_max);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
 
+  // Decimals are compared by value and refer to the bytes of the array
+  struct ArrowDecimal decimal;
+  ArrowDecimalInit(&decimal, 128, 10, 2);
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetTypeDecimal(&schema, NANOARROW_TYPE_DECIMAL128, 10, 2),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int64_t value : {-1, 4, -300, 2}) {
+    ArrowDecimalSetInt(&decimal, value);
+    ASSERT_EQ(ArrowArrayAppendDecimal(&array, &decimal), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewComputeStatistics(&array_view, &statistics, &error),
+            NANOARROW_OK);
+  ASSERT_TRUE(statistics.has_min_max);
+  EXPECT_EQ(statistics.min.as_bytes.size_bytes, 16);
+  ArrowDecimalSetBytes(&decimal, statistics.min.as_bytes.data.as_uint8);
+  EXPECT_EQ(ArrowDecimalGetIntUnsafe(&decimal), -300);
+  ArrowDecimalSetBytes(&decimal, statistics.max.as_bytes.data.as_uint8);
+  EXPECT_EQ(ArrowDecimalGetIntUnsafe(&decimal), 4);
   ArrowArrayViewReset(&array_view);
   array.release(&array);
   schema.release(&schema);
 
-  // Array without nulls (Arrow does not allocate the validity buffer)
-  builder = NumericBuilder<TypeClass>();
-  ARROW_EXPECT_OK(builder.Append(1));
-  ARROW_EXPECT_OK(builder.Append(2));
-  maybe_arrow_array = builder.Finish();
-  ARROW_EXPECT_OK(maybe_arrow_array);
-  arrow_array = maybe_arrow_array.ValueUnsafe();
+  // Strings are compared by byte such that a prefix is less than the string
+  for (enum ArrowType type : {NANOARROW_TYPE_STRING, NANOARROW_TYPE_STRING_VIEW}) {
+    ASSERT_EQ(ArrowArrayInitFromType(&array, type), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    for (const char* value : {"banana", "apple", "bananas", "apple", "cherry"}) {
+      ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView(value)), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+    ArrowArrayViewInitFromType(&array_view, type);
+    ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewComputeStatistics(&array_view, &statistics, &error),
+              NANOARROW_OK);
+    EXPECT_EQ(statistics.null_count, 1);
+    EXPECT_EQ(statistics.distinct_count, 4);
+    EXPECT_EQ(std::string(statistics.min.as_bytes.data.as_char,
+                          statistics.min.as_bytes.size_bytes),
+              "apple");
+    EXPECT_EQ(std::string(statistics.max.as_bytes.data.as_char,
+                          statistics.max.as_bytes.size_bytes),
+              "cherry");
+    ArrowArrayViewReset(&array_view);
+    array.release(&array);
+  }
 
-  ARROW_EXPECT_OK(ExportArray(*arrow_array, &array, &schema));
-  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
+  // The distinct count of many values over many blocks is an estimate
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT64), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int64_t i = 0; i < 100000; i++) {
+    ASSERT_EQ(ArrowArrayAppendInt(&array, i % 20000), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT64);
   ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+  ASSERT_EQ(ArrowArrayViewComputeStatistics(&array_view, &statistics, &error),
             NANOARROW_OK);
+  EXPECT_EQ(statistics.min.as_int64, 0);
+  EXPECT_EQ(statistics.max.as_int64, 19999);
+  EXPECT_GT(statistics.distinct_count, 18000);
+  EXPECT_LT(statistics.distinct_count, 22000);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
 
-  // We're trying to test behavior with no validity buffer, so make sure that's true
-  ASSERT_EQ(array_view.buffer_views[0].data.data, nullptr);
+  // Other types are not supported
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_BOOL);
+  EXPECT_EQ(ArrowArrayViewComputeStatistics(&array_view, &statistics, &error), ENOTSUP);
+  EXPECT_STREQ(error.message,
+               "Computing statistics of arrays of type bool is not supported");
+  ArrowArrayViewReset(&array_view);
+}
 
-  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 0), 0);
-  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 1), 0);
+TEST(ArrayViewTest, ArrayViewTestBloomFilter) {
+  struct ArrowBloomFilter filter;
+  EXPECT_EQ(ArrowBloomFilterInit(&filter, -1, 0.01), EINVAL);
+  EXPECT_EQ(ArrowBloomFilterInit(&filter, 10, 0), EINVAL);
+  EXPECT_EQ(ArrowBloomFilterInit(&filter, 10, 1), EINVAL);
+
+  // A filter of 1000 distinct values at 1% uses about 9.6 bits per value
+  ASSERT_EQ(ArrowBloomFilterInit(&filter, 1000, 0.01), NANOARROW_OK);
+  EXPECT_GT(filter.n_blocks, 30);
+  EXPECT_LT(filter.n_blocks, 60);
+
+  // Hashes are mixed from even integers such that odd integers were never inserted
+  std::vector<uint64_t> hashes(2000);
+  for (uint64_t i = 0; i < hashes.size(); i++) {
+    hashes[i] = (i + 1) * 0x9e3779b97f4a7c15ULL;
+    hashes[i] ^= hashes[i] >> 29;
+  }
 
-  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(&array_view, 0), 1);
-  EXPECT_EQ(ArrowArrayViewGetUIntUnsafe(&array_view, 1), 2);
+  for (size_t i = 0; i < hashes.size(); i += 2) {
+    ArrowBloomFilterInsert(&filter, hashes.data() + i, 1);
+  }
 
-  ArrowArrayViewReset(&array_view);
-  array.release(&array);
-  schema.release(&schema);
-}
+  int64_t n_false_positive = 0;
+  for (size_t i = 0; i < hashes.size(); i++) {
+    if (i % 2 == 0) {
+      EXPECT_TRUE(ArrowBloomFilterMightContain(&filter, hashes[i]));
+    } else {
+      n_false_positive += ArrowBloomFilterMightContain(&filter, hashes[i]) != 0;
+    }
+  }
+  EXPECT_LT(n_false_positive, 50);
+  ArrowBloomFilterReset(&filter);
 
-TEST(ArrayViewTest, ArrayViewTestGetNumeric) {
-  TestGetFromNumericArrayView<Int64Type>();
-  TestGetFromNumericArrayView<UInt64Type>();
-  TestGetFromNumericArrayView<Int32Type>();
-  TestGetFromNumericArrayView<UInt32Type>();
-  TestGetFromNumericArrayView<Int16Type>();
-  TestGetFromNumericArrayView<UInt32Type>();
-  TestGetFromNumericArrayView<Int8Type>();
-  TestGetFromNumericArrayView<UInt32Type>();
-  TestGetFromNumericArrayView<DoubleType>();
-  TestGetFromNumericArrayView<FloatType>();
+  // A filter without blocks may contain anything
+  EXPECT_EQ(filter.n_blocks, 0);
+  EXPECT_TRUE(ArrowBloomFilterMightContain(&filter, 123));
 }
 
-template <typename BuilderClass>
-void TestGetFromBinary(BuilderClass& builder) {
-  struct ArrowArray array;
+TEST(ArrayViewTest, ArrayViewTestBatchSummary) {
   struct ArrowSchema schema;
+  struct ArrowArray array;
   struct ArrowArrayView array_view;
+  struct ArrowBatchSummary summary;
   struct ArrowError error;
 
-  auto type = builder.type();
-  ARROW_EXPECT_OK(builder.Append("1234"));
-  ARROW_EXPECT_OK(builder.AppendNulls(2));
-  ARROW_EXPECT_OK(builder.Append("four"));
-  auto maybe_arrow_array = builder.Finish();
-  ARROW_EXPECT_OK(maybe_arrow_array);
-  auto arrow_array = maybe_arrow_array.ValueUnsafe();
-
-  ARROW_EXPECT_OK(ExportArray(*arrow_array, &array, &schema));
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT64), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[2], NANOARROW_TYPE_BOOL), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int64_t i = 0; i < 1000; i++) {
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[0], i * 10), NANOARROW_OK);
+    if (i == 500) {
+      ASSERT_EQ(ArrowArrayAppendNull(array.children[1], 1), NANOARROW_OK);
+    } else {
+      std::string value = "key" + std::to_string(i);
+      ASSERT_EQ(ArrowArrayAppendString(array.children[1], ArrowCharView(value.c_str())),
+                NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayAppendInt(array.children[2], i % 2), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(&array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema, &error), NANOARROW_OK);
   ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, &error), NANOARROW_OK);
-  EXPECT_EQ(ArrowArrayViewValidate(&array_view, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+
+  EXPECT_EQ(ArrowBatchSummaryInit(&summary, array_view.children[0], 0.01, &error),
+            EINVAL);
+  EXPECT_EQ(ArrowBatchSummaryInit(&summary, &array_view, 0, &error), EINVAL);
+  ASSERT_EQ(ArrowBatchSummaryInit(&summary, &array_view, 0.01, &error), NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(summary.length, 1000);
+  ASSERT_EQ(summary.n_columns, 3);
+  EXPECT_TRUE(summary.columns[0].has_statistics);
+  EXPECT_EQ(summary.columns[0].statistics.min.as_int64, 0);
+  EXPECT_EQ(summary.columns[0].statistics.max.as_int64, 9990);
+  EXPECT_TRUE(summary.columns[1].has_statistics);
+  EXPECT_EQ(summary.columns[1].statistics.null_count, 1);
+  EXPECT_FALSE(summary.columns[2].has_statistics);
+
+  // Probes of the integer column: present, absent but in range, out of range, null
+  struct ArrowArray probe;
+  struct ArrowArrayView probe_view;
+  uint8_t out[1200];
+  ASSERT_EQ(ArrowArrayInitFromType(&probe, NANOARROW_TYPE_INT64), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&probe), NANOARROW_OK);
+  for (int64_t i = 0; i < 1000; i++) {
+    ASSERT_EQ(ArrowArrayAppendInt(&probe, i * 10), NANOARROW_OK);
+  }
+  for (int64_t i = 0; i < 198; i++) {
+    ASSERT_EQ(ArrowArrayAppendInt(&probe, i * 10 + 5), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayAppendInt(&probe, 10000), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&probe, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&probe, nullptr), NANOARROW_OK);
+  ArrowArrayViewInitFromType(&probe_view, NANOARROW_TYPE_INT64);
+  ASSERT_EQ(ArrowArrayViewSetArray(&probe_view, &probe, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowBatchSummaryMightContain(&summary, 0, &probe_view, out, &error),
             NANOARROW_OK);
+  int64_t n_false_positive = 0;
+  for (int64_t i = 0; i < 1000; i++) {
+    EXPECT_EQ(out[i], 1);
+  }
+  for (int64_t i = 1000; i < 1198; i++) {
+    n_false_positive += out[i];
+  }
+  EXPECT_LT(n_false_positive, 20);
+  EXPECT_EQ(out[1198], 0);
+  EXPECT_EQ(out[1199], 0);
 
-  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 2), 1);
-  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 3), 0);
+  // The wrong column or type is an error
+  EXPECT_EQ(ArrowBatchSummaryMightContain(&summary, 1, &probe_view, out, &error),
+            EINVAL);
+  EXPECT_EQ(ArrowBatchSummaryMightContain(&summary, 3, &probe_view, out, &error),
+            EINVAL);
+  ArrowArrayViewReset(&probe_view);
+  probe.release(&probe);
+
+  // Probes of the string column, whose null may be contained
+  ASSERT_EQ(ArrowArrayInitFromType(&probe, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&probe), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&probe, ArrowCharView("key42")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&probe, ArrowCharView("a")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&probe, ArrowCharView("zzz")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&probe, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&probe, nullptr), NANOARROW_OK);
+  ArrowArrayViewInitFromType(&probe_view, NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowArrayViewSetArray(&probe_view, &probe, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowBatchSummaryMightContain(&summary, 1, &probe_view, out, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(std::vector<uint8_t>(out, out + 4), std::vector<uint8_t>({1, 0, 0, 1}));
+
+  // A serialized summary gives the same answers and truncated data is an error
+  struct ArrowBuffer buffer;
+  struct ArrowBatchSummary summary2;
+  ArrowBufferInit(&buffer);
+  ASSERT_EQ(ArrowBatchSummarySerialize(&summary, &buffer), NANOARROW_OK);
+  struct ArrowBufferView data;
+  data.data.data = buffer.data;
+  data.size_bytes = buffer.size_bytes;
+  ASSERT_EQ(ArrowBatchSummaryDeserialize(&summary2, data, &error), NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(summary2.length, 1000);
+  ASSERT_EQ(summary2.n_columns, 3);
+  EXPECT_FALSE(summary2.columns[2].has_statistics);
+  EXPECT_EQ(summary2.columns[1].bloom_filter.n_blocks,
+            summary.columns[1].bloom_filter.n_blocks);
+  memset(out, 0xff, 4);
+  ASSERT_EQ(ArrowBatchSummaryMightContain(&summary2, 1, &probe_view, out, &error),
+            NANOARROW_OK);
+  EXPECT_EQ(std::vector<uint8_t>(out, out + 4), std::vector<uint8_t>({1, 0, 0, 1}));
+  ArrowBatchSummaryReset(&summary2);
+
+  data.size_bytes -= 1;
+  EXPECT_EQ(ArrowBatchSummaryDeserialize(&summary2, data, &error), EINVAL);
+  data.size_bytes = 4;
+  EXPECT_EQ(ArrowBatchSummaryDeserialize(&summary2, data, &error), EINVAL);
+
+  ArrowBufferReset(&buffer);
+  ArrowArrayViewReset(&probe_view);
+  probe.release(&probe);
+  ArrowBatchSummaryReset(&summary);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  schema.release(&schema);
+}
 
-  auto string_view = ArrowArrayViewGetStringUnsafe(&array_view, 3);
-  EXPECT_EQ(string_view.size_bytes, strlen("four"));
-  EXPECT_EQ(memcmp(string_view.data, "four", string_view.size_bytes), 0);
+TEST(ArrayViewTest, ArrayViewTestComputeNullCount) {
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
 
-  auto buffer_view = ArrowArrayViewGetBytesUnsafe(&array_view, 3);
-  EXPECT_EQ(buffer_view.size_bytes, strlen("four"));
-  EXPECT_EQ(memcmp(buffer_view.data.as_char, "four", buffer_view.size_bytes), 0);
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 4), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+  // A known null count is returned as is
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT32);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewComputeNullCount(&array_view), 2);
+
+  // An unknown null count is computed and cached
+  array.null_count = -1;
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewComputeNullCount(&array_view), 2);
+  EXPECT_EQ(array_view.null_count, 2);
+  EXPECT_NE(array_view.buffer_views[0].data.data, nullptr);
+
+  // Computing the null count of a slice without nulls leaves its buffer views as is
+  array.offset = 3;
+  array.length = 1;
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  struct ArrowBufferView validity = array_view.buffer_views[0];
+  EXPECT_EQ(ArrowArrayViewComputeNullCount(&array_view), 0);
+  EXPECT_EQ(array_view.buffer_views[0].data.data, validity.data.data);
+  EXPECT_EQ(array_view.buffer_views[0].size_bytes, validity.size_bytes);
+  EXPECT_NE(validity.data.data, nullptr);
+  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 0), 0);
+  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(&array_view, 0), 4);
+
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+
+  // All elements of a null array are null
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_NA), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array, 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  array.null_count = -1;
+
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_NA);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewComputeNullCount(&array_view), 3);
 
   ArrowArrayViewReset(&array_view);
   array.release(&array);
-  schema.release(&schema);
 }
 
-TEST(ArrayViewTest, ArrayViewTestGetString) {
-  auto string_builder = StringBuilder();
-  TestGetFromBinary<StringBuilder>(string_builder);
+TEST(ArrayViewTest, ArrayViewTestGetRangesUnsafe) {
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  int64_t ints[3];
+  double doubles[3];
+  struct ArrowStringView strings[3];
 
-  auto binary_builder = BinaryBuilder();
-  TestGetFromBinary<BinaryBuilder>(binary_builder);
+  // Ranges of a sliced array start at the array's offset
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT16), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int i = 0; i < 5; i++) {
+    ASSERT_EQ(ArrowArrayAppendInt(&array, i - 2), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  array.offset = 1;
+  array.length = 4;
 
-  auto large_string_builder = LargeStringBuilder();
-  TestGetFromBinary<LargeStringBuilder>(large_string_builder);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_INT16);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  ArrowArrayViewGetIntsUnsafe(&array_view, 1, 3, ints);
+  EXPECT_EQ(ints[0], 0);
+  EXPECT_EQ(ints[1], 1);
+  EXPECT_EQ(ints[2], 2);
+  ArrowArrayViewGetDoublesUnsafe(&array_view, 0, 3, doubles);
+  EXPECT_EQ(doubles[0], -1.0);
+  EXPECT_EQ(doubles[1], 0.0);
+  EXPECT_EQ(doubles[2], 1.0);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
 
-  auto large_binary_builder = LargeBinaryBuilder();
-  TestGetFromBinary<LargeBinaryBuilder>(large_binary_builder);
+  // Types without a specialized loop use the element-wise getters
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_BOOL), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 0), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
 
-  auto fixed_size_builder = FixedSizeBinaryBuilder(fixed_size_binary(4));
-  TestGetFromBinary<FixedSizeBinaryBuilder>(fixed_size_builder);
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_BOOL);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  ArrowArrayViewGetIntsUnsafe(&array_view, 0, 3, ints);
+  EXPECT_EQ(ints[0], 1);
+  EXPECT_EQ(ints[1], 0);
+  EXPECT_EQ(ints[2], 1);
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+
+  // Strings
+  for (auto type : {NANOARROW_TYPE_STRING, NANOARROW_TYPE_LARGE_BINARY,
+                    NANOARROW_TYPE_STRING_VIEW}) {
+    ASSERT_EQ(ArrowArrayInitFromType(&array, type), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("a")), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("")), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("a longer string value")),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+
+    ArrowArrayViewInitFromType(&array_view, type);
+    ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+    ArrowArrayViewGetStringsUnsafe(&array_view, 0, 3, strings);
+    EXPECT_EQ(std::string(strings[0].data, strings[0].size_bytes), "a");
+    EXPECT_EQ(strings[1].size_bytes, 0);
+    EXPECT_EQ(std::string(strings[2].data, strings[2].size_bytes),
+              "a longer string value");
+    ArrowArrayViewReset(&array_view);
+    array.release(&array);
+  }
 }
 
 TEST(ArrayViewTest, ArrayViewTestGetIntervalYearMonth) {
@@ -28,6 +28,45 @@
 extern "C" {
 #endif
 
+// Finalize a hash so that every output bit depends on every input bit
+static inline uint64_t _ArrowHashFinalize(uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= 0xFF51AFD7ED558CCDULL;
+  hash ^= hash >> 33;
+  hash *= 0xC4CEB9FE1A85EC53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+// A hash of arbitrary bytes that processes eight bytes at a time
+static inline uint64_t _ArrowHashBytes(uint64_t seed, const uint8_t* data,
+                                       int64_t size_bytes) {
+  const uint64_t multiplier = 0x9E3779B97F4A7C15ULL;
+  uint64_t hash = seed ^ ((uint64_t)size_bytes * multiplier);
+  uint64_t word;
+
+  while (size_bytes >= 8) {
+    memcpy(&word, data, sizeof(uint64_t));
+    hash = (hash ^ word) * multiplier;
+    hash ^= hash >> 32;
+    data += 8;
+    size_bytes -= 8;
+  }
+
+  if (size_bytes > 0) {
+    word = 0;
+    memcpy(&word, data, (size_t)size_bytes);
+    hash = (hash ^ word) * multiplier;
+  }
+
+  return _ArrowHashFinalize(hash);
+}
+
+// A hash of a value that fits in a single word
+static inline uint64_t _ArrowHashWord(uint64_t seed, uint64_t word) {
+  return _ArrowHashFinalize((seed ^ word) * 0x9E3779B97F4A7C15ULL);
+}
+
 static inline int64_t _ArrowGrowByFactor(int64_t current_capacity, int64_t new_capacity) {
   int64_t doubled_capacity = current_capacity * 2;
   if (doubled_capacity > new_capacity) {
@@ -37,11 +76,43 @@ static inline int64_t _ArrowGrowByFactor(int64_t current_capacity, int64_t new_c
   }
 }
 
+static inline int64_t _ArrowGrowByPolicy(enum ArrowBufferGrowthPolicy growth_policy,
+                                         int64_t current_capacity,
+                                         int64_t new_capacity) {
+  int64_t grown_capacity;
+  int64_t page_size;
+
+  switch (growth_policy) {
+    case NANOARROW_BUFFER_GROWTH_FACTOR_1_5:
+      grown_capacity = current_capacity + current_capacity / 2;
+      return grown_capacity > new_capacity ? grown_capacity : new_capacity;
+    case NANOARROW_BUFFER_GROWTH_PAGE_ALIGNED:
+      grown_capacity = current_capacity + current_capacity / 2;
+      if (grown_capacity < new_capacity) {
+        grown_capacity = new_capacity;
+      }
+
+      page_size = grown_capacity >= (2 << 20) ? (2 << 20) : 4096;
+      if (grown_capacity > (INT64_MAX - page_size)) {
+        return grown_capacity;
+      }
+
+      return (grown_capacity + page_size - 1) & ~(page_size - 1);
+    default:
+      return _ArrowGrowByFactor(current_capacity, new_capacity);
+  }
+}
+
 static inline void ArrowBufferInit(struct ArrowBuffer* buffer) {
   buffer->data = NULL;
   buffer->size_bytes = 0;
   buffer->capacity_bytes = 0;
   buffer->allocator = ArrowBufferAllocatorDefault();
+  buffer->growth_policy = NANOARROW_BUFFER_GROWTH_DOUBLE;
+#if defined(NANOARROW_WITH_BUFFER_STATS)
+  buffer->n_reallocations = 0;
+  buffer->bytes_reallocated = 0;
+#endif
 }
 
 static inline ArrowErrorCode ArrowBufferSetAllocator(
@@ -54,6 +125,11 @@ static inline ArrowErrorCode ArrowBufferSetAllocator(
   }
 }
 
+static inline void ArrowBufferSetGrowthPolicy(
+    struct ArrowBuffer* buffer, enum ArrowBufferGrowthPolicy growth_policy) {
+  buffer->growth_policy = growth_policy;
+}
+
 static inline void ArrowBufferReset(struct ArrowBuffer* buffer) {
   if (buffer->data != NULL) {
     buffer->allocator.free(&buffer->allocator, (uint8_t*)buffer->data,
@@ -63,6 +139,10 @@ static inline void ArrowBufferReset(struct ArrowBuffer* buffer) {
 
   buffer->capacity_bytes = 0;
   buffer->size_bytes = 0;
+#if defined(NANOARROW_WITH_BUFFER_STATS)
+  buffer->n_reallocations = 0;
+  buffer->bytes_reallocated = 0;
+#endif
 }
 
 static inline void ArrowBufferMove(struct ArrowBuffer* src, struct ArrowBuffer* dst) {
@@ -79,6 +159,15 @@ static inline ArrowErrorCode ArrowBufferResize(struct ArrowBuffer* buffer,
   }
 
   if (new_capacity_bytes > buffer->capacity_bytes || shrink_to_fit) {
+    NANOARROW_TRACE(NANOARROW_TRACE_BUFFER_REALLOCATE, buffer->capacity_bytes,
+                    new_capacity_bytes);
+#if defined(NANOARROW_WITH_BUFFER_STATS)
+    if (buffer->data != NULL) {
+      buffer->n_reallocations++;
+      buffer->bytes_reallocated += buffer->size_bytes;
+    }
+#endif
+
     buffer->data = buffer->allocator.reallocate(
         &buffer->allocator, buffer->data, buffer->capacity_bytes, new_capacity_bytes);
     if (buffer->data == NULL && new_capacity_bytes > 0) {
@@ -106,7 +195,10 @@ static inline ArrowErrorCode ArrowBufferReserve(struct ArrowBuffer* buffer,
   }
 
   return ArrowBufferResize(
-      buffer, _ArrowGrowByFactor(buffer->capacity_bytes, min_capacity_bytes), 0);
+      buffer,
+      _ArrowGrowByPolicy(buffer->growth_policy, buffer->capacity_bytes,
+                         min_capacity_bytes),
+      0);
 }
 
 static inline void ArrowBufferAppendUnsafe(struct ArrowBuffer* buffer, const void* data,
@@ -210,6 +302,36 @@ static const uint8_t _ArrowkBytePopcount[] = {
     5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6,
     4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8};
 
+// Count the set bits in a 64-bit word. Where the compiler provides a builtin,
+// this compiles to a single instruction when the target supports it (e.g.,
+// popcnt on x86_64 with -mpopcnt or cnt on ARM64); otherwise, fall back to the
+// byte lookup table.
+static inline int64_t _ArrowPopcountUInt64(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return (int64_t)__builtin_popcountll(word);
+#else
+  int64_t count = 0;
+  for (int i = 0; i < 8; i++) {
+    count += _ArrowkBytePopcount[(word >> (i * 8)) & 0xff];
+  }
+  return count;
+#endif
+}
+
+// The index of the least significant set bit in a non-zero word
+static inline int64_t _ArrowCountTrailingZerosUInt64(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return (int64_t)__builtin_ctzll(word);
+#else
+  int64_t count = 0;
+  while ((word & 1) == 0) {
+    word >>= 1;
+    count++;
+  }
+  return count;
+#endif
+}
+
 static inline int64_t _ArrowRoundUpToMultipleOf8(int64_t value) {
   return (value + 7) & ~((int64_t)7);
 }
@@ -222,7 +344,21 @@ static inline int64_t _ArrowBytesForBits(int64_t bits) {
   return (bits >> 3) + ((bits & 7) != 0);
 }
 
+// The int8 pack and unpack helpers operate on all eight values at once using
+// 64-bit multiplies: on little endian platforms, byte k of a uint64_t
+// corresponds to int8 value k (i.e., bit k of the bitmap byte).
 static inline void _ArrowBitsUnpackInt8(const uint8_t word, int8_t* out) {
+  if (_ArrowIsLittleEndian()) {
+    // Broadcast word to all bytes, keep bit k of byte k, then collapse each
+    // byte to 0 or 1
+    uint64_t unpacked =
+        ((uint64_t)word * UINT64_C(0x0101010101010101)) & UINT64_C(0x8040201008040201);
+    unpacked = ((unpacked + UINT64_C(0x7F7F7F7F7F7F7F7F)) >> 7) &
+               UINT64_C(0x0101010101010101);
+    memcpy(out, &unpacked, sizeof(uint64_t));
+    return;
+  }
+
   out[0] = (word >> 0) & 1;
   out[1] = (word >> 1) & 1;
   out[2] = (word >> 2) & 1;
@@ -245,6 +381,15 @@ static inline void _ArrowBitsUnpackInt32(const uint8_t word, int32_t* out) {
 }
 
 static inline void _ArrowBitmapPackInt8(const int8_t* values, uint8_t* out) {
+  if (_ArrowIsLittleEndian()) {
+    // Because all values are 0 or 1, the multiply gathers value k into bit
+    // 56 + k without any carries between partial products
+    uint64_t packed;
+    memcpy(&packed, values, sizeof(uint64_t));
+    *out = (uint8_t)((packed * UINT64_C(0x0102040810204080)) >> 56);
+    return;
+  }
+
   *out = (values[0] | values[1] << 1 | values[2] << 2 | values[3] << 3 | values[4] << 4 |
           values[5] << 5 | values[6] << 6 | values[7] << 7);
 }
@@ -388,6 +533,10 @@ static inline void ArrowBitsSetTo(uint8_t* bits, int64_t start_offset, int64_t l
   bits[bytes_end - 1] |= (uint8_t)(fill_byte & ~last_byte_mask);
 }
 
+// The number of words counted by ArrowBitCountSet() above which the overhead of
+// calling the kernel selected by ArrowBitCountSetWords() is negligible
+#define _NANOARROW_BIT_COUNT_DISPATCH_WORDS 64
+
 static inline int64_t ArrowBitCountSet(const uint8_t* bits, int64_t start_offset,
                                        int64_t length) {
   if (length == 0) {
@@ -420,8 +569,23 @@ static inline int64_t ArrowBitCountSet(const uint8_t* bits, int64_t start_offset
   // first byte
   count += _ArrowkBytePopcount[bits[bytes_begin] & ~first_byte_mask];
 
-  // middle bytes
-  for (int64_t i = bytes_begin + 1; i < bytes_last_valid; i++) {
+  // middle bytes: whole 64-bit words first (memcpy() is used to avoid
+  // making any assumptions about alignment), then any remaining bytes
+  int64_t i = bytes_begin + 1;
+  int64_t n_words = (bytes_last_valid - i) / 8;
+  if (n_words >= _NANOARROW_BIT_COUNT_DISPATCH_WORDS) {
+    // Long ranges use the kernel selected for the CPU at runtime
+    count += ArrowBitCountSetWords(bits + i, n_words);
+    i += n_words * 8;
+  }
+
+  uint64_t word;
+  for (; (i + 8) <= bytes_last_valid; i += 8) {
+    memcpy(&word, bits + i, sizeof(uint64_t));
+    count += _ArrowPopcountUInt64(word);
+  }
+
+  for (; i < bytes_last_valid; i++) {
     count += _ArrowkBytePopcount[bits[i]];
   }
 
@@ -431,6 +595,257 @@ static inline int64_t ArrowBitCountSet(const uint8_t* bits, int64_t start_offset
   return count;
 }
 
+// Bitwise operations that can be applied to a pair of bitmaps
+#define _NANOARROW_BITS_AND 0
+#define _NANOARROW_BITS_OR 1
+#define _NANOARROW_BITS_XOR 2
+#define _NANOARROW_BITS_AND_NOT 3
+
+static inline uint64_t _ArrowBitsApplyOp(int op, uint64_t lhs, uint64_t rhs) {
+  switch (op) {
+    case _NANOARROW_BITS_AND:
+      return lhs & rhs;
+    case _NANOARROW_BITS_OR:
+      return lhs | rhs;
+    case _NANOARROW_BITS_XOR:
+      return lhs ^ rhs;
+    default:
+      return lhs & ~rhs;
+  }
+}
+
+// Load eight bits starting at an arbitrary bit offset. All eight bits must
+// be within the bitmap.
+static inline uint8_t _ArrowBitsLoadByte(const uint8_t* bits, int64_t offset) {
+  const uint8_t* cursor = bits + offset / 8;
+  const int shift = (int)(offset % 8);
+  if (shift == 0) {
+    return cursor[0];
+  }
+
+  return (uint8_t)((cursor[0] >> shift) | (cursor[1] << (8 - shift)));
+}
+
+// Load 64 bits starting at an arbitrary bit offset such that bit i of the
+// result is bit offset + i of the bitmap. All 64 bits must be within the
+// bitmap such that only the bytes they occupy are read.
+static inline uint64_t _ArrowBitsLoadWord(const uint8_t* bits, int64_t offset) {
+  const uint8_t* cursor = bits + offset / 8;
+  const int shift = (int)(offset % 8);
+
+  // Assembling the word byte by byte is endian-independent and is
+  // compiled to a single (unaligned) load on little endian platforms
+  uint64_t word = 0;
+  for (int i = 0; i < 8; i++) {
+    word |= (uint64_t)cursor[i] << (8 * i);
+  }
+
+  if (shift == 0) {
+    return word;
+  }
+
+  return (word >> shift) | ((uint64_t)cursor[8] << (64 - shift));
+}
+
+static inline void _ArrowBitsStoreWord(uint8_t* out, uint64_t word) {
+  for (int i = 0; i < 8; i++) {
+    out[i] = (uint8_t)(word >> (8 * i));
+  }
+}
+
+static inline void _ArrowBitsBinaryOp(int op, const uint8_t* lhs, int64_t lhs_offset,
+                                      const uint8_t* rhs, int64_t rhs_offset,
+                                      int64_t length, uint8_t* out, int64_t out_offset) {
+  int64_t i = 0;
+
+  // Leading bits until the output is byte-aligned
+  for (; i < length && ((out_offset + i) % 8) != 0; i++) {
+    uint64_t value = _ArrowBitsApplyOp(op, (uint64_t)ArrowBitGet(lhs, lhs_offset + i),
+                                       (uint64_t)ArrowBitGet(rhs, rhs_offset + i));
+    ArrowBitSetTo(out, out_offset + i, (uint8_t)(value & 1));
+  }
+
+  // Whole 64-bit words, shifting the input as required
+  for (; (i + 64) <= length; i += 64) {
+    uint64_t value = _ArrowBitsApplyOp(op, _ArrowBitsLoadWord(lhs, lhs_offset + i),
+                                       _ArrowBitsLoadWord(rhs, rhs_offset + i));
+    _ArrowBitsStoreWord(out + (out_offset + i) / 8, value);
+  }
+
+  // Whole bytes
+  for (; (i + 8) <= length; i += 8) {
+    uint64_t value = _ArrowBitsApplyOp(op, _ArrowBitsLoadByte(lhs, lhs_offset + i),
+                                       _ArrowBitsLoadByte(rhs, rhs_offset + i));
+    out[(out_offset + i) / 8] = (uint8_t)value;
+  }
+
+  // Trailing bits
+  for (; i < length; i++) {
+    uint64_t value = _ArrowBitsApplyOp(op, (uint64_t)ArrowBitGet(lhs, lhs_offset + i),
+                                       (uint64_t)ArrowBitGet(rhs, rhs_offset + i));
+    ArrowBitSetTo(out, out_offset + i, (uint8_t)(value & 1));
+  }
+}
+
+static inline void ArrowBitsAnd(const uint8_t* lhs, int64_t lhs_offset,
+                                const uint8_t* rhs, int64_t rhs_offset, int64_t length,
+                                uint8_t* out, int64_t out_offset) {
+  _ArrowBitsBinaryOp(_NANOARROW_BITS_AND, lhs, lhs_offset, rhs, rhs_offset, length, out,
+                     out_offset);
+}
+
+static inline void ArrowBitsOr(const uint8_t* lhs, int64_t lhs_offset, const uint8_t* rhs,
+                               int64_t rhs_offset, int64_t length, uint8_t* out,
+                               int64_t out_offset) {
+  _ArrowBitsBinaryOp(_NANOARROW_BITS_OR, lhs, lhs_offset, rhs, rhs_offset, length, out,
+                     out_offset);
+}
+
+static inline void ArrowBitsXor(const uint8_t* lhs, int64_t lhs_offset,
+                                const uint8_t* rhs, int64_t rhs_offset, int64_t length,
+                                uint8_t* out, int64_t out_offset) {
+  _ArrowBitsBinaryOp(_NANOARROW_BITS_XOR, lhs, lhs_offset, rhs, rhs_offset, length, out,
+                     out_offset);
+}
+
+static inline void ArrowBitsAndNot(const uint8_t* lhs, int64_t lhs_offset,
+                                   const uint8_t* rhs, int64_t rhs_offset, int64_t length,
+                                   uint8_t* out, int64_t out_offset) {
+  _ArrowBitsBinaryOp(_NANOARROW_BITS_AND_NOT, lhs, lhs_offset, rhs, rhs_offset, length,
+                     out, out_offset);
+}
+
+static inline void ArrowBitRunReaderInit(struct ArrowBitRunReader* reader,
+                                         const uint8_t* bits, int64_t start_offset,
+                                         int64_t length) {
+  reader->bits = bits;
+  reader->start_offset = start_offset;
+  reader->position = start_offset;
+  reader->end = start_offset + length;
+}
+
+static inline int64_t ArrowBitRunReaderNext(struct ArrowBitRunReader* reader,
+                                            struct ArrowBitRun* run) {
+  if (reader->position >= reader->end) {
+    return 0;
+  }
+
+  run->start = reader->position - reader->start_offset;
+
+  if (reader->bits == NULL) {
+    run->is_set = 1;
+    run->length = reader->end - reader->position;
+    reader->position = reader->end;
+    return run->length;
+  }
+
+  const uint8_t* bits = reader->bits;
+  const int8_t is_set = ArrowBitGet(bits, reader->position);
+  int64_t i = reader->position + 1;
+
+  // Whole 64-bit words, inverted if needed such that the run ends at the
+  // first zero bit
+  int64_t run_end = -1;
+  while (run_end == -1 && (i + 64) <= reader->end) {
+    uint64_t word = _ArrowBitsLoadWord(bits, i);
+    if (!is_set) {
+      word = ~word;
+    }
+
+    if (word == UINT64_MAX) {
+      i += 64;
+    } else {
+      run_end = i + _ArrowCountTrailingZerosUInt64(~word);
+    }
+  }
+
+  // Trailing bits
+  if (run_end == -1) {
+    while (i < reader->end && ArrowBitGet(bits, i) == is_set) {
+      i++;
+    }
+
+    run_end = i;
+  }
+
+  i = run_end;
+  run->is_set = is_set;
+  run->length = i - reader->position;
+  reader->position = i;
+  return run->length;
+}
+
+// Write the positions of the set bits of word (plus base) to out and return the
+// number of positions written. Sparse words are scanned one set bit at a time;
+// dense words are expanded without a branch per bit, stopping after the most
+// significant set bit such that nothing is written past the last position.
+static inline int64_t _ArrowBitsWordToIndices(uint64_t word, int64_t base, int64_t* out) {
+  if (word == UINT64_MAX) {
+    for (int64_t j = 0; j < 64; j++) {
+      out[j] = base + j;
+    }
+
+    return 64;
+  }
+
+  int64_t n = 0;
+  if (_ArrowPopcountUInt64(word) < 32) {
+    while (word != 0) {
+      out[n++] = base + _ArrowCountTrailingZerosUInt64(word);
+      word &= word - 1;
+    }
+  } else {
+    for (int64_t j = 0; word != 0; j++) {
+      out[n] = base + j;
+      n += (int64_t)(word & 1);
+      word >>= 1;
+    }
+  }
+
+  return n;
+}
+
+// The number of words converted by ArrowBitmapToIndices() above which the
+// kernel selected by ArrowBitmapToIndicesWords() is used
+#define _NANOARROW_BIT_INDICES_DISPATCH_WORDS 16
+
+static inline int64_t ArrowBitmapToIndices(const uint8_t* bits, int64_t offset,
+                                           int64_t length, int64_t* out) {
+  int64_t n = 0;
+  int64_t i = 0;
+
+  // Leading bits until the input is byte-aligned
+  for (; i < length && ((offset + i) % 8) != 0; i++) {
+    if (ArrowBitGet(bits, offset + i)) {
+      out[n++] = i;
+    }
+  }
+
+  // Long ranges use the kernel selected for the CPU at runtime
+  int64_t n_words = (length - i) / 64;
+  if (n_words >= _NANOARROW_BIT_INDICES_DISPATCH_WORDS) {
+    n += ArrowBitmapToIndicesWords(bits + (offset + i) / 8, n_words, i, out + n);
+    i += n_words * 64;
+  }
+
+  // Whole 64-bit words, skipping those with no set bits
+  for (; (i + 64) <= length; i += 64) {
+    uint64_t word = _ArrowBitsLoadWord(bits, offset + i);
+    if (word != 0) {
+      n += _ArrowBitsWordToIndices(word, i, out + n);
+    }
+  }
+
+  // Trailing bits
+  for (; i < length; i++) {
+    if (ArrowBitGet(bits, offset + i)) {
+      out[n++] = i;
+    }
+  }
+
+  return n;
+}
+
 static inline void ArrowBitmapInit(struct ArrowBitmap* bitmap) {
   ArrowBufferInit(&bitmap->buffer);
   bitmap->size_bits = 0;
@@ -583,6 +998,49 @@ static inline void ArrowBitmapAppendInt32Unsafe(struct ArrowBitmap* bitmap,
   bitmap->buffer.size_bytes = out_cursor - bitmap->buffer.data;
 }
 
+static inline ArrowErrorCode _ArrowBitmapAppendBinaryOp(
+    struct ArrowBitmap* bitmap, int op, const uint8_t* lhs, int64_t lhs_offset,
+    const uint8_t* rhs, int64_t rhs_offset, int64_t length) {
+  NANOARROW_RETURN_NOT_OK(ArrowBitmapReserve(bitmap, length));
+
+  _ArrowBitsBinaryOp(op, lhs, lhs_offset, rhs, rhs_offset, length, bitmap->buffer.data,
+                     bitmap->size_bits);
+  bitmap->size_bits += length;
+  bitmap->buffer.size_bytes = _ArrowBytesForBits(bitmap->size_bits);
+  return NANOARROW_OK;
+}
+
+static inline ArrowErrorCode ArrowBitmapAnd(struct ArrowBitmap* bitmap,
+                                            const uint8_t* lhs, int64_t lhs_offset,
+                                            const uint8_t* rhs, int64_t rhs_offset,
+                                            int64_t length) {
+  return _ArrowBitmapAppendBinaryOp(bitmap, _NANOARROW_BITS_AND, lhs, lhs_offset, rhs,
+                                    rhs_offset, length);
+}
+
+static inline ArrowErrorCode ArrowBitmapOr(struct ArrowBitmap* bitmap, const uint8_t* lhs,
+                                           int64_t lhs_offset, const uint8_t* rhs,
+                                           int64_t rhs_offset, int64_t length) {
+  return _ArrowBitmapAppendBinaryOp(bitmap, _NANOARROW_BITS_OR, lhs, lhs_offset, rhs,
+                                    rhs_offset, length);
+}
+
+static inline ArrowErrorCode ArrowBitmapXor(struct ArrowBitmap* bitmap,
+                                            const uint8_t* lhs, int64_t lhs_offset,
+                                            const uint8_t* rhs, int64_t rhs_offset,
+                                            int64_t length) {
+  return _ArrowBitmapAppendBinaryOp(bitmap, _NANOARROW_BITS_XOR, lhs, lhs_offset, rhs,
+                                    rhs_offset, length);
+}
+
+static inline ArrowErrorCode ArrowBitmapAndNot(struct ArrowBitmap* bitmap,
+                                               const uint8_t* lhs, int64_t lhs_offset,
+                                               const uint8_t* rhs, int64_t rhs_offset,
+                                               int64_t length) {
+  return _ArrowBitmapAppendBinaryOp(bitmap, _NANOARROW_BITS_AND_NOT, lhs, lhs_offset, rhs,
+                                    rhs_offset, length);
+}
+
 static inline void ArrowBitmapReset(struct ArrowBitmap* bitmap) {
   ArrowBufferReset(&bitmap->buffer);
   bitmap->size_bits = 0;
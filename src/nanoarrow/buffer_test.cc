@@ -18,6 +18,7 @@
 #include <cerrno>
 #include <cstring>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -163,6 +164,85 @@ TEST(BufferTest, BufferTestResize0) {
   ArrowBufferReset(&buffer);
 }
 
+TEST(BufferTest, BufferTestGrowthPolicy) {
+  struct ArrowBuffer buffer;
+
+  // The default is to double the capacity
+  ArrowBufferInit(&buffer);
+  EXPECT_EQ(buffer.growth_policy, NANOARROW_BUFFER_GROWTH_DOUBLE);
+  ASSERT_EQ(ArrowBufferReserve(&buffer, 100), NANOARROW_OK);
+  EXPECT_EQ(buffer.capacity_bytes, 100);
+  buffer.size_bytes = 100;
+  ASSERT_EQ(ArrowBufferReserve(&buffer, 1), NANOARROW_OK);
+  EXPECT_EQ(buffer.capacity_bytes, 200);
+  ArrowBufferReset(&buffer);
+
+  ArrowBufferInit(&buffer);
+  ArrowBufferSetGrowthPolicy(&buffer, NANOARROW_BUFFER_GROWTH_FACTOR_1_5);
+  ASSERT_EQ(ArrowBufferReserve(&buffer, 100), NANOARROW_OK);
+  EXPECT_EQ(buffer.capacity_bytes, 100);
+  buffer.size_bytes = 100;
+  ASSERT_EQ(ArrowBufferReserve(&buffer, 1), NANOARROW_OK);
+  EXPECT_EQ(buffer.capacity_bytes, 150);
+  buffer.size_bytes = 150;
+  ASSERT_EQ(ArrowBufferReserve(&buffer, 100), NANOARROW_OK);
+  EXPECT_EQ(buffer.capacity_bytes, 250);
+  ArrowBufferReset(&buffer);
+
+  ArrowBufferInit(&buffer);
+  ArrowBufferSetGrowthPolicy(&buffer, NANOARROW_BUFFER_GROWTH_PAGE_ALIGNED);
+  ASSERT_EQ(ArrowBufferReserve(&buffer, 100), NANOARROW_OK);
+  EXPECT_EQ(buffer.capacity_bytes, 4096);
+  buffer.size_bytes = 4096;
+  ASSERT_EQ(ArrowBufferReserve(&buffer, 1), NANOARROW_OK);
+  EXPECT_EQ(buffer.capacity_bytes, 8192);
+  buffer.size_bytes = 8192;
+  ASSERT_EQ(ArrowBufferReserve(&buffer, 3 << 20), NANOARROW_OK);
+  EXPECT_EQ(buffer.capacity_bytes, 4 << 20);
+
+  // The policy is preserved by a move
+  struct ArrowBuffer buffer2;
+  ArrowBufferMove(&buffer, &buffer2);
+  EXPECT_EQ(buffer2.growth_policy, NANOARROW_BUFFER_GROWTH_PAGE_ALIGNED);
+  ArrowBufferReset(&buffer2);
+
+  EXPECT_EQ(ArrowBufferReserve(&buffer2, std::numeric_limits<int64_t>::max()), ENOMEM);
+}
+
+#if defined(NANOARROW_WITH_BUFFER_STATS)
+TEST(BufferTest, BufferTestReallocationCounters) {
+  struct ArrowBuffer buffer;
+  ArrowBufferInit(&buffer);
+  EXPECT_EQ(buffer.n_reallocations, 0);
+  EXPECT_EQ(buffer.bytes_reallocated, 0);
+
+  // The first allocation is not a reallocation
+  ASSERT_EQ(ArrowBufferAppend(&buffer, "1234567", 7), NANOARROW_OK);
+  EXPECT_EQ(buffer.n_reallocations, 0);
+
+  ASSERT_EQ(ArrowBufferAppend(&buffer, "1234567", 7), NANOARROW_OK);
+  EXPECT_EQ(buffer.n_reallocations, 1);
+  EXPECT_EQ(buffer.bytes_reallocated, 7);
+
+  ASSERT_EQ(ArrowBufferResize(&buffer, 14, true), NANOARROW_OK);
+  EXPECT_EQ(buffer.n_reallocations, 2);
+  EXPECT_EQ(buffer.bytes_reallocated, 21);
+
+  // Reserving within the current capacity does not reallocate
+  ASSERT_EQ(ArrowBufferReserve(&buffer, 0), NANOARROW_OK);
+  EXPECT_EQ(buffer.n_reallocations, 2);
+
+  struct ArrowBuffer buffer2;
+  ArrowBufferMove(&buffer, &buffer2);
+  EXPECT_EQ(buffer2.n_reallocations, 2);
+
+  // Resetting a buffer resets its counters
+  ArrowBufferReset(&buffer2);
+  EXPECT_EQ(buffer2.n_reallocations, 0);
+  EXPECT_EQ(buffer2.bytes_reallocated, 0);
+}
+#endif
+
 TEST(BufferTest, BufferTestError) {
   struct ArrowBuffer buffer;
   ArrowBufferInit(&buffer);
@@ -429,6 +509,57 @@ TEST(BitmapTest, BitmapTestCountSet) {
   EXPECT_EQ(ArrowBitCountSet(bitmap, 24, 8), 0);
 }
 
+TEST(BitmapTest, BitmapTestCountSetWords) {
+  // Long enough to exercise the 64-bit word loop with arbitrary start/end offsets
+  uint8_t bitmap[67];
+  for (size_t i = 0; i < sizeof(bitmap); i++) {
+    bitmap[i] = static_cast<uint8_t>(i * 37 + 11);
+  }
+
+  for (int64_t offset = 0; offset < 19; offset++) {
+    for (int64_t length = 0; length < (int64_t)(sizeof(bitmap) * 8) - offset;
+         length += 7) {
+      int64_t expected = 0;
+      for (int64_t i = offset; i < (offset + length); i++) {
+        expected += ArrowBitGet(bitmap, i);
+      }
+
+      EXPECT_EQ(ArrowBitCountSet(bitmap, offset, length), expected);
+    }
+  }
+
+  memset(bitmap, 0xff, sizeof(bitmap));
+  EXPECT_EQ(ArrowBitCountSet(bitmap, 0, sizeof(bitmap) * 8), sizeof(bitmap) * 8);
+  EXPECT_EQ(ArrowBitCountSet(bitmap, 3, sizeof(bitmap) * 8 - 5), sizeof(bitmap) * 8 - 5);
+}
+
+TEST(BitmapTest, BitmapTestCountSetDispatch) {
+  // Long enough for ArrowBitCountSet() to use ArrowBitCountSetWords()
+  std::vector<uint8_t> bitmap(1031);
+  for (size_t i = 0; i < bitmap.size(); i++) {
+    bitmap[i] = static_cast<uint8_t>(i * 131 + (i >> 3) * 7 + 5);
+  }
+
+  int64_t expected = 0;
+  for (int64_t n_words = 0; n_words <= 128; n_words++) {
+    EXPECT_EQ(ArrowBitCountSetWords(bitmap.data() + 1, n_words), expected);
+    for (int64_t i = 0; i < 64 && n_words < 128; i++) {
+      expected += ArrowBitGet(bitmap.data() + 1, n_words * 64 + i);
+    }
+  }
+
+  for (int64_t offset : {0, 3, 17, 100}) {
+    for (int64_t length : {4000, 8000, 8248 - 100}) {
+      expected = 0;
+      for (int64_t i = offset; i < (offset + length); i++) {
+        expected += ArrowBitGet(bitmap.data(), i);
+      }
+
+      EXPECT_EQ(ArrowBitCountSet(bitmap.data(), offset, length), expected);
+    }
+  }
+}
+
 TEST(BitmapTest, BitmapTestCountSetSingleByte) {
   uint8_t bitmap = 0xff;
 
@@ -652,3 +783,264 @@ TEST(BitmapTest, BitmapTestAppendInt32Unsafe) {
 
   ArrowBitmapReset(&bitmap);
 }
+
+TEST(BitmapTest, BitmapTestPackUnpackAllBytes) {
+  // Check every possible byte value through both the unpack and pack paths
+  uint8_t bitmap[256];
+  for (int i = 0; i < 256; i++) {
+    bitmap[i] = static_cast<uint8_t>(i);
+  }
+
+  int8_t unpacked[256 * 8];
+  ArrowBitsUnpackInt8(bitmap, 0, sizeof(unpacked), unpacked);
+  for (int64_t i = 0; i < (int64_t)sizeof(unpacked); i++) {
+    ASSERT_EQ(unpacked[i], ArrowBitGet(bitmap, i));
+  }
+
+  struct ArrowBitmap packed;
+  ArrowBitmapInit(&packed);
+  ASSERT_EQ(ArrowBitmapReserve(&packed, sizeof(unpacked)), NANOARROW_OK);
+  ArrowBitmapAppendInt8Unsafe(&packed, unpacked, sizeof(unpacked));
+  EXPECT_EQ(packed.size_bits, (int64_t)sizeof(unpacked));
+  EXPECT_EQ(packed.buffer.size_bytes, (int64_t)sizeof(bitmap));
+  EXPECT_EQ(memcmp(packed.buffer.data, bitmap, sizeof(bitmap)), 0);
+  ArrowBitmapReset(&packed);
+}
+
+static uint8_t BitmapTestApplyOp(int op, uint8_t lhs, uint8_t rhs) {
+  switch (op) {
+    case 0:
+      return lhs && rhs;
+    case 1:
+      return lhs || rhs;
+    case 2:
+      return lhs != rhs;
+    default:
+      return lhs && !rhs;
+  }
+}
+
+static void BitmapTestBinaryOp(int op, const uint8_t* lhs, int64_t lhs_offset,
+                               const uint8_t* rhs, int64_t rhs_offset, int64_t length,
+                               uint8_t* out, int64_t out_offset) {
+  switch (op) {
+    case 0:
+      ArrowBitsAnd(lhs, lhs_offset, rhs, rhs_offset, length, out, out_offset);
+      break;
+    case 1:
+      ArrowBitsOr(lhs, lhs_offset, rhs, rhs_offset, length, out, out_offset);
+      break;
+    case 2:
+      ArrowBitsXor(lhs, lhs_offset, rhs, rhs_offset, length, out, out_offset);
+      break;
+    default:
+      ArrowBitsAndNot(lhs, lhs_offset, rhs, rhs_offset, length, out, out_offset);
+      break;
+  }
+}
+
+TEST(BitmapTest, BitmapTestBinaryOps) {
+  uint8_t lhs[40];
+  uint8_t rhs[40];
+  for (int i = 0; i < 40; i++) {
+    lhs[i] = static_cast<uint8_t>(i * 37 + 11);
+    rhs[i] = static_cast<uint8_t>(i * 91 + 3);
+  }
+
+  uint8_t out[48];
+  for (int op = 0; op < 4; op++) {
+    for (int64_t lhs_offset : {0, 3, 8, 13}) {
+      for (int64_t rhs_offset : {0, 1, 7, 16}) {
+        for (int64_t out_offset : {0, 5, 8, 70}) {
+          for (int64_t length : {0, 1, 7, 8, 9, 63, 64, 65, 130, 200}) {
+            memset(out, 0xaa, sizeof(out));
+            BitmapTestBinaryOp(op, lhs, lhs_offset, rhs, rhs_offset, length, out,
+                               out_offset);
+
+            for (int64_t i = 0; i < (static_cast<int64_t>(sizeof(out)) * 8); i++) {
+              if (i >= out_offset && i < (out_offset + length)) {
+                uint8_t expected =
+                    BitmapTestApplyOp(op, ArrowBitGet(lhs, lhs_offset + i - out_offset),
+                                      ArrowBitGet(rhs, rhs_offset + i - out_offset));
+                ASSERT_EQ(ArrowBitGet(out, i), expected) << "op " << op << " bit " << i;
+              } else {
+                // Bits outside the output range must not be touched
+                ASSERT_EQ(ArrowBitGet(out, i), (i % 8) % 2)
+                    << "op " << op << " bit " << i;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(BitmapTest, BitmapTestAppendBinaryOps) {
+  uint8_t lhs[] = {0xff, 0x0f, 0xf0, 0x55, 0xaa};
+  uint8_t rhs[] = {0x0f, 0x0f, 0x33, 0xff, 0x00};
+
+  struct ArrowBitmap bitmap;
+  ArrowBitmapInit(&bitmap);
+
+  ASSERT_EQ(ArrowBitmapAppend(&bitmap, 1, 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowBitmapAnd(&bitmap, lhs, 0, rhs, 0, 40), NANOARROW_OK);
+  ASSERT_EQ(ArrowBitmapOr(&bitmap, lhs, 4, rhs, 9, 20), NANOARROW_OK);
+  ASSERT_EQ(ArrowBitmapXor(&bitmap, lhs, 1, rhs, 2, 30), NANOARROW_OK);
+  ASSERT_EQ(ArrowBitmapAndNot(&bitmap, lhs, 5, rhs, 3, 10), NANOARROW_OK);
+  EXPECT_EQ(bitmap.size_bits, 103);
+  EXPECT_EQ(bitmap.buffer.size_bytes, 13);
+
+  int64_t i = 0;
+  for (; i < 3; i++) {
+    EXPECT_EQ(ArrowBitGet(bitmap.buffer.data, i), 1);
+  }
+
+  for (int64_t j = 0; j < 40; j++, i++) {
+    EXPECT_EQ(ArrowBitGet(bitmap.buffer.data, i),
+              ArrowBitGet(lhs, j) && ArrowBitGet(rhs, j));
+  }
+
+  for (int64_t j = 0; j < 20; j++, i++) {
+    EXPECT_EQ(ArrowBitGet(bitmap.buffer.data, i),
+              ArrowBitGet(lhs, 4 + j) || ArrowBitGet(rhs, 9 + j));
+  }
+
+  for (int64_t j = 0; j < 30; j++, i++) {
+    EXPECT_EQ(ArrowBitGet(bitmap.buffer.data, i),
+              ArrowBitGet(lhs, 1 + j) != ArrowBitGet(rhs, 2 + j));
+  }
+
+  for (int64_t j = 0; j < 10; j++, i++) {
+    EXPECT_EQ(ArrowBitGet(bitmap.buffer.data, i),
+              ArrowBitGet(lhs, 5 + j) && !ArrowBitGet(rhs, 3 + j));
+  }
+
+  ArrowBitmapReset(&bitmap);
+}
+
+static void BitmapTestCheckRuns(const uint8_t* bits, int64_t start_offset,
+                                int64_t length) {
+  struct ArrowBitRunReader reader;
+  struct ArrowBitRun run;
+  ArrowBitRunReaderInit(&reader, bits, start_offset, length);
+
+  int64_t i = 0;
+  int8_t last_is_set = -1;
+  while (ArrowBitRunReaderNext(&reader, &run) > 0) {
+    ASSERT_EQ(run.start, i);
+    ASSERT_GT(run.length, 0);
+    // Consecutive runs must alternate
+    ASSERT_NE(run.is_set, last_is_set);
+    for (int64_t j = 0; j < run.length; j++) {
+      ASSERT_EQ(ArrowBitGet(bits, start_offset + i + j), run.is_set);
+    }
+
+    i += run.length;
+    last_is_set = run.is_set;
+  }
+
+  EXPECT_EQ(i, length);
+  EXPECT_EQ(ArrowBitRunReaderNext(&reader, &run), 0);
+}
+
+TEST(BitmapTest, BitmapTestBitRunReader) {
+  uint8_t bits[48];
+
+  // Mixed short runs
+  for (int i = 0; i < 48; i++) {
+    bits[i] = static_cast<uint8_t>(i * 37 + 11);
+  }
+
+  for (int64_t start_offset : {0, 1, 7, 8, 13}) {
+    for (int64_t length : {0, 1, 7, 63, 64, 65, 200, 300}) {
+      BitmapTestCheckRuns(bits, start_offset, length);
+    }
+  }
+
+  // Long runs that span several words
+  memset(bits, 0xff, sizeof(bits));
+  memset(bits + 10, 0x00, 20);
+  bits[35] = 0xf7;
+  for (int64_t start_offset : {0, 3, 80}) {
+    for (int64_t length : {1, 64, 200, 300}) {
+      BitmapTestCheckRuns(bits, start_offset, length);
+    }
+  }
+
+  struct ArrowBitRunReader reader;
+  struct ArrowBitRun run;
+  ArrowBitRunReaderInit(&reader, bits, 0, 384);
+  ASSERT_EQ(ArrowBitRunReaderNext(&reader, &run), 80);
+  EXPECT_EQ(run.start, 0);
+  EXPECT_EQ(run.is_set, 1);
+  ASSERT_EQ(ArrowBitRunReaderNext(&reader, &run), 160);
+  EXPECT_EQ(run.start, 80);
+  EXPECT_EQ(run.is_set, 0);
+  ASSERT_EQ(ArrowBitRunReaderNext(&reader, &run), 43);
+  EXPECT_EQ(run.start, 240);
+  EXPECT_EQ(run.is_set, 1);
+  ASSERT_EQ(ArrowBitRunReaderNext(&reader, &run), 1);
+  EXPECT_EQ(run.start, 283);
+  EXPECT_EQ(run.is_set, 0);
+  ASSERT_EQ(ArrowBitRunReaderNext(&reader, &run), 100);
+  EXPECT_EQ(run.start, 284);
+  EXPECT_EQ(run.is_set, 1);
+  EXPECT_EQ(ArrowBitRunReaderNext(&reader, &run), 0);
+
+  // A NULL bitmap is a single run of set bits
+  ArrowBitRunReaderInit(&reader, nullptr, 5, 1000);
+  ASSERT_EQ(ArrowBitRunReaderNext(&reader, &run), 1000);
+  EXPECT_EQ(run.start, 0);
+  EXPECT_EQ(run.is_set, 1);
+  EXPECT_EQ(ArrowBitRunReaderNext(&reader, &run), 0);
+}
+
+static void BitmapTestCheckIndices(const uint8_t* bits, int64_t offset, int64_t length) {
+  std::vector<int64_t> expected;
+  for (int64_t i = 0; i < length; i++) {
+    if (ArrowBitGet(bits, offset + i)) {
+      expected.push_back(i);
+    }
+  }
+
+  // Sized exactly such that writing past the last position is caught by ASan
+  std::vector<int64_t> actual(expected.size());
+  ASSERT_EQ(ArrowBitmapToIndices(bits, offset, length, actual.data()),
+            static_cast<int64_t>(expected.size()));
+  EXPECT_EQ(actual, expected);
+}
+
+TEST(BitmapTest, BitmapTestToIndices) {
+  // Sparse, dense, empty, and full words, long enough to use
+  // ArrowBitmapToIndicesWords()
+  std::vector<uint8_t> bits(2048);
+  for (size_t i = 0; i < bits.size(); i++) {
+    switch ((i / 8) % 4) {
+      case 0:
+        bits[i] = static_cast<uint8_t>((i * 37 + 11) & (i * 13));
+        break;
+      case 1:
+        bits[i] = static_cast<uint8_t>(~(i * 37 + 11));
+        break;
+      case 2:
+        bits[i] = 0;
+        break;
+      default:
+        bits[i] = 0xff;
+        break;
+    }
+  }
+
+  for (int64_t offset : {0, 1, 7, 8, 13}) {
+    for (int64_t length : {0, 1, 7, 63, 64, 65, 200, 2000, 16000}) {
+      BitmapTestCheckIndices(bits.data(), offset, length);
+    }
+  }
+
+  std::vector<int64_t> out(64);
+  EXPECT_EQ(ArrowBitmapToIndicesWords(bits.data() + 24, 1, 100, out.data()), 64);
+  EXPECT_EQ(out[0], 100);
+  EXPECT_EQ(out[63], 163);
+  EXPECT_EQ(ArrowBitmapToIndicesWords(bits.data() + 16, 1, 100, out.data()), 0);
+}
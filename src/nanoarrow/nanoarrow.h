@@ -39,6 +39,14 @@
 #define ArrowNanoarrowVersionInt \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowNanoarrowVersionInt)
 #define ArrowErrorMessage NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowErrorMessage)
+#define ArrowTraceSetCallback \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowTraceSetCallback)
+#define ArrowTrace NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowTrace)
+#define ArrowCpuFeatures NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowCpuFeatures)
+#define ArrowBitCountSetWords \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBitCountSetWords)
+#define ArrowBitmapToIndicesWords \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBitmapToIndicesWords)
 #define ArrowMalloc NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowMalloc)
 #define ArrowRealloc NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowRealloc)
 #define ArrowFree NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowFree)
@@ -46,8 +54,36 @@
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBufferAllocatorDefault)
 #define ArrowBufferDeallocator \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBufferDeallocator)
+#define ArrowBufferAllocatorAligned \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBufferAllocatorAligned)
+#define ArrowBufferAllocatorHugePages \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBufferAllocatorHugePages)
+#define ArrowBufferAllocatorTrackerInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBufferAllocatorTrackerInit)
+#define ArrowBufferAllocatorTracking \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBufferAllocatorTracking)
+#define ArrowBufferAllocatorArenaInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBufferAllocatorArenaInit)
+#define ArrowBufferAllocatorArenaRelease \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBufferAllocatorArenaRelease)
+#define ArrowBufferPoolIsThreadSafe \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBufferPoolIsThreadSafe)
+#define ArrowBufferAllocatorPoolInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBufferAllocatorPoolInit)
+#define ArrowBufferAllocatorPoolStats \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBufferAllocatorPoolStats)
+#define ArrowBufferAllocatorPoolTrim \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBufferAllocatorPoolTrim)
+#define ArrowBufferAllocatorPoolRelease \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBufferAllocatorPoolRelease)
 #define ArrowErrorSet NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowErrorSet)
 #define ArrowLayoutInit NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowLayoutInit)
+#define ArrowDecimalSetDigits NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDecimalSetDigits)
+#define ArrowDecimalSetString NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDecimalSetString)
+#define ArrowDecimalAppendDigitsToBuffer \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDecimalAppendDigitsToBuffer)
+#define ArrowDecimalAppendStringToBuffer \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDecimalAppendStringToBuffer)
 #define ArrowSchemaInit NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaInit)
 #define ArrowSchemaInitFromType \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaInitFromType)
@@ -62,11 +98,20 @@
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaSetTypeDateTime)
 #define ArrowSchemaSetTypeUnion \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaSetTypeUnion)
+#define ArrowSchemaSetTypeRunEndEncoded \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaSetTypeRunEndEncoded)
 #define ArrowSchemaDeepCopy NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaDeepCopy)
+#define ArrowSchemaShare NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaShare)
 #define ArrowSchemaSetFormat NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaSetFormat)
 #define ArrowSchemaSetName NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaSetName)
 #define ArrowSchemaSetMetadata \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaSetMetadata)
+#define ArrowSchemaSetFormatStatic \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaSetFormatStatic)
+#define ArrowSchemaSetNameStatic \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaSetNameStatic)
+#define ArrowSchemaSetMetadataStatic \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaSetMetadataStatic)
 #define ArrowSchemaAllocateChildren \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaAllocateChildren)
 #define ArrowSchemaAllocateDictionary \
@@ -86,8 +131,46 @@
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowMetadataBuilderSet)
 #define ArrowMetadataBuilderRemove \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowMetadataBuilderRemove)
+#define ArrowMetadataBuilderSetMany \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowMetadataBuilderSetMany)
+#define ArrowMetadataIndexInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowMetadataIndexInit)
+#define ArrowMetadataIndexReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowMetadataIndexReset)
+#define ArrowMetadataIndexGetValue \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowMetadataIndexGetValue)
+#define ArrowMetadataIndexHasKey \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowMetadataIndexHasKey)
 #define ArrowSchemaViewInit NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaViewInit)
+#define ArrowSchemaViewInitWithRegistry \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaViewInitWithRegistry)
+#define ArrowExtensionRegistryInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowExtensionRegistryInit)
+#define ArrowExtensionRegistryReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowExtensionRegistryReset)
+#define ArrowExtensionRegistryRegister \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowExtensionRegistryRegister)
+#define ArrowExtensionRegistryFind \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowExtensionRegistryFind)
+#define ArrowExtensionRegistryName \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowExtensionRegistryName)
 #define ArrowSchemaToString NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaToString)
+#define ArrowSchemaToStringBuffer \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaToStringBuffer)
+#define ArrowSchemaEquals NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaEquals)
+#define ArrowSchemaFingerprint \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaFingerprint)
+#define ArrowSchemaFieldIndexInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaFieldIndexInit)
+#define ArrowSchemaFieldIndexReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaFieldIndexReset)
+#define ArrowSchemaFieldIndexFind \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaFieldIndexFind)
+#define ArrowSchemaProjectionInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaProjectionInit)
+#define ArrowSchemaProjectionReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaProjectionReset)
+#define ArrowSchemaProject NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaProject)
 #define ArrowArrayInitFromType \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayInitFromType)
 #define ArrowArrayInitFromSchema \
@@ -103,15 +186,58 @@
 #define ArrowArraySetValidityBitmap \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArraySetValidityBitmap)
 #define ArrowArraySetBuffer NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArraySetBuffer)
+#define ArrowArraySetFixedSizeListValues \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArraySetFixedSizeListValues)
+#define ArrowArraySetAllocator \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArraySetAllocator)
 #define ArrowArrayReserve NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayReserve)
+#define ArrowArrayReserveShape \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayReserveShape)
+#define ArrowArrayGetBuildStats \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayGetBuildStats)
+#define ArrowArrayCapacityHintUpdate \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayCapacityHintUpdate)
+#define ArrowArrayReserveFromHint \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayReserveFromHint)
+#define ArrowArrayAppendArrayView \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayAppendArrayView)
+#define ArrowArrayAppendTake NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayAppendTake)
+#define ArrowArrayAppendFilter \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayAppendFilter)
+#define ArrowArrayAppendRecords \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayAppendRecords)
+#define ArrowArrayConcatenate NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayConcatenate)
+#define ArrowArraySlice NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArraySlice)
+#define ArrowArrayViewDeepCopy \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewDeepCopy)
+#define ArrowArrayViewParallelFor \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewParallelFor)
+#define ArrowArraySliceIsThreadSafe \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArraySliceIsThreadSafe)
+#define ArrowArrayWriteRelocatable \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayWriteRelocatable)
+#define ArrowArrayReadRelocatable \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayReadRelocatable)
+#define ArrowArrayProject NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayProject)
 #define ArrowArrayFinishBuilding \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayFinishBuilding)
 #define ArrowArrayFinishBuildingDefault \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayFinishBuildingDefault)
+#define ArrowArrayShrinkToFit NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayShrinkToFit)
+#define ArrowArrayFinishBuildingNarrow \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayFinishBuildingNarrow)
+#define ArrowArrayResetForReuse \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayResetForReuse)
 #define ArrowArrayViewInitFromType \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewInitFromType)
 #define ArrowArrayViewInitFromSchema \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewInitFromSchema)
+#define ArrowSchemaLayoutInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaLayoutInit)
+#define ArrowSchemaLayoutReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaLayoutReset)
+#define ArrowArrayViewInitFromSchemaLayout \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewInitFromSchemaLayout)
 #define ArrowArrayViewAllocateChildren \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewAllocateChildren)
 #define ArrowArrayViewAllocateDictionary \
@@ -124,13 +250,119 @@
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewSetArrayMinimal)
 #define ArrowArrayViewValidate \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewValidate)
+#define ArrowArrayViewHash NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewHash)
+#define ArrowArrayViewComputeStatistics \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewComputeStatistics)
+#define ArrowBloomFilterInit NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBloomFilterInit)
+#define ArrowBloomFilterInsert \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBloomFilterInsert)
+#define ArrowBloomFilterMightContain \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBloomFilterMightContain)
+#define ArrowBloomFilterReset NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBloomFilterReset)
+#define ArrowBatchSummaryInit NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBatchSummaryInit)
+#define ArrowBatchSummaryMightContain \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBatchSummaryMightContain)
+#define ArrowBatchSummarySerialize \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBatchSummarySerialize)
+#define ArrowBatchSummaryDeserialize \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBatchSummaryDeserialize)
+#define ArrowBatchSummaryReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBatchSummaryReset)
+#define ArrowArrayViewDecodeDictionary \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewDecodeDictionary)
+#define ArrowArrayViewCast NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewCast)
+#define ArrowArrayViewTemporalTruncate \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewTemporalTruncate)
+#define ArrowArrayViewSortIndices \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewSortIndices)
+#define ArrowArrayViewFenceInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewFenceInit)
+#define ArrowArrayViewFenceReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewFenceReset)
+#define ArrowArrayViewLowerBound \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewLowerBound)
+#define ArrowArrayViewUpperBound \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewUpperBound)
+#define ArrowGrouperInit NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowGrouperInit)
+#define ArrowGrouperConsume NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowGrouperConsume)
+#define ArrowGrouperGetKeys NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowGrouperGetKeys)
+#define ArrowGrouperReset NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowGrouperReset)
+#define ArrowGroupedAggregateInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowGroupedAggregateInit)
+#define ArrowGroupedAggregateUpdate \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowGroupedAggregateUpdate)
+#define ArrowGroupedAggregateFinish \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowGroupedAggregateFinish)
+#define ArrowGroupedAggregateReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowGroupedAggregateReset)
+#define ArrowArrayViewMatchStrings \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewMatchStrings)
+#define ArrowArrayViewListLengths \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewListLengths)
+#define ArrowArrayViewListParentIds \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewListParentIds)
+#define ArrowArrayViewListFlatten \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewListFlatten)
+#define ArrowArrayViewUnionSelect \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewUnionSelect)
+#define ArrowArrayViewMapLookup \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewMapLookup)
+#define ArrowArrayViewRunEndEncode \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewRunEndEncode)
+#define ArrowArrayViewRunEndDecode \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewRunEndDecode)
 #define ArrowArrayViewReset NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewReset)
+#define ArrowArrayViewEquals NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewEquals)
+#define ArrowChunkedArrayViewInitFromSchema \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowChunkedArrayViewInitFromSchema)
+#define ArrowChunkedArrayViewAppendArray \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowChunkedArrayViewAppendArray)
+#define ArrowChunkedArrayViewReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowChunkedArrayViewReset)
+#define ArrowDictionaryBuilderInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDictionaryBuilderInit)
+#define ArrowDictionaryBuilderAppendInt \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDictionaryBuilderAppendInt)
+#define ArrowDictionaryBuilderAppendUInt \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDictionaryBuilderAppendUInt)
+#define ArrowDictionaryBuilderAppendDouble \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDictionaryBuilderAppendDouble)
+#define ArrowDictionaryBuilderAppendBytes \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDictionaryBuilderAppendBytes)
+#define ArrowDictionaryBuilderAppendString \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDictionaryBuilderAppendString)
+#define ArrowDictionaryBuilderAppendNull \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDictionaryBuilderAppendNull)
+#define ArrowDictionaryBuilderAppendArrayView \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDictionaryBuilderAppendArrayView)
+#define ArrowDictionaryBuilderReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDictionaryBuilderReset)
 #define ArrowBasicArrayStreamInit \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBasicArrayStreamInit)
 #define ArrowBasicArrayStreamSetArray \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBasicArrayStreamSetArray)
+#define ArrowBasicArrayStreamSetShareSchema \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBasicArrayStreamSetShareSchema)
 #define ArrowBasicArrayStreamValidate \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBasicArrayStreamValidate)
+#define ArrowRebatchArrayStreamInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowRebatchArrayStreamInit)
+#define ArrowInstrumentedArrayStreamInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowInstrumentedArrayStreamInit)
+#define ArrowInstrumentedArrayStreamGetStats \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowInstrumentedArrayStreamGetStats)
+#define ArrowSpillingArrayStreamInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSpillingArrayStreamInit)
+#define ArrowSpillingArrayStreamPush \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSpillingArrayStreamPush)
+#define ArrowSpillingArrayStreamFinish \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSpillingArrayStreamFinish)
+#define ArrowSpillingArrayStreamGetStats \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSpillingArrayStreamGetStats)
+#define ArrowArrayStreamToAsync \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayStreamToAsync)
+#define ArrowArrayStreamInitFromAsync \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayStreamInitFromAsync)
 
 #endif
 
@@ -171,6 +403,93 @@ void ArrowFree(void* ptr);
 /// ArrowFree().
 struct ArrowBufferAllocator ArrowBufferAllocatorDefault(void);
 
+/// \brief Return an allocator that aligns and pads allocations
+///
+/// Returns an allocator whose allocations begin at a multiple of alignment
+/// bytes and whose capacity is padded to a multiple of alignment bytes (with
+/// the padding zeroed). alignment is rounded up to the next power of two
+/// that is at least sizeof(void*); 64 matches the recommendation of the
+/// Arrow columnar format. Reallocation always preserves the alignment.
+struct ArrowBufferAllocator ArrowBufferAllocatorAligned(int64_t alignment);
+
+/// \brief Return an allocator that maps large allocations using huge pages
+///
+/// Allocations of at least threshold_bytes are made using an anonymous
+/// mmap() that is advised to use transparent huge pages (MADV_HUGEPAGE) and
+/// are grown using mremap(), which avoids copying when the mapping can be
+/// extended. Smaller allocations use ArrowMalloc(). This is useful for very
+/// large buffers that will be scanned repeatedly. On platforms other than
+/// Linux this returns ArrowBufferAllocatorDefault().
+struct ArrowBufferAllocator ArrowBufferAllocatorHugePages(int64_t threshold_bytes);
+
+/// \brief Initialize an arena allocator
+///
+/// Creates an allocator that carves 64-byte aligned allocations out of chunks
+/// of at least chunk_size bytes. The most recent allocation is grown or shrunk
+/// in place when possible; all other reallocations copy into new space and
+/// the space they previously occupied is not reused until the arena is
+/// released. The arena is reference counted: the caller holds one reference
+/// that must be released using ArrowBufferAllocatorArenaRelease() and each
+/// live allocation holds another, such that all chunks are freed at once when
+/// the caller has released its reference and the last buffer allocated from
+/// the arena has been freed (e.g., when the last array whose buffers were
+/// allocated using it is released). Buffers that have not yet allocated do
+/// not hold a reference, so the caller's reference should only be released
+/// when no further allocations will be made (e.g., after
+/// ArrowArrayFinishBuilding()). The arena is not thread safe: buffers
+/// allocated from it must not be reallocated or freed concurrently.
+ArrowErrorCode ArrowBufferAllocatorArenaInit(struct ArrowBufferAllocator* allocator,
+                                             int64_t chunk_size);
+
+/// \brief Release the caller's reference to an arena allocator
+void ArrowBufferAllocatorArenaRelease(struct ArrowBufferAllocator* allocator);
+
+/// \brief Initialize a buffer pool allocator
+///
+/// Creates an allocator that rounds allocations up to a power-of-two size
+/// class and, when a buffer is freed, retains its block for reuse by the next
+/// allocation of the same size class (e.g., by the next batch of a stream
+/// whose batches have a similar shape). At most max_bytes_retained bytes are
+/// held in blocks that are not in use. Like the arena allocator, the pool is
+/// reference counted: the caller's reference must be released using
+/// ArrowBufferAllocatorPoolRelease() and the pool is destroyed when the last
+/// buffer allocated from it is freed. The pool is thread safe if
+/// ArrowBufferPoolIsThreadSafe() returns non-zero.
+ArrowErrorCode ArrowBufferAllocatorPoolInit(struct ArrowBufferAllocator* allocator,
+                                            int64_t max_bytes_retained);
+
+/// \brief Check for thread safety of the buffer pool allocator
+///
+/// A thread safe buffer pool requires C11 and the stdatomic.h header.
+int ArrowBufferPoolIsThreadSafe(void);
+
+/// \brief Get usage statistics for a buffer pool allocator
+void ArrowBufferAllocatorPoolStats(struct ArrowBufferAllocator* allocator,
+                                   struct ArrowBufferPoolStats* out);
+
+/// \brief Free all blocks retained by a buffer pool allocator that are not in use
+void ArrowBufferAllocatorPoolTrim(struct ArrowBufferAllocator* allocator);
+
+/// \brief Release the caller's reference to a buffer pool allocator
+void ArrowBufferAllocatorPoolRelease(struct ArrowBufferAllocator* allocator);
+
+/// \brief Initialize a tracker that records the usage of an allocator
+///
+/// Resets all counters of tracker and sets the allocator to which requests
+/// made using ArrowBufferAllocatorTracking() will be forwarded.
+void ArrowBufferAllocatorTrackerInit(struct ArrowBufferAllocatorTracker* tracker,
+                                     struct ArrowBufferAllocator allocator);
+
+/// \brief Return an allocator that records its usage in a tracker
+///
+/// Requests are forwarded to tracker->allocator and counted in tracker, which
+/// must outlive any buffer allocated with the returned allocator. Usage can
+/// be recorded per tag by using one tracker per tag; trackers can be nested
+/// (e.g., by initializing each tag's tracker with the allocator of a shared
+/// tracker) to record a total at the same time. Trackers are not thread safe.
+struct ArrowBufferAllocator ArrowBufferAllocatorTracking(
+    struct ArrowBufferAllocatorTracker* tracker);
+
 /// \brief Create a custom deallocator
 ///
 /// Creates a buffer allocator with only a free method that can be used to
@@ -231,6 +550,76 @@ const char* ArrowErrorMessage(struct ArrowError* error);
 
 /// @}
 
+/// \defgroup nanoarrow-trace Tracing
+///
+/// When nanoarrow is configured with NANOARROW_WITH_TRACE (i.e., the CMake option
+/// of the same name, which defines it in nanoarrow_config.h), a callback registered
+/// with ArrowTraceSetCallback() is called at key points in the library such that
+/// time and memory can be attributed to nanoarrow operations in a production build.
+/// Otherwise, trace points compile to nothing.
+///
+/// @{
+
+/// \brief Points in the library at which a trace callback is called
+///
+/// Each *_BEGIN event is followed by the matching *_END event (whose arg0 is the
+/// return code of the operation) on the same thread.
+enum ArrowTraceEvent {
+  /// \brief A buffer was reallocated (arg0: old capacity, arg1: new capacity in bytes)
+  NANOARROW_TRACE_BUFFER_REALLOCATE = 0,
+  /// \brief ArrowArrayFinishBuilding() (arg0: validation level, arg1: length)
+  NANOARROW_TRACE_ARRAY_FINISH_BUILDING_BEGIN,
+  NANOARROW_TRACE_ARRAY_FINISH_BUILDING_END,
+  /// \brief ArrowArrayViewSetArray() (arg0: array length)
+  NANOARROW_TRACE_ARRAY_VIEW_SET_ARRAY_BEGIN,
+  NANOARROW_TRACE_ARRAY_VIEW_SET_ARRAY_END,
+  /// \brief Decoding an IPC message header (arg0: size of the data in bytes)
+  NANOARROW_TRACE_IPC_DECODE_HEADER_BEGIN,
+  NANOARROW_TRACE_IPC_DECODE_HEADER_END,
+  /// \brief Decoding an IPC Schema message
+  NANOARROW_TRACE_IPC_DECODE_SCHEMA_BEGIN,
+  NANOARROW_TRACE_IPC_DECODE_SCHEMA_END,
+  /// \brief Setting array views from an IPC message body (arg0: body size in bytes)
+  NANOARROW_TRACE_IPC_DECODE_ARRAY_VIEW_BEGIN,
+  NANOARROW_TRACE_IPC_DECODE_ARRAY_VIEW_END,
+  /// \brief Validating array views decoded from IPC (arg0: validation level)
+  NANOARROW_TRACE_IPC_VALIDATE_BEGIN,
+  NANOARROW_TRACE_IPC_VALIDATE_END,
+  /// \brief Building arrays from array views decoded from IPC
+  NANOARROW_TRACE_IPC_DECODE_ARRAY_BEGIN,
+  NANOARROW_TRACE_IPC_DECODE_ARRAY_END
+};
+
+/// \brief A function called for each trace event
+typedef void (*ArrowTraceCallback)(enum ArrowTraceEvent event, int64_t arg0,
+                                   int64_t arg1, void* private_data);
+
+/// \brief Set the function called for each trace event
+///
+/// Pass NULL to remove a callback. This function is only thread safe when nanoarrow is
+/// compiled with C11 atomics; otherwise, it should be called before any other nanoarrow
+/// function (e.g., at startup). Trace events on other threads may still call the
+/// previous callback (with its private_data) after this function returns. Has no
+/// effect unless NANOARROW_WITH_TRACE is defined.
+void ArrowTraceSetCallback(ArrowTraceCallback callback, void* private_data);
+
+/// \brief Call the registered trace callback, if any
+///
+/// Use NANOARROW_TRACE() rather than calling this function directly.
+void ArrowTrace(enum ArrowTraceEvent event, int64_t arg0, int64_t arg1);
+
+/// \brief Emit a trace event if nanoarrow was configured with NANOARROW_WITH_TRACE
+///
+/// The arguments are not evaluated otherwise.
+#if defined(NANOARROW_WITH_TRACE)
+#define NANOARROW_TRACE(EVENT, ARG0, ARG1) \
+  ArrowTrace((EVENT), (int64_t)(ARG0), (int64_t)(ARG1))
+#else
+#define NANOARROW_TRACE(EVENT, ARG0, ARG1)
+#endif
+
+/// @}
+
 /// \defgroup nanoarrow-utils Utility data structures
 ///
 /// @{
@@ -241,12 +630,55 @@ const char* ArrowNanoarrowVersion(void);
 /// \brief Return an integer that can be used to compare versions sequentially
 int ArrowNanoarrowVersionInt(void);
 
+/// \brief Return the features of the CPU used to select kernels
+///
+/// Returns a combination of enum ArrowCpuFeature values, detected on first use
+/// (e.g., using __builtin_cpu_supports() on x86 or getauxval() on Linux ARM64).
+/// Compile with -DNANOARROW_CPU_FEATURES=<value> to skip detection and use a fixed
+/// set of features instead (e.g., 0 to always use portable kernels). Detection is
+/// only implemented for GCC and Clang; other compilers report no features.
+int ArrowCpuFeatures(void);
+
 /// \brief Initialize a description of buffer arrangements from a storage type
 void ArrowLayoutInit(struct ArrowLayout* layout, enum ArrowType storage_type);
 
 /// \brief Create a string view from a null-terminated string
 static inline struct ArrowStringView ArrowCharView(const char* value);
 
+/// \brief Set the unscaled value of a decimal from a string of digits
+///
+/// value must consist of an optional leading '-' or '+' followed by one or more
+/// decimal digits; leading zeros do not count towards the precision of decimal.
+/// Returns EINVAL if value is not a valid integer or EOVERFLOW if it has more
+/// significant digits than the precision of decimal (or does not fit in its
+/// bitwidth). decimal is unchanged if an error is returned.
+ArrowErrorCode ArrowDecimalSetDigits(struct ArrowDecimal* decimal,
+                                     struct ArrowStringView value);
+
+/// \brief Set the value of a decimal from a string with an optional decimal point
+///
+/// Like ArrowDecimalSetDigits() except value may contain a decimal point (e.g.,
+/// "-123.45") and is rescaled to the scale of decimal (e.g., to an unscaled value
+/// of -1234500 for a scale of 4). Values are never rounded: EINVAL is returned if
+/// rescaling would discard non-zero digits.
+ArrowErrorCode ArrowDecimalSetString(struct ArrowDecimal* decimal,
+                                     struct ArrowStringView value);
+
+/// \brief Append the unscaled value of a decimal to a buffer as a string of digits
+///
+/// Writes the digits without leading zeros (i.e., "0" for zero) and preceded by '-'
+/// for negative values. Returns ENOMEM if buffer could not be reserved.
+ArrowErrorCode ArrowDecimalAppendDigitsToBuffer(struct ArrowDecimal* decimal,
+                                                struct ArrowBuffer* buffer);
+
+/// \brief Append the value of a decimal to a buffer as a string
+///
+/// Like ArrowDecimalAppendDigitsToBuffer() except the value is formatted according
+/// to the scale of decimal (e.g., "-0.05" for an unscaled value of -5 and a scale
+/// of 2 or "500" for an unscaled value of 5 and a scale of -2).
+ArrowErrorCode ArrowDecimalAppendStringToBuffer(struct ArrowDecimal* decimal,
+                                                struct ArrowBuffer* buffer);
+
 /// @}
 
 /// \defgroup nanoarrow-schema Creating schemas
@@ -279,6 +711,133 @@ ArrowErrorCode ArrowSchemaInitFromType(struct ArrowSchema* schema, enum ArrowTyp
 int64_t ArrowSchemaToString(struct ArrowSchema* schema, char* out, int64_t n,
                             char recursive);
 
+/// \brief Append a human-readable summary of a Schema to a buffer
+///
+/// Appends the summary written by ArrowSchemaToString() in a single pass, growing
+/// buffer as needed such that a reused buffer only allocates when a summary is longer
+/// than any previous one. Children nested more than max_depth levels below schema are
+/// summarized as "<...>" (e.g., a max_depth of 0 only summarizes schema itself); pass
+/// -1 to include all descendants. After a successful call, buffer->data is terminated
+/// with a null character that is not included in buffer->size_bytes.
+ArrowErrorCode ArrowSchemaToStringBuffer(struct ArrowSchema* schema,
+                                         struct ArrowBuffer* buffer, int64_t max_depth);
+
+/// \brief Check two schemas for equality
+///
+/// Returns non-zero if lhs and rhs have the same format, name, flags, and metadata
+/// and their children and dictionaries (if any) are recursively equal. A NULL name is
+/// considered equal to an empty name and NULL metadata is considered equal to metadata
+/// with zero key/value pairs; otherwise, metadata is compared byte-wise (i.e., key/value
+/// pairs must be in the same order). Names and/or metadata can be excluded from the
+/// comparison by passing a combination of enum ArrowSchemaCompareOptions values.
+int ArrowSchemaEquals(const struct ArrowSchema* lhs, const struct ArrowSchema* rhs,
+                      int options);
+
+/// \brief Compute a 64-bit fingerprint of a schema
+///
+/// Computes a hash of the fields compared by ArrowSchemaEquals() in a single pass
+/// over the schema tree such that schemas that are equal with the same options have
+/// the same fingerprint. This is useful as a fast path (e.g., as a cache key) before
+/// falling back to ArrowSchemaEquals(). The fingerprint does not depend on any
+/// addresses and is stable across processes on platforms with the same byte order.
+uint64_t ArrowSchemaFingerprint(const struct ArrowSchema* schema, int options);
+
+/// \brief An index of the nested fields of a schema by path
+///
+/// Every descendant of a schema (excluding dictionaries) is assigned a field index
+/// according to a depth-first walk of its children, which matches the flattened
+/// field index used by ArrowIpcArrayStreamReaderOptions. The path of a field is the
+/// names of it and its ancestors (excluding the root) joined by "." (e.g., "a.b.c"),
+/// where a NULL name is treated as an empty name. Initialize using
+/// ArrowSchemaFieldIndexInit() and release using ArrowSchemaFieldIndexReset(). The
+/// fields member is only valid for the lifetime of the indexed schema.
+struct ArrowSchemaFieldIndex {
+  /// \brief The number of fields
+  int64_t n_fields;
+
+  /// \brief The full path of each field
+  struct ArrowStringView* paths;
+
+  /// \brief A pointer to each field within the indexed schema
+  struct ArrowSchema** fields;
+
+  /// \brief The field index of the parent of each field or -1 for top-level fields
+  int64_t* parents;
+
+  /// \brief The number of slots in the hash table (a power of two)
+  int64_t n_slots;
+
+  /// \brief The hash table of field indices, where empty slots are -1
+  int64_t* slots;
+
+  /// \brief The characters of all paths
+  char* path_data;
+};
+
+/// \brief Initialize an ArrowSchemaFieldIndex
+///
+/// Walks schema once to compute the path of every field and index them by path. On
+/// success, the caller is responsible for calling ArrowSchemaFieldIndexReset().
+ArrowErrorCode ArrowSchemaFieldIndexInit(struct ArrowSchemaFieldIndex* index,
+                                         struct ArrowSchema* schema,
+                                         struct ArrowError* error);
+
+/// \brief Release the memory held by an ArrowSchemaFieldIndex
+void ArrowSchemaFieldIndexReset(struct ArrowSchemaFieldIndex* index);
+
+/// \brief Find the field index of a path
+///
+/// Returns the index of the first field whose full path is path or -1 if there is
+/// no such field.
+int64_t ArrowSchemaFieldIndexFind(const struct ArrowSchemaFieldIndex* index,
+                                  struct ArrowStringView path);
+
+/// \brief A selection of nested fields from a struct schema
+///
+/// The nodes of the projected tree are stored in depth-first order starting with
+/// the root. Each node refers to a child of the corresponding node of the source by
+/// position and either keeps all of its descendants (n_children of -1) or is a struct
+/// whose selected children are the next n_children subtrees. Initialize using
+/// ArrowSchemaProjectionInit() and release using ArrowSchemaProjectionReset(). A
+/// projection can be applied to any number of schemas or arrays of the same type
+/// using ArrowSchemaProject() and ArrowArrayProject().
+struct ArrowSchemaProjection {
+  /// \brief The number of nodes in the projected tree
+  int64_t n_nodes;
+
+  /// \brief The position of each node among the children of its source parent or -1
+  /// for the root
+  int64_t* child_index;
+
+  /// \brief The number of selected children of each node or -1 to keep all children
+  int64_t* n_children;
+};
+
+/// \brief Initialize an ArrowSchemaProjection from a list of field paths
+///
+/// Each of the n paths is the full path of a field as defined by
+/// ArrowSchemaFieldIndex (e.g., "a.b"). A selected field keeps all of its
+/// descendants and its ancestors keep only the children required to reach a selected
+/// field. Children are ordered by the first path that refers to them. Returns EINVAL
+/// if a path does not exist or if a field whose children would be pruned is not a
+/// struct. On success, the caller is responsible for calling
+/// ArrowSchemaProjectionReset().
+ArrowErrorCode ArrowSchemaProjectionInit(struct ArrowSchemaProjection* projection,
+                                         struct ArrowSchema* schema,
+                                         const struct ArrowStringView* paths, int64_t n,
+                                         struct ArrowError* error);
+
+/// \brief Release the memory held by an ArrowSchemaProjection
+void ArrowSchemaProjectionReset(struct ArrowSchemaProjection* projection);
+
+/// \brief Create a pruned copy of a schema
+///
+/// Initializes out with a copy of the fields of schema selected by projection.
+/// Returns EINVAL if projection is not compatible with schema.
+ArrowErrorCode ArrowSchemaProject(struct ArrowSchema* schema,
+                                  const struct ArrowSchemaProjection* projection,
+                                  struct ArrowSchema* out, struct ArrowError* error);
+
 /// \brief Set the format field of a schema from an ArrowType
 ///
 /// Initializes the fields and release callback of schema_out. For
@@ -335,12 +894,39 @@ ArrowErrorCode ArrowSchemaSetTypeDateTime(struct ArrowSchema* schema, enum Arrow
 ArrowErrorCode ArrowSchemaSetTypeUnion(struct ArrowSchema* schema, enum ArrowType type,
                                        int64_t n_children);
 
+/// \brief Set the format field of a run-end encoded schema
+///
+/// Returns EINVAL for a run_end_type that is not NANOARROW_TYPE_INT16,
+/// NANOARROW_TYPE_INT32, or NANOARROW_TYPE_INT64. A non-nullable "run_ends" child of
+/// run_end_type and an initialized "values" child are allocated; the caller is
+/// responsible for setting the type of the "values" child.
+ArrowErrorCode ArrowSchemaSetTypeRunEndEncoded(struct ArrowSchema* schema,
+                                               enum ArrowType run_end_type);
+
 /// \brief Make a (recursive) copy of a schema
 ///
-/// Allocates and copies fields of schema into schema_out.
+/// Allocates and copies fields of schema into schema_out. The nodes and strings of the
+/// copy are laid out in a single allocation that is freed once every node has been
+/// released. Fields of the copy can still be modified using the ArrowSchemaSet*()
+/// functions, which first expand the node being modified into separately allocated
+/// fields.
 ArrowErrorCode ArrowSchemaDeepCopy(struct ArrowSchema* schema,
                                    struct ArrowSchema* schema_out);
 
+/// \brief Create a shared reference to a schema without copying its strings
+///
+/// If schema is not already a shared reference, its contents are moved into a
+/// reference-counted holder and schema is replaced with a reference to it. out is then
+/// initialized as another reference to the same holder, whose contents are released
+/// when the last reference is released. This is useful to hand out the same schema to
+/// many consumers (e.g., once per batch) without making a deep copy for each of them.
+/// Every node of a reference holds its own reference to the holder: children and the
+/// dictionary may be moved out and released independently, and a node modified with
+/// ArrowSchemaSet*() is replaced with a copy without affecting other references. The
+/// reference count is thread safe if ArrowArraySliceIsThreadSafe() returns non-zero.
+/// Returns EINVAL if schema or any of its descendants has been released.
+ArrowErrorCode ArrowSchemaShare(struct ArrowSchema* schema, struct ArrowSchema* out);
+
 /// \brief Copy format into schema->format
 ///
 /// schema must have been allocated using ArrowSchemaInitFromType() or
@@ -359,6 +945,28 @@ ArrowErrorCode ArrowSchemaSetName(struct ArrowSchema* schema, const char* name);
 /// ArrowSchemaDeepCopy.
 ArrowErrorCode ArrowSchemaSetMetadata(struct ArrowSchema* schema, const char* metadata);
 
+/// \brief Set schema->format to a string that outlives schema without copying it
+///
+/// Like ArrowSchemaSetFormat() except that format (e.g., a string literal) is borrowed
+/// rather than copied and is not freed when schema is released. The format strings of
+/// ArrowSchemaInitFromType() and ArrowSchemaSetType() are set in this way. A later call
+/// to ArrowSchemaSetFormat() copies its argument as usual.
+ArrowErrorCode ArrowSchemaSetFormatStatic(struct ArrowSchema* schema,
+                                          const char* format);
+
+/// \brief Set schema->name to a string that outlives schema without copying it
+///
+/// Like ArrowSchemaSetName() except that name is borrowed rather than copied and is not
+/// freed when schema is released.
+ArrowErrorCode ArrowSchemaSetNameStatic(struct ArrowSchema* schema, const char* name);
+
+/// \brief Set schema->metadata to metadata that outlives schema without copying it
+///
+/// Like ArrowSchemaSetMetadata() except that metadata is borrowed rather than copied
+/// and is not freed when schema is released.
+ArrowErrorCode ArrowSchemaSetMetadataStatic(struct ArrowSchema* schema,
+                                            const char* metadata);
+
 /// \brief Allocate the schema->children array
 ///
 /// Includes the memory for each child struct ArrowSchema.
@@ -415,6 +1023,50 @@ char ArrowMetadataHasKey(const char* metadata, struct ArrowStringView key);
 ArrowErrorCode ArrowMetadataGetValue(const char* metadata, struct ArrowStringView key,
                                      struct ArrowStringView* value_out);
 
+/// \brief A hash index of the key/value pairs in schema metadata
+///
+/// Parsing metadata once into an ArrowMetadataIndex allows keys to be looked up in
+/// constant time instead of scanning the metadata string. Like the
+/// ArrowMetadataReader, the ArrowMetadataIndex does not own any data and is only
+/// valid for the lifetime of the underlying metadata pointer.
+struct ArrowMetadataIndex {
+  /// \brief The number of unique keys
+  int64_t n_keys;
+
+  /// \brief The unique keys in the order of their first instance
+  struct ArrowStringView* keys;
+
+  /// \brief The value of the first instance of each key
+  struct ArrowStringView* values;
+
+  /// \brief The number of slots in the hash table (a power of two)
+  int64_t n_slots;
+
+  /// \brief The hash table of indices into keys, where empty slots are -1
+  int64_t* slots;
+};
+
+/// \brief Initialize an ArrowMetadataIndex
+///
+/// metadata can be NULL. On success, the caller is responsible for calling
+/// ArrowMetadataIndexReset().
+ArrowErrorCode ArrowMetadataIndexInit(struct ArrowMetadataIndex* index,
+                                      const char* metadata);
+
+/// \brief Release the memory held by an ArrowMetadataIndex
+void ArrowMetadataIndexReset(struct ArrowMetadataIndex* index);
+
+/// \brief Extract a value from an ArrowMetadataIndex
+///
+/// If key does not exist in the index, value_out is unmodified
+ArrowErrorCode ArrowMetadataIndexGetValue(const struct ArrowMetadataIndex* index,
+                                          struct ArrowStringView key,
+                                          struct ArrowStringView* value_out);
+
+/// \brief Check for a key in an ArrowMetadataIndex
+char ArrowMetadataIndexHasKey(const struct ArrowMetadataIndex* index,
+                              struct ArrowStringView key);
+
 /// \brief Initialize a builder for schema metadata from key/value pairs
 ///
 /// metadata can be an existing metadata string or NULL to initialize
@@ -439,6 +1091,17 @@ ArrowErrorCode ArrowMetadataBuilderSet(struct ArrowBuffer* buffer,
 ArrowErrorCode ArrowMetadataBuilderRemove(struct ArrowBuffer* buffer,
                                           struct ArrowStringView key);
 
+/// \brief Set or remove many keys in a buffer containing serialized metadata
+///
+/// Applies the equivalent of ArrowMetadataBuilderSet() for each of the n pairs of
+/// keys and values (or ArrowMetadataBuilderRemove() where values[i].data is NULL)
+/// while rewriting the buffer only once. If a key is given more than once, the last
+/// value is used. Keys that do not already exist are appended in the order they were
+/// first given.
+ArrowErrorCode ArrowMetadataBuilderSetMany(struct ArrowBuffer* buffer, int64_t n,
+                                           const struct ArrowStringView* keys,
+                                           const struct ArrowStringView* values);
+
 /// @}
 
 /// \defgroup nanoarrow-schema-view Reading schemas
@@ -532,12 +1195,81 @@ struct ArrowSchemaView {
   /// type ids parameter. This value points to
   /// data within the schema and is undefined for other types.
   const char* union_type_ids;
+
+  /// \brief The registered identifier of the extension type
+  ///
+  /// NANOARROW_EXTENSION_ID_NONE if the schema is not an extension type,
+  /// NANOARROW_EXTENSION_ID_UNREGISTERED if it is an extension type that was not
+  /// resolved using an ArrowExtensionRegistry, or the identifier returned by
+  /// ArrowExtensionRegistryRegister() for extension_name.
+  int32_t extension_id;
 };
 
 /// \brief Initialize an ArrowSchemaView
 ArrowErrorCode ArrowSchemaViewInit(struct ArrowSchemaView* schema_view,
                                    struct ArrowSchema* schema, struct ArrowError* error);
 
+/// \brief The extension_id of an ArrowSchemaView whose schema is not an extension type
+#define NANOARROW_EXTENSION_ID_NONE 0
+
+/// \brief The extension_id of an ArrowSchemaView whose extension type is not known
+#define NANOARROW_EXTENSION_ID_UNREGISTERED -1
+
+/// \brief A set of extension type names, each with an integer identifier
+///
+/// Consumers that handle several extension types (e.g., geoarrow.wkb or arrow.uuid)
+/// can register each name once and dispatch on ArrowSchemaView.extension_id
+/// rather than comparing extension names for every schema or batch. Registration
+/// is not thread safe but a registry that is no longer modified can be shared by
+/// any number of threads.
+struct ArrowExtensionRegistry {
+  /// \brief The number of registered extension types
+  ///
+  /// Registered identifiers are 1 through n_types.
+  int32_t n_types;
+
+  /// \brief The end offset of each registered name in names (private)
+  struct ArrowBuffer offsets;
+
+  /// \brief The concatenated registered names (private)
+  struct ArrowBuffer names;
+};
+
+/// \brief Initialize an empty ArrowExtensionRegistry
+void ArrowExtensionRegistryInit(struct ArrowExtensionRegistry* registry);
+
+/// \brief Free the memory held by an ArrowExtensionRegistry
+void ArrowExtensionRegistryReset(struct ArrowExtensionRegistry* registry);
+
+/// \brief Register an extension type name
+///
+/// Places the identifier of extension_name in id_out, registering extension_name
+/// (a copy of which is kept by registry) if it was not already registered.
+/// Returns EINVAL for an empty extension_name.
+ArrowErrorCode ArrowExtensionRegistryRegister(struct ArrowExtensionRegistry* registry,
+                                              struct ArrowStringView extension_name,
+                                              int32_t* id_out);
+
+/// \brief Find the identifier of an extension type name
+///
+/// Returns NANOARROW_EXTENSION_ID_UNREGISTERED if extension_name was not registered.
+int32_t ArrowExtensionRegistryFind(const struct ArrowExtensionRegistry* registry,
+                                   struct ArrowStringView extension_name);
+
+/// \brief The name registered with an identifier
+///
+/// Returns a view whose data is NULL if id is not a registered identifier.
+struct ArrowStringView ArrowExtensionRegistryName(
+    const struct ArrowExtensionRegistry* registry, int32_t id);
+
+/// \brief Initialize an ArrowSchemaView and resolve its extension_id
+///
+/// Like ArrowSchemaViewInit() except that the extension_id of an extension type is
+/// looked up in registry (which may be NULL).
+ArrowErrorCode ArrowSchemaViewInitWithRegistry(
+    struct ArrowSchemaView* schema_view, struct ArrowSchema* schema,
+    const struct ArrowExtensionRegistry* registry, struct ArrowError* error);
+
 /// @}
 
 /// \defgroup nanoarrow-buffer Owning, growable buffers
@@ -556,6 +1288,16 @@ static inline void ArrowBufferInit(struct ArrowBuffer* buffer);
 static inline ArrowErrorCode ArrowBufferSetAllocator(
     struct ArrowBuffer* buffer, struct ArrowBufferAllocator allocator);
 
+/// \brief Set the strategy used to grow a buffer's capacity
+///
+/// Affects future calls to ArrowBufferReserve() and the functions that
+/// call it (e.g., ArrowBufferAppend()). The default is to double the
+/// capacity. Allocators may additionally expand a buffer in place from their
+/// reallocate callback; with the default allocator, large allocations are
+/// typically grown using mremap() by glibc's realloc().
+static inline void ArrowBufferSetGrowthPolicy(
+    struct ArrowBuffer* buffer, enum ArrowBufferGrowthPolicy growth_policy);
+
 /// \brief Reset an ArrowBuffer
 ///
 /// Releases the buffer using the allocator's free method if
@@ -680,6 +1422,13 @@ static inline void ArrowBitsSetTo(uint8_t* bits, int64_t start_offset, int64_t l
 /// \brief Count true values in a bitmap
 static inline int64_t ArrowBitCountSet(const uint8_t* bits, int64_t i_from, int64_t i_to);
 
+/// \brief Count true values in n_words contiguous 64-bit words
+///
+/// bits does not need to be aligned. Uses the kernel for the features returned by
+/// ArrowCpuFeatures() (POPCNT or AVX2 on x86), or a portable kernel otherwise, and is
+/// used by ArrowBitCountSet() for long ranges.
+int64_t ArrowBitCountSetWords(const uint8_t* bits, int64_t n_words);
+
 /// \brief Extract int8 boolean values from a range in a bitmap
 static inline void ArrowBitsUnpackInt8(const uint8_t* bits, int64_t start_offset,
                                        int64_t length, int8_t* out);
@@ -688,6 +1437,76 @@ static inline void ArrowBitsUnpackInt8(const uint8_t* bits, int64_t start_offset
 static inline void ArrowBitsUnpackInt32(const uint8_t* bits, int64_t start_offset,
                                         int64_t length, int32_t* out);
 
+/// \brief Compute the bitwise AND of two bitmap ranges
+///
+/// Writes length bits of lhs & rhs to out beginning at out_offset. Each of
+/// lhs_offset, rhs_offset, and out_offset may be an arbitrary bit offset.
+/// Bits of out outside the written range are not modified.
+static inline void ArrowBitsAnd(const uint8_t* lhs, int64_t lhs_offset,
+                                const uint8_t* rhs, int64_t rhs_offset, int64_t length,
+                                uint8_t* out, int64_t out_offset);
+
+/// \brief Compute the bitwise OR of two bitmap ranges
+///
+/// See ArrowBitsAnd() for a description of the arguments.
+static inline void ArrowBitsOr(const uint8_t* lhs, int64_t lhs_offset, const uint8_t* rhs,
+                               int64_t rhs_offset, int64_t length, uint8_t* out,
+                               int64_t out_offset);
+
+/// \brief Compute the bitwise XOR of two bitmap ranges
+///
+/// See ArrowBitsAnd() for a description of the arguments.
+static inline void ArrowBitsXor(const uint8_t* lhs, int64_t lhs_offset,
+                                const uint8_t* rhs, int64_t rhs_offset, int64_t length,
+                                uint8_t* out, int64_t out_offset);
+
+/// \brief Compute lhs & ~rhs for two bitmap ranges
+///
+/// See ArrowBitsAnd() for a description of the arguments.
+static inline void ArrowBitsAndNot(const uint8_t* lhs, int64_t lhs_offset,
+                                   const uint8_t* rhs, int64_t rhs_offset, int64_t length,
+                                   uint8_t* out, int64_t out_offset);
+
+/// \brief Initialize an iterator over runs of set and unset bits in a bitmap
+///
+/// A NULL bits pointer is treated as a bitmap with all bits set, which
+/// matches the interpretation of a missing validity buffer.
+static inline void ArrowBitRunReaderInit(struct ArrowBitRunReader* reader,
+                                         const uint8_t* bits, int64_t start_offset,
+                                         int64_t length);
+
+/// \brief Read the next run of set or unset bits
+///
+/// Populates run with the next run of bits whose values are identical and
+/// returns its length, or returns 0 when there are no more bits to read.
+/// Whole 64-bit words that are all set or all unset are skipped with a single
+/// comparison, which makes iterating over mostly valid or mostly null bitmaps
+/// much faster than testing each bit.
+static inline int64_t ArrowBitRunReaderNext(struct ArrowBitRunReader* reader,
+                                            struct ArrowBitRun* run);
+
+/// \brief Write the positions of the set bits in a range of a bitmap
+///
+/// Writes the position (relative to offset) of each of the
+/// ArrowBitCountSet(bits, offset, length) set bits in increasing order to out and
+/// returns the number of positions written, e.g., to convert the result of a filter
+/// to the indices accepted by ArrowArrayAppendTake(). out must have room for one
+/// value per set bit. Words with no set bits are skipped with a single comparison
+/// and words with only a few set bits are scanned using the position of the lowest
+/// set bit, such that the cost is proportional to the number of positions written.
+static inline int64_t ArrowBitmapToIndices(const uint8_t* bits, int64_t offset,
+                                           int64_t length, int64_t* out);
+
+/// \brief Write the positions of the set bits in n_words contiguous 64-bit words
+///
+/// Writes the position of each set bit plus base to out and returns the number of
+/// positions written. bits does not need to be aligned. Uses the kernel for the
+/// features returned by ArrowCpuFeatures() (a compressing store of eight positions
+/// per byte for AVX-512 on x86), or a portable kernel otherwise, and is used by
+/// ArrowBitmapToIndices() for long ranges.
+int64_t ArrowBitmapToIndicesWords(const uint8_t* bits, int64_t n_words, int64_t base,
+                                  int64_t* out);
+
 /// \brief Initialize an ArrowBitmap
 ///
 /// Initialize the builder's buffer, empty its cache, and reset the size to zero
@@ -736,6 +1555,29 @@ static inline void ArrowBitmapAppendInt8Unsafe(struct ArrowBitmap* bitmap,
 static inline void ArrowBitmapAppendInt32Unsafe(struct ArrowBitmap* bitmap,
                                                 const int32_t* values, int64_t n_values);
 
+/// \brief Reserve space for and append the bitwise AND of two bitmap ranges
+static inline ArrowErrorCode ArrowBitmapAnd(struct ArrowBitmap* bitmap,
+                                            const uint8_t* lhs, int64_t lhs_offset,
+                                            const uint8_t* rhs, int64_t rhs_offset,
+                                            int64_t length);
+
+/// \brief Reserve space for and append the bitwise OR of two bitmap ranges
+static inline ArrowErrorCode ArrowBitmapOr(struct ArrowBitmap* bitmap, const uint8_t* lhs,
+                                           int64_t lhs_offset, const uint8_t* rhs,
+                                           int64_t rhs_offset, int64_t length);
+
+/// \brief Reserve space for and append the bitwise XOR of two bitmap ranges
+static inline ArrowErrorCode ArrowBitmapXor(struct ArrowBitmap* bitmap,
+                                            const uint8_t* lhs, int64_t lhs_offset,
+                                            const uint8_t* rhs, int64_t rhs_offset,
+                                            int64_t length);
+
+/// \brief Reserve space for and append lhs & ~rhs for two bitmap ranges
+static inline ArrowErrorCode ArrowBitmapAndNot(struct ArrowBitmap* bitmap,
+                                               const uint8_t* lhs, int64_t lhs_offset,
+                                               const uint8_t* rhs, int64_t rhs_offset,
+                                               int64_t length);
+
 /// \brief Reset a bitmap builder
 ///
 /// Releases any memory held by buffer, empties the cache, and resets the size to zero
@@ -803,14 +1645,37 @@ void ArrowArraySetValidityBitmap(struct ArrowArray* array, struct ArrowBitmap* b
 ArrowErrorCode ArrowArraySetBuffer(struct ArrowArray* array, int64_t i,
                                    struct ArrowBuffer* buffer);
 
+/// \brief Adopt the contiguous child values of a fixed_size_list array
+///
+/// Takes ownership of values, which must contain a whole number of lists of the
+/// fixed-width child type, and moves it into the child's data buffer without copying
+/// such that memory wrapped using ArrowBufferSetAllocator() with an
+/// ArrowBufferDeallocator() is released by the array. The array and its child must be
+/// empty; on success, the lengths of both are set from the size of values and all
+/// lists are valid. On error, values is left untouched.
+ArrowErrorCode ArrowArraySetFixedSizeListValues(struct ArrowArray* array,
+                                                struct ArrowBuffer* values);
+
+/// \brief Set the allocator used for all buffers of an ArrowArray
+///
+/// Recursively sets the allocator used for the buffers of array, its
+/// children, and its dictionary (e.g., to ArrowBufferAllocatorAligned()
+/// for an array initialized with ArrowArrayInitFromSchema()). Returns EINVAL
+/// if any buffer has already been allocated. array and any children or
+/// dictionary must have been allocated using ArrowArrayInitFromType().
+ArrowErrorCode ArrowArraySetAllocator(struct ArrowArray* array,
+                                      struct ArrowBufferAllocator allocator);
+
 /// \brief Get the validity bitmap of an ArrowArray
 ///
-/// array must have been allocated using ArrowArrayInitFromType()
+/// array must have been allocated using ArrowArrayInitFromType(). Because the bitmap
+/// may be modified directly, ArrowArrayFinishBuilding() will fully validate array.
 static inline struct ArrowBitmap* ArrowArrayValidityBitmap(struct ArrowArray* array);
 
 /// \brief Get a buffer of an ArrowArray
 ///
-/// array must have been allocated using ArrowArrayInitFromType()
+/// array must have been allocated using ArrowArrayInitFromType(). Because the buffer
+/// may be modified directly, ArrowArrayFinishBuilding() will fully validate array.
 static inline struct ArrowBuffer* ArrowArrayBuffer(struct ArrowArray* array, int64_t i);
 
 /// \brief Start element-wise appending to an ArrowArray
@@ -830,6 +1695,227 @@ static inline ArrowErrorCode ArrowArrayStartAppending(struct ArrowArray* array);
 ArrowErrorCode ArrowArrayReserve(struct ArrowArray* array,
                                  int64_t additional_size_elements);
 
+/// \brief Reserve space for future appends of a known shape
+///
+/// Like ArrowArrayReserve() but also reserves space for string and binary data
+/// and for the children of list, map, and dense union arrays according to the
+/// per-child element and byte counts in shape. When shape accurately describes
+/// the values that will be appended, no buffer is reallocated while appending
+/// them (except for a validity buffer that has not yet been allocated). Returns
+/// EINVAL if shape does not match the structure of array.
+ArrowErrorCode ArrowArrayReserveShape(struct ArrowArray* array,
+                                      const struct ArrowArrayShape* shape);
+
+/// \brief Counters of the buffer reallocations of an array under construction
+struct ArrowArrayBuildStats {
+  /// \brief The number of times a buffer that held data was reallocated
+  int64_t n_reallocations;
+
+  /// \brief The number of bytes held by buffers when they were reallocated
+  int64_t bytes_reallocated;
+};
+
+/// \brief Sum the reallocation counters of every buffer in an array tree
+///
+/// Includes the buffers of children and dictionaries. Can be called before or after
+/// ArrowArrayFinishBuilding(); array must have been allocated using
+/// ArrowArrayInitFromType() or ArrowArrayInitFromSchema(). Buffers only count their
+/// reallocations when nanoarrow is configured with NANOARROW_WITH_BUFFER_STATS (i.e.,
+/// the CMake option of the same name); otherwise, out is zeroed and ENOTSUP is
+/// returned.
+ArrowErrorCode ArrowArrayGetBuildStats(struct ArrowArray* array,
+                                       struct ArrowArrayBuildStats* out);
+
+/// \brief Record the buffer sizes of a built array as a capacity hint
+///
+/// hint is a buffer of int64_t values that describes an array tree with the same
+/// structure as array. If hint is empty, it is initialized from the buffer sizes of
+/// array; otherwise, each value is updated to the maximum of its value and the size of
+/// the corresponding buffer of array. Returns EINVAL if hint describes an array with a
+/// different structure.
+ArrowErrorCode ArrowArrayCapacityHintUpdate(struct ArrowArray* array,
+                                            struct ArrowBuffer* hint);
+
+/// \brief Reserve the buffer sizes recorded in a capacity hint
+///
+/// Reserves space in each buffer of array (and its children and dictionary) such that
+/// each buffer can reach the size recorded in hint by ArrowArrayCapacityHintUpdate()
+/// without a reallocation. A producer that updates hint with each batch and reserves
+/// from it before building the next converges to building batches of a typical shape
+/// without reallocating. This is best called before ArrowArrayStartAppending() so that
+/// the initial offset of offset buffers is written to the reserved space. Returns EINVAL
+/// if hint describes an array with a different structure.
+ArrowErrorCode ArrowArrayReserveFromHint(struct ArrowArray* array,
+                                         const struct ArrowBuffer* hint);
+
+/// \brief Append a range of elements from an ArrowArrayView to an array
+///
+/// Appends elements [offset, offset + length) of array_view to array by copying
+/// buffer contents in bulk: validity and boolean bitmaps are copied with shifted
+/// word-wise copies, offsets are rebased, and the referenced range of any child
+/// is appended recursively. array_view must have the same storage type and
+/// structure as array (e.g., a view of an array with the same schema) and
+/// ArrowArrayStartAppending() must have been called on array. For dictionary
+/// encoded arrays, only the indices are appended. Returns EINVAL if the range
+/// is out of bounds or array_view does not match array or EOVERFLOW if the
+/// rebased offsets would overflow; array may be partially appended to if an
+/// error is returned.
+ArrowErrorCode ArrowArrayAppendArrayView(struct ArrowArray* array,
+                                         struct ArrowArrayView* array_view,
+                                         int64_t offset, int64_t length);
+
+/// \brief Append selected elements from an ArrowArrayView to an array
+///
+/// Appends elements indices[0], ..., indices[n - 1] of array_view to array in that
+/// order. Fixed-width values, bits, and string data are gathered into buffers that
+/// are reserved up front; the children of struct and sparse union arrays are taken
+/// using the same indices, and the child ranges of list arrays are appended using
+/// ArrowArrayAppendArrayView(). array_view and array must meet the requirements of
+/// ArrowArrayAppendArrayView(). Returns EINVAL if an index is out of bounds or
+/// array_view does not match array, EOVERFLOW if the appended offsets would
+/// overflow, or ENOTSUP for dense union, run-end encoded, and binary or string view
+/// arrays; array may be partially appended to if an error is returned.
+ArrowErrorCode ArrowArrayAppendTake(struct ArrowArray* array,
+                                    struct ArrowArrayView* array_view,
+                                    const int64_t* indices, int64_t n);
+
+/// \brief Append the elements of an ArrowArrayView selected by a bitmap
+///
+/// Appends each element i of array_view for which bit i of filter is set, in order.
+/// filter must contain at least array_view->length bits. Error conditions are the
+/// same as for ArrowArrayAppendTake().
+ArrowErrorCode ArrowArrayAppendFilter(struct ArrowArray* array,
+                                      struct ArrowArrayView* array_view,
+                                      const uint8_t* filter);
+
+/// \brief Append an array of C structs to a struct array
+///
+/// Appends one non-null element to array for each of the n records that begin
+/// every stride bytes at records (e.g., stride is sizeof() the struct). fields
+/// must contain one struct ArrowRecordField for each child of array, describing
+/// the member from which the values of that child are read. Each child is filled
+/// in blocks using strided loops that gather its member from every record into
+/// the child's buffers. Returns EINVAL if array is not a struct array or if a field
+/// does not match its child, which must be a fixed-width, boolean, string, or large
+/// string array. ArrowArrayStartAppending() must have been called on array, which
+/// may be partially appended to if an error is returned.
+ArrowErrorCode ArrowArrayAppendRecords(struct ArrowArray* array, const void* records,
+                                       int64_t n, int64_t stride,
+                                       const struct ArrowRecordField* fields);
+
+/// \brief Concatenate arrays into a single array
+///
+/// Initializes out from schema and fills it with the contents of the n arrays,
+/// each of which must be valid for schema. The exact size of every buffer of out
+/// is calculated before any data is copied so that each buffer is allocated
+/// exactly once and filled using the bulk copies of ArrowArrayAppendArrayView().
+/// Nested types are supported but dictionary-encoded arrays are not. On error,
+/// out is released.
+ArrowErrorCode ArrowArrayConcatenate(struct ArrowArray** arrays, int64_t n,
+                                     struct ArrowSchema* schema, struct ArrowArray* out,
+                                     struct ArrowError* error);
+
+/// \brief Create a zero-copy slice of an array
+///
+/// Initializes out with elements offset, ..., offset + length - 1 of array without
+/// copying any buffers. Only the top level is sliced (i.e., out->offset and
+/// out->length are adjusted and children keep the offset and length of array). If
+/// array is not already a slice, it is moved into a reference-counted holder and
+/// replaced with a slice of its full range, after which it can be released
+/// independently of out but can no longer be used with functions that modify or
+/// build arrays (e.g., ArrowArrayBuffer() or ArrowArrayAppendInt()). Slices of
+/// slices share the same holder. The null_count of out is -1 if it is not known to
+/// be zero. Returns EINVAL if the requested range is out of bounds or array has been
+/// released. The reference count is thread safe if ArrowArraySliceIsThreadSafe()
+/// returns non-zero.
+ArrowErrorCode ArrowArraySlice(struct ArrowArray* array, int64_t offset,
+                               int64_t length, struct ArrowArray* out);
+
+/// \brief Check for thread safety of the reference count used by ArrowArraySlice()
+///
+/// A thread safe reference count requires C11 and the stdatomic.h header.
+int ArrowArraySliceIsThreadSafe(void);
+
+/// \brief Write a schema and array to a single relocatable block
+///
+/// Appends a block to out that contains the schema, the array structures, and the
+/// contents of every buffer of array, where pointers are replaced with offsets from
+/// the start of the block such that the block can be written to a file and read
+/// with ArrowArrayReadRelocatable() without copying buffers. The block is padded to
+/// start at a multiple of 64 bytes from the start of out and every buffer is aligned
+/// to 64 bytes within the block. Blocks depend on the byte order and pointer size of
+/// the platform on which they were written and are intended for local caches rather
+/// than as an interchange format (see the IPC extension for the latter).
+ArrowErrorCode ArrowArrayWriteRelocatable(struct ArrowSchema* schema,
+                                          struct ArrowArray* array,
+                                          struct ArrowBuffer* out,
+                                          struct ArrowError* error);
+
+/// \brief Read a schema and array from a relocatable block
+///
+/// Replaces the offsets in a block written by ArrowArrayWriteRelocatable() with
+/// pointers in place (i.e., block must be writable, such as a private memory
+/// mapping) and initializes array_out with an array whose buffers point into block.
+/// On success, block is moved into a reference-counted holder that is freed (using
+/// the deallocator of block) when array_out and any children moved out of it have
+/// been released. If schema_out is not NULL, it is initialized with a copy of the
+/// schema. The data of block must be aligned to at least the size of a pointer.
+/// Returns EINVAL if block was not written on a compatible platform or refers to
+/// memory outside of itself, in which case block may have been modified.
+ArrowErrorCode ArrowArrayReadRelocatable(struct ArrowBuffer* block,
+                                         struct ArrowSchema* schema_out,
+                                         struct ArrowArray* array_out,
+                                         struct ArrowError* error);
+
+/// \brief Select nested children of an array without copying buffers
+///
+/// Initializes out with the children of array selected by projection (see
+/// ArrowSchemaProjectionInit()). Like ArrowArraySlice(), array is moved into a
+/// reference-counted holder (if it is not already a slice) that is shared with out,
+/// whose nodes reference the buffers of array. An ArrowArrayView of out can be
+/// initialized from the result of ArrowSchemaProject() with the same projection.
+/// Returns EINVAL if projection is not compatible with array.
+ArrowErrorCode ArrowArrayProject(struct ArrowArray* array,
+                                 const struct ArrowSchemaProjection* projection,
+                                 struct ArrowArray* out, struct ArrowError* error);
+
+/// \brief Copy the contents of an ArrowArrayView into a new array
+///
+/// Initializes out using ArrowArrayInitFromArrayView() and copies elements
+/// 0, ..., array_view->length - 1 of array_view (including any dictionaries) into
+/// buffers that out owns, such that out remains valid after the source of
+/// array_view is released (e.g., a memory-mapped file). Each buffer is allocated
+/// once with its exact size. If executor is not NULL and array_view is a struct,
+/// each column is copied by a separate task submitted to executor. array_view must
+/// be valid and of a type supported by ArrowArrayAppendArrayView(). On error, out
+/// is released.
+ArrowErrorCode ArrowArrayViewDeepCopy(struct ArrowArrayView* array_view,
+                                      struct ArrowExecutor* executor,
+                                      struct ArrowArray* out, struct ArrowError* error);
+
+/// \brief Run a task for contiguous morsels of an ArrowArrayView in parallel
+///
+/// Splits elements 0, ..., array_view->length - 1 of array_view into at most
+/// n_morsels morsels of equal size that start at multiples of 64 elements, such
+/// that tasks writing one bit or value per element to a shared output (e.g., the
+/// bitmap written by ArrowArrayViewMatchStrings()) never share a byte with another
+/// task. task is called with a copy of array_view whose offset and length select
+/// the elements of the morsel and with the index start of its first element in
+/// array_view. Only the top level is copied: children, dictionaries, and
+/// array_view->array are shared and must not be modified by tasks, and the offsets
+/// of lists, unions, and run-end encoded arrays are interpreted exactly as for
+/// array_view such that kernels called on a morsel (e.g.,
+/// ArrowArrayViewComputeStatistics() or ArrowArrayViewHash()) see the same values
+/// as for the corresponding range of array_view. The null_count of a morsel is -1
+/// unless that of array_view is zero. Morsels are submitted to executor or run on
+/// the calling thread if executor is NULL. Returns the result of the first morsel
+/// whose task fails, copying its error message.
+ArrowErrorCode ArrowArrayViewParallelFor(
+    struct ArrowArrayView* array_view, int64_t n_morsels, struct ArrowExecutor* executor,
+    ArrowErrorCode (*task)(void* task_private, struct ArrowArrayView* morsel,
+                           int64_t start, struct ArrowError* error),
+    void* task_private, struct ArrowError* error);
+
 /// \brief Append a null value to an array
 static inline ArrowErrorCode ArrowArrayAppendNull(struct ArrowArray* array, int64_t n);
 
@@ -860,14 +1946,107 @@ static inline ArrowErrorCode ArrowArrayAppendUInt(struct ArrowArray* array,
 static inline ArrowErrorCode ArrowArrayAppendDouble(struct ArrowArray* array,
                                                     double value);
 
+/// \brief Append many values to an array
+///
+/// Appends n values and, if validity is non-NULL, treats values[i] as null
+/// if bit i of the validity bitmap is unset. When the storage type of array
+/// matches the type of values, the values are appended with a single copy and
+/// the validity bitmap is appended in whole words; otherwise, each value is
+/// appended with ArrowArrayAppendInt(), ArrowArrayAppendUInt(), or
+/// ArrowArrayAppendDouble(). Returns EINVAL if any value cannot be exactly
+/// represented by the underlying storage type (in which case the array may
+/// contain some of the values).
+static inline ArrowErrorCode ArrowArrayAppendInt64Slice(struct ArrowArray* array,
+                                                        const int64_t* values, int64_t n,
+                                                        const uint8_t* validity);
+
+/// \brief Append int8_t values to an array
+///
+/// See ArrowArrayAppendInt64Slice().
+static inline ArrowErrorCode ArrowArrayAppendInt8Slice(struct ArrowArray* array,
+                                                       const int8_t* values, int64_t n,
+                                                       const uint8_t* validity);
+
+/// \brief Append uint8_t values to an array
+///
+/// See ArrowArrayAppendInt64Slice().
+static inline ArrowErrorCode ArrowArrayAppendUInt8Slice(struct ArrowArray* array,
+                                                        const uint8_t* values, int64_t n,
+                                                        const uint8_t* validity);
+
+/// \brief Append int16_t values to an array
+///
+/// See ArrowArrayAppendInt64Slice().
+static inline ArrowErrorCode ArrowArrayAppendInt16Slice(struct ArrowArray* array,
+                                                        const int16_t* values, int64_t n,
+                                                        const uint8_t* validity);
+
+/// \brief Append uint16_t values to an array
+///
+/// See ArrowArrayAppendInt64Slice().
+static inline ArrowErrorCode ArrowArrayAppendUInt16Slice(struct ArrowArray* array,
+                                                         const uint16_t* values,
+                                                         int64_t n,
+                                                         const uint8_t* validity);
+
+/// \brief Append int32_t values to an array
+///
+/// See ArrowArrayAppendInt64Slice().
+static inline ArrowErrorCode ArrowArrayAppendInt32Slice(struct ArrowArray* array,
+                                                        const int32_t* values, int64_t n,
+                                                        const uint8_t* validity);
+
+/// \brief Append uint32_t values to an array
+///
+/// See ArrowArrayAppendInt64Slice().
+static inline ArrowErrorCode ArrowArrayAppendUInt32Slice(struct ArrowArray* array,
+                                                         const uint32_t* values,
+                                                         int64_t n,
+                                                         const uint8_t* validity);
+
+/// \brief Append uint64_t values to an array
+///
+/// See ArrowArrayAppendInt64Slice().
+static inline ArrowErrorCode ArrowArrayAppendUInt64Slice(struct ArrowArray* array,
+                                                         const uint64_t* values,
+                                                         int64_t n,
+                                                         const uint8_t* validity);
+
+/// \brief Append float values to an array
+///
+/// See ArrowArrayAppendInt64Slice().
+static inline ArrowErrorCode ArrowArrayAppendFloatSlice(struct ArrowArray* array,
+                                                        const float* values, int64_t n,
+                                                        const uint8_t* validity);
+
+/// \brief Append double values to an array
+///
+/// See ArrowArrayAppendInt64Slice().
+static inline ArrowErrorCode ArrowArrayAppendDoubleSlice(struct ArrowArray* array,
+                                                         const double* values, int64_t n,
+                                                         const uint8_t* validity);
+
+/// \brief Append fixed-size lists from a contiguous buffer of child values
+///
+/// Appends n lists to a fixed_size_list array whose child is a fixed-width type
+/// (e.g., fixed_size_list<float32, N> for embedding vectors) from n * N contiguous
+/// child values (e.g., a float[n * N]) using a single copy into the child's data
+/// buffer. Child values are always marked as valid; validity, if non-NULL, is a
+/// bitmap of n bits marking which lists are non-null. Returns EINVAL if array is not a
+/// fixed_size_list or its child is not a fixed-width type of at least one byte.
+static inline ArrowErrorCode ArrowArrayAppendFixedSizeListSlice(
+    struct ArrowArray* array, const void* values, int64_t n, const uint8_t* validity);
+
 /// \brief Append a string of bytes to an array
 ///
 /// Returns NANOARROW_OK if value can be exactly represented by
 /// the underlying storage type, EOVERFLOW if appending value would overflow
 /// the offset type (e.g., if the data buffer would be larger than 2 GB for a
 /// non-large string type), or EINVAL otherwise (e.g., the underlying array is not a
-/// binary, string, large binary, large string, or fixed-size binary array, or value is
-/// the wrong size for a fixed-size binary array).
+/// binary, string, large binary, large string, fixed-size binary, binary view, or
+/// string view array, or value is the wrong size for a fixed-size binary array).
+/// For binary and string view arrays, values longer than
+/// NANOARROW_BINARY_VIEW_INLINE_SIZE bytes are copied into a variadic data buffer.
 static inline ArrowErrorCode ArrowArrayAppendBytes(struct ArrowArray* array,
                                                    struct ArrowBufferView value);
 
@@ -877,10 +2056,44 @@ static inline ArrowErrorCode ArrowArrayAppendBytes(struct ArrowArray* array,
 /// the underlying storage type, EOVERFLOW if appending value would overflow
 /// the offset type (e.g., if the data buffer would be larger than 2 GB for a
 /// non-large string type), or EINVAL otherwise (e.g., the underlying array is not a
-/// string or large string array).
+/// string, large string, binary, large binary, binary view, or string view array).
 static inline ArrowErrorCode ArrowArrayAppendString(struct ArrowArray* array,
                                                     struct ArrowStringView value);
 
+/// \brief Append many strings or byte strings to an array
+///
+/// Appends n values and, if validity is non-NULL, treats values[i] as null
+/// if bit i of the validity bitmap is unset (in which case values[i] is not
+/// accessed). For string, binary, large string, and large binary arrays, the
+/// offset and data buffers are each reserved once. Returns EOVERFLOW if
+/// appending the values would overflow the offset type or EINVAL if array
+/// is not a binary, string, large binary, large string, or fixed-size
+/// binary array.
+static inline ArrowErrorCode ArrowArrayAppendStrings(struct ArrowArray* array,
+                                                     const struct ArrowStringView* values,
+                                                     int64_t n, const uint8_t* validity);
+
+/// \brief Append strings or byte strings from an offsets and data buffer
+///
+/// Appends the n values described by the n + 1 offsets into data (e.g., the
+/// offsets and data buffers of a string or binary array), rebasing the
+/// offsets and copying the data with a single copy. offsets[0] need not be
+/// zero. If validity is non-NULL, values whose bit is unset are appended as
+/// null. Returns EOVERFLOW if appending the values would overflow the offset
+/// type or EINVAL if array is not a binary, string, large binary, or large
+/// string array.
+static inline ArrowErrorCode ArrowArrayAppendStringsFromOffsets(
+    struct ArrowArray* array, const int32_t* offsets, const char* data, int64_t n,
+    const uint8_t* validity);
+
+/// \brief Append strings or byte strings from an offsets and data buffer
+///
+/// Like ArrowArrayAppendStringsFromOffsets() with 64-bit offsets (e.g.,
+/// from a large string or large binary array).
+static inline ArrowErrorCode ArrowArrayAppendStringsFromLargeOffsets(
+    struct ArrowArray* array, const int64_t* offsets, const char* data, int64_t n,
+    const uint8_t* validity);
+
 /// \brief Append a Interval to an array
 ///
 /// Returns NANOARROW_OK if value can be exactly represented by
@@ -898,13 +2111,31 @@ static inline ArrowErrorCode ArrowArrayAppendDecimal(struct ArrowArray* array,
 /// \brief Finish a nested array element
 ///
 /// Appends a non-null element to the array based on the first child's current
-/// length. Returns NANOARROW_OK if the item was successfully added, EOVERFLOW
+/// length. For list view and large list view arrays, the element refers to the child
+/// values appended since the end of the range referred to by the previous element.
+/// Returns NANOARROW_OK if the item was successfully added, EOVERFLOW
 /// if the child of a list or map array would exceed INT_MAX elements, or EINVAL
-/// if the underlying storage type is not a struct, list, large list, or fixed-size
-/// list, or if there was an attempt to add a struct or fixed-size list element where the
-/// length of the child array(s) did not match the expected length.
+/// if the underlying storage type is not a struct, list, large list, list view,
+/// large list view, or fixed-size list, or if there was an attempt to add a struct or
+/// fixed-size list element where the length of the child array(s) did not match the
+/// expected length.
 static inline ArrowErrorCode ArrowArrayFinishElement(struct ArrowArray* array);
 
+/// \brief Append a list view element referring to any range of its child
+///
+/// Appends a non-null element to a list view or large list view array that refers to
+/// size values of array->children[0] starting at child_offset. Child values may be
+/// appended in any order and before or after the elements that refer to them, and
+/// elements may refer to overlapping ranges; the range is checked against the length
+/// of the child by full validation. Null and empty elements appended with
+/// ArrowArrayAppendNull() and ArrowArrayAppendEmpty() refer to an empty range at the
+/// end of the child. Returns EINVAL if array is not a list view or large list view
+/// array or if child_offset or size are negative, or EOVERFLOW if the end of the range
+/// cannot be represented by the offset type.
+static inline ArrowErrorCode ArrowArrayAppendListView(struct ArrowArray* array,
+                                                     int64_t child_offset,
+                                                     int64_t size);
+
 /// \brief Finish a union array element
 ///
 /// Appends an element to the union type ids buffer and increments array->length.
@@ -914,11 +2145,27 @@ static inline ArrowErrorCode ArrowArrayFinishElement(struct ArrowArray* array);
 static inline ArrowErrorCode ArrowArrayFinishUnionElement(struct ArrowArray* array,
                                                           int8_t type_id);
 
+/// \brief Finish a run-end encoded array element
+///
+/// After exactly one value has been appended to the values child (i.e.,
+/// array->children[1]), appends a run of run_length elements by appending the new
+/// run end to the run_ends child and incrementing array->length. Returns EOVERFLOW
+/// if the run end cannot be represented by the run end type, or EINVAL if the
+/// underlying storage type is not run-end encoded, if run_length is not positive, or
+/// if the values child does not contain exactly one more element than the run_ends
+/// child. ArrowArrayAppendNull() and ArrowArrayAppendEmpty() append a single run
+/// whose value is null or empty, respectively.
+static inline ArrowErrorCode ArrowArrayFinishRunEndElement(struct ArrowArray* array,
+                                                           int64_t run_length);
+
 /// \brief Shrink buffer capacity to the size required
 ///
-/// Also applies shrinking to any child arrays. array must have been allocated using
-/// ArrowArrayInitFromType
-static inline ArrowErrorCode ArrowArrayShrinkToFit(struct ArrowArray* array);
+/// Also applies shrinking to any child arrays. Buffer contents and child values
+/// that are not referenced by the elements up to array->offset + array->length
+/// (e.g., values of a buffer set with a larger size than required or values of a
+/// struct child that is longer than its parent) are trimmed before capacity is
+/// released. array must have been allocated using ArrowArrayInitFromType
+ArrowErrorCode ArrowArrayShrinkToFit(struct ArrowArray* array);
 
 /// \brief Finish building an ArrowArray
 ///
@@ -935,11 +2182,126 @@ ArrowErrorCode ArrowArrayFinishBuildingDefault(struct ArrowArray* array,
 /// (i.e. NANOARROW_VALIDATION_LEVEL_NONE or NANOARROW_VALIDATION_LEVEL_MINIMAL) if CPU
 /// buffer data access is not possible or more validation (i.e.,
 /// NANOARROW_VALIDATION_LEVEL_FULL) if buffer content was obtained from an untrusted or
-/// corruptible source.
+/// corruptible source. Arrays whose buffers have only been written by the append
+/// functions since ArrowArrayInitFromType() or ArrowArrayResetForReuse() skip the
+/// parts of full validation that those functions already guarantee (e.g., that
+/// offsets are non-decreasing) and the counting of bits in their validity bitmap.
+/// For these arrays, a validity bitmap that contains no nulls is also released
+/// (consistent with the append functions, which only allocate a validity bitmap
+/// when the first null is appended).
 ArrowErrorCode ArrowArrayFinishBuilding(struct ArrowArray* array,
                                         enum ArrowValidationLevel validation_level,
                                         struct ArrowError* error);
 
+/// \brief Finish building an ArrowArray using the narrowest storage for its values
+///
+/// Scans the values of integer arrays once and rewrites them in place as the
+/// narrowest integer type of the same signedness that can represent them (e.g., an
+/// int64 array whose values are between -128 and 127 becomes an int8 array) and
+/// rewrites the offsets of large string, large binary, and large list arrays as
+/// 32-bit offsets if they fit. The format of the corresponding node of schema is
+/// updated to match. Children are narrowed recursively; dictionary indices,
+/// extension types, and sliced arrays are left as they are. The array is then shrunk
+/// to fit using ArrowArrayShrinkToFit() and finished using
+/// ArrowArrayFinishBuilding(). schema must be the schema from which array was
+/// allocated using ArrowArrayInitFromSchema().
+ArrowErrorCode ArrowArrayFinishBuildingNarrow(struct ArrowArray* array,
+                                              struct ArrowSchema* schema,
+                                              enum ArrowValidationLevel validation_level,
+                                              struct ArrowError* error);
+
+/// \brief Reset a finished ArrowArray to build another batch
+///
+/// Discards the contents of array and its children (and dictionary, if present)
+/// without releasing buffer memory or the internal structure allocated by
+/// ArrowArrayInitFromSchema() or ArrowArrayInitFromType(), then starts appending
+/// as if ArrowArrayStartAppending() had been called. Any data that must outlive
+/// the next batch must be copied before calling this function. Returns EINVAL if
+/// any array in the tree was not allocated by nanoarrow.
+ArrowErrorCode ArrowArrayResetForReuse(struct ArrowArray* array);
+
+/// @}
+
+/// \defgroup nanoarrow-dictionary-builder Building dictionary-encoded arrays
+///
+/// A hash-based builder that deduplicates values appended to a dictionary-encoded
+/// array, appending each unique value to array->dictionary once and its index to
+/// array.
+///
+/// @{
+
+/// \brief Initialize a dictionary builder
+///
+/// array must have been allocated using ArrowArrayInitFromSchema() with a
+/// dictionary-encoded schema whose index type is a signed integer and whose
+/// value type is a string, binary, or fixed-width type (other than boolean), and
+/// ArrowArrayStartAppending() must have been called. Any values already present
+/// in array->dictionary are used for deduplication. The index type of array is
+/// widened as required up to NANOARROW_TYPE_INT32: after building, the schema of
+/// array should be updated using ArrowSchemaSetType(schema, builder->index_type).
+/// If this function returns NANOARROW_OK, the caller must release the builder
+/// using ArrowDictionaryBuilderReset().
+ArrowErrorCode ArrowDictionaryBuilderInit(struct ArrowDictionaryBuilder* builder,
+                                          struct ArrowArray* array);
+
+/// \brief Append a signed integer value to a dictionary-encoded array
+///
+/// Appends value to the dictionary if it is not already present and appends its
+/// index to the array. Returns EINVAL if value cannot be represented by the
+/// dictionary value type or EOVERFLOW if the number of unique values would exceed
+/// the maximum index.
+ArrowErrorCode ArrowDictionaryBuilderAppendInt(struct ArrowDictionaryBuilder* builder,
+                                               int64_t value);
+
+/// \brief Append an unsigned integer value to a dictionary-encoded array
+///
+/// See ArrowDictionaryBuilderAppendInt().
+ArrowErrorCode ArrowDictionaryBuilderAppendUInt(struct ArrowDictionaryBuilder* builder,
+                                                uint64_t value);
+
+/// \brief Append a floating point value to a dictionary-encoded array
+///
+/// See ArrowDictionaryBuilderAppendInt().
+ArrowErrorCode ArrowDictionaryBuilderAppendDouble(struct ArrowDictionaryBuilder* builder,
+                                                  double value);
+
+/// \brief Append a binary value to a dictionary-encoded array
+///
+/// See ArrowDictionaryBuilderAppendInt().
+ArrowErrorCode ArrowDictionaryBuilderAppendBytes(struct ArrowDictionaryBuilder* builder,
+                                                 struct ArrowBufferView value);
+
+/// \brief Append a string value to a dictionary-encoded array
+///
+/// See ArrowDictionaryBuilderAppendInt().
+ArrowErrorCode ArrowDictionaryBuilderAppendString(struct ArrowDictionaryBuilder* builder,
+                                                  struct ArrowStringView value);
+
+/// \brief Append n nulls to a dictionary-encoded array
+///
+/// Nulls are represented in the indices and are not added to the dictionary.
+ArrowErrorCode ArrowDictionaryBuilderAppendNull(struct ArrowDictionaryBuilder* builder,
+                                                int64_t n);
+
+/// \brief Append the elements of a dictionary-encoded ArrowArrayView
+///
+/// Unifies the dictionary of array_view with the dictionary being built: the value
+/// of each distinct index referred to by array_view is added to the dictionary if it
+/// is not already present and the index of each element is remapped to the index
+/// of its value in the unified dictionary. Values are never decoded, so appending a
+/// batch costs one lookup per distinct index plus one remapped index per element.
+/// Elements with a null index or a null dictionary value are appended as nulls. The
+/// value type of array_view must match that of the dictionary being built. Returns
+/// EINVAL if array_view is not dictionary-encoded, its value type does not match,
+/// or one of its indices is outside its dictionary.
+ArrowErrorCode ArrowDictionaryBuilderAppendArrayView(
+    struct ArrowDictionaryBuilder* builder, struct ArrowArrayView* array_view);
+
+/// \brief Release the hash table of a dictionary builder
+///
+/// The array that was being built is not modified.
+void ArrowDictionaryBuilderReset(struct ArrowDictionaryBuilder* builder);
+
 /// @}
 
 /// \defgroup nanoarrow-array-view Reading arrays
@@ -964,6 +2326,28 @@ ArrowErrorCode ArrowArrayViewInitFromSchema(struct ArrowArrayView* array_view,
                                             struct ArrowSchema* schema,
                                             struct ArrowError* error);
 
+/// \brief Parse an ArrowSchema into an ArrowSchemaLayout
+///
+/// Parses the format string of every node of schema once such that any number of
+/// ArrowArrayViews can be initialized using ArrowArrayViewInitFromSchemaLayout()
+/// without parsing the schema again. The layout does not reference schema after this
+/// call returns. On success, the caller is responsible for calling
+/// ArrowSchemaLayoutReset().
+ArrowErrorCode ArrowSchemaLayoutInit(struct ArrowSchemaLayout* layout,
+                                     struct ArrowSchema* schema,
+                                     struct ArrowError* error);
+
+/// \brief Release the memory held by an ArrowSchemaLayout
+void ArrowSchemaLayoutReset(struct ArrowSchemaLayout* layout);
+
+/// \brief Initialize the contents of an ArrowArrayView from an ArrowSchemaLayout
+///
+/// Produces the same ArrowArrayView as ArrowArrayViewInitFromSchema() with the schema
+/// that was used to initialize layout.
+ArrowErrorCode ArrowArrayViewInitFromSchemaLayout(struct ArrowArrayView* array_view,
+                                                  const struct ArrowSchemaLayout* layout,
+                                                  struct ArrowError* error);
+
 /// \brief Allocate the array_view->children array
 ///
 /// Includes the memory for each child struct ArrowArrayView
@@ -998,6 +2382,542 @@ ArrowErrorCode ArrowArrayViewValidate(struct ArrowArrayView* array_view,
                                       enum ArrowValidationLevel validation_level,
                                       struct ArrowError* error);
 
+/// \brief Compute a hash of each element of an ArrowArrayView
+///
+/// Writes array_view->length hashes to out, which must have room for that many
+/// values, such that out[i] is a hash of element i combined with seed. Null
+/// elements hash to a value that depends only on seed; the children of a struct are
+/// combined in order such that each hash covers the entire row. Boolean, fixed-width
+/// (including fixed-size binary and decimal), binary, and string (including large
+/// and view) types are supported. Values are hashed by their bytes (e.g., 0.0 and
+/// -0.0 have different hashes) and hashes are not guaranteed to be stable across
+/// versions of nanoarrow or platforms of different endianness. Returns ENOTSUP for
+/// other types and dictionary-encoded arrays, in which case out may be partially
+/// written.
+ArrowErrorCode ArrowArrayViewHash(struct ArrowArrayView* array_view, uint64_t seed,
+                                  uint64_t* out, struct ArrowError* error);
+
+/// \brief Compute the statistics of an ArrowArrayView
+///
+/// Computes the null count, minimum, maximum, and an estimate of the number of
+/// distinct values (using a HyperLogLog sketch of the hashes of ArrowArrayViewHash())
+/// of array_view in one pass over blocks of values. Integer, floating point, decimal,
+/// binary, and string (including large, view, and fixed-size binary) types are
+/// supported. NaN values are not considered for the minimum or maximum and strings
+/// and binary values are compared lexicographically by byte. The null count is
+/// cached in array_view as for ArrowArrayViewComputeNullCount(). Returns ENOTSUP
+/// for other types and dictionary-encoded arrays.
+ArrowErrorCode ArrowArrayViewComputeStatistics(struct ArrowArrayView* array_view,
+                                               struct ArrowArrayStatistics* out,
+                                               struct ArrowError* error);
+
+/// \brief A split-block Bloom filter of 64-bit hashes
+///
+/// Each inserted hash selects one 256-bit block using its high 32 bits and sets one
+/// bit in each of the block's eight 32-bit words using its low 32 bits, as described
+/// for the Bloom filters of the Parquet format. Lookups never return a false
+/// negative. Initialize using ArrowBloomFilterInit() and release using
+/// ArrowBloomFilterReset().
+struct ArrowBloomFilter {
+  /// \brief The number of 32-byte blocks
+  int64_t n_blocks;
+
+  /// \brief The 32-bit words of the blocks in native byte order
+  struct ArrowBuffer blocks;
+};
+
+/// \brief Initialize an empty ArrowBloomFilter
+///
+/// Allocates enough blocks for n_distinct distinct hashes to be inserted with a
+/// probability of false positives of at most false_positive_rate (e.g., 0.01),
+/// using between 1 and 2^22 blocks (128 MiB). Returns EINVAL if n_distinct is
+/// negative or false_positive_rate is not between 0 and 1. On success, the caller
+/// is responsible for calling ArrowBloomFilterReset().
+ArrowErrorCode ArrowBloomFilterInit(struct ArrowBloomFilter* filter, int64_t n_distinct,
+                                    double false_positive_rate);
+
+/// \brief Insert n hashes into an ArrowBloomFilter
+void ArrowBloomFilterInsert(struct ArrowBloomFilter* filter, const uint64_t* hashes,
+                            int64_t n);
+
+/// \brief Check whether a hash may have been inserted into an ArrowBloomFilter
+///
+/// Returns zero if hash was never inserted into filter and non-zero if it may have
+/// been. A filter without blocks may contain any hash.
+int ArrowBloomFilterMightContain(const struct ArrowBloomFilter* filter, uint64_t hash);
+
+/// \brief Release the memory held by an ArrowBloomFilter
+void ArrowBloomFilterReset(struct ArrowBloomFilter* filter);
+
+/// \brief A summary of the values of one column of a batch
+struct ArrowColumnSummary {
+  /// \brief The storage type of the column
+  enum ArrowType storage_type;
+
+  /// \brief Non-zero if statistics and bloom_filter describe the values
+  ///
+  /// Only the null count of columns of types that are not supported by
+  /// ArrowArrayViewComputeStatistics() and of dictionary-encoded columns is
+  /// computed, such that they may contain any value.
+  int8_t has_statistics;
+
+  /// \brief The statistics of the column
+  ///
+  /// Binary, string, and decimal minimums and maximums refer to min_max_data.
+  struct ArrowArrayStatistics statistics;
+
+  /// \brief A Bloom filter of the hashes of the non-null values of the column
+  struct ArrowBloomFilter bloom_filter;
+
+  /// \brief The bytes of binary, string, and decimal minimums and maximums
+  struct ArrowBuffer min_max_data;
+};
+
+/// \brief Per-column summaries of a batch used to skip batches for lookups
+///
+/// Summarizes each column of a batch (e.g., a record batch of an IPC stream) by
+/// its statistics and by a Bloom filter of its values, such that a batch can be
+/// skipped without reading or decoding it when a value is outside the range of a
+/// column or is not in its Bloom filter. Summaries can be serialized such that
+/// they can be stored separately from the batch (e.g., in a sidecar file or as
+/// the value of a custom metadata key). Initialize using ArrowBatchSummaryInit() or
+/// ArrowBatchSummaryDeserialize() and release using ArrowBatchSummaryReset().
+struct ArrowBatchSummary {
+  /// \brief The number of rows of the batch
+  int64_t length;
+
+  /// \brief The number of columns of the batch
+  int64_t n_columns;
+
+  /// \brief The summary of each column
+  struct ArrowColumnSummary* columns;
+};
+
+/// \brief Summarize the columns of a batch
+///
+/// batch must be a struct ArrowArrayView whose children are the columns of the
+/// batch (the validity of batch itself is not considered). Each column is
+/// summarized using ArrowArrayViewComputeStatistics() and a Bloom filter of the
+/// hashes of its non-null values (using ArrowArrayViewHash()) whose size is chosen
+/// from the estimated number of distinct values for the given false_positive_rate.
+/// Returns EINVAL if batch is not a struct or false_positive_rate is not between 0
+/// and 1. On success, the caller is responsible for calling
+/// ArrowBatchSummaryReset().
+ArrowErrorCode ArrowBatchSummaryInit(struct ArrowBatchSummary* summary,
+                                     struct ArrowArrayView* batch,
+                                     double false_positive_rate,
+                                     struct ArrowError* error);
+
+/// \brief Check whether a column of a summarized batch may contain values
+///
+/// Writes values->length bytes to out such that out[j] is zero if column i of the
+/// summarized batch does not contain element j of values and one if it may. A null
+/// value may only be contained by a column with nulls; a non-null value may only be
+/// contained if it is within the minimum and maximum of the column and its hash is
+/// in the column's Bloom filter. values must have the storage type of the column
+/// and must not be dictionary-encoded (e.g., an array of one element for a point
+/// lookup) or EINVAL is returned.
+ArrowErrorCode ArrowBatchSummaryMightContain(const struct ArrowBatchSummary* summary,
+                                             int64_t i, struct ArrowArrayView* values,
+                                             uint8_t* out, struct ArrowError* error);
+
+/// \brief Serialize an ArrowBatchSummary
+///
+/// Appends a versioned, little-endian serialization of summary to out. Because
+/// Bloom filters contain hashes of ArrowArrayViewHash(), which are not guaranteed
+/// to be stable across versions of nanoarrow, the serialization should only be
+/// read by the version of nanoarrow that wrote it.
+ArrowErrorCode ArrowBatchSummarySerialize(const struct ArrowBatchSummary* summary,
+                                          struct ArrowBuffer* out);
+
+/// \brief Deserialize an ArrowBatchSummary written by ArrowBatchSummarySerialize()
+///
+/// The summary does not refer to data after this call. Returns EINVAL if data is not
+/// a valid serialization. On success, the caller is responsible for calling
+/// ArrowBatchSummaryReset().
+ArrowErrorCode ArrowBatchSummaryDeserialize(struct ArrowBatchSummary* summary,
+                                            struct ArrowBufferView data,
+                                            struct ArrowError* error);
+
+/// \brief Release the memory held by an ArrowBatchSummary
+void ArrowBatchSummaryReset(struct ArrowBatchSummary* summary);
+
+/// \brief Decode elements of a dictionary-encoded ArrowArrayView
+///
+/// Writes the dictionary values of elements i, ..., i + n - 1 of array_view to out
+/// without materializing an array. If the dictionary is a binary or string type
+/// (including large and view types), out must have space for n ArrowStringViews
+/// that refer to the buffers of the dictionary; if the dictionary is a fixed-width
+/// type other than boolean, out must have space for n values of its element size.
+/// Null entries yield a NULL view (i.e., data is NULL and size_bytes is 0) or zeroed
+/// bytes; the validity of dictionary values is not considered. Returns EINVAL if
+/// array_view is not dictionary-encoded, the requested range is out of bounds, or a
+/// non-null index is outside the dictionary, and ENOTSUP for other dictionary types.
+ArrowErrorCode ArrowArrayViewDecodeDictionary(struct ArrowArrayView* array_view,
+                                              int64_t i, int64_t n, void* out,
+                                              struct ArrowError* error);
+
+/// \brief Convert the values of an ArrowArrayView to another numeric type
+///
+/// Initializes out with the values of array_view, whose type is source_type,
+/// converted to target_type. Integer, floating point, decimal128, date, timestamp,
+/// time, and duration types are supported: integers and decimals are converted to
+/// each other and to floating point types (rescaling decimals), dates and
+/// timestamps are converted to each other by their units (as are times and
+/// durations), and temporal types are converted to and from integers by their
+/// stored value. Values are converted in blocks whose range is checked in bulk
+/// before they are written; unless permitted by options (see enum
+/// ArrowCastOptions), non-null values that overflow target_type return EOVERFLOW
+/// and values that would lose precision return EINVAL. Decimals whose unscaled
+/// values do not fit in an int64_t are considered to overflow. Decimal128 and
+/// decimal256 values can also be formatted as string or large string values using
+/// ArrowDecimalAppendStringToBuffer() in a single pass. When no conversion
+/// is required (e.g., date32 to int32) and array_view->array is set, out shares
+/// the buffers of array_view->array using ArrowArraySlice() (see the notes on the
+/// source array there). Returns ENOTSUP for other types, pairs of types that
+/// cannot be converted, and dictionary-encoded arrays. On error, out is released.
+ArrowErrorCode ArrowArrayViewCast(struct ArrowArrayView* array_view,
+                                  const struct ArrowSchemaView* source_type,
+                                  const struct ArrowSchemaView* target_type,
+                                  int options, struct ArrowArray* out,
+                                  struct ArrowError* error);
+
+/// \brief Truncate the values of a temporal ArrowArrayView to calendar buckets
+///
+/// Initializes out with the values of array_view, whose type is a date32, date64,
+/// timestamp, or duration, rounded towards negative infinity to the start of a
+/// bucket of multiple units (e.g., 15 NANOARROW_CALENDAR_UNIT_MINUTE). out has the
+/// type of array_view. Buckets are counted from the Unix epoch in UTC (regardless
+/// of the timezone of a timestamp) such that buckets of days start at midnight,
+/// buckets of weeks start on a Monday (the first of which is 1970-01-05), and
+/// buckets of months and years start on January 1st, 1970 (e.g., 3 months are
+/// quarters). Weeks of durations are counted from zero. Values are truncated in
+/// blocks whose range is checked in bulk; to convert between units or from
+/// timestamps to dates, use ArrowArrayViewCast(). Returns EINVAL if multiple is not
+/// positive or if the buckets are neither a multiple nor a divisor of the unit of
+/// type (e.g., 1500 milliseconds for a timestamp in seconds), EOVERFLOW if the
+/// buckets or the start of the bucket of a non-null value cannot be represented,
+/// and ENOTSUP for other types, for months and years of durations, and for
+/// dictionary-encoded arrays. On error, out is released.
+ArrowErrorCode ArrowArrayViewTemporalTruncate(struct ArrowArrayView* array_view,
+                                              const struct ArrowSchemaView* type,
+                                              enum ArrowCalendarUnit unit,
+                                              int64_t multiple, struct ArrowArray* out,
+                                              struct ArrowError* error);
+
+/// \brief Compute the indices that sort an ArrowArrayView
+///
+/// Writes array_view->length indices to out, which must have room for that many
+/// values, such that elements out[0], out[1], ... of array_view are in sorted
+/// order (e.g., for use with ArrowArrayAppendTake()). The sort is stable: equal
+/// elements and nulls keep their original order. Boolean, integer, floating point
+/// (with NaN after all other values), and temporal types are sorted with an LSD
+/// radix sort of keys whose unsigned order is the order of the values; binary and
+/// string types (including large, view, and fixed-size binary) are radix sorted by
+/// their first eight bytes, after which values that share a prefix are compared in
+/// full. Struct arrays are sorted lexicographically by their children. Nulls are
+/// placed according to options (see enum ArrowSortOptions), which apply to every
+/// child of a struct. Returns ENOTSUP for other types and for dictionary-encoded
+/// arrays.
+ArrowErrorCode ArrowArrayViewSortIndices(struct ArrowArrayView* array_view, int options,
+                                         int64_t* out, struct ArrowError* error);
+
+/// \brief A sparse index of a sorted ArrowArrayView
+///
+/// Holds the sort keys (see ArrowArrayViewSortIndices()) of every stride-th non-null
+/// element of a sorted array in a contiguous buffer, which can be searched before
+/// the array itself to narrow a binary search to a few blocks of the array.
+/// Initialize using ArrowArrayViewFenceInit() and release using
+/// ArrowArrayViewFenceReset().
+struct ArrowArrayViewFence {
+  /// \brief The number of elements between fence keys
+  int64_t stride;
+
+  /// \brief The range [begin, end) of the non-null elements of the array
+  int64_t begin;
+  int64_t end;
+
+  /// \brief The number of fence keys
+  int64_t n_keys;
+
+  /// \brief The key of element begin + i * stride of the array
+  uint64_t* keys;
+};
+
+/// \brief Initialize an ArrowArrayViewFence from a sorted ArrowArrayView
+///
+/// array_view must meet the requirements of ArrowArrayViewLowerBound() and keep
+/// the same contents while the fence is used to search it. Returns EINVAL if
+/// stride is not positive or ENOTSUP for unsupported types. On success, the caller
+/// is responsible for calling ArrowArrayViewFenceReset().
+ArrowErrorCode ArrowArrayViewFenceInit(struct ArrowArrayViewFence* fence,
+                                       struct ArrowArrayView* array_view,
+                                       int64_t stride, struct ArrowError* error);
+
+/// \brief Release the memory held by an ArrowArrayViewFence
+void ArrowArrayViewFenceReset(struct ArrowArrayViewFence* fence);
+
+/// \brief Find the first element of a sorted ArrowArrayView not less than a value
+///
+/// Sets out to the index of the first non-null element of array_view that is not
+/// less than value, or to the end of the non-null elements if there is no such
+/// element. The non-null elements of array_view must be sorted in ascending order
+/// as defined by ArrowArrayViewSortIndices() and its nulls must be placed before or
+/// after all other elements. value is a signed integer (as_int64), unsigned integer
+/// or boolean (as_uint64), floating point (as_double), or binary or string
+/// (as_bytes) value of the same kind as the storage type of array_view. The search
+/// is a binary search in O(log n), which first searches fence if it is not NULL
+/// (see ArrowArrayViewFenceInit()). Combined with ArrowArrayViewUpperBound(), the
+/// result can be used to slice the elements in a range of values without copying
+/// (e.g., using ArrowArraySlice()). Returns ENOTSUP for other types and
+/// dictionary-encoded arrays.
+ArrowErrorCode ArrowArrayViewLowerBound(struct ArrowArrayView* array_view,
+                                        const union ArrowStatisticsValue* value,
+                                        const struct ArrowArrayViewFence* fence,
+                                        int64_t* out, struct ArrowError* error);
+
+/// \brief Find the first element of a sorted ArrowArrayView greater than a value
+///
+/// Like ArrowArrayViewLowerBound() but sets out to the index of the first
+/// non-null element of array_view that is greater than value.
+ArrowErrorCode ArrowArrayViewUpperBound(struct ArrowArrayView* array_view,
+                                        const union ArrowStatisticsValue* value,
+                                        const struct ArrowArrayViewFence* fence,
+                                        int64_t* out, struct ArrowError* error);
+
+/// \brief A hash table that assigns dense group ids to distinct keys
+///
+/// Keys are the elements of ArrowArrayViews of the same type (e.g., a struct whose
+/// children are the key columns). Distinct keys are assigned ids 0, 1, ... in order
+/// of first appearance across all consumed batches. Initialize using
+/// ArrowGrouperInit() and release using ArrowGrouperReset().
+struct ArrowGrouper {
+  /// \brief The number of distinct keys consumed so far
+  int64_t n_groups;
+
+  /// \brief Private data used by the implementation
+  void* private_data;
+};
+
+/// \brief Initialize an ArrowGrouper for keys of a given type
+///
+/// On success, the caller is responsible for calling ArrowGrouperReset().
+ArrowErrorCode ArrowGrouperInit(struct ArrowGrouper* grouper, struct ArrowSchema* schema,
+                                struct ArrowError* error);
+
+/// \brief Assign a group id to each element of an ArrowArrayView
+///
+/// Writes array_view->length group ids to group_ids, which must have room for that
+/// many values, adding groups for keys that have not been seen before. Keys are
+/// hashed in bulk using ArrowArrayViewHash() and looked up in an open addressing
+/// table; two keys are equal if they are both null or if their values have the
+/// same bytes (e.g., 0.0 and -0.0 are different keys). The keys of new groups are
+/// copied using ArrowArrayAppendTake(), such that array_view may be released after
+/// this call. array_view must be of the type passed to ArrowGrouperInit() and of a
+/// type supported by both ArrowArrayViewHash() and ArrowArrayAppendTake().
+ArrowErrorCode ArrowGrouperConsume(struct ArrowGrouper* grouper,
+                                   struct ArrowArrayView* array_view, int64_t* group_ids,
+                                   struct ArrowError* error);
+
+/// \brief Copy the key of each group into a new array
+///
+/// Element i of out is the key of group i.
+ArrowErrorCode ArrowGrouperGetKeys(struct ArrowGrouper* grouper, struct ArrowArray* out,
+                                   struct ArrowError* error);
+
+/// \brief Release the memory held by an ArrowGrouper
+void ArrowGrouperReset(struct ArrowGrouper* grouper);
+
+/// \brief Accumulators of an aggregate function for each group
+///
+/// Initialize using ArrowGroupedAggregateInit(), update with the group ids assigned
+/// to each batch by ArrowGrouperConsume() using ArrowGroupedAggregateUpdate(), and
+/// release using ArrowGroupedAggregateReset().
+struct ArrowGroupedAggregate {
+  /// \brief The aggregate function
+  enum ArrowAggregateFunction function;
+
+  /// \brief The storage type of aggregated values
+  enum ArrowType storage_type;
+
+  /// \brief The number of groups with an accumulator
+  int64_t n_groups;
+
+  /// \brief The int64_t or double accumulator of each group
+  struct ArrowBuffer values;
+
+  /// \brief The number of values aggregated for each group
+  struct ArrowBuffer counts;
+};
+
+/// \brief Initialize an ArrowGroupedAggregate
+///
+/// Boolean, integer, and floating point storage types are supported by every
+/// function; NANOARROW_AGGREGATE_COUNT supports any type. Integer values are
+/// aggregated as int64_t and floating point values as double. Returns ENOTSUP for
+/// other types. The caller is responsible for calling ArrowGroupedAggregateReset().
+ArrowErrorCode ArrowGroupedAggregateInit(struct ArrowGroupedAggregate* aggregate,
+                                         enum ArrowAggregateFunction function,
+                                         enum ArrowType storage_type,
+                                         struct ArrowError* error);
+
+/// \brief Aggregate each element of an ArrowArrayView into its group
+///
+/// Element i of array_view is aggregated into the accumulator of group_ids[i],
+/// each of which must be less than n_groups. Values are read in blocks with
+/// ArrowArrayViewGetIntsUnsafe() or ArrowArrayViewGetDoublesUnsafe(). Returns
+/// EOVERFLOW if an integer sum or unsigned value overflows an int64_t.
+ArrowErrorCode ArrowGroupedAggregateUpdate(struct ArrowGroupedAggregate* aggregate,
+                                           struct ArrowArrayView* array_view,
+                                           const int64_t* group_ids, int64_t n_groups,
+                                           struct ArrowError* error);
+
+/// \brief Write the result of each of n_groups groups to a new array
+///
+/// Initializes out as an int64 (for counts and integer values) or double array
+/// whose element i is the result of group i. The sum, minimum, and maximum of a
+/// group without any values is null.
+ArrowErrorCode ArrowGroupedAggregateFinish(struct ArrowGroupedAggregate* aggregate,
+                                           int64_t n_groups, struct ArrowArray* out,
+                                           struct ArrowError* error);
+
+/// \brief Release the memory held by an ArrowGroupedAggregate
+void ArrowGroupedAggregateReset(struct ArrowGroupedAggregate* aggregate);
+
+/// \brief Evaluate a string predicate for each element of an ArrowArrayView
+///
+/// Sets bit i of out if element i of array_view is non-null and satisfies
+/// predicate for pattern (see enum ArrowStringPredicate) and clears it otherwise.
+/// out must have room for array_view->length bits, all of whose bytes are
+/// overwritten. For string, binary, large string, and large binary arrays,
+/// NANOARROW_STRING_CONTAINS scans the data buffer as a whole for the first byte of
+/// pattern and uses the offsets only to find the element containing each candidate
+/// match; the other predicates only compare the bytes of values whose length allows
+/// a match. String view, binary view, and fixed-size binary arrays are also
+/// supported. Returns ENOTSUP for other types and for dictionary-encoded arrays.
+ArrowErrorCode ArrowArrayViewMatchStrings(struct ArrowArrayView* array_view,
+                                          enum ArrowStringPredicate predicate,
+                                          struct ArrowStringView pattern, uint8_t* out,
+                                          struct ArrowError* error);
+
+/// \brief Compute the length of each list of an ArrowArrayView
+///
+/// Writes array_view->length lengths to out from the differences between
+/// consecutive offsets (or the list size of a fixed-size list) without inspecting
+/// the validity bitmap. Supports list, large list, map, and fixed-size list arrays;
+/// returns ENOTSUP for other types.
+ArrowErrorCode ArrowArrayViewListLengths(struct ArrowArrayView* array_view, int64_t* out,
+                                         struct ArrowError* error);
+
+/// \brief Compute the index of the list that references each value of its child
+///
+/// Writes the index (from 0 to array_view->length - 1) of the list containing each
+/// child value referenced by array_view to out, which must have room for
+/// ArrowArrayViewListChildOffset(array_view, array_view->offset +
+/// array_view->length) - ArrowArrayViewListChildOffset(array_view,
+/// array_view->offset) values (or the length multiplied by the list size of a
+/// fixed-size list). Together with ArrowArrayViewListFlatten(), these indices
+/// unnest the lists of array_view (e.g., to take the corresponding values of other
+/// columns with ArrowArrayAppendTake()). Supports the types supported by
+/// ArrowArrayViewListLengths().
+ArrowErrorCode ArrowArrayViewListParentIds(struct ArrowArrayView* array_view,
+                                           int64_t* out, struct ArrowError* error);
+
+/// \brief Create a zero-copy slice of the child values referenced by the lists
+///
+/// Initializes out with the range of array_view->array->children[0] referenced by
+/// the lists of array_view using ArrowArraySlice() (see the notes on the source
+/// array there), whose values correspond to those computed by
+/// ArrowArrayViewListParentIds(). array_view must have been set from an ArrowArray
+/// using ArrowArrayViewSetArray(); returns EINVAL otherwise or if the offsets are
+/// out of range of the child. Supports the types supported by
+/// ArrowArrayViewListLengths().
+ArrowErrorCode ArrowArrayViewListFlatten(struct ArrowArrayView* array_view,
+                                         struct ArrowArray* out,
+                                         struct ArrowError* error);
+
+/// \brief Partition a range of a union ArrowArrayView by child
+///
+/// Writes the number of elements in elements offset, ..., offset + length - 1 of
+/// array_view that refer to each child to child_counts (which must have room for
+/// array_view->n_children values) and the index of each element to rows (which must
+/// have room for length values), grouped by child index in increasing order. The
+/// indices of elements of child i are rows[child_counts[0] + ... + child_counts[i -
+/// 1]], ... in increasing order, so that the values of each child can be processed
+/// in homogeneous loops. If child_offsets is not NULL, the offset of each element
+/// into its child (i.e., ArrowArrayViewUnionChildOffset() including
+/// array_view->offset) is written to the same position. Type ids are counted in one
+/// pass and mapped to children once per type id. Returns EINVAL for type ids that do
+/// not refer to a child and ENOTSUP if array_view is not a union.
+ArrowErrorCode ArrowArrayViewUnionSelect(struct ArrowArrayView* array_view,
+                                         int64_t offset, int64_t length,
+                                         int64_t* child_counts, int64_t* rows,
+                                         int64_t* child_offsets,
+                                         struct ArrowError* error);
+
+/// \brief Look up keys in each element of a map ArrowArrayView
+///
+/// For each of n_keys keys, writes array_view->length indices to out (i.e., the
+/// indices for key k start at out + k * array_view->length). Each index is the
+/// position in array_view->children[0]->children[0] of the first key of the map that
+/// is equal to the key (which is also the position of its value in
+/// array_view->children[0]->children[1]) or -1 if the map is null or does not
+/// contain the key. Keys of string, binary, large string, large binary, string
+/// view, binary view, or fixed-size binary type are supported. By default, all
+/// keys referenced by array_view are compared in one pass using
+/// ArrowArrayViewMatchStrings(); with NANOARROW_MAP_LOOKUP_KEYS_SORTED the keys of
+/// each map are binary searched. Returns ENOTSUP for other types.
+ArrowErrorCode ArrowArrayViewMapLookup(struct ArrowArrayView* array_view,
+                                       const struct ArrowStringView* keys, int64_t n_keys,
+                                       int options, int64_t* out,
+                                       struct ArrowError* error);
+
+/// \brief Run-end encode an ArrowArrayView
+///
+/// Initializes out as a run-end encoded array whose run ends have type run_end_type
+/// (int16, int32, or int64) and whose values have the structure of array_view, such
+/// that each run of adjacent equal elements of array_view is stored once. Adjacent
+/// elements are compared in blocks: fixed-width values are compared byte-wise (one
+/// word at a time for widths of 1, 2, 4, or 8 bytes), binary and string values
+/// (including large types) with memcmp(), and nulls are equal to each other but not
+/// to any value. The values of the runs are appended with ArrowArrayAppendTake().
+/// Returns EOVERFLOW if array_view is too long for run_end_type and ENOTSUP for
+/// nested, dictionary-encoded, null, and binary or string view arrays. On error, out
+/// is released.
+ArrowErrorCode ArrowArrayViewRunEndEncode(struct ArrowArrayView* array_view,
+                                          enum ArrowType run_end_type,
+                                          struct ArrowArray* out,
+                                          struct ArrowError* error);
+
+/// \brief Expand a run-end encoded ArrowArrayView
+///
+/// Initializes out with the elements of the run-end encoded array_view as an array
+/// with the structure of its values. Fixed-width and boolean values (and their
+/// validity) are filled one run at a time in bulk; other values are appended with
+/// ArrowArrayAppendTake() in blocks. Returns EINVAL if array_view is not run-end
+/// encoded or its run ends are invalid and ENOTSUP for values that are not
+/// supported by ArrowArrayViewRunEndEncode(). On error, out is released.
+ArrowErrorCode ArrowArrayViewRunEndDecode(struct ArrowArrayView* array_view,
+                                          struct ArrowArray* out,
+                                          struct ArrowError* error);
+
+/// \brief Check two ArrowArrayViews for equality
+///
+/// Returns non-zero if lhs and rhs have the same layout (recursively), the same
+/// length, and the same elements, where elements are equal if they are both null or
+/// both non-null with equal values. Values of fixed-width types are compared
+/// byte-wise (floating point values can be compared numerically by passing
+/// NANOARROW_ARRAY_COMPARE_FLOAT_VALUES); the contents of buffers behind null
+/// elements and offsets are not compared. Ranges of elements that are non-null in
+/// both are compared with memcmp() where possible and validity bitmaps are compared
+/// 64 bits at a time regardless of each view's offset. Dictionary-encoded views are
+/// equal if both dictionaries are equal and their indices are equal. If lhs and rhs
+/// are not equal and first_difference is not NULL, it is set to the first row
+/// that differs, to the length of the shorter view if one is a prefix of the other,
+/// or to -1 if the layouts or dictionaries differ.
+int ArrowArrayViewEquals(struct ArrowArrayView* lhs, struct ArrowArrayView* rhs,
+                         int options, int64_t* first_difference);
+
 /// \brief Reset the contents of an ArrowArrayView and frees resources
 void ArrowArrayViewReset(struct ArrowArrayView* array_view);
 
@@ -1016,6 +2936,23 @@ static inline int8_t ArrowArrayViewUnionChildIndex(struct ArrowArrayView* array_
 static inline int64_t ArrowArrayViewUnionChildOffset(struct ArrowArrayView* array_view,
                                                      int64_t i);
 
+/// \brief Compute and cache the null count of an ArrowArrayView
+///
+/// Returns array_view->null_count if it is known (i.e., >= 0); otherwise, counts the
+/// null elements of array_view, stores the result in array_view->null_count, and
+/// returns it. The buffer views of array_view are not modified and the null counts of
+/// children are not computed.
+static inline int64_t ArrowArrayViewComputeNullCount(struct ArrowArrayView* array_view);
+
+/// \brief Get the index into the values child of a run-end encoded array element
+///
+/// Uses a binary search of the run_ends child to find the run containing element i.
+/// Returns -1 if array_view is not a run-end encoded array. The element accessors
+/// (e.g., ArrowArrayViewIsNull() and ArrowArrayViewGetIntUnsafe()) use this to look
+/// up the value of a run-end encoded element.
+static inline int64_t ArrowArrayViewRunEndPhysicalIndex(struct ArrowArrayView* array_view,
+                                                        int64_t i);
+
 /// \brief Get an element in an ArrowArrayView as an integer
 ///
 /// This function does not check for null values, that values are actually integers, or
@@ -1049,6 +2986,33 @@ static inline struct ArrowStringView ArrowArrayViewGetStringUnsafe(
 static inline struct ArrowBufferView ArrowArrayViewGetBytesUnsafe(
     struct ArrowArrayView* array_view, int64_t i);
 
+/// \brief Get elements [i, i + n) of an ArrowArrayView as integers
+///
+/// Equivalent to calling ArrowArrayViewGetIntUnsafe() for each element but uses a
+/// loop specialized for the storage type of array_view. out must have space for n
+/// values. This function does not check for null values, that values are actually
+/// integers, or that values are within a valid range for an int64.
+static inline void ArrowArrayViewGetIntsUnsafe(struct ArrowArrayView* array_view,
+                                               int64_t i, int64_t n, int64_t* out);
+
+/// \brief Get elements [i, i + n) of an ArrowArrayView as doubles
+///
+/// Equivalent to calling ArrowArrayViewGetDoubleUnsafe() for each element but uses a
+/// loop specialized for the storage type of array_view. out must have space for n
+/// values. This function does not check for null values, or that values are within a
+/// valid range for a double.
+static inline void ArrowArrayViewGetDoublesUnsafe(struct ArrowArrayView* array_view,
+                                                  int64_t i, int64_t n, double* out);
+
+/// \brief Get elements [i, i + n) of an ArrowArrayView as ArrowStringViews
+///
+/// Equivalent to calling ArrowArrayViewGetStringUnsafe() for each element but uses a
+/// loop specialized for the storage type of array_view. out must have space for n
+/// values. This function does not check for null values.
+static inline void ArrowArrayViewGetStringsUnsafe(struct ArrowArrayView* array_view,
+                                                  int64_t i, int64_t n,
+                                                  struct ArrowStringView* out);
+
 /// \brief Get an element in an ArrowArrayView as an ArrowDecimal
 ///
 /// This function does not check for null values. The out parameter must
@@ -1057,6 +3021,172 @@ static inline struct ArrowBufferView ArrowArrayViewGetBytesUnsafe(
 static inline void ArrowArrayViewGetDecimalUnsafe(struct ArrowArrayView* array_view,
                                                   int64_t i, struct ArrowDecimal* out);
 
+/// \brief Get the dictionary value of an element in a dictionary-encoded
+/// ArrowArrayView as an integer
+///
+/// Equivalent to calling ArrowArrayViewGetIntUnsafe() on array_view->dictionary
+/// with the index of element i. This function does not check for null values
+/// (of the index or of the dictionary value) or that the index is within the
+/// bounds of the dictionary.
+static inline int64_t ArrowArrayViewGetDictionaryIntUnsafe(
+    struct ArrowArrayView* array_view, int64_t i);
+
+/// \brief Get the dictionary value of an element in a dictionary-encoded
+/// ArrowArrayView as an unsigned integer
+///
+/// See ArrowArrayViewGetDictionaryIntUnsafe().
+static inline uint64_t ArrowArrayViewGetDictionaryUIntUnsafe(
+    struct ArrowArrayView* array_view, int64_t i);
+
+/// \brief Get the dictionary value of an element in a dictionary-encoded
+/// ArrowArrayView as a double
+///
+/// See ArrowArrayViewGetDictionaryIntUnsafe().
+static inline double ArrowArrayViewGetDictionaryDoubleUnsafe(
+    struct ArrowArrayView* array_view, int64_t i);
+
+/// \brief Get the dictionary value of an element in a dictionary-encoded
+/// ArrowArrayView as an ArrowStringView
+///
+/// See ArrowArrayViewGetDictionaryIntUnsafe().
+static inline struct ArrowStringView ArrowArrayViewGetDictionaryStringUnsafe(
+    struct ArrowArrayView* array_view, int64_t i);
+
+/// \brief Get the dictionary value of an element in a dictionary-encoded
+/// ArrowArrayView as an ArrowBufferView
+///
+/// See ArrowArrayViewGetDictionaryIntUnsafe().
+static inline struct ArrowBufferView ArrowArrayViewGetDictionaryBytesUnsafe(
+    struct ArrowArrayView* array_view, int64_t i);
+
+/// \brief A non-owning view of a sequence of arrays of the same type as one array
+///
+/// Holds an ArrowArrayView of each chunk and the index of the first element of each
+/// chunk in the sequence, such that the chunk containing an element is found by a
+/// binary search in O(log n_chunks) without concatenating the chunks. Initialize
+/// using ArrowChunkedArrayViewInitFromSchema(), add chunks using
+/// ArrowChunkedArrayViewAppendArray(), and release using
+/// ArrowChunkedArrayViewReset(). The arrays must outlive the view.
+struct ArrowChunkedArrayView {
+  /// \brief The number of chunks
+  int64_t n_chunks;
+
+  /// \brief A view of each chunk
+  struct ArrowArrayView* chunks;
+
+  /// \brief The index of the first element of each chunk followed by length
+  /// (i.e., n_chunks + 1 values)
+  int64_t* chunk_offsets;
+
+  /// \brief The total number of elements of all chunks
+  int64_t length;
+
+  /// \brief The total number of null elements of all chunks
+  int64_t null_count;
+
+  /// \brief The number of chunks for which chunks and chunk_offsets have room
+  int64_t capacity;
+
+  /// \brief A copy of the schema from which the view of each chunk is initialized
+  struct ArrowSchema schema;
+};
+
+/// \brief Initialize an empty ArrowChunkedArrayView for arrays of a given schema
+///
+/// schema is copied and checked in the same way as by ArrowArrayViewInitFromSchema().
+/// On success, the caller is responsible for calling ArrowChunkedArrayViewReset().
+ArrowErrorCode ArrowChunkedArrayViewInitFromSchema(
+    struct ArrowChunkedArrayView* chunked_array_view, struct ArrowSchema* schema,
+    struct ArrowError* error);
+
+/// \brief Append a view of an array to an ArrowChunkedArrayView
+///
+/// Sets a view of array using ArrowArrayViewSetArray() (i.e., with default
+/// validation), computes its null count if unknown, and appends it as the last
+/// chunk. array is not copied and must outlive chunked_array_view.
+ArrowErrorCode ArrowChunkedArrayViewAppendArray(
+    struct ArrowChunkedArrayView* chunked_array_view, struct ArrowArray* array,
+    struct ArrowError* error);
+
+/// \brief Release the memory held by an ArrowChunkedArrayView
+void ArrowChunkedArrayViewReset(struct ArrowChunkedArrayView* chunked_array_view);
+
+/// \brief Find the chunk containing element i of an ArrowChunkedArrayView
+///
+/// Returns the index of the (non-empty) chunk containing element i, whose index
+/// within the chunk is i - chunked_array_view->chunk_offsets[chunk]. i must be
+/// between 0 and chunked_array_view->length - 1.
+static inline int64_t ArrowChunkedArrayViewFindChunk(
+    const struct ArrowChunkedArrayView* chunked_array_view, int64_t i);
+
+/// \brief Find the part of a range of an ArrowChunkedArrayView within one chunk
+///
+/// Sets chunk to the index of the chunk containing element i and chunk_i to the
+/// index of element i within that chunk, and returns the number of elements of
+/// [i, end) in that chunk. A range can be processed chunk by chunk using
+/// `for (int64_t n = 0; i < end; i += n)` where n is the result of this function.
+/// i must be less than end and end must be at most chunked_array_view->length.
+static inline int64_t ArrowChunkedArrayViewChunkRange(
+    const struct ArrowChunkedArrayView* chunked_array_view, int64_t i, int64_t end,
+    int64_t* chunk, int64_t* chunk_i);
+
+/// \brief Check for a null element in an ArrowChunkedArrayView
+static inline int8_t ArrowChunkedArrayViewIsNull(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i);
+
+/// \brief Get an element of an ArrowChunkedArrayView as an integer
+///
+/// See ArrowArrayViewGetIntUnsafe().
+static inline int64_t ArrowChunkedArrayViewGetIntUnsafe(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i);
+
+/// \brief Get an element of an ArrowChunkedArrayView as an unsigned integer
+///
+/// See ArrowArrayViewGetUIntUnsafe().
+static inline uint64_t ArrowChunkedArrayViewGetUIntUnsafe(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i);
+
+/// \brief Get an element of an ArrowChunkedArrayView as a double
+///
+/// See ArrowArrayViewGetDoubleUnsafe().
+static inline double ArrowChunkedArrayViewGetDoubleUnsafe(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i);
+
+/// \brief Get an element of an ArrowChunkedArrayView as an ArrowStringView
+///
+/// See ArrowArrayViewGetStringUnsafe().
+static inline struct ArrowStringView ArrowChunkedArrayViewGetStringUnsafe(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i);
+
+/// \brief Get an element of an ArrowChunkedArrayView as an ArrowBufferView
+///
+/// See ArrowArrayViewGetBytesUnsafe().
+static inline struct ArrowBufferView ArrowChunkedArrayViewGetBytesUnsafe(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i);
+
+/// \brief Get elements [i, i + n) of an ArrowChunkedArrayView as integers
+///
+/// Equivalent to ArrowArrayViewGetIntsUnsafe() for the range of each chunk that
+/// overlaps [i, i + n), which may span any number of chunks. out must have space
+/// for n values.
+static inline void ArrowChunkedArrayViewGetIntsUnsafe(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i, int64_t n,
+    int64_t* out);
+
+/// \brief Get elements [i, i + n) of an ArrowChunkedArrayView as doubles
+///
+/// See ArrowChunkedArrayViewGetIntsUnsafe() and ArrowArrayViewGetDoublesUnsafe().
+static inline void ArrowChunkedArrayViewGetDoublesUnsafe(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i, int64_t n,
+    double* out);
+
+/// \brief Get elements [i, i + n) of an ArrowChunkedArrayView as ArrowStringViews
+///
+/// See ArrowChunkedArrayViewGetIntsUnsafe() and ArrowArrayViewGetStringsUnsafe().
+static inline void ArrowChunkedArrayViewGetStringsUnsafe(
+    struct ArrowChunkedArrayView* chunked_array_view, int64_t i, int64_t n,
+    struct ArrowStringView* out);
+
 /// @}
 
 /// \defgroup nanoarrow-basic-array-stream Basic ArrowArrayStream implementation
@@ -1086,16 +3216,164 @@ ArrowErrorCode ArrowBasicArrayStreamInit(struct ArrowArrayStream* array_stream,
 void ArrowBasicArrayStreamSetArray(struct ArrowArrayStream* array_stream, int64_t i,
                                    struct ArrowArray* array);
 
+/// \brief Hand out shared references to the schema of this ArrowArrayStream
+///
+/// array_stream must have been initialized with ArrowBasicArrayStreamInit(). If
+/// share_schema is non-zero, get_schema() returns a reference created by
+/// ArrowSchemaShare() instead of a deep copy.
+void ArrowBasicArrayStreamSetShareSchema(struct ArrowArrayStream* array_stream,
+                                         char share_schema);
+
 /// \brief Validate the contents of this ArrowArrayStream
 ///
 /// array_stream must have been initialized with ArrowBasicArrayStreamInit().
-/// This function uses ArrowArrayStreamInitFromSchema() and ArrowArrayStreamSetArray()
-/// to validate the contents of the arrays.
+/// This function initializes a single ArrowArrayView using
+/// ArrowArrayViewInitFromSchema() and reuses it to validate the contents of each
+/// array with ArrowArrayViewSetArray().
 ArrowErrorCode ArrowBasicArrayStreamValidate(struct ArrowArrayStream* array_stream,
                                              struct ArrowError* error);
 
 /// @}
 
+/// \defgroup nanoarrow-rebatch-array-stream Rebatching ArrowArrayStream implementation
+///
+/// An implementation of an ArrowArrayStream that wraps another ArrowArrayStream
+/// and re-chunks its arrays to a target length.
+///
+/// @{
+
+/// \brief Initialize an ArrowArrayStream that re-chunks input to target_length
+///
+/// Each array returned by the stream has exactly
+/// target_length elements except the last, which contains any remainder. Input
+/// arrays that are longer than needed are split using zero-copy ArrowArraySlice()
+/// and the pieces of shorter input arrays are combined with ArrowArrayConcatenate()
+/// (which does not support dictionary-encoded arrays). If the next output consists
+/// of a single piece, it is returned without copying. Errors from the input stream
+/// are propagated with its get_last_error() message. If this function returns
+/// NANOARROW_OK, this function moves the ownership of input to array_stream and
+/// the caller is responsible for releasing the ArrowArrayStream.
+ArrowErrorCode ArrowRebatchArrayStreamInit(struct ArrowArrayStream* array_stream,
+                                           struct ArrowArrayStream* input,
+                                           int64_t target_length,
+                                           struct ArrowError* error);
+
+/// @}
+
+/// \defgroup nanoarrow-instrumented-array-stream Instrumented ArrowArrayStream
+///
+/// An implementation of an ArrowArrayStream that wraps another ArrowArrayStream
+/// (e.g., an ArrowBasicArrayStream or an IPC reader) and records how many arrays,
+/// rows, and bytes flowed through it and how long its get_next() took.
+///
+/// @{
+
+/// \brief Initialize an ArrowArrayStream that records statistics about input
+///
+/// get_schema(), get_next(), and get_last_error() are forwarded to input unchanged.
+/// instrumentation may be NULL, in which case only batches, rows, and errors are
+/// counted. If this function returns NANOARROW_OK, this function moves the ownership
+/// of input to array_stream and the caller is responsible for releasing the
+/// ArrowArrayStream.
+ArrowErrorCode ArrowInstrumentedArrayStreamInit(
+    struct ArrowArrayStream* array_stream, struct ArrowArrayStream* input,
+    struct ArrowArrayStreamInstrumentation* instrumentation, struct ArrowError* error);
+
+/// \brief Retrieve the statistics accumulated by an instrumented ArrowArrayStream
+///
+/// array_stream must have been initialized with ArrowInstrumentedArrayStreamInit().
+void ArrowInstrumentedArrayStreamGetStats(struct ArrowArrayStream* array_stream,
+                                          struct ArrowArrayStreamStats* out);
+
+/// @}
+
+/// \defgroup nanoarrow-spilling-array-stream Spilling ArrowArrayStream
+///
+/// An implementation of an ArrowArrayStream that queues arrays pushed by a producer
+/// until a consumer requests them, writing arrays that would exceed a memory budget
+/// to a temporary file (see ArrowArrayWriteRelocatable()) such that memory remains
+/// bounded when the consumer falls behind. Spilled arrays are memory-mapped when
+/// they are read back (where mmap() is available) and are returned in the order
+/// they were pushed. The stream is not thread-safe: calls to
+/// ArrowSpillingArrayStreamPush() must be serialized with calls to its methods.
+///
+/// @{
+
+/// \brief Initialize a spilling ArrowArrayStream
+///
+/// The spill file is only created when the first array is spilled, is removed as
+/// soon as it has been created, and grows until array_stream is released (arrays
+/// that were read back from it remain valid after that). This function moves the
+/// ownership of schema to the array_stream. If this function returns NANOARROW_OK,
+/// the caller is responsible for releasing the ArrowArrayStream.
+ArrowErrorCode ArrowSpillingArrayStreamInit(
+    struct ArrowArrayStream* array_stream, struct ArrowSchema* schema,
+    const struct ArrowSpillingArrayStreamOptions* options, struct ArrowError* error);
+
+/// \brief Append an array to a spilling ArrowArrayStream
+///
+/// array_stream must have been initialized with ArrowSpillingArrayStreamInit().
+/// The buffer bytes referenced by array are counted using an ArrowArrayView; if they
+/// would bring the bytes held in memory over memory_budget_bytes, array is written to
+/// the spill file and released. On success, ownership of array is moved to
+/// array_stream; otherwise, array is left untouched.
+ArrowErrorCode ArrowSpillingArrayStreamPush(struct ArrowArrayStream* array_stream,
+                                            struct ArrowArray* array,
+                                            struct ArrowError* error);
+
+/// \brief Mark the end of a spilling ArrowArrayStream
+///
+/// array_stream must have been initialized with ArrowSpillingArrayStreamInit().
+/// Before this is called, get_next() returns EAGAIN when no arrays are queued;
+/// afterwards, it signals the end of the stream once the queue is drained.
+void ArrowSpillingArrayStreamFinish(struct ArrowArrayStream* array_stream);
+
+/// \brief Retrieve the statistics accumulated by a spilling ArrowArrayStream
+///
+/// array_stream must have been initialized with ArrowSpillingArrayStreamInit().
+void ArrowSpillingArrayStreamGetStats(struct ArrowArrayStream* array_stream,
+                                      struct ArrowSpillingArrayStreamStats* out);
+
+/// @}
+
+/// \defgroup nanoarrow-async-array-stream Asynchronous ArrowArrayStream adapters
+///
+/// Adapters between the pull-based ArrowArrayStream and the push-based
+/// ArrowAsyncArrayStreamHandler. Neither adapter is thread-safe: producers that
+/// deliver arrays from another thread must serialize calls to the handler with calls
+/// to the methods of the ArrowArrayStream.
+///
+/// @{
+
+/// \brief Push the contents of an ArrowArrayStream to an ArrowAsyncArrayStreamHandler
+///
+/// Calls handler->on_schema() before returning and then calls get_next() on
+/// array_stream once for each array requested via the producer, delivering the
+/// result to handler->on_next() from within ArrowAsyncProducer::request(). Errors
+/// from get_next() are delivered to handler->on_error() with the stream's
+/// get_last_error() message. If this function returns NANOARROW_OK, ownership of
+/// array_stream and handler is moved to the producer, which releases both after the
+/// end of the stream, an error, or a cancellation. Returns an errno code (and
+/// takes ownership of nothing) if get_schema() fails.
+ArrowErrorCode ArrowArrayStreamToAsync(struct ArrowArrayStream* array_stream,
+                                       struct ArrowAsyncArrayStreamHandler* handler,
+                                       struct ArrowError* error);
+
+/// \brief Initialize an ArrowArrayStream that consumes an ArrowAsyncArrayStreamHandler
+///
+/// Initializes handler and array_stream such that arrays delivered to handler are
+/// queued and returned by get_next(). The caller is responsible for passing handler to
+/// a producer (which takes ownership of it) and for releasing array_stream. When the
+/// queue is empty, get_next() requests one array from the producer and returns EAGAIN
+/// if it was not delivered before request() returned; get_schema() returns EAGAIN
+/// until on_schema() has been called. Errors passed to on_error() are returned by
+/// get_next() once the queue is drained. Releasing array_stream before the end of the
+/// stream cancels the producer.
+ArrowErrorCode ArrowArrayStreamInitFromAsync(
+    struct ArrowArrayStream* array_stream, struct ArrowAsyncArrayStreamHandler* handler);
+
+/// @}
+
 // Inline function definitions
 #include "array_inline.h"
 #include "buffer_inline.h"
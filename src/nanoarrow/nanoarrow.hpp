@@ -15,10 +15,30 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <condition_variable>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
 #include <vector>
 
+// std::pmr is only available from C++17
+#if (__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)) && \
+    defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <algorithm>
+#include <cstring>
+#include <memory_resource>
+#define NANOARROW_HPP_HAVE_MEMORY_RESOURCE
+#endif
+#endif
+
 #include "nanoarrow.h"
 
 #ifndef NANOARROW_HPP_INCLUDED
@@ -227,8 +247,310 @@ using UniqueBitmap = internal::Unique<struct ArrowBitmap>;
 /// \brief Class wrapping a unique struct ArrowArrayView
 using UniqueArrayView = internal::Unique<struct ArrowArrayView>;
 
+/// \brief An ArrowArrayView that can be rebound to a new array without reallocating
+///
+/// ArrowArrayViewInitFromSchema() allocates the child tree and union type id maps
+/// of an ArrowArrayView, whereas ArrowArrayViewSetArray() only re-points buffers.
+/// This class keeps the allocated tree and a copy of the schema it was built from
+/// such that Bind() only reallocates when the schema changes in a way that affects
+/// the view (names and metadata are ignored).
+class RebindableArrayView {
+ public:
+  /// \brief Ensure the view is initialized for a schema
+  ///
+  /// Does nothing if the view was already initialized from an equivalent schema.
+  ArrowErrorCode Bind(struct ArrowSchema* schema, struct ArrowError* error) {
+    if (schema_->release != nullptr &&
+        ArrowSchemaEquals(schema_.get(), schema,
+                          NANOARROW_SCHEMA_COMPARE_IGNORE_NAMES |
+                              NANOARROW_SCHEMA_COMPARE_IGNORE_METADATA)) {
+      return NANOARROW_OK;
+    }
+
+    schema_.reset();
+    array_view_.reset();
+    NANOARROW_RETURN_NOT_OK(ArrowSchemaDeepCopy(schema, schema_.get()));
+    ArrowErrorCode result =
+        ArrowArrayViewInitFromSchema(array_view_.get(), schema_.get(), error);
+    if (result != NANOARROW_OK) {
+      schema_.reset();
+    }
+
+    return result;
+  }
+
+  /// \brief Bind to schema if required and point the view to array
+  ArrowErrorCode SetArray(struct ArrowSchema* schema, struct ArrowArray* array,
+                          struct ArrowError* error) {
+    NANOARROW_RETURN_NOT_OK(Bind(schema, error));
+    return SetArray(array, error);
+  }
+
+  /// \brief Point the view to an array of the most recently bound schema
+  ArrowErrorCode SetArray(struct ArrowArray* array, struct ArrowError* error) {
+    return ArrowArrayViewSetArray(array_view_.get(), array, error);
+  }
+
+  /// \brief Get a pointer to the ArrowArrayView owned by this object
+  struct ArrowArrayView* get() noexcept { return array_view_.get(); }
+
+  /// \brief Use the pointer operator to access fields of the ArrowArrayView
+  struct ArrowArrayView* operator->() { return array_view_.get(); }
+
+ private:
+  UniqueSchema schema_;
+  UniqueArrayView array_view_;
+};
+
+/// @}
+
+/// \defgroup nanoarrow_hpp-buffers Buffer helpers
+///
+/// These helpers move the storage of a C++ container into an ArrowBuffer without
+/// copying it: the container is kept alive by the buffer's ArrowBufferDeallocator()
+/// and destroyed when the buffer is released. Such a buffer must not be grown (e.g.,
+/// by appending to it). An empty container is destroyed immediately and leaves the
+/// buffer empty (i.e., with a NULL data pointer, which is never freed).
+///
+/// @{
+
+namespace internal {
+
+template <typename T>
+static inline void DeleteWrappedBuffer(struct ArrowBufferAllocator* allocator,
+                                       uint8_t* ptr, int64_t size) {
+  delete reinterpret_cast<T*>(allocator->private_data);
+}
+
+template <typename T>
+static inline void DeleteWrappedArray(struct ArrowBufferAllocator* allocator,
+                                      uint8_t* ptr, int64_t size) {
+  delete[] reinterpret_cast<T*>(allocator->private_data);
+}
+
+}  // namespace internal
+
+/// \brief Initialize a buffer that keeps an object alive and points to its data
+///
+/// Moves obj into the buffer, which points to size_bytes of data that must be owned
+/// (directly or indirectly) by obj and remain valid after obj is moved.
+template <typename T>
+static inline void BufferInitWrapped(struct ArrowBuffer* buffer, T obj,
+                                     const uint8_t* data, int64_t size_bytes) {
+  ArrowBufferInit(buffer);
+  if (data == nullptr) {
+    return;
+  }
+
+  T* obj_moved = new T(std::move(obj));
+  buffer->allocator =
+      ArrowBufferDeallocator(&internal::DeleteWrappedBuffer<T>, obj_moved);
+  buffer->data = const_cast<uint8_t*>(data);
+  buffer->size_bytes = size_bytes;
+  buffer->capacity_bytes = size_bytes;
+}
+
+/// \brief Initialize a buffer from the storage of a contiguous container
+///
+/// Moves sequence (e.g., a std::vector<int32_t> or a std::string) into the buffer,
+/// which points to its data(). The pointer is taken after the move because moving a
+/// short std::string copies its characters.
+template <typename T>
+static inline void BufferInitSequence(struct ArrowBuffer* buffer, T sequence) {
+  ArrowBufferInit(buffer);
+  if (sequence.size() == 0) {
+    return;
+  }
+
+  T* sequence_moved = new T(std::move(sequence));
+  buffer->allocator =
+      ArrowBufferDeallocator(&internal::DeleteWrappedBuffer<T>, sequence_moved);
+  buffer->data = reinterpret_cast<uint8_t*>(
+      const_cast<typename T::value_type*>(sequence_moved->data()));
+  buffer->size_bytes =
+      static_cast<int64_t>(sequence_moved->size() * sizeof(typename T::value_type));
+  buffer->capacity_bytes = buffer->size_bytes;
+}
+
+/// \brief Initialize a buffer from an array of n_values elements
+template <typename T>
+static inline void BufferInitSequence(struct ArrowBuffer* buffer,
+                                      std::unique_ptr<T[]> values, int64_t n_values) {
+  ArrowBufferInit(buffer);
+  if (values == nullptr) {
+    return;
+  }
+
+  T* values_released = values.release();
+  buffer->allocator =
+      ArrowBufferDeallocator(&internal::DeleteWrappedArray<T>, values_released);
+  buffer->data = reinterpret_cast<uint8_t*>(values_released);
+  buffer->size_bytes = n_values * static_cast<int64_t>(sizeof(T));
+  buffer->capacity_bytes = buffer->size_bytes;
+}
+
+/// \brief Set buffer i of an array to the storage of a contiguous container
+///
+/// Like ArrowArraySetBuffer() with a buffer from BufferInitSequence(). On error,
+/// sequence is destroyed.
+template <typename T>
+static inline ArrowErrorCode ArraySetBufferSequence(struct ArrowArray* array, int64_t i,
+                                                    T sequence) {
+  UniqueBuffer buffer;
+  BufferInitSequence(buffer.get(), std::move(sequence));
+  return ArrowArraySetBuffer(array, i, buffer.get());
+}
+
+/// \brief Set buffer i of an array to an array of n_values elements
+template <typename T>
+static inline ArrowErrorCode ArraySetBufferSequence(struct ArrowArray* array, int64_t i,
+                                                    std::unique_ptr<T[]> values,
+                                                    int64_t n_values) {
+  UniqueBuffer buffer;
+  BufferInitSequence(buffer.get(), std::move(values), n_values);
+  return ArrowArraySetBuffer(array, i, buffer.get());
+}
+
 /// @}
 
+#if defined(NANOARROW_HPP_HAVE_MEMORY_RESOURCE)
+
+/// \defgroup nanoarrow_hpp-memory_resource std::pmr adapters
+///
+/// These adapters let nanoarrow buffers allocate from a std::pmr::memory_resource
+/// (e.g., a per-request std::pmr::monotonic_buffer_resource) and let standard
+/// containers allocate from an ArrowBufferAllocator. They are only available when
+/// compiling with C++17 or later.
+///
+/// @{
+
+namespace internal {
+
+// Buffers allocated from a memory_resource are aligned to this many bytes
+static constexpr std::size_t kMemoryResourceAlignment = 64;
+
+static inline uint8_t* MemoryResourceReallocate(struct ArrowBufferAllocator* allocator,
+                                                uint8_t* ptr, int64_t old_size,
+                                                int64_t new_size) {
+  auto resource = reinterpret_cast<std::pmr::memory_resource*>(allocator->private_data);
+  if (ptr != nullptr && new_size == old_size) {
+    return ptr;
+  }
+
+  // A memory_resource can't grow an allocation in place and must be given back the
+  // size of each allocation when it is deallocated, so resizing is always an allocation
+  // of new_size bytes and a copy
+  void* new_ptr;
+  try {
+    new_ptr = resource->allocate(static_cast<std::size_t>(new_size),
+                                 kMemoryResourceAlignment);
+  } catch (...) {
+    // Exceptions can't propagate through nanoarrow's C callbacks
+    return nullptr;
+  }
+
+  if (ptr != nullptr) {
+    std::memcpy(new_ptr, ptr, static_cast<std::size_t>(std::min(old_size, new_size)));
+    resource->deallocate(ptr, static_cast<std::size_t>(old_size),
+                         kMemoryResourceAlignment);
+  }
+
+  return reinterpret_cast<uint8_t*>(new_ptr);
+}
+
+static inline void MemoryResourceFree(struct ArrowBufferAllocator* allocator,
+                                      uint8_t* ptr, int64_t size) {
+  auto resource = reinterpret_cast<std::pmr::memory_resource*>(allocator->private_data);
+  resource->deallocate(ptr, static_cast<std::size_t>(size), kMemoryResourceAlignment);
+}
+
+}  // namespace internal
+
+/// \brief Create an ArrowBufferAllocator that allocates from a memory_resource
+///
+/// Allocations are aligned to 64 bytes. The allocator does not own resource, which
+/// must outlive every buffer allocated with it (i.e., releasing a
+/// std::pmr::monotonic_buffer_resource releases every buffer allocated from it, which
+/// must not be used afterward).
+inline struct ArrowBufferAllocator MemoryResourceAllocator(
+    std::pmr::memory_resource* resource) {
+  struct ArrowBufferAllocator allocator;
+  allocator.reallocate = &internal::MemoryResourceReallocate;
+  allocator.free = &internal::MemoryResourceFree;
+  allocator.private_data = resource;
+  return allocator;
+}
+
+/// \brief A std::pmr::memory_resource that allocates from an ArrowBufferAllocator
+///
+/// The ArrowBufferAllocator (e.g., one returned by ArrowBufferAllocatorPoolInit() or
+/// ArrowBufferAllocatorArenaInit()) must outlive this object and is not released by
+/// it. Allocations with an alignment greater than alignof(std::max_align_t) are
+/// padded such that they can be aligned within the allocation. Throws std::bad_alloc
+/// when the allocator fails.
+class AllocatorMemoryResource : public std::pmr::memory_resource {
+ public:
+  explicit AllocatorMemoryResource(struct ArrowBufferAllocator allocator)
+      : allocator_(allocator) {}
+
+  /// \brief Get the allocator of this memory_resource
+  const struct ArrowBufferAllocator& allocator() const noexcept { return allocator_; }
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    if (alignment <= alignof(std::max_align_t)) {
+      uint8_t* ptr = allocator_.reallocate(&allocator_, nullptr, 0,
+                                           static_cast<int64_t>(bytes));
+      if (ptr == nullptr) {
+        throw std::bad_alloc();
+      }
+
+      return ptr;
+    }
+
+    // Over-aligned: the pointer to give back to the allocator is stored just before
+    // the aligned pointer
+    std::size_t padded_size = bytes + alignment + sizeof(void*);
+    uint8_t* ptr = allocator_.reallocate(&allocator_, nullptr, 0,
+                                         static_cast<int64_t>(padded_size));
+    if (ptr == nullptr) {
+      throw std::bad_alloc();
+    }
+
+    uintptr_t address = reinterpret_cast<uintptr_t>(ptr) + sizeof(void*);
+    address = (address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    uint8_t* aligned = reinterpret_cast<uint8_t*>(address);
+    std::memcpy(aligned - sizeof(void*), &ptr, sizeof(void*));
+    return aligned;
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+    uint8_t* ptr = reinterpret_cast<uint8_t*>(p);
+    if (alignment <= alignof(std::max_align_t)) {
+      allocator_.free(&allocator_, ptr, static_cast<int64_t>(bytes));
+      return;
+    }
+
+    uint8_t* allocated;
+    std::memcpy(&allocated, ptr - sizeof(void*), sizeof(void*));
+    std::size_t padded_size = bytes + alignment + sizeof(void*);
+    allocator_.free(&allocator_, allocated, static_cast<int64_t>(padded_size));
+  }
+
+  // Comparing two wrappers of the same allocator would need RTTI, which this
+  // header does not otherwise require
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+
+ private:
+  struct ArrowBufferAllocator allocator_;
+};
+
+/// @}
+
+#endif
+
 /// \defgroup nanoarrow_hpp-array-stream ArrayStream helpers
 ///
 /// These classes provide simple struct ArrowArrayStream implementations that
@@ -348,6 +670,1202 @@ class VectorArrayStream : public EmptyArrayStream {
   int64_t offset_;
 };
 
+/// \brief An ArrowArrayStream that reads ahead from another stream on a background thread
+///
+/// Calls the wrapped stream's get_next() from a background thread, queueing up to a
+/// fixed number of arrays so that producing and consuming arrays can overlap. Errors
+/// from the wrapped stream (including its get_last_error() message) are returned
+/// after all arrays queued before the error have been consumed. The wrapped stream is
+/// never called concurrently. Releasing this stream waits for any in-progress call
+/// to the wrapped stream's get_next() to return.
+class ReadaheadArrayStream : public EmptyArrayStream {
+ public:
+  /// \brief Create a UniqueArrayStream that reads ahead up to max_queued arrays
+  ///
+  /// Takes ownership of stream.
+  static UniqueArrayStream MakeUnique(struct ArrowArrayStream* stream,
+                                      int64_t max_queued) {
+    UniqueArrayStream upstream(stream);
+    UniqueSchema schema;
+    int schema_result = upstream->get_schema(upstream.get(), schema.get());
+
+    UniqueArrayStream out;
+    (new ReadaheadArrayStream(schema.get(), std::move(upstream), max_queued,
+                              schema_result))
+        ->MakeStream(out.get());
+    return out;
+  }
+
+  ~ReadaheadArrayStream() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cancelled_ = true;
+    }
+    producer_cv_.notify_one();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+ protected:
+  ReadaheadArrayStream(struct ArrowSchema* schema, UniqueArrayStream upstream,
+                       int64_t max_queued, int schema_result)
+      : EmptyArrayStream(schema),
+        upstream_(std::move(upstream)),
+        max_queued_(max_queued < 1 ? 1 : max_queued),
+        result_(schema_result),
+        finished_(schema_result != NANOARROW_OK),
+        cancelled_(false) {
+    if (result_ != NANOARROW_OK) {
+      SetUpstreamError();
+    } else {
+      thread_ = std::thread(&ReadaheadArrayStream::ReadAhead, this);
+    }
+  }
+
+  int get_schema(struct ArrowSchema* schema) {
+    if (schema_->release == nullptr) {
+      return result_;
+    }
+
+    return EmptyArrayStream::get_schema(schema);
+  }
+
+  int get_next(struct ArrowArray* array) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    consumer_cv_.wait(lock, [this] { return !queue_.empty() || finished_; });
+
+    if (!queue_.empty()) {
+      queue_.front().move(array);
+      queue_.pop_front();
+      lock.unlock();
+      producer_cv_.notify_one();
+      return NANOARROW_OK;
+    }
+
+    if (result_ != NANOARROW_OK) {
+      return result_;
+    }
+
+    array->release = nullptr;
+    return NANOARROW_OK;
+  }
+
+ private:
+  UniqueArrayStream upstream_;
+  int64_t max_queued_;
+  std::deque<UniqueArray> queue_;
+  int result_;
+  bool finished_;
+  bool cancelled_;
+  std::mutex mutex_;
+  std::condition_variable producer_cv_;
+  std::condition_variable consumer_cv_;
+  std::thread thread_;
+
+  // Only called from the background thread (or before it starts). The consumer
+  // only reads error_ after observing finished_ under the lock.
+  void SetUpstreamError() {
+    const char* message = upstream_->get_last_error(upstream_.get());
+    if (message == nullptr) {
+      message = "";
+    }
+
+    ArrowErrorSet(&error_, "%s", message);
+  }
+
+  void ReadAhead() {
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        producer_cv_.wait(lock, [this] {
+          return cancelled_ || static_cast<int64_t>(queue_.size()) < max_queued_;
+        });
+
+        if (cancelled_) {
+          return;
+        }
+      }
+
+      UniqueArray array;
+      int result = upstream_->get_next(upstream_.get(), array.get());
+      bool done = result != NANOARROW_OK || array->release == nullptr;
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (result != NANOARROW_OK) {
+          result_ = result;
+          SetUpstreamError();
+        } else if (!done) {
+          queue_.push_back(std::move(array));
+        }
+
+        finished_ = done;
+      }
+
+      consumer_cv_.notify_one();
+      if (done) {
+        return;
+      }
+    }
+  }
+};
+
+/// \brief An ArrowArrayStream that merges streams read on background threads
+///
+/// Reads every wrapped stream on its own background thread, queueing up to a
+/// fixed number of arrays per stream, and yields arrays either in the order they
+/// arrive or in round-robin order of the wrapped streams (which is deterministic).
+/// At least one stream is required and all wrapped streams must have the same schema
+/// (including names and metadata); otherwise, get_schema() and get_next() return
+/// EINVAL. If a background thread can't be started, the threads that were started
+/// are stopped and get_schema() and get_next() return EAGAIN. Each wrapped stream is
+/// only ever called from one thread at a time. Releasing this stream waits for any
+/// in-progress calls to the wrapped streams' get_next() to return.
+class MergeArrayStream : public EmptyArrayStream {
+ public:
+  /// \brief The order in which arrays from the wrapped streams are yielded
+  enum class Order {
+    /// \brief Yield arrays as soon as they are available. An error from any
+    /// wrapped stream is returned as soon as it is observed.
+    kArrival,
+    /// \brief Yield one array from each wrapped stream in turn, skipping streams
+    /// that have finished. An error from a wrapped stream is returned on its turn.
+    kRoundRobin
+  };
+
+  /// \brief Create a UniqueArrayStream merging streams
+  ///
+  /// Takes ownership of streams.
+  static UniqueArrayStream MakeUnique(std::vector<UniqueArrayStream> streams,
+                                      Order order = Order::kArrival,
+                                      int64_t max_queued = 1) {
+    UniqueArrayStream out;
+    (new MergeArrayStream(std::move(streams), order, max_queued))->MakeStream(out.get());
+    return out;
+  }
+
+  ~MergeArrayStream() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cancelled_ = true;
+    }
+    producer_cv_.notify_all();
+    for (auto& source : sources_) {
+      if (source->thread.joinable()) {
+        source->thread.join();
+      }
+    }
+  }
+
+ protected:
+  MergeArrayStream(std::vector<UniqueArrayStream> streams, Order order,
+                   int64_t max_queued)
+      : EmptyArrayStream(UniqueSchema().get()),
+        order_(order),
+        max_queued_(max_queued < 1 ? 1 : max_queued),
+        result_(NANOARROW_OK),
+        next_(0),
+        n_done_(0),
+        n_queued_(0),
+        has_error_(false),
+        cancelled_(false) {
+    for (auto& stream : streams) {
+      sources_.emplace_back(new Source(std::move(stream)));
+    }
+
+    result_ = CheckSchemas();
+    if (result_ != NANOARROW_OK) {
+      return;
+    }
+
+    for (size_t i = 0; i < sources_.size(); i++) {
+      try {
+        sources_[i]->thread = std::thread(&MergeArrayStream::ReadAhead, this, i);
+      } catch (const std::system_error& e) {
+        // Stop the threads that were started (which are joined when this stream is
+        // released) rather than letting the exception escape with joinable threads
+        ArrowErrorSet(&error_, "Failed to start a thread for stream %ld: %s", (long)i,
+                      e.what());
+        result_ = EAGAIN;
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          cancelled_ = true;
+        }
+        producer_cv_.notify_all();
+        return;
+      }
+    }
+  }
+
+  int get_schema(struct ArrowSchema* schema) {
+    if (result_ != NANOARROW_OK) {
+      return result_;
+    }
+
+    return EmptyArrayStream::get_schema(schema);
+  }
+
+  int get_next(struct ArrowArray* array) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (result_ != NANOARROW_OK) {
+      return result_;
+    }
+
+    int result = order_ == Order::kArrival ? NextArrival(lock, array)
+                                           : NextRoundRobin(lock, array);
+    lock.unlock();
+    producer_cv_.notify_all();
+    return result;
+  }
+
+ private:
+  struct Source {
+    explicit Source(UniqueArrayStream stream)
+        : stream(std::move(stream)), finished(false), result(NANOARROW_OK) {}
+
+    UniqueArrayStream stream;
+    std::deque<UniqueArray> queue;
+    bool finished;
+    int result;
+    std::string error;
+    std::thread thread;
+  };
+
+  Order order_;
+  int64_t max_queued_;
+  std::vector<std::unique_ptr<Source>> sources_;
+  // Indices of the sources that queued each array in arrival order
+  std::deque<size_t> arrivals_;
+  int result_;
+  size_t next_;
+  size_t n_done_;
+  int64_t n_queued_;
+  bool has_error_;
+  bool cancelled_;
+  std::mutex mutex_;
+  std::condition_variable producer_cv_;
+  std::condition_variable consumer_cv_;
+
+  int CheckSchemas() {
+    if (sources_.empty()) {
+      ArrowErrorSet(&error_, "Expected at least one stream");
+      return EINVAL;
+    }
+
+    for (size_t i = 0; i < sources_.size(); i++) {
+      UniqueSchema schema;
+      struct ArrowArrayStream* stream = sources_[i]->stream.get();
+      int result = stream->get_schema(stream, schema.get());
+      if (result != NANOARROW_OK) {
+        const char* message = stream->get_last_error(stream);
+        ArrowErrorSet(&error_, "get_schema() failed for stream %ld: %s", (long)i,
+                      message == nullptr ? "" : message);
+        return result;
+      }
+
+      if (i == 0) {
+        schema_.reset(schema.get());
+        continue;
+      }
+
+      if (ArrowSchemaFingerprint(schema.get(), NANOARROW_SCHEMA_COMPARE_DEFAULT) !=
+              ArrowSchemaFingerprint(schema_.get(), NANOARROW_SCHEMA_COMPARE_DEFAULT) ||
+          !ArrowSchemaEquals(schema.get(), schema_.get(),
+                             NANOARROW_SCHEMA_COMPARE_DEFAULT)) {
+        ArrowErrorSet(&error_, "Expected schema of stream %ld to equal that of stream 0",
+                      (long)i);
+        return EINVAL;
+      }
+    }
+
+    return NANOARROW_OK;
+  }
+
+  int SetSourceError(const Source& source) {
+    ArrowErrorSet(&error_, "%s", source.error.c_str());
+    return source.result;
+  }
+
+  int NextArrival(std::unique_lock<std::mutex>& lock, struct ArrowArray* array) {
+    consumer_cv_.wait(lock, [this] {
+      return n_queued_ > 0 || n_done_ == sources_.size() || has_error_;
+    });
+
+    if (has_error_) {
+      for (const auto& source : sources_) {
+        if (source->result != NANOARROW_OK) {
+          return SetSourceError(*source);
+        }
+      }
+    }
+
+    if (arrivals_.empty()) {
+      array->release = nullptr;
+      return NANOARROW_OK;
+    }
+
+    size_t i = arrivals_.front();
+    arrivals_.pop_front();
+    return PopArray(sources_[i].get(), array);
+  }
+
+  int NextRoundRobin(std::unique_lock<std::mutex>& lock, struct ArrowArray* array) {
+    while (n_done_ < sources_.size() || n_queued_ > 0) {
+      Source* source = sources_[next_].get();
+      next_ = (next_ + 1) % sources_.size();
+
+      consumer_cv_.wait(lock,
+                        [source] { return !source->queue.empty() || source->finished; });
+
+      if (!source->queue.empty()) {
+        return PopArray(source, array);
+      }
+
+      if (source->result != NANOARROW_OK) {
+        return SetSourceError(*source);
+      }
+    }
+
+    array->release = nullptr;
+    return NANOARROW_OK;
+  }
+
+  int PopArray(Source* source, struct ArrowArray* array) {
+    source->queue.front().move(array);
+    source->queue.pop_front();
+    n_queued_--;
+    return NANOARROW_OK;
+  }
+
+  void ReadAhead(size_t i) {
+    Source* source = sources_[i].get();
+    struct ArrowArrayStream* stream = source->stream.get();
+
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        producer_cv_.wait(lock, [this, source] {
+          return cancelled_ || static_cast<int64_t>(source->queue.size()) < max_queued_;
+        });
+
+        if (cancelled_) {
+          return;
+        }
+      }
+
+      UniqueArray array;
+      int result = stream->get_next(stream, array.get());
+      bool done = result != NANOARROW_OK || array->release == nullptr;
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (result != NANOARROW_OK) {
+          const char* message = stream->get_last_error(stream);
+          source->result = result;
+          source->error = message == nullptr ? "" : message;
+          has_error_ = true;
+        } else if (!done) {
+          source->queue.push_back(std::move(array));
+          n_queued_++;
+          if (order_ == Order::kArrival) {
+            arrivals_.push_back(i);
+          }
+        }
+
+        if (done) {
+          source->finished = true;
+          n_done_++;
+        }
+      }
+
+      consumer_cv_.notify_one();
+      if (done) {
+        return;
+      }
+    }
+  }
+};
+
+/// @}
+
+/// \defgroup nanoarrow_hpp-builders Array builders
+///
+/// The ArrowArrayAppend*() functions switch on the storage type of the array
+/// for every value appended. These builders know their storage type at compile
+/// time and write directly into the buffers of the array being built.
+///
+/// @{
+
+namespace internal {
+
+/// \brief The storage type used to build arrays of a C type
+template <typename T>
+struct StorageType;
+
+template <>
+struct StorageType<int8_t> {
+  static constexpr enum ArrowType value = NANOARROW_TYPE_INT8;
+};
+
+template <>
+struct StorageType<uint8_t> {
+  static constexpr enum ArrowType value = NANOARROW_TYPE_UINT8;
+};
+
+template <>
+struct StorageType<int16_t> {
+  static constexpr enum ArrowType value = NANOARROW_TYPE_INT16;
+};
+
+template <>
+struct StorageType<uint16_t> {
+  static constexpr enum ArrowType value = NANOARROW_TYPE_UINT16;
+};
+
+template <>
+struct StorageType<int32_t> {
+  static constexpr enum ArrowType value = NANOARROW_TYPE_INT32;
+};
+
+template <>
+struct StorageType<uint32_t> {
+  static constexpr enum ArrowType value = NANOARROW_TYPE_UINT32;
+};
+
+template <>
+struct StorageType<int64_t> {
+  static constexpr enum ArrowType value = NANOARROW_TYPE_INT64;
+};
+
+template <>
+struct StorageType<uint64_t> {
+  static constexpr enum ArrowType value = NANOARROW_TYPE_UINT64;
+};
+
+template <>
+struct StorageType<float> {
+  static constexpr enum ArrowType value = NANOARROW_TYPE_FLOAT;
+};
+
+template <>
+struct StorageType<double> {
+  static constexpr enum ArrowType value = NANOARROW_TYPE_DOUBLE;
+};
+
+}  // namespace internal
+
+/// \brief A move-only builder for a fixed-width numeric array
+/// \tparam T The C type of each value (e.g., int32_t for an int32 array)
+template <typename T>
+class Builder {
+ public:
+  /// \brief The storage type of the array being built
+  static constexpr enum ArrowType type_id = internal::StorageType<T>::value;
+
+  Builder() = default;
+  Builder(Builder&& rhs) = default;
+  Builder(const Builder& rhs) = delete;
+
+  /// \brief Initialize a new empty array
+  ///
+  /// Must be called before appending and again after each call to Finish().
+  ArrowErrorCode Init() {
+    array_.reset();
+    NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(array_.get(), type_id));
+    return ArrowArrayStartAppending(array_.get());
+  }
+
+  /// \brief The number of values appended so far
+  int64_t length() { return array_->length; }
+
+  /// \brief Ensure that additional values can be appended with AppendUnsafe()
+  ArrowErrorCode Reserve(int64_t additional) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferReserve(data_buffer(), additional * static_cast<int64_t>(sizeof(T))));
+    struct ArrowBitmap* bitmap = validity_bitmap();
+    if (bitmap->buffer.data != nullptr) {
+      NANOARROW_RETURN_NOT_OK(ArrowBitmapReserve(bitmap, additional));
+    }
+
+    return NANOARROW_OK;
+  }
+
+  /// \brief Append a non-null value, growing the buffers if required
+  ArrowErrorCode Append(T value) {
+    struct ArrowBuffer* buffer = data_buffer();
+    struct ArrowBitmap* bitmap = validity_bitmap();
+    if ((buffer->capacity_bytes - buffer->size_bytes) <
+            static_cast<int64_t>(sizeof(T)) ||
+        (bitmap->buffer.data != nullptr &&
+         bitmap->buffer.capacity_bytes * 8 <= bitmap->size_bits)) {
+      NANOARROW_RETURN_NOT_OK(Reserve(1));
+    }
+
+    AppendUnsafe(value);
+    return NANOARROW_OK;
+  }
+
+  /// \brief Append a non-null value without checking capacity
+  ///
+  /// Reserve() must have been called with enough space for this value.
+  void AppendUnsafe(T value) {
+    ArrowBufferAppendUnsafe(data_buffer(), &value, sizeof(T));
+    struct ArrowBitmap* bitmap = validity_bitmap();
+    if (bitmap->buffer.data != nullptr) {
+      ArrowBitmapAppendUnsafe(bitmap, 1, 1);
+    }
+
+    array_->length++;
+  }
+
+  /// \brief Append n contiguous values, optionally with a validity bitmap
+  ArrowErrorCode AppendValues(const T* values, int64_t n,
+                              const uint8_t* validity = nullptr) {
+    return _ArrowArrayAppendSlice(array_.get(), type_id, values, n, validity);
+  }
+
+  /// \brief Append n nulls
+  ArrowErrorCode AppendNull(int64_t n = 1) {
+    return ArrowArrayAppendNull(array_.get(), n);
+  }
+
+  /// \brief Finish building and move the array into out
+  ///
+  /// Any array previously held by out is released.
+  ArrowErrorCode Finish(UniqueArray* out, struct ArrowError* error) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayFinishBuildingDefault(array_.get(), error));
+    out->reset(array_.get());
+    return NANOARROW_OK;
+  }
+
+ private:
+  UniqueArray array_;
+
+  // These accessors keep the array marked as built by append functions because
+  // this class maintains the same invariants
+  struct ArrowBuffer* data_buffer() { return _ArrowArrayBuffer(array_.get(), 1); }
+  struct ArrowBitmap* validity_bitmap() {
+    return _ArrowArrayValidityBitmap(array_.get());
+  }
+};
+
+/// @}
+
+/// \defgroup nanoarrow_hpp-static_schema Static schemas
+///
+/// Schemas that are known at compile time (e.g., the schema of a fixed set of
+/// columns) can be declared as a type whose ArrowSchema is built once, with
+/// string literal formats and names, and never freed:
+///
+/// \code
+/// NANOARROW_SCHEMA_NAME(ts);
+/// NANOARROW_SCHEMA_NAME(value);
+///
+/// namespace na = nanoarrow::schema;
+/// using Telemetry = na::Struct<na::Field<ts, na::Timestamp<NANOARROW_TIME_UNIT_MICRO>>,
+///                              na::Field<value, na::Double>>;
+///
+/// nanoarrow::StaticSchema<Telemetry>::Export(out_schema);
+///
+/// nanoarrow::StaticBuilder<Telemetry> builder;
+/// NANOARROW_RETURN_NOT_OK(builder.Init());
+/// NANOARROW_RETURN_NOT_OK(builder.Append(1700000000000000, 1.5));
+/// \endcode
+///
+/// Exporting a static schema copies one struct and allocates nothing. The release
+/// callback of an exported schema only marks it as released; its children are shared
+/// by every export and must not be moved or modified by the consumer.
+///
+/// @{
+
+/// \brief Declare a type whose name can be used as the name of a schema::Field
+///
+/// The member of the declared type has a prefixed name such that a field can have any
+/// name that is a valid C++ identifier.
+#define NANOARROW_SCHEMA_NAME(name)                                        \
+  struct name {                                                            \
+    static constexpr const char* nanoarrow_schema_name() { return #name; } \
+  }
+
+namespace internal {
+
+static inline void ReleaseStaticSchema(struct ArrowSchema* schema) {
+  schema->release = nullptr;
+}
+
+struct NoSchemaName {
+  static constexpr const char* nanoarrow_schema_name() { return nullptr; }
+};
+
+/// \brief The immutable ArrowSchema of a schema type
+template <typename Type, typename Name, int64_t Flags>
+struct StaticSchemaNode {
+  static struct ArrowSchema* get() {
+    static struct ArrowSchema schema = Make();
+    return &schema;
+  }
+
+  static struct ArrowSchema Make() {
+    struct ArrowSchema schema;
+    schema.format = Type::format();
+    schema.name = Name::nanoarrow_schema_name();
+    schema.metadata = nullptr;
+    schema.flags = Flags;
+    schema.n_children = Type::n_children();
+    schema.children = Type::children();
+    schema.dictionary = nullptr;
+    schema.release = &ReleaseStaticSchema;
+    schema.private_data = nullptr;
+    return schema;
+  }
+};
+
+static inline ArrowErrorCode AppendStaticValidity(struct ArrowArray* array) {
+  struct ArrowBitmap* bitmap = _ArrowArrayValidityBitmap(array);
+  if (bitmap->buffer.data != nullptr) {
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(bitmap, 1, 1));
+  }
+
+  array->length++;
+  return NANOARROW_OK;
+}
+
+template <typename T>
+struct FixedWidthSchemaType {
+  using value_type = T;
+
+  static constexpr int64_t n_children() { return 0; }
+  static struct ArrowSchema** children() { return nullptr; }
+
+  static ArrowErrorCode Append(struct ArrowArray* array, T value) {
+    NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(_ArrowArrayBuffer(array, 1), &value,
+                                              static_cast<int64_t>(sizeof(T))));
+    return AppendStaticValidity(array);
+  }
+};
+
+template <typename OffsetT>
+struct BinarySchemaType {
+  using value_type = struct ArrowStringView;
+
+  static constexpr int64_t n_children() { return 0; }
+  static struct ArrowSchema** children() { return nullptr; }
+
+  static ArrowErrorCode Append(struct ArrowArray* array, struct ArrowStringView value) {
+    struct ArrowBuffer* data = _ArrowArrayBuffer(array, 2);
+    int64_t end = data->size_bytes + value.size_bytes;
+    if (end > static_cast<int64_t>(std::numeric_limits<OffsetT>::max())) {
+      return EOVERFLOW;
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(data, value.data, value.size_bytes));
+    OffsetT offset = static_cast<OffsetT>(end);
+    NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(_ArrowArrayBuffer(array, 1), &offset,
+                                              static_cast<int64_t>(sizeof(OffsetT))));
+    return AppendStaticValidity(array);
+  }
+};
+
+}  // namespace internal
+
+namespace schema {
+
+/// \brief int8
+struct Int8 : public internal::FixedWidthSchemaType<int8_t> {
+  static constexpr const char* format() { return "c"; }
+};
+
+/// \brief uint8
+struct UInt8 : public internal::FixedWidthSchemaType<uint8_t> {
+  static constexpr const char* format() { return "C"; }
+};
+
+/// \brief int16
+struct Int16 : public internal::FixedWidthSchemaType<int16_t> {
+  static constexpr const char* format() { return "s"; }
+};
+
+/// \brief uint16
+struct UInt16 : public internal::FixedWidthSchemaType<uint16_t> {
+  static constexpr const char* format() { return "S"; }
+};
+
+/// \brief int32
+struct Int32 : public internal::FixedWidthSchemaType<int32_t> {
+  static constexpr const char* format() { return "i"; }
+};
+
+/// \brief uint32
+struct UInt32 : public internal::FixedWidthSchemaType<uint32_t> {
+  static constexpr const char* format() { return "I"; }
+};
+
+/// \brief int64
+struct Int64 : public internal::FixedWidthSchemaType<int64_t> {
+  static constexpr const char* format() { return "l"; }
+};
+
+/// \brief uint64
+struct UInt64 : public internal::FixedWidthSchemaType<uint64_t> {
+  static constexpr const char* format() { return "L"; }
+};
+
+/// \brief float
+struct Float : public internal::FixedWidthSchemaType<float> {
+  static constexpr const char* format() { return "f"; }
+};
+
+/// \brief double
+struct Double : public internal::FixedWidthSchemaType<double> {
+  static constexpr const char* format() { return "g"; }
+};
+
+/// \brief date32 (days since the epoch)
+struct Date32 : public internal::FixedWidthSchemaType<int32_t> {
+  static constexpr const char* format() { return "tdD"; }
+};
+
+/// \brief timestamp without a timezone (units since the epoch)
+template <enum ArrowTimeUnit Unit>
+struct Timestamp : public internal::FixedWidthSchemaType<int64_t> {
+  static constexpr const char* format() {
+    return Unit == NANOARROW_TIME_UNIT_SECOND ? "tss:"
+           : Unit == NANOARROW_TIME_UNIT_MILLI ? "tsm:"
+           : Unit == NANOARROW_TIME_UNIT_MICRO ? "tsu:"
+                                               : "tsn:";
+  }
+};
+
+/// \brief utf8 (values are appended as an ArrowStringView)
+struct Utf8 : public internal::BinarySchemaType<int32_t> {
+  static constexpr const char* format() { return "u"; }
+};
+
+/// \brief large_utf8 (values are appended as an ArrowStringView)
+struct LargeUtf8 : public internal::BinarySchemaType<int64_t> {
+  static constexpr const char* format() { return "U"; }
+};
+
+/// \brief binary (values are appended as an ArrowStringView)
+struct Binary : public internal::BinarySchemaType<int32_t> {
+  static constexpr const char* format() { return "z"; }
+};
+
+/// \brief A named child of a Struct
+/// \tparam Name A type declared with NANOARROW_SCHEMA_NAME()
+/// \tparam Type The schema type of the child
+/// \tparam Nullable Whether the child is marked as nullable
+template <typename Name, typename Type, bool Nullable = true>
+struct Field {
+  using type = Type;
+
+  static struct ArrowSchema* schema() {
+    return internal::StaticSchemaNode<Type, Name,
+                                      Nullable ? ARROW_FLAG_NULLABLE : 0>::get();
+  }
+};
+
+/// \brief struct
+/// \tparam Fields Zero or more schema::Field types
+template <typename... Fields>
+struct Struct {
+  static constexpr const char* format() { return "+s"; }
+  static constexpr int64_t n_children() {
+    return static_cast<int64_t>(sizeof...(Fields));
+  }
+
+  static struct ArrowSchema** children() {
+    // The trailing element keeps this array non-empty for a struct with no fields
+    static struct ArrowSchema* children[] = {Fields::schema()..., nullptr};
+    return children;
+  }
+};
+
+}  // namespace schema
+
+/// \brief The ArrowSchema of a schema type (e.g., a schema::Struct)
+template <typename Type>
+class StaticSchema {
+ public:
+  /// \brief The immutable schema shared by all exports
+  ///
+  /// This schema must not be released, moved, or modified.
+  static const struct ArrowSchema* get() {
+    return internal::StaticSchemaNode<Type, internal::NoSchemaName,
+                                      ARROW_FLAG_NULLABLE>::get();
+  }
+
+  /// \brief Export the schema without allocating
+  ///
+  /// out must be released (a no-op other than marking it as released) but its
+  /// children must not be moved or modified.
+  static void Export(struct ArrowSchema* out) { *out = *get(); }
+};
+
+/// \brief A move-only builder for arrays of a static schema type
+///
+/// Only schema::Struct types whose fields are not nested are supported.
+template <typename Type>
+class StaticBuilder;
+
+/// \brief A move-only builder for struct arrays with one Append() parameter per field
+template <typename... Fields>
+class StaticBuilder<schema::Struct<Fields...>> {
+ public:
+  using schema_type = schema::Struct<Fields...>;
+
+  StaticBuilder() = default;
+  StaticBuilder(StaticBuilder&& rhs) = default;
+  StaticBuilder(const StaticBuilder& rhs) = delete;
+
+  /// \brief Initialize a new empty array
+  ///
+  /// Must be called before appending and again after each call to Finish().
+  ArrowErrorCode Init() {
+    array_.reset();
+    NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromSchema(
+        array_.get(), const_cast<struct ArrowSchema*>(StaticSchema<schema_type>::get()),
+        nullptr));
+    return ArrowArrayStartAppending(array_.get());
+  }
+
+  /// \brief The number of rows appended so far
+  int64_t length() { return array_->length; }
+
+  /// \brief Append a non-null row with one value per field
+  ///
+  /// If this returns an error, Init() must be called before appending again.
+  ArrowErrorCode Append(typename Fields::type::value_type... values) {
+    int64_t i = 0;
+    // Elements of a braced initializer list are evaluated in order
+    ArrowErrorCode results[] = {
+        NANOARROW_OK, Fields::type::Append(array_->children[i++], values)...};
+    for (ArrowErrorCode result : results) {
+      NANOARROW_RETURN_NOT_OK(result);
+    }
+
+    return ArrowArrayFinishElement(array_.get());
+  }
+
+  /// \brief Append n null rows
+  ArrowErrorCode AppendNull(int64_t n = 1) {
+    return ArrowArrayAppendNull(array_.get(), n);
+  }
+
+  /// \brief Finish building and move the array into out
+  ///
+  /// Any array previously held by out is released.
+  ArrowErrorCode Finish(UniqueArray* out, struct ArrowError* error) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayFinishBuildingDefault(array_.get(), error));
+    out->reset(array_.get());
+    return NANOARROW_OK;
+  }
+
+ private:
+  UniqueArray array_;
+};
+
+/// @}
+
+/// \defgroup nanoarrow_hpp-type_dispatch Type dispatch helpers
+///
+/// These helpers allow loops over the values of an ArrowArrayView to be
+/// instantiated once for each concrete storage type such that the type switch
+/// happens once per array rather than once per value. Views do not check that
+/// the storage type of the ArrowArrayView matches the requested value type.
+///
+/// @{
+
+/// \brief A view of the values of a fixed-width numeric ArrowArrayView
+/// \tparam T The C type used to store each value (e.g., int32_t)
+template <typename T>
+class NumericView {
+ public:
+  /// \brief The C type of each value
+  using value_type = T;
+
+  /// \brief Create a view of an ArrowArrayView whose storage type uses T
+  explicit NumericView(const struct ArrowArrayView* array_view)
+      : validity_(array_view->null_count == 0
+                      ? nullptr
+                      : array_view->buffer_views[0].data.as_uint8),
+        values_(reinterpret_cast<const T*>(array_view->buffer_views[1].data.data)),
+        offset_(array_view->offset),
+        length_(array_view->length) {
+    // Can't do math on a NULL pointer
+    if (values_ != nullptr) {
+      values_ += offset_;
+    }
+  }
+
+  /// \brief The number of values in this view
+  int64_t length() const { return length_; }
+
+  /// \brief A pointer to the first value in this view
+  const T* data() const { return values_; }
+
+  /// \brief Get the value at index i without checking for nulls
+  T operator[](int64_t i) const { return values_[i]; }
+
+  /// \brief Check whether the value at index i is non-null
+  bool is_valid(int64_t i) const {
+    return validity_ == nullptr || ArrowBitGet(validity_, offset_ + i);
+  }
+
+  const T* begin() const { return values_; }
+  const T* end() const { return values_ + length_; }
+
+ private:
+  const uint8_t* validity_;
+  const T* values_;
+  int64_t offset_;
+  int64_t length_;
+};
+
+/// \brief A view of the values of a string or binary ArrowArrayView
+/// \tparam OffsetT The C type of each offset (int32_t or int64_t)
+template <typename OffsetT>
+class BasicStringView {
+ public:
+  /// \brief The type of each value
+  using value_type = struct ArrowStringView;
+
+  /// \brief Create a view of an ArrowArrayView whose storage type uses OffsetT offsets
+  explicit BasicStringView(const struct ArrowArrayView* array_view)
+      : validity_(array_view->null_count == 0
+                      ? nullptr
+                      : array_view->buffer_views[0].data.as_uint8),
+        offsets_(reinterpret_cast<const OffsetT*>(array_view->buffer_views[1].data.data)),
+        data_(array_view->buffer_views[2].data.as_char),
+        offset_(array_view->offset),
+        length_(array_view->length) {
+    // Can't do math on a NULL pointer
+    if (offsets_ != nullptr) {
+      offsets_ += offset_;
+    }
+  }
+
+  /// \brief The number of values in this view
+  int64_t length() const { return length_; }
+
+  /// \brief Get the value at index i without checking for nulls
+  struct ArrowStringView operator[](int64_t i) const {
+    struct ArrowStringView out;
+    out.data = data_ + offsets_[i];
+    out.size_bytes = static_cast<int64_t>(offsets_[i + 1] - offsets_[i]);
+    return out;
+  }
+
+  /// \brief Check whether the value at index i is non-null
+  bool is_valid(int64_t i) const {
+    return validity_ == nullptr || ArrowBitGet(validity_, offset_ + i);
+  }
+
+ private:
+  const uint8_t* validity_;
+  const OffsetT* offsets_;
+  const char* data_;
+  int64_t offset_;
+  int64_t length_;
+};
+
+/// \brief A view of the values of a string or binary ArrowArrayView
+using StringView = BasicStringView<int32_t>;
+
+/// \brief A view of the values of a large string or large binary ArrowArrayView
+using LargeStringView = BasicStringView<int64_t>;
+
+/// \brief A value paired with its validity
+///
+/// value is unspecified when is_valid is false.
+template <typename T>
+struct Maybe {
+  T value;
+  bool is_valid;
+
+  /// \brief Check whether this value is non-null
+  explicit operator bool() const { return is_valid; }
+
+  /// \brief Access the value without checking for null
+  const T& operator*() const { return value; }
+};
+
+namespace internal {
+
+/// \brief A random-access range of Maybe values over a NumericView or BasicStringView
+template <typename View>
+class ViewRange {
+ public:
+  using value_type = Maybe<typename View::value_type>;
+
+  class const_iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = Maybe<typename View::value_type>;
+    using difference_type = int64_t;
+    using pointer = void;
+    using reference = value_type;
+
+    const_iterator() : view_(nullptr), i_(0) {}
+    const_iterator(const View* view, int64_t i) : view_(view), i_(i) {}
+
+    // Reading the value of a null slot is well-defined for these views, so
+    // dereferencing never branches on validity
+    value_type operator*() const { return {(*view_)[i_], view_->is_valid(i_)}; }
+    value_type operator[](difference_type n) const { return *(*this + n); }
+
+    const_iterator& operator++() {
+      ++i_;
+      return *this;
+    }
+    const_iterator operator++(int) {
+      const_iterator out = *this;
+      ++i_;
+      return out;
+    }
+    const_iterator& operator--() {
+      --i_;
+      return *this;
+    }
+    const_iterator operator--(int) {
+      const_iterator out = *this;
+      --i_;
+      return out;
+    }
+    const_iterator& operator+=(difference_type n) {
+      i_ += n;
+      return *this;
+    }
+    const_iterator& operator-=(difference_type n) {
+      i_ -= n;
+      return *this;
+    }
+    const_iterator operator+(difference_type n) const {
+      return const_iterator(view_, i_ + n);
+    }
+    const_iterator operator-(difference_type n) const {
+      return const_iterator(view_, i_ - n);
+    }
+    difference_type operator-(const const_iterator& rhs) const { return i_ - rhs.i_; }
+
+    bool operator==(const const_iterator& rhs) const { return i_ == rhs.i_; }
+    bool operator!=(const const_iterator& rhs) const { return i_ != rhs.i_; }
+    bool operator<(const const_iterator& rhs) const { return i_ < rhs.i_; }
+    bool operator>(const const_iterator& rhs) const { return i_ > rhs.i_; }
+    bool operator<=(const const_iterator& rhs) const { return i_ <= rhs.i_; }
+    bool operator>=(const const_iterator& rhs) const { return i_ >= rhs.i_; }
+
+   private:
+    const View* view_;
+    int64_t i_;
+  };
+
+  explicit ViewRange(const struct ArrowArrayView* array_view) : view_(array_view) {}
+
+  /// \brief The number of values in this range
+  int64_t size() const { return view_.length(); }
+
+  /// \brief The underlying view (e.g., to access values without validity)
+  const View& view() const { return view_; }
+
+  value_type operator[](int64_t i) const { return {view_[i], view_.is_valid(i)}; }
+
+  const_iterator begin() const { return const_iterator(&view_, 0); }
+  const_iterator end() const { return const_iterator(&view_, view_.length()); }
+
+ private:
+  View view_;
+};
+
+}  // namespace internal
+
+/// \brief A random-access range of Maybe<T> over a fixed-width numeric ArrowArrayView
+///
+/// The range must not outlive the ArrowArrayView or its buffers. If the
+/// ArrowArrayView has a null_count of zero, the validity bitmap is never read.
+template <typename T>
+using ViewAsRange = internal::ViewRange<NumericView<T>>;
+
+/// \brief A random-access range of Maybe<ArrowStringView> over a string or binary
+/// ArrowArrayView
+using ViewAsStrings = internal::ViewRange<StringView>;
+
+/// \brief A random-access range of Maybe<ArrowStringView> over a large string or
+/// large binary ArrowArrayView
+using ViewAsLargeStrings = internal::ViewRange<LargeStringView>;
+
+/// \brief A tag passed to a visitor for a fixed-width numeric storage type
+template <enum ArrowType TypeId, typename T>
+struct NumericTypeTag {
+  static constexpr enum ArrowType type_id = TypeId;
+  using value_type = T;
+  using view_type = NumericView<T>;
+};
+
+/// \brief A tag passed to a visitor for a string or binary storage type
+template <enum ArrowType TypeId, typename OffsetT>
+struct StringTypeTag {
+  static constexpr enum ArrowType type_id = TypeId;
+  using offset_type = OffsetT;
+  using view_type = BasicStringView<OffsetT>;
+};
+
+/// \brief Call visitor with the NumericTypeTag of a fixed-width numeric storage type
+///
+/// visitor must be callable with any NumericTypeTag and return an ArrowErrorCode
+/// (e.g., a struct with a templated operator() or a C++14 generic lambda). Returns
+/// ENOTSUP without calling visitor for other types.
+template <typename Visitor>
+ArrowErrorCode VisitNumericType(enum ArrowType type, Visitor&& visitor) {
+  switch (type) {
+    case NANOARROW_TYPE_INT8:
+      return visitor(NumericTypeTag<NANOARROW_TYPE_INT8, int8_t>());
+    case NANOARROW_TYPE_UINT8:
+      return visitor(NumericTypeTag<NANOARROW_TYPE_UINT8, uint8_t>());
+    case NANOARROW_TYPE_INT16:
+      return visitor(NumericTypeTag<NANOARROW_TYPE_INT16, int16_t>());
+    case NANOARROW_TYPE_UINT16:
+      return visitor(NumericTypeTag<NANOARROW_TYPE_UINT16, uint16_t>());
+    case NANOARROW_TYPE_INT32:
+      return visitor(NumericTypeTag<NANOARROW_TYPE_INT32, int32_t>());
+    case NANOARROW_TYPE_UINT32:
+      return visitor(NumericTypeTag<NANOARROW_TYPE_UINT32, uint32_t>());
+    case NANOARROW_TYPE_INT64:
+      return visitor(NumericTypeTag<NANOARROW_TYPE_INT64, int64_t>());
+    case NANOARROW_TYPE_UINT64:
+      return visitor(NumericTypeTag<NANOARROW_TYPE_UINT64, uint64_t>());
+    case NANOARROW_TYPE_FLOAT:
+      return visitor(NumericTypeTag<NANOARROW_TYPE_FLOAT, float>());
+    case NANOARROW_TYPE_DOUBLE:
+      return visitor(NumericTypeTag<NANOARROW_TYPE_DOUBLE, double>());
+    default:
+      return ENOTSUP;
+  }
+}
+
+/// \brief Call visitor with the type tag of a numeric, string, or binary storage type
+///
+/// Like VisitNumericType() except visitor must also be callable with any
+/// StringTypeTag. Because both tags define view_type, a single templated visitor
+/// can loop over the values of either kind of ArrowArrayView. Returns ENOTSUP
+/// without calling visitor for other types.
+template <typename Visitor>
+ArrowErrorCode VisitType(enum ArrowType type, Visitor&& visitor) {
+  switch (type) {
+    case NANOARROW_TYPE_STRING:
+      return visitor(StringTypeTag<NANOARROW_TYPE_STRING, int32_t>());
+    case NANOARROW_TYPE_BINARY:
+      return visitor(StringTypeTag<NANOARROW_TYPE_BINARY, int32_t>());
+    case NANOARROW_TYPE_LARGE_STRING:
+      return visitor(StringTypeTag<NANOARROW_TYPE_LARGE_STRING, int64_t>());
+    case NANOARROW_TYPE_LARGE_BINARY:
+      return visitor(StringTypeTag<NANOARROW_TYPE_LARGE_BINARY, int64_t>());
+    default:
+      return VisitNumericType(type, std::forward<Visitor>(visitor));
+  }
+}
+
 /// @}
 
 }  // namespace nanoarrow
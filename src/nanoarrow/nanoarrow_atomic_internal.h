@@ -0,0 +1,102 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef NANOARROW_ATOMIC_INTERNAL_H_INCLUDED
+#define NANOARROW_ATOMIC_INTERNAL_H_INCLUDED
+
+// This header is used by the nanoarrow sources and extensions and is not installed.
+// In bundled builds its contents are pasted into the source files that include it.
+
+#include <stdint.h>
+
+// Reference counts and locks are only thread safe with C11 + stdatomic.h
+// Can compile with -DNANOARROW_USE_STDATOMIC=0 or 1 to override
+// automatic detection
+#if !defined(NANOARROW_USE_STDATOMIC)
+#define NANOARROW_USE_STDATOMIC 0
+
+// Check for C11
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+
+// Check for GCC 4.8, which doesn't include stdatomic.h but does
+// not define __STDC_NO_ATOMICS__
+#if defined(__clang__) || !defined(__GNUC__) || __GNUC__ >= 5
+
+#if !defined(__STDC_NO_ATOMICS__)
+#undef NANOARROW_USE_STDATOMIC
+#define NANOARROW_USE_STDATOMIC 1
+#endif
+#endif
+#endif
+
+#endif
+
+#if NANOARROW_USE_STDATOMIC
+#include <stdatomic.h>
+
+// A reference count that may be updated concurrently by more than one thread
+typedef _Atomic int64_t ArrowRefCount;
+
+static inline void ArrowRefCountInit(ArrowRefCount* count, int64_t value) {
+  atomic_store(count, value);
+}
+
+// Adds delta to count and returns the updated count
+static inline int64_t ArrowRefCountAdd(ArrowRefCount* count, int64_t delta) {
+  return atomic_fetch_add(count, delta) + delta;
+}
+
+// A spin lock for critical sections that are only a few instructions long
+typedef atomic_flag ArrowSpinLock;
+
+// Initializes a spin lock with static storage duration
+#define NANOARROW_SPIN_LOCK_INIT ATOMIC_FLAG_INIT
+
+static inline void ArrowSpinLockInit(ArrowSpinLock* lock) { atomic_flag_clear(lock); }
+
+static inline void ArrowSpinLockAcquire(ArrowSpinLock* lock) {
+  while (atomic_flag_test_and_set_explicit(lock, memory_order_acquire)) {
+  }
+}
+
+static inline void ArrowSpinLockRelease(ArrowSpinLock* lock) {
+  atomic_flag_clear_explicit(lock, memory_order_release);
+}
+#else
+typedef int64_t ArrowRefCount;
+
+static inline void ArrowRefCountInit(ArrowRefCount* count, int64_t value) {
+  *count = value;
+}
+
+static inline int64_t ArrowRefCountAdd(ArrowRefCount* count, int64_t delta) {
+  *count += delta;
+  return *count;
+}
+
+typedef int ArrowSpinLock;
+
+#define NANOARROW_SPIN_LOCK_INIT 0
+
+static inline void ArrowSpinLockInit(ArrowSpinLock* lock) { *lock = 0; }
+
+static inline void ArrowSpinLockAcquire(ArrowSpinLock* lock) { (void)lock; }
+
+static inline void ArrowSpinLockRelease(ArrowSpinLock* lock) { (void)lock; }
+#endif
+
+#endif
@@ -0,0 +1,391 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "nanoarrow/nanoarrow.h"
+
+// Benchmarks take the number of elements (rows or bits) as their only argument
+#define NANOARROW_BENCHMARK_SIZES \
+  RangeMultiplier(10)->Range(1000, 100000000)->Unit(benchmark::kMicrosecond)
+
+// Fails the benchmark (instead of crashing) if a nanoarrow call fails
+#define BENCHMARK_RETURN_NOT_OK(expr)                       \
+  do {                                                      \
+    if ((expr) != NANOARROW_OK) {                           \
+      state.SkipWithError("nanoarrow call failed: " #expr); \
+      return;                                               \
+    }                                                       \
+  } while (0)
+
+static std::vector<uint8_t> MakeBitmap(int64_t n_bits) {
+  std::vector<uint8_t> bits(_ArrowBytesForBits(n_bits));
+  for (size_t i = 0; i < bits.size(); i++) {
+    bits[i] = static_cast<uint8_t>(i * 37);
+  }
+  return bits;
+}
+
+// Builds a string array of n elements where every tenth element is null
+static ArrowErrorCode MakeStringArray(struct ArrowArray* array, int64_t n) {
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(array, NANOARROW_TYPE_STRING));
+  NANOARROW_RETURN_NOT_OK(ArrowArrayStartAppending(array));
+  NANOARROW_RETURN_NOT_OK(ArrowArrayReserve(array, n));
+  for (int64_t i = 0; i < n; i++) {
+    if (i % 10 == 0) {
+      NANOARROW_RETURN_NOT_OK(ArrowArrayAppendNull(array, 1));
+    } else {
+      NANOARROW_RETURN_NOT_OK(ArrowArrayAppendString(array, ArrowCharView("abcdefg")));
+    }
+  }
+
+  return ArrowArrayFinishBuilding(array, NANOARROW_VALIDATION_LEVEL_NONE, nullptr);
+}
+
+static void BM_ArrowBitCountSet(benchmark::State& state) {
+  int64_t n = state.range(0);
+  std::vector<uint8_t> bits = MakeBitmap(n);
+
+  for (auto _ : state) {
+    // Start at an offset to exercise the partial first and last bytes
+    benchmark::DoNotOptimize(ArrowBitCountSet(bits.data(), 3, n));
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void BM_ArrowBitsUnpackInt8(benchmark::State& state) {
+  int64_t n = state.range(0);
+  std::vector<uint8_t> bits = MakeBitmap(n);
+  std::vector<int8_t> out(n);
+
+  for (auto _ : state) {
+    ArrowBitsUnpackInt8(bits.data(), 0, n, out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Appends n elements one at a time to a fresh array of type using append(array, i)
+template <typename Append>
+static void BenchmarkAppend(benchmark::State& state, enum ArrowType type,
+                            Append append) {
+  int64_t n = state.range(0);
+
+  for (auto _ : state) {
+    struct ArrowArray array;
+    BENCHMARK_RETURN_NOT_OK(ArrowArrayInitFromType(&array, type));
+    BENCHMARK_RETURN_NOT_OK(ArrowArrayStartAppending(&array));
+    for (int64_t i = 0; i < n; i++) {
+      if (append(&array, i) != NANOARROW_OK) {
+        array.release(&array);
+        state.SkipWithError("append failed");
+        return;
+      }
+    }
+    benchmark::DoNotOptimize(array.length);
+    array.release(&array);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void BM_ArrowArrayAppendInt(benchmark::State& state) {
+  BenchmarkAppend(state, NANOARROW_TYPE_INT32, [](struct ArrowArray* array, int64_t i) {
+    return ArrowArrayAppendInt(array, i);
+  });
+}
+
+static void BM_ArrowArrayAppendUInt(benchmark::State& state) {
+  BenchmarkAppend(state, NANOARROW_TYPE_UINT32, [](struct ArrowArray* array, int64_t i) {
+    return ArrowArrayAppendUInt(array, static_cast<uint64_t>(i));
+  });
+}
+
+static void BM_ArrowArrayAppendDouble(benchmark::State& state) {
+  BenchmarkAppend(state, NANOARROW_TYPE_DOUBLE, [](struct ArrowArray* array, int64_t i) {
+    return ArrowArrayAppendDouble(array, static_cast<double>(i));
+  });
+}
+
+static void BM_ArrowArrayAppendBool(benchmark::State& state) {
+  BenchmarkAppend(state, NANOARROW_TYPE_BOOL, [](struct ArrowArray* array, int64_t i) {
+    return ArrowArrayAppendInt(array, i % 3 == 0);
+  });
+}
+
+static void BM_ArrowArrayAppendNull(benchmark::State& state) {
+  BenchmarkAppend(state, NANOARROW_TYPE_INT32, [](struct ArrowArray* array, int64_t i) {
+    return ArrowArrayAppendNull(array, 1);
+  });
+}
+
+static void BM_ArrowArrayAppendEmpty(benchmark::State& state) {
+  BenchmarkAppend(state, NANOARROW_TYPE_INT32, [](struct ArrowArray* array, int64_t i) {
+    return ArrowArrayAppendEmpty(array, 1);
+  });
+}
+
+static void BM_ArrowArrayAppendBytes(benchmark::State& state) {
+  BenchmarkAppend(state, NANOARROW_TYPE_BINARY, [](struct ArrowArray* array, int64_t i) {
+    struct ArrowBufferView value;
+    value.data.as_char = "abcdefg";
+    value.size_bytes = 7;
+    return ArrowArrayAppendBytes(array, value);
+  });
+}
+
+static void BM_ArrowArrayAppendString(benchmark::State& state) {
+  BenchmarkAppend(state, NANOARROW_TYPE_STRING, [](struct ArrowArray* array, int64_t i) {
+    return ArrowArrayAppendString(array, ArrowCharView("abcdefg"));
+  });
+}
+
+static void BM_ArrowArrayAppendInterval(benchmark::State& state) {
+  BenchmarkAppend(state, NANOARROW_TYPE_INTERVAL_MONTH_DAY_NANO,
+                  [](struct ArrowArray* array, int64_t i) {
+                    struct ArrowInterval interval;
+                    ArrowIntervalInit(&interval, NANOARROW_TYPE_INTERVAL_MONTH_DAY_NANO);
+                    interval.months = 1;
+                    interval.days = 2;
+                    interval.ns = i;
+                    return ArrowArrayAppendInterval(array, &interval);
+                  });
+}
+
+static void BM_ArrowArrayAppendDecimal(benchmark::State& state) {
+  int64_t n = state.range(0);
+  struct ArrowDecimal decimal;
+  ArrowDecimalInit(&decimal, 128, 10, 2);
+
+  for (auto _ : state) {
+    struct ArrowSchema schema;
+    struct ArrowArray array;
+    ArrowSchemaInit(&schema);
+    BENCHMARK_RETURN_NOT_OK(
+        ArrowSchemaSetTypeDecimal(&schema, NANOARROW_TYPE_DECIMAL128, 10, 2));
+    BENCHMARK_RETURN_NOT_OK(ArrowArrayInitFromSchema(&array, &schema, nullptr));
+    schema.release(&schema);
+    BENCHMARK_RETURN_NOT_OK(ArrowArrayStartAppending(&array));
+    for (int64_t i = 0; i < n; i++) {
+      ArrowDecimalSetInt(&decimal, i);
+      if (ArrowArrayAppendDecimal(&array, &decimal) != NANOARROW_OK) {
+        array.release(&array);
+        state.SkipWithError("append failed");
+        return;
+      }
+    }
+    array.release(&array);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Appends all n elements in a single call to append(array, n)
+template <typename Append>
+static void BenchmarkAppendSlice(benchmark::State& state, enum ArrowType type,
+                                 Append append) {
+  int64_t n = state.range(0);
+
+  for (auto _ : state) {
+    struct ArrowArray array;
+    BENCHMARK_RETURN_NOT_OK(ArrowArrayInitFromType(&array, type));
+    BENCHMARK_RETURN_NOT_OK(ArrowArrayStartAppending(&array));
+    if (append(&array, n) != NANOARROW_OK) {
+      array.release(&array);
+      state.SkipWithError("append failed");
+      return;
+    }
+    array.release(&array);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+#define NANOARROW_BENCHMARK_APPEND_SLICE(NAME, TYPE, CTYPE)                  \
+  static void BM_ArrowArrayAppend##NAME##Slice(benchmark::State& state) {    \
+    std::vector<CTYPE> values(state.range(0), static_cast<CTYPE>(1));        \
+    BenchmarkAppendSlice(state, TYPE, [&](struct ArrowArray* array, int64_t n) { \
+      return ArrowArrayAppend##NAME##Slice(array, values.data(), n, nullptr);  \
+    });                                                                      \
+  }                                                                          \
+  BENCHMARK(BM_ArrowArrayAppend##NAME##Slice)->NANOARROW_BENCHMARK_SIZES
+
+NANOARROW_BENCHMARK_APPEND_SLICE(Int8, NANOARROW_TYPE_INT8, int8_t);
+NANOARROW_BENCHMARK_APPEND_SLICE(UInt8, NANOARROW_TYPE_UINT8, uint8_t);
+NANOARROW_BENCHMARK_APPEND_SLICE(Int16, NANOARROW_TYPE_INT16, int16_t);
+NANOARROW_BENCHMARK_APPEND_SLICE(UInt16, NANOARROW_TYPE_UINT16, uint16_t);
+NANOARROW_BENCHMARK_APPEND_SLICE(Int32, NANOARROW_TYPE_INT32, int32_t);
+NANOARROW_BENCHMARK_APPEND_SLICE(UInt32, NANOARROW_TYPE_UINT32, uint32_t);
+NANOARROW_BENCHMARK_APPEND_SLICE(Int64, NANOARROW_TYPE_INT64, int64_t);
+NANOARROW_BENCHMARK_APPEND_SLICE(UInt64, NANOARROW_TYPE_UINT64, uint64_t);
+NANOARROW_BENCHMARK_APPEND_SLICE(Float, NANOARROW_TYPE_FLOAT, float);
+NANOARROW_BENCHMARK_APPEND_SLICE(Double, NANOARROW_TYPE_DOUBLE, double);
+
+static void BM_ArrowArrayAppendStrings(benchmark::State& state) {
+  std::vector<struct ArrowStringView> values(state.range(0), ArrowCharView("abcdefg"));
+  BenchmarkAppendSlice(state, NANOARROW_TYPE_STRING,
+                       [&values](struct ArrowArray* array, int64_t n) {
+                         return ArrowArrayAppendStrings(array, values.data(), n, nullptr);
+                       });
+}
+
+static void BM_ArrowArrayAppendStringsFromOffsets(benchmark::State& state) {
+  int64_t n = state.range(0);
+  std::string data(n * 7, 'a');
+  std::vector<int32_t> offsets(n + 1);
+  for (int64_t i = 0; i <= n; i++) {
+    offsets[i] = static_cast<int32_t>(i * 7);
+  }
+
+  BenchmarkAppendSlice(state, NANOARROW_TYPE_STRING,
+                       [&](struct ArrowArray* array, int64_t n) {
+                         return ArrowArrayAppendStringsFromOffsets(
+                             array, offsets.data(), data.data(), n, nullptr);
+                       });
+}
+
+static void BM_ArrowArrayAppendStringsFromLargeOffsets(benchmark::State& state) {
+  int64_t n = state.range(0);
+  std::string data(n * 7, 'a');
+  std::vector<int64_t> offsets(n + 1);
+  for (int64_t i = 0; i <= n; i++) {
+    offsets[i] = i * 7;
+  }
+
+  BenchmarkAppendSlice(state, NANOARROW_TYPE_LARGE_STRING,
+                       [&](struct ArrowArray* array, int64_t n) {
+                         return ArrowArrayAppendStringsFromLargeOffsets(
+                             array, offsets.data(), data.data(), n, nullptr);
+                       });
+}
+
+// Measures ArrowArrayFinishBuilding() at the validation level given by the second
+// argument. Building the array is excluded from the timing.
+static void BM_ArrowArrayFinishBuilding(benchmark::State& state) {
+  int64_t n = state.range(0);
+  auto level = static_cast<enum ArrowValidationLevel>(state.range(1));
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    struct ArrowArray array;
+    BENCHMARK_RETURN_NOT_OK(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING));
+    BENCHMARK_RETURN_NOT_OK(ArrowArrayStartAppending(&array));
+    for (int64_t i = 0; i < n; i++) {
+      BENCHMARK_RETURN_NOT_OK(ArrowArrayAppendString(&array, ArrowCharView("abcdefg")));
+    }
+    state.ResumeTiming();
+
+    BENCHMARK_RETURN_NOT_OK(ArrowArrayFinishBuilding(&array, level, nullptr));
+
+    state.PauseTiming();
+    array.release(&array);
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void BM_ArrowArrayViewSetArray(benchmark::State& state) {
+  int64_t n = state.range(0);
+  struct ArrowArray array;
+  BENCHMARK_RETURN_NOT_OK(MakeStringArray(&array, n));
+
+  struct ArrowArrayView array_view;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING);
+
+  for (auto _ : state) {
+    if (ArrowArrayViewSetArray(&array_view, &array, nullptr) != NANOARROW_OK) {
+      state.SkipWithError("ArrowArrayViewSetArray() failed");
+      break;
+    }
+    benchmark::DoNotOptimize(array_view.buffer_views[2].size_bytes);
+  }
+
+  ArrowArrayViewReset(&array_view);
+  array.release(&array);
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Measures ArrowSchemaViewInit() on each child of a struct with n_fields fields
+// of varying types (the argument is the number of fields rather than rows)
+static void BM_ArrowSchemaViewInit(benchmark::State& state) {
+  int64_t n_fields = state.range(0);
+  const char* formats[] = {"i", "l", "u", "+l", "d:10,2", "tsu:UTC", "w:16"};
+  const int64_t n_formats = sizeof(formats) / sizeof(formats[0]);
+
+  struct ArrowSchema schema;
+  BENCHMARK_RETURN_NOT_OK(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT));
+  BENCHMARK_RETURN_NOT_OK(ArrowSchemaAllocateChildren(&schema, n_fields));
+  for (int64_t i = 0; i < n_fields; i++) {
+    ArrowSchemaInit(schema.children[i]);
+    BENCHMARK_RETURN_NOT_OK(
+        ArrowSchemaSetFormat(schema.children[i], formats[i % n_formats]));
+    if (std::strcmp(formats[i % n_formats], "+l") == 0) {
+      BENCHMARK_RETURN_NOT_OK(ArrowSchemaAllocateChildren(schema.children[i], 1));
+      BENCHMARK_RETURN_NOT_OK(
+          ArrowSchemaInitFromType(schema.children[i]->children[0], NANOARROW_TYPE_INT32));
+      BENCHMARK_RETURN_NOT_OK(
+          ArrowSchemaSetName(schema.children[i]->children[0], "item"));
+    }
+  }
+
+  struct ArrowSchemaView schema_view;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < n_fields; i++) {
+      if (ArrowSchemaViewInit(&schema_view, schema.children[i], nullptr) !=
+          NANOARROW_OK) {
+        state.SkipWithError("ArrowSchemaViewInit() failed");
+        break;
+      }
+      benchmark::DoNotOptimize(schema_view.type);
+    }
+  }
+
+  schema.release(&schema);
+  state.SetItemsProcessed(state.iterations() * n_fields);
+}
+
+BENCHMARK(BM_ArrowBitCountSet)->NANOARROW_BENCHMARK_SIZES;
+BENCHMARK(BM_ArrowBitsUnpackInt8)->NANOARROW_BENCHMARK_SIZES;
+BENCHMARK(BM_ArrowArrayAppendInt)->NANOARROW_BENCHMARK_SIZES;
+BENCHMARK(BM_ArrowArrayAppendUInt)->NANOARROW_BENCHMARK_SIZES;
+BENCHMARK(BM_ArrowArrayAppendDouble)->NANOARROW_BENCHMARK_SIZES;
+BENCHMARK(BM_ArrowArrayAppendBool)->NANOARROW_BENCHMARK_SIZES;
+BENCHMARK(BM_ArrowArrayAppendNull)->NANOARROW_BENCHMARK_SIZES;
+BENCHMARK(BM_ArrowArrayAppendEmpty)->NANOARROW_BENCHMARK_SIZES;
+BENCHMARK(BM_ArrowArrayAppendBytes)->NANOARROW_BENCHMARK_SIZES;
+BENCHMARK(BM_ArrowArrayAppendString)->NANOARROW_BENCHMARK_SIZES;
+BENCHMARK(BM_ArrowArrayAppendInterval)->NANOARROW_BENCHMARK_SIZES;
+BENCHMARK(BM_ArrowArrayAppendDecimal)->NANOARROW_BENCHMARK_SIZES;
+BENCHMARK(BM_ArrowArrayAppendStrings)->NANOARROW_BENCHMARK_SIZES;
+BENCHMARK(BM_ArrowArrayAppendStringsFromOffsets)->NANOARROW_BENCHMARK_SIZES;
+BENCHMARK(BM_ArrowArrayAppendStringsFromLargeOffsets)->NANOARROW_BENCHMARK_SIZES;
+BENCHMARK(BM_ArrowArrayFinishBuilding)
+    ->ArgsProduct({benchmark::CreateRange(1000, 100000000, 10),
+                   {NANOARROW_VALIDATION_LEVEL_NONE, NANOARROW_VALIDATION_LEVEL_MINIMAL,
+                    NANOARROW_VALIDATION_LEVEL_DEFAULT, NANOARROW_VALIDATION_LEVEL_FULL}})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ArrowArrayViewSetArray)->NANOARROW_BENCHMARK_SIZES;
+BENCHMARK(BM_ArrowSchemaViewInit)->RangeMultiplier(10)->Range(1, 1000);
+
+BENCHMARK_MAIN();
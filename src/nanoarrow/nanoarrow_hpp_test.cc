@@ -15,6 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "nanoarrow/nanoarrow.hpp"
@@ -140,6 +143,173 @@ TEST(NanoarrowHppTest, NanoarrowHppUniqueBufferTest) {
   EXPECT_EQ(buffer3->size_bytes, 123);
 }
 
+TEST(NanoarrowHppTest, NanoarrowHppBufferInitSequenceTest) {
+  // std::vector: the buffer points to the vector's storage
+  std::vector<int32_t> values = {1, 2, 3};
+  const int32_t* values_data = values.data();
+  nanoarrow::UniqueBuffer buffer;
+  nanoarrow::BufferInitSequence(buffer.get(), std::move(values));
+  EXPECT_EQ(buffer->data, reinterpret_cast<const uint8_t*>(values_data));
+  EXPECT_EQ(buffer->size_bytes, 3 * sizeof(int32_t));
+  buffer.reset();
+
+  // Empty containers leave the buffer empty
+  nanoarrow::BufferInitSequence(buffer.get(), std::vector<int32_t>());
+  EXPECT_EQ(buffer->data, nullptr);
+  EXPECT_EQ(buffer->size_bytes, 0);
+
+  // std::string (including one short enough to be stored inline)
+  nanoarrow::UniqueBuffer buffer2;
+  nanoarrow::BufferInitSequence(buffer2.get(), std::string("abc"));
+  EXPECT_EQ(buffer2->size_bytes, 3);
+  EXPECT_EQ(memcmp(buffer2->data, "abc", 3), 0);
+
+  // std::unique_ptr<T[]>
+  std::unique_ptr<int64_t[]> array_values(new int64_t[2]{5, 6});
+  const int64_t* array_values_data = array_values.get();
+  nanoarrow::UniqueBuffer buffer3;
+  nanoarrow::BufferInitSequence(buffer3.get(), std::move(array_values), 2);
+  EXPECT_EQ(buffer3->data, reinterpret_cast<const uint8_t*>(array_values_data));
+  EXPECT_EQ(buffer3->size_bytes, 2 * sizeof(int64_t));
+
+  // Any object that owns the data
+  auto shared = std::make_shared<std::vector<uint8_t>>(4, 0xff);
+  nanoarrow::UniqueBuffer buffer4;
+  nanoarrow::BufferInitWrapped(buffer4.get(), shared, shared->data(), 4);
+  EXPECT_EQ(shared.use_count(), 2);
+  buffer4.reset();
+  EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppArraySetBufferSequenceTest) {
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayInitFromType(array.get(), NANOARROW_TYPE_STRING), NANOARROW_OK);
+
+  std::vector<int32_t> offsets = {0, 3, 7};
+  const int32_t* offsets_data = offsets.data();
+  ASSERT_EQ(nanoarrow::ArraySetBufferSequence(array.get(), 1, std::move(offsets)),
+            NANOARROW_OK);
+  std::unique_ptr<char[]> data(new char[7]{'a', 'b', 'c', 'd', 'e', 'f', 'g'});
+  ASSERT_EQ(nanoarrow::ArraySetBufferSequence(array.get(), 2, std::move(data), 7),
+            NANOARROW_OK);
+  array->length = 2;
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+  EXPECT_EQ(array->buffers[1], offsets_data);
+
+  nanoarrow::UniqueArrayView array_view;
+  ArrowArrayViewInitFromType(array_view.get(), NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+            NANOARROW_OK);
+  struct ArrowStringView value = ArrowArrayViewGetStringUnsafe(array_view.get(), 1);
+  EXPECT_EQ(std::string(value.data, value.size_bytes), "defg");
+
+  // Out of range
+  EXPECT_EQ(nanoarrow::ArraySetBufferSequence(array.get(), 3, std::vector<int32_t>{}),
+            EINVAL);
+}
+
+#if defined(NANOARROW_HPP_HAVE_MEMORY_RESOURCE)
+// Counts the bytes allocated from a memory_resource that were not deallocated
+class CountingMemoryResource : public std::pmr::memory_resource {
+ public:
+  int64_t bytes_allocated{0};
+  std::size_t last_alignment{0};
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    bytes_allocated += static_cast<int64_t>(bytes);
+    last_alignment = alignment;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+    bytes_allocated -= static_cast<int64_t>(bytes);
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+TEST(NanoarrowHppTest, NanoarrowHppMemoryResourceAllocatorTest) {
+  CountingMemoryResource resource;
+
+  nanoarrow::UniqueBuffer buffer;
+  ASSERT_EQ(ArrowBufferSetAllocator(buffer.get(),
+                                    nanoarrow::MemoryResourceAllocator(&resource)),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowBufferAppendInt32(buffer.get(), 123), NANOARROW_OK);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer->data) % 64, 0);
+  EXPECT_EQ(resource.last_alignment, 64);
+  EXPECT_EQ(resource.bytes_allocated, buffer->capacity_bytes);
+
+  // Growing keeps the content and deallocates the previous allocation
+  for (int32_t i = 0; i < 1000; i++) {
+    ASSERT_EQ(ArrowBufferAppendInt32(buffer.get(), i), NANOARROW_OK);
+  }
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(buffer->data)[0], 123);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(buffer->data)[1000], 999);
+  EXPECT_EQ(resource.bytes_allocated, buffer->capacity_bytes);
+
+  // ...as does shrinking
+  ASSERT_EQ(ArrowBufferResize(buffer.get(), 8, true), NANOARROW_OK);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(buffer->data)[0], 123);
+  EXPECT_EQ(resource.bytes_allocated, 8);
+
+  buffer.reset();
+  EXPECT_EQ(resource.bytes_allocated, 0);
+
+  // Every buffer of an array
+  std::pmr::monotonic_buffer_resource arena(&resource);
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayInitFromType(array.get(), NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArraySetAllocator(array.get(),
+                                   nanoarrow::MemoryResourceAllocator(&arena)),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.get(), ArrowCharView("abc")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+  EXPECT_GT(resource.bytes_allocated, 0);
+  EXPECT_EQ(memcmp(array->buffers[2], "abc", 3), 0);
+  array.reset();
+  arena.release();
+  EXPECT_EQ(resource.bytes_allocated, 0);
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppAllocatorMemoryResourceTest) {
+  struct ArrowBufferAllocatorTracker tracker;
+  ArrowBufferAllocatorTrackerInit(&tracker, ArrowBufferAllocatorDefault());
+  nanoarrow::AllocatorMemoryResource resource(ArrowBufferAllocatorTracking(&tracker));
+  EXPECT_EQ(resource.allocator().private_data, &tracker);
+  EXPECT_TRUE(resource.is_equal(resource));
+  EXPECT_FALSE(resource.is_equal(*std::pmr::new_delete_resource()));
+
+  {
+    std::pmr::vector<int64_t> values(&resource);
+    for (int64_t i = 0; i < 1000; i++) {
+      values.push_back(i);
+    }
+    EXPECT_EQ(values[999], 999);
+    EXPECT_GE(tracker.bytes_allocated, 1000 * sizeof(int64_t));
+  }
+  EXPECT_EQ(tracker.bytes_allocated, 0);
+
+  // Over-aligned allocations
+  void* ptr = resource.allocate(100, 256);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 256, 0);
+  memset(ptr, 0xff, 100);
+  resource.deallocate(ptr, 100, 256);
+  EXPECT_EQ(tracker.bytes_allocated, 0);
+
+  // Failed allocations throw
+  nanoarrow::AllocatorMemoryResource failing(
+      ArrowBufferDeallocator([](struct ArrowBufferAllocator*, uint8_t*, int64_t) {},
+                             nullptr));
+  EXPECT_THROW(static_cast<void>(failing.allocate(8)), std::bad_alloc);
+}
+#endif
+
 TEST(NanoarrowHppTest, NanoarrowHppUniqueBitmapTest) {
   nanoarrow::UniqueBitmap bitmap;
   EXPECT_EQ(bitmap->buffer.data, nullptr);
@@ -226,3 +396,538 @@ TEST(NanoarrowHppTest, NanoarrowHppVectorArrayStreamTest) {
   EXPECT_EQ(array_stream->get_next(array_stream.get(), array.get()), NANOARROW_OK);
   EXPECT_EQ(array->release, nullptr);
 }
+
+// Counts non-null values and sums numeric values or string lengths
+struct SumVisitor {
+  const struct ArrowArrayView* array_view;
+  int64_t n_valid;
+  double sum;
+
+  template <typename Tag>
+  ArrowErrorCode operator()(Tag) {
+    typename Tag::view_type view(array_view);
+    for (int64_t i = 0; i < view.length(); i++) {
+      if (view.is_valid(i)) {
+        n_valid++;
+        sum += Value(view[i]);
+      }
+    }
+
+    return NANOARROW_OK;
+  }
+
+  template <typename T>
+  static double Value(T value) {
+    return static_cast<double>(value);
+  }
+
+  static double Value(struct ArrowStringView value) {
+    return static_cast<double>(value.size_bytes);
+  }
+};
+
+TEST(NanoarrowHppTest, NanoarrowHppNumericViewTest) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+
+  ASSERT_EQ(ArrowArrayInitFromType(array.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.get(), 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(array.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.get(), 4), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+  // Slice to check that the offset is applied
+  array->offset = 1;
+  array->length = 3;
+
+  ArrowArrayViewInitFromType(array_view.get(), NANOARROW_TYPE_INT32);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr), NANOARROW_OK);
+
+  nanoarrow::NumericView<int32_t> view(array_view.get());
+  EXPECT_EQ(view.length(), 3);
+  EXPECT_EQ(view[0], 2);
+  EXPECT_EQ(view[2], 4);
+  EXPECT_TRUE(view.is_valid(0));
+  EXPECT_FALSE(view.is_valid(1));
+  EXPECT_EQ(view.data() + 3, view.end());
+
+  std::vector<int32_t> values(view.begin(), view.end());
+  EXPECT_EQ(values.size(), 3);
+  EXPECT_EQ(values[0], 2);
+
+  SumVisitor visitor{array_view.get(), 0, 0};
+  EXPECT_EQ(nanoarrow::VisitNumericType(array_view->storage_type, visitor),
+            NANOARROW_OK);
+  EXPECT_EQ(visitor.n_valid, 2);
+  EXPECT_EQ(visitor.sum, 6);
+
+  EXPECT_EQ(nanoarrow::VisitNumericType(NANOARROW_TYPE_STRING, visitor), ENOTSUP);
+  EXPECT_EQ(nanoarrow::VisitType(NANOARROW_TYPE_STRUCT, visitor), ENOTSUP);
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppStringViewTest) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+
+  ASSERT_EQ(ArrowArrayInitFromType(array.get(), NANOARROW_TYPE_LARGE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.get(), ArrowCharView("a")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.get(), ArrowCharView("bcd")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(array.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.get(), ArrowCharView("ef")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+  array->offset = 1;
+  array->length = 3;
+
+  ArrowArrayViewInitFromType(array_view.get(), NANOARROW_TYPE_LARGE_STRING);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr), NANOARROW_OK);
+
+  nanoarrow::LargeStringView view(array_view.get());
+  EXPECT_EQ(view.length(), 3);
+  EXPECT_EQ(std::string(view[0].data, view[0].size_bytes), "bcd");
+  EXPECT_FALSE(view.is_valid(1));
+  EXPECT_EQ(std::string(view[2].data, view[2].size_bytes), "ef");
+
+  SumVisitor visitor{array_view.get(), 0, 0};
+  EXPECT_EQ(nanoarrow::VisitType(array_view->storage_type, visitor), NANOARROW_OK);
+  EXPECT_EQ(visitor.n_valid, 2);
+  EXPECT_EQ(visitor.sum, 5);
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppViewAsRangeTest) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+
+  ASSERT_EQ(ArrowArrayInitFromType(array.get(), NANOARROW_TYPE_DOUBLE), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(array.get(), 1.5), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(array.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(array.get(), 3.5), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+  ArrowArrayViewInitFromType(array_view.get(), NANOARROW_TYPE_DOUBLE);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr), NANOARROW_OK);
+
+  nanoarrow::ViewAsRange<double> range(array_view.get());
+  EXPECT_EQ(range.size(), 3);
+  EXPECT_EQ(range.end() - range.begin(), 3);
+  EXPECT_EQ(*range.begin()[2], 3.5);
+  EXPECT_FALSE(range[1]);
+
+  double sum = 0;
+  int64_t n_valid = 0;
+  for (nanoarrow::Maybe<double> item : range) {
+    if (item) {
+      sum += *item;
+      n_valid++;
+    }
+  }
+  EXPECT_EQ(sum, 5);
+  EXPECT_EQ(n_valid, 2);
+
+  auto it = range.end();
+  --it;
+  EXPECT_EQ((*it).value, 3.5);
+  it -= 2;
+  EXPECT_EQ(it, range.begin());
+  EXPECT_LT(it, range.end());
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppViewAsStringsTest) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+
+  ASSERT_EQ(ArrowArrayInitFromType(array.get(), NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.get(), ArrowCharView("abc")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.get(), ArrowCharView("de")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+  ArrowArrayViewInitFromType(array_view.get(), NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr), NANOARROW_OK);
+
+  std::vector<std::string> values;
+  for (auto item : nanoarrow::ViewAsStrings(array_view.get())) {
+    ASSERT_TRUE(item.is_valid);
+    values.emplace_back(item.value.data, item.value.size_bytes);
+  }
+
+  EXPECT_EQ(values, std::vector<std::string>({"abc", "de"}));
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppRebindableArrayViewTest) {
+  nanoarrow::UniqueSchema schema;
+  ArrowSchemaInit(schema.get());
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0], "col1"), NANOARROW_OK);
+
+  nanoarrow::RebindableArrayView view;
+  struct ArrowArrayView** children = nullptr;
+
+  for (int32_t i = 0; i < 3; i++) {
+    nanoarrow::UniqueArray array;
+    ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendInt(array->children[0], i), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(array.get()), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+    ASSERT_EQ(view.SetArray(schema.get(), array.get(), nullptr), NANOARROW_OK);
+    EXPECT_EQ(ArrowArrayViewGetIntUnsafe(view->children[0], 0), i);
+
+    // The child tree is only allocated once
+    if (children == nullptr) {
+      children = view->children;
+    }
+    EXPECT_EQ(view->children, children);
+  }
+
+  // Renaming a field does not require a new view
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0], "col2"), NANOARROW_OK);
+  ASSERT_EQ(view.Bind(schema.get(), nullptr), NANOARROW_OK);
+  EXPECT_EQ(view->children, children);
+
+  // ...but changing a type does
+  nanoarrow::UniqueSchema schema2;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema2.get(), NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(view.Bind(schema2.get(), nullptr), NANOARROW_OK);
+  EXPECT_EQ(view->storage_type, NANOARROW_TYPE_STRING);
+  EXPECT_EQ(view->n_children, 0);
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppBuilderTest) {
+  nanoarrow::Builder<int16_t> builder;
+  ASSERT_EQ(builder.Init(), NANOARROW_OK);
+
+  ASSERT_EQ(builder.Reserve(100), NANOARROW_OK);
+  for (int16_t i = 0; i < 100; i++) {
+    builder.AppendUnsafe(i);
+  }
+
+  ASSERT_EQ(builder.AppendNull(), NANOARROW_OK);
+  for (int16_t i = 0; i < 100; i++) {
+    ASSERT_EQ(builder.Append(i), NANOARROW_OK);
+  }
+
+  int16_t values[] = {1, 2, 3};
+  ASSERT_EQ(builder.AppendValues(values, 3), NANOARROW_OK);
+  EXPECT_EQ(builder.length(), 204);
+
+  // Builders are move-only
+  nanoarrow::Builder<int16_t> builder2(std::move(builder));
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(builder2.Finish(&array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(array->length, 204);
+  EXPECT_EQ(array->null_count, 1);
+
+  nanoarrow::UniqueArrayView array_view;
+  ArrowArrayViewInitFromType(array_view.get(), NANOARROW_TYPE_INT16);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewValidate(array_view.get(), NANOARROW_VALIDATION_LEVEL_FULL,
+                                   nullptr),
+            NANOARROW_OK);
+
+  nanoarrow::ViewAsRange<int16_t> range(array_view.get());
+  EXPECT_EQ(*range[99], 99);
+  EXPECT_FALSE(range[100]);
+  EXPECT_EQ(*range[101], 0);
+  EXPECT_EQ(*range[200], 99);
+  EXPECT_EQ(*range[203], 3);
+
+  // The builder can be reused after Init()
+  ASSERT_EQ(builder2.Init(), NANOARROW_OK);
+  ASSERT_EQ(builder2.Append(5), NANOARROW_OK);
+  ASSERT_EQ(builder2.Finish(&array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(array->length, 1);
+  EXPECT_EQ(array->null_count, 0);
+}
+
+namespace static_schema_test {
+NANOARROW_SCHEMA_NAME(ts);
+NANOARROW_SCHEMA_NAME(host);
+NANOARROW_SCHEMA_NAME(value);
+
+namespace na = nanoarrow::schema;
+using Telemetry =
+    na::Struct<na::Field<ts, na::Timestamp<NANOARROW_TIME_UNIT_MICRO>, false>,
+               na::Field<host, na::Utf8>, na::Field<value, na::Double>>;
+}  // namespace static_schema_test
+
+TEST(NanoarrowHppTest, NanoarrowHppStaticSchemaTest) {
+  using static_schema_test::Telemetry;
+
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::StaticSchema<Telemetry>::Export(schema.get());
+  ASSERT_NE(schema->release, nullptr);
+
+  char buf[128];
+  ArrowSchemaToString(schema.get(), buf, sizeof(buf), true);
+  EXPECT_STREQ(buf, "struct<ts: timestamp('us', ''), host: string, value: double>");
+  EXPECT_EQ(schema->flags, ARROW_FLAG_NULLABLE);
+  EXPECT_EQ(schema->children[0]->flags, 0);
+  EXPECT_EQ(schema->children[1]->flags, ARROW_FLAG_NULLABLE);
+
+  // Every export shares the same children
+  nanoarrow::UniqueSchema schema2;
+  nanoarrow::StaticSchema<Telemetry>::Export(schema2.get());
+  EXPECT_EQ(schema2->children, schema->children);
+  EXPECT_EQ(schema2->children, nanoarrow::StaticSchema<Telemetry>::get()->children);
+
+  // Releasing an export does not affect the static schema
+  schema.reset();
+  EXPECT_NE(nanoarrow::StaticSchema<Telemetry>::get()->release, nullptr);
+  EXPECT_NE(schema2->children[0]->release, nullptr);
+
+  nanoarrow::UniqueSchema empty;
+  nanoarrow::StaticSchema<nanoarrow::schema::Struct<>>::Export(empty.get());
+  EXPECT_STREQ(empty->format, "+s");
+  EXPECT_EQ(empty->n_children, 0);
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppStaticBuilderTest) {
+  using static_schema_test::Telemetry;
+
+  nanoarrow::StaticBuilder<Telemetry> builder;
+  ASSERT_EQ(builder.Init(), NANOARROW_OK);
+  ASSERT_EQ(builder.Append(1, ArrowCharView("abc"), 1.5), NANOARROW_OK);
+  ASSERT_EQ(builder.AppendNull(), NANOARROW_OK);
+  ASSERT_EQ(builder.Append(3, ArrowCharView("defg"), 3.5), NANOARROW_OK);
+  EXPECT_EQ(builder.length(), 3);
+
+  nanoarrow::StaticBuilder<Telemetry> builder2(std::move(builder));
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(builder2.Finish(&array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(array->length, 3);
+  EXPECT_EQ(array->null_count, 1);
+
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::StaticSchema<Telemetry>::Export(schema.get());
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewValidate(array_view.get(), NANOARROW_VALIDATION_LEVEL_FULL,
+                                   nullptr),
+            NANOARROW_OK);
+
+  EXPECT_EQ(ArrowArrayViewGetIntUnsafe(array_view->children[0], 2), 3);
+  struct ArrowStringView item =
+      ArrowArrayViewGetStringUnsafe(array_view->children[1], 2);
+  EXPECT_EQ(std::string(item.data, static_cast<size_t>(item.size_bytes)), "defg");
+  EXPECT_TRUE(ArrowArrayViewIsNull(array_view.get(), 1));
+  EXPECT_EQ(ArrowArrayViewGetDoubleUnsafe(array_view->children[2], 0), 1.5);
+}
+
+// A stream that returns n_arrays int32 arrays and then fails
+class FailingArrayStream : public nanoarrow::EmptyArrayStream {
+ public:
+  static nanoarrow::UniqueArrayStream MakeUnique(struct ArrowSchema* schema,
+                                                 int64_t n_arrays) {
+    nanoarrow::UniqueArrayStream stream;
+    (new FailingArrayStream(schema, n_arrays))->MakeStream(stream.get());
+    return stream;
+  }
+
+ protected:
+  FailingArrayStream(struct ArrowSchema* schema, int64_t n_arrays)
+      : EmptyArrayStream(schema), n_arrays_(n_arrays) {}
+
+  int get_next(struct ArrowArray* array) {
+    if (n_arrays_-- == 0) {
+      ArrowErrorSet(&error_, "upstream failed");
+      return EIO;
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(array, NANOARROW_TYPE_INT32));
+    return ArrowArrayFinishBuildingDefault(array, nullptr);
+  }
+
+ private:
+  int64_t n_arrays_;
+};
+
+TEST(NanoarrowHppTest, NanoarrowHppReadaheadArrayStreamTest) {
+  std::vector<nanoarrow::UniqueArray> arrays_in(5);
+  for (int32_t i = 0; i < 5; i++) {
+    ASSERT_EQ(ArrowArrayInitFromType(arrays_in[i].get(), NANOARROW_TYPE_INT32),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(arrays_in[i].get()), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendInt(arrays_in[i].get(), i), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(arrays_in[i].get(), nullptr),
+              NANOARROW_OK);
+  }
+
+  nanoarrow::UniqueSchema schema_in;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema_in.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+  auto upstream =
+      nanoarrow::VectorArrayStream::MakeUnique(schema_in.get(), std::move(arrays_in));
+  auto stream = nanoarrow::ReadaheadArrayStream::MakeUnique(upstream.get(), 2);
+
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(stream->get_schema(stream.get(), schema.get()), NANOARROW_OK);
+  EXPECT_STREQ(schema->format, "i");
+
+  nanoarrow::UniqueArrayView array_view;
+  ArrowArrayViewInitFromType(array_view.get(), NANOARROW_TYPE_INT32);
+  for (int32_t i = 0; i < 5; i++) {
+    nanoarrow::UniqueArray array;
+    ASSERT_EQ(stream->get_next(stream.get(), array.get()), NANOARROW_OK);
+    ASSERT_NE(array->release, nullptr);
+    ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+              NANOARROW_OK);
+    EXPECT_EQ(ArrowArrayViewGetIntUnsafe(array_view.get(), 0), i);
+  }
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(stream->get_next(stream.get(), array.get()), NANOARROW_OK);
+  EXPECT_EQ(array->release, nullptr);
+  ASSERT_EQ(stream->get_next(stream.get(), array.get()), NANOARROW_OK);
+  EXPECT_EQ(array->release, nullptr);
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppReadaheadArrayStreamErrorTest) {
+  nanoarrow::UniqueSchema schema_in;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema_in.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+  auto upstream = FailingArrayStream::MakeUnique(schema_in.get(), 2);
+  auto stream = nanoarrow::ReadaheadArrayStream::MakeUnique(upstream.get(), 4);
+
+  // Arrays produced before the error are still returned
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(stream->get_next(stream.get(), array.get()), NANOARROW_OK);
+  EXPECT_NE(array->release, nullptr);
+  array.reset();
+  ASSERT_EQ(stream->get_next(stream.get(), array.get()), NANOARROW_OK);
+  EXPECT_NE(array->release, nullptr);
+  array.reset();
+
+  EXPECT_EQ(stream->get_next(stream.get(), array.get()), EIO);
+  EXPECT_STREQ(stream->get_last_error(stream.get()), "upstream failed");
+
+  // Releasing a stream with queued arrays stops the background thread
+  nanoarrow::UniqueSchema schema_in2;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema_in2.get(), NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  auto upstream2 = FailingArrayStream::MakeUnique(schema_in2.get(), 100);
+  auto stream2 = nanoarrow::ReadaheadArrayStream::MakeUnique(upstream2.get(), 1);
+  stream2.reset();
+}
+
+// Create a stream of n_arrays single-element int32 arrays whose values start at value
+static nanoarrow::UniqueArrayStream MakeInt32Stream(int32_t value, int64_t n_arrays) {
+  std::vector<nanoarrow::UniqueArray> arrays(n_arrays);
+  for (auto& array : arrays) {
+    NANOARROW_THROW_NOT_OK(ArrowArrayInitFromType(array.get(), NANOARROW_TYPE_INT32));
+    NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(array.get()));
+    NANOARROW_THROW_NOT_OK(ArrowArrayAppendInt(array.get(), value++));
+    NANOARROW_THROW_NOT_OK(ArrowArrayFinishBuildingDefault(array.get(), nullptr));
+  }
+
+  nanoarrow::UniqueSchema schema;
+  NANOARROW_THROW_NOT_OK(ArrowSchemaInitFromType(schema.get(), NANOARROW_TYPE_INT32));
+  return nanoarrow::VectorArrayStream::MakeUnique(schema.get(), std::move(arrays));
+}
+
+// Collect the values of a stream of single-element int32 arrays
+static std::vector<int32_t> CollectInt32Stream(struct ArrowArrayStream* stream) {
+  std::vector<int32_t> values;
+  nanoarrow::UniqueArrayView array_view;
+  ArrowArrayViewInitFromType(array_view.get(), NANOARROW_TYPE_INT32);
+  while (true) {
+    nanoarrow::UniqueArray array;
+    NANOARROW_THROW_NOT_OK(stream->get_next(stream, array.get()));
+    if (array->release == nullptr) {
+      break;
+    }
+
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr));
+    int64_t value = ArrowArrayViewGetIntUnsafe(array_view.get(), 0);
+    values.push_back(static_cast<int32_t>(value));
+  }
+
+  return values;
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppMergeArrayStreamTest) {
+  using Order = nanoarrow::MergeArrayStream::Order;
+
+  std::vector<nanoarrow::UniqueArrayStream> streams;
+  streams.push_back(MakeInt32Stream(0, 3));
+  streams.push_back(MakeInt32Stream(10, 1));
+  streams.push_back(MakeInt32Stream(20, 2));
+  auto stream = nanoarrow::MergeArrayStream::MakeUnique(std::move(streams),
+                                                        Order::kRoundRobin);
+
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(stream->get_schema(stream.get(), schema.get()), NANOARROW_OK);
+  EXPECT_STREQ(schema->format, "i");
+  EXPECT_EQ(CollectInt32Stream(stream.get()),
+            std::vector<int32_t>({0, 10, 20, 1, 21, 2}));
+
+  // Arrival order yields every array but in no particular order
+  for (int i = 0; i < 10; i++) {
+    streams.clear();
+    streams.push_back(MakeInt32Stream(0, 3));
+    streams.push_back(MakeInt32Stream(10, 1));
+    streams.push_back(MakeInt32Stream(20, 2));
+    stream.reset(nanoarrow::MergeArrayStream::MakeUnique(std::move(streams)).get());
+
+    std::vector<int32_t> values = CollectInt32Stream(stream.get());
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(values, std::vector<int32_t>({0, 1, 2, 10, 20, 21}));
+  }
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppMergeArrayStreamErrorTest) {
+  using Order = nanoarrow::MergeArrayStream::Order;
+  nanoarrow::UniqueArray array;
+
+  // Mismatched schemas
+  std::vector<nanoarrow::UniqueArrayStream> streams;
+  streams.push_back(MakeInt32Stream(0, 1));
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.get(), NANOARROW_TYPE_INT64), NANOARROW_OK);
+  streams.push_back(nanoarrow::EmptyArrayStream::MakeUnique(schema.get()));
+  auto stream = nanoarrow::MergeArrayStream::MakeUnique(std::move(streams));
+  EXPECT_EQ(stream->get_schema(stream.get(), schema.get()), EINVAL);
+  EXPECT_EQ(stream->get_next(stream.get(), array.get()), EINVAL);
+  EXPECT_STREQ(stream->get_last_error(stream.get()),
+               "Expected schema of stream 1 to equal that of stream 0");
+
+  // No streams
+  stream.reset(nanoarrow::MergeArrayStream::MakeUnique({}).get());
+  EXPECT_EQ(stream->get_next(stream.get(), array.get()), EINVAL);
+  EXPECT_STREQ(stream->get_last_error(stream.get()), "Expected at least one stream");
+
+  // Errors are returned on the failing stream's turn
+  nanoarrow::UniqueSchema schema_in;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema_in.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+  streams.clear();
+  streams.push_back(MakeInt32Stream(0, 3));
+  streams.push_back(FailingArrayStream::MakeUnique(schema_in.get(), 1));
+  stream.reset(
+      nanoarrow::MergeArrayStream::MakeUnique(std::move(streams), Order::kRoundRobin)
+          .get());
+  for (int i = 0; i < 3; i++) {
+    ASSERT_EQ(stream->get_next(stream.get(), array.get()), NANOARROW_OK);
+    EXPECT_NE(array->release, nullptr);
+    array.reset();
+  }
+  EXPECT_EQ(stream->get_next(stream.get(), array.get()), EIO);
+  EXPECT_STREQ(stream->get_last_error(stream.get()), "upstream failed");
+
+  // ...or as soon as they are observed
+  ASSERT_EQ(ArrowSchemaInitFromType(schema_in.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+  streams.clear();
+  streams.push_back(FailingArrayStream::MakeUnique(schema_in.get(), 0));
+  stream.reset(nanoarrow::MergeArrayStream::MakeUnique(std::move(streams)).get());
+  EXPECT_EQ(stream->get_next(stream.get(), array.get()), EIO);
+  EXPECT_STREQ(stream->get_last_error(stream.get()), "upstream failed");
+}
@@ -149,6 +149,59 @@ static inline void ArrowArrayStreamMove(struct ArrowArrayStream* src,
   src->release = NULL;
 }
 
+/// \brief A producer of arrays for an ArrowAsyncArrayStreamHandler
+///
+/// Passed to ArrowAsyncArrayStreamHandler::on_schema(). The producer remains valid
+/// until the handler's release callback is invoked, after which it must not be used.
+struct ArrowAsyncProducer {
+  /// \brief Request that n more arrays be delivered to on_next()
+  ///
+  /// Arrays may be delivered before this call returns or later (e.g., once more
+  /// input is available). May be called from within on_schema() or on_next().
+  void (*request)(struct ArrowAsyncProducer* self, int64_t n);
+
+  /// \brief Stop delivering arrays and release the handler
+  ///
+  /// The handler's release callback may be invoked before this call returns.
+  void (*cancel)(struct ArrowAsyncProducer* self);
+
+  /// \brief Opaque producer-specific data
+  void* private_data;
+};
+
+/// \brief A push-based (asynchronous) counterpart to the ArrowArrayStream
+///
+/// A producer first calls on_schema() exactly once and then delivers one array to
+/// on_next() for each array requested via ArrowAsyncProducer::request(). A released
+/// array (i.e., one whose release callback is NULL) marks the end of the stream and
+/// fulfils a request like any other array. If the producer fails, on_error() is
+/// called instead. After the end of the stream, an error, or a cancellation (including
+/// a non-zero return value from on_schema() or on_next()), the producer calls release()
+/// and makes no further calls to the handler. None of these callbacks are called
+/// concurrently with each other.
+struct ArrowAsyncArrayStreamHandler {
+  /// \brief Receive the schema and the producer of the stream
+  ///
+  /// The handler takes ownership of schema.
+  int (*on_schema)(struct ArrowAsyncArrayStreamHandler* self,
+                   struct ArrowAsyncProducer* producer, struct ArrowSchema* schema);
+
+  /// \brief Receive the next array or a released array at the end of the stream
+  ///
+  /// The handler takes ownership of array.
+  int (*on_next)(struct ArrowAsyncArrayStreamHandler* self, struct ArrowArray* array);
+
+  /// \brief Receive an errno-compatible error code and an error message
+  void (*on_error)(struct ArrowAsyncArrayStreamHandler* self, int code,
+                   const char* message);
+
+  /// \brief Release resources of the handler
+  void (*release)(struct ArrowAsyncArrayStreamHandler* self);
+
+  /// \brief Opaque handler-specific data
+  void* private_data;
+};
+
 /// @}
 
 // Utility macros
@@ -294,7 +347,12 @@ enum ArrowType {
   NANOARROW_TYPE_LARGE_STRING,
   NANOARROW_TYPE_LARGE_BINARY,
   NANOARROW_TYPE_LARGE_LIST,
-  NANOARROW_TYPE_INTERVAL_MONTH_DAY_NANO
+  NANOARROW_TYPE_INTERVAL_MONTH_DAY_NANO,
+  NANOARROW_TYPE_RUN_END_ENCODED,
+  NANOARROW_TYPE_BINARY_VIEW,
+  NANOARROW_TYPE_STRING_VIEW,
+  NANOARROW_TYPE_LIST_VIEW,
+  NANOARROW_TYPE_LARGE_LIST_VIEW
 };
 
 /// \brief Get a string value of an enum ArrowType value
@@ -381,6 +439,16 @@ static inline const char* ArrowTypeString(enum ArrowType type) {
       return "large_list";
     case NANOARROW_TYPE_INTERVAL_MONTH_DAY_NANO:
       return "interval_month_day_nano";
+    case NANOARROW_TYPE_RUN_END_ENCODED:
+      return "run_end_encoded";
+    case NANOARROW_TYPE_BINARY_VIEW:
+      return "binary_view";
+    case NANOARROW_TYPE_STRING_VIEW:
+      return "string_view";
+    case NANOARROW_TYPE_LIST_VIEW:
+      return "list_view";
+    case NANOARROW_TYPE_LARGE_LIST_VIEW:
+      return "large_list_view";
     default:
       return NULL;
   }
@@ -412,11 +480,41 @@ enum ArrowValidationLevel {
   /// but do not perform any checks that are O(1) along the length of the buffers.
   NANOARROW_VALIDATION_LEVEL_DEFAULT = 2,
 
-  /// \brief Validate all buffer sizes and all buffer content. This is useful in the
+  /// \brief Validate all buffer sizes and all buffer content, including that the
+  /// non-null elements of string arrays are valid UTF-8. This is useful in the
   /// context of untrusted input or input that may have been corrupted in transit.
   NANOARROW_VALIDATION_LEVEL_FULL = 3
 };
 
+/// \brief Schema comparison options
+/// \ingroup nanoarrow-schema
+///
+/// Options may be combined using bitwise or and are used by ArrowSchemaEquals()
+/// and ArrowSchemaFingerprint().
+enum ArrowSchemaCompareOptions {
+  /// \brief Compare the format, name, flags, and metadata of every node.
+  NANOARROW_SCHEMA_COMPARE_DEFAULT = 0,
+
+  /// \brief Do not compare the name of any node.
+  NANOARROW_SCHEMA_COMPARE_IGNORE_NAMES = 1,
+
+  /// \brief Do not compare the metadata of any node.
+  NANOARROW_SCHEMA_COMPARE_IGNORE_METADATA = 2
+};
+
+/// \brief Options for comparing arrays
+/// \ingroup nanoarrow-array-view
+///
+/// Options may be combined using bitwise or and are used by ArrowArrayViewEquals().
+enum ArrowArrayCompareOptions {
+  /// \brief Compare the bytes of every non-null fixed-width value.
+  NANOARROW_ARRAY_COMPARE_DEFAULT = 0,
+
+  /// \brief Compare floating point values numerically, except that all NaN values
+  /// are considered equal (i.e., 0.0 equals -0.0 and NaN payloads are ignored).
+  NANOARROW_ARRAY_COMPARE_FLOAT_VALUES = 1
+};
+
 /// \brief Get a string value of an enum ArrowTimeUnit value
 /// \ingroup nanoarrow-utils
 ///
@@ -446,7 +544,50 @@ enum ArrowBufferType {
   NANOARROW_BUFFER_TYPE_TYPE_ID,
   NANOARROW_BUFFER_TYPE_UNION_OFFSET,
   NANOARROW_BUFFER_TYPE_DATA_OFFSET,
-  NANOARROW_BUFFER_TYPE_DATA
+  NANOARROW_BUFFER_TYPE_DATA,
+  NANOARROW_BUFFER_TYPE_VIEW_OFFSET,
+  NANOARROW_BUFFER_TYPE_SIZE
+};
+
+/// \brief Strategies for growing the capacity of an ArrowBuffer
+/// \ingroup nanoarrow-buffer
+enum ArrowBufferGrowthPolicy {
+  /// \brief Double the capacity of the buffer (the default)
+  NANOARROW_BUFFER_GROWTH_DOUBLE = 0,
+
+  /// \brief Grow the capacity of the buffer by a factor of 1.5
+  ///
+  /// This wastes less memory than doubling for very large buffers at the
+  /// expense of more frequent reallocation.
+  NANOARROW_BUFFER_GROWTH_FACTOR_1_5 = 1,
+
+  /// \brief Grow by a factor of 1.5 and round up to whole pages
+  ///
+  /// Capacities are rounded up to a multiple of 4 KiB or, once the capacity
+  /// reaches 2 MiB, to a multiple of 2 MiB such that large buffers can be
+  /// backed by huge pages.
+  NANOARROW_BUFFER_GROWTH_PAGE_ALIGNED = 2
+};
+
+/// \brief CPU features used to select kernels at runtime
+/// \ingroup nanoarrow-utils
+///
+/// Features may be combined using bitwise or and are returned by ArrowCpuFeatures().
+enum ArrowCpuFeature {
+  /// \brief The x86 POPCNT instruction
+  NANOARROW_CPU_POPCNT = 1,
+
+  /// \brief x86 AVX2 instructions (including operating system support)
+  NANOARROW_CPU_AVX2 = 2,
+
+  /// \brief x86 AVX-512 foundation instructions
+  NANOARROW_CPU_AVX512 = 4,
+
+  /// \brief ARM NEON (Advanced SIMD) instructions
+  NANOARROW_CPU_NEON = 8,
+
+  /// \brief ARM Scalable Vector Extension instructions
+  NANOARROW_CPU_SVE = 16
 };
 
 /// \brief An non-owning view of a string
@@ -480,6 +621,46 @@ static inline struct ArrowStringView ArrowCharView(const char* value) {
   return out;
 }
 
+/// \brief The maximum number of buffers of any type other than binary or string view
+/// \ingroup nanoarrow-utils
+///
+/// Binary and string view arrays have a validity buffer, a buffer of views, zero or
+/// more variadic data buffers, and a final buffer containing the size of each variadic
+/// data buffer.
+#define NANOARROW_MAX_FIXED_BUFFERS 3
+
+/// \brief The number of bytes of a binary or string view that are stored inline
+/// \ingroup nanoarrow-utils
+#define NANOARROW_BINARY_VIEW_INLINE_SIZE 12
+
+/// \brief The size of a variadic data buffer allocated when building a binary or
+/// string view array
+/// \ingroup nanoarrow-utils
+#define NANOARROW_BINARY_VIEW_BLOCK_SIZE (32 << 10)
+
+/// \brief An element of a binary or string view array
+/// \ingroup nanoarrow-utils
+///
+/// Values of at most NANOARROW_BINARY_VIEW_INLINE_SIZE bytes are stored inline;
+/// otherwise, the view refers to a range of one of the variadic data buffers.
+union ArrowBinaryView {
+  /// \brief The representation of a value stored inline
+  struct {
+    int32_t size;
+    uint8_t data[NANOARROW_BINARY_VIEW_INLINE_SIZE];
+  } inlined;
+
+  /// \brief The representation of a value stored in a variadic data buffer
+  struct {
+    int32_t size;
+    uint8_t prefix[4];
+    int32_t buffer_index;
+    int32_t offset;
+  } ref;
+
+  int64_t alignment_dummy;
+};
+
 union ArrowBufferViewData {
   const void* data;
   const int8_t* as_int8;
@@ -493,6 +674,7 @@ union ArrowBufferViewData {
   const double* as_double;
   const float* as_float;
   const char* as_char;
+  const union ArrowBinaryView* as_binary_view;
 };
 
 /// \brief An non-owning view of a buffer
@@ -525,6 +707,50 @@ struct ArrowBufferAllocator {
   void* private_data;
 };
 
+/// \brief Statistics describing the reuse of memory by a buffer pool
+/// \ingroup nanoarrow-malloc
+struct ArrowBufferPoolStats {
+  /// \brief The number of allocations satisfied by a retained block
+  int64_t n_hits;
+
+  /// \brief The number of allocations that required a new block
+  int64_t n_misses;
+
+  /// \brief The number of bytes held by the pool in blocks that are not in use
+  int64_t bytes_retained;
+};
+
+/// \brief Memory accounting for a tracking allocator
+/// \ingroup nanoarrow-malloc
+///
+/// Initialize using ArrowBufferAllocatorTrackerInit() and obtain an allocator
+/// whose usage is recorded here using ArrowBufferAllocatorTracking(). Members
+/// other than allocator may be read at any time.
+struct ArrowBufferAllocatorTracker {
+  /// \brief The allocator to which all requests are forwarded
+  struct ArrowBufferAllocator allocator;
+
+  /// \brief The number of bytes currently allocated
+  int64_t bytes_allocated;
+
+  /// \brief The maximum value of bytes_allocated since initialization
+  int64_t peak_bytes_allocated;
+
+  /// \brief The number of new allocations
+  int64_t n_allocations;
+
+  /// \brief The number of reallocations of an existing allocation
+  int64_t n_reallocations;
+
+  /// \brief The number of reallocations that returned a different pointer
+  ///
+  /// These are reallocations for which the data was (most likely) copied.
+  int64_t n_reallocations_moved;
+
+  /// \brief The number of allocations released
+  int64_t n_frees;
+};
+
 /// \brief An owning mutable view of a buffer
 /// \ingroup nanoarrow-buffer
 struct ArrowBuffer {
@@ -541,6 +767,22 @@ struct ArrowBuffer {
 
   /// \brief The allocator that will be used to reallocate and/or free the buffer
   struct ArrowBufferAllocator allocator;
+
+  /// \brief The strategy used to choose a new capacity when the buffer must grow
+  enum ArrowBufferGrowthPolicy growth_policy;
+
+#if defined(NANOARROW_WITH_BUFFER_STATS)
+  /// \brief The number of times data was reallocated after its first allocation
+  ///
+  /// Only present if NANOARROW_WITH_BUFFER_STATS is defined.
+  int64_t n_reallocations;
+
+  /// \brief The total size_bytes of the buffer at each of those reallocations
+  ///
+  /// This is the number of bytes the allocator may have had to copy. Only present if
+  /// NANOARROW_WITH_BUFFER_STATS is defined.
+  int64_t bytes_reallocated;
+#endif
 };
 
 /// \brief An owning mutable view of a bitmap
@@ -553,6 +795,39 @@ struct ArrowBitmap {
   int64_t size_bits;
 };
 
+/// \brief A run of consecutive set or unset bits in a bitmap
+/// \ingroup nanoarrow-bitmap
+struct ArrowBitRun {
+  /// \brief The index of the first bit in the run relative to the start of
+  /// the range being read
+  int64_t start;
+
+  /// \brief The number of bits in the run
+  int64_t length;
+
+  /// \brief 1 if all bits in the run are set or 0 otherwise
+  int8_t is_set;
+};
+
+/// \brief An iterator over runs of set or unset bits in a bitmap
+/// \ingroup nanoarrow-bitmap
+///
+/// Initialize using ArrowBitRunReaderInit() and iterate using
+/// ArrowBitRunReaderNext(). Members are considered private.
+struct ArrowBitRunReader {
+  /// \brief The bitmap being read or NULL to consider all bits set
+  const uint8_t* bits;
+
+  /// \brief The bit offset of the start of the range being read
+  int64_t start_offset;
+
+  /// \brief The bit offset of the next bit to be read
+  int64_t position;
+
+  /// \brief The bit offset one past the end of the range being read
+  int64_t end;
+};
+
 /// \brief A description of an arrangement of buffers
 /// \ingroup nanoarrow-utils
 ///
@@ -627,6 +902,394 @@ struct ArrowArrayView {
   /// type_id == union_type_id_map[128 + child_index]. This value may be
   /// NULL in the case where child_id == type_id.
   int8_t* union_type_id_map;
+
+  /// \brief The number of variadic data buffers of a binary or string view array
+  int64_t n_variadic_buffers;
+
+  /// \brief Pointers to the variadic data buffers of a binary or string view array
+  const void** variadic_buffers;
+
+  /// \brief The size of each variadic data buffer of a binary or string view array
+  const int64_t* variadic_buffer_sizes;
+};
+
+/// \brief One node of an ArrowSchemaLayout
+/// \ingroup nanoarrow-array-view
+struct ArrowSchemaLayoutNode {
+  /// \brief The storage type of this node
+  enum ArrowType storage_type;
+
+  /// \brief The buffer layout of this node
+  struct ArrowLayout layout;
+
+  /// \brief The number of children of this node
+  int64_t n_children;
+
+  /// \brief The index of the first child of this node in ArrowSchemaLayout.nodes
+  ///
+  /// The children of a node are stored contiguously.
+  int64_t child_index;
+
+  /// \brief The index of the dictionary of this node or -1 if it has none
+  int64_t dictionary_index;
+
+  /// \brief The union type id map for union types or NULL otherwise
+  int8_t* union_type_id_map;
+};
+
+/// \brief A schema parsed into the information required to initialize an
+/// ArrowArrayView
+/// \ingroup nanoarrow-array-view
+///
+/// The nodes of the schema tree are stored in a flat array whose first element is
+/// the root. Initialize using ArrowSchemaLayoutInit() and release using
+/// ArrowSchemaLayoutReset().
+struct ArrowSchemaLayout {
+  /// \brief The number of nodes in the schema tree
+  int64_t n_nodes;
+
+  /// \brief The nodes of the schema tree
+  struct ArrowSchemaLayoutNode* nodes;
+};
+
+/// \brief A minimum or maximum value of an ArrowArrayStatistics
+/// \ingroup nanoarrow-array-view
+///
+/// The member that is set depends on the storage type of the array: as_int64 for
+/// signed integers (including temporal types stored as integers), as_uint64 for
+/// unsigned integers, as_double for floating point types, and as_bytes for decimal,
+/// binary, and string types.
+union ArrowStatisticsValue {
+  int64_t as_int64;
+  uint64_t as_uint64;
+  double as_double;
+  struct ArrowBufferView as_bytes;
+};
+
+/// \brief Cast options
+/// \ingroup nanoarrow-array-view
+///
+/// Options may be combined using bitwise or and are used by ArrowArrayViewCast().
+enum ArrowCastOptions {
+  /// \brief Return an error for values that overflow or would be truncated.
+  NANOARROW_CAST_DEFAULT = 0,
+
+  /// \brief Do not check for values that overflow the target type.
+  ///
+  /// The result for such values is unspecified but no error is returned.
+  NANOARROW_CAST_ALLOW_OVERFLOW = 1,
+
+  /// \brief Allow values to lose precision (e.g., 1.5 to an integer or 1500 ms to s).
+  ///
+  /// Floating point values are truncated towards zero, decimal values are
+  /// truncated towards zero, and temporal values are rounded towards negative
+  /// infinity.
+  NANOARROW_CAST_ALLOW_TRUNCATE = 2
+};
+
+/// \brief Calendar units
+/// \ingroup nanoarrow-array-view
+///
+/// Units of the buckets used by ArrowArrayViewTemporalTruncate().
+enum ArrowCalendarUnit {
+  NANOARROW_CALENDAR_UNIT_NANOSECOND,
+  NANOARROW_CALENDAR_UNIT_MICROSECOND,
+  NANOARROW_CALENDAR_UNIT_MILLISECOND,
+  NANOARROW_CALENDAR_UNIT_SECOND,
+  NANOARROW_CALENDAR_UNIT_MINUTE,
+  NANOARROW_CALENDAR_UNIT_HOUR,
+  NANOARROW_CALENDAR_UNIT_DAY,
+  /// \brief Weeks starting on Monday
+  NANOARROW_CALENDAR_UNIT_WEEK,
+  NANOARROW_CALENDAR_UNIT_MONTH,
+  NANOARROW_CALENDAR_UNIT_YEAR
+};
+
+/// \brief Sort options
+/// \ingroup nanoarrow-array-view
+///
+/// Options may be combined using bitwise or and are used by
+/// ArrowArrayViewSortIndices().
+enum ArrowSortOptions {
+  /// \brief Sort in ascending order with nulls last.
+  NANOARROW_SORT_DEFAULT = 0,
+
+  /// \brief Sort in descending order.
+  NANOARROW_SORT_DESCENDING = 1,
+
+  /// \brief Place nulls before all other values.
+  NANOARROW_SORT_NULLS_FIRST = 2
+};
+
+/// \brief Aggregate functions
+/// \ingroup nanoarrow-array-view
+///
+/// Used by ArrowGroupedAggregateInit().
+enum ArrowAggregateFunction {
+  /// \brief The number of non-null values
+  NANOARROW_AGGREGATE_COUNT,
+
+  /// \brief The sum of non-null values
+  NANOARROW_AGGREGATE_SUM,
+
+  /// \brief The minimum non-null, non-NaN value
+  NANOARROW_AGGREGATE_MIN,
+
+  /// \brief The maximum non-null, non-NaN value
+  NANOARROW_AGGREGATE_MAX
+};
+
+/// \brief String predicates
+/// \ingroup nanoarrow-array-view
+///
+/// Used by ArrowArrayViewMatchStrings().
+enum ArrowStringPredicate {
+  /// \brief The value is equal to the pattern
+  NANOARROW_STRING_EQUALS,
+
+  /// \brief The value begins with the pattern
+  NANOARROW_STRING_STARTS_WITH,
+
+  /// \brief The value ends with the pattern
+  NANOARROW_STRING_ENDS_WITH,
+
+  /// \brief The value contains the pattern
+  NANOARROW_STRING_CONTAINS
+};
+
+/// \brief Map lookup options
+/// \ingroup nanoarrow-array-view
+///
+/// Options may be combined using bitwise or and are used by
+/// ArrowArrayViewMapLookup().
+enum ArrowMapLookupOptions {
+  /// \brief Scan all keys of each map.
+  NANOARROW_MAP_LOOKUP_DEFAULT = 0,
+
+  /// \brief Assume the keys of each map are sorted (i.e., ARROW_FLAG_MAP_KEYS_SORTED).
+  ///
+  /// Keys are compared bytewise and, if one key is a prefix of another, the shorter
+  /// key sorts first. The result for maps whose keys are not sorted is unspecified.
+  NANOARROW_MAP_LOOKUP_KEYS_SORTED = 1
+};
+
+/// \brief Statistics of the values of an ArrowArrayView
+/// \ingroup nanoarrow-array-view
+///
+/// Computed using ArrowArrayViewComputeStatistics(). Values referred to by as_bytes
+/// are borrowed from the buffers of the array and are only valid while the array is.
+struct ArrowArrayStatistics {
+  /// \brief The number of null elements
+  int64_t null_count;
+
+  /// \brief An estimate of the number of distinct non-null values
+  int64_t distinct_count;
+
+  /// \brief Non-zero if there is at least one non-null, non-NaN value and min and
+  /// max are set
+  int8_t has_min_max;
+
+  /// \brief The minimum non-null, non-NaN value
+  union ArrowStatisticsValue min;
+
+  /// \brief The maximum non-null, non-NaN value
+  union ArrowStatisticsValue max;
+};
+
+/// \brief The expected size of future appends to a (possibly nested) array
+/// \ingroup nanoarrow-array
+///
+/// Used to reserve space in an array under construction using
+/// ArrowArrayReserveShape(). The tree of children mirrors the children of the
+/// array and is owned by the caller (e.g., it may be allocated on the stack).
+struct ArrowArrayShape {
+  /// \brief The number of elements that will be appended
+  int64_t length;
+
+  /// \brief The number of bytes of string or binary data that will be appended
+  int64_t data_size_bytes;
+
+  /// \brief The number of children or 0 to derive the children's shape
+  ///
+  /// If 0, the shape of a struct or sparse union child is taken to be the
+  /// length of this shape and the shape of a fixed-size list child is taken to
+  /// be the length of this shape times the list size. Otherwise, this must
+  /// be equal to the number of children of the array.
+  int64_t n_children;
+
+  /// \brief Pointers to the shape of each child
+  struct ArrowArrayShape** children;
+};
+
+/// \brief The location of a member of a C struct
+/// \ingroup nanoarrow-array
+///
+/// Describes where the value of one child of a struct array is found in each of
+/// an array of C structs (records) appended using ArrowArrayAppendRecords().
+struct ArrowRecordField {
+  /// \brief The offset in bytes of the member from the start of a record
+  ///
+  /// This is usually obtained from offsetof().
+  int64_t offset;
+
+  /// \brief The storage type of the child
+  ///
+  /// For fixed-width types, the member must have the same size as an element of
+  /// the child (e.g., an int32_t for NANOARROW_TYPE_INT32 or NANOARROW_TYPE_DATE32).
+  /// For NANOARROW_TYPE_BOOL, the member is a single byte (e.g., a bool or uint8_t)
+  /// that is true if non-zero. For NANOARROW_TYPE_STRING and
+  /// NANOARROW_TYPE_LARGE_STRING, the member is a const char* that points to a
+  /// null-terminated string or is NULL for a null value.
+  enum ArrowType type;
+
+  /// \brief The offset in bytes of a single-byte member that is non-zero if the
+  /// value is null, or -1 if the member has no null flag
+  int64_t null_flag_offset;
+};
+
+/// \brief A caller-provided executor for independent tasks
+/// \ingroup nanoarrow-array
+///
+/// Used by functions such as ArrowArrayViewDeepCopy() to fan out work (e.g., one
+/// task per column) to a thread pool owned by the caller.
+struct ArrowExecutor {
+  /// \brief Call task(task_private, i) for each i in [0, n_tasks)
+  ///
+  /// Tasks may be run concurrently and in any order but must all have completed
+  /// when this function returns.
+  void (*parallel_for)(struct ArrowExecutor* executor,
+                       void (*task)(void* task_private, int64_t i), void* task_private,
+                       int64_t n_tasks);
+
+  /// \brief Opaque data specific to the executor
+  void* private_data;
+};
+
+/// \brief A hash-based builder for dictionary-encoded arrays
+/// \ingroup nanoarrow-dictionary-builder
+///
+/// Initialize using ArrowDictionaryBuilderInit() and release the hash table using
+/// ArrowDictionaryBuilderReset(). The array being built is owned by the caller.
+struct ArrowDictionaryBuilder {
+  /// \brief The dictionary-encoded array being built
+  struct ArrowArray* array;
+
+  /// \brief The current index type of array
+  ///
+  /// This is widened (e.g., from NANOARROW_TYPE_INT8 to NANOARROW_TYPE_INT16)
+  /// when the number of unique values can no longer be represented.
+  enum ArrowType index_type;
+
+  /// \brief The number of slots in the hash table (zero or a power of two)
+  int64_t n_slots;
+
+  /// \brief The hash table: one plus the dictionary index of the value in each
+  /// slot (as int32_t) or zero for empty slots
+  struct ArrowBuffer slots;
+
+  /// \brief The hash of each dictionary value (as uint64_t)
+  struct ArrowBuffer hashes;
+};
+
+/// \brief A record of one call to get_next() of an instrumented ArrowArrayStream
+/// \ingroup nanoarrow-instrumented-array-stream
+struct ArrowArrayStreamSpan {
+  /// \brief The zero-based index of this call to get_next()
+  int64_t call_index;
+
+  /// \brief The value of now_ns() before and after calling get_next() or 0
+  int64_t start_ns;
+  int64_t end_ns;
+
+  /// \brief The errno code returned by get_next()
+  int code;
+
+  /// \brief The length of the array or -1 at the end of the stream or on error
+  int64_t n_rows;
+
+  /// \brief The number of buffer bytes referenced by the array or -1 if not counted
+  int64_t n_bytes;
+};
+
+/// \brief Counters accumulated by an instrumented ArrowArrayStream
+/// \ingroup nanoarrow-instrumented-array-stream
+struct ArrowArrayStreamStats {
+  /// \brief The number of (non-released) arrays returned by get_next()
+  int64_t n_batches;
+
+  /// \brief The sum of the lengths of arrays returned by get_next()
+  int64_t n_rows;
+
+  /// \brief The sum of the buffer bytes referenced by arrays returned by get_next()
+  ///
+  /// Only accumulated if count_bytes was set when the stream was initialized.
+  int64_t n_bytes;
+
+  /// \brief The largest number of buffer bytes referenced by a single array
+  int64_t max_batch_bytes;
+
+  /// \brief The number of calls to get_next() that returned an error
+  int64_t n_errors;
+
+  /// \brief The total time spent in get_next() of the wrapped stream
+  ///
+  /// Only accumulated if now_ns was set when the stream was initialized.
+  int64_t get_next_ns;
+};
+
+/// \brief Optional hooks for an instrumented ArrowArrayStream
+/// \ingroup nanoarrow-instrumented-array-stream
+///
+/// All members may be zero/NULL, in which case only batches, rows, and errors are
+/// counted. The instrumentation is copied by ArrowInstrumentedArrayStreamInit() but
+/// private_data is borrowed and must outlive the stream.
+struct ArrowArrayStreamInstrumentation {
+  /// \brief Non-zero to count the buffer bytes referenced by each array
+  ///
+  /// Requires an ArrowArrayViewSetArray() per array, which reads the last offset of
+  /// variable-length types but no other buffer content.
+  char count_bytes;
+
+  /// \brief Return the current time in nanoseconds from an arbitrary origin
+  int64_t (*now_ns)(struct ArrowArrayStreamInstrumentation* self);
+
+  /// \brief Receive a record of each call to get_next()
+  void (*on_span)(struct ArrowArrayStreamInstrumentation* self,
+                  const struct ArrowArrayStreamSpan* span);
+
+  /// \brief Opaque data specific to the caller
+  void* private_data;
+};
+
+/// \brief Options for a spilling ArrowArrayStream
+/// \ingroup nanoarrow-spilling-array-stream
+struct ArrowSpillingArrayStreamOptions {
+  /// \brief The maximum number of buffer bytes referenced by arrays kept in memory
+  int64_t memory_budget_bytes;
+
+  /// \brief The directory in which to create the spill file or NULL to use tmpfile()
+  ///
+  /// The directory is copied by ArrowSpillingArrayStreamInit().
+  const char* spill_directory;
+};
+
+/// \brief Counters accumulated by a spilling ArrowArrayStream
+/// \ingroup nanoarrow-spilling-array-stream
+struct ArrowSpillingArrayStreamStats {
+  /// \brief The number of arrays pushed to the stream
+  int64_t n_batches;
+
+  /// \brief The number of arrays that were written to the spill file
+  int64_t n_batches_spilled;
+
+  /// \brief The number of bytes written to the spill file (excluding padding)
+  int64_t n_bytes_spilled;
+
+  /// \brief The number of buffer bytes referenced by arrays currently kept in memory
+  int64_t memory_bytes;
+
+  /// \brief The largest value of memory_bytes
+  int64_t max_memory_bytes;
 };
 
 // Used as the private data member for ArrowArrays allocated here and accessed
@@ -654,6 +1317,22 @@ struct ArrowArrayPrivateData {
   // In the future this could be replaced with a type id<->child mapping
   // to support constructing unions in append mode where type_id != child_index
   int8_t union_type_id_is_child_index;
+
+  // Holders for the variadic data buffers of binary and string view types
+  int64_t n_variadic_buffers;
+  struct ArrowBuffer* variadic_buffers;
+
+  // The size of each variadic buffer and the array of pointers to buffers used for
+  // binary and string view types with variadic data buffers (whose n_buffers is
+  // greater than three). Like buffer_data, these are only synchronized with the
+  // buffers after a sequence of appends.
+  int64_t* variadic_buffer_sizes;
+  const void** variadic_buffer_data;
+
+  // Nonzero if this array's buffers have only been modified by append functions
+  // since initialization, in which case offsets are known to be non-decreasing and
+  // null_count is exact. Cleared when a buffer is exposed for direct modification.
+  int8_t built_by_append;
 };
 
 /// \brief A representation of an interval.
@@ -683,8 +1362,8 @@ static inline void ArrowIntervalInit(struct ArrowInterval* interval,
 /// \ingroup nanoarrow-utils
 ///
 /// This structure should be initialized with ArrowDecimalInit() once and
-/// values set using ArrowDecimalSetInt(), ArrowDecimalSetBytes128(),
-/// or ArrowDecimalSetBytes256().
+/// values set using ArrowDecimalSetInt(), ArrowDecimalSetBytes(),
+/// ArrowDecimalSetDigits(), or ArrowDecimalSetString().
 struct ArrowDecimal {
   /// \brief An array of 64-bit integers of n_words length defined in native-endian order
   uint64_t words[4];
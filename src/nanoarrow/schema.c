@@ -16,16 +16,53 @@
 // under the License.
 
 #include <errno.h>
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "nanoarrow.h"
+#include "nanoarrow_atomic_internal.h"
+
+// The format, name, and metadata of a schema released by ArrowSchemaRelease() are
+// owned by the schema unless they were set by an ArrowSchemaSet*Static() function, in
+// which case the corresponding bit is set in the (otherwise unused) private_data.
+// Encoding these bits in the pointer keeps borrowing a string free of allocations.
+#define NANOARROW_SCHEMA_STATIC_FORMAT ((uintptr_t)1)
+#define NANOARROW_SCHEMA_STATIC_NAME ((uintptr_t)2)
+#define NANOARROW_SCHEMA_STATIC_METADATA ((uintptr_t)4)
+
+static int ArrowSchemaIsStatic(struct ArrowSchema* schema, uintptr_t field) {
+  return ((uintptr_t)schema->private_data & field) != 0;
+}
+
+static void ArrowSchemaSetStatic(struct ArrowSchema* schema, uintptr_t field,
+                                 int is_static) {
+  uintptr_t flags = (uintptr_t)schema->private_data;
+  if (is_static) {
+    flags |= field;
+  } else {
+    flags &= ~field;
+  }
+
+  schema->private_data = (void*)flags;
+}
 
 static void ArrowSchemaRelease(struct ArrowSchema* schema) {
-  if (schema->format != NULL) ArrowFree((void*)schema->format);
-  if (schema->name != NULL) ArrowFree((void*)schema->name);
-  if (schema->metadata != NULL) ArrowFree((void*)schema->metadata);
+  if (schema->format != NULL &&
+      !ArrowSchemaIsStatic(schema, NANOARROW_SCHEMA_STATIC_FORMAT)) {
+    ArrowFree((void*)schema->format);
+  }
+
+  if (schema->name != NULL &&
+      !ArrowSchemaIsStatic(schema, NANOARROW_SCHEMA_STATIC_NAME)) {
+    ArrowFree((void*)schema->name);
+  }
+
+  if (schema->metadata != NULL &&
+      !ArrowSchemaIsStatic(schema, NANOARROW_SCHEMA_STATIC_METADATA)) {
+    ArrowFree((void*)schema->metadata);
+  }
 
   // This object owns the memory for all the children, but those
   // children may have been generated elsewhere and might have
@@ -55,14 +92,64 @@ static void ArrowSchemaRelease(struct ArrowSchema* schema) {
     ArrowFree(schema->dictionary);
   }
 
-  // private data not currently used
-  if (schema->private_data != NULL) {
-    ArrowFree(schema->private_data);
+  // private_data only holds the NANOARROW_SCHEMA_STATIC_* bits
+  schema->private_data = NULL;
+  schema->release = NULL;
+}
+
+// A schema created by ArrowSchemaDeepCopy() lays out all of its nodes, child pointer
+// arrays, and strings in a single allocation that starts with this header. Every node
+// holds one reference, which is released when that node is released (either by its
+// parent or independently after having been moved out of the tree, possibly on
+// another thread).
+struct ArrowSchemaCompactPrivate {
+  ArrowRefCount reference_count;
+};
+
+static void ArrowSchemaReleaseCompact(struct ArrowSchema* schema) {
+  // Children that were moved out of the tree (or replaced) are released by their
+  // new owner; nodes still in the tree are released here
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    if (schema->children[i] != NULL && schema->children[i]->release != NULL) {
+      schema->children[i]->release(schema->children[i]);
+    }
+  }
+
+  if (schema->dictionary != NULL && schema->dictionary->release != NULL) {
+    schema->dictionary->release(schema->dictionary);
+  }
+
+  struct ArrowSchemaCompactPrivate* private_data =
+      (struct ArrowSchemaCompactPrivate*)schema->private_data;
+  if (ArrowRefCountAdd(&private_data->reference_count, -1) == 0) {
+    ArrowFree(private_data);
   }
 
   schema->release = NULL;
 }
 
+static ArrowErrorCode ArrowSchemaDeepCopyExpanded(const struct ArrowSchema* schema,
+                                                  struct ArrowSchema* schema_out);
+
+// The fields of a compact schema can't be individually freed or reallocated, so
+// before modifying one it is replaced with a copy whose fields are each allocated
+// separately. Children of the (possibly compact) parent that are not modified are
+// left untouched.
+static void ArrowSchemaReleaseShared(struct ArrowSchema* schema);
+
+static ArrowErrorCode ArrowSchemaEnsureExpanded(struct ArrowSchema* schema) {
+  if (schema->release != &ArrowSchemaReleaseCompact &&
+      schema->release != &ArrowSchemaReleaseShared) {
+    return NANOARROW_OK;
+  }
+
+  struct ArrowSchema tmp;
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaDeepCopyExpanded(schema, &tmp));
+  schema->release(schema);
+  ArrowSchemaMove(&tmp, schema);
+  return NANOARROW_OK;
+}
+
 static const char* ArrowSchemaFormatTemplate(enum ArrowType type) {
   switch (type) {
     case NANOARROW_TYPE_UNINITIALIZED:
@@ -104,6 +191,10 @@ static const char* ArrowSchemaFormatTemplate(enum ArrowType type) {
       return "z";
     case NANOARROW_TYPE_LARGE_BINARY:
       return "Z";
+    case NANOARROW_TYPE_BINARY_VIEW:
+      return "vz";
+    case NANOARROW_TYPE_STRING_VIEW:
+      return "vu";
 
     case NANOARROW_TYPE_DATE32:
       return "tdD";
@@ -120,6 +211,10 @@ static const char* ArrowSchemaFormatTemplate(enum ArrowType type) {
       return "+l";
     case NANOARROW_TYPE_LARGE_LIST:
       return "+L";
+    case NANOARROW_TYPE_LIST_VIEW:
+      return "+vl";
+    case NANOARROW_TYPE_LARGE_LIST_VIEW:
+      return "+vL";
     case NANOARROW_TYPE_STRUCT:
       return "+s";
     case NANOARROW_TYPE_MAP:
@@ -135,25 +230,27 @@ static int ArrowSchemaInitChildrenIfNeeded(struct ArrowSchema* schema,
   switch (type) {
     case NANOARROW_TYPE_LIST:
     case NANOARROW_TYPE_LARGE_LIST:
+    case NANOARROW_TYPE_LIST_VIEW:
+    case NANOARROW_TYPE_LARGE_LIST_VIEW:
     case NANOARROW_TYPE_FIXED_SIZE_LIST:
       NANOARROW_RETURN_NOT_OK(ArrowSchemaAllocateChildren(schema, 1));
       ArrowSchemaInit(schema->children[0]);
-      NANOARROW_RETURN_NOT_OK(ArrowSchemaSetName(schema->children[0], "item"));
+      NANOARROW_RETURN_NOT_OK(ArrowSchemaSetNameStatic(schema->children[0], "item"));
       break;
     case NANOARROW_TYPE_MAP:
       NANOARROW_RETURN_NOT_OK(ArrowSchemaAllocateChildren(schema, 1));
       NANOARROW_RETURN_NOT_OK(
           ArrowSchemaInitFromType(schema->children[0], NANOARROW_TYPE_STRUCT));
-      NANOARROW_RETURN_NOT_OK(ArrowSchemaSetName(schema->children[0], "entries"));
+      NANOARROW_RETURN_NOT_OK(ArrowSchemaSetNameStatic(schema->children[0], "entries"));
       schema->children[0]->flags &= ~ARROW_FLAG_NULLABLE;
       NANOARROW_RETURN_NOT_OK(ArrowSchemaAllocateChildren(schema->children[0], 2));
       ArrowSchemaInit(schema->children[0]->children[0]);
       ArrowSchemaInit(schema->children[0]->children[1]);
       NANOARROW_RETURN_NOT_OK(
-          ArrowSchemaSetName(schema->children[0]->children[0], "key"));
+          ArrowSchemaSetNameStatic(schema->children[0]->children[0], "key"));
       schema->children[0]->children[0]->flags &= ~ARROW_FLAG_NULLABLE;
       NANOARROW_RETURN_NOT_OK(
-          ArrowSchemaSetName(schema->children[0]->children[1], "value"));
+          ArrowSchemaSetNameStatic(schema->children[0]->children[1], "value"));
       break;
     default:
       break;
@@ -186,7 +283,7 @@ ArrowErrorCode ArrowSchemaSetType(struct ArrowSchema* schema, enum ArrowType typ
     return EINVAL;
   }
 
-  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetFormat(schema, template_format));
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetFormatStatic(schema, template_format));
 
   // For types with an umabiguous child structure, allocate children
   return ArrowSchemaInitChildrenIfNeeded(schema, type);
@@ -202,6 +299,28 @@ ArrowErrorCode ArrowSchemaSetTypeStruct(struct ArrowSchema* schema, int64_t n_ch
   return NANOARROW_OK;
 }
 
+ArrowErrorCode ArrowSchemaSetTypeRunEndEncoded(struct ArrowSchema* schema,
+                                               enum ArrowType run_end_type) {
+  switch (run_end_type) {
+    case NANOARROW_TYPE_INT16:
+    case NANOARROW_TYPE_INT32:
+    case NANOARROW_TYPE_INT64:
+      break;
+    default:
+      return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetFormatStatic(schema, "+r"));
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaAllocateChildren(schema, 2));
+  ArrowSchemaInit(schema->children[0]);
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetType(schema->children[0], run_end_type));
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetNameStatic(schema->children[0], "run_ends"));
+  schema->children[0]->flags &= ~ARROW_FLAG_NULLABLE;
+  ArrowSchemaInit(schema->children[1]);
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetNameStatic(schema->children[1], "values"));
+  return NANOARROW_OK;
+}
+
 ArrowErrorCode ArrowSchemaInitFromType(struct ArrowSchema* schema, enum ArrowType type) {
   ArrowSchemaInit(schema);
 
@@ -378,10 +497,14 @@ ArrowErrorCode ArrowSchemaSetTypeUnion(struct ArrowSchema* schema, enum ArrowTyp
 }
 
 ArrowErrorCode ArrowSchemaSetFormat(struct ArrowSchema* schema, const char* format) {
-  if (schema->format != NULL) {
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaEnsureExpanded(schema));
+
+  if (schema->format != NULL &&
+      !ArrowSchemaIsStatic(schema, NANOARROW_SCHEMA_STATIC_FORMAT)) {
     ArrowFree((void*)schema->format);
   }
 
+  ArrowSchemaSetStatic(schema, NANOARROW_SCHEMA_STATIC_FORMAT, 0);
   if (format != NULL) {
     size_t format_size = strlen(format) + 1;
     schema->format = (const char*)ArrowMalloc(format_size);
@@ -398,10 +521,14 @@ ArrowErrorCode ArrowSchemaSetFormat(struct ArrowSchema* schema, const char* form
 }
 
 ArrowErrorCode ArrowSchemaSetName(struct ArrowSchema* schema, const char* name) {
-  if (schema->name != NULL) {
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaEnsureExpanded(schema));
+
+  if (schema->name != NULL &&
+      !ArrowSchemaIsStatic(schema, NANOARROW_SCHEMA_STATIC_NAME)) {
     ArrowFree((void*)schema->name);
   }
 
+  ArrowSchemaSetStatic(schema, NANOARROW_SCHEMA_STATIC_NAME, 0);
   if (name != NULL) {
     size_t name_size = strlen(name) + 1;
     schema->name = (const char*)ArrowMalloc(name_size);
@@ -418,10 +545,14 @@ ArrowErrorCode ArrowSchemaSetName(struct ArrowSchema* schema, const char* name)
 }
 
 ArrowErrorCode ArrowSchemaSetMetadata(struct ArrowSchema* schema, const char* metadata) {
-  if (schema->metadata != NULL) {
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaEnsureExpanded(schema));
+
+  if (schema->metadata != NULL &&
+      !ArrowSchemaIsStatic(schema, NANOARROW_SCHEMA_STATIC_METADATA)) {
     ArrowFree((void*)schema->metadata);
   }
 
+  ArrowSchemaSetStatic(schema, NANOARROW_SCHEMA_STATIC_METADATA, 0);
   if (metadata != NULL) {
     size_t metadata_size = ArrowMetadataSizeOf(metadata);
     schema->metadata = (const char*)ArrowMalloc(metadata_size);
@@ -437,8 +568,51 @@ ArrowErrorCode ArrowSchemaSetMetadata(struct ArrowSchema* schema, const char* me
   return NANOARROW_OK;
 }
 
+ArrowErrorCode ArrowSchemaSetFormatStatic(struct ArrowSchema* schema,
+                                          const char* format) {
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaEnsureExpanded(schema));
+
+  if (schema->format != NULL &&
+      !ArrowSchemaIsStatic(schema, NANOARROW_SCHEMA_STATIC_FORMAT)) {
+    ArrowFree((void*)schema->format);
+  }
+
+  schema->format = format;
+  ArrowSchemaSetStatic(schema, NANOARROW_SCHEMA_STATIC_FORMAT, format != NULL);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowSchemaSetNameStatic(struct ArrowSchema* schema, const char* name) {
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaEnsureExpanded(schema));
+
+  if (schema->name != NULL &&
+      !ArrowSchemaIsStatic(schema, NANOARROW_SCHEMA_STATIC_NAME)) {
+    ArrowFree((void*)schema->name);
+  }
+
+  schema->name = name;
+  ArrowSchemaSetStatic(schema, NANOARROW_SCHEMA_STATIC_NAME, name != NULL);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowSchemaSetMetadataStatic(struct ArrowSchema* schema,
+                                            const char* metadata) {
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaEnsureExpanded(schema));
+
+  if (schema->metadata != NULL &&
+      !ArrowSchemaIsStatic(schema, NANOARROW_SCHEMA_STATIC_METADATA)) {
+    ArrowFree((void*)schema->metadata);
+  }
+
+  schema->metadata = metadata;
+  ArrowSchemaSetStatic(schema, NANOARROW_SCHEMA_STATIC_METADATA, metadata != NULL);
+  return NANOARROW_OK;
+}
+
 ArrowErrorCode ArrowSchemaAllocateChildren(struct ArrowSchema* schema,
                                            int64_t n_children) {
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaEnsureExpanded(schema));
+
   if (schema->children != NULL) {
     return EEXIST;
   }
@@ -470,6 +644,8 @@ ArrowErrorCode ArrowSchemaAllocateChildren(struct ArrowSchema* schema,
 }
 
 ArrowErrorCode ArrowSchemaAllocateDictionary(struct ArrowSchema* schema) {
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaEnsureExpanded(schema));
+
   if (schema->dictionary != NULL) {
     return EEXIST;
   }
@@ -483,8 +659,8 @@ ArrowErrorCode ArrowSchemaAllocateDictionary(struct ArrowSchema* schema) {
   return NANOARROW_OK;
 }
 
-ArrowErrorCode ArrowSchemaDeepCopy(struct ArrowSchema* schema,
-                                   struct ArrowSchema* schema_out) {
+static ArrowErrorCode ArrowSchemaDeepCopyExpanded(const struct ArrowSchema* schema,
+                                                  struct ArrowSchema* schema_out) {
   ArrowSchemaInit(schema_out);
 
   int result = ArrowSchemaSetFormat(schema_out, schema->format);
@@ -514,7 +690,7 @@ ArrowErrorCode ArrowSchemaDeepCopy(struct ArrowSchema* schema,
   }
 
   for (int64_t i = 0; i < schema->n_children; i++) {
-    result = ArrowSchemaDeepCopy(schema->children[i], schema_out->children[i]);
+    result = ArrowSchemaDeepCopyExpanded(schema->children[i], schema_out->children[i]);
     if (result != NANOARROW_OK) {
       schema_out->release(schema_out);
       return result;
@@ -528,7 +704,7 @@ ArrowErrorCode ArrowSchemaDeepCopy(struct ArrowSchema* schema,
       return result;
     }
 
-    result = ArrowSchemaDeepCopy(schema->dictionary, schema_out->dictionary);
+    result = ArrowSchemaDeepCopyExpanded(schema->dictionary, schema_out->dictionary);
     if (result != NANOARROW_OK) {
       schema_out->release(schema_out);
       return result;
@@ -538,6 +714,294 @@ ArrowErrorCode ArrowSchemaDeepCopy(struct ArrowSchema* schema,
   return NANOARROW_OK;
 }
 
+struct ArrowSchemaCompactLayout {
+  int64_t n_nodes;
+  int64_t n_child_pointers;
+  int64_t n_string_bytes;
+  struct ArrowSchemaCompactPrivate* private_data;
+  struct ArrowSchema* next_node;
+  struct ArrowSchema** next_child_pointer;
+  char* next_string;
+};
+
+static void ArrowSchemaCompactMeasure(const struct ArrowSchema* schema,
+                                      struct ArrowSchemaCompactLayout* layout) {
+  layout->n_nodes++;
+  layout->n_child_pointers += schema->n_children;
+
+  if (schema->format != NULL) {
+    layout->n_string_bytes += strlen(schema->format) + 1;
+  }
+
+  if (schema->name != NULL) {
+    layout->n_string_bytes += strlen(schema->name) + 1;
+  }
+
+  layout->n_string_bytes += ArrowMetadataSizeOf(schema->metadata);
+
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    ArrowSchemaCompactMeasure(schema->children[i], layout);
+  }
+
+  if (schema->dictionary != NULL) {
+    ArrowSchemaCompactMeasure(schema->dictionary, layout);
+  }
+}
+
+static const char* ArrowSchemaCompactCopyBytes(struct ArrowSchemaCompactLayout* layout,
+                                               const char* value, int64_t size_bytes) {
+  char* out = layout->next_string;
+  memcpy(out, value, (size_t)size_bytes);
+  layout->next_string += size_bytes;
+  return out;
+}
+
+static void ArrowSchemaCompactFill(const struct ArrowSchema* schema,
+                                   struct ArrowSchema* schema_out,
+                                   struct ArrowSchemaCompactLayout* layout) {
+  ArrowSchemaInit(schema_out);
+  schema_out->flags = schema->flags;
+
+  if (schema->format != NULL) {
+    schema_out->format = ArrowSchemaCompactCopyBytes(layout, schema->format,
+                                                     strlen(schema->format) + 1);
+  }
+
+  if (schema->name != NULL) {
+    schema_out->name =
+        ArrowSchemaCompactCopyBytes(layout, schema->name, strlen(schema->name) + 1);
+  }
+
+  if (schema->metadata != NULL) {
+    schema_out->metadata = ArrowSchemaCompactCopyBytes(
+        layout, schema->metadata, ArrowMetadataSizeOf(schema->metadata));
+  }
+
+  if (schema->n_children > 0) {
+    schema_out->n_children = schema->n_children;
+    schema_out->children = layout->next_child_pointer;
+    layout->next_child_pointer += schema->n_children;
+
+    for (int64_t i = 0; i < schema->n_children; i++) {
+      schema_out->children[i] = layout->next_node++;
+      ArrowSchemaCompactFill(schema->children[i], schema_out->children[i], layout);
+    }
+  }
+
+  if (schema->dictionary != NULL) {
+    schema_out->dictionary = layout->next_node++;
+    ArrowSchemaCompactFill(schema->dictionary, schema_out->dictionary, layout);
+  }
+
+  schema_out->private_data = layout->private_data;
+  schema_out->release = &ArrowSchemaReleaseCompact;
+}
+
+ArrowErrorCode ArrowSchemaDeepCopy(struct ArrowSchema* schema,
+                                   struct ArrowSchema* schema_out) {
+  struct ArrowSchemaCompactLayout layout;
+  memset(&layout, 0, sizeof(layout));
+  ArrowSchemaCompactMeasure(schema, &layout);
+
+  // The root node is written to schema_out; every other node lives in the allocation
+  int64_t size_bytes = sizeof(struct ArrowSchemaCompactPrivate) +
+                       (layout.n_nodes - 1) * sizeof(struct ArrowSchema) +
+                       layout.n_child_pointers * sizeof(struct ArrowSchema*) +
+                       layout.n_string_bytes;
+  layout.private_data = (struct ArrowSchemaCompactPrivate*)ArrowMalloc(size_bytes);
+  if (layout.private_data == NULL) {
+    return ENOMEM;
+  }
+
+  ArrowRefCountInit(&layout.private_data->reference_count, layout.n_nodes);
+  layout.next_node = (struct ArrowSchema*)(layout.private_data + 1);
+  layout.next_child_pointer =
+      (struct ArrowSchema**)(layout.next_node + layout.n_nodes - 1);
+  layout.next_string = (char*)(layout.next_child_pointer + layout.n_child_pointers);
+
+  ArrowSchemaCompactFill(schema, schema_out, &layout);
+  return NANOARROW_OK;
+}
+
+struct ArrowSchemaShared {
+  struct ArrowSchema schema;
+  ArrowRefCount reference_count;
+};
+
+static int64_t ArrowSchemaSharedUpdate(struct ArrowSchemaShared* shared, int delta) {
+  return ArrowRefCountAdd(&shared->reference_count, delta);
+}
+
+static void ArrowSchemaSharedSet(struct ArrowSchemaShared* shared, int64_t count) {
+  ArrowRefCountInit(&shared->reference_count, count);
+}
+
+static void ArrowSchemaSharedRelease(struct ArrowSchemaShared* shared) {
+  if (ArrowSchemaSharedUpdate(shared, -1) == 0) {
+    shared->schema.release(&shared->schema);
+    ArrowFree(shared);
+  }
+}
+
+// Each node of a shared reference (including its children and dictionary) holds its
+// own reference to the shared holder and borrows its strings from the corresponding
+// node of the holder, so that a child moved out of (or modified in) a reference does
+// not affect the holder or any other reference.
+struct ArrowSchemaSharedPrivate {
+  struct ArrowSchemaShared* shared;
+  struct ArrowSchema* children;
+  struct ArrowSchema** child_pointers;
+  struct ArrowSchema dictionary;
+};
+
+static void ArrowSchemaReleaseShared(struct ArrowSchema* schema) {
+  struct ArrowSchemaSharedPrivate* private_data =
+      (struct ArrowSchemaSharedPrivate*)schema->private_data;
+
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    if (schema->children[i]->release != NULL) {
+      schema->children[i]->release(schema->children[i]);
+    }
+  }
+
+  if (schema->dictionary != NULL && schema->dictionary->release != NULL) {
+    schema->dictionary->release(schema->dictionary);
+  }
+
+  ArrowFree(private_data->children);
+  ArrowFree(private_data->child_pointers);
+  ArrowSchemaSharedRelease(private_data->shared);
+  ArrowFree(private_data);
+  schema->release = NULL;
+}
+
+static ArrowErrorCode ArrowSchemaSharedInitNode(struct ArrowSchema* out,
+                                                const struct ArrowSchema* src,
+                                                struct ArrowSchemaShared* shared) {
+  if (src->release == NULL) {
+    return EINVAL;
+  }
+
+  struct ArrowSchemaSharedPrivate* private_data =
+      (struct ArrowSchemaSharedPrivate*)ArrowMalloc(
+          sizeof(struct ArrowSchemaSharedPrivate));
+  if (private_data == NULL) {
+    return ENOMEM;
+  }
+
+  ArrowSchemaSharedUpdate(shared, 1);
+  private_data->shared = shared;
+  private_data->children = NULL;
+  private_data->child_pointers = NULL;
+
+  // Children are assigned once they can be released safely
+  out->format = src->format;
+  out->name = src->name;
+  out->metadata = src->metadata;
+  out->flags = src->flags;
+  out->n_children = 0;
+  out->children = NULL;
+  out->dictionary = NULL;
+  out->release = &ArrowSchemaReleaseShared;
+  out->private_data = private_data;
+
+  if (src->n_children > 0) {
+    private_data->children =
+        (struct ArrowSchema*)ArrowMalloc(src->n_children * sizeof(struct ArrowSchema));
+    private_data->child_pointers = (struct ArrowSchema**)ArrowMalloc(
+        src->n_children * sizeof(struct ArrowSchema*));
+    if (private_data->children == NULL || private_data->child_pointers == NULL) {
+      out->release(out);
+      return ENOMEM;
+    }
+
+    for (int64_t i = 0; i < src->n_children; i++) {
+      private_data->children[i].release = NULL;
+      private_data->child_pointers[i] = private_data->children + i;
+    }
+
+    out->children = private_data->child_pointers;
+    out->n_children = src->n_children;
+
+    for (int64_t i = 0; i < src->n_children; i++) {
+      int result = ArrowSchemaSharedInitNode(out->children[i], src->children[i], shared);
+      if (result != NANOARROW_OK) {
+        out->release(out);
+        return result;
+      }
+    }
+  }
+
+  if (src->dictionary != NULL) {
+    private_data->dictionary.release = NULL;
+    out->dictionary = &private_data->dictionary;
+    int result = ArrowSchemaSharedInitNode(out->dictionary, src->dictionary, shared);
+    if (result != NANOARROW_OK) {
+      out->release(out);
+      return result;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+// Returns non-zero if every node of schema is an unmodified reference to shared
+static int ArrowSchemaSharedIsIntact(const struct ArrowSchema* schema,
+                                     const struct ArrowSchemaShared* shared) {
+  if (schema->release != &ArrowSchemaReleaseShared ||
+      ((struct ArrowSchemaSharedPrivate*)schema->private_data)->shared != shared) {
+    return 0;
+  }
+
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    if (!ArrowSchemaSharedIsIntact(schema->children[i], shared)) {
+      return 0;
+    }
+  }
+
+  if (schema->dictionary != NULL) {
+    return ArrowSchemaSharedIsIntact(schema->dictionary, shared);
+  }
+
+  return 1;
+}
+
+ArrowErrorCode ArrowSchemaShare(struct ArrowSchema* schema, struct ArrowSchema* out) {
+  if (schema->release == NULL) {
+    return EINVAL;
+  }
+
+  if (schema->release == &ArrowSchemaReleaseShared) {
+    struct ArrowSchemaShared* shared =
+        ((struct ArrowSchemaSharedPrivate*)schema->private_data)->shared;
+    if (ArrowSchemaSharedIsIntact(schema, shared)) {
+      return ArrowSchemaSharedInitNode(out, schema, shared);
+    }
+  }
+
+  // Move the source into a shared holder and replace it with a reference so that
+  // schema and out can be released in any order. The holder's own reference is
+  // dropped once both have been initialized.
+  struct ArrowSchemaShared* shared =
+      (struct ArrowSchemaShared*)ArrowMalloc(sizeof(struct ArrowSchemaShared));
+  if (shared == NULL) {
+    return ENOMEM;
+  }
+
+  ArrowSchemaSharedSet(shared, 1);
+  ArrowSchemaMove(schema, &shared->schema);
+  int result = ArrowSchemaSharedInitNode(schema, &shared->schema, shared);
+  if (result != NANOARROW_OK) {
+    ArrowSchemaMove(&shared->schema, schema);
+    ArrowFree(shared);
+    return result;
+  }
+
+  result = ArrowSchemaSharedInitNode(out, &shared->schema, shared);
+  ArrowSchemaSharedRelease(shared);
+  return result;
+}
+
 static void ArrowSchemaViewSetPrimitive(struct ArrowSchemaView* schema_view,
                                         enum ArrowType type) {
   schema_view->type = type;
@@ -691,6 +1155,25 @@ static ArrowErrorCode ArrowSchemaViewParse(struct ArrowSchemaView* schema_view,
       *format_end_out = format + 1;
       return NANOARROW_OK;
 
+    // validity + views + variadic data buffers + variadic buffer sizes
+    case 'v':
+      switch (format[1]) {
+        case 'z':
+          schema_view->type = NANOARROW_TYPE_BINARY_VIEW;
+          schema_view->storage_type = NANOARROW_TYPE_BINARY_VIEW;
+          *format_end_out = format + 2;
+          return NANOARROW_OK;
+        case 'u':
+          schema_view->type = NANOARROW_TYPE_STRING_VIEW;
+          schema_view->storage_type = NANOARROW_TYPE_STRING_VIEW;
+          *format_end_out = format + 2;
+          return NANOARROW_OK;
+        default:
+          ArrowErrorSet(error, "Expected 'z' or 'u' following 'v' but found '%s'",
+                        format + 1);
+          return EINVAL;
+      }
+
     // nested types
     case '+':
       switch (format[1]) {
@@ -708,6 +1191,26 @@ static ArrowErrorCode ArrowSchemaViewParse(struct ArrowSchemaView* schema_view,
           *format_end_out = format + 2;
           return NANOARROW_OK;
 
+        // list view has validity + offset + size or offset + size and large list
+        // view has validity + large_offset + large_size or large_offset + large_size
+        case 'v':
+          switch (format[2]) {
+            case 'l':
+              schema_view->storage_type = NANOARROW_TYPE_LIST_VIEW;
+              schema_view->type = NANOARROW_TYPE_LIST_VIEW;
+              *format_end_out = format + 3;
+              return NANOARROW_OK;
+            case 'L':
+              schema_view->storage_type = NANOARROW_TYPE_LARGE_LIST_VIEW;
+              schema_view->type = NANOARROW_TYPE_LARGE_LIST_VIEW;
+              *format_end_out = format + 3;
+              return NANOARROW_OK;
+            default:
+              ArrowErrorSet(error, "Expected 'l' or 'L' following '+v' but found '%s'",
+                            format + 2);
+              return EINVAL;
+          }
+
         // just validity buffer
         case 'w':
           if (format[2] != ':' || format[3] == '\0') {
@@ -731,6 +1234,13 @@ static ArrowErrorCode ArrowSchemaViewParse(struct ArrowSchemaView* schema_view,
           *format_end_out = format + 2;
           return NANOARROW_OK;
 
+        // run-end encoded has no buffers and exactly two children
+        case 'r':
+          schema_view->storage_type = NANOARROW_TYPE_RUN_END_ENCODED;
+          schema_view->type = NANOARROW_TYPE_RUN_END_ENCODED;
+          *format_end_out = format + 2;
+          return NANOARROW_OK;
+
         // unions
         case 'u':
           switch (format[2]) {
@@ -1007,6 +1517,23 @@ static ArrowErrorCode ArrowSchemaViewValidateMap(struct ArrowSchemaView* schema_
   return NANOARROW_OK;
 }
 
+static ArrowErrorCode ArrowSchemaViewValidateRunEndEncoded(
+    struct ArrowSchemaView* schema_view, struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaViewValidateNChildren(schema_view, 2, error));
+
+  const char* run_ends_format = schema_view->schema->children[0]->format;
+  if (strcmp(run_ends_format, "s") != 0 && strcmp(run_ends_format, "i") != 0 &&
+      strcmp(run_ends_format, "l") != 0) {
+    ArrowErrorSet(error,
+                  "Expected format of run_ends child of run-end encoded type to be "
+                  "'s', 'i', or 'l' but found '%s'",
+                  run_ends_format);
+    return EINVAL;
+  }
+
+  return NANOARROW_OK;
+}
+
 static ArrowErrorCode ArrowSchemaViewValidateDictionary(
     struct ArrowSchemaView* schema_view, struct ArrowError* error) {
   // check for valid index type
@@ -1056,6 +1583,8 @@ static ArrowErrorCode ArrowSchemaViewValidate(struct ArrowSchemaView* schema_vie
     case NANOARROW_TYPE_LARGE_STRING:
     case NANOARROW_TYPE_BINARY:
     case NANOARROW_TYPE_LARGE_BINARY:
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_STRING_VIEW:
     case NANOARROW_TYPE_DATE32:
     case NANOARROW_TYPE_DATE64:
     case NANOARROW_TYPE_INTERVAL_MONTHS:
@@ -1077,6 +1606,8 @@ static ArrowErrorCode ArrowSchemaViewValidate(struct ArrowSchemaView* schema_vie
 
     case NANOARROW_TYPE_LIST:
     case NANOARROW_TYPE_LARGE_LIST:
+    case NANOARROW_TYPE_LIST_VIEW:
+    case NANOARROW_TYPE_LARGE_LIST_VIEW:
     case NANOARROW_TYPE_FIXED_SIZE_LIST:
       return ArrowSchemaViewValidateNChildren(schema_view, 1, error);
 
@@ -1090,6 +1621,9 @@ static ArrowErrorCode ArrowSchemaViewValidate(struct ArrowSchemaView* schema_vie
     case NANOARROW_TYPE_MAP:
       return ArrowSchemaViewValidateMap(schema_view, error);
 
+    case NANOARROW_TYPE_RUN_END_ENCODED:
+      return ArrowSchemaViewValidateRunEndEncoded(schema_view, error);
+
     case NANOARROW_TYPE_DICTIONARY:
       return ArrowSchemaViewValidateDictionary(schema_view, error);
 
@@ -1102,6 +1636,41 @@ static ArrowErrorCode ArrowSchemaViewValidate(struct ArrowSchemaView* schema_vie
   return NANOARROW_OK;
 }
 
+// Finds the extension name and metadata in a single pass over the metadata (keeping
+// the first value of each key like ArrowMetadataGetValue())
+static void ArrowSchemaViewReadExtension(struct ArrowSchemaView* schema_view,
+                                         const char* metadata) {
+  schema_view->extension_name = ArrowCharView(NULL);
+  schema_view->extension_metadata = ArrowCharView(NULL);
+  schema_view->extension_id = NANOARROW_EXTENSION_ID_NONE;
+  if (metadata == NULL) {
+    return;
+  }
+
+  struct ArrowStringView name_key = ArrowCharView("ARROW:extension:name");
+  struct ArrowStringView metadata_key = ArrowCharView("ARROW:extension:metadata");
+
+  struct ArrowMetadataReader reader;
+  struct ArrowStringView key;
+  struct ArrowStringView value;
+  ArrowMetadataReaderInit(&reader, metadata);
+  while (ArrowMetadataReaderRead(&reader, &key, &value) == NANOARROW_OK) {
+    if (schema_view->extension_name.data == NULL &&
+        key.size_bytes == name_key.size_bytes &&
+        memcmp(key.data, name_key.data, (size_t)key.size_bytes) == 0) {
+      schema_view->extension_name = value;
+    } else if (schema_view->extension_metadata.data == NULL &&
+               key.size_bytes == metadata_key.size_bytes &&
+               memcmp(key.data, metadata_key.data, (size_t)key.size_bytes) == 0) {
+      schema_view->extension_metadata = value;
+    }
+  }
+
+  if (schema_view->extension_name.data != NULL) {
+    schema_view->extension_id = NANOARROW_EXTENSION_ID_UNREGISTERED;
+  }
+}
+
 ArrowErrorCode ArrowSchemaViewInit(struct ArrowSchemaView* schema_view,
                                    struct ArrowSchema* schema, struct ArrowError* error) {
   if (schema == NULL) {
@@ -1173,144 +1742,415 @@ ArrowErrorCode ArrowSchemaViewInit(struct ArrowSchemaView* schema_view,
     schema_view->layout.child_size_elements = schema_view->fixed_size;
   }
 
-  schema_view->extension_name = ArrowCharView(NULL);
-  schema_view->extension_metadata = ArrowCharView(NULL);
-  ArrowMetadataGetValue(schema->metadata, ArrowCharView("ARROW:extension:name"),
-                        &schema_view->extension_name);
-  ArrowMetadataGetValue(schema->metadata, ArrowCharView("ARROW:extension:metadata"),
-                        &schema_view->extension_metadata);
+  ArrowSchemaViewReadExtension(schema_view, schema->metadata);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowSchemaViewInitWithRegistry(
+    struct ArrowSchemaView* schema_view, struct ArrowSchema* schema,
+    const struct ArrowExtensionRegistry* registry, struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaViewInit(schema_view, schema, error));
+  if (registry != NULL && schema_view->extension_id != NANOARROW_EXTENSION_ID_NONE) {
+    schema_view->extension_id =
+        ArrowExtensionRegistryFind(registry, schema_view->extension_name);
+  }
 
   return NANOARROW_OK;
 }
 
-static int64_t ArrowSchemaTypeToStringInternal(struct ArrowSchemaView* schema_view,
-                                               char* out, int64_t n) {
-  const char* type_string = ArrowTypeString(schema_view->type);
-  switch (schema_view->type) {
-    case NANOARROW_TYPE_DECIMAL128:
-    case NANOARROW_TYPE_DECIMAL256:
-      return snprintf(out, n, "%s(%d, %d)", type_string,
-                      (int)schema_view->decimal_precision,
-                      (int)schema_view->decimal_scale);
-    case NANOARROW_TYPE_TIMESTAMP:
-      return snprintf(out, n, "%s('%s', '%s')", type_string,
-                      ArrowTimeUnitString(schema_view->time_unit), schema_view->timezone);
-    case NANOARROW_TYPE_TIME32:
-    case NANOARROW_TYPE_TIME64:
-    case NANOARROW_TYPE_DURATION:
-      return snprintf(out, n, "%s('%s')", type_string,
-                      ArrowTimeUnitString(schema_view->time_unit));
-    case NANOARROW_TYPE_FIXED_SIZE_BINARY:
-    case NANOARROW_TYPE_FIXED_SIZE_LIST:
-      return snprintf(out, n, "%s(%ld)", type_string, (long)schema_view->fixed_size);
-    case NANOARROW_TYPE_SPARSE_UNION:
-    case NANOARROW_TYPE_DENSE_UNION:
-      return snprintf(out, n, "%s([%s])", type_string, schema_view->union_type_ids);
-    default:
-      return snprintf(out, n, "%s", type_string);
+void ArrowExtensionRegistryInit(struct ArrowExtensionRegistry* registry) {
+  registry->n_types = 0;
+  ArrowBufferInit(&registry->offsets);
+  ArrowBufferInit(&registry->names);
+}
+
+void ArrowExtensionRegistryReset(struct ArrowExtensionRegistry* registry) {
+  ArrowBufferReset(&registry->offsets);
+  ArrowBufferReset(&registry->names);
+  registry->n_types = 0;
+}
+
+ArrowErrorCode ArrowExtensionRegistryRegister(struct ArrowExtensionRegistry* registry,
+                                              struct ArrowStringView extension_name,
+                                              int32_t* id_out) {
+  if (extension_name.data == NULL || extension_name.size_bytes <= 0) {
+    return EINVAL;
+  }
+
+  int32_t id = ArrowExtensionRegistryFind(registry, extension_name);
+  if (id == NANOARROW_EXTENSION_ID_UNREGISTERED) {
+    if (registry->n_types == INT32_MAX) {
+      return EOVERFLOW;
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(&registry->names, extension_name.data,
+                                              extension_name.size_bytes));
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferAppendInt64(&registry->offsets, registry->names.size_bytes));
+    id = ++registry->n_types;
+  }
+
+  *id_out = id;
+  return NANOARROW_OK;
+}
+
+struct ArrowStringView ArrowExtensionRegistryName(
+    const struct ArrowExtensionRegistry* registry, int32_t id) {
+  if (id < 1 || id > registry->n_types) {
+    return ArrowCharView(NULL);
+  }
+
+  const int64_t* offsets = (const int64_t*)registry->offsets.data;
+  int64_t start = id == 1 ? 0 : offsets[id - 2];
+  struct ArrowStringView out;
+  out.data = (const char*)registry->names.data + start;
+  out.size_bytes = offsets[id - 1] - start;
+  return out;
+}
+
+int32_t ArrowExtensionRegistryFind(const struct ArrowExtensionRegistry* registry,
+                                   struct ArrowStringView extension_name) {
+  const int64_t* offsets = (const int64_t*)registry->offsets.data;
+  int64_t start = 0;
+  for (int32_t i = 0; i < registry->n_types; i++) {
+    if ((offsets[i] - start) == extension_name.size_bytes &&
+        memcmp(registry->names.data + start, extension_name.data,
+               (size_t)extension_name.size_bytes) == 0) {
+      return i + 1;
+    }
+
+    start = offsets[i];
   }
+
+  return NANOARROW_EXTENSION_ID_UNREGISTERED;
 }
 
-// Helper for bookkeeping to emulate sprintf()-like behaviour spread
-// among multiple sprintf calls.
-static inline void ArrowToStringLogChars(char** out, int64_t n_chars_last,
-                                         int64_t* n_remaining, int64_t* n_chars) {
-  *n_chars += n_chars_last;
-  *n_remaining -= n_chars_last;
+// Writes either into a fixed-size output (emulating snprintf()-like behaviour spread
+// among multiple calls) or appends to a buffer that grows as needed
+struct ArrowSchemaStringWriter {
+  char* out;
+  int64_t n_remaining;
+  int64_t n_chars;
+  struct ArrowBuffer* buffer;
+  ArrowErrorCode result;
+};
+
+static void ArrowSchemaStringWriterPrintf(struct ArrowSchemaStringWriter* writer,
+                                          const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+
+  if (writer->buffer == NULL) {
+    int n_chars_last = vsnprintf(writer->out, writer->n_remaining, fmt, args);
+    va_end(args);
+
+    writer->n_chars += n_chars_last;
+    writer->n_remaining -= n_chars_last;
+
+    // n_remaining is never less than 0
+    if (writer->n_remaining < 0) {
+      writer->n_remaining = 0;
+    }
+
+    // Can't do math on a NULL pointer
+    if (writer->out != NULL) {
+      writer->out += n_chars_last;
+    }
+
+    return;
+  }
+
+  if (writer->result != NANOARROW_OK) {
+    va_end(args);
+    return;
+  }
 
-  // n_remaining is never less than 0
-  if (*n_remaining < 0) {
-    *n_remaining = 0;
+  // Only format again if the remaining capacity was insufficient
+  struct ArrowBuffer* buffer = writer->buffer;
+  va_list args_copy;
+  va_copy(args_copy, args);
+  int64_t n_available = buffer->capacity_bytes - buffer->size_bytes;
+  char* out = n_available > 0 ? (char*)buffer->data + buffer->size_bytes : NULL;
+  int n_chars_last = vsnprintf(out, n_available, fmt, args);
+  if (n_chars_last >= 0 && n_chars_last >= n_available) {
+    writer->result = ArrowBufferReserve(buffer, n_chars_last + 1);
+    if (writer->result == NANOARROW_OK) {
+      vsnprintf((char*)buffer->data + buffer->size_bytes, n_chars_last + 1, fmt,
+                args_copy);
+    }
+  } else if (n_chars_last < 0) {
+    writer->result = EINVAL;
   }
 
-  // Can't do math on a NULL pointer
-  if (*out != NULL) {
-    *out += n_chars_last;
+  va_end(args_copy);
+  va_end(args);
+
+  if (writer->result == NANOARROW_OK) {
+    buffer->size_bytes += n_chars_last;
+    writer->n_chars += n_chars_last;
   }
 }
 
-int64_t ArrowSchemaToString(struct ArrowSchema* schema, char* out, int64_t n,
-                            char recursive) {
+static void ArrowSchemaTypeToStringInternal(struct ArrowSchemaView* schema_view,
+                                            struct ArrowSchemaStringWriter* writer) {
+  const char* type_string = ArrowTypeString(schema_view->type);
+  switch (schema_view->type) {
+    case NANOARROW_TYPE_DECIMAL128:
+    case NANOARROW_TYPE_DECIMAL256:
+      ArrowSchemaStringWriterPrintf(writer, "%s(%d, %d)", type_string,
+                                    (int)schema_view->decimal_precision,
+                                    (int)schema_view->decimal_scale);
+      break;
+    case NANOARROW_TYPE_TIMESTAMP:
+      ArrowSchemaStringWriterPrintf(writer, "%s('%s', '%s')", type_string,
+                                    ArrowTimeUnitString(schema_view->time_unit),
+                                    schema_view->timezone);
+      break;
+    case NANOARROW_TYPE_TIME32:
+    case NANOARROW_TYPE_TIME64:
+    case NANOARROW_TYPE_DURATION:
+      ArrowSchemaStringWriterPrintf(writer, "%s('%s')", type_string,
+                                    ArrowTimeUnitString(schema_view->time_unit));
+      break;
+    case NANOARROW_TYPE_FIXED_SIZE_BINARY:
+    case NANOARROW_TYPE_FIXED_SIZE_LIST:
+      ArrowSchemaStringWriterPrintf(writer, "%s(%ld)", type_string,
+                                    (long)schema_view->fixed_size);
+      break;
+    case NANOARROW_TYPE_SPARSE_UNION:
+    case NANOARROW_TYPE_DENSE_UNION:
+      ArrowSchemaStringWriterPrintf(writer, "%s([%s])", type_string,
+                                    schema_view->union_type_ids);
+      break;
+    default:
+      ArrowSchemaStringWriterPrintf(writer, "%s", type_string);
+      break;
+  }
+}
+
+// Children are written if max_depth is not zero (or negative for no limit); otherwise,
+// elided is written in their place
+static void ArrowSchemaToStringInternal(struct ArrowSchema* schema,
+                                        struct ArrowSchemaStringWriter* writer,
+                                        int64_t max_depth, const char* elided) {
   if (schema == NULL) {
-    return snprintf(out, n, "[invalid: pointer is null]");
+    ArrowSchemaStringWriterPrintf(writer, "[invalid: pointer is null]");
+    return;
   }
 
   if (schema->release == NULL) {
-    return snprintf(out, n, "[invalid: schema is released]");
+    ArrowSchemaStringWriterPrintf(writer, "[invalid: schema is released]");
+    return;
   }
 
   struct ArrowSchemaView schema_view;
   struct ArrowError error;
 
   if (ArrowSchemaViewInit(&schema_view, schema, &error) != NANOARROW_OK) {
-    return snprintf(out, n, "[invalid: %s]", ArrowErrorMessage(&error));
+    ArrowSchemaStringWriterPrintf(writer, "[invalid: %s]", ArrowErrorMessage(&error));
+    return;
   }
 
   // Extension type and dictionary should include both the top-level type
   // and the storage type.
   int is_extension = schema_view.extension_name.size_bytes > 0;
   int is_dictionary = schema->dictionary != NULL;
-  int64_t n_chars = 0;
-  int64_t n_chars_last = 0;
 
   // Uncommon but not technically impossible that both are true
   if (is_extension && is_dictionary) {
-    n_chars_last = snprintf(
-        out, n, "%.*s{dictionary(%s)<", (int)schema_view.extension_name.size_bytes,
+    ArrowSchemaStringWriterPrintf(
+        writer, "%.*s{dictionary(%s)<", (int)schema_view.extension_name.size_bytes,
         schema_view.extension_name.data, ArrowTypeString(schema_view.storage_type));
   } else if (is_extension) {
-    n_chars_last = snprintf(out, n, "%.*s{", (int)schema_view.extension_name.size_bytes,
-                            schema_view.extension_name.data);
+    ArrowSchemaStringWriterPrintf(writer, "%.*s{",
+                                  (int)schema_view.extension_name.size_bytes,
+                                  schema_view.extension_name.data);
   } else if (is_dictionary) {
-    n_chars_last =
-        snprintf(out, n, "dictionary(%s)<", ArrowTypeString(schema_view.storage_type));
+    ArrowSchemaStringWriterPrintf(writer, "dictionary(%s)<",
+                                  ArrowTypeString(schema_view.storage_type));
   }
 
-  ArrowToStringLogChars(&out, n_chars_last, &n, &n_chars);
-
   if (!is_dictionary) {
-    n_chars_last = ArrowSchemaTypeToStringInternal(&schema_view, out, n);
+    ArrowSchemaTypeToStringInternal(&schema_view, writer);
   } else {
-    n_chars_last = ArrowSchemaToString(schema->dictionary, out, n, recursive);
+    ArrowSchemaToStringInternal(schema->dictionary, writer, max_depth, elided);
   }
 
-  ArrowToStringLogChars(&out, n_chars_last, &n, &n_chars);
-
-  if (recursive && schema->format[0] == '+') {
-    n_chars_last = snprintf(out, n, "<");
-    ArrowToStringLogChars(&out, n_chars_last, &n, &n_chars);
+  if (max_depth == 0 && schema->format[0] == '+') {
+    ArrowSchemaStringWriterPrintf(writer, "%s", elided);
+  } else if (schema->format[0] == '+') {
+    ArrowSchemaStringWriterPrintf(writer, "<");
 
     for (int64_t i = 0; i < schema->n_children; i++) {
       if (i > 0) {
-        n_chars_last = snprintf(out, n, ", ");
-        ArrowToStringLogChars(&out, n_chars_last, &n, &n_chars);
+        ArrowSchemaStringWriterPrintf(writer, ", ");
       }
 
       // ArrowSchemaToStringInternal() will validate the child and print the error,
       // but we need the name first
       if (schema->children[i] != NULL && schema->children[i]->release != NULL &&
           schema->children[i]->name != NULL) {
-        n_chars_last = snprintf(out, n, "%s: ", schema->children[i]->name);
-        ArrowToStringLogChars(&out, n_chars_last, &n, &n_chars);
+        ArrowSchemaStringWriterPrintf(writer, "%s: ", schema->children[i]->name);
       }
 
-      n_chars_last = ArrowSchemaToString(schema->children[i], out, n, recursive);
-      ArrowToStringLogChars(&out, n_chars_last, &n, &n_chars);
+      ArrowSchemaToStringInternal(schema->children[i], writer, max_depth - 1, elided);
     }
 
-    n_chars_last = snprintf(out, n, ">");
-    ArrowToStringLogChars(&out, n_chars_last, &n, &n_chars);
+    ArrowSchemaStringWriterPrintf(writer, ">");
   }
 
   if (is_extension && is_dictionary) {
-    n_chars += snprintf(out, n, ">}");
+    ArrowSchemaStringWriterPrintf(writer, ">}");
   } else if (is_extension) {
-    n_chars += snprintf(out, n, "}");
+    ArrowSchemaStringWriterPrintf(writer, "}");
   } else if (is_dictionary) {
-    n_chars += snprintf(out, n, ">");
+    ArrowSchemaStringWriterPrintf(writer, ">");
+  }
+}
+
+int64_t ArrowSchemaToString(struct ArrowSchema* schema, char* out, int64_t n,
+                            char recursive) {
+  struct ArrowSchemaStringWriter writer;
+  writer.out = out;
+  writer.n_remaining = n;
+  writer.n_chars = 0;
+  writer.buffer = NULL;
+  writer.result = NANOARROW_OK;
+
+  ArrowSchemaToStringInternal(schema, &writer, recursive ? -1 : 0, "");
+  return writer.n_chars;
+}
+
+ArrowErrorCode ArrowSchemaToStringBuffer(struct ArrowSchema* schema,
+                                         struct ArrowBuffer* buffer, int64_t max_depth) {
+  struct ArrowSchemaStringWriter writer;
+  writer.out = NULL;
+  writer.n_remaining = 0;
+  writer.n_chars = 0;
+  writer.buffer = buffer;
+  writer.result = NANOARROW_OK;
+
+  ArrowSchemaToStringInternal(schema, &writer, max_depth, "<...>");
+  NANOARROW_RETURN_NOT_OK(writer.result);
+
+  // Terminate the output without including the terminator in the buffer size
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(buffer, 1));
+  buffer->data[buffer->size_bytes] = '\0';
+  return NANOARROW_OK;
+}
+
+// Names are compared such that NULL is equivalent to ""
+static inline struct ArrowStringView ArrowSchemaNameView(
+    const struct ArrowSchema* schema) {
+  if (schema->name == NULL) {
+    return ArrowCharView("");
+  } else {
+    return ArrowCharView(schema->name);
+  }
+}
+
+// Metadata is compared such that NULL is equivalent to zero key/value pairs
+static inline struct ArrowBufferView ArrowSchemaMetadataView(
+    const struct ArrowSchema* schema) {
+  struct ArrowBufferView view;
+  view.data.as_char = schema->metadata;
+  view.size_bytes = ArrowMetadataSizeOf(schema->metadata);
+  if (view.size_bytes <= (int64_t)sizeof(int32_t)) {
+    view.size_bytes = 0;
+  }
+
+  return view;
+}
+
+int ArrowSchemaEquals(const struct ArrowSchema* lhs, const struct ArrowSchema* rhs,
+                      int options) {
+  if (lhs == rhs) {
+    return 1;
+  }
+
+  if (lhs == NULL || rhs == NULL) {
+    return 0;
+  }
+
+  if (lhs->flags != rhs->flags || lhs->n_children != rhs->n_children) {
+    return 0;
+  }
+
+  if (lhs->format == NULL || rhs->format == NULL) {
+    if (lhs->format != rhs->format) {
+      return 0;
+    }
+  } else if (strcmp(lhs->format, rhs->format) != 0) {
+    return 0;
+  }
+
+  if (!(options & NANOARROW_SCHEMA_COMPARE_IGNORE_NAMES)) {
+    struct ArrowStringView lhs_name = ArrowSchemaNameView(lhs);
+    struct ArrowStringView rhs_name = ArrowSchemaNameView(rhs);
+    if (lhs_name.size_bytes != rhs_name.size_bytes ||
+        memcmp(lhs_name.data, rhs_name.data, (size_t)lhs_name.size_bytes) != 0) {
+      return 0;
+    }
+  }
+
+  if (!(options & NANOARROW_SCHEMA_COMPARE_IGNORE_METADATA)) {
+    struct ArrowBufferView lhs_metadata = ArrowSchemaMetadataView(lhs);
+    struct ArrowBufferView rhs_metadata = ArrowSchemaMetadataView(rhs);
+    if (lhs_metadata.size_bytes != rhs_metadata.size_bytes) {
+      return 0;
+    }
+
+    if (lhs_metadata.size_bytes > 0 &&
+        memcmp(lhs_metadata.data.data, rhs_metadata.data.data,
+               (size_t)lhs_metadata.size_bytes) != 0) {
+      return 0;
+    }
+  }
+
+  for (int64_t i = 0; i < lhs->n_children; i++) {
+    if (!ArrowSchemaEquals(lhs->children[i], rhs->children[i], options)) {
+      return 0;
+    }
+  }
+
+  return ArrowSchemaEquals(lhs->dictionary, rhs->dictionary, options);
+}
+
+static uint64_t ArrowSchemaFingerprintInternal(const struct ArrowSchema* schema,
+                                               int options, uint64_t hash) {
+  // Distinguish a missing child or dictionary from any other node
+  if (schema == NULL) {
+    return _ArrowHashWord(hash, 0);
+  }
+
+  if (schema->format == NULL) {
+    hash = _ArrowHashWord(hash, 1);
+  } else {
+    hash = _ArrowHashBytes(hash, (const uint8_t*)schema->format,
+                           (int64_t)strlen(schema->format));
+  }
+
+  if (!(options & NANOARROW_SCHEMA_COMPARE_IGNORE_NAMES)) {
+    struct ArrowStringView name = ArrowSchemaNameView(schema);
+    hash = _ArrowHashBytes(hash, (const uint8_t*)name.data, name.size_bytes);
+  }
+
+  if (!(options & NANOARROW_SCHEMA_COMPARE_IGNORE_METADATA)) {
+    struct ArrowBufferView metadata = ArrowSchemaMetadataView(schema);
+    hash = _ArrowHashBytes(hash, metadata.data.as_uint8, metadata.size_bytes);
+  }
+
+  hash = _ArrowHashWord(hash, (uint64_t)schema->flags);
+  hash = _ArrowHashWord(hash, (uint64_t)schema->n_children);
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    hash = ArrowSchemaFingerprintInternal(schema->children[i], options, hash);
   }
 
-  return n_chars;
+  return ArrowSchemaFingerprintInternal(schema->dictionary, options, hash);
+}
+
+uint64_t ArrowSchemaFingerprint(const struct ArrowSchema* schema, int options) {
+  return ArrowSchemaFingerprintInternal(schema, options, 0);
 }
 
 ArrowErrorCode ArrowMetadataReaderInit(struct ArrowMetadataReader* reader,
@@ -1413,6 +2253,135 @@ char ArrowMetadataHasKey(const char* metadata, struct ArrowStringView key) {
   return value.data != NULL;
 }
 
+static ArrowErrorCode ArrowMetadataIndexAllocate(struct ArrowMetadataIndex* index,
+                                                 int64_t n_pairs) {
+  index->n_keys = 0;
+  index->n_slots = 8;
+  while (index->n_slots < (2 * n_pairs)) {
+    index->n_slots *= 2;
+  }
+
+  index->keys = NULL;
+  index->values = NULL;
+  index->slots = (int64_t*)ArrowMalloc(index->n_slots * sizeof(int64_t));
+  if (n_pairs > 0) {
+    index->keys =
+        (struct ArrowStringView*)ArrowMalloc(n_pairs * sizeof(struct ArrowStringView));
+    index->values =
+        (struct ArrowStringView*)ArrowMalloc(n_pairs * sizeof(struct ArrowStringView));
+  }
+
+  if (index->slots == NULL ||
+      (n_pairs > 0 && (index->keys == NULL || index->values == NULL))) {
+    ArrowMetadataIndexReset(index);
+    return ENOMEM;
+  }
+
+  memset(index->slots, 0xff, index->n_slots * sizeof(int64_t));
+  return NANOARROW_OK;
+}
+
+// Returns the slot for key in an open-addressing hash table of indices into keys
+// with n_slots (a power of two) slots, which either contains the index of key or -1
+static int64_t ArrowStringViewTableFindSlot(const struct ArrowStringView* keys,
+                                            const int64_t* slots, int64_t n_slots,
+                                            struct ArrowStringView key) {
+  uint64_t hash = _ArrowHashBytes(0, (const uint8_t*)key.data, key.size_bytes);
+  int64_t mask = n_slots - 1;
+  int64_t slot = (int64_t)(hash & (uint64_t)mask);
+
+  while (slots[slot] != -1) {
+    struct ArrowStringView existing = keys[slots[slot]];
+    if (existing.size_bytes == key.size_bytes &&
+        memcmp(existing.data, key.data, (size_t)key.size_bytes) == 0) {
+      break;
+    }
+
+    slot = (slot + 1) & mask;
+  }
+
+  return slot;
+}
+
+static int64_t ArrowMetadataIndexFindSlot(const struct ArrowMetadataIndex* index,
+                                          struct ArrowStringView key) {
+  return ArrowStringViewTableFindSlot(index->keys, index->slots, index->n_slots, key);
+}
+
+// Inserts a key/value pair and returns the index of key. If key already exists, its
+// value is replaced if replace is non-zero or kept otherwise.
+static int64_t ArrowMetadataIndexInsert(struct ArrowMetadataIndex* index,
+                                        struct ArrowStringView key,
+                                        struct ArrowStringView value, char replace) {
+  int64_t slot = ArrowMetadataIndexFindSlot(index, key);
+  if (index->slots[slot] == -1) {
+    index->slots[slot] = index->n_keys;
+    index->keys[index->n_keys] = key;
+    index->values[index->n_keys] = value;
+    index->n_keys++;
+  } else if (replace) {
+    index->values[index->slots[slot]] = value;
+  }
+
+  return index->slots[slot];
+}
+
+ArrowErrorCode ArrowMetadataIndexInit(struct ArrowMetadataIndex* index,
+                                      const char* metadata) {
+  struct ArrowMetadataReader reader;
+  struct ArrowStringView key;
+  struct ArrowStringView value;
+  NANOARROW_RETURN_NOT_OK(ArrowMetadataReaderInit(&reader, metadata));
+  NANOARROW_RETURN_NOT_OK(ArrowMetadataIndexAllocate(index, reader.remaining_keys));
+
+  // Like ArrowMetadataGetValue(), the index refers to the first instance of a key
+  while (ArrowMetadataReaderRead(&reader, &key, &value) == NANOARROW_OK) {
+    ArrowMetadataIndexInsert(index, key, value, 0);
+  }
+
+  return NANOARROW_OK;
+}
+
+void ArrowMetadataIndexReset(struct ArrowMetadataIndex* index) {
+  if (index->keys != NULL) {
+    ArrowFree(index->keys);
+  }
+
+  if (index->values != NULL) {
+    ArrowFree(index->values);
+  }
+
+  if (index->slots != NULL) {
+    ArrowFree(index->slots);
+  }
+
+  index->n_keys = 0;
+  index->keys = NULL;
+  index->values = NULL;
+  index->n_slots = 0;
+  index->slots = NULL;
+}
+
+ArrowErrorCode ArrowMetadataIndexGetValue(const struct ArrowMetadataIndex* index,
+                                          struct ArrowStringView key,
+                                          struct ArrowStringView* value_out) {
+  if (value_out == NULL) {
+    return EINVAL;
+  }
+
+  int64_t key_index = index->slots[ArrowMetadataIndexFindSlot(index, key)];
+  if (key_index != -1) {
+    *value_out = index->values[key_index];
+  }
+
+  return NANOARROW_OK;
+}
+
+char ArrowMetadataIndexHasKey(const struct ArrowMetadataIndex* index,
+                              struct ArrowStringView key) {
+  return index->slots[ArrowMetadataIndexFindSlot(index, key)] != -1;
+}
+
 ArrowErrorCode ArrowMetadataBuilderInit(struct ArrowBuffer* buffer,
                                         const char* metadata) {
   ArrowBufferInit(buffer);
@@ -1523,3 +2492,506 @@ ArrowErrorCode ArrowMetadataBuilderRemove(struct ArrowBuffer* buffer,
                                           struct ArrowStringView key) {
   return ArrowMetadataBuilderSetInternal(buffer, &key, NULL);
 }
+
+ArrowErrorCode ArrowMetadataBuilderSetMany(struct ArrowBuffer* buffer, int64_t n,
+                                           const struct ArrowStringView* keys,
+                                           const struct ArrowStringView* values) {
+  // Index the updates such that the last value for a given key wins
+  struct ArrowMetadataIndex updates;
+  NANOARROW_RETURN_NOT_OK(ArrowMetadataIndexAllocate(&updates, n));
+  for (int64_t i = 0; i < n; i++) {
+    ArrowMetadataIndexInsert(&updates, keys[i], values[i], 1);
+  }
+
+  char* applied = NULL;
+  if (updates.n_keys > 0) {
+    applied = (char*)ArrowMalloc(updates.n_keys);
+    if (applied == NULL) {
+      ArrowMetadataIndexReset(&updates);
+      return ENOMEM;
+    }
+
+    memset(applied, 0, updates.n_keys);
+  }
+
+  struct ArrowMetadataReader reader;
+  struct ArrowStringView existing_key;
+  struct ArrowStringView existing_value;
+  struct ArrowBuffer new_buffer;
+  ArrowMetadataReaderInit(&reader, (const char*)buffer->data);
+  int result = ArrowMetadataBuilderInit(&new_buffer, NULL);
+
+  // Existing keys keep the position of their first instance; other instances of an
+  // updated key are dropped
+  while (result == NANOARROW_OK && reader.remaining_keys > 0) {
+    result = ArrowMetadataReaderRead(&reader, &existing_key, &existing_value);
+    if (result != NANOARROW_OK) {
+      break;
+    }
+
+    int64_t key_index = updates.slots[ArrowMetadataIndexFindSlot(&updates, existing_key)];
+    if (key_index == -1) {
+      result =
+          ArrowMetadataBuilderAppendInternal(&new_buffer, &existing_key, &existing_value);
+    } else if (!applied[key_index]) {
+      applied[key_index] = 1;
+      if (updates.values[key_index].data != NULL) {
+        result = ArrowMetadataBuilderAppendInternal(&new_buffer, &existing_key,
+                                                    updates.values + key_index);
+      }
+    }
+  }
+
+  // Keys that did not already exist are appended in the order they were first given
+  for (int64_t i = 0; result == NANOARROW_OK && i < updates.n_keys; i++) {
+    if (!applied[i] && updates.values[i].data != NULL) {
+      result = ArrowMetadataBuilderAppendInternal(&new_buffer, updates.keys + i,
+                                                  updates.values + i);
+    }
+  }
+
+  if (applied != NULL) {
+    ArrowFree(applied);
+  }
+  ArrowMetadataIndexReset(&updates);
+
+  if (result != NANOARROW_OK) {
+    ArrowBufferReset(&new_buffer);
+    return result;
+  }
+
+  ArrowBufferReset(buffer);
+  ArrowBufferMove(&new_buffer, buffer);
+  return NANOARROW_OK;
+}
+
+static void ArrowSchemaFieldIndexMeasure(struct ArrowSchema* schema,
+                                         int64_t parent_path_size, int64_t* n_fields,
+                                         int64_t* n_path_bytes) {
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    struct ArrowSchema* child = schema->children[i];
+    int64_t path_size = ArrowSchemaNameView(child).size_bytes;
+    if (parent_path_size >= 0) {
+      path_size += parent_path_size + 1;
+    }
+
+    *n_fields += 1;
+    *n_path_bytes += path_size;
+    ArrowSchemaFieldIndexMeasure(child, path_size, n_fields, n_path_bytes);
+  }
+}
+
+// Fields are numbered in depth-first order, which is the order of the flattened
+// fields used by the IPC decoder
+static void ArrowSchemaFieldIndexFill(struct ArrowSchemaFieldIndex* index,
+                                      struct ArrowSchema* schema, int64_t parent,
+                                      char** next_path) {
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    struct ArrowSchema* child = schema->children[i];
+    int64_t field_index = index->n_fields++;
+    struct ArrowStringView name = ArrowSchemaNameView(child);
+    struct ArrowStringView* path = index->paths + field_index;
+
+    path->data = *next_path;
+    path->size_bytes = 0;
+    if (parent >= 0) {
+      memcpy(*next_path, index->paths[parent].data, index->paths[parent].size_bytes);
+      (*next_path)[index->paths[parent].size_bytes] = '.';
+      path->size_bytes = index->paths[parent].size_bytes + 1;
+    }
+
+    memcpy(*next_path + path->size_bytes, name.data, (size_t)name.size_bytes);
+    path->size_bytes += name.size_bytes;
+    *next_path += path->size_bytes;
+
+    index->fields[field_index] = child;
+    index->parents[field_index] = parent;
+
+    // The first of any fields with identical paths is found by lookups
+    int64_t slot = ArrowStringViewTableFindSlot(index->paths, index->slots,
+                                                index->n_slots, *path);
+    if (index->slots[slot] == -1) {
+      index->slots[slot] = field_index;
+    }
+
+    ArrowSchemaFieldIndexFill(index, child, field_index, next_path);
+  }
+}
+
+static ArrowErrorCode ArrowSchemaFieldIndexValidate(struct ArrowSchema* schema,
+                                                    struct ArrowError* error) {
+  if (schema->release == NULL) {
+    ArrowErrorSet(error, "Expected valid schema but found a released schema");
+    return EINVAL;
+  }
+
+  if (schema->n_children > 0 && schema->children == NULL) {
+    ArrowErrorSet(error, "Expected non-NULL schema->children for %ld children",
+                  (long)schema->n_children);
+    return EINVAL;
+  }
+
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    if (schema->children[i] == NULL) {
+      ArrowErrorSet(error, "Expected non-NULL schema->children[%ld]", (long)i);
+      return EINVAL;
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowSchemaFieldIndexValidate(schema->children[i], error));
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowSchemaFieldIndexInit(struct ArrowSchemaFieldIndex* index,
+                                         struct ArrowSchema* schema,
+                                         struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaFieldIndexValidate(schema, error));
+
+  int64_t n_fields = 0;
+  int64_t n_path_bytes = 0;
+  ArrowSchemaFieldIndexMeasure(schema, -1, &n_fields, &n_path_bytes);
+
+  index->n_fields = 0;
+  index->n_slots = 8;
+  while (index->n_slots < (2 * n_fields)) {
+    index->n_slots *= 2;
+  }
+
+  index->paths = (struct ArrowStringView*)ArrowMalloc(
+      (n_fields + 1) * sizeof(struct ArrowStringView));
+  index->fields =
+      (struct ArrowSchema**)ArrowMalloc((n_fields + 1) * sizeof(struct ArrowSchema*));
+  index->parents = (int64_t*)ArrowMalloc((n_fields + 1) * sizeof(int64_t));
+  index->slots = (int64_t*)ArrowMalloc(index->n_slots * sizeof(int64_t));
+  index->path_data = (char*)ArrowMalloc(n_path_bytes + 1);
+  if (index->paths == NULL || index->fields == NULL || index->parents == NULL ||
+      index->slots == NULL || index->path_data == NULL) {
+    ArrowSchemaFieldIndexReset(index);
+    ArrowErrorSet(error, "Failed to allocate ArrowSchemaFieldIndex with %ld fields",
+                  (long)n_fields);
+    return ENOMEM;
+  }
+
+  memset(index->slots, 0xff, index->n_slots * sizeof(int64_t));
+  char* next_path = index->path_data;
+  ArrowSchemaFieldIndexFill(index, schema, -1, &next_path);
+  return NANOARROW_OK;
+}
+
+void ArrowSchemaFieldIndexReset(struct ArrowSchemaFieldIndex* index) {
+  if (index->paths != NULL) {
+    ArrowFree(index->paths);
+  }
+
+  if (index->fields != NULL) {
+    ArrowFree(index->fields);
+  }
+
+  if (index->parents != NULL) {
+    ArrowFree(index->parents);
+  }
+
+  if (index->slots != NULL) {
+    ArrowFree(index->slots);
+  }
+
+  if (index->path_data != NULL) {
+    ArrowFree(index->path_data);
+  }
+
+  index->n_fields = 0;
+  index->paths = NULL;
+  index->fields = NULL;
+  index->parents = NULL;
+  index->n_slots = 0;
+  index->slots = NULL;
+  index->path_data = NULL;
+}
+
+int64_t ArrowSchemaFieldIndexFind(const struct ArrowSchemaFieldIndex* index,
+                                  struct ArrowStringView path) {
+  return index->slots[ArrowStringViewTableFindSlot(index->paths, index->slots,
+                                                   index->n_slots, path)];
+}
+
+// Selection state of a field while initializing an ArrowSchemaProjection
+enum ArrowSchemaProjectionState {
+  NANOARROW_PROJECTION_NONE = 0,
+  NANOARROW_PROJECTION_PARTIAL = 1,
+  NANOARROW_PROJECTION_ALL = 2
+};
+
+struct ArrowSchemaProjectionBuilder {
+  struct ArrowSchema* schema;
+  struct ArrowSchemaFieldIndex index;
+  int8_t* state;
+  int64_t* rank;
+  int64_t* subtree_size;
+
+  // A stack of the selected children of the nodes being emitted
+  int64_t* stack_fields;
+  int64_t* stack_positions;
+  int64_t stack_size;
+};
+
+static void ArrowSchemaProjectionBuilderReset(
+    struct ArrowSchemaProjectionBuilder* builder) {
+  ArrowSchemaFieldIndexReset(&builder->index);
+  if (builder->state != NULL) {
+    ArrowFree(builder->state);
+  }
+
+  if (builder->rank != NULL) {
+    ArrowFree(builder->rank);
+  }
+
+  if (builder->subtree_size != NULL) {
+    ArrowFree(builder->subtree_size);
+  }
+
+  if (builder->stack_fields != NULL) {
+    ArrowFree(builder->stack_fields);
+  }
+
+  if (builder->stack_positions != NULL) {
+    ArrowFree(builder->stack_positions);
+  }
+}
+
+static ArrowErrorCode ArrowSchemaProjectionBuilderInit(
+    struct ArrowSchemaProjectionBuilder* builder, struct ArrowSchema* schema,
+    struct ArrowError* error) {
+  memset(builder, 0, sizeof(struct ArrowSchemaProjectionBuilder));
+  builder->schema = schema;
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaFieldIndexInit(&builder->index, schema, error));
+
+  int64_t n_fields = builder->index.n_fields;
+  builder->state = (int8_t*)ArrowMalloc(n_fields + 1);
+  builder->rank = (int64_t*)ArrowMalloc((n_fields + 1) * sizeof(int64_t));
+  builder->subtree_size = (int64_t*)ArrowMalloc((n_fields + 1) * sizeof(int64_t));
+  builder->stack_fields = (int64_t*)ArrowMalloc((n_fields + 1) * sizeof(int64_t));
+  builder->stack_positions = (int64_t*)ArrowMalloc((n_fields + 1) * sizeof(int64_t));
+  if (builder->state == NULL || builder->rank == NULL || builder->subtree_size == NULL ||
+      builder->stack_fields == NULL || builder->stack_positions == NULL) {
+    ArrowSchemaProjectionBuilderReset(builder);
+    ArrowErrorSet(error, "Failed to allocate projection of %ld fields", (long)n_fields);
+    return ENOMEM;
+  }
+
+  memset(builder->state, NANOARROW_PROJECTION_NONE, n_fields + 1);
+  for (int64_t i = 0; i < n_fields; i++) {
+    builder->rank[i] = INT64_MAX;
+    builder->subtree_size[i] = 1;
+  }
+
+  // Parents precede their descendants in depth-first order
+  for (int64_t i = n_fields - 1; i >= 0; i--) {
+    if (builder->index.parents[i] >= 0) {
+      builder->subtree_size[builder->index.parents[i]] += builder->subtree_size[i];
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowSchemaProjectionBuilderSelect(
+    struct ArrowSchemaProjectionBuilder* builder, struct ArrowStringView path,
+    int64_t rank, struct ArrowError* error) {
+  int64_t field = ArrowSchemaFieldIndexFind(&builder->index, path);
+  if (field == -1) {
+    ArrowErrorSet(error, "Field '%.*s' not found", (int)path.size_bytes, path.data);
+    return EINVAL;
+  }
+
+  builder->state[field] = NANOARROW_PROJECTION_ALL;
+  while (field != -1) {
+    if (builder->state[field] == NANOARROW_PROJECTION_NONE) {
+      builder->state[field] = NANOARROW_PROJECTION_PARTIAL;
+    }
+
+    if (rank < builder->rank[field]) {
+      builder->rank[field] = rank;
+    }
+
+    field = builder->index.parents[field];
+  }
+
+  return NANOARROW_OK;
+}
+
+// Emits the node for field (or the root if field is -1) followed by the nodes of its
+// selected children in the order in which they were first referenced
+static ArrowErrorCode ArrowSchemaProjectionEmit(
+    struct ArrowSchemaProjection* projection,
+    struct ArrowSchemaProjectionBuilder* builder, int64_t field, int64_t position,
+    struct ArrowError* error) {
+  int64_t node = projection->n_nodes++;
+  projection->child_index[node] = position;
+  if (field >= 0 && builder->state[field] == NANOARROW_PROJECTION_ALL) {
+    projection->n_children[node] = -1;
+    return NANOARROW_OK;
+  }
+
+  struct ArrowSchema* schema = builder->schema;
+  if (field >= 0) {
+    schema = builder->index.fields[field];
+  }
+  if (schema->format == NULL || strcmp(schema->format, "+s") != 0) {
+    if (field >= 0) {
+      ArrowErrorSet(error, "Can't project children of non-struct field '%.*s'",
+                    (int)builder->index.paths[field].size_bytes,
+                    builder->index.paths[field].data);
+    } else {
+      ArrowErrorSet(error, "Can't project children of non-struct schema");
+    }
+
+    return EINVAL;
+  }
+
+  // The children of a field are the subtrees following it in depth-first order
+  int64_t* fields = builder->stack_fields + builder->stack_size;
+  int64_t* positions = builder->stack_positions + builder->stack_size;
+  int64_t n_selected = 0;
+  int64_t child = field + 1;
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    if (builder->state[child] != NANOARROW_PROJECTION_NONE) {
+      int64_t j = n_selected++;
+      while (j > 0 && builder->rank[fields[j - 1]] > builder->rank[child]) {
+        fields[j] = fields[j - 1];
+        positions[j] = positions[j - 1];
+        j--;
+      }
+
+      fields[j] = child;
+      positions[j] = i;
+    }
+
+    child += builder->subtree_size[child];
+  }
+
+  projection->n_children[node] = n_selected;
+  builder->stack_size += n_selected;
+  for (int64_t i = 0; i < n_selected; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowSchemaProjectionEmit(projection, builder, fields[i], positions[i], error));
+  }
+
+  builder->stack_size -= n_selected;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowSchemaProjectionInit(struct ArrowSchemaProjection* projection,
+                                         struct ArrowSchema* schema,
+                                         const struct ArrowStringView* paths, int64_t n,
+                                         struct ArrowError* error) {
+  struct ArrowSchemaProjectionBuilder builder;
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaProjectionBuilderInit(&builder, schema, error));
+
+  projection->n_nodes = 0;
+  projection->child_index =
+      (int64_t*)ArrowMalloc((builder.index.n_fields + 1) * sizeof(int64_t));
+  projection->n_children =
+      (int64_t*)ArrowMalloc((builder.index.n_fields + 1) * sizeof(int64_t));
+  if (projection->child_index == NULL || projection->n_children == NULL) {
+    ArrowSchemaProjectionReset(projection);
+    ArrowSchemaProjectionBuilderReset(&builder);
+    ArrowErrorSet(error, "Failed to allocate projection of %ld fields",
+                  (long)builder.index.n_fields);
+    return ENOMEM;
+  }
+
+  int result = NANOARROW_OK;
+  for (int64_t i = 0; i < n && result == NANOARROW_OK; i++) {
+    result = ArrowSchemaProjectionBuilderSelect(&builder, paths[i], i, error);
+  }
+
+  if (result == NANOARROW_OK) {
+    result = ArrowSchemaProjectionEmit(projection, &builder, -1, -1, error);
+  }
+
+  ArrowSchemaProjectionBuilderReset(&builder);
+  if (result != NANOARROW_OK) {
+    ArrowSchemaProjectionReset(projection);
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+void ArrowSchemaProjectionReset(struct ArrowSchemaProjection* projection) {
+  if (projection->child_index != NULL) {
+    ArrowFree(projection->child_index);
+  }
+
+  if (projection->n_children != NULL) {
+    ArrowFree(projection->n_children);
+  }
+
+  projection->n_nodes = 0;
+  projection->child_index = NULL;
+  projection->n_children = NULL;
+}
+
+// On error, out is left released
+static ArrowErrorCode ArrowSchemaProjectNode(
+    struct ArrowSchema* schema, const struct ArrowSchemaProjection* projection,
+    int64_t* node, struct ArrowSchema* out) {
+  int64_t i = (*node)++;
+  if (projection->n_children[i] == -1) {
+    return ArrowSchemaDeepCopy(schema, out);
+  }
+
+  ArrowSchemaInit(out);
+  out->flags = schema->flags;
+  int result = ArrowSchemaSetFormat(out, schema->format);
+  if (result == NANOARROW_OK) {
+    result = ArrowSchemaSetName(out, schema->name);
+  }
+
+  if (result == NANOARROW_OK) {
+    result = ArrowSchemaSetMetadata(out, schema->metadata);
+  }
+
+  if (result == NANOARROW_OK) {
+    result = ArrowSchemaAllocateChildren(out, projection->n_children[i]);
+  }
+
+  for (int64_t j = 0; result == NANOARROW_OK && j < projection->n_children[i]; j++) {
+    int64_t child_index = -1;
+    if (*node < projection->n_nodes) {
+      child_index = projection->child_index[*node];
+    }
+
+    if (child_index < 0 || child_index >= schema->n_children) {
+      result = EINVAL;
+    } else {
+      result = ArrowSchemaProjectNode(schema->children[child_index], projection, node,
+                                      out->children[j]);
+    }
+  }
+
+  if (result != NANOARROW_OK) {
+    out->release(out);
+  }
+
+  return result;
+}
+
+ArrowErrorCode ArrowSchemaProject(struct ArrowSchema* schema,
+                                  const struct ArrowSchemaProjection* projection,
+                                  struct ArrowSchema* out, struct ArrowError* error) {
+  if (projection->n_nodes == 0) {
+    ArrowErrorSet(error, "Expected initialized projection");
+    return EINVAL;
+  }
+
+  int64_t node = 0;
+  int result = ArrowSchemaProjectNode(schema, projection, &node, out);
+  if (result != NANOARROW_OK) {
+    ArrowErrorSet(error, "ArrowSchemaProject() failed with errno %d", result);
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
@@ -386,6 +386,35 @@ TEST(SchemaTest, SchemaInitUnion) {
       dense_union({field("u1", int32()), field("u2", utf8())})));
 }
 
+TEST(SchemaTest, SchemaInitRunEndEncoded) {
+  struct ArrowSchema schema;
+
+  ArrowSchemaInit(&schema);
+  EXPECT_EQ(ArrowSchemaSetTypeRunEndEncoded(&schema, NANOARROW_TYPE_UINT32), EINVAL);
+  EXPECT_EQ(ArrowSchemaSetType(&schema, NANOARROW_TYPE_RUN_END_ENCODED), EINVAL);
+  schema.release(&schema);
+
+  ArrowSchemaInit(&schema);
+  EXPECT_EQ(ArrowSchemaSetTypeRunEndEncoded(&schema, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  EXPECT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  EXPECT_STREQ(schema.format, "+r");
+  ASSERT_EQ(schema.n_children, 2);
+  EXPECT_STREQ(schema.children[0]->format, "i");
+  EXPECT_STREQ(schema.children[0]->name, "run_ends");
+  EXPECT_FALSE(schema.children[0]->flags & ARROW_FLAG_NULLABLE);
+  EXPECT_STREQ(schema.children[1]->format, "u");
+  EXPECT_STREQ(schema.children[1]->name, "values");
+  EXPECT_TRUE(schema.children[1]->flags & ARROW_FLAG_NULLABLE);
+  schema.release(&schema);
+
+  ArrowSchemaInit(&schema);
+  EXPECT_EQ(ArrowSchemaSetType(&schema, NANOARROW_TYPE_BINARY_VIEW), NANOARROW_OK);
+  EXPECT_STREQ(schema.format, "vz");
+  EXPECT_EQ(ArrowSchemaSetType(&schema, NANOARROW_TYPE_STRING_VIEW), NANOARROW_OK);
+  EXPECT_STREQ(schema.format, "vu");
+  schema.release(&schema);
+}
+
 TEST(SchemaTest, SchemaSetFormat) {
   struct ArrowSchema schema;
   ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_UNINITIALIZED);
@@ -428,6 +457,59 @@ TEST(SchemaTest, SchemaSetMetadata) {
   schema.release(&schema);
 }
 
+TEST(SchemaTest, SchemaSetStatic) {
+  static const char kFormat[] = "i";
+  static const char kName[] = "a_name";
+  std::string simple_metadata = SimpleMetadata();
+
+  struct ArrowSchema schema;
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetFormatStatic(&schema, kFormat), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetNameStatic(&schema, kName), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetMetadataStatic(&schema, simple_metadata.data()),
+            NANOARROW_OK);
+  EXPECT_EQ(schema.format, kFormat);
+  EXPECT_EQ(schema.name, kName);
+  EXPECT_EQ(schema.metadata, simple_metadata.data());
+
+  // Replacing a borrowed string with a copy (and vice versa) is tracked per field
+  ASSERT_EQ(ArrowSchemaSetName(&schema, kName), NANOARROW_OK);
+  EXPECT_NE(schema.name, kName);
+  EXPECT_STREQ(schema.name, kName);
+  ASSERT_EQ(ArrowSchemaSetFormat(&schema, "l"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetFormatStatic(&schema, kFormat), NANOARROW_OK);
+  EXPECT_EQ(schema.format, kFormat);
+  ASSERT_EQ(ArrowSchemaSetMetadataStatic(&schema, nullptr), NANOARROW_OK);
+  EXPECT_EQ(schema.metadata, nullptr);
+
+  // A deep copy owns all of its strings
+  struct ArrowSchema schema_copy;
+  ASSERT_EQ(ArrowSchemaDeepCopy(&schema, &schema_copy), NANOARROW_OK);
+  EXPECT_NE(schema_copy.format, kFormat);
+  EXPECT_STREQ(schema_copy.format, kFormat);
+  schema_copy.release(&schema_copy);
+
+  schema.release(&schema);
+
+  // Formats and child names assigned from a type are borrowed
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_MAP), NANOARROW_OK);
+  struct ArrowSchema schema2;
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema2, NANOARROW_TYPE_MAP), NANOARROW_OK);
+  EXPECT_EQ(schema.format, schema2.format);
+  EXPECT_EQ(schema.children[0]->children[1]->name,
+            schema2.children[0]->children[1]->name);
+
+  // ...including when a child is moved out of the tree
+  struct ArrowSchema entries;
+  ArrowSchemaMove(schema.children[0], &entries);
+  ASSERT_EQ(ArrowSchemaSetFormat(&entries, "+s"), NANOARROW_OK);
+  EXPECT_STREQ(entries.name, "entries");
+  entries.release(&entries);
+
+  schema2.release(&schema2);
+  schema.release(&schema);
+}
+
 TEST(SchemaTest, SchemaAllocateDictionary) {
   struct ArrowSchema schema;
   ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_UNINITIALIZED);
@@ -526,6 +608,384 @@ TEST(SchemaTest, SchemaCopyMetadata) {
   schema.release(&schema);
 }
 
+TEST(SchemaTest, SchemaCopyCompact) {
+  struct ArrowSchema schema;
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0], "col1"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[1], "col2"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(schema.children[1]), NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowSchemaInitFromType(schema.children[1]->dictionary, NANOARROW_TYPE_STRING),
+      NANOARROW_OK);
+
+  struct ArrowBuffer buffer;
+  ASSERT_EQ(ArrowMetadataBuilderInit(&buffer, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowMetadataBuilderAppend(&buffer, ArrowCharView("key"),
+                                       ArrowCharView("value")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetMetadata(schema.children[0], (const char*)buffer.data),
+            NANOARROW_OK);
+  ArrowBufferReset(&buffer);
+
+  struct ArrowSchema schema_copy;
+  ASSERT_EQ(ArrowSchemaDeepCopy(&schema, &schema_copy), NANOARROW_OK);
+  EXPECT_TRUE(ArrowSchemaEquals(&schema, &schema_copy, NANOARROW_SCHEMA_COMPARE_DEFAULT));
+  EXPECT_NE(schema_copy.children[0]->name, schema.children[0]->name);
+
+  // Copies of compact schemas are also equal
+  struct ArrowSchema schema_copy2;
+  ASSERT_EQ(ArrowSchemaDeepCopy(&schema_copy, &schema_copy2), NANOARROW_OK);
+  EXPECT_TRUE(
+      ArrowSchemaEquals(&schema_copy, &schema_copy2, NANOARROW_SCHEMA_COMPARE_DEFAULT));
+  schema_copy2.release(&schema_copy2);
+
+  // Modifying a node of the copy does not affect other nodes or the original
+  ASSERT_EQ(ArrowSchemaSetName(schema_copy.children[0], "new_name"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetMetadata(schema_copy.children[0], nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema_copy.children[1]->dictionary,
+                               NANOARROW_TYPE_LARGE_STRING),
+            NANOARROW_OK);
+  EXPECT_STREQ(schema_copy.children[0]->name, "new_name");
+  EXPECT_EQ(schema_copy.children[0]->metadata, nullptr);
+  EXPECT_STREQ(schema_copy.children[0]->format, "i");
+  EXPECT_STREQ(schema_copy.children[1]->dictionary->format, "U");
+  EXPECT_STREQ(schema_copy.children[1]->name, "col2");
+  EXPECT_STREQ(schema.children[0]->name, "col1");
+  EXPECT_STREQ(schema.children[1]->dictionary->format, "u");
+  schema.release(&schema);
+
+  // A child moved out of the copy remains valid after the parent is released
+  struct ArrowSchema child;
+  ArrowSchemaMove(schema_copy.children[1], &child);
+  ASSERT_EQ(ArrowSchemaSetMetadata(&schema_copy, nullptr), NANOARROW_OK);
+  schema_copy.release(&schema_copy);
+  EXPECT_STREQ(child.format, "i");
+  EXPECT_STREQ(child.name, "col2");
+  ASSERT_NE(child.dictionary, nullptr);
+  EXPECT_STREQ(child.dictionary->format, "U");
+  child.release(&child);
+}
+
+TEST(SchemaTest, SchemaShare) {
+  struct ArrowSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0], "col1"), NANOARROW_OK);
+  const char* child_name = schema.children[0]->name;
+
+  // The first reference moves the schema into a shared holder
+  struct ArrowSchema shared1;
+  ASSERT_EQ(ArrowSchemaShare(&schema, &shared1), NANOARROW_OK);
+  ASSERT_NE(schema.release, nullptr);
+  EXPECT_EQ(schema.children[0]->name, child_name);
+  EXPECT_EQ(shared1.children[0]->name, child_name);
+  EXPECT_TRUE(ArrowSchemaEquals(&schema, &shared1, NANOARROW_SCHEMA_COMPARE_DEFAULT));
+
+  // References to references share the same holder
+  struct ArrowSchema shared2;
+  ASSERT_EQ(ArrowSchemaShare(&shared1, &shared2), NANOARROW_OK);
+  EXPECT_EQ(shared2.children[0]->name, child_name);
+
+  // References can be released in any order
+  schema.release(&schema);
+  shared1.release(&shared1);
+  EXPECT_STREQ(shared2.format, "+s");
+  EXPECT_STREQ(shared2.children[0]->name, "col1");
+
+  // Modifying a reference with ArrowSchemaSet*() modifies a copy
+  struct ArrowSchema shared3;
+  ASSERT_EQ(ArrowSchemaShare(&shared2, &shared3), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(&shared3, "renamed"), NANOARROW_OK);
+  EXPECT_EQ(shared2.name, nullptr);
+  EXPECT_STREQ(shared3.name, "renamed");
+  EXPECT_NE(shared3.children, shared2.children);
+
+  shared2.release(&shared2);
+  EXPECT_STREQ(shared3.children[0]->name, "col1");
+  shared3.release(&shared3);
+
+  schema.release = nullptr;
+  EXPECT_EQ(ArrowSchemaShare(&schema, &shared1), EINVAL);
+}
+
+TEST(SchemaTest, SchemaShareChildren) {
+  struct ArrowSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0], "col1"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[1], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[1], "col2"), NANOARROW_OK);
+
+  struct ArrowSchema shared1;
+  ASSERT_EQ(ArrowSchemaShare(&schema, &shared1), NANOARROW_OK);
+
+  // A child moved out of a reference outlives every other reference
+  struct ArrowSchema child;
+  ArrowSchemaMove(shared1.children[0], &child);
+  schema.release(&schema);
+  shared1.release(&shared1);
+  EXPECT_STREQ(child.format, "u");
+  EXPECT_STREQ(child.name, "col1");
+
+  // ...and can itself be shared
+  struct ArrowSchema child_shared;
+  ASSERT_EQ(ArrowSchemaShare(&child, &child_shared), NANOARROW_OK);
+  child.release(&child);
+  EXPECT_STREQ(child_shared.name, "col1");
+  child_shared.release(&child_shared);
+
+  // Modifying a child of a reference does not modify the shared holder
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0], "col1"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaShare(&schema, &shared1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(shared1.children[0], "renamed"), NANOARROW_OK);
+  EXPECT_STREQ(shared1.children[0]->name, "renamed");
+  EXPECT_STREQ(schema.children[0]->name, "col1");
+
+  // Sharing a modified reference shares its current contents
+  struct ArrowSchema shared2;
+  ASSERT_EQ(ArrowSchemaShare(&shared1, &shared2), NANOARROW_OK);
+  EXPECT_STREQ(shared2.children[0]->name, "renamed");
+  shared1.release(&shared1);
+  schema.release(&schema);
+  EXPECT_STREQ(shared2.children[0]->name, "renamed");
+  shared2.release(&shared2);
+
+  // Sharing a schema with a released child fails and leaves the schema unchanged
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(&schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.children[0], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  schema.children[0]->release(schema.children[0]);
+  EXPECT_EQ(ArrowSchemaShare(&schema, &shared1), EINVAL);
+  EXPECT_STREQ(schema.format, "+s");
+  schema.release(&schema);
+}
+
+TEST(SchemaTest, SchemaEqualsAndFingerprint) {
+  struct ArrowSchema lhs;
+  struct ArrowSchema rhs;
+
+  ArrowSchemaInit(&lhs);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&lhs, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(lhs.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(lhs.children[0], "col1"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(lhs.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(lhs.children[1], "col2"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaDeepCopy(&lhs, &rhs), NANOARROW_OK);
+
+  EXPECT_TRUE(ArrowSchemaEquals(&lhs, &rhs, NANOARROW_SCHEMA_COMPARE_DEFAULT));
+  EXPECT_EQ(ArrowSchemaFingerprint(&lhs, NANOARROW_SCHEMA_COMPARE_DEFAULT),
+            ArrowSchemaFingerprint(&rhs, NANOARROW_SCHEMA_COMPARE_DEFAULT));
+
+  // A NULL name is equivalent to an empty name
+  ASSERT_EQ(ArrowSchemaSetName(&lhs, ""), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(&rhs, nullptr), NANOARROW_OK);
+  EXPECT_TRUE(ArrowSchemaEquals(&lhs, &rhs, NANOARROW_SCHEMA_COMPARE_DEFAULT));
+  EXPECT_EQ(ArrowSchemaFingerprint(&lhs, NANOARROW_SCHEMA_COMPARE_DEFAULT),
+            ArrowSchemaFingerprint(&rhs, NANOARROW_SCHEMA_COMPARE_DEFAULT));
+
+  // Names of children are compared unless ignored
+  ASSERT_EQ(ArrowSchemaSetName(rhs.children[1], "col3"), NANOARROW_OK);
+  EXPECT_FALSE(ArrowSchemaEquals(&lhs, &rhs, NANOARROW_SCHEMA_COMPARE_DEFAULT));
+  EXPECT_NE(ArrowSchemaFingerprint(&lhs, NANOARROW_SCHEMA_COMPARE_DEFAULT),
+            ArrowSchemaFingerprint(&rhs, NANOARROW_SCHEMA_COMPARE_DEFAULT));
+  EXPECT_TRUE(ArrowSchemaEquals(&lhs, &rhs, NANOARROW_SCHEMA_COMPARE_IGNORE_NAMES));
+  EXPECT_EQ(ArrowSchemaFingerprint(&lhs, NANOARROW_SCHEMA_COMPARE_IGNORE_NAMES),
+            ArrowSchemaFingerprint(&rhs, NANOARROW_SCHEMA_COMPARE_IGNORE_NAMES));
+
+  // Metadata is compared unless ignored, and empty metadata is equivalent to NULL
+  struct ArrowBuffer buffer;
+  ASSERT_EQ(ArrowMetadataBuilderInit(&buffer, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowBufferAppendInt32(&buffer, 0), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetMetadata(lhs.children[0], (const char*)buffer.data),
+            NANOARROW_OK);
+  EXPECT_TRUE(ArrowSchemaEquals(&lhs, &rhs, NANOARROW_SCHEMA_COMPARE_IGNORE_NAMES));
+
+  ArrowBufferReset(&buffer);
+  ASSERT_EQ(ArrowMetadataBuilderInit(&buffer, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowMetadataBuilderAppend(&buffer, ArrowCharView("key"),
+                                       ArrowCharView("value")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetMetadata(lhs.children[0], (const char*)buffer.data),
+            NANOARROW_OK);
+  ArrowBufferReset(&buffer);
+
+  const int ignore_names = NANOARROW_SCHEMA_COMPARE_IGNORE_NAMES;
+  const int ignore_all =
+      NANOARROW_SCHEMA_COMPARE_IGNORE_NAMES | NANOARROW_SCHEMA_COMPARE_IGNORE_METADATA;
+  EXPECT_FALSE(ArrowSchemaEquals(&lhs, &rhs, ignore_names));
+  EXPECT_NE(ArrowSchemaFingerprint(&lhs, ignore_names),
+            ArrowSchemaFingerprint(&rhs, ignore_names));
+  EXPECT_TRUE(ArrowSchemaEquals(&lhs, &rhs, ignore_all));
+  EXPECT_EQ(ArrowSchemaFingerprint(&lhs, ignore_all),
+            ArrowSchemaFingerprint(&rhs, ignore_all));
+
+  // Flags, types, and dictionaries are always compared
+  rhs.children[0]->flags &= ~ARROW_FLAG_NULLABLE;
+  EXPECT_FALSE(ArrowSchemaEquals(&lhs, &rhs, ignore_all));
+  EXPECT_NE(ArrowSchemaFingerprint(&lhs, ignore_all),
+            ArrowSchemaFingerprint(&rhs, ignore_all));
+  rhs.children[0]->flags |= ARROW_FLAG_NULLABLE;
+
+  ASSERT_EQ(ArrowSchemaSetType(rhs.children[1], NANOARROW_TYPE_LARGE_STRING),
+            NANOARROW_OK);
+  EXPECT_FALSE(ArrowSchemaEquals(&lhs, &rhs, ignore_all));
+  EXPECT_NE(ArrowSchemaFingerprint(&lhs, ignore_all),
+            ArrowSchemaFingerprint(&rhs, ignore_all));
+  ASSERT_EQ(ArrowSchemaSetType(rhs.children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  EXPECT_TRUE(ArrowSchemaEquals(&lhs, &rhs, ignore_all));
+
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(rhs.children[1]), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(rhs.children[1]->dictionary, NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  EXPECT_FALSE(ArrowSchemaEquals(&lhs, &rhs, ignore_all));
+  EXPECT_NE(ArrowSchemaFingerprint(&lhs, ignore_all),
+            ArrowSchemaFingerprint(&rhs, ignore_all));
+
+  lhs.release(&lhs);
+  rhs.release(&rhs);
+}
+
+TEST(SchemaTest, SchemaFieldIndex) {
+  // struct<a: struct<b: list<item: int32>, c: string>, d: int64, "": int32>
+  struct ArrowSchema schema;
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema.children[0], 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0], "a"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0]->children[0], NANOARROW_TYPE_LIST),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0]->children[0], "b"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0]->children[0]->children[0],
+                               NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0]->children[1], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0]->children[1], "c"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_INT64), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[1], "d"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[2], NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  struct ArrowSchemaFieldIndex index;
+  ASSERT_EQ(ArrowSchemaFieldIndexInit(&index, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(index.n_fields, 6);
+
+  std::vector<std::string> paths;
+  for (int64_t i = 0; i < index.n_fields; i++) {
+    paths.push_back(std::string(index.paths[i].data, index.paths[i].size_bytes));
+    EXPECT_EQ(ArrowSchemaFieldIndexFind(&index, index.paths[i]), i);
+  }
+
+  EXPECT_EQ(paths, std::vector<std::string>({"a", "a.b", "a.b.item", "a.c", "d", ""}));
+  EXPECT_EQ(index.fields[2], schema.children[0]->children[0]->children[0]);
+  EXPECT_EQ(index.parents[0], -1);
+  EXPECT_EQ(index.parents[2], 1);
+  EXPECT_EQ(index.parents[3], 0);
+  EXPECT_EQ(ArrowSchemaFieldIndexFind(&index, ArrowCharView("a.c")), 3);
+  EXPECT_EQ(ArrowSchemaFieldIndexFind(&index, ArrowCharView("a.d")), -1);
+  EXPECT_EQ(ArrowSchemaFieldIndexFind(&index, ArrowCharView("c")), -1);
+  ArrowSchemaFieldIndexReset(&index);
+
+  // Invalid schemas are rejected
+  struct ArrowError error;
+  schema.children[0]->children[0]->children[0]->release(
+      schema.children[0]->children[0]->children[0]);
+  EXPECT_EQ(ArrowSchemaFieldIndexInit(&index, &schema, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected valid schema but found a released schema");
+
+  schema.release(&schema);
+}
+
+static void MakeProjectionTestSchema(struct ArrowSchema* schema) {
+  // struct<a: struct<b: int32, c: string>, d: int64, e: list<item: int32>>
+  ArrowSchemaInit(schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema, 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema->children[0], 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0], "a"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[0]->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0]->children[0], "b"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[0]->children[1], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0]->children[1], "c"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[1], NANOARROW_TYPE_INT64), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[1], "d"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[2], NANOARROW_TYPE_LIST), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[2], "e"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[2]->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+}
+
+TEST(SchemaTest, SchemaProject) {
+  struct ArrowSchema schema;
+  MakeProjectionTestSchema(&schema);
+
+  struct ArrowSchemaProjection projection;
+  std::vector<struct ArrowStringView> paths = {ArrowCharView("d"), ArrowCharView("a.c"),
+                                               ArrowCharView("e")};
+  ASSERT_EQ(ArrowSchemaProjectionInit(&projection, &schema, paths.data(), paths.size(),
+                                      nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(projection.n_nodes, 5);
+
+  struct ArrowSchema projected;
+  ASSERT_EQ(ArrowSchemaProject(&schema, &projection, &projected, nullptr),
+            NANOARROW_OK);
+  char out[128];
+  ArrowSchemaToString(&projected, out, sizeof(out), true);
+  EXPECT_STREQ(out, "struct<d: int64, a: struct<c: string>, e: list<item: int32>>");
+  projected.release(&projected);
+  ArrowSchemaProjectionReset(&projection);
+
+  // Selecting a field and one of its descendants keeps the whole field
+  paths = {ArrowCharView("a.b"), ArrowCharView("a")};
+  ASSERT_EQ(ArrowSchemaProjectionInit(&projection, &schema, paths.data(), paths.size(),
+                                      nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaProject(&schema, &projection, &projected, nullptr),
+            NANOARROW_OK);
+  ArrowSchemaToString(&projected, out, sizeof(out), true);
+  EXPECT_STREQ(out, "struct<a: struct<b: int32, c: string>>");
+  projected.release(&projected);
+  ArrowSchemaProjectionReset(&projection);
+
+  // An empty projection selects no children
+  ASSERT_EQ(ArrowSchemaProjectionInit(&projection, &schema, nullptr, 0, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaProject(&schema, &projection, &projected, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(projected.n_children, 0);
+  projected.release(&projected);
+  ArrowSchemaProjectionReset(&projection);
+
+  struct ArrowError error;
+  paths = {ArrowCharView("a.x")};
+  EXPECT_EQ(ArrowSchemaProjectionInit(&projection, &schema, paths.data(), paths.size(),
+                                      &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Field 'a.x' not found");
+
+  paths = {ArrowCharView("e.item")};
+  EXPECT_EQ(ArrowSchemaProjectionInit(&projection, &schema, paths.data(), paths.size(),
+                                      &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Can't project children of non-struct field 'e'");
+
+  schema.release(&schema);
+}
+
 TEST(SchemaViewTest, SchemaViewInitErrors) {
   struct ArrowSchema schema;
   struct ArrowSchemaView schema_view;
@@ -598,6 +1058,7 @@ TEST(SchemaViewTest, SchemaViewInitSimple) {
   EXPECT_EQ(schema_view.storage_type, NANOARROW_TYPE_NA);
   EXPECT_EQ(schema_view.extension_name.data, nullptr);
   EXPECT_EQ(schema_view.extension_metadata.data, nullptr);
+  EXPECT_EQ(schema_view.extension_id, NANOARROW_EXTENSION_ID_NONE);
   EXPECT_EQ(ArrowSchemaToStdString(&schema), "na");
   schema.release(&schema);
 
@@ -1105,6 +1566,50 @@ TEST(SchemaViewTest, SchemaViewInitNestedList) {
   schema.release(&schema);
 }
 
+TEST(SchemaViewTest, SchemaViewInitNestedListView) {
+  struct ArrowSchema schema;
+  struct ArrowSchemaView schema_view;
+  struct ArrowError error;
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_LIST_VIEW), NANOARROW_OK);
+  EXPECT_STREQ(schema.format, "+vl");
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  EXPECT_EQ(ArrowSchemaViewInit(&schema_view, &schema, &error), NANOARROW_OK);
+  EXPECT_EQ(schema_view.type, NANOARROW_TYPE_LIST_VIEW);
+  EXPECT_EQ(schema_view.storage_type, NANOARROW_TYPE_LIST_VIEW);
+  EXPECT_EQ(schema_view.layout.buffer_type[0], NANOARROW_BUFFER_TYPE_VALIDITY);
+  EXPECT_EQ(schema_view.layout.buffer_type[1], NANOARROW_BUFFER_TYPE_VIEW_OFFSET);
+  EXPECT_EQ(schema_view.layout.buffer_type[2], NANOARROW_BUFFER_TYPE_SIZE);
+  EXPECT_EQ(schema_view.layout.buffer_data_type[1], NANOARROW_TYPE_INT32);
+  EXPECT_EQ(schema_view.layout.buffer_data_type[2], NANOARROW_TYPE_INT32);
+  EXPECT_EQ(schema_view.layout.element_size_bits[1], 32);
+  EXPECT_EQ(schema_view.layout.element_size_bits[2], 32);
+  EXPECT_EQ(ArrowSchemaToStdString(&schema), "list_view<item: int32>");
+  schema.release(&schema);
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_LARGE_LIST_VIEW),
+            NANOARROW_OK);
+  EXPECT_STREQ(schema.format, "+vL");
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  EXPECT_EQ(ArrowSchemaViewInit(&schema_view, &schema, &error), NANOARROW_OK);
+  EXPECT_EQ(schema_view.type, NANOARROW_TYPE_LARGE_LIST_VIEW);
+  EXPECT_EQ(schema_view.storage_type, NANOARROW_TYPE_LARGE_LIST_VIEW);
+  EXPECT_EQ(schema_view.layout.buffer_type[1], NANOARROW_BUFFER_TYPE_VIEW_OFFSET);
+  EXPECT_EQ(schema_view.layout.buffer_type[2], NANOARROW_BUFFER_TYPE_SIZE);
+  EXPECT_EQ(schema_view.layout.buffer_data_type[1], NANOARROW_TYPE_INT64);
+  EXPECT_EQ(schema_view.layout.buffer_data_type[2], NANOARROW_TYPE_INT64);
+  EXPECT_EQ(schema_view.layout.element_size_bits[1], 64);
+  EXPECT_EQ(schema_view.layout.element_size_bits[2], 64);
+  EXPECT_EQ(ArrowSchemaToStdString(&schema), "large_list_view<item: int32>");
+
+  ASSERT_EQ(ArrowSchemaSetFormat(&schema, "+vx"), NANOARROW_OK);
+  EXPECT_EQ(ArrowSchemaViewInit(&schema_view, &schema, &error), EINVAL);
+  EXPECT_STREQ(ArrowErrorMessage(&error),
+               "Error parsing schema->format: Expected 'l' or 'L' following '+v' but "
+               "found 'x'");
+  schema.release(&schema);
+}
+
 TEST(SchemaViewTest, SchemaViewNestedListErrors) {
   struct ArrowSchema schema;
   struct ArrowSchemaView schema_view;
@@ -1341,6 +1846,71 @@ TEST(SchemaViewTest, SchemaViewInitNestedUnionErrors) {
   schema.release(&schema);
 }
 
+TEST(SchemaViewTest, SchemaViewInitBinaryAndStringView) {
+  struct ArrowSchema schema;
+  struct ArrowSchemaView schema_view;
+  struct ArrowError error;
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRING_VIEW), NANOARROW_OK);
+  EXPECT_EQ(ArrowSchemaViewInit(&schema_view, &schema, &error), NANOARROW_OK);
+  EXPECT_EQ(schema_view.type, NANOARROW_TYPE_STRING_VIEW);
+  EXPECT_EQ(schema_view.storage_type, NANOARROW_TYPE_STRING_VIEW);
+  EXPECT_EQ(schema_view.layout.buffer_type[0], NANOARROW_BUFFER_TYPE_VALIDITY);
+  EXPECT_EQ(schema_view.layout.buffer_type[1], NANOARROW_BUFFER_TYPE_DATA);
+  EXPECT_EQ(schema_view.layout.buffer_type[2], NANOARROW_BUFFER_TYPE_NONE);
+  EXPECT_EQ(schema_view.layout.buffer_data_type[1], NANOARROW_TYPE_STRING_VIEW);
+  EXPECT_EQ(schema_view.layout.element_size_bits[1], 128);
+  EXPECT_EQ(ArrowSchemaToStdString(&schema), "string_view");
+  schema.release(&schema);
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_BINARY_VIEW), NANOARROW_OK);
+  EXPECT_EQ(ArrowSchemaViewInit(&schema_view, &schema, &error), NANOARROW_OK);
+  EXPECT_EQ(schema_view.type, NANOARROW_TYPE_BINARY_VIEW);
+  EXPECT_EQ(schema_view.storage_type, NANOARROW_TYPE_BINARY_VIEW);
+  EXPECT_EQ(ArrowSchemaToStdString(&schema), "binary_view");
+
+  ASSERT_EQ(ArrowSchemaSetFormat(&schema, "vx"), NANOARROW_OK);
+  EXPECT_EQ(ArrowSchemaViewInit(&schema_view, &schema, &error), EINVAL);
+  EXPECT_STREQ(ArrowErrorMessage(&error),
+               "Error parsing schema->format: Expected 'z' or 'u' following 'v' but "
+               "found 'x'");
+  schema.release(&schema);
+}
+
+TEST(SchemaViewTest, SchemaViewInitRunEndEncoded) {
+  struct ArrowSchema schema;
+  struct ArrowSchemaView schema_view;
+  struct ArrowError error;
+
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeRunEndEncoded(&schema, NANOARROW_TYPE_INT16), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  EXPECT_EQ(ArrowSchemaViewInit(&schema_view, &schema, &error), NANOARROW_OK);
+  EXPECT_EQ(schema_view.type, NANOARROW_TYPE_RUN_END_ENCODED);
+  EXPECT_EQ(schema_view.storage_type, NANOARROW_TYPE_RUN_END_ENCODED);
+  EXPECT_EQ(schema_view.layout.buffer_type[0], NANOARROW_BUFFER_TYPE_NONE);
+  EXPECT_EQ(schema_view.layout.buffer_type[1], NANOARROW_BUFFER_TYPE_NONE);
+  EXPECT_EQ(schema_view.layout.buffer_type[2], NANOARROW_BUFFER_TYPE_NONE);
+  EXPECT_EQ(schema_view.layout.element_size_bits[0], 0);
+  EXPECT_EQ(schema_view.layout.element_size_bits[1], 0);
+  EXPECT_EQ(ArrowSchemaToStdString(&schema),
+            "run_end_encoded<run_ends: int16, values: int32>");
+
+  ASSERT_EQ(ArrowSchemaSetFormat(schema.children[0], "I"), NANOARROW_OK);
+  EXPECT_EQ(ArrowSchemaViewInit(&schema_view, &schema, &error), EINVAL);
+  EXPECT_STREQ(ArrowErrorMessage(&error),
+               "Expected format of run_ends child of run-end encoded type to be 's', "
+               "'i', or 'l' but found 'I'");
+  schema.release(&schema);
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_NA), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetFormat(&schema, "+r"), NANOARROW_OK);
+  EXPECT_EQ(ArrowSchemaViewInit(&schema_view, &schema, &error), EINVAL);
+  EXPECT_STREQ(ArrowErrorMessage(&error),
+               "Expected schema with 2 children but found 0 children");
+  schema.release(&schema);
+}
+
 TEST(SchemaViewTest, SchemaViewInitInvalidSpecErrors) {
   struct ArrowSchema schema;
   struct ArrowSchemaView schema_view;
@@ -1409,11 +1979,83 @@ TEST(SchemaViewTest, SchemaViewInitExtension) {
   EXPECT_EQ(std::string(schema_view.extension_metadata.data,
                         schema_view.extension_metadata.size_bytes),
             "test metadata");
+  EXPECT_EQ(schema_view.extension_id, NANOARROW_EXTENSION_ID_UNREGISTERED);
   EXPECT_EQ(ArrowSchemaToStdString(&schema), "arrow.test.ext_name{int32}");
 
   schema.release(&schema);
 }
 
+TEST(SchemaViewTest, SchemaViewInitExtensionRegistry) {
+  struct ArrowExtensionRegistry registry;
+  ArrowExtensionRegistryInit(&registry);
+
+  int32_t uuid_id;
+  int32_t json_id;
+  int32_t id;
+  ASSERT_EQ(ArrowExtensionRegistryRegister(&registry, ArrowCharView("arrow.uuid"),
+                                           &uuid_id),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowExtensionRegistryRegister(&registry, ArrowCharView("arrow.json"),
+                                           &json_id),
+            NANOARROW_OK);
+  EXPECT_EQ(uuid_id, 1);
+  EXPECT_EQ(json_id, 2);
+  EXPECT_EQ(registry.n_types, 2);
+
+  // Registering a name again returns the same identifier
+  ASSERT_EQ(ArrowExtensionRegistryRegister(&registry, ArrowCharView("arrow.json"), &id),
+            NANOARROW_OK);
+  EXPECT_EQ(id, json_id);
+  EXPECT_EQ(ArrowExtensionRegistryRegister(&registry, ArrowCharView(""), &id), EINVAL);
+
+  EXPECT_EQ(ArrowExtensionRegistryFind(&registry, ArrowCharView("arrow.uuid")), uuid_id);
+  EXPECT_EQ(ArrowExtensionRegistryFind(&registry, ArrowCharView("arrow.uui")),
+            NANOARROW_EXTENSION_ID_UNREGISTERED);
+  struct ArrowStringView name = ArrowExtensionRegistryName(&registry, json_id);
+  EXPECT_EQ(std::string(name.data, name.size_bytes), "arrow.json");
+  EXPECT_EQ(ArrowExtensionRegistryName(&registry, 3).data, nullptr);
+  EXPECT_EQ(ArrowExtensionRegistryName(&registry, NANOARROW_EXTENSION_ID_NONE).data,
+            nullptr);
+
+  struct ArrowSchema schema;
+  struct ArrowSchemaView schema_view;
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_STRING), NANOARROW_OK);
+
+  // Not an extension type
+  ASSERT_EQ(ArrowSchemaViewInitWithRegistry(&schema_view, &schema, &registry, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(schema_view.extension_id, NANOARROW_EXTENSION_ID_NONE);
+
+  struct ArrowBuffer metadata;
+  ASSERT_EQ(ArrowMetadataBuilderInit(&metadata, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowMetadataBuilderAppend(&metadata, ArrowCharView("ARROW:extension:name"),
+                                       ArrowCharView("arrow.json")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetMetadata(&schema, (const char*)metadata.data), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInitWithRegistry(&schema_view, &schema, &registry, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(schema_view.extension_id, json_id);
+  EXPECT_EQ(schema_view.extension_metadata.data, nullptr);
+
+  // ...without a registry, the extension type is not resolved
+  ASSERT_EQ(ArrowSchemaViewInitWithRegistry(&schema_view, &schema, nullptr, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(schema_view.extension_id, NANOARROW_EXTENSION_ID_UNREGISTERED);
+
+  // The first value of a duplicated key is used
+  ASSERT_EQ(ArrowMetadataBuilderAppend(&metadata, ArrowCharView("ARROW:extension:name"),
+                                       ArrowCharView("arrow.uuid")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetMetadata(&schema, (const char*)metadata.data), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaViewInitWithRegistry(&schema_view, &schema, &registry, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(schema_view.extension_id, json_id);
+
+  ArrowBufferReset(&metadata);
+  schema.release(&schema);
+  ArrowExtensionRegistryReset(&registry);
+}
+
 TEST(SchemaViewTest, SchemaViewInitExtensionDictionary) {
   struct ArrowSchema schema;
   struct ArrowSchemaView schema_view;
@@ -1472,6 +2114,59 @@ TEST(SchemaViewTest, SchemaFormatInvalid) {
   schema.release(&schema);
 }
 
+TEST(SchemaViewTest, SchemaFormatBuffer) {
+  struct ArrowSchema schema;
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0], "col1"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema.children[1], 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[1], "col2"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetTypeDateTime(schema.children[1]->children[0],
+                                       NANOARROW_TYPE_TIMESTAMP, NANOARROW_TIME_UNIT_MILLI,
+                                       "America/Halifax"),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[1]->children[0], "col3"), NANOARROW_OK);
+
+  struct ArrowBuffer buffer;
+  ArrowBufferInit(&buffer);
+
+  // Unlimited depth matches ArrowSchemaToString()
+  char expected[1024];
+  int64_t n = ArrowSchemaToString(&schema, expected, sizeof(expected), true);
+  ASSERT_EQ(ArrowSchemaToStringBuffer(&schema, &buffer, -1), NANOARROW_OK);
+  EXPECT_EQ(std::string(reinterpret_cast<char*>(buffer.data), buffer.size_bytes),
+            std::string(expected, n));
+  EXPECT_STREQ(reinterpret_cast<char*>(buffer.data), expected);
+
+  // Reusing the buffer does not reallocate
+  uint8_t* data = buffer.data;
+  buffer.size_bytes = 0;
+  ASSERT_EQ(ArrowSchemaToStringBuffer(&schema, &buffer, -1), NANOARROW_OK);
+  EXPECT_EQ(buffer.data, data);
+  EXPECT_EQ(buffer.size_bytes, n);
+
+  buffer.size_bytes = 0;
+  ASSERT_EQ(ArrowSchemaToStringBuffer(&schema, &buffer, 1), NANOARROW_OK);
+  EXPECT_STREQ(reinterpret_cast<char*>(buffer.data),
+               "struct<col1: int32, col2: struct<...>>");
+
+  buffer.size_bytes = 0;
+  ASSERT_EQ(ArrowSchemaToStringBuffer(&schema, &buffer, 0), NANOARROW_OK);
+  EXPECT_STREQ(reinterpret_cast<char*>(buffer.data), "struct<...>");
+
+  // Output is appended to existing content
+  ASSERT_EQ(ArrowSchemaToStringBuffer(schema.children[0], &buffer, 0), NANOARROW_OK);
+  EXPECT_STREQ(reinterpret_cast<char*>(buffer.data), "struct<...>int32");
+
+  buffer.size_bytes = 0;
+  ASSERT_EQ(ArrowSchemaToStringBuffer(nullptr, &buffer, -1), NANOARROW_OK);
+  EXPECT_STREQ(reinterpret_cast<char*>(buffer.data), "[invalid: pointer is null]");
+
+  ArrowBufferReset(&buffer);
+  schema.release(&schema);
+}
+
 TEST(MetadataTest, Metadata) {
   // Encoded metadata string for "key": "value"
   std::string simple_metadata = SimpleMetadata();
@@ -1570,3 +2265,117 @@ TEST(MetadataTest, MetadataBuild) {
 
   ArrowBufferReset(&metadata_builder);
 }
+
+TEST(MetadataTest, MetadataIndex) {
+  struct ArrowBuffer metadata_builder;
+  ASSERT_EQ(ArrowMetadataBuilderInit(&metadata_builder, nullptr), NANOARROW_OK);
+  for (int i = 0; i < 100; i++) {
+    std::string key = "key" + std::to_string(i);
+    std::string value = "value" + std::to_string(i);
+    ASSERT_EQ(ArrowMetadataBuilderAppend(&metadata_builder, ArrowCharView(key.c_str()),
+                                         ArrowCharView(value.c_str())),
+              NANOARROW_OK);
+  }
+
+  // Duplicate keys refer to the first instance, like ArrowMetadataGetValue()
+  ASSERT_EQ(ArrowMetadataBuilderAppend(&metadata_builder, ArrowCharView("key0"),
+                                       ArrowCharView("duplicate")),
+            NANOARROW_OK);
+  const char* metadata = (const char*)metadata_builder.data;
+
+  struct ArrowMetadataIndex index;
+  ASSERT_EQ(ArrowMetadataIndexInit(&index, metadata), NANOARROW_OK);
+  EXPECT_EQ(index.n_keys, 100);
+
+  for (int i = 0; i < 100; i++) {
+    std::string key = "key" + std::to_string(i);
+    struct ArrowStringView value = ArrowCharView(nullptr);
+    struct ArrowStringView expected_value = ArrowCharView(nullptr);
+    ASSERT_EQ(ArrowMetadataIndexGetValue(&index, ArrowCharView(key.c_str()), &value),
+              NANOARROW_OK);
+    ASSERT_EQ(
+        ArrowMetadataGetValue(metadata, ArrowCharView(key.c_str()), &expected_value),
+        NANOARROW_OK);
+    EXPECT_EQ(value.data, expected_value.data);
+    EXPECT_EQ(value.size_bytes, expected_value.size_bytes);
+    EXPECT_TRUE(ArrowMetadataIndexHasKey(&index, ArrowCharView(key.c_str())));
+  }
+
+  struct ArrowStringView value = ArrowCharView("default_val");
+  EXPECT_FALSE(ArrowMetadataIndexHasKey(&index, ArrowCharView("not_a_key")));
+  ASSERT_EQ(ArrowMetadataIndexGetValue(&index, ArrowCharView("not_a_key"), &value),
+            NANOARROW_OK);
+  EXPECT_EQ(std::string(value.data, value.size_bytes), "default_val");
+  EXPECT_EQ(ArrowMetadataIndexGetValue(&index, ArrowCharView("key0"), nullptr), EINVAL);
+  ArrowMetadataIndexReset(&index);
+  ArrowBufferReset(&metadata_builder);
+
+  // NULL metadata has no keys
+  ASSERT_EQ(ArrowMetadataIndexInit(&index, nullptr), NANOARROW_OK);
+  EXPECT_EQ(index.n_keys, 0);
+  EXPECT_FALSE(ArrowMetadataIndexHasKey(&index, ArrowCharView("key")));
+  ArrowMetadataIndexReset(&index);
+}
+
+TEST(MetadataTest, MetadataBuildSetMany) {
+  struct ArrowBuffer metadata_builder;
+  ASSERT_EQ(ArrowMetadataBuilderInit(&metadata_builder, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowMetadataBuilderAppend(&metadata_builder, ArrowCharView("key1"),
+                                       ArrowCharView("value1")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowMetadataBuilderAppend(&metadata_builder, ArrowCharView("key2"),
+                                       ArrowCharView("value2")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowMetadataBuilderAppend(&metadata_builder, ArrowCharView("key1"),
+                                       ArrowCharView("duplicate")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowMetadataBuilderAppend(&metadata_builder, ArrowCharView("key3"),
+                                       ArrowCharView("value3")),
+            NANOARROW_OK);
+
+  // Update key1 (twice), remove key2 and a key that doesn't exist, and add key4
+  std::vector<struct ArrowStringView> keys = {
+      ArrowCharView("key1"), ArrowCharView("key2"), ArrowCharView("key4"),
+      ArrowCharView("key5"), ArrowCharView("key1")};
+  std::vector<struct ArrowStringView> values = {
+      ArrowCharView("ignored"), ArrowCharView(nullptr), ArrowCharView("value4"),
+      ArrowCharView(nullptr), ArrowCharView("new_value1")};
+  ASSERT_EQ(ArrowMetadataBuilderSetMany(&metadata_builder, keys.size(), keys.data(),
+                                        values.data()),
+            NANOARROW_OK);
+
+  struct ArrowMetadataReader reader;
+  struct ArrowStringView key;
+  struct ArrowStringView value;
+  std::vector<std::string> pairs;
+  ASSERT_EQ(ArrowMetadataReaderInit(&reader, (const char*)metadata_builder.data),
+            NANOARROW_OK);
+  while (ArrowMetadataReaderRead(&reader, &key, &value) == NANOARROW_OK) {
+    pairs.push_back(std::string(key.data, key.size_bytes) + "=" +
+                    std::string(value.data, value.size_bytes));
+  }
+
+  EXPECT_EQ(pairs, std::vector<std::string>({"key1=new_value1", "key3=value3",
+                                             "key4=value4"}));
+
+  // Applying no updates preserves the content
+  int64_t size_bytes = metadata_builder.size_bytes;
+  ASSERT_EQ(ArrowMetadataBuilderSetMany(&metadata_builder, 0, nullptr, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(metadata_builder.size_bytes, size_bytes);
+  ArrowBufferReset(&metadata_builder);
+
+  // ...including for an empty builder
+  ASSERT_EQ(ArrowMetadataBuilderInit(&metadata_builder, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowMetadataBuilderSetMany(&metadata_builder, 2, keys.data() + 2,
+                                        values.data() + 2),
+            NANOARROW_OK);
+  value = ArrowCharView(nullptr);
+  ASSERT_EQ(ArrowMetadataGetValue((const char*)metadata_builder.data,
+                                  ArrowCharView("key4"), &value),
+            NANOARROW_OK);
+  EXPECT_EQ(std::string(value.data, value.size_bytes), "value4");
+  EXPECT_FALSE(
+      ArrowMetadataHasKey((const char*)metadata_builder.data, ArrowCharView("key5")));
+  ArrowBufferReset(&metadata_builder);
+}
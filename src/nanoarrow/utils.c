@@ -15,14 +15,44 @@
 // specific language governing permissions and limitations
 // under the License.
 
+// mremap() and MAP_ANONYMOUS require _GNU_SOURCE on Linux
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include <errno.h>
 #include <stdarg.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define NANOARROW_HAVE_MREMAP 1
+#else
+#define NANOARROW_HAVE_MREMAP 0
+#endif
+
+// Runtime selection of kernels using instructions that are not part of the
+// baseline target is implemented for GCC and Clang on x86 (using function
+// attributes) and detects ARM64 features on Linux
+#if (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define NANOARROW_CPU_DISPATCH_X86 1
+#else
+#define NANOARROW_CPU_DISPATCH_X86 0
+#endif
+
+#if defined(__linux__) && defined(__aarch64__)
+#include <sys/auxv.h>
+#endif
+
 #include "nanoarrow.h"
+#include "nanoarrow_atomic_internal.h"
 
 const char* ArrowNanoarrowVersion(void) { return NANOARROW_VERSION; }
 
@@ -57,6 +87,30 @@ const char* ArrowErrorMessage(struct ArrowError* error) {
   }
 }
 
+// Both values are read and written under g_arrow_trace_lock such that a trace event
+// never calls a callback with the private_data of another
+static ArrowSpinLock g_arrow_trace_lock = NANOARROW_SPIN_LOCK_INIT;
+static ArrowTraceCallback g_arrow_trace_callback = NULL;
+static void* g_arrow_trace_private_data = NULL;
+
+void ArrowTraceSetCallback(ArrowTraceCallback callback, void* private_data) {
+  ArrowSpinLockAcquire(&g_arrow_trace_lock);
+  g_arrow_trace_callback = callback;
+  g_arrow_trace_private_data = private_data;
+  ArrowSpinLockRelease(&g_arrow_trace_lock);
+}
+
+void ArrowTrace(enum ArrowTraceEvent event, int64_t arg0, int64_t arg1) {
+  ArrowSpinLockAcquire(&g_arrow_trace_lock);
+  ArrowTraceCallback callback = g_arrow_trace_callback;
+  void* private_data = g_arrow_trace_private_data;
+  ArrowSpinLockRelease(&g_arrow_trace_lock);
+
+  if (callback != NULL) {
+    callback(event, arg0, arg1, private_data);
+  }
+}
+
 void ArrowLayoutInit(struct ArrowLayout* layout, enum ArrowType storage_type) {
   layout->buffer_type[0] = NANOARROW_BUFFER_TYPE_VALIDITY;
   layout->buffer_data_type[0] = NANOARROW_TYPE_BOOL;
@@ -94,6 +148,24 @@ void ArrowLayoutInit(struct ArrowLayout* layout, enum ArrowType storage_type) {
       layout->element_size_bits[1] = 64;
       break;
 
+    case NANOARROW_TYPE_LIST_VIEW:
+      layout->buffer_type[1] = NANOARROW_BUFFER_TYPE_VIEW_OFFSET;
+      layout->buffer_data_type[1] = NANOARROW_TYPE_INT32;
+      layout->element_size_bits[1] = 32;
+      layout->buffer_type[2] = NANOARROW_BUFFER_TYPE_SIZE;
+      layout->buffer_data_type[2] = NANOARROW_TYPE_INT32;
+      layout->element_size_bits[2] = 32;
+      break;
+
+    case NANOARROW_TYPE_LARGE_LIST_VIEW:
+      layout->buffer_type[1] = NANOARROW_BUFFER_TYPE_VIEW_OFFSET;
+      layout->buffer_data_type[1] = NANOARROW_TYPE_INT64;
+      layout->element_size_bits[1] = 64;
+      layout->buffer_type[2] = NANOARROW_BUFFER_TYPE_SIZE;
+      layout->buffer_data_type[2] = NANOARROW_TYPE_INT64;
+      layout->element_size_bits[2] = 64;
+      break;
+
     case NANOARROW_TYPE_STRUCT:
     case NANOARROW_TYPE_FIXED_SIZE_LIST:
       layout->buffer_type[1] = NANOARROW_BUFFER_TYPE_NONE;
@@ -186,11 +258,500 @@ void ArrowLayoutInit(struct ArrowLayout* layout, enum ArrowType storage_type) {
       layout->buffer_data_type[2] = NANOARROW_TYPE_BINARY;
       break;
 
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_STRING_VIEW:
+      layout->element_size_bits[1] = 128;
+      break;
+
+    case NANOARROW_TYPE_RUN_END_ENCODED:
+      layout->buffer_type[0] = NANOARROW_BUFFER_TYPE_NONE;
+      layout->buffer_data_type[0] = NANOARROW_TYPE_UNINITIALIZED;
+      layout->buffer_type[1] = NANOARROW_BUFFER_TYPE_NONE;
+      layout->buffer_data_type[1] = NANOARROW_TYPE_UNINITIALIZED;
+      layout->element_size_bits[0] = 0;
+      break;
+
     default:
       break;
   }
 }
 
+// Decimal values are parsed and formatted using their magnitude as (up to eight)
+// 32-bit limbs from least to most significant, which are multiplied or divided by
+// a power of ten for every nine digits such that every intermediate value fits in
+// a uint64_t
+#define NANOARROW_DECIMAL_MAX_LIMBS 8
+#define NANOARROW_DECIMAL_CHUNK_DIGITS 9
+#define NANOARROW_DECIMAL_CHUNK 1000000000U
+
+static const uint32_t kArrowDecimalPowersOfTen[] = {
+    1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U};
+
+// Copy the magnitude of decimal into limbs and return 1 if it is negative
+static int ArrowDecimalGetLimbs(struct ArrowDecimal* decimal, uint32_t* limbs) {
+  int n_limbs = decimal->n_words * 2;
+  for (int k = 0; k < decimal->n_words; k++) {
+    int word_index = decimal->low_word_index == 0 ? k : decimal->n_words - 1 - k;
+    limbs[2 * k] = (uint32_t)decimal->words[word_index];
+    limbs[2 * k + 1] = (uint32_t)(decimal->words[word_index] >> 32);
+  }
+
+  int negative = ArrowDecimalSign(decimal) < 0;
+  if (negative) {
+    uint64_t carry = 1;
+    for (int i = 0; i < n_limbs; i++) {
+      uint64_t value = (uint64_t)(uint32_t)~limbs[i] + carry;
+      limbs[i] = (uint32_t)value;
+      carry = value >> 32;
+    }
+  }
+
+  return negative;
+}
+
+static void ArrowDecimalSetLimbs(struct ArrowDecimal* decimal, uint32_t* limbs,
+                                 int negative) {
+  int n_limbs = decimal->n_words * 2;
+  if (negative) {
+    uint64_t carry = 1;
+    for (int i = 0; i < n_limbs; i++) {
+      uint64_t value = (uint64_t)(uint32_t)~limbs[i] + carry;
+      limbs[i] = (uint32_t)value;
+      carry = value >> 32;
+    }
+  }
+
+  for (int k = 0; k < decimal->n_words; k++) {
+    int word_index = decimal->low_word_index == 0 ? k : decimal->n_words - 1 - k;
+    decimal->words[word_index] =
+        (uint64_t)limbs[2 * k] | ((uint64_t)limbs[2 * k + 1] << 32);
+  }
+}
+
+// Set limbs to limbs * multiply + add and return the carry out of the highest limb
+static uint32_t ArrowDecimalLimbsMultiplyAdd(uint32_t* limbs, int n_limbs,
+                                             uint32_t multiply, uint32_t add) {
+  uint64_t carry = add;
+  for (int i = 0; i < n_limbs; i++) {
+    uint64_t value = (uint64_t)limbs[i] * multiply + carry;
+    limbs[i] = (uint32_t)value;
+    carry = value >> 32;
+  }
+
+  return (uint32_t)carry;
+}
+
+// Set limbs to limbs / divide and return the remainder
+static uint32_t ArrowDecimalLimbsDivide(uint32_t* limbs, int n_limbs, uint32_t divide) {
+  uint64_t remainder = 0;
+  for (int i = n_limbs - 1; i >= 0; i--) {
+    uint64_t value = (remainder << 32) | limbs[i];
+    limbs[i] = (uint32_t)(value / divide);
+    remainder = value % divide;
+  }
+
+  return (uint32_t)remainder;
+}
+
+// The ith digit of the integer digits followed by the fractional digits of a value
+static inline uint32_t ArrowDecimalDigit(const char* int_digits, int64_t n_int_digits,
+                                         const char* frac_digits, int64_t i) {
+  return (uint32_t)((i < n_int_digits ? int_digits[i] : frac_digits[i - n_int_digits]) -
+                    '0');
+}
+
+// Parse value as the unscaled value of decimal (if !scaled) or as a value with an
+// optional decimal point that is rescaled to the scale of decimal
+static ArrowErrorCode ArrowDecimalParse(struct ArrowDecimal* decimal,
+                                        struct ArrowStringView value, int scaled) {
+  const char* p = value.data;
+  const char* end = value.data + value.size_bytes;
+
+  int negative = 0;
+  if (p < end && (*p == '-' || *p == '+')) {
+    negative = *p == '-';
+    p++;
+  }
+
+  const char* int_digits = p;
+  while (p < end && *p >= '0' && *p <= '9') {
+    p++;
+  }
+  int64_t n_int_digits = p - int_digits;
+
+  const char* frac_digits = p;
+  int64_t n_frac_digits = 0;
+  if (scaled && p < end && *p == '.') {
+    frac_digits = ++p;
+    while (p < end && *p >= '0' && *p <= '9') {
+      p++;
+    }
+    n_frac_digits = p - frac_digits;
+  }
+
+  if (p != end || (n_int_digits + n_frac_digits) == 0) {
+    return EINVAL;
+  }
+
+  // Digits beyond the scale must be zero, and zeros are appended to values with
+  // fewer fractional digits than the scale
+  int64_t scale = scaled ? decimal->scale : 0;
+  int64_t n_digits = n_int_digits + n_frac_digits;
+  int64_t n_zeros = 0;
+  if (n_frac_digits > scale) {
+    int64_t n_dropped = n_frac_digits - scale;
+    for (int64_t i = n_digits - n_dropped; i < n_digits; i++) {
+      if (i >= 0 && ArrowDecimalDigit(int_digits, n_int_digits, frac_digits, i) != 0) {
+        return EINVAL;
+      }
+    }
+
+    n_digits = n_digits > n_dropped ? n_digits - n_dropped : 0;
+  } else {
+    n_zeros = scale - n_frac_digits;
+  }
+
+  // Leading zeros do not count towards the precision
+  int64_t i = 0;
+  while (i < n_digits &&
+         ArrowDecimalDigit(int_digits, n_int_digits, frac_digits, i) == 0) {
+    i++;
+  }
+
+  if (i < n_digits && (n_digits - i + n_zeros) > decimal->precision) {
+    return EOVERFLOW;
+  }
+
+  uint32_t limbs[NANOARROW_DECIMAL_MAX_LIMBS];
+  int n_limbs = decimal->n_words * 2;
+  memset(limbs, 0, sizeof(limbs));
+  uint32_t carry = 0;
+
+  while (i < n_digits) {
+    int64_t chunk_end = i + NANOARROW_DECIMAL_CHUNK_DIGITS;
+    if (chunk_end > n_digits) {
+      chunk_end = n_digits;
+    }
+
+    int n_chunk_digits = (int)(chunk_end - i);
+    uint32_t chunk = 0;
+    for (; i < chunk_end; i++) {
+      chunk = chunk * 10 + ArrowDecimalDigit(int_digits, n_int_digits, frac_digits, i);
+    }
+
+    uint32_t multiply = kArrowDecimalPowersOfTen[n_chunk_digits];
+    carry |= ArrowDecimalLimbsMultiplyAdd(limbs, n_limbs, multiply, chunk);
+  }
+
+  for (; n_zeros > 0; n_zeros -= NANOARROW_DECIMAL_CHUNK_DIGITS) {
+    int n_chunk_zeros = n_zeros > NANOARROW_DECIMAL_CHUNK_DIGITS
+                            ? NANOARROW_DECIMAL_CHUNK_DIGITS
+                            : (int)n_zeros;
+    carry |= ArrowDecimalLimbsMultiplyAdd(limbs, n_limbs,
+                                          kArrowDecimalPowersOfTen[n_chunk_zeros], 0);
+  }
+
+  // The magnitude must also fit in the signed range of the decimal
+  if (carry != 0 || (limbs[n_limbs - 1] >> 31) != 0) {
+    return EOVERFLOW;
+  }
+
+  ArrowDecimalSetLimbs(decimal, limbs, negative);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowDecimalSetDigits(struct ArrowDecimal* decimal,
+                                     struct ArrowStringView value) {
+  return ArrowDecimalParse(decimal, value, 0);
+}
+
+ArrowErrorCode ArrowDecimalSetString(struct ArrowDecimal* decimal,
+                                     struct ArrowStringView value) {
+  return ArrowDecimalParse(decimal, value, 1);
+}
+
+// Write the digits of the magnitude of decimal to out (which must have room for
+// NANOARROW_DECIMAL_MAX_DIGITS characters) and return the number of digits written
+#define NANOARROW_DECIMAL_MAX_DIGITS 80
+static int64_t ArrowDecimalFormatDigits(struct ArrowDecimal* decimal, char* out,
+                                        int* negative) {
+  uint32_t limbs[NANOARROW_DECIMAL_MAX_LIMBS];
+  int n_limbs = decimal->n_words * 2;
+  *negative = ArrowDecimalGetLimbs(decimal, limbs);
+
+  // Collect base 10^9 chunks from least to most significant, dropping the highest
+  // limb whenever it becomes zero
+  uint32_t chunks[NANOARROW_DECIMAL_MAX_DIGITS / NANOARROW_DECIMAL_CHUNK_DIGITS + 1];
+  int n_chunks = 0;
+  while (n_limbs > 0 && limbs[n_limbs - 1] == 0) {
+    n_limbs--;
+  }
+
+  while (n_limbs > 0) {
+    chunks[n_chunks++] = ArrowDecimalLimbsDivide(limbs, n_limbs, NANOARROW_DECIMAL_CHUNK);
+    while (n_limbs > 0 && limbs[n_limbs - 1] == 0) {
+      n_limbs--;
+    }
+  }
+
+  if (n_chunks == 0) {
+    out[0] = '0';
+    return 1;
+  }
+
+  // The most significant chunk is written without leading zeros
+  char digits[NANOARROW_DECIMAL_CHUNK_DIGITS];
+  int n_digits = 0;
+  uint32_t chunk = chunks[n_chunks - 1];
+  while (chunk > 0) {
+    digits[n_digits++] = (char)('0' + chunk % 10);
+    chunk /= 10;
+  }
+
+  int64_t n_out = 0;
+  while (n_digits > 0) {
+    out[n_out++] = digits[--n_digits];
+  }
+
+  for (int k = n_chunks - 2; k >= 0; k--) {
+    chunk = chunks[k];
+    for (int j = NANOARROW_DECIMAL_CHUNK_DIGITS - 1; j >= 0; j--) {
+      out[n_out + j] = (char)('0' + chunk % 10);
+      chunk /= 10;
+    }
+
+    n_out += NANOARROW_DECIMAL_CHUNK_DIGITS;
+  }
+
+  return n_out;
+}
+
+ArrowErrorCode ArrowDecimalAppendDigitsToBuffer(struct ArrowDecimal* decimal,
+                                                struct ArrowBuffer* buffer) {
+  char digits[NANOARROW_DECIMAL_MAX_DIGITS];
+  int negative;
+  int64_t n_digits = ArrowDecimalFormatDigits(decimal, digits, &negative);
+
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(buffer, n_digits + 1));
+  if (negative) {
+    ArrowBufferAppendUnsafe(buffer, "-", 1);
+  }
+
+  ArrowBufferAppendUnsafe(buffer, digits, n_digits);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowDecimalAppendStringToBuffer(struct ArrowDecimal* decimal,
+                                                struct ArrowBuffer* buffer) {
+  char digits[NANOARROW_DECIMAL_MAX_DIGITS];
+  int negative;
+  int64_t n_digits = ArrowDecimalFormatDigits(decimal, digits, &negative);
+  int64_t scale = decimal->scale;
+  int is_zero = n_digits == 1 && digits[0] == '0';
+
+  // Room for the sign, the digits, the decimal point, and any zeros
+  NANOARROW_RETURN_NOT_OK(
+      ArrowBufferReserve(buffer, n_digits + (scale < 0 ? -scale : scale) + 3));
+  if (negative) {
+    ArrowBufferAppendUnsafe(buffer, "-", 1);
+  }
+
+  if (scale <= 0) {
+    ArrowBufferAppendUnsafe(buffer, digits, n_digits);
+    if (!is_zero) {
+      memset(buffer->data + buffer->size_bytes, '0', -scale);
+      buffer->size_bytes += -scale;
+    }
+  } else if (n_digits > scale) {
+    ArrowBufferAppendUnsafe(buffer, digits, n_digits - scale);
+    ArrowBufferAppendUnsafe(buffer, ".", 1);
+    ArrowBufferAppendUnsafe(buffer, digits + n_digits - scale, scale);
+  } else {
+    ArrowBufferAppendUnsafe(buffer, "0.", 2);
+    memset(buffer->data + buffer->size_bytes, '0', scale - n_digits);
+    buffer->size_bytes += scale - n_digits;
+    ArrowBufferAppendUnsafe(buffer, digits, n_digits);
+  }
+
+  return NANOARROW_OK;
+}
+
+#if !defined(NANOARROW_CPU_FEATURES)
+static int ArrowCpuFeaturesDetect(void) {
+  int features = 0;
+#if NANOARROW_CPU_DISPATCH_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("popcnt")) {
+    features |= NANOARROW_CPU_POPCNT;
+  }
+
+  if (__builtin_cpu_supports("avx2")) {
+    features |= NANOARROW_CPU_AVX2;
+  }
+
+  if (__builtin_cpu_supports("avx512f")) {
+    features |= NANOARROW_CPU_AVX512;
+  }
+#elif defined(__aarch64__)
+  // NEON is part of the ARMv8-A baseline
+  features |= NANOARROW_CPU_NEON;
+#if defined(__linux__) && defined(HWCAP_SVE)
+  if (getauxval(AT_HWCAP) & HWCAP_SVE) {
+    features |= NANOARROW_CPU_SVE;
+  }
+#endif
+#endif
+  return features;
+}
+#endif
+
+int ArrowCpuFeatures(void) {
+#if defined(NANOARROW_CPU_FEATURES)
+  return NANOARROW_CPU_FEATURES;
+#elif NANOARROW_USE_STDATOMIC
+  // Detection always gives the same result, so threads that detect features
+  // concurrently on first use store the same value
+  static atomic_int features = -1;
+  int value = atomic_load_explicit(&features, memory_order_relaxed);
+  if (value < 0) {
+    value = ArrowCpuFeaturesDetect();
+    atomic_store_explicit(&features, value, memory_order_relaxed);
+  }
+
+  return value;
+#else
+  static int features = -1;
+  if (features < 0) {
+    features = ArrowCpuFeaturesDetect();
+  }
+
+  return features;
+#endif
+}
+
+static int64_t ArrowBitCountSetWordsPortable(const uint8_t* bits, int64_t n_words) {
+  int64_t count = 0;
+  uint64_t word;
+  for (int64_t i = 0; i < n_words; i++) {
+    memcpy(&word, bits + i * 8, sizeof(uint64_t));
+    count += _ArrowPopcountUInt64(word);
+  }
+
+  return count;
+}
+
+#if NANOARROW_CPU_DISPATCH_X86
+__attribute__((target("popcnt"))) static int64_t ArrowBitCountSetWordsPopcnt(
+    const uint8_t* bits, int64_t n_words) {
+  int64_t count = 0;
+  uint64_t word;
+  for (int64_t i = 0; i < n_words; i++) {
+    memcpy(&word, bits + i * 8, sizeof(uint64_t));
+    count += __builtin_popcountll(word);
+  }
+
+  return count;
+}
+
+// Count the set bits of each nibble of 32 bytes at a time using a shuffle as a
+// lookup table and sum the bytes of each 64-bit lane
+__attribute__((target("avx2,popcnt"))) static int64_t ArrowBitCountSetWordsAvx2(
+    const uint8_t* bits, int64_t n_words) {
+  const __m256i lookup =
+      _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2,
+                       2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i low_mask = _mm256_set1_epi8(0x0f);
+  __m256i sums = _mm256_setzero_si256();
+
+  int64_t i = 0;
+  for (; (i + 4) <= n_words; i += 4) {
+    __m256i values = _mm256_loadu_si256((const __m256i*)(bits + i * 8));
+    __m256i low = _mm256_and_si256(values, low_mask);
+    __m256i high = _mm256_and_si256(_mm256_srli_epi16(values, 4), low_mask);
+    __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low),
+                                     _mm256_shuffle_epi8(lookup, high));
+    sums = _mm256_add_epi64(sums, _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+  }
+
+  uint64_t lanes[4];
+  _mm256_storeu_si256((__m256i*)lanes, sums);
+  int64_t count = (int64_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+
+  uint64_t word;
+  for (; i < n_words; i++) {
+    memcpy(&word, bits + i * 8, sizeof(uint64_t));
+    count += __builtin_popcountll(word);
+  }
+
+  return count;
+}
+#endif
+
+int64_t ArrowBitCountSetWords(const uint8_t* bits, int64_t n_words) {
+#if NANOARROW_CPU_DISPATCH_X86
+  int features = ArrowCpuFeatures();
+  if ((features & NANOARROW_CPU_AVX2) && (features & NANOARROW_CPU_POPCNT)) {
+    return ArrowBitCountSetWordsAvx2(bits, n_words);
+  } else if (features & NANOARROW_CPU_POPCNT) {
+    return ArrowBitCountSetWordsPopcnt(bits, n_words);
+  }
+#endif
+
+  return ArrowBitCountSetWordsPortable(bits, n_words);
+}
+
+static int64_t ArrowBitmapToIndicesWordsPortable(const uint8_t* bits, int64_t n_words,
+                                                 int64_t base, int64_t* out) {
+  int64_t n = 0;
+  for (int64_t i = 0; i < n_words; i++) {
+    uint64_t word = _ArrowBitsLoadWord(bits, i * 64);
+    if (word != 0) {
+      n += _ArrowBitsWordToIndices(word, base + i * 64, out + n);
+    }
+  }
+
+  return n;
+}
+
+#if NANOARROW_CPU_DISPATCH_X86
+// Store the positions selected by each byte of a word using the byte as the mask
+// of a compressing store of eight consecutive positions
+__attribute__((target("avx512f"))) static int64_t ArrowBitmapToIndicesWordsAvx512(
+    const uint8_t* bits, int64_t n_words, int64_t base, int64_t* out) {
+  const __m512i step = _mm512_set1_epi64(8);
+  int64_t n = 0;
+  uint64_t word;
+  for (int64_t i = 0; i < n_words; i++) {
+    memcpy(&word, bits + i * 8, sizeof(uint64_t));
+    if (word == 0) {
+      continue;
+    }
+
+    __m512i positions = _mm512_add_epi64(_mm512_set1_epi64(base + i * 64),
+                                         _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0));
+    for (int j = 0; j < 8; j++) {
+      const uint8_t byte = bits[i * 8 + j];
+      _mm512_mask_compressstoreu_epi64(out + n, (__mmask8)byte, positions);
+      n += _ArrowkBytePopcount[byte];
+      positions = _mm512_add_epi64(positions, step);
+    }
+  }
+
+  return n;
+}
+#endif
+
+int64_t ArrowBitmapToIndicesWords(const uint8_t* bits, int64_t n_words, int64_t base,
+                                  int64_t* out) {
+#if NANOARROW_CPU_DISPATCH_X86
+  if (ArrowCpuFeatures() & NANOARROW_CPU_AVX512) {
+    return ArrowBitmapToIndicesWordsAvx512(bits, n_words, base, out);
+  }
+#endif
+
+  return ArrowBitmapToIndicesWordsPortable(bits, n_words, base, out);
+}
+
 void* ArrowMalloc(int64_t size) { return malloc(size); }
 
 void* ArrowRealloc(void* ptr, int64_t size) { return realloc(ptr, size); }
@@ -215,6 +776,666 @@ struct ArrowBufferAllocator ArrowBufferAllocatorDefault(void) {
   return ArrowBufferAllocatorMalloc;
 }
 
+// Aligned allocations are made by overallocating using ArrowMalloc() and
+// storing the pointer that must eventually be passed to ArrowFree()
+// immediately before the aligned pointer that is returned.
+static uint8_t* ArrowAlignedMalloc(int64_t size, int64_t alignment) {
+  uint8_t* unaligned = (uint8_t*)ArrowMalloc(size + alignment + sizeof(void*));
+  if (unaligned == NULL) {
+    return NULL;
+  }
+
+  uintptr_t address = (uintptr_t)(unaligned + sizeof(void*));
+  address = (address + alignment - 1) & ~((uintptr_t)alignment - 1);
+  uint8_t* aligned = (uint8_t*)address;
+  memcpy(aligned - sizeof(void*), &unaligned, sizeof(void*));
+  return aligned;
+}
+
+static void ArrowAlignedFree(uint8_t* ptr) {
+  if (ptr == NULL) {
+    return;
+  }
+
+  void* unaligned;
+  memcpy(&unaligned, ptr - sizeof(void*), sizeof(void*));
+  ArrowFree(unaligned);
+}
+
+static uint8_t* ArrowBufferAllocatorAlignedReallocate(
+    struct ArrowBufferAllocator* allocator, uint8_t* ptr, int64_t old_size,
+    int64_t new_size) {
+  int64_t alignment = (int64_t)(intptr_t)allocator->private_data;
+  if (new_size > (INT64_MAX - 3 * alignment)) {
+    return NULL;
+  }
+
+  // Allocations are padded to a multiple of the alignment so that consumers
+  // can process whole blocks without a scalar loop for the tail
+  int64_t old_padded_size = (old_size + alignment - 1) & ~(alignment - 1);
+  int64_t new_padded_size = (new_size + alignment - 1) & ~(alignment - 1);
+  if (ptr != NULL && new_padded_size == old_padded_size) {
+    // Bytes released by shrinking in place become part of the zeroed padding
+    if (new_size < old_size) {
+      memset(ptr + new_size, 0, old_size - new_size);
+    }
+
+    return ptr;
+  }
+
+  if (new_size == 0) {
+    ArrowAlignedFree(ptr);
+    return NULL;
+  }
+
+  uint8_t* new_ptr = ArrowAlignedMalloc(new_padded_size, alignment);
+  if (new_ptr == NULL) {
+    return NULL;
+  }
+
+  int64_t n_copy = 0;
+  if (ptr != NULL) {
+    n_copy = old_size < new_size ? old_size : new_size;
+    memcpy(new_ptr, ptr, n_copy);
+    ArrowAlignedFree(ptr);
+  }
+
+  // Zero the padding so that its contents is deterministic
+  memset(new_ptr + new_size, 0, new_padded_size - new_size);
+  return new_ptr;
+}
+
+static void ArrowBufferAllocatorAlignedFree(struct ArrowBufferAllocator* allocator,
+                                            uint8_t* ptr, int64_t size) {
+  ArrowAlignedFree(ptr);
+}
+
+struct ArrowBufferAllocator ArrowBufferAllocatorAligned(int64_t alignment) {
+  // The pointer to free is stored before the aligned pointer, so the alignment
+  // must be at least large enough to hold it
+  int64_t actual_alignment = sizeof(void*);
+  while (actual_alignment < alignment) {
+    actual_alignment *= 2;
+  }
+
+  struct ArrowBufferAllocator allocator;
+  allocator.reallocate = &ArrowBufferAllocatorAlignedReallocate;
+  allocator.free = &ArrowBufferAllocatorAlignedFree;
+  allocator.private_data = (void*)(intptr_t)actual_alignment;
+  return allocator;
+}
+
+// Allocations carved out of an arena are aligned to this many bytes
+#define NANOARROW_ARENA_ALIGNMENT 64
+
+struct ArrowArenaChunk {
+  struct ArrowArenaChunk* next;
+  uint8_t* data;
+  int64_t capacity_bytes;
+  int64_t size_bytes;
+};
+
+struct ArrowArena {
+  // The most recently allocated chunk, from which new allocations are carved
+  struct ArrowArenaChunk* chunks;
+  int64_t chunk_size;
+
+  // The most recent allocation, which can be grown or shrunk in place
+  uint8_t* last_ptr;
+
+  // One reference for the creator plus one for each live allocation
+  int64_t n_references;
+};
+
+static void ArrowArenaReleaseReference(struct ArrowArena* arena) {
+  arena->n_references--;
+  if (arena->n_references > 0) {
+    return;
+  }
+
+  struct ArrowArenaChunk* chunk = arena->chunks;
+  while (chunk != NULL) {
+    struct ArrowArenaChunk* next = chunk->next;
+    ArrowFree(chunk);
+    chunk = next;
+  }
+
+  ArrowFree(arena);
+}
+
+static int64_t ArrowArenaAlign(int64_t value) {
+  return (value + NANOARROW_ARENA_ALIGNMENT - 1) &
+         ~((int64_t)NANOARROW_ARENA_ALIGNMENT - 1);
+}
+
+static uint8_t* ArrowArenaAllocate(struct ArrowArena* arena, int64_t size) {
+  struct ArrowArenaChunk* chunk = arena->chunks;
+  if (chunk == NULL || (chunk->capacity_bytes - chunk->size_bytes) < size) {
+    // Requests larger than the chunk size get a chunk of their own
+    int64_t capacity_bytes = size > arena->chunk_size ? size : arena->chunk_size;
+    chunk = (struct ArrowArenaChunk*)ArrowMalloc(
+        sizeof(struct ArrowArenaChunk) + NANOARROW_ARENA_ALIGNMENT + capacity_bytes);
+    if (chunk == NULL) {
+      return NULL;
+    }
+
+    uintptr_t address = (uintptr_t)(chunk + 1);
+    address = (address + NANOARROW_ARENA_ALIGNMENT - 1) &
+              ~((uintptr_t)NANOARROW_ARENA_ALIGNMENT - 1);
+    chunk->data = (uint8_t*)address;
+    chunk->capacity_bytes = capacity_bytes;
+    chunk->size_bytes = 0;
+    chunk->next = arena->chunks;
+    arena->chunks = chunk;
+  }
+
+  uint8_t* ptr = chunk->data + chunk->size_bytes;
+  chunk->size_bytes += size;
+  arena->last_ptr = ptr;
+  return ptr;
+}
+
+static uint8_t* ArrowBufferAllocatorArenaReallocate(
+    struct ArrowBufferAllocator* allocator, uint8_t* ptr, int64_t old_size,
+    int64_t new_size) {
+  struct ArrowArena* arena = (struct ArrowArena*)allocator->private_data;
+  if (new_size > (INT64_MAX - 3 * NANOARROW_ARENA_ALIGNMENT)) {
+    if (ptr != NULL) {
+      ArrowArenaReleaseReference(arena);
+    }
+    return NULL;
+  }
+
+  int64_t old_aligned_size = ArrowArenaAlign(old_size);
+  int64_t new_aligned_size = ArrowArenaAlign(new_size);
+
+  if (ptr == NULL) {
+    if (new_size == 0) {
+      return NULL;
+    }
+
+    uint8_t* new_ptr = ArrowArenaAllocate(arena, new_aligned_size);
+    if (new_ptr != NULL) {
+      arena->n_references++;
+    }
+
+    return new_ptr;
+  }
+
+  if (new_size == 0) {
+    allocator->free(allocator, ptr, old_size);
+    return NULL;
+  }
+
+  // The most recent allocation can grow or shrink in place if it fits
+  struct ArrowArenaChunk* chunk = arena->chunks;
+  if (ptr == arena->last_ptr) {
+    int64_t offset = ptr - chunk->data;
+    if ((offset + new_aligned_size) <= chunk->capacity_bytes) {
+      chunk->size_bytes = offset + new_aligned_size;
+      return ptr;
+    }
+  } else if (new_aligned_size <= old_aligned_size) {
+    return ptr;
+  }
+
+  uint8_t* new_ptr = ArrowArenaAllocate(arena, new_aligned_size);
+  if (new_ptr == NULL) {
+    // The caller no longer has a reference to ptr
+    ArrowArenaReleaseReference(arena);
+    return NULL;
+  }
+
+  memcpy(new_ptr, ptr, old_size < new_size ? old_size : new_size);
+  return new_ptr;
+}
+
+static void ArrowBufferAllocatorArenaFree(struct ArrowBufferAllocator* allocator,
+                                          uint8_t* ptr, int64_t size) {
+  struct ArrowArena* arena = (struct ArrowArena*)allocator->private_data;
+  if (ptr == NULL) {
+    return;
+  }
+
+  // Space for the most recent allocation can be reused immediately
+  if (ptr == arena->last_ptr) {
+    arena->chunks->size_bytes = ptr - arena->chunks->data;
+    arena->last_ptr = NULL;
+  }
+
+  ArrowArenaReleaseReference(arena);
+}
+
+ArrowErrorCode ArrowBufferAllocatorArenaInit(struct ArrowBufferAllocator* allocator,
+                                             int64_t chunk_size) {
+  if (chunk_size <= 0) {
+    return EINVAL;
+  }
+
+  struct ArrowArena* arena = (struct ArrowArena*)ArrowMalloc(sizeof(struct ArrowArena));
+  if (arena == NULL) {
+    return ENOMEM;
+  }
+
+  arena->chunks = NULL;
+  arena->chunk_size = ArrowArenaAlign(chunk_size);
+  arena->last_ptr = NULL;
+  arena->n_references = 1;
+
+  allocator->reallocate = &ArrowBufferAllocatorArenaReallocate;
+  allocator->free = &ArrowBufferAllocatorArenaFree;
+  allocator->private_data = arena;
+  return NANOARROW_OK;
+}
+
+void ArrowBufferAllocatorArenaRelease(struct ArrowBufferAllocator* allocator) {
+  ArrowArenaReleaseReference((struct ArrowArena*)allocator->private_data);
+  allocator->private_data = NULL;
+}
+
+// Pooled blocks have a power-of-two capacity between
+// 2 ^ NANOARROW_POOL_MIN_SIZE_CLASS and 2 ^ NANOARROW_POOL_MAX_SIZE_CLASS bytes;
+// larger allocations are passed directly to ArrowMalloc()/ArrowFree().
+#define NANOARROW_POOL_MIN_SIZE_CLASS 6
+#define NANOARROW_POOL_MAX_SIZE_CLASS 30
+#define NANOARROW_POOL_N_SIZE_CLASSES \
+  (NANOARROW_POOL_MAX_SIZE_CLASS - NANOARROW_POOL_MIN_SIZE_CLASS + 1)
+
+int ArrowBufferPoolIsThreadSafe(void) { return NANOARROW_USE_STDATOMIC; }
+
+// Blocks that are not in use are kept in a singly-linked list per size class
+// whose next pointers are stored in the first bytes of each block
+struct ArrowBufferPool {
+  ArrowSpinLock lock;
+  uint8_t* free_blocks[NANOARROW_POOL_N_SIZE_CLASSES];
+  int64_t max_bytes_retained;
+  struct ArrowBufferPoolStats stats;
+
+  // One reference for the creator plus one for each live allocation
+  int64_t n_references;
+};
+
+// Returns the size class for an allocation of size bytes or -1 if it is too
+// large to be pooled
+static int ArrowBufferPoolSizeClass(int64_t size) {
+  int size_class = NANOARROW_POOL_MIN_SIZE_CLASS;
+  while (size_class <= NANOARROW_POOL_MAX_SIZE_CLASS &&
+         (((int64_t)1) << size_class) < size) {
+    size_class++;
+  }
+
+  if (size_class > NANOARROW_POOL_MAX_SIZE_CLASS) {
+    return -1;
+  } else {
+    return size_class - NANOARROW_POOL_MIN_SIZE_CLASS;
+  }
+}
+
+// Must be called with the lock held
+static void ArrowBufferPoolTrimInternal(struct ArrowBufferPool* pool) {
+  for (int i = 0; i < NANOARROW_POOL_N_SIZE_CLASSES; i++) {
+    uint8_t* block = pool->free_blocks[i];
+    while (block != NULL) {
+      uint8_t* next;
+      memcpy(&next, block, sizeof(uint8_t*));
+      ArrowFree(block);
+      block = next;
+    }
+
+    pool->free_blocks[i] = NULL;
+  }
+
+  pool->stats.bytes_retained = 0;
+}
+
+// Must be called with the lock held. Returns non-zero if the pool was
+// destroyed (in which case the lock no longer exists).
+static int ArrowBufferPoolReleaseReferenceInternal(struct ArrowBufferPool* pool) {
+  pool->n_references--;
+  if (pool->n_references > 0) {
+    return 0;
+  }
+
+  ArrowBufferPoolTrimInternal(pool);
+  ArrowFree(pool);
+  return 1;
+}
+
+static uint8_t* ArrowBufferPoolAllocate(struct ArrowBufferPool* pool, int64_t size) {
+  int size_class = ArrowBufferPoolSizeClass(size);
+  uint8_t* block = NULL;
+
+  ArrowSpinLockAcquire(&pool->lock);
+  if (size_class >= 0 && pool->free_blocks[size_class] != NULL) {
+    block = pool->free_blocks[size_class];
+    memcpy(&pool->free_blocks[size_class], block, sizeof(uint8_t*));
+    pool->stats.bytes_retained -= ((int64_t)1)
+                                  << (size_class + NANOARROW_POOL_MIN_SIZE_CLASS);
+    pool->stats.n_hits++;
+  } else {
+    pool->stats.n_misses++;
+  }
+  pool->n_references++;
+  ArrowSpinLockRelease(&pool->lock);
+
+  if (block != NULL) {
+    return block;
+  }
+
+  if (size_class >= 0) {
+    block = (uint8_t*)ArrowMalloc(((int64_t)1)
+                                  << (size_class + NANOARROW_POOL_MIN_SIZE_CLASS));
+  } else {
+    block = (uint8_t*)ArrowMalloc(size);
+  }
+
+  if (block == NULL) {
+    ArrowSpinLockAcquire(&pool->lock);
+    if (!ArrowBufferPoolReleaseReferenceInternal(pool)) {
+      ArrowSpinLockRelease(&pool->lock);
+    }
+  }
+
+  return block;
+}
+
+static void ArrowBufferPoolDeallocate(struct ArrowBufferPool* pool, uint8_t* block,
+                                      int64_t size) {
+  int size_class = ArrowBufferPoolSizeClass(size);
+
+  ArrowSpinLockAcquire(&pool->lock);
+  if (size_class >= 0) {
+    int64_t block_size = ((int64_t)1) << (size_class + NANOARROW_POOL_MIN_SIZE_CLASS);
+    if ((pool->stats.bytes_retained + block_size) <= pool->max_bytes_retained) {
+      memcpy(block, &pool->free_blocks[size_class], sizeof(uint8_t*));
+      pool->free_blocks[size_class] = block;
+      pool->stats.bytes_retained += block_size;
+      block = NULL;
+    }
+  }
+
+  if (!ArrowBufferPoolReleaseReferenceInternal(pool)) {
+    ArrowSpinLockRelease(&pool->lock);
+  }
+
+  ArrowFree(block);
+}
+
+static uint8_t* ArrowBufferAllocatorPoolReallocate(struct ArrowBufferAllocator* allocator,
+                                                   uint8_t* ptr, int64_t old_size,
+                                                   int64_t new_size) {
+  struct ArrowBufferPool* pool = (struct ArrowBufferPool*)allocator->private_data;
+
+  if (ptr == NULL && new_size == 0) {
+    return NULL;
+  }
+
+  if (ptr != NULL && new_size == 0) {
+    ArrowBufferPoolDeallocate(pool, ptr, old_size);
+    return NULL;
+  }
+
+  // The block that was handed out may already be large enough
+  int old_size_class = ArrowBufferPoolSizeClass(old_size);
+  int new_size_class = ArrowBufferPoolSizeClass(new_size);
+  if (ptr != NULL && old_size_class >= 0 && old_size_class == new_size_class) {
+    return ptr;
+  }
+
+  uint8_t* new_ptr = ArrowBufferPoolAllocate(pool, new_size);
+  if (ptr == NULL) {
+    return new_ptr;
+  }
+
+  if (new_ptr != NULL) {
+    memcpy(new_ptr, ptr, old_size < new_size ? old_size : new_size);
+  }
+
+  // On failure the caller no longer has a reference to ptr either
+  ArrowBufferPoolDeallocate(pool, ptr, old_size);
+  return new_ptr;
+}
+
+static void ArrowBufferAllocatorPoolFree(struct ArrowBufferAllocator* allocator,
+                                         uint8_t* ptr, int64_t size) {
+  if (ptr != NULL) {
+    ArrowBufferPoolDeallocate((struct ArrowBufferPool*)allocator->private_data, ptr,
+                              size);
+  }
+}
+
+ArrowErrorCode ArrowBufferAllocatorPoolInit(struct ArrowBufferAllocator* allocator,
+                                            int64_t max_bytes_retained) {
+  if (max_bytes_retained < 0) {
+    return EINVAL;
+  }
+
+  struct ArrowBufferPool* pool =
+      (struct ArrowBufferPool*)ArrowMalloc(sizeof(struct ArrowBufferPool));
+  if (pool == NULL) {
+    return ENOMEM;
+  }
+
+  ArrowSpinLockInit(&pool->lock);
+  for (int i = 0; i < NANOARROW_POOL_N_SIZE_CLASSES; i++) {
+    pool->free_blocks[i] = NULL;
+  }
+  pool->max_bytes_retained = max_bytes_retained;
+  pool->stats.n_hits = 0;
+  pool->stats.n_misses = 0;
+  pool->stats.bytes_retained = 0;
+  pool->n_references = 1;
+
+  allocator->reallocate = &ArrowBufferAllocatorPoolReallocate;
+  allocator->free = &ArrowBufferAllocatorPoolFree;
+  allocator->private_data = pool;
+  return NANOARROW_OK;
+}
+
+void ArrowBufferAllocatorPoolStats(struct ArrowBufferAllocator* allocator,
+                                   struct ArrowBufferPoolStats* out) {
+  struct ArrowBufferPool* pool = (struct ArrowBufferPool*)allocator->private_data;
+  ArrowSpinLockAcquire(&pool->lock);
+  *out = pool->stats;
+  ArrowSpinLockRelease(&pool->lock);
+}
+
+void ArrowBufferAllocatorPoolTrim(struct ArrowBufferAllocator* allocator) {
+  struct ArrowBufferPool* pool = (struct ArrowBufferPool*)allocator->private_data;
+  ArrowSpinLockAcquire(&pool->lock);
+  ArrowBufferPoolTrimInternal(pool);
+  ArrowSpinLockRelease(&pool->lock);
+}
+
+void ArrowBufferAllocatorPoolRelease(struct ArrowBufferAllocator* allocator) {
+  struct ArrowBufferPool* pool = (struct ArrowBufferPool*)allocator->private_data;
+  ArrowSpinLockAcquire(&pool->lock);
+  if (!ArrowBufferPoolReleaseReferenceInternal(pool)) {
+    ArrowSpinLockRelease(&pool->lock);
+  }
+
+  allocator->private_data = NULL;
+}
+
+#if NANOARROW_HAVE_MREMAP
+static int64_t ArrowMmapSize(int64_t size) {
+  int64_t page_size = (int64_t)sysconf(_SC_PAGESIZE);
+  return (size + page_size - 1) & ~(page_size - 1);
+}
+
+static uint8_t* ArrowMmapAllocate(int64_t size) {
+  void* ptr = mmap(NULL, ArrowMmapSize(size), PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ptr == MAP_FAILED) {
+    return NULL;
+  }
+
+#if defined(MADV_HUGEPAGE)
+  // This is a hint that may be ignored (e.g., if transparent huge pages are
+  // disabled), so failure here is not an error
+  madvise(ptr, ArrowMmapSize(size), MADV_HUGEPAGE);
+#endif
+
+  return (uint8_t*)ptr;
+}
+
+static uint8_t* ArrowMmapReallocate(uint8_t* ptr, int64_t old_size, int64_t new_size) {
+  void* new_ptr =
+      mremap(ptr, ArrowMmapSize(old_size), ArrowMmapSize(new_size), MREMAP_MAYMOVE);
+  if (new_ptr == MAP_FAILED) {
+    return NULL;
+  }
+
+#if defined(MADV_HUGEPAGE)
+  madvise(new_ptr, ArrowMmapSize(new_size), MADV_HUGEPAGE);
+#endif
+
+  return (uint8_t*)new_ptr;
+}
+
+static void ArrowMmapFree(uint8_t* ptr, int64_t size) {
+  munmap(ptr, ArrowMmapSize(size));
+}
+
+// Allocations of at least threshold bytes are mapped; smaller allocations use
+// ArrowMalloc(). Which one was used is derived from the size passed by the
+// caller.
+static uint8_t* ArrowBufferAllocatorHugePagesReallocate(
+    struct ArrowBufferAllocator* allocator, uint8_t* ptr, int64_t old_size,
+    int64_t new_size) {
+  int64_t threshold = (int64_t)(intptr_t)allocator->private_data;
+  int old_is_mapped = ptr != NULL && old_size >= threshold;
+  int new_is_mapped = new_size > 0 && new_size >= threshold;
+
+  if (new_size > (INT64_MAX / 2)) {
+    return NULL;
+  }
+
+  if (old_is_mapped && new_is_mapped) {
+    return ArrowMmapReallocate(ptr, old_size, new_size);
+  } else if (!old_is_mapped && !new_is_mapped) {
+    return (uint8_t*)ArrowRealloc(ptr, new_size);
+  }
+
+  uint8_t* new_ptr;
+  if (new_is_mapped) {
+    new_ptr = ArrowMmapAllocate(new_size);
+  } else if (new_size > 0) {
+    new_ptr = (uint8_t*)ArrowMalloc(new_size);
+  } else {
+    new_ptr = NULL;
+  }
+
+  if (new_ptr == NULL && new_size > 0) {
+    return NULL;
+  }
+
+  if (ptr != NULL) {
+    memcpy(new_ptr, ptr, old_size < new_size ? old_size : new_size);
+    if (old_is_mapped) {
+      ArrowMmapFree(ptr, old_size);
+    } else {
+      ArrowFree(ptr);
+    }
+  }
+
+  return new_ptr;
+}
+
+static void ArrowBufferAllocatorHugePagesFree(struct ArrowBufferAllocator* allocator,
+                                              uint8_t* ptr, int64_t size) {
+  int64_t threshold = (int64_t)(intptr_t)allocator->private_data;
+  if (ptr == NULL) {
+    return;
+  }
+
+  if (size >= threshold) {
+    ArrowMmapFree(ptr, size);
+  } else {
+    ArrowFree(ptr);
+  }
+}
+
+struct ArrowBufferAllocator ArrowBufferAllocatorHugePages(int64_t threshold_bytes) {
+  struct ArrowBufferAllocator allocator;
+  allocator.reallocate = &ArrowBufferAllocatorHugePagesReallocate;
+  allocator.free = &ArrowBufferAllocatorHugePagesFree;
+  allocator.private_data = (void*)(intptr_t)threshold_bytes;
+  return allocator;
+}
+#else
+struct ArrowBufferAllocator ArrowBufferAllocatorHugePages(int64_t threshold_bytes) {
+  return ArrowBufferAllocatorDefault();
+}
+#endif
+
+static uint8_t* ArrowBufferAllocatorTrackingReallocate(
+    struct ArrowBufferAllocator* allocator, uint8_t* ptr, int64_t old_size,
+    int64_t new_size) {
+  struct ArrowBufferAllocatorTracker* tracker =
+      (struct ArrowBufferAllocatorTracker*)allocator->private_data;
+  uint8_t* new_ptr =
+      tracker->allocator.reallocate(&tracker->allocator, ptr, old_size, new_size);
+
+  if (ptr != NULL) {
+    // Whether or not the reallocation succeeded, ptr is no longer valid
+    tracker->bytes_allocated -= old_size;
+  }
+
+  if (new_ptr == NULL) {
+    if (ptr != NULL) {
+      tracker->n_frees++;
+    }
+
+    return NULL;
+  }
+
+  if (ptr == NULL) {
+    tracker->n_allocations++;
+  } else {
+    tracker->n_reallocations++;
+    tracker->n_reallocations_moved += new_ptr != ptr;
+  }
+
+  tracker->bytes_allocated += new_size;
+  if (tracker->bytes_allocated > tracker->peak_bytes_allocated) {
+    tracker->peak_bytes_allocated = tracker->bytes_allocated;
+  }
+
+  return new_ptr;
+}
+
+static void ArrowBufferAllocatorTrackingFree(struct ArrowBufferAllocator* allocator,
+                                             uint8_t* ptr, int64_t size) {
+  struct ArrowBufferAllocatorTracker* tracker =
+      (struct ArrowBufferAllocatorTracker*)allocator->private_data;
+  tracker->allocator.free(&tracker->allocator, ptr, size);
+  if (ptr != NULL) {
+    tracker->bytes_allocated -= size;
+    tracker->n_frees++;
+  }
+}
+
+void ArrowBufferAllocatorTrackerInit(struct ArrowBufferAllocatorTracker* tracker,
+                                     struct ArrowBufferAllocator allocator) {
+  tracker->allocator = allocator;
+  tracker->bytes_allocated = 0;
+  tracker->peak_bytes_allocated = 0;
+  tracker->n_allocations = 0;
+  tracker->n_reallocations = 0;
+  tracker->n_reallocations_moved = 0;
+  tracker->n_frees = 0;
+}
+
+struct ArrowBufferAllocator ArrowBufferAllocatorTracking(
+    struct ArrowBufferAllocatorTracker* tracker) {
+  struct ArrowBufferAllocator allocator;
+  allocator.reallocate = &ArrowBufferAllocatorTrackingReallocate;
+  allocator.free = &ArrowBufferAllocatorTrackingFree;
+  allocator.private_data = tracker;
+  return allocator;
+}
+
 static uint8_t* ArrowBufferAllocatorNeverReallocate(
     struct ArrowBufferAllocator* allocator, uint8_t* ptr, int64_t old_size,
     int64_t new_size) {
@@ -17,6 +17,7 @@
 
 #include <cstring>
 #include <string>
+#include <vector>
 
 #include <arrow/memory_pool.h>
 #include <arrow/util/decimal.h>
@@ -31,6 +32,17 @@ TEST(BuildIdTest, VersionTest) {
   EXPECT_EQ(ArrowNanoarrowVersionInt(), NANOARROW_VERSION_INT);
 }
 
+TEST(UtilsTest, UtilsTestCpuFeatures) {
+  int features = ArrowCpuFeatures();
+  EXPECT_GE(features, 0);
+  EXPECT_EQ(features & ~(NANOARROW_CPU_POPCNT | NANOARROW_CPU_AVX2 |
+                         NANOARROW_CPU_AVX512 | NANOARROW_CPU_NEON | NANOARROW_CPU_SVE),
+            0);
+
+  // Features are detected once
+  EXPECT_EQ(ArrowCpuFeatures(), features);
+}
+
 TEST(ErrorTest, ErrorTestInit) {
   struct ArrowError error;
   memset(&error.message, 0xff, sizeof(ArrowError));
@@ -78,6 +90,76 @@ TEST(ErrorTest, ErrorTestAssertNotOkDebug) {
 TEST(ErrorTest, ErrorTestAssertNotOkRelease) { NANOARROW_ASSERT_OK(EINVAL); }
 #endif
 
+struct TraceRecord {
+  enum ArrowTraceEvent event;
+  int64_t arg0;
+  int64_t arg1;
+};
+
+static void RecordTraceEvent(enum ArrowTraceEvent event, int64_t arg0, int64_t arg1,
+                             void* private_data) {
+  auto records = reinterpret_cast<std::vector<TraceRecord>*>(private_data);
+  records->push_back({event, arg0, arg1});
+}
+
+TEST(TraceTest, TraceTestCallback) {
+  std::vector<TraceRecord> records;
+  ArrowTraceSetCallback(&RecordTraceEvent, &records);
+
+  // Calling ArrowTrace() directly always calls the callback
+  ArrowTrace(NANOARROW_TRACE_IPC_DECODE_SCHEMA_BEGIN, 1, 2);
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].event, NANOARROW_TRACE_IPC_DECODE_SCHEMA_BEGIN);
+  EXPECT_EQ(records[0].arg0, 1);
+  EXPECT_EQ(records[0].arg1, 2);
+  records.clear();
+
+  struct ArrowBuffer buffer;
+  ArrowBufferInit(&buffer);
+  ASSERT_EQ(ArrowBufferReserve(&buffer, 64), NANOARROW_OK);
+  ArrowBufferReset(&buffer);
+
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(&array, 1), NANOARROW_OK);
+  records.clear();
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  array.release(&array);
+
+  ArrowTraceSetCallback(nullptr, nullptr);
+  ArrowTrace(NANOARROW_TRACE_IPC_DECODE_SCHEMA_BEGIN, 1, 2);
+
+#if defined(NANOARROW_WITH_TRACE)
+  ASSERT_GE(records.size(), 2);
+  EXPECT_EQ(records.front().event, NANOARROW_TRACE_ARRAY_FINISH_BUILDING_BEGIN);
+  EXPECT_EQ(records.front().arg0, NANOARROW_VALIDATION_LEVEL_DEFAULT);
+  EXPECT_EQ(records.front().arg1, 1);
+  EXPECT_EQ(records.back().event, NANOARROW_TRACE_ARRAY_FINISH_BUILDING_END);
+  EXPECT_EQ(records.back().arg0, NANOARROW_OK);
+#else
+  EXPECT_TRUE(records.empty());
+#endif
+}
+
+#if defined(NANOARROW_WITH_TRACE)
+TEST(TraceTest, TraceTestBufferReallocate) {
+  std::vector<TraceRecord> records;
+  ArrowTraceSetCallback(&RecordTraceEvent, &records);
+
+  struct ArrowBuffer buffer;
+  ArrowBufferInit(&buffer);
+  ASSERT_EQ(ArrowBufferReserve(&buffer, 64), NANOARROW_OK);
+  ArrowBufferReset(&buffer);
+  ArrowTraceSetCallback(nullptr, nullptr);
+
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].event, NANOARROW_TRACE_BUFFER_REALLOCATE);
+  EXPECT_EQ(records[0].arg0, 0);
+  EXPECT_EQ(records[0].arg1, 64);
+}
+#endif
+
 static uint8_t* MemoryPoolReallocate(struct ArrowBufferAllocator* allocator, uint8_t* ptr,
                                      int64_t old_size, int64_t new_size) {
   MemoryPool* pool = reinterpret_cast<MemoryPool*>(allocator->private_data);
@@ -123,6 +205,302 @@ TEST(AllocatorTest, AllocatorTestDefault) {
   EXPECT_EQ(buffer, nullptr);
 }
 
+TEST(AllocatorTest, AllocatorTestAligned) {
+  for (int64_t alignment : {0, 1, 7, 8, 16, 64, 128}) {
+    struct ArrowBufferAllocator allocator = ArrowBufferAllocatorAligned(alignment);
+    int64_t actual_alignment =
+        alignment < static_cast<int64_t>(sizeof(void*)) ? sizeof(void*) : alignment;
+
+    uint8_t* buffer = allocator.reallocate(&allocator, nullptr, 0, 10);
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer) % actual_alignment, 0);
+    const char* test_str = "abcdefg";
+    memcpy(buffer, test_str, strlen(test_str) + 1);
+
+    // Padding is zeroed
+    for (int64_t i = 10; i < actual_alignment; i++) {
+      EXPECT_EQ(buffer[i], 0);
+    }
+
+    buffer = allocator.reallocate(&allocator, buffer, 10, 1000);
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer) % actual_alignment, 0);
+    EXPECT_STREQ(reinterpret_cast<const char*>(buffer), test_str);
+
+    buffer = allocator.reallocate(&allocator, buffer, 1000, 4);
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer) % actual_alignment, 0);
+    EXPECT_EQ(memcmp(buffer, test_str, 4), 0);
+
+    allocator.free(&allocator, buffer, 4);
+
+    // Shrinking within the same padded size zeroes the released bytes
+    struct ArrowBuffer shrunk;
+    ArrowBufferInit(&shrunk);
+    ASSERT_EQ(ArrowBufferSetAllocator(&shrunk, allocator), NANOARROW_OK);
+    ASSERT_EQ(ArrowBufferAppendFill(&shrunk, 0xff, 6), NANOARROW_OK);
+    ASSERT_EQ(ArrowBufferResize(&shrunk, 2, true), NANOARROW_OK);
+    for (int64_t i = 2; i < actual_alignment; i++) {
+      EXPECT_EQ(shrunk.data[i], 0) << i;
+    }
+    ArrowBufferReset(&shrunk);
+
+    EXPECT_EQ(
+        allocator.reallocate(&allocator, nullptr, 0, std::numeric_limits<int64_t>::max()),
+        nullptr);
+  }
+}
+
+TEST(AllocatorTest, AllocatorTestArena) {
+  struct ArrowBufferAllocator allocator;
+  EXPECT_EQ(ArrowBufferAllocatorArenaInit(&allocator, 0), EINVAL);
+  ASSERT_EQ(ArrowBufferAllocatorArenaInit(&allocator, 1024), NANOARROW_OK);
+
+  // Allocations are aligned and the most recent one grows in place
+  uint8_t* buffer0 = allocator.reallocate(&allocator, nullptr, 0, 10);
+  ASSERT_NE(buffer0, nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer0) % 64, 0);
+  memcpy(buffer0, "abcdefghi", 10);
+  EXPECT_EQ(allocator.reallocate(&allocator, buffer0, 10, 100), buffer0);
+
+  // Once another allocation has been made, growing requires a copy
+  uint8_t* buffer1 = allocator.reallocate(&allocator, nullptr, 0, 10);
+  ASSERT_NE(buffer1, nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer1) % 64, 0);
+  EXPECT_NE(buffer1, buffer0);
+  uint8_t* buffer0_grown = allocator.reallocate(&allocator, buffer0, 100, 200);
+  ASSERT_NE(buffer0_grown, nullptr);
+  EXPECT_NE(buffer0_grown, buffer0);
+  EXPECT_STREQ(reinterpret_cast<const char*>(buffer0_grown), "abcdefghi");
+
+  // Allocations larger than the chunk size get a chunk of their own
+  uint8_t* buffer2 = allocator.reallocate(&allocator, nullptr, 0, 10000);
+  ASSERT_NE(buffer2, nullptr);
+  memset(buffer2, 0, 10000);
+
+  EXPECT_EQ(
+      allocator.reallocate(&allocator, nullptr, 0, std::numeric_limits<int64_t>::max()),
+      nullptr);
+
+  // The arena stays alive until all allocations and the creator's reference
+  // have been released
+  struct ArrowBufferAllocator buffer_allocator = allocator;
+  ArrowBufferAllocatorArenaRelease(&allocator);
+  EXPECT_EQ(allocator.private_data, nullptr);
+
+  buffer_allocator.free(&buffer_allocator, buffer1, 10);
+  buffer_allocator.free(&buffer_allocator, buffer2, 10000);
+  EXPECT_STREQ(reinterpret_cast<const char*>(buffer0_grown), "abcdefghi");
+  buffer_allocator.free(&buffer_allocator, buffer0_grown, 200);
+}
+
+TEST(AllocatorTest, AllocatorTestArenaArray) {
+  struct ArrowBufferAllocator allocator;
+  ASSERT_EQ(ArrowBufferAllocatorArenaInit(&allocator, 4096), NANOARROW_OK);
+
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArraySetAllocator(&array, allocator), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("abcdef")), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  ArrowBufferAllocatorArenaRelease(&allocator);
+
+  struct ArrowArrayView array_view;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(array_view.length, 2000);
+  EXPECT_EQ(ArrowArrayViewIsNull(&array_view, 1999), 1);
+  struct ArrowStringView item = ArrowArrayViewGetStringUnsafe(&array_view, 1998);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), "abcdef");
+  ArrowArrayViewReset(&array_view);
+
+  // Releasing the array frees the arena
+  array.release(&array);
+}
+
+TEST(AllocatorTest, AllocatorTestPool) {
+  struct ArrowBufferAllocator allocator;
+  EXPECT_EQ(ArrowBufferAllocatorPoolInit(&allocator, -1), EINVAL);
+  ASSERT_EQ(ArrowBufferAllocatorPoolInit(&allocator, 1024), NANOARROW_OK);
+
+  struct ArrowBufferPoolStats stats;
+  uint8_t* buffer = allocator.reallocate(&allocator, nullptr, 0, 10);
+  ASSERT_NE(buffer, nullptr);
+  memcpy(buffer, "abcdefghi", 10);
+
+  // Growing within a size class does not move the block
+  EXPECT_EQ(allocator.reallocate(&allocator, buffer, 10, 64), buffer);
+  buffer = allocator.reallocate(&allocator, buffer, 64, 100);
+  ASSERT_NE(buffer, nullptr);
+  EXPECT_STREQ(reinterpret_cast<const char*>(buffer), "abcdefghi");
+
+  ArrowBufferAllocatorPoolStats(&allocator, &stats);
+  EXPECT_EQ(stats.n_hits, 0);
+  EXPECT_EQ(stats.n_misses, 2);
+  EXPECT_EQ(stats.bytes_retained, 64);
+
+  // Freeing and reallocating the same size class reuses the block
+  allocator.free(&allocator, buffer, 100);
+  ArrowBufferAllocatorPoolStats(&allocator, &stats);
+  EXPECT_EQ(stats.bytes_retained, 64 + 128);
+
+  uint8_t* buffer2 = allocator.reallocate(&allocator, nullptr, 0, 120);
+  EXPECT_EQ(buffer2, buffer);
+  ArrowBufferAllocatorPoolStats(&allocator, &stats);
+  EXPECT_EQ(stats.n_hits, 1);
+  EXPECT_EQ(stats.bytes_retained, 64);
+
+  // Blocks beyond max_bytes_retained are freed
+  uint8_t* big = allocator.reallocate(&allocator, nullptr, 0, 2000);
+  ASSERT_NE(big, nullptr);
+  allocator.free(&allocator, big, 2000);
+  ArrowBufferAllocatorPoolStats(&allocator, &stats);
+  EXPECT_EQ(stats.bytes_retained, 64);
+
+  ArrowBufferAllocatorPoolTrim(&allocator);
+  ArrowBufferAllocatorPoolStats(&allocator, &stats);
+  EXPECT_EQ(stats.bytes_retained, 0);
+
+  EXPECT_EQ(
+      allocator.reallocate(&allocator, nullptr, 0, std::numeric_limits<int64_t>::max()),
+      nullptr);
+
+  // The pool outlives the creator's reference until all blocks are freed
+  struct ArrowBufferAllocator buffer_allocator = allocator;
+  ArrowBufferAllocatorPoolRelease(&allocator);
+  EXPECT_EQ(allocator.private_data, nullptr);
+  buffer_allocator.free(&buffer_allocator, buffer2, 120);
+}
+
+TEST(AllocatorTest, AllocatorTestPoolArrays) {
+  struct ArrowBufferAllocator allocator;
+  ASSERT_EQ(ArrowBufferAllocatorPoolInit(&allocator, 1 << 20), NANOARROW_OK);
+
+  struct ArrowBufferPoolStats stats;
+  for (int batch = 0; batch < 3; batch++) {
+    struct ArrowArray array;
+    ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), NANOARROW_OK);
+    ASSERT_EQ(ArrowArraySetAllocator(&array, allocator), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayReserve(&array, 1000), NANOARROW_OK);
+    for (int i = 0; i < 1000; i++) {
+      ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView("abc")), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+    array.release(&array);
+
+    // After the first batch, every allocation is served by the pool
+    if (batch == 0) {
+      ArrowBufferAllocatorPoolStats(&allocator, &stats);
+    } else {
+      struct ArrowBufferPoolStats batch_stats;
+      ArrowBufferAllocatorPoolStats(&allocator, &batch_stats);
+      EXPECT_EQ(batch_stats.n_misses, stats.n_misses);
+      EXPECT_GT(batch_stats.n_hits, stats.n_hits);
+    }
+  }
+
+  ArrowBufferAllocatorPoolRelease(&allocator);
+}
+
+TEST(AllocatorTest, AllocatorTestHugePages) {
+  struct ArrowBufferAllocator allocator = ArrowBufferAllocatorHugePages(1 << 20);
+
+  // Below the threshold
+  uint8_t* buffer = allocator.reallocate(&allocator, nullptr, 0, 10);
+  ASSERT_NE(buffer, nullptr);
+  memcpy(buffer, "abcdefghi", 10);
+
+  // Across the threshold, above the threshold, and back
+  int64_t old_size = 10;
+  for (int64_t size : {1 << 20, 3 << 20, 10 << 20, 2 << 20, 100}) {
+    buffer = allocator.reallocate(&allocator, buffer, old_size, size);
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_STREQ(reinterpret_cast<const char*>(buffer), "abcdefghi");
+    buffer[size - 1] = 0;
+    old_size = size;
+  }
+
+  allocator.free(&allocator, buffer, old_size);
+
+  buffer = allocator.reallocate(&allocator, nullptr, 0, 4 << 20);
+  ASSERT_NE(buffer, nullptr);
+  memset(buffer, 0, 4 << 20);
+  allocator.free(&allocator, buffer, 4 << 20);
+
+  EXPECT_EQ(
+      allocator.reallocate(&allocator, nullptr, 0, std::numeric_limits<int64_t>::max()),
+      nullptr);
+
+  // Works as a drop-in allocator for a buffer
+  struct ArrowBuffer large;
+  ArrowBufferInit(&large);
+  ASSERT_EQ(ArrowBufferSetAllocator(&large, allocator), NANOARROW_OK);
+  for (int i = 0; i < 100000; i++) {
+    ASSERT_EQ(ArrowBufferAppendInt64(&large, i), NANOARROW_OK);
+  }
+  const int64_t* values = reinterpret_cast<const int64_t*>(large.data);
+  EXPECT_EQ(values[0], 0);
+  EXPECT_EQ(values[99999], 99999);
+  ArrowBufferReset(&large);
+}
+
+TEST(AllocatorTest, AllocatorTestTracking) {
+  struct ArrowBufferAllocatorTracker total;
+  ArrowBufferAllocatorTrackerInit(&total, ArrowBufferAllocatorDefault());
+  struct ArrowBufferAllocatorTracker tagged;
+  ArrowBufferAllocatorTrackerInit(&tagged, ArrowBufferAllocatorTracking(&total));
+
+  struct ArrowBuffer buffer;
+  ArrowBufferInit(&buffer);
+  ASSERT_EQ(ArrowBufferSetAllocator(&buffer, ArrowBufferAllocatorTracking(&tagged)),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowBufferAppend(&buffer, "abcd", 4), NANOARROW_OK);
+  EXPECT_EQ(tagged.bytes_allocated, 4);
+  EXPECT_EQ(tagged.n_allocations, 1);
+
+  ASSERT_EQ(ArrowBufferReserve(&buffer, 1000), NANOARROW_OK);
+  EXPECT_EQ(tagged.bytes_allocated, buffer.capacity_bytes);
+  EXPECT_EQ(tagged.n_reallocations, 1);
+  EXPECT_LE(tagged.n_reallocations_moved, 1);
+
+  ASSERT_EQ(ArrowBufferResize(&buffer, 10, true), NANOARROW_OK);
+  EXPECT_EQ(tagged.bytes_allocated, 10);
+  EXPECT_EQ(tagged.peak_bytes_allocated, 1004);
+
+  struct ArrowBuffer buffer2;
+  ArrowBufferInit(&buffer2);
+  ASSERT_EQ(ArrowBufferSetAllocator(&buffer2, ArrowBufferAllocatorTracking(&total)),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowBufferAppend(&buffer2, "abcd", 4), NANOARROW_OK);
+
+  // The nested tracker includes both buffers
+  EXPECT_EQ(total.bytes_allocated, 14);
+  EXPECT_EQ(total.n_allocations, 2);
+
+  ArrowBufferReset(&buffer);
+  EXPECT_EQ(tagged.bytes_allocated, 0);
+  EXPECT_EQ(tagged.n_frees, 1);
+  EXPECT_EQ(total.bytes_allocated, 4);
+
+  ArrowBufferReset(&buffer2);
+  EXPECT_EQ(total.bytes_allocated, 0);
+  EXPECT_EQ(total.n_frees, 2);
+
+  // A failed allocation is not counted
+  struct ArrowBufferAllocator allocator = ArrowBufferAllocatorTracking(&tagged);
+  EXPECT_EQ(
+      allocator.reallocate(&allocator, nullptr, 0, std::numeric_limits<int64_t>::max()),
+      nullptr);
+  EXPECT_EQ(tagged.n_allocations, 1);
+  EXPECT_EQ(tagged.bytes_allocated, 0);
+}
+
 // In a non-trivial test this struct could hold a reference to an object
 // that keeps the buffer from being garbage collected (e.g., an SEXP in R)
 struct CustomFreeData {
@@ -250,3 +628,112 @@ TEST(DecimalTest, Decimal256Test) {
   ArrowDecimalSetBytes(&decimal, bytes_neg);
   EXPECT_EQ(memcmp(decimal.words, bytes_neg, sizeof(bytes_neg)), 0);
 }
+
+static std::string ArrowDecimalToStdString(struct ArrowDecimal* decimal, bool scaled) {
+  struct ArrowBuffer buffer;
+  ArrowBufferInit(&buffer);
+  int result = scaled ? ArrowDecimalAppendStringToBuffer(decimal, &buffer)
+                      : ArrowDecimalAppendDigitsToBuffer(decimal, &buffer);
+  std::string out = "<error>";
+  if (result == NANOARROW_OK) {
+    out = std::string(reinterpret_cast<char*>(buffer.data), buffer.size_bytes);
+  }
+  ArrowBufferReset(&buffer);
+  return out;
+}
+
+TEST(DecimalTest, DecimalDigitsTest) {
+  struct ArrowDecimal decimal;
+  ArrowDecimalInit(&decimal, 128, 38, 0);
+
+  ASSERT_EQ(ArrowDecimalSetDigits(&decimal, ArrowCharView("12345")), NANOARROW_OK);
+  EXPECT_EQ(ArrowDecimalGetIntUnsafe(&decimal), 12345);
+  ASSERT_EQ(ArrowDecimalSetDigits(&decimal, ArrowCharView("-12345")), NANOARROW_OK);
+  EXPECT_EQ(ArrowDecimalGetIntUnsafe(&decimal), -12345);
+  EXPECT_EQ(ArrowDecimalSign(&decimal), -1);
+  ASSERT_EQ(ArrowDecimalSetDigits(&decimal, ArrowCharView("+007")), NANOARROW_OK);
+  EXPECT_EQ(ArrowDecimalGetIntUnsafe(&decimal), 7);
+  ASSERT_EQ(ArrowDecimalSetDigits(&decimal, ArrowCharView("-0")), NANOARROW_OK);
+  EXPECT_EQ(ArrowDecimalGetIntUnsafe(&decimal), 0);
+  EXPECT_EQ(ArrowDecimalSign(&decimal), 1);
+  EXPECT_EQ(ArrowDecimalToStdString(&decimal, false), "0");
+
+  // 2^64 spans both words
+  ASSERT_EQ(ArrowDecimalSetDigits(&decimal, ArrowCharView("18446744073709551616")),
+            NANOARROW_OK);
+  EXPECT_EQ(decimal.words[decimal.low_word_index], 0);
+  EXPECT_EQ(decimal.words[decimal.high_word_index], 1);
+  EXPECT_EQ(ArrowDecimalToStdString(&decimal, false), "18446744073709551616");
+
+  std::string max_digits(38, '9');
+  for (const std::string& digits : {max_digits, "-" + max_digits,
+                                    std::string("-1000000000"),
+                                    std::string("123456789012345678901234567")}) {
+    ASSERT_EQ(ArrowDecimalSetDigits(&decimal, ArrowCharView(digits.c_str())),
+              NANOARROW_OK);
+    EXPECT_EQ(ArrowDecimalToStdString(&decimal, false), digits);
+  }
+
+  EXPECT_EQ(ArrowDecimalSetDigits(&decimal, ArrowCharView(("1" + max_digits).c_str())),
+            EOVERFLOW);
+  EXPECT_EQ(ArrowDecimalSetDigits(&decimal, ArrowCharView("")), EINVAL);
+  EXPECT_EQ(ArrowDecimalSetDigits(&decimal, ArrowCharView("-")), EINVAL);
+  EXPECT_EQ(ArrowDecimalSetDigits(&decimal, ArrowCharView("12a")), EINVAL);
+  EXPECT_EQ(ArrowDecimalSetDigits(&decimal, ArrowCharView("1.5")), EINVAL);
+
+  ArrowDecimalInit(&decimal, 256, 76, 0);
+  max_digits = std::string(76, '9');
+  for (const std::string& digits : {max_digits, "-" + max_digits, std::string("-1")}) {
+    ASSERT_EQ(ArrowDecimalSetDigits(&decimal, ArrowCharView(digits.c_str())),
+              NANOARROW_OK);
+    EXPECT_EQ(ArrowDecimalToStdString(&decimal, false), digits);
+  }
+
+  ASSERT_EQ(ArrowDecimalSetDigits(&decimal, ArrowCharView("-1")), NANOARROW_OK);
+  for (int i = 0; i < decimal.n_words; i++) {
+    EXPECT_EQ(decimal.words[i], UINT64_MAX);
+  }
+}
+
+TEST(DecimalTest, DecimalStringTest) {
+  struct ArrowDecimal decimal;
+  ArrowDecimalInit(&decimal, 128, 10, 3);
+
+  auto dec_pos = *Decimal128::FromString("12.345");
+  uint8_t bytes_pos[16];
+  dec_pos.ToBytes(bytes_pos);
+  ASSERT_EQ(ArrowDecimalSetString(&decimal, ArrowCharView("12.345")), NANOARROW_OK);
+  EXPECT_EQ(memcmp(decimal.words, bytes_pos, sizeof(bytes_pos)), 0);
+
+  ArrowDecimalInit(&decimal, 128, 10, 2);
+  ASSERT_EQ(ArrowDecimalSetString(&decimal, ArrowCharView("123.45")), NANOARROW_OK);
+  EXPECT_EQ(ArrowDecimalGetIntUnsafe(&decimal), 12345);
+  EXPECT_EQ(ArrowDecimalToStdString(&decimal, true), "123.45");
+  ASSERT_EQ(ArrowDecimalSetString(&decimal, ArrowCharView("-.05")), NANOARROW_OK);
+  EXPECT_EQ(ArrowDecimalGetIntUnsafe(&decimal), -5);
+  EXPECT_EQ(ArrowDecimalToStdString(&decimal, true), "-0.05");
+  ASSERT_EQ(ArrowDecimalSetString(&decimal, ArrowCharView("7")), NANOARROW_OK);
+  EXPECT_EQ(ArrowDecimalGetIntUnsafe(&decimal), 700);
+  EXPECT_EQ(ArrowDecimalToStdString(&decimal, true), "7.00");
+  ASSERT_EQ(ArrowDecimalSetString(&decimal, ArrowCharView("1.230")), NANOARROW_OK);
+  EXPECT_EQ(ArrowDecimalGetIntUnsafe(&decimal), 123);
+  ASSERT_EQ(ArrowDecimalSetString(&decimal, ArrowCharView("0")), NANOARROW_OK);
+  EXPECT_EQ(ArrowDecimalToStdString(&decimal, true), "0.00");
+
+  EXPECT_EQ(ArrowDecimalSetString(&decimal, ArrowCharView("1.234")), EINVAL);
+  EXPECT_EQ(ArrowDecimalSetString(&decimal, ArrowCharView(".")), EINVAL);
+  EXPECT_EQ(ArrowDecimalSetString(&decimal, ArrowCharView("1.2.3")), EINVAL);
+  EXPECT_EQ(ArrowDecimalSetString(&decimal, ArrowCharView("123456789")), EOVERFLOW);
+  EXPECT_EQ(ArrowDecimalSetString(&decimal, ArrowCharView("00012345678.9")),
+            NANOARROW_OK);
+  EXPECT_EQ(ArrowDecimalGetIntUnsafe(&decimal), 1234567890);
+
+  ArrowDecimalInit(&decimal, 256, 10, -2);
+  ASSERT_EQ(ArrowDecimalSetString(&decimal, ArrowCharView("1200")), NANOARROW_OK);
+  EXPECT_EQ(ArrowDecimalGetIntUnsafe(&decimal), 12);
+  EXPECT_EQ(ArrowDecimalToStdString(&decimal, true), "1200");
+  EXPECT_EQ(ArrowDecimalToStdString(&decimal, false), "12");
+  EXPECT_EQ(ArrowDecimalSetString(&decimal, ArrowCharView("1250")), EINVAL);
+  ASSERT_EQ(ArrowDecimalSetString(&decimal, ArrowCharView("0")), NANOARROW_OK);
+  EXPECT_EQ(ArrowDecimalToStdString(&decimal, true), "0");
+}